@@ -18,6 +18,7 @@
 //
 //*****************************************************************************
 
+#ifndef HOST_BUILD
 #include "inc/hw_gpio.h"
 #include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
@@ -30,6 +31,9 @@
 #include "driverlib/rom.h"
 #include "grlib/grlib.h"
 #include "drivers/Kentec320x240x16_ssd2119_8bit.h"
+#else
+#include "tools/ssd2119_emu.h"
+#endif
 
 //*****************************************************************************
 //
@@ -185,15 +189,31 @@
 #define SSD2119_GAMMA_CTRL_8_REG      0x37
 #define SSD2119_GAMMA_CTRL_9_REG      0x3A
 #define SSD2119_GAMMA_CTRL_10_REG     0x3B
+#define SSD2119_V_SCROLL_CTRL_1_REG   0x41
+#define SSD2119_V_SCROLL_CTRL_2_REG   0x42
 #define SSD2119_V_RAM_POS_REG         0x44
 #define SSD2119_H_RAM_START_REG       0x45
 #define SSD2119_H_RAM_END_REG         0x46
+#define SSD2119_FIRST_WIN_START_REG   0x48
+#define SSD2119_FIRST_WIN_END_REG     0x49
+#define SSD2119_SECOND_WIN_START_REG  0x4A
+#define SSD2119_SECOND_WIN_END_REG    0x4B
 #define SSD2119_X_RAM_ADDR_REG        0x4E
 #define SSD2119_Y_RAM_ADDR_REG        0x4F
 
 #define ENTRY_MODE_DEFAULT 0x6830
 #define MAKE_ENTRY_MODE(x) ((ENTRY_MODE_DEFAULT & 0xFF00) | (x))
 
+//
+// Display control register values.  SPT splits the panel into two screens,
+// and VLE1 and VLE2 turn on vertical scrolling for the first and second of
+// them.
+//
+#define DISPLAY_CTRL_DEFAULT 0x0033
+#define DISPLAY_CTRL_SPT     0x0100
+#define DISPLAY_CTRL_VLE1    0x0200
+#define DISPLAY_CTRL_VLE2    0x0400
+
 //*****************************************************************************
 //
 // The dimensions of the LCD panel.
@@ -202,6 +222,15 @@
 #define LCD_VERTICAL_MAX 240
 #define LCD_HORIZONTAL_MAX 320
 
+//*****************************************************************************
+//
+// The number of lines in the scrolling area, or 0 if scrolling is off, and
+// the register that holds the scroll amount for the screen that scrolls.
+//
+//*****************************************************************************
+static unsigned short g_usScrollLines;
+static unsigned char g_ucScrollReg;
+
 //*****************************************************************************
 //
 // Translates a 24-bit RGB color to a display driver-specific color.
@@ -234,12 +263,23 @@ typedef void (*pfnWriteCommand)(unsigned char ucData);
 // Function pointers for low level LCD controller access functions.
 //
 //*****************************************************************************
-
+#ifndef HOST_BUILD
 static void WriteDataGPIO(unsigned short usData);
 static void WriteCommandGPIO(unsigned char ucData);
 
 pfnWriteData WriteData = WriteDataGPIO;
 pfnWriteCommand WriteCommand = WriteCommandGPIO;
+#else
+//
+// A host build drives the controller model in tools/ssd2119_emu.c instead of
+// the GPIO bus.  Everything up to Kentec320x240x16_SSD2119Init() is bus and
+// pin handling, so it is left out.
+//
+pfnWriteData WriteData = EmuWriteData;
+pfnWriteCommand WriteCommand = EmuWriteCommand;
+#endif
+
+#ifndef HOST_BUILD
 
 void LED_ON(void)
 {
@@ -426,6 +466,7 @@ InitGPIOLCDInterface(unsigned long ulClockMS)
     //
     SysCtlDelay(ulClockMS);
 }
+#endif // HOST_BUILD
 
 
 //*****************************************************************************
@@ -441,7 +482,9 @@ InitGPIOLCDInterface(unsigned long ulClockMS)
 void
 Kentec320x240x16_SSD2119Init(void)
 {
-    unsigned long ulClockMS, ulCount;
+    unsigned long ulCount;
+#ifndef HOST_BUILD
+    unsigned long ulClockMS;
 
     //
     // Get the current processor clock frequency.
@@ -471,6 +514,7 @@ Kentec320x240x16_SSD2119Init(void)
             //
             InitGPIOLCDInterface(ulClockMS);
         }
+#endif
 
     //
     // Enter sleep mode (if we are not already there).
@@ -506,10 +550,12 @@ Kentec320x240x16_SSD2119Init(void)
     WriteCommand(SSD2119_SLEEP_MODE_REG);
     WriteData(0x0000);
 
+#ifndef HOST_BUILD
     //
     // Delay 30mS
     //
     SysCtlDelay(30 * ulClockMS);
+#endif
 
     //
     // Configure pixel color format and MCU interface parameters.
@@ -521,7 +567,7 @@ Kentec320x240x16_SSD2119Init(void)
     // Enable the display.
     //
     WriteCommand(SSD2119_DISPLAY_CTRL_REG);
-    WriteData(0x0033);
+    WriteData(DISPLAY_CTRL_DEFAULT);
 
     //
     // Set VCIX2 voltage to 6.1V.
@@ -700,6 +746,407 @@ DpyPixelDrawMultipleVertical(long lX, long lY,
 
 }
 
+//*****************************************************************************
+//
+//! Draws a horizontal line made up of runs of solid color.
+//!
+//! \param lX is the X coordinate of the first pixel.
+//! \param lY is the Y coordinate of the line.
+//! \param lCount is the number of runs to draw.
+//! \param lRunLength is the number of pixels in each run.
+//! \param pucData is a pointer to the palette index of each run.
+//! \param pusPalette is a pointer to the palette, which holds colors already
+//! translated to the display's native 5-6-5 format.
+//!
+//! This function draws lCount * lRunLength pixels after setting up the cursor
+//! only once, which makes it cheap enough to draw a full row of bars every
+//! frame.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DpyPixelDrawRuns(long lX, long lY, long lCount, long lRunLength,
+                 const unsigned char *pucData,
+                 const unsigned short *pusPalette)
+{
+    unsigned short usColor;
+    long lPixel;
+
+    //
+    // Set the cursor increment to left to right, followed by top to bottom.
+    //
+    WriteCommand(SSD2119_ENTRY_MODE_REG);
+    WriteData(MAKE_ENTRY_MODE(HORIZ_DIRECTION));
+
+    //
+    // Set the starting X address of the display cursor.
+    //
+    WriteCommand(SSD2119_X_RAM_ADDR_REG);
+    WriteData(MAPPED_X(lX, lY));
+
+    //
+    // Set the Y address of the display cursor.
+    //
+    WriteCommand(SSD2119_Y_RAM_ADDR_REG);
+    WriteData(MAPPED_Y(lX, lY));
+
+    //
+    // Write the data RAM write command.
+    //
+    WriteCommand(SSD2119_RAM_DATA_REG);
+
+    //
+    // Loop while there are more runs to draw.
+    //
+    while(lCount--)
+    {
+        usColor = pusPalette[*pucData++];
+        for(lPixel = lRunLength; lPixel; lPixel--)
+        {
+            WriteData(usColor);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Whether DpyWindowBegin() set the window extents, which DpyWindowEnd() then
+// has to put back to the whole screen.
+//
+//*****************************************************************************
+static tBoolean g_bWindowSet;
+
+//*****************************************************************************
+//
+// Sets the extents of the window the cursor wraps within.
+//
+//*****************************************************************************
+static void
+DpyWindowExtentsSet(long lXMin, long lYMin, long lXMax, long lYMax)
+{
+    //
+    // Write the X extents of the window.
+    //
+    WriteCommand(SSD2119_H_RAM_START_REG);
+#if (defined PORTRAIT) || (defined LANDSCAPE)
+    WriteData(MAPPED_X(lXMax, lYMax));
+#else
+    WriteData(MAPPED_X(lXMin, lYMin));
+#endif
+
+    WriteCommand(SSD2119_H_RAM_END_REG);
+#if (defined PORTRAIT) || (defined LANDSCAPE)
+    WriteData(MAPPED_X(lXMin, lYMin));
+#else
+    WriteData(MAPPED_X(lXMax, lYMax));
+#endif
+
+    //
+    // Write the Y extents of the window.
+    //
+    WriteCommand(SSD2119_V_RAM_POS_REG);
+#if (defined LANDSCAPE_FLIP) || (defined PORTRAIT)
+    WriteData(MAPPED_Y(lXMin, lYMin) |
+             (MAPPED_Y(lXMax, lYMax) << 8));
+#else
+    WriteData(MAPPED_Y(lXMax, lYMax) |
+             (MAPPED_Y(lXMin, lYMin) << 8));
+#endif
+}
+
+//*****************************************************************************
+//
+//! Opens a window on the display to be filled column by column.
+//!
+//! \param lXMin is the X coordinate of the left edge of the window.
+//! \param lYMin is the Y coordinate of the top edge of the window.
+//! \param lXMax is the X coordinate of the right edge of the window.
+//! \param lYMax is the Y coordinate of the bottom edge of the window.
+//!
+//! This function sets the controller up so that the pixels written with
+//! DpyPixelRun() fill the window from the top left, down each column and then
+//! on to the top of the next.  The cursor is only set up once for the whole
+//! window.  DpyWindowEnd() must be called once the window is filled.
+//!
+//! A window one column wide doesn't need its extents set, as the cursor never
+//! has to wrap, so it costs no more to set up than a vertical line.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DpyWindowBegin(long lXMin, long lYMin, long lXMax, long lYMax)
+{
+    //
+    // Set the cursor increment to top to bottom, followed by left to right.
+    //
+    WriteCommand(SSD2119_ENTRY_MODE_REG);
+    WriteData(MAKE_ENTRY_MODE(VERT_DIRECTION));
+
+    g_bWindowSet = (lXMin != lXMax);
+    if(g_bWindowSet)
+    {
+        DpyWindowExtentsSet(lXMin, lYMin, lXMax, lYMax);
+    }
+
+    //
+    // Set the display cursor to the upper left of the window.
+    //
+    WriteCommand(SSD2119_X_RAM_ADDR_REG);
+    WriteData(MAPPED_X(lXMin, lYMin));
+
+    WriteCommand(SSD2119_Y_RAM_ADDR_REG);
+    WriteData(MAPPED_Y(lXMin, lYMin));
+
+    //
+    // Tell the controller we are about to write data into its RAM.
+    //
+    WriteCommand(SSD2119_RAM_DATA_REG);
+}
+
+//*****************************************************************************
+//
+//! Writes a run of pixels of one color at the display cursor.
+//!
+//! \param usColor is the color, in the display's native 5-6-5 format.
+//! \param lCount is the number of pixels to write.
+//!
+//! This does the same as calling WriteData() lCount times, but holds chip
+//! select down for the whole run instead of toggling it around every pixel.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DpyPixelRun(unsigned short usColor, long lCount)
+{
+#ifndef HOST_BUILD
+    unsigned char ucHigh, ucLow;
+
+    ucHigh = usColor >> 8;
+    ucLow = usColor & 0xff;
+
+    HWREG(LCD_CS_BASE + GPIO_O_DATA + (LCD_CS_PIN << 2)) = 0;
+
+    while(lCount--)
+    {
+        //
+        // Write the most significant byte, with the same write enable timing
+        // as WriteDataGPIO().
+        //
+        SET_LCD_DATA(ucHigh);
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = LCD_WR_PIN;
+
+        //
+        // And the least significant byte.
+        //
+        SET_LCD_DATA(ucLow);
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = LCD_WR_PIN;
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = LCD_WR_PIN;
+        HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = LCD_WR_PIN;
+    }
+
+    HWREG(LCD_CS_BASE + GPIO_O_DATA + (LCD_CS_PIN << 2)) = LCD_CS_PIN;
+#else
+    //
+    // The bus traffic is the same as for lCount calls to WriteData().
+    //
+    while(lCount--)
+    {
+        WriteData(usColor);
+    }
+#endif
+}
+
+//*****************************************************************************
+//
+//! Closes the window opened by DpyWindowBegin().
+//!
+//! This function sets the window back to the whole screen.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DpyWindowEnd(void)
+{
+    if(!g_bWindowSet)
+    {
+        return;
+    }
+
+    //
+    // Reset the X extents to the entire screen.
+    //
+    WriteCommand(SSD2119_H_RAM_START_REG);
+    WriteData(0x0000);
+    WriteCommand(SSD2119_H_RAM_END_REG);
+    WriteData(0x013F);
+
+    //
+    // Reset the Y extent to the full screen
+    //
+    WriteCommand(SSD2119_V_RAM_POS_REG);
+    WriteData(0xEF00);
+}
+
+//*****************************************************************************
+//
+//! Sets up part of the display to scroll in hardware.
+//!
+//! \param lStart is the first line of the scrolling area.
+//! \param lEnd is the last line of the scrolling area.
+//!
+//! The SSD2119 can only scroll along its gate lines, which run across the
+//! short side of the panel.  The lines are Y coordinates in the landscape
+//! orientations and X coordinates in the portrait orientations.
+//!
+//! The panel is split into two screens: the scrolling area, and the rest of
+//! the display, which stays put.  The scrolling area must therefore start or
+//! end at an edge of the display.  The area starts out unscrolled.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119ScrollAreaSet(long lStart, long lEnd)
+{
+    unsigned long ulFirst, ulLast, ulTemp;
+
+    //
+    // Find the range of gate lines the area covers.
+    //
+    ulFirst = MAPPED_Y(lStart, lStart);
+    ulLast = MAPPED_Y(lEnd, lEnd);
+    if(ulFirst > ulLast)
+    {
+        ulTemp = ulFirst;
+        ulFirst = ulLast;
+        ulLast = ulTemp;
+    }
+    g_usScrollLines = ulLast - ulFirst + 1;
+
+    WriteCommand(SSD2119_V_SCROLL_CTRL_1_REG);
+    WriteData(0x0000);
+    WriteCommand(SSD2119_V_SCROLL_CTRL_2_REG);
+    WriteData(0x0000);
+
+    if(ulFirst == 0)
+    {
+        //
+        // The scrolling area is the first screen, and anything after it is
+        // the second.
+        //
+        WriteCommand(SSD2119_FIRST_WIN_START_REG);
+        WriteData(0x0000);
+        WriteCommand(SSD2119_FIRST_WIN_END_REG);
+        WriteData(ulLast);
+        WriteCommand(SSD2119_SECOND_WIN_START_REG);
+        WriteData(ulLast + 1);
+        WriteCommand(SSD2119_SECOND_WIN_END_REG);
+        WriteData(LCD_VERTICAL_MAX - 1);
+        WriteCommand(SSD2119_DISPLAY_CTRL_REG);
+        if(ulLast == (LCD_VERTICAL_MAX - 1))
+        {
+            WriteData(DISPLAY_CTRL_DEFAULT | DISPLAY_CTRL_VLE1);
+        }
+        else
+        {
+            WriteData(DISPLAY_CTRL_DEFAULT | DISPLAY_CTRL_SPT |
+                      DISPLAY_CTRL_VLE1);
+        }
+        g_ucScrollReg = SSD2119_V_SCROLL_CTRL_1_REG;
+    }
+    else
+    {
+        //
+        // The scrolling area is the second screen, and everything before it
+        // is the first.
+        //
+        WriteCommand(SSD2119_FIRST_WIN_START_REG);
+        WriteData(0x0000);
+        WriteCommand(SSD2119_FIRST_WIN_END_REG);
+        WriteData(ulFirst - 1);
+        WriteCommand(SSD2119_SECOND_WIN_START_REG);
+        WriteData(ulFirst);
+        WriteCommand(SSD2119_SECOND_WIN_END_REG);
+        WriteData(ulLast);
+        WriteCommand(SSD2119_DISPLAY_CTRL_REG);
+        WriteData(DISPLAY_CTRL_DEFAULT | DISPLAY_CTRL_SPT | DISPLAY_CTRL_VLE2);
+        g_ucScrollReg = SSD2119_V_SCROLL_CTRL_2_REG;
+    }
+}
+
+//*****************************************************************************
+//
+//! Scrolls the scrolling area.
+//!
+//! \param lLines is how far to scroll the area, in lines, from where it
+//! started.
+//!
+//! Scrolling moves the contents of the scrolling area towards higher
+//! coordinates by lLines, and the lines that fall off the end of the area
+//! wrap around to its start.  Nothing in the display RAM moves, so drawing
+//! into the area still uses unscrolled coordinates.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119ScrollSet(long lLines)
+{
+    if(g_usScrollLines == 0)
+    {
+        return;
+    }
+    lLines %= g_usScrollLines;
+
+    //
+    // The controller scrolls towards lower gate lines, so flip the amount in
+    // the orientations where gate lines run the same way as the coordinates.
+    //
+#if (defined LANDSCAPE_FLIP) || (defined PORTRAIT)
+    if(lLines)
+    {
+        lLines = g_usScrollLines - lLines;
+    }
+#endif
+    WriteCommand(g_ucScrollReg);
+    WriteData(lLines);
+}
+
+//*****************************************************************************
+//
+//! Turns hardware scrolling back off.
+//!
+//! This returns the panel to being driven as a single, unscrolled screen.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119ScrollDisable(void)
+{
+    WriteCommand(SSD2119_DISPLAY_CTRL_REG);
+    WriteData(DISPLAY_CTRL_DEFAULT);
+    WriteCommand(SSD2119_V_SCROLL_CTRL_1_REG);
+    WriteData(0x0000);
+    WriteCommand(SSD2119_V_SCROLL_CTRL_2_REG);
+    WriteData(0x0000);
+    WriteCommand(SSD2119_FIRST_WIN_START_REG);
+    WriteData(0x0000);
+    WriteCommand(SSD2119_FIRST_WIN_END_REG);
+    WriteData(LCD_VERTICAL_MAX - 1);
+    g_usScrollLines = 0;
+}
+
 //*****************************************************************************
 //
 //! Draws a horizontal sequence of pixels on the screen.
@@ -1125,7 +1572,7 @@ Kentec320x240x16_SSD2119RectFill(void *pvDisplayData, const tRectangle *pRect,
     // Loop through the pixels of this filled rectangle.
     //
     for(lCount = ((pRect->sXMax - pRect->sXMin + 1) *
-                  (pRect->sYMax - pRect->sYMin + 1)); lCount >= 0; lCount--)
+                  (pRect->sYMax - pRect->sYMin + 1)); lCount > 0; lCount--)
     {
         //
         // Write the pixel value.
@@ -52,6 +52,15 @@ extern void DpyPixelDrawMultipleVertical(long lX, long lY,
 										 long lCount, long lWidth,
 										 const unsigned char *pucData,
 										 const unsigned char *pucPalette);
+extern void DpyPixelDrawRuns(long lX, long lY, long lCount, long lRunLength,
+                             const unsigned char *pucData,
+                             const unsigned short *pusPalette);
+extern void DpyWindowBegin(long lXMin, long lYMin, long lXMax, long lYMax);
+extern void DpyPixelRun(unsigned short usColor, long lCount);
+extern void DpyWindowEnd(void);
+extern void Kentec320x240x16_SSD2119ScrollAreaSet(long lStart, long lEnd);
+extern void Kentec320x240x16_SSD2119ScrollSet(long lLines);
+extern void Kentec320x240x16_SSD2119ScrollDisable(void);
 extern void LED_ON(void);
 extern void LED_OFF(void);
 #endif // __KENTEC320X240X16_SSD2119_H__
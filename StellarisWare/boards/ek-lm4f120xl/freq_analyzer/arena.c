@@ -0,0 +1,57 @@
+//*****************************************************************************
+//
+// arena.c - The SRAM arena that holds the large working buffers.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "arm_math.h"
+#include "gui.h"
+#include "dsp.h"
+#include "freq_analyzer.h"
+#include "arena.h"
+
+//*****************************************************************************
+//
+// Public global variables
+//
+//*****************************************************************************
+
+//
+// The arena.  The uDMA control table at the start of it has to be aligned to
+// a 1024 byte boundary.  With GCC, the linker script puts the arena at the
+// very start of SRAM, which is aligned already, so no SRAM is lost to
+// padding ahead of it.
+//
+#if defined(ewarm)
+#pragma data_alignment=1024
+tArena g_sArena;
+#elif defined(ccs)
+#pragma DATA_ALIGN(g_sArena, 1024)
+tArena g_sArena;
+#else
+tArena g_sArena __attribute__ ((section(".arena"), aligned(1024)));
+#endif
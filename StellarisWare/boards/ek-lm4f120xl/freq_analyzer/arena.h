@@ -0,0 +1,98 @@
+//*****************************************************************************
+//
+// arena.h - Layout of the SRAM arena that holds the large working buffers.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The buffers that make up most of the SRAM the application uses, laid out
+// in one place so their cost can be seen at a glance.  Buffers that are never
+// in use at the same time share space in a union.
+//
+// The arena is not cleared at reset; each buffer is set up by the code that
+// owns it before it is used.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The uDMA control table.  This has to be first, as it must be aligned
+	// to a 1024 byte boundary.
+	//
+	unsigned char pucDMAControl[1024];
+
+	//
+	// The last NUM_SAMPLES audio samples, and the buffers the slow uDMA
+	// method takes turns capturing into
+	//
+	unsigned short pusADCValues[NUM_SAMPLES];
+	unsigned short pusDMAPing[DMA_SIZE];
+	unsigned short pusDMAPong[DMA_SIZE];
+
+	//
+	// The DSP loop's working buffer.  The FFT engine keeps the windowed
+	// samples and then the spectrum here; the filterbank and zoom FFT keep
+	// their state here instead, as only one engine runs at a time.
+	//
+	float32_t pfFFTResult[NUM_BINS * 2];
+
+	//
+	// The running spectrum average only has to last from one frame to the
+	// next.  Laying the bars out again restarts it, so while that is done,
+	// the same space holds each new bar's edge frequency, and the edges and
+	// normalization state of the old bars to carry over to the new ones.
+	//
+	union
+	{
+		float32_t pfAvgSpectrum[NUM_BINS];
+		struct
+		{
+			union
+			{
+				int piBarEdgeFreqs[MAX_NUMBARS + 1];
+				float32_t pfEdges[MAX_NUMBARS + 1];
+			}
+			uNew;
+			float32_t pfOldEdges[MAX_NUMBARS + 1];
+			float32_t pfOldLevels[MAX_NUMBARS];
+		}
+		sLayout;
+	}
+	uSpectrum;
+}
+tArena;
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+extern tArena g_sArena;
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ARENA_H__
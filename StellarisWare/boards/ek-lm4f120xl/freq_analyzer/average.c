@@ -0,0 +1,138 @@
+//*****************************************************************************
+//
+// average.c - Averaging of power spectra across frames.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "arm_math.h"
+#include "average.h"
+#include <math.h>
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Convert an FFT result into the magnitude spectrum the rest of the DSP loop
+// works from, averaging power across frames if averaging is turned on.
+//
+// Averaging is done on power, as in Welch's method, and the square root of
+// the average is handed back so the bars, peak finder, and tuner see the same
+// units either way.  Each frame costs one vector scale and one vector add in
+// EMA mode, and one vector add in boxcar mode.
+//
+// In boxcar mode there is only room in SRAM for one accumulated spectrum, not
+// a ring of ulFrames of them, so the frames are averaged in back to back
+// blocks and a new average comes out every ulFrames frames.  When the slow
+// DMA method is in use the frames themselves overlap, each one sliding the
+// capture window forward by only DMA_SIZE samples.
+//
+// param pfBuffer: the FFT result, as ulNumBins complex bins.  On return the
+//		 first ulNumBins elements hold the (averaged) magnitude of each bin.
+// param pfAverage: ulNumBins elements of power kept from frame to frame.  In
+//		 EMA mode it holds the leaky sum of every frame so far; in boxcar
+//		 mode it holds the sum of the frames in the current block.
+// param pulCount: the number of frames summed into pfAverage.  Setting it to
+//		 zero restarts the average from the next frame.
+// param ulNumBins: the number of bins
+// param ulMode: one of the AVG_MODE_* modes
+// param ulFrames: the number of frames to average, at least 1
+//
+// return: 1 if pfBuffer holds a new spectrum to analyze, 0 if the frame was
+//		   only summed into the current boxcar block
+//
+//*****************************************************************************
+int
+AverageSpectrum(float32_t *pfBuffer, float32_t *pfAverage,
+				unsigned long *pulCount, unsigned long ulNumBins,
+				unsigned long ulMode, unsigned long ulFrames)
+{
+	unsigned long i;
+	float32_t fDecay, fScale;
+
+	if(ulMode == AVG_MODE_OFF)
+	{
+		arm_cmplx_mag_f32(pfBuffer, pfBuffer, ulNumBins);
+		return(1);
+	}
+
+	arm_cmplx_mag_squared_f32(pfBuffer, pfBuffer, ulNumBins);
+
+	if(ulMode == AVG_MODE_EMA)
+	{
+		//
+		// Keep a leaky sum, S = decay * S + P, which settles at P / (1 -
+		// decay).  Seed it at that level so the bars don't ramp up from zero.
+		// A decay of 1 - 2 / (K + 1) gives the same variance reduction as a K
+		// frame boxcar.
+		//
+		fScale = 2.0f / ((float32_t)ulFrames + 1.0f);
+		fDecay = 1.0f - fScale;
+		if(*pulCount == 0)
+		{
+			arm_scale_f32(pfBuffer, 1.0f / fScale, pfAverage, ulNumBins);
+			*pulCount = 1;
+		}
+		else
+		{
+			arm_scale_f32(pfAverage, fDecay, pfAverage, ulNumBins);
+			arm_add_f32(pfAverage, pfBuffer, pfAverage, ulNumBins);
+		}
+	}
+	else
+	{
+		//
+		// Sum the frames in this block, and only hand back a spectrum once
+		// the block is full
+		//
+		if(*pulCount == 0)
+		{
+			arm_copy_f32(pfBuffer, pfAverage, ulNumBins);
+		}
+		else
+		{
+			arm_add_f32(pfAverage, pfBuffer, pfAverage, ulNumBins);
+		}
+		if(++(*pulCount) < ulFrames)
+		{
+			return(0);
+		}
+		*pulCount = 0;
+		fScale = 1.0f / (float32_t)ulFrames;
+	}
+
+	//
+	// Hand back the magnitude of the averaged power
+	//
+	for(i = 0; i < ulNumBins; i++)
+	{
+		pfBuffer[i] = sqrtf(pfAverage[i] * fScale);
+	}
+	return(1);
+}
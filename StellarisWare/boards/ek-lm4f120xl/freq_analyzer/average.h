@@ -0,0 +1,56 @@
+//*****************************************************************************
+//
+// average.h - Predefines and public functions for averaging power spectra
+// across frames.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __AVERAGE_H__
+#define __AVERAGE_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// Spectrum averaging modes.  EMA keeps an exponential moving average of the
+// power spectrum; boxcar averages back to back blocks of frames.
+//
+#define AVG_MODE_OFF			0
+#define AVG_MODE_EMA			1
+#define AVG_MODE_BOXCAR			2
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern int AverageSpectrum(float32_t *pfBuffer, float32_t *pfAverage,
+						   unsigned long *pulCount, unsigned long ulNumBins,
+						   unsigned long ulMode, unsigned long ulFrames);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __AVERAGE_H__
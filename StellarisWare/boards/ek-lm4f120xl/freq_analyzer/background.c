@@ -0,0 +1,166 @@
+//*****************************************************************************
+//
+// background.c - Draws any part of the compressed background image.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#ifndef HOST_BUILD
+#include "grlib/grlib.h"
+#include "drivers/Kentec320x240x16_ssd2119_8bit.h"
+#else
+#include "tools/ssd2119_emu.h"
+#endif
+#include "background.h"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// Read nibble n of a packet stream
+//
+#define NIBBLE(pucData, n)	(((pucData)[(n) >> 1] >> ((~(n) & 1) << 2)) & 0xf)
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Draw a rectangle of the background image in place on the screen.
+//
+// param psBackground: the image to draw from
+// param lXMin, lYMin: the top left corner of the rectangle
+// param lXMax, lYMax: the bottom right corner of the rectangle, inclusive
+//
+// The rectangle is drawn column by column through a window on the display,
+// so the cursor is only set up once, and each run of one color in the image
+// goes out as a single burst.  Each column is decoded from the start of the
+// segment lYMin is in.
+//
+//*****************************************************************************
+void
+BackgroundDraw(const tBackground *psBackground, long lXMin, long lYMin,
+			   long lXMax, long lYMax)
+{
+	const unsigned char *pucData;
+	unsigned long ulSegments, ulNibble, ulPacket;
+	unsigned short usColor;
+	long lX, lY, lCount, lFirst, lLast;
+
+	if((lXMin > lXMax) || (lYMin > lYMax))
+	{
+		return;
+	}
+
+	ulSegments = ((psBackground->usHeight + BG_SEGMENT_ROWS - 1) /
+				  BG_SEGMENT_ROWS);
+
+	DpyWindowBegin(lXMin, lYMin, lXMax, lYMax);
+
+	for(lX = lXMin; lX <= lXMax; lX++)
+	{
+		//
+		// Find the segment the first row is in
+		//
+		pucData = (psBackground->pucData + psBackground->pusColumns[lX] +
+				   psBackground->pucSegments[(lX * ulSegments) +
+											 (lYMin / BG_SEGMENT_ROWS)]);
+		lY = lYMin - (lYMin % BG_SEGMENT_ROWS);
+		ulNibble = 0;
+
+		while(lY <= lYMax)
+		{
+			//
+			// Each segment starts on a byte boundary
+			//
+			if(!(lY % BG_SEGMENT_ROWS))
+			{
+				ulNibble = (ulNibble + 1) & ~1;
+			}
+
+			ulPacket = NIBBLE(pucData, ulNibble);
+			ulNibble++;
+
+			if(ulPacket & 8)
+			{
+				//
+				// A run.  Draw the part of it that's in the rectangle.
+				//
+				lCount = ulPacket - 6;
+				usColor = psBackground->pusPalette[NIBBLE(pucData, ulNibble)];
+				ulNibble++;
+
+				lFirst = (lY > lYMin) ? lY : lYMin;
+				lLast = lY + lCount - 1;
+				if(lLast > lYMax)
+				{
+					lLast = lYMax;
+				}
+				if(lLast >= lFirst)
+				{
+					DpyPixelRun(usColor, lLast - lFirst + 1);
+				}
+				lY += lCount;
+			}
+			else
+			{
+				//
+				// A literal.  Skip over the pixels above the rectangle.  Once
+				// the pixels run past the bottom of it, the column is done.
+				//
+				lCount = ulPacket + 1;
+				if(lY < lYMin)
+				{
+					lFirst = lYMin - lY;
+					if(lFirst > lCount)
+					{
+						lFirst = lCount;
+					}
+					ulNibble += lFirst;
+					lY += lFirst;
+					lCount -= lFirst;
+				}
+				while(lCount && (lY <= lYMax))
+				{
+					usColor = psBackground->pusPalette[NIBBLE(pucData,
+															  ulNibble)];
+					DpyPixelRun(usColor, 1);
+					ulNibble++;
+					lY++;
+					lCount--;
+				}
+			}
+		}
+	}
+
+	DpyWindowEnd();
+}
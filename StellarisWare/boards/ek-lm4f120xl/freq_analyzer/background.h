@@ -0,0 +1,109 @@
+//*****************************************************************************
+//
+// background.h - Predefines, public functions, and globals for drawing the
+// compressed background image.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __BACKGROUND_H__
+#define __BACKGROUND_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The number of rows in each segment of a column.  Drawing from any row
+// starts at the segment it is in, so at most this many pixels are decoded
+// and thrown away before the first one is drawn.  This must match the value
+// bgimage.c was generated with by tools/gen_background.py.
+//
+#define BG_SEGMENT_ROWS			32
+
+//
+// The number of colors in the palette.  Each pixel is a nibble.
+//
+#define BG_PALETTE_SIZE			16
+
+//*****************************************************************************
+//
+// A background image, compressed a column at a time.
+//
+// Each column is cut into segments of BG_SEGMENT_ROWS rows.  Each segment is
+// a stream of nibble packets, first nibble in the high half of each byte.  A
+// packet of 0 to 7 is followed by that many plus one pixels; a packet of 8 to
+// 15 is followed by one pixel that is repeated that many minus six times.
+// Every segment starts on a byte boundary.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The size of the image, in pixels.
+	//
+	unsigned short usWidth;
+	unsigned short usHeight;
+
+	//
+	// The colors of the image, in the display's native 5-6-5 RGB format.
+	//
+	const unsigned short *pusPalette;
+
+	//
+	// The offset into pucData of each column.
+	//
+	const unsigned short *pusColumns;
+
+	//
+	// The offset of each segment from the start of its column, column by
+	// column.
+	//
+	const unsigned char *pucSegments;
+
+	//
+	// The packets.
+	//
+	const unsigned char *pucData;
+}
+tBackground;
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+extern const tBackground g_sBackground;
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern void BackgroundDraw(const tBackground *psBackground, long lXMin,
+						   long lYMin, long lXMax, long lYMax);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __BACKGROUND_H__
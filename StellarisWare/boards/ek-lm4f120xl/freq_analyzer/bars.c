@@ -0,0 +1,269 @@
+//*****************************************************************************
+//
+// bars.c - Kernels that turn bar powers into display heights.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "arm_math.h"
+#include "bars.h"
+
+//*****************************************************************************
+//
+// Private predefines
+//
+//*****************************************************************************
+
+//
+// The cubic BarsLog2 approximates log2(1 + x) with, for x in [0, 1).  It is
+// a minimax fit, good to within 0.00064, which is 0.004 dB.
+//
+#define LOG2_C0					0.00063708f
+#define LOG2_C1					1.41888041f
+#define LOG2_C2					(-0.57712915f)
+#define LOG2_C3					0.15824874f
+
+//
+// The number of dB in a doubling of amplitude, 20 * log10(2)
+//
+#define DB_PER_LOG2				6.02059991f
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Turn the power in each bar into the height to draw it at.
+//
+// Each power is multiplied by its bar's scale, then by a scale shared by all
+// the bars, and the result is cut to a whole number of pixels no taller than
+// the display.  Callers keep the reciprocal of whatever they normalize
+// against, so this is multiplies only; there is no division per bar.
+//
+// param pfPower: the power in each bar.  This is overwritten with the
+//		 unquantized heights.
+// param pfScale: the scale for each bar, or 0 to apply only fScale
+// param fScale: the scale applied to every bar
+// param pucHeight: where to store the height of each bar
+// param ulNumBars: the number of bars
+// param ulMaxHeight: the tallest a bar can be.  Bars that would be taller
+//		 are clipped to this.
+//
+//*****************************************************************************
+void
+BarsQuantize(float32_t *pfPower, const float32_t *pfScale, float32_t fScale,
+			 unsigned char *pucHeight, unsigned long ulNumBars,
+			 unsigned long ulMaxHeight)
+{
+	unsigned long ulIdx;
+	float32_t fMax;
+
+	if(pfScale)
+	{
+		arm_mult_f32(pfPower, (float32_t *)pfScale, pfPower, ulNumBars);
+	}
+	arm_scale_f32(pfPower, fScale, pfPower, ulNumBars);
+
+	//
+	// Written so that the compare picks the clipped height for anything that
+	// isn't a number as well as for anything too tall
+	//
+	fMax = (float32_t)ulMaxHeight;
+	for(ulIdx = 0; ulIdx < ulNumBars; ulIdx++)
+	{
+		pucHeight[ulIdx] = (pfPower[ulIdx] < fMax) ?
+						   (unsigned char)pfPower[ulIdx] :
+						   (unsigned char)ulMaxHeight;
+	}
+}
+
+//*****************************************************************************
+//
+// Take the base 2 logarithm of a block of values.
+//
+// Each value is split into its exponent, which is the whole part of the
+// logarithm, and its mantissa, whose logarithm comes from a cubic.  There are
+// no branches or table lookups, so every value costs the same.
+//
+// param pfSrc: the values.  These must not be negative.  0 comes out as
+//		 about -127.
+// param pfDst: where to store the logarithms.  This can be the same as
+//		 pfSrc.
+// param ulCount: the number of values
+//
+//*****************************************************************************
+void
+BarsLog2(const float32_t *pfSrc, float32_t *pfDst, unsigned long ulCount)
+{
+	unsigned long ulIdx;
+	union
+	{
+		float32_t f;
+		uint32_t ul;
+	}
+	uBits;
+	float32_t fExponent, fX;
+
+	for(ulIdx = 0; ulIdx < ulCount; ulIdx++)
+	{
+		uBits.f = pfSrc[ulIdx];
+
+		//
+		// The constant term of the cubic is folded into the exponent bias
+		//
+		fExponent = (float32_t)(long)(uBits.ul >> 23) - (127.0f - LOG2_C0);
+
+		//
+		// Give the mantissa an exponent of 0 to get it as a number in [1, 2)
+		//
+		uBits.ul = (uBits.ul & 0x007fffff) | 0x3f800000;
+		fX = uBits.f - 1.0f;
+
+		pfDst[ulIdx] = fExponent +
+					   (fX * (LOG2_C1 + (fX * (LOG2_C2 + (fX * LOG2_C3)))));
+	}
+}
+
+//*****************************************************************************
+//
+// Turn the power in each bar into the height to draw it at, on a dB scale.
+//
+// Each power is multiplied by its bar's scale, then by a scale shared by all
+// the bars, to give its level against the maximum it is normalized against.
+// That level is converted to dB, and the range from fFloorDb to fCeilingDb
+// is spread over the height of the display.
+//
+// param pfPower: the power in each bar.  This is overwritten.
+// param pfScale: the scale for each bar, or 0 to apply only fScale
+// param fScale: the scale applied to every bar
+// param fFloorDb: the level, in dB, at the bottom of the display.  Anything
+//		 quieter has no height.
+// param fCeilingDb: the level, in dB, at the top of the display.  This must
+//		 be above fFloorDb.  Anything louder is clipped to the top.
+// param pucHeight: where to store the height of each bar
+// param ulNumBars: the number of bars
+// param ulMaxHeight: the height of the display
+//
+//*****************************************************************************
+void
+BarsQuantizeDb(float32_t *pfPower, const float32_t *pfScale, float32_t fScale,
+			   float32_t fFloorDb, float32_t fCeilingDb,
+			   unsigned char *pucHeight, unsigned long ulNumBars,
+			   unsigned long ulMaxHeight)
+{
+	unsigned long ulIdx;
+	float32_t fMax, fSlope, fOffset, fHeight;
+
+	if(pfScale)
+	{
+		arm_mult_f32(pfPower, (float32_t *)pfScale, pfPower, ulNumBars);
+	}
+	arm_scale_f32(pfPower, fScale, pfPower, ulNumBars);
+	BarsLog2(pfPower, pfPower, ulNumBars);
+
+	//
+	// Go straight from the logarithm to pixels with one multiply and add
+	//
+	fMax = (float32_t)ulMaxHeight;
+	fSlope = (DB_PER_LOG2 * fMax) / (fCeilingDb - fFloorDb);
+	fOffset = (-fFloorDb * fMax) / (fCeilingDb - fFloorDb);
+	for(ulIdx = 0; ulIdx < ulNumBars; ulIdx++)
+	{
+		fHeight = (pfPower[ulIdx] * fSlope) + fOffset;
+		pucHeight[ulIdx] = (fHeight < 0) ? 0 :
+						   ((fHeight < fMax) ? (unsigned char)fHeight :
+							(unsigned char)ulMaxHeight);
+	}
+}
+
+//*****************************************************************************
+//
+// Carry a value kept for each bar over to a new set of bars.
+//
+// Each bar covers a range of frequencies, given by its edges.  A new bar
+// takes the mean of the old bars' values over the part of its range the old
+// bars covered, each weighted by how much of the range it covered.  Both
+// sets of bars are in order of frequency, so this is one pass over each.
+//
+// param pfOldEdges: the edges of the old bars, in Hz, ulOldBars + 1 of them
+//		 in ascending order
+// param pfOld: the value of each old bar
+// param ulOldBars: the number of old bars
+// param pfNewEdges: the edges of the new bars, as for pfOldEdges
+// param pfNew: where to store the value of each new bar
+// param ulNewBars: the number of new bars
+// param fUncovered: the value given to new bars no old bar overlaps
+//
+//*****************************************************************************
+void
+BarsRemap(const float32_t *pfOldEdges, const float32_t *pfOld,
+		  unsigned long ulOldBars, const float32_t *pfNewEdges,
+		  float32_t *pfNew, unsigned long ulNewBars, float32_t fUncovered)
+{
+	unsigned long ulOld, ulNew;
+	float32_t fLow, fHigh, fSum, fWidth;
+
+	ulOld = 0;
+	for(ulNew = 0; ulNew < ulNewBars; ulNew++)
+	{
+		//
+		// Skip the old bars that end below this one.  They end below every
+		// bar after it too.
+		//
+		while((ulOld < ulOldBars) &&
+			  (pfOldEdges[ulOld + 1] <= pfNewEdges[ulNew]))
+		{
+			ulOld++;
+		}
+
+		//
+		// Sum over the old bars that overlap this one.  The last of them may
+		// overlap the next new bar as well, so it is left for that one.
+		//
+		fSum = 0;
+		fWidth = 0;
+		while((ulOld < ulOldBars) &&
+			  (pfOldEdges[ulOld] < pfNewEdges[ulNew + 1]))
+		{
+			fLow = (pfOldEdges[ulOld] > pfNewEdges[ulNew]) ?
+				   pfOldEdges[ulOld] : pfNewEdges[ulNew];
+			fHigh = (pfOldEdges[ulOld + 1] < pfNewEdges[ulNew + 1]) ?
+					pfOldEdges[ulOld + 1] : pfNewEdges[ulNew + 1];
+			fSum += pfOld[ulOld] * (fHigh - fLow);
+			fWidth += fHigh - fLow;
+			if(pfOldEdges[ulOld + 1] > pfNewEdges[ulNew + 1])
+			{
+				break;
+			}
+			ulOld++;
+		}
+
+		pfNew[ulNew] = (fWidth > 0) ? (fSum / fWidth) : fUncovered;
+	}
+}
@@ -0,0 +1,52 @@
+//*****************************************************************************
+//
+// bars.h - Public functions for the kernels that turn bar powers into display
+// heights.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __BARS_H__
+#define __BARS_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern void BarsQuantize(float32_t *pfPower, const float32_t *pfScale,
+						 float32_t fScale, unsigned char *pucHeight,
+						 unsigned long ulNumBars, unsigned long ulMaxHeight);
+extern void BarsLog2(const float32_t *pfSrc, float32_t *pfDst,
+					 unsigned long ulCount);
+extern void BarsQuantizeDb(float32_t *pfPower, const float32_t *pfScale,
+						   float32_t fScale, float32_t fFloorDb,
+						   float32_t fCeilingDb, unsigned char *pucHeight,
+						   unsigned long ulNumBars, unsigned long ulMaxHeight);
+extern void BarsRemap(const float32_t *pfOldEdges, const float32_t *pfOld,
+					  unsigned long ulOldBars, const float32_t *pfNewEdges,
+					  float32_t *pfNew, unsigned long ulNewBars,
+					  float32_t fUncovered);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __BARS_H__
@@ -0,0 +1,3411 @@
+//*****************************************************************************
+//
+// bgimage.c - The background image, compressed so that it can be drawn a
+// piece of a column at a time.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// THIS FILE IS GENERATED BY tools/gen_background.py FROM background.bmp.
+// DO NOT EDIT.
+//
+//*****************************************************************************
+
+#include "background.h"
+
+#if (BG_SEGMENT_ROWS != 32) || (BG_PALETTE_SIZE != 16)
+#error "background.h and bgimage.c disagree on the image layout"
+#endif
+
+static const unsigned short g_pusBgPalette[16] =
+{
+    0x084e, 0x8539, 0x1291, 0x0af3, 0x08ee, 0x190e, 0xbe5c, 0xdf1d,
+    0x0950, 0x0a11, 0x2170, 0x2211, 0x2293, 0x3af2, 0x2334, 0x53d5,
+};
+
+static const unsigned short g_pusBgColumns[320] =
+{
+        0,   100,   204,   303,   414,   524,   625,   734,
+      833,   944,  1034,  1141,  1254,  1357,  1453,  1561,
+     1673,  1786,  1891,  1994,  2101,  2213,  2327,  2442,
+     2552,  2667,  2783,  2896,  3008,  3124,  3236,  3349,
+     3466,  3579,  3692,  3803,  3917,  4031,  4144,  4259,
+     4373,  4488,  4605,  4718,  4827,  4939,  5047,  5165,
+     5280,  5398,  5512,  5628,  5743,  5859,  5974,  6090,
+     6206,  6324,  6440,  6550,  6663,  6773,  6890,  7005,
+     7118,  7230,  7345,  7461,  7578,  7692,  7807,  7917,
+     8036,  8153,  8270,  8393,  8515,  8637,  8757,  8875,
+     8992,  9109,  9230,  9351,  9467,  9574,  9685,  9802,
+     9924, 10046, 10167, 10287, 10407, 10530, 10650, 10767,
+    10888, 11009, 11129, 11248, 11358, 11469, 11585, 11699,
+    11813, 11931, 12044, 12155, 12268, 12384, 12500, 12616,
+    12729, 12849, 12959, 13074, 13189, 13300, 13415, 13525,
+    13638, 13759, 13875, 13988, 14098, 14207, 14318, 14427,
+    14542, 14654, 14764, 14874, 14990, 15100, 15210, 15324,
+    15434, 15547, 15663, 15777, 15885, 15996, 16108, 16223,
+    16337, 16450, 16565, 16685, 16796, 16904, 17014, 17121,
+    17238, 17353, 17470, 17584, 17691, 17801, 17912, 18027,
+    18141, 18253, 18363, 18472, 18586, 18695, 18802, 18917,
+    19023, 19138, 19250, 19361, 19473, 19588, 19705, 19827,
+    19944, 20054, 20167, 20276, 20383, 20496, 20609, 20720,
+    20828, 20943, 21057, 21166, 21276, 21392, 21508, 21624,
+    21740, 21858, 21973, 22089, 22202, 22318, 22428, 22546,
+    22660, 22771, 22878, 22987, 23098, 23217, 23334, 23449,
+    23561, 23678, 23799, 23920, 24037, 24157, 24278, 24399,
+    24521, 24645, 24766, 24888, 25005, 25126, 25241, 25355,
+    25470, 25588, 25703, 25817, 25935, 26052, 26172, 26292,
+    26414, 26534, 26650, 26770, 26886, 27005, 27125, 27248,
+    27366, 27480, 27595, 27712, 27825, 27942, 28061, 28175,
+    28291, 28408, 28525, 28639, 28754, 28865, 28978, 29088,
+    29202, 29314, 29429, 29539, 29653, 29770, 29885, 30001,
+    30114, 30228, 30342, 30457, 30573, 30686, 30797, 30910,
+    31009, 31122, 31235, 31343, 31455, 31562, 31670, 31780,
+    31889, 31996, 32108, 32210, 32324, 32435, 32537, 32647,
+    32746, 32853, 32961, 33066, 33173, 33274, 33377, 33478,
+    33581, 33685, 33791, 33894, 33999, 34110, 34223, 34326,
+    34423, 34522, 34625, 34728, 34827, 34936, 35044, 35150,
+    35256, 35358, 35464, 35567, 35658, 35770, 35878, 35983,
+};
+
+static const unsigned char g_pucBgSegments[2560] =
+{
+      0,   8,  23,  39,  54,  69,  85,  97,
+      0,   9,  24,  42,  56,  72,  88, 101,
+      0,   9,  23,  40,  55,  72,  85,  96,
+      0,  13,  29,  46,  63,  80,  94, 107,
+      0,  10,  26,  42,  59,  76,  92, 106,
+      0,   9,  24,  39,  55,  71,  84,  97,
+      0,  12,  28,  44,  60,  77,  91, 105,
+      0,   7,  21,  38,  51,  68,  83,  95,
+      0,  10,  27,  43,  60,  78,  95, 107,
+      0,   8,  19,  31,  45,  60,  75,  86,
+      0,  10,  27,  40,  58,  73,  90, 103,
+      0,  10,  27,  44,  62,  78,  96, 109,
+      0,   9,  24,  41,  57,  72,  86,  99,
+      0,   9,  19,  34,  51,  65,  80,  92,
+      0,  10,  24,  40,  58,  75,  91, 104,
+      0,   9,  26,  43,  61,  78,  94, 108,
+      0,  10,  27,  44,  61,  78,  95, 109,
+      0,   8,  25,  41,  58,  73,  88, 101,
+      0,   7,  21,  37,  54,  71,  85,  99,
+      0,   8,  22,  40,  56,  74,  89, 103,
+      0,   9,  24,  41,  59,  77,  94, 108,
+      0,   9,  25,  42,  60,  78,  96, 110,
+      0,   9,  26,  44,  61,  79,  96, 111,
+      0,   9,  27,  44,  59,  77,  94, 106,
+      0,   9,  26,  44,  61,  79,  97, 111,
+      0,  10,  28,  46,  64,  81,  97, 112,
+      0,  10,  25,  42,  60,  78,  96, 109,
+      0,  10,  25,  43,  61,  76,  94, 108,
+      0,   9,  26,  44,  62,  80,  98, 112,
+      0,   8,  22,  40,  58,  76,  93, 108,
+      0,   8,  25,  42,  60,  77,  95, 109,
+      0,   9,  27,  45,  63,  81,  99, 113,
+      0,  10,  28,  43,  61,  79,  97, 109,
+      0,   8,  26,  43,  61,  79,  97, 109,
+      0,   9,  25,  42,  60,  77,  95, 107,
+      0,   9,  25,  43,  61,  78,  96, 110,
+      0,   9,  27,  45,  63,  80,  97, 110,
+      0,   7,  24,  42,  60,  77,  95, 109,
+      0,   9,  26,  43,  61,  79,  97, 111,
+      0,   7,  25,  43,  61,  79,  97, 110,
+      0,   7,  25,  43,  60,  78,  96, 111,
+      0,  10,  28,  46,  64,  81,  98, 113,
+      0,   9,  27,  43,  61,  78,  96, 109,
+      0,   9,  26,  43,  57,  74,  92, 105,
+      0,   9,  25,  42,  58,  76,  94, 108,
+      0,   9,  26,  43,  56,  73,  90, 104,
+      0,  10,  28,  46,  64,  82, 100, 114,
+      0,   9,  27,  45,  61,  79,  96, 111,
+      0,   9,  27,  45,  63,  81,  99, 114,
+      0,  10,  28,  44,  62,  79,  97, 110,
+      0,  10,  27,  44,  62,  80,  98, 112,
+      0,  10,  27,  45,  62,  80,  96, 111,
+      0,  10,  28,  46,  64,  81,  98, 112,
+      0,  10,  27,  44,  60,  78,  96, 111,
+      0,  10,  27,  45,  61,  79,  97, 112,
+      0,  10,  28,  45,  63,  81,  99, 112,
+      0,  10,  28,  46,  63,  81,  99, 114,
+      0,  10,  28,  45,  62,  80,  98, 112,
+      0,   9,  27,  45,  58,  75,  92, 106,
+      0,  10,  28,  44,  59,  77,  94, 109,
+      0,  10,  26,  44,  58,  76,  92, 106,
+      0,  10,  28,  46,  64,  82,  98, 113,
+      0,  10,  27,  45,  61,  78,  96, 111,
+      0,  10,  28,  46,  59,  77,  95, 109,
+      0,   9,  27,  45,  58,  76,  94, 108,
+      0,  10,  27,  45,  60,  78,  96, 111,
+      0,   9,  27,  45,  63,  81,  97, 112,
+      0,   9,  27,  45,  63,  81,  99, 113,
+      0,   9,  27,  44,  62,  80,  96, 110,
+      0,  10,  27,  44,  62,  79,  97, 111,
+      0,  10,  26,  40,  58,  73,  91, 106,
+      0,  10,  28,  46,  64,  82, 100, 115,
+      0,  10,  26,  44,  62,  80,  98, 113,
+      0,  10,  27,  42,  60,  78,  96, 111,
+      0,  10,  28,  46,  64,  82, 100, 116,
+      0,   9,  27,  45,  63,  81,  98, 115,
+      0,   9,  27,  45,  63,  81,  99, 115,
+      0,   9,  27,  44,  62,  79,  97, 114,
+      0,  10,  27,  45,  60,  78,  95, 112,
+      0,   9,  27,  43,  58,  76,  94, 110,
+      0,  10,  25,  43,  59,  77,  95, 110,
+      0,  10,  28,  46,  64,  80,  98, 115,
+      0,  10,  27,  45,  63,  81,  99, 115,
+      0,  10,  26,  44,  57,  75,  93, 110,
+      0,   9,  26,  44,  53,  71,  89, 103,
+      0,  10,  28,  46,  62,  78,  94, 107,
+      0,   9,  26,  44,  62,  79,  96, 112,
+      0,  10,  28,  46,  64,  81,  99, 115,
+      0,   9,  27,  45,  63,  81,  99, 115,
+      0,   9,  27,  44,  62,  80,  97, 114,
+      0,  10,  28,  46,  64,  81,  98, 113,
+      0,  10,  28,  45,  63,  79,  97, 114,
+      0,   9,  27,  45,  63,  81,  99, 116,
+      0,   9,  27,  44,  62,  79,  96, 113,
+      0,  10,  28,  45,  62,  79,  96, 111,
+      0,   9,  26,  44,  62,  80,  98, 115,
+      0,   9,  27,  45,  63,  79,  97, 114,
+      0,   9,  26,  44,  61,  77,  95, 112,
+      0,  10,  28,  45,  62,  80,  97, 113,
+      0,   9,  26,  43,  56,  73,  90, 104,
+      0,  10,  28,  46,  58,  76,  94, 107,
+      0,  10,  28,  45,  61,  79,  97, 112,
+      0,  10,  27,  45,  61,  77,  95, 110,
+      0,   9,  27,  45,  59,  76,  94, 110,
+      0,  10,  28,  46,  59,  75,  93, 110,
+      0,  10,  28,  44,  59,  77,  93, 109,
+      0,   9,  27,  43,  58,  74,  91, 107,
+      0,   9,  26,  44,  60,  76,  94, 109,
+      0,   9,  27,  45,  62,  79,  96, 111,
+      0,   8,  25,  43,  60,  76,  94, 110,
+      0,   9,  27,  44,  60,  78,  96, 110,
+      0,   9,  27,  43,  57,  75,  92, 107,
+      0,  10,  28,  45,  63,  81,  99, 113,
+      0,   8,  26,  42,  56,  71,  89, 103,
+      0,   9,  27,  40,  58,  74,  91, 108,
+      0,  10,  27,  44,  59,  74,  92, 109,
+      0,  10,  27,  44,  60,  75,  92, 107,
+      0,   9,  27,  45,  62,  79,  96, 111,
+      0,   9,  27,  44,  57,  74,  91, 106,
+      0,  10,  28,  45,  59,  76,  94, 109,
+      0,  10,  28,  45,  62,  79,  97, 114,
+      0,   9,  27,  43,  58,  73,  91, 108,
+      0,   9,  27,  44,  57,  72,  89, 106,
+      0,   8,  26,  43,  54,  70,  88, 104,
+      0,  10,  26,  41,  53,  69,  86, 103,
+      0,  10,  27,  44,  56,  73,  89, 105,
+      0,  10,  28,  44,  58,  70,  86, 103,
+      0,   9,  27,  45,  62,  75,  93, 109,
+      0,   9,  27,  44,  59,  76,  94, 108,
+      0,   9,  27,  43,  58,  75,  92, 106,
+      0,  10,  28,  43,  60,  72,  90, 106,
+      0,  10,  28,  43,  58,  75,  93, 109,
+      0,   9,  27,  44,  57,  73,  90, 106,
+      0,  10,  28,  45,  60,  76,  91, 106,
+      0,  10,  28,  46,  63,  79,  96, 110,
+      0,  10,  28,  44,  62,  73,  89, 105,
+      0,  10,  28,  45,  60,  76,  92, 107,
+      0,   9,  27,  44,  60,  77,  93, 109,
+      0,   9,  27,  45,  58,  73,  90, 107,
+      0,  10,  28,  44,  57,  71,  85, 101,
+      0,   9,  26,  43,  57,  73,  88, 105,
+      0,   9,  27,  43,  56,  71,  89, 106,
+      0,  10,  28,  45,  57,  74,  91, 106,
+      0,  10,  28,  44,  58,  72,  88, 105,
+      0,   9,  26,  43,  55,  71,  88, 105,
+      0,  10,  25,  41,  57,  74,  91, 107,
+      0,   9,  27,  44,  61,  77,  95, 112,
+      0,  10,  26,  41,  57,  72,  88, 104,
+      0,  10,  28,  44,  59,  74,  90, 104,
+      0,  10,  26,  41,  57,  73,  91, 106,
+      0,  10,  25,  42,  56,  73,  88, 103,
+      0,  10,  28,  46,  63,  79,  97, 113,
+      0,  10,  28,  43,  60,  73,  91, 108,
+      0,  10,  28,  46,  61,  77,  95, 111,
+      0,  10,  28,  43,  60,  75,  93, 107,
+      0,   9,  27,  41,  56,  71,  87, 101,
+      0,  10,  27,  44,  57,  73,  88, 103,
+      0,  10,  28,  42,  59,  74,  89, 104,
+      0,  10,  28,  44,  60,  76,  93, 108,
+      0,  10,  28,  45,  63,  77,  94, 108,
+      0,  10,  28,  43,  60,  75,  91, 105,
+      0,  10,  27,  44,  58,  71,  88, 104,
+      0,  10,  27,  42,  55,  69,  86, 103,
+      0,  10,  28,  44,  59,  76,  94, 110,
+      0,  10,  28,  44,  60,  73,  90, 105,
+      0,   9,  24,  41,  54,  70,  88, 103,
+      0,  10,  28,  46,  62,  78,  96, 111,
+      0,  10,  28,  45,  56,  70,  86, 102,
+      0,  10,  28,  45,  56,  72,  90, 107,
+      0,  10,  28,  42,  59,  73,  91, 106,
+      0,   9,  27,  43,  57,  72,  88, 105,
+      0,  10,  28,  45,  57,  71,  89, 106,
+      0,  10,  28,  45,  61,  74,  92, 109,
+      0,  10,  28,  46,  61,  74,  92, 109,
+      0,   9,  27,  45,  63,  80,  98, 114,
+      0,   9,  27,  44,  61,  75,  93, 110,
+      0,   8,  25,  42,  57,  73,  90, 104,
+      0,  10,  27,  44,  57,  74,  92, 107,
+      0,  10,  28,  44,  57,  71,  88, 102,
+      0,   9,  26,  41,  55,  68,  84,  99,
+      0,   9,  25,  42,  58,  74,  91, 106,
+      0,  10,  28,  45,  62,  77,  94, 108,
+      0,   9,  27,  45,  56,  73,  88, 105,
+      0,  10,  28,  43,  55,  69,  86, 103,
+      0,  10,  27,  42,  59,  75,  93, 110,
+      0,   9,  27,  41,  58,  73,  91, 108,
+      0,  10,  28,  42,  59,  72,  88, 103,
+      0,   9,  26,  43,  59,  71,  89, 103,
+      0,   9,  26,  44,  59,  75,  93, 108,
+      0,   9,  27,  44,  61,  77,  95, 109,
+      0,  10,  28,  46,  62,  78,  95, 110,
+      0,   9,  27,  45,  61,  77,  95, 112,
+      0,  10,  28,  46,  62,  79,  97, 114,
+      0,  10,  26,  44,  60,  77,  95, 111,
+      0,   9,  26,  43,  59,  77,  95, 112,
+      0,  10,  27,  45,  61,  76,  94, 109,
+      0,  10,  26,  44,  60,  76,  94, 111,
+      0,  10,  27,  45,  59,  74,  90, 106,
+      0,  10,  28,  45,  62,  79,  97, 114,
+      0,  10,  28,  44,  59,  75,  93, 110,
+      0,  10,  28,  46,  58,  72,  90, 107,
+      0,  10,  28,  45,  56,  71,  89, 103,
+      0,  10,  28,  46,  59,  72,  90, 105,
+      0,  10,  27,  43,  60,  76,  93, 107,
+      0,   9,  27,  45,  61,  79,  97, 114,
+      0,  10,  27,  45,  60,  78,  96, 112,
+      0,  10,  28,  46,  60,  78,  96, 111,
+      0,  10,  27,  43,  59,  75,  93, 108,
+      0,   9,  26,  44,  62,  80,  98, 113,
+      0,  10,  28,  46,  64,  82, 100, 116,
+      0,  10,  28,  46,  64,  82,  98, 114,
+      0,   8,  24,  42,  58,  76,  94, 110,
+      0,   9,  27,  45,  63,  81,  96, 113,
+      0,   8,  25,  43,  61,  79,  97, 114,
+      0,  10,  27,  45,  63,  81,  98, 115,
+      0,  10,  28,  45,  62,  80,  98, 115,
+      0,  10,  28,  46,  64,  82, 100, 117,
+      0,  10,  27,  45,  63,  81,  98, 115,
+      0,  10,  28,  46,  64,  81,  99, 116,
+      0,   9,  25,  41,  59,  75,  93, 110,
+      0,  10,  28,  46,  64,  82,  97, 113,
+      0,  10,  26,  44,  57,  75,  93, 109,
+      0,  10,  24,  42,  57,  75,  92, 108,
+      0,  10,  25,  43,  61,  79,  96, 111,
+      0,  10,  28,  46,  64,  82,  99, 114,
+      0,  10,  26,  44,  61,  79,  97, 111,
+      0,   9,  26,  44,  59,  77,  95, 110,
+      0,  10,  28,  46,  60,  78,  96, 111,
+      0,  10,  28,  45,  63,  81,  97, 113,
+      0,  10,  28,  46,  63,  81,  99, 116,
+      0,  10,  28,  46,  64,  81,  98, 114,
+      0,  10,  28,  46,  64,  82, 100, 116,
+      0,  10,  28,  46,  64,  82,  99, 115,
+      0,   9,  27,  44,  62,  80,  96, 110,
+      0,  10,  28,  46,  64,  82, 100, 114,
+      0,   9,  27,  43,  60,  77,  95, 109,
+      0,   9,  26,  44,  62,  80,  98, 113,
+      0,   9,  26,  43,  61,  79,  96, 113,
+      0,  10,  27,  45,  63,  81,  99, 116,
+      0,   9,  27,  45,  63,  81,  99, 114,
+      0,  10,  27,  42,  60,  77,  95, 110,
+      0,  10,  28,  43,  61,  78,  96, 111,
+      0,   9,  27,  45,  63,  81,  99, 113,
+      0,  10,  27,  43,  61,  78,  95, 109,
+      0,  10,  28,  45,  63,  80,  98, 113,
+      0,  10,  28,  46,  64,  82, 100, 115,
+      0,   9,  27,  45,  59,  77,  95, 110,
+      0,  10,  28,  46,  62,  80,  97, 112,
+      0,  10,  28,  46,  64,  81,  98, 113,
+      0,   9,  27,  45,  62,  80,  98, 113,
+      0,   9,  27,  43,  60,  78,  95, 110,
+      0,   8,  26,  44,  62,  80,  97, 111,
+      0,   9,  26,  44,  62,  78,  94, 107,
+      0,   9,  26,  44,  62,  77,  94, 109,
+      0,   9,  27,  45,  62,  74,  92, 106,
+      0,  10,  28,  46,  64,  77,  95, 110,
+      0,   8,  26,  42,  60,  76,  94, 108,
+      0,   9,  27,  44,  61,  78,  96, 111,
+      0,   9,  26,  44,  61,  75,  93, 106,
+      0,   9,  26,  44,  61,  77,  95, 110,
+      0,  10,  28,  46,  64,  81,  98, 113,
+      0,   9,  26,  44,  61,  78,  96, 111,
+      0,   9,  27,  45,  63,  80,  98, 112,
+      0,   7,  25,  43,  60,  76,  94, 109,
+      0,   8,  26,  44,  62,  78,  96, 110,
+      0,   9,  25,  43,  61,  78,  96, 110,
+      0,  10,  28,  46,  64,  81,  98, 111,
+      0,  10,  28,  46,  64,  81,  98, 112,
+      0,  10,  26,  44,  62,  79,  96, 109,
+      0,  10,  23,  41,  59,  76,  94, 107,
+      0,  10,  27,  43,  61,  77,  95, 109,
+      0,   9,  25,  41,  52,  65,  82,  95,
+      0,  10,  27,  44,  61,  79,  97, 109,
+      0,  10,  28,  46,  62,  80,  97, 109,
+      0,   9,  26,  42,  57,  73,  91, 104,
+      0,   9,  26,  42,  58,  76,  94, 108,
+      0,  10,  25,  41,  57,  74,  91, 103,
+      0,  10,  24,  39,  57,  72,  90, 104,
+      0,   9,  26,  42,  59,  77,  94, 106,
+      0,   9,  25,  42,  58,  75,  91, 105,
+      0,   8,  25,  40,  56,  73,  89, 103,
+      0,   9,  26,  43,  61,  78,  94, 108,
+      0,   9,  22,  37,  53,  71,  86,  98,
+      0,   9,  26,  43,  61,  78,  96, 110,
+      0,   9,  26,  42,  60,  77,  93, 107,
+      0,   8,  22,  39,  55,  73,  86,  98,
+      0,   9,  25,  42,  60,  78,  92, 106,
+      0,   8,  21,  37,  53,  70,  84,  95,
+      0,   9,  24,  40,  57,  74,  90, 103,
+      0,   8,  24,  41,  59,  76,  91, 104,
+      0,   9,  25,  41,  54,  71,  87, 101,
+      0,   6,  23,  40,  58,  75,  90, 103,
+      0,   7,  20,  37,  54,  70,  82,  97,
+      0,   8,  22,  39,  57,  70,  85,  99,
+      0,   9,  22,  35,  52,  67,  84,  97,
+      0,   9,  25,  38,  55,  70,  86,  99,
+      0,  10,  25,  40,  55,  71,  88, 100,
+      0,  10,  27,  40,  58,  74,  91, 102,
+      0,   9,  24,  40,  56,  72,  86,  99,
+      0,  10,  24,  39,  54,  70,  87, 101,
+      0,  10,  26,  43,  59,  76,  93, 107,
+      0,  10,  26,  44,  60,  78,  95, 109,
+      0,   8,  22,  39,  55,  71,  86,  99,
+      0,   7,  20,  35,  51,  66,  79,  93,
+      0,   8,  22,  38,  52,  69,  81,  95,
+      0,  10,  23,  38,  55,  70,  86,  99,
+      0,   9,  22,  37,  53,  69,  86,  99,
+      0,   9,  23,  38,  53,  71,  84,  95,
+      0,   9,  26,  44,  60,  77,  91, 105,
+      0,   9,  25,  43,  59,  75,  91, 104,
+      0,   9,  25,  39,  55,  73,  88, 102,
+      0,   9,  24,  38,  54,  71,  88, 102,
+      0,  10,  26,  39,  55,  69,  87,  98,
+      0,  14,  30,  44,  60,  73,  88, 102,
+      0,   8,  24,  41,  53,  70,  84,  99,
+      0,   7,  22,  35,  49,  63,  75,  87,
+      0,  14,  28,  46,  62,  80,  97, 109,
+      0,  10,  27,  44,  61,  76,  93, 105,
+      0,  11,  27,  43,  59,  75,  91, 102,
+      0,   6,  18,  32,  42,  56,  68,  76,
+};
+
+static const unsigned char g_pucBgData[36062] =
+{
+    0xc7, 0xf7, 0xf7, 0x75, 0x00, 0xa0, 0x40, 0x40, 0x40, 0x50, 0x04, 0x80,
+    0x65, 0x00, 0x50, 0x05, 0xb0, 0x34, 0x00, 0x5a, 0x01, 0x5a, 0x90, 0x20,
+    0x05, 0x70, 0x05, 0x05, 0x50, 0x59, 0x00, 0x5a, 0x03, 0x55, 0x0a, 0xa0,
+    0x44, 0x05, 0xa0, 0x34, 0x05, 0x49, 0x06, 0x40, 0x55, 0x00, 0x5e, 0x00,
+    0x58, 0x06, 0x54, 0x40, 0x05, 0xa0, 0xb0, 0x0a, 0x70, 0x05, 0x05, 0x00,
+    0x59, 0x00, 0xa9, 0x04, 0x45, 0x50, 0xaa, 0x01, 0x40, 0x45, 0xa0, 0x40,
+    0x84, 0x90, 0x75, 0x04, 0x50, 0x05, 0x08, 0x4b, 0x06, 0x40, 0x05, 0x04,
+    0x00, 0x00, 0x8a, 0xa0, 0x14, 0x58, 0x06, 0x50, 0x50, 0x44, 0x0b, 0x4f,
+    0x40, 0xc4, 0xf4, 0x08, 0x07, 0x8c, 0xf2, 0xf2, 0x6c, 0xc7, 0x50, 0x04,
+    0xa0, 0x84, 0xa0, 0x45, 0xa0, 0x04, 0xa0, 0x04, 0x90, 0x0a, 0xa0, 0x05,
+    0x90, 0x35, 0x05, 0x00, 0x20, 0x5a, 0x80, 0x65, 0x04, 0x05, 0x54, 0x90,
+    0x84, 0x60, 0x05, 0x50, 0x50, 0x74, 0x04, 0x50, 0x45, 0x00, 0x20, 0x04,
+    0xa5, 0x60, 0x05, 0xa0, 0x04, 0xe0, 0x0a, 0x90, 0x14, 0x59, 0x00, 0x50,
+    0x50, 0x50, 0x05, 0xa8, 0x08, 0x58, 0x09, 0x42, 0x00, 0x5a, 0x03, 0x54,
+    0x04, 0x90, 0x24, 0x40, 0x14, 0x59, 0x03, 0x45, 0x05, 0x90, 0x45, 0x50,
+    0x04, 0xa0, 0x04, 0x90, 0x0a, 0x90, 0x24, 0x50, 0x30, 0x05, 0x07, 0x50,
+    0x0a, 0x50, 0x05, 0x90, 0x35, 0x50, 0x4a, 0x1f, 0x10, 0xc1, 0xf1, 0x0b,
+    0x17, 0xc8, 0x2f, 0x2f, 0x24, 0xc7, 0x00, 0x5b, 0x00, 0x90, 0x85, 0x90,
+    0x05, 0xc0, 0x85, 0x70, 0x04, 0x05, 0x00, 0xba, 0x02, 0x45, 0x00, 0x70,
+    0x40, 0x45, 0x00, 0x49, 0x06, 0x50, 0x50, 0x05, 0xa9, 0x00, 0x57, 0x40,
+    0x04, 0x40, 0x04, 0x80, 0x10, 0x49, 0x02, 0x45, 0x49, 0x00, 0x5c, 0x01,
+    0x54, 0x70, 0x04, 0x0a, 0x05, 0xba, 0x00, 0x85, 0x80, 0x65, 0x05, 0x50,
+    0x54, 0x90, 0x24, 0x05, 0x70, 0x05, 0x50, 0x40, 0x59, 0x03, 0x40, 0x04,
+    0x05, 0xd0, 0x64, 0x55, 0x04, 0x05, 0xc0, 0x05, 0x90, 0x64, 0x0a, 0x04,
+    0xb0, 0x90, 0x85, 0xa0, 0x85, 0x70, 0x04, 0x00, 0x45, 0x4a, 0x1f, 0x10,
+    0xc1, 0xf1, 0x0b, 0x67, 0x22, 0xc2, 0x2c, 0xf2, 0x12, 0xc8, 0x26, 0xc2,
+    0x27, 0x04, 0x5b, 0x00, 0x00, 0x75, 0x50, 0x45, 0x00, 0xac, 0x00, 0x48,
+    0x07, 0xa4, 0x05, 0x00, 0xa5, 0x90, 0x05, 0x80, 0x90, 0x1a, 0x59, 0x01,
+    0x50, 0x75, 0x04, 0x50, 0x05, 0xb9, 0x08, 0x56, 0x00, 0xa0, 0x04, 0x58,
+    0x00, 0x60, 0x50, 0x05, 0x50, 0x75, 0x50, 0x0a, 0x00, 0x48, 0x07, 0x45,
+    0x00, 0xa0, 0x05, 0x80, 0x85, 0x90, 0x65, 0x00, 0x40, 0x0a, 0x75, 0x00,
+    0x55, 0x05, 0x08, 0x58, 0x08, 0xa9, 0x07, 0xaa, 0x00, 0x50, 0x05, 0x05,
+    0xc0, 0x75, 0x40, 0x55, 0x04, 0xac, 0x06, 0x50, 0x0a, 0x00, 0x58, 0x08,
+    0x50, 0x90, 0x05, 0xb0, 0x1a, 0x58, 0x08, 0x56, 0x05, 0x44, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70,
+    0x40, 0x40, 0x50, 0x40, 0x54, 0x55, 0x04, 0xab, 0x03, 0x50, 0x04, 0x90,
+    0x3b, 0x50, 0x59, 0x06, 0x50, 0x50, 0x50, 0x40, 0x80, 0x65, 0x50, 0x05,
+    0x05, 0x90, 0x55, 0x00, 0x54, 0xb9, 0x04, 0x55, 0x00, 0x5a, 0x01, 0x40,
+    0x04, 0x70, 0x45, 0xa0, 0x04, 0xab, 0x00, 0x58, 0x07, 0x50, 0x04, 0xb0,
+    0x04, 0x90, 0x35, 0x0a, 0x00, 0x65, 0x04, 0x40, 0x5a, 0x70, 0x05, 0x5a,
+    0x05, 0x49, 0x02, 0x55, 0xa9, 0x07, 0x55, 0x00, 0x50, 0x04, 0x90, 0x05,
+    0x70, 0x50, 0x54, 0x05, 0xab, 0x00, 0x48, 0x07, 0x40, 0x04, 0xb0, 0x04,
+    0x90, 0x05, 0x74, 0x50, 0x50, 0x40, 0x48, 0x58, 0x09, 0x56, 0x04, 0x04,
+    0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x07, 0x84, 0x90, 0x05, 0x80, 0x25, 0x45, 0xe0, 0x34, 0x05, 0x49, 0x03,
+    0xa5, 0x05, 0x80, 0x75, 0x40, 0xa5, 0x00, 0x50, 0x04, 0x90, 0x95, 0x10,
+    0x59, 0x05, 0x50, 0x55, 0x05, 0x90, 0x65, 0xa0, 0x04, 0x05, 0xa0, 0x04,
+    0x70, 0x5a, 0x00, 0x40, 0x4c, 0x01, 0x4a, 0xa0, 0x2a, 0x50, 0x75, 0x00,
+    0x55, 0x0a, 0x50, 0x20, 0x0a, 0xa0, 0x45, 0x45, 0x04, 0x90, 0x05, 0x70,
+    0x5a, 0x0a, 0x05, 0x08, 0x59, 0x09, 0x40, 0x90, 0x74, 0x05, 0x54, 0x40,
+    0x4e, 0x00, 0x5a, 0x07, 0xa4, 0x05, 0x05, 0x50, 0x50, 0xa4, 0x00, 0x5a,
+    0x09, 0x58, 0x46, 0x00, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x67, 0x22, 0xc2, 0x2c, 0xf2, 0x72, 0xc2, 0x2c, 0x22, 0x7d, 0x00,
+    0x40, 0x70, 0x05, 0x04, 0x05, 0xaa, 0x01, 0x5a, 0xa0, 0x84, 0x70, 0x40,
+    0x54, 0x00, 0x59, 0x00, 0x50, 0xa0, 0x05, 0x80, 0x85, 0x90, 0x05, 0x70,
+    0x5a, 0x50, 0x05, 0x08, 0x5a, 0x00, 0x49, 0x00, 0x40, 0x50, 0x05, 0x00,
+    0x5a, 0x00, 0xaa, 0x08, 0xa6, 0x00, 0x40, 0x05, 0x07, 0x50, 0x5a, 0x00,
+    0xa4, 0x20, 0x45, 0x90, 0x85, 0x74, 0x05, 0x50, 0x04, 0x57, 0x05, 0xa5,
+    0x00, 0xa0, 0x85, 0xa0, 0x14, 0x00, 0xb0, 0x65, 0x00, 0x50, 0x40, 0x85,
+    0xa0, 0x1a, 0x5a, 0x07, 0x45, 0x04, 0x05, 0x40, 0x10, 0x59, 0x00, 0x5a,
+    0x00, 0x58, 0x08, 0x56, 0x00, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xd0, 0x0a, 0x20, 0x05, 0xa0,
+    0x0a, 0xb0, 0x4a, 0x40, 0x04, 0x80, 0x8a, 0xa0, 0x14, 0x5a, 0x00, 0x00,
+    0x74, 0x04, 0x50, 0x05, 0xa9, 0x03, 0x50, 0x05, 0x7a, 0x00, 0x50, 0x50,
+    0x5a, 0x00, 0x49, 0x00, 0x00, 0x85, 0xd0, 0x05, 0xb0, 0x85, 0x60, 0x05,
+    0x00, 0xa5, 0xa0, 0x24, 0x50, 0x70, 0x40, 0x04, 0x05, 0xa8, 0x08, 0xa6,
+    0x00, 0x45, 0x04, 0x57, 0xa0, 0x05, 0x05, 0x05, 0x90, 0x84, 0xa0, 0x45,
+    0x50, 0x05, 0x90, 0x14, 0x5a, 0x01, 0x5a, 0x74, 0x00, 0x40, 0x0a, 0x5a,
+    0x00, 0x14, 0x5e, 0x03, 0x40, 0x0a, 0x75, 0x00, 0x44, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x40,
+    0x44, 0x00, 0x40, 0x04, 0x80, 0x74, 0x50, 0x05, 0x00, 0x48, 0x06, 0x5b,
+    0x00, 0x54, 0x07, 0x55, 0x04, 0x04, 0x05, 0xa0, 0x1a, 0x5a, 0x03, 0x55,
+    0x05, 0x84, 0xa0, 0x35, 0x00, 0x48, 0x59, 0x06, 0x45, 0x04, 0x05, 0x40,
+    0x20, 0x05, 0x90, 0x35, 0x50, 0x4a, 0x06, 0x40, 0xaa, 0x00, 0xa8, 0x08,
+    0x56, 0x04, 0x40, 0x05, 0x00, 0x90, 0x2a, 0x40, 0x74, 0x00, 0x55, 0x4a,
+    0x08, 0x47, 0x00, 0x45, 0x00, 0x54, 0x75, 0x40, 0x05, 0x50, 0x50, 0x30,
+    0x54, 0x08, 0x49, 0x01, 0x54, 0xa0, 0x04, 0x75, 0x00, 0x5a, 0x00, 0x57,
+    0x00, 0x54, 0x40, 0x40, 0x10, 0x5a, 0x00, 0xab, 0x08, 0x47, 0x0a, 0x04,
+    0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x07, 0x90, 0x85, 0x90, 0x6a, 0x00, 0x40, 0x05, 0xa0, 0x34, 0x04, 0xad,
+    0x08, 0x5e, 0x00, 0x1a, 0x5b, 0x09, 0x59, 0x4d, 0x02, 0x44, 0x59, 0x00,
+    0xa9, 0x08, 0x50, 0x80, 0x75, 0xa0, 0x05, 0x00, 0xaa, 0x01, 0x40, 0x85,
+    0xd0, 0x8a, 0x90, 0x14, 0x00, 0x44, 0x00, 0xa5, 0xb0, 0x1a, 0x5a, 0x4a,
+    0x00, 0x48, 0x06, 0x54, 0x40, 0x04, 0x58, 0x00, 0x00, 0x8a, 0x80, 0x74,
+    0x50, 0x05, 0x00, 0x5a, 0x01, 0x40, 0x85, 0xd0, 0x1a, 0x48, 0x00, 0xc0,
+    0x1a, 0x5b, 0x00, 0x59, 0x04, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x50, 0x55, 0x00, 0xa0,
+    0x74, 0x00, 0x50, 0x05, 0x07, 0x54, 0x05, 0x50, 0x05, 0x90, 0x35, 0x44,
+    0xaa, 0x00, 0x59, 0x00, 0xa0, 0x00, 0x85, 0xa0, 0x45, 0xa0, 0x5a, 0xe0,
+    0x15, 0xaa, 0x03, 0x40, 0x50, 0x8a, 0x20, 0x0a, 0x90, 0x4a, 0x04, 0x50,
+    0x75, 0x50, 0x55, 0x05, 0x49, 0x01, 0x54, 0x75, 0xa5, 0x40, 0x45, 0x00,
+    0x50, 0x0a, 0x04, 0x58, 0x07, 0x40, 0xa5, 0x05, 0xa4, 0xd0, 0x14, 0x59,
+    0x03, 0x40, 0x05, 0x40, 0x5a, 0x04, 0x7a, 0x40, 0x05, 0x00, 0x47, 0x04,
+    0x40, 0xa0, 0x05, 0xa0, 0x64, 0x05, 0xa0, 0x40, 0xa0, 0x24, 0xa0, 0x85,
+    0xa0, 0x05, 0x74, 0x05, 0xa4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0xa4, 0xa5, 0x00, 0xa0, 0x30,
+    0x40, 0x47, 0x50, 0x04, 0x55, 0x04, 0x90, 0x65, 0x05, 0x00, 0xa4, 0x90,
+    0x04, 0x90, 0x25, 0x45, 0x30, 0x0a, 0x57, 0x00, 0x44, 0x50, 0x5a, 0xa0,
+    0x04, 0x70, 0x45, 0x5a, 0x00, 0x49, 0x03, 0xa4, 0xa5, 0x40, 0x4a, 0x04,
+    0x70, 0x54, 0x00, 0xaa, 0x47, 0x04, 0x40, 0x54, 0x0a, 0x70, 0x0b, 0x50,
+    0x40, 0x59, 0x00, 0x04, 0x70, 0xa0, 0x0a, 0x50, 0x59, 0x43, 0x05, 0xa4,
+    0x90, 0x84, 0xa5, 0x20, 0x05, 0x90, 0x0a, 0x30, 0xa5, 0x08, 0x59, 0x06,
+    0x55, 0x00, 0x5a, 0x47, 0x05, 0x04, 0x40, 0x05, 0x70, 0x4a, 0x50, 0x40,
+    0x40, 0x90, 0x55, 0x05, 0x00, 0xaa, 0x00, 0x47, 0x00, 0x5a, 0x41, 0x16,
+    0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x47, 0x44,
+    0x05, 0x90, 0x05, 0x40, 0x50, 0x05, 0xe0, 0x55, 0x50, 0x05, 0x49, 0x01,
+    0x45, 0x70, 0x54, 0x04, 0x54, 0x00, 0x70, 0x05, 0x40, 0x45, 0x49, 0x04,
+    0x55, 0x00, 0x59, 0x01, 0xa4, 0x90, 0x75, 0x00, 0x55, 0x0a, 0x40, 0x15,
+    0x09, 0x53, 0x00, 0x50, 0xa4, 0x90, 0x7a, 0x50, 0x0a, 0x50, 0x47, 0x05,
+    0x50, 0xa4, 0x40, 0xb0, 0x5a, 0x50, 0x4a, 0x59, 0x04, 0x45, 0x05, 0xa9,
+    0x01, 0xa5, 0x90, 0x04, 0x80, 0x85, 0x10, 0x59, 0x09, 0x52, 0x00, 0x5e,
+    0x04, 0x54, 0x00, 0x57, 0x00, 0x40, 0x44, 0x0a, 0x30, 0x40, 0x5a, 0x00,
+    0x59, 0x01, 0x54, 0x90, 0x45, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x90, 0x45, 0x05, 0x40, 0x05, 0xb0,
+    0x3a, 0x40, 0x5b, 0x09, 0x5a, 0x00, 0x5f, 0x00, 0x25, 0x45, 0x90, 0x8a,
+    0xa0, 0x35, 0x05, 0xa9, 0x04, 0x44, 0x00, 0xab, 0x02, 0x4a, 0x00, 0x05,
+    0x84, 0x95, 0x70, 0x40, 0xa4, 0x05, 0x48, 0x09, 0x52, 0xaa, 0x47, 0x00,
+    0x45, 0x40, 0x40, 0x84, 0x80, 0x64, 0x55, 0x40, 0x40, 0x8a, 0xa0, 0x1a,
+    0x08, 0xad, 0x03, 0xa0, 0x04, 0x80, 0x75, 0x50, 0x54, 0x55, 0x4a, 0x05,
+    0xb4, 0x05, 0x04, 0x90, 0x95, 0xa0, 0x35, 0x00, 0x40, 0xb0, 0x34, 0x54,
+    0x59, 0x01, 0xa5, 0xa0, 0x34, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x54, 0x45, 0x5a, 0x00, 0x20,
+    0x04, 0x90, 0x4a, 0xa0, 0x54, 0x90, 0x95, 0x90, 0x45, 0x50, 0x0a, 0xc0,
+    0x04, 0x50, 0x5a, 0x05, 0x08, 0x5a, 0x03, 0x50, 0x0a, 0xb0, 0x2a, 0x54,
+    0x70, 0x5a, 0x04, 0x05, 0x40, 0x04, 0x7a, 0x00, 0x45, 0x44, 0x07, 0xaa,
+    0x0a, 0x50, 0x40, 0x85, 0x84, 0x80, 0x85, 0x60, 0x0a, 0x50, 0x40, 0x20,
+    0x05, 0x70, 0x55, 0x45, 0x4a, 0x57, 0x44, 0x00, 0xa0, 0x4a, 0xb0, 0x7a,
+    0x45, 0x0a, 0xa0, 0x50, 0x44, 0x54, 0x5a, 0x80, 0x85, 0x90, 0x4a, 0x50,
+    0xa4, 0x90, 0x85, 0xa0, 0x05, 0x90, 0x15, 0x00, 0x10, 0x49, 0x06, 0x40,
+    0xa5, 0x44, 0x08, 0x5a, 0x03, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x00, 0x50, 0x50, 0x85, 0x80, 0x84,
+    0x60, 0x05, 0x00, 0xa5, 0xa0, 0x3a, 0x00, 0x49, 0x01, 0x50, 0x7a, 0x00,
+    0x55, 0x00, 0x50, 0x00, 0x75, 0xa0, 0x45, 0x04, 0x59, 0x04, 0x55, 0x0a,
+    0x4a, 0x01, 0x5a, 0x80, 0x6a, 0x50, 0x5a, 0x4a, 0x50, 0xa4, 0x04, 0x07,
+    0x50, 0x05, 0x54, 0xb5, 0x90, 0x14, 0xa8, 0x06, 0x50, 0x40, 0x50, 0xa8,
+    0x08, 0x50, 0x10, 0x47, 0xa0, 0x8a, 0x44, 0xa0, 0x85, 0x70, 0x04, 0xaa,
+    0x0a, 0x5a, 0x07, 0x54, 0x00, 0xb5, 0x04, 0x45, 0x05, 0x05, 0x80, 0x84,
+    0x75, 0x04, 0x54, 0x0a, 0x49, 0x01, 0x45, 0xc0, 0x35, 0x45, 0x00, 0x30,
+    0x44, 0x08, 0x57, 0x0a, 0xa0, 0x05, 0x04, 0xa0, 0x34, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x0a,
+    0x05, 0x05, 0x00, 0x1a, 0x4a, 0x07, 0xa0, 0x45, 0x50, 0x05, 0x70, 0xa4,
+    0x0a, 0x04, 0x08, 0x49, 0x04, 0x44, 0x05, 0x00, 0x40, 0x4a, 0x40, 0x94,
+    0x05, 0x90, 0x54, 0x50, 0x05, 0x07, 0xa5, 0x00, 0x50, 0x4a, 0x90, 0x0a,
+    0x85, 0x40, 0x40, 0xa4, 0x90, 0x45, 0xa0, 0x5a, 0x90, 0x3a, 0x4a, 0x07,
+    0x4a, 0x40, 0x05, 0x05, 0x80, 0x85, 0x24, 0x40, 0x85, 0x7a, 0x80, 0x40,
+    0x55, 0x09, 0x44, 0x50, 0x45, 0x07, 0xa4, 0x00, 0x50, 0x5a, 0x90, 0x5a,
+    0x45, 0x04, 0x07, 0xa0, 0x05, 0x05, 0x50, 0x85, 0x90, 0x55, 0x0a, 0x00,
+    0xa9, 0x00, 0x59, 0x00, 0x50, 0x40, 0x04, 0x07, 0x45, 0xa4, 0x05, 0x05,
+    0xa0, 0x34, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x37, 0x50, 0x4b, 0x00, 0x0a, 0x90, 0x14, 0x57, 0x00, 0xa5,
+    0x40, 0x05, 0xa0, 0x75, 0x04, 0x00, 0xa0, 0x59, 0x02, 0x45, 0x00, 0x35,
+    0x45, 0x4a, 0x00, 0x5b, 0x00, 0x47, 0x05, 0x0a, 0x54, 0x45, 0x80, 0x65,
+    0x0a, 0x04, 0x40, 0x90, 0x0a, 0x90, 0x5a, 0x54, 0x0b, 0x59, 0x05, 0xa0,
+    0x04, 0x4a, 0x84, 0x70, 0x45, 0x0a, 0x40, 0x40, 0x24, 0x50, 0xb5, 0x90,
+    0x65, 0x00, 0x40, 0x04, 0x70, 0x50, 0xb5, 0x54, 0x5a, 0x01, 0xa0, 0x84,
+    0xa0, 0x0a, 0x90, 0x5a, 0x50, 0x0b, 0x59, 0x00, 0xaa, 0x07, 0x54, 0x40,
+    0x05, 0x05, 0xa0, 0x34, 0x05, 0x08, 0x59, 0x01, 0x45, 0x90, 0x34, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27,
+    0x45, 0xc0, 0x60, 0x40, 0x0a, 0x50, 0x84, 0xf0, 0x50, 0x50, 0x04, 0x57,
+    0x05, 0x50, 0x04, 0x40, 0x45, 0x40, 0x05, 0x90, 0x05, 0x70, 0x05, 0x50,
+    0xa0, 0xab, 0x56, 0xa5, 0x54, 0x05, 0x49, 0x00, 0x30, 0x04, 0x08, 0x47,
+    0x0a, 0x04, 0x05, 0x40, 0xa4, 0x00, 0x94, 0x05, 0x84, 0x6a, 0x50, 0x55,
+    0x05, 0x75, 0xa0, 0x45, 0x04, 0xa9, 0x05, 0xa5, 0x45, 0x40, 0x75, 0x0a,
+    0xa5, 0x45, 0x49, 0x53, 0x00, 0x5a, 0x10, 0x4b, 0x07, 0x50, 0x45, 0x00,
+    0x45, 0x90, 0x05, 0xc0, 0x65, 0x00, 0x55, 0x05, 0x20, 0x04, 0x70, 0x44,
+    0x54, 0x00, 0x48, 0x09, 0x45, 0x04, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x05, 0xb0, 0x05, 0x60, 0x05,
+    0x05, 0x04, 0x85, 0xa0, 0x05, 0xd0, 0x74, 0xa5, 0x44, 0x50, 0x59, 0x00,
+    0x74, 0x50, 0x05, 0x45, 0x07, 0x4a, 0x0a, 0x50, 0x50, 0x75, 0x50, 0x5a,
+    0x40, 0x57, 0xaa, 0x55, 0xa0, 0x54, 0x20, 0x0a, 0xa0, 0x25, 0x04, 0x75,
+    0x45, 0x05, 0x4a, 0x59, 0x0a, 0x46, 0xa8, 0x4a, 0x55, 0xa0, 0x00, 0x85,
+    0x7a, 0x50, 0x4a, 0x55, 0x09, 0x51, 0xa5, 0x74, 0xa0, 0x55, 0x04, 0xa7,
+    0x44, 0x5a, 0xa4, 0x5a, 0x50, 0x54, 0x04, 0x5a, 0x00, 0x58, 0x06, 0x45,
+    0x40, 0x55, 0xad, 0x04, 0x5a, 0x40, 0x50, 0x24, 0x45, 0x70, 0x40, 0xa4,
+    0x04, 0x5a, 0x06, 0x50, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xa0, 0x35, 0x00, 0x50, 0xa0, 0x75,
+    0x0a, 0x55, 0x00, 0x5a, 0x03, 0x50, 0x54, 0x90, 0x55, 0x40, 0x05, 0xa9,
+    0x00, 0x50, 0x05, 0x00, 0x57, 0xa0, 0x5a, 0x00, 0x40, 0x85, 0xa0, 0x6b,
+    0x40, 0x40, 0xa5, 0x90, 0x14, 0xa0, 0x70, 0x05, 0x40, 0x54, 0xa7, 0x0a,
+    0x5a, 0x54, 0x40, 0x75, 0x04, 0xa0, 0x55, 0x47, 0x00, 0xa5, 0x00, 0x5a,
+    0x40, 0x04, 0x50, 0x7a, 0x54, 0x5a, 0x05, 0xa8, 0x06, 0x55, 0xaa, 0x00,
+    0x57, 0x0d, 0x00, 0x44, 0xa4, 0x80, 0x70, 0x45, 0x00, 0x54, 0x07, 0x54,
+    0x50, 0xa0, 0x54, 0x90, 0x45, 0x04, 0x50, 0x85, 0x90, 0x05, 0x80, 0x00,
+    0x85, 0x90, 0x74, 0x05, 0x00, 0x45, 0x07, 0x54, 0x00, 0x41, 0x16, 0xd7,
+    0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x00, 0x40,
+    0xa4, 0x80, 0x90, 0x35, 0x50, 0xa7, 0x00, 0x50, 0xa5, 0x05, 0x90, 0x1a,
+    0x59, 0x05, 0x55, 0x00, 0x4a, 0x90, 0x80, 0x7a, 0x55, 0x40, 0x04, 0x5a,
+    0x08, 0x57, 0x00, 0xa0, 0xa4, 0x54, 0x70, 0x45, 0x00, 0x50, 0xa0, 0x65,
+    0x04, 0x00, 0xa8, 0x74, 0x0a, 0x00, 0x50, 0xb7, 0xa0, 0xa5, 0x40, 0xba,
+    0x80, 0x64, 0xa4, 0x00, 0x5a, 0x70, 0x48, 0x40, 0xa5, 0xa7, 0x40, 0x05,
+    0xa4, 0x05, 0x70, 0x5a, 0x40, 0xa0, 0xa7, 0x45, 0x40, 0x54, 0x04, 0x15,
+    0x07, 0xa0, 0x05, 0x04, 0x4a, 0x70, 0x0a, 0x00, 0x50, 0xa9, 0x54, 0x44,
+    0x0a, 0x59, 0x00, 0x58, 0x00, 0x20, 0x45, 0x70, 0x04, 0x00, 0x50, 0x5a,
+    0x06, 0x50, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x47, 0x04, 0x40, 0x85, 0x80, 0x90, 0x5a, 0x40, 0xa5,
+    0x07, 0x50, 0x5a, 0x05, 0x05, 0x70, 0xa0, 0x55, 0x00, 0x49, 0x00, 0x59,
+    0x00, 0x40, 0x05, 0x0a, 0x74, 0x05, 0xa5, 0x40, 0x49, 0x05, 0xa5, 0xa0,
+    0x54, 0x8a, 0x70, 0x50, 0x45, 0x40, 0xa0, 0x08, 0x84, 0x60, 0x55, 0xb5,
+    0xdf, 0xad, 0x0f, 0xad, 0x35, 0x0a, 0x48, 0x56, 0x44, 0x55, 0x04, 0x50,
+    0x74, 0x55, 0x00, 0x55, 0xa7, 0x40, 0xa5, 0x5a, 0x45, 0x90, 0x3a, 0x5a,
+    0x08, 0x46, 0xba, 0x0a, 0x40, 0x50, 0x30, 0x0a, 0x4b, 0x04, 0xa0, 0x0a,
+    0x48, 0x57, 0x0b, 0x55, 0xa4, 0x40, 0x7a, 0x05, 0x40, 0x05, 0x00, 0x50,
+    0x05, 0x05, 0x47, 0x00, 0x40, 0x50, 0x05, 0x74, 0x55, 0x04, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x05,
+    0x90, 0x05, 0x80, 0x30, 0x05, 0xa7, 0x00, 0xa5, 0x00, 0x50, 0x84, 0x70,
+    0x0a, 0x40, 0x0a, 0x59, 0x00, 0xa8, 0x59, 0x00, 0x50, 0x60, 0x44, 0x55,
+    0x04, 0x8a, 0x90, 0x0a, 0x90, 0x75, 0x50, 0x0a, 0x0a, 0xb7, 0x0a, 0x00,
+    0xa0, 0x50, 0x6a, 0x05, 0x0a, 0x4b, 0x8f, 0xb1, 0x0f, 0xb1, 0x35, 0x00,
+    0xd7, 0x80, 0x05, 0x54, 0xa4, 0x34, 0x54, 0x08, 0x58, 0xa7, 0x05, 0xba,
+    0x54, 0x0a, 0x70, 0x04, 0x55, 0x00, 0xa7, 0x0a, 0xa0, 0xa4, 0x0a, 0x40,
+    0x44, 0x50, 0x74, 0x05, 0x4a, 0x00, 0xba, 0x56, 0x04, 0x50, 0x4a, 0x57,
+    0x00, 0xb5, 0x00, 0x45, 0x25, 0xa4, 0xb0, 0x85, 0x90, 0x1a, 0x59, 0x03,
+    0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x27, 0x0a, 0x90, 0x25, 0x05, 0x45, 0x44, 0x05, 0x70, 0x55, 0x00, 0x40,
+    0x57, 0x40, 0x05, 0x40, 0x4b, 0x90, 0x34, 0xa4, 0xaa, 0x00, 0x60, 0x54,
+    0x55, 0x04, 0x85, 0x64, 0x04, 0xa0, 0x4a, 0x74, 0x40, 0x4a, 0x05, 0x47,
+    0x05, 0x00, 0xa4, 0xa0, 0x5a, 0x05, 0xaa, 0x59, 0xf3, 0x11, 0xf1, 0x8f,
+    0x81, 0x7f, 0xf1, 0xd0, 0xad, 0x09, 0x43, 0xa5, 0xa0, 0x70, 0x45, 0x45,
+    0x45, 0xa7, 0x04, 0xaa, 0x40, 0xa5, 0x70, 0x5a, 0x54, 0x04, 0xa7, 0x05,
+    0x50, 0x50, 0x4a, 0x00, 0x75, 0x45, 0x0a, 0x5a, 0x48, 0x57, 0x0a, 0x04,
+    0x54, 0x0a, 0x74, 0x00, 0xa0, 0x05, 0xd9, 0x08, 0x50, 0x10, 0x59, 0x00,
+    0x5a, 0x00, 0x48, 0x08, 0x56, 0x00, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96,
+    0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x40, 0x04, 0xa0,
+    0x40, 0x05, 0x70, 0x50, 0x45, 0x0a, 0x07, 0x50, 0x0a, 0x00, 0x45, 0x90,
+    0x35, 0x00, 0x49, 0x04, 0x50, 0x05, 0xa0, 0x70, 0x44, 0x0a, 0x44, 0x07,
+    0x45, 0x4a, 0x00, 0x5a, 0x90, 0x45, 0xb0, 0x50, 0x75, 0x50, 0x4a, 0x05,
+    0x00, 0x0a, 0x84, 0x8a, 0x6d, 0xf1, 0xd5, 0xd5, 0x9f, 0x0d, 0x75, 0x5d,
+    0x11, 0x54, 0xa7, 0x04, 0xa5, 0x00, 0xa0, 0x00, 0x8a, 0x75, 0x44, 0x0a,
+    0x54, 0x09, 0x54, 0xa0, 0x55, 0xa9, 0x08, 0xa7, 0x05, 0x05, 0x40, 0x45,
+    0x00, 0x95, 0x00, 0x74, 0x5a, 0xa0, 0x55, 0x47, 0xa5, 0x50, 0x45, 0x04,
+    0x85, 0x90, 0x05, 0xb0, 0x10, 0x58, 0x07, 0x45, 0x04, 0x00, 0x54, 0x80,
+    0x74, 0x04, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x04, 0x00, 0x55, 0x00, 0x20, 0x05, 0xa0,
+    0x0d, 0x75, 0x40, 0x05, 0x04, 0x57, 0x04, 0x40, 0x04, 0x4a, 0xc0, 0x85,
+    0x60, 0x44, 0x04, 0xa5, 0x74, 0x40, 0x4a, 0x0b, 0x5a, 0x01, 0x5a, 0x84,
+    0x60, 0xa8, 0x40, 0x45, 0x84, 0x4a, 0xa0, 0x0a, 0x9f, 0x74, 0x4d, 0x5f,
+    0xfd, 0x47, 0x0a, 0x5f, 0x1b, 0x04, 0x7a, 0x5a, 0x40, 0x44, 0x00, 0x65,
+    0xa8, 0x04, 0x40, 0x85, 0x6a, 0x44, 0x05, 0xa0, 0x7d, 0x50, 0x04, 0x05,
+    0xa7, 0x44, 0x0a, 0xa4, 0x05, 0x15, 0x07, 0x45, 0xa0, 0x05, 0x50, 0x74,
+    0x05, 0xd4, 0x50, 0x48, 0x08, 0x57, 0x05, 0x40, 0x55, 0x45, 0x80, 0x10,
+    0x48, 0x08, 0x5a, 0x00, 0x58, 0x4a, 0x04, 0x54, 0x11, 0x6d, 0x79, 0x60,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x55, 0x05,
+    0x05, 0x00, 0x90, 0x05, 0x80, 0x85, 0xa0, 0x15, 0x49, 0x07, 0x44, 0x05,
+    0xa0, 0x45, 0x90, 0x05, 0x90, 0x94, 0x45, 0x0a, 0xa0, 0x74, 0x54, 0x05,
+    0xd5, 0x07, 0x54, 0x04, 0x45, 0x50, 0x74, 0x54, 0x54, 0xa5, 0xa0, 0x14,
+    0xa9, 0x41, 0xf1, 0x7d, 0x05, 0xa0, 0xdf, 0xd7, 0x54, 0x54, 0xd1, 0xd0,
+    0x8a, 0x60, 0xa4, 0x40, 0x0a, 0x95, 0xb4, 0x8a, 0x60, 0x44, 0x00, 0x5d,
+    0x94, 0x35, 0x00, 0x47, 0x84, 0x04, 0x50, 0x45, 0x7a, 0x5a, 0x4a, 0x00,
+    0x47, 0x5a, 0x50, 0x5a, 0x05, 0x70, 0xa5, 0x54, 0x00, 0x47, 0x00, 0x5a,
+    0x05, 0x40, 0x80, 0x65, 0x04, 0x40, 0x04, 0x80, 0x85, 0x80, 0x64, 0x00,
+    0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x37, 0x00, 0x59, 0x01, 0x50, 0x64, 0x00, 0x40, 0x0a, 0x90, 0x3a, 0x00,
+    0x5a, 0x05, 0x50, 0x0a, 0x05, 0x70, 0x44, 0x05, 0x0a, 0x40, 0x75, 0x4a,
+    0x0a, 0x54, 0x57, 0x0b, 0x50, 0xa5, 0x0a, 0x75, 0x54, 0xa4, 0x00, 0xa7,
+    0x4a, 0x40, 0x0a, 0x54, 0x10, 0x57, 0xa5, 0x5f, 0x1d, 0x4b, 0x70, 0x0f,
+    0x1d, 0x55, 0x07, 0x8d, 0xfd, 0x05, 0xa4, 0x88, 0x94, 0x0a, 0x10, 0xb9,
+    0x51, 0xa4, 0x7a, 0xa5, 0x40, 0xb4, 0x07, 0xb5, 0x0a, 0x5a, 0x05, 0x90,
+    0x5a, 0x45, 0x00, 0x40, 0x4a, 0x40, 0x04, 0x95, 0x60, 0x50, 0x5a, 0x40,
+    0x85, 0x60, 0x55, 0x04, 0x40, 0x75, 0x05, 0x50, 0x40, 0x40, 0x24, 0x05,
+    0x70, 0xa4, 0x54, 0xa0, 0x59, 0x47, 0x0a, 0x00, 0x41, 0x16, 0xd7, 0x96,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0x00, 0x5b, 0x00,
+    0x24, 0x45, 0x90, 0x7a, 0x04, 0x4a, 0x40, 0x4c, 0x00, 0x5b, 0x43, 0x00,
+    0xa0, 0x85, 0x20, 0x4a, 0x75, 0x40, 0x4a, 0x08, 0x48, 0x59, 0x07, 0x5a,
+    0x0a, 0x50, 0x4d, 0x75, 0xa5, 0x00, 0xaa, 0x00, 0x70, 0x54, 0x5a, 0xf1,
+    0xd7, 0x4a, 0x04, 0xf1, 0xd0, 0x7a, 0x04, 0xd1, 0xd0, 0xa7, 0x48, 0xa8,
+    0x54, 0x4a, 0x50, 0xaa, 0x04, 0x59, 0x46, 0x5a, 0x0a, 0x08, 0x47, 0x04,
+    0x45, 0x50, 0xb4, 0x70, 0x0d, 0x5a, 0x40, 0x40, 0x3a, 0x40, 0x48, 0x07,
+    0x5a, 0xa4, 0x00, 0xa0, 0xa5, 0x10, 0x59, 0x00, 0x47, 0x00, 0x54, 0x04,
+    0x45, 0x00, 0x74, 0xa0, 0xa4, 0x04, 0x59, 0x01, 0x45, 0x70, 0x50, 0x44,
+    0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x17, 0x5b, 0x01, 0x50, 0x45, 0x0a, 0x40, 0x75, 0x40, 0x44, 0x54, 0x5a,
+    0x03, 0x45, 0x0a, 0x80, 0x95, 0x50, 0x04, 0x0a, 0x40, 0x60, 0xa0, 0x40,
+    0x4a, 0xa5, 0x44, 0x05, 0x40, 0x74, 0x54, 0xa4, 0x08, 0xa7, 0x55, 0x4a,
+    0x44, 0x85, 0x70, 0x50, 0xa4, 0xf1, 0xd7, 0xa5, 0x0a, 0xf1, 0xf5, 0x94,
+    0x2d, 0x1d, 0x75, 0xb0, 0x4a, 0x88, 0x08, 0x40, 0x54, 0xa5, 0x0a, 0x07,
+    0x50, 0x4b, 0x45, 0x5a, 0xb4, 0x45, 0xa0, 0xa4, 0x70, 0x5b, 0x45, 0x4a,
+    0x50, 0x00, 0x94, 0x15, 0x07, 0x54, 0xa4, 0x05, 0x50, 0x95, 0x2a, 0x05,
+    0x90, 0x05, 0x70, 0x48, 0x00, 0x45, 0x40, 0x70, 0x40, 0x05, 0x00, 0x59,
+    0x01, 0x5a, 0x80, 0x64, 0x40, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x50, 0x04, 0xa0, 0x85, 0x05, 0x80,
+    0x74, 0x0a, 0x50, 0x05, 0x07, 0x5a, 0x00, 0x55, 0x40, 0x7a, 0xa0, 0x05,
+    0x5a, 0x58, 0x09, 0x50, 0x50, 0x55, 0x00, 0xa7, 0x54, 0x5b, 0xa0, 0x50,
+    0x7a, 0x54, 0x0a, 0x44, 0x08, 0xa7, 0x50, 0x5a, 0x40, 0xab, 0x30, 0xa5,
+    0xa7, 0x0f, 0x1d, 0xba, 0x05, 0x8f, 0x7d, 0xa0, 0x5a, 0xd1, 0xd8, 0xa7,
+    0x08, 0xa8, 0xb8, 0x05, 0x08, 0x8a, 0x60, 0x58, 0x00, 0xa5, 0x74, 0x5b,
+    0xa0, 0x44, 0xa9, 0x50, 0xa8, 0x47, 0x0a, 0xa4, 0x0a, 0x50, 0x50, 0xaa,
+    0x4a, 0x57, 0xa0, 0x55, 0x0a, 0x50, 0x75, 0xa0, 0xa5, 0x00, 0xa7, 0x44,
+    0x0a, 0xa0, 0x04, 0x85, 0x64, 0x05, 0x54, 0x40, 0x84, 0x80, 0x85, 0x80,
+    0x6b, 0x40, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x75, 0x00, 0xa5, 0x05, 0x00, 0x45, 0x00, 0x40, 0x7a,
+    0x40, 0x0a, 0x04, 0xa8, 0x08, 0x58, 0x08, 0xa6, 0x00, 0xaa, 0x44, 0x08,
+    0xa8, 0x40, 0x50, 0x0b, 0x44, 0x59, 0x05, 0xd0, 0x4a, 0x0b, 0xc5, 0x40,
+    0xaa, 0x84, 0x85, 0x84, 0x8b, 0x34, 0xa5, 0xa7, 0x0d, 0x1d, 0xba, 0x05,
+    0x8f, 0x7d, 0xa5, 0x0a, 0xdf, 0xd8, 0xa7, 0x00, 0xba, 0x54, 0x0b, 0x5a,
+    0x55, 0x04, 0xb9, 0x46, 0x00, 0x4b, 0x05, 0xa7, 0x0b, 0x45, 0x4a, 0x5a,
+    0x70, 0xaa, 0x54, 0x55, 0x00, 0x60, 0xba, 0x05, 0x5a, 0x80, 0x65, 0x0b,
+    0x50, 0x5b, 0x70, 0xaa, 0x00, 0xa5, 0x07, 0x4a, 0xa0, 0x0a, 0xa0, 0x30,
+    0x0b, 0xaa, 0x00, 0xab, 0x07, 0x5a, 0x05, 0x41, 0x16, 0xd7, 0x96, 0x96,
+    0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x47, 0x05, 0x04, 0xa0, 0x90,
+    0x25, 0x05, 0x74, 0x00, 0xa0, 0x40, 0x48, 0x07, 0x40, 0xa4, 0x50, 0x0b,
+    0x7a, 0x04, 0x0a, 0x50, 0xa0, 0x24, 0x0a, 0x84, 0xa0, 0x25, 0x08, 0x75,
+    0x4a, 0x04, 0x54, 0xb8, 0x07, 0xaa, 0x48, 0x04, 0xa4, 0x8a, 0x75, 0xa8,
+    0x80, 0x55, 0x47, 0xa5, 0x04, 0xff, 0xd5, 0x7a, 0x04, 0xdf, 0xd5, 0xb7,
+    0x00, 0xba, 0x44, 0x0b, 0x25, 0x0a, 0x80, 0x9a, 0x70, 0x04, 0x05, 0x0a,
+    0x57, 0x4a, 0x00, 0x54, 0xb4, 0x70, 0xab, 0x45, 0x04, 0xb0, 0x00, 0x7a,
+    0xa0, 0xa5, 0x40, 0x47, 0x54, 0xa4, 0x05, 0xa0, 0x94, 0x30, 0x05, 0x07,
+    0xa5, 0xa0, 0x0a, 0x50, 0x80, 0x6a, 0x00, 0xa0, 0x0a, 0xc0, 0x65, 0x05,
+    0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x67, 0x04, 0x40, 0x04, 0x80, 0x90, 0x15, 0xab, 0x06, 0x50, 0x04, 0x05,
+    0x07, 0x54, 0x0a, 0x00, 0xa4, 0x90, 0x34, 0x54, 0xa0, 0x34, 0x4a, 0x08,
+    0x5a, 0x01, 0x54, 0x70, 0xa5, 0x40, 0xa5, 0xa8, 0x06, 0xaa, 0x0a, 0x54,
+    0xb9, 0x40, 0x5a, 0xa8, 0x40, 0x48, 0xa7, 0x44, 0x54, 0xd1, 0xd4, 0x9a,
+    0x0d, 0x71, 0xd4, 0xb4, 0x4a, 0x89, 0x40, 0x50, 0x7a, 0x4a, 0x05, 0xa0,
+    0xaa, 0x43, 0x0a, 0x50, 0x7a, 0x44, 0x0a, 0x5a, 0x47, 0x0a, 0xa0, 0xa5,
+    0x4a, 0x54, 0x48, 0xa5, 0x47, 0x00, 0x5a, 0xa4, 0x45, 0x80, 0x6a, 0x00,
+    0x40, 0xa0, 0x85, 0x64, 0xa0, 0x0a, 0x50, 0x20, 0x04, 0x75, 0x0a, 0x00,
+    0x50, 0x5d, 0x03, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x67, 0x05, 0x50, 0x05, 0x80, 0xa0, 0x05, 0xb0, 0x55,
+    0x00, 0x50, 0xa7, 0x04, 0x04, 0xa0, 0x40, 0x74, 0x40, 0x04, 0xaa, 0x40,
+    0x35, 0x45, 0x48, 0xa7, 0x40, 0x04, 0x54, 0x0a, 0x84, 0x70, 0xb4, 0x05,
+    0x8a, 0x87, 0x4a, 0x04, 0x8a, 0x54, 0x7b, 0x44, 0xa4, 0x04, 0xb7, 0x44,
+    0x85, 0xf1, 0xd5, 0x7a, 0x5b, 0xd1, 0xda, 0xb7, 0x5a, 0x4a, 0xa0, 0x58,
+    0x2b, 0xa4, 0x9a, 0x30, 0xaa, 0x09, 0x41, 0xa5, 0x74, 0xa0, 0x44, 0xb5,
+    0x49, 0x83, 0x44, 0xa0, 0x85, 0x1a, 0x07, 0x4a, 0x04, 0x54, 0x04, 0x7a,
+    0x40, 0x04, 0x4a, 0x09, 0x40, 0xa7, 0x0a, 0x04, 0xa0, 0x40, 0x84, 0x30,
+    0x04, 0xa7, 0x50, 0x50, 0x50, 0x54, 0xa0, 0x54, 0x04, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x04, 0x50,
+    0x04, 0x80, 0x45, 0x00, 0x54, 0x90, 0x64, 0x54, 0x5a, 0xa0, 0x85, 0x64,
+    0x54, 0x40, 0xa0, 0x75, 0x50, 0x55, 0x0a, 0x40, 0x05, 0x74, 0xa4, 0x5a,
+    0x4a, 0x59, 0xa2, 0x54, 0x08, 0x46, 0xa0, 0x0a, 0x8a, 0x07, 0x4a, 0x40,
+    0xaa, 0x04, 0x5a, 0x45, 0xb4, 0x07, 0xaa, 0x08, 0x5a, 0xf1, 0x7d, 0xba,
+    0x0a, 0xd1, 0xd8, 0x87, 0x4b, 0x45, 0xa0, 0xa8, 0x24, 0xa4, 0x9a, 0x64,
+    0x5a, 0x8a, 0x58, 0x7a, 0x8a, 0x84, 0x55, 0xa8, 0x49, 0xa5, 0x04, 0xa5,
+    0x4a, 0x4b, 0x04, 0xa0, 0x74, 0xa4, 0x0a, 0x50, 0x57, 0x45, 0x58, 0x4a,
+    0xa0, 0xa5, 0x64, 0x04, 0xa0, 0x45, 0x00, 0x85, 0x74, 0x50, 0x50, 0x50,
+    0x4a, 0x09, 0x53, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x27, 0x04, 0xc0, 0x90, 0x74, 0x40, 0x55, 0x0a, 0x07,
+    0xa5, 0x50, 0x0a, 0xa5, 0x80, 0x85, 0x60, 0x44, 0x05, 0x40, 0x85, 0x25,
+    0x58, 0x70, 0x44, 0xa5, 0xa4, 0x09, 0xa1, 0x40, 0x78, 0xb4, 0x05, 0xaa,
+    0x57, 0x04, 0xb0, 0xaa, 0x4a, 0x10, 0x59, 0x80, 0x48, 0xa6, 0x0a, 0xa4,
+    0xff, 0xd8, 0xa6, 0x04, 0xf1, 0xd4, 0x87, 0xaa, 0x58, 0x54, 0xa4, 0x38,
+    0xa8, 0x58, 0xa7, 0x04, 0x58, 0x8b, 0x80, 0x9a, 0x60, 0x4a, 0xa4, 0x08,
+    0x8a, 0x94, 0x2a, 0x4a, 0x54, 0x45, 0x04, 0x57, 0x84, 0x5a, 0x50, 0xa5,
+    0x74, 0xa5, 0xa5, 0xa0, 0x47, 0xba, 0x40, 0x05, 0x50, 0x84, 0x60, 0x50,
+    0x45, 0x40, 0x85, 0x90, 0x25, 0x4a, 0x90, 0x34, 0x11, 0x6d, 0x79, 0x60,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x05, 0xa0, 0x15,
+    0x00, 0x40, 0x4a, 0x05, 0xa0, 0x45, 0x50, 0x45, 0x80, 0x75, 0x5a, 0x50,
+    0xa5, 0x47, 0x04, 0x5a, 0xa5, 0xa4, 0x80, 0x8a, 0x95, 0x64, 0xa0, 0x08,
+    0x8b, 0x75, 0x08, 0xb5, 0x45, 0xb7, 0x4b, 0x44, 0x55, 0xb5, 0x84, 0x40,
+    0x85, 0x48, 0x7a, 0x5a, 0x88, 0x55, 0xf7, 0x1d, 0xaa, 0x44, 0xd1, 0x7d,
+    0xa0, 0xb8, 0x85, 0x49, 0xa0, 0x3a, 0xa5, 0x07, 0x4a, 0xa5, 0x88, 0x5a,
+    0x84, 0x88, 0x7b, 0x04, 0x8b, 0x54, 0x87, 0xb4, 0xb4, 0x55, 0xab, 0x04,
+    0x90, 0x7a, 0x40, 0xaa, 0x5a, 0x47, 0x04, 0x4a, 0x44, 0xa5, 0x70, 0x4a,
+    0x5a, 0x40, 0xa8, 0x48, 0x00, 0x45, 0x5a, 0x85, 0x90, 0x65, 0x40, 0x05,
+    0x5a, 0x90, 0x34, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x27, 0x05, 0xc0, 0x40, 0x04, 0x04, 0x75, 0x00, 0x50,
+    0x50, 0x48, 0x08, 0x56, 0x45, 0x44, 0x05, 0xa7, 0x40, 0x55, 0xaa, 0x04,
+    0x54, 0x0b, 0xd0, 0x57, 0x0a, 0xa0, 0xa5, 0x4a, 0x88, 0x74, 0x0a, 0xa4,
+    0xa4, 0xa7, 0x85, 0x0a, 0xa4, 0x5a, 0x6a, 0xa8, 0x85, 0x84, 0x8a, 0x60,
+    0xab, 0xd1, 0xda, 0x74, 0xaa, 0xdf, 0xda, 0x89, 0xa4, 0x40, 0x8a, 0xb0,
+    0x7a, 0x48, 0x40, 0xbb, 0x07, 0x84, 0xba, 0x0a, 0xa4, 0x7a, 0x5b, 0x44,
+    0xba, 0x47, 0xa4, 0xa8, 0x44, 0x8a, 0x14, 0x09, 0xa7, 0x44, 0x5a, 0x4a,
+    0xa0, 0x8a, 0x60, 0x55, 0xa0, 0x45, 0x7a, 0x45, 0x50, 0x0a, 0x58, 0x00,
+    0x30, 0x4b, 0xaa, 0x08, 0xb9, 0x00, 0xa7, 0x50, 0x55, 0x41, 0x16, 0xd7,
+    0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xd0, 0x05,
+    0x0a, 0x80, 0x74, 0xa4, 0x04, 0x50, 0x59, 0x44, 0x05, 0x05, 0x08, 0x46,
+    0x55, 0xa5, 0x00, 0x58, 0xa8, 0x00, 0x45, 0x4a, 0xa0, 0x84, 0x7a, 0xa5,
+    0xa5, 0x05, 0xa9, 0x45, 0xa5, 0x48, 0x80, 0x7a, 0xa4, 0x5a, 0x54, 0x50,
+    0x6a, 0x4b, 0xb0, 0x4a, 0x7b, 0xa4, 0x88, 0xd1, 0xb9, 0x85, 0xad, 0x15,
+    0xa8, 0x9a, 0x48, 0x48, 0xab, 0x3a, 0x04, 0x87, 0x5a, 0xd4, 0x58, 0xa4,
+    0x8a, 0x64, 0x48, 0xa8, 0x05, 0x7b, 0x54, 0x88, 0x0a, 0x59, 0x40, 0x70,
+    0x45, 0xa4, 0xaa, 0x47, 0x0a, 0xb5, 0x05, 0xa0, 0x7a, 0x00, 0x40, 0x54,
+    0xa7, 0x05, 0x45, 0x5a, 0x40, 0x10, 0x48, 0xa8, 0x07, 0x40, 0xaa, 0x05,
+    0x0a, 0x74, 0x5a, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0x05, 0x05, 0x00, 0x50, 0x90, 0x4a,
+    0xd0, 0x45, 0x70, 0x0a, 0x40, 0xa5, 0x07, 0xa4, 0x04, 0x0b, 0x45, 0x7a,
+    0x40, 0x45, 0xb5, 0x40, 0x34, 0xa4, 0x08, 0x57, 0xa0, 0xab, 0x04, 0xa4,
+    0x75, 0x44, 0xba, 0x8a, 0x48, 0x87, 0xb4, 0xb8, 0x5a, 0x5a, 0x38, 0x0a,
+    0x87, 0x54, 0xab, 0x8a, 0x80, 0x74, 0xb8, 0x8b, 0x85, 0xb7, 0xa8, 0x58,
+    0xb4, 0xab, 0x98, 0x0a, 0x5d, 0x54, 0x88, 0x4a, 0xa3, 0x4a, 0xa0, 0x8a,
+    0x78, 0xa4, 0x5b, 0xa4, 0xa7, 0x48, 0x5b, 0x4a, 0x85, 0x1a, 0x08, 0x56,
+    0x0a, 0x54, 0x0b, 0xd9, 0x48, 0x06, 0xa5, 0x0a, 0x05, 0xaa, 0x44, 0xb0,
+    0x55, 0x00, 0x40, 0x44, 0xb4, 0x80, 0x65, 0x04, 0x00, 0x50, 0x75, 0xa0,
+    0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x67, 0x50, 0x54, 0x04, 0x80, 0x70, 0x50, 0x4a, 0x00, 0xa7, 0x00,
+    0x44, 0x0a, 0xa0, 0x7a, 0x50, 0x05, 0xa4, 0x07, 0xb4, 0x54, 0x4a, 0xa4,
+    0x95, 0x18, 0x59, 0x46, 0xba, 0x0a, 0xb0, 0x47, 0x04, 0xa8, 0x85, 0x0a,
+    0x98, 0x2a, 0xa5, 0x9a, 0x78, 0x44, 0xaa, 0x4a, 0xb7, 0x5b, 0xd5, 0x5b,
+    0xdb, 0x7d, 0xd5, 0xba, 0x80, 0x47, 0xb5, 0x4b, 0x5a, 0x58, 0x5b, 0xa8,
+    0xaa, 0x89, 0xa1, 0x84, 0x7b, 0xa0, 0xbb, 0x45, 0x49, 0xa8, 0x87, 0x45,
+    0x58, 0x5a, 0xa4, 0x5b, 0xaa, 0x54, 0x07, 0xaa, 0x0a, 0xa4, 0x5a, 0x80,
+    0x74, 0x55, 0xaa, 0x5b, 0x07, 0x40, 0x5a, 0x04, 0xa5, 0x75, 0x44, 0xa5,
+    0x00, 0x58, 0x4a, 0x07, 0xb0, 0x0a, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x95, 0x20, 0xa5, 0x80, 0x40,
+    0xa0, 0x05, 0xa0, 0x6a, 0x04, 0x5a, 0xa0, 0x8a, 0x60, 0x05, 0xa0, 0x0a,
+    0x94, 0x35, 0x4a, 0x40, 0x2a, 0x45, 0x7a, 0x00, 0x54, 0xb8, 0x08, 0xa8,
+    0x09, 0xa2, 0x08, 0x49, 0x87, 0x4a, 0x48, 0xa5, 0x5d, 0x4a, 0x84, 0x4b,
+    0x98, 0x0b, 0x81, 0xf1, 0x0a, 0x84, 0x8a, 0x64, 0x4b, 0xaa, 0x8a, 0x28,
+    0xa4, 0xaa, 0x00, 0x78, 0xaa, 0xb4, 0x4b, 0xa8, 0x48, 0xa8, 0x87, 0xa4,
+    0xaa, 0x85, 0xa4, 0x88, 0x7a, 0x8b, 0xa4, 0x04, 0xa9, 0x84, 0x54, 0x48,
+    0xb7, 0x40, 0x5a, 0xa5, 0xa5, 0x70, 0x08, 0x50, 0x4a, 0x40, 0x94, 0x35,
+    0x00, 0x5a, 0x02, 0x54, 0x07, 0xa0, 0x0a, 0x41, 0x16, 0xd7, 0x96, 0x96,
+    0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x57, 0x05, 0x00, 0xa9, 0x50,
+    0x10, 0x47, 0x55, 0x00, 0x50, 0x4b, 0xd0, 0x0a, 0x80, 0x94, 0x05, 0x74,
+    0x8a, 0x5a, 0x40, 0x40, 0x0a, 0x85, 0x60, 0x08, 0xba, 0x4a, 0x75, 0x45,
+    0x84, 0xa8, 0xa8, 0x4a, 0xa7, 0x4a, 0x88, 0xa0, 0x8d, 0x28, 0xba, 0x70,
+    0xb9, 0x88, 0xb1, 0xf9, 0x10, 0xf9, 0x14, 0xf1, 0xf8, 0x4b, 0xa3, 0x88,
+    0x9b, 0x24, 0x48, 0x9a, 0x00, 0x88, 0x6b, 0xa4, 0xaa, 0x5a, 0x78, 0x8b,
+    0xab, 0x44, 0x87, 0xaa, 0xb4, 0x88, 0x5a, 0x14, 0x87, 0xd8, 0xaa, 0x0a,
+    0xa8, 0x95, 0x40, 0xad, 0x50, 0x85, 0x64, 0x48, 0xa0, 0x04, 0x95, 0x10,
+    0x40, 0x04, 0x85, 0x90, 0x6a, 0x55, 0x00, 0x4a, 0x94, 0x50, 0x04, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07,
+    0x90, 0x44, 0x40, 0x5a, 0x20, 0x54, 0x90, 0x74, 0xa4, 0x5a, 0x00, 0x59,
+    0x00, 0xba, 0x00, 0xa8, 0x86, 0x4a, 0xa5, 0x44, 0xa0, 0x9a, 0x20, 0x8a,
+    0x7b, 0xb0, 0x8b, 0x45, 0x8a, 0xa5, 0xb0, 0xab, 0x8b, 0x70, 0x8c, 0x8a,
+    0x8a, 0xb0, 0x40, 0xbb, 0x4b, 0x98, 0x05, 0xfd, 0x5d, 0x11, 0x55, 0x8a,
+    0xa3, 0x8b, 0xa8, 0x74, 0x5b, 0xab, 0xa0, 0xa9, 0xb3, 0x0a, 0xb4, 0x98,
+    0x5a, 0xa8, 0xb0, 0xa7, 0xb5, 0xb0, 0x8b, 0x5a, 0x74, 0xba, 0x0b, 0xa0,
+    0xa7, 0x85, 0x80, 0xaa, 0x5a, 0x75, 0x54, 0xa4, 0x08, 0xba, 0x03, 0xa5,
+    0xa5, 0x8a, 0x74, 0x00, 0xa4, 0xa5, 0x08, 0x58, 0xa7, 0x00, 0x40, 0x41,
+    0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07,
+    0x75, 0x05, 0x50, 0x05, 0x00, 0x14, 0x88, 0x06, 0x40, 0xa5, 0x84, 0x57,
+    0x44, 0x04, 0x00, 0xba, 0x90, 0x14, 0x57, 0xb0, 0x4a, 0x54, 0x4a, 0x34,
+    0xad, 0x07, 0x5b, 0xa8, 0x8a, 0xa4, 0x98, 0x6a, 0xa4, 0xb5, 0x5d, 0x8a,
+    0x70, 0x0d, 0xa4, 0xab, 0xa0, 0x48, 0xa5, 0x8b, 0x88, 0x7a, 0x5a, 0xab,
+    0xba, 0x87, 0xa8, 0xb5, 0xf1, 0xd5, 0x98, 0x5a, 0xb4, 0x8b, 0x80, 0x28,
+    0x8b, 0x75, 0xbb, 0x0a, 0xb8, 0xa9, 0x82, 0x4a, 0x89, 0xa3, 0x8b, 0x0a,
+    0x7b, 0xaa, 0x44, 0xd8, 0x00, 0x4a, 0xa5, 0x48, 0x70, 0x5b, 0x45, 0x54,
+    0xa9, 0x87, 0x58, 0x54, 0xa4, 0x4b, 0x74, 0x04, 0x00, 0xaa, 0x00, 0x14,
+    0xa9, 0x06, 0xb0, 0xaa, 0x04, 0xa8, 0x57, 0x44, 0x00, 0x41, 0x16, 0xd7,
+    0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x40, 0x05,
+    0x4a, 0x80, 0x74, 0x00, 0x44, 0x5b, 0x07, 0x4a, 0x04, 0xa0, 0x4a, 0x70,
+    0xaa, 0x05, 0x40, 0x47, 0x50, 0x4a, 0x0a, 0xa5, 0x55, 0x4b, 0x84, 0xa7,
+    0x45, 0xaa, 0x04, 0xb8, 0x74, 0x4a, 0xbb, 0x08, 0xa8, 0xb7, 0x40, 0xab,
+    0x4a, 0xb8, 0x3b, 0x44, 0x9a, 0x87, 0xbb, 0x89, 0xb8, 0x8b, 0x74, 0x8b,
+    0xd1, 0xf4, 0xaa, 0x83, 0x4a, 0x84, 0x9b, 0x28, 0x8b, 0x8a, 0x7b, 0x88,
+    0xbb, 0x08, 0xb7, 0x85, 0x5a, 0xbb, 0x0a, 0x78, 0xba, 0x50, 0xaa, 0x40,
+    0xaa, 0x10, 0x47, 0xa5, 0x54, 0x4a, 0xb4, 0x8a, 0x64, 0x55, 0x0a, 0xa0,
+    0x8a, 0x60, 0xa4, 0x04, 0x40, 0x25, 0x50, 0x8a, 0x64, 0x45, 0xa4, 0x5a,
+    0x80, 0x7a, 0x40, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x90, 0x45, 0x45, 0x0a, 0x7a, 0x04, 0x50,
+    0x5a, 0x07, 0x4b, 0x04, 0x04, 0x54, 0x7a, 0x4a, 0x04, 0xaa, 0x47, 0x05,
+    0xa5, 0x0a, 0xd0, 0x7b, 0xa0, 0xaa, 0x00, 0xa7, 0xb4, 0x48, 0xab, 0xa0,
+    0x7a, 0xba, 0x48, 0xaa, 0x57, 0x8b, 0xa8, 0x8a, 0xb5, 0x0a, 0x78, 0xbb,
+    0x48, 0xa8, 0xb9, 0x82, 0xb8, 0x98, 0x86, 0xab, 0xd1, 0xd4, 0x57, 0xbb,
+    0xa8, 0xbb, 0x80, 0x1b, 0xd7, 0x0b, 0xa4, 0xbb, 0x08, 0x8b, 0x64, 0x88,
+    0xab, 0xa0, 0x9b, 0x70, 0x8b, 0xa4, 0x8b, 0xa8, 0x80, 0x78, 0xba, 0x84,
+    0xba, 0x07, 0x88, 0x4a, 0xa4, 0xab, 0x74, 0xa4, 0x54, 0x4a, 0x47, 0xa0,
+    0x45, 0xa4, 0x04, 0x5a, 0x40, 0xbb, 0x07, 0xb4, 0x0b, 0x40, 0x0a, 0x75,
+    0x04, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x75, 0x00, 0x44, 0x00, 0xa0, 0x1a, 0x07, 0x45, 0x05,
+    0x04, 0x4a, 0x70, 0x04, 0xa4, 0x0a, 0x59, 0x42, 0x54, 0x87, 0x5a, 0x55,
+    0x4a, 0xb4, 0x54, 0xb4, 0xaa, 0x59, 0x86, 0x4a, 0x45, 0xb5, 0x89, 0xa7,
+    0x84, 0xd5, 0x08, 0x8b, 0x98, 0x8a, 0x6a, 0x8d, 0xb5, 0xab, 0x78, 0x98,
+    0x8a, 0xb4, 0xa8, 0xb6, 0x85, 0xf1, 0xd8, 0x97, 0xa8, 0xb8, 0xb8, 0xa8,
+    0x8b, 0x74, 0x8d, 0x4b, 0xaa, 0x87, 0xb9, 0x8b, 0x88, 0xb5, 0xaa, 0x88,
+    0x7d, 0x80, 0x58, 0xb8, 0x40, 0x9a, 0x45, 0xab, 0x84, 0x7a, 0xa4, 0xa4,
+    0x55, 0xb7, 0x44, 0x5a, 0x44, 0xa4, 0x75, 0x4a, 0x45, 0x54, 0xa0, 0x94,
+    0x6a, 0xa0, 0x4b, 0x45, 0x94, 0x85, 0x64, 0x40, 0x41, 0x16, 0xd7, 0x96,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0x44, 0x00,
+    0x4a, 0x40, 0x3a, 0x44, 0xa8, 0x48, 0x09, 0x40, 0x09, 0xa4, 0x04, 0xa4,
+    0x08, 0xa8, 0x07, 0xaa, 0x45, 0x58, 0x84, 0x30, 0xba, 0x89, 0xa0, 0x49,
+    0xa0, 0x08, 0xb7, 0x4b, 0xa4, 0xaa, 0x8d, 0x98, 0x64, 0xbb, 0xa8, 0x0a,
+    0x6a, 0xb8, 0xba, 0xab, 0x78, 0x99, 0x8b, 0xaa, 0x89, 0xb3, 0x4d, 0x1d,
+    0x78, 0xba, 0x48, 0xbb, 0x88, 0xb0, 0x2b, 0x85, 0x78, 0xda, 0xba, 0xab,
+    0x49, 0xb0, 0x48, 0xb6, 0x5b, 0xa4, 0xbb, 0x87, 0xd8, 0x58, 0x4c, 0xba,
+    0x15, 0x48, 0x86, 0xb5, 0xb4, 0xaa, 0x48, 0xa6, 0x4a, 0x88, 0x0a, 0xb7,
+    0xa0, 0xaa, 0x44, 0xa5, 0x80, 0x8a, 0x04, 0x75, 0x58, 0x40, 0x4a, 0x4a,
+    0x50, 0x07, 0x55, 0x40, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x75, 0x54, 0x04, 0x4a, 0x00, 0x54, 0x40,
+    0x50, 0xa9, 0x43, 0xaa, 0x04, 0x75, 0xa0, 0x0b, 0x44, 0x58, 0x49, 0xa5,
+    0x48, 0xa5, 0x48, 0x38, 0x8b, 0x49, 0xa6, 0x04, 0xbb, 0x48, 0xb7, 0x8b,
+    0xb0, 0xbb, 0x8b, 0x7a, 0xa4, 0x8a, 0xba, 0x48, 0x80, 0x6b, 0xba, 0x98,
+    0x8a, 0x78, 0x8b, 0x9a, 0xbb, 0x87, 0xbb, 0x90, 0xd1, 0xda, 0x98, 0x0b,
+    0xaa, 0x0b, 0x7a, 0x89, 0x9b, 0xb5, 0xa7, 0x9b, 0x45, 0xbb, 0x48, 0x7b,
+    0x5b, 0xb0, 0xbb, 0x87, 0xbb, 0x84, 0x8b, 0xab, 0x20, 0x8a, 0x7b, 0xb4,
+    0x85, 0x4a, 0x8c, 0xa0, 0x49, 0xa0, 0x07, 0x4b, 0x04, 0x45, 0x58, 0x85,
+    0x10, 0x57, 0xa4, 0x04, 0x45, 0xa0, 0x95, 0x00, 0x75, 0xa5, 0x04, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07,
+    0x70, 0x54, 0x55, 0x00, 0xa0, 0x15, 0xa9, 0x01, 0xa4, 0x7a, 0x4a, 0xa4,
+    0x5a, 0x07, 0xa0, 0xd5, 0x40, 0x48, 0x9a, 0x55, 0x4b, 0x84, 0x80, 0x84,
+    0x7a, 0x4a, 0xb5, 0xa0, 0xa8, 0xb6, 0x8b, 0x8a, 0xb4, 0xa9, 0x81, 0xab,
+    0x74, 0xba, 0x8b, 0xa9, 0x80, 0x1a, 0x59, 0xb6, 0x4a, 0x8b, 0x8b, 0xa7,
+    0xbb, 0x8a, 0xb4, 0xad, 0x71, 0xda, 0xa8, 0x9b, 0xa9, 0x80, 0xc0, 0x0b,
+    0x98, 0x8b, 0x74, 0xbb, 0x8a, 0x48, 0xb7, 0x98, 0xb5, 0xbb, 0x89, 0x98,
+    0x6a, 0xa4, 0xb8, 0x8b, 0x58, 0xba, 0x84, 0xb8, 0xa6, 0x48, 0x8b, 0x5b,
+    0x48, 0xb6, 0x4a, 0xa0, 0xa4, 0xd8, 0x58, 0x4a, 0xa0, 0x84, 0x7b, 0x80,
+    0x40, 0x45, 0x08, 0xa8, 0x47, 0x00, 0xa5, 0x41, 0x16, 0xd7, 0x96, 0x96,
+    0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x4a, 0x45, 0x54,
+    0x50, 0x85, 0x64, 0x40, 0xa0, 0x50, 0x7a, 0xa0, 0x5a, 0x0a, 0x48, 0xa6,
+    0x54, 0x88, 0x05, 0x49, 0xa9, 0x80, 0x05, 0x84, 0x8a, 0x78, 0x8a, 0xa8,
+    0x8a, 0xba, 0x84, 0xa4, 0xa4, 0xa7, 0x5b, 0x5b, 0xa4, 0x8c, 0x88, 0x1a,
+    0x89, 0xb9, 0x83, 0xba, 0xb8, 0x8b, 0x78, 0xab, 0x4b, 0xd1, 0xf8, 0x88,
+    0xb9, 0x89, 0xb0, 0x7b, 0x89, 0x9b, 0x88, 0xb8, 0x86, 0x98, 0xa8, 0xbb,
+    0x89, 0xa3, 0xba, 0xb8, 0x7a, 0x4b, 0x8d, 0xb0, 0xa0, 0x1b, 0x89, 0xa0,
+    0xb7, 0x8b, 0x84, 0x4b, 0x8a, 0x74, 0xaa, 0x0a, 0xa0, 0xa7, 0x4b, 0xa5,
+    0x4a, 0x80, 0x84, 0x2a, 0x4a, 0x84, 0x7a, 0x54, 0x04, 0xa5, 0x48, 0x56,
+    0x00, 0x84, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x70, 0x0b, 0x04, 0x5a, 0x40, 0x40, 0x05, 0x50, 0x94,
+    0x20, 0xa4, 0x80, 0x68, 0x45, 0x44, 0xb5, 0x9a, 0x94, 0x5b, 0x88, 0xa8,
+    0xa0, 0x28, 0x4a, 0x88, 0x74, 0xa8, 0xba, 0x0a, 0x88, 0xb7, 0x8a, 0xa5,
+    0xb5, 0xd8, 0x9b, 0x5a, 0x08, 0xda, 0x80, 0x8b, 0x98, 0x7b, 0xba, 0x8b,
+    0x88, 0xb9, 0x86, 0x98, 0xbd, 0x1f, 0xa9, 0xb9, 0x82, 0xba, 0xb0, 0x1b,
+    0x88, 0xb6, 0x8a, 0xba, 0x89, 0x87, 0xba, 0x88, 0xb9, 0xba, 0x98, 0x1b,
+    0xa7, 0xd5, 0xb8, 0xbb, 0x04, 0x6b, 0x88, 0xbb, 0x8a, 0x78, 0xaa, 0x84,
+    0xa8, 0x48, 0x86, 0x08, 0xa4, 0xa4, 0xa7, 0xb4, 0x8a, 0xa0, 0x40, 0x5a,
+    0x4a, 0x84, 0x57, 0x00, 0x5a, 0x44, 0x04, 0x7a, 0x50, 0x44, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70,
+    0x54, 0x4a, 0x5a, 0x00, 0x70, 0x45, 0x40, 0x04, 0x57, 0xa4, 0x05, 0x0a,
+    0xa0, 0x78, 0xaa, 0x4b, 0x48, 0xb7, 0x04, 0x45, 0xca, 0x5a, 0x44, 0x4b,
+    0xa0, 0xa8, 0x4a, 0x88, 0xab, 0x78, 0xab, 0x88, 0xb8, 0xb8, 0x87, 0x2b,
+    0x84, 0x8b, 0x8b, 0x6b, 0xd8, 0x89, 0x29, 0x88, 0x6b, 0x9b, 0x98, 0x98,
+    0x7b, 0xb8, 0xf1, 0xda, 0xb7, 0x8b, 0xb8, 0x8b, 0xbc, 0x08, 0x8b, 0x78,
+    0x8c, 0xb5, 0xbb, 0x89, 0x91, 0x89, 0x7b, 0xb8, 0xb8, 0x8a, 0x87, 0xd8,
+    0x8b, 0xb8, 0x8a, 0x4a, 0xab, 0x8b, 0x74, 0x4b, 0xa8, 0x45, 0xa9, 0x85,
+    0xaa, 0x4a, 0xa4, 0x8a, 0x78, 0xab, 0x48, 0xa0, 0x40, 0x24, 0x8b, 0x74,
+    0xa4, 0x05, 0xa5, 0x0c, 0x44, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0xa0, 0x44, 0x00, 0x50,
+    0x30, 0x4a, 0xb7, 0x00, 0x44, 0xa0, 0x0a, 0x94, 0x70, 0xbb, 0x45, 0xb0,
+    0x88, 0xa6, 0x50, 0xab, 0x88, 0x00, 0x5a, 0xac, 0x54, 0x87, 0xab, 0x4b,
+    0x8a, 0x8a, 0x78, 0xbb, 0x88, 0xb8, 0xa7, 0x88, 0xbb, 0x5b, 0xb8, 0x8b,
+    0x68, 0x9a, 0x59, 0x2c, 0x98, 0x0b, 0x7c, 0x98, 0xc8, 0x9b, 0x48, 0x19,
+    0xb7, 0x4b, 0xb9, 0xa8, 0xb2, 0x7b, 0xb5, 0x82, 0xc8, 0xa7, 0x8b, 0xb8,
+    0xb9, 0xb8, 0x79, 0x89, 0xb8, 0x8b, 0x87, 0x99, 0x89, 0xb4, 0xdb, 0x44,
+    0xbb, 0x8b, 0x7a, 0x48, 0xbb, 0x45, 0x48, 0xb8, 0x86, 0xb4, 0xa8, 0x0d,
+    0xa7, 0x4a, 0xa4, 0x8a, 0x58, 0x54, 0x8b, 0x8a, 0x07, 0x5a, 0xb0, 0x44,
+    0xa5, 0x70, 0x54, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0xa0, 0x50, 0x0a, 0x50, 0x40, 0x0a,
+    0xd4, 0x90, 0x6a, 0x44, 0xa5, 0x45, 0x74, 0xbb, 0x45, 0x84, 0x88, 0xa6,
+    0x5b, 0x58, 0xb4, 0x00, 0x7a, 0x8b, 0x4a, 0x5a, 0xb9, 0x80, 0x9a, 0x86,
+    0xba, 0xbd, 0xa8, 0xc8, 0x86, 0xb5, 0xbb, 0x8a, 0x80, 0x39, 0xb8, 0x48,
+    0xb7, 0xd9, 0x85, 0x9c, 0xb8, 0x7c, 0x89, 0x8d, 0x11, 0x59, 0xb0, 0x8a,
+    0xb1, 0x89, 0x4c, 0x48, 0x9b, 0x7d, 0x8b, 0x8b, 0xb8, 0x97, 0x8b, 0x88,
+    0x5b, 0xb8, 0x8b, 0x68, 0x8b, 0x88, 0xb5, 0x8b, 0x68, 0xa8, 0x8b, 0x80,
+    0x78, 0xbd, 0x80, 0x49, 0xb8, 0x86, 0xa4, 0x84, 0x0d, 0xa7, 0x4a, 0x88,
+    0x0a, 0xa4, 0x4a, 0x4a, 0xb0, 0x95, 0x3d, 0x4a, 0x08, 0xa7, 0x4a, 0x45,
+    0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x27, 0x4a, 0x90, 0x25, 0xd0, 0x50, 0x05, 0xd5, 0x08, 0x46, 0xaa, 0x5a,
+    0x4a, 0x48, 0xa6, 0x54, 0x84, 0xba, 0x87, 0x48, 0xb4, 0xda, 0x0a, 0x55,
+    0x4a, 0x4b, 0xa9, 0x80, 0x59, 0x81, 0xb8, 0x8b, 0x68, 0xbb, 0x88, 0xb8,
+    0x7b, 0xb8, 0xbb, 0xa8, 0xa0, 0x1b, 0xd9, 0x83, 0x2d, 0xa5, 0x81, 0xf1,
+    0x5f, 0x8b, 0x92, 0x9a, 0xb1, 0x8d, 0x69, 0x8b, 0x89, 0x28, 0xbb, 0x18,
+    0xb7, 0x98, 0xba, 0xcb, 0x8b, 0x7a, 0x89, 0x98, 0xbb, 0x88, 0xb0, 0x2a,
+    0x54, 0x7b, 0xb4, 0x48, 0xbd, 0x0b, 0x80, 0xa9, 0x83, 0x4b, 0xa4, 0x7a,
+    0xa8, 0xa4, 0x85, 0xa0, 0x4a, 0x4d, 0x80, 0x7a, 0x05, 0xa0, 0x5a, 0x59,
+    0x45, 0x00, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x70, 0x45, 0x00, 0x4a, 0x40, 0x48, 0x0a, 0xb0, 0x85,
+    0x6a, 0x55, 0x4a, 0x8a, 0x75, 0xa5, 0x04, 0xb8, 0x47, 0xba, 0x5b, 0x44,
+    0xd8, 0x84, 0x7a, 0x88, 0x4a, 0xba, 0x5b, 0x80, 0xa9, 0xb0, 0xa9, 0x80,
+    0xb7, 0x88, 0x98, 0xba, 0xbd, 0x88, 0x0b, 0x7c, 0x8b, 0xab, 0xd8, 0xd8,
+    0x1f, 0x12, 0x5b, 0xc8, 0x96, 0x29, 0xac, 0x8a, 0xd0, 0x09, 0x78, 0xbb,
+    0x99, 0x8b, 0xd7, 0x88, 0xb9, 0x98, 0x89, 0x9b, 0x98, 0x0b, 0x7c, 0x89,
+    0xb8, 0xb8, 0xb0, 0x2b, 0x40, 0x7b, 0xb8, 0xa8, 0xbb, 0x09, 0xa9, 0x86,
+    0xa8, 0xa4, 0xb5, 0x47, 0x5a, 0x85, 0xb4, 0x5a, 0x30, 0xad, 0x47, 0x04,
+    0x84, 0x80, 0xab, 0x80, 0x78, 0x40, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96,
+    0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x55, 0x40, 0x44,
+    0x00, 0x55, 0x4a, 0x50, 0x4a, 0xa2, 0x48, 0x48, 0xa9, 0x48, 0x88, 0x47,
+    0xaa, 0x5b, 0x40, 0xca, 0x84, 0x0b, 0x78, 0xa8, 0xcb, 0x48, 0x58, 0x88,
+    0x96, 0xb9, 0x8b, 0xb9, 0xa8, 0xb8, 0x87, 0xb8, 0xb4, 0xbb, 0x8b, 0x8b,
+    0x68, 0xb9, 0xbb, 0x89, 0xff, 0x4d, 0xb9, 0xbc, 0x89, 0x6b, 0xba, 0xc8,
+    0xad, 0x09, 0x78, 0x8c, 0x99, 0x8d, 0xc9, 0x81, 0x98, 0x89, 0x6b, 0x98,
+    0xbb, 0x98, 0x8b, 0x69, 0x9b, 0x8b, 0x4d, 0x5a, 0x8a, 0xbb, 0x57, 0x89,
+    0xc8, 0x0a, 0x8a, 0xb8, 0x0b, 0xa8, 0x7a, 0xa4, 0x4a, 0x58, 0xb0, 0x30,
+    0x4d, 0x58, 0x47, 0xb5, 0x84, 0xba, 0x05, 0x90, 0x44, 0x41, 0x16, 0xd7,
+    0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0xa5,
+    0x05, 0xa0, 0x50, 0x5a, 0x4a, 0x05, 0x07, 0xa4, 0x4a, 0x84, 0x0a, 0x88,
+    0x7a, 0x0a, 0xb4, 0xa4, 0xb7, 0x8b, 0x85, 0xb4, 0xa8, 0x5b, 0x85, 0x8d,
+    0xb7, 0x4a, 0x08, 0x9b, 0x9b, 0x78, 0x9c, 0x8b, 0xab, 0x87, 0xb8, 0xb9,
+    0x98, 0xba, 0x8b, 0x4c, 0x8b, 0xb8, 0x7b, 0x8b, 0x9b, 0x89, 0xb7, 0x98,
+    0x8c, 0x8b, 0x98, 0x8c, 0x8b, 0x6a, 0xc9, 0xbb, 0x82, 0x29, 0xb9, 0x72,
+    0xb8, 0x9d, 0xb8, 0xb8, 0x87, 0xbc, 0x9b, 0x8b, 0xc8, 0x9b, 0x78, 0xb9,
+    0xbb, 0x95, 0xb0, 0xab, 0x08, 0xab, 0x48, 0xaa, 0xba, 0x98, 0x64, 0x8a,
+    0x8a, 0xa4, 0x7b, 0xb5, 0x54, 0x8a, 0x80, 0x54, 0x4a, 0x4a, 0x47, 0x88,
+    0x04, 0xb5, 0x4a, 0x70, 0x05, 0xa4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0x45, 0x0a, 0xa0, 0xa0,
+    0x4a, 0x00, 0x4a, 0x84, 0x80, 0x8a, 0x84, 0x68, 0x05, 0x50, 0x4b, 0x7a,
+    0x8a, 0x84, 0xa5, 0xba, 0x80, 0x8b, 0x88, 0x7b, 0xb8, 0xa8, 0x8b, 0xc7,
+    0x8b, 0x8b, 0xc8, 0x9b, 0x88, 0x89, 0x78, 0xbc, 0x8a, 0xda, 0xb0, 0x5c,
+    0x8c, 0xbb, 0x87, 0xbc, 0x99, 0x85, 0xbd, 0x9b, 0x15, 0xdb, 0xb0, 0x9a,
+    0xb2, 0x8b, 0x90, 0x99, 0x1b, 0xc7, 0x99, 0xcb, 0xb9, 0xb8, 0x7b, 0xc8,
+    0xb8, 0xbc, 0x89, 0xb7, 0x89, 0x98, 0xbc, 0x8b, 0x1b, 0x57, 0xbb, 0x8b,
+    0xa8, 0x89, 0x7b, 0xaa, 0x45, 0xb8, 0x47, 0x88, 0x4a, 0x54, 0x8b, 0x88,
+    0x8a, 0x88, 0x55, 0xa4, 0x88, 0x57, 0xa5, 0x45, 0xa5, 0x84, 0x75, 0x05,
+    0xa4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x75, 0x45, 0x05, 0xa0, 0x50, 0x30, 0x84, 0xa7, 0x50, 0xaa,
+    0x0a, 0xa4, 0x8a, 0x70, 0x85, 0xba, 0x8a, 0x87, 0xda, 0x05, 0x8a, 0x4b,
+    0x88, 0x2b, 0xb8, 0x8b, 0x7a, 0xba, 0xba, 0xbc, 0x87, 0xbb, 0x89, 0x98,
+    0xba, 0x88, 0x89, 0x6b, 0xd8, 0xbb, 0x4b, 0x2c, 0x9b, 0x79, 0x28, 0xcb,
+    0x82, 0xda, 0x1f, 0x14, 0xdd, 0x8b, 0x99, 0xb0, 0x52, 0x8b, 0x22, 0x97,
+    0x29, 0xb2, 0xbd, 0x8b, 0x7d, 0x8c, 0xb8, 0xbb, 0x88, 0xb7, 0x89, 0x98,
+    0xbd, 0x8b, 0x7b, 0x4b, 0xba, 0xa8, 0xb7, 0x8b, 0xa4, 0xb8, 0x49, 0x78,
+    0x8b, 0xa4, 0x88, 0xb7, 0xa8, 0x8a, 0xb4, 0x45, 0x4a, 0x55, 0x85, 0x9a,
+    0x55, 0xa5, 0x5a, 0x07, 0xb0, 0xaa, 0x81, 0x16, 0xd7, 0x96, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x4a, 0x50, 0x05, 0x84, 0x70,
+    0xb8, 0x40, 0x05, 0xb7, 0x48, 0xaa, 0x55, 0x0d, 0x70, 0xad, 0x44, 0x8b,
+    0xa7, 0x84, 0xb8, 0x45, 0xab, 0x1a, 0xb7, 0x8b, 0x8a, 0xa8, 0xc4, 0x8b,
+    0x88, 0x7b, 0xa5, 0xbb, 0xab, 0x97, 0xbb, 0x8b, 0xc9, 0xcb, 0x88, 0x12,
+    0xb7, 0x99, 0xc9, 0x29, 0x8d, 0xb1, 0xf1, 0x7d, 0xcb, 0x88, 0xcb, 0x80,
+    0x59, 0x2b, 0xb2, 0x98, 0xb7, 0x99, 0xbd, 0x5b, 0xcb, 0x79, 0xb8, 0x5c,
+    0xc9, 0xb7, 0x8b, 0x98, 0xbc, 0x9c, 0x29, 0x48, 0x8b, 0x88, 0x7d, 0x89,
+    0x98, 0xbb, 0x87, 0x9b, 0x88, 0x45, 0xc4, 0x8b, 0x64, 0x08, 0xba, 0x05,
+    0x1a, 0x88, 0x49, 0xa0, 0x89, 0x52, 0xa5, 0x47, 0xb0, 0xaa, 0x41, 0x16,
+    0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74,
+    0x04, 0xa0, 0x5a, 0x00, 0x54, 0xa4, 0x04, 0xa7, 0x48, 0xa4, 0x8b, 0x45,
+    0x7a, 0xa0, 0xbb, 0x54, 0xaa, 0x80, 0xa9, 0x81, 0xba, 0x2a, 0xad, 0x7a,
+    0x4a, 0x8b, 0xc8, 0xb9, 0x81, 0x9b, 0x78, 0x8d, 0x9b, 0x98, 0xc7, 0x8c,
+    0xc9, 0x8b, 0xb8, 0x8b, 0x69, 0x9c, 0x99, 0xbc, 0x91, 0xcd, 0x3f, 0x11,
+    0xf7, 0xdd, 0xcb, 0x2b, 0xac, 0x8b, 0x59, 0xcb, 0xb2, 0xc7, 0x88, 0x99,
+    0xcb, 0x8b, 0x79, 0xb9, 0xbb, 0x89, 0xd7, 0x9b, 0xb8, 0xb8, 0xcb, 0x88,
+    0x7b, 0xb8, 0xb9, 0x88, 0xb8, 0x88, 0xb6, 0xab, 0x98, 0xbb, 0x49, 0xa0,
+    0x58, 0xb6, 0x44, 0xa8, 0xa5, 0x40, 0x5a, 0x85, 0x4b, 0x57, 0xa8, 0xb4,
+    0x04, 0x0a, 0x78, 0x0a, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x47, 0x50, 0x4a, 0x94, 0x05, 0x7a, 0x05,
+    0x5a, 0xa4, 0xa7, 0x40, 0xab, 0x4b, 0xb8, 0x70, 0xb4, 0xba, 0xb4, 0xa7,
+    0xb8, 0x4a, 0xd4, 0x8b, 0x6b, 0xab, 0xb0, 0x48, 0x7d, 0xba, 0xbb, 0xad,
+    0x88, 0xb6, 0x89, 0x9c, 0x99, 0xc7, 0x99, 0xcb, 0x8b, 0xc9, 0x3b, 0x9b,
+    0xc9, 0xb6, 0xcb, 0x11, 0xd8, 0x27, 0xc8, 0xdb, 0xb1, 0x1d, 0x8b, 0x7c,
+    0x89, 0xcb, 0x9c, 0xd0, 0x59, 0x2c, 0xbb, 0xc7, 0xb8, 0x89, 0xdc, 0x8c,
+    0x8b, 0x7e, 0x8b, 0xb9, 0x9b, 0xc7, 0x89, 0xb8, 0x9c, 0xb8, 0x49, 0xc8,
+    0x98, 0x8b, 0x88, 0x8b, 0xb8, 0x7b, 0xb4, 0xcb, 0xa4, 0xb7, 0x5a, 0xba,
+    0x0a, 0xb4, 0x54, 0xab, 0x0b, 0xa7, 0x5a, 0xb8, 0x00, 0x4b, 0x78, 0x4a,
+    0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x67, 0xaa, 0x45, 0x05, 0x84, 0x65, 0x05, 0xa8, 0x0b, 0x75, 0x04,
+    0xba, 0x0b, 0xa8, 0x86, 0xa8, 0xb8, 0xa4, 0xa7, 0xb8, 0x8a, 0xb5, 0xab,
+    0x48, 0x8b, 0x94, 0x88, 0x7b, 0x98, 0x9b, 0x8c, 0x88, 0xb9, 0x93, 0xba,
+    0xd8, 0x79, 0xb8, 0xcc, 0x8b, 0x80, 0x79, 0x9b, 0x9b, 0x22, 0xb7, 0xd1,
+    0x15, 0x8d, 0xc8, 0x7d, 0xb9, 0x11, 0xdc, 0xb7, 0xc9, 0xb2, 0x9b, 0x2d,
+    0x29, 0x92, 0x89, 0x7c, 0xc8, 0x9b, 0x29, 0x87, 0x22, 0xbc, 0x89, 0xc9,
+    0x9b, 0x79, 0xd8, 0x89, 0x8c, 0xb0, 0x49, 0xb8, 0x98, 0x7b, 0xb8, 0xbb,
+    0x8a, 0xc9, 0x86, 0xd9, 0x4b, 0xa5, 0x48, 0xa6, 0xb8, 0xa4, 0xaa, 0x50,
+    0x3a, 0xab, 0x0a, 0x85, 0xa4, 0x04, 0x4a, 0x75, 0x45, 0x54, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x57, 0xaa,
+    0x4a, 0x09, 0x50, 0x54, 0x04, 0x4a, 0x48, 0xa7, 0x48, 0xaa, 0x8a, 0x45,
+    0x88, 0x9a, 0x24, 0xba, 0x75, 0x4b, 0xb8, 0xa8, 0xb0, 0x69, 0x8b, 0xa8,
+    0xc9, 0xa8, 0x0b, 0x79, 0xb9, 0x8b, 0xcc, 0xb7, 0x9b, 0xd8, 0xbc, 0x8c,
+    0x9b, 0x08, 0x2b, 0x9c, 0x99, 0x7b, 0x2b, 0x11, 0x9b, 0x97, 0xc2, 0xbb,
+    0x91, 0x1d, 0x7b, 0xb9, 0xc2, 0x9a, 0xe8, 0xb0, 0x0b, 0x78, 0xcb, 0x9c,
+    0xbb, 0xc9, 0x91, 0xb9, 0x92, 0x49, 0xab, 0xbc, 0x88, 0x79, 0xd4, 0xbc,
+    0x8c, 0xb0, 0x2b, 0xb8, 0x9b, 0x89, 0x7b, 0x9b, 0x8d, 0xb8, 0x99, 0xb0,
+    0x8a, 0xa7, 0xba, 0xa8, 0xb8, 0x0a, 0x1b, 0x87, 0xaa, 0x0b, 0xa8, 0xa4,
+    0x8a, 0xa4, 0x50, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0x5a, 0x45, 0x08, 0x00, 0x10, 0xa7,
+    0x5a, 0x5a, 0x84, 0x4b, 0x9a, 0x18, 0xa7, 0x8a, 0x5b, 0xba, 0x4a, 0xa8,
+    0x2b, 0xab, 0x88, 0x3b, 0x9b, 0x87, 0xbc, 0x8b, 0x5b, 0xb8, 0x9b, 0x88,
+    0x7b, 0xb9, 0xbc, 0x9b, 0xc9, 0x93, 0xcb, 0x29, 0x52, 0xc9, 0xbc, 0x98,
+    0x26, 0xb1, 0x19, 0xd9, 0xc7, 0x29, 0xbb, 0x11, 0xdc, 0x8b, 0x6c, 0xb9,
+    0xb2, 0xc8, 0x3c, 0x99, 0xc7, 0x22, 0xbc, 0xc9, 0xc8, 0x7c, 0x29, 0x22,
+    0xb8, 0x97, 0xbb, 0xab, 0xcb, 0xac, 0xab, 0x1b, 0x97, 0x8b, 0xb8, 0x8b,
+    0x8b, 0x99, 0x38, 0x8d, 0x87, 0xb9, 0x8a, 0xab, 0xab, 0x9a, 0x38, 0x5a,
+    0x80, 0x6a, 0xb4, 0xb8, 0xab, 0x88, 0x64, 0xba, 0x45, 0x0b, 0x94, 0x21,
+    0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07,
+    0x70, 0xaa, 0x5a, 0x0a, 0x40, 0x04, 0x7b, 0x05, 0xba, 0x40, 0x47, 0xb4,
+    0x5a, 0x8a, 0x48, 0xca, 0x44, 0xbb, 0x4b, 0x8a, 0x89, 0x0b, 0x98, 0x7b,
+    0xb8, 0xb8, 0xbb, 0x8b, 0xba, 0x92, 0xbb, 0xca, 0x93, 0xcb, 0xc9, 0x78,
+    0x29, 0x2c, 0x8b, 0xc7, 0xd1, 0x19, 0xcb, 0x2c, 0x72, 0x28, 0x11, 0xdc,
+    0xb7, 0x2b, 0x9c, 0x28, 0xc9, 0x4c, 0x2c, 0x2b, 0x89, 0x8c, 0x68, 0xcb,
+    0xcb, 0x92, 0xab, 0x22, 0x82, 0xcb, 0x29, 0xbc, 0x6b, 0xca, 0x8b, 0x8b,
+    0x7c, 0x4b, 0xcb, 0x88, 0xa7, 0xbb, 0x8b, 0xb8, 0x4a, 0x88, 0x6b, 0x8a,
+    0x8a, 0xc8, 0x44, 0xb5, 0xb8, 0x8a, 0x60, 0x04, 0xb8, 0x04, 0x7a, 0xa5,
+    0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x7a, 0x54, 0xb4, 0x00, 0x50, 0x55, 0xa0, 0x0b, 0xa8, 0x88,
+    0x46, 0xa4, 0xab, 0x58, 0x49, 0xa3, 0x54, 0xba, 0x7b, 0x84, 0xbd, 0x84,
+    0xb0, 0x69, 0x8b, 0x8b, 0xb8, 0x8b, 0x68, 0xb8, 0x8b, 0xdb, 0x88, 0x9b,
+    0x28, 0xd9, 0x78, 0x29, 0x2b, 0xbc, 0x90, 0x4b, 0x92, 0x2c, 0x89, 0x7c,
+    0xb1, 0x19, 0xb2, 0x97, 0xc3, 0x29, 0xf1, 0xd2, 0x89, 0x6c, 0x9c, 0xb9,
+    0xcd, 0x1b, 0x87, 0xcc, 0xb2, 0x9b, 0xc8, 0x7b, 0xc9, 0xcb, 0x9b, 0xd7,
+    0xb8, 0x9b, 0xcb, 0x8c, 0x99, 0x22, 0xc9, 0x2b, 0xc8, 0x7b, 0x8b, 0xb9,
+    0x89, 0xc9, 0x93, 0x8b, 0xb8, 0x8b, 0x98, 0x0b, 0x78, 0x85, 0x8b, 0xaa,
+    0x50, 0x04, 0x8b, 0x80, 0x7a, 0xa5, 0xa4, 0x8a, 0x08, 0xa6, 0x4a, 0x44,
+    0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x07, 0x7a, 0x00, 0xa4, 0xa0, 0xb0, 0x8a, 0xa4, 0x3a, 0xb5, 0x48, 0xa9,
+    0x84, 0xb5, 0x5a, 0xb8, 0x87, 0xb8, 0xb8, 0xab, 0xb8, 0x8b, 0x48, 0xbc,
+    0xa8, 0x9b, 0x78, 0x9b, 0xb8, 0xbc, 0xb7, 0x98, 0x9c, 0xc9, 0xc8, 0x79,
+    0x92, 0xc8, 0x9c, 0x90, 0x42, 0x8c, 0xcb, 0x82, 0x69, 0xd1, 0x19, 0x9c,
+    0x89, 0x92, 0x31, 0x1d, 0xc8, 0x96, 0xc9, 0x29, 0x92, 0xc0, 0x39, 0x29,
+    0x88, 0xc8, 0x97, 0xc2, 0x29, 0x22, 0xb8, 0x8c, 0x72, 0x98, 0xbc, 0xcb,
+    0xc9, 0x92, 0xcc, 0x80, 0x5b, 0xca, 0x9a, 0xc7, 0xb9, 0xbb, 0x88, 0xbc,
+    0x78, 0x9b, 0x89, 0x98, 0xb8, 0x87, 0xbb, 0x88, 0xba, 0xa5, 0x58, 0xaa,
+    0x4a, 0x57, 0x4b, 0xb5, 0x4a, 0x5a, 0x70, 0xaa, 0x44, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0x0a,
+    0xa5, 0x4a, 0x80, 0x55, 0x85, 0x85, 0x0b, 0x84, 0x45, 0xa5, 0x97, 0x84,
+    0xab, 0xac, 0xa5, 0x7c, 0x98, 0x84, 0x9c, 0xa0, 0x38, 0xc9, 0x89, 0xb8,
+    0x9c, 0xb5, 0x9b, 0xb9, 0xcb, 0x99, 0x72, 0x99, 0xb8, 0x2c, 0xa0, 0x39,
+    0x29, 0x27, 0x9b, 0xcb, 0xd1, 0x12, 0x99, 0x02, 0x7b, 0x9c, 0x11, 0xdc,
+    0x97, 0xcb, 0xbe, 0xc9, 0x29, 0x72, 0xda, 0x9e, 0x22, 0xc7, 0xbc, 0x99,
+    0x2b, 0x2b, 0x79, 0x29, 0x2b, 0xbc, 0x97, 0x2b, 0x99, 0x22, 0xb8, 0x1c,
+    0x28, 0x99, 0xb0, 0x88, 0xb8, 0x89, 0xb0, 0x87, 0x98, 0xb8, 0x8b, 0xb8,
+    0x7b, 0xb8, 0xb8, 0xbd, 0x80, 0x05, 0x74, 0x48, 0xb0, 0xab, 0x58, 0xaa,
+    0x86, 0xa4, 0xa4, 0x11, 0x6d, 0x72, 0x61, 0xd0, 0x95, 0x1b, 0xf8, 0x6e,
+    0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x5b, 0x50, 0x5b, 0x40,
+    0x14, 0xa7, 0x84, 0xaa, 0x44, 0xb8, 0x74, 0xa8, 0x5a, 0xba, 0x57, 0xbb,
+    0x8b, 0x85, 0xcb, 0x98, 0x2c, 0xb8, 0x5b, 0x98, 0xdd, 0x88, 0xb7, 0xc8,
+    0x9c, 0xbb, 0x89, 0x8c, 0x79, 0xb8, 0x2c, 0x8b, 0xc9, 0x92, 0x3b, 0x80,
+    0x19, 0xc8, 0x99, 0x24, 0xcd, 0x11, 0xd8, 0x98, 0x27, 0x99, 0xc1, 0x1d,
+    0x29, 0x7c, 0x9b, 0xdc, 0x92, 0x90, 0x5c, 0xc9, 0x2b, 0x97, 0xdc, 0x8b,
+    0xbc, 0x9b, 0x82, 0x7b, 0xb9, 0xcc, 0x99, 0x87, 0xcc, 0x9b, 0xc9, 0x9b,
+    0x1c, 0x97, 0x8b, 0xc8, 0x8b, 0xb9, 0x9b, 0x18, 0xd8, 0x86, 0x98, 0x89,
+    0xc8, 0xa7, 0xca, 0x4b, 0x4a, 0xdb, 0x98, 0x2b, 0x84, 0x7a, 0x80, 0xdb,
+    0x04, 0xb7, 0xa0, 0x8a, 0x41, 0x16, 0xc7, 0x36, 0xb5, 0x40, 0x74, 0x55,
+    0x44, 0x5f, 0x6d, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x47, 0x4a, 0x45,
+    0x94, 0x0a, 0x54, 0xaa, 0x0a, 0xd8, 0x47, 0xb8, 0xab, 0x54, 0xba, 0x74,
+    0x8d, 0x58, 0xaa, 0x47, 0x8b, 0xab, 0x9b, 0x8b, 0x1b, 0xa7, 0xbd, 0xa8,
+    0x8b, 0xc8, 0x9b, 0x4c, 0x89, 0xcd, 0x98, 0x1c, 0xd8, 0x96, 0xc9, 0x2c,
+    0x2b, 0x90, 0x32, 0x9c, 0x97, 0xc2, 0x92, 0xd1, 0x1c, 0x82, 0x7d, 0x99,
+    0x32, 0x11, 0xf8, 0x97, 0x22, 0x92, 0xcc, 0xe2, 0x2c, 0xb2, 0x8b, 0x7c,
+    0xd9, 0x89, 0xcc, 0x87, 0x2b, 0x22, 0xb2, 0xce, 0x98, 0x7c, 0xc9, 0xbc,
+    0x92, 0xc0, 0x09, 0xbb, 0x09, 0x7c, 0x98, 0xbd, 0xa8, 0xc8, 0x96, 0xb8,
+    0x8c, 0x98, 0xb7, 0xd4, 0x8a, 0xa4, 0xab, 0x4a, 0xb8, 0xb0, 0x8a, 0x65,
+    0xbd, 0x54, 0x5a, 0x78, 0x4a, 0x54, 0x11, 0x6b, 0x74, 0x65, 0x45, 0xf0,
+    0x91, 0x5f, 0xb4, 0x5d, 0x7c, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07,
+    0x8a, 0x94, 0x0a, 0x84, 0x5b, 0xaa, 0x44, 0xa8, 0x49, 0x82, 0xa8, 0xb7,
+    0x98, 0x84, 0xdb, 0x8b, 0x8a, 0x78, 0xb8, 0xda, 0xb5, 0xc0, 0x49, 0x8b,
+    0xb9, 0x8b, 0x68, 0xb8, 0x2b, 0xc9, 0x9b, 0x4c, 0x29, 0xb2, 0x7d, 0x92,
+    0x29, 0xc2, 0x98, 0xb0, 0x6c, 0xbb, 0xcc, 0x29, 0x8c, 0x61, 0x1b, 0xc2,
+    0xc2, 0x7c, 0x29, 0x11, 0xd2, 0xb7, 0xcb, 0xb2, 0x2c, 0xdb, 0x12, 0x97,
+    0xc2, 0x2c, 0x22, 0xc2, 0x7b, 0x29, 0x29, 0xc9, 0xc8, 0xb7, 0xeb, 0x99,
+    0x2c, 0x92, 0x89, 0x82, 0x59, 0x9b, 0xc8, 0x97, 0xc2, 0xb9, 0x92, 0x8b,
+    0x89, 0x7b, 0xc8, 0xb8, 0x8b, 0x87, 0xda, 0x4b, 0x88, 0xba, 0x0b, 0x7d,
+    0x88, 0x4b, 0x58, 0xba, 0xa0, 0x57, 0x85, 0xaa, 0x41, 0x16, 0xb7, 0x4d,
+    0x5d, 0x76, 0x96, 0x91, 0x15, 0x48, 0x6b, 0x10, 0xb0, 0x07, 0xa2, 0xf2,
+    0xf2, 0x67, 0x5a, 0x40, 0x85, 0x84, 0x1a, 0x89, 0xa2, 0x0a, 0xb7, 0x08,
+    0x84, 0xbd, 0x48, 0x7a, 0x8b, 0xba, 0xb5, 0xb7, 0xc8, 0x8c, 0xb8, 0x8c,
+    0x69, 0x98, 0xbc, 0xc8, 0x9b, 0x79, 0xbc, 0x8c, 0xc9, 0x27, 0xbc, 0xbc,
+    0xcb, 0x29, 0x82, 0x99, 0x02, 0x3b, 0x22, 0xc7, 0x23, 0xc3, 0x91, 0x1f,
+    0x99, 0x0c, 0x7d, 0x9f, 0x11, 0xcc, 0xb7, 0xc8, 0xce, 0x29, 0xe2, 0x28,
+    0x2c, 0xa2, 0x2e, 0xc9, 0x92, 0x29, 0x2c, 0x79, 0xcc, 0xbc, 0x9c, 0x97,
+    0xc2, 0x99, 0xb2, 0xb2, 0x29, 0x9b, 0x89, 0x8c, 0x7b, 0xcb, 0xb8, 0xbb,
+    0x88, 0x96, 0xac, 0xc8, 0x8b, 0x87, 0xbb, 0x8b, 0x4b, 0xb8, 0x58, 0xba,
+    0x08, 0xb7, 0x58, 0x58, 0xb8, 0x48, 0x7a, 0xa0, 0xa4, 0x11, 0x6a, 0x73,
+    0x65, 0xd7, 0x86, 0x96, 0xa1, 0x24, 0xb7, 0xb1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x7a, 0xa4, 0x08, 0x04, 0xb0, 0x84, 0x98, 0x24, 0x8a, 0x94,
+    0x08, 0x9b, 0x75, 0xab, 0x88, 0xcb, 0x88, 0xb6, 0x89, 0xbb, 0x4b, 0x90,
+    0x6b, 0xc8, 0xbd, 0x98, 0x7b, 0xcb, 0x92, 0xb4, 0xb8, 0xc6, 0x99, 0xc9,
+    0xc9, 0xc9, 0x94, 0xcc, 0xb9, 0x20, 0x19, 0xb7, 0xc9, 0xb3, 0x22, 0x9f,
+    0xa1, 0x0f, 0xc1, 0x49, 0xbe, 0xc9, 0x8c, 0x82, 0x8c, 0x18, 0xc7, 0x29,
+    0xc9, 0x2c, 0x98, 0x7c, 0xc2, 0x9c, 0x98, 0x28, 0xc8, 0x97, 0xc9, 0xc9,
+    0xcb, 0xb9, 0x8c, 0x5b, 0x99, 0x89, 0xc7, 0x8b, 0x29, 0x29, 0xc2, 0xa8,
+    0x5b, 0xcb, 0x89, 0xb7, 0xa8, 0xcb, 0x88, 0xb8, 0x98, 0x24, 0x8a, 0x78,
+    0xa4, 0xab, 0x40, 0xb7, 0xaa, 0x4b, 0x41, 0x16, 0xa7, 0x3f, 0x46, 0x78,
+    0x60, 0x96, 0xa1, 0x2b, 0x47, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67,
+    0x4a, 0x48, 0xa0, 0x8a, 0x88, 0x74, 0x8a, 0x88, 0xa5, 0xa9, 0x80, 0xb7,
+    0xc0, 0x4b, 0x84, 0xcb, 0x78, 0x99, 0xb8, 0xb8, 0xb8, 0x80, 0x5c, 0xb8,
+    0xb2, 0x9c, 0xb2, 0x28, 0x97, 0xcc, 0x99, 0xc9, 0xc2, 0x89, 0x6c, 0x92,
+    0xc9, 0x23, 0x18, 0xc7, 0x3b, 0xb9, 0x33, 0x92, 0xf1, 0x41, 0xd2, 0x9d,
+    0x7c, 0x22, 0xcc, 0x2c, 0x20, 0x42, 0x92, 0xec, 0x79, 0x2c, 0x9c, 0x39,
+    0xc8, 0x26, 0xc9, 0x9c, 0xcb, 0x27, 0xcb, 0xcc, 0x99, 0xc9, 0x82, 0x38,
+    0x22, 0x88, 0xc7, 0xb9, 0x9c, 0x29, 0x92, 0x78, 0xb9, 0xb8, 0x2c, 0x47,
+    0xab, 0x84, 0xcb, 0x98, 0x8b, 0x1a, 0xba, 0x85, 0xba, 0x48, 0xa4, 0x8a,
+    0x78, 0xb8, 0xa4, 0x11, 0x6a, 0x72, 0xd4, 0x79, 0x60, 0x96, 0xa1, 0x1d,
+    0x48, 0x6a, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0xa0, 0xaa,
+    0x04, 0xa0, 0x2b, 0xa4, 0x98, 0x0b, 0xd8, 0x7b, 0x08, 0xb2, 0x88, 0xa7,
+    0xc2, 0x98, 0xbb, 0x4b, 0x88, 0x4c, 0xb9, 0x8b, 0x79, 0x92, 0xab, 0x2b,
+    0xc7, 0x99, 0x2b, 0x92, 0xb2, 0x8c, 0x68, 0x92, 0xe2, 0xc9, 0x8c, 0x28,
+    0xb3, 0x7c, 0xc9, 0xc2, 0x2e, 0xcd, 0xf0, 0xd7, 0xbc, 0xc9, 0x22, 0xec,
+    0x92, 0x1c, 0x90, 0x4c, 0x92, 0xec, 0x72, 0x92, 0x2c, 0xe9, 0xc8, 0x27,
+    0xc9, 0x22, 0x92, 0x92, 0x9c, 0x58, 0x9c, 0xc9, 0x20, 0x48, 0xcc, 0x8b,
+    0x72, 0xcb, 0x8c, 0xb9, 0x28, 0x97, 0xb9, 0xb8, 0xbc, 0x48, 0x8b, 0x68,
+    0x8b, 0xcb, 0x98, 0x7b, 0x85, 0xb8, 0x8d, 0xbb, 0x80, 0xb7, 0x58, 0x5a,
+    0x41, 0x16, 0xa7, 0x2d, 0x47, 0x96, 0x96, 0xa1, 0x1d, 0x48, 0x6a, 0x10,
+    0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0xa5, 0xaa, 0x40, 0xb0, 0x7a,
+    0x48, 0xb5, 0x8b, 0x47, 0xab, 0x8b, 0xaa, 0xba, 0x78, 0xa8, 0xbb, 0x9c,
+    0xb7, 0x84, 0xbb, 0x8b, 0x2b, 0x3b, 0xcc, 0x88, 0xb7, 0x8d, 0xc8, 0xbd,
+    0x2b, 0x79, 0xbc, 0x9b, 0x9c, 0x27, 0xb9, 0x29, 0x22, 0xcb, 0x8c, 0x19,
+    0xb7, 0xec, 0x92, 0xc2, 0x2e, 0x79, 0x93, 0x9c, 0x99, 0xca, 0x20, 0xc8,
+    0x26, 0xe3, 0x29, 0xcc, 0x90, 0xbc, 0x1e, 0x97, 0xc3, 0x9d, 0xc9, 0xcd,
+    0x82, 0x7c, 0x22, 0x99, 0x23, 0x29, 0x93, 0x22, 0xbc, 0x69, 0xcc, 0x99,
+    0xc2, 0x89, 0x6c, 0x8b, 0xc8, 0xb2, 0x79, 0xc8, 0xbb, 0x9b, 0x87, 0x9c,
+    0x8b, 0x2b, 0x84, 0x2b, 0xa4, 0x7b, 0x8b, 0x8b, 0xb4, 0xb8, 0x88, 0xb6,
+    0x4a, 0xd4, 0x11, 0x6a, 0x71, 0xd4, 0x87, 0x86, 0x96, 0xa1, 0x2d, 0x47,
+    0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0xb5, 0xab, 0x45, 0xb0,
+    0x94, 0x3b, 0xa4, 0x89, 0xb3, 0x8b, 0xb4, 0x8b, 0x78, 0xb8, 0x8c, 0xc8,
+    0xb7, 0xaa, 0xb8, 0x9b, 0xbc, 0x8b, 0x6c, 0x99, 0xbb, 0x9c, 0x78, 0xbd,
+    0x22, 0x8b, 0xc7, 0x99, 0x22, 0xe9, 0x93, 0x99, 0x1e, 0xb8, 0xc0, 0x09,
+    0x72, 0xe9, 0xc2, 0xe2, 0x99, 0xc1, 0x39, 0x7e, 0x2b, 0x3c, 0x23, 0x97,
+    0x2e, 0xc2, 0xcb, 0x23, 0x82, 0x33, 0xcc, 0x27, 0xce, 0x22, 0x32, 0x2c,
+    0x79, 0x2e, 0xc2, 0x92, 0xc7, 0x22, 0x93, 0xc9, 0x92, 0x99, 0x0c, 0x6b,
+    0xdc, 0x9c, 0xcb, 0x89, 0x6d, 0xb8, 0x22, 0xb2, 0x78, 0xca, 0x8b, 0xb8,
+    0xb7, 0x8b, 0xcc, 0x8b, 0x4a, 0x8a, 0x68, 0x9b, 0xd8, 0xab, 0x98, 0x9a,
+    0x64, 0xab, 0x41, 0x16, 0xa7, 0x31, 0x51, 0x78, 0x60, 0x96, 0xa1, 0x25,
+    0x57, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0xa5, 0xa8, 0x58,
+    0xa0, 0x5a, 0xb0, 0xab, 0x48, 0x86, 0xb9, 0x8a, 0x8b, 0x98, 0x57, 0xd8,
+    0x8b, 0x99, 0xb8, 0xab, 0x99, 0x5b, 0x8c, 0x28, 0xb7, 0xcc, 0x99, 0xbc,
+    0x2b, 0x79, 0xcb, 0x22, 0xc2, 0xc8, 0x97, 0x39, 0x2c, 0xcb, 0xc2, 0x02,
+    0xac, 0x0d, 0xd1, 0x8f, 0xc1, 0x2b, 0x93, 0x7c, 0x2c, 0x2e, 0x2c, 0x30,
+    0x23, 0x92, 0x7c, 0x9e, 0xc9, 0x23, 0xc7, 0x29, 0xcc, 0x39, 0x2c, 0x92,
+    0x83, 0x72, 0x99, 0x29, 0x22, 0xc0, 0x09, 0x7c, 0xb2, 0x2c, 0x22, 0x87,
+    0xcb, 0x89, 0xc2, 0x28, 0x89, 0x6c, 0xb8, 0x8c, 0xa8, 0x9b, 0x2c, 0x8b,
+    0x1a, 0x98, 0xb6, 0x89, 0x85, 0xba, 0x49, 0x87, 0x44, 0xab, 0x41, 0x16,
+    0xa7, 0x36, 0x4d, 0x78, 0x60, 0x96, 0xa1, 0x25, 0xf7, 0xb1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x57, 0x58, 0x4b, 0x09, 0xa0, 0x18, 0xa7, 0x44, 0xa5,
+    0xca, 0x8b, 0x98, 0x3b, 0x88, 0xd8, 0xb9, 0x84, 0xcb, 0x9c, 0x88, 0xb9,
+    0x90, 0x52, 0x8d, 0xb9, 0x28, 0xc7, 0x99, 0xbb, 0xc9, 0xce, 0x79, 0x22,
+    0xcc, 0x99, 0xe7, 0x29, 0xcc, 0x22, 0xc8, 0xbc, 0xd1, 0xf1, 0x0f, 0x99,
+    0x0e, 0x9c, 0x29, 0x32, 0x03, 0x79, 0x23, 0x9e, 0x29, 0x28, 0xe7, 0x99,
+    0x22, 0xe9, 0xec, 0x79, 0x22, 0x33, 0x99, 0xd9, 0x91, 0xb9, 0x42, 0xc8,
+    0x32, 0x9c, 0x49, 0x9c, 0xbc, 0x89, 0x6b, 0x99, 0xbc, 0x89, 0x7c, 0xc9,
+    0x88, 0xbc, 0x98, 0xb0, 0x08, 0x7b, 0xb9, 0x88, 0xba, 0xb9, 0x88, 0xb9,
+    0x44, 0xa4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x74, 0x5a, 0xa4, 0xab, 0x50, 0x78, 0x4a, 0x8a, 0x0d,
+    0xb7, 0x0b, 0x88, 0xb8, 0x8b, 0x7c, 0xbb, 0x4b, 0xba, 0x87, 0xc2, 0x8b,
+    0x9b, 0x9c, 0x7c, 0xbc, 0x2c, 0x9c, 0x27, 0x92, 0x99, 0xc9, 0x2e, 0x72,
+    0xb2, 0x99, 0xe2, 0xc7, 0x9c, 0xd9, 0x2c, 0xc9, 0x2c, 0xdc, 0x82, 0x8f,
+    0x61, 0xf1, 0x1f, 0x1f, 0xd1, 0x0d, 0x79, 0xcc, 0x22, 0xec, 0x98, 0x20,
+    0x82, 0x83, 0x6c, 0x3c, 0xc2, 0xec, 0x72, 0xc2, 0x9e, 0x23, 0xcb, 0x29,
+    0xc4, 0x9c, 0xc8, 0x20, 0x22, 0xc8, 0x9c, 0x09, 0x8b, 0x69, 0x98, 0xd2,
+    0x8c, 0xcb, 0x1c, 0xb7, 0x98, 0xcb, 0x98, 0xc9, 0xb8, 0x0b, 0x9a, 0x4b,
+    0x88, 0xba, 0x78, 0x84, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x04, 0xba, 0xa0, 0x8a, 0x54, 0x4a,
+    0xb8, 0x47, 0xbb, 0x5c, 0xb8, 0xb8, 0xbb, 0x44, 0xbb, 0xa8, 0x7c, 0xb9,
+    0xb9, 0x89, 0xc0, 0x28, 0xbc, 0x9b, 0x09, 0x82, 0x69, 0x92, 0xcc, 0x9e,
+    0x73, 0xb2, 0x92, 0xe2, 0x97, 0xbc, 0xe8, 0xcc, 0x3c, 0x49, 0xcc, 0x92,
+    0x9c, 0x7b, 0x11, 0x2e, 0x33, 0xc7, 0x9c, 0xe3, 0x3c, 0x9e, 0x72, 0xc2,
+    0xc2, 0x92, 0x30, 0x39, 0x2e, 0x99, 0xc4, 0x23, 0x23, 0x28, 0x99, 0xc4,
+    0x9d, 0xc2, 0xc8, 0x27, 0xe2, 0x29, 0xed, 0x8c, 0x9c, 0x4a, 0xcb, 0x8b,
+    0x72, 0xc9, 0x9c, 0xcb, 0xc9, 0xb0, 0x88, 0xc8, 0xb7, 0x98, 0xbb, 0x98,
+    0xc9, 0x38, 0xb8, 0x48, 0xb7, 0x4b, 0xb8, 0xa8, 0x8b, 0x78, 0x44, 0xa4,
+    0x11, 0x6d, 0x72, 0x66, 0x10, 0x9f, 0x11, 0x6f, 0x11, 0x1b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x74, 0x8d, 0x88, 0x4a, 0x40, 0x2b, 0xa5, 0x78, 0x48,
+    0xb8, 0x9c, 0xb7, 0xa8, 0x98, 0xcb, 0x8d, 0x89, 0x78, 0xbb, 0x28, 0x9c,
+    0xb9, 0x90, 0x29, 0x9d, 0x7b, 0xbc, 0x9c, 0x99, 0x89, 0x23, 0x93, 0x28,
+    0x9c, 0x22, 0xc9, 0x72, 0xe9, 0x29, 0xd9, 0x30, 0x09, 0x7c, 0x2c, 0x39,
+    0xc9, 0xd7, 0x11, 0xcd, 0x32, 0x2c, 0x79, 0x32, 0x2c, 0x23, 0x29, 0x33,
+    0x23, 0x3c, 0x49, 0x33, 0xc2, 0x9c, 0x2e, 0x9e, 0x99, 0x72, 0x32, 0x2c,
+    0xc9, 0xc8, 0x27, 0xcc, 0x9c, 0xcb, 0xb2, 0x7e, 0x92, 0xb2, 0x9c, 0x27,
+    0x9c, 0x92, 0x2b, 0x2c, 0x7b, 0x98, 0xbb, 0xc8, 0xb7, 0xc9, 0x98, 0xb9,
+    0xb8, 0x5b, 0xc9, 0x8b, 0x97, 0xaa, 0xbb, 0xab, 0x8b, 0x78, 0x54, 0xa4,
+    0x11, 0x6d, 0x70, 0xf8, 0x50, 0x54, 0x45, 0x54, 0xd8, 0x6d, 0x10, 0xb0,
+    0x07, 0xa2, 0xf2, 0xf2, 0x27, 0xa0, 0x9a, 0x04, 0x8a, 0x5b, 0x44, 0x8b,
+    0x87, 0xb4, 0xdb, 0x84, 0x8c, 0x7a, 0x99, 0x8c, 0x99, 0x88, 0x97, 0xb2,
+    0x9b, 0xb9, 0x29, 0x52, 0x8c, 0xc2, 0xb7, 0xc2, 0xc8, 0x22, 0x92, 0x89,
+    0x72, 0xbd, 0xcc, 0x23, 0x97, 0x2c, 0x9c, 0x9e, 0x23, 0x19, 0x28, 0xc8,
+    0x96, 0x23, 0xd1, 0x1d, 0xe9, 0x21, 0xd2, 0x93, 0x0e, 0x83, 0x72, 0x3c,
+    0x33, 0xc2, 0x30, 0x63, 0xc2, 0xc2, 0xce, 0x7c, 0x2c, 0xce, 0x9e, 0xc7,
+    0x93, 0x39, 0x32, 0xd3, 0x82, 0x6c, 0x92, 0xcb, 0xdb, 0x4c, 0x9c, 0x9c,
+    0x72, 0xc9, 0x92, 0xc2, 0xb7, 0x9d, 0xc9, 0x98, 0xc9, 0x9b, 0x7c, 0x99,
+    0x8b, 0xb9, 0xb0, 0x88, 0x9b, 0x5a, 0xba, 0xbb, 0xa8, 0x88, 0xa6, 0x0b,
+    0xa4, 0x11, 0x6b, 0x74, 0x6b, 0x54, 0x50, 0x9d, 0x55, 0x54, 0x51, 0x6c,
+    0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0xaa, 0x58, 0x54, 0x88, 0x4a,
+    0xa8, 0x8c, 0x88, 0x6b, 0xb9, 0x88, 0x9b, 0x88, 0x79, 0xbb, 0x9b, 0x92,
+    0xc7, 0xbc, 0xb8, 0xbb, 0x29, 0x72, 0xbb, 0x2c, 0x99, 0xb7, 0xd8, 0x22,
+    0x92, 0x39, 0xac, 0x33, 0xcc, 0xb7, 0x2c, 0xbe, 0x32, 0x32, 0x22, 0x2c,
+    0x83, 0x72, 0x2d, 0xb1, 0x1e, 0x38, 0x28, 0xc6, 0x22, 0x3c, 0x3e, 0x27,
+    0x33, 0xe3, 0xc3, 0x93, 0x13, 0xe9, 0x30, 0x27, 0x3c, 0x22, 0xce, 0xb3,
+    0x82, 0x7c, 0x39, 0xdc, 0xe9, 0x37, 0xc3, 0x2c, 0x2b, 0xc2, 0xa2, 0x79,
+    0xc2, 0x29, 0x2c, 0x97, 0xbb, 0xc9, 0x9b, 0xbc, 0x89, 0x8b, 0x79, 0x98,
+    0xb2, 0xb8, 0xc0, 0x58, 0x89, 0xbb, 0x87, 0x98, 0xab, 0xba, 0x5b, 0x7a,
+    0x4a, 0xa4, 0x11, 0x6b, 0x74, 0xd4, 0x51, 0x70, 0x96, 0x21, 0x1d, 0x85,
+    0x86, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x75, 0xb8, 0xa4, 0x88,
+    0xb0, 0x75, 0xa8, 0x8a, 0x58, 0xb7, 0x9b, 0x8a, 0xba, 0xb8, 0x7b, 0x9b,
+    0x9b, 0x8c, 0x27, 0xbb, 0xcb, 0x29, 0xc9, 0x62, 0xc8, 0xbc, 0x29, 0x82,
+    0x6c, 0xbc, 0xc2, 0xc9, 0x7e, 0xc9, 0x3c, 0x32, 0xc7, 0xee, 0xa2, 0xe9,
+    0xc9, 0x43, 0x2e, 0x2e, 0x83, 0x6c, 0xb1, 0x1c, 0x32, 0x9c, 0x63, 0x23,
+    0x23, 0xc2, 0x73, 0xde, 0x2c, 0xec, 0xe0, 0x93, 0x4c, 0xe9, 0x3e, 0x73,
+    0x23, 0x2c, 0x2e, 0xc7, 0x2e, 0x9d, 0x39, 0xc3, 0x92, 0x4d, 0xcb, 0xce,
+    0x09, 0x72, 0x92, 0x9c, 0x92, 0x98, 0x28, 0x97, 0xcb, 0x29, 0xb2, 0xc2,
+    0xa9, 0x6b, 0x89, 0xdb, 0x8b, 0xab, 0x72, 0x8b, 0xb4, 0xbb, 0x89, 0xa6,
+    0xba, 0xb4, 0x11, 0x6a, 0x75, 0x64, 0x56, 0x76, 0x96, 0x91, 0x3d, 0x4d,
+    0x7b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0xa5, 0x8a, 0x88,
+    0xb0, 0x78, 0x8b, 0x8b, 0xab, 0x88, 0xb9, 0x80, 0xb8, 0x87, 0xb8, 0x9b,
+    0x98, 0xb2, 0x7c, 0x99, 0xbc, 0xb9, 0x20, 0x2c, 0xb9, 0x92, 0x53, 0x92,
+    0xdb, 0xc8, 0x29, 0xc4, 0x29, 0x2e, 0x27, 0x92, 0xcd, 0xb9, 0x39, 0x83,
+    0x82, 0x6e, 0x32, 0x33, 0xeb, 0x81, 0x8e, 0x62, 0xc9, 0xc3, 0x3e, 0x72,
+    0xcc, 0x32, 0xce, 0xc9, 0x30, 0xe0, 0x32, 0x23, 0xeb, 0x36, 0xc9, 0x3e,
+    0x9c, 0x29, 0x34, 0xc2, 0x9c, 0xe8, 0x99, 0xc2, 0xb9, 0xc0, 0x72, 0xc2,
+    0x99, 0x39, 0x27, 0xc9, 0xcb, 0xc9, 0xc2, 0x78, 0x29, 0xcb, 0x9c, 0x87,
+    0xb9, 0xb8, 0xcb, 0x2b, 0x68, 0x9b, 0x88, 0x9b, 0x88, 0x69, 0xaa, 0xb0,
+    0xab, 0x98, 0x21, 0x16, 0xa7, 0x3f, 0x51, 0x78, 0x60, 0x96, 0xa1, 0x25,
+    0x47, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x57, 0x45, 0xa0, 0xb9, 0x80,
+    0x1a, 0x89, 0xb0, 0x87, 0xbb, 0x89, 0x8b, 0xb8, 0x9b, 0x58, 0xcb, 0x88,
+    0x98, 0x26, 0x99, 0xb2, 0x99, 0x20, 0x72, 0x8c, 0xc2, 0xc2, 0x87, 0xcc,
+    0x99, 0x23, 0x3e, 0x72, 0x9c, 0x2e, 0x22, 0xc7, 0x93, 0xc9, 0x33, 0x9e,
+    0x19, 0x29, 0x33, 0xe3, 0xeb, 0x81, 0x83, 0x62, 0xdc, 0x23, 0xce, 0x79,
+    0xec, 0x32, 0x2e, 0x38, 0x28, 0xe0, 0x52, 0x23, 0x39, 0xd8, 0xc7, 0xec,
+    0x93, 0xc2, 0x23, 0x7c, 0x3e, 0x99, 0xc2, 0xd7, 0x9c, 0xc2, 0xcc, 0x9c,
+    0x3c, 0xbc, 0xb8, 0x27, 0x92, 0x32, 0xc9, 0xe9, 0x82, 0x79, 0xcb, 0xb9,
+    0x9b, 0x87, 0xc9, 0x88, 0xbc, 0x98, 0x18, 0xb7, 0x29, 0x8b, 0x88, 0xc8,
+    0x9a, 0x00, 0x7b, 0xb8, 0x84, 0x11, 0x6a, 0x72, 0xd4, 0x79, 0x60, 0x96,
+    0xa1, 0x1d, 0x58, 0x6a, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x8a,
+    0x80, 0xab, 0x88, 0x65, 0x98, 0xdb, 0x4c, 0x78, 0x89, 0x4d, 0xb8, 0xc7,
+    0xb9, 0x8c, 0xb8, 0xb9, 0x9b, 0x39, 0x92, 0x98, 0x20, 0x79, 0x8c, 0xbc,
+    0xc9, 0xb8, 0xc8, 0x27, 0xcc, 0x32, 0xc9, 0xd2, 0xac, 0x79, 0x3c, 0xc3,
+    0x39, 0xd0, 0x5c, 0x33, 0x2c, 0x37, 0xd3, 0xb1, 0x13, 0x39, 0x7d, 0xcc,
+    0xdc, 0x39, 0xe8, 0x37, 0xc3, 0xc3, 0xc3, 0x23, 0x93, 0x69, 0x9e, 0x3e,
+    0x39, 0x93, 0x0c, 0x83, 0x72, 0x3c, 0x39, 0xe9, 0xc7, 0x9e, 0xc9, 0x3c,
+    0x93, 0x22, 0x9e, 0x92, 0x69, 0x29, 0xc9, 0xbc, 0x79, 0x22, 0x8d, 0xbb,
+    0xc7, 0x99, 0xbd, 0x9b, 0x9b, 0x99, 0x38, 0xbb, 0x98, 0xb6, 0x88, 0xb9,
+    0xca, 0x08, 0xa6, 0xb8, 0x84, 0x11, 0x6a, 0x72, 0xd4, 0x79, 0x60, 0xa6,
+    0x91, 0x1d, 0x48, 0x6a, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78,
+    0xa5, 0x45, 0xb8, 0xa0, 0x38, 0x98, 0xc7, 0xb0, 0xba, 0xa8, 0xb9, 0x7b,
+    0x9b, 0x8c, 0x9b, 0x88, 0xc8, 0x97, 0x2b, 0x9c, 0x29, 0x2b, 0x09, 0x92,
+    0x4c, 0xb9, 0xdc, 0x92, 0x43, 0x92, 0x2c, 0x92, 0x3e, 0x2c, 0xe7, 0x9e,
+    0x39, 0xe2, 0x93, 0x1c, 0x28, 0x37, 0xc2, 0xdc, 0xb1, 0x13, 0x9c, 0x73,
+    0xec, 0x2d, 0xc3, 0x99, 0xe0, 0x38, 0xe9, 0x30, 0x43, 0xec, 0x23, 0x7c,
+    0xee, 0x29, 0xde, 0xcb, 0x35, 0x2e, 0xcc, 0x2c, 0x72, 0xde, 0x9e, 0x29,
+    0xc0, 0x49, 0x2c, 0xc2, 0x73, 0x92, 0x9d, 0x9a, 0xea, 0x24, 0xcb, 0x2b,
+    0x97, 0xcb, 0x28, 0xc2, 0x29, 0x8b, 0x9b, 0x18, 0xba, 0x85, 0xbb, 0xa8,
+    0xda, 0x98, 0x34, 0x11, 0x6a, 0x71, 0xd4, 0x87, 0x86, 0x96, 0xa1, 0x2b,
+    0x47, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0x5b, 0x49, 0x81, 0x5b,
+    0x9b, 0x89, 0x64, 0xbb, 0x89, 0xb8, 0x8b, 0x79, 0x8d, 0xb8, 0x8d, 0xa8,
+    0xb7, 0x2c, 0x9c, 0x99, 0x2c, 0x6b, 0xc9, 0xcc, 0x92, 0x7d, 0xcb, 0x92,
+    0xc9, 0x29, 0xc5, 0x99, 0xc2, 0x3e, 0x79, 0xe2, 0x2c, 0x23, 0x90, 0x5c,
+    0x9e, 0xec, 0x38, 0xc7, 0xb1, 0x12, 0x3e, 0x2e, 0x7c, 0x92, 0xe3, 0x92,
+    0xf7, 0x2e, 0x2e, 0xe3, 0xe2, 0x52, 0x33, 0x2e, 0x37, 0xe3, 0x9c, 0xde,
+    0x29, 0x8e, 0x72, 0x3e, 0xc3, 0x99, 0xd7, 0x9c, 0xe2, 0xe2, 0x2e, 0x62,
+    0x3b, 0xc9, 0xec, 0x73, 0x2c, 0xc8, 0xe2, 0x98, 0xc6, 0x9c, 0x9b, 0x9c,
+    0x97, 0x89, 0xdb, 0xb9, 0x2c, 0x5b, 0xc8, 0x8b, 0x97, 0x8b, 0x8b, 0xa4,
+    0xbc, 0x7b, 0x88, 0xb4, 0x11, 0x6a, 0x73, 0xf5, 0x17, 0x86, 0x96, 0xa1,
+    0x25, 0x57, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0xab, 0x4b, 0x5b,
+    0x88, 0x6b, 0xbc, 0x8b, 0xa8, 0x9b, 0x28, 0x8c, 0x7a, 0x8b, 0xc8, 0x8b,
+    0xd8, 0xa8, 0x26, 0xc9, 0xc9, 0x82, 0xc0, 0x12, 0xc8, 0x98, 0xc8, 0x97,
+    0xcc, 0x2e, 0x29, 0x3e, 0x72, 0x29, 0x3c, 0x9e, 0xc7, 0x3c, 0x2e, 0xe9,
+    0xe2, 0x2e, 0x23, 0x9e, 0x79, 0xec, 0x11, 0x3e, 0x27, 0x3e, 0x99, 0xee,
+    0x92, 0x8e, 0x79, 0xc3, 0xe3, 0x3e, 0x20, 0x29, 0xce, 0xc3, 0x6e, 0x2e,
+    0xc3, 0xd2, 0x7c, 0x3e, 0x22, 0x9c, 0xe7, 0x93, 0x23, 0x39, 0xc3, 0x69,
+    0xcb, 0x32, 0x23, 0x7e, 0x29, 0xcb, 0xcc, 0x27, 0xc9, 0x2c, 0x89, 0x2c,
+    0x88, 0x6c, 0xc8, 0x92, 0x2b, 0x18, 0xc8, 0x86, 0xbc, 0x8b, 0x88, 0xb9,
+    0x87, 0xb8, 0xac, 0x41, 0x16, 0xa7, 0x56, 0x54, 0x17, 0x60, 0x96, 0x91,
+    0x3b, 0x51, 0x6b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x17, 0x5a, 0xa2,
+    0xb8, 0xa0, 0x18, 0xb7, 0xc8, 0xba, 0x4d, 0x8b, 0x78, 0xbb, 0x89, 0xb9,
+    0x2b, 0xb0, 0xc7, 0x29, 0xb2, 0x99, 0x3c, 0x09, 0x82, 0x89, 0x8c, 0x79,
+    0xc2, 0x2d, 0x2c, 0x38, 0x26, 0x92, 0xce, 0x22, 0x97, 0xec, 0x33, 0xc2,
+    0x32, 0x0e, 0x73, 0x32, 0x3e, 0x2e, 0x38, 0x17, 0xfe, 0x23, 0xe9, 0x3c,
+    0x73, 0xec, 0x3e, 0x33, 0xeb, 0x30, 0x33, 0xee, 0x9a, 0x30, 0xe8, 0x37,
+    0xc3, 0x3d, 0xcd, 0xe3, 0x82, 0x69, 0xec, 0x22, 0x9c, 0xa3, 0x29, 0xcb,
+    0x8c, 0x82, 0x8c, 0x69, 0x2b, 0x9d, 0xbc, 0x79, 0x22, 0x92, 0x2b, 0xc7,
+    0xb9, 0x29, 0xbc, 0x98, 0x19, 0xb7, 0x89, 0xcc, 0x89, 0x98, 0x9b, 0x08,
+    0x7b, 0x88, 0xb4, 0x11, 0x6b, 0x74, 0x15, 0x4b, 0xf0, 0x06, 0x71, 0x1f,
+    0xd4, 0x4b, 0x7c, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0xab,
+    0x8b, 0x5b, 0xa0, 0x78, 0xab, 0x99, 0xaa, 0xc7, 0xab, 0x89, 0xb9, 0xcb,
+    0x7a, 0xc2, 0x9b, 0xc9, 0x27, 0xb9, 0xb9, 0x22, 0x9c, 0x6b, 0x2c, 0x99,
+    0xc3, 0xa2, 0x3c, 0xce, 0xc9, 0x25, 0x93, 0xc3, 0xe9, 0x7c, 0x3c, 0x3c,
+    0xc2, 0xe0, 0x02, 0x8e, 0x62, 0x3e, 0x3e, 0x2f, 0x91, 0x2f, 0xf1, 0xaf,
+    0x71, 0xd3, 0xed, 0x2e, 0x29, 0x30, 0xe0, 0x2e, 0xce, 0x73, 0xec, 0x33,
+    0xee, 0x38, 0x29, 0x37, 0xf2, 0xc3, 0x32, 0x3c, 0x7e, 0x3b, 0xce, 0x32,
+    0xc0, 0x9c, 0x52, 0xd9, 0x92, 0xc7, 0x32, 0x9c, 0xd9, 0x29, 0x92, 0x3c,
+    0x99, 0xc7, 0xb9, 0xcc, 0xbc, 0x92, 0x0b, 0x78, 0xbb, 0x9b, 0x89, 0xb8,
+    0x89, 0xb7, 0x88, 0x58, 0x41, 0x16, 0xc7, 0x31, 0x54, 0x50, 0xa5, 0x34,
+    0x5d, 0x7d, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x88, 0xb8, 0xba,
+    0x88, 0x39, 0x98, 0xb7, 0xa4, 0xcb, 0x99, 0xb8, 0xab, 0x58, 0x92, 0xbb,
+    0xc7, 0x9c, 0x22, 0x99, 0xc9, 0x82, 0x6c, 0xbc, 0x92, 0xc3, 0x72, 0xbe,
+    0x9b, 0xcc, 0x98, 0xc7, 0x32, 0x39, 0x32, 0x29, 0x8c, 0x93, 0x8c, 0x12,
+    0xea, 0x33, 0xe3, 0x2e, 0x81, 0xf1, 0x4f, 0x3e, 0xe3, 0x8e, 0x93, 0x0e,
+    0x73, 0xe3, 0xc3, 0xe3, 0xe9, 0x31, 0x2e, 0x72, 0x2e, 0xe2, 0xe3, 0xe9,
+    0x37, 0xc3, 0x32, 0xc3, 0x2c, 0x3c, 0x33, 0x29, 0x35, 0x2c, 0xe2, 0x9e,
+    0xa2, 0x49, 0xcc, 0xbc, 0x89, 0x7b, 0xb2, 0x29, 0x22, 0xb0, 0x68, 0xbc,
+    0x9b, 0x98, 0xcb, 0x08, 0x75, 0xb8, 0x84, 0x11, 0x6d, 0x72, 0x6f, 0xd0,
+    0x94, 0x1b, 0xf8, 0x6e, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74,
+    0x4b, 0x98, 0x8a, 0xb0, 0x59, 0xb9, 0xb8, 0x57, 0xc8, 0xb9, 0xc8, 0x8b,
+    0x78, 0xbb, 0x9b, 0x92, 0xb8, 0x27, 0x92, 0xc9, 0xcb, 0x3c, 0x42, 0xcd,
+    0x93, 0x82, 0x73, 0xbe, 0x2c, 0x32, 0x98, 0x36, 0xe2, 0xc3, 0x92, 0xd7,
+    0x2e, 0x32, 0x3e, 0xe2, 0x83, 0x8e, 0xb3, 0x1e, 0xbf, 0x16, 0x1d, 0x3e,
+    0x33, 0xea, 0x30, 0xe0, 0x63, 0xe3, 0x3e, 0xe3, 0x7e, 0xe3, 0xe2, 0xe2,
+    0xe9, 0x35, 0xec, 0xe2, 0xe3, 0x79, 0x3e, 0x9c, 0x39, 0x20, 0x5e, 0x39,
+    0x29, 0x27, 0x33, 0x2c, 0x92, 0xe9, 0x72, 0xcc, 0x29, 0xcb, 0x28, 0x97,
+    0x29, 0x2b, 0x22, 0x92, 0x69, 0xac, 0x8c, 0xb8, 0xbb, 0x19, 0xb7, 0xab,
+    0x8b, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x7a, 0x88, 0xb8, 0x8b, 0x80, 0x4b, 0x9c, 0xb4, 0x7b, 0xb8,
+    0xb9, 0xbc, 0x88, 0xb7, 0x99, 0xb9, 0xbd, 0x9b, 0x92, 0x59, 0x9c, 0x9c,
+    0x20, 0x09, 0x7c, 0x22, 0x99, 0xee, 0x29, 0xc5, 0x92, 0xc2, 0x3e, 0x72,
+    0xe3, 0x93, 0xd3, 0xea, 0x31, 0xe3, 0x43, 0x39, 0xe3, 0x7e, 0xe2, 0xee,
+    0x2c, 0x38, 0xeb, 0x33, 0xec, 0x3e, 0x83, 0x9e, 0x23, 0xce, 0x73, 0xe3,
+    0x2e, 0xc3, 0x27, 0x3e, 0xe3, 0xe3, 0x32, 0x93, 0x4e, 0xe2, 0xe3, 0x72,
+    0x3d, 0x3c, 0x22, 0xc0, 0x2c, 0xc2, 0x7c, 0xc9, 0xc3, 0xe2, 0x98, 0xc6,
+    0x8c, 0x2c, 0xc9, 0xc8, 0x97, 0xbc, 0x99, 0xc9, 0xb9, 0x82, 0x58, 0x9b,
+    0x8d, 0x97, 0x8b, 0x8b, 0x88, 0xcb, 0x78, 0x8b, 0xa4, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0x84,
+    0x9b, 0x5b, 0x80, 0x5b, 0x89, 0xb8, 0xd7, 0xb4, 0xab, 0x9c, 0xc8, 0xab,
+    0x29, 0xbc, 0x89, 0x82, 0x6c, 0x28, 0x92, 0xc2, 0x09, 0x73, 0xc2, 0x2c,
+    0xc2, 0xc8, 0xe7, 0x93, 0x23, 0x32, 0x3c, 0x93, 0x7e, 0xec, 0x22, 0xe3,
+    0x28, 0xe0, 0x33, 0xe2, 0xea, 0x35, 0xee, 0x23, 0xe3, 0x8e, 0x73, 0xe3,
+    0x3e, 0x33, 0xe9, 0x31, 0xef, 0x93, 0x9e, 0x73, 0xec, 0xc3, 0xee, 0x39,
+    0xe6, 0x93, 0x3e, 0x33, 0xea, 0x36, 0xee, 0xc9, 0xce, 0x30, 0x72, 0xee,
+    0x2c, 0x2e, 0x27, 0x32, 0x9e, 0xc8, 0xc3, 0x79, 0xc2, 0x92, 0xc9, 0xc7,
+    0x8c, 0xc8, 0x92, 0x2c, 0x2b, 0x89, 0x82, 0x88, 0x6b, 0x9b, 0x8b, 0xba,
+    0x79, 0xcb, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x67, 0xba, 0x0b, 0xb4, 0x8a, 0x5c, 0x88, 0xb8, 0xc7,
+    0xb0, 0x8c, 0x8b, 0xcb, 0x89, 0x7c, 0xb8, 0xcc, 0x88, 0xc7, 0x32, 0x29,
+    0xcc, 0x2c, 0x59, 0x9c, 0x99, 0x37, 0x92, 0x3d, 0xc2, 0x39, 0x7d, 0x23,
+    0x2e, 0x3c, 0x27, 0x3e, 0xe2, 0xce, 0x32, 0x8e, 0x22, 0xe3, 0x7e, 0x23,
+    0xe3, 0xee, 0xbf, 0x18, 0x38, 0xe8, 0x39, 0xe2, 0x33, 0xe0, 0x9e, 0x12,
+    0x37, 0xe2, 0x33, 0x2c, 0x3f, 0x93, 0x52, 0xd3, 0x3c, 0xe8, 0x37, 0x2e,
+    0x3e, 0x2c, 0x32, 0x62, 0xee, 0x9c, 0xce, 0x89, 0x6c, 0x9d, 0xc8, 0x2c,
+    0x79, 0xcc, 0x29, 0xcc, 0xb7, 0x9c, 0xc8, 0x9c, 0x2b, 0x5b, 0x8d, 0x2b,
+    0x97, 0x8b, 0xc8, 0xbb, 0x89, 0x7b, 0xda, 0xa4, 0x11, 0x6a, 0x70, 0x6b,
+    0xf0, 0xff, 0x06, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0xb5,
+    0x9b, 0x5a, 0x80, 0x1b, 0x47, 0x8b, 0x9c, 0x98, 0x9c, 0x7b, 0x9b, 0x98,
+    0xbb, 0x89, 0xc1, 0x98, 0x8c, 0x69, 0x29, 0xdc, 0x2c, 0x42, 0x9e, 0x3c,
+    0x89, 0x82, 0x6c, 0x2c, 0x32, 0xe2, 0x7c, 0xc3, 0xe3, 0x23, 0xe7, 0xc3,
+    0x23, 0xe3, 0xed, 0x42, 0xe3, 0xe2, 0x93, 0x1e, 0x3f, 0x11, 0x1f, 0x9e,
+    0x83, 0x8e, 0x93, 0x0f, 0x9e, 0x13, 0x99, 0xea, 0x31, 0xe3, 0x8e, 0x73,
+    0xe2, 0x3e, 0xce, 0x37, 0x93, 0xee, 0x39, 0x3e, 0x69, 0xee, 0x9c, 0xc3,
+    0x89, 0x63, 0xcc, 0x29, 0xce, 0x72, 0x23, 0x99, 0x2c, 0x99, 0xc4, 0x8a,
+    0xc2, 0x90, 0x29, 0x9c, 0x72, 0xbb, 0x88, 0xbb, 0x99, 0x87, 0x9b, 0x8b,
+    0x41, 0x16, 0xa7, 0x5f, 0x45, 0x54, 0x50, 0x05, 0x94, 0x55, 0x44, 0x54,
+    0x7b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0xca, 0x88, 0xbb,
+    0xa0, 0x6a, 0x0a, 0xb9, 0xb8, 0x99, 0x5b, 0xb8, 0x99, 0xb7, 0x92, 0x29,
+    0xc9, 0x8c, 0x72, 0x92, 0x9c, 0x22, 0xe0, 0x12, 0x99, 0xcb, 0x22, 0x33,
+    0x29, 0x37, 0x2e, 0xce, 0x29, 0x3e, 0x72, 0xe3, 0x2f, 0x33, 0xe0, 0xae,
+    0x09, 0x7c, 0xe3, 0x3f, 0x11, 0xfb, 0xd0, 0xf7, 0x11, 0xe3, 0xe3, 0x3e,
+    0xa3, 0x0e, 0x23, 0x3e, 0x83, 0x9e, 0x13, 0xc9, 0x32, 0xe3, 0xc7, 0xec,
+    0xe2, 0xe3, 0xd3, 0x79, 0xee, 0x23, 0x32, 0xd0, 0xc3, 0x72, 0x9c, 0x33,
+    0x22, 0x97, 0x2c, 0xc2, 0x9c, 0x9c, 0x79, 0x2c, 0x9c, 0x99, 0xc8, 0x90,
+    0x7b, 0x92, 0x9b, 0xd8, 0x99, 0xb9, 0x97, 0x88, 0xb8, 0x41, 0x16, 0xa7,
+    0x3f, 0x44, 0x58, 0xd0, 0xfd, 0x07, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x67, 0xab, 0xa8, 0x8b, 0x88, 0x0b, 0x78, 0x89, 0xc9, 0x89, 0xb7, 0x8d,
+    0xbb, 0x29, 0xc8, 0x99, 0x2c, 0x29, 0x92, 0x59, 0x22, 0x3c, 0x20, 0x23,
+    0x3c, 0x79, 0xcc, 0x29, 0x32, 0xc8, 0x26, 0xe2, 0xc2, 0xd3, 0x9b, 0x33,
+    0xe3, 0xce, 0x93, 0x3e, 0xce, 0xc9, 0x36, 0xe3, 0xf1, 0xf3, 0xe9, 0x38,
+    0xe7, 0x11, 0xd3, 0xe3, 0x3e, 0xb3, 0x6e, 0xe3, 0x3e, 0xe9, 0x8e, 0x93,
+    0x0e, 0x93, 0x4e, 0x3e, 0x3e, 0xb3, 0x5c, 0x3d, 0x2c, 0xe0, 0x3c, 0x33,
+    0xe9, 0x33, 0x22, 0x3e, 0x79, 0x2c, 0x22, 0xd9, 0x29, 0xc6, 0x9c, 0x9c,
+    0xc2, 0xb9, 0x20, 0x3a, 0xb2, 0xca, 0xb1, 0xc4, 0x8b, 0x88, 0x79, 0x9b,
+    0x84, 0x11, 0x6b, 0x74, 0xd5, 0x5d, 0x70, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x67, 0x48, 0xb5, 0x82, 0x88, 0x0b, 0x88, 0x8b, 0x88,
+    0x9b, 0x52, 0x9c, 0xc8, 0xc9, 0x94, 0xb2, 0xbc, 0x97, 0x2c, 0x89, 0x2c,
+    0xc9, 0x4c, 0xc3, 0x92, 0x7c, 0x2c, 0x33, 0xcc, 0x29, 0x34, 0x2c, 0x29,
+    0xc8, 0xe6, 0x23, 0xe2, 0x33, 0xe8, 0x30, 0x3e, 0x3c, 0xe9, 0x31, 0xe3,
+    0x81, 0x93, 0x9e, 0x42, 0xef, 0x1d, 0x93, 0x4e, 0x3e, 0xe2, 0x8e, 0x13,
+    0xe7, 0x3e, 0x3e, 0x33, 0xe3, 0xbe, 0x13, 0xe9, 0x32, 0xe3, 0x29, 0xe5,
+    0x23, 0xc2, 0x3e, 0x5c, 0x23, 0xe9, 0x37, 0xec, 0x2c, 0xc9, 0x92, 0x93,
+    0x42, 0xec, 0xbc, 0x72, 0x99, 0x2c, 0x9d, 0x98, 0x20, 0x28, 0x29, 0x72,
+    0x28, 0xb9, 0xb8, 0xba, 0x99, 0xb3, 0x41, 0x16, 0xc7, 0x3f, 0x44, 0x50,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0x5b, 0xa9, 0x81,
+    0xa8, 0x0b, 0x88, 0x7b, 0xb8, 0xbb, 0x8c, 0x87, 0xcc, 0xb4, 0xbc, 0xc9,
+    0x7b, 0x2b, 0xc9, 0x9c, 0x99, 0x21, 0xc3, 0x32, 0x2c, 0x97, 0x22, 0x3e,
+    0xec, 0x93, 0x8e, 0x62, 0x2e, 0xe2, 0x93, 0x8e, 0x83, 0x6c, 0xe3, 0xee,
+    0xc3, 0x93, 0x0e, 0x83, 0x7e, 0x3b, 0x11, 0xce, 0x39, 0xe4, 0x9e, 0xf1,
+    0xf9, 0x36, 0xe3, 0xee, 0x33, 0xe0, 0x03, 0xbe, 0x23, 0xe3, 0x9e, 0x33,
+    0x3e, 0x37, 0xe2, 0x3e, 0xe3, 0x23, 0x7e, 0xe3, 0x3c, 0xe2, 0xe0, 0x0e,
+    0x73, 0xc3, 0x23, 0xe2, 0x97, 0xec, 0x9e, 0xc2, 0xe9, 0x9c, 0x28, 0x2e,
+    0xa2, 0x49, 0xc9, 0xcb, 0x39, 0x2b, 0x98, 0x29, 0xb4, 0x89, 0x9b, 0x97,
+    0xb8, 0x82, 0x41, 0x16, 0xd7, 0x26, 0xb4, 0x25, 0xf7, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x8b, 0xb8, 0x09, 0x38, 0x9c, 0x99, 0xb2,
+    0x88, 0xca, 0xb1, 0x89, 0x7c, 0x2c, 0xb9, 0xcc, 0x97, 0xc2, 0x2c, 0x2c,
+    0xc3, 0x59, 0x93, 0x29, 0x27, 0xe2, 0xec, 0x9c, 0x3e, 0x89, 0x7e, 0xe2,
+    0x23, 0xe3, 0xe7, 0x33, 0xe3, 0xe3, 0x3e, 0x13, 0xe9, 0x30, 0xe7, 0x3e,
+    0xd1, 0x1c, 0xec, 0x8e, 0x93, 0x2f, 0x1f, 0x83, 0x8e, 0xa3, 0x1e, 0x30,
+    0x9e, 0x33, 0xce, 0xc9, 0xe1, 0x3e, 0xa3, 0x2e, 0x23, 0x7e, 0xe2, 0x33,
+    0xec, 0xe9, 0x31, 0xce, 0x93, 0x39, 0x33, 0x28, 0xe6, 0x23, 0xcc, 0x22,
+    0xe7, 0x29, 0x3c, 0x99, 0xc2, 0x7c, 0xb9, 0xc2, 0x2b, 0x90, 0x5c, 0xbb,
+    0x2c, 0x27, 0x8b, 0xb8, 0x99, 0x28, 0x7b, 0x58, 0xb4, 0x11, 0x6d, 0x72,
+    0x66, 0xd0, 0x24, 0x4b, 0x86, 0xf1, 0x11, 0xb0, 0x07, 0xa2, 0xf2, 0xf2,
+    0x17, 0x58, 0xb9, 0x81, 0xb8, 0x38, 0x9b, 0x98, 0xb6, 0xa9, 0xc9, 0x29,
+    0x27, 0xb9, 0x2c, 0x8b, 0xc9, 0x8c, 0x62, 0xc9, 0x2c, 0xde, 0x82, 0x69,
+    0x9d, 0xd9, 0x92, 0x8c, 0x62, 0xe3, 0x23, 0x3e, 0x72, 0x33, 0xec, 0xe3,
+    0xe9, 0x31, 0xce, 0x93, 0x13, 0xe9, 0x37, 0xe3, 0x3d, 0x11, 0xe3, 0x9e,
+    0x73, 0x3e, 0xf1, 0xfe, 0x39, 0xe8, 0x39, 0xe0, 0x0e, 0x93, 0x22, 0xef,
+    0x93, 0x3e, 0xe3, 0xe8, 0x37, 0xec, 0xe3, 0x3e, 0xe3, 0x7e, 0x3e, 0x33,
+    0x93, 0xe0, 0x13, 0x98, 0x36, 0xe3, 0x2c, 0xe9, 0xc7, 0x39, 0x3e, 0x2c,
+    0x23, 0x72, 0x23, 0x29, 0xc2, 0x9a, 0xc0, 0x80, 0x8b, 0x8c, 0x89, 0x78,
+    0x8c, 0xd8, 0xb9, 0xb7, 0xa8, 0xba, 0x41, 0x16, 0xd7, 0x96, 0x01, 0x95,
+    0x11, 0x6f, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xa8, 0x3b, 0xb8,
+    0x90, 0x3b, 0x88, 0x97, 0xcb, 0x8b, 0xcb, 0x29, 0x7b, 0x99, 0x2b, 0xcb,
+    0xc9, 0x26, 0xcb, 0x92, 0x3e, 0xc8, 0x90, 0x72, 0x9e, 0xd9, 0x22, 0xd7,
+    0xc2, 0xec, 0x23, 0x3c, 0x82, 0x6e, 0xe9, 0xe3, 0x3e, 0xc3, 0x0e, 0x1e,
+    0x38, 0xe9, 0x36, 0xed, 0x11, 0xe3, 0xea, 0x33, 0xef, 0x1f, 0xbe, 0x93,
+    0x8e, 0x6e, 0x33, 0xe3, 0xef, 0x93, 0x2e, 0xe3, 0x8e, 0x63, 0x3e, 0xe2,
+    0x3f, 0x7e, 0x3e, 0x33, 0xe3, 0x98, 0x30, 0x22, 0x3e, 0x83, 0x8e, 0x82,
+    0x73, 0xc2, 0x9c, 0xe9, 0x37, 0x23, 0x22, 0xc2, 0xc9, 0xa2, 0x2c, 0xb8,
+    0x02, 0x9c, 0x08, 0x89, 0x6a, 0xdd, 0xa8, 0x8c, 0x7a, 0xbb, 0xa4, 0x11,
+    0x6d, 0x79, 0x60, 0x66, 0x1b, 0x54, 0xd7, 0xe1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x7a, 0x8b, 0x89, 0x98, 0xb0, 0x5b, 0x88, 0xbd, 0xb7, 0x8b,
+    0x88, 0xcb, 0x9c, 0x7b, 0xbc, 0xc9, 0x22, 0xe7, 0x9c, 0xc9, 0x9c, 0x3e,
+    0x89, 0x13, 0xc7, 0x3c, 0x32, 0x32, 0x3e, 0xa3, 0x2e, 0x29, 0x7e, 0xe3,
+    0xc3, 0xe3, 0xe9, 0x30, 0xe9, 0x30, 0x0e, 0x73, 0xee, 0x32, 0xef, 0xd8,
+    0x16, 0x33, 0xe3, 0x3e, 0x37, 0xef, 0x1f, 0x33, 0xe3, 0x8e, 0x83, 0x8e,
+    0x1e, 0x39, 0xe1, 0x3e, 0x73, 0x3e, 0x3e, 0xe3, 0xe8, 0x36, 0xe3, 0x3e,
+    0xe3, 0xe7, 0x3e, 0x2e, 0xe3, 0xc3, 0x4e, 0x2c, 0x32, 0x8e, 0x62, 0x9e,
+    0xe2, 0xc2, 0x89, 0x7e, 0x22, 0xe9, 0x2c, 0x37, 0x29, 0x2c, 0x9c, 0x29,
+    0x19, 0x27, 0xcc, 0x8b, 0x22, 0x9b, 0xa9, 0x7b, 0xb8, 0xa4, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x3d, 0x44, 0xb8, 0x6c, 0x10, 0xb0, 0x07, 0xa2, 0xf2,
+    0xf2, 0x27, 0xb8, 0x9b, 0x98, 0x58, 0xb8, 0x9c, 0x98, 0xb7, 0x88, 0xbc,
+    0x93, 0xc8, 0x7d, 0x29, 0x92, 0xe2, 0xb7, 0xc2, 0x29, 0x9d, 0xc9, 0x73,
+    0xe3, 0x3c, 0xc3, 0x98, 0xe6, 0x9e, 0xe2, 0xc2, 0xca, 0xe0, 0x2a, 0x32,
+    0xee, 0x39, 0xe0, 0xc3, 0x2e, 0xfd, 0x81, 0x93, 0x5e, 0x3e, 0x33, 0xf7,
+    0x1f, 0x33, 0xf3, 0x3e, 0xa3, 0x7e, 0xe3, 0xee, 0x33, 0xe9, 0x37, 0xee,
+    0x9e, 0xe3, 0xe3, 0x8e, 0xd3, 0x32, 0xde, 0x30, 0x0e, 0x93, 0x32, 0x3e,
+    0xc7, 0x9e, 0xd2, 0xcc, 0x92, 0x9c, 0x4e, 0x2b, 0xd9, 0x72, 0x9c, 0xdb,
+    0x9c, 0x20, 0x99, 0x1d, 0xb8, 0x96, 0xcb, 0x99, 0x29, 0x87, 0xca, 0x0c,
+    0x81, 0x16, 0xd7, 0x96, 0x96, 0x61, 0x1b, 0x45, 0x16, 0xb1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x47, 0xba, 0xb9, 0x8b, 0x88, 0x4a, 0xb8, 0x9b, 0x89,
+    0x8b, 0x6c, 0x9b, 0xb2, 0xc8, 0x7c, 0xc9, 0x92, 0xc2, 0x87, 0xe2, 0xc9,
+    0x92, 0xc2, 0x0c, 0x83, 0x7c, 0x22, 0x33, 0xec, 0x98, 0xe8, 0x2c, 0x31,
+    0xce, 0xa3, 0xbe, 0x4e, 0xc3, 0xce, 0x83, 0x7e, 0xd1, 0x13, 0xe3, 0xe7,
+    0x3e, 0xe3, 0x11, 0xf3, 0x8e, 0x63, 0x3e, 0x3e, 0xe3, 0x2e, 0xe3, 0xae,
+    0xa3, 0x3e, 0x33, 0xf7, 0xe3, 0xc3, 0xe3, 0x3e, 0x83, 0x6e, 0x33, 0xc3,
+    0xe3, 0x0e, 0x73, 0xec, 0x22, 0x3e, 0x2a, 0x34, 0xc2, 0xcc, 0x99, 0xc2,
+    0xbe, 0x37, 0x99, 0xcc, 0x9b, 0xc9, 0x29, 0x9b, 0x7c, 0x29, 0x29, 0x29,
+    0x89, 0x97, 0xd5, 0x4d, 0x41, 0x16, 0xa7, 0x5f, 0x55, 0x44, 0x50, 0x05,
+    0x94, 0x85, 0x94, 0x07, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a,
+    0xb8, 0x8d, 0xbb, 0x80, 0x04, 0x9b, 0x59, 0xb9, 0x8b, 0xd7, 0xb8, 0xbc,
+    0xb9, 0xbc, 0x89, 0x62, 0x2b, 0xc2, 0xc2, 0x8c, 0x99, 0x2c, 0x3c, 0x79,
+    0x93, 0xe3, 0x3c, 0x28, 0xe7, 0x32, 0xee, 0x32, 0x3c, 0x9e, 0xa3, 0x3e,
+    0x33, 0xf0, 0x9e, 0x09, 0xae, 0x4d, 0x11, 0xef, 0x93, 0x6e, 0xe3, 0x11,
+    0xf3, 0xae, 0x23, 0xe3, 0x8e, 0x93, 0x9e, 0x23, 0x3e, 0x93, 0x2e, 0x3e,
+    0x93, 0x9e, 0x93, 0x5e, 0x3e, 0x33, 0x28, 0xe0, 0x79, 0x3f, 0xce, 0xc2,
+    0xe9, 0x34, 0xc2, 0x9c, 0xd7, 0xc9, 0xcc, 0x29, 0x2c, 0x79, 0x9c, 0x9b,
+    0xc2, 0x30, 0x52, 0xbb, 0x98, 0x97, 0x29, 0xb8, 0x8b, 0xc9, 0x7b, 0xb8,
+    0x94, 0x11, 0x6a, 0x70, 0xf9, 0x51, 0x45, 0xc4, 0x35, 0x54, 0x7b, 0x10,
+    0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0xb8, 0x8c, 0x4b, 0xd0, 0x04,
+    0x9b, 0x69, 0x89, 0xbb, 0xcb, 0x78, 0x9b, 0xb9, 0x2d, 0x29, 0x98, 0xc7,
+    0x99, 0x3c, 0x32, 0x9e, 0x43, 0xcc, 0x83, 0x9e, 0x39, 0x3e, 0x9a, 0x37,
+    0xc3, 0xe9, 0xee, 0x3e, 0x73, 0x3e, 0x3e, 0x33, 0xe0, 0x33, 0xee, 0x27,
+    0xee, 0x3e, 0x31, 0x1f, 0x8e, 0x83, 0x6e, 0x3c, 0x11, 0xd3, 0xce, 0x23,
+    0x3e, 0x83, 0xae, 0x72, 0xe3, 0xee, 0x93, 0xe8, 0x3c, 0xe0, 0x28, 0xe6,
+    0x3e, 0x93, 0xe3, 0xe0, 0x63, 0x3e, 0x2e, 0xe9, 0x8c, 0x63, 0xc3, 0x23,
+    0x3e, 0x92, 0x63, 0x99, 0x2e, 0x29, 0x82, 0x8c, 0x82, 0x92, 0x29, 0x9c,
+    0x7b, 0xdb, 0x4b, 0xbc, 0xb7, 0x59, 0xb4, 0x41, 0x16, 0xa7, 0xa6, 0x81,
+    0xf1, 0x06, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0xb8, 0x9b, 0x00,
+    0x8b, 0x19, 0xc8, 0x97, 0xb8, 0xb2, 0xb9, 0xb9, 0x8b, 0x7c, 0x92, 0xd2,
+    0x92, 0x98, 0x27, 0xe2, 0x23, 0x29, 0x2e, 0x42, 0xdd, 0x9c, 0x9e, 0x22,
+    0x3e, 0x72, 0x3e, 0xe3, 0xe9, 0xe7, 0xc3, 0xf3, 0xe2, 0x3e, 0x93, 0x1e,
+    0x30, 0x02, 0xae, 0x33, 0x3e, 0x37, 0xf1, 0x1d, 0x3e, 0xd3, 0x7e, 0xf1,
+    0x1e, 0x3e, 0x39, 0xe3, 0x33, 0xe3, 0x63, 0x3f, 0x3e, 0xe2, 0xae, 0x33,
+    0x3e, 0x39, 0xe3, 0x3e, 0xce, 0x72, 0xcf, 0xee, 0x23, 0xf8, 0x30, 0x73,
+    0xec, 0x2e, 0x23, 0xe7, 0x33, 0xc9, 0x3e, 0x32, 0x7c, 0x39, 0x3c, 0x93,
+    0xea, 0x93, 0x22, 0xcb, 0x19, 0xc9, 0x90, 0xc7, 0x8d, 0xb8, 0xbc, 0xcb,
+    0x78, 0x92, 0xa4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x27, 0xc4, 0x9b, 0x0a, 0x88, 0x79, 0x28, 0x8b, 0x9c,
+    0x99, 0x20, 0xb7, 0xc8, 0xcc, 0x9c, 0xc9, 0x82, 0x79, 0x2c, 0x99, 0xc2,
+    0xc8, 0x30, 0x52, 0x2d, 0x22, 0xe7, 0x23, 0x3e, 0x29, 0xec, 0x83, 0x9e,
+    0x12, 0xc9, 0xe7, 0x93, 0xee, 0x3e, 0xe3, 0x0e, 0x83, 0x6e, 0xe3, 0x3e,
+    0xef, 0xf1, 0x51, 0xfe, 0x33, 0xeb, 0x31, 0xe3, 0x0e, 0x73, 0xe3, 0xef,
+    0x33, 0xe7, 0x33, 0xee, 0x33, 0xec, 0x93, 0x2e, 0xe2, 0xae, 0x42, 0x2e,
+    0xe3, 0x93, 0x3e, 0xc9, 0xe9, 0x35, 0xe3, 0xe2, 0xc3, 0x7c, 0x3c, 0x93,
+    0x39, 0xd7, 0x39, 0xc2, 0x92, 0xc8, 0x59, 0x29, 0xcb, 0xc7, 0x8b, 0xd8,
+    0xbd, 0x89, 0x72, 0xb8, 0x94, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x79, 0x89, 0xb8, 0xb8, 0xb0, 0x72,
+    0x89, 0x98, 0x2c, 0x97, 0xbc, 0xb2, 0x99, 0xbc, 0x79, 0x2c, 0x89, 0xc3,
+    0x27, 0x92, 0xc3, 0x9e, 0xd9, 0x4e, 0x22, 0xec, 0x82, 0x8e, 0x62, 0x23,
+    0xee, 0xc9, 0x9e, 0x69, 0x33, 0xee, 0x3e, 0x93, 0x2e, 0xe3, 0x1e, 0x38,
+    0xe6, 0x3e, 0xe3, 0xee, 0xff, 0x18, 0xe7, 0x3e, 0x3e, 0xe3, 0x3e, 0x83,
+    0x3e, 0xf3, 0xe8, 0x38, 0xe8, 0x38, 0xe9, 0x37, 0xee, 0x33, 0xef, 0xe2,
+    0x83, 0x8e, 0x93, 0x1e, 0x30, 0x53, 0xe3, 0x32, 0xe7, 0x39, 0x3c, 0x2e,
+    0xe2, 0x7c, 0xc2, 0x39, 0x2c, 0x37, 0x2c, 0x39, 0x23, 0x32, 0x8b, 0x5c,
+    0x98, 0xcc, 0x87, 0xcb, 0xbd, 0xb8, 0x8c, 0x72, 0x88, 0x94, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b,
+    0x88, 0xb8, 0xa8, 0xc0, 0x5c, 0x88, 0xbb, 0x27, 0x9b, 0x9c, 0x8b, 0x9c,
+    0x89, 0x7c, 0x2c, 0x92, 0x92, 0x37, 0x9c, 0x32, 0x2c, 0xe9, 0x43, 0xd2,
+    0xce, 0x82, 0x8e, 0x69, 0xc3, 0x3e, 0x32, 0x9e, 0x5c, 0x3e, 0xe9, 0x39,
+    0xe3, 0x33, 0xe3, 0x33, 0x3f, 0xe8, 0x39, 0xe4, 0x33, 0xef, 0xda, 0xf0,
+    0xd8, 0xe6, 0x3e, 0xe3, 0xee, 0x39, 0xe0, 0x30, 0x5e, 0xf3, 0xee, 0x38,
+    0xe8, 0x36, 0xee, 0x3e, 0x33, 0xf8, 0x39, 0xe4, 0xc3, 0xec, 0x29, 0xe8,
+    0x30, 0x73, 0xee, 0x33, 0xfe, 0x27, 0x3c, 0xc3, 0x32, 0x3e, 0x92, 0x4e,
+    0x22, 0xc9, 0x7c, 0x2c, 0x2c, 0x29, 0xc0, 0x5c, 0x99, 0xdd, 0x87, 0xcd,
+    0x8d, 0xb8, 0x9d, 0x7b, 0x8b, 0x84, 0x11, 0x6a, 0x71, 0xf5, 0x84, 0x85,
+    0x94, 0x65, 0x44, 0x54, 0x57, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x17,
+    0xc8, 0x89, 0xa8, 0xb0, 0x4c, 0x8b, 0xc8, 0x99, 0x3c, 0xbb, 0x88, 0xc7,
+    0x29, 0xc2, 0x29, 0x3c, 0x89, 0x73, 0x32, 0x33, 0xec, 0x20, 0x19, 0xd8,
+    0xc7, 0x3e, 0xe2, 0xe3, 0xe9, 0x8e, 0x72, 0xec, 0x33, 0xe3, 0xea, 0x38,
+    0xea, 0x30, 0x03, 0x9e, 0x03, 0x8e, 0x93, 0x9e, 0x83, 0x9e, 0x33, 0xee,
+    0x39, 0xe8, 0x39, 0xe1, 0x3e, 0x5e, 0xe3, 0xee, 0x3a, 0xea, 0x32, 0x2e,
+    0xf7, 0x3e, 0xe3, 0xee, 0x3e, 0xa3, 0x2f, 0xe3, 0x2c, 0x3e, 0x73, 0xe3,
+    0xe3, 0xce, 0x29, 0x30, 0xe7, 0x32, 0x9e, 0xe2, 0x9c, 0x82, 0x69, 0xe2,
+    0x92, 0xc2, 0x42, 0xb2, 0xc2, 0x89, 0x6c, 0x8c, 0x8d, 0xb8, 0x72, 0xbb,
+    0x84, 0x11, 0x6a, 0x73, 0xf5, 0x45, 0x84, 0x05, 0x84, 0x95, 0x34, 0x45,
+    0x7b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x8b, 0x98, 0x2a, 0xd8,
+    0x6c, 0x88, 0xb9, 0x9b, 0x79, 0x2b, 0x29, 0xc2, 0xc7, 0x82, 0xdb, 0x22,
+    0xc2, 0x93, 0x52, 0x23, 0xc3, 0x90, 0x53, 0xcc, 0x33, 0xc7, 0xe9, 0x2e,
+    0xe9, 0x3e, 0x72, 0xee, 0x2e, 0xe3, 0xea, 0x39, 0xe0, 0xc8, 0x30, 0x33,
+    0xf3, 0xe7, 0x33, 0xe3, 0x3e, 0x3e, 0xff, 0x33, 0xe3, 0xe8, 0x3b, 0xe0,
+    0x3e, 0x3e, 0x3b, 0xe9, 0x38, 0xe6, 0x2e, 0xe3, 0xee, 0x27, 0xee, 0x3e,
+    0xe3, 0x23, 0x9e, 0xa3, 0x2e, 0x3e, 0x93, 0x52, 0xc3, 0xc3, 0xc7, 0x39,
+    0xce, 0xc9, 0xce, 0x79, 0xcc, 0x99, 0x2c, 0x20, 0x39, 0x23, 0x29, 0x96,
+    0xcb, 0x99, 0x2b, 0x87, 0xbc, 0xb4, 0x41, 0x16, 0xa7, 0x3f, 0x51, 0x68,
+    0x10, 0x3f, 0x5f, 0x6b, 0x10, 0x6b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2,
+    0x37, 0x9b, 0x8b, 0xb0, 0x6b, 0xb8, 0xa9, 0x29, 0x72, 0x9c, 0xc9, 0x9c,
+    0x28, 0x96, 0xdc, 0x22, 0x93, 0xe7, 0xcc, 0x22, 0xee, 0x93, 0x0c, 0x72,
+    0xe9, 0xee, 0xc2, 0x98, 0xe8, 0x37, 0xe3, 0x3e, 0x2e, 0xe3, 0x9e, 0x13,
+    0xe8, 0x3a, 0xe0, 0xbe, 0x43, 0xe3, 0xe3, 0x81, 0xf1, 0x6f, 0xee, 0x3e,
+    0xe3, 0xae, 0x0e, 0x83, 0x9e, 0x03, 0x9e, 0x83, 0x9e, 0x63, 0xe3, 0xee,
+    0x3e, 0x93, 0x6e, 0x33, 0xee, 0x3e, 0x73, 0xe3, 0xe3, 0xee, 0x37, 0x23,
+    0x3e, 0x3c, 0x2d, 0x7e, 0x93, 0xe3, 0x29, 0xe7, 0x92, 0x99, 0xcc, 0xbc,
+    0x39, 0x2e, 0xca, 0x94, 0xd8, 0xcc, 0xb8, 0x86, 0xbc, 0x84, 0x11, 0x6a,
+    0x73, 0xf5, 0x67, 0x86, 0x31, 0x41, 0x78, 0x1f, 0x10, 0xb0, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x78, 0xbc, 0xb9, 0xa8, 0xc0, 0x1b, 0xc9, 0x87, 0xc9,
+    0x29, 0xcc, 0x9b, 0x7c, 0x8c, 0x2c, 0xc2, 0x9b, 0x25, 0x39, 0xe3, 0x32,
+    0x93, 0x72, 0xee, 0x3e, 0x32, 0xc8, 0xe8, 0x39, 0xe8, 0x37, 0x2e, 0x3e,
+    0x3e, 0xe3, 0xae, 0x1e, 0xc9, 0xe9, 0x31, 0xef, 0x81, 0xf1, 0x4f, 0x33,
+    0xe3, 0xbe, 0x0f, 0x0e, 0x93, 0x0e, 0x73, 0x3e, 0xe3, 0xee, 0x3a, 0xe0,
+    0x3b, 0xe0, 0x37, 0xec, 0xe3, 0xee, 0x2e, 0x4e, 0x3e, 0xc3, 0x9e, 0x62,
+    0x33, 0xe3, 0xe2, 0x8e, 0x69, 0x3e, 0x9e, 0xbd, 0x8c, 0x92, 0x09, 0x82,
+    0x4c, 0x9c, 0x29, 0x72, 0x9b, 0x99, 0x22, 0x98, 0xb6, 0x8b, 0xc4, 0x11,
+    0x6a, 0x73, 0xf5, 0x67, 0x86, 0x31, 0x51, 0x78, 0x1f, 0x10, 0xb0, 0x07,
+    0xa2, 0xf2, 0xf2, 0x07, 0x74, 0x8c, 0x88, 0xbb, 0x90, 0x09, 0xab, 0x02,
+    0x99, 0x0c, 0x99, 0x1c, 0x99, 0xc1, 0xd2, 0x9c, 0x09, 0x72, 0x9e, 0x3c,
+    0xc2, 0xe0, 0x93, 0x1e, 0xc9, 0x35, 0xec, 0x23, 0x3c, 0x7e, 0xc3, 0xe3,
+    0xe3, 0xe7, 0x9e, 0x3e, 0xe2, 0x3e, 0x83, 0xce, 0x63, 0x3e, 0x11, 0xfe,
+    0xed, 0x7f, 0xe3, 0xee, 0x3e, 0x39, 0xe0, 0x1e, 0x39, 0xe0, 0x3a, 0xe5,
+    0x3e, 0xe3, 0xe3, 0x8e, 0x83, 0x7e, 0xef, 0xed, 0x9e, 0x38, 0xe8, 0x30,
+    0x2e, 0x3c, 0x7e, 0xe3, 0x3c, 0xee, 0xcc, 0x31, 0x23, 0x7c, 0x9c, 0x2c,
+    0xe2, 0x98, 0xc9, 0x90, 0x1c, 0xb7, 0xc2, 0xb2, 0x29, 0xbc, 0xa9, 0x7c,
+    0x88, 0xb4, 0x11, 0x6a, 0x73, 0xf4, 0x67, 0x86, 0x31, 0x51, 0x78, 0x1f,
+    0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0x8b, 0xab, 0xbd, 0x80,
+    0x18, 0x99, 0xb2, 0xab, 0x98, 0xb9, 0x92, 0x2c, 0x97, 0x2c, 0xc9, 0xdb,
+    0x23, 0x79, 0x9c, 0xcd, 0xcc, 0xd0, 0x72, 0x2e, 0xe9, 0x3c, 0x38, 0xe8,
+    0x38, 0xeb, 0x32, 0xe3, 0xf8, 0x39, 0xe4, 0x33, 0xe3, 0xe0, 0x1e, 0xfa,
+    0x32, 0xee, 0x38, 0x1b, 0x39, 0xe3, 0x3e, 0xe3, 0xae, 0x43, 0x3e, 0x3f,
+    0x9e, 0x73, 0x3e, 0xe3, 0x3e, 0x3d, 0xe0, 0x3c, 0xe0, 0xca, 0xe8, 0x30,
+    0x6e, 0xe3, 0xee, 0x29, 0xa3, 0x02, 0xb3, 0x22, 0x2e, 0x73, 0x2c, 0xc3,
+    0x9c, 0x98, 0x38, 0x90, 0x5c, 0x9e, 0x92, 0xc7, 0x99, 0xcc, 0x8b, 0xc9,
+    0x72, 0x9a, 0x94, 0x11, 0x6a, 0x73, 0xf5, 0x67, 0x86, 0x31, 0x51, 0x78,
+    0x1f, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0xbb, 0x8a, 0xc8, 0x8b,
+    0x78, 0x9c, 0xc8, 0xb9, 0xb7, 0xc2, 0x9c, 0x92, 0x28, 0x7c, 0xc2, 0xcd,
+    0x82, 0xe7, 0x93, 0x2e, 0xe2, 0xec, 0x52, 0x3e, 0x29, 0x37, 0xe3, 0x2e,
+    0xe3, 0x2e, 0x73, 0xee, 0x33, 0xe3, 0xe7, 0x33, 0xee, 0x3e, 0xe3, 0x8e,
+    0x73, 0xee, 0x33, 0xee, 0x37, 0xe1, 0x1e, 0x33, 0xe3, 0x8e, 0x63, 0xee,
+    0x3e, 0xe3, 0x8e, 0x93, 0x8f, 0x53, 0xee, 0x33, 0xe8, 0x39, 0xe1, 0x3e,
+    0xa3, 0x9e, 0x83, 0x9e, 0xb3, 0x8e, 0x03, 0x8e, 0x93, 0x09, 0x7e, 0xe3,
+    0x93, 0x23, 0xe9, 0x35, 0x23, 0x39, 0xdc, 0x72, 0xcc, 0x93, 0xcb, 0x20,
+    0x59, 0xce, 0x9c, 0xa7, 0x92, 0xc9, 0x8b, 0xc2, 0xab, 0x34, 0x11, 0x6a,
+    0x78, 0x68, 0x78, 0x60, 0x16, 0x18, 0x68, 0x1f, 0x10, 0xb0, 0x07, 0xa2,
+    0xf2, 0xf2, 0x47, 0xdb, 0x8b, 0x88, 0x8b, 0x78, 0x99, 0xdb, 0x88, 0x97,
+    0xc2, 0x9c, 0x99, 0x29, 0x7d, 0xeb, 0x2c, 0x99, 0x37, 0xc9, 0x9c, 0x3d,
+    0x29, 0x3c, 0xed, 0x27, 0xc2, 0xce, 0x2e, 0x3e, 0xa3, 0x5e, 0x33, 0xee,
+    0x38, 0xe7, 0x3e, 0x3e, 0xe3, 0xe3, 0x13, 0xe9, 0x36, 0xef, 0xed, 0x11,
+    0xe8, 0x38, 0xe9, 0x32, 0xfe, 0x39, 0xe0, 0x3c, 0xe0, 0x2f, 0xe3, 0x8e,
+    0x7f, 0x3e, 0x3e, 0xe3, 0xe9, 0x30, 0xe8, 0x36, 0xe3, 0xee, 0x33, 0xea,
+    0x31, 0xfe, 0x23, 0xec, 0x73, 0xec, 0x93, 0x3f, 0x38, 0x98, 0xe8, 0x36,
+    0xe3, 0x32, 0x9d, 0xc7, 0x2c, 0x39, 0x2c, 0xc9, 0x52, 0xc2, 0xe9, 0x87,
+    0x2c, 0xd8, 0xb8, 0xbc, 0x99, 0x4b, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0xab, 0x98, 0x2b, 0xc8, 0x58,
+    0x99, 0xdb, 0x87, 0x9b, 0x32, 0x92, 0x92, 0x79, 0x2c, 0x29, 0xc2, 0xc8,
+    0x27, 0x3c, 0xe9, 0xee, 0x9c, 0x73, 0x3e, 0x9e, 0xe3, 0xeb, 0x33, 0xe3,
+    0x3e, 0x83, 0x7e, 0x33, 0xe3, 0xee, 0x38, 0xe9, 0x30, 0x8e, 0xa3, 0x0f,
+    0x73, 0xd1, 0x1e, 0xe3, 0xe9, 0x39, 0xe1, 0x3e, 0xa3, 0x9e, 0x13, 0xf0,
+    0x1e, 0x38, 0xe6, 0x3e, 0x3e, 0x33, 0xeb, 0x34, 0xe3, 0xee, 0x38, 0xe6,
+    0x33, 0xe3, 0xee, 0x38, 0xe0, 0x63, 0xc3, 0x3e, 0x39, 0x7c, 0x3f, 0x22,
+    0x33, 0xeb, 0x33, 0x23, 0xe9, 0x72, 0x32, 0xc9, 0xcb, 0xc0, 0x2c, 0x9d,
+    0x7c, 0x8c, 0x92, 0xc9, 0xc9, 0x97, 0xb9, 0xbb, 0x41, 0x16, 0xd7, 0x96,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0x8d, 0xa8,
+    0xbc, 0x90, 0x6b, 0x8b, 0xd8, 0xb9, 0x7b, 0x22, 0xb2, 0x2c, 0x97, 0xc2,
+    0x92, 0x3c, 0xc3, 0x82, 0x6c, 0x22, 0xf3, 0x2c, 0x0c, 0x83, 0x69, 0x3e,
+    0xc3, 0xec, 0xa3, 0x9e, 0xa3, 0x5e, 0xe3, 0x3e, 0x39, 0xe8, 0x30, 0x8e,
+    0x93, 0x7e, 0xf3, 0xd1, 0x13, 0xe8, 0x37, 0xee, 0x3e, 0xe3, 0xe3, 0x9e,
+    0x53, 0xee, 0x3e, 0xf0, 0x83, 0x6e, 0xe3, 0xe3, 0xef, 0x9e, 0xa3, 0x9e,
+    0xb3, 0x8e, 0xb3, 0x0e, 0x6e, 0x39, 0xee, 0x3e, 0x72, 0xee, 0x2c, 0x3e,
+    0x37, 0xc3, 0xc3, 0xc2, 0xe2, 0x89, 0x6e, 0x23, 0xc2, 0xbc, 0x59, 0xcd,
+    0x99, 0xb7, 0x99, 0x28, 0xbc, 0xb9, 0x72, 0xb9, 0x84, 0x11, 0x6a, 0x70,
+    0x1b, 0xd0, 0xfd, 0x07, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78,
+    0xbb, 0xa8, 0x9b, 0x80, 0x4b, 0x9c, 0xc8, 0x8b, 0x6c, 0x22, 0x9c, 0x23,
+    0x72, 0xb2, 0x92, 0x32, 0x98, 0x37, 0x2e, 0x92, 0xde, 0x32, 0x5e, 0x33,
+    0x2e, 0xd8, 0x2c, 0x32, 0xec, 0xe9, 0x37, 0xee, 0x33, 0xe3, 0xe3, 0x8e,
+    0x83, 0x8e, 0x93, 0x6e, 0xe3, 0xd1, 0x1e, 0x83, 0xae, 0x93, 0x9e, 0x73,
+    0xee, 0x3e, 0x33, 0xf0, 0x0e, 0x73, 0x3e, 0x33, 0xef, 0xe8, 0x39, 0xe3,
+    0x3e, 0xe3, 0x8e, 0xa3, 0x7e, 0x33, 0xe3, 0xe3, 0xe0, 0x3e, 0x33, 0xe8,
+    0x37, 0xe3, 0xec, 0x2e, 0x3e, 0x73, 0xc3, 0xe3, 0xe3, 0xc9, 0x26, 0xc2,
+    0x9e, 0x22, 0xc0, 0x39, 0xbd, 0xb8, 0x96, 0xc2, 0x29, 0xcd, 0x8b, 0x93,
+    0x41, 0x16, 0xa7, 0x1f, 0x59, 0x40, 0x50, 0x05, 0x84, 0xb5, 0x14, 0x7b,
+    0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x4d, 0x9b, 0x2c, 0xb9, 0x0b,
+    0x79, 0xc9, 0x98, 0xc2, 0x99, 0x20, 0x97, 0xc2, 0xb2, 0x9e, 0xc2, 0x7c,
+    0x2e, 0x2c, 0x29, 0xd9, 0x30, 0x0e, 0x73, 0x22, 0xee, 0x2e, 0x99, 0x38,
+    0xe6, 0x3c, 0xe3, 0xe3, 0xe7, 0x3e, 0x33, 0xe3, 0x3f, 0x9e, 0x9e, 0x03,
+    0x9e, 0x53, 0xd1, 0x13, 0xe9, 0x38, 0xe9, 0x38, 0xe8, 0x3d, 0xe0, 0x1e,
+    0x39, 0xe5, 0x33, 0xfe, 0x3e, 0x83, 0xae, 0x63, 0xee, 0x3e, 0x3e, 0x93,
+    0x9e, 0x12, 0xd0, 0x03, 0x9e, 0x33, 0x3e, 0x37, 0xe3, 0x23, 0xe3, 0x3c,
+    0x93, 0x6e, 0x3c, 0x22, 0xec, 0x92, 0x2c, 0x2c, 0x5b, 0xbe, 0x92, 0x97,
+    0xc2, 0x99, 0xdc, 0x8b, 0x78, 0x89, 0xc4, 0x11, 0x6a, 0x70, 0x6b, 0xf0,
+    0xff, 0x06, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0xac, 0xbb,
+    0xc8, 0xc0, 0x02, 0x99, 0x0c, 0x8b, 0x69, 0xbc, 0xc9, 0x92, 0x79, 0xc9,
+    0x93, 0xe2, 0x97, 0x2c, 0x23, 0x93, 0x32, 0x83, 0x83, 0x72, 0x3e, 0x33,
+    0xe9, 0x38, 0xe9, 0x37, 0xee, 0x3e, 0xe3, 0x3e, 0x83, 0x6e, 0xe3, 0xee,
+    0x3e, 0x0e, 0x73, 0xe3, 0xe3, 0x3e, 0xd8, 0x19, 0xe2, 0x33, 0xeb, 0x3a,
+    0xe1, 0x3e, 0x93, 0x0e, 0x03, 0x9e, 0x93, 0xae, 0x83, 0x7e, 0xe3, 0xe3,
+    0xef, 0x38, 0xe8, 0x36, 0xee, 0x3e, 0x32, 0xe0, 0x4e, 0x2d, 0xe3, 0x8e,
+    0x93, 0x7e, 0x3c, 0x23, 0xec, 0x37, 0x2c, 0x9e, 0x22, 0x3e, 0xc2, 0x39,
+    0x22, 0x98, 0x26, 0xc2, 0x92, 0xcb, 0x28, 0xb6, 0x9c, 0xc4, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a,
+    0xab, 0x8b, 0xc8, 0xb0, 0x9b, 0x22, 0x29, 0x72, 0x99, 0xc2, 0x92, 0xc7,
+    0x22, 0x93, 0x3c, 0xc2, 0x7e, 0x29, 0x29, 0x32, 0xe8, 0x30, 0x93, 0x2c,
+    0x39, 0x7e, 0xec, 0x23, 0xe3, 0xe8, 0x37, 0xe3, 0x3e, 0x3e, 0x3e, 0x73,
+    0xef, 0x3e, 0xe3, 0xe0, 0x9e, 0x23, 0xe3, 0x8e, 0x6d, 0x11, 0x3e, 0xe3,
+    0x8e, 0x93, 0x1e, 0x37, 0xee, 0x3e, 0x33, 0xe3, 0x8e, 0xae, 0x03, 0x9e,
+    0x03, 0x9e, 0x73, 0xee, 0x3e, 0xe3, 0xe8, 0x38, 0xe9, 0x34, 0xee, 0xf3,
+    0xe0, 0x0e, 0x73, 0xee, 0x3e, 0x3e, 0x38, 0xe9, 0x34, 0x2e, 0x32, 0x37,
+    0xe9, 0x22, 0xc2, 0xc9, 0x8c, 0x92, 0xa2, 0x09, 0x82, 0x6c, 0x92, 0xbb,
+    0xcb, 0x7d, 0x82, 0xc4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0xbb, 0x48, 0xb9, 0xb0, 0x68, 0xc9,
+    0x29, 0x9b, 0x7c, 0x99, 0x22, 0xc2, 0x87, 0xd9, 0xcd, 0x22, 0x9e, 0x82,
+    0x69, 0xc3, 0x2c, 0x3e, 0x63, 0xe2, 0xe3, 0x3e, 0x73, 0xe2, 0xee, 0x33,
+    0xe8, 0x3a, 0xe5, 0x33, 0xe3, 0xef, 0x8e, 0x93, 0x83, 0x9e, 0x03, 0x7e,
+    0x3b, 0x11, 0x33, 0xe7, 0x3e, 0x33, 0xf3, 0xef, 0x7e, 0x3e, 0xfe, 0xe3,
+    0xe8, 0x30, 0xee, 0x43, 0xe3, 0xe3, 0xbe, 0x83, 0x8e, 0xc3, 0x3e, 0xf3,
+    0xe0, 0x33, 0x2c, 0xe9, 0x31, 0xec, 0x93, 0x8e, 0xa3, 0x4e, 0x2c, 0xeb,
+    0x8e, 0x62, 0x93, 0xc9, 0x92, 0x1c, 0x38, 0x97, 0xcc, 0x22, 0x9c, 0xb9,
+    0x8b, 0x7c, 0x5c, 0xc4, 0x11, 0x6d, 0x72, 0x66, 0x10, 0x9f, 0x11, 0x6f,
+    0x11, 0x1b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0x8b, 0x98, 0x92, 0x80,
+    0x18, 0xc9, 0x90, 0x29, 0xb5, 0x99, 0xc2, 0x2b, 0x7e, 0x82, 0xd2, 0x92,
+    0x38, 0x26, 0x9e, 0x32, 0x2e, 0xc0, 0x23, 0x3e, 0x73, 0x23, 0x3e, 0xe2,
+    0xe9, 0x33, 0xee, 0x23, 0x9e, 0x33, 0xee, 0x39, 0xe3, 0x3e, 0xe3, 0x5e,
+    0xe3, 0x3e, 0x39, 0xe3, 0x11, 0xd3, 0xbe, 0x1f, 0x39, 0xe0, 0x3a, 0xe1,
+    0x3e, 0x83, 0x9e, 0x03, 0xbe, 0x63, 0xee, 0x3e, 0x3e, 0x73, 0xee, 0x33,
+    0xe3, 0xe7, 0x3e, 0xe3, 0xee, 0x3e, 0x7e, 0x33, 0xee, 0x33, 0xeb, 0x34,
+    0xe2, 0x33, 0xea, 0xc1, 0x2e, 0x7c, 0x29, 0x32, 0xcb, 0x20, 0x5c, 0x2b,
+    0x9e, 0xb9, 0xc3, 0xb9, 0x29, 0x8c, 0x68, 0xb9, 0x41, 0x16, 0xd7, 0x01,
+    0x85, 0x65, 0x44, 0x54, 0xd6, 0xe1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67,
+    0x98, 0x8c, 0x9b, 0x89, 0x0c, 0x99, 0x32, 0x29, 0x27, 0x99, 0xcc, 0x8c,
+    0xcb, 0x79, 0xec, 0x93, 0xe9, 0x27, 0xc9, 0x2c, 0xe2, 0xec, 0x63, 0x3d,
+    0xe2, 0x93, 0x8e, 0x63, 0xee, 0x3e, 0x3e, 0x83, 0x6e, 0x3e, 0x33, 0xf3,
+    0x8e, 0x93, 0x8e, 0xae, 0x93, 0x8e, 0x6f, 0x11, 0xf1, 0x1f, 0x91, 0x4f,
+    0x1d, 0xe3, 0x7e, 0x3e, 0xe3, 0x3e, 0xf0, 0x03, 0x9e, 0x23, 0xfe, 0x93,
+    0x3e, 0xf3, 0xe8, 0x3a, 0xe1, 0x3e, 0x73, 0xe3, 0x3e, 0x33, 0xe8, 0x30,
+    0x6e, 0xe3, 0x3e, 0x3e, 0xc3, 0x2e, 0x32, 0x7e, 0xe9, 0xec, 0x22, 0xd7,
+    0x22, 0x3c, 0x93, 0xc9, 0x52, 0xcd, 0x9c, 0xb7, 0x22, 0xdb, 0x89, 0x9d,
+    0x7b, 0x8c, 0xb4, 0x11, 0x6c, 0x73, 0xf4, 0x54, 0x6b, 0xdd, 0x54, 0x45,
+    0x86, 0xc1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x57, 0xbb, 0x8c, 0xb9, 0x90,
+    0x2c, 0x8b, 0x82, 0x79, 0xcb, 0xb8, 0xec, 0x88, 0xc6, 0x99, 0xc2, 0xd3,
+    0xc7, 0x92, 0xe2, 0x23, 0xd2, 0x83, 0x63, 0x3e, 0xe9, 0x23, 0x8e, 0x63,
+    0x3e, 0x3f, 0x23, 0x7e, 0x33, 0xee, 0x3e, 0x37, 0xe3, 0x3e, 0xe3, 0xe3,
+    0x93, 0x6e, 0xe3, 0xe3, 0xed, 0x81, 0xf1, 0x8f, 0x8e, 0x63, 0x3e, 0xe3,
+    0xef, 0x33, 0xee, 0x39, 0xe9, 0x37, 0xee, 0x3e, 0x33, 0xf3, 0x8e, 0x93,
+    0x2e, 0x3e, 0x83, 0xae, 0x13, 0xe9, 0x37, 0xee, 0x3e, 0xe3, 0x3e, 0x93,
+    0x7e, 0xe9, 0xdc, 0x29, 0xc7, 0x2c, 0x33, 0x92, 0x3b, 0x52, 0xcd, 0x82,
+    0xc7, 0x29, 0xcc, 0x89, 0xbc, 0x7b, 0x8c, 0xb4, 0x11, 0x6b, 0x74, 0x14,
+    0x5f, 0x60, 0x96, 0x51, 0x1b, 0x55, 0x7c, 0x10, 0xb0, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x7b, 0xc9, 0xb8, 0x99, 0x20, 0x0b, 0x79, 0xb9, 0x29, 0xcc,
+    0xb7, 0x92, 0xc2, 0xc2, 0x2b, 0x9c, 0x22, 0x2c, 0x92, 0x5e, 0xec, 0x23,
+    0xe0, 0x73, 0x3e, 0xe3, 0xe3, 0xc9, 0x35, 0xe3, 0xe3, 0x3e, 0xb3, 0x5f,
+    0x2e, 0xe3, 0xf9, 0xe0, 0x30, 0x83, 0x8e, 0x63, 0xe3, 0xe3, 0xef, 0xf1,
+    0x11, 0xfa, 0xe5, 0x3e, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0xe9, 0x38, 0xe6,
+    0x33, 0xe3, 0xee, 0x37, 0xef, 0x9e, 0xe2, 0xfe, 0x8e, 0xe3, 0x7e, 0x3e,
+    0xc3, 0x3e, 0x39, 0xc2, 0x99, 0x27, 0xcc, 0x22, 0xc2, 0x29, 0x3e, 0x2c,
+    0x97, 0xbc, 0x29, 0xcb, 0x92, 0x99, 0x68, 0x8b, 0x41, 0x16, 0xb7, 0x45,
+    0x46, 0x76, 0xa6, 0x51, 0x1d, 0x5f, 0x7b, 0x10, 0xb0, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0xab, 0x38, 0xbb, 0x90, 0x9b, 0x79, 0x9b, 0x22, 0x9c, 0xb8,
+    0xc7, 0x92, 0xbc, 0xbc, 0x2c, 0x79, 0xe3, 0x99, 0xee, 0x99, 0x30, 0x1e,
+    0xc9, 0x32, 0xec, 0x37, 0x2e, 0x33, 0xee, 0x32, 0xb3, 0x2e, 0xe3, 0x7e,
+    0xe3, 0xe3, 0xe3, 0xe0, 0x8e, 0x83, 0xae, 0x33, 0xee, 0x3a, 0xe4, 0x3e,
+    0x3e, 0x39, 0xe3, 0x3e, 0xe3, 0xae, 0x1e, 0x39, 0xe0, 0x39, 0xe9, 0x34,
+    0xe3, 0xe3, 0xe8, 0x39, 0xe0, 0x39, 0xe3, 0x3e, 0xe3, 0x8e, 0x0e, 0x83,
+    0x8e, 0xa3, 0x3e, 0x33, 0xe7, 0xc3, 0xe2, 0xe3, 0x23, 0xcc, 0x42, 0xc9,
+    0x92, 0x1e, 0xc7, 0x92, 0x9c, 0xc9, 0x29, 0x8c, 0x89, 0x78, 0xc9, 0x94,
+    0x11, 0x6a, 0x73, 0x14, 0xf7, 0x86, 0x96, 0xa1, 0x24, 0x57, 0xb1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x17, 0x8a, 0xb2, 0x8c, 0x80, 0x19, 0xc7, 0x89,
+    0x23, 0x98, 0x9e, 0x7b, 0x2c, 0x9c, 0x9c, 0x29, 0xc0, 0x27, 0xc2, 0xe9,
+    0x23, 0x2e, 0x83, 0x0e, 0x93, 0x6e, 0xe3, 0xe2, 0xde, 0x73, 0xee, 0x3e,
+    0x3e, 0x39, 0xe0, 0x39, 0xe8, 0x3a, 0xe0, 0x53, 0xe3, 0x3e, 0x39, 0xe8,
+    0x3d, 0xe2, 0x3e, 0x3b, 0xe5, 0x3e, 0xe3, 0xf3, 0xae, 0x93, 0x7e, 0xe3,
+    0xe3, 0xfe, 0x39, 0xe3, 0x3e, 0xe3, 0x8e, 0x83, 0x9e, 0x23, 0x3e, 0x03,
+    0x7e, 0x33, 0xe3, 0x3e, 0x29, 0xe1, 0x32, 0x73, 0xe3, 0x3c, 0xc3, 0x98,
+    0xc7, 0x3e, 0x2c, 0x99, 0xec, 0x39, 0xc9, 0xc8, 0x27, 0xc9, 0xb9, 0xcc,
+    0x92, 0x78, 0xdb, 0x84, 0x11, 0x6a, 0x71, 0xf5, 0x87, 0x86, 0x96, 0xa1,
+    0x2b, 0x47, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0xaa, 0xcb,
+    0x89, 0xb0, 0x5b, 0xc8, 0x9e, 0x29, 0x95, 0xc9, 0x93, 0xc2, 0x89, 0x6c,
+    0x3c, 0x92, 0xc2, 0x7e, 0x22, 0x3d, 0x92, 0xe0, 0x1e, 0x29, 0x35, 0xe2,
+    0x3e, 0x3e, 0x93, 0x5e, 0xe3, 0x3e, 0x37, 0xe3, 0xe3, 0x3e, 0xe3, 0x9e,
+    0x03, 0x93, 0x2e, 0xe3, 0x81, 0xee, 0x4f, 0xfe, 0xef, 0xce, 0x4f, 0xe3,
+    0xef, 0x1e, 0x38, 0xe9, 0x36, 0xee, 0x3e, 0xe3, 0xe8, 0x39, 0xe8, 0x38,
+    0xe6, 0x33, 0xe3, 0x3e, 0x38, 0xe0, 0x13, 0xea, 0x38, 0xe7, 0x3c, 0xf3,
+    0x32, 0x3e, 0x7c, 0x3e, 0xe3, 0x22, 0xc7, 0x23, 0x23, 0x39, 0xd9, 0x69,
+    0xee, 0x99, 0xc2, 0x99, 0x3c, 0xc9, 0x2a, 0xb3, 0x41, 0x16, 0xa7, 0x2d,
+    0x47, 0x96, 0x06, 0x71, 0xf1, 0x61, 0x1d, 0x48, 0x6a, 0x10, 0xb0, 0x07,
+    0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0x8b, 0xc8, 0xb8, 0xc0, 0x9b, 0x49, 0x29,
+    0x2c, 0x79, 0x9c, 0x29, 0x39, 0xc7, 0x92, 0xcc, 0x29, 0xc2, 0x73, 0x92,
+    0xed, 0x99, 0x30, 0x03, 0x8e, 0x73, 0x3e, 0xce, 0xc3, 0xe8, 0x38, 0xea,
+    0x39, 0xe0, 0xf8, 0x39, 0xe3, 0x3e, 0xe3, 0x0e, 0x73, 0xe3, 0xef, 0x11,
+    0xf9, 0x1f, 0x10, 0xf8, 0xe7, 0x3e, 0x3e, 0xe3, 0xef, 0x6e, 0x3e, 0x3e,
+    0xe3, 0xbe, 0x33, 0xee, 0x3a, 0xe8, 0x3a, 0xe9, 0x32, 0xee, 0x30, 0x4e,
+    0xe3, 0xe2, 0x8e, 0xc3, 0x3e, 0x2c, 0xe9, 0x33, 0x2c, 0x93, 0x7c, 0xe3,
+    0x9e, 0x22, 0x90, 0x52, 0xee, 0x99, 0x27, 0x9c, 0xcb, 0x9c, 0x9c, 0x79,
+    0xb2, 0x94, 0x11, 0x6a, 0x72, 0xd5, 0x79, 0x60, 0x06, 0x71, 0x41, 0x71,
+    0x1d, 0x58, 0x6a, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0xb5, 0xab,
+    0x19, 0xc0, 0x59, 0xbb, 0xcb, 0x88, 0xc8, 0x99, 0x22, 0x92, 0xc9, 0x94,
+    0xe2, 0x33, 0x27, 0xe3, 0x23, 0x22, 0xec, 0x09, 0x8e, 0x93, 0x0e, 0x83,
+    0x7e, 0xce, 0x3e, 0xe3, 0xe8, 0x3a, 0xe0, 0x37, 0xe3, 0xee, 0xc3, 0xfe,
+    0x83, 0x6e, 0xe3, 0xf1, 0x1d, 0x91, 0xf1, 0x4f, 0xe3, 0xe3, 0x9e, 0x93,
+    0x7e, 0xf3, 0x3f, 0xe3, 0xe7, 0x33, 0xe3, 0xe3, 0xe3, 0xbe, 0x03, 0xae,
+    0x53, 0xe3, 0xee, 0x30, 0x8e, 0x83, 0x9e, 0x43, 0xee, 0x39, 0x8e, 0x73,
+    0x3c, 0x23, 0x22, 0xe9, 0x36, 0xe2, 0xcc, 0x2e, 0x20, 0x19, 0x28, 0x97,
+    0xd9, 0x9c, 0x22, 0xbc, 0x8b, 0x79, 0xcb, 0x24, 0x11, 0x6a, 0x71, 0xd4,
+    0x87, 0x86, 0x16, 0x17, 0x51, 0x71, 0x1b, 0x47, 0xb1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x78, 0xad, 0x98, 0x8c, 0xb0, 0x99, 0x92, 0x2b, 0xbe,
+    0xc9, 0x6c, 0x29, 0x3c, 0x9c, 0x82, 0x7d, 0xe9, 0x22, 0xed, 0x90, 0x93,
+    0x0e, 0x7d, 0x2c, 0xee, 0x3c, 0xea, 0x31, 0xef, 0x73, 0xe3, 0xee, 0x33,
+    0xe9, 0x39, 0xe0, 0x03, 0x8e, 0x83, 0x6e, 0xfd, 0x3d, 0xdf, 0xcd, 0x5f,
+    0xdd, 0xee, 0x37, 0xf3, 0xef, 0xe3, 0x3e, 0x2e, 0xe3, 0x8e, 0x73, 0xee,
+    0x3e, 0x3e, 0x3b, 0xe5, 0x3e, 0xe3, 0xe3, 0x7e, 0xe3, 0x3e, 0x33, 0xe0,
+    0x4e, 0xe3, 0x3e, 0x93, 0x2e, 0x3e, 0x93, 0x1e, 0x2a, 0x31, 0x2d, 0x82,
+    0x73, 0x39, 0xe9, 0xcd, 0xc0, 0x89, 0x6b, 0xcc, 0x82, 0x29, 0x8c, 0xab,
+    0x69, 0x9c, 0x41, 0x16, 0xa7, 0x3f, 0x51, 0x78, 0x60, 0x16, 0x17, 0x4f,
+    0x61, 0x15, 0x57, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x17, 0x88, 0xb9,
+    0x88, 0xb0, 0x58, 0xc2, 0x8b, 0xd7, 0xbb, 0xe9, 0x2c, 0x29, 0x83, 0x7b,
+    0x2e, 0x29, 0xe2, 0x97, 0x3e, 0x2e, 0x3e, 0x32, 0x83, 0x6c, 0xfe, 0x93,
+    0xcf, 0x83, 0x6e, 0x3e, 0x33, 0xef, 0x93, 0x7e, 0xf3, 0x3e, 0x33, 0xe9,
+    0x30, 0x3e, 0x3e, 0x3b, 0xe4, 0x33, 0xee, 0x37, 0xe3, 0x3e, 0xe3, 0xef,
+    0x83, 0x7e, 0xe3, 0xee, 0x3e, 0x30, 0x4e, 0xe3, 0xe3, 0x7e, 0xfe, 0x3e,
+    0xef, 0x3a, 0xe8, 0x38, 0xf9, 0x37, 0xfe, 0x33, 0xe3, 0x3e, 0x7e, 0x32,
+    0xee, 0x33, 0xe8, 0x38, 0xe7, 0x23, 0xe3, 0xce, 0x29, 0x8e, 0x79, 0xce,
+    0x22, 0xc2, 0x98, 0xc0, 0x32, 0xc2, 0xc8, 0xb6, 0xc9, 0x2d, 0x28, 0x98,
+    0xc6, 0x82, 0xb4, 0x11, 0x6a, 0x73, 0x65, 0xb7, 0x86, 0x26, 0x14, 0x85,
+    0x94, 0x1f, 0x7b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0xb8,
+    0xa8, 0xb8, 0x90, 0x52, 0xb2, 0x89, 0xc8, 0x9c, 0x20, 0xe8, 0x96, 0x2c,
+    0x29, 0xec, 0x97, 0x2e, 0x9d, 0x3c, 0x2c, 0x83, 0x8e, 0xa3, 0x1e, 0x27,
+    0xe3, 0xe3, 0x3e, 0xef, 0x93, 0x1e, 0xfb, 0x33, 0xe3, 0xe3, 0x1e, 0x3a,
+    0xe4, 0x33, 0xf3, 0xd9, 0xf5, 0xe3, 0x3e, 0xed, 0x8f, 0xae, 0x53, 0x3e,
+    0xef, 0x30, 0x3e, 0x3e, 0x39, 0xe5, 0x3e, 0x3e, 0xe3, 0xae, 0x43, 0xe3,
+    0xfe, 0x83, 0x8e, 0x83, 0xae, 0x93, 0x0e, 0x83, 0x8e, 0x93, 0x0e, 0xb3,
+    0x4e, 0x23, 0xe9, 0x83, 0x7d, 0x22, 0xe2, 0x92, 0xc0, 0x2c, 0xc2, 0x7c,
+    0x9d, 0xbb, 0xcc, 0x9a, 0xb6, 0x92, 0xb4, 0x11, 0x6b, 0x74, 0xd4, 0x17,
+    0x60, 0x26, 0x15, 0xa4, 0x05, 0x86, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x07, 0x79, 0xb8, 0x99, 0xb9, 0xb0, 0x4c, 0x92, 0x2b, 0x89, 0x62, 0x92,
+    0x99, 0xce, 0x89, 0x6c, 0x9e, 0xc2, 0xc9, 0x8c, 0x63, 0x2e, 0xe2, 0x2e,
+    0x03, 0x72, 0x3c, 0xee, 0x33, 0xe9, 0x35, 0xe3, 0xee, 0x3e, 0x93, 0x3e,
+    0xf3, 0xea, 0x39, 0xe0, 0x0e, 0x83, 0xae, 0x23, 0x3d, 0xb1, 0x0e, 0x7f,
+    0x33, 0xf1, 0xfe, 0x3a, 0xe3, 0x33, 0xfe, 0x33, 0xef, 0xe9, 0x30, 0xfb,
+    0xe3, 0x3e, 0xf3, 0x7e, 0xe3, 0xe3, 0xe3, 0xec, 0x30, 0xe0, 0x93, 0x5e,
+    0x3e, 0xe3, 0xeb, 0x31, 0x2e, 0x73, 0x3e, 0xe2, 0x2e, 0x27, 0xc3, 0x2e,
+    0xbc, 0xe2, 0x59, 0xd2, 0x9b, 0xda, 0x93, 0xc2, 0xb9, 0x7b, 0xb9, 0xb4,
+    0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x07, 0x79, 0xb8, 0x9b, 0x89, 0x20, 0x5b, 0x82, 0x92, 0x98, 0xca, 0x93,
+    0xcc, 0x29, 0xa2, 0x3c, 0xe9, 0xc7, 0xe2, 0x3c, 0xe9, 0xce, 0x93, 0x3e,
+    0xec, 0x99, 0xe3, 0x3e, 0xe2, 0x9e, 0x33, 0x3e, 0x3a, 0xea, 0x30, 0xe8,
+    0x30, 0x23, 0x3e, 0x83, 0x9e, 0x13, 0xfb, 0x16, 0xff, 0x3e, 0xf1, 0xf9,
+    0xe0, 0x39, 0xe2, 0x3f, 0xe0, 0x03, 0xae, 0x03, 0x8e, 0x83, 0x9e, 0x13,
+    0xe8, 0x39, 0xe2, 0x33, 0xe9, 0x30, 0xe9, 0x38, 0xe0, 0x93, 0x2c, 0x3e,
+    0x83, 0x7e, 0xe3, 0x3e, 0xe9, 0x37, 0x29, 0xee, 0x23, 0xc3, 0x72, 0x3e,
+    0xc9, 0x33, 0x90, 0x39, 0xcc, 0x98, 0xc7, 0x22, 0x82, 0xe9, 0x8c, 0x7d,
+    0xb8, 0xc4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x7b, 0xb8, 0x82, 0x8b, 0xc0, 0xa9, 0x42, 0x99, 0xc9,
+    0xa2, 0x6c, 0xc9, 0x2c, 0xcb, 0x8c, 0x82, 0xa3, 0x3c, 0x2c, 0x20, 0x2e,
+    0xe3, 0x8e, 0x83, 0x9e, 0x13, 0xe9, 0x35, 0xef, 0x33, 0xe3, 0x9e, 0x73,
+    0xe3, 0x3e, 0x33, 0xe0, 0x03, 0x8e, 0x83, 0x9e, 0x73, 0x11, 0xd3, 0xf1,
+    0xf7, 0xef, 0x3f, 0x1f, 0x3f, 0xee, 0x53, 0xe3, 0xee, 0x38, 0xe8, 0x39,
+    0xe0, 0x39, 0xe0, 0x37, 0xee, 0x3e, 0xe3, 0xe3, 0x9e, 0x03, 0x8e, 0x93,
+    0x02, 0x8e, 0xd3, 0x2e, 0x23, 0x79, 0x33, 0xee, 0x9c, 0xe7, 0x29, 0xd3,
+    0x22, 0xc2, 0x52, 0xc2, 0x92, 0xb7, 0xcc, 0x8c, 0xc9, 0x9c, 0x7b, 0x2b,
+    0xc4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x79, 0xb8, 0xb2, 0x8b, 0x20, 0x72, 0x28, 0xcc, 0xb2, 0xc7,
+    0x92, 0x92, 0x9c, 0xd8, 0x79, 0xc3, 0x93, 0xcc, 0xe7, 0x33, 0x2c, 0x2e,
+    0x92, 0x1d, 0xe7, 0x32, 0x33, 0xee, 0x3e, 0x83, 0x7e, 0xc3, 0xee, 0x3e,
+    0x39, 0xe6, 0x33, 0xee, 0x3e, 0x38, 0xe0, 0x03, 0xae, 0x03, 0x7e, 0xe3,
+    0x11, 0x3e, 0xd8, 0x16, 0xef, 0x3f, 0x1f, 0x39, 0xe5, 0xfe, 0x3e, 0xe3,
+    0x7e, 0x33, 0xfe, 0xe3, 0xe7, 0x3e, 0xe3, 0xee, 0x3e, 0xa3, 0x5e, 0x3e,
+    0x3f, 0xe8, 0x3a, 0xe0, 0x33, 0xee, 0x29, 0xe2, 0x33, 0xe7, 0x33, 0xee,
+    0x23, 0x3e, 0x79, 0xee, 0x93, 0xe3, 0x98, 0x39, 0xc0, 0x90, 0x59, 0xc9,
+    0xc8, 0xb7, 0xdc, 0x9b, 0x29, 0xcb, 0x7a, 0xc9, 0x94, 0x11, 0x6a, 0x70,
+    0x6b, 0xf0, 0xbf, 0x86, 0xe1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a,
+    0xb8, 0xcb, 0x88, 0xc0, 0x3c, 0x99, 0x27, 0xb9, 0xc9, 0xbc, 0x9c, 0x7b,
+    0x9c, 0xb2, 0xc2, 0xc8, 0x27, 0xde, 0x29, 0x3c, 0x9c, 0x83, 0x9e, 0x02,
+    0x93, 0x8e, 0x83, 0x8e, 0xa3, 0x0e, 0x83, 0x9e, 0x63, 0x3e, 0xe3, 0xe3,
+    0x8e, 0x83, 0x6e, 0xe3, 0xee, 0x3d, 0x81, 0x9e, 0x81, 0x7e, 0xe3, 0xf1,
+    0xfe, 0x37, 0xef, 0xee, 0x3e, 0xe3, 0x2e, 0xe3, 0x9e, 0x43, 0xe3, 0x3f,
+    0xce, 0x23, 0x3e, 0x83, 0xae, 0x83, 0xae, 0x43, 0xfe, 0x2c, 0x7e, 0xe3,
+    0x3e, 0x33, 0xe8, 0x36, 0xe3, 0xe2, 0x3e, 0x27, 0x32, 0xc3, 0x2c, 0xec,
+    0x89, 0x3c, 0xc9, 0xc8, 0x29, 0xc4, 0x92, 0x99, 0xc7, 0xb9, 0x9c, 0x41,
+    0x16, 0xa7, 0x5f, 0x55, 0x44, 0x50, 0x04, 0x95, 0x34, 0x4d, 0x6d, 0x10,
+    0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0xc8, 0xbc, 0x88, 0xd0, 0x79,
+    0x89, 0xcb, 0xbc, 0x97, 0xbc, 0x9c, 0xc9, 0x2c, 0x79, 0xc9, 0xcc, 0x3c,
+    0x37, 0x99, 0x3c, 0x2c, 0x3e, 0x0c, 0x73, 0xe3, 0x3e, 0x33, 0xe7, 0x2c,
+    0xf3, 0xe3, 0x3e, 0x93, 0x8e, 0x73, 0x3e, 0xe3, 0x3e, 0x38, 0xe0, 0x03,
+    0x8e, 0x93, 0x2e, 0x3d, 0x81, 0x9e, 0x81, 0x9e, 0x2f, 0x1f, 0xbe, 0x43,
+    0x3e, 0xe3, 0x6e, 0xef, 0x3e, 0xe3, 0xbe, 0x33, 0xef, 0xe9, 0x39, 0xe0,
+    0x38, 0xe6, 0x33, 0xee, 0x33, 0xe0, 0x53, 0xee, 0x33, 0xe9, 0x36, 0xe3,
+    0x3e, 0x3c, 0xe7, 0x2e, 0x22, 0x33, 0x23, 0x72, 0xec, 0xc3, 0xcb, 0x20,
+    0x5c, 0x29, 0xc2, 0xc7, 0x9c, 0xcb, 0x22, 0x9b, 0x7c, 0x8b, 0xc4, 0x11,
+    0x6a, 0x70, 0x1b, 0xd0, 0xad, 0x4b, 0x44, 0x57, 0xc1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x7a, 0xb8, 0xcb, 0x8b, 0xc0, 0x69, 0x28, 0x2b, 0x89,
+    0x9c, 0x19, 0xb7, 0x22, 0xc9, 0x9e, 0xc9, 0x7e, 0xc2, 0xe9, 0x3c, 0x29,
+    0x30, 0xe0, 0x82, 0x8e, 0x93, 0x2e, 0xe3, 0x9e, 0x83, 0x8e, 0xa3, 0x3e,
+    0x33, 0xe9, 0x33, 0xe3, 0xfe, 0xbe, 0x03, 0x7e, 0xed, 0x11, 0xee, 0x37,
+    0x11, 0xee, 0x3f, 0x1f, 0x73, 0xfe, 0x3e, 0x3e, 0x38, 0xe0, 0x0e, 0x93,
+    0x1e, 0xf9, 0xea, 0x38, 0xe9, 0x39, 0xe2, 0x3e, 0x37, 0xe3, 0x3e, 0xe3,
+    0x3e, 0x1c, 0xe8, 0x38, 0xe6, 0x3e, 0x3e, 0xe9, 0x39, 0xe7, 0x3c, 0x3c,
+    0xc2, 0x2e, 0x79, 0x2d, 0xe2, 0xc9, 0xe0, 0x92, 0x2c, 0x93, 0x79, 0xbc,
+    0xc8, 0xc9, 0x27, 0x9b, 0xbc, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0x3b,
+    0x5d, 0x7b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x99, 0x1c, 0x89,
+    0xb0, 0x1b, 0x28, 0x86, 0xc8, 0x29, 0x22, 0xb7, 0x92, 0xc2, 0x93, 0xc2,
+    0x99, 0x7e, 0xe2, 0xe2, 0xc3, 0xc8, 0x30, 0x5c, 0x9e, 0xe2, 0x38, 0xe9,
+    0x34, 0xee, 0x33, 0xe9, 0x38, 0xed, 0x39, 0xe0, 0x30, 0xbe, 0x83, 0x6e,
+    0xd1, 0x1e, 0x3e, 0x71, 0x1e, 0xe3, 0xf1, 0xf8, 0x3b, 0xe0, 0x38, 0xe0,
+    0xae, 0x13, 0xf9, 0x32, 0xee, 0x37, 0xe3, 0xee, 0x3e, 0xe3, 0xae, 0x83,
+    0x8e, 0x93, 0x0e, 0x43, 0xe3, 0xe3, 0x9e, 0x22, 0xce, 0x93, 0x8e, 0x93,
+    0x5e, 0x22, 0xcd, 0x99, 0x23, 0xe3, 0x2c, 0x39, 0xcc, 0x29, 0x96, 0xbd,
+    0xb9, 0xcc, 0x27, 0x99, 0xbc, 0x41, 0x16, 0xd7, 0x96, 0x96, 0xa1, 0x25,
+    0x57, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0xbb, 0xc8, 0xcc,
+    0x90, 0x6b, 0x9b, 0x9b, 0x9d, 0x7c, 0x82, 0x2c, 0x2c, 0x97, 0xcd, 0xc3,
+    0x99, 0xc3, 0x8c, 0xb3, 0x12, 0x30, 0x1e, 0x39, 0xc6, 0x3e, 0xe3, 0xe3,
+    0x27, 0xe3, 0xef, 0x3c, 0xe3, 0x9e, 0x4f, 0x33, 0xe3, 0x9e, 0x03, 0x9e,
+    0x03, 0xbe, 0x4f, 0xd3, 0xe3, 0x81, 0x9e, 0x3f, 0x1f, 0x3e, 0xe0, 0x30,
+    0x2e, 0xe3, 0xbe, 0x33, 0xfe, 0x37, 0xee, 0x3e, 0x3e, 0xe3, 0x8e, 0x83,
+    0x9e, 0x03, 0x8e, 0x83, 0x2e, 0xe2, 0x8e, 0xb3, 0x5e, 0x3e, 0xe9, 0xea,
+    0x35, 0xce, 0xde, 0x39, 0x93, 0x29, 0xc3, 0x59, 0x29, 0x29, 0x27, 0xcb,
+    0xcc, 0xbb, 0xcb, 0x79, 0xb9, 0x84, 0x11, 0x6d, 0x79, 0x60, 0x96, 0xa1,
+    0x1d, 0x58, 0x6a, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0xbc,
+    0xbb, 0x8c, 0xb0, 0x58, 0x9c, 0x22, 0x87, 0xcc, 0x8c, 0x22, 0xc9, 0x9c,
+    0x62, 0x29, 0xe3, 0xc2, 0x7e, 0xc3, 0x23, 0x23, 0xe0, 0x8c, 0x8e, 0xa3,
+    0x0e, 0x93, 0x4e, 0xe3, 0xfe, 0xa3, 0x6f, 0xe3, 0x3e, 0xf3, 0xae, 0x33,
+    0xee, 0x3a, 0xe3, 0x3e, 0xe3, 0x7e, 0xe1, 0x13, 0xee, 0xf7, 0x1f, 0x3f,
+    0xee, 0x3f, 0x9e, 0x03, 0x33, 0x3e, 0x3a, 0xe0, 0x3b, 0xe4, 0x3e, 0x3e,
+    0xf9, 0xe8, 0x39, 0xe4, 0x3e, 0xe2, 0xe0, 0x9e, 0x1c, 0xe9, 0x39, 0xe4,
+    0x9e, 0x39, 0xda, 0x38, 0xc8, 0x37, 0x29, 0xe3, 0x29, 0xe3, 0x39, 0x22,
+    0x98, 0xc7, 0x9c, 0xdc, 0x9b, 0x92, 0x7b, 0x99, 0xb4, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0xa1, 0x1d, 0x58, 0x6a, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2,
+    0x07, 0x78, 0x9d, 0xbb, 0x8b, 0x90, 0x69, 0x2b, 0x29, 0x9c, 0x82, 0x6e,
+    0x2c, 0x29, 0x2c, 0x72, 0x9c, 0x9c, 0x9c, 0x27, 0xe2, 0x3e, 0xe2, 0x3e,
+    0x83, 0x7e, 0x3e, 0xe3, 0xe3, 0xc7, 0x23, 0xee, 0x3e, 0xe3, 0xbe, 0x03,
+    0x9e, 0x43, 0xee, 0x3e, 0x53, 0xe3, 0x3e, 0x37, 0xe3, 0x3e, 0x3e, 0xf3,
+    0x81, 0x9e, 0x3f, 0x1f, 0x3b, 0xe8, 0x38, 0xe0, 0x53, 0x3e, 0x3e, 0xf9,
+    0xe0, 0x38, 0xe8, 0x39, 0xe3, 0x3e, 0xe3, 0xae, 0x63, 0x3e, 0xe3, 0x3e,
+    0x9e, 0x6c, 0xe3, 0x3e, 0x3e, 0x79, 0xc3, 0xe3, 0xde, 0xc9, 0x32, 0xd2,
+    0xc7, 0xe2, 0xc2, 0x39, 0x32, 0x59, 0xe3, 0x9c, 0x27, 0xbc, 0xc2, 0x2c,
+    0x9c, 0x7b, 0x98, 0xb4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0xa1, 0x1d, 0x48,
+    0x6a, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0x8c, 0xbb, 0x8b,
+    0x80, 0x6c, 0xb8, 0x9b, 0x2c, 0x79, 0xcc, 0x29, 0x9c, 0x97, 0x32, 0xbe,
+    0xc2, 0x92, 0x93, 0x52, 0x3c, 0x3e, 0x30, 0x1e, 0x27, 0xd3, 0xec, 0x33,
+    0xe2, 0x8e, 0x93, 0x3e, 0xe3, 0xfa, 0xe0, 0x37, 0xee, 0x33, 0xee, 0x3e,
+    0x33, 0xee, 0xf7, 0xe3, 0xee, 0x3e, 0x3f, 0x8e, 0x71, 0x1f, 0xee, 0x11,
+    0xf8, 0xe7, 0x33, 0xe3, 0x3e, 0xe3, 0x53, 0xee, 0x3e, 0xfc, 0xe0, 0x39,
+    0xe9, 0x32, 0xe3, 0xfa, 0xe5, 0x3e, 0xe3, 0xe3, 0x9e, 0x93, 0x5e, 0x33,
+    0xe3, 0xe8, 0x37, 0xed, 0x33, 0x2e, 0x2e, 0x82, 0x7e, 0x2c, 0x92, 0x3c,
+    0x20, 0x92, 0x09, 0x82, 0x7c, 0xbe, 0xcb, 0xb9, 0x27, 0xb8, 0xbb, 0x41,
+    0x16, 0xd7, 0x96, 0x96, 0xa1, 0x25, 0x47, 0xb1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x7c, 0xb9, 0x9b, 0xb9, 0xb0, 0x6c, 0x9b, 0x9c, 0x92, 0x7b,
+    0xe2, 0x29, 0x9c, 0xb8, 0x26, 0xc3, 0x32, 0x93, 0xc7, 0x3c, 0xc9, 0x33,
+    0xe3, 0x1e, 0x29, 0xe4, 0x3c, 0xce, 0x99, 0x32, 0xee, 0x3a, 0xe6, 0x3e,
+    0xe3, 0x3e, 0x3b, 0xe0, 0x23, 0xe3, 0x8e, 0x63, 0xef, 0xe3, 0xef, 0x8e,
+    0x91, 0x73, 0xf1, 0x1d, 0xee, 0x3a, 0xe2, 0x33, 0xe0, 0x23, 0xe3, 0xbe,
+    0x03, 0x9e, 0x53, 0xee, 0x3e, 0x39, 0xe0, 0xfa, 0xe5, 0x3e, 0xe3, 0xe3,
+    0x8e, 0x93, 0x8e, 0x93, 0x4e, 0x3e, 0x3d, 0x93, 0x1c, 0xe8, 0x28, 0xc7,
+    0x33, 0x29, 0xcc, 0x2e, 0x99, 0x7c, 0xc9, 0xc9, 0xcc, 0x28, 0xb8, 0xc6,
+    0x4c, 0xb4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0x3b, 0x5f, 0x7b, 0x10,
+    0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0xd8, 0xbb, 0x89, 0xc0, 0x7b,
+    0x29, 0x9c, 0x99, 0x27, 0xc9, 0x92, 0x2c, 0x29, 0x92, 0x5c, 0x2c, 0xec,
+    0x2a, 0xc2, 0x3e, 0x30, 0x2c, 0xe2, 0x73, 0xe3, 0xe3, 0xe3, 0xc7, 0xee,
+    0x3e, 0x3e, 0xec, 0xae, 0x33, 0xee, 0x38, 0xe9, 0x30, 0xbe, 0x33, 0x3e,
+    0x39, 0xe2, 0x33, 0xfc, 0x12, 0x3e, 0x37, 0xef, 0xe3, 0xee, 0x3e, 0xbe,
+    0x03, 0x9e, 0x03, 0xbe, 0x73, 0x3e, 0x3f, 0xee, 0x3c, 0xe0, 0x38, 0xe0,
+    0x13, 0xe9, 0x37, 0xe3, 0xe3, 0xee, 0x23, 0x8e, 0x93, 0x5c, 0xc3, 0x23,
+    0x27, 0x3c, 0x93, 0xdc, 0x9c, 0x5c, 0x2c, 0x2c, 0x97, 0x2c, 0x82, 0xc2,
+    0x9c, 0x79, 0xbb, 0xd4, 0x11, 0x6a, 0x70, 0x1b, 0xd0, 0xad, 0x0b, 0x95,
+    0x07, 0xc1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0xc8, 0x9b, 0x89,
+    0xc0, 0x7b, 0x92, 0x9b, 0x82, 0x98, 0xc7, 0x92, 0x23, 0xc9, 0x29, 0x82,
+    0x89, 0x9c, 0x43, 0xc2, 0xe2, 0x83, 0x3e, 0xe2, 0x37, 0xec, 0xec, 0xce,
+    0xce, 0xa3, 0x4e, 0xe3, 0xef, 0x83, 0xce, 0x03, 0x8e, 0x63, 0x3e, 0x33,
+    0xe3, 0xce, 0x13, 0xeb, 0x10, 0xd9, 0xe0, 0x3b, 0xe1, 0x3e, 0x03, 0xae,
+    0x03, 0xae, 0x03, 0xce, 0x43, 0x3e, 0xe3, 0x9e, 0x43, 0x3e, 0xfc, 0x8e,
+    0x13, 0xe9, 0x32, 0xee, 0x39, 0xe2, 0x3e, 0x38, 0xe6, 0x23, 0x3e, 0x33,
+    0xc9, 0x35, 0xcb, 0xd3, 0x2c, 0x32, 0x2c, 0x98, 0x27, 0xcc, 0x9c, 0xcb,
+    0xc9, 0x7b, 0x29, 0xb4, 0x11, 0x6a, 0x70, 0xfa, 0x40, 0x50, 0xa5, 0x34,
+    0x4d, 0x6d, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0x9b, 0x8c,
+    0x98, 0xb0, 0x6b, 0x9c, 0x9c, 0xac, 0x79, 0xc2, 0x92, 0xb2, 0x97, 0x2c,
+    0xbc, 0x32, 0x29, 0x8c, 0x69, 0x23, 0xe3, 0x23, 0x7e, 0x9e, 0xc3, 0xee,
+    0x98, 0xe9, 0x34, 0xee, 0xfc, 0x29, 0xe3, 0x33, 0xe3, 0x8e, 0x83, 0x9e,
+    0xb3, 0x4e, 0x3e, 0xef, 0x9e, 0x03, 0x8e, 0x9f, 0x1e, 0x39, 0xe8, 0x38,
+    0xe8, 0x38, 0xe0, 0x93, 0x3e, 0x3e, 0x39, 0xe5, 0x33, 0xe3, 0xe3, 0x7e,
+    0x3e, 0x33, 0xee, 0xf7, 0x33, 0xe3, 0xee, 0x3e, 0x5e, 0x3e, 0x33, 0xe8,
+    0x36, 0xe3, 0xec, 0xd2, 0xe8, 0x36, 0xe2, 0xe3, 0x3e, 0x97, 0xec, 0x29,
+    0x23, 0x39, 0x09, 0x72, 0x32, 0x9c, 0x29, 0xc9, 0xb1, 0xc8, 0x72, 0xc9,
+    0x84, 0x11, 0x6a, 0x70, 0x6b, 0xf0, 0xbf, 0x06, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x78, 0x9b, 0x8c, 0xb8, 0xb0, 0x69, 0x92, 0xcc, 0x8c,
+    0x89, 0x62, 0x9e, 0xc9, 0xe2, 0x79, 0x9d, 0xc9, 0xc2, 0xe7, 0x39, 0x22,
+    0xe2, 0x3c, 0x13, 0x9a, 0xe7, 0x23, 0xee, 0x33, 0xe3, 0x9e, 0x23, 0xf3,
+    0xae, 0x73, 0xee, 0x3e, 0xe3, 0xf0, 0x1e, 0x3b, 0xe3, 0x33, 0xfd, 0x93,
+    0x0f, 0x8e, 0x7f, 0xe3, 0x3f, 0xee, 0x3a, 0xe0, 0x38, 0xe0, 0xae, 0x03,
+    0xae, 0x93, 0x2e, 0xe3, 0xbe, 0x23, 0xf3, 0xae, 0x43, 0xee, 0x3e, 0x4e,
+    0x3e, 0x3e, 0xa3, 0x6e, 0x33, 0xe2, 0x3c, 0x79, 0xfc, 0x2e, 0x32, 0x97,
+    0xdc, 0x92, 0x33, 0x29, 0x3b, 0xb2, 0x98, 0x27, 0x98, 0xc2, 0xc2, 0x89,
+    0x72, 0x29, 0xb4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x47, 0x8b, 0xb8, 0x8b, 0x89, 0x28, 0xb9, 0x7c, 0xb8,
+    0xc9, 0x22, 0x9a, 0xc0, 0xb7, 0xc2, 0xe9, 0x2e, 0x3c, 0xd3, 0x0c, 0x42,
+    0x33, 0xce, 0x73, 0x9e, 0xe3, 0xec, 0xe9, 0x33, 0xe3, 0xe3, 0xae, 0x73,
+    0xe3, 0xee, 0x33, 0xe0, 0x0e, 0xb3, 0x2f, 0xed, 0x81, 0xde, 0x43, 0xe3,
+    0xe3, 0xae, 0x43, 0xe3, 0x3e, 0x03, 0x8e, 0x83, 0xae, 0x13, 0xf9, 0xe1,
+    0x3e, 0x93, 0x9e, 0x03, 0x8e, 0x6f, 0xe3, 0xee, 0x3e, 0x1e, 0x38, 0xe9,
+    0x36, 0xe3, 0xf2, 0x3e, 0x37, 0xc3, 0xcd, 0xcc, 0xec, 0x73, 0x2e, 0x93,
+    0xc3, 0x98, 0x30, 0x52, 0xb2, 0x23, 0x97, 0xb9, 0xc2, 0xcb, 0x8d, 0x7b,
+    0x29, 0xb4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x78, 0xc8, 0xa8, 0xb8, 0xc0, 0x5b, 0x29, 0xbb, 0x87,
+    0xcc, 0x9b, 0xd9, 0xc2, 0x7c, 0x9d, 0xc9, 0x9d, 0xc7, 0x39, 0xce, 0x3e,
+    0x32, 0x83, 0x02, 0x7e, 0x3e, 0xe9, 0x3f, 0xe8, 0x38, 0xe8, 0x39, 0xe3,
+    0x33, 0xe3, 0x8e, 0x73, 0xee, 0x3f, 0xee, 0x30, 0x0e, 0x73, 0xe3, 0xe3,
+    0xee, 0xf8, 0x1b, 0xe0, 0xf9, 0xe4, 0xd3, 0x3f, 0xe8, 0x3a, 0xe0, 0x30,
+    0xa3, 0x1e, 0x38, 0xe8, 0x36, 0xfe, 0xe3, 0x3e, 0x3a, 0xe2, 0x33, 0xf7,
+    0x3e, 0xe3, 0xe3, 0x3e, 0x8e, 0x93, 0x2e, 0x3e, 0x7c, 0xee, 0x9e, 0xe3,
+    0xc7, 0xe2, 0x3c, 0x22, 0xd3, 0x79, 0x9d, 0x23, 0x9c, 0x30, 0x5c, 0xc2,
+    0x29, 0x27, 0xbc, 0x2c, 0x28, 0xbd, 0x7b, 0xb9, 0xb4, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0xc8,
+    0xba, 0xb9, 0xb0, 0x7d, 0x22, 0x9b, 0xab, 0xc7, 0x92, 0x29, 0xc9, 0x92,
+    0x7e, 0x99, 0x3e, 0x92, 0x37, 0xce, 0x2e, 0x29, 0x3e, 0x0c, 0xb3, 0x0c,
+    0x9e, 0x33, 0xed, 0x27, 0xef, 0x3e, 0x3e, 0xe3, 0x8e, 0x73, 0xe3, 0xef,
+    0x3e, 0x30, 0x1e, 0x39, 0xed, 0x1f, 0x10, 0xf7, 0xef, 0x3e, 0x3e, 0xe3,
+    0x8e, 0x03, 0x8e, 0x93, 0x9e, 0x83, 0xbe, 0x23, 0xef, 0x93, 0x2e, 0xf3,
+    0x8e, 0x93, 0x8e, 0x13, 0xd9, 0x39, 0xe4, 0x33, 0xe2, 0xea, 0x35, 0x2e,
+    0x22, 0xce, 0x89, 0x6e, 0xd9, 0x22, 0xc3, 0x5c, 0xc9, 0x92, 0xc7, 0x92,
+    0x9b, 0xc9, 0xb9, 0x7c, 0xb9, 0xd4, 0x11, 0x6a, 0x70, 0x1b, 0xd0, 0xfd,
+    0x07, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x79, 0xb8, 0xb8, 0xcb,
+    0x80, 0x7b, 0xcc, 0x8b, 0xb8, 0xd7, 0x9c, 0x92, 0xc8, 0x93, 0x72, 0x99,
+    0x23, 0x92, 0xe7, 0x32, 0x2e, 0x99, 0xec, 0x33, 0xcc, 0x37, 0xee, 0x32,
+    0x33, 0xef, 0x83, 0x8e, 0xa3, 0x0f, 0x93, 0x1e, 0x39, 0xe2, 0x3e, 0x30,
+    0x0f, 0x83, 0x8e, 0xd1, 0xf1, 0x1f, 0xe8, 0x39, 0xe3, 0x33, 0xe3, 0x43,
+    0xee, 0x3e, 0x83, 0x9e, 0x53, 0xee, 0x3f, 0xca, 0xe8, 0x36, 0xee, 0x3e,
+    0x3e, 0x39, 0xe0, 0x3c, 0xe3, 0xe8, 0x39, 0xe6, 0x3e, 0xe3, 0xe3, 0xe7,
+    0x23, 0xe2, 0x33, 0xc2, 0x79, 0x33, 0x93, 0xe2, 0x90, 0x5b, 0xc9, 0x93,
+    0xc7, 0x9c, 0x29, 0xcc, 0xb8, 0x7c, 0x9b, 0xd4, 0x11, 0x6a, 0x75, 0xf5,
+    0x45, 0x54, 0x84, 0x75, 0x45, 0x45, 0x45, 0x7b, 0x10, 0xb0, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x78, 0xbb, 0x8b, 0xbc, 0xb0, 0x78, 0xbc, 0x9b, 0xb8,
+    0xd7, 0xbc, 0x92, 0x29, 0xc2, 0x79, 0xec, 0x92, 0x3c, 0xe7, 0x22, 0x32,
+    0x23, 0xce, 0x09, 0xa3, 0x8e, 0x6c, 0x33, 0xce, 0xef, 0xb3, 0xae, 0x33,
+    0xee, 0x39, 0xe1, 0x3e, 0x0e, 0x7f, 0xe3, 0xee, 0xdd, 0xf8, 0x16, 0xfd,
+    0xdf, 0xfd, 0xf8, 0xd6, 0xfe, 0x3e, 0xe3, 0xeb, 0x30, 0xce, 0x03, 0xae,
+    0x93, 0x8e, 0x7f, 0xe3, 0x3e, 0x33, 0xe9, 0x34, 0xee, 0x33, 0xe0, 0x4e,
+    0x3e, 0x3e, 0x83, 0x6e, 0xe3, 0xe9, 0x3e, 0x72, 0xe2, 0xe3, 0x2e, 0x97,
+    0x2e, 0xc9, 0xc3, 0x2e, 0x89, 0x7b, 0x92, 0x9c, 0xcb, 0x29, 0x98, 0xc9,
+    0xb5, 0x9b, 0x41, 0x16, 0xa7, 0x1f, 0x5a, 0xf0, 0x2f, 0x4d, 0xcf, 0x06,
+    0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0xa9, 0xcb, 0xda, 0x8b, 0x3b,
+    0x9b, 0xc7, 0xb8, 0xcc, 0x99, 0xb9, 0x8c, 0x82, 0x7b, 0x2c, 0x22, 0xe9,
+    0xc7, 0x32, 0x92, 0xe3, 0x3c, 0x93, 0x0c, 0x93, 0x2c, 0x3e, 0x7c, 0x3e,
+    0xf3, 0xe3, 0xe9, 0x36, 0xee, 0x33, 0xee, 0x3a, 0xe0, 0x03, 0xae, 0x33,
+    0xee, 0xd8, 0x19, 0x3b, 0xe3, 0x33, 0xe3, 0xae, 0x43, 0xe3, 0x3e, 0x83,
+    0x8e, 0x83, 0xae, 0x73, 0x3e, 0xe3, 0xef, 0x3b, 0xe0, 0x37, 0xee, 0x33,
+    0xe3, 0x3e, 0x1e, 0x39, 0xea, 0x38, 0xe6, 0x9e, 0xe2, 0xc2, 0xc9, 0xe0,
+    0x37, 0x92, 0x92, 0xcc, 0xbe, 0x82, 0x5b, 0x9c, 0x92, 0xb9, 0x24, 0x99,
+    0xc2, 0xb7, 0x8c, 0x98, 0x41, 0x16, 0xa7, 0x3f, 0x56, 0x78, 0x60, 0x31,
+    0x5f, 0x78, 0x1f, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0x8c,
+    0x98, 0x8b, 0x20, 0x69, 0x29, 0x29, 0x8d, 0x99, 0x33, 0x9b, 0xc7, 0x92,
+    0x99, 0xc2, 0x2c, 0x72, 0xc3, 0x32, 0x2e, 0x28, 0xe0, 0x23, 0x3e, 0x73,
+    0xee, 0x3e, 0x2d, 0x38, 0xe6, 0x33, 0xe3, 0xec, 0xe9, 0x3a, 0xe2, 0x33,
+    0xe8, 0x30, 0xde, 0x13, 0xd8, 0x17, 0x33, 0xe3, 0x3e, 0x3e, 0x83, 0xfe,
+    0x13, 0xe0, 0x03, 0xee, 0x93, 0x7f, 0x3e, 0xe3, 0x3e, 0x37, 0xe3, 0xee,
+    0x33, 0xe3, 0x8e, 0x83, 0x0e, 0x83, 0x7c, 0x3e, 0xe3, 0x3e, 0x97, 0x3e,
+    0x23, 0x3e, 0x93, 0x7e, 0x23, 0x29, 0xc9, 0x39, 0xc8, 0x20, 0x52, 0x2c,
+    0xbc, 0x27, 0xbb, 0xc9, 0xc2, 0x9b, 0x78, 0xd9, 0xb4, 0x11, 0x6a, 0x73,
+    0xf4, 0x67, 0x86, 0x31, 0x45, 0xb8, 0x6f, 0x10, 0xb0, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x78, 0xab, 0x28, 0x8b, 0x80, 0x4b, 0x2c, 0xb8, 0x7b, 0xc8,
+    0x9b, 0xc2, 0x97, 0xc9, 0x92, 0xc2, 0x2e, 0x92, 0x53, 0x32, 0x9e, 0x28,
+    0xe0, 0x32, 0xec, 0x37, 0xe3, 0x3e, 0x3e, 0x3e, 0xa3, 0x5e, 0xe3, 0xf3,
+    0x27, 0x3f, 0x3e, 0xe3, 0x3e, 0x83, 0xa3, 0x4e, 0xe3, 0x3d, 0x81, 0xae,
+    0x13, 0xe7, 0x33, 0xe3, 0xe3, 0xfe, 0x83, 0x9e, 0x13, 0xe0, 0x33, 0xee,
+    0x3d, 0xe0, 0x39, 0xe0, 0x3b, 0xe1, 0x3f, 0x93, 0x0f, 0x9e, 0x83, 0x2e,
+    0xe3, 0x8c, 0x63, 0xe3, 0xe3, 0x9e, 0x73, 0x2c, 0xce, 0xe2, 0xe8, 0x97,
+    0xcc, 0x32, 0xe9, 0x2c, 0x82, 0x09, 0x72, 0xc9, 0xc2, 0x9c, 0x29, 0x98,
+    0xc7, 0xb2, 0xbb, 0x41, 0x16, 0xa7, 0x31, 0x5f, 0x78, 0x60, 0x6d, 0x5b,
+    0x54, 0xd6, 0xe1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0xb8, 0x9c,
+    0x8b, 0x80, 0x6b, 0xb2, 0x28, 0xdc, 0x78, 0xbc, 0xb3, 0xb9, 0x27, 0x9b,
+    0xc2, 0x2e, 0x92, 0x83, 0x6e, 0x29, 0x22, 0xec, 0x19, 0xe8, 0x37, 0x2c,
+    0xec, 0x3e, 0xe2, 0x7c, 0xe3, 0xe3, 0xe3, 0xe8, 0x39, 0xe6, 0x33, 0xee,
+    0x3e, 0x30, 0x03, 0xbe, 0x83, 0x7e, 0x11, 0xee, 0x3e, 0x39, 0xe0, 0x39,
+    0xe2, 0xfe, 0x39, 0xe9, 0x30, 0x9e, 0x63, 0xe3, 0xe3, 0x3f, 0x83, 0xfe,
+    0x13, 0xe8, 0x39, 0xe3, 0x3c, 0xe3, 0x03, 0x7e, 0xe3, 0xe2, 0xec, 0xe8,
+    0x36, 0xec, 0x93, 0xc3, 0xe8, 0x27, 0x3c, 0x9c, 0x2c, 0xe9, 0x82, 0x8e,
+    0x49, 0x22, 0x9c, 0x79, 0x9c, 0xb2, 0x82, 0xc8, 0xb6, 0xcb, 0x84, 0x11,
+    0x6a, 0x75, 0x65, 0x51, 0x6d, 0x05, 0x7b, 0x7f, 0x45, 0x5f, 0x6c, 0x10,
+    0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0xb8, 0x82, 0xca, 0x8b, 0x2c, 0x89,
+    0x7b, 0x9c, 0xc4, 0xbc, 0x98, 0xc7, 0x92, 0xcc, 0xbb, 0xce, 0x89, 0x8c,
+    0x63, 0xe9, 0x3c, 0x3c, 0x59, 0x3e, 0x23, 0xe7, 0x33, 0xef, 0xe2, 0x32,
+    0x7e, 0x3c, 0x3e, 0x3e, 0x39, 0xe2, 0x33, 0xe8, 0x38, 0xe0, 0x03, 0x9e,
+    0x03, 0x8e, 0x63, 0xe1, 0xf3, 0xe3, 0x9e, 0x03, 0x8e, 0x83, 0x8e, 0x73,
+    0x3e, 0x3e, 0xe3, 0xe0, 0x9e, 0x53, 0xee, 0x33, 0xe7, 0x3e, 0xef, 0xe3,
+    0xe3, 0x7e, 0xe3, 0xee, 0x3e, 0x39, 0xe3, 0x33, 0xe3, 0x43, 0xee, 0x2e,
+    0x73, 0xe3, 0x3e, 0x3d, 0xc7, 0x9c, 0xe2, 0xce, 0x29, 0x8c, 0x63, 0x9d,
+    0xc9, 0x9c, 0x83, 0x1c, 0x99, 0xc6, 0x29, 0xc2, 0x8b, 0x29, 0xb6, 0xdb,
+    0x84, 0x11, 0x6b, 0x72, 0xd4, 0x58, 0x40, 0x05, 0x86, 0x61, 0x1b, 0x44,
+    0xb7, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0xb8, 0x8c, 0xc4, 0x8b,
+    0x4c, 0x88, 0x29, 0x7c, 0xc8, 0x9d, 0x92, 0xc7, 0x29, 0xbd, 0xbc, 0xce,
+    0x89, 0x8e, 0x69, 0x29, 0xde, 0x23, 0x52, 0x2d, 0x3c, 0x37, 0x93, 0x3e,
+    0x2e, 0xe2, 0x7f, 0x3e, 0x33, 0xee, 0x3a, 0xe1, 0x3e, 0x83, 0x8e, 0x03,
+    0x9e, 0x83, 0x9e, 0x43, 0x3e, 0xf3, 0x9e, 0x63, 0x3e, 0x3e, 0xef, 0x73,
+    0x3e, 0xe3, 0xe3, 0xf0, 0x9e, 0x83, 0xae, 0x83, 0x7e, 0xe3, 0xee, 0x3f,
+    0x3b, 0xe0, 0x39, 0xe8, 0x38, 0xe0, 0x03, 0x7e, 0xe2, 0xec, 0xe2, 0x39,
+    0xe1, 0x39, 0x8e, 0x72, 0xee, 0x39, 0xcc, 0x99, 0xc4, 0x99, 0xec, 0x90,
+    0x59, 0x9d, 0xcc, 0x27, 0x99, 0xc9, 0xbb, 0x9b, 0x79, 0xc8, 0xb4, 0x11,
+    0x6b, 0x74, 0x6f, 0x55, 0xb0, 0x96, 0x91, 0x3f, 0x55, 0x7b, 0x10, 0xb0,
+    0x07, 0xa2, 0xf2, 0xf2, 0x47, 0x5c, 0x98, 0xab, 0x4b, 0x48, 0x29, 0x8b,
+    0x89, 0x92, 0x99, 0x0b, 0x79, 0x2e, 0x9e, 0x29, 0xe7, 0xc9, 0x22, 0xec,
+    0x2e, 0x22, 0x2e, 0x73, 0xc2, 0x3c, 0x33, 0xe9, 0x35, 0xe3, 0xce, 0x3e,
+    0x73, 0x3e, 0xe3, 0xec, 0x3a, 0xe0, 0x9e, 0x93, 0x3f, 0xfe, 0x37, 0xee,
+    0x3e, 0xe3, 0xe3, 0xae, 0x43, 0xe3, 0x3f, 0x83, 0x9e, 0x03, 0x8e, 0x83,
+    0x9e, 0x33, 0x3e, 0x3b, 0xe5, 0x33, 0xee, 0x3f, 0x83, 0x6e, 0xf3, 0xe3,
+    0xcf, 0x83, 0x9e, 0x3c, 0x32, 0xc9, 0x30, 0xc7, 0x33, 0xec, 0xc3, 0x39,
+    0x92, 0x7d, 0x9c, 0x99, 0xe2, 0x90, 0x49, 0x23, 0x92, 0x7c, 0x9b, 0x22,
+    0xb8, 0xb8, 0x99, 0xb3, 0x41, 0x16, 0xd7, 0x96, 0x96, 0xb1, 0x1b, 0x7b,
+    0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0xcb, 0x89, 0xcb, 0x90,
+    0x79, 0x8b, 0xcc, 0x98, 0xb8, 0x96, 0xc2, 0x92, 0x2c, 0x89, 0x22, 0xc2,
+    0x98, 0xc9, 0x23, 0x9e, 0xce, 0x33, 0xce, 0x28, 0xea, 0x33, 0xe3, 0x3e,
+    0x93, 0x2e, 0x3e, 0x83, 0x8e, 0x73, 0xe3, 0x3f, 0x33, 0xe0, 0x9e, 0x53,
+    0x3f, 0x11, 0xf9, 0x1f, 0x10, 0xf7, 0x3e, 0x33, 0xee, 0x3e, 0x83, 0x6e,
+    0x3e, 0x3e, 0xe3, 0x8e, 0xa3, 0x7e, 0x33, 0xe3, 0xe3, 0xf8, 0xe8, 0x36,
+    0xee, 0x3e, 0x33, 0xe0, 0x53, 0x3e, 0xe3, 0xe7, 0x32, 0x3e, 0xe2, 0x3c,
+    0x83, 0x7e, 0x32, 0x33, 0xc2, 0x37, 0x22, 0xe9, 0x9c, 0x29, 0x39, 0x22,
+    0xc7, 0xbc, 0x9c, 0xc8, 0xcb, 0x89, 0x7b, 0x9b, 0x84, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0xb1, 0x1d, 0x6b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07,
+    0x78, 0xbb, 0xa9, 0x29, 0xb0, 0x4b, 0xb9, 0x9c, 0x99, 0x72, 0x9c, 0x9c,
+    0xc9, 0xc7, 0x92, 0xc2, 0x32, 0xc2, 0x7c, 0xc2, 0x23, 0xee, 0x20, 0x6c,
+    0xc3, 0x23, 0xe2, 0xa3, 0x6e, 0x33, 0xe3, 0x3e, 0x83, 0x8e, 0x93, 0x3e,
+    0x33, 0xe9, 0x30, 0x1e, 0x39, 0xe3, 0xf1, 0x1f, 0x91, 0xf1, 0x3f, 0x3e,
+    0x3a, 0xe2, 0x3e, 0x30, 0xae, 0x93, 0x0e, 0xa3, 0x1e, 0x3a, 0xe5, 0x33,
+    0xe3, 0x3e, 0xa3, 0x3e, 0x3e, 0xc0, 0x6e, 0x33, 0xe2, 0x3e, 0x83, 0x8e,
+    0x93, 0x7e, 0x3e, 0x3c, 0x32, 0x39, 0x24, 0xc3, 0x2c, 0x98, 0xc0, 0x19,
+    0x28, 0xc8, 0x26, 0xc2, 0x28, 0xcb, 0xa8, 0x99, 0xb3, 0x41, 0x16, 0xd7,
+    0x96, 0x96, 0x61, 0x1f, 0xb4, 0x57, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x67, 0x59, 0xba, 0x89, 0x88, 0x0c, 0x89, 0x7c, 0xc8, 0xb9, 0xbc, 0x29,
+    0xc2, 0x82, 0xea, 0x22, 0x9d, 0x27, 0x9c, 0x93, 0x39, 0xe3, 0x3e, 0x3e,
+    0x29, 0x36, 0xee, 0xcc, 0xe3, 0xe9, 0x32, 0xe3, 0xc9, 0xe8, 0x38, 0xeb,
+    0x30, 0x0e, 0x73, 0x3e, 0x33, 0x1f, 0x39, 0xff, 0xf2, 0x33, 0xe7, 0x3e,
+    0x3e, 0xe3, 0xe3, 0x03, 0x9e, 0x73, 0xe3, 0xee, 0x3e, 0x3b, 0xec, 0x39,
+    0xe5, 0x33, 0xe3, 0x3e, 0x0e, 0x93, 0x72, 0x3e, 0x33, 0xec, 0x2b, 0x35,
+    0xce, 0xc9, 0x3e, 0x8c, 0x62, 0xc9, 0xe9, 0x2c, 0x09, 0x92, 0x1c, 0x97,
+    0x2b, 0xc8, 0xb9, 0x2c, 0x72, 0x8b, 0xc4, 0x11, 0x6d, 0x79, 0x60, 0x86,
+    0x71, 0xd5, 0x54, 0x5b, 0x7b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x57,
+    0x8b, 0x9b, 0x99, 0x80, 0x4b, 0x92, 0x9c, 0x9b, 0x78, 0xc9, 0xc2, 0xc8,
+    0x97, 0xcc, 0x29, 0x93, 0x39, 0x82, 0x9c, 0x93, 0x23, 0xce, 0x72, 0x33,
+    0xe3, 0xec, 0x99, 0xe5, 0x93, 0xee, 0x32, 0xae, 0x73, 0x3d, 0x3e, 0xe3,
+    0xe0, 0x43, 0x3e, 0x3e, 0x83, 0x6e, 0x3e, 0x3c, 0xe3, 0x9e, 0x83, 0x9e,
+    0x93, 0x1e, 0x3a, 0xe0, 0x30, 0x9e, 0x03, 0x7e, 0xe3, 0x3e, 0xe3, 0xf8,
+    0x39, 0xe8, 0x38, 0xe9, 0x39, 0xe4, 0x33, 0xe3, 0xe0, 0x93, 0x39, 0x3c,
+    0x38, 0xe9, 0x32, 0xe2, 0xc7, 0xe2, 0xe3, 0xc9, 0x2d, 0x8c, 0x69, 0xb3,
+    0x29, 0xcb, 0x52, 0xc2, 0xc9, 0x27, 0x9b, 0xb8, 0x9c, 0xcb, 0x7c, 0x58,
+    0x24, 0x11, 0x6d, 0x79, 0x60, 0x7f, 0xb5, 0x54, 0xbf, 0x6d, 0x10, 0xb0,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0xc9, 0x89, 0x8b, 0x90, 0x58, 0x9d,
+    0x9b, 0x28, 0x98, 0xb7, 0x2b, 0x22, 0x99, 0xc9, 0x7c, 0xc8, 0xe2, 0x2c,
+    0xb9, 0xc2, 0xec, 0x30, 0x69, 0x9e, 0xe2, 0x3c, 0x73, 0x32, 0x3e, 0x3e,
+    0xc9, 0xe0, 0x39, 0xe1, 0x3e, 0x93, 0x4e, 0xfe, 0x3e, 0x73, 0xe3, 0x3e,
+    0xf3, 0xe8, 0x39, 0xe2, 0x33, 0xe8, 0x36, 0xee, 0x3e, 0xe3, 0xf9, 0xe0,
+    0x39, 0xe0, 0x9e, 0x83, 0x8e, 0x93, 0x3e, 0xec, 0x39, 0xe8, 0x38, 0xe8,
+    0x3a, 0xe4, 0x33, 0xc3, 0xe0, 0xa3, 0x0e, 0x83, 0x8e, 0x62, 0x33, 0xc2,
+    0xec, 0x73, 0x3e, 0xc9, 0xce, 0x27, 0xc2, 0x9e, 0x29, 0x29, 0xac, 0x72,
+    0x98, 0x8c, 0xd8, 0x99, 0xb6, 0x89, 0xa4, 0x11, 0x6d, 0x72, 0x1d, 0x40,
+    0xa5, 0x1d, 0x7f, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x8b, 0x88,
+    0x9b, 0x09, 0x0b, 0x89, 0x9b, 0x28, 0xbc, 0x79, 0xb2, 0x29, 0xbc, 0xb8,
+    0x99, 0xc1, 0x2c, 0x72, 0x92, 0x9e, 0xe9, 0x30, 0x43, 0x9e, 0xd9, 0x82,
+    0x6e, 0xe3, 0xec, 0x23, 0x7e, 0xd2, 0x33, 0xe3, 0xe8, 0x37, 0xe3, 0x3e,
+    0xe3, 0x3e, 0x8e, 0x93, 0x0f, 0xc1, 0xf1, 0x0d, 0x93, 0x6e, 0xe3, 0x3e,
+    0xef, 0x4e, 0x3e, 0xe3, 0x8f, 0x63, 0xe3, 0xfe, 0x3e, 0x93, 0x8e, 0x63,
+    0x3e, 0xec, 0xe3, 0x8e, 0x83, 0x8e, 0x93, 0x3c, 0xc3, 0xe9, 0x33, 0xe3,
+    0x2e, 0x7d, 0x9c, 0x33, 0x9c, 0x3c, 0x23, 0xcc, 0x98, 0x32, 0xbd, 0xc8,
+    0x97, 0xb8, 0xcd, 0x8b, 0x9c, 0x7a, 0x8c, 0xa4, 0x11, 0x6a, 0x75, 0x6f,
+    0xb5, 0x54, 0x5d, 0x16, 0x5d, 0x7f, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2,
+    0x07, 0x78, 0xbb, 0x89, 0x98, 0xb0, 0x6c, 0x88, 0xbc, 0xb8, 0x79, 0x28,
+    0x29, 0x9c, 0x98, 0xb6, 0xc9, 0x22, 0xc9, 0xc7, 0x39, 0x2c, 0x3e, 0x92,
+    0x33, 0x3c, 0xe7, 0x32, 0x3e, 0xc3, 0xec, 0xa3, 0x02, 0x8e, 0xb3, 0x3e,
+    0xec, 0xea, 0x30, 0x4e, 0x3e, 0xe3, 0xd1, 0xf1, 0x2f, 0xe3, 0x7e, 0x3e,
+    0xe3, 0xee, 0xf0, 0x0f, 0x93, 0x9e, 0x93, 0x1e, 0x38, 0xe9, 0x34, 0xe3,
+    0x3e, 0xfb, 0x38, 0xe9, 0x30, 0x73, 0x9c, 0xe3, 0xee, 0x27, 0x9e, 0xe2,
+    0x3c, 0x32, 0x7e, 0x23, 0x39, 0x22, 0xe9, 0x29, 0xc1, 0x28, 0x02, 0x9c,
+    0x18, 0x99, 0x24, 0xc8, 0xb9, 0xb7, 0xab, 0xba, 0x41, 0x16, 0xa7, 0x5f,
+    0x44, 0xd1, 0x60, 0x96, 0x24, 0xd7, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x07, 0x7a, 0x8b, 0xb9, 0xb8, 0x90, 0x49, 0x98, 0xbc, 0x9b, 0x88, 0x6c,
+    0xc9, 0x3b, 0xbd, 0x7b, 0xc9, 0x2e, 0x92, 0xca, 0x22, 0xec, 0x90, 0x73,
+    0xc2, 0x2c, 0xc3, 0x28, 0xe6, 0x9e, 0xe3, 0x32, 0x3a, 0xe9, 0x31, 0xe3,
+    0xae, 0x83, 0x93, 0x6e, 0xef, 0x11, 0xf1, 0x8f, 0x91, 0x1f, 0x18, 0xf8,
+    0x16, 0xd3, 0xee, 0x33, 0xe8, 0x38, 0xe0, 0x6f, 0x33, 0xee, 0x3e, 0xa3,
+    0x2e, 0xe3, 0x8e, 0xa3, 0x3e, 0xe3, 0xe9, 0x32, 0xe3, 0xe8, 0x30, 0x2e,
+    0xce, 0x93, 0x0e, 0x73, 0x9e, 0xf9, 0x33, 0x97, 0x23, 0x32, 0xe2, 0xce,
+    0x92, 0x5c, 0xcb, 0x2c, 0xb0, 0x49, 0xcb, 0xd9, 0x8b, 0x6c, 0xbb, 0x22,
+    0x98, 0x7c, 0xb4, 0x24, 0x11, 0x6a, 0x75, 0xf4, 0x5b, 0xf6, 0x96, 0x24,
+    0xd7, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x9b, 0x0a, 0x8b, 0x88,
+    0x09, 0x7b, 0x89, 0x29, 0x9c, 0x87, 0xb9, 0xcb, 0xcc, 0x8e, 0x7c, 0x99,
+    0x2e, 0x29, 0xea, 0x22, 0xce, 0x90, 0xa3, 0x1c, 0x38, 0x26, 0xe3, 0x9e,
+    0xe2, 0xc9, 0x34, 0xee, 0x33, 0xe9, 0x3c, 0xe0, 0xa3, 0x1e, 0x38, 0xe6,
+    0x33, 0xe3, 0xf1, 0xf9, 0xe0, 0x38, 0xe8, 0x38, 0xe6, 0x33, 0xe3, 0xee,
+    0x30, 0x2e, 0xe3, 0xce, 0x53, 0x3f, 0xe9, 0xf7, 0xe3, 0xe3, 0xe3, 0x3e,
+    0xb3, 0x3c, 0xee, 0xc0, 0x6e, 0x3e, 0x32, 0x23, 0x7e, 0x93, 0xe2, 0xce,
+    0x97, 0x33, 0xc3, 0xec, 0xbd, 0x82, 0x69, 0x2e, 0x99, 0xe9, 0x59, 0xbb,
+    0xcc, 0xb7, 0xcc, 0x22, 0x92, 0x9b, 0x7c, 0x84, 0xe4, 0x11, 0x6b, 0x74,
+    0xfb, 0x54, 0x50, 0x5b, 0x16, 0x4d, 0x7f, 0x10, 0xb0, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x7b, 0xb8, 0xac, 0xba, 0x80, 0x78, 0xbb, 0x9b, 0x9b, 0x87,
+    0xbd, 0x9b, 0xbc, 0xc8, 0x8c, 0x69, 0x9c, 0x29, 0x23, 0x8c, 0x92, 0x13,
+    0x20, 0xac, 0x39, 0x23, 0xc7, 0xec, 0x93, 0xe3, 0x2e, 0xb3, 0x8e, 0xa3,
+    0x9e, 0x13, 0xf0, 0x6e, 0xec, 0x3e, 0x3e, 0xa3, 0x3e, 0x11, 0xf9, 0xe2,
+    0x33, 0xe8, 0x38, 0xe6, 0x33, 0xe3, 0xe3, 0xe0, 0x2e, 0xe3, 0x9e, 0xa3,
+    0x4e, 0xe3, 0x3e, 0x93, 0x8e, 0xb3, 0x0e, 0xb3, 0x0e, 0x73, 0xcf, 0xee,
+    0x29, 0xeb, 0x30, 0x27, 0x3d, 0x32, 0x3e, 0xcb, 0x9c, 0x62, 0x3c, 0xbb,
+    0xc2, 0x09, 0x82, 0x79, 0x29, 0x29, 0x2b, 0x89, 0x97, 0xb8, 0x82, 0x41,
+    0x16, 0xd7, 0x26, 0xd5, 0x04, 0x95, 0x1b, 0x7f, 0x10, 0xb0, 0x07, 0xa2,
+    0xf2, 0xf2, 0x67, 0xaa, 0x88, 0xca, 0x8b, 0x04, 0x9b, 0x12, 0x97, 0xb9,
+    0xbd, 0xb8, 0xb2, 0x99, 0x1d, 0x29, 0x98, 0xc7, 0x29, 0xc2, 0x39, 0x23,
+    0x9c, 0x29, 0x9c, 0x8e, 0x62, 0x3e, 0x93, 0xe3, 0x9e, 0x63, 0x23, 0xec,
+    0xe2, 0x93, 0x3e, 0x33, 0xe0, 0x33, 0xee, 0x9a, 0xe6, 0x3e, 0x3e, 0x11,
+    0xf8, 0xe8, 0x38, 0xea, 0x34, 0xee, 0x3e, 0x38, 0xe0, 0x83, 0xae, 0x02,
+    0xae, 0x33, 0xee, 0x3c, 0xe9, 0x32, 0xe3, 0xeb, 0x30, 0x62, 0x3e, 0xcd,
+    0xc9, 0x8e, 0x83, 0x62, 0x32, 0xce, 0xc9, 0x83, 0x72, 0x92, 0xc9, 0x92,
+    0x98, 0xc8, 0x20, 0x22, 0xc2, 0x99, 0x7c, 0x2b, 0x49, 0xbc, 0xb7, 0x8b,
+    0xba, 0x41, 0x16, 0xd7, 0x96, 0x7f, 0xb4, 0x54, 0x5f, 0x6d, 0x10, 0xb0,
+    0x07, 0xa2, 0xf2, 0xf2, 0x67, 0xa8, 0x89, 0xb0, 0x8b, 0x78, 0xcb, 0x9b,
+    0x8b, 0xca, 0xb3, 0x9b, 0x28, 0x72, 0xdb, 0x92, 0x9c, 0x27, 0xc9, 0x33,
+    0xc9, 0x2e, 0x42, 0xdc, 0x82, 0x9e, 0x32, 0x3e, 0x27, 0x3e, 0x33, 0xe3,
+    0xe2, 0x7c, 0xe3, 0xe9, 0x3f, 0xe8, 0x38, 0xe0, 0x02, 0xde, 0x23, 0x3e,
+    0x73, 0xf1, 0xf3, 0xee, 0x38, 0xe8, 0x39, 0xe3, 0x3e, 0x3e, 0x83, 0x63,
+    0x3e, 0x3f, 0xe9, 0xae, 0x33, 0x3e, 0x39, 0xe0, 0x39, 0xe0, 0x9a, 0xe2,
+    0x93, 0xf8, 0x30, 0x53, 0xe3, 0x9d, 0xc7, 0x2e, 0x33, 0x29, 0xce, 0x73,
+    0x92, 0x32, 0xcc, 0xb7, 0x2d, 0x99, 0x2c, 0xcb, 0x82, 0x52, 0xc9, 0x89,
+    0xc7, 0xbd, 0xb4, 0xbb, 0xdc, 0x78, 0x8c, 0x84, 0x11, 0x6d, 0x79, 0x60,
+    0x86, 0x71, 0xd5, 0x54, 0x4b, 0x7b, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2,
+    0x27, 0xb4, 0x9b, 0x2a, 0x98, 0x19, 0xc9, 0x92, 0x82, 0x97, 0x29, 0x9b,
+    0xb8, 0xc9, 0x78, 0xdc, 0x92, 0x99, 0x27, 0xe9, 0x93, 0x23, 0x2e, 0x52,
+    0xbd, 0x99, 0xe9, 0x32, 0xe3, 0x29, 0x38, 0xe6, 0x9e, 0x93, 0xe3, 0xe7,
+    0x99, 0xfe, 0x2e, 0xe3, 0x33, 0xe3, 0xe9, 0x32, 0xe3, 0xe7, 0x3e, 0xf1,
+    0xf3, 0x3e, 0x83, 0x8e, 0xa3, 0x5e, 0xec, 0x3e, 0x30, 0x9e, 0x53, 0xef,
+    0x3c, 0xe9, 0x36, 0xe3, 0x3e, 0xec, 0x39, 0xe1, 0x93, 0x9e, 0x42, 0x2e,
+    0x39, 0x1c, 0xe9, 0x30, 0x97, 0xce, 0x23, 0x32, 0xc3, 0x9c, 0x63, 0x22,
+    0x39, 0x9e, 0x72, 0x9c, 0x99, 0x2c, 0x90, 0x39, 0xc9, 0x27, 0xbd, 0x8b,
+    0xc8, 0xbc, 0x99, 0x6b, 0x88, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x61, 0x1f,
+    0xb5, 0x57, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0xa8, 0xba,
+    0xb4, 0x80, 0x12, 0x87, 0x99, 0x8b, 0xc8, 0x9c, 0x99, 0x78, 0x2c, 0x8c,
+    0xc8, 0x28, 0xc8, 0x26, 0x92, 0xc9, 0xcd, 0x90, 0x5c, 0x9c, 0x32, 0x37,
+    0x93, 0xe3, 0x92, 0xe3, 0x82, 0x9e, 0x09, 0x83, 0x8e, 0x72, 0x23, 0xe3,
+    0xee, 0x30, 0x3e, 0x33, 0xea, 0x36, 0xee, 0x3e, 0x11, 0xf7, 0xe3, 0xee,
+    0x3e, 0xe3, 0xbe, 0x33, 0x3e, 0x30, 0x4e, 0xfe, 0xe3, 0x9e, 0x83, 0x8e,
+    0x93, 0x7e, 0xec, 0x33, 0xee, 0x98, 0x38, 0xea, 0x30, 0x90, 0x0c, 0x83,
+    0x6e, 0x23, 0xe3, 0xc3, 0x79, 0xee, 0x93, 0xe2, 0xc7, 0x29, 0x33, 0x9c,
+    0xc9, 0x82, 0xa9, 0x2c, 0x29, 0x8c, 0x8b, 0x68, 0xcc, 0xbb, 0x89, 0x7c,
+    0x85, 0xb4, 0x11, 0x6d, 0x79, 0x60, 0xa6, 0xa1, 0x1d, 0x6b, 0x10, 0xb0,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x98, 0x0b, 0x98, 0x0c, 0x4c, 0x8b, 0xb8,
+    0x8b, 0x79, 0x9c, 0x8b, 0x92, 0xb8, 0x26, 0xc2, 0x99, 0x2c, 0x37, 0x93,
+    0xcc, 0x9c, 0xd8, 0x7c, 0xe9, 0xcc, 0x92, 0xc7, 0xe2, 0x32, 0x3e, 0xc9,
+    0x7e, 0xde, 0x23, 0xee, 0x97, 0x3e, 0xe3, 0xc3, 0xe3, 0x0c, 0x73, 0xee,
+    0x3c, 0x33, 0xe9, 0x35, 0x11, 0xf3, 0xe3, 0xae, 0x93, 0x6e, 0xe3, 0xee,
+    0x32, 0x5e, 0xe2, 0xee, 0x38, 0xe8, 0x38, 0xea, 0x32, 0xee, 0x29, 0xe5,
+    0x33, 0xe3, 0x23, 0x8e, 0x83, 0x6e, 0xe3, 0x23, 0xde, 0x92, 0x59, 0xcc,
+    0x22, 0xe7, 0x92, 0x93, 0x29, 0x39, 0x72, 0x99, 0x2c, 0x29, 0xc0, 0x5c,
+    0x98, 0xcd, 0x87, 0xcc, 0x8d, 0xb8, 0x8c, 0x72, 0x89, 0x84, 0x11, 0x6a,
+    0x73, 0x6f, 0x67, 0x86, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x07, 0x7b, 0x85, 0xaa, 0x8a, 0xc0, 0x6b, 0x88, 0xb9, 0x98, 0x79, 0xcd,
+    0x89, 0xbc, 0xb7, 0x9c, 0x22, 0x9c, 0x29, 0x82, 0x6c, 0x2b, 0xcc, 0xd9,
+    0x12, 0xd7, 0x2c, 0x93, 0x32, 0xe3, 0x7e, 0x9c, 0xe2, 0xe3, 0xe7, 0xce,
+    0x2e, 0x22, 0xe3, 0x8e, 0x93, 0x0e, 0x6c, 0x3e, 0xe3, 0x3e, 0x73, 0xe3,
+    0x3e, 0x11, 0xf9, 0xe5, 0x3e, 0x3e, 0x3e, 0x93, 0x8e, 0x93, 0x5e, 0xe3,
+    0x3f, 0x39, 0xe8, 0x39, 0xe7, 0x3e, 0xe3, 0xe3, 0xce, 0x83, 0x7e, 0x22,
+    0x33, 0xee, 0x30, 0x39, 0x3c, 0x37, 0xee, 0x32, 0xcc, 0x23, 0x82, 0x6c,
+    0x39, 0x2c, 0xc2, 0x79, 0xc9, 0x29, 0xcb, 0x99, 0x20, 0x59, 0xb9, 0xcc,
+    0x87, 0xbd, 0x8c, 0x8b, 0xb9, 0x7b, 0x9b, 0x84, 0x11, 0x6a, 0x73, 0xf5,
+    0x67, 0x86, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b,
+    0x8a, 0x4a, 0x8c, 0x80, 0x4b, 0x9a, 0xb8, 0x89, 0xab, 0x78, 0x2c, 0xc8,
+    0xbc, 0xb7, 0x9c, 0x29, 0x2c, 0xc9, 0xac, 0x02, 0x72, 0xec, 0xc3, 0xc3,
+    0x97, 0x3e, 0xe9, 0xec, 0x2d, 0x7c, 0x9e, 0xe3, 0xe2, 0xc8, 0x39, 0xe2,
+    0xc2, 0x30, 0x4e, 0xec, 0xec, 0x8e, 0xa3, 0x3e, 0x11, 0xf9, 0xe8, 0x38,
+    0xe7, 0x3e, 0xe3, 0x3e, 0xe3, 0x8e, 0x2e, 0xec, 0x73, 0xe3, 0xee, 0x33,
+    0x29, 0xe0, 0x98, 0xe7, 0x9e, 0x39, 0xe3, 0x3e, 0x83, 0x82, 0x9e, 0x52,
+    0x93, 0xce, 0x27, 0xe2, 0xcc, 0x23, 0xc2, 0x73, 0x22, 0x93, 0xcc, 0x98,
+    0xc7, 0x99, 0xcb, 0x99, 0xcb, 0x29, 0xb2, 0xab, 0x6c, 0x9b, 0x9b, 0xb8,
+    0x9b, 0x44, 0x41, 0x16, 0xa7, 0x3f, 0x46, 0x78, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0xab, 0x88, 0xa9, 0xb0, 0x8b, 0x78,
+    0x9a, 0x9b, 0xb8, 0xb7, 0xc8, 0xbc, 0x98, 0x9e, 0xab, 0x82, 0x7b, 0xcb,
+    0x2c, 0xc2, 0xc0, 0x62, 0x23, 0x92, 0xe3, 0x79, 0x9e, 0xc2, 0x9e, 0x27,
+    0xed, 0x9e, 0xe3, 0xec, 0xb3, 0x3e, 0x2e, 0x30, 0x8e, 0x63, 0xe3, 0x23,
+    0x3e, 0x93, 0x81, 0x7f, 0x3e, 0xe3, 0x3f, 0xe9, 0x3a, 0xe0, 0x38, 0xe0,
+    0x23, 0x3e, 0x83, 0x6e, 0x33, 0xe3, 0x23, 0x8e, 0x63, 0x3e, 0x3e, 0xe2,
+    0x7e, 0x33, 0xee, 0x32, 0x39, 0xe0, 0x72, 0xc3, 0xec, 0x3c, 0x27, 0x93,
+    0x2c, 0x33, 0x2e, 0x73, 0x9c, 0xc2, 0x92, 0xe7, 0x9b, 0x22, 0xcc, 0xbc,
+    0x29, 0x2c, 0x79, 0x92, 0xb9, 0xc8, 0x98, 0xb8, 0x86, 0xbb, 0x84, 0x11,
+    0x6a, 0x73, 0xf5, 0x67, 0x86, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x74, 0xb8, 0x8a, 0xa8, 0xc0, 0x8b, 0x98, 0x6c, 0x9b, 0xbc,
+    0xc8, 0x7b, 0xc8, 0xc9, 0xc2, 0xb8, 0x98, 0x27, 0xb2, 0x29, 0xec, 0x29,
+    0x09, 0x92, 0x1c, 0xe7, 0x2c, 0x22, 0xee, 0x3c, 0x72, 0x3c, 0xc3, 0x39,
+    0xc7, 0xee, 0x2e, 0x32, 0x3e, 0x83, 0x83, 0x9e, 0x93, 0x3e, 0x3e, 0x38,
+    0x17, 0xfe, 0xe3, 0xe3, 0xfe, 0x93, 0x6e, 0x3c, 0xe3, 0xcf, 0x0e, 0xc3,
+    0x8e, 0xa3, 0x2e, 0xe3, 0x7e, 0x2e, 0xe3, 0xc3, 0x27, 0x3e, 0xe2, 0xec,
+    0x9c, 0x63, 0xee, 0x32, 0xec, 0x7e, 0x92, 0x2e, 0x9c, 0x98, 0xe6, 0x9c,
+    0xcb, 0xc9, 0xe7, 0x9b, 0x99, 0x22, 0xb9, 0x39, 0xbe, 0x2a, 0x93, 0xb8,
+    0x2b, 0x89, 0x78, 0x8b, 0xb4, 0x11, 0x6a, 0x71, 0xf4, 0xad, 0xfd, 0x07,
+    0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0xab, 0x5a, 0xb9, 0xb0,
+    0x9b, 0x6a, 0x8c, 0xbb, 0x9d, 0x9b, 0x52, 0x8c, 0xb2, 0xc9, 0x23, 0xc8,
+    0xc9, 0x9c, 0x22, 0x92, 0x63, 0x22, 0x3c, 0x29, 0x93, 0x39, 0xee, 0x28,
+    0x37, 0xcc, 0x3e, 0x9c, 0x9e, 0x73, 0xee, 0x23, 0xe3, 0xc0, 0x4e, 0x3e,
+    0x3e, 0x93, 0x8e, 0x73, 0x3f, 0x1f, 0x3e, 0x2a, 0xe8, 0x37, 0xee, 0x33,
+    0xce, 0x3e, 0x2e, 0x3e, 0xa3, 0x0e, 0x93, 0x5e, 0x33, 0xee, 0x3a, 0xe1,
+    0x3e, 0x8c, 0x6b, 0xe3, 0xe3, 0x2c, 0x3d, 0x23, 0xc8, 0x36, 0xc3, 0x32,
+    0x2c, 0x37, 0x22, 0xe2, 0x93, 0xc9, 0x7d, 0x9c, 0xcb, 0x2c, 0x29, 0x90,
+    0x4c, 0xbc, 0x29, 0x72, 0xb9, 0x82, 0xbb, 0x98, 0xb6, 0x88, 0xb4, 0x11,
+    0x6a, 0x71, 0xf5, 0x84, 0x85, 0xc5, 0x94, 0x07, 0xb1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x70, 0x4d, 0x8a, 0xbd, 0x80, 0x88, 0x9b, 0x78, 0xbb,
+    0x8b, 0x98, 0x98, 0xb6, 0x9b, 0xbc, 0x8b, 0x98, 0x27, 0x9b, 0xc2, 0xcc,
+    0x9c, 0x52, 0x9c, 0xc9, 0x27, 0x39, 0xec, 0x23, 0x3c, 0x73, 0x23, 0xc3,
+    0xe2, 0xe7, 0xbc, 0xee, 0x39, 0x9e, 0x83, 0x13, 0xeb, 0x37, 0xe3, 0xe3,
+    0x3f, 0x1f, 0x93, 0xae, 0x03, 0x9e, 0x93, 0x2e, 0xce, 0x2e, 0x3e, 0x93,
+    0x0e, 0xa3, 0x3e, 0xe3, 0xc8, 0xeb, 0x33, 0xec, 0xd9, 0x9e, 0x23, 0x92,
+    0x4e, 0x23, 0xec, 0x92, 0x73, 0x32, 0x93, 0x22, 0x39, 0x91, 0x29, 0x92,
+    0x1c, 0xb8, 0xca, 0xb0, 0x5c, 0x9c, 0xbb, 0xc7, 0x98, 0x9b, 0x89, 0xb8,
+    0x7c, 0xba, 0x84, 0x11, 0x6a, 0x71, 0xf4, 0xaf, 0xff, 0x06, 0xb1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78, 0xa8, 0x8b, 0xab, 0x80, 0x78, 0xb9,
+    0x98, 0x9b, 0x97, 0xbb, 0x9b, 0x92, 0xb8, 0x72, 0x2b, 0xbd, 0x82, 0xc9,
+    0x92, 0x2d, 0x98, 0xc0, 0x89, 0x8c, 0x69, 0x2e, 0x39, 0x23, 0x82, 0x93,
+    0x0e, 0xa3, 0x0e, 0x82, 0x7e, 0xe9, 0xc3, 0x23, 0xe0, 0x53, 0xe3, 0x23,
+    0xea, 0x36, 0xee, 0xf1, 0xf3, 0xe7, 0x33, 0xed, 0x3e, 0xe2, 0x8e, 0x93,
+    0x1e, 0xf0, 0x33, 0xee, 0x37, 0xce, 0x39, 0xee, 0x3c, 0xa3, 0x5e, 0x3e,
+    0xe3, 0x27, 0x33, 0xe9, 0x2e, 0xe2, 0x83, 0x42, 0xcc, 0x3e, 0x89, 0x63,
+    0x32, 0x29, 0x2c, 0x73, 0x29, 0x29, 0x3c, 0x97, 0xcc, 0x2c, 0xc9, 0xbc,
+    0x89, 0x5b, 0xcd, 0x8c, 0xb7, 0x89, 0xc8, 0x49, 0xb9, 0x78, 0x98, 0x84,
+    0x11, 0x6a, 0x73, 0xf4, 0x67, 0x86, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x7b, 0xb4, 0xa8, 0x5a, 0xb0, 0x78, 0x8b, 0xc8, 0xa8,
+    0x97, 0xdb, 0x9c, 0x9b, 0x98, 0x7c, 0xc9, 0xbc, 0x89, 0xc7, 0x2b, 0x93,
+    0x2c, 0x28, 0x22, 0xcd, 0x92, 0x2c, 0xe9, 0x73, 0x2c, 0x23, 0x3c, 0xea,
+    0x38, 0xc9, 0x35, 0x9e, 0xe9, 0xe3, 0x52, 0x3e, 0x23, 0xdd, 0xf2, 0x11,
+    0xd8, 0xf6, 0xdf, 0xf3, 0xee, 0x28, 0xe9, 0x31, 0xe3, 0x6e, 0x39, 0x3e,
+    0xf2, 0x83, 0x7e, 0x33, 0xe3, 0xe3, 0xc9, 0x32, 0x23, 0xeb, 0x33, 0xe2,
+    0xd3, 0x7b, 0xd3, 0x9c, 0xc9, 0x27, 0xec, 0x22, 0x9c, 0xe2, 0x79, 0x39,
+    0x22, 0x8d, 0xc7, 0xbc, 0xc9, 0x9c, 0xb9, 0x39, 0xc2, 0xc7, 0xb0, 0xb2,
+    0xc8, 0x8a, 0x8b, 0x78, 0xb8, 0x84, 0x11, 0x6a, 0x73, 0xf4, 0x67, 0x86,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0xb5, 0xa4,
+    0xab, 0x80, 0x74, 0x89, 0xdb, 0x48, 0xb7, 0xcb, 0x8c, 0x9b, 0x8b, 0x7c,
+    0xc9, 0xb9, 0xb9, 0x27, 0xcb, 0x39, 0xcd, 0x9b, 0x62, 0x2e, 0x93, 0x92,
+    0x73, 0x23, 0x23, 0x22, 0x97, 0x2e, 0x23, 0xc2, 0x2e, 0x83, 0x6e, 0x2e,
+    0xe2, 0xc2, 0x5e, 0xe3, 0x93, 0xfc, 0x1f, 0x12, 0xf3, 0xc7, 0x33, 0xee,
+    0x3e, 0x3e, 0x7f, 0x2e, 0x3e, 0xe3, 0xec, 0x30, 0xeb, 0x35, 0x2e, 0xe2,
+    0x2e, 0x93, 0x22, 0xec, 0x42, 0xc2, 0xce, 0x89, 0x62, 0x3d, 0x29, 0x9c,
+    0x73, 0x92, 0x39, 0x29, 0xb7, 0xe2, 0xb2, 0x2c, 0x9c, 0x8b, 0x12, 0x98,
+    0xc7, 0x8b, 0x9c, 0xc8, 0xba, 0x8b, 0x78, 0x98, 0xb4, 0x11, 0x6a, 0x73,
+    0xf4, 0x67, 0x86, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07,
+    0x78, 0xbb, 0x44, 0xad, 0x80, 0x7a, 0x8a, 0xda, 0x89, 0xa8, 0xb9, 0x90,
+    0xb7, 0x8c, 0xb8, 0x92, 0xbc, 0x82, 0x7b, 0xcc, 0x9d, 0x29, 0xc0, 0x22,
+    0x9c, 0x7b, 0xcc, 0x22, 0x32, 0xc8, 0x29, 0xc6, 0xe9, 0x3c, 0x93, 0xc9,
+    0x35, 0xcc, 0xee, 0x29, 0x1e, 0xf9, 0x3d, 0x1f, 0x12, 0xfe, 0x37, 0xee,
+    0x33, 0xee, 0xcf, 0x63, 0x3e, 0x3c, 0xe2, 0x8e, 0xd3, 0x7e, 0x3e, 0x32,
+    0xc3, 0x27, 0x3e, 0x33, 0xc2, 0x3e, 0x0c, 0x89, 0x8e, 0x69, 0x22, 0xed,
+    0x9b, 0x92, 0x0c, 0x79, 0x22, 0xcb, 0xcb, 0x87, 0xb2, 0x2c, 0x2b, 0xbc,
+    0x1b, 0x97, 0xd9, 0x8b, 0x89, 0x98, 0x9b, 0x18, 0x99, 0x83, 0x41, 0x16,
+    0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78,
+    0xab, 0x44, 0x8b, 0x80, 0x6b, 0x8b, 0xc4, 0xa9, 0x9b, 0x48, 0x29, 0xb9,
+    0x7b, 0xb8, 0x9c, 0xb9, 0x38, 0xb6, 0xc8, 0xbd, 0x29, 0xb0, 0x0c, 0x82,
+    0x79, 0x2d, 0x92, 0x23, 0x99, 0x27, 0x3c, 0xc3, 0x29, 0x3e, 0x73, 0x3e,
+    0x2e, 0x9e, 0xc8, 0x20, 0x73, 0xe2, 0xe2, 0xed, 0xba, 0xdf, 0xd1, 0x3e,
+    0x83, 0x6e, 0x33, 0xe9, 0xcf, 0x93, 0x3e, 0x33, 0x28, 0xea, 0x3f, 0x31,
+    0x9c, 0x7e, 0x33, 0xe2, 0x32, 0xe0, 0x7e, 0x92, 0x3c, 0x23, 0x97, 0xee,
+    0x8c, 0xbc, 0x92, 0x79, 0xc2, 0x29, 0x29, 0x87, 0xbc, 0x29, 0xcb, 0xbc,
+    0x38, 0xbd, 0x97, 0x88, 0xb8, 0x98, 0xbc, 0x88, 0x7b, 0xb9, 0x84, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07,
+    0x70, 0xda, 0xa8, 0xb8, 0x40, 0x38, 0xab, 0x98, 0x8a, 0xb0, 0x88, 0x96,
+    0xcb, 0xa9, 0x92, 0xc9, 0xb0, 0x27, 0xbc, 0x99, 0xe2, 0x92, 0x7c, 0x29,
+    0x9e, 0xd9, 0xc9, 0x90, 0x37, 0x9c, 0x29, 0xec, 0x39, 0xb3, 0x42, 0xe2,
+    0xdc, 0x83, 0x0e, 0x73, 0x9c, 0xce, 0xc2, 0x38, 0xe9, 0x32, 0xc3, 0xe9,
+    0x30, 0xc8, 0xe9, 0x35, 0xe3, 0xe3, 0x2f, 0x93, 0x0e, 0x93, 0x3e, 0xe9,
+    0xc8, 0x29, 0x37, 0xe3, 0x3e, 0x3e, 0x2e, 0x93, 0x4e, 0x33, 0x9e, 0x92,
+    0x6e, 0xc9, 0x93, 0xe2, 0x89, 0x8c, 0x62, 0x99, 0x22, 0xc2, 0x9b, 0x1c,
+    0x28, 0x99, 0xb0, 0xc0, 0x48, 0x8d, 0xb9, 0x78, 0xc9, 0x88, 0xdc, 0x5a,
+    0x84, 0xa4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x17, 0x4a, 0xa2, 0xb4, 0xb0, 0x0b, 0x98, 0x1b, 0x97, 0xb8,
+    0x8b, 0x98, 0x8b, 0x79, 0xbb, 0x8c, 0xc9, 0xb7, 0x9c, 0xbc, 0x92, 0x2b,
+    0x82, 0x5c, 0x29, 0x9e, 0xc7, 0x2c, 0x92, 0x3e, 0x2c, 0x72, 0xcd, 0x93,
+    0xc3, 0x28, 0x37, 0x2e, 0x39, 0xcc, 0x3e, 0x2e, 0x2e, 0xa3, 0x8e, 0x93,
+    0x0e, 0x83, 0xad, 0x1e, 0x28, 0xe8, 0x36, 0xce, 0x3e, 0x33, 0xe0, 0x32,
+    0x33, 0xe9, 0x36, 0xe3, 0x3e, 0x92, 0x37, 0xe3, 0xe9, 0xed, 0x9e, 0x8c,
+    0x72, 0x33, 0xce, 0x3b, 0xd0, 0x6c, 0x9c, 0xc2, 0xe3, 0x82, 0x69, 0x9c,
+    0x39, 0x9c, 0x72, 0x99, 0x29, 0x29, 0x87, 0xcc, 0x9b, 0xbc, 0xb9, 0x1b,
+    0x99, 0xb0, 0x97, 0xcb, 0x89, 0xdb, 0x8a, 0x74, 0x89, 0xb4, 0x11, 0x6a,
+    0x70, 0xfa, 0x40, 0x50, 0xa4, 0xb5, 0x07, 0xb1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x7a, 0x5b, 0x4a, 0xb8, 0xb0, 0x5a, 0x8a, 0xbb, 0x99, 0x86,
+    0xbb, 0x89, 0x29, 0xa9, 0x94, 0x2b, 0x9c, 0x97, 0xbc, 0x9c, 0x92, 0x92,
+    0x4c, 0x29, 0x2c, 0x92, 0x5b, 0x23, 0xc9, 0xc8, 0x27, 0xc9, 0x2e, 0x32,
+    0x2c, 0x72, 0xee, 0x22, 0xc2, 0xe0, 0x5c, 0x3e, 0x33, 0x2a, 0x33, 0x22,
+    0xe3, 0xc1, 0x23, 0x3e, 0x83, 0x6e, 0x33, 0xc2, 0xe3, 0x73, 0x3c, 0xe3,
+    0x3c, 0x37, 0x9e, 0x33, 0x2e, 0xe2, 0x7e, 0x2c, 0xe2, 0x3e, 0x37, 0x23,
+    0x32, 0xee, 0x9c, 0x5e, 0x9d, 0xe2, 0xd8, 0x27, 0x93, 0x32, 0x99, 0xbc,
+    0x72, 0x92, 0xc9, 0xb9, 0xb7, 0x9c, 0x92, 0x2b, 0xb8, 0x19, 0xb9, 0x99,
+    0xb5, 0x99, 0xb8, 0xb8, 0x7b, 0x8b, 0xb4, 0x11, 0x6a, 0x71, 0xf4, 0x85,
+    0x84, 0x85, 0xd4, 0x07, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x78,
+    0xab, 0x0a, 0xb8, 0x90, 0x28, 0xb8, 0x7b, 0x94, 0x8b, 0x89, 0xb7, 0x8b,
+    0xb8, 0xb8, 0xdc, 0x99, 0x0d, 0x8b, 0x69, 0x2c, 0xbc, 0x9c, 0x4c, 0xc9,
+    0x3c, 0x72, 0xc9, 0xeb, 0xce, 0x97, 0xcc, 0x99, 0xcc, 0xe3, 0x82, 0x83,
+    0x62, 0xf2, 0xe3, 0x93, 0x43, 0x3c, 0x2e, 0x73, 0xec, 0x2c, 0xe2, 0xce,
+    0x10, 0xe9, 0x33, 0xd3, 0x32, 0x93, 0x93, 0x3e, 0x33, 0xe8, 0x36, 0xe3,
+    0xdb, 0xee, 0x27, 0xec, 0x93, 0xe2, 0xe3, 0x72, 0x33, 0x23, 0xf2, 0x30,
+    0x7c, 0x9c, 0x3c, 0x22, 0xc7, 0x2c, 0x29, 0xcc, 0x92, 0x7c, 0x9c, 0x29,
+    0xc8, 0xd7, 0xcb, 0x9b, 0xc8, 0xb9, 0x19, 0xb8, 0x99, 0xb4, 0x28, 0xb9,
+    0x88, 0x97, 0xd0, 0xbb, 0x41, 0x16, 0xa7, 0xa6, 0x81, 0xf1, 0x06, 0xb1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0xaa, 0x44, 0x8b, 0x80, 0x28,
+    0xc9, 0xa8, 0x0b, 0x88, 0x8b, 0x79, 0x8b, 0xd4, 0xbd, 0x98, 0xb7, 0xc9,
+    0xb8, 0xcb, 0x89, 0x8c, 0x12, 0xcc, 0x21, 0xdb, 0x9c, 0x29, 0xc2, 0x79,
+    0x3e, 0x32, 0x29, 0x37, 0x23, 0xe3, 0xec, 0x29, 0x4c, 0xe3, 0x9e, 0xb3,
+    0x5e, 0x3d, 0x11, 0xf8, 0xd9, 0x12, 0xf3, 0x97, 0x3e, 0xc3, 0x2e, 0x39,
+    0x13, 0xe9, 0x30, 0xeb, 0x30, 0xd7, 0x9c, 0xe3, 0x3e, 0x92, 0x8c, 0xa3,
+    0x5c, 0x93, 0xe3, 0xc0, 0x53, 0x99, 0x33, 0x97, 0x2e, 0x99, 0x2b, 0xc2,
+    0x89, 0x73, 0xc2, 0xbb, 0xd8, 0xb7, 0xd9, 0x8b, 0xcb, 0xa8, 0x2b, 0xb8,
+    0x7b, 0xca, 0xb2, 0xba, 0x88, 0x98, 0xb6, 0x0b, 0xa4, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x57, 0x80, 0x8b,
+    0x49, 0x80, 0x8b, 0x88, 0x8b, 0x68, 0x89, 0x89, 0xc8, 0x9b, 0x68, 0xdb,
+    0x99, 0xc9, 0x9b, 0x32, 0x2c, 0x98, 0xc0, 0x32, 0xbd, 0xb9, 0x98, 0xc6,
+    0xb3, 0x92, 0x99, 0xc7, 0x99, 0xec, 0x32, 0x9e, 0x72, 0xce, 0x29, 0x33,
+    0x20, 0x43, 0xc2, 0x3e, 0x72, 0x2e, 0xe2, 0x33, 0xf8, 0x16, 0x2e, 0xec,
+    0x11, 0xd8, 0x37, 0xe2, 0xee, 0x2e, 0x3e, 0x73, 0xe3, 0x3c, 0xe2, 0x97,
+    0x33, 0xee, 0x9e, 0x23, 0x7c, 0x3c, 0x93, 0xe2, 0xe7, 0x22, 0xe2, 0xee,
+    0x29, 0x3c, 0xc9, 0x39, 0x26, 0xc9, 0x23, 0xc9, 0x28, 0x97, 0x23, 0x9c,
+    0xcb, 0x9c, 0x7b, 0xb9, 0xc9, 0x29, 0x80, 0x09, 0x8b, 0x68, 0xcb, 0x9b,
+    0xda, 0x98, 0x0c, 0x7b, 0x4b, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0x44, 0xb8, 0xa4, 0x80,
+    0x7b, 0x58, 0x99, 0x8a, 0xb7, 0x88, 0xbc, 0x8d, 0xca, 0x78, 0xc9, 0xc9,
+    0xc8, 0xb7, 0xc9, 0x92, 0xd9, 0x2c, 0x72, 0x9c, 0xc8, 0x99, 0xe7, 0x39,
+    0x3c, 0xbe, 0x9c, 0x72, 0x92, 0x2c, 0x22, 0x37, 0x22, 0xe3, 0x22, 0xe3,
+    0x43, 0x93, 0xe9, 0x73, 0x3e, 0x2c, 0x33, 0xf8, 0x16, 0x9d, 0xe3, 0xf1,
+    0xf9, 0xe6, 0x23, 0xe9, 0x2e, 0xd0, 0x69, 0xee, 0x33, 0xe3, 0x89, 0x63,
+    0xee, 0x2e, 0xc2, 0x7d, 0x2e, 0x32, 0x23, 0xe7, 0x22, 0xc2, 0x2e, 0x32,
+    0x09, 0x7e, 0x2c, 0x92, 0xc2, 0x97, 0xc2, 0x2c, 0x92, 0x9c, 0x73, 0x8e,
+    0xcb, 0x9d, 0x99, 0xc3, 0x8b, 0xb8, 0x38, 0xbd, 0x88, 0xb7, 0x8a, 0xbb,
+    0x08, 0x9d, 0x7b, 0x5b, 0x84, 0x11, 0x6d, 0x72, 0x66, 0x10, 0x9f, 0x11,
+    0x6f, 0x11, 0x1b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0xb5, 0xa4, 0x88,
+    0xa0, 0x3b, 0x88, 0xa8, 0x88, 0xb7, 0x88, 0xcb, 0xac, 0xba, 0x78, 0xbb,
+    0xcb, 0x99, 0xb7, 0x2b, 0xbc, 0xb9, 0x9c, 0x5b, 0xbc, 0xc8, 0x98, 0x26,
+    0xc9, 0x23, 0x2c, 0x97, 0x2c, 0xc2, 0xc9, 0x2d, 0x89, 0x6e, 0x2c, 0xe2,
+    0x39, 0x03, 0x72, 0x33, 0x23, 0xe3, 0x27, 0xec, 0x3f, 0x1f, 0x2e, 0x7c,
+    0xcf, 0x1f, 0xe3, 0xc9, 0x33, 0x2e, 0xce, 0x72, 0x2e, 0x23, 0xe3, 0x99,
+    0x32, 0xc2, 0x37, 0xe3, 0xe9, 0x23, 0x23, 0x7c, 0x23, 0xe9, 0x2c, 0x98,
+    0xc0, 0x79, 0x39, 0xc9, 0x22, 0x98, 0xc8, 0x27, 0xc9, 0x9b, 0xc2, 0xbc,
+    0xbb, 0x6d, 0xbb, 0x9b, 0xb8, 0x3d, 0xbb, 0x87, 0x9b, 0x88, 0xba, 0x4b,
+    0x89, 0x78, 0x4a, 0xa4, 0x11, 0x6d, 0x72, 0xf5, 0x40, 0x14, 0x59, 0x40,
+    0xd8, 0x6d, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xaa, 0x04, 0x98,
+    0x0a, 0x98, 0x6b, 0x8b, 0xb8, 0xba, 0x8b, 0xa8, 0xab, 0x28, 0xcb, 0x78,
+    0x8c, 0xcb, 0x28, 0x20, 0x0c, 0x7b, 0xcb, 0x2d, 0x92, 0x9a, 0x22, 0xc2,
+    0x97, 0x2c, 0xe2, 0x92, 0xdb, 0x7c, 0xc2, 0xec, 0x33, 0x90, 0x0c, 0xc3,
+    0x7c, 0x2e, 0xc3, 0xf1, 0xf7, 0xe3, 0xcc, 0xf1, 0xfc, 0x82, 0x6e, 0x39,
+    0x2d, 0xe3, 0x43, 0x9e, 0xec, 0x7e, 0x2c, 0xe3, 0x22, 0xc8, 0x26, 0x3c,
+    0x29, 0x2c, 0xe8, 0x97, 0x3d, 0x9c, 0x39, 0xe2, 0x0c, 0x72, 0xbc, 0x29,
+    0x92, 0x97, 0x22, 0x9c, 0xc9, 0xcb, 0x8c, 0x99, 0x2b, 0xbc, 0x9b, 0x3c,
+    0xb8, 0xa0, 0x0c, 0x8b, 0x68, 0x8b, 0xba, 0xb8, 0x8b, 0x88, 0x75, 0xa5,
+    0x84, 0x11, 0x6b, 0x71, 0x6b, 0x95, 0x0b, 0x8d, 0xa5, 0x11, 0x6c, 0x10,
+    0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x4b, 0x9a, 0x24, 0xb8, 0x54, 0xb4,
+    0xaa, 0xb9, 0x80, 0xc7, 0xa9, 0xb8, 0xb8, 0xba, 0x9b, 0x08, 0x8b, 0x79,
+    0x9b, 0xc8, 0xc2, 0x90, 0x1c, 0xb7, 0x9b, 0xcc, 0x9c, 0x8d, 0x7c, 0x93,
+    0xcc, 0x99, 0xc9, 0x21, 0x32, 0x8e, 0x62, 0x29, 0x3c, 0xc3, 0x59, 0xc2,
+    0x2e, 0x28, 0x36, 0xe3, 0x92, 0xf1, 0xf9, 0xc5, 0x9f, 0x1f, 0xe3, 0x72,
+    0xc2, 0xcc, 0x3e, 0x20, 0x6e, 0x32, 0xec, 0x32, 0x8e, 0x62, 0xc9, 0xe3,
+    0x93, 0x7e, 0xc2, 0x2c, 0x22, 0x37, 0xc2, 0xce, 0xc2, 0x9c, 0xa2, 0x4c,
+    0x92, 0xc9, 0x9c, 0x79, 0x92, 0xcb, 0xc2, 0x99, 0xb3, 0x9c, 0xca, 0xab,
+    0x09, 0x5b, 0xc8, 0xb8, 0x97, 0xb8, 0x8a, 0xcb, 0x8a, 0x74, 0xba, 0x44,
+    0x11, 0x6b, 0x74, 0xd5, 0x51, 0x70, 0x96, 0x21, 0x1d, 0x84, 0x86, 0xb1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xba, 0x20, 0x8a, 0x5a, 0xb0, 0x8d,
+    0xb9, 0x82, 0xba, 0x89, 0xb2, 0x5a, 0xb9, 0x95, 0xbb, 0x8c, 0xb8, 0x9b,
+    0x19, 0x20, 0x0c, 0x99, 0x7c, 0xc9, 0x22, 0xc2, 0x98, 0x28, 0xc7, 0x92,
+    0x23, 0xc9, 0x23, 0x79, 0x39, 0x23, 0xcc, 0x90, 0x22, 0x32, 0x8e, 0x69,
+    0x2d, 0xc2, 0x92, 0x81, 0x7f, 0xee, 0x39, 0xf1, 0xf7, 0xc2, 0xc3, 0x2d,
+    0xc9, 0x83, 0x53, 0x3e, 0xe2, 0x37, 0x2e, 0xc9, 0x33, 0xc3, 0x72, 0x32,
+    0x33, 0x92, 0x98, 0x37, 0x2c, 0xc2, 0x99, 0x2c, 0x32, 0xcb, 0x97, 0x29,
+    0x3c, 0x89, 0xec, 0x99, 0x62, 0xb9, 0xcc, 0xb8, 0x8b, 0x79, 0xb8, 0xbb,
+    0x8d, 0x90, 0x48, 0xdb, 0x98, 0x8b, 0x98, 0x3b, 0x84, 0x87, 0xba, 0xa4,
+    0x41, 0x16, 0xa7, 0x56, 0x55, 0x67, 0x60, 0x96, 0x91, 0x3d, 0x5d, 0x7b,
+    0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0x55, 0xd4, 0xa0, 0xb0,
+    0x1a, 0xb8, 0x87, 0xbb, 0x9b, 0x88, 0xb8, 0x99, 0x1b, 0x89, 0xb8, 0x88,
+    0xb7, 0x29, 0x8b, 0xd9, 0x82, 0x62, 0x9c, 0x99, 0xcb, 0x72, 0x29, 0xc9,
+    0x9c, 0xe7, 0x39, 0x92, 0x33, 0x9d, 0x89, 0x63, 0xce, 0x22, 0xe2, 0x73,
+    0x2e, 0xcc, 0x22, 0xe7, 0x31, 0x19, 0xf1, 0xf3, 0x7c, 0x33, 0xd1, 0xf3,
+    0x27, 0x9e, 0x3c, 0x22, 0x3d, 0x22, 0x9c, 0x93, 0x72, 0x3e, 0x2c, 0xc2,
+    0xc7, 0x99, 0x3c, 0x39, 0x93, 0x8c, 0x79, 0xeb, 0x92, 0x2e, 0x20, 0x8c,
+    0x99, 0x1c, 0x27, 0xc9, 0x9c, 0x2c, 0x29, 0x72, 0xcb, 0x22, 0xbb, 0x89,
+    0xb5, 0x98, 0xcb, 0xb8, 0x58, 0xcd, 0x88, 0xb7, 0x89, 0xb8, 0xbb, 0x4b,
+    0x7a, 0x8a, 0x44, 0x11, 0x6a, 0x73, 0xf4, 0x17, 0x86, 0x96, 0xa1, 0x25,
+    0x47, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0x04, 0xb5, 0xa0,
+    0xb0, 0x2a, 0xa8, 0x7b, 0x84, 0xad, 0x88, 0xba, 0x80, 0xb7, 0x88, 0xbc,
+    0xb8, 0xba, 0x79, 0xb9, 0xbb, 0x8c, 0x90, 0x08, 0x8c, 0x69, 0x92, 0x2c,
+    0x9c, 0x82, 0x69, 0x2c, 0x29, 0x2b, 0xac, 0x82, 0x69, 0x3c, 0x92, 0xd2,
+    0x23, 0x9c, 0xa3, 0x79, 0xb1, 0x12, 0xf1, 0xf9, 0x25, 0x3f, 0x1f, 0xe3,
+    0x72, 0x32, 0x32, 0x33, 0xc0, 0x22, 0xe2, 0x79, 0xce, 0x22, 0x3c, 0x37,
+    0x2c, 0x32, 0x9c, 0xc3, 0x92, 0x1e, 0xc7, 0x2c, 0x23, 0x23, 0xc9, 0x2c,
+    0xcb, 0x89, 0x6c, 0xcb, 0xcc, 0x98, 0x8c, 0x79, 0x9c, 0x9b, 0xb9, 0x28,
+    0x98, 0x29, 0xb2, 0x9b, 0x80, 0x8b, 0x88, 0x7b, 0x85, 0xcb, 0x88, 0xb8,
+    0xa7, 0x8b, 0x58, 0x41, 0x16, 0xa7, 0x1d, 0x48, 0x78, 0x60, 0x96, 0xa1,
+    0x1d, 0x58, 0x6a, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0x4b,
+    0xa5, 0x4b, 0x50, 0x15, 0xa7, 0x4a, 0xa5, 0xa8, 0xba, 0x98, 0x0b, 0x7a,
+    0xbb, 0x88, 0xc8, 0xc8, 0xa7, 0xc2, 0x89, 0x8b, 0xc8, 0x3b, 0xc9, 0xb7,
+    0xc9, 0xb9, 0xc2, 0x9c, 0x92, 0x09, 0x72, 0xc9, 0xcb, 0x2c, 0x97, 0x23,
+    0x22, 0x93, 0xc9, 0x19, 0xe9, 0x20, 0x98, 0x36, 0xb1, 0x1e, 0xf1, 0xf8,
+    0x36, 0x93, 0xf1, 0xfe, 0x27, 0xe9, 0x2d, 0xc9, 0x29, 0x23, 0xe9, 0x7c,
+    0xe2, 0xce, 0xcc, 0x28, 0x36, 0x2c, 0xc9, 0x22, 0x37, 0xc9, 0xc9, 0xc2,
+    0x92, 0x83, 0x89, 0x63, 0x39, 0x9c, 0x92, 0x7b, 0xb2, 0xb9, 0xcb, 0xc9,
+    0x95, 0xbb, 0x8c, 0x98, 0x72, 0x2b, 0xc8, 0xbd, 0x90, 0x38, 0x84, 0xb7,
+    0xd4, 0xab, 0x4a, 0xb8, 0x8a, 0x78, 0xaa, 0xb4, 0x11, 0x6a, 0x72, 0xd5,
+    0x79, 0x60, 0x96, 0xa1, 0x1d, 0x48, 0x6a, 0x10, 0xb0, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x74, 0xab, 0x80, 0x4b, 0x80, 0x04, 0x78, 0xa5, 0xab, 0x54,
+    0xdb, 0x87, 0x9c, 0xa8, 0xc9, 0x8b, 0x88, 0x7c, 0xc8, 0x99, 0x2b, 0x80,
+    0x7b, 0x99, 0xdc, 0x8b, 0x97, 0xe9, 0xbc, 0x2c, 0x89, 0x7c, 0xdb, 0x99,
+    0xce, 0x97, 0x2c, 0x99, 0x2c, 0x29, 0x62, 0xeb, 0x93, 0x32, 0x7c, 0xe1,
+    0x1e, 0xf1, 0xf8, 0x26, 0x3e, 0xf1, 0xf9, 0x27, 0xe2, 0x9c, 0xe2, 0x39,
+    0x7d, 0x29, 0xc9, 0x9d, 0xe7, 0x92, 0xcc, 0x92, 0xc3, 0x7c, 0x99, 0xed,
+    0x92, 0x97, 0xee, 0x99, 0xc2, 0x2c, 0x6c, 0xb8, 0x2c, 0xb9, 0x72, 0xc9,
+    0x2c, 0x99, 0xdb, 0x93, 0xbc, 0xa9, 0x7c, 0x98, 0xb8, 0x8c, 0xb0, 0x48,
+    0x98, 0xba, 0x75, 0xa8, 0x8d, 0xb4, 0x88, 0xb6, 0x4a, 0xa4, 0x11, 0x6a,
+    0x71, 0xd4, 0x87, 0x86, 0x96, 0xa1, 0x2b, 0x47, 0xb1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x7a, 0xa4, 0x88, 0xa5, 0xa0, 0x38, 0xa8, 0x07, 0xad,
+    0x54, 0xb8, 0x8b, 0x88, 0x6c, 0xb8, 0xbd, 0xa8, 0x8b, 0x88, 0x6c, 0xbc,
+    0x9c, 0x8b, 0x8b, 0x7c, 0xdb, 0x8b, 0x9c, 0x87, 0x2c, 0x2c, 0xb2, 0xcd,
+    0x99, 0x2c, 0xc9, 0x72, 0x39, 0x2c, 0x92, 0x90, 0x53, 0x9c, 0x2c, 0x37,
+    0x93, 0xe1, 0x13, 0xf1, 0x7f, 0x29, 0xe9, 0xf1, 0xf8, 0x27, 0xcc, 0x92,
+    0xe2, 0xdc, 0x4c, 0xbc, 0xc2, 0x8e, 0x89, 0x62, 0xce, 0x9c, 0x2c, 0x92,
+    0x1e, 0xd9, 0x95, 0xce, 0x9c, 0xc9, 0x8c, 0x5b, 0x29, 0x29, 0x27, 0xbc,
+    0x28, 0xce, 0x8b, 0x7c, 0x9b, 0xc8, 0x9c, 0x97, 0x8b, 0xd8, 0x8b, 0x98,
+    0x8b, 0x4b, 0xd8, 0xb4, 0x9a, 0x4b, 0xc4, 0x85, 0x8a, 0x64, 0xaa, 0x41,
+    0x16, 0xa7, 0x3f, 0x41, 0x78, 0x60, 0x96, 0xa1, 0x24, 0x57, 0xb1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x67, 0xaa, 0x44, 0x5a, 0x84, 0x1b, 0xa9, 0x80,
+    0xab, 0x89, 0xb0, 0xa9, 0x84, 0xcb, 0x8d, 0x88, 0x96, 0xb9, 0xdb, 0xb8,
+    0xc0, 0x89, 0x9b, 0x4c, 0xb8, 0xb9, 0x72, 0x9c, 0x92, 0xc9, 0xe8, 0x27,
+    0x9c, 0xc9, 0xc2, 0x2c, 0xa2, 0x73, 0x99, 0xd2, 0x39, 0x27, 0x31, 0x1d,
+    0xf1, 0xf3, 0x7e, 0x92, 0x11, 0xfc, 0x97, 0xe2, 0xcc, 0x32, 0xd2, 0x22,
+    0x9e, 0x82, 0x93, 0x8c, 0x82, 0x7c, 0x29, 0xe9, 0xcc, 0xb7, 0xc2, 0x29,
+    0x33, 0x9c, 0xa2, 0x39, 0xb9, 0x28, 0x98, 0xc7, 0x29, 0xb2, 0xb9, 0x92,
+    0x79, 0xb2, 0xb8, 0x8b, 0xa7, 0xd9, 0x8c, 0x8b, 0x2b, 0x18, 0xc7, 0x88,
+    0x4d, 0x88, 0xa8, 0x9a, 0x05, 0x7a, 0x88, 0xa4, 0x11, 0x6b, 0x74, 0x54,
+    0x17, 0x60, 0x96, 0x91, 0x3b, 0x41, 0x6b, 0x10, 0xb0, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x78, 0x84, 0x45, 0x54, 0xa0, 0x7b, 0x8b, 0xaa, 0x4a, 0xb7,
+    0x48, 0x84, 0xbd, 0x8a, 0x7b, 0x8b, 0xb9, 0xb8, 0xb7, 0xc8, 0x8c, 0xb4,
+    0x9c, 0x49, 0xb8, 0x9d, 0x7b, 0x8b, 0xcb, 0x9b, 0xc7, 0x8c, 0xc2, 0x29,
+    0x2b, 0x8c, 0x92, 0x59, 0xc2, 0x99, 0x20, 0x42, 0x92, 0x29, 0x8c, 0x73,
+    0x9f, 0x1f, 0x11, 0xf8, 0xd6, 0xbf, 0x11, 0xd3, 0x27, 0x39, 0xc3, 0x22,
+    0xe3, 0x08, 0x72, 0xe2, 0xc9, 0x3e, 0xc7, 0x9c, 0xc2, 0x2c, 0xcb, 0x9c,
+    0x82, 0x7c, 0x2c, 0xc2, 0x92, 0x98, 0x20, 0xa9, 0x32, 0x2b, 0x99, 0x23,
+    0x8c, 0xc8, 0x99, 0x5c, 0xc8, 0xab, 0x8a, 0xb3, 0x8c, 0xb8, 0x39, 0xcb,
+    0x08, 0xb6, 0x8a, 0x88, 0xb8, 0x49, 0xa5, 0x0b, 0x41, 0x16, 0xb7, 0x41,
+    0x54, 0xbf, 0x06, 0x71, 0x1f, 0xd5, 0x5b, 0x7c, 0x10, 0xb0, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x75, 0xa4, 0x48, 0x08, 0xb0, 0x78, 0x4a, 0x88, 0x4a,
+    0xbb, 0x84, 0xbb, 0x8a, 0xb8, 0x88, 0xc8, 0x89, 0x92, 0xbb, 0x48, 0xb0,
+    0x79, 0xb8, 0xbc, 0xb8, 0xb7, 0xcb, 0x9c, 0xb8, 0x2c, 0x7e, 0x99, 0xc9,
+    0x29, 0xc7, 0x92, 0x93, 0xcb, 0x92, 0x39, 0x23, 0x99, 0x24, 0xc9, 0xd1,
+    0xff, 0x13, 0x99, 0xde, 0xb2, 0x13, 0xc0, 0x59, 0xc2, 0x3c, 0x97, 0xcc,
+    0xb9, 0x33, 0xc2, 0x7c, 0xb9, 0x3c, 0xe9, 0x27, 0xc9, 0xc2, 0x39, 0x29,
+    0x8c, 0x99, 0x08, 0x7b, 0xc8, 0x92, 0x92, 0xb8, 0xc7, 0x89, 0x98, 0xbc,
+    0x28, 0x7b, 0xb8, 0x8c, 0xb8, 0x98, 0x80, 0x9b, 0x24, 0xb8, 0x7b, 0xb4,
+    0xbb, 0x44, 0xb7, 0xa8, 0x4b, 0x41, 0x16, 0xc7, 0x31, 0x54, 0x50, 0x84,
+    0x95, 0x24, 0xd6, 0xd1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x75, 0x84,
+    0xaa, 0x0a, 0x80, 0x78, 0xa0, 0x8a, 0x48, 0xbb, 0x86, 0xbd, 0x48, 0xcb,
+    0x4c, 0xb3, 0x8b, 0xab, 0x88, 0x4c, 0xb8, 0x92, 0x79, 0x22, 0xbb, 0x29,
+    0xc7, 0x99, 0xcc, 0x92, 0xb2, 0x8c, 0x89, 0x6c, 0xc2, 0x99, 0x23, 0x78,
+    0xc3, 0x22, 0x93, 0xc8, 0x28, 0xfe, 0x13, 0xe2, 0x8e, 0x73, 0xc3, 0x29,
+    0x2c, 0x20, 0x72, 0x99, 0xcc, 0x92, 0x97, 0x2c, 0xc2, 0xc2, 0x9c, 0x7b,
+    0x93, 0x39, 0x22, 0xb7, 0xcc, 0xb9, 0xc9, 0x29, 0x79, 0x22, 0x8c, 0xc2,
+    0x97, 0x8c, 0x29, 0x22, 0x8b, 0x99, 0x8c, 0x78, 0xbb, 0x94, 0xcb, 0x99,
+    0xb0, 0x18, 0x97, 0x89, 0x48, 0xba, 0x4a, 0x88, 0x8a, 0x74, 0xba, 0xa4,
+    0x11, 0x6d, 0x72, 0x6f, 0xd0, 0x95, 0x1b, 0xf8, 0x6e, 0x10, 0xb0, 0x07,
+    0xa2, 0xf2, 0xf2, 0x07, 0x75, 0xa0, 0xab, 0x44, 0x80, 0x6b, 0x84, 0xaa,
+    0x8b, 0xd8, 0x2b, 0x4a, 0x9b, 0x18, 0xb8, 0xc7, 0xb8, 0xba, 0x4b, 0xb8,
+    0x7d, 0xcb, 0x8b, 0x99, 0xc7, 0xb9, 0x9c, 0x2b, 0x92, 0x79, 0x29, 0xbc,
+    0x2c, 0x87, 0xbc, 0xc2, 0x39, 0xe3, 0x69, 0x93, 0xc2, 0x23, 0x82, 0x6e,
+    0x92, 0xb2, 0x3b, 0x7c, 0xcb, 0x22, 0x3b, 0x97, 0x2e, 0xe2, 0x9c, 0xc9,
+    0x3c, 0x22, 0xd7, 0xcc, 0xbc, 0xc2, 0xec, 0x82, 0x6c, 0xc9, 0x92, 0x9c,
+    0x82, 0x8c, 0x62, 0x89, 0xcc, 0x9c, 0x49, 0xcc, 0x8b, 0x8c, 0x69, 0x92,
+    0x9b, 0xc9, 0xab, 0x58, 0x2c, 0x8b, 0x97, 0xbb, 0x89, 0xcc, 0xa8, 0x3b,
+    0xa4, 0xb8, 0x87, 0xba, 0xa4, 0x88, 0xad, 0x75, 0xa8, 0xa4, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74,
+    0xa4, 0xaa, 0x00, 0xb0, 0x6a, 0x04, 0xb5, 0x4b, 0x74, 0x8b, 0x8a, 0x85,
+    0xb8, 0xa6, 0x8a, 0xb9, 0x9c, 0xb7, 0x84, 0xbb, 0x4b, 0xbc, 0x3b, 0xbc,
+    0x87, 0x92, 0x9b, 0xd8, 0xbd, 0x99, 0x1b, 0x29, 0xb3, 0xcc, 0xa9, 0x72,
+    0x99, 0x2c, 0xbc, 0x30, 0x89, 0x7c, 0x29, 0x2c, 0x22, 0xd7, 0x99, 0xc9,
+    0xcb, 0xbc, 0x92, 0x2b, 0xe2, 0x7c, 0xec, 0x29, 0xcc, 0x90, 0x62, 0x3c,
+    0x23, 0xcb, 0x72, 0x39, 0xce, 0x9b, 0xe7, 0x99, 0x29, 0x29, 0x92, 0x8c,
+    0x68, 0x92, 0x9b, 0x9c, 0x3b, 0xcc, 0x87, 0x9d, 0xb8, 0x9c, 0x8b, 0x7c,
+    0xb9, 0xc8, 0xd8, 0xa9, 0xb3, 0x88, 0xc8, 0x9b, 0x84, 0x5b, 0xa4, 0xb8,
+    0xb7, 0x8b, 0xb4, 0x8a, 0x8b, 0x7a, 0x4a, 0xb4, 0x11, 0x6d, 0x79, 0x60,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0xb5, 0xaa,
+    0x0a, 0xb0, 0x65, 0x80, 0xba, 0x08, 0x9b, 0xb8, 0x0a, 0x74, 0xb8, 0x8c,
+    0xb8, 0xb7, 0xab, 0xb8, 0x9b, 0x9c, 0x38, 0x8c, 0xb7, 0x8b, 0x29, 0x29,
+    0x9d, 0x8b, 0x78, 0x92, 0x99, 0xb2, 0xc7, 0x89, 0x22, 0x99, 0xcb, 0x8c,
+    0x59, 0x2c, 0x92, 0x97, 0xeb, 0x92, 0xd1, 0x1f, 0xb1, 0x4f, 0xc9, 0x2e,
+    0x7c, 0x93, 0xbc, 0x22, 0x90, 0x33, 0xcc, 0x97, 0x2c, 0x29, 0xc2, 0x2c,
+    0x79, 0x2d, 0x2c, 0x92, 0xc7, 0x92, 0x2c, 0xd8, 0x92, 0x99, 0x0c, 0x5b,
+    0xdc, 0x82, 0xc8, 0x97, 0x8d, 0x98, 0x9c, 0x2b, 0x78, 0xb8, 0x8b, 0xb8,
+    0xb7, 0x48, 0xcb, 0x8b, 0x4b, 0x2a, 0x5a, 0x7b, 0x8b, 0x48, 0xba, 0x49,
+    0x87, 0xa4, 0xab, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x67, 0x8a, 0x0a, 0x58, 0x8a, 0x58, 0xa0, 0x5a, 0x0b,
+    0x84, 0x45, 0xb8, 0x47, 0x8c, 0xa4, 0x88, 0xab, 0x78, 0xb8, 0xb9, 0xbb,
+    0x80, 0x79, 0x8c, 0xb8, 0xb2, 0xc7, 0x99, 0xbc, 0x2b, 0x9c, 0x99, 0x4c,
+    0xcb, 0x89, 0x72, 0x29, 0x2c, 0x9c, 0x90, 0x02, 0x8c, 0x62, 0x39, 0x2c,
+    0x9d, 0x81, 0xf1, 0x2b, 0x9c, 0x72, 0x3c, 0x9c, 0x22, 0xc0, 0x53, 0x92,
+    0x29, 0xd7, 0x29, 0x23, 0xc9, 0x92, 0x8c, 0x79, 0x2c, 0xbb, 0x2c, 0x27,
+    0x99, 0xb2, 0x9b, 0xbc, 0x3b, 0xdb, 0x99, 0x26, 0xc8, 0xbb, 0x89, 0x28,
+    0xb7, 0x88, 0x9d, 0xa8, 0x8c, 0x7a, 0xab, 0x89, 0xb8, 0xb0, 0x38, 0xb8,
+    0xb9, 0x84, 0x4b, 0x84, 0x88, 0xa7, 0x04, 0x5a, 0x41, 0x16, 0xa7, 0x01,
+    0xbd, 0xfd, 0x07, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x75, 0x50,
+    0xa0, 0xa8, 0x50, 0x7a, 0xa8, 0x0a, 0x4d, 0xa7, 0x08, 0x58, 0xaa, 0x8a,
+    0x7d, 0xbb, 0xa4, 0x8b, 0xa7, 0x9b, 0x8b, 0x89, 0x89, 0x0b, 0x78, 0xb9,
+    0x89, 0xcc, 0x87, 0x9b, 0x9c, 0x8c, 0xe8, 0x89, 0x72, 0x29, 0x9c, 0x29,
+    0x29, 0xb1, 0xca, 0xac, 0x42, 0x9b, 0xc9, 0x91, 0xcf, 0x91, 0x0b, 0x89,
+    0x72, 0xc2, 0xcc, 0x93, 0x90, 0x92, 0x4c, 0x9c, 0x29, 0x72, 0xec, 0x92,
+    0x9b, 0xc7, 0x8c, 0xe9, 0xb2, 0x23, 0x79, 0xbd, 0x9b, 0x99, 0xb0, 0x4b,
+    0xc8, 0xcb, 0x82, 0x6b, 0x88, 0xbb, 0xe9, 0x78, 0xbb, 0x9b, 0x98, 0xb8,
+    0xc7, 0x98, 0xa8, 0xba, 0xb9, 0xa8, 0x15, 0x89, 0xa4, 0x58, 0x8b, 0xa9,
+    0x44, 0x54, 0x11, 0x6a, 0x71, 0xf4, 0x85, 0x84, 0x95, 0x64, 0x45, 0x45,
+    0x47, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x8a, 0xa5, 0x5b,
+    0x40, 0x84, 0x9a, 0x00, 0x8b, 0x70, 0xba, 0x8a, 0x4a, 0x87, 0xb8, 0xb4,
+    0xbb, 0x84, 0x7b, 0xb8, 0x89, 0x88, 0xb0, 0x0a, 0xab, 0x28, 0x2b, 0x99,
+    0x48, 0xc9, 0xbc, 0x7b, 0x9b, 0xb9, 0xcb, 0xc7, 0x82, 0xe8, 0xcc, 0x29,
+    0x0b, 0x7c, 0x2b, 0x9c, 0x22, 0x58, 0x17, 0xdc, 0x2c, 0x2b, 0xcd, 0x81,
+    0x7d, 0x8c, 0x22, 0x9c, 0x29, 0x90, 0x19, 0x27, 0xcb, 0xbc, 0xc2, 0x93,
+    0x92, 0x2b, 0x9c, 0x7b, 0xce, 0xb9, 0x29, 0x27, 0xd9, 0xc8, 0xcc, 0x5c,
+    0x0c, 0x9b, 0x2c, 0x98, 0xab, 0x48, 0xcb, 0x8d, 0x99, 0x0a, 0xab, 0x78,
+    0x4b, 0xb8, 0x8c, 0x90, 0x98, 0x14, 0x59, 0xa1, 0x8a, 0x85, 0x8a, 0x75,
+    0x44, 0x04, 0x11, 0x6a, 0x73, 0xf5, 0x45, 0x8f, 0xff, 0x06, 0xb1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x5b, 0xa8, 0x0a, 0x40, 0x70, 0x4a,
+    0xa4, 0x4a, 0x87, 0x4b, 0xa8, 0xa4, 0x8b, 0x78, 0x8b, 0x4b, 0xaa, 0x57,
+    0xc8, 0x8b, 0xb8, 0x9c, 0x28, 0x9d, 0x9b, 0x08, 0x7b, 0x29, 0x8b, 0x22,
+    0xb7, 0xcb, 0x89, 0xb9, 0xc2, 0x89, 0x6d, 0xc8, 0xcc, 0xb2, 0x18, 0xc8,
+    0x98, 0x26, 0xc9, 0xd1, 0x19, 0xe9, 0x23, 0x92, 0xcf, 0x71, 0xd9, 0xc9,
+    0x29, 0xea, 0x20, 0x39, 0x2c, 0x88, 0xc7, 0xb2, 0x29, 0xc2, 0x98, 0x7c,
+    0xc2, 0x9d, 0xb8, 0xb8, 0x97, 0xcb, 0x99, 0xc2, 0x8b, 0x3c, 0x29, 0x87,
+    0xc9, 0x8b, 0xbc, 0xb8, 0x8b, 0x78, 0xcb, 0xb8, 0x89, 0xc8, 0x87, 0xa4,
+    0xb8, 0xb8, 0xd8, 0x3a, 0xb8, 0x48, 0xa7, 0x0a, 0xba, 0x5a, 0x0a, 0x78,
+    0x40, 0x84, 0x11, 0x6b, 0x74, 0xf4, 0x4b, 0x60, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0x4b, 0x4a, 0x0a, 0x40, 0x4b, 0x54,
+    0x54, 0x8a, 0x64, 0xab, 0x84, 0x4a, 0x78, 0x9a, 0x8d, 0xaa, 0x47, 0xa8,
+    0xb8, 0x8b, 0x98, 0x8b, 0x29, 0x8d, 0x9b, 0x59, 0xb9, 0x88, 0xb9, 0x90,
+    0x27, 0xb5, 0xcc, 0x9b, 0xc8, 0x7b, 0xc8, 0xbb, 0xdb, 0xc0, 0x58, 0x2b,
+    0xc2, 0x97, 0x29, 0xd1, 0x1c, 0xec, 0x89, 0x7c, 0x93, 0xf1, 0xf2, 0xb7,
+    0x82, 0x2c, 0x92, 0xc2, 0x69, 0xc2, 0x2b, 0xd2, 0x7c, 0xcb, 0xc2, 0xbb,
+    0xca, 0x22, 0xb8, 0xd7, 0xb9, 0xbc, 0x82, 0xc8, 0x89, 0x0c, 0x82, 0x9b,
+    0x4c, 0xb8, 0xb8, 0x8b, 0x69, 0xcc, 0xb8, 0x8b, 0x78, 0xb8, 0xac, 0x88,
+    0x4a, 0x80, 0x08, 0x7b, 0xa8, 0xa5, 0xaa, 0xb9, 0xa1, 0x4b, 0x74, 0x55,
+    0x84, 0x11, 0x6c, 0x71, 0x65, 0x84, 0x1f, 0x78, 0x68, 0x1f, 0x10, 0xb0,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7b, 0x04, 0xa5, 0x05, 0x40, 0x4b, 0x04,
+    0x4b, 0x8a, 0x70, 0xba, 0xa0, 0x4b, 0xa9, 0x85, 0xba, 0xa4, 0x8a, 0x78,
+    0xb8, 0x8a, 0x8b, 0x80, 0x5b, 0x8c, 0xbb, 0x87, 0xbb, 0xc0, 0xbb, 0x82,
+    0x79, 0x8b, 0xbd, 0xba, 0xb7, 0xc8, 0xbb, 0x8c, 0x9c, 0x82, 0x3b, 0x99,
+    0xc9, 0x90, 0xc7, 0xd1, 0x1e, 0xc9, 0x9b, 0x7c, 0xb9, 0xd1, 0xf2, 0x97,
+    0x8b, 0xc2, 0xc9, 0x89, 0x42, 0xcb, 0xc9, 0x8c, 0x6b, 0x9b, 0xcc, 0x8c,
+    0x7b, 0xb2, 0x99, 0xc9, 0xd9, 0xb6, 0xc9, 0xb2, 0x9c, 0x80, 0x02, 0x99,
+    0x3b, 0xbc, 0xa7, 0x89, 0xc9, 0xb8, 0xcb, 0x98, 0x4d, 0xa8, 0x98, 0x7b,
+    0x88, 0x4a, 0xba, 0xb0, 0x24, 0x48, 0x8a, 0x74, 0xb5, 0xaa, 0x84, 0x88,
+    0xa6, 0x08, 0x44, 0x11, 0x6d, 0x72, 0x6d, 0x40, 0x35, 0xb7, 0x68, 0x1f,
+    0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a, 0xa4, 0x54, 0x04, 0x50,
+    0x64, 0x5a, 0x4b, 0x84, 0x75, 0xa5, 0x58, 0xaa, 0x59, 0x83, 0xaa, 0x5a,
+    0x8b, 0x78, 0xaa, 0x48, 0xab, 0x90, 0x2b, 0xb8, 0x79, 0xbb, 0x8a, 0xb8,
+    0xb9, 0x93, 0x28, 0xdc, 0x9b, 0x2d, 0xba, 0x7b, 0xb8, 0xc2, 0xb2, 0x90,
+    0x39, 0x9c, 0xb7, 0xcb, 0x9c, 0xd1, 0x1c, 0x99, 0x8c, 0x69, 0xbf, 0x1f,
+    0x2b, 0x72, 0xcc, 0x9c, 0xb9, 0x20, 0x12, 0xc9, 0x22, 0x92, 0xc7, 0xba,
+    0xbc, 0x9b, 0x2b, 0x72, 0x28, 0xdb, 0xb9, 0xc9, 0xb4, 0xcb, 0x8c, 0xb0,
+    0x68, 0x29, 0xb8, 0xc9, 0x7b, 0x99, 0xc8, 0x99, 0xc9, 0x83, 0x99, 0x8a,
+    0x98, 0x6b, 0x58, 0xba, 0x5b, 0x48, 0x58, 0x8a, 0x78, 0xa5, 0x45, 0x85,
+    0x48, 0xa6, 0x58, 0xa4, 0x11, 0x6d, 0x72, 0x66, 0xf0, 0x95, 0x11, 0x6f,
+    0x11, 0x1b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x4b, 0x84, 0x95, 0x0a, 0x65,
+    0x5a, 0x4a, 0x08, 0x7a, 0xa5, 0x48, 0xaa, 0x87, 0x58, 0x4a, 0x88, 0xab,
+    0x9a, 0x5b, 0x89, 0x89, 0xb0, 0x8b, 0x68, 0x8b, 0x89, 0xba, 0xbb, 0x1c,
+    0x87, 0xcc, 0x8b, 0xc2, 0x9b, 0x7c, 0xc8, 0xbc, 0x92, 0xb0, 0x5b, 0x9c,
+    0x92, 0x99, 0xb4, 0x11, 0xc2, 0x98, 0xb7, 0x22, 0x9f, 0xfd, 0xcb, 0x79,
+    0xcc, 0xbc, 0xc9, 0xc0, 0x69, 0xc9, 0xcc, 0x8b, 0x7c, 0xbc, 0x9b, 0xcb,
+    0xc8, 0xb6, 0x29, 0xcb, 0x8b, 0xc7, 0x99, 0xbc, 0xca, 0xbc, 0x08, 0x9b,
+    0x28, 0xda, 0xab, 0x88, 0x9b, 0x04, 0x88, 0x8b, 0x78, 0xaa, 0xba, 0x4a,
+    0xb9, 0xa0, 0x9a, 0x24, 0xa8, 0x7a, 0xa0, 0xaa, 0x55, 0x47, 0x5a, 0x5a,
+    0x41, 0x16, 0xd7, 0x96, 0x56, 0xb4, 0x4d, 0x7f, 0x10, 0xb0, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x70, 0x54, 0x4a, 0x00, 0x80, 0x48, 0x48, 0x4a, 0x75,
+    0xb5, 0xa8, 0x4a, 0x47, 0x88, 0x5b, 0x4b, 0xa8, 0x74, 0x4b, 0xb8, 0x8a,
+    0xb9, 0x80, 0x1b, 0x88, 0xb8, 0xa6, 0xb4, 0x9c, 0xbb, 0x97, 0xcb, 0xcb,
+    0x88, 0x9d, 0x89, 0x8b, 0x6c, 0xb8, 0xbb, 0x92, 0x78, 0xb2, 0x29, 0xc9,
+    0xc7, 0xb1, 0x1c, 0x29, 0x29, 0x7c, 0xb9, 0xf1, 0xf9, 0x27, 0x9b, 0xcc,
+    0xb9, 0xbc, 0x79, 0x92, 0xc9, 0x2c, 0x97, 0xbc, 0x8b, 0xc9, 0x92, 0x7b,
+    0xcc, 0x98, 0x9b, 0xd7, 0x99, 0xbb, 0xdb, 0xab, 0x7b, 0x9b, 0x88, 0xcb,
+    0x97, 0xc8, 0xba, 0xd8, 0xb9, 0x78, 0xa8, 0xb8, 0xab, 0x47, 0xa8, 0x84,
+    0xab, 0xb8, 0x34, 0xab, 0x49, 0x86, 0x4a, 0xa4, 0xab, 0x07, 0xaa, 0x40,
+    0x41, 0x16, 0xd7, 0x96, 0x66, 0x6d, 0x44, 0xb6, 0xe1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x57, 0x00, 0xa0, 0xa9, 0x50, 0x84, 0x9a, 0x15, 0xb7, 0x40,
+    0xa5, 0xba, 0x4b, 0x8a, 0x64, 0xba, 0x58, 0x4a, 0x78, 0x48, 0xbb, 0x88,
+    0x90, 0x19, 0x0a, 0xb5, 0xa4, 0xbb, 0xab, 0x99, 0x52, 0x88, 0xd9, 0xc9,
+    0xb7, 0x9b, 0xc8, 0x92, 0x8c, 0x9b, 0x89, 0x82, 0x7c, 0xb1, 0x19, 0x29,
+    0xd8, 0xb6, 0xd2, 0xd1, 0xf2, 0x97, 0xb9, 0xcb, 0x99, 0x2c, 0x6b, 0x92,
+    0x98, 0xc2, 0x7c, 0xbb, 0x8c, 0xc9, 0xb9, 0x25, 0xc8, 0x8d, 0x8d, 0x9b,
+    0x48, 0xbb, 0x8b, 0x7b, 0x8c, 0x8b, 0xb8, 0x99, 0xb4, 0x8c, 0x88, 0xb7,
+    0x8c, 0xa8, 0xbb, 0xa4, 0x7c, 0xa8, 0x48, 0xb8, 0x40, 0x34, 0xab, 0x58,
+    0x87, 0x50, 0xb5, 0xa5, 0x40, 0x8a, 0x94, 0x21, 0x16, 0xd7, 0x96, 0x96,
+    0x51, 0x55, 0x41, 0x6c, 0x10, 0xb0, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x45,
+    0x50, 0x5a, 0x84, 0x24, 0x45, 0x7b, 0x54, 0xb4, 0x5a, 0x08, 0xb7, 0x5b,
+    0x8a, 0x4b, 0xa5, 0x9a, 0x18, 0x9a, 0x81, 0xa9, 0x88, 0x7b, 0x9b, 0x94,
+    0xbb, 0xa9, 0xb2, 0x89, 0x87, 0xb8, 0xd8, 0xbb, 0xcb, 0x78, 0xbb, 0x9b,
+    0x98, 0xc0, 0x32, 0x99, 0x88, 0x97, 0xdb, 0xd1, 0x19, 0x28, 0x8d, 0x7b,
+    0xc9, 0xd1, 0xf9, 0xb7, 0x22, 0xb9, 0x29, 0x92, 0x69, 0xc2, 0x99, 0xc9,
+    0x7c, 0xb8, 0xcc, 0xb2, 0x97, 0xb9, 0x9a, 0xbb, 0xd8, 0x8b, 0x6c, 0xba,
+    0xbb, 0x8b, 0x0b, 0x78, 0xcb, 0x9a, 0x8b, 0x97, 0xd8, 0xab, 0x58, 0xb4,
+    0x7d, 0xaa, 0xba, 0x8a, 0xda, 0xa2, 0x88, 0xa0, 0x25, 0x8a, 0x98, 0x74,
+    0x4a, 0xab, 0x40, 0xa7, 0x5a, 0xa5, 0x41, 0x16, 0xa7, 0xa6, 0x81, 0xb1,
+    0x4b, 0x54, 0xd7, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x4a, 0x90,
+    0x2a, 0x05, 0x34, 0xa0, 0xb7, 0xa0, 0xba, 0x55, 0xb4, 0x9a, 0x44, 0xba,
+    0x80, 0x8b, 0x68, 0x5a, 0x98, 0xba, 0x98, 0x28, 0xba, 0x8b, 0x78, 0x8d,
+    0xb8, 0x98, 0xc9, 0x88, 0xb8, 0x88, 0xb6, 0xcd, 0x8c, 0x99, 0xc9, 0x90,
+    0x52, 0x92, 0x92, 0x97, 0xcb, 0xb1, 0x1b, 0xb2, 0x8b, 0x7c, 0xb8, 0xf1,
+    0xd8, 0xd7, 0xcb, 0x92, 0xb9, 0xcb, 0x79, 0x2b, 0x92, 0xbc, 0xb7, 0xa9,
+    0xdb, 0xb9, 0x9c, 0x99, 0x4c, 0xb8, 0x8c, 0x7b, 0xcc, 0x8c, 0xb8, 0xc0,
+    0x98, 0x1b, 0x89, 0xb5, 0x8c, 0x85, 0xdb, 0x88, 0x7b, 0xaa, 0xba, 0x8b,
+    0xa7, 0x40, 0xba, 0xa4, 0x8a, 0x5a, 0xa8, 0x5a, 0x87, 0x48, 0x5b, 0xa4,
+    0x4b, 0x75, 0xa5, 0x44, 0x11, 0x6a, 0x75, 0xf4, 0x55, 0x45, 0x45, 0x44,
+    0x54, 0xa5, 0x07, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x74, 0xa4,
+    0xa0, 0xa0, 0x50, 0x9a, 0x14, 0x57, 0x4a, 0xa4, 0x8a, 0x4a, 0x88, 0x64,
+    0xba, 0x08, 0xd5, 0x98, 0x2b, 0x8b, 0x98, 0x0a, 0x68, 0xa8, 0xbb, 0x8a,
+    0x9b, 0x58, 0xbb, 0x4b, 0xc7, 0xbb, 0x88, 0xb8, 0xbc, 0x78, 0xc8, 0x9d,
+    0xac, 0x80, 0x7b, 0x92, 0x2c, 0x2b, 0xc7, 0xb1, 0x19, 0x22, 0x9c, 0x7b,
+    0xb9, 0xf1, 0xdb, 0xd7, 0x8b, 0x92, 0xc9, 0xc9, 0x79, 0x9b, 0x92, 0x9b,
+    0x27, 0x8b, 0xcc, 0x88, 0x2c, 0x78, 0xbc, 0xbb, 0x89, 0xc7, 0x8c, 0xb8,
+    0xc8, 0xbc, 0x0a, 0x7b, 0x89, 0x8c, 0xbb, 0x98, 0xb7, 0x4b, 0xaa, 0xba,
+    0x4b, 0x98, 0x1b, 0xa7, 0x0a, 0xd4, 0x85, 0x8a, 0x4a, 0xb0, 0x48, 0x7a,
+    0x4a, 0x58, 0x50, 0x58, 0xa6, 0x40, 0xa4, 0x11, 0x6a, 0x70, 0xf9, 0x51,
+    0x45, 0x94, 0x05, 0x94, 0x25, 0x57, 0xb1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x67, 0x0a, 0x05, 0x4a, 0x84, 0x9a, 0x44, 0x8a, 0x4a, 0x78, 0xb0, 0x8b,
+    0x44, 0xa7, 0xb4, 0x0a, 0xb0, 0xab, 0x78, 0x84, 0xb8, 0x49, 0xb0, 0x78,
+    0xb8, 0x8b, 0xb8, 0x47, 0xbb, 0x8c, 0xa8, 0xbc, 0x98, 0x4b, 0xd8, 0x98,
+    0x7b, 0xb8, 0xbc, 0x8b, 0x80, 0x3c, 0x89, 0xb8, 0xc7, 0x8b, 0xd1, 0x1b,
+    0xc8, 0x79, 0xc8, 0x8b, 0xd1, 0xd8, 0xc7, 0x8b, 0x2b, 0x9b, 0xcb, 0x38,
+    0x2c, 0x97, 0x2b, 0x8c, 0x2b, 0x8c, 0x7b, 0x8c, 0x89, 0xbc, 0x98, 0x87,
+    0xbc, 0x89, 0x8b, 0xb8, 0x8b, 0x78, 0xb8, 0xb9, 0xab, 0xc7, 0xb8, 0xba,
+    0xab, 0x8b, 0x74, 0xab, 0x04, 0x8a, 0x47, 0x8b, 0xb0, 0x8a, 0xa4, 0x54,
+    0xb4, 0x4a, 0xb7, 0x5a, 0x54, 0xb5, 0x40, 0x7a, 0x4a, 0xb4, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70,
+    0x55, 0x04, 0xaa, 0x40, 0x00, 0x7a, 0xa4, 0x4a, 0x4d, 0x57, 0xa4, 0xaa,
+    0x0a, 0xa4, 0x7a, 0xa4, 0x8a, 0xab, 0xab, 0x88, 0xb0, 0x05, 0xa8, 0x8b,
+    0x65, 0xa8, 0x8c, 0x8b, 0x8a, 0x98, 0x5b, 0xc9, 0x98, 0xcb, 0xb1, 0x89,
+    0x5c, 0xbb, 0x82, 0xc7, 0x8b, 0xd1, 0x18, 0xc9, 0x72, 0xb8, 0xbb, 0xd1,
+    0xd8, 0x97, 0x2b, 0xcb, 0x9b, 0xb9, 0x09, 0x7c, 0x28, 0xb2, 0x9b, 0xcb,
+    0xb4, 0xd8, 0xda, 0x87, 0xbb, 0x8b, 0xc9, 0x98, 0x9b, 0x18, 0x90, 0x69,
+    0x8a, 0xbb, 0xa5, 0x8b, 0x7a, 0x85, 0xad, 0x8b, 0x48, 0xa6, 0x08, 0xaa,
+    0xba, 0x49, 0xa2, 0xb5, 0x40, 0x15, 0x87, 0x48, 0xaa, 0x48, 0x80, 0x9a,
+    0x04, 0x75, 0x4a, 0xb4, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x75, 0x4a, 0x4a, 0x4a, 0x40, 0x74, 0x4a,
+    0xa5, 0x45, 0xb7, 0x4a, 0x45, 0xa5, 0xa4, 0x70, 0xba, 0x48, 0xb8, 0xb9,
+    0x84, 0x4b, 0x88, 0xb0, 0xb8, 0x8b, 0x68, 0x8a, 0xa8, 0xad, 0x9a, 0x28,
+    0xa8, 0x9b, 0x38, 0x92, 0x99, 0xb1, 0x8b, 0x48, 0xcb, 0xb8, 0x82, 0x8b,
+    0x81, 0x78, 0xb9, 0xbb, 0x9c, 0xb7, 0xd1, 0xd8, 0xcd, 0x8c, 0x9b, 0x18,
+    0x20, 0x0b, 0x79, 0xb9, 0xb9, 0xb9, 0x27, 0xc9, 0x89, 0xb8, 0xbd, 0xaa,
+    0x18, 0x99, 0xb0, 0x89, 0xb1, 0x8b, 0x3b, 0x8b, 0xa7, 0xba, 0x88, 0xbb,
+    0xa4, 0x8b, 0x78, 0xb4, 0x8a, 0xab, 0x57, 0x4b, 0x84, 0xbb, 0x8b, 0x85,
+    0x54, 0x4a, 0x55, 0xa7, 0x88, 0x58, 0x4a, 0xa4, 0x70, 0x50, 0x54, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67,
+    0x00, 0xa4, 0x50, 0x85, 0x78, 0x50, 0xa5, 0x0b, 0x47, 0x05, 0xa4, 0xaa,
+    0x4a, 0x70, 0x0a, 0x45, 0xa4, 0xb7, 0x88, 0x54, 0xb4, 0xba, 0x48, 0xab,
+    0xab, 0x9a, 0x74, 0xc8, 0x8b, 0xb8, 0xb7, 0x8b, 0x8b, 0xa9, 0x8b, 0x78,
+    0xb9, 0x8b, 0xd9, 0xb0, 0x09, 0x7b, 0xb9, 0x9b, 0xc9, 0x58, 0x17, 0x99,
+    0xb8, 0xbb, 0x9c, 0x7d, 0x1d, 0x9b, 0xcb, 0xc9, 0x91, 0xbc, 0x18, 0xc8,
+    0x99, 0xb4, 0xcb, 0xb9, 0xa7, 0xcb, 0x82, 0xb8, 0xb8, 0x7b, 0x8b, 0x99,
+    0x8b, 0x88, 0xb8, 0x80, 0x4c, 0x9b, 0xb8, 0x79, 0xb9, 0x8b, 0x45, 0xd8,
+    0x88, 0xa6, 0x5a, 0xa8, 0x84, 0x57, 0xa4, 0xaa, 0x58, 0x85, 0x84, 0x7a,
+    0x0a, 0x5a, 0x88, 0x58, 0xa8, 0x57, 0x0b, 0x04, 0x41, 0x16, 0xd7, 0x96,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x0a, 0x50,
+    0x45, 0x40, 0x34, 0xaa, 0x58, 0x07, 0xa4, 0x45, 0xb5, 0x4a, 0x94, 0x65,
+    0xa0, 0xa8, 0x8a, 0x98, 0x44, 0xb4, 0xba, 0x34, 0xab, 0x89, 0xa1, 0xb5,
+    0x9b, 0xa8, 0x7b, 0xb8, 0xdb, 0x48, 0xd7, 0xab, 0xa8, 0x8c, 0xb8, 0x28,
+    0xb8, 0x79, 0x2c, 0x98, 0x8d, 0x57, 0xbb, 0xc9, 0x8b, 0xa9, 0x7b, 0xd9,
+    0x8b, 0x99, 0x2a, 0x90, 0xc0, 0x38, 0xcb, 0x8a, 0xb0, 0x98, 0xb7, 0xab,
+    0x8b, 0x8b, 0x89, 0x8b, 0x68, 0xdb, 0x48, 0xda, 0x8b, 0x88, 0x3c, 0x98,
+    0xa8, 0x8a, 0xb2, 0x4a, 0xb7, 0x88, 0xab, 0xa4, 0xb4, 0x78, 0x8a, 0xa0,
+    0xa8, 0xa9, 0x80, 0x84, 0x6b, 0x0a, 0x80, 0x4a, 0x94, 0x15, 0xa7, 0x4a,
+    0x05, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x75, 0x00, 0x55, 0x05, 0x00, 0x75, 0x5a, 0x80, 0xa5, 0x09,
+    0x51, 0xb5, 0x88, 0x64, 0x4a, 0x88, 0xb8, 0x74, 0x8b, 0x94, 0x5a, 0x48,
+    0xa0, 0x64, 0xb5, 0x84, 0x5b, 0x9a, 0x0b, 0x98, 0x4b, 0x88, 0xba, 0x8b,
+    0x78, 0x9c, 0x9a, 0x8b, 0x99, 0xb0, 0x28, 0xb8, 0x7b, 0xbc, 0x98, 0xbb,
+    0x49, 0xb1, 0xc8, 0x79, 0xb9, 0x8b, 0x8b, 0xc7, 0x8b, 0xbc, 0x28, 0x9b,
+    0x18, 0xc7, 0xb8, 0xb8, 0xb8, 0xbc, 0xab, 0x88, 0x6b, 0xb8, 0xbb, 0x8c,
+    0x88, 0x6a, 0xda, 0xb8, 0x9a, 0x58, 0xba, 0x8a, 0x47, 0xb8, 0xc8, 0x4b,
+    0x80, 0x9a, 0x1b, 0x48, 0xa6, 0x55, 0xb5, 0xab, 0x48, 0x88, 0xa0, 0x40,
+    0x5a, 0x4b, 0x78, 0x0a, 0x45, 0x05, 0xa8, 0x46, 0x5a, 0x54, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x7a,
+    0x40, 0xaa, 0x45, 0x40, 0x4a, 0x04, 0xa0, 0x8a, 0x70, 0x4a, 0x0a, 0xb4,
+    0x87, 0x5a, 0x54, 0xab, 0x05, 0x8a, 0x6b, 0xa0, 0x8a, 0x8a, 0x04, 0x7a,
+    0xa4, 0x5b, 0xa8, 0xa8, 0xb6, 0x0a, 0x8b, 0xa8, 0xa8, 0xb8, 0x88, 0xb7,
+    0x88, 0xab, 0x98, 0xcb, 0x58, 0xba, 0xb8, 0xf7, 0x1f, 0x11, 0xff, 0x1f,
+    0x81, 0x7f, 0x11, 0xf1, 0xdb, 0xc7, 0x89, 0x29, 0xcb, 0x89, 0x3b, 0x2b,
+    0x88, 0xb7, 0x88, 0xbb, 0x8b, 0xdb, 0x74, 0x88, 0xbb, 0x8b, 0x99, 0x86,
+    0xbb, 0x98, 0x8b, 0x80, 0x78, 0xcb, 0x5b, 0x8b, 0x87, 0x98, 0x8d, 0xa0,
+    0xab, 0x74, 0xba, 0x88, 0xa5, 0xa7, 0x4b, 0xa4, 0x58, 0xab, 0x55, 0x05,
+    0xaa, 0x47, 0x0a, 0x50, 0x08, 0x54, 0x7a, 0xba, 0x04, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x57, 0x54, 0x0b,
+    0xa9, 0x50, 0x0a, 0x80, 0x7a, 0x0b, 0xa0, 0x4b, 0x07, 0xab, 0x45, 0x5a,
+    0x4a, 0x8b, 0x60, 0x0b, 0xb8, 0xa0, 0x8b, 0x8a, 0x54, 0x4b, 0x48, 0xa7,
+    0x0a, 0xad, 0x84, 0xa4, 0x7b, 0xaa, 0x8b, 0x9b, 0x89, 0xb6, 0x5a, 0xb8,
+    0x5c, 0xd0, 0x54, 0xba, 0xc8, 0xfa, 0x10, 0xff, 0x13, 0x1d, 0xbc, 0x78,
+    0x8c, 0xb9, 0x98, 0xd0, 0x0c, 0x7b, 0xb8, 0xad, 0x88, 0x97, 0x89, 0xbd,
+    0x88, 0xb8, 0x7c, 0xab, 0x8b, 0xb9, 0x49, 0xb0, 0x89, 0xa0, 0x68, 0xcb,
+    0x0a, 0xab, 0x84, 0x6b, 0x8b, 0xa0, 0xad, 0x70, 0xab, 0x84, 0xaa, 0x47,
+    0xab, 0xa0, 0x0b, 0xa8, 0x24, 0x0b, 0x8a, 0x74, 0x04, 0xb0, 0x45, 0x08,
+    0x46, 0xb0, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x07, 0x74, 0xa4, 0x55, 0x04, 0x00, 0x75, 0x00, 0x50,
+    0xb4, 0x07, 0x4a, 0x45, 0xa5, 0x04, 0x75, 0x4a, 0x8b, 0x40, 0xb7, 0x84,
+    0x84, 0xba, 0x4b, 0x55, 0x0a, 0xba, 0x87, 0x48, 0x8b, 0x8a, 0xa5, 0x7a,
+    0x5a, 0x98, 0xb8, 0x47, 0xbb, 0x88, 0x4a, 0xc8, 0x8b, 0x58, 0x9a, 0xb4,
+    0xda, 0xf0, 0xd9, 0xf9, 0x10, 0xd9, 0xf6, 0xdb, 0xc8, 0x8c, 0xb9, 0x80,
+    0xd0, 0x4b, 0x8b, 0x98, 0x9b, 0x58, 0x89, 0x8b, 0x88, 0xb7, 0x8b, 0x8a,
+    0xb8, 0xca, 0x74, 0xbb, 0xa8, 0x45, 0xb0, 0x38, 0xbb, 0x89, 0xa0, 0x07,
+    0x58, 0x8b, 0x50, 0xab, 0xa8, 0x34, 0x48, 0x47, 0xba, 0xb0, 0x4b, 0x84,
+    0x24, 0x4b, 0x74, 0x4a, 0x00, 0xa5, 0x48, 0x08, 0x46, 0xa0, 0x88, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07,
+    0x70, 0xa5, 0x00, 0x54, 0x00, 0x20, 0x05, 0x8a, 0x94, 0x70, 0x0a, 0x50,
+    0x55, 0x87, 0x4a, 0x84, 0xb4, 0x4b, 0x78, 0x45, 0x4a, 0x85, 0xb0, 0x5a,
+    0x5b, 0x4b, 0xa7, 0x85, 0x54, 0xaa, 0x4b, 0x7a, 0xa8, 0xba, 0xba, 0x87,
+    0xbc, 0x8b, 0xa5, 0xc9, 0x88, 0x5b, 0xa9, 0x80, 0xa7, 0xbb, 0x88, 0x98,
+    0x8d, 0x91, 0x68, 0x98, 0xb9, 0x9c, 0x79, 0x8c, 0xb8, 0x98, 0xb0, 0x6b,
+    0x8c, 0x88, 0xba, 0x8b, 0xa8, 0x6b, 0x88, 0xb8, 0xa8, 0x9b, 0x0a, 0x78,
+    0xbc, 0x8b, 0x85, 0xd0, 0x98, 0x7b, 0xaa, 0x80, 0x8b, 0xa7, 0x44, 0xa8,
+    0x8b, 0x84, 0x9a, 0x04, 0x9a, 0x5b, 0x44, 0xb5, 0x40, 0x54, 0x45, 0x54,
+    0xb7, 0x04, 0xa0, 0xa4, 0x04, 0x70, 0x0a, 0x44, 0x11, 0x6d, 0x79, 0x60,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x17, 0x09, 0x43, 0x05,
+    0x40, 0x64, 0x40, 0x4a, 0x40, 0x84, 0x60, 0xa4, 0x0a, 0x4a, 0x75, 0x84,
+    0x8b, 0x5a, 0x87, 0x55, 0x04, 0xab, 0xba, 0x5a, 0xab, 0x0a, 0x87, 0x44,
+    0xa8, 0xb8, 0x8b, 0x78, 0xa8, 0xb8, 0x4a, 0x87, 0x9b, 0x8b, 0xa8, 0xb9,
+    0x88, 0x4b, 0x89, 0x98, 0x7a, 0x8b, 0x88, 0x9b, 0x8a, 0x14, 0xdb, 0x89,
+    0x88, 0xb9, 0x94, 0xab, 0x88, 0x90, 0x2c, 0xb9, 0x9b, 0x78, 0xbb, 0x88,
+    0x98, 0x97, 0x88, 0xca, 0xa8, 0xba, 0x78, 0x98, 0x98, 0x8b, 0x48, 0xa0,
+    0x0a, 0x88, 0x7b, 0x88, 0xa8, 0x5a, 0xb8, 0x49, 0x87, 0xb4, 0x8a, 0x4a,
+    0x4a, 0x74, 0xaa, 0x4a, 0x5a, 0x50, 0x00, 0x85, 0x6b, 0x58, 0xa4, 0x40,
+    0x8a, 0x80, 0x74, 0x4a, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x05, 0xa0, 0x04, 0x80, 0x2a, 0x40,
+    0x8a, 0x80, 0x74, 0x54, 0x55, 0xaa, 0x07, 0xa5, 0x48, 0xa5, 0x4b, 0x84,
+    0x6a, 0x0a, 0xa5, 0xa4, 0x9a, 0x85, 0x6a, 0x8a, 0x8a, 0x89, 0x98, 0x0b,
+    0xa8, 0x9b, 0x04, 0x7a, 0xba, 0x8b, 0xb8, 0xa0, 0x5b, 0x88, 0xba, 0x48,
+    0xb9, 0x81, 0xad, 0xa1, 0x6f, 0xb9, 0x89, 0x9b, 0x78, 0xc8, 0xab, 0x4b,
+    0x90, 0x39, 0xb8, 0xb7, 0x9b, 0x89, 0x9b, 0xb8, 0x9b, 0x89, 0x6a, 0xa8,
+    0xa8, 0x8b, 0x79, 0xb4, 0x8b, 0x85, 0xb0, 0x5b, 0x88, 0xb4, 0x87, 0xb8,
+    0x4b, 0xa4, 0x85, 0xa8, 0x5b, 0xa0, 0xb8, 0x57, 0x8a, 0xa4, 0xd0, 0xa5,
+    0x50, 0xa5, 0x4a, 0x07, 0xa4, 0x50, 0x54, 0x45, 0x74, 0x5a, 0xa4, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x17,
+    0x0a, 0x49, 0x00, 0x25, 0x50, 0x7a, 0x50, 0x55, 0x4a, 0x07, 0xa5, 0xa0,
+    0x4b, 0xa5, 0x74, 0x58, 0xa4, 0x55, 0x49, 0x58, 0x80, 0x3a, 0x5a, 0x47,
+    0xa8, 0xaa, 0xba, 0x4b, 0x8a, 0x84, 0x7b, 0xb8, 0x48, 0xbb, 0xa7, 0x48,
+    0xb8, 0xbb, 0x8b, 0x98, 0x2b, 0xb8, 0x8b, 0x74, 0xba, 0x51, 0x1f, 0xb7,
+    0x1f, 0xdd, 0xbb, 0x89, 0x78, 0xb8, 0xaa, 0x8b, 0x80, 0x09, 0x8b, 0x8a,
+    0x6b, 0x8b, 0x9b, 0xab, 0x88, 0x9b, 0x64, 0x5b, 0xb4, 0x4a, 0x7b, 0xb5,
+    0x48, 0xb8, 0xb0, 0x59, 0xb9, 0x08, 0xab, 0x83, 0x4a, 0x84, 0x7b, 0x5b,
+    0xaa, 0x05, 0xb8, 0xa6, 0x44, 0x88, 0x45, 0x40, 0x64, 0xa4, 0x5a, 0x54,
+    0x85, 0x80, 0x95, 0x7a, 0x00, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0x0a, 0x49, 0x01, 0x54, 0x60,
+    0x4a, 0x55, 0x45, 0x74, 0x4a, 0x54, 0x55, 0x07, 0x48, 0x5a, 0xa0, 0xb8,
+    0xa4, 0x4a, 0xab, 0xb8, 0x50, 0x0a, 0xa8, 0x57, 0xa5, 0xb8, 0x4a, 0xab,
+    0x74, 0x48, 0xb8, 0x4a, 0xb7, 0x8c, 0x88, 0xaa, 0xcb, 0x88, 0x74, 0xb8,
+    0x8b, 0xb8, 0xb9, 0x80, 0xd8, 0x17, 0x8b, 0xf1, 0xfb, 0x8b, 0x78, 0x8c,
+    0xba, 0xa5, 0xa8, 0xb0, 0x0b, 0x9f, 0x0d, 0xaf, 0x3d, 0xdf, 0xda, 0xf6,
+    0xdf, 0xdb, 0x85, 0xa7, 0xb8, 0xb8, 0x8a, 0xab, 0x98, 0x34, 0xa8, 0x4a,
+    0xa6, 0x55, 0x88, 0xa8, 0x48, 0xa8, 0x47, 0xa5, 0xb5, 0x0b, 0x54, 0x85,
+    0xba, 0x05, 0x80, 0x65, 0x50, 0x4a, 0x4a, 0x90, 0x34, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0x05, 0x4a,
+    0x00, 0x40, 0x54, 0x45, 0x45, 0xa7, 0x04, 0xa0, 0x55, 0xa0, 0x74, 0xa5,
+    0x0a, 0xa0, 0xa8, 0x8a, 0x41, 0xba, 0x85, 0x74, 0x0b, 0xd0, 0x44, 0xb7,
+    0xa4, 0xba, 0x5a, 0xab, 0x78, 0x4b, 0xa8, 0xa8, 0xb9, 0x84, 0xab, 0x88,
+    0xa0, 0x68, 0x98, 0xb8, 0xb8, 0x8b, 0x65, 0xa1, 0x1d, 0x8b, 0x75, 0x11,
+    0xd4, 0xbb, 0x87, 0x9a, 0xb8, 0x48, 0xbc, 0x0b, 0x91, 0x6f, 0x11, 0xf1,
+    0x1f, 0xe1, 0x4d, 0xab, 0xb5, 0x7a, 0x8b, 0xa4, 0x8a, 0xb0, 0x88, 0x9a,
+    0x08, 0x9a, 0x58, 0xaa, 0x0a, 0xb9, 0x85, 0xa4, 0x8a, 0xa4, 0x7a, 0xa0,
+    0xaa, 0x54, 0x00, 0x15, 0x87, 0xba, 0x04, 0x00, 0xdb, 0x90, 0x0a, 0x75,
+    0x05, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x94, 0x40, 0x05, 0x05, 0x0a, 0x80, 0x74, 0xa4, 0x05,
+    0xa0, 0x59, 0x40, 0x08, 0x56, 0xa0, 0xa4, 0xa8, 0xa7, 0x40, 0x4a, 0xbb,
+    0x04, 0x1a, 0x48, 0xb7, 0x45, 0x8b, 0xa4, 0xba, 0x74, 0x88, 0xa4, 0x8b,
+    0xa7, 0x4a, 0xa4, 0xb8, 0x4a, 0x98, 0x0a, 0x1b, 0xa8, 0xb9, 0x86, 0xba,
+    0x4d, 0x1f, 0xb8, 0x96, 0x8f, 0x1f, 0xb8, 0x99, 0x83, 0xba, 0x48, 0x8b,
+    0x1b, 0xfe, 0x10, 0xfe, 0x12, 0x58, 0xd7, 0xa8, 0xaa, 0x4b, 0xa8, 0x8a,
+    0x45, 0x58, 0x84, 0x8b, 0x84, 0x6a, 0xba, 0x48, 0xa4, 0x7a, 0x88, 0x44,
+    0xa4, 0xa7, 0x0a, 0x4a, 0x5a, 0x40, 0x75, 0x5b, 0xa0, 0x05, 0x48, 0xa9,
+    0x00, 0xa7, 0x54, 0x54, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x04, 0x04, 0x00, 0x40, 0x55, 0x00,
+    0xab, 0x07, 0x4a, 0x00, 0xa5, 0x0a, 0x84, 0x7a, 0x54, 0x84, 0xb5, 0x87,
+    0xa0, 0x4a, 0x5b, 0x40, 0x25, 0xa5, 0x78, 0xa8, 0xa8, 0xab, 0x4a, 0xa0,
+    0x47, 0x8b, 0xb5, 0xa8, 0x85, 0x7a, 0x8b, 0x8a, 0x84, 0xa0, 0x48, 0x49,
+    0xb8, 0x74, 0xbd, 0x58, 0x1f, 0xd7, 0xb9, 0x8d, 0x51, 0x1d, 0x98, 0x7b,
+    0x8b, 0xb8, 0x5a, 0xb0, 0x2d, 0x1f, 0xd1, 0x0d, 0xd1, 0x5f, 0xdb, 0xb8,
+    0xa9, 0x84, 0xb8, 0xb5, 0xa0, 0x6a, 0x4a, 0xa4, 0x8a, 0x74, 0x0b, 0xb8,
+    0xa8, 0x07, 0x4b, 0x84, 0xb4, 0x5a, 0x84, 0x65, 0x4b, 0x4a, 0xa4, 0x34,
+    0x55, 0xb8, 0x07, 0x4a, 0x04, 0x04, 0x40, 0x75, 0x50, 0x54, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0x40,
+    0x5b, 0x00, 0x74, 0x40, 0x5a, 0x04, 0xa7, 0x00, 0x44, 0x0a, 0xa0, 0x7b,
+    0x54, 0x04, 0xa4, 0x07, 0xa0, 0x55, 0x4b, 0xa0, 0x8a, 0x98, 0x35, 0x50,
+    0xb7, 0xa0, 0xbb, 0x48, 0x48, 0x8a, 0x68, 0x80, 0xa8, 0x84, 0x8b, 0xaa,
+    0x4a, 0x44, 0xb9, 0x74, 0xab, 0x4d, 0x1f, 0x57, 0xb9, 0x8b, 0xbf, 0x1f,
+    0x7b, 0x48, 0xb8, 0x8b, 0x59, 0xa0, 0x2b, 0x1f, 0xd1, 0x3d, 0x11, 0xf7,
+    0x11, 0xf1, 0x1d, 0xab, 0x88, 0x74, 0x8a, 0x84, 0xba, 0x40, 0x7b, 0xaa,
+    0x80, 0x4a, 0x87, 0x0a, 0xb0, 0x58, 0x04, 0x7a, 0x85, 0xba, 0x4b, 0x57,
+    0x40, 0x5a, 0x05, 0xa4, 0x84, 0x70, 0xaa, 0x00, 0x54, 0x58, 0x48, 0x07,
+    0xa4, 0x0a, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x47, 0x54, 0x40, 0x85, 0x80, 0x50, 0xa0, 0x05, 0x09, 0x40,
+    0xb9, 0x42, 0xaa, 0x07, 0xa5, 0x40, 0x4a, 0x40, 0x7a, 0x45, 0x54, 0x4a,
+    0x00, 0xaa, 0x30, 0x4a, 0x47, 0xb5, 0x0b, 0xb4, 0x0a, 0x78, 0xa5, 0x84,
+    0x5b, 0x87, 0x48, 0x8b, 0xaa, 0x8b, 0x4a, 0x84, 0x8a, 0x98, 0x05, 0x81,
+    0x8d, 0x98, 0x5b, 0xa5, 0x11, 0xb8, 0x87, 0xb5, 0x4b, 0x8a, 0x8a, 0x2a,
+    0x1f, 0xa1, 0x4f, 0x11, 0xf1, 0x7f, 0xf1, 0x1f, 0xf1, 0xd9, 0xa0, 0x47,
+    0x8a, 0x84, 0xa4, 0xba, 0x5a, 0xab, 0x84, 0x07, 0x5a, 0x48, 0x85, 0x45,
+    0x7a, 0xb5, 0x4a, 0x8a, 0x58, 0xa7, 0x00, 0xaa, 0x04, 0xa4, 0x24, 0x40,
+    0x85, 0x60, 0x50, 0x40, 0x04, 0x80, 0x7a, 0x00, 0xa4, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x57, 0x44, 0x00,
+    0xa9, 0x50, 0x20, 0xa5, 0x94, 0x35, 0x05, 0xb8, 0x08, 0x49, 0x07, 0x54,
+    0x04, 0x55, 0x85, 0x94, 0x38, 0x40, 0x40, 0x7a, 0x85, 0x00, 0x4b, 0xa7,
+    0x58, 0x45, 0xaa, 0x4b, 0x78, 0xa0, 0x48, 0xaa, 0xb7, 0x4a, 0x88, 0xa4,
+    0x4d, 0x9a, 0x00, 0x8b, 0x88, 0x65, 0x1f, 0xad, 0xa4, 0x7a, 0xa8, 0x8f,
+    0x1d, 0x49, 0x85, 0xb8, 0x8a, 0x8b, 0x15, 0xfa, 0x14, 0xff, 0x11, 0xfe,
+    0x14, 0xda, 0x44, 0x87, 0xa8, 0xb4, 0x85, 0x8a, 0x60, 0x4d, 0xaa, 0x50,
+    0x9a, 0x55, 0x8a, 0x0a, 0xb7, 0x50, 0x55, 0x00, 0x5a, 0x70, 0x08, 0x45,
+    0x84, 0x50, 0x94, 0x90, 0x6a, 0x44, 0x00, 0x4a, 0x84, 0x90, 0x34, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x67,
+    0x40, 0x04, 0x50, 0x8a, 0x10, 0x5a, 0x05, 0x45, 0x45, 0x50, 0x84, 0x90,
+    0x1a, 0x57, 0x04, 0x0a, 0x5a, 0x05, 0x94, 0x10, 0xa0, 0x25, 0xa5, 0x70,
+    0xaa, 0xbb, 0x04, 0xa8, 0x46, 0xaa, 0x5a, 0xab, 0x08, 0xa7, 0x8b, 0x04,
+    0xba, 0xa4, 0x8a, 0x00, 0x8b, 0x70, 0xa8, 0x8a, 0x5f, 0xda, 0xa0, 0x88,
+    0xa7, 0x45, 0x1d, 0x8a, 0x8b, 0x98, 0x2b, 0xb8, 0x15, 0xfa, 0x10, 0xf9,
+    0x14, 0xff, 0x11, 0xfa, 0x13, 0xda, 0xa0, 0x9a, 0x5b, 0x05, 0xb4, 0xa0,
+    0x44, 0x88, 0x0b, 0x7a, 0x0a, 0x58, 0xa0, 0x59, 0xa7, 0x54, 0x55, 0x00,
+    0x4b, 0x70, 0x04, 0x4a, 0x55, 0x40, 0x15, 0x47, 0x50, 0x0a, 0x5a, 0x50,
+    0x85, 0x8a, 0x70, 0x04, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x75, 0x05, 0x40, 0x04, 0x00, 0x50,
+    0x50, 0x05, 0x09, 0x50, 0x49, 0x51, 0x45, 0x80, 0x6b, 0x50, 0x44, 0x54,
+    0x7b, 0x04, 0xa5, 0x40, 0xa0, 0x44, 0xab, 0x05, 0x7b, 0xaa, 0x4a, 0x84,
+    0x88, 0xa6, 0x8a, 0x0b, 0x44, 0xd8, 0xa7, 0x04, 0xca, 0x0a, 0x8a, 0x54,
+    0xa5, 0xab, 0x47, 0x5a, 0x4b, 0xb8, 0xa8, 0x8a, 0x65, 0xa4, 0x5d, 0xa4,
+    0x98, 0x55, 0xb5, 0x8b, 0x80, 0x65, 0x11, 0xf1, 0x1f, 0x91, 0x0f, 0x91,
+    0x0f, 0xa1, 0x4d, 0x4b, 0x05, 0x7d, 0xaa, 0x04, 0xb8, 0x00, 0x5a, 0xa5,
+    0x4a, 0x48, 0xa7, 0x48, 0x50, 0x85, 0x54, 0x95, 0x44, 0x80, 0x0b, 0xa0,
+    0x34, 0x5a, 0x00, 0x10, 0x59, 0x00, 0xa7, 0x05, 0xa0, 0x4a, 0x54, 0x70,
+    0x50, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x67, 0x50, 0x45, 0x05, 0x80, 0x90, 0x94, 0x1a, 0x07, 0x5a,
+    0x00, 0x50, 0x5a, 0x70, 0xaa, 0x08, 0x40, 0x47, 0x50, 0x55, 0x0a, 0xa5,
+    0x55, 0x4b, 0x44, 0xa7, 0x48, 0xaa, 0x04, 0xb5, 0x94, 0x6a, 0xb0, 0x5a,
+    0xba, 0x70, 0x0b, 0xa0, 0xab, 0x40, 0x7b, 0x00, 0xaa, 0x85, 0x47, 0xab,
+    0x4a, 0xb8, 0x8b, 0x70, 0xaa, 0x0a, 0xb0, 0xaa, 0x83, 0x0a, 0xa4, 0x1a,
+    0xf9, 0xd6, 0xfd, 0xdf, 0xdd, 0xf9, 0xd0, 0xfa, 0xd2, 0xbb, 0x08, 0x86,
+    0xba, 0x40, 0xb8, 0x00, 0x08, 0x9a, 0x80, 0x75, 0x58, 0x54, 0x8b, 0x48,
+    0xa6, 0x04, 0x50, 0x5a, 0x08, 0xa6, 0x0a, 0x40, 0x44, 0x00, 0x34, 0x40,
+    0xa7, 0x54, 0x54, 0x50, 0x45, 0x80, 0x75, 0x40, 0x04, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x90, 0x45,
+    0x05, 0x05, 0x3a, 0x00, 0x57, 0x05, 0x50, 0x4a, 0x05, 0x80, 0x84, 0x95,
+    0x40, 0x05, 0x84, 0x70, 0x45, 0x50, 0xad, 0x00, 0x7b, 0xa0, 0xa5, 0x00,
+    0xa7, 0xb0, 0x45, 0xab, 0xa0, 0x7a, 0xba, 0x04, 0xaa, 0x57, 0x4b, 0xa4,
+    0x48, 0xb8, 0x78, 0x4b, 0xa4, 0x8a, 0x47, 0x8a, 0x44, 0xb8, 0xa4, 0x88,
+    0x9a, 0x2b, 0x05, 0x7a, 0xb8, 0x48, 0xb8, 0x00, 0x3a, 0xfd, 0xf8, 0xd8,
+    0xf9, 0xd0, 0xf9, 0xd8, 0xf9, 0xd3, 0xba, 0x04, 0x7a, 0xa4, 0x5a, 0xa5,
+    0x40, 0x25, 0xa5, 0x7a, 0x4b, 0xa0, 0x58, 0x47, 0x8a, 0x4a, 0xb4, 0x50,
+    0x94, 0x7a, 0x4a, 0x05, 0x88, 0x48, 0x00, 0x65, 0x00, 0xbd, 0x0b, 0x75,
+    0x0a, 0x40, 0x0a, 0x59, 0x03, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xd0, 0x0a, 0x55, 0x04, 0x50, 0x47,
+    0x00, 0x4a, 0x04, 0x48, 0x80, 0x7a, 0x04, 0x05, 0x54, 0x57, 0x0a, 0x45,
+    0x45, 0xd0, 0x4a, 0xb5, 0x5a, 0x84, 0x8a, 0x64, 0xa4, 0x4b, 0xa4, 0x7a,
+    0xa5, 0xa4, 0xb4, 0x07, 0x4b, 0xb8, 0x48, 0xa8, 0x48, 0x5b, 0x84, 0x7a,
+    0xa8, 0xa4, 0x5a, 0xd7, 0x44, 0x5b, 0x54, 0xba, 0xa8, 0x6a, 0xa8, 0xba,
+    0x84, 0x2a, 0x1f, 0xc1, 0x5f, 0xf1, 0xf1, 0xf8, 0x16, 0xf1, 0xda, 0xa8,
+    0x47, 0xb4, 0x05, 0xab, 0x80, 0x78, 0xa5, 0x48, 0xba, 0x07, 0xaa, 0x48,
+    0x44, 0x5a, 0x70, 0x45, 0xa0, 0x0a, 0x47, 0x54, 0x54, 0x54, 0x0a, 0x55,
+    0x54, 0xaa, 0x07, 0x5a, 0x0a, 0x04, 0x05, 0x74, 0x04, 0x04, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x17, 0xab,
+    0x01, 0xa4, 0x1a, 0x08, 0x57, 0x04, 0x04, 0x55, 0x40, 0x75, 0xa5, 0x05,
+    0x44, 0x08, 0xa8, 0x07, 0x5a, 0x04, 0x5a, 0x80, 0x60, 0xb5, 0x5a, 0x5a,
+    0x70, 0x5a, 0xa0, 0xba, 0x08, 0xa6, 0x08, 0xa4, 0xb4, 0x57, 0x40, 0xba,
+    0x44, 0x05, 0x7a, 0xb5, 0xb5, 0x5a, 0x47, 0x85, 0x5a, 0xa4, 0x0a, 0x7b,
+    0xa0, 0xa8, 0x8a, 0xb7, 0xa0, 0x4a, 0xa8, 0x5a, 0x18, 0x18, 0xfb, 0x11,
+    0xfd, 0x91, 0x0f, 0x81, 0x7f, 0x1d, 0x0a, 0xa4, 0xb9, 0x43, 0x0b, 0xa4,
+    0x80, 0x74, 0xab, 0x5a, 0x05, 0xa7, 0x44, 0x04, 0xa5, 0x40, 0x9a, 0x20,
+    0xa5, 0x70, 0x4a, 0x50, 0x08, 0xa0, 0x00, 0x75, 0x45, 0x40, 0x0a, 0x4a,
+    0x50, 0x07, 0x55, 0x00, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x84, 0xa0, 0x1a, 0x00, 0x05, 0xc0, 0x44,
+    0x45, 0x50, 0x95, 0x70, 0x0a, 0x50, 0x04, 0x08, 0x46, 0x50, 0x5a, 0x50,
+    0x40, 0x25, 0x5a, 0x84, 0x85, 0x60, 0x0a, 0xa0, 0x5b, 0x74, 0xaa, 0x0a,
+    0xa0, 0xa8, 0x47, 0x04, 0xa8, 0xa4, 0x84, 0x35, 0xb0, 0xa8, 0x47, 0x85,
+    0x58, 0x85, 0xba, 0x74, 0xab, 0xa0, 0x5b, 0x59, 0x86, 0x5a, 0x8a, 0x4a,
+    0x80, 0x15, 0xfa, 0x10, 0xf9, 0x10, 0xd9, 0x10, 0xf8, 0x16, 0xf1, 0xd0,
+    0x8a, 0x47, 0xa5, 0x50, 0x4a, 0x8a, 0x00, 0x74, 0x48, 0xa4, 0xa4, 0x07,
+    0x44, 0xa4, 0x54, 0xa5, 0x70, 0x4a, 0xa0, 0x4a, 0x09, 0x43, 0x00, 0x45,
+    0x30, 0x55, 0x49, 0x05, 0x55, 0x05, 0x54, 0x80, 0x65, 0x50, 0x41, 0x16,
+    0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70,
+    0x40, 0x55, 0x00, 0x40, 0x10, 0x59, 0x02, 0xa4, 0x57, 0x0a, 0xa4, 0x55,
+    0x04, 0x70, 0xb5, 0x40, 0x04, 0xa7, 0x45, 0x40, 0xba, 0x04, 0x54, 0x4a,
+    0x05, 0xa7, 0x44, 0x04, 0xa5, 0x4a, 0x74, 0xaa, 0x45, 0xa0, 0x48, 0xa7,
+    0x0a, 0x84, 0xa8, 0xa5, 0x1a, 0x49, 0xa4, 0x04, 0x4b, 0x47, 0xa4, 0xba,
+    0x4a, 0xa4, 0x7a, 0x4d, 0x55, 0x44, 0x89, 0xa2, 0x44, 0xb0, 0x68, 0xf1,
+    0xff, 0x1f, 0x81, 0x9f, 0x91, 0x0f, 0x91, 0x4d, 0x48, 0x80, 0x74, 0xaa,
+    0x0a, 0x54, 0xa0, 0x44, 0xa5, 0x84, 0x9a, 0x00, 0x84, 0x6a, 0x0a, 0x4b,
+    0xa0, 0xa5, 0x30, 0xb0, 0x48, 0x08, 0xa8, 0x50, 0x30, 0x0a, 0x5a, 0x01,
+    0x50, 0x85, 0xa0, 0x55, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x05, 0x44, 0x00, 0x50, 0x10,
+    0x49, 0x00, 0xa7, 0x45, 0x45, 0x50, 0x4a, 0x70, 0x54, 0xaa, 0x54, 0x07,
+    0x50, 0x40, 0x54, 0xa5, 0x84, 0x04, 0x90, 0x3a, 0xa4, 0xa7, 0x44, 0x0a,
+    0xa0, 0x4a, 0x75, 0x45, 0xa4, 0x54, 0xa7, 0x4b, 0xa0, 0x5a, 0x54, 0x4a,
+    0x4b, 0xab, 0x84, 0x70, 0xb8, 0x85, 0xbb, 0x48, 0xa6, 0x0b, 0x4b, 0xb8,
+    0x57, 0x8a, 0x08, 0x0a, 0x5b, 0x0a, 0x91, 0x8f, 0x91, 0x2f, 0xf1, 0x8f,
+    0x91, 0x6f, 0x1d, 0x58, 0x84, 0x75, 0x5a, 0x4b, 0x50, 0xa0, 0x4a, 0x55,
+    0x85, 0x9a, 0x84, 0x70, 0xa4, 0xa4, 0xa5, 0x07, 0xaa, 0x0a, 0x0b, 0xa5,
+    0x94, 0x20, 0x04, 0x25, 0x4a, 0x80, 0x84, 0x90, 0x3a, 0x00, 0x59, 0x04,
+    0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x07, 0x70, 0x0a, 0x00, 0x55, 0x00, 0x80, 0x84, 0x90, 0x24, 0x04,
+    0x90, 0x55, 0x04, 0x04, 0xb9, 0x03, 0x50, 0x40, 0x95, 0x24, 0x08, 0x54,
+    0x04, 0xa5, 0x07, 0x44, 0xaa, 0x05, 0x45, 0x7a, 0x40, 0x54, 0xa4, 0xd7,
+    0x4a, 0x5b, 0x80, 0x0b, 0x84, 0x4a, 0xb4, 0x54, 0x8a, 0x65, 0x4a, 0x44,
+    0xb8, 0x70, 0x5a, 0x0a, 0x5a, 0xb8, 0x88, 0xa9, 0x02, 0xb4, 0x80, 0x4a,
+    0xf1, 0x1f, 0x81, 0x6f, 0x1f, 0xd1, 0x1f, 0xa1, 0x5f, 0xb5, 0x5a, 0x47,
+    0xd5, 0x84, 0xaa, 0x05, 0x0b, 0x70, 0x4a, 0xa5, 0x44, 0xa7, 0x54, 0x4a,
+    0x44, 0x54, 0x80, 0x65, 0x05, 0x08, 0xb4, 0x85, 0xa0, 0x55, 0x45, 0x50,
+    0x58, 0x08, 0x4a, 0x00, 0xa9, 0x03, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x05, 0x05, 0x5a, 0x40,
+    0xe0, 0x74, 0x00, 0x40, 0x05, 0x49, 0x54, 0x08, 0x04, 0x59, 0x01, 0x4a,
+    0x95, 0x70, 0x0a, 0x50, 0x45, 0x07, 0x54, 0x00, 0x4a, 0x40, 0x75, 0x44,
+    0xa5, 0xb4, 0x57, 0xab, 0x40, 0x45, 0x4a, 0x15, 0xb7, 0x50, 0x48, 0x45,
+    0x4a, 0x95, 0x58, 0x80, 0xaa, 0x49, 0xa1, 0x5b, 0x70, 0xaa, 0x04, 0x84,
+    0xb0, 0x05, 0x81, 0x8f, 0x61, 0x1f, 0x11, 0xd1, 0x9f, 0x61, 0x1f, 0xfd,
+    0x54, 0x9a, 0x34, 0x4a, 0xb9, 0x40, 0x1a, 0x57, 0xa5, 0xa0, 0x04, 0x54,
+    0x80, 0x7a, 0x55, 0x00, 0x40, 0x58, 0x09, 0x54, 0x4a, 0x05, 0xa8, 0x00,
+    0x20, 0x5a, 0x80, 0x75, 0x00, 0x55, 0x00, 0x4b, 0x03, 0x41, 0x16, 0xd7,
+    0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x75, 0x50,
+    0x4a, 0x00, 0x40, 0x30, 0x04, 0x59, 0x04, 0x4a, 0x00, 0x5a, 0x07, 0xab,
+    0x04, 0xb0, 0x0a, 0x75, 0x40, 0x5a, 0x45, 0x00, 0x10, 0x57, 0xb5, 0x04,
+    0xaa, 0x05, 0xc4, 0x3a, 0x40, 0xa8, 0x57, 0x40, 0x8a, 0x0a, 0xa0, 0x8a,
+    0x54, 0x55, 0x04, 0xa7, 0xb0, 0x44, 0xab, 0x48, 0x7b, 0x48, 0x80, 0xbb,
+    0x48, 0xa7, 0x05, 0xa5, 0x40, 0xab, 0x15, 0x18, 0xf8, 0x1c, 0xf8, 0x17,
+    0xff, 0x1f, 0x1d, 0x40, 0x7a, 0x55, 0x40, 0xaa, 0x08, 0xa0, 0x74, 0xaa,
+    0x05, 0x50, 0x58, 0xa9, 0x02, 0x5a, 0x07, 0x4a, 0x04, 0x40, 0xda, 0x70,
+    0xaa, 0x04, 0xa4, 0x50, 0x00, 0x75, 0xa0, 0x50, 0x05, 0xa9, 0x01, 0xa4,
+    0xa0, 0x34, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x67, 0x55, 0x05, 0x40, 0x84, 0x30, 0x04, 0xba, 0x03, 0xa0,
+    0x05, 0xa0, 0x7b, 0xb0, 0x45, 0x00, 0x57, 0xa0, 0x50, 0x4b, 0x40, 0x64,
+    0x4b, 0x45, 0x05, 0x7a, 0x08, 0x44, 0x04, 0x07, 0x4a, 0x55, 0xb5, 0x5b,
+    0xa5, 0x8b, 0x95, 0xc5, 0x0d, 0xa5, 0x3b, 0x55, 0xba, 0x58, 0xbe, 0x50,
+    0xb8, 0x50, 0x0b, 0xad, 0x0f, 0xad, 0x0a, 0xf5, 0x30, 0x8b, 0x07, 0x4a,
+    0x40, 0x54, 0xba, 0x85, 0x70, 0x05, 0x50, 0x48, 0xb9, 0x04, 0x4a, 0x04,
+    0x5a, 0x01, 0xba, 0x70, 0x55, 0x00, 0xa5, 0x40, 0x34, 0x05, 0xa9, 0x05,
+    0x5a, 0x05, 0x05, 0xb0, 0x34, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x54, 0x00, 0x5a, 0x00, 0x30,
+    0x05, 0xda, 0x06, 0x55, 0x04, 0x04, 0x08, 0x56, 0x40, 0x40, 0x40, 0x57,
+    0x40, 0x50, 0xba, 0x05, 0x50, 0x0a, 0x0a, 0x58, 0x49, 0x06, 0x40, 0x54,
+    0xaa, 0x58, 0x17, 0xff, 0x1f, 0xf1, 0xdf, 0x81, 0x8f, 0x41, 0x1f, 0xfd,
+    0x81, 0xaf, 0x61, 0x1d, 0xff, 0x1f, 0x81, 0x9f, 0x0d, 0x71, 0xf1, 0xf1,
+    0x1f, 0x10, 0x2d, 0xf1, 0x8f, 0x71, 0xf1, 0x1f, 0x44, 0x09, 0x47, 0x54,
+    0xaa, 0x0a, 0xa0, 0x74, 0x80, 0x4a, 0x55, 0xa0, 0x44, 0x40, 0xab, 0x80,
+    0x84, 0x6b, 0x00, 0x44, 0xa5, 0x74, 0x50, 0x50, 0x44, 0x07, 0x44, 0x05,
+    0x05, 0x05, 0x34, 0x0b, 0x59, 0x04, 0x45, 0x05, 0x4c, 0x03, 0x41, 0x16,
+    0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70,
+    0x05, 0x00, 0x4a, 0x00, 0x35, 0x04, 0xa9, 0x00, 0x49, 0x02, 0x40, 0x47,
+    0x05, 0x40, 0x05, 0x40, 0x75, 0x40, 0x50, 0x5d, 0x48, 0x00, 0x05, 0x70,
+    0x50, 0x5a, 0x50, 0xa8, 0x49, 0x03, 0x8a, 0x45, 0x8f, 0x71, 0x1f, 0xf1,
+    0xfd, 0xf8, 0x18, 0xf0, 0x0f, 0x91, 0x3d, 0x11, 0xfa, 0x11, 0xfd, 0x91,
+    0x6f, 0x11, 0xff, 0x1d, 0x91, 0x2f, 0x1f, 0x81, 0x5d, 0xff, 0x1f, 0x17,
+    0xf1, 0x1f, 0x05, 0x04, 0x70, 0x04, 0xaa, 0x50, 0x47, 0x05, 0xa4, 0x0a,
+    0x48, 0x84, 0x55, 0x40, 0x5a, 0x47, 0x50, 0x5b, 0x05, 0x45, 0x94, 0x45,
+    0x05, 0x0a, 0x90, 0x65, 0x44, 0x50, 0x45, 0x20, 0xad, 0x90, 0x55, 0x04,
+    0x04, 0xac, 0x03, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x67, 0x05, 0x50, 0x04, 0x80, 0x05, 0x70, 0x54, 0x00,
+    0x40, 0x4a, 0x01, 0x45, 0x90, 0x84, 0x80, 0x7a, 0x45, 0xa0, 0x0d, 0x58,
+    0x00, 0x5a, 0x50, 0x0a, 0xd9, 0x09, 0x45, 0x04, 0x54, 0xa5, 0x8f, 0x81,
+    0x8f, 0x81, 0x8f, 0x81, 0x8f, 0x71, 0x1f, 0x1d, 0x11, 0xfb, 0x10, 0xd8,
+    0xf8, 0x19, 0xf3, 0x11, 0xdf, 0xa1, 0x2f, 0xf1, 0x0d, 0x8f, 0x61, 0x1f,
+    0xf1, 0x1f, 0xc4, 0x75, 0x40, 0xa5, 0x00, 0x47, 0xa4, 0x0a, 0x05, 0x0a,
+    0x05, 0x80, 0x74, 0x50, 0x44, 0xa5, 0x08, 0x57, 0xa5, 0x50, 0x40, 0xa4,
+    0x80, 0x64, 0x45, 0x00, 0x50, 0x85, 0x70, 0x4d, 0x40, 0x0a, 0x48, 0x08,
+    0xab, 0x04, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x67, 0x05, 0x50, 0x05, 0x80, 0x25, 0x05, 0x90, 0x35,
+    0x00, 0x4a, 0x03, 0x45, 0x40, 0x8a, 0x80, 0x75, 0x50, 0x50, 0x0a, 0x48,
+    0x00, 0x7a, 0x50, 0x0b, 0xa0, 0x58, 0x07, 0x4a, 0x4a, 0x00, 0xa5, 0x91,
+    0xbf, 0x5d, 0xf1, 0x1f, 0x10, 0x61, 0xf1, 0x1d, 0x1f, 0xa1, 0x2f, 0x1d,
+    0x8f, 0x71, 0xf1, 0x1f, 0x11, 0xdb, 0x12, 0xff, 0x10, 0x0d, 0x8f, 0x81,
+    0x8f, 0x81, 0x6f, 0x50, 0x08, 0xa4, 0x7a, 0x04, 0xa4, 0x55, 0x47, 0x04,
+    0x04, 0x54, 0x0a, 0x75, 0x0a, 0xa0, 0x45, 0x47, 0x50, 0x04, 0xa0, 0x45,
+    0x74, 0x00, 0xa0, 0x54, 0x07, 0xa5, 0x00, 0x55, 0x05, 0x20, 0x0a, 0x90,
+    0x7a, 0x50, 0x0b, 0x50, 0x49, 0x04, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96,
+    0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x55, 0x05, 0xa0,
+    0x40, 0x04, 0x90, 0x15, 0x49, 0x01, 0x54, 0xe0, 0x0a, 0x75, 0x04, 0x50,
+    0x50, 0x59, 0x00, 0x40, 0x05, 0x90, 0x3a, 0x54, 0x58, 0x07, 0x4a, 0x45,
+    0x45, 0xa5, 0x81, 0xbf, 0x61, 0xdf, 0x11, 0xf1, 0x41, 0xf1, 0x1d, 0x8f,
+    0x81, 0x9f, 0x11, 0xd8, 0xf7, 0x1f, 0x1f, 0xf1, 0x1d, 0x91, 0x9f, 0x81,
+    0x5d, 0xff, 0x11, 0xf9, 0x13, 0xf5, 0x40, 0x78, 0xa0, 0xa0, 0xaa, 0x08,
+    0xa9, 0x05, 0x44, 0xa5, 0x05, 0x15, 0x08, 0xa6, 0x0a, 0x50, 0x04, 0x5a,
+    0x06, 0xaa, 0x00, 0x50, 0x48, 0x07, 0x5a, 0x04, 0x00, 0x40, 0x10, 0x4a,
+    0x04, 0x54, 0x04, 0x5b, 0x05, 0x45, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x04, 0x05, 0x50, 0x40,
+    0x90, 0x45, 0x50, 0x04, 0xb0, 0x04, 0x90, 0x5a, 0x44, 0x54, 0xac, 0x00,
+    0x58, 0x00, 0x24, 0x54, 0x95, 0x1a, 0x07, 0xa4, 0x4a, 0x05, 0x50, 0x85,
+    0x81, 0xef, 0x31, 0x1f, 0x10, 0x01, 0x9f, 0x1d, 0xf8, 0x16, 0xf1, 0x1f,
+    0x1d, 0xf8, 0x16, 0xf1, 0xf1, 0x1f, 0xd7, 0x11, 0xff, 0x11, 0xf1, 0x1d,
+    0xfe, 0x10, 0x47, 0xa0, 0x5a, 0x0a, 0x50, 0x94, 0x1a, 0x57, 0x00, 0x44,
+    0x5d, 0x04, 0x45, 0x0a, 0x50, 0x74, 0x04, 0x0a, 0x50, 0x57, 0x40, 0x54,
+    0x05, 0x40, 0x74, 0x0a, 0x05, 0x45, 0xa9, 0x00, 0x30, 0x40, 0x48, 0x08,
+    0x59, 0x01, 0x45, 0x90, 0x55, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x05, 0xa0, 0x14, 0x00, 0x10,
+    0x58, 0x49, 0x00, 0xaa, 0x00, 0x48, 0x07, 0xa0, 0xab, 0x00, 0x4a, 0x90,
+    0x55, 0x00, 0x44, 0x50, 0x85, 0x70, 0x50, 0x55, 0x0a, 0x47, 0x5a, 0x40,
+    0xa0, 0x05, 0xa1, 0x9f, 0x01, 0x8f, 0x81, 0x8f, 0x01, 0xbf, 0x01, 0x8f,
+    0x61, 0x1f, 0x1d, 0xf1, 0x7f, 0xf1, 0xf1, 0x1f, 0xd9, 0x14, 0xff, 0x11,
+    0xf0, 0x0d, 0xa1, 0x0f, 0x71, 0xf1, 0xf4, 0xb4, 0x57, 0xa5, 0x5a, 0x50,
+    0x8a, 0x85, 0x70, 0x04, 0x05, 0xb0, 0xa0, 0x55, 0x04, 0x54, 0x07, 0x4a,
+    0x05, 0x00, 0xa5, 0xa0, 0x24, 0x05, 0x7a, 0x0a, 0xb0, 0x04, 0xa9, 0x00,
+    0x05, 0x90, 0x34, 0x40, 0x4c, 0x07, 0x50, 0x54, 0x41, 0x16, 0xd7, 0x96,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x90, 0x45, 0x04,
+    0x50, 0x50, 0x44, 0x00, 0x4b, 0x02, 0x50, 0x47, 0x55, 0x05, 0xa0, 0x0a,
+    0xa0, 0x55, 0x40, 0x04, 0x50, 0x85, 0x7a, 0x00, 0x40, 0x5a, 0x07, 0x54,
+    0x00, 0x55, 0x05, 0x71, 0xf1, 0xff, 0x1f, 0x1a, 0xf1, 0x1f, 0x81, 0xbf,
+    0x71, 0x1f, 0xf1, 0xfd, 0x18, 0xf6, 0x11, 0xf1, 0x1f, 0xd7, 0x11, 0xf1,
+    0xf1, 0xf1, 0x0d, 0xb1, 0x8f, 0x71, 0xfa, 0xa0, 0xa4, 0x57, 0x45, 0x50,
+    0x0b, 0x04, 0x70, 0x45, 0x05, 0x54, 0x00, 0x74, 0x40, 0x55, 0x04, 0xa9,
+    0x00, 0x5a, 0x03, 0x45, 0x04, 0x75, 0x40, 0x5a, 0x00, 0x5a, 0x00, 0x44,
+    0x40, 0x0a, 0x84, 0x85, 0xa0, 0x05, 0x7a, 0x05, 0x04, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x47, 0x40, 0x0a,
+    0xa0, 0x04, 0x90, 0x14, 0x5a, 0x03, 0x55, 0x0a, 0x75, 0x00, 0xa0, 0x55,
+    0xa8, 0x07, 0x50, 0x05, 0xb0, 0x5a, 0x30, 0x4a, 0x49, 0x07, 0xaa, 0x05,
+    0x00, 0xb0, 0x95, 0xaf, 0x3d, 0xfd, 0xf8, 0xda, 0xf0, 0xaf, 0x0d, 0xaf,
+    0x6d, 0xff, 0xdd, 0xfd, 0x8f, 0x8d, 0x9f, 0x0d, 0x7f, 0xdd, 0xff, 0xdf,
+    0x10, 0x0d, 0xcf, 0x0d, 0x7f, 0xdb, 0xa0, 0xa4, 0x57, 0xb0, 0x54, 0x05,
+    0x5a, 0x70, 0x05, 0x05, 0x54, 0x00, 0x44, 0xa0, 0x40, 0x85, 0x90, 0x05,
+    0xb0, 0x7a, 0x50, 0xa5, 0x00, 0xa7, 0x05, 0xaa, 0x00, 0x40, 0x00, 0x75,
+    0xa0, 0x54, 0x45, 0xaa, 0x00, 0xa7, 0x50, 0x50, 0x41, 0x16, 0xd7, 0x96,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x85, 0x90, 0x04,
+    0x80, 0x90, 0x35, 0x40, 0x59, 0x01, 0xa5, 0x70, 0x55, 0x40, 0x40, 0x58,
+    0x48, 0x07, 0x50, 0x55, 0xa0, 0x05, 0x80, 0x85, 0x90, 0x64, 0x50, 0x45,
+    0x0b, 0x80, 0x65, 0x00, 0x45, 0x4a, 0x90, 0x54, 0xdf, 0xdf, 0xd0, 0x7d,
+    0xdf, 0xf5, 0x4a, 0x57, 0x0a, 0x40, 0x0a, 0x40, 0x7a, 0xa0, 0x45, 0x5a,
+    0x47, 0xa0, 0x05, 0x0a, 0x5b, 0x20, 0x0a, 0x80, 0x75, 0x80, 0x05, 0xa4,
+    0x09, 0x55, 0xb0, 0x45, 0x40, 0x95, 0x6a, 0x00, 0x40, 0xa5, 0x24, 0x54,
+    0x80, 0x74, 0x40, 0x04, 0x00, 0xa9, 0x04, 0xa4, 0x05, 0x4a, 0x08, 0x59,
+    0x01, 0x40, 0x00, 0x75, 0xa0, 0x45, 0x00, 0x4a, 0x00, 0x49, 0x04, 0x54,
+    0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x67, 0x5a, 0x54, 0x04, 0x80, 0xc0, 0x65, 0x50, 0x05, 0x45, 0xb0, 0x85,
+    0x60, 0x05, 0x04, 0x0a, 0xa0, 0x05, 0x15, 0x08, 0x46, 0x55, 0x00, 0x44,
+    0x09, 0x49, 0x0b, 0x44, 0xd0, 0x45, 0x0a, 0x10, 0xf0, 0x01, 0x9f, 0x75,
+    0x00, 0x50, 0xba, 0x0a, 0x58, 0x49, 0x02, 0xa5, 0x47, 0x0a, 0x50, 0x4b,
+    0x54, 0x80, 0x85, 0x70, 0x40, 0x5a, 0x40, 0x47, 0x00, 0x54, 0x50, 0x04,
+    0x85, 0x80, 0x7a, 0xd0, 0x55, 0x0b, 0xa0, 0x4a, 0x40, 0x05, 0x84, 0x90,
+    0x25, 0x0a, 0x84, 0xa5, 0xb0, 0x75, 0x40, 0x05, 0x00, 0x50, 0x05, 0xa0,
+    0x45, 0x00, 0x50, 0x85, 0xb0, 0x44, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0x04, 0x59, 0x01, 0x40, 0x40,
+    0x50, 0x04, 0xa0, 0x55, 0x05, 0x50, 0x47, 0x05, 0x5a, 0x55, 0x05, 0x90,
+    0x35, 0x50, 0x48, 0x00, 0x35, 0x44, 0x07, 0x5a, 0x05, 0x0a, 0x40, 0x95,
+    0x80, 0x84, 0x80, 0x65, 0x45, 0xa4, 0x0f, 0x81, 0x8f, 0x7f, 0x1f, 0xf5,
+    0x45, 0x47, 0x55, 0x00, 0xa4, 0x5a, 0x74, 0x50, 0x44, 0xaa, 0x57, 0x0a,
+    0x50, 0x0a, 0xa0, 0x6a, 0x05, 0xa4, 0x50, 0x7a, 0xa0, 0x50, 0x54, 0x09,
+    0x53, 0x00, 0x45, 0x80, 0x95, 0x4a, 0x40, 0x45, 0x05, 0x90, 0x05, 0x70,
+    0x0a, 0x05, 0x44, 0x57, 0x00, 0xa0, 0x54, 0x05, 0x70, 0x05, 0xa5, 0x50,
+    0x59, 0x00, 0x35, 0x50, 0x57, 0x00, 0x50, 0x50, 0x5a, 0x90, 0x65, 0x00,
+    0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2,
+    0x27, 0x05, 0xa0, 0x15, 0x00, 0x50, 0xa0, 0x5a, 0x59, 0x03, 0x50, 0x04,
+    0x90, 0x04, 0x90, 0x15, 0x07, 0x50, 0x54, 0x05, 0x04, 0x80, 0x05, 0x90,
+    0x04, 0x75, 0x04, 0x45, 0x50, 0xab, 0x45, 0x05, 0x04, 0x05, 0x90, 0x1f,
+    0x19, 0xf0, 0x6f, 0x1f, 0x1a, 0x05, 0x7a, 0xa0, 0x04, 0xb0, 0x47, 0x55,
+    0x40, 0x54, 0x4a, 0x85, 0x60, 0x4a, 0x40, 0xa0, 0x1a, 0x07, 0x4a, 0x00,
+    0x4a, 0x50, 0xa5, 0x10, 0xa8, 0x47, 0x54, 0x00, 0x54, 0x40, 0x84, 0x90,
+    0x0a, 0x30, 0x54, 0x07, 0x50, 0x5a, 0x05, 0xa5, 0x90, 0x0a, 0xd0, 0x04,
+    0x70, 0x54, 0x40, 0x04, 0x00, 0x60, 0xa0, 0x50, 0x05, 0x90, 0x15, 0x49,
+    0x06, 0x54, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x07, 0x90, 0x0a, 0xa0, 0x10, 0x58, 0x06, 0xa0, 0x04,
+    0x00, 0x48, 0x0f, 0x06, 0x50, 0x50, 0x05, 0xa9, 0x00, 0x05, 0xa0, 0x25,
+    0x04, 0x7a, 0x44, 0x04, 0x0a, 0x57, 0x00, 0x45, 0x40, 0xa4, 0x90, 0x9f,
+    0x11, 0xf0, 0x9f, 0x11, 0x58, 0x07, 0xb4, 0x04, 0x05, 0x50, 0x85, 0x90,
+    0x94, 0x40, 0x45, 0x4a, 0x80, 0x8a, 0x30, 0x0a, 0x59, 0x02, 0x45, 0x07,
+    0x5a, 0x45, 0x00, 0x4a, 0x75, 0x04, 0x5a, 0x50, 0xa9, 0x02, 0x45, 0x40,
+    0x10, 0xa9, 0x05, 0x45, 0x50, 0x0a, 0xa0, 0x84, 0x80, 0xf0, 0x34, 0x05,
+    0x00, 0x00, 0x85, 0xe0, 0x24, 0x05, 0x74, 0x40, 0x04, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x47, 0x50, 0x4a,
+    0x90, 0x05, 0x14, 0x5a, 0x01, 0x4a, 0x80, 0x85, 0x90, 0x04, 0x90, 0x0a,
+    0x80, 0x65, 0x04, 0x00, 0x5b, 0x90, 0x70, 0x5a, 0x00, 0xa4, 0x57, 0x04,
+    0x50, 0x05, 0xa4, 0x90, 0x35, 0xa0, 0xa9, 0x05, 0x4f, 0xf1, 0x1f, 0x11,
+    0xf8, 0x18, 0x57, 0x40, 0x05, 0xa0, 0x0a, 0x84, 0x75, 0x45, 0x00, 0x4a,
+    0x47, 0x0a, 0x55, 0x00, 0x5b, 0x50, 0x44, 0x08, 0xa7, 0x00, 0xa4, 0xa0,
+    0x58, 0x74, 0x05, 0x85, 0x00, 0x48, 0x57, 0x45, 0x04, 0x45, 0x50, 0x75,
+    0xa4, 0x50, 0xa5, 0x4a, 0x04, 0xa5, 0x00, 0x5e, 0x04, 0x50, 0x05, 0x48,
+    0x00, 0x20, 0x4a, 0xa0, 0x65, 0xa0, 0x0a, 0x04, 0x70, 0x55, 0x04, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37,
+    0x00, 0x5b, 0x00, 0x90, 0x25, 0x40, 0x85, 0xd0, 0x05, 0x90, 0x5a, 0x05,
+    0x00, 0xab, 0x01, 0xa0, 0x40, 0x55, 0x04, 0xc0, 0x15, 0x09, 0x43, 0x55,
+    0x05, 0x94, 0x00, 0x74, 0x08, 0xff, 0x11, 0xf0, 0x3f, 0x1f, 0x19, 0x54,
+    0x00, 0x55, 0x49, 0x03, 0x40, 0x05, 0x90, 0x5a, 0x0a, 0x44, 0xaa, 0x00,
+    0x70, 0xa0, 0x0a, 0x54, 0x59, 0x44, 0x04, 0x04, 0x09, 0x42, 0x54, 0x09,
+    0x46, 0x00, 0x50, 0x54, 0x00, 0x85, 0xa0, 0x75, 0x04, 0x40, 0x0a, 0x5d,
+    0x00, 0xa9, 0x06, 0x50, 0x40, 0x55, 0x00, 0x90, 0x44, 0xa0, 0x05, 0xd0,
+    0x64, 0x05, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x17, 0x08, 0x59, 0x01, 0x40, 0x90, 0x54, 0x54, 0x00, 0xac,
+    0x02, 0x54, 0x07, 0x54, 0x05, 0x00, 0xa4, 0x90, 0x25, 0x50, 0x90, 0x8a,
+    0x90, 0x75, 0x04, 0x45, 0x44, 0x08, 0xa9, 0x00, 0x57, 0xa0, 0x0a, 0x4f,
+    0xf1, 0x8f, 0x4f, 0x1f, 0xf5, 0x74, 0x45, 0x50, 0x0a, 0x49, 0x04, 0x44,
+    0xa5, 0x07, 0x55, 0x0a, 0x44, 0xa4, 0x90, 0x4a, 0x50, 0x45, 0x70, 0xaa,
+    0x00, 0x54, 0x09, 0x40, 0x58, 0x08, 0xa9, 0x07, 0xa5, 0x00, 0xa4, 0x05,
+    0x05, 0x90, 0x05, 0x80, 0x75, 0x44, 0xa4, 0x04, 0xac, 0x00, 0x58, 0x07,
+    0x50, 0x0a, 0x00, 0xa0, 0x90, 0x15, 0x4a, 0x04, 0xa5, 0x00, 0x58, 0x09,
+    0x42, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x17, 0x09, 0x4a, 0x00, 0x50, 0x55, 0x04, 0xa8, 0x06, 0x50, 0x05,
+    0x00, 0x49, 0x01, 0xa4, 0xb0, 0x45, 0x04, 0x05, 0x80, 0x35, 0x04, 0xaa,
+    0x01, 0xa0, 0x75, 0x54, 0x40, 0x4a, 0xb9, 0x08, 0xa6, 0x00, 0x50, 0xff,
+    0x18, 0xf0, 0x71, 0xf1, 0xfa, 0x40, 0x57, 0xa0, 0x45, 0x00, 0x84, 0x70,
+    0xa4, 0x05, 0xb4, 0x07, 0x50, 0x04, 0xa0, 0x54, 0x65, 0x00, 0x40, 0x5b,
+    0x90, 0x25, 0xa0, 0x95, 0x40, 0x04, 0xab, 0x90, 0x7a, 0xa0, 0x05, 0x04,
+    0x50, 0x15, 0x4b, 0x07, 0x54, 0x05, 0xa0, 0x45, 0x80, 0x75, 0x00, 0x50,
+    0x05, 0xbb, 0x08, 0x40, 0x30, 0x40, 0x5a, 0x01, 0x4a, 0x90, 0x85, 0x60,
+    0x40, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2,
+    0xf2, 0x27, 0x54, 0x90, 0x24, 0x05, 0x5a, 0x55, 0x00, 0x5b, 0x03, 0x50,
+    0x45, 0x90, 0x3a, 0x00, 0x59, 0x02, 0x40, 0xa9, 0x00, 0x50, 0x80, 0x75,
+    0x50, 0x55, 0x05, 0x07, 0x40, 0x40, 0x4a, 0x5a, 0x90, 0x55, 0xa0, 0x45,
+    0x0b, 0x50, 0xa5, 0xfd, 0x05, 0x7a, 0x04, 0x50, 0x04, 0xb8, 0x07, 0xa0,
+    0x04, 0xa4, 0xb5, 0x24, 0x05, 0x80, 0x65, 0x50, 0x55, 0x45, 0x90, 0x55,
+    0x04, 0x54, 0xa9, 0x07, 0xa5, 0x04, 0x40, 0x45, 0x90, 0x05, 0x70, 0x05,
+    0x54, 0x00, 0x4b, 0x01, 0x40, 0x84, 0x90, 0x7a, 0x00, 0x40, 0x04, 0x50,
+    0x10, 0xa9, 0x01, 0x50, 0x74, 0x45, 0x05, 0x54, 0x59, 0x03, 0x41, 0x16,
+    0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xe0,
+    0x25, 0x05, 0x90, 0x14, 0x5a, 0x01, 0x4a, 0x80, 0x64, 0x05, 0x50, 0x50,
+    0x85, 0x60, 0x05, 0x50, 0x05, 0x90, 0x54, 0x55, 0x00, 0x59, 0x03, 0x40,
+    0x5a, 0x74, 0x50, 0xa4, 0x5a, 0x07, 0x40, 0x05, 0x40, 0x04, 0x44, 0x04,
+    0x5d, 0x91, 0x6f, 0x11, 0xff, 0xd0, 0x8a, 0x60, 0x04, 0x05, 0x50, 0x75,
+    0x04, 0xa4, 0x0a, 0x50, 0x20, 0x0a, 0xa0, 0x0a, 0x75, 0x50, 0x04, 0x00,
+    0x57, 0x0a, 0x50, 0x50, 0xa0, 0x8a, 0xa0, 0x14, 0x00, 0xb0, 0x04, 0x75,
+    0x05, 0x04, 0x00, 0x5a, 0x01, 0x5a, 0xa0, 0x75, 0x50, 0x50, 0x55, 0x00,
+    0x10, 0xa9, 0x00, 0xaa, 0x00, 0x59, 0x07, 0x50, 0x04, 0x41, 0x16, 0xd7,
+    0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xd0, 0x05,
+    0x20, 0x05, 0x90, 0x15, 0xaa, 0x01, 0x5a, 0xc0, 0x85, 0xb0, 0x45, 0x00,
+    0x50, 0x40, 0x40, 0x5a, 0x74, 0x05, 0xa0, 0x04, 0x58, 0x06, 0x5a, 0x00,
+    0x50, 0x58, 0x49, 0x00, 0x5a, 0x00, 0x50, 0x55, 0x0d, 0x19, 0xf7, 0x11,
+    0xff, 0xa0, 0x5a, 0x90, 0x04, 0x80, 0x85, 0x60, 0x40, 0x04, 0x50, 0x50,
+    0x54, 0x04, 0x08, 0x58, 0x08, 0xa6, 0x00, 0xa4, 0x04, 0x57, 0xa0, 0x0a,
+    0x0a, 0x45, 0xb0, 0xa0, 0x44, 0x40, 0x05, 0x90, 0x15, 0xaa, 0x01, 0x5a,
+    0xc0, 0x85, 0xa0, 0x44, 0x50, 0x04, 0x80, 0x64, 0x00, 0x50, 0x0a, 0x75,
+    0x00, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x27, 0x05, 0xb0, 0x05, 0x90, 0x44, 0x40, 0x05, 0xb0, 0x8a,
+    0x60, 0x05, 0x00, 0xa5, 0x90, 0x24, 0x05, 0xa0, 0x45, 0x50, 0x45, 0x80,
+    0x85, 0x94, 0x05, 0x80, 0x65, 0xa0, 0x05, 0x45, 0x90, 0x34, 0x40, 0x49,
+    0x00, 0x50, 0x55, 0x0d, 0xf7, 0x11, 0xff, 0x1f, 0x1d, 0x80, 0x7a, 0xb0,
+    0x0a, 0x00, 0xa7, 0x50, 0x40, 0x44, 0x50, 0x90, 0x25, 0x40, 0x84, 0x80,
+    0x95, 0x60, 0x54, 0x00, 0x5a, 0x80, 0x95, 0xd0, 0xa0, 0x85, 0xa0, 0x54,
+    0x00, 0x50, 0x49, 0x00, 0xa7, 0x50, 0x05, 0x00, 0xa5, 0x90, 0x04, 0x14,
+    0x5a, 0x07, 0x50, 0x04, 0x40, 0x05, 0x74, 0x50, 0x44, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0x05, 0x08,
+    0x59, 0x00, 0x6a, 0x00, 0x54, 0x05, 0xa0, 0x75, 0x04, 0xa0, 0x05, 0x49,
+    0x01, 0x45, 0xe0, 0x1a, 0x4a, 0x01, 0x54, 0x95, 0x14, 0x5d, 0x09, 0x53,
+    0x00, 0x5a, 0x90, 0x85, 0x80, 0x75, 0x5d, 0xf1, 0x1f, 0x19, 0xf4, 0xd0,
+    0x05, 0xa8, 0x08, 0x59, 0x01, 0xa5, 0x90, 0x15, 0x00, 0x90, 0x1a, 0x4a,
+    0x06, 0x55, 0x0a, 0x40, 0x4a, 0x01, 0x40, 0x84, 0x85, 0x80, 0x85, 0x80,
+    0x00, 0x85, 0x80, 0x74, 0x40, 0x04, 0x00, 0x5a, 0x07, 0x40, 0xaa, 0x00,
+    0x54, 0x90, 0x15, 0x48, 0x00, 0x10, 0x4a, 0x00, 0xab, 0x01, 0x45, 0x70,
+    0x50, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x90, 0x45, 0x50, 0x05, 0x6a, 0x00, 0x40, 0x05, 0x70,
+    0x04, 0x04, 0x40, 0x5a, 0x04, 0x40, 0x0a, 0x4b, 0x02, 0x40, 0x40, 0x25,
+    0x54, 0xa0, 0x45, 0x50, 0x54, 0xe0, 0x14, 0x5a, 0x00, 0x59, 0x01, 0x5a,
+    0x80, 0x75, 0x5d, 0xf1, 0xff, 0x19, 0xf4, 0xa4, 0x00, 0x4a, 0x00, 0x58,
+    0x06, 0xa4, 0x00, 0x55, 0x00, 0x25, 0x04, 0x85, 0xb0, 0x4a, 0x50, 0x5a,
+    0xb0, 0x04, 0x80, 0x85, 0x90, 0x14, 0x58, 0x00, 0x00, 0x85, 0x80, 0x7a,
+    0x50, 0x04, 0x04, 0x57, 0x00, 0x40, 0x50, 0x05, 0xc0, 0x24, 0xa4, 0x80,
+    0x90, 0x44, 0x05, 0x45, 0xb0, 0x0a, 0x75, 0x04, 0x54, 0x11, 0x6d, 0x79,
+    0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x54,
+    0xa5, 0x00, 0xa0, 0x90, 0x05, 0x80, 0x65, 0x45, 0x50, 0x54, 0x80, 0x75,
+    0x04, 0x04, 0xaa, 0x5d, 0x01, 0x4a, 0x20, 0x05, 0xa0, 0x44, 0x50, 0x5a,
+    0xa0, 0x14, 0x09, 0x43, 0xa0, 0x05, 0x90, 0x0a, 0x95, 0x50, 0x05, 0x0d,
+    0xf8, 0x18, 0xf9, 0x10, 0xd7, 0x54, 0x05, 0x50, 0x40, 0xa5, 0x04, 0xb0,
+    0x54, 0x4a, 0x04, 0xaa, 0x04, 0x55, 0x05, 0xaa, 0x00, 0x57, 0x04, 0x04,
+    0xa0, 0x05, 0x90, 0x0a, 0x55, 0xa5, 0x00, 0xa9, 0x00, 0x57, 0x00, 0x45,
+    0x54, 0x05, 0x80, 0x85, 0x60, 0x40, 0x5a, 0x54, 0x90, 0xa0, 0x24, 0xa0,
+    0x85, 0xa0, 0x85, 0x60, 0x5a, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1,
+    0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x50, 0xa5, 0x04, 0x50, 0x40,
+    0x50, 0x05, 0x90, 0x15, 0x49, 0x04, 0x45, 0x00, 0x57, 0x00, 0xa0, 0x04,
+    0x05, 0x90, 0x25, 0x40, 0x30, 0x0a, 0x5d, 0x08, 0x5b, 0x06, 0x45, 0x45,
+    0x00, 0x49, 0x03, 0x50, 0xa5, 0x40, 0x05, 0x0d, 0x7f, 0xf1, 0xff, 0x11,
+    0xf7, 0x50, 0x05, 0x50, 0x0a, 0x70, 0x0a, 0x40, 0x50, 0x59, 0x00, 0x55,
+    0x04, 0x00, 0xa8, 0x07, 0x45, 0x50, 0x04, 0xa5, 0xb0, 0x64, 0x54, 0x40,
+    0x04, 0x90, 0x05, 0x20, 0xa5, 0x70, 0x45, 0x04, 0x04, 0x58, 0x08, 0x4a,
+    0x04, 0x54, 0x00, 0x57, 0x00, 0xa0, 0x05, 0x05, 0x90, 0x55, 0x04, 0x00,
+    0xad, 0x05, 0x55, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x07, 0x90, 0x45, 0x05, 0x04, 0x05, 0x90, 0x34, 0x0a,
+    0x4b, 0x04, 0x44, 0x04, 0x5a, 0x07, 0x55, 0x04, 0x40, 0x04, 0x80, 0x24,
+    0x05, 0x90, 0x85, 0xa0, 0x15, 0x08, 0x59, 0x04, 0x55, 0x00, 0xa7, 0x00,
+    0x44, 0x00, 0x50, 0x45, 0x05, 0x5d, 0xaf, 0x41, 0x1f, 0xfd, 0x70, 0x05,
+    0x44, 0x5a, 0x49, 0x03, 0xa5, 0x05, 0x90, 0x54, 0x00, 0x50, 0x59, 0x08,
+    0x59, 0x04, 0x55, 0x05, 0xa9, 0x04, 0x55, 0x00, 0xa9, 0x01, 0x40, 0x90,
+    0x15, 0x08, 0x59, 0x02, 0x40, 0xac, 0x04, 0x54, 0x00, 0x5a, 0x03, 0xa4,
+    0x05, 0x60, 0x40, 0x40, 0x04, 0x85, 0x90, 0x84, 0x90, 0x44, 0x41, 0x16,
+    0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70,
+    0x40, 0x50, 0x5a, 0x00, 0x20, 0x05, 0x90, 0x3a, 0x50, 0xaa, 0x09, 0x5a,
+    0x00, 0x5b, 0x00, 0x49, 0x00, 0x40, 0x95, 0x40, 0x50, 0x5a, 0xa0, 0x35,
+    0x05, 0xab, 0x02, 0x44, 0xa7, 0x04, 0x50, 0x40, 0x50, 0x85, 0x60, 0x45,
+    0xda, 0xb5, 0xad, 0x05, 0x90, 0x04, 0x75, 0x54, 0x00, 0x55, 0x4c, 0x00,
+    0x40, 0x05, 0x45, 0x94, 0x00, 0x85, 0x70, 0x40, 0x05, 0x05, 0xab, 0x07,
+    0x40, 0xa0, 0x55, 0x04, 0x50, 0x50, 0x55, 0x09, 0x49, 0x05, 0xb4, 0x0a,
+    0x04, 0x80, 0x64, 0x55, 0x40, 0x05, 0x90, 0x14, 0x00, 0x10, 0x49, 0x09,
+    0x51, 0x45, 0x80, 0x85, 0x70, 0x40, 0x04, 0x11, 0x6d, 0x79, 0x60, 0x96,
+    0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x44, 0x05, 0x0a,
+    0x50, 0x20, 0x05, 0x74, 0x00, 0x55, 0x0a, 0x59, 0x08, 0x5a, 0x00, 0x49,
+    0x07, 0xa0, 0x04, 0x50, 0x0a, 0x00, 0x75, 0xa0, 0x55, 0x05, 0x49, 0x04,
+    0x55, 0x0a, 0x4a, 0x01, 0xa5, 0x80, 0x6a, 0xa0, 0x45, 0x05, 0x10, 0x59,
+    0x08, 0x56, 0x00, 0x54, 0x0a, 0x59, 0x08, 0x5a, 0x04, 0x50, 0x04, 0xa9,
+    0x00, 0x40, 0x20, 0x05, 0x70, 0x5a, 0x04, 0x50, 0x59, 0x05, 0x45, 0x00,
+    0xa4, 0xa0, 0x7a, 0x40, 0x0a, 0xa0, 0x40, 0x75, 0x05, 0x0a, 0x00, 0x58,
+    0x46, 0x00, 0x54, 0x0a, 0x49, 0x01, 0x54, 0xa0, 0x55, 0x00, 0x55, 0x00,
+    0x50, 0x50, 0x04, 0x57, 0x0a, 0xa4, 0x05, 0x05, 0xa0, 0x34, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70,
+    0x0a, 0x05, 0x04, 0x00, 0x15, 0x4a, 0x04, 0x50, 0x0a, 0x5a, 0x03, 0xa0,
+    0x05, 0x90, 0x55, 0x05, 0x00, 0x49, 0x00, 0x40, 0x00, 0x75, 0xa0, 0x05,
+    0x04, 0x59, 0x05, 0x55, 0x04, 0x50, 0x74, 0x40, 0x04, 0x00, 0xa9, 0x02,
+    0xa0, 0x50, 0x30, 0x50, 0x58, 0x07, 0x50, 0x05, 0x00, 0x54, 0xa0, 0x3a,
+    0x00, 0x59, 0x00, 0x5a, 0x08, 0x40, 0x10, 0x47, 0x00, 0x5a, 0x40, 0x50,
+    0x84, 0x90, 0x75, 0x50, 0x55, 0x05, 0x48, 0x06, 0x40, 0x4a, 0x00, 0x40,
+    0x25, 0x05, 0x70, 0x50, 0x50, 0x04, 0x09, 0x52, 0x05, 0x4a, 0x03, 0xa0,
+    0x05, 0x90, 0x35, 0x04, 0x00, 0x40, 0x40, 0x04, 0x80, 0x65, 0xa4, 0x05,
+    0x05, 0x90, 0x44, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x37, 0x50, 0x4b, 0x00, 0x0a, 0xa0, 0x44, 0x50, 0xa5,
+    0x90, 0x55, 0x05, 0x00, 0xac, 0x00, 0x4a, 0x01, 0x40, 0x35, 0x0a, 0x49,
+    0x04, 0x45, 0x00, 0x5a, 0x03, 0x40, 0xa5, 0x80, 0x74, 0x00, 0x50, 0x40,
+    0x58, 0x00, 0x90, 0x0a, 0x90, 0x54, 0x55, 0x0a, 0x59, 0x02, 0xa0, 0x58,
+    0x07, 0xa4, 0x00, 0x44, 0x04, 0x90, 0x60, 0x40, 0x50, 0xa5, 0x90, 0x24,
+    0x50, 0x84, 0xc0, 0x1a, 0x48, 0x06, 0x40, 0x05, 0x04, 0x00, 0x05, 0xb0,
+    0x0a, 0xa0, 0x45, 0x00, 0xa5, 0x90, 0x55, 0x05, 0x00, 0x59, 0x00, 0x49,
+    0x00, 0xa0, 0x54, 0x05, 0x05, 0x49, 0x08, 0x56, 0x00, 0x44, 0x11, 0x6d,
+    0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x17, 0x5d,
+    0x00, 0xa0, 0x55, 0x50, 0x05, 0x49, 0x00, 0x4e, 0x03, 0x45, 0x05, 0xa0,
+    0x14, 0x00, 0x04, 0x90, 0x05, 0x90, 0x05, 0xa0, 0x54, 0x40, 0x55, 0xa9,
+    0x50, 0x4a, 0x00, 0x5a, 0x00, 0xa0, 0x04, 0x70, 0x0a, 0x40, 0x05, 0x49,
+    0x00, 0x5a, 0x08, 0x48, 0x06, 0x55, 0x05, 0x00, 0x40, 0x90, 0x44, 0x40,
+    0x04, 0x90, 0x35, 0x00, 0x5a, 0x06, 0x50, 0xa5, 0x50, 0x5a, 0x01, 0x50,
+    0xd0, 0x35, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x4a, 0x00, 0x49, 0x03, 0x55,
+    0x05, 0x60, 0x04, 0x04, 0x05, 0x90, 0x04, 0x80, 0x84, 0x90, 0x34, 0x11,
+    0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27,
+    0x0a, 0xb0, 0x05, 0x70, 0x05, 0x05, 0x00, 0x4a, 0x01, 0x45, 0xe0, 0x75,
+    0x44, 0x55, 0x04, 0x08, 0x40, 0x45, 0x50, 0x0a, 0x90, 0x94, 0x25, 0x50,
+    0x75, 0x05, 0xa0, 0x45, 0x0a, 0x55, 0x00, 0xa0, 0x40, 0x20, 0x04, 0x70,
+    0x45, 0x05, 0x00, 0x4a, 0x01, 0x54, 0xe0, 0x6a, 0x50, 0x55, 0x05, 0x70,
+    0x44, 0x55, 0x04, 0xa9, 0x06, 0x45, 0x4a, 0x40, 0x57, 0x05, 0x50, 0x4a,
+    0x04, 0x95, 0x20, 0x4a, 0xb0, 0x05, 0x70, 0x50, 0x05, 0x00, 0x4b, 0x00,
+    0x5e, 0x03, 0xa4, 0x05, 0x05, 0x70, 0x50, 0x40, 0x55, 0x08, 0x5a, 0x06,
+    0x50, 0x54, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2,
+    0xf2, 0xf2, 0x07, 0x70, 0x50, 0x04, 0x00, 0x50, 0xa0, 0x15, 0x0a, 0x59,
+    0x03, 0x50, 0x04, 0xb0, 0x64, 0x54, 0x04, 0x45, 0x90, 0xc0, 0x65, 0x00,
+    0x50, 0x04, 0x70, 0x55, 0x05, 0x00, 0xa9, 0x07, 0x55, 0x40, 0x40, 0x40,
+    0x80, 0x65, 0x00, 0x50, 0x40, 0x95, 0x04, 0x90, 0x35, 0x00, 0x49, 0x00,
+    0x57, 0x05, 0x54, 0x04, 0x45, 0x90, 0x05, 0xb0, 0x05, 0x70, 0x05, 0x04,
+    0x40, 0xab, 0x00, 0xa7, 0x00, 0x45, 0x50, 0x04, 0x10, 0x49, 0x00, 0x57,
+    0x00, 0x40, 0x40, 0x54, 0x85, 0x90, 0x35, 0x00, 0x5b, 0x09, 0x50, 0x40,
+    0x04, 0x85, 0x90, 0x04, 0xb0, 0x15, 0x07, 0x45, 0x00, 0x41, 0x16, 0xd7,
+    0x96, 0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0xa0, 0x35,
+    0x00, 0x40, 0xa0, 0x64, 0x0a, 0x40, 0x50, 0x85, 0x90, 0x15, 0x08, 0x5d,
+    0x01, 0x4a, 0x90, 0x20, 0x05, 0x80, 0x74, 0x50, 0x45, 0x00, 0x47, 0x04,
+    0xa0, 0x05, 0x0a, 0xf0, 0x10, 0x50, 0x20, 0x04, 0x80, 0x84, 0x75, 0x0a,
+    0x00, 0x40, 0x5a, 0x01, 0x50, 0x85, 0x90, 0x04, 0x90, 0x85, 0x90, 0x24,
+    0x05, 0x80, 0x74, 0x50, 0x45, 0x00, 0x47, 0x05, 0x50, 0x05, 0x05, 0xa0,
+    0x04, 0x90, 0x24, 0x05, 0x80, 0x74, 0x00, 0x44, 0x50, 0xaa, 0x00, 0x59,
+    0x04, 0x45, 0x0a, 0x59, 0x00, 0x58, 0x00, 0x00, 0x85, 0xb0, 0x5a, 0x00,
+    0x45, 0x07, 0x45, 0x00, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x67, 0x00, 0x50, 0xa5, 0x80, 0x90, 0x35, 0x50,
+    0xa7, 0x00, 0x50, 0xa5, 0x0a, 0x90, 0x1a, 0x4e, 0x03, 0x50, 0x40, 0x80,
+    0x65, 0x05, 0x40, 0x04, 0xb0, 0x84, 0x95, 0x20, 0x50, 0x85, 0xa0, 0x34,
+    0x50, 0xa0, 0x04, 0xb0, 0x35, 0x00, 0xa7, 0x00, 0x50, 0xa5, 0x4a, 0x90,
+    0x1a, 0x5a, 0x00, 0x4a, 0x00, 0x60, 0x44, 0x00, 0x50, 0x7a, 0x00, 0x40,
+    0x40, 0x48, 0x06, 0x50, 0x50, 0xa0, 0x47, 0x0a, 0x40, 0x40, 0x05, 0x24,
+    0x0a, 0xc0, 0x3a, 0x05, 0xa7, 0x00, 0x50, 0xa5, 0x5a, 0x90, 0x0a, 0xd0,
+    0xe0, 0x55, 0x05, 0x00, 0x57, 0x05, 0x04, 0x41, 0x16, 0xd7, 0x96, 0x96,
+    0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x05, 0x90, 0x05, 0x80,
+    0x90, 0x6a, 0x00, 0xa5, 0x05, 0x80, 0x75, 0x44, 0x05, 0x05, 0x08, 0x59,
+    0x04, 0x40, 0x44, 0x08, 0x40, 0x40, 0x04, 0x45, 0x80, 0x6a, 0x50, 0x50,
+    0x54, 0x80, 0x95, 0x40, 0x54, 0x5a, 0x70, 0x50, 0x05, 0x00, 0x40, 0x05,
+    0xb0, 0x7a, 0x00, 0xa4, 0x45, 0x09, 0x57, 0x40, 0x50, 0x50, 0xa5, 0x90,
+    0x34, 0x05, 0x40, 0x70, 0x54, 0x00, 0x54, 0x57, 0x00, 0xa5, 0x45, 0x05,
+    0x90, 0x95, 0x10, 0x57, 0x0a, 0xa0, 0x50, 0x05, 0x80, 0x85, 0xb0, 0x7a,
+    0x00, 0xa0, 0x44, 0x09, 0x57, 0x05, 0x50, 0x50, 0xa5, 0xa0, 0x40, 0x44,
+    0x05, 0x90, 0x54, 0x54, 0x00, 0xa7, 0x04, 0x50, 0x41, 0x16, 0xd7, 0x96,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x05, 0x90, 0x25,
+    0x04, 0x84, 0x95, 0x60, 0xa5, 0x04, 0x50, 0x85, 0x60, 0x05, 0x50, 0x0b,
+    0x90, 0x34, 0x50, 0xaa, 0x00, 0x30, 0x40, 0x58, 0x06, 0x4a, 0x50, 0x04,
+    0xa7, 0x00, 0x54, 0x50, 0x05, 0x70, 0x55, 0x05, 0x00, 0x59, 0x00, 0x25,
+    0x04, 0xb5, 0x60, 0x55, 0x04, 0x50, 0x85, 0x60, 0x05, 0x40, 0x0b, 0x90,
+    0x45, 0x50, 0x50, 0xc0, 0x55, 0x00, 0x5a, 0x58, 0x08, 0x57, 0x04, 0x54,
+    0x50, 0x05, 0x70, 0x55, 0x0a, 0x00, 0x50, 0x90, 0x35, 0x04, 0x0a, 0x56,
+    0x0a, 0x00, 0x55, 0x08, 0x56, 0x00, 0xa0, 0x04, 0xb9, 0x08, 0x50, 0x14,
+    0x5c, 0x05, 0x45, 0x00, 0x5a, 0x75, 0x00, 0x44, 0x11, 0x6d, 0x79, 0x60,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x27, 0x05, 0x90, 0x2a,
+    0x05, 0x75, 0x45, 0x00, 0x50, 0x5a, 0x00, 0x59, 0x00, 0x49, 0x00, 0xa9,
+    0x07, 0x40, 0x05, 0x00, 0x45, 0xa0, 0x15, 0x48, 0x07, 0x54, 0x05, 0x00,
+    0x5a, 0x90, 0x14, 0x5d, 0x01, 0x50, 0x84, 0x35, 0x04, 0x58, 0x4a, 0x05,
+    0x50, 0x40, 0x05, 0x90, 0x45, 0x00, 0x4a, 0x90, 0x44, 0x00, 0x50, 0x00,
+    0x75, 0x40, 0x40, 0x05, 0x48, 0x07, 0x40, 0x05, 0x00, 0x5a, 0x90, 0x14,
+    0x59, 0x04, 0x45, 0x00, 0x50, 0x80, 0x65, 0x50, 0x54, 0x54, 0xa0, 0x05,
+    0xa0, 0x05, 0x90, 0x45, 0x00, 0x5a, 0x90, 0x84, 0x10, 0x58, 0x06, 0x44,
+    0x04, 0x00, 0x59, 0x07, 0x50, 0x05, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91,
+    0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x90, 0x44, 0x0a, 0x40, 0x00,
+    0x85, 0x60, 0x44, 0x0b, 0x45, 0x70, 0x44, 0x00, 0x50, 0x4b, 0x00, 0x4c,
+    0x01, 0x45, 0xa0, 0x85, 0x60, 0x04, 0x00, 0x50, 0x85, 0xb0, 0x05, 0x90,
+    0x25, 0x54, 0x90, 0x84, 0x15, 0x48, 0x08, 0x56, 0x05, 0x50, 0xb4, 0x57,
+    0x04, 0x40, 0x44, 0x04, 0xa0, 0x14, 0x5b, 0x00, 0x00, 0x75, 0x50, 0x40,
+    0x05, 0x47, 0x00, 0x40, 0x05, 0x0a, 0x84, 0x90, 0x14, 0x59, 0x08, 0x59,
+    0x00, 0x70, 0x04, 0xa4, 0x00, 0x57, 0x00, 0x44, 0x0a, 0x05, 0x70, 0x44,
+    0x04, 0x50, 0x4b, 0x00, 0x58, 0x00, 0x10, 0x48, 0x06, 0x55, 0x04, 0x00,
+    0xa9, 0x07, 0x40, 0x45, 0x41, 0x16, 0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b,
+    0x07, 0xa2, 0xf2, 0xf2, 0x07, 0x70, 0x55, 0x45, 0x45, 0x00, 0x20, 0x05,
+    0xa0, 0x0a, 0xa0, 0x35, 0x04, 0x57, 0x05, 0x40, 0x45, 0x05, 0xa0, 0x34,
+    0x00, 0x50, 0xb0, 0x14, 0x5c, 0x01, 0xb5, 0xb0, 0x94, 0x00, 0x74, 0x50,
+    0x05, 0x40, 0x40, 0x14, 0x59, 0x05, 0x50, 0x40, 0x0a, 0xa0, 0x14, 0x08,
+    0x47, 0x05, 0x50, 0x55, 0x05, 0xa0, 0x04, 0x50, 0x05, 0x00, 0x48, 0x08,
+    0x5c, 0x00, 0xbc, 0x08, 0x46, 0x00, 0x54, 0x00, 0x50, 0x45, 0x04, 0x0a,
+    0x80, 0x65, 0x50, 0x40, 0x4a, 0x90, 0x35, 0x40, 0x58, 0x06, 0x54, 0x05,
+    0x54, 0x58, 0x00, 0x50, 0x04, 0x00, 0x5b, 0x08, 0x5b, 0x03, 0x41, 0x16,
+    0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x67, 0x22, 0xc2, 0x2c, 0xf2, 0x72,
+    0xc2, 0x2c, 0x22, 0x77, 0x00, 0x50, 0x40, 0x54, 0x90, 0x35, 0x40, 0x59,
+    0x01, 0x40, 0x94, 0x90, 0x14, 0x08, 0x56, 0x04, 0x00, 0x50, 0x59, 0x00,
+    0x20, 0x05, 0x80, 0x85, 0x80, 0x65, 0x00, 0x55, 0x05, 0x84, 0xf0, 0x20,
+    0x45, 0x80, 0x20, 0x54, 0x90, 0x35, 0x00, 0x59, 0x01, 0x40, 0x94, 0x90,
+    0x55, 0x05, 0x50, 0x4a, 0x00, 0x40, 0xb0, 0x05, 0x80, 0x85, 0x80, 0x65,
+    0x00, 0x4a, 0x05, 0xb0, 0x04, 0xc0, 0x05, 0x05, 0x90, 0x04, 0xa0, 0x35,
+    0x00, 0x59, 0x04, 0x40, 0x05, 0x49, 0x01, 0x50, 0x85, 0xa0, 0x80, 0x64,
+    0x04, 0x00, 0x45, 0x80, 0x85, 0x80, 0x65, 0x00, 0x41, 0x16, 0xd7, 0x96,
+    0x96, 0x91, 0xf1, 0x0b, 0x07, 0xa2, 0xf2, 0xf2, 0x37, 0x00, 0x5b, 0x00,
+    0x64, 0x00, 0x50, 0x05, 0x90, 0x35, 0x00, 0x4a, 0x03, 0x50, 0x54, 0xa0,
+    0x34, 0x04, 0x08, 0x50, 0x80, 0x75, 0x04, 0x00, 0xa0, 0xa8, 0x07, 0x50,
+    0x05, 0x45, 0x05, 0x90, 0x2a, 0x04, 0x90, 0x05, 0x80, 0xc0, 0x34, 0x00,
+    0xa9, 0x03, 0x50, 0x05, 0xc0, 0x15, 0x4c, 0x00, 0x40, 0x20, 0x54, 0x80,
+    0x7a, 0x04, 0x00, 0x50, 0xa8, 0x07, 0x50, 0x05, 0x05, 0x05, 0x90, 0x2b,
+    0x05, 0x90, 0x34, 0x00, 0x5b, 0x04, 0x40, 0x05, 0x09, 0x52, 0x00, 0x4c,
+    0x03, 0x50, 0x04, 0x80, 0x50, 0x05, 0x05, 0x47, 0x05, 0x50, 0x40, 0x05,
+    0x70, 0x50, 0x44, 0x11, 0x6d, 0x79, 0x60, 0x96, 0x91, 0xf1, 0x0b, 0x07,
+    0xa2, 0xf2, 0xf2, 0x27, 0x05, 0xc0, 0x25, 0x05, 0x80, 0x64, 0x00, 0x50,
+    0x54, 0xc0, 0x24, 0x05, 0xa0, 0x64, 0x00, 0x40, 0x45, 0x10, 0x5a, 0x01,
+    0x45, 0xf0, 0x65, 0x0a, 0x40, 0x0a, 0x85, 0x90, 0x04, 0x80, 0x90, 0x24,
+    0x0a, 0x80, 0x64, 0x50, 0x54, 0x54, 0xe0, 0x05, 0xa0, 0x34, 0x00, 0x40,
+    0x40, 0x54, 0x05, 0xa0, 0x34, 0x50, 0x4d, 0x00, 0x47, 0x0a, 0x40, 0x0a,
+    0x45, 0x90, 0xc0, 0x54, 0x0a, 0x00, 0x58, 0x09, 0x50, 0x4e, 0x05, 0x50,
+    0x04, 0x40, 0xa0, 0x34, 0x00, 0x5a, 0x08, 0x57, 0x04, 0x00, 0x41, 0x16,
+    0xd7, 0x96, 0x96, 0x91, 0xf1, 0x0b, 0x77, 0x22, 0xc2, 0x2c, 0x2f, 0x27,
+    0xc2, 0x2c, 0x22, 0x74, 0x90, 0x35, 0x05, 0x00, 0x55, 0x04, 0x40, 0x5b,
+    0x08, 0x5a, 0x00, 0x47, 0x05, 0x50, 0x04, 0x54, 0xa0, 0x84, 0x20, 0x50,
+    0x74, 0x04, 0x50, 0x05, 0xa9, 0x00, 0x49, 0x05, 0x44, 0x00, 0x45, 0x74,
+    0x00, 0x40, 0x04, 0x50, 0x00, 0x75, 0x05, 0x04, 0x00, 0x59, 0x01, 0x40,
+    0x85, 0xa0, 0x34, 0x05, 0x49, 0x08, 0x49, 0x00, 0x50, 0x50, 0x05, 0x07,
+    0x40, 0x5a, 0x00, 0x5a, 0x90, 0x04, 0x80, 0x64, 0x04, 0x00, 0x45, 0x90,
+    0x14, 0x00, 0x00, 0xa5, 0x30, 0x50, 0x48, 0x07, 0x50, 0x04, 0x00, 0x54,
+    0xa0, 0x05, 0x70, 0x55, 0x00, 0x50, 0x40, 0xa0, 0x65, 0x00, 0x54, 0x40,
+    0x75, 0x50, 0x0a, 0x50, 0x4a, 0x1f, 0x10, 0xc1, 0xf1, 0x0b, 0x17, 0xc8,
+    0x2f, 0x2f, 0x27, 0xc7, 0x40, 0x05, 0xa0, 0x85, 0x05, 0xa0, 0x7a, 0x50,
+    0x05, 0x04, 0xa7, 0x00, 0x54, 0x00, 0xa5, 0x80, 0x85, 0x64, 0x40, 0x55,
+    0x05, 0x50, 0x05, 0x00, 0x59, 0x01, 0xa4, 0x90, 0x45, 0x44, 0x04, 0x90,
+    0x55, 0x54, 0x05, 0x48, 0x08, 0xa0, 0x10, 0xa8, 0x5a, 0x07, 0xa4, 0x00,
+    0x50, 0x5a, 0x70, 0x05, 0x40, 0x0a, 0x57, 0x00, 0x55, 0x40, 0x0a, 0x05,
+    0x74, 0x40, 0x05, 0x00, 0x49, 0x00, 0xba, 0x01, 0xa4, 0xc0, 0x45, 0x54,
+    0x05, 0x80, 0x40, 0x5a, 0x0a, 0x85, 0xa0, 0x7a, 0x40, 0x05, 0x0a, 0x58,
+    0x08, 0x58, 0x06, 0xa5, 0x00, 0x55, 0x40, 0x80, 0x95, 0x80, 0x85, 0x80,
+    0x74, 0x00, 0x5a, 0x00, 0x4a, 0x1f, 0x10, 0xc1, 0xf1, 0x0b, 0x07, 0x8c,
+    0xf2, 0xf2, 0x2c, 0xc7, 0x75, 0x00, 0xa4, 0x05, 0x00, 0x05, 0xa0, 0x0a,
+    0x90, 0x3a, 0x00, 0x49, 0x04, 0x50, 0x54, 0x58, 0x08, 0xa9, 0x03, 0x55,
+    0x05, 0x20, 0x05, 0xc0, 0x1a, 0x08, 0x46, 0x05, 0x04, 0x00, 0x58, 0x07,
+    0x55, 0x04, 0x05, 0x40, 0x85, 0x90, 0x05, 0xa0, 0x0a, 0x90, 0x3a, 0x00,
+    0x49, 0x01, 0x40, 0x95, 0x30, 0x0a, 0x59, 0x00, 0xa0, 0x55, 0x04, 0x00,
+    0x5c, 0x02, 0xa0, 0x57, 0x00, 0x50, 0x50, 0x04, 0x80, 0x65, 0x54, 0x00,
+    0x40, 0x60, 0xa4, 0x05, 0x05, 0xa0, 0x0a, 0x90, 0x3a, 0x00, 0x49, 0x01,
+    0x40, 0x95, 0x40, 0x0a, 0x50, 0x80, 0x6a, 0x50, 0x40, 0x05, 0xb0, 0x24,
+    0xa0, 0x84, 0xa1, 0xf1, 0xc1, 0xf1, 0x0b, 0xc7, 0xf7, 0xf7, 0x20, 0xa4,
+    0xb0, 0x90, 0x05, 0xb0, 0x04, 0xd0, 0x34, 0x40, 0xa8, 0x08, 0x5c, 0x00,
+    0x50, 0x44, 0x05, 0x04, 0x90, 0xf0, 0x64, 0x05, 0x00, 0x5a, 0x70, 0x50,
+    0x05, 0x00, 0x40, 0xc0, 0x0a, 0xb0, 0x04, 0xe0, 0x24, 0x0a, 0x80, 0x85,
+    0xa0, 0x70, 0x0a, 0x00, 0x40, 0x49, 0x0f, 0x02, 0x50, 0x58, 0x06, 0x4a,
+    0x05, 0x00, 0x50, 0x20, 0x04, 0xc0, 0x05, 0xb0, 0x84, 0xc0, 0x84, 0x60,
+    0x50, 0x05, 0x40, 0xb0, 0x5a, 0x00, 0x40, 0x4d, 0x0b, 0x4f, 0x40, 0xc4,
+    0xf4, 0x08,
+};
+
+const tBackground g_sBackground =
+{
+    320,
+    240,
+    g_pusBgPalette,
+    g_pusBgColumns,
+    g_pucBgSegments,
+    g_pucBgData
+};
@@ -0,0 +1,223 @@
+//*****************************************************************************
+//
+// colormap.c - Tables mapping a display level or a bar's place across the
+// display to a 5-6-5 RGB color.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// THIS FILE IS GENERATED BY tools/gen_colormap.py.  DO NOT EDIT.
+//
+//*****************************************************************************
+
+#include "colormap.h"
+
+#if (COLORMAP_SIZE != 256) || (COLORMAP_FULL_SCALE != 185) || \
+    (NUM_BAR_PALETTES != 4)
+#error "colormap.h and colormap.c disagree on the table layout"
+#endif
+
+//
+// Heat: black through purple and red to pale yellow
+//
+const unsigned short g_pusColormapHeat[COLORMAP_SIZE] =
+{
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002,
+    0x0802, 0x0822, 0x0822, 0x0823, 0x0823, 0x0823, 0x0824, 0x0824,
+    0x1024, 0x1025, 0x1045, 0x1045, 0x1045, 0x1046, 0x1046, 0x1046,
+    0x1047, 0x1847, 0x1847, 0x1867, 0x1868, 0x1868, 0x2068, 0x2068,
+    0x2068, 0x2068, 0x2869, 0x2869, 0x2869, 0x2869, 0x3069, 0x3069,
+    0x308a, 0x308a, 0x388a, 0x388a, 0x388a, 0x408a, 0x408a, 0x408b,
+    0x408b, 0x488b, 0x488b, 0x488b, 0x488b, 0x50ac, 0x50ac, 0x50ac,
+    0x50ac, 0x58ac, 0x58ac, 0x58ac, 0x60ad, 0x60ad, 0x60ad, 0x60ad,
+    0x68ad, 0x68ad, 0x68cd, 0x68cd, 0x70cd, 0x70cd, 0x70ed, 0x78ed,
+    0x78ed, 0x78ed, 0x78ed, 0x810c, 0x810c, 0x810c, 0x810c, 0x890c,
+    0x892c, 0x892c, 0x912c, 0x912c, 0x914c, 0x914c, 0x994b, 0x994b,
+    0x994b, 0xa16b, 0xa16b, 0xa16b, 0xa16b, 0xa96b, 0xa98b, 0xa98b,
+    0xa98b, 0xb18a, 0xb1aa, 0xb1aa, 0xb9aa, 0xb9aa, 0xb9aa, 0xb9ca,
+    0xc1ca, 0xc1e9, 0xc1e9, 0xc209, 0xc209, 0xca29, 0xca28, 0xca48,
+    0xca48, 0xd248, 0xd267, 0xd267, 0xd287, 0xd287, 0xdaa7, 0xdaa6,
+    0xdac6, 0xdac6, 0xe2c6, 0xe2e6, 0xe2e5, 0xe305, 0xe305, 0xeb25,
+    0xeb25, 0xeb44, 0xeb44, 0xeb64, 0xeb84, 0xeb84, 0xeba4, 0xf3c4,
+    0xf3c4, 0xf3e4, 0xf404, 0xf404, 0xf424, 0xf444, 0xf464, 0xf464,
+    0xf483, 0xf4a3, 0xf4a3, 0xf4c3, 0xf4e3, 0xf4e3, 0xf503, 0xfd23,
+    0xfd23, 0xfd43, 0xfd63, 0xfd83, 0xfd83, 0xfda3, 0xfdc3, 0xfdc4,
+    0xfde5, 0xfe05, 0xfe06, 0xfe26, 0xfe47, 0xfe48, 0xfe68, 0xfe89,
+    0xfe89, 0xfeaa, 0xfecb, 0xfecb, 0xfeec, 0xfeed, 0xff0d, 0xff2e,
+    0xff2e, 0xff4f, 0xff70, 0xff70, 0xff91, 0xffb2, 0xffb2, 0xffd3,
+    0xfff3, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4,
+    0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4,
+    0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4,
+    0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4,
+    0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4,
+    0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4,
+    0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4,
+    0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4,
+    0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4, 0xfff4,
+};
+
+//
+// Gradient: blue through to red
+//
+const unsigned short g_pusPaletteGradient[COLORMAP_SIZE] =
+{
+    0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x081e, 0x081e, 0x081e, 0x081e, 0x081e, 0x081e, 0x081e, 0x081e,
+    0x101d, 0x101d, 0x101d, 0x101d, 0x101d, 0x101d, 0x101d, 0x101d,
+    0x181c, 0x181c, 0x181c, 0x181c, 0x181c, 0x181c, 0x181c, 0x181c,
+    0x201b, 0x201b, 0x201b, 0x201b, 0x201b, 0x201b, 0x201b, 0x201b,
+    0x281a, 0x281a, 0x281a, 0x281a, 0x281a, 0x281a, 0x281a, 0x281a,
+    0x3019, 0x3019, 0x3019, 0x3019, 0x3019, 0x3019, 0x3019, 0x3019,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x4017, 0x4017, 0x4017, 0x4017, 0x4017, 0x4017, 0x4017, 0x4017,
+    0x4816, 0x4816, 0x4816, 0x4816, 0x4816, 0x4816, 0x4816, 0x4816,
+    0x5015, 0x5015, 0x5015, 0x5015, 0x5015, 0x5015, 0x5015, 0x5015,
+    0x5814, 0x5814, 0x5814, 0x5814, 0x5814, 0x5814, 0x5814, 0x5814,
+    0x6013, 0x6013, 0x6013, 0x6013, 0x6013, 0x6013, 0x6013, 0x6013,
+    0x6812, 0x6812, 0x6812, 0x6812, 0x6812, 0x6812, 0x6812, 0x6812,
+    0x7011, 0x7011, 0x7011, 0x7011, 0x7011, 0x7011, 0x7011, 0x7011,
+    0x7810, 0x7810, 0x7810, 0x7810, 0x7810, 0x7810, 0x7810, 0x7810,
+    0x8010, 0x800f, 0x800f, 0x800f, 0x800f, 0x800f, 0x800f, 0x800f,
+    0x800f, 0x880e, 0x880e, 0x880e, 0x880e, 0x880e, 0x880e, 0x880e,
+    0x880e, 0x900d, 0x900d, 0x900d, 0x900d, 0x900d, 0x900d, 0x900d,
+    0x900d, 0x980c, 0x980c, 0x980c, 0x980c, 0x980c, 0x980c, 0x980c,
+    0x980c, 0xa00b, 0xa00b, 0xa00b, 0xa00b, 0xa00b, 0xa00b, 0xa00b,
+    0xa00b, 0xa80a, 0xa80a, 0xa80a, 0xa80a, 0xa80a, 0xa80a, 0xa80a,
+    0xa80a, 0xb009, 0xb009, 0xb009, 0xb009, 0xb009, 0xb009, 0xb009,
+    0xb009, 0xb808, 0xb808, 0xb808, 0xb808, 0xb808, 0xb808, 0xb808,
+    0xb808, 0xc007, 0xc007, 0xc007, 0xc007, 0xc007, 0xc007, 0xc007,
+    0xc007, 0xc806, 0xc806, 0xc806, 0xc806, 0xc806, 0xc806, 0xc806,
+    0xc806, 0xd005, 0xd005, 0xd005, 0xd005, 0xd005, 0xd005, 0xd005,
+    0xd005, 0xd804, 0xd804, 0xd804, 0xd804, 0xd804, 0xd804, 0xd804,
+    0xd804, 0xe003, 0xe003, 0xe003, 0xe003, 0xe003, 0xe003, 0xe003,
+    0xe003, 0xe802, 0xe802, 0xe802, 0xe802, 0xe802, 0xe802, 0xe802,
+    0xe802, 0xf001, 0xf001, 0xf001, 0xf001, 0xf001, 0xf001, 0xf001,
+    0xf001, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
+};
+
+//
+// Heat: purple and red through to pale yellow
+//
+const unsigned short g_pusPaletteHeat[COLORMAP_SIZE] =
+{
+    0x1868, 0x1868, 0x1868, 0x1868, 0x2068, 0x2068, 0x2068, 0x2068,
+    0x2068, 0x2068, 0x2069, 0x2869, 0x2869, 0x2869, 0x2869, 0x2869,
+    0x2869, 0x3069, 0x3069, 0x3069, 0x3069, 0x308a, 0x308a, 0x308a,
+    0x388a, 0x388a, 0x388a, 0x388a, 0x388a, 0x388a, 0x408a, 0x408a,
+    0x408b, 0x408b, 0x408b, 0x408b, 0x408b, 0x488b, 0x488b, 0x488b,
+    0x488b, 0x488b, 0x488b, 0x508b, 0x50ac, 0x50ac, 0x50ac, 0x50ac,
+    0x50ac, 0x50ac, 0x58ac, 0x58ac, 0x58ac, 0x58ac, 0x58ac, 0x58ad,
+    0x60ad, 0x60ad, 0x60ad, 0x60ad, 0x60ad, 0x60ad, 0x68ad, 0x68ad,
+    0x68ad, 0x68cd, 0x68cd, 0x68cd, 0x68cd, 0x70cd, 0x70cd, 0x70cd,
+    0x70cd, 0x70ed, 0x70ed, 0x78ed, 0x78ed, 0x78ed, 0x78ed, 0x78ed,
+    0x78ed, 0x810c, 0x810c, 0x810c, 0x810c, 0x810c, 0x810c, 0x810c,
+    0x890c, 0x892c, 0x892c, 0x892c, 0x892c, 0x892c, 0x912c, 0x912c,
+    0x912c, 0x914c, 0x914c, 0x914c, 0x994b, 0x994b, 0x994b, 0x994b,
+    0x994b, 0x996b, 0xa16b, 0xa16b, 0xa16b, 0xa16b, 0xa16b, 0xa16b,
+    0xa96b, 0xa98b, 0xa98b, 0xa98b, 0xa98b, 0xa98b, 0xa98b, 0xb18b,
+    0xb18a, 0xb1aa, 0xb1aa, 0xb1aa, 0xb1aa, 0xb9aa, 0xb9aa, 0xb9aa,
+    0xb9aa, 0xb9ca, 0xb9ca, 0xb9ca, 0xc1ca, 0xc1e9, 0xc1e9, 0xc1e9,
+    0xc1e9, 0xc209, 0xc209, 0xc209, 0xc209, 0xca29, 0xca28, 0xca28,
+    0xca28, 0xca48, 0xca48, 0xca48, 0xca48, 0xd268, 0xd268, 0xd267,
+    0xd267, 0xd267, 0xd287, 0xd287, 0xd287, 0xda87, 0xdaa7, 0xdaa7,
+    0xdaa6, 0xdaa6, 0xdac6, 0xdac6, 0xdac6, 0xdac6, 0xe2e6, 0xe2e6,
+    0xe2e5, 0xe2e5, 0xe305, 0xe305, 0xe305, 0xe305, 0xeb25, 0xeb25,
+    0xeb25, 0xeb24, 0xeb44, 0xeb44, 0xeb44, 0xeb64, 0xeb64, 0xeb84,
+    0xeb84, 0xeba4, 0xeba4, 0xf3c4, 0xf3c4, 0xf3e4, 0xf3e4, 0xf404,
+    0xf404, 0xf424, 0xf424, 0xf444, 0xf444, 0xf464, 0xf464, 0xf483,
+    0xf483, 0xf4a3, 0xf4a3, 0xf4c3, 0xf4c3, 0xf4e3, 0xf4e3, 0xf503,
+    0xfd03, 0xfd23, 0xfd23, 0xfd43, 0xfd43, 0xfd63, 0xfd63, 0xfd83,
+    0xfd83, 0xfda3, 0xfda3, 0xfdc3, 0xfdc4, 0xfde4, 0xfde5, 0xfe05,
+    0xfe06, 0xfe26, 0xfe27, 0xfe47, 0xfe47, 0xfe68, 0xfe68, 0xfe69,
+    0xfe89, 0xfe8a, 0xfeaa, 0xfeab, 0xfecb, 0xfecc, 0xfeec, 0xfeec,
+    0xff0d, 0xff0d, 0xff2e, 0xff2e, 0xff4f, 0xff4f, 0xff70, 0xff70,
+    0xff90, 0xff91, 0xffb1, 0xffb2, 0xffb2, 0xffd3, 0xffd3, 0xfff4,
+};
+
+//
+// Rainbow: red through the spectrum to violet
+//
+const unsigned short g_pusPaletteRainbow[COLORMAP_SIZE] =
+{
+    0xf800, 0xf800, 0xf820, 0xf840, 0xf860, 0xf860, 0xf880, 0xf8a0,
+    0xf8c0, 0xf8c0, 0xf8e0, 0xf900, 0xf900, 0xf920, 0xf940, 0xf960,
+    0xf960, 0xf980, 0xf9a0, 0xf9c0, 0xf9c0, 0xf9e0, 0xfa00, 0xfa20,
+    0xfa20, 0xfa40, 0xfa60, 0xfa60, 0xfa80, 0xfaa0, 0xfac0, 0xfac0,
+    0xfae0, 0xfb00, 0xfb20, 0xfb20, 0xfb40, 0xfb60, 0xfb80, 0xfb80,
+    0xfba0, 0xfbc0, 0xfbe0, 0xfbe0, 0xfc00, 0xfc20, 0xfc40, 0xfc40,
+    0xfc60, 0xfc80, 0xfca0, 0xfca0, 0xfcc0, 0xfce0, 0xfd00, 0xfd20,
+    0xfd20, 0xfd40, 0xfd60, 0xfd80, 0xfd80, 0xfda0, 0xfdc0, 0xfde0,
+    0xfe00, 0xfe00, 0xfe20, 0xfe40, 0xfe60, 0xfe60, 0xfe80, 0xfea0,
+    0xfec0, 0xfec0, 0xfee0, 0xff00, 0xff20, 0xff40, 0xff40, 0xff60,
+    0xff80, 0xffa0, 0xffa0, 0xffc0, 0xffe0, 0xffe0, 0xf7e0, 0xf7e0,
+    0xefe0, 0xe7e0, 0xdfe0, 0xdfe0, 0xd7e0, 0xcfe0, 0xc7e0, 0xc7e0,
+    0xbfe0, 0xb7e0, 0xb7e0, 0xafe0, 0xa7e0, 0x9fe0, 0x9fe0, 0x97e0,
+    0x8fe0, 0x87e0, 0x87e0, 0x7fe0, 0x77e0, 0x6fe0, 0x6fe0, 0x67e0,
+    0x5fe0, 0x5fe0, 0x57e0, 0x4fe0, 0x47e0, 0x47e0, 0x3fe0, 0x37e0,
+    0x2fe0, 0x2fe0, 0x27e0, 0x1fe0, 0x17e0, 0x17e0, 0x0fe0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e1, 0x07e2, 0x07e2, 0x07e3, 0x07e4, 0x07e5,
+    0x07e5, 0x07e6, 0x07e7, 0x07e8, 0x07e8, 0x07e9, 0x07ea, 0x07eb,
+    0x07eb, 0x07ec, 0x07ed, 0x07ed, 0x07ee, 0x07ef, 0x07f0, 0x07f0,
+    0x07f1, 0x07f2, 0x07f3, 0x07f3, 0x07f4, 0x07f5, 0x07f6, 0x07f6,
+    0x07f7, 0x07f8, 0x07f8, 0x07f9, 0x07fa, 0x07fb, 0x07fb, 0x07fc,
+    0x07fd, 0x07fe, 0x07fe, 0x07ff, 0x07ff, 0x07bf, 0x079f, 0x075f,
+    0x071f, 0x06ff, 0x06bf, 0x069f, 0x065f, 0x063f, 0x05ff, 0x05df,
+    0x059f, 0x055f, 0x053f, 0x04ff, 0x04df, 0x049f, 0x047f, 0x043f,
+    0x041f, 0x03df, 0x039f, 0x037f, 0x033f, 0x031f, 0x02df, 0x02bf,
+    0x027f, 0x023f, 0x021f, 0x01df, 0x01bf, 0x017f, 0x015f, 0x011f,
+    0x00ff, 0x00bf, 0x007f, 0x005f, 0x001f, 0x001f, 0x001f, 0x001f,
+    0x081f, 0x081f, 0x101f, 0x101f, 0x101f, 0x181f, 0x181f, 0x181f,
+    0x201f, 0x201f, 0x281f, 0x281f, 0x281f, 0x301f, 0x301f, 0x301f,
+    0x381f, 0x381f, 0x381f, 0x401f, 0x401f, 0x481f, 0x481f, 0x481f,
+    0x501f, 0x501f, 0x501f, 0x581f, 0x581f, 0x601f, 0x601f, 0x601f,
+    0x681f, 0x681f, 0x681f, 0x701f, 0x701f, 0x701f, 0x781f, 0x781f,
+};
+
+//
+// Mono: one shade of green
+//
+const unsigned short g_pusPaletteMono[COLORMAP_SIZE] =
+{
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+};
+
+//
+// The bar palettes, indexed by BAR_PALETTE_*
+//
+const unsigned short * const g_ppusBarPalettes[NUM_BAR_PALETTES] =
+{
+    g_pusPaletteGradient,
+    g_pusPaletteHeat,
+    g_pusPaletteRainbow,
+    g_pusPaletteMono,
+};
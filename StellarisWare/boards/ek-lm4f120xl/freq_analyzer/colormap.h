@@ -0,0 +1,81 @@
+//*****************************************************************************
+//
+// colormap.h - Predefines and globals for the tables that map a display level
+// or a bar's place across the display to a color.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __COLORMAP_H__
+#define __COLORMAP_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The number of entries in each color map.  There is one for every value of
+// an unsigned char, so a bar height can index a map without being clamped.
+//
+#define COLORMAP_SIZE			256
+
+//
+// The level that maps to the last color in each map.  This is the default
+// height of the bars; anything above it gets the last color.  These must
+// match the values colormap.c was generated with by tools/gen_colormap.py.
+//
+#define COLORMAP_FULL_SCALE		185
+
+//
+// The palettes the bars can be colored from, left to right.  Each has
+// COLORMAP_SIZE entries spanning the whole width of the bars, so bar i of N
+// takes entry (i * COLORMAP_SIZE) / N.  These must match the order
+// tools/gen_colormap.py generates them in.
+//
+#define BAR_PALETTE_GRADIENT	0
+#define BAR_PALETTE_HEAT		1
+#define BAR_PALETTE_RAINBOW		2
+#define BAR_PALETTE_MONO		3
+#define NUM_BAR_PALETTES		4
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+
+//
+// Each entry is in the display's native 5-6-5 RGB format, ready to be written
+// straight to the SSD2119.
+//
+extern const unsigned short g_pusColormapHeat[COLORMAP_SIZE];
+extern const unsigned short g_pusPaletteGradient[COLORMAP_SIZE];
+extern const unsigned short g_pusPaletteHeat[COLORMAP_SIZE];
+extern const unsigned short g_pusPaletteRainbow[COLORMAP_SIZE];
+extern const unsigned short g_pusPaletteMono[COLORMAP_SIZE];
+extern const unsigned short * const g_ppusBarPalettes[NUM_BAR_PALETTES];
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __COLORMAP_H__
@@ -39,6 +39,7 @@
 #include "driverlib/interrupt.h"
 #include "driverlib/rom.h"
 #include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
 #include "driverlib/timer.h"
 #include "driverlib/udma.h"
 
@@ -48,8 +49,17 @@
 #include "arm_math.h"
 #include "images.h"
 #include "gui.h"
+#include "render.h"
 #include "dsp.h"
+#include "window.h"
+#include "tuner.h"
+#include "filterbank.h"
+#include "zoom.h"
+#include "bars.h"
+#include "average.h"
 #include "freq_analyzer.h"
+#include "arena.h"
+#include "store.h"
 #include <math.h>
 
 
@@ -69,6 +79,49 @@ float32_t maxLEDPowers[MAX_NUMBARS];
 //
 float g_HzPerBin;
 
+//
+// The frequency in Hertz of the first bin.  This is 0 unless the zoom FFT is
+// in use.
+//
+float g_fFirstBinFreq;
+
+//
+// The factor that converts an FFT bin magnitude into the amplitude (in ADC
+// counts) of a sine centered on that bin, correcting for the window's coherent
+// gain.
+//
+float g_fMagnitudeScale;
+
+//
+// The loudest peaks found in the most recently processed frame.
+//
+tPeakResults g_sPeakResults;
+
+//
+// The number of frames of bar heights published to the display so far.
+//
+unsigned long g_ulFrameCount;
+
+//
+// The configuration epoch, which goes up by one each time the DSP is set up
+// again.  Frames are stamped with it so the display can tell which ones were
+// calculated for an older bar layout.
+//
+unsigned long g_ulConfigEpoch;
+
+//
+// The number of processor cycles the analysis stage took on the last frame:
+// windowing through band powers for the FFT engine, or filtering and reading
+// the bands for the filterbank engine.  Used to compare the two engines.
+//
+unsigned long g_ulAnalysisCycles;
+
+//
+// Whether the input was below the silence threshold on the last frame.  While
+// it is, the spectrum isn't calculated and the bars just fall.
+//
+unsigned char g_ucSilent;
+
 //*****************************************************************************
 //
 // Private predefines and variables used for the FFT portion of the DSP loop
@@ -79,6 +132,7 @@ float g_HzPerBin;
 // Flag used to determine whether to calculate forward (0) or inverse(1) fft
 //
 #define INVERT_FFT				0
+#define INVERT_IFFT				1
 //
 // Flag used to determine if fft result will be output in standard bit order(1)
 // or reversed bit order (0)
@@ -88,23 +142,170 @@ float g_HzPerBin;
 //
 // The array used to store the results of the fast fourier transform.  Each
 // element in this array represents the power found in a frequency bin of width
-// Fs / FFT_length
+// Fs / FFT_length.  Only the bins from DC through Nyquist are kept, so this
+// is NUM_BINS complex values rather than the NUM_SAMPLES complex values
+// arm_rfft_f32 would write.  The array itself is in the arena.
 //
-static float32_t g_fFFTResult[NUM_SAMPLES * 2];
+static float32_t * const g_pfFFTResult = g_sArena.pfFFTResult;
 
 //
-// FFT and CMSIS config structures
+// CMSIS config structure for the NUM_SAMPLES / 2 point complex FFT the real
+// FFT is built on
 //
-arm_rfft_instance_f32 fftStructure;
 arm_cfft_radix4_instance_f32 cfftStructure;
 
 //
-// Hamming window, used to prepare samples for fft and correct for the fact
-// we're using an algorithm meant for a continuous, infinite signal on a
-// signal that is finite and not always continuous.
+// Inverse FFT structure, used to turn the power spectrum into an
+// autocorrelation when the tuner is running
+//
+arm_cfft_radix4_instance_f32 icfftStructure;
+
+//
+// The window used to prepare samples for fft and correct for the fact we're
+// using an algorithm meant for a continuous, infinite signal on a signal that
+// is finite and not always continuous.
+//
+static const tWindowTable *g_psWindow;
+
+//
+// The gain applied to each bar's power: the frequency weighting at the bar's
+// center, folded together with the window's magnitude scale.  Recalculated
+// whenever the bar layout changes.
+//
+static float32_t g_fBarGain[MAX_NUMBARS];
+
+//
+// The SysTick value at the end of the last normalization stage, used to
+// measure how much wall time each frame covers
+//
+static unsigned long g_ulLastNormTick;
+
+//
+// The reciprocal of each bar's maximum power, or 0 where the maximum is 0.
+// This is kept in step with maxLEDPowers so normalizing a frame takes a
+// multiply per bar instead of a divide.  Rounding makes the two drift apart
+// slowly, so one bar a frame is recalculated outright, in turn.
+//
+static float32_t g_fInvMaxPower[MAX_NUMBARS];
+static uint32_t g_ulResyncBar;
+
+//
+// When the newest samples the frame being worked on was calculated from
+// landed, as a latency timestamp.  Taken as each frame starts, since the
+// capture carries on underneath it.
+//
+static unsigned long g_ulFrameCaptureTime;
+
+//
+// The running power spectrum used when spectrum averaging is on.  In EMA mode
+// it holds the leaky sum of every frame so far; in boxcar mode it holds the
+// sum of the frames in the current block.  This shares its space in the
+// arena with the bar edges setFreqBreakpoints works out, which is fine as
+// the average is restarted whenever the bars are laid out again.
+//
+static float32_t * const g_pfAvgSpectrum = g_sArena.uSpectrum.pfAvgSpectrum;
+
+//
+// The number of frames summed into g_pfAvgSpectrum.  Zero means the average
+// needs to be restarted from the next frame.
+//
+static unsigned long g_ulAvgCount;
+
+//
+// The filterbank used by the filterbank engine.  It lives in the FFT result
+// buffer, which the filterbank engine has no other use for.
+//
+static tFilterbank *g_psFilterbank;
+
+//
+// The zoom FFT, or 0 if the full-band FFT is in use.  The zoom FFT's state
+// lives in the FFT result buffer, after the room its own spectrum needs.
+//
+static tZoom *g_psZoom;
+
+//
+// The number of bins in the spectrum the bars, peak finder, and averaging
+// work from: NUM_BINS for the full-band FFT, or ZOOM_FFT_SIZE for the zoom FFT
+//
+static uint32_t g_ulNumBins;
+
+//
+// The settings the DSP was last set up for.  DSPReconfigure compares them
+// with the current ones to find what has to be set up again.
+//
+typedef struct
+{
+	unsigned int uiSamplingFreq;
+	unsigned int uiMinDisplayFreq;
+	unsigned int uiMaxDisplayFreq;
+
+	//
+	// The number of bars as laid out, which may be fewer than were asked for
+	//
+	unsigned int uiNumBars;
+	unsigned char ucWindowType;
+	unsigned char ucWeighting;
+	unsigned char ucEngine;
+	unsigned char ucOctaveFraction;
+	unsigned char ucZoom;
+	unsigned char ucAvgMode;
+	unsigned char ucAvgFrames;
+}
+tDSPConfig;
+
+static tDSPConfig g_sDSPConfig;
+
+//*****************************************************************************
+//
+// Forward declaration of private functions
+//
+//*****************************************************************************
+static void PublishBars(uint32_t ulNumBars);
+
+
+//*****************************************************************************
+//
+// Calculate the gain of a frequency weighting curve, as defined in IEC 61672,
+// normalized to unity at 1 kHz.
+//
+// param ulWeighting: one of the WEIGHTING_* curves
+// param fFreq: the frequency, in Hz
+//
+// return: the linear (amplitude) gain of the curve at fFreq
 //
-extern float ti_hamming_window_vector[NUM_SAMPLES];
+//*****************************************************************************
+static float
+WeightingGain(unsigned long ulWeighting, float fFreq)
+{
+	float fF2, fGain;
+
+	fF2 = fFreq * fFreq;
+
+	if(ulWeighting == WEIGHTING_A)
+	{
+		fGain = (12194.0f * 12194.0f * fF2 * fF2) /
+				((fF2 + (20.6f * 20.6f)) *
+				 sqrtf((fF2 + (107.7f * 107.7f)) * (fF2 + (737.9f * 737.9f))) *
+				 (fF2 + (12194.0f * 12194.0f)));
+
+		//
+		// Scale so the gain at 1 kHz is 0 dB
+		//
+		return(fGain * 1.2589049f);
+	}
+	else if(ulWeighting == WEIGHTING_C)
+	{
+		fGain = (12194.0f * 12194.0f * fF2) /
+				((fF2 + (20.6f * 20.6f)) * (fF2 + (12194.0f * 12194.0f)));
+
+		//
+		// Scale so the gain at 1 kHz is 0 dB
+		//
+		return(fGain * 1.0071525f);
+	}
 
+	return(1.0f);
+}
 
 //*****************************************************************************
 //
@@ -120,7 +321,7 @@ setFreqBreakpoints(void)
     float minVal, maxVal, numLEDs;
     float minLog, maxLog, deltaLog, tempLog;
     int binMin, binMax, binCenter, binCenterNext;
-    static int freqArray[MAX_NUMBARS+1];
+    int *freqArray;
     int i;
     int j;
     int targetFreq;
@@ -129,6 +330,7 @@ setFreqBreakpoints(void)
     minVal = g_uiMinDisplayFreq;
     maxVal = g_uiMaxDisplayFreq;
     numLEDs = g_uiNumDisplayBars;
+    freqArray = g_sArena.uSpectrum.sLayout.uNew.piBarEdgeFreqs;
 
     minLog = log10f(minVal);
     maxLog = log10f(maxVal);
@@ -153,13 +355,13 @@ setFreqBreakpoints(void)
     for(j=0;j<numLEDs+1;j++)
     {
         targetFreq = freqArray[j];
-		for(i=0; i<NUM_SAMPLES/2; i++)
+		for(i=0; i<g_ulNumBins - 1; i++)
 		{
-			binMin = g_HzPerBin * i;
-			binMax = g_HzPerBin * (i+1);
+			binMin = g_fFirstBinFreq + g_HzPerBin * i;
+			binMax = g_fFirstBinFreq + g_HzPerBin * (i+1);
 			binCenter = (binMin + binMax)/2;
-			binMin = g_HzPerBin * (i+1);
-			binMax = g_HzPerBin * (i+2);
+			binMin = g_fFirstBinFreq + g_HzPerBin * (i+1);
+			binMax = g_fFirstBinFreq + g_HzPerBin * (i+2);
 			binCenterNext = (binMin + binMax)/2;
 
 			if(binCenter > targetFreq)
@@ -196,7 +398,8 @@ setFreqBreakpoints(void)
 		// to display this little frequency over this many bars, so override
 		// the user set number of bars.
 		//
-		if((g_HzPerBin*LEDFreqBreakpoints[i]) > g_uiMaxDisplayFreq)
+		if((g_fFirstBinFreq + g_HzPerBin*LEDFreqBreakpoints[i]) >
+		   g_uiMaxDisplayFreq)
 		{
 			g_uiNumDisplayBars = i;
 			GUIUpdateSlider(NUMBARS_SLIDER, i);
@@ -204,7 +407,21 @@ setFreqBreakpoints(void)
 		}
     }
 
-    if(g_ucPrintDbg | 2)
+    //
+    // Work out the gain for each bar from the weighting at its center
+    // frequency, so the DSP loop only has to do one multiply per bar
+    //
+    for(i=0;i<g_uiNumDisplayBars;i++)
+    {
+		binMin = (i == 0) ? LEDFreqBreakpoints[0] : LEDFreqBreakpoints[i] + 1;
+		binMax = LEDFreqBreakpoints[i+1];
+		g_fBarGain[i] = g_fMagnitudeScale *
+						WeightingGain(g_ucWeighting,
+									  g_fFirstBinFreq +
+									  (g_HzPerBin * (binMin + binMax) / 2));
+    }
+
+    if(g_ucPrintDbg & 2)
     {
 		UARTprintf("// \n");
 		for(i=0;i<numLEDs;i++)
@@ -223,171 +440,1528 @@ setFreqBreakpoints(void)
 
 //*****************************************************************************
 //
-// Initialize the digital signal processing engine.
+// Get the window frames are taken with: the selected one, unless tuner mode
+// can't work with it.
+//
+// return: one of the WINDOW_* types
 //
 //*****************************************************************************
-void
-InitDSP(void)
+static unsigned char
+WindowTypeGet(void)
 {
-	int i;
+	return(g_ucTunerMode ? TunerWindowType(g_ucWindowType) : g_ucWindowType);
+}
 
-	//
-	// zero out our maximum power history
-	//
-	for(i=0;i<g_uiNumDisplayBars;i++)
+//*****************************************************************************
+//
+// Work out the hash of everything setFreqBreakpoints works from, which is
+// what tells a saved bar layout is still the one it would work out.
+//
+// return: the hash
+//
+//*****************************************************************************
+static unsigned long
+LayoutKey(void)
+{
+	unsigned long ulHash;
+	unsigned char ucWindowType;
+
+	ucWindowType = WindowTypeGet();
+	ulHash = StoreHash(STORE_HASH_INIT, &g_uiSamplingFreq,
+					   sizeof(g_uiSamplingFreq));
+	ulHash = StoreHash(ulHash, &g_uiMinDisplayFreq, sizeof(g_uiMinDisplayFreq));
+	ulHash = StoreHash(ulHash, &g_uiMaxDisplayFreq, sizeof(g_uiMaxDisplayFreq));
+	ulHash = StoreHash(ulHash, &g_uiNumDisplayBars, sizeof(g_uiNumDisplayBars));
+	ulHash = StoreHash(ulHash, &g_ucWeighting, sizeof(g_ucWeighting));
+	ulHash = StoreHash(ulHash, &ucWindowType, sizeof(ucWindowType));
+	ulHash = StoreHash(ulHash, &g_ulNumBins, sizeof(g_ulNumBins));
+	ulHash = StoreHash(ulHash, &g_HzPerBin, sizeof(g_HzPerBin));
+	ulHash = StoreHash(ulHash, &g_fFirstBinFreq, sizeof(g_fFirstBinFreq));
+	ulHash = StoreHash(ulHash, &g_fMagnitudeScale, sizeof(g_fMagnitudeScale));
+	return(ulHash);
+}
+
+//*****************************************************************************
+//
+// Put back the bar layout saved by LayoutSave, in place of working it out
+// again with setFreqBreakpoints.
+//
+// param ulKey: the LayoutKey of the current configuration
+// return: 1 if a layout was saved for this configuration and has been put
+//		   back, else 0
+//
+//*****************************************************************************
+static int
+LayoutLoad(unsigned long ulKey)
+{
+	unsigned long pulHead[2];
+	unsigned long ulNumBars, ulOffset, ulLength;
+
+	if((StoreRead(STORE_TAG_LAYOUT, 0, pulHead, sizeof(pulHead)) !=
+		sizeof(pulHead)) || (pulHead[0] != ulKey))
 	{
-		maxLEDPowers[i] = 0;
-		LEDFreqBreakpoints[i] = 0;
-		LEDDisplayMaxes[i] = 0;
+		return(0);
 	}
 
-	g_HzPerBin = (float)g_uiSamplingFreq / (float)NUM_SAMPLES;
-
 	//
-	// set our frequency range breakpoints
+	// setFreqBreakpoints can only ever take bars away
 	//
-	setFreqBreakpoints();
+	ulNumBars = pulHead[1];
+	if((ulNumBars == 0) || (ulNumBars > g_uiNumDisplayBars) ||
+	   (StoreFind(STORE_TAG_LAYOUT) !=
+		(long)(sizeof(pulHead) + (ulNumBars * sizeof(g_fBarGain[0])) +
+			   ((ulNumBars + 1) * sizeof(LEDFreqBreakpoints[0])))))
+	{
+		return(0);
+	}
 
-	//
-	// Determine if our sampling frequency is fast enough to handle our refresh
-	// rate
-	//
-	if((g_uiSamplingFreq/NUM_SAMPLES) > 16 )
+	ulOffset = sizeof(pulHead);
+	ulLength = ulNumBars * sizeof(g_fBarGain[0]);
+	if(StoreRead(STORE_TAG_LAYOUT, ulOffset, g_fBarGain, ulLength) != ulLength)
 	{
-		g_ucDMAMethod = DMA_METHOD_FAST;
+		return(0);
 	}
-	else
+	ulOffset += ulLength;
+	ulLength = (ulNumBars + 1) * sizeof(LEDFreqBreakpoints[0]);
+	if(StoreRead(STORE_TAG_LAYOUT, ulOffset, LEDFreqBreakpoints, ulLength) !=
+	   ulLength)
+	{
+		return(0);
+	}
+
+	if(ulNumBars < g_uiNumDisplayBars)
 	{
-		g_ucDMAMethod = DMA_METHOD_SLOW;
+		g_uiNumDisplayBars = ulNumBars;
+		GUIUpdateSlider(NUMBARS_SLIDER, ulNumBars);
+	}
+	return(1);
+}
+
+//*****************************************************************************
+//
+// Save the bar layout setFreqBreakpoints has just worked out, for LayoutLoad
+// to put back the next time the configuration is the same.
+//
+// param ulKey: the LayoutKey of the configuration, from before
+//		 setFreqBreakpoints ran
+//
+//*****************************************************************************
+static void
+LayoutSave(unsigned long ulKey)
+{
+	unsigned long pulHead[2];
+	tStorePart psParts[3];
+
+	pulHead[0] = ulKey;
+	pulHead[1] = g_uiNumDisplayBars;
+	psParts[0].pvData = pulHead;
+	psParts[0].ulLength = sizeof(pulHead);
+	psParts[1].pvData = g_fBarGain;
+	psParts[1].ulLength = g_uiNumDisplayBars * sizeof(g_fBarGain[0]);
+	psParts[2].pvData = LEDFreqBreakpoints;
+	psParts[2].ulLength = (g_uiNumDisplayBars + 1) *
+						  sizeof(LEDFreqBreakpoints[0]);
+	StoreWrite(STORE_TAG_LAYOUT, psParts, 3);
+}
+
+//*****************************************************************************
+//
+// Set up the filterbank engine with one bar per band, and work out the gain
+// for each bar from the weighting at its band's center frequency.
+//
+// return: the number of bands, or 0 if the filterbank could not be set up
+//
+//*****************************************************************************
+static unsigned long
+InitFilterbankBars(void)
+{
+	unsigned long ulBands;
+	unsigned long i;
+
+	g_psFilterbank = (tFilterbank *)g_pfFFTResult;
+	ulBands = FilterbankInit(g_psFilterbank, sizeof(g_sArena.pfFFTResult),
+							 g_uiSamplingFreq, g_ucOctaveFraction,
+							 g_uiMinDisplayFreq, g_uiMaxDisplayFreq);
+	if(ulBands == 0)
+	{
+		return(0);
 	}
 
+	//
+	// The band layout sets the number of bars, overriding the slider
+	//
+	g_uiNumDisplayBars = ulBands;
+	GUIUpdateSlider(NUMBARS_SLIDER, ulBands);
+	for(i = 0; i < ulBands; i++)
+	{
+		g_fBarGain[i] = WeightingGain(g_ucWeighting,
+									  g_psFilterbank->psBands[i].fCenter);
+	}
 
 	//
-	// Call the CMSIS real fft init function
+	// Anything captured so far was captured for the old configuration
 	//
-	arm_rfft_init_f32(&fftStructure, &cfftStructure, NUM_SAMPLES, INVERT_FFT, BIT_ORDER_FFT);
+	g_ulNewSamples = 0;
+
+	if(g_ucPrintDbg)
+	{
+		UARTprintf("Filterbank: %d bands at 1/%d octave, %d.%02d biquads per "
+				   "sample\n", ulBands, g_ucOctaveFraction,
+				   (int)g_psFilterbank->sCost.fSectionsPerSample,
+				   (int)(g_psFilterbank->sCost.fSectionsPerSample * 100) % 100);
+	}
+
+	return(ulBands);
 }
 
 //*****************************************************************************
 //
-// Run the DSP calculations on the input vector.
-//
-// Step 1: multiply vector by hamming window
-// Step 2: get fast fourier transform of samples
-// Step 3: get complex power of each element in fft output
-// Step 4: figure out power in each LED range of bins, compare to previously
-//		   observed maximum power, and set global LED array for that LED column
-//		   accordingly
-// Step 5: ???
-// Step 6: Profit
+// Work out what the bins of the spectrum are.  If the display band is narrow
+// enough, the zoom FFT is set up for it.  The window for the FFT length is
+// looked up, and with it the scale that turns bin magnitudes into amplitudes.
 //
 //*****************************************************************************
-void
-ProcessData(void)
+static void
+BinsSetup(void)
 {
-	uint32_t i;
-	uint32_t j;
-	float32_t power;
-	float32_t maxValue;
-	static float32_t historicMax = 0;
-	static float32_t LEDPower[MAX_NUMBARS];
-	//uint32_t dummy;
+	unsigned long ulDecimation, ulLength;
 
-	if(g_ucDMAMethod == DMA_METHOD_SLOW)
+	//
+	// If the display band is narrow enough, zoom in on it: mix it down to 0
+	// Hz, decimate it, and take a smaller complex FFT with finer bins than
+	// the full-band FFT has.  The tuner needs the whole band, so it is off
+	// while zoomed.
+	//
+	g_psZoom = 0;
+	ulDecimation = 1;
+	if(g_ucZoom && (g_ucEngine == ENGINE_FFT))
 	{
-		//
-		// Convert the samples to floats and center around 0
-		//
-		for(i=0; i < NUM_SAMPLES; i++)
-		{
-			g_fFFTResult[i] = ((float)g_ulADCValues[i] - (float)0x800);
-		}
-		g_ucDataReady = 0;
+		ulDecimation = ZoomDecimationGet(g_uiSamplingFreq, g_uiMinDisplayFreq,
+										 g_uiMaxDisplayFreq);
 	}
-	else
+	if(ulDecimation > 1)
 	{
-		//
-		// Ugly, ugly, ugly part where we have to move the ul samples into a float
-		// array because the fixed point fft functions in CMSIS seem to be not
-		// working.  While we're at it, we might as well center the samples around
-		// 0, as the CMSIS algorithm seems to like that.
-		//
-		for(i=0;i<NUM_SAMPLES;i++)
+		g_psZoom = (tZoom *)(g_pfFFTResult + (ZOOM_FFT_SIZE * 2));
+		if(!ZoomInit(g_psZoom,
+					 sizeof(g_sArena.pfFFTResult) -
+					 (ZOOM_FFT_SIZE * 2 * sizeof(float)),
+					 g_uiSamplingFreq,
+					 (g_uiMinDisplayFreq + g_uiMaxDisplayFreq) / 2.0f,
+					 ulDecimation))
 		{
-			g_fFFTResult[i] = ((float)g_ulADCValues[i] - (float)0x800);// / (float)640;
+			g_psZoom = 0;
 		}
+	}
 
+	if(g_psZoom)
+	{
+		ulLength = ZOOM_FFT_SIZE;
+		g_ulNumBins = ZOOM_FFT_SIZE;
+		g_HzPerBin = (float)g_uiSamplingFreq /
+					 (float)(ulDecimation * ZOOM_FFT_SIZE);
+		g_fFirstBinFreq = g_psZoom->fCenter -
+						  (g_HzPerBin * (ZOOM_FFT_SIZE / 2));
+		g_ulNewSamples = 0;
+	}
+	else
+	{
+		ulLength = NUM_SAMPLES;
+		g_ulNumBins = NUM_BINS;
+		g_HzPerBin = (float)g_uiSamplingFreq / (float)NUM_SAMPLES;
+		g_fFirstBinFreq = 0;
+	}
 
+	//
+	// Look up the window for our FFT length.  If the selected window wasn't
+	// generated for this length, fall back to Hamming.
+	//
+	g_psWindow = WindowTableGet(WindowTypeGet(), ulLength);
+	if(g_psWindow == 0)
+	{
+		g_ucWindowType = WINDOW_HAMMING;
+		g_psWindow = WindowTableGet(WINDOW_HAMMING, ulLength);
 	}
 
 	//
-	// Multiply samples by hamming window
+	// A real sine of amplitude A shows up as a peak of A / 2 times the
+	// window's sum in the full-band FFT.  The zoom FFT's mixer keeps only one
+	// of the sine's two halves, which comes out the same.
 	//
-	arm_mult_f32(g_fFFTResult, ti_hamming_window_vector, g_fFFTResult, NUM_SAMPLES);
+	g_fMagnitudeScale = 2.0f / ((float)ulLength * g_psWindow->fCoherentGain);
+
+	if(g_ucPrintDbg && g_psZoom)
+	{
+		UARTprintf("Zoom: decimating by %d, %d.%02d Hz per bin\n",
+				   ulDecimation, (int)g_HzPerBin,
+				   (int)(g_HzPerBin * 100) % 100);
+	}
+
+	if(g_ucPrintDbg)
+	{
+		UARTprintf("Window: %s, coherent gain %d/1000, ENBW %d/1000 bins\n",
+				   WindowNameGet(WindowTypeGet()),
+				   (int)(g_psWindow->fCoherentGain * 1000),
+				   (int)(g_psWindow->fENBW * 1000));
+	}
+}
+
+//*****************************************************************************
+//
+// Lay the bars out over the bins: one bar per band for the filterbank
+// engine, or setFreqBreakpoints' layout for the FFT engine.  Either can cut
+// the number of bars.
+//
+//*****************************************************************************
+static void
+LayoutSetup(void)
+{
+	unsigned long ulKey, i;
 
 	//
-	// Calculate FFT on samples
+	// Set up the filterbank if it's in use.  If it can't be built, fall back
+	// to the FFT engine.
 	//
-	arm_rfft_f32(&fftStructure, g_fFFTResult, g_fFFTResult);
+	if((g_ucEngine == ENGINE_FILTERBANK) && (InitFilterbankBars() == 0))
+	{
+		g_ucEngine = ENGINE_FFT;
+	}
 
 	//
-	// Calculate complex power of FFT results
+	// set our frequency range breakpoints.  Working them out takes a search
+	// of the bins for every bar, so the last layout worked out is kept in
+	// flash, and used again if nothing it was worked out from has changed.
 	//
-	arm_cmplx_mag_f32(g_fFFTResult, g_fFFTResult, NUM_SAMPLES * 2);
+	if(g_ucEngine == ENGINE_FFT)
+	{
+		ulKey = LayoutKey();
+		if(!LayoutLoad(ulKey))
+		{
+			for(i = 0; i <= MAX_NUMBARS; i++)
+			{
+				LEDFreqBreakpoints[i] = 0;
+			}
+			setFreqBreakpoints();
+			LayoutSave(ulKey);
+		}
+	}
+}
 
+//*****************************************************************************
+//
+// Work out the edges of the bars, in Hz, so that what is kept for each bar
+// can be carried over to bars laid out differently.
+//
+// An FFT bar runs from the bottom of its lowest bin to the top of its
+// highest.  A filterbank band runs halfway to each neighbour, on a log
+// scale, and the outermost bands run as far again beyond their centers.
+//
+// param psConfig: the configuration the bars were laid out for
+// param pfEdges: where to store the psConfig->uiNumBars + 1 edges
+//
+//*****************************************************************************
+static void
+LayoutEdgesGet(const tDSPConfig *psConfig, float32_t *pfEdges)
+{
+	unsigned long i;
+	float32_t fHalfBand;
 
-	if(g_ucPrintDbg)
+	if(psConfig->ucEngine == ENGINE_FILTERBANK)
 	{
-		//
-		// For debug purposes, find the maximum bin
-		//
-		arm_max_f32(g_fFFTResult, NUM_SAMPLES, &maxValue, &i);
-		if(maxValue > historicMax)
+		fHalfBand = powf(2.0f, 0.5f / (float32_t)psConfig->ucOctaveFraction);
+		pfEdges[0] = g_psFilterbank->psBands[0].fCenter / fHalfBand;
+		for(i = 1; i < psConfig->uiNumBars; i++)
 		{
-			historicMax = maxValue;
+			pfEdges[i] = sqrtf(g_psFilterbank->psBands[i - 1].fCenter *
+							   g_psFilterbank->psBands[i].fCenter);
 		}
-
-		UARTprintf("FPS: %2d  ", g_ucLastFramesPerSec);
-		UARTprintf("DPSPS: %2d  ", g_uiLastDSPPerSec);
-		UARTprintf("Peak is b/w %06d and %06d\r",
-				   (int)(g_HzPerBin*i), (int)(g_HzPerBin*(i+1)));
+		pfEdges[i] = g_psFilterbank->psBands[i - 1].fCenter * fHalfBand;
 	}
-	//
-	// Calculate power stored in the frequency band each LED represents
-	//
-	j = LEDFreqBreakpoints[0];
-	for(i=1;i<g_uiNumDisplayBars + 1;i++)
+	else
 	{
-		//
-		// Find the average power of all the LED bins in the freq array. j is
-		// the index of the lowest bin used for this LED.  To get the size of
-		// range to take the average of, we do highest indexed bin,
-		// LEDfreqBreakPoints[i], minus the lowest indexed bin, j, + 1.
-		//
-		arm_mean_f32(g_fFFTResult+j, LEDFreqBreakpoints[i]-j + 1, &power);
-		//arm_max_f32(g_fFFTResult+j, LEDFreqBreakpoints[i]-j+1, &power, &dummy);
-		if(maxLEDPowers[i -1] < power)
+		pfEdges[0] = g_fFirstBinFreq +
+					 (g_HzPerBin * ((float32_t)LEDFreqBreakpoints[0] - 0.5f));
+		for(i = 1; i <= psConfig->uiNumBars; i++)
 		{
-			maxLEDPowers[i - 1] = power;
+			pfEdges[i] = g_fFirstBinFreq +
+						 (g_HzPerBin *
+						  ((float32_t)LEDFreqBreakpoints[i] + 0.5f));
 		}
-		//else
-		//{
-		//	  maxLEDPowers[i-1] *= POWER_DECAY_FACTOR;
-		//}
-		LEDPower[i - 1] = power;
-		j = LEDFreqBreakpoints[i] + 1;
+	}
+}
 
-		//
-		// Normalize currently observed power by maximum observed power for
-		// this frequency range
-		//
-		power = LEDPower[i-1] / maxLEDPowers[i-1];
+//*****************************************************************************
+//
+// Pick the uDMA method for the current configuration.
+//
+// Determine if our sampling frequency is fast enough to handle our refresh
+// rate.  The filterbank and the zoom FFT have to see every sample, so they
+// always use the slow method, which never stops capturing.
+//
+// return: DMA_METHOD_FAST or DMA_METHOD_SLOW
+//
+//*****************************************************************************
+static unsigned char
+DMAMethodGet(void)
+{
+	if(((g_uiSamplingFreq/NUM_SAMPLES) > 16) && (g_ucEngine == ENGINE_FFT) &&
+	   (g_psZoom == 0))
+	{
+		return(DMA_METHOD_FAST);
+	}
+	return(DMA_METHOD_SLOW);
+}
 
-		//
-		// power is now between 0 and 1, so multiply by max display power to
-		// figure out how many display elements to light up
-		//
-		LEDDisplay[i-1] = (int)(power * 185);
+//*****************************************************************************
+//
+// Take a copy of the settings the DSP is set up from.
+//
+// param psConfig: where to store them
+//
+//*****************************************************************************
+static void
+DSPConfigGet(tDSPConfig *psConfig)
+{
+	psConfig->uiSamplingFreq = g_uiSamplingFreq;
+	psConfig->uiMinDisplayFreq = g_uiMinDisplayFreq;
+	psConfig->uiMaxDisplayFreq = g_uiMaxDisplayFreq;
+	psConfig->uiNumBars = g_uiNumDisplayBars;
+	psConfig->ucWindowType = WindowTypeGet();
+	psConfig->ucWeighting = g_ucWeighting;
+	psConfig->ucEngine = g_ucEngine;
+	psConfig->ucOctaveFraction = g_ucOctaveFraction;
+	psConfig->ucZoom = g_ucZoom;
+	psConfig->ucAvgMode = g_ucAvgMode;
+	psConfig->ucAvgFrames = g_ucAvgFrames;
+}
+
+//*****************************************************************************
+//
+// Work out which stages of setting the DSP up a change of settings needs.
+//
+// param psOld: the settings the DSP is set up for
+// param psNew: the settings it is to be set up for
+// return: the RECONFIG_* stages to run.  The uDMA method isn't known until
+//		   the bins are, so RECONFIG_CAPTURE may also be needed for a change
+//		   of method.
+//
+//*****************************************************************************
+static unsigned long
+ReconfigPlan(const tDSPConfig *psOld, const tDSPConfig *psNew)
+{
+	unsigned long ulStages;
+	unsigned char ucBandMoved;
+
+	ulStages = 0;
+	ucBandMoved = ((psNew->uiMinDisplayFreq != psOld->uiMinDisplayFreq) ||
+				   (psNew->uiMaxDisplayFreq != psOld->uiMaxDisplayFreq));
+
+	//
+	// Samples captured at one rate are no use at another, and every bin
+	// changes with the rate
+	//
+	if(psNew->uiSamplingFreq != psOld->uiSamplingFreq)
+	{
+		ulStages |= RECONFIG_CAPTURE | RECONFIG_BINS;
+	}
+
+	//
+	// The bins also change with the window and the engine, and with the
+	// display band if the zoom FFT is or would be in use for it
+	//
+	if((psNew->ucWindowType != psOld->ucWindowType) ||
+	   (psNew->ucEngine != psOld->ucEngine) ||
+	   (psNew->ucZoom != psOld->ucZoom))
+	{
+		ulStages |= RECONFIG_BINS;
+	}
+	if(ucBandMoved && psNew->ucZoom && (psNew->ucEngine == ENGINE_FFT) &&
+	   (g_psZoom || (ZoomDecimationGet(psNew->uiSamplingFreq,
+									   psNew->uiMinDisplayFreq,
+									   psNew->uiMaxDisplayFreq) > 1)))
+	{
+		ulStages |= RECONFIG_BINS;
+	}
+
+	//
+	// The bars are laid out over the bins, across the display band
+	//
+	if((ulStages & RECONFIG_BINS) || ucBandMoved ||
+	   (psNew->uiNumBars != psOld->uiNumBars) ||
+	   (psNew->ucWeighting != psOld->ucWeighting) ||
+	   (psNew->ucOctaveFraction != psOld->ucOctaveFraction))
+	{
+		ulStages |= RECONFIG_LAYOUT;
+	}
+
+	//
+	// The spectrum average is of the old bins, and shares its space with
+	// what laying the bars out works with
+	//
+	if((ulStages & RECONFIG_LAYOUT) ||
+	   (psNew->ucAvgMode != psOld->ucAvgMode) ||
+	   (psNew->ucAvgFrames != psOld->ucAvgFrames))
+	{
+		ulStages |= RECONFIG_AVERAGE;
+	}
+
+	return(ulStages);
+}
+
+//*****************************************************************************
+//
+// Initialize the digital signal processing engine.
+//
+//*****************************************************************************
+void
+InitDSP(void)
+{
+	int i;
+
+	//
+	// Frames calculated from here on are for the new configuration
+	//
+	g_ulConfigEpoch++;
+
+	//
+	// zero out our maximum power history
+	//
+	for(i=0;i<MAX_NUMBARS;i++)
+	{
+		maxLEDPowers[i] = 0;
+		g_fInvMaxPower[i] = 0;
+		LEDDisplayMaxes[i] = 0;
+	}
+	g_ulLastNormTick = SysTickValueGet();
+
+	//
+	// Start spectrum averaging from nothing
+	//
+	g_ulAvgCount = 0;
+	if(g_ucAvgFrames < 1)
+	{
+		g_ucAvgFrames = 1;
+	}
+
+	BinsSetup();
+	LayoutSetup();
+	g_ucDMAMethod = DMAMethodGet();
+
+	//
+	// Call the CMSIS complex fft init function.  The real FFT of NUM_SAMPLES
+	// points is done as a complex FFT of half that length.  That length never
+	// changes, so this is only done here, and not when reconfiguring.
+	//
+	arm_cfft_radix4_init_f32(&cfftStructure, NUM_SAMPLES / 2, INVERT_FFT,
+							 BIT_ORDER_FFT);
+	arm_cfft_radix4_init_f32(&icfftStructure, NUM_SAMPLES / 2, INVERT_IFFT,
+							 BIT_ORDER_FFT);
+
+	DSPConfigGet(&g_sDSPConfig);
+}
+
+//*****************************************************************************
+//
+// Set the DSP up for changed settings, running only the stages the change
+// needs, and without losing what the bars show.
+//
+// When the bars are laid out again, the maximum each new bar is normalized
+// against is carried over from the old bars covering the same frequencies,
+// so the bars don't all jump to full height while the maxima build up again.
+// The last frame is redrawn over the new bars and published, so the display
+// has a frame for the new layout straight away.  Audio capture is only
+// restarted for a new sampling rate or uDMA method; until it has a full
+// buffer again, the full-band FFT waits and the last frame stays up.
+//
+// return: the RECONFIG_* stages that were run
+//
+//*****************************************************************************
+unsigned long
+DSPReconfigure(void)
+{
+	tDSPConfig sNew;
+	unsigned long ulStages, ulOldBars, i;
+	unsigned char ucMethod, ucRedraw;
+	float32_t fLoudest;
+	float32_t * const pfEdges = g_sArena.uSpectrum.sLayout.uNew.pfEdges;
+	float32_t * const pfOldEdges = g_sArena.uSpectrum.sLayout.pfOldEdges;
+	float32_t * const pfOldLevels = g_sArena.uSpectrum.sLayout.pfOldLevels;
+
+	DSPConfigGet(&sNew);
+	ulStages = ReconfigPlan(&g_sDSPConfig, &sNew);
+
+	//
+	// Before the bars are laid out again, note where the old ones were and
+	// the maximum each was normalized against, with the bar's gain taken out
+	// so it can be given the gain of whichever new bar it carries over to
+	//
+	ulOldBars = g_sDSPConfig.uiNumBars;
+	fLoudest = 0;
+	if(ulStages & RECONFIG_LAYOUT)
+	{
+		LayoutEdgesGet(&g_sDSPConfig, pfOldEdges);
+		for(i = 0; i < ulOldBars; i++)
+		{
+			pfOldLevels[i] = (g_fBarGain[i] > 0) ?
+							 (maxLEDPowers[i] / g_fBarGain[i]) : 0;
+			if(pfOldLevels[i] > fLoudest)
+			{
+				fLoudest = pfOldLevels[i];
+			}
+		}
+	}
+
+	if(ulStages & RECONFIG_BINS)
+	{
+		BinsSetup();
+	}
+
+	if(ulStages & RECONFIG_LAYOUT)
+	{
+		LayoutSetup();
+		DSPConfigGet(&sNew);
+		LayoutEdgesGet(&sNew, pfEdges);
+
+		//
+		// Carry the last frame's heights over to the new bars, as long as it
+		// was calculated for the old ones.  maxLEDPowers and g_fInvMaxPower
+		// are worked out again below, so they hold the heights meanwhile.
+		//
+		ucRedraw = ((g_psBarFrame->ulEpoch == g_ulConfigEpoch) &&
+					(g_psBarFrame->uiNumBars == ulOldBars));
+		if(ucRedraw)
+		{
+			for(i = 0; i < ulOldBars; i++)
+			{
+				maxLEDPowers[i] = g_psBarFrame->pucHeights[i];
+			}
+			BarsRemap(pfOldEdges, maxLEDPowers, ulOldBars, pfEdges,
+					  g_fInvMaxPower, g_uiNumDisplayBars, 0);
+			BarsQuantize(g_fInvMaxPower, 0, 1.0f,
+						 g_psBarFrameNext->pucHeights, g_uiNumDisplayBars,
+						 g_ucBarHeight);
+		}
+
+		//
+		// A new bar no old one covered starts from the loudest of the old
+		// maxima, so it starts out short rather than at full height
+		//
+		BarsRemap(pfOldEdges, pfOldLevels, ulOldBars, pfEdges, maxLEDPowers,
+				  g_uiNumDisplayBars, fLoudest);
+		arm_mult_f32(maxLEDPowers, g_fBarGain, maxLEDPowers,
+					 g_uiNumDisplayBars);
+		for(i = 0; i < g_uiNumDisplayBars; i++)
+		{
+			g_fInvMaxPower[i] = (maxLEDPowers[i] > 0) ?
+								(1.0f / maxLEDPowers[i]) : 0;
+		}
+
+		//
+		// Frames calculated from here on are for the new layout
+		//
+		g_ulConfigEpoch++;
+		if(ucRedraw)
+		{
+			g_ulFrameCaptureTime = g_psBarFrame->ulCaptureTime;
+			PublishBars(g_uiNumDisplayBars);
+		}
+	}
+
+	if(ulStages & RECONFIG_AVERAGE)
+	{
+		g_ulAvgCount = 0;
+		if(g_ucAvgFrames < 1)
+		{
+			g_ucAvgFrames = 1;
+		}
+	}
+
+	ucMethod = DMAMethodGet();
+	if((ulStages & RECONFIG_CAPTURE) || (ucMethod != g_ucDMAMethod))
+	{
+		ulStages |= RECONFIG_CAPTURE;
+		CaptureRestart(ucMethod);
+	}
+
+	DSPConfigGet(&g_sDSPConfig);
+
+	if(g_ucPrintDbg)
+	{
+		UARTprintf("Reconfigured:%s%s%s%s\n",
+				   (ulStages & RECONFIG_CAPTURE) ? " capture" : "",
+				   (ulStages & RECONFIG_BINS) ? " bins" : "",
+				   (ulStages & RECONFIG_LAYOUT) ? " layout" : "",
+				   (ulStages & RECONFIG_AVERAGE) ? " average" : "");
+	}
+
+	return(ulStages);
+}
+
+//*****************************************************************************
+//
+// Calculate the FFT of a real frame of NUM_SAMPLES samples, in place.
+//
+// The frame is treated as NUM_SAMPLES / 2 complex samples, z(n) = x(2n) +
+// j x(2n+1), and run through the complex FFT.  The split step then pulls the
+// spectra of the even and odd samples back apart and combines them into the
+// spectrum of x.  This is what arm_rfft_f32 does, except arm_rfft_f32 also
+// writes the mirror image of the spectrum above Nyquist, which nothing here
+// uses and which needs a buffer twice the size.  Bins k and NUM_SAMPLES / 2 - k
+// are built from the same two inputs, so working them out together lets the
+// split run in place.
+//
+// param pfBuffer: on entry, the NUM_SAMPLES real samples.  On return, the
+//		 NUM_BINS complex bins from DC through Nyquist.  Must have room for
+//		 NUM_BINS * 2 values.
+//
+//*****************************************************************************
+static void
+RealFFT(float32_t *pfBuffer)
+{
+	uint32_t k, m;
+	float32_t fCos, fSin, fAlpha, fBeta, fTemp;
+	float32_t fEr, fEi, fOr, fOi, fTr, fTi;
+
+	arm_cfft_radix4_f32(&cfftStructure, pfBuffer);
+
+	//
+	// DC and Nyquist are the sum and difference of the real and imaginary
+	// parts of bin 0
+	//
+	fEr = pfBuffer[0];
+	fEi = pfBuffer[1];
+	pfBuffer[0] = fEr + fEi;
+	pfBuffer[1] = 0;
+	pfBuffer[NUM_SAMPLES] = fEr - fEi;
+	pfBuffer[NUM_SAMPLES + 1] = 0;
+
+	//
+	// The bin halfway to Nyquist is its own partner, and works out to its
+	// own conjugate
+	//
+	pfBuffer[(NUM_SAMPLES / 2) + 1] = -pfBuffer[(NUM_SAMPLES / 2) + 1];
+
+	//
+	// Step the twiddle factor, e^(-j 2 pi k / NUM_SAMPLES), along with a
+	// trigonometric recurrence rather than calling cosf and sinf for every
+	// bin
+	//
+	fTemp = sinf(PI / NUM_SAMPLES);
+	fAlpha = 2.0f * fTemp * fTemp;
+	fBeta = sinf(2.0f * PI / NUM_SAMPLES);
+	fCos = 1.0f;
+	fSin = 0.0f;
+
+	for(k = 1; k < NUM_SAMPLES / 4; k++)
+	{
+		fTemp = fCos;
+		fCos -= (fAlpha * fCos) + (fBeta * fSin);
+		fSin -= (fAlpha * fSin) - (fBeta * fTemp);
+
+		//
+		// Separate the spectra of the even (E) and odd (O) samples, then
+		// rotate the odd one by the twiddle factor (T)
+		//
+		m = (NUM_SAMPLES / 2) - k;
+		fEr = 0.5f * (pfBuffer[2 * k] + pfBuffer[2 * m]);
+		fEi = 0.5f * (pfBuffer[(2 * k) + 1] - pfBuffer[(2 * m) + 1]);
+		fOr = 0.5f * (pfBuffer[(2 * k) + 1] + pfBuffer[(2 * m) + 1]);
+		fOi = 0.5f * (pfBuffer[2 * m] - pfBuffer[2 * k]);
+		fTr = (fCos * fOr) + (fSin * fOi);
+		fTi = (fCos * fOi) - (fSin * fOr);
+
+		pfBuffer[2 * k] = fEr + fTr;
+		pfBuffer[(2 * k) + 1] = fEi + fTi;
+		pfBuffer[2 * m] = fEr - fTr;
+		pfBuffer[(2 * m) + 1] = fTi - fEi;
+	}
+}
+
+//*****************************************************************************
+//
+// Calculate the inverse of RealFFT, in place.
+//
+// This undoes the split step to rebuild the complex spectrum of z(n) = x(2n)
+// + j x(2n+1), then runs the inverse complex FFT, which leaves the samples of
+// x in order.
+//
+// param pfBuffer: on entry, the NUM_BINS complex bins from DC through
+//		 Nyquist.  On return, the NUM_SAMPLES real samples.
+//
+//*****************************************************************************
+static void
+RealIFFT(float32_t *pfBuffer)
+{
+	uint32_t k, m;
+	float32_t fCos, fSin, fAlpha, fBeta, fTemp;
+	float32_t fEr, fEi, fOr, fOi, fDr, fDi;
+
+	fEr = pfBuffer[0];
+	fEi = pfBuffer[NUM_SAMPLES];
+	pfBuffer[0] = 0.5f * (fEr + fEi);
+	pfBuffer[1] = 0.5f * (fEr - fEi);
+	pfBuffer[(NUM_SAMPLES / 2) + 1] = -pfBuffer[(NUM_SAMPLES / 2) + 1];
+
+	fTemp = sinf(PI / NUM_SAMPLES);
+	fAlpha = 2.0f * fTemp * fTemp;
+	fBeta = sinf(2.0f * PI / NUM_SAMPLES);
+	fCos = 1.0f;
+	fSin = 0.0f;
+
+	for(k = 1; k < NUM_SAMPLES / 4; k++)
+	{
+		fTemp = fCos;
+		fCos -= (fAlpha * fCos) + (fBeta * fSin);
+		fSin -= (fAlpha * fSin) - (fBeta * fTemp);
+
+		//
+		// Recover the even (E) and odd (O) spectra, undoing the twiddle
+		// rotation on the odd one, and recombine them as E + jO
+		//
+		m = (NUM_SAMPLES / 2) - k;
+		fEr = 0.5f * (pfBuffer[2 * k] + pfBuffer[2 * m]);
+		fEi = 0.5f * (pfBuffer[(2 * k) + 1] - pfBuffer[(2 * m) + 1]);
+		fDr = 0.5f * (pfBuffer[2 * k] - pfBuffer[2 * m]);
+		fDi = 0.5f * (pfBuffer[(2 * k) + 1] + pfBuffer[(2 * m) + 1]);
+		fOr = (fCos * fDr) - (fSin * fDi);
+		fOi = (fSin * fDr) + (fCos * fDi);
+
+		pfBuffer[2 * k] = fEr - fOi;
+		pfBuffer[(2 * k) + 1] = fEi + fOr;
+		pfBuffer[2 * m] = fEr + fOi;
+		pfBuffer[(2 * m) + 1] = fOr - fEi;
+	}
+
+	arm_cfft_radix4_f32(&icfftStructure, pfBuffer);
+}
+
+//*****************************************************************************
+//
+// Calculate the autocorrelation of the current frame from its magnitude
+// spectrum, reusing the FFT result buffer.
+//
+// The autocorrelation is the inverse FFT of the power spectrum.  On entry the
+// first NUM_BINS elements of pfBuffer hold the magnitude of each bin.  These
+// are squared and spread out into the NUM_BINS complex bins the inverse real
+// FFT expects, and the inverse FFT runs in place.
+//
+// param pfBuffer: the FFT result buffer, holding magnitudes
+//
+// return: a pointer to the autocorrelation, NUM_SAMPLES lags long
+//
+//*****************************************************************************
+static float32_t *
+AutoCorrelate(float32_t *pfBuffer)
+{
+	uint32_t i;
+
+	//
+	// Walk down from the top so each magnitude is read before the complex
+	// bins overwrite it.  DC is dropped so the ADC's offset doesn't swamp the
+	// correlation.
+	//
+	for(i = NUM_SAMPLES / 2; i > 0; i--)
+	{
+		pfBuffer[2 * i] = pfBuffer[i] * pfBuffer[i];
+		pfBuffer[(2 * i) + 1] = 0;
+	}
+	pfBuffer[0] = 0;
+	pfBuffer[1] = 0;
+
+	RealIFFT(pfBuffer);
+
+	return(pfBuffer);
+}
+
+//*****************************************************************************
+//
+// Stamp the frame of bar heights that has just been filled in, and publish it
+// to the display.
+//
+// param ulNumBars: the number of bars in the frame
+//
+//*****************************************************************************
+static void
+PublishBars(uint32_t ulNumBars)
+{
+	g_psBarFrameNext->ulSequence = ++g_ulFrameCount;
+	g_psBarFrameNext->ulEpoch = g_ulConfigEpoch;
+	g_psBarFrameNext->uiNumBars = ulNumBars;
+	g_psBarFrameNext->ulCaptureTime = g_ulFrameCaptureTime;
+	GUIPublishFrame();
+}
+
+//*****************************************************************************
+//
+// Measure how long it has been since the bars were last updated.
+//
+// return: the time since the last call, in milliseconds, capped at
+//		   NORM_MAX_FRAME_MS
+//
+//*****************************************************************************
+static float32_t
+FrameTimeGet(void)
+{
+	unsigned long ulNow;
+	float32_t fFrameMs;
+
+	//
+	// SysTick counts down
+	//
+	ulNow = SysTickValueGet();
+	fFrameMs = (float32_t)((g_ulLastNormTick - ulNow) & 0x00ffffff) /
+			   ((float32_t)SysCtlClockGet() / 1000.0f);
+	g_ulLastNormTick = ulNow;
+	if(fFrameMs > NORM_MAX_FRAME_MS)
+	{
+		fFrameMs = NORM_MAX_FRAME_MS;
+	}
+
+	return(fFrameMs);
+}
+
+//*****************************************************************************
+//
+// Normalize the power of each bar against the maximum power recently seen in
+// that bar, and set the display height of the bar accordingly.
+//
+// The maximum follows each bar's power with separate attack and release time
+// constants.  The time each frame covers is measured with SysTick rather than
+// assumed, so the decay runs at the same rate no matter how fast frames or
+// display refreshes come in.
+//
+// The heights go to the next frame, which is then published for display.
+//
+// param pfPower: the power in each bar for this frame.  This is overwritten.
+// param ulNumBars: the number of bars
+//
+//*****************************************************************************
+static void
+NormalizeBars(float32_t *pfPower, uint32_t ulNumBars)
+{
+	uint32_t i;
+	float32_t fFrameMs, fRelease, fAttack, fShared;
+	float32_t *pfScale;
+
+	//
+	// With no bars there is nothing to normalize, and no bar to resync
+	//
+	if(ulNumBars == 0)
+	{
+		return;
+	}
+
+	fFrameMs = FrameTimeGet();
+
+	//
+	// Let every maximum decay, then pull the ones below the current power
+	// back up towards it.  The reciprocals grow as the maxima decay, and the
+	// ones whose maximum moved up are recalculated.
+	//
+	fRelease = expf(-fFrameMs / NORM_RELEASE_MS);
+	fAttack = (NORM_ATTACK_MS > 0) ?
+			  (1.0f - expf(-fFrameMs / (float32_t)NORM_ATTACK_MS)) : 1.0f;
+	arm_scale_f32(maxLEDPowers, fRelease, maxLEDPowers, ulNumBars);
+	arm_scale_f32(g_fInvMaxPower, expf(fFrameMs / NORM_RELEASE_MS),
+				  g_fInvMaxPower, ulNumBars);
+	for(i = 0; i < ulNumBars; i++)
+	{
+		if(pfPower[i] > maxLEDPowers[i])
+		{
+			maxLEDPowers[i] += fAttack * (pfPower[i] - maxLEDPowers[i]);
+			g_fInvMaxPower[i] = 1.0f / maxLEDPowers[i];
+		}
+	}
+
+	g_ulResyncBar = (g_ulResyncBar + 1) % ulNumBars;
+	g_fInvMaxPower[g_ulResyncBar] = (maxLEDPowers[g_ulResyncBar] > 0) ?
+									(1.0f / maxLEDPowers[g_ulResyncBar]) : 0;
+
+	//
+	// Normalize currently observed power by maximum observed power for this
+	// frequency range, and scale it to the height of the display, either
+	// directly or as a level in dB.  With a slow attack the power can
+	// overshoot the maximum, so it is clipped to the top of the display.
+	//
+	// A weighting curve only shows up if the bars are compared against each
+	// other, so when one is selected every bar is normalized against the
+	// loudest bar's maximum instead of its own.
+	//
+	if(g_ucWeighting != WEIGHTING_Z)
+	{
+		arm_max_f32(maxLEDPowers, ulNumBars, &fShared, &i);
+		fShared = (fShared > 0) ? (1.0f / fShared) : 0;
+		pfScale = 0;
+	}
+	else
+	{
+		fShared = 1.0f;
+		pfScale = g_fInvMaxPower;
+	}
+
+	if(g_ucBarScale == BAR_SCALE_DB)
+	{
+		BarsQuantizeDb(pfPower, pfScale, fShared, (float32_t)g_cDbFloor,
+					   (float32_t)g_cDbCeiling, g_psBarFrameNext->pucHeights,
+					   ulNumBars, g_ucBarHeight);
+	}
+	else
+	{
+		BarsQuantize(pfPower, pfScale, fShared * (float32_t)g_ucBarHeight,
+					 g_psBarFrameNext->pucHeights, ulNumBars,
+					 g_ucBarHeight);
+	}
+	PublishBars(ulNumBars);
+}
+
+//*****************************************************************************
+//
+// Let the bars fall towards nothing, for frames where the input is silent.
+//
+// The maxima the bars are normalized against are left alone.  Were they let
+// decay, the noise on an idle input would slowly be scaled up to full height,
+// and the first sound after the silence would be pinned to the top.
+//
+// param ulNumBars: the number of bars
+//
+//*****************************************************************************
+static void
+DecayBars(uint32_t ulNumBars)
+{
+	uint32_t i;
+	unsigned long ulFall;
+	unsigned char *pucLast, *pucNext;
+
+	//
+	// Always fall by at least a pixel so the bars are sure to reach the
+	// bottom
+	//
+	ulFall = (unsigned long)((FrameTimeGet() * g_ucBarHeight) /
+							 SILENCE_FALL_MS) + 1;
+	pucLast = g_psBarFrame->pucHeights;
+	pucNext = g_psBarFrameNext->pucHeights;
+	for(i = 0; i < ulNumBars; i++)
+	{
+		pucNext[i] = (pucLast[i] > ulFall) ? (pucLast[i] - ulFall) : 0;
+	}
+	PublishBars(ulNumBars);
+}
+
+//*****************************************************************************
+//
+// Decide whether the input was silent over the samples of the last frame.
+//
+// The test is on the RMS of the samples with their mean taken out, so an ADC
+// bias a little off of 0x800 doesn't hold the gate open.  It is done on the
+// mean square to save a square root.
+//
+// param fSum: the sum of the centered samples
+// param fSumSquares: the sum of the squares of the centered samples
+// param ulCount: the number of samples summed.  If this is 0 there is nothing
+//		 to go on, so the last decision stands.
+//
+// return: nonzero if the RMS is below g_ucSilenceThreshold ADC counts.  A
+//		   threshold of 0 turns the gate off.
+//
+//*****************************************************************************
+static unsigned char
+SilenceCheck(float32_t fSum, float32_t fSumSquares, unsigned long ulCount)
+{
+	float32_t fMean, fThreshold;
+
+	if(ulCount)
+	{
+		fMean = fSum / (float32_t)ulCount;
+		fThreshold = (float32_t)g_ucSilenceThreshold *
+					 (float32_t)g_ucSilenceThreshold;
+		g_ucSilent = (((fSumSquares / (float32_t)ulCount) - (fMean * fMean)) <
+					  fThreshold);
+	}
+
+	return(g_ucSilent);
+}
+
+//*****************************************************************************
+//
+// Find the NUM_PEAKS loudest local maxima in a magnitude spectrum and refine
+// each one to sub-bin accuracy.
+//
+// The candidates are kept in a small list sorted by magnitude, so the whole
+// spectrum is only walked once.  Each winner is then refined by fitting a
+// parabola through the log magnitudes of the peak bin and its two neighbours,
+// which is exact for a Gaussian shaped peak and within a few hundredths of a
+// bin for the windows we use.
+//
+// param pfMag: the magnitude spectrum, g_ulNumBins bins long
+// param psResults: where to store the peaks that were found
+//
+//*****************************************************************************
+static void
+FindPeaks(float32_t *pfMag, tPeakResults *psResults)
+{
+	uint32_t i;
+	uint32_t j;
+	uint32_t ulNumFound;
+	uint32_t pulBins[NUM_PEAKS];
+	float32_t fLeft, fCenter, fRight;
+	float32_t fDenom, fDelta;
+
+	//
+	// Walk the spectrum, skipping DC and the last bin since neither has two
+	// neighbours to interpolate with.
+	//
+	ulNumFound = 0;
+	for(i = 1; i < g_ulNumBins - 1; i++)
+	{
+		fCenter = pfMag[i];
+		if((fCenter <= pfMag[i - 1]) || (fCenter < pfMag[i + 1]))
+		{
+			continue;
+		}
+
+		//
+		// This is a local maximum.  If it's louder than the quietest peak in
+		// a full list, insert it in sorted order.
+		//
+		if((ulNumFound == NUM_PEAKS) &&
+		   (fCenter <= pfMag[pulBins[NUM_PEAKS - 1]]))
+		{
+			continue;
+		}
+		if(ulNumFound < NUM_PEAKS)
+		{
+			ulNumFound++;
+		}
+		for(j = ulNumFound - 1; (j > 0) && (pfMag[pulBins[j - 1]] < fCenter); j--)
+		{
+			pulBins[j] = pulBins[j - 1];
+		}
+		pulBins[j] = i;
+	}
+
+	//
+	// Refine each peak.  Interpolating on the log magnitude fits the main lobe
+	// of the window much better than interpolating on the magnitude itself.
+	//
+	for(j = 0; j < ulNumFound; j++)
+	{
+		i = pulBins[j];
+		fCenter = pfMag[i];
+		fDelta = 0;
+		if(pfMag[i - 1] > 0 && pfMag[i + 1] > 0)
+		{
+			fLeft = logf(pfMag[i - 1]);
+			fCenter = logf(fCenter);
+			fRight = logf(pfMag[i + 1]);
+			fDenom = fLeft - (2 * fCenter) + fRight;
+			if(fDenom < 0)
+			{
+				fDelta = 0.5f * (fLeft - fRight) / fDenom;
+			}
+			fCenter = expf(fCenter - (0.25f * (fLeft - fRight) * fDelta));
+		}
+
+		psResults->psPeaks[j].fFrequency = g_fFirstBinFreq +
+										   (g_HzPerBin * ((float)i + fDelta));
+		psResults->psPeaks[j].fAmplitude = fCenter * g_fMagnitudeScale;
+	}
+	psResults->ulNumPeaks = ulNumFound;
+}
+
+//*****************************************************************************
+//
+// Take the oldest of the samples that have come in since they were last
+// taken, centered around 0.
+//
+// This is for the engines that carry state from one frame to the next and so
+// only look at new samples.  The capture interrupt shifts the whole sample
+// buffer along each time a DMA block lands, so the new samples are always the
+// last g_ulNewSamples of it.  They are copied out with interrupts off so a
+// shift can't land partway through the copy.
+//
+// param pfBlock: where to store the samples
+// param ulMin: the fewest samples worth taking
+// param ulMax: the most samples to take
+//
+// return: the number of samples taken, which is 0 if fewer than ulMin were
+//		   waiting
+//
+//*****************************************************************************
+static unsigned long
+TakeNewSamples(float32_t *pfBlock, unsigned long ulMin, unsigned long ulMax)
+{
+	const unsigned short *pusSamples;
+	unsigned long ulCount;
+	unsigned long i;
+
+	IntMasterDisable();
+	ulCount = g_ulNewSamples;
+	if(ulCount < ulMin)
+	{
+		ulCount = 0;
+	}
+	else if(ulCount > ulMax)
+	{
+		ulCount = ulMax;
+	}
+	pusSamples = g_sArena.pusADCValues + NUM_SAMPLES - g_ulNewSamples;
+	for(i = 0; i < ulCount; i++)
+	{
+		pfBlock[i] = (float)pusSamples[i] - (float)0x800;
+	}
+	g_ulNewSamples -= ulCount;
+	IntMasterEnable();
+
+	return(ulCount);
+}
+
+//*****************************************************************************
+//
+// Add a block of samples to the running sums the silence gate works from.
+//
+// param pfBlock: the centered samples
+// param ulCount: the number of samples
+// param pfSum: the running sum of the samples
+// param pfSumSquares: the running sum of their squares
+//
+//*****************************************************************************
+static void
+SumBlock(float32_t *pfBlock, unsigned long ulCount, float32_t *pfSum,
+		 float32_t *pfSumSquares)
+{
+	float32_t fValue;
+
+	arm_mean_f32(pfBlock, ulCount, &fValue);
+	*pfSum += fValue * (float32_t)ulCount;
+	arm_power_f32(pfBlock, ulCount, &fValue);
+	*pfSumSquares += fValue;
+}
+
+//*****************************************************************************
+//
+// Run the samples that have come in since the last frame through the zoom
+// FFT's mixer and decimators.  The zoomed spectrum can then be taken from
+// the decimated samples with ZoomSpectrum.
+//
+// param pfSum: where to add the sum of the samples, for the silence gate
+// param pfSumSquares: where to add the sum of their squares
+//
+// return: the number of samples taken
+//
+//*****************************************************************************
+static unsigned long
+DecimateNewSamples(float32_t *pfSum, float32_t *pfSumSquares)
+{
+	float32_t pfBlock[ZOOM_BLOCK_SIZE];
+	unsigned long ulTotal;
+
+	g_ucDataReady = 0;
+
+	//
+	// Stop after one buffer's worth so a processor that can't keep up still
+	// gets back to the display
+	//
+	for(ulTotal = 0; ulTotal < NUM_SAMPLES; ulTotal += ZOOM_BLOCK_SIZE)
+	{
+		if(TakeNewSamples(pfBlock, ZOOM_BLOCK_SIZE, ZOOM_BLOCK_SIZE) == 0)
+		{
+			break;
+		}
+		SumBlock(pfBlock, ZOOM_BLOCK_SIZE, pfSum, pfSumSquares);
+		ZoomProcess(g_psZoom, pfBlock);
+	}
+
+	return(ulTotal);
+}
+
+//*****************************************************************************
+//
+// Run the samples that have come in since the last frame through the
+// filterbank, and read the level of each band.
+//
+// The filters carry their state from one frame to the next, so unlike the FFT
+// engine this only looks at new samples, and the bars can be read as often as
+// frames come in without waiting on a full block.
+//
+// param pfPower: where to store the level of each bar
+//
+// return: nonzero if the new samples were silent
+//
+//*****************************************************************************
+static unsigned char
+AnalyzeFilterbank(float32_t *pfPower)
+{
+	float32_t pfBlock[FB_BLOCK_SIZE];
+	float32_t fSum, fSumSquares;
+	unsigned long ulStart, ulCount, ulTotal;
+
+	ulStart = SysTickValueGet();
+	g_ucDataReady = 0;
+	fSum = 0;
+	fSumSquares = 0;
+
+	//
+	// Stop after one buffer's worth so a processor that can't keep up still
+	// gets back to the display.  The filters have to see every sample, even
+	// silent ones, to keep their state.
+	//
+	for(ulTotal = 0; ulTotal < NUM_SAMPLES; ulTotal += ulCount)
+	{
+		ulCount = TakeNewSamples(pfBlock, 1, FB_BLOCK_SIZE);
+		if(ulCount == 0)
+		{
+			break;
+		}
+		SumBlock(pfBlock, ulCount, &fSum, &fSumSquares);
+		FilterbankProcess(g_psFilterbank, pfBlock, ulCount);
+	}
+
+	FilterbankRead(g_psFilterbank, pfPower);
+	arm_mult_f32(pfPower, g_fBarGain, pfPower, g_uiNumDisplayBars);
+
+	g_ulAnalysisCycles = (ulStart - SysTickValueGet()) & 0x00ffffff;
+
+	return(SilenceCheck(fSum, fSumSquares, ulTotal));
+}
+
+//*****************************************************************************
+//
+// Run the DSP calculations on the input vector.
+//
+// Step 1: center samples around 0 and multiply by the window
+// Step 2: get fast fourier transform of samples
+// Step 3: get complex power of each element in fft output
+// Step 4: figure out power in each LED range of bins, normalize it against
+//		   the recently observed maximum power, and set global LED array for
+//		   that LED column accordingly
+// Step 5: if the tuner is on, find the pitch from the autocorrelation
+// Step 6: ???
+// Step 7: Profit
+//
+// When zoomed in on a narrow band, steps 1 and 2 are replaced by the zoom FFT,
+// and step 5 is skipped.  When the filterbank engine is selected, steps 1
+// through 4 are replaced by running the new samples through the filterbank,
+// and step 5 is skipped.
+//
+// While the RMS of the input is below the silence threshold, steps 2 through
+// 5 are skipped and the bars just fall.
+//
+//*****************************************************************************
+void
+ProcessData(void)
+{
+	uint32_t i;
+	uint32_t j;
+	float32_t power;
+	float32_t fCoef;
+	float32_t fSample0, fSample1;
+	float32_t fSum, fSumSquares;
+	const tWindowCoef *pWindow;
+	unsigned long ulStart, ulCount;
+	static float32_t LEDPower[MAX_NUMBARS];
+	//uint32_t dummy;
+
+	g_ulFrameCaptureTime = g_ulCaptureTime;
+
+	//
+	// The filterbank engine replaces everything up to normalization, and has
+	// no spectrum for the peak finder or tuner to work from
+	//
+	if(g_ucEngine == ENGINE_FILTERBANK)
+	{
+		if(AnalyzeFilterbank(LEDPower))
+		{
+			DecayBars(g_uiNumDisplayBars);
+		}
+		else
+		{
+			NormalizeBars(LEDPower, g_uiNumDisplayBars);
+		}
+
+		if(g_ucPrintDbg)
+		{
+			UARTprintf("FPS: %2d  DPSPS: %2d  Cycles: %7d%s\r",
+					   g_ucLastFramesPerSec, g_uiLastDSPPerSec,
+					   g_ulAnalysisCycles, g_ucSilent ? "  Silent" : "");
+		}
+		return;
+	}
+
+	ulStart = SysTickValueGet();
+	fSum = 0;
+	fSumSquares = 0;
+
+	if(g_psZoom)
+	{
+		//
+		// Zoomed in, the window is applied to the decimated samples
+		//
+		ulCount = DecimateNewSamples(&fSum, &fSumSquares);
+	}
+	else
+	{
+		//
+		// Once audio capture has been restarted, the sample buffer holds
+		// samples from before the restart until a whole buffer of new ones
+		// has come in.  The slow uDMA method fills it a block at a time, so
+		// until then the last frame is left up.
+		//
+		if((g_ucDMAMethod == DMA_METHOD_SLOW) &&
+		   (g_ulNewSamples < NUM_SAMPLES))
+		{
+			g_ucDataReady = 0;
+			return;
+		}
+
+		//
+		// Ugly, ugly, ugly part where we have to move the ul samples into a
+		// float array because the fixed point fft functions in CMSIS seem to
+		// be not working.  While we're at it, we might as well center the
+		// samples around 0, as the CMSIS algorithm seems to like that, and
+		// apply the window.  The window is symmetric and only its first half
+		// is stored, so each coefficient is applied to sample i and to its
+		// mirror, N-1-i.  The sums the silence gate needs are taken along
+		// the way.
+		//
+		pWindow = g_psWindow->pCoefs;
+		for(i = 0; i < NUM_SAMPLES / 2; i++)
+		{
+			fCoef = WINDOW_COEF_TO_FLOAT(pWindow[i]);
+			fSample0 = (float)g_sArena.pusADCValues[i] - (float)0x800;
+			fSample1 = (float)g_sArena.pusADCValues[NUM_SAMPLES - 1 - i] -
+					   (float)0x800;
+			fSum += fSample0 + fSample1;
+			fSumSquares += (fSample0 * fSample0) + (fSample1 * fSample1);
+			g_pfFFTResult[i] = fSample0 * fCoef;
+			g_pfFFTResult[NUM_SAMPLES - 1 - i] = fSample1 * fCoef;
+		}
+		ulCount = NUM_SAMPLES;
+
+		if(g_ucDMAMethod == DMA_METHOD_SLOW)
+		{
+			g_ucDataReady = 0;
+		}
+	}
+
+	if(SilenceCheck(fSum, fSumSquares, ulCount))
+	{
+		//
+		// Nothing to see, so skip the FFT and let the bars fall.  Averaging
+		// starts over when the input comes back, rather than blending the
+		// old sound with the new.
+		//
+		DecayBars(g_uiNumDisplayBars);
+		g_ulAvgCount = 0;
+		g_sPeakResults.ulNumPeaks = 0;
+		g_sTunerResults.ucValid = 0;
+		g_ulAnalysisCycles = (ulStart - SysTickValueGet()) & 0x00ffffff;
+
+		if(g_ucPrintDbg)
+		{
+			UARTprintf("FPS: %2d  DPSPS: %2d  Cycles: %7d  Silent      "
+					   "                          \r", g_ucLastFramesPerSec,
+					   g_uiLastDSPPerSec, g_ulAnalysisCycles);
+		}
+	}
+	else if(g_psZoom)
+	{
+		ZoomSpectrum(g_psZoom, g_psWindow, g_pfFFTResult);
+	}
+	else
+	{
+		//
+		// Calculate FFT on samples
+		//
+		RealFFT(g_pfFFTResult);
+	}
+
+	//
+	// Turn the FFT results into a magnitude spectrum, averaging it with the
+	// spectra of previous frames if averaging is on.  In boxcar mode nothing
+	// new comes out until a full block of frames has been summed, so there's
+	// nothing to analyze until then.
+	//
+	if(!g_ucSilent &&
+	   AverageSpectrum(g_pfFFTResult, g_pfAvgSpectrum, &g_ulAvgCount,
+					   g_ulNumBins, g_ucAvgMode, g_ucAvgFrames))
+	{
+		//
+		// Find the loudest peaks in the spectrum
+		//
+		FindPeaks(g_pfFFTResult, &g_sPeakResults);
+
+		if(g_ucPrintDbg && !g_ucTunerMode)
+		{
+			UARTprintf("FPS: %2d  ", g_ucLastFramesPerSec);
+			UARTprintf("DPSPS: %2d  ", g_uiLastDSPPerSec);
+			UARTprintf("Cycles: %7d  ", g_ulAnalysisCycles);
+			UARTprintf("Paint: %7d  ", g_ulPaintCycles);
+			if(g_sPeakResults.ulNumPeaks)
+			{
+				UARTprintf("Peak at %05d.%d Hz, %04d counts\r",
+						   (int)g_sPeakResults.psPeaks[0].fFrequency,
+						   (int)(g_sPeakResults.psPeaks[0].fFrequency * 10) % 10,
+						   (int)g_sPeakResults.psPeaks[0].fAmplitude);
+			}
+		}
+		//
+		// Calculate power stored in the frequency band each LED represents
+		//
+		j = LEDFreqBreakpoints[0];
+		for(i=1;i<g_uiNumDisplayBars + 1;i++)
+		{
+			//
+			// Find the average power of all the LED bins in the freq array. j is
+			// the index of the lowest bin used for this LED.  To get the size of
+			// range to take the average of, we do highest indexed bin,
+			// LEDfreqBreakPoints[i], minus the lowest indexed bin, j, + 1.
+			//
+			arm_mean_f32(g_pfFFTResult+j, LEDFreqBreakpoints[i]-j + 1, &power);
+			//arm_max_f32(g_pfFFTResult+j, LEDFreqBreakpoints[i]-j+1, &power, &dummy);
+
+			//
+			// Apply the bar's gain, which corrects for the window's coherent
+			// gain so band powers read the same no matter which window is
+			// selected, and applies the selected frequency weighting
+			//
+			power *= g_fBarGain[i - 1];
+			LEDPower[i - 1] = power;
+			j = LEDFreqBreakpoints[i] + 1;
+		}
+		g_ulAnalysisCycles = (ulStart - SysTickValueGet()) & 0x00ffffff;
+
+		//
+		// Normalize each bar against its recent maximum
+		//
+		NormalizeBars(LEDPower, g_uiNumDisplayBars);
+
+		//
+		// In tuner mode, find the fundamental from the autocorrelation.  This is
+		// done last since it overwrites the magnitudes.  Until the DSP has been
+		// set up again, the frame may still be taken with a window the tuner
+		// can't use.
+		//
+		if(g_ucTunerMode && (g_psZoom == 0) &&
+		   (g_sDSPConfig.ucWindowType == WindowTypeGet()))
+		{
+			TunerProcess(AutoCorrelate(g_pfFFTResult), NUM_SAMPLES, g_psWindow,
+						 (float)g_uiSamplingFreq, &g_sTunerResults);
+
+			if(g_sTunerResults.ucValid)
+			{
+				UARTprintf("Tuner: %2s%d %c%02d cents  %04d.%d Hz     \r",
+						   TunerNoteName(g_sTunerResults.iNote),
+						   TunerNoteOctave(g_sTunerResults.iNote),
+						   (g_sTunerResults.iCents < 0) ? '-' : '+',
+						   (g_sTunerResults.iCents < 0) ?
+						   -g_sTunerResults.iCents : g_sTunerResults.iCents,
+						   (int)g_sTunerResults.fFrequency,
+						   (int)(g_sTunerResults.fFrequency * 10) % 10);
+			}
+			else
+			{
+				UARTprintf("Tuner: ---                            \r");
+			}
+		}
 	}
 
 	if(g_ucDMAMethod == DMA_METHOD_FAST)
@@ -401,14 +1975,14 @@ ProcessData(void)
 			uDMAChannelTransferSet(UDMA_CHANNEL_ADC3 | UDMA_PRI_SELECT,
 								   UDMA_MODE_BASIC,
 								   (void *)(ADC0_BASE + ADC_O_SSFIFO3 + (0x20 * UDMA_ARB_1)),
-								   g_ulADCValues, UDMA_XFER_MAX);
+								   g_sArena.pusADCValues, UDMA_XFER_MAX);
 		}
 		else
 		{
 			uDMAChannelTransferSet(UDMA_CHANNEL_ADC3 | UDMA_PRI_SELECT,
 								   UDMA_MODE_BASIC,
 								   (void *)(ADC0_BASE + ADC_O_SSFIFO3 + (0x20 * UDMA_ARB_1)),
-								   g_ulADCValues, NUM_SAMPLES);
+								   g_sArena.pusADCValues, NUM_SAMPLES);
 		}
 
 		//
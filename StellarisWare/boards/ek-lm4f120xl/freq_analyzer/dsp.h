@@ -34,9 +34,110 @@ extern "C"
 #define NUM_SAMPLES				2048
 
 //
-// Amount by which the recorded maximum power decays 15 times per second
+// Number of unique bins in the FFT of a real signal, DC through Nyquist
 //
-#define	POWER_DECAY_FACTOR		0.999
+#define NUM_BINS				((NUM_SAMPLES / 2) + 1)
+
+//
+// Frequency weighting curves that can be applied to the bars.  Z is flat.
+//
+#define WEIGHTING_Z				0
+#define WEIGHTING_A				1
+#define WEIGHTING_C				2
+
+//
+// The scales the bars can be drawn on.  Linear bars are in proportion to the
+// amplitude in each band; dB bars are in proportion to its logarithm, between
+// g_cDbFloor and g_cDbCeiling.
+//
+#define BAR_SCALE_LINEAR		0
+#define BAR_SCALE_DB			1
+
+//
+// The analysis engines.  The FFT engine measures the bars from the spectrum
+// of each block of samples.  The filterbank engine runs the samples through a
+// bank of fractional-octave bandpass filters, one per bar, and measures the
+// RMS level of each.
+//
+#define ENGINE_FFT				0
+#define ENGINE_FILTERBANK		1
+
+//
+// Attack and release time constants, in milliseconds, for the maximum power
+// each bar is normalized against.  An attack of 0 makes the maximum jump
+// straight to any louder power.
+//
+#define NORM_ATTACK_MS			0
+#define NORM_RELEASE_MS			55000
+
+//
+// The longest time, in milliseconds, one frame is allowed to advance the
+// normalization.  SysTick wraps after about 200ms, so longer gaps (such as
+// while the DSP is being reconfigured) are treated as this long.
+//
+#define NORM_MAX_FRAME_MS		200
+
+//
+// The time, in milliseconds, a full height bar takes to fall to nothing once
+// the input goes silent
+//
+#define SILENCE_FALL_MS			400
+
+//
+// Number of spectral peaks tracked by the peak analysis stage
+//
+#define NUM_PEAKS				4
+
+//
+// The stages of setting the DSP up again that DSPReconfigure can run, which
+// it returns the set of.  CAPTURE restarts audio capture at a new sampling
+// rate or uDMA method.  BINS sets up the zoom FFT and window for new bins.
+// LAYOUT lays the bars out again, carrying each bar's normalization over to
+// the new bars.  AVERAGE restarts spectrum averaging.
+//
+#define RECONFIG_CAPTURE		0x01
+#define RECONFIG_BINS			0x02
+#define RECONFIG_LAYOUT			0x04
+#define RECONFIG_AVERAGE		0x08
+
+//*****************************************************************************
+//
+// A single spectral peak, refined to sub-bin accuracy.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// Interpolated frequency of the peak, in Hz.
+	//
+	float fFrequency;
+
+	//
+	// Interpolated amplitude of the peak, in ADC counts.
+	//
+	float fAmplitude;
+}
+tPeak;
+
+//*****************************************************************************
+//
+// The results of the peak analysis stage for the most recent frame.  The
+// peaks are sorted from loudest to quietest.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The number of valid entries in psPeaks.
+	//
+	unsigned long ulNumPeaks;
+
+	//
+	// The peaks that were found.
+	//
+	tPeak psPeaks[NUM_PEAKS];
+}
+tPeakResults;
 
 //*****************************************************************************
 //
@@ -45,6 +146,13 @@ extern "C"
 //*****************************************************************************
 extern float32_t maxLEDPowers[MAX_NUMBARS];
 extern float g_HzPerBin;
+extern float g_fFirstBinFreq;
+extern float g_fMagnitudeScale;
+extern tPeakResults g_sPeakResults;
+extern unsigned long g_ulFrameCount;
+extern unsigned long g_ulConfigEpoch;
+extern unsigned long g_ulAnalysisCycles;
+extern unsigned char g_ucSilent;
 
 //*****************************************************************************
 //
@@ -52,6 +160,7 @@ extern float g_HzPerBin;
 //
 //*****************************************************************************
 extern void InitDSP(void);
+extern unsigned long DSPReconfigure(void);
 extern void ProcessData(void);
 
 //*****************************************************************************
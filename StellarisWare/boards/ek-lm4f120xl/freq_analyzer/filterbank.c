@@ -0,0 +1,489 @@
+//*****************************************************************************
+//
+// filterbank.c - Fractional-octave filterbank analysis engine.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+
+#include "arm_math.h"
+#include "filterbank.h"
+#include <math.h>
+
+//*****************************************************************************
+//
+// Private predefines and variables
+//
+//*****************************************************************************
+
+//
+// The octave ratio used by IEC 61260, 10^(3/10).  Band centers are powers of
+// this around 1 kHz rather than powers of 2, so they land on the familiar
+// nominal frequencies.
+//
+#define OCTAVE_RATIO			1.99526231f
+
+//
+// A band runs at the lowest rate that keeps its upper edge below this fraction
+// of that rate.  Bands further up than this are warped badly enough by the
+// bilinear transform that they would not meet their shape.
+//
+#define MAX_EDGE_FRACTION		0.18f
+
+//
+// Bands at the full input rate are allowed up to this fraction of it, which
+// leaves room for the anti-aliasing filter in front of the ADC.
+//
+#define MAX_EDGE_FRACTION_FULL	0.45f
+
+//
+// The cutoff of the anti-aliasing filter, as a fraction of the rate being
+// halved.  Everything the next stage's bands use is well inside this, and
+// what would alias onto them is more than 80 dB down.
+//
+#define DECIM_CUTOFF			0.2f
+
+//*****************************************************************************
+//
+// Private Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Map an analog pole onto the z plane with the bilinear transform and store
+// the biquad denominator for it and its conjugate.
+//
+// param fRe, fIm: the pole, with s already scaled by 1 / (2 fs) so the
+//		 transform is z = (1 + s) / (1 - s)
+// param pfCoeffs: the biquad's five coefficients.  Only the feedback terms,
+//		 which CMSIS stores negated, are written.
+//
+//*****************************************************************************
+static void
+BilinearPole(float fRe, float fIm, float32_t *pfCoeffs)
+{
+	float fDenom, fZRe, fZIm;
+
+	fDenom = ((1.0f - fRe) * (1.0f - fRe)) + (fIm * fIm);
+	fZRe = (1.0f - (fRe * fRe) - (fIm * fIm)) / fDenom;
+	fZIm = (2.0f * fIm) / fDenom;
+
+	pfCoeffs[3] = 2.0f * fZRe;
+	pfCoeffs[4] = -((fZRe * fZRe) + (fZIm * fZIm));
+}
+
+//*****************************************************************************
+//
+// Design a Butterworth bandpass as FB_BAND_SECTIONS biquads.
+//
+// The poles of a Butterworth lowpass of order FB_BAND_SECTIONS are moved
+// through the analog lowpass to bandpass transform, s -> (s^2 + W0^2) / (B s),
+// and then mapped into the z plane with the bilinear transform.  The band
+// edges are prewarped so they land exactly where they should.  Each section
+// gets one zero at DC and one at Nyquist, and is scaled to unity gain at the
+// band's center frequency, which leaves the whole filter at unity there as
+// well.
+//
+// param fLow, fCenter, fHigh: the band edges and center, as fractions of the
+//		 sample rate
+// param pfCoeffs: where to store the FB_BAND_SECTIONS * 5 coefficients
+//
+//*****************************************************************************
+static void
+DesignBandpass(float fLow, float fCenter, float fHigh, float32_t *pfCoeffs)
+{
+	float fW1, fW2, fBW, fW0Sq, fAngle, fPr, fPi;
+	float fDr, fDi, fMag, fSr, fSi, fCos, fSin, fCos2, fSin2, fRe, fIm;
+	unsigned long ulSection, ulPole;
+
+	fW1 = tanf(PI * fLow);
+	fW2 = tanf(PI * fHigh);
+	fBW = fW2 - fW1;
+	fW0Sq = fW1 * fW2;
+
+	ulSection = 0;
+	for(ulPole = 0; ulPole < (FB_BAND_SECTIONS + 1) / 2; ulPole++)
+	{
+		//
+		// A prototype pole from the upper half of the circle, scaled by the
+		// bandwidth.  Its conjugate gives the conjugates of the same two
+		// bandpass poles.
+		//
+		fAngle = (PI / 2.0f) + ((PI * ((2 * ulPole) + 1)) /
+								(2.0f * FB_BAND_SECTIONS));
+		fPr = cosf(fAngle) * fBW;
+		fPi = sinf(fAngle) * fBW;
+
+		//
+		// The bandpass poles are the roots of s^2 - p B s + W0^2, which are
+		// (p B +/- sqrt(p^2 B^2 - 4 W0^2)) / 2
+		//
+		fDr = (fPr * fPr) - (fPi * fPi) - (4.0f * fW0Sq);
+		fDi = 2.0f * fPr * fPi;
+		fMag = sqrtf((fDr * fDr) + (fDi * fDi));
+		fSr = sqrtf((fMag + fDr) / 2.0f);
+		fSi = sqrtf((fMag - fDr) / 2.0f);
+		if(fDi < 0)
+		{
+			fSi = -fSi;
+		}
+		BilinearPole((fPr + fSr) / 2.0f, (fPi + fSi) / 2.0f,
+					 pfCoeffs + (5 * ulSection++));
+
+		//
+		// The real prototype pole of an odd order filter gives a conjugate
+		// pair, which one section already covers
+		//
+		if(ulSection < FB_BAND_SECTIONS)
+		{
+			BilinearPole((fPr - fSr) / 2.0f, (fPi - fSi) / 2.0f,
+						 pfCoeffs + (5 * ulSection++));
+		}
+	}
+
+	//
+	// Scale each section to unity at the center frequency
+	//
+	fCos = cosf(2.0f * PI * fCenter);
+	fSin = sinf(2.0f * PI * fCenter);
+	fCos2 = (2.0f * fCos * fCos) - 1.0f;
+	fSin2 = 2.0f * fSin * fCos;
+	for(ulSection = 0; ulSection < FB_BAND_SECTIONS; ulSection++)
+	{
+		//
+		// |1 - e^(-2jw)| over |1 - a1 e^(-jw) - a2 e^(-2jw)|, with a1 and a2
+		// as CMSIS stores them
+		//
+		fRe = 1.0f - (pfCoeffs[3] * fCos) - (pfCoeffs[4] * fCos2);
+		fIm = (pfCoeffs[3] * fSin) + (pfCoeffs[4] * fSin2);
+		fMag = sqrtf(((fRe * fRe) + (fIm * fIm)) /
+					 (((1.0f - fCos2) * (1.0f - fCos2)) + (fSin2 * fSin2)));
+
+		pfCoeffs[0] = fMag;
+		pfCoeffs[1] = 0;
+		pfCoeffs[2] = -fMag;
+		pfCoeffs += 5;
+	}
+}
+
+//*****************************************************************************
+//
+// Design a 6th order Butterworth lowpass as three biquads, for use ahead of a
+// halving of the sample rate.
+//
+// param fCutoff: the cutoff frequency, as a fraction of the sample rate
+// param pfCoeffs: where to store the 3 * 5 coefficients
+//
+//*****************************************************************************
+static void
+DesignLowpass(float fCutoff, float32_t *pfCoeffs)
+{
+	float fWc, fAngle, fGain;
+	unsigned long ulSection;
+
+	fWc = tanf(PI * fCutoff);
+	for(ulSection = 0; ulSection < FB_DECIM_SECTIONS; ulSection++)
+	{
+		//
+		// The poles of a Butterworth lowpass are spaced evenly around the
+		// left half of a circle of radius Wc
+		//
+		fAngle = (PI / 2.0f) + ((PI * ((2 * ulSection) + 1)) /
+								(4.0f * FB_DECIM_SECTIONS));
+		BilinearPole(fWc * cosf(fAngle), fWc * sinf(fAngle), pfCoeffs);
+
+		//
+		// Both zeros go at Nyquist.  Scale for unity gain at DC.
+		//
+		fGain = (1.0f - pfCoeffs[3] - pfCoeffs[4]) / 4.0f;
+		pfCoeffs[0] = fGain;
+		pfCoeffs[1] = 2.0f * fGain;
+		pfCoeffs[2] = fGain;
+		pfCoeffs += 5;
+	}
+}
+
+//*****************************************************************************
+//
+// Keep every other sample of a block, in place.
+//
+// param pfBuffer: the block
+// param ulCount: the number of samples in the block
+// param pulPhase: which sample of the block to keep first, 0 or 1.  Updated
+//		 for the next block.
+//
+// return: the number of samples kept
+//
+//*****************************************************************************
+static unsigned long
+Decimate(float32_t *pfBuffer, unsigned long ulCount, unsigned long *pulPhase)
+{
+	unsigned long ulIn, ulOut;
+
+	ulOut = 0;
+	for(ulIn = *pulPhase; ulIn < ulCount; ulIn += 2)
+	{
+		pfBuffer[ulOut++] = pfBuffer[ulIn];
+	}
+	*pulPhase = (*pulPhase + ulCount) & 1;
+	return(ulOut);
+}
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Lay out and design a fractional-octave filterbank.
+//
+// Band centers follow IEC 61260: 1 kHz times powers of OCTAVE_RATIO^(1/b) for
+// odd b, offset by half a band for even b, with edges half a band either side
+// of the center.  Each band is a 6th order Butterworth bandpass.  To keep the
+// low bands' poles away from the unit circle, and to save work, the signal is
+// repeatedly lowpass filtered and halved in rate, and each band runs at the
+// lowest rate that still comfortably holds it.
+//
+// param psBank: the filterbank to initialize
+// param ulBytes: the number of bytes available at psBank
+// param ulSampleRate: the input sample rate, in Hz
+// param ulFraction: the bandwidth of each band, one of the FB_OCTAVE_*
+//		 values
+// param ulMinFreq, ulMaxFreq: the range, in Hz, the band centers must fall in
+//
+// return: the number of bands, or 0 if the bank doesn't fit in ulBytes or no
+//		   bands fit in the range
+//
+//*****************************************************************************
+unsigned long
+FilterbankInit(tFilterbank *psBank, unsigned long ulBytes,
+			   unsigned long ulSampleRate, unsigned long ulFraction,
+			   unsigned long ulMinFreq, unsigned long ulMaxFreq)
+{
+	tFilterbankBand *psBand;
+	long lIndex;
+	unsigned long ulStage;
+	float fLogRatio, fExp, fCenter, fHalfBand, fHigh, fRate;
+
+	if((ulBytes < sizeof(tFilterbank)) || (ulMinFreq == 0))
+	{
+		return(0);
+	}
+
+	psBank->ulNumBands = 0;
+	psBank->ulNumStages = 1;
+	psBank->sCost.ulSamples = 0;
+	psBank->sCost.ulSections = 0;
+	psBank->sCost.fSectionsPerSample = 0;
+
+	//
+	// Find the first band index whose center is at or above the minimum.
+	// Even fractions are offset by half a band so the centers straddle
+	// 1 kHz.
+	//
+	fLogRatio = logf(OCTAVE_RATIO) / (float)ulFraction;
+	fExp = logf((float)ulMinFreq / 1000.0f) / fLogRatio;
+	if((ulFraction & 1) == 0)
+	{
+		fExp -= 0.5f;
+	}
+	lIndex = (long)ceilf(fExp - 0.001f);
+	fHalfBand = expf(fLogRatio / 2.0f);
+
+	while(psBank->ulNumBands < FB_MAX_BANDS)
+	{
+		fExp = (float)lIndex++;
+		if((ulFraction & 1) == 0)
+		{
+			fExp += 0.5f;
+		}
+		fCenter = 1000.0f * expf(fExp * fLogRatio);
+		fHigh = fCenter * fHalfBand;
+		if((fCenter > (float)ulMaxFreq) ||
+		   (fHigh >= MAX_EDGE_FRACTION_FULL * (float)ulSampleRate))
+		{
+			break;
+		}
+
+		//
+		// Pick the lowest rate that keeps the band's upper edge low enough
+		//
+		fRate = (float)ulSampleRate;
+		for(ulStage = 0; ulStage < FB_MAX_STAGES - 1; ulStage++)
+		{
+			if(fHigh > (MAX_EDGE_FRACTION * fRate / 2.0f))
+			{
+				break;
+			}
+			fRate /= 2.0f;
+		}
+
+		psBand = &psBank->psBands[psBank->ulNumBands++];
+		psBand->fCenter = fCenter;
+		psBand->ulStage = ulStage;
+		psBand->fSumSquares = 0;
+		psBand->ulCount = 0;
+		psBand->fLevel = 0;
+		DesignBandpass(fCenter / (fHalfBand * fRate), fCenter / fRate,
+					   fHigh / fRate, psBand->pfCoeffs);
+		arm_biquad_cascade_df1_init_f32(&psBand->sFilter, FB_BAND_SECTIONS,
+										psBand->pfCoeffs, psBand->pfState);
+
+		if(ulStage >= psBank->ulNumStages)
+		{
+			psBank->ulNumStages = ulStage + 1;
+		}
+		psBank->sCost.fSectionsPerSample +=
+			(float)FB_BAND_SECTIONS / (float)(1 << ulStage);
+	}
+
+	//
+	// Set up a decimator between each pair of rates in use
+	//
+	for(ulStage = 0; ulStage + 1 < psBank->ulNumStages; ulStage++)
+	{
+		DesignLowpass(DECIM_CUTOFF, psBank->psDecim[ulStage].pfCoeffs);
+		arm_biquad_cascade_df1_init_f32(&psBank->psDecim[ulStage].sFilter,
+										FB_DECIM_SECTIONS,
+										psBank->psDecim[ulStage].pfCoeffs,
+										psBank->psDecim[ulStage].pfState);
+		psBank->psDecim[ulStage].ulPhase = 0;
+		psBank->sCost.fSectionsPerSample +=
+			(float)FB_DECIM_SECTIONS / (float)(1 << ulStage);
+	}
+
+	return(psBank->ulNumBands);
+}
+
+//*****************************************************************************
+//
+// Run a block of samples through every band of the filterbank, adding the
+// output power of each band to its accumulator.
+//
+// The filters keep their state between calls, so the samples should pick up
+// exactly where the last call left off.  Any number of samples may be passed;
+// they are worked through FB_BLOCK_SIZE at a time.
+//
+// param psBank: the filterbank
+// param pfSamples: the new samples, centered around 0
+// param ulCount: the number of new samples
+//
+//*****************************************************************************
+void
+FilterbankProcess(tFilterbank *psBank, float32_t *pfSamples,
+				  unsigned long ulCount)
+{
+	tFilterbankBand *psBand;
+	unsigned long ulBlock, ulLength, ulStage, ulBand;
+	float32_t *pfIn, *pfOut;
+	float32_t fPower;
+
+	while(ulCount)
+	{
+		ulBlock = (ulCount > FB_BLOCK_SIZE) ? FB_BLOCK_SIZE : ulCount;
+		psBank->sCost.ulSamples += ulBlock;
+
+		pfIn = pfSamples;
+		ulLength = ulBlock;
+		for(ulStage = 0; (ulStage < psBank->ulNumStages) && ulLength;
+			ulStage++)
+		{
+			//
+			// Measure every band that runs at this rate
+			//
+			for(ulBand = 0; ulBand < psBank->ulNumBands; ulBand++)
+			{
+				psBand = &psBank->psBands[ulBand];
+				if(psBand->ulStage != ulStage)
+				{
+					continue;
+				}
+				arm_biquad_cascade_df1_f32(&psBand->sFilter, pfIn,
+										   psBank->pfBandOut, ulLength);
+				arm_power_f32(psBank->pfBandOut, ulLength, &fPower);
+				psBand->fSumSquares += fPower;
+				psBand->ulCount += ulLength;
+				psBank->sCost.ulSections += FB_BAND_SECTIONS * ulLength;
+			}
+
+			//
+			// Halve the rate for the next stage down
+			//
+			if(ulStage + 1 < psBank->ulNumStages)
+			{
+				pfOut = psBank->pfStage[ulStage & 1];
+				arm_biquad_cascade_df1_f32(&psBank->psDecim[ulStage].sFilter,
+										   pfIn, pfOut, ulLength);
+				psBank->sCost.ulSections += FB_DECIM_SECTIONS * ulLength;
+				ulLength = Decimate(pfOut, ulLength,
+									&psBank->psDecim[ulStage].ulPhase);
+				pfIn = pfOut;
+			}
+		}
+
+		pfSamples += ulBlock;
+		ulCount -= ulBlock;
+	}
+}
+
+//*****************************************************************************
+//
+// Read the level of every band since the last read, and start a new
+// measurement.
+//
+// How often this is called sets the output rate of the filterbank.  The level
+// is the RMS of the band's output scaled up by sqrt(2), so a sine in the
+// middle of a band reads as its amplitude, the same as the FFT engine's bars.
+// A band that has not seen a sample since the last read, which can happen to
+// the lowest bands when reads come faster than their decimated rate, keeps
+// its last value.
+//
+// param psBank: the filterbank
+// param pfAmplitude: where to store the level of each band, ulNumBands long
+//
+//*****************************************************************************
+void
+FilterbankRead(tFilterbank *psBank, float32_t *pfAmplitude)
+{
+	tFilterbankBand *psBand;
+	unsigned long ulBand;
+
+	for(ulBand = 0; ulBand < psBank->ulNumBands; ulBand++)
+	{
+		psBand = &psBank->psBands[ulBand];
+		if(psBand->ulCount)
+		{
+			psBand->fLevel = sqrtf((2.0f * psBand->fSumSquares) /
+								   (float32_t)psBand->ulCount);
+			psBand->fSumSquares = 0;
+			psBand->ulCount = 0;
+		}
+		pfAmplitude[ulBand] = psBand->fLevel;
+	}
+}
@@ -0,0 +1,202 @@
+//*****************************************************************************
+//
+// filterbank.h - Predefines, public functions, and globals for the
+// fractional-octave filterbank analysis engine.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __FILTERBANK_H__
+#define __FILTERBANK_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The supported bandwidths, as the b in 1/b octave
+//
+#define FB_OCTAVE_1				1
+#define FB_OCTAVE_3				3
+#define FB_OCTAVE_6				6
+
+//
+// The most bands one filterbank can hold, which is eight octaves at 1/6
+// octave.  The bank has to fit in the FFT engine's buffers.
+//
+#define FB_MAX_BANDS			48
+
+//
+// The most times the signal is halved in rate before it reaches the lowest
+// bands
+//
+#define FB_MAX_STAGES			8
+
+//
+// The number of biquad sections in each band filter (a 6th order Butterworth
+// bandpass, as in ANSI S1.11) and in each decimation filter (a 6th order
+// Butterworth lowpass)
+//
+#define FB_BAND_SECTIONS		3
+#define FB_DECIM_SECTIONS		3
+
+//
+// The number of samples filtered at a time.  This sets the size of the
+// working buffers, not the output rate; any number of samples may be passed
+// to FilterbankProcess.
+//
+#define FB_BLOCK_SIZE			32
+
+//*****************************************************************************
+//
+// The work a filterbank has done since it was initialized, for comparing its
+// cost against the FFT engine.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The number of input samples processed.
+	//
+	unsigned long ulSamples;
+
+	//
+	// The number of biquad section updates, across all bands and decimation
+	// stages.  Each one is five multiplies and four adds.
+	//
+	unsigned long ulSections;
+
+	//
+	// The number of biquad section updates per input sample, worked out when
+	// the bank was designed.  The decimated stages contribute fractions.
+	//
+	float fSectionsPerSample;
+}
+tFilterbankCost;
+
+//*****************************************************************************
+//
+// One bandpass filter in the bank and its running RMS accumulator.
+//
+//*****************************************************************************
+typedef struct
+{
+	arm_biquad_casd_df1_inst_f32 sFilter;
+	float32_t pfCoeffs[5 * FB_BAND_SECTIONS];
+	float32_t pfState[4 * FB_BAND_SECTIONS];
+
+	//
+	// The sum of the squared filter output, and the number of samples in it,
+	// since the band was last read.
+	//
+	float32_t fSumSquares;
+	unsigned long ulCount;
+
+	//
+	// The level of the band at the last read.
+	//
+	float32_t fLevel;
+
+	//
+	// The exact mid-band frequency of the band, in Hz.
+	//
+	float fCenter;
+
+	//
+	// The decimation stage the band runs at.  Stage k runs at the input rate
+	// divided by 2^k.
+	//
+	unsigned long ulStage;
+}
+tFilterbankBand;
+
+//*****************************************************************************
+//
+// The anti-aliasing filter run ahead of each halving of the sample rate.
+//
+//*****************************************************************************
+typedef struct
+{
+	arm_biquad_casd_df1_inst_f32 sFilter;
+	float32_t pfCoeffs[5 * FB_DECIM_SECTIONS];
+	float32_t pfState[4 * FB_DECIM_SECTIONS];
+
+	//
+	// Which of the filtered samples is kept next, 0 or 1.  Carried between
+	// blocks so blocks of odd length decimate correctly.
+	//
+	unsigned long ulPhase;
+}
+tFilterbankDecimator;
+
+//*****************************************************************************
+//
+// A complete filterbank.  This is big, so the caller provides the memory.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The number of bands, sorted from lowest to highest frequency.
+	//
+	unsigned long ulNumBands;
+
+	//
+	// The number of rates the bank runs at.  There is one decimator between
+	// each pair of neighbouring rates.
+	//
+	unsigned long ulNumStages;
+
+	tFilterbankBand psBands[FB_MAX_BANDS];
+	tFilterbankDecimator psDecim[FB_MAX_STAGES - 1];
+
+	//
+	// Working buffers: one for the output of the band being measured and two
+	// that the decimated signal ping-pongs between.
+	//
+	float32_t pfBandOut[FB_BLOCK_SIZE];
+	float32_t pfStage[2][FB_BLOCK_SIZE];
+
+	tFilterbankCost sCost;
+}
+tFilterbank;
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern unsigned long FilterbankInit(tFilterbank *psBank,
+									unsigned long ulBytes,
+									unsigned long ulSampleRate,
+									unsigned long ulFraction,
+									unsigned long ulMinFreq,
+									unsigned long ulMaxFreq);
+extern void FilterbankProcess(tFilterbank *psBank, float32_t *pfSamples,
+							  unsigned long ulCount);
+extern void FilterbankRead(tFilterbank *psBank, float32_t *pfAmplitude);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __FILTERBANK_H__
@@ -41,6 +41,7 @@
 #include "driverlib/interrupt.h"
 #include "driverlib/rom.h"
 #include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
 #include "driverlib/timer.h"
 #include "driverlib/udma.h"
 
@@ -53,7 +54,11 @@
 #include "images.h"
 #include "gui.h"
 #include "dsp.h"
+#include "latency.h"
 #include "freq_analyzer.h"
+#include "arena.h"
+#include "pointer.h"
+#include "store.h"
 #include <math.h>
 
 //*****************************************************************************
@@ -62,7 +67,7 @@
 //! This project uses the following peripherals and pins:
 //! UART0 for display of debug statements
 //! ADC input ch0 on ADC0 Sequencer 3 for audio capture
-//! ADC input ch8 and 9 on ADC1 Sequencer 3 for touchscreen capture
+//! ADC input ch8 and 9 on ADC1 Sequencer 0 for touchscreen capture
 //! Timer 0 for the audio sampling timer
 //! Timer 1 for the touchscreen sampling timer
 //! Timer 2 for 1 Hz debug functionality (FPS calculation, DSPPS calculation)
@@ -90,38 +95,29 @@
 #define UDMA_XFER_MAX			1024
 
 //
-// The size of the ping pong buffer used for the slow uDMA method
+// Variables used for signalling which uDMA method to use.  The uDMA control
+// table and the buffers the ADC values are captured into are in the arena.
 //
-#define DMA_SIZE 256
+volatile unsigned char g_ucDMAMethod;
+volatile unsigned char g_ucDMApingpong;
 
 //
-// The control table used by the uDMA controller.  This table must be aligned
-// to a 1024 byte boundary.
+// Flag from the uDMA engine signaling that data is ready to be processed
 //
-#if defined(ewarm)
-#pragma data_alignment=1024
-unsigned char ucControlTable[1024];
-#elif defined(ccs)
-#pragma DATA_ALIGN(ucControlTable, 1024)
-unsigned char ucControlTable[1024];
-#else
-unsigned char ucControlTable[1024] __attribute__ ((aligned(1024)));
-#endif
+volatile unsigned char g_ucDataReady;
 
 //
-// Variables used for storing ADC values and signalling which uDMA method to
-// use
+// The number of samples at the end of the sample buffer that have come in since
+// the DSP loop last took them.  Only the filterbank engine uses this; the FFT
+// engine always works on the whole buffer.
 //
-volatile unsigned char g_ucDMAMethod;
-unsigned short g_ulADCValues[NUM_SAMPLES];
-unsigned short g_usDMAping[DMA_SIZE];
-unsigned short g_usDMApong[DMA_SIZE];
-volatile unsigned char g_ucDMApingpong;
+volatile unsigned long g_ulNewSamples;
 
 //
-// Flag from the uDMA engine signaling that data is ready to be processed
+// The latency timestamp of the moment the newest samples in the sample buffer
+// landed
 //
-volatile unsigned char g_ucDataReady;
+volatile unsigned long g_ulCaptureTime;
 
 //
 // The count of uDMA errors.  This value is incremented by the uDMA error
@@ -129,6 +125,13 @@ volatile unsigned char g_ucDataReady;
 //
 static volatile unsigned long g_uluDMAErrCount = 0;
 
+//
+// How far the fast uDMA method has got through filling the sample buffer:
+// the transfers completed, and the samples they moved
+//
+static unsigned long g_uluDMACount;
+static unsigned long g_ulDataXferd;
+
 //
 // The count of times various uDMA error conditions detected.
 //
@@ -145,6 +148,19 @@ volatile unsigned char g_ucLastFramesPerSec;
 volatile unsigned int g_uiDSPPerSec;
 volatile unsigned int g_uiLastDSPPerSec;
 
+//
+// Set by the once a second timer to have the main loop close out the
+// latency statistics
+//
+static volatile unsigned char g_ucNewSecond;
+
+//*****************************************************************************
+//
+// Forward declaration of private functions
+//
+//*****************************************************************************
+static void CaptureArm(void);
+
 
 //*****************************************************************************
 //
@@ -192,6 +208,8 @@ Timer2AIntHandler(void)
     g_uiLastDSPPerSec = g_uiDSPPerSec;
     g_uiDSPPerSec = 0;
 
+    g_ucNewSecond = 1;
+
     TimerLoadSet(TIMER2_BASE, TIMER_A, SysCtlClockGet());
     TimerEnable(TIMER2_BASE, TIMER_A);
 }
@@ -210,8 +228,6 @@ void
 ADC3IntHandler(void)
 {
 	unsigned long ulStatus;
-	static unsigned long uluDMACount = 0;
-	static unsigned long ulDataXferd = 0;
 	unsigned long ulNextuDMAXferSize = 0;
 	unsigned short *pusDMABuffer;
 	unsigned short *pusCopyBuffer;
@@ -257,14 +273,14 @@ ADC3IntHandler(void)
 		//
 		if(g_ucDMApingpong == 0)
 		{
-			pusDMABuffer = g_usDMApong;
-			pusCopyBuffer = g_usDMAping;
+			pusDMABuffer = g_sArena.pusDMAPong;
+			pusCopyBuffer = g_sArena.pusDMAPing;
 			g_ucDMApingpong = 1;
 		}
 		else
 		{
-			pusDMABuffer = g_usDMAping;
-			pusCopyBuffer = g_usDMApong;
+			pusDMABuffer = g_sArena.pusDMAPing;
+			pusCopyBuffer = g_sArena.pusDMAPong;
 			g_ucDMApingpong = 0;
 		}
 
@@ -284,7 +300,7 @@ ADC3IntHandler(void)
 		//
 		for(i=0; i < (NUM_SAMPLES - DMA_SIZE); i++)
 		{
-			g_ulADCValues[i] = g_ulADCValues[i + DMA_SIZE];
+			g_sArena.pusADCValues[i] = g_sArena.pusADCValues[i + DMA_SIZE];
 		}
 
 		//
@@ -292,12 +308,23 @@ ADC3IntHandler(void)
 		//
 		for(i=0; i < DMA_SIZE; i++)
 		{
-			g_ulADCValues[i + NUM_SAMPLES - DMA_SIZE] = pusCopyBuffer[i];
+			g_sArena.pusADCValues[i + NUM_SAMPLES - DMA_SIZE] = pusCopyBuffer[i];
+		}
+
+		//
+		// If the DSP loop has fallen more than a whole buffer behind, the
+		// oldest samples it hasn't taken yet have just been shifted out
+		//
+		g_ulNewSamples += DMA_SIZE;
+		if(g_ulNewSamples > NUM_SAMPLES)
+		{
+			g_ulNewSamples = NUM_SAMPLES;
 		}
 
 		//
 		// Signal that we have new data to be processed
 		//
+		g_ulCaptureTime = LatencyTimestamp();
 		g_ucDataReady = 1;
 	}
 	else
@@ -319,28 +346,28 @@ ADC3IntHandler(void)
 		// size, we might need to set up another uDMA transfer before signaling
 		// that we are ready to process the data.
 		//
-		uluDMACount++;
-		ulDataXferd += UDMA_XFER_MAX;
+		g_uluDMACount++;
+		g_ulDataXferd += UDMA_XFER_MAX;
 
-		if(NUM_SAMPLES > ulDataXferd)
+		if(NUM_SAMPLES > g_ulDataXferd)
 		{
 			//
 			// Figure out how many more uDMA transfers are required to completely
 			// fill our sample array, which will tell us what size we need our next
 			// uDMA transfer to be
 			//
-			if((NUM_SAMPLES - ulDataXferd) > UDMA_XFER_MAX)
+			if((NUM_SAMPLES - g_ulDataXferd) > UDMA_XFER_MAX)
 			{
 				ulNextuDMAXferSize = UDMA_XFER_MAX;
 			}
 			else
 			{
-				ulNextuDMAXferSize = NUM_SAMPLES - ulDataXferd;
+				ulNextuDMAXferSize = NUM_SAMPLES - g_ulDataXferd;
 			}
 			uDMAChannelTransferSet(UDMA_CHANNEL_ADC3 | UDMA_PRI_SELECT,
 								   UDMA_MODE_BASIC,
 								   (void *)(ADC0_BASE + ADC_O_SSFIFO3 + (0x20 * UDMA_ARB_1)),
-								   g_ulADCValues + (UDMA_XFER_MAX * uluDMACount),
+								   g_sArena.pusADCValues + (UDMA_XFER_MAX * g_uluDMACount),
 								   ulNextuDMAXferSize);
 			uDMAChannelEnable(UDMA_CHANNEL_ADC3);
 			TimerLoadSet(TIMER0_BASE, TIMER_A, SysCtlClockGet()/(g_uiSamplingFreq - 1));
@@ -354,14 +381,16 @@ ADC3IntHandler(void)
 			// to unpend in case it happened again since we entered this
 			// handler
 			//
-			uluDMACount = 0;
-			ulDataXferd = 0;
+			g_uluDMACount = 0;
+			g_ulDataXferd = 0;
 			ADCIntDisable(ADC0_BASE, ADC_SEQUENCER);
 			IntPendClear(INT_ADC0SS3);
 
 			//
 			// Signal that we have new data to be processed
 			//
+			g_ulNewSamples = NUM_SAMPLES;
+			g_ulCaptureTime = LatencyTimestamp();
 			g_ucDataReady = 1;
 		}
 	}
@@ -423,12 +452,92 @@ InitSamplingTimer()
 	TimerEnable(TIMER0_BASE, TIMER_A);
 }
 
+//*****************************************************************************
+//
+// Restart audio capture from an empty sample buffer, at the sampling rate in
+// g_uiSamplingFreq and with the given uDMA method.
+//
+// The sampling timer and uDMA channel are stopped, with the capture interrupt
+// held off, so the interrupt handler never sees a transfer set up for one
+// method finish under the other.  Everything captured so far is dropped, as
+// it may have been captured at the old rate.
+//
+// param ucMethod: the uDMA method, DMA_METHOD_SLOW or DMA_METHOD_FAST
+//
+//*****************************************************************************
+void
+CaptureRestart(unsigned char ucMethod)
+{
+	IntDisable(INT_ADC3);
+	TimerDisable(TIMER0_BASE, TIMER_A);
+	uDMAChannelDisable(UDMA_CHANNEL_ADC3);
+	ADCIntClear(ADC0_BASE, ADC_SEQUENCER);
+	IntPendClear(INT_ADC0SS3);
+
+	g_ucDMAMethod = ucMethod;
+	g_uluDMACount = 0;
+	g_ulDataXferd = 0;
+	g_ulNewSamples = 0;
+	g_ucDataReady = 0;
+
+	CaptureArm();
+	ADCIntEnable(ADC0_BASE, ADC_SEQUENCER);
+	TimerLoadSet(TIMER0_BASE, TIMER_A, SysCtlClockGet()/(g_uiSamplingFreq - 1));
+	TimerEnable(TIMER0_BASE, TIMER_A);
+	IntEnable(INT_ADC3);
+}
+
 //*****************************************************************************
 //
 // Private Functions
 //
 //*****************************************************************************
 
+//*****************************************************************************
+//
+// Set up the uDMA channel for the first transfer of the current uDMA method.
+//
+//*****************************************************************************
+static void
+CaptureArm(void)
+{
+    if(g_ucDMAMethod == DMA_METHOD_SLOW)
+    {
+		g_ucDMApingpong = 0;
+		uDMAChannelTransferSet(UDMA_CHANNEL_ADC3 | UDMA_PRI_SELECT,
+							   UDMA_MODE_BASIC,
+							   (void *)(ADC0_BASE + ADC_O_SSFIFO3 + (0x20 * UDMA_ARB_1)),
+							   g_sArena.pusDMAPing, DMA_SIZE);
+    }
+    else
+    {
+		//
+		// The uDMA engine has an upper limit of the number of transfers it can
+		// complete before it must be configured for a new transfer.  As a result,
+		// we need to configure the uDMA engine to transfer as many samples as
+		// possible, up to its maximum amount
+		//
+		if(NUM_SAMPLES > UDMA_XFER_MAX)
+		{
+			uDMAChannelTransferSet(UDMA_CHANNEL_ADC3 | UDMA_PRI_SELECT,
+								   UDMA_MODE_BASIC,
+								   (void *)(ADC0_BASE + ADC_O_SSFIFO3 + (0x20 * UDMA_ARB_1)),
+								   g_sArena.pusADCValues, UDMA_XFER_MAX);
+		}
+		else
+		{
+			uDMAChannelTransferSet(UDMA_CHANNEL_ADC3 | UDMA_PRI_SELECT,
+								   UDMA_MODE_BASIC,
+								   (void *)(ADC0_BASE + ADC_O_SSFIFO3 + (0x20 * UDMA_ARB_1)),
+								   g_sArena.pusADCValues, NUM_SAMPLES);
+		}
+    }
+    //
+    // Enable the DMA channel
+    //
+    uDMAChannelEnable(UDMA_CHANNEL_ADC3);
+}
+
 //*****************************************************************************
 //
 // Initialize the signal capture chain.
@@ -454,7 +563,7 @@ InitADC3Transfer(void)
     //
     for(uIdx = 0; uIdx < NUM_SAMPLES; uIdx++)
     {
-    	g_ulADCValues[uIdx] = 0;
+    	g_sArena.pusADCValues[uIdx] = 0;
     }
 
     //
@@ -463,7 +572,7 @@ InitADC3Transfer(void)
 	SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
 	IntEnable(INT_UDMAERR);
 	uDMAEnable();
-	uDMAControlBaseSet(ucControlTable);
+	uDMAControlBaseSet(g_sArena.pucDMAControl);
 	UARTprintf("Capturing audio on ADC0 seq 3 using DMA channel %d\n",
 			   UDMA_CHANNEL_ADC3 & 0xff);
 
@@ -493,41 +602,7 @@ InitADC3Transfer(void)
 						  UDMA_SIZE_16 | UDMA_SRC_INC_NONE |
 						  UDMA_DST_INC_16 | UDMA_ARB_1);
 
-    if(g_ucDMAMethod == DMA_METHOD_SLOW)
-    {
-		g_ucDMApingpong = 0;
-		uDMAChannelTransferSet(UDMA_CHANNEL_ADC3 | UDMA_PRI_SELECT,
-							   UDMA_MODE_BASIC,
-							   (void *)(ADC0_BASE + ADC_O_SSFIFO3 + (0x20 * UDMA_ARB_1)),
-							   g_usDMAping, DMA_SIZE);
-    }
-    else
-    {
-		//
-		// The uDMA engine has an upper limit of the number of transfers it can
-		// complete before it must be configured for a new transfer.  As a result,
-		// we need to configure the uDMA engine to transfer as many samples as
-		// possible, up to its maximum amount
-		//
-		if(NUM_SAMPLES > UDMA_XFER_MAX)
-		{
-			uDMAChannelTransferSet(UDMA_CHANNEL_ADC3 | UDMA_PRI_SELECT,
-								   UDMA_MODE_BASIC,
-								   (void *)(ADC0_BASE + ADC_O_SSFIFO3 + (0x20 * UDMA_ARB_1)),
-								   g_ulADCValues, UDMA_XFER_MAX);
-		}
-		else
-		{
-			uDMAChannelTransferSet(UDMA_CHANNEL_ADC3 | UDMA_PRI_SELECT,
-								   UDMA_MODE_BASIC,
-								   (void *)(ADC0_BASE + ADC_O_SSFIFO3 + (0x20 * UDMA_ARB_1)),
-								   g_ulADCValues, NUM_SAMPLES);
-		}
-    }
-    //
-    // Enable the DMA channel
-    //
-    uDMAChannelEnable(UDMA_CHANNEL_ADC3);
+    CaptureArm();
 }
 
 //*****************************************************************************
@@ -563,6 +638,13 @@ InitBasics(void)
 	ROM_GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
 	UARTStdioInit(0);
 
+	//
+	// Let SysTick free run over its full 24 bit range, without interrupts.
+	// The DSP loop reads it to measure how much time each frame covers.
+	//
+	SysTickPeriodSet(0x01000000);
+	SysTickEnable();
+
 	//
 	// Hello!
 	//
@@ -605,16 +687,24 @@ main(void)
     g_ucFramesPerSec = 0;
     g_uiDSPPerSec = 0;
     g_uiLastDSPPerSec = 0;
+    g_ucNewSecond = 0;
 
 	//
 	// Initialize all peripherals
 	//
     InitBasics();
+    LatencyInit();
+    StoreInit();
 	GUIinit();
     InitSamplingTimer();
     InitDebugTimer();
-	InitADC3Transfer();
+
+	//
+	// The DSP setup picks the uDMA method, which the capture chain has to be
+	// set up for
+	//
 	InitDSP();
+	InitADC3Transfer();
 
 	//
 	// Once ADC3 interrupts are enabled, our capture engine will start churning
@@ -654,8 +744,19 @@ main(void)
     	}
 
     	//
-    	// Look for button presses
+    	// Once a second, summarize how long frames took to get to the screen
+    	//
+    	if(g_ucNewSecond)
+    	{
+    		g_ucNewSecond = 0;
+    		LatencyReport();
+    	}
+
+    	//
+    	// Pass on the latest touch screen move, if a frame has gone by since
+    	// the last one, then look for button presses
     	//
+    	PointerFlush();
 		WidgetMessageQueueProcess();
     }
 }
@@ -32,6 +32,11 @@ extern "C"
 //
 #define UDMA_XFER_MAX			1024
 
+//
+// The size of the ping pong buffer used for the slow uDMA method
+//
+#define DMA_SIZE				256
+
 #define DMA_METHOD_SLOW			0
 #define DMA_METHOD_FAST			1
 
@@ -41,12 +46,13 @@ extern "C"
 //
 //*****************************************************************************
 extern volatile unsigned char g_ucDataReady;
+extern volatile unsigned long g_ulNewSamples;
+extern volatile unsigned long g_ulCaptureTime;
 extern volatile unsigned char g_ucDMAMethod;
 extern volatile unsigned char g_ucFramesPerSec;
 extern volatile unsigned char g_ucLastFramesPerSec;
 extern volatile unsigned int g_uiDSPPerSec;
 extern volatile unsigned int g_uiLastDSPPerSec;
-extern unsigned short g_ulADCValues[NUM_SAMPLES];
 
 //*****************************************************************************
 //
@@ -54,6 +60,7 @@ extern unsigned short g_ulADCValues[NUM_SAMPLES];
 //
 //*****************************************************************************
 extern void InitSamplingTimer();
+extern void CaptureRestart(unsigned char ucMethod);
 
 //*****************************************************************************
 //
@@ -28,8 +28,9 @@
 
 MEMORY
 {
-    /* Application stored in and executes from internal flash */
-    FLASH (RX) : origin = APP_BASE, length = 0x00040000
+    /* Application stored in and executes from internal flash, apart from */
+    /* the top 16 KB, which is left to the settings log kept by store.c    */
+    FLASH (RX) : origin = APP_BASE, length = 0x0003C000
     /* Application uses internal RAM for data */
     SRAM (RWX) : origin = 0x20000000, length = 0x00008000
 }
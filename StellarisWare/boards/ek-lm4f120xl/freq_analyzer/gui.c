@@ -38,6 +38,7 @@
 #include "driverlib/interrupt.h"
 #include "driverlib/rom.h"
 #include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
 #include "driverlib/timer.h"
 
 #include "grlib/grlib.h"
@@ -56,6 +57,16 @@
 #include "images.h"
 #include "gui.h"
 #include "dsp.h"
+#include "average.h"
+#include "window.h"
+#include "tuner.h"
+#include "filterbank.h"
+#include "colormap.h"
+#include "latency.h"
+#include "background.h"
+#include "render.h"
+#include "pointer.h"
+#include "store.h"
 #include "freq_analyzer.h"
 
 //*****************************************************************************
@@ -64,7 +75,27 @@
 //
 //*****************************************************************************
 
-#define REFRESH_RATE			18
+//
+// The display refresh rate is paced by how long the bars take to draw, so
+// that drawing them takes no more than one part in PAINT_SHARE of the
+// processor, within these limits (in frames per second)
+//
+#define MAX_REFRESH_RATE		18
+#define MIN_REFRESH_RATE		6
+#define PAINT_SHARE				3
+
+//
+// How long, in microseconds, each call to the bar painter may draw for before
+// it returns to let the DSP code run
+//
+#define PAINT_BUDGET_US			4000
+
+//
+// The painter sorts the bars by how far they moved into this many priorities,
+// each covering 1 << PAINT_PRIORITY_SHIFT pixels of change
+//
+#define PAINT_PRIORITY_LEVELS	32
+#define PAINT_PRIORITY_SHIFT	3
 
 #define INIT_SAMPLING_FREQ		26000
 #define MAX_SAMPLING_FREQ		80000
@@ -82,6 +113,34 @@
 #define MAX_DISPLAY_U_FREQ		INIT_SAMPLING_FREQ/2
 #define INTERVAL_DISPLAY_U_FREQ	500
 #define INIT_DISPLAY_RAIN		0
+#define INIT_WINDOW_TYPE		WINDOW_HAMMING
+#define INIT_TUNER_MODE			0
+#define INIT_AVG_MODE			AVG_MODE_OFF
+#define INIT_AVG_FRAMES			4
+#define MIN_AVG_FRAMES			2
+#define MAX_AVG_FRAMES			32
+#define INIT_WEIGHTING			WEIGHTING_Z
+#define INIT_WATERFALL			0
+#define INIT_ENGINE				ENGINE_FFT
+#define INIT_OCTAVE_FRACTION	FB_OCTAVE_3
+#define INIT_ZOOM				1
+#define INIT_SILENCE_THRESHOLD	4
+#define INIT_BAR_HEIGHT			COLORMAP_FULL_SCALE
+#define INIT_SHOW_LATENCY		0
+#define INIT_BAR_SCALE			BAR_SCALE_LINEAR
+#define INIT_BAR_PALETTE		BAR_PALETTE_GRADIENT
+#define INIT_RENDERER			RENDERER_BARS
+
+//
+// The range of levels shown in dB mode, in dB against the maximum each bar is
+// normalized against.  The ceiling must be above the floor.  The config page
+// moves each in steps of DB_STEP, keeping them at least that far apart.
+//
+#define INIT_DB_FLOOR			(-60)
+#define INIT_DB_CEILING			0
+#define MIN_DB_FLOOR			(-90)
+#define MAX_DB_CEILING			0
+#define DB_STEP					10
 
 //
 // The strength of the "gravity" at which the rain accelrates downard
@@ -91,8 +150,89 @@
 #define CHECK_RAIN			0
 #define CHECK_DEBUG			1
 #define CHECK_VERBOSE		2
+#define CHECK_TUNER			3
+#define CHECK_WATERFALL		4
+
+//
+// Indices for which option on the third config page is which
+//
+#define CHOICE_WINDOW		0
+#define CHOICE_AVG_MODE		1
+#define CHOICE_AVG_FRAMES	2
+#define CHOICE_WEIGHTING	3
+#define CHOICE_BAR_SCALE	4
+#define CHOICE_DB_FLOOR		5
+#define CHOICE_DB_CEILING	6
+#define CHOICE_BAR_PALETTE	7
+#define CHOICE_RENDERER		8
+#define NUM_CHOICES			9
+
+//
+// The longest text an option's button shows, including the terminator
+//
+#define CHOICE_TEXT_SIZE	16
+
+//
+// The part of the screen the waterfall scrolls through: everything above the
+// config button.  The panel can only hold one part of the screen still while
+// it scrolls the rest, so the title bar goes to the waterfall too.
+//
+#define WATERFALL_Y_MIN		0
+#define WATERFALL_Y_MAX		209
+#define WATERFALL_HEIGHT	(WATERFALL_Y_MAX - WATERFALL_Y_MIN + 1)
+
+//
+// The most rectangles drawn over the background that are kept track of at
+// once.  The bar display and a config page each cover two.
+//
+#define MAX_COVERED			4
+
+//
+// The width of the corner of the title bar the latency readout is drawn in
+//
+#define LATENCY_WIDTH		64
+
+//*****************************************************************************
+//
+// The settings kept in flash across resets.  The debug checkboxes are left
+// out, as the UART output is only wanted for the session it was asked for in.
+// Adding a field means giving the record a new tag in store.h.
+//
+//*****************************************************************************
+typedef struct
+{
+	unsigned long ulSamplingFreq;
+	unsigned long ulMinDisplayFreq;
+	unsigned long ulMaxDisplayFreq;
+	unsigned long ulNumBars;
+	unsigned char ucDispRain;
+	unsigned char ucTunerMode;
+	unsigned char ucWaterfall;
+	unsigned char ucReserved;
+}
+tSavedConfig;
 
-#define RAIN_HEIGHT	1
+//*****************************************************************************
+//
+// The analysis and display options, which follow tSavedConfig in a
+// STORE_TAG_CONFIG_2 record.  A STORE_TAG_CONFIG record holds tSavedConfig
+// alone.
+//
+//*****************************************************************************
+typedef struct
+{
+	unsigned char ucWindowType;
+	unsigned char ucAvgMode;
+	unsigned char ucAvgFrames;
+	unsigned char ucWeighting;
+	unsigned char ucBarScale;
+	signed char cDbFloor;
+	signed char cDbCeiling;
+	unsigned char ucBarPalette;
+	unsigned char ucRenderer;
+	unsigned char pucReserved[3];
+}
+tSavedOptions;
 
 //*****************************************************************************
 //
@@ -103,6 +243,7 @@ static void OnConfigPress(tWidget *pWidget);
 static void OnSliderChange(tWidget *pWidget, long lValue);
 static void OnButtonPress(tWidget *pWidget);
 static void OnCheckChange(tWidget *pWidget, unsigned long bSelected);
+static void OnChoicePress(tWidget *pWidget);
 static void InitDisplayTimer(void);
 
 //*****************************************************************************
@@ -112,9 +253,15 @@ static void InitDisplayTimer(void);
 //*****************************************************************************
 
 //
-// The character array used to update the LED display
+// The bar heights, double buffered.  g_psBarFrame is the last frame the DSP
+// code published, which is the one drawn, and g_psBarFrameNext is the one it
+// is filling in.  The DSP code swaps them with GUIPublishFrame once the whole
+// frame is ready, so the display never draws half of one frame and half of
+// the next.
 //
-unsigned char LEDDisplay[MAX_NUMBARS];
+static tBarFrame g_psBarFrameBuf[2];
+tBarFrame *g_psBarFrame = &g_psBarFrameBuf[0];
+tBarFrame *g_psBarFrameNext = &g_psBarFrameBuf[1];
 
 //
 // An array detailing the first and last bin numbers (indexed 0-NUM_SAMPLES*2)
@@ -122,24 +269,12 @@ unsigned char LEDDisplay[MAX_NUMBARS];
 //
 unsigned int  LEDFreqBreakpoints[MAX_NUMBARS + 1];
 
-//
-// An array used to keep track of the current location of each "rain drop,"
-// which represents the biggest value drawn on screen for a given bar, minus
-// the effects of gravity over time
-//
-unsigned char LEDDisplayMaxes[MAX_NUMBARS];
-
-//
-// An array used to keep track of the current "acceleration" of the falling
-// "rain drop"
-//
-unsigned char g_pucGravity[MAX_NUMBARS];
-
 //
 // The curent state of the display.
 // 	0: displaying bars
 //	1: displaying config screen 1
 //  2: displaying config screen 2
+//  3: displaying config screen 3
 //
 static unsigned char g_ucCfgDisplay;
 
@@ -149,6 +284,63 @@ static unsigned char g_ucCfgDisplay;
 //
 volatile unsigned char g_ucDispRefresh;
 
+//
+// The bar painter's progress through its current pass: the bars left to
+// draw, most urgent first, the frame they are being drawn from, and the
+// cycles spent on the pass so far
+//
+static unsigned short g_pusPaintOrder[MAX_NUMBARS];
+static unsigned int g_uiPaintCount;
+static unsigned int g_uiPaintNext;
+static unsigned long g_ulPaintSequence;
+static unsigned long g_ulPassCycles;
+static unsigned char g_ucPaintPass;
+
+//
+// The number of cycles the last complete pass of the bar painter took
+//
+unsigned long g_ulPaintCycles;
+
+//
+// The rectangles of the screen drawn over the background since it was last
+// restored.  Moving between the bars and the config pages only restores
+// these, rather than the whole background.
+//
+static tRectangle g_psCovered[MAX_COVERED];
+static unsigned int g_uiNumCovered;
+
+//
+// What the bar display draws over: the title bar, where the title and the
+// tuner and latency readouts go, and the bars, including the row they stand
+// on.  The waterfall covers everything above the config button instead.
+//
+static const tRectangle g_sTitleArea = { 0, 0, 319, 20 };
+static const tRectangle g_sBarsArea = { 10, 24, 309, 210 };
+static const tRectangle g_sWaterfallArea =
+{
+	0, WATERFALL_Y_MIN, 319, WATERFALL_Y_MAX
+};
+
+//
+// The rectangle the last tuner readout was drawn in, or an empty one if there
+// is none to restore
+//
+static tRectangle g_sTunerRect = { 0, 0, -1, -1 };
+
+//
+// The number of bars and the palette the bar colors were last built for
+//
+static unsigned int g_uiColorBars;
+static unsigned char g_ucColorPalette;
+
+//
+// Where the fill of each slider ended and how wide its text was when it was
+// last painted, so that a change only has to repaint the columns the end of
+// the fill moved across and the text.
+//
+static short g_psSliderFillEnd[4];
+static short g_psSliderTextWidth[4];
+
 
 //*****************************************************************************
 //
@@ -171,35 +363,51 @@ RectangularButton(g_sCfgButton, 0, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 210,
 //*****************************************************************************
 unsigned char g_ucDispRain;
 unsigned char g_ucPrintDbg;
+unsigned char g_ucTunerMode;
+unsigned char g_ucWaterfall;
 
 extern tCanvasWidget g_psPanelCfg1;
 
 tCanvasWidget g_psCheckBoxIndicators[] =
 {
     CanvasStruct(&g_psPanelCfg1, g_psCheckBoxIndicators + 1, 0,
-                 &g_sKentec320x240x16_SSD2119, 260, 30, 50, 42,
+                 &g_sKentec320x240x16_SSD2119, 260, 30, 50, 34,
                  CANVAS_STYLE_IMG, 0, 0, 0, 0, 0, g_pucLightOff, 0),
     CanvasStruct(&g_psPanelCfg1, g_psCheckBoxIndicators + 2, 0,
-                 &g_sKentec320x240x16_SSD2119, 260, 82, 50, 42,
+                 &g_sKentec320x240x16_SSD2119, 260, 65, 50, 34,
+                 CANVAS_STYLE_IMG, 0, 0, 0, 0, 0, g_pucLightOff, 0),
+    CanvasStruct(&g_psPanelCfg1, g_psCheckBoxIndicators + 3, 0,
+                 &g_sKentec320x240x16_SSD2119, 260, 100, 50, 34,
+                 CANVAS_STYLE_IMG, 0, 0, 0, 0, 0, g_pucLightOff, 0),
+    CanvasStruct(&g_psPanelCfg1, g_psCheckBoxIndicators + 4, 0,
+                 &g_sKentec320x240x16_SSD2119, 260, 135, 50, 34,
                  CANVAS_STYLE_IMG, 0, 0, 0, 0, 0, g_pucLightOff, 0),
     CanvasStruct(&g_psPanelCfg1, 0, 0,
-                 &g_sKentec320x240x16_SSD2119, 260, 134, 50, 42,
+                 &g_sKentec320x240x16_SSD2119, 260, 170, 50, 34,
                  CANVAS_STYLE_IMG, 0, 0, 0, 0, 0, g_pucLightOff, 0)
 };
 tCheckBoxWidget g_psCheckBoxes[] =
 {
     CheckBoxStruct(&g_psPanelCfg1, g_psCheckBoxes + 1, 0,
-                   &g_sKentec320x240x16_SSD2119, 20, 30, 300, 42,
+                   &g_sKentec320x240x16_SSD2119, 20, 30, 300, 34,
                    CB_STYLE_TEXT, 16, 0, ClrSilver, ClrSilver, &g_sFontCm20,
                    "Make it rain!!!", 0, OnCheckChange),
     CheckBoxStruct(&g_psPanelCfg1, g_psCheckBoxes + 2, 0,
-                   &g_sKentec320x240x16_SSD2119, 20, 82, 300, 48,
+                   &g_sKentec320x240x16_SSD2119, 20, 65, 300, 34,
                    CB_STYLE_TEXT, 16, 0, ClrSilver, ClrSilver, &g_sFontCm20,
 				   "Enable Debug (UART)", 0, OnCheckChange),
-    CheckBoxStruct(&g_psPanelCfg1, g_psCheckBoxIndicators, 0,
-                   &g_sKentec320x240x16_SSD2119, 20, 134, 300, 42,
+    CheckBoxStruct(&g_psPanelCfg1, g_psCheckBoxes + 3, 0,
+                   &g_sKentec320x240x16_SSD2119, 20, 100, 300, 34,
                    CB_STYLE_TEXT, 16, 0, ClrSilver, ClrSilver, &g_sFontCm20,
                    "Verbose Debug (UART)", 0, OnCheckChange),
+    CheckBoxStruct(&g_psPanelCfg1, g_psCheckBoxes + 4, 0,
+                   &g_sKentec320x240x16_SSD2119, 20, 135, 300, 34,
+                   CB_STYLE_TEXT, 16, 0, ClrSilver, ClrSilver, &g_sFontCm20,
+                   "Tuner Mode", 0, OnCheckChange),
+    CheckBoxStruct(&g_psPanelCfg1, g_psCheckBoxIndicators, 0,
+                   &g_sKentec320x240x16_SSD2119, 20, 170, 300, 34,
+                   CB_STYLE_TEXT, 16, 0, ClrSilver, ClrSilver, &g_sFontCm20,
+                   "Waterfall Display", 0, OnCheckChange),
 };
 
 
@@ -217,6 +425,21 @@ unsigned int g_uiMinDisplayFreq;
 unsigned int g_uiMaxDisplayFreq;
 unsigned int g_uiSamplingFreq;
 unsigned char g_ucDisplayRain;
+unsigned char g_ucWindowType;
+unsigned char g_ucAvgMode;
+unsigned char g_ucAvgFrames;
+unsigned char g_ucWeighting;
+unsigned char g_ucEngine;
+unsigned char g_ucOctaveFraction;
+unsigned char g_ucZoom;
+unsigned char g_ucSilenceThreshold;
+unsigned char g_ucBarHeight;
+unsigned char g_ucShowLatency;
+unsigned char g_ucBarScale;
+unsigned char g_ucBarPalette;
+unsigned char g_ucRenderer;
+signed char g_cDbFloor;
+signed char g_cDbCeiling;
 long g_plSliderVal[4];
 char g_pcSliderText[4][7];
 
@@ -322,6 +545,164 @@ tCanvasWidget g_psPanelCfg2 = CanvasStruct(0, 0, &g_sUDispContainer,
 		&g_sKentec320x240x16_SSD2119, 0, 24, 320, 186, CANVAS_STYLE_FILL, 0, 0,
 		0, 0, 0, 0, 0);
 
+//*****************************************************************************
+//
+// The third config page, which has the analysis and display options.  Each
+// option is a button that steps through its values, showing the one chosen.
+// As with the sliders, what the buttons are set to only takes effect once
+// the config pages are left.
+//
+//*****************************************************************************
+static long g_plChoiceVal[NUM_CHOICES];
+static char g_pcChoiceText[NUM_CHOICES][CHOICE_TEXT_SIZE];
+
+//
+// The names of the AVG_MODE_* modes
+//
+static const char * const g_ppcAvgModeNames[] =
+{
+	"Off", "EMA", "Boxcar"
+};
+
+//
+// The names of the WEIGHTING_* curves
+//
+static const char * const g_ppcWeightingNames[] =
+{
+	"Z (flat)", "A", "C"
+};
+
+//
+// The names of the BAR_SCALE_* scales
+//
+static const char * const g_ppcBarScaleNames[] =
+{
+	"Linear", "dB"
+};
+
+//
+// The names of the BAR_PALETTE_* palettes
+//
+static const char * const g_ppcBarPaletteNames[] =
+{
+	"Gradient", "Heat", "Rainbow", "Mono"
+};
+
+extern tCanvasWidget g_psPanelCfg3;
+extern tPushButtonWidget g_psChoiceButtons[];
+extern tContainerWidget g_sWindowContainer;
+extern tContainerWidget g_sAvgModeContainer;
+extern tContainerWidget g_sAvgFramesContainer;
+extern tContainerWidget g_sWeightingContainer;
+extern tContainerWidget g_sBarScaleContainer;
+extern tContainerWidget g_sDbRangeContainer;
+extern tContainerWidget g_sBarPaletteContainer;
+extern tContainerWidget g_sRendererContainer;
+
+Container(g_sWindowContainer, &g_psPanelCfg3, &g_sAvgModeContainer,
+		  g_psChoiceButtons + CHOICE_WINDOW, &g_sKentec320x240x16_SSD2119,
+		  0, 30, 160, 40,
+		  CTR_STYLE_FILL | CTR_STYLE_TEXT | CTR_STYLE_TEXT_CENTER, ClrBlack,
+		  0, ClrSilver, &g_sFontCm16, "Window");
+Container(g_sAvgModeContainer, &g_psPanelCfg3, &g_sAvgFramesContainer,
+		  g_psChoiceButtons + CHOICE_AVG_MODE, &g_sKentec320x240x16_SSD2119,
+		  0, 75, 160, 40,
+		  CTR_STYLE_FILL | CTR_STYLE_TEXT | CTR_STYLE_TEXT_CENTER, ClrBlack,
+		  0, ClrSilver, &g_sFontCm16, "Averaging");
+Container(g_sAvgFramesContainer, &g_psPanelCfg3, &g_sWeightingContainer,
+		  g_psChoiceButtons + CHOICE_AVG_FRAMES, &g_sKentec320x240x16_SSD2119,
+		  0, 120, 160, 40,
+		  CTR_STYLE_FILL | CTR_STYLE_TEXT | CTR_STYLE_TEXT_CENTER, ClrBlack,
+		  0, ClrSilver, &g_sFontCm16, "Frames Averaged");
+Container(g_sWeightingContainer, &g_psPanelCfg3, &g_sBarScaleContainer,
+		  g_psChoiceButtons + CHOICE_WEIGHTING, &g_sKentec320x240x16_SSD2119,
+		  0, 165, 160, 40,
+		  CTR_STYLE_FILL | CTR_STYLE_TEXT | CTR_STYLE_TEXT_CENTER, ClrBlack,
+		  0, ClrSilver, &g_sFontCm16, "Weighting");
+Container(g_sBarScaleContainer, &g_psPanelCfg3, &g_sDbRangeContainer,
+		  g_psChoiceButtons + CHOICE_BAR_SCALE, &g_sKentec320x240x16_SSD2119,
+		  160, 30, 160, 40,
+		  CTR_STYLE_FILL | CTR_STYLE_TEXT | CTR_STYLE_TEXT_CENTER, ClrBlack,
+		  0, ClrSilver, &g_sFontCm16, "Bar Scale");
+Container(g_sDbRangeContainer, &g_psPanelCfg3, &g_sBarPaletteContainer,
+		  g_psChoiceButtons + CHOICE_DB_FLOOR, &g_sKentec320x240x16_SSD2119,
+		  160, 75, 160, 40,
+		  CTR_STYLE_FILL | CTR_STYLE_TEXT | CTR_STYLE_TEXT_CENTER, ClrBlack,
+		  0, ClrSilver, &g_sFontCm16, "dB Floor / Ceiling");
+Container(g_sBarPaletteContainer, &g_psPanelCfg3, &g_sRendererContainer,
+		  g_psChoiceButtons + CHOICE_BAR_PALETTE, &g_sKentec320x240x16_SSD2119,
+		  160, 120, 160, 40,
+		  CTR_STYLE_FILL | CTR_STYLE_TEXT | CTR_STYLE_TEXT_CENTER, ClrBlack,
+		  0, ClrSilver, &g_sFontCm16, "Palette");
+Container(g_sRendererContainer, &g_psPanelCfg3, 0,
+		  g_psChoiceButtons + CHOICE_RENDERER, &g_sKentec320x240x16_SSD2119,
+		  160, 165, 160, 40,
+		  CTR_STYLE_FILL | CTR_STYLE_TEXT | CTR_STYLE_TEXT_CENTER, ClrBlack,
+		  0, ClrSilver, &g_sFontCm16, "Bar Style");
+
+tPushButtonWidget g_psChoiceButtons[] =
+{
+	RectangularButtonStruct(&g_sWindowContainer, 0, 0,
+							&g_sKentec320x240x16_SSD2119, 10, 45, 140, 25,
+							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT,
+							ClrMidnightBlue, ClrBlack, ClrGray, ClrSilver,
+							&g_sFontCm16, g_pcChoiceText[CHOICE_WINDOW], 0, 0,
+							0, 0, OnChoicePress),
+	RectangularButtonStruct(&g_sAvgModeContainer, 0, 0,
+							&g_sKentec320x240x16_SSD2119, 10, 90, 140, 25,
+							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT,
+							ClrMidnightBlue, ClrBlack, ClrGray, ClrSilver,
+							&g_sFontCm16, g_pcChoiceText[CHOICE_AVG_MODE], 0,
+							0, 0, 0, OnChoicePress),
+	RectangularButtonStruct(&g_sAvgFramesContainer, 0, 0,
+							&g_sKentec320x240x16_SSD2119, 10, 135, 140, 25,
+							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT,
+							ClrMidnightBlue, ClrBlack, ClrGray, ClrSilver,
+							&g_sFontCm16, g_pcChoiceText[CHOICE_AVG_FRAMES], 0,
+							0, 0, 0, OnChoicePress),
+	RectangularButtonStruct(&g_sWeightingContainer, 0, 0,
+							&g_sKentec320x240x16_SSD2119, 10, 180, 140, 25,
+							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT,
+							ClrMidnightBlue, ClrBlack, ClrGray, ClrSilver,
+							&g_sFontCm16, g_pcChoiceText[CHOICE_WEIGHTING], 0,
+							0, 0, 0, OnChoicePress),
+	RectangularButtonStruct(&g_sBarScaleContainer, 0, 0,
+							&g_sKentec320x240x16_SSD2119, 170, 45, 140, 25,
+							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT,
+							ClrMidnightBlue, ClrBlack, ClrGray, ClrSilver,
+							&g_sFontCm16, g_pcChoiceText[CHOICE_BAR_SCALE], 0,
+							0, 0, 0, OnChoicePress),
+	RectangularButtonStruct(&g_sDbRangeContainer,
+							g_psChoiceButtons + CHOICE_DB_CEILING, 0,
+							&g_sKentec320x240x16_SSD2119, 170, 90, 65, 25,
+							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT,
+							ClrMidnightBlue, ClrBlack, ClrGray, ClrSilver,
+							&g_sFontCm16, g_pcChoiceText[CHOICE_DB_FLOOR], 0,
+							0, 0, 0, OnChoicePress),
+	RectangularButtonStruct(&g_sDbRangeContainer, 0, 0,
+							&g_sKentec320x240x16_SSD2119, 245, 90, 65, 25,
+							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT,
+							ClrMidnightBlue, ClrBlack, ClrGray, ClrSilver,
+							&g_sFontCm16, g_pcChoiceText[CHOICE_DB_CEILING], 0,
+							0, 0, 0, OnChoicePress),
+	RectangularButtonStruct(&g_sBarPaletteContainer, 0, 0,
+							&g_sKentec320x240x16_SSD2119, 170, 135, 140, 25,
+							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT,
+							ClrMidnightBlue, ClrBlack, ClrGray, ClrSilver,
+							&g_sFontCm16, g_pcChoiceText[CHOICE_BAR_PALETTE], 0,
+							0, 0, 0, OnChoicePress),
+	RectangularButtonStruct(&g_sRendererContainer, 0, 0,
+							&g_sKentec320x240x16_SSD2119, 170, 180, 140, 25,
+							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT,
+							ClrMidnightBlue, ClrBlack, ClrGray, ClrSilver,
+							&g_sFontCm16, g_pcChoiceText[CHOICE_RENDERER], 0,
+							0, 0, 0, OnChoicePress),
+};
+
+tCanvasWidget g_psPanelCfg3 = CanvasStruct(0, 0, &g_sWindowContainer,
+		&g_sKentec320x240x16_SSD2119, 0, 24, 320, 186, CANVAS_STYLE_FILL, 0, 0,
+		0, 0, 0, 0, 0);
+
 //*****************************************************************************
 //
 // Interrupt Handlers
@@ -338,19 +719,18 @@ tCanvasWidget g_psPanelCfg2 = CanvasStruct(0, 0, &g_sUDispContainer,
 void
 Timer3AIntHandler(void)
 {
-	int i;
     //
     // Clear the timer interrupt.
     //
     TimerIntClear(TIMER3_BASE, TIMER_TIMA_TIMEOUT);
 
+    //
+    // Just signal the refresh.  The maximum power decay used to live here,
+    // but it now runs in the DSP loop where it's timed against wall time and
+    // doesn't force a floating point context save in this handler.  The
+    // timer is started again once the display has been drawn.
+    //
     g_ucDispRefresh = 1;
-    for(i=0;i<g_uiNumDisplayBars;i++)
-    {
-    	maxLEDPowers[i-1] *= POWER_DECAY_FACTOR;
-    }
-	TimerLoadSet(TIMER3_BASE, TIMER_A, SysCtlClockGet()/REFRESH_RATE);
-	TimerEnable(TIMER3_BASE, TIMER_A);
 }
 
 //*****************************************************************************
@@ -362,296 +742,1161 @@ Timer3AIntHandler(void)
 
 //*****************************************************************************
 //
-// Initialize the timer that will cause the LED display to refresh, Timer3,
-// based on macro'd refresh rate (rate declared in frames per second)
+// Initialize the timer that will cause the LED display to refresh, Timer3,
+// based on macro'd refresh rate (rate declared in frames per second)
+//
+//*****************************************************************************
+static void
+InitDisplayTimer()
+{
+	//
+	// Set up timer3A to be the display timer, first interrupting at the
+	// fastest refresh rate.  GUIUpdateDisplay paces it from there.
+	//
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER3);
+    TimerConfigure(TIMER3_BASE, TIMER_CFG_ONE_SHOT);
+    TimerLoadSet(TIMER3_BASE, TIMER_A, SysCtlClockGet()/MAX_REFRESH_RATE);
+    IntEnable(INT_TIMER3A);
+    TimerIntEnable(TIMER3_BASE, TIMER_TIMA_TIMEOUT);
+    TimerEnable(TIMER3_BASE, TIMER_A);
+}
+
+
+//*****************************************************************************
+//
+// Draw the whole background image, erasing everything on the screen.
+//
+//*****************************************************************************
+static void
+DrawBackground(void)
+{
+	BackgroundDraw(&g_sBackground, 0, 0, g_sBackground.usWidth - 1,
+				   g_sBackground.usHeight - 1);
+	g_uiNumCovered = 0;
+}
+
+//*****************************************************************************
+//
+// Restore one rectangle of the background, if it isn't empty.
+//
+//*****************************************************************************
+static void
+RestoreRect(long lXMin, long lYMin, long lXMax, long lYMax)
+{
+	if((lXMin <= lXMax) && (lYMin <= lYMax))
+	{
+		BackgroundDraw(&g_sBackground, lXMin, lYMin, lXMax, lYMax);
+	}
+}
+
+//*****************************************************************************
+//
+// Note that a rectangle of the screen has been drawn over the background, so
+// the next CoverRestore puts the background back there.
+//
+// param psRect: the rectangle drawn over
+//
+// A rectangle inside one already noted isn't noted again, and one that takes
+// in others replaces them.  If the list is full, the last rectangle is grown
+// to take in the new one, which restores more than it has to but never less.
+//
+//*****************************************************************************
+static void
+CoverAdd(const tRectangle *psRect)
+{
+	tRectangle *psCovered;
+	unsigned int uiIdx;
+
+	for(uiIdx = 0; uiIdx < g_uiNumCovered; uiIdx++)
+	{
+		psCovered = &g_psCovered[uiIdx];
+		if((psRect->sXMin >= psCovered->sXMin) &&
+		   (psRect->sYMin >= psCovered->sYMin) &&
+		   (psRect->sXMax <= psCovered->sXMax) &&
+		   (psRect->sYMax <= psCovered->sYMax))
+		{
+			return;
+		}
+		if((psRect->sXMin <= psCovered->sXMin) &&
+		   (psRect->sYMin <= psCovered->sYMin) &&
+		   (psRect->sXMax >= psCovered->sXMax) &&
+		   (psRect->sYMax >= psCovered->sYMax))
+		{
+			*psCovered = g_psCovered[--g_uiNumCovered];
+			uiIdx--;
+		}
+	}
+
+	if(g_uiNumCovered < MAX_COVERED)
+	{
+		g_psCovered[g_uiNumCovered++] = *psRect;
+		return;
+	}
+
+	psCovered = &g_psCovered[MAX_COVERED - 1];
+	if(psRect->sXMin < psCovered->sXMin)
+	{
+		psCovered->sXMin = psRect->sXMin;
+	}
+	if(psRect->sYMin < psCovered->sYMin)
+	{
+		psCovered->sYMin = psRect->sYMin;
+	}
+	if(psRect->sXMax > psCovered->sXMax)
+	{
+		psCovered->sXMax = psRect->sXMax;
+	}
+	if(psRect->sYMax > psCovered->sYMax)
+	{
+		psCovered->sYMax = psRect->sYMax;
+	}
+}
+
+//*****************************************************************************
+//
+// Put the background back over everything drawn over it since the last
+// restore, except where the next screen is about to draw over it anyway.
+//
+// param psKeep: the rectangle the next screen fills, or 0 if it doesn't fill
+//		 any
+//
+// Each covered rectangle is cut around psKeep into the rows above it, the
+// rows below it, and the columns either side of it, and only those are
+// restored.
+//
+//*****************************************************************************
+static void
+CoverRestore(const tRectangle *psKeep)
+{
+	const tRectangle *psRect;
+	unsigned int uiIdx;
+	long lYMin, lYMax;
+
+	for(uiIdx = 0; uiIdx < g_uiNumCovered; uiIdx++)
+	{
+		psRect = &g_psCovered[uiIdx];
+		if(!psKeep || (psKeep->sXMin > psRect->sXMax) ||
+		   (psKeep->sXMax < psRect->sXMin) ||
+		   (psKeep->sYMin > psRect->sYMax) ||
+		   (psKeep->sYMax < psRect->sYMin))
+		{
+			RestoreRect(psRect->sXMin, psRect->sYMin, psRect->sXMax,
+						psRect->sYMax);
+			continue;
+		}
+
+		lYMin = (psKeep->sYMin > psRect->sYMin) ? psKeep->sYMin :
+												  psRect->sYMin;
+		lYMax = (psKeep->sYMax < psRect->sYMax) ? psKeep->sYMax :
+												  psRect->sYMax;
+		RestoreRect(psRect->sXMin, psRect->sYMin, psRect->sXMax, lYMin - 1);
+		RestoreRect(psRect->sXMin, lYMax + 1, psRect->sXMax, psRect->sYMax);
+		RestoreRect(psRect->sXMin, lYMin, psKeep->sXMin - 1, lYMax);
+		RestoreRect(psKeep->sXMax + 1, lYMin, psRect->sXMax, lYMax);
+	}
+	g_uiNumCovered = 0;
+}
+
+//*****************************************************************************
+//
+// Note what the bar display covers once it has been drawn: the bars and the
+// title bar, or the waterfall.
+//
+//*****************************************************************************
+static void
+CoverDisplay(void)
+{
+	if(g_ucWaterfall)
+	{
+		CoverAdd(&g_sWaterfallArea);
+	}
+	else
+	{
+		CoverAdd(&g_sTitleArea);
+		CoverAdd(&g_sBarsArea);
+	}
+}
+
+//*****************************************************************************
+//
+// Draw a title centered at the top of the screen, and note the rectangle it
+// covers.
+//
+// param pContext: the context in which the title is to be drawn
+// param pcTitle: the title
+//
+//*****************************************************************************
+static void
+DrawTitle(tContext *pContext, const char *pcTitle)
+{
+	tRectangle sRect;
+	long lWidth, lHeight;
+
+	GrContextFontSet(pContext, &g_sFontCm16);
+	GrContextForegroundSet(pContext, ClrLightGrey);
+	GrStringDrawCentered(pContext, pcTitle, -1,
+						 GrContextDpyWidthGet(pContext) / 2, 10, 0);
+
+	//
+	// The string is centered on the point, give or take a pixel of rounding
+	// either way
+	//
+	lWidth = GrStringWidthGet(pContext, pcTitle, -1);
+	lHeight = GrStringHeightGet(pContext);
+	sRect.sXMin = (GrContextDpyWidthGet(pContext) - lWidth) / 2 - 1;
+	sRect.sXMax = sRect.sXMin + lWidth + 1;
+	sRect.sYMin = 10 - (lHeight / 2) - 1;
+	sRect.sYMax = sRect.sYMin + lHeight + 1;
+	if(sRect.sXMin < 0)
+	{
+		sRect.sXMin = 0;
+	}
+	if(sRect.sYMin < 0)
+	{
+		sRect.sYMin = 0;
+	}
+	CoverAdd(&sRect);
+}
+
+//*****************************************************************************
+//
+// Find the last column of a slider's fill at its current value.
+//
+// param pSlider: the slider
+//
+// return: the column, which is the slider's left edge when there is no fill
+//
+//*****************************************************************************
+static short
+SliderFillEnd(tSliderWidget *pSlider)
+{
+	const tRectangle *psPos;
+	long lRange, lValue;
+
+	psPos = &pSlider->sBase.sPosition;
+	lRange = pSlider->lMax - pSlider->lMin;
+	lValue = pSlider->lValue - pSlider->lMin;
+	if((lRange <= 0) || (lValue <= 0))
+	{
+		return(psPos->sXMin);
+	}
+	if(lValue >= lRange)
+	{
+		return(psPos->sXMax);
+	}
+	return(psPos->sXMin + (((lValue * (psPos->sXMax - psPos->sXMin)) +
+							(lRange / 2)) / lRange));
+}
+
+//*****************************************************************************
+//
+// Paint part of a slider the way its own paint handler would: the fill, the
+// background, the outline and the text, each kept to the given rectangle.
+//
+// param pSlider: the slider
+// param psRect: the part of the slider to paint
+// param sFillEnd: the last column of the fill
+//
+//*****************************************************************************
+static void
+SliderAreaPaint(tSliderWidget *pSlider, const tRectangle *psRect,
+				short sFillEnd)
+{
+	tContext sCtx;
+	tRectangle sFill, sBack, sClip;
+	long lX, lY;
+
+	GrContextInit(&sCtx, pSlider->sBase.pDisplay);
+	GrContextFontSet(&sCtx, pSlider->pFont);
+	GrContextClipRegionSet(&sCtx, (tRectangle *)psRect);
+
+	sFill = pSlider->sBase.sPosition;
+	sFill.sXMax = sFillEnd;
+	sBack = pSlider->sBase.sPosition;
+	sBack.sXMin = sFillEnd + 1;
+
+	if(sFill.sXMax >= sFill.sXMin)
+	{
+		GrContextForegroundSet(&sCtx, pSlider->ulFillColor);
+		GrRectFill(&sCtx, &sFill);
+	}
+	if(sBack.sXMax >= sBack.sXMin)
+	{
+		GrContextForegroundSet(&sCtx, pSlider->ulBackgroundFillColor);
+		GrRectFill(&sCtx, &sBack);
+	}
+	GrContextForegroundSet(&sCtx, pSlider->ulOutlineColor);
+	GrRectDraw(&sCtx, &pSlider->sBase.sPosition);
+
+	//
+	// The text is drawn in one color over the fill and another over the
+	// background, so it is drawn twice, each time kept to its own part
+	//
+	lX = (pSlider->sBase.sPosition.sXMin + pSlider->sBase.sPosition.sXMax) / 2;
+	lY = (pSlider->sBase.sPosition.sYMin + pSlider->sBase.sPosition.sYMax) / 2;
+	if(GrRectIntersectGet((tRectangle *)psRect, &sFill, &sClip))
+	{
+		GrContextClipRegionSet(&sCtx, &sClip);
+		GrContextForegroundSet(&sCtx, pSlider->ulTextColor);
+		GrStringDrawCentered(&sCtx, pSlider->pcText, -1, lX, lY, 0);
+	}
+	if(GrRectIntersectGet((tRectangle *)psRect, &sBack, &sClip))
+	{
+		GrContextClipRegionSet(&sCtx, &sClip);
+		GrContextForegroundSet(&sCtx, pSlider->ulBackgroundTextColor);
+		GrStringDrawCentered(&sCtx, pSlider->pcText, -1, lX, lY, 0);
+	}
+}
+
+//*****************************************************************************
+//
+// Note what a slider's paint handler has just been asked to draw, so later
+// changes can be painted over it.
+//
+// param ulSlider: the slider, from FMAX_DISP_SLIDER to NUMBARS_SLIDER
+//
+//*****************************************************************************
+static void
+SliderDrawn(unsigned long ulSlider)
+{
+	tSliderWidget *pSlider;
+	tContext sCtx;
+
+	pSlider = &g_psSliders[ulSlider];
+	GrContextInit(&sCtx, pSlider->sBase.pDisplay);
+	GrContextFontSet(&sCtx, pSlider->pFont);
+	g_psSliderFillEnd[ulSlider] = SliderFillEnd(pSlider);
+	g_psSliderTextWidth[ulSlider] = GrStringWidthGet(&sCtx, pSlider->pcText,
+													 -1);
+}
+
+//*****************************************************************************
+//
+// Repaint a slider after its value, range or text has changed.  Only the
+// columns the end of the fill moved across and the text are painted, rather
+// than the whole slider.
+//
+// The columns either side of the ones that changed are painted too, in case
+// the paint handler rounds the end of the fill a column differently.
+//
+// param ulSlider: the slider, from FMAX_DISP_SLIDER to NUMBARS_SLIDER
+//
+//*****************************************************************************
+static void
+SliderPaintChange(unsigned long ulSlider)
+{
+	tSliderWidget *pSlider;
+	tContext sCtx;
+	tRectangle sSpan, sText, sClip;
+	short sOldEnd, sNewEnd, sWidth, sHalf, sMid;
+
+	pSlider = &g_psSliders[ulSlider];
+	sOldEnd = g_psSliderFillEnd[ulSlider];
+	sNewEnd = SliderFillEnd(pSlider);
+
+	GrContextInit(&sCtx, pSlider->sBase.pDisplay);
+	GrContextFontSet(&sCtx, pSlider->pFont);
+	sWidth = GrStringWidthGet(&sCtx, pSlider->pcText, -1);
+
+	//
+	// The text is covered at the wider of its old and new widths
+	//
+	sHalf = ((sWidth > g_psSliderTextWidth[ulSlider]) ?
+			 sWidth : g_psSliderTextWidth[ulSlider]) / 2 + 1;
+	sMid = (pSlider->sBase.sPosition.sXMin +
+			pSlider->sBase.sPosition.sXMax) / 2;
+	sText = pSlider->sBase.sPosition;
+	sText.sXMin = sMid - sHalf;
+	sText.sXMax = sMid + sHalf;
+
+	sSpan = pSlider->sBase.sPosition;
+	sSpan.sXMin = ((sOldEnd < sNewEnd) ? sOldEnd : sNewEnd) - 1;
+	sSpan.sXMax = ((sOldEnd < sNewEnd) ? sNewEnd : sOldEnd) + 1;
+
+	if(sOldEnd == sNewEnd)
+	{
+		SliderAreaPaint(pSlider, &sText, sNewEnd);
+	}
+	else
+	{
+		//
+		// Paint the span and the text as one if they touch
+		//
+		if((sSpan.sXMax + 1 >= sText.sXMin) &&
+		   (sText.sXMax + 1 >= sSpan.sXMin))
+		{
+			sSpan.sXMin = (sText.sXMin < sSpan.sXMin) ? sText.sXMin :
+														sSpan.sXMin;
+			sSpan.sXMax = (sText.sXMax > sSpan.sXMax) ? sText.sXMax :
+														sSpan.sXMax;
+		}
+		else
+		{
+			SliderAreaPaint(pSlider, &sText, sNewEnd);
+		}
+		if(GrRectIntersectGet(&sSpan, &pSlider->sBase.sPosition, &sClip))
+		{
+			SliderAreaPaint(pSlider, &sClip, sNewEnd);
+		}
+	}
+
+	g_psSliderFillEnd[ulSlider] = sNewEnd;
+	g_psSliderTextWidth[ulSlider] = sWidth;
+}
+
+//*****************************************************************************
+//
+// Find how urgently a bar needs to be drawn: the more of it the renderer
+// would have to draw, the sooner it is drawn.
+//
+// param psRenderer: the renderer the bar is drawn with
+// param psFrame: the frame the bar is from
+// param ulIdx: the index of the bar
+//
+// return: the priority, from 0 to PAINT_PRIORITY_LEVELS - 1, or -1 if drawing
+//		   the bar wouldn't change anything on the screen
+//
+//*****************************************************************************
+static int
+PaintPriority(const tRenderer *psRenderer, tBarFrame *psFrame,
+			  unsigned long ulIdx)
+{
+	long lCost;
+
+	//
+	// A bar that hasn't moved still costs 0 rather than -1 if the renderer
+	// has something of it moving, like a falling raindrop
+	//
+	lCost = psRenderer->pfnCost(psRenderer->pvData, psFrame, ulIdx);
+	if(lCost < 0)
+	{
+		return(-1);
+	}
+
+	lCost >>= PAINT_PRIORITY_SHIFT;
+	if(lCost >= PAINT_PRIORITY_LEVELS)
+	{
+		lCost = PAINT_PRIORITY_LEVELS - 1;
+	}
+	return(lCost);
+}
+
+//*****************************************************************************
+//
+// Start a pass of the painter over a frame.  The bars that need drawing are
+// put in g_pusPaintOrder, most urgent first, with a counting sort on their
+// priority.  Bars of the same priority are drawn left to right.
+//
+// param psRenderer: the renderer the frame is drawn with
+// param psFrame: the frame to draw
+//
+// return: 1 if every bar of the frame is at the bottom, and the renderer has
+//		   nothing left to animate, 0 otherwise
+//
+//*****************************************************************************
+static unsigned char
+PaintPlan(const tRenderer *psRenderer, tBarFrame *psFrame)
+{
+	unsigned short pusStart[PAINT_PRIORITY_LEVELS];
+	unsigned long ulIdx;
+	unsigned int uiPos;
+	unsigned char ucIdle;
+	int iLevel;
+
+	for(iLevel = 0; iLevel < PAINT_PRIORITY_LEVELS; iLevel++)
+	{
+		pusStart[iLevel] = 0;
+	}
+
+	//
+	// Count the bars at each priority
+	//
+	ucIdle = 1;
+	for(ulIdx = 0; ulIdx < psFrame->uiNumBars; ulIdx++)
+	{
+		iLevel = PaintPriority(psRenderer, psFrame, ulIdx);
+		if(iLevel >= 0)
+		{
+			pusStart[iLevel]++;
+		}
+		if(psFrame->pucHeights[ulIdx] || (iLevel >= 0))
+		{
+			ucIdle = 0;
+		}
+	}
+
+	//
+	// Turn the counts into where each priority starts in the order, highest
+	// priority first
+	//
+	uiPos = 0;
+	for(iLevel = PAINT_PRIORITY_LEVELS - 1; iLevel >= 0; iLevel--)
+	{
+		uiPos += pusStart[iLevel];
+		pusStart[iLevel] = uiPos - pusStart[iLevel];
+	}
+	g_uiPaintCount = uiPos;
+	g_uiPaintNext = 0;
+
+	//
+	// And put each bar in its place
+	//
+	for(ulIdx = 0; ulIdx < psFrame->uiNumBars; ulIdx++)
+	{
+		iLevel = PaintPriority(psRenderer, psFrame, ulIdx);
+		if(iLevel >= 0)
+		{
+			g_pusPaintOrder[pusStart[iLevel]++] = ulIdx;
+		}
+	}
+
+	return(ucIdle);
+}
+
+//*****************************************************************************
+//
+// Color the bars for a layout, from the palette in g_ucBarPalette, unless
+// they are already colored that way.  A new palette only shows on the parts
+// of the bars drawn from here on, until the next fresh display.
+//
+// param uiNumBars: the number of bars
+//
+//*****************************************************************************
+static void
+ColorsUpdate(unsigned int uiNumBars)
+{
+	if(g_ucBarPalette >= NUM_BAR_PALETTES)
+	{
+		g_ucBarPalette = BAR_PALETTE_GRADIENT;
+	}
+	if((uiNumBars != g_uiColorBars) || (g_ucBarPalette != g_ucColorPalette))
+	{
+		RenderColorsBuild(uiNumBars, g_ucBarPalette);
+		g_uiColorBars = uiNumBars;
+		g_ucColorPalette = g_ucBarPalette;
+	}
+}
+
+//*****************************************************************************
+//
+// The function used to paint the equalizer bars.
+//
+// param ucResetDisp: Whether we are drawing a fresh display (1) or updating a
+//		 previously drawn display (0).  Resetting the display picks up the
+//		 selected renderer and has it forget what was drawn last time, so the
+//		 next pass draws every bar in full; nothing is drawn by the reset
+//		 itself.
+// param pContext: the context in which the bars are to be drawn
+//
+// The bars are drawn by the renderer in g_ucRenderer, which only draws what
+// has changed since it last drew each bar.
+// At a lot of bars, drawing all of them can take longer than a refresh
+// period, and the DSP code doesn't get to run while they are drawn.  So the
+// bars are drawn in passes, and each call only draws for PAINT_BUDGET_US
+// before returning.  The next call picks the pass back up where it left off.
+// The bars that have changed the most are drawn first, so when the painter
+// falls behind, it is the smallest changes that show up late.  If a new frame
+// comes in before a pass is done, the rest of the pass is planned again from
+// the new frame.
+//
+// Once the input has gone silent and every bar and raindrop has fallen to the
+// bottom, nothing can change until the input comes back, so the bars are not
+// walked at all.
+//
+// Each new frame is handed to the latency statistics once all of it is on the
+// screen.
+//
+// return: 1 if the display is up to date, or 0 if the pass ran out of time
+//		   and has more bars to draw
+//
+//*****************************************************************************
+static unsigned char
+OnEqPaint(unsigned char ucResetDisp, tContext *pContext)
+{
+    unsigned long ulIdx;
+    unsigned long ulStart, ulBudget, ulElapsed;
+    long lXMin, lWidth;
+    static const tRenderer *psRenderer = 0;
+    static unsigned char ucIdle = 0;
+    static unsigned char ucFresh = 0;
+    static unsigned char ucFull;
+    static unsigned char ucNewFrame;
+    static unsigned long ulLastSequence;
+    tBarFrame *psFrame;
+
+    //
+    // If this is a draw on a fresh display, have the renderer forget what it
+    // drew, and drop any pass that was under way.  The renderer is only
+    // switched here, since a renderer can't draw over what another one drew.
+    //
+    if(ucResetDisp || !psRenderer)
+    {
+    	if(g_ucRenderer >= NUM_RENDERERS)
+    	{
+    		g_ucRenderer = RENDERER_BARS;
+    	}
+    	psRenderer = g_ppsRenderers[g_ucRenderer];
+    	psRenderer->pfnInit(psRenderer->pvData);
+    	g_ucPaintPass = 0;
+    	ucFresh = 1;
+    	return(0);
+    }
+
+    //
+    // Frames from before the last configuration change may have a different
+    // number of bars, so wait for a current one.  A pass over a frame that
+    // has since been replaced is started over on the new one.
+    //
+    psFrame = g_psBarFrame;
+    if(psFrame->ulEpoch != g_ulConfigEpoch)
+    {
+    	g_ucPaintPass = 0;
+    	return(1);
+    }
+    if(psFrame->ulSequence != g_ulPaintSequence)
+    {
+    	g_ucPaintPass = 0;
+    }
+
+    ulStart = SysTickValueGet();
+
+    if(!g_ucPaintPass)
+    {
+		//
+		// If nothing has changed since the last draw, don't tie up the bus
+		// drawing it again.  Falling raindrops still have to be animated,
+		// though.
+		//
+		if(!ucFresh &&
+		   (((psFrame->ulSequence == ulLastSequence) && !g_ucDispRain) ||
+			(ucIdle && g_ucSilent)))
+		{
+			return(1);
+		}
+
+		//
+		// Only the first pass after a reset draws in full.  If it's cut
+		// short by a new frame, the bars it did draw are already on the
+		// screen, so the pass planned over again draws just the changes.
+		//
+		ucFull = ucFresh;
+		ucFresh = 0;
+		ucNewFrame = (psFrame->ulSequence != ulLastSequence);
+		ulLastSequence = psFrame->ulSequence;
+
+		//
+		// Color the bars for the current layout
+		//
+		ColorsUpdate(psFrame->uiNumBars);
+
+		ucIdle = PaintPlan(psRenderer, psFrame);
+		g_ulPaintSequence = psFrame->ulSequence;
+		g_ucPaintPass = 1;
+    }
+
+    RenderLayout(psFrame->uiNumBars, &lXMin, &lWidth);
+
+    //
+    // Draw bars until the pass is done or the time is up.  At least one bar
+    // is drawn per call, so the pass always makes progress.  SysTick counts
+    // down.
+    //
+    ulBudget = (SysCtlClockGet() / 1000000) * PAINT_BUDGET_US;
+    while(g_uiPaintNext < g_uiPaintCount)
+    {
+    	ulIdx = g_pusPaintOrder[g_uiPaintNext++];
+    	if(ucFull)
+    	{
+    		psRenderer->pfnPaintFull(psRenderer->pvData, psFrame, ulIdx,
+    								 lXMin + (ulIdx * lWidth), lWidth);
+    	}
+    	else
+    	{
+    		psRenderer->pfnPaintDiff(psRenderer->pvData, psFrame, ulIdx,
+    								 lXMin + (ulIdx * lWidth), lWidth);
+    	}
+    	if(((ulStart - SysTickValueGet()) & 0x00ffffff) >= ulBudget)
+    	{
+    		break;
+    	}
+    }
+    ulElapsed = (ulStart - SysTickValueGet()) & 0x00ffffff;
+    g_ulPassCycles += ulElapsed;
+
+    if(g_uiPaintNext < g_uiPaintCount)
+    {
+    	return(0);
+    }
+
+    //
+    // The pass is done.  Its cost, including any time spent on frames that
+    // were replaced part way through, is what the refresh rate is paced by.
+    //
+    g_ulPaintCycles = g_ulPassCycles;
+    g_ulPassCycles = 0;
+    g_ucPaintPass = 0;
+
+    if(ucNewFrame)
+    {
+    	LatencyRecord(psFrame->ulCaptureTime);
+    }
+
+    return(1);
+}
+
+//*****************************************************************************
+//
+// The function used to paint the waterfall (spectrogram) display.
+//
+// Each frame is drawn as a row of color mapped bars at the top of the
+// waterfall, and the older rows move down a line.  Rather than redrawing
+// them, the SSD2119 scrolls the waterfall in hardware, so only one row of
+// pixels is written per frame.  The row that scrolls around to the top is the
+// oldest one, so the new row is simply drawn over it.
+//
+// param ucResetDisp: Whether we are drawing a fresh display (1) or updating a
+//		 previously drawn display (0).  A fresh display clears the waterfall
+//		 and sets up the hardware scrolling.
+// param pContext: the context in which the waterfall is to be drawn
+//
+//*****************************************************************************
+static void
+OnWaterfallPaint(unsigned char ucResetDisp, tContext *pContext)
+{
+	static unsigned long ulScroll;
+	static unsigned long ulLastFrame;
+	tRectangle sRect;
+	long lXMin, lWidth;
+	tBarFrame *psFrame;
+
+	psFrame = g_psBarFrame;
+
+	if(ucResetDisp)
+	{
+		//
+		// Clear the waterfall to black.  The rows are never drawn outside
+		// the bars, so this also gives them a black border on either side.
+		//
+		sRect.sXMin = 0;
+		sRect.sYMin = WATERFALL_Y_MIN;
+		sRect.sXMax = GrContextDpyWidthGet(pContext) - 1;
+		sRect.sYMax = WATERFALL_Y_MAX;
+		GrContextForegroundSet(pContext, ClrBlack);
+		GrRectFill(pContext, &sRect);
+
+		Kentec320x240x16_SSD2119ScrollAreaSet(WATERFALL_Y_MIN,
+											  WATERFALL_Y_MAX);
+		ulScroll = 0;
+		ulLastFrame = psFrame->ulSequence;
+		return;
+	}
+
+	//
+	// Only add a row when the DSP has finished a new frame, and only for the
+	// current configuration
+	//
+	if((ulLastFrame == psFrame->ulSequence) ||
+	   (psFrame->ulEpoch != g_ulConfigEpoch))
+	{
+		return;
+	}
+	ulLastFrame = psFrame->ulSequence;
+
+	//
+	// Lay the bars out the same way OnEqPaint does
+	//
+	RenderLayout(psFrame->uiNumBars, &lXMin, &lWidth);
+
+	//
+	// Draw the new row over the oldest one, which is at the bottom of the
+	// waterfall, then scroll down a line to bring it around to the top
+	//
+	ulScroll = (ulScroll + 1) % WATERFALL_HEIGHT;
+	DpyPixelDrawRuns(lXMin, WATERFALL_Y_MIN +
+					 ((WATERFALL_HEIGHT - ulScroll) % WATERFALL_HEIGHT),
+					 psFrame->uiNumBars, lWidth, psFrame->pucHeights,
+					 g_pusColormapHeat);
+	Kentec320x240x16_SSD2119ScrollSet(ulScroll);
+	LatencyRecord(psFrame->ulCaptureTime);
+}
+
+//*****************************************************************************
+//
+// Draw the tuner readout in place of the title at the top of the screen.
+//
+// param pContext: the context in which the readout is to be drawn
+//
+// return: non-zero if the readout restored or drew over the latency
+//		   readout's corner
+//
+//*****************************************************************************
+static unsigned char
+DrawTunerReadout(tContext *pContext)
+{
+	char pcText[32];
+	long lWidth, lHeight, lCorner;
+	unsigned char ucOverCorner;
+
+	//
+	// Restore the background behind the last readout by redrawing just the
+	// rectangle it was drawn in
+	//
+	lCorner = GrContextDpyWidthGet(pContext) - LATENCY_WIDTH;
+	ucOverCorner = (g_sTunerRect.sXMax >= lCorner);
+	RestoreRect(g_sTunerRect.sXMin, g_sTunerRect.sYMin, g_sTunerRect.sXMax,
+				g_sTunerRect.sYMax);
+
+	if(g_sTunerResults.ucValid)
+	{
+		usprintf(pcText, "%s%d  %c%d cents  (%d.%d Hz)",
+				 TunerNoteName(g_sTunerResults.iNote),
+				 TunerNoteOctave(g_sTunerResults.iNote),
+				 (g_sTunerResults.iCents < 0) ? '-' : '+',
+				 (g_sTunerResults.iCents < 0) ?
+				 -g_sTunerResults.iCents : g_sTunerResults.iCents,
+				 (int)g_sTunerResults.fFrequency,
+				 (int)(g_sTunerResults.fFrequency * 10) % 10);
+	}
+	else
+	{
+		usprintf(pcText, "Tuner: ---");
+	}
+
+	GrContextFontSet(pContext, &g_sFontCm16);
+	GrContextForegroundSet(pContext, ClrLightGrey);
+	GrStringDrawCentered(pContext, pcText, -1,
+						 GrContextDpyWidthGet(pContext) / 2, 10, 0);
+
+	//
+	// Note where it went, give or take a pixel of rounding either way, as
+	// DrawTitle does.  The title bar is already among the covered areas, so
+	// this isn't passed to CoverAdd.
+	//
+	lWidth = GrStringWidthGet(pContext, pcText, -1);
+	lHeight = GrStringHeightGet(pContext);
+	g_sTunerRect.sXMin = (GrContextDpyWidthGet(pContext) - lWidth) / 2 - 1;
+	g_sTunerRect.sXMax = g_sTunerRect.sXMin + lWidth + 1;
+	g_sTunerRect.sYMin = 10 - (lHeight / 2) - 1;
+	g_sTunerRect.sYMax = g_sTunerRect.sYMin + lHeight + 1;
+	if(g_sTunerRect.sXMin < 0)
+	{
+		g_sTunerRect.sXMin = 0;
+	}
+	if(g_sTunerRect.sYMin < 0)
+	{
+		g_sTunerRect.sYMin = 0;
+	}
+
+	return(ucOverCorner || (g_sTunerRect.sXMax >= lCorner));
+}
+
+//*****************************************************************************
+//
+// Draw the sample to pixel latency, as the median and 99th percentile in
+// milliseconds, in the top right corner of the screen.
+//
+// param pContext: the context in which the readout is to be drawn
+// param ucForce: whether to draw the readout even if the statistics haven't
+//		 changed since it was last drawn, as when something has drawn over it
+//
+//*****************************************************************************
+static void
+DrawLatencyReadout(tContext *pContext, unsigned char ucForce)
+{
+	static unsigned long ulLastInterval;
+	char pcText[24];
+
+	if(!ucForce && (ulLastInterval == g_sLatencyStats.ulInterval))
+	{
+		return;
+	}
+	ulLastInterval = g_sLatencyStats.ulInterval;
+
+	//
+	// Restore the background behind the last readout.  The title stops well
+	// short of this corner, and a tuner readout that reaches it forces this
+	// to be redrawn.
+	//
+	BackgroundDraw(&g_sBackground,
+				   GrContextDpyWidthGet(pContext) - LATENCY_WIDTH, 0,
+				   GrContextDpyWidthGet(pContext) - 1, 20);
+
+	if(g_sLatencyStats.ulCount)
+	{
+		usprintf(pcText, "%d/%d ms", g_sLatencyStats.ulP50 / 1000,
+				 g_sLatencyStats.ulP99 / 1000);
+	}
+	else
+	{
+		usprintf(pcText, "--/-- ms");
+	}
+
+	GrContextFontSet(pContext, &g_sFontCm12);
+	GrContextForegroundSet(pContext, ClrLightGrey);
+	GrStringDraw(pContext, pcText, -1, GrContextDpyWidthGet(pContext) - 4 -
+				 GrStringWidthGet(pContext, pcText, -1), 4, 0);
+}
+
+//*****************************************************************************
+//
+// Set a checkbox and its indicator, without painting them.
+//
+// param ulCheck: the checkbox
+// param ucOn: 1 to select it, 0 to clear it
+//
+//*****************************************************************************
+static void
+CheckSet(unsigned long ulCheck, unsigned char ucOn)
+{
+	if(ucOn)
+	{
+		CheckBoxSelectedOn(g_psCheckBoxes + ulCheck);
+		CanvasImageSet(g_psCheckBoxIndicators + ulCheck, g_pucLightOn);
+	}
+	else
+	{
+		CheckBoxSelectedOff(g_psCheckBoxes + ulCheck);
+		CanvasImageSet(g_psCheckBoxIndicators + ulCheck, g_pucLightOff);
+	}
+}
+
+//*****************************************************************************
+//
+// Set a slider's value and the text showing it, without painting it.
+//
+// param ulSlider: the slider
+// param lValue: the value
+//
+//*****************************************************************************
+static void
+SliderSet(unsigned long ulSlider, long lValue)
+{
+	g_plSliderVal[ulSlider] = lValue;
+	SliderValueSet(&g_psSliders[ulSlider], lValue);
+	usprintf(g_pcSliderText[ulSlider], "%d", lValue);
+	SliderTextSet(&g_psSliders[ulSlider], g_pcSliderText[ulSlider]);
+}
+
+//*****************************************************************************
+//
+// Set an option on the third config page and the text its button shows,
+// without painting it.
+//
+// param ulChoice: the option
+// param lValue: the value
+//
+//*****************************************************************************
+static void
+ChoiceSet(unsigned long ulChoice, long lValue)
+{
+	g_plChoiceVal[ulChoice] = lValue;
+	if(ulChoice == CHOICE_WINDOW)
+	{
+		usprintf(g_pcChoiceText[ulChoice], "%s", WindowNameGet(lValue));
+	}
+	else if(ulChoice == CHOICE_AVG_MODE)
+	{
+		usprintf(g_pcChoiceText[ulChoice], "%s", g_ppcAvgModeNames[lValue]);
+	}
+	else if(ulChoice == CHOICE_AVG_FRAMES)
+	{
+		usprintf(g_pcChoiceText[ulChoice], "%d", lValue);
+	}
+	else if(ulChoice == CHOICE_WEIGHTING)
+	{
+		usprintf(g_pcChoiceText[ulChoice], "%s",
+				 g_ppcWeightingNames[lValue]);
+	}
+	else if(ulChoice == CHOICE_BAR_SCALE)
+	{
+		usprintf(g_pcChoiceText[ulChoice], "%s", g_ppcBarScaleNames[lValue]);
+	}
+	else if((ulChoice == CHOICE_DB_FLOOR) || (ulChoice == CHOICE_DB_CEILING))
+	{
+		usprintf(g_pcChoiceText[ulChoice], "%d dB", lValue);
+	}
+	else if(ulChoice == CHOICE_BAR_PALETTE)
+	{
+		usprintf(g_pcChoiceText[ulChoice], "%s",
+				 g_ppcBarPaletteNames[lValue]);
+	}
+	else if(ulChoice == CHOICE_RENDERER)
+	{
+		usprintf(g_pcChoiceText[ulChoice], "%s",
+				 g_ppsRenderers[lValue]->pcName);
+	}
+	PushButtonTextSet(&g_psChoiceButtons[ulChoice], g_pcChoiceText[ulChoice]);
+}
+
+//*****************************************************************************
+//
+// Take a copy of the analysis and display options as they are set on the
+// third config page.
+//
+// param psOptions: where to store them
 //
 //*****************************************************************************
 static void
-InitDisplayTimer()
+OptionsGet(tSavedOptions *psOptions)
 {
-	//
-	// Set up timer3A to be the display timer, interrupting at 15 Hz
-	//
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER3);
-    TimerConfigure(TIMER3_BASE, TIMER_CFG_ONE_SHOT);
-    TimerLoadSet(TIMER3_BASE, TIMER_A, SysCtlClockGet()/REFRESH_RATE);
-    IntEnable(INT_TIMER3A);
-    TimerIntEnable(TIMER3_BASE, TIMER_TIMA_TIMEOUT);
-    TimerEnable(TIMER3_BASE, TIMER_A);
+	psOptions->ucWindowType = g_plChoiceVal[CHOICE_WINDOW];
+	psOptions->ucAvgMode = g_plChoiceVal[CHOICE_AVG_MODE];
+	psOptions->ucAvgFrames = g_plChoiceVal[CHOICE_AVG_FRAMES];
+	psOptions->ucWeighting = g_plChoiceVal[CHOICE_WEIGHTING];
+	psOptions->ucBarScale = g_plChoiceVal[CHOICE_BAR_SCALE];
+	psOptions->cDbFloor = g_plChoiceVal[CHOICE_DB_FLOOR];
+	psOptions->cDbCeiling = g_plChoiceVal[CHOICE_DB_CEILING];
+	psOptions->ucBarPalette = g_plChoiceVal[CHOICE_BAR_PALETTE];
+	psOptions->ucRenderer = g_plChoiceVal[CHOICE_RENDERER];
+	psOptions->pucReserved[0] = 0;
+	psOptions->pucReserved[1] = 0;
+	psOptions->pucReserved[2] = 0;
 }
 
-
 //*****************************************************************************
 //
-// This function will draw a column of an image as specified by the input
-// parameters.  This is necessary because trying to draw row by row does not
-// yield the screen refresh rate necessary for an impressive display.
-//
-// param pContext: a pointer to the context in which the image is to be drawn
-// param *pucImage: a pointer to the character array in which the image is
-//		 stored
-// param lColumn: the column of the image that is to be drawn
-// param lYStart: the Y coordinate at which to start drawing the column
-// param lYStop: the Y coordinate at which to stop drawing the column
+// Put back the settings saved by ConfigSave, if there are any, and set the
+// config pages to show them.  A record that doesn't make sense is ignored,
+// leaving the settings as they were.  A record saved before the options were
+// kept leaves the options as they were.
 //
 //*****************************************************************************
 static void
-DrawImgColumn2(const tContext *pContext, const unsigned char *pucImage,
-        long lColumn, long lYStart, long lYStop)
+ConfigLoad(void)
 {
-    long lBPP, lWidth, lHeight, lY;
-    const unsigned char *pucPalette;
-    unsigned long pulBWPalette[2];
-
-    //
-    // Get the image format from the image data.
-    //
-    lBPP = *pucImage++;
-
-    //
-    // Get the image width from the image data.
-    //
-    lWidth = *(unsigned short *)pucImage;
-    pucImage += 2;
-
-    //
-    // Get the image height from the image data.
-    //
-    lHeight = *(unsigned short *)pucImage;
-    pucImage += 2;
+	tSavedConfig sConfig;
+	tSavedOptions sOptions;
+	unsigned short usTag;
 
-    //
-    // Determine the color palette for the image based on the image format.
-    //
-    if((lBPP & 0x7f) == IMAGE_FMT_1BPP_UNCOMP)
-    {
-        //
-        // Construct a local "black & white" palette based on the foreground
-        // and background colors of the drawing context.
-        //
-        pulBWPalette[0] = pContext->ulBackground;
-        pulBWPalette[1] = pContext->ulForeground;
-
-        //
-        // Set the palette pointer to the local "black & white" palette.
-        //
-        pucPalette = (unsigned char *)pulBWPalette;
-    }
-    else
-    {
-        //
-        // For 4 and 8 BPP images, the palette is contained at the start of the
-        // image data.
-        //
-        pucPalette = pucImage + 1;
-        pucImage += (pucImage[0] * 3) + 4;
-    }
+	if(StoreFind(STORE_TAG_CONFIG_2) ==
+	   (long)(sizeof(sConfig) + sizeof(sOptions)))
+	{
+		usTag = STORE_TAG_CONFIG_2;
+		if(StoreRead(usTag, sizeof(sConfig), &sOptions, sizeof(sOptions)) !=
+		   sizeof(sOptions))
+		{
+			return;
+		}
+	}
+	else if(StoreFind(STORE_TAG_CONFIG) == sizeof(sConfig))
+	{
+		usTag = STORE_TAG_CONFIG;
+		OptionsGet(&sOptions);
+	}
+	else
+	{
+		return;
+	}
+	if(StoreRead(usTag, 0, &sConfig, sizeof(sConfig)) != sizeof(sConfig))
+	{
+		return;
+	}
 
-    //
-    // See if the image is compressed.
-    //
-    if((lBPP & 0x80))
-    {
-    	//
-		// We don't support compression yet... Deal with it.
-		//
-		while(1);
-    }
+	if((sConfig.ulSamplingFreq < MIN_SAMPLING_FREQ) ||
+	   (sConfig.ulSamplingFreq > MAX_SAMPLING_FREQ) ||
+	   (sConfig.ulMinDisplayFreq < MIN_DISPLAY_L_FREQ) ||
+	   (sConfig.ulMinDisplayFreq > MAX_DISPLAY_L_FREQ) ||
+	   (sConfig.ulMaxDisplayFreq < MIN_DISPLAY_U_FREQ) ||
+	   (sConfig.ulMaxDisplayFreq > sConfig.ulSamplingFreq / 2) ||
+	   (sConfig.ulMaxDisplayFreq <= sConfig.ulMinDisplayFreq) ||
+	   (sConfig.ulNumBars < MIN_NUMBARS) ||
+	   (sConfig.ulNumBars > MAX_NUMBARS) ||
+	   (sConfig.ucDispRain > 1) || (sConfig.ucTunerMode > 1) ||
+	   (sConfig.ucWaterfall > 1) ||
+	   (sOptions.ucWindowType >= NUM_WINDOWS) ||
+	   (sOptions.ucAvgMode > AVG_MODE_BOXCAR) ||
+	   (sOptions.ucAvgFrames < MIN_AVG_FRAMES) ||
+	   (sOptions.ucAvgFrames > MAX_AVG_FRAMES) ||
+	   (sOptions.ucWeighting > WEIGHTING_C) ||
+	   (sOptions.ucBarScale > BAR_SCALE_DB) ||
+	   (sOptions.cDbFloor < MIN_DB_FLOOR) ||
+	   (sOptions.cDbCeiling > MAX_DB_CEILING) ||
+	   (sOptions.cDbFloor >= sOptions.cDbCeiling) ||
+	   (sOptions.ucBarPalette >= NUM_BAR_PALETTES) ||
+	   (sOptions.ucRenderer >= NUM_RENDERERS))
+	{
+		return;
+	}
 
-	//
-	// The image is not compressed.
-	// Skip past the data for the rows that lie above the desired region
-	//
-	pucImage += (((lWidth * lBPP) + 7) / 8) * lYStart;
+	g_uiSamplingFreq = sConfig.ulSamplingFreq;
+	g_uiMinDisplayFreq = sConfig.ulMinDisplayFreq;
+	g_uiMaxDisplayFreq = sConfig.ulMaxDisplayFreq;
+	g_uiNumDisplayBars = sConfig.ulNumBars;
+	g_ucDispRain = sConfig.ucDispRain;
+	g_ucTunerMode = sConfig.ucTunerMode;
+	g_ucWaterfall = sConfig.ucWaterfall;
+	g_ucWindowType = sOptions.ucWindowType;
+	g_ucAvgMode = sOptions.ucAvgMode;
+	g_ucAvgFrames = sOptions.ucAvgFrames;
+	g_ucWeighting = sOptions.ucWeighting;
+	g_ucBarScale = sOptions.ucBarScale;
+	g_cDbFloor = sOptions.cDbFloor;
+	g_cDbCeiling = sOptions.cDbCeiling;
+	g_ucBarPalette = sOptions.ucBarPalette;
+	g_ucRenderer = sOptions.ucRenderer;
 
 	//
-	// Set the display height
+	// The sampling frequency sets how far the max display frequency slider
+	// goes, so that goes first
 	//
-	lHeight = lYStop - lYStart + 1;
-
-	lY = lYStart;
-
-	DpyPixelDrawMultipleVertical(lColumn, lY, lHeight, lWidth,
-								 pucImage + lColumn, pucPalette);
+	SliderSet(FSAMP_SLIDER, g_uiSamplingFreq);
+	SliderRangeSet(&g_psSliders[FMAX_DISP_SLIDER], MIN_DISPLAY_U_FREQ,
+				   g_uiSamplingFreq / 2);
+	SliderSet(FMAX_DISP_SLIDER, g_uiMaxDisplayFreq);
+	SliderSet(FMIN_DISP_SLIDER, g_uiMinDisplayFreq);
+	SliderSet(NUMBARS_SLIDER, g_uiNumDisplayBars);
+	CheckSet(CHECK_RAIN, g_ucDispRain);
+	CheckSet(CHECK_TUNER, g_ucTunerMode);
+	CheckSet(CHECK_WATERFALL, g_ucWaterfall);
+	ChoiceSet(CHOICE_WINDOW, g_ucWindowType);
+	ChoiceSet(CHOICE_AVG_MODE, g_ucAvgMode);
+	ChoiceSet(CHOICE_AVG_FRAMES, g_ucAvgFrames);
+	ChoiceSet(CHOICE_WEIGHTING, g_ucWeighting);
+	ChoiceSet(CHOICE_BAR_SCALE, g_ucBarScale);
+	ChoiceSet(CHOICE_DB_FLOOR, g_cDbFloor);
+	ChoiceSet(CHOICE_DB_CEILING, g_cDbCeiling);
+	ChoiceSet(CHOICE_BAR_PALETTE, g_ucBarPalette);
+	ChoiceSet(CHOICE_RENDERER, g_ucRenderer);
 }
 
 //*****************************************************************************
 //
-// The function used to paint the equalizer bars.
-//
-// param ucResetDisp: Whether we are drawing a fresh display (1) or updating a
-//		 previously drawn display (0).  If this is a fresh display, we need to
-//		 draw the entire bar from top to bottom, as opposed to just the part of
-//		 the bar that has changed since last draw.
-// param pContext: the context in which the bars are to be drawn
+// Save the settings on the config pages, so that ConfigLoad can put them
+// back after a reset.  Nothing is written if they haven't changed since they
+// were last saved.
 //
 //*****************************************************************************
-void
-OnEqPaint(unsigned char ucResetDisp, tContext *pContext)
+static void
+ConfigSave(void)
 {
-    unsigned long ulIdx;
-    tRectangle sRect;
-    int canvasWidth, maxWidth, width;
-    int Xmin, Ymax;
-    unsigned int uiColIdx;
-    unsigned long ulColor;
-    static unsigned char pucPrevHeight[MAX_NUMBARS] = {0};
-
-    //Todo: these should probably be macro'd out...
-    Ymax = 210;
-    canvasWidth = 300;
-    maxWidth = 50;
-
-    //
-    // Figure out the width of each bar based on the number of pixels the
-    // entire display can take up
-    //
-    width = canvasWidth / g_uiNumDisplayBars;
-    if(width > maxWidth)
-    {
-    	width = maxWidth;
-    }
-    Xmin = 10 + (canvasWidth - (width * g_uiNumDisplayBars))/2;
-
-    sRect.sXMin = Xmin;
-    sRect.sXMax = Xmin + width - 1;
-
-    //
-    // If this is a draw on a fresh display, set all previous heights back to 0
-    //
-    if(ucResetDisp)
-    {
-    	for(ulIdx = 0; ulIdx < g_uiNumDisplayBars; ulIdx++)
-    	{
-    		pucPrevHeight[ulIdx] = 0;
-    	}
-    }
-
-    //
-    // Draw each bar
-    //
-    for(ulIdx = 0; ulIdx < g_uiNumDisplayBars; ulIdx++)
-    {
-    	if(pucPrevHeight[ulIdx] < LEDDisplay[ulIdx])
-    	{
-    		//
-    		// If last drawn height is smaller than current, we need to draw
-    		// the bar color from previous height to current height.  This way,
-    		// we don't have to waste time drawing parts of the bar that are
-    		// already on the screen from the last draw.
-    		//
-
-    		//
-    		// Set the color to be an even gradient from blue to red
-    		//
-    		ulColor = ((((g_uiNumDisplayBars - ulIdx) * 255) / g_uiNumDisplayBars) << ClrBlueShift) |
-    				   (((ulIdx * 255) / g_uiNumDisplayBars) << ClrRedShift);
-
-
-    		if(g_ucDispRain)
-    		{
-				if(LEDDisplay[ulIdx] >= LEDDisplayMaxes[ulIdx])
-				{
-					sRect.sYMax = Ymax - pucPrevHeight[ulIdx] + RAIN_HEIGHT;
-				}
-				else
-				{
-					sRect.sYMax = Ymax - pucPrevHeight[ulIdx];
-				}
-    		}
-    		else
-    		{
-    			sRect.sYMax = Ymax - pucPrevHeight[ulIdx];
-    		}
-    		sRect.sYMin = Ymax - LEDDisplay[ulIdx] - 1;
-    		for(uiColIdx=sRect.sXMin; uiColIdx<=sRect.sXMax; uiColIdx++)
-			{
-    			DpyLineDrawV(pContext->pDisplay, uiColIdx, sRect.sYMin,
-    						 sRect.sYMax,
-    						 DpyColorTranslate(pContext->pDisplay, ulColor));
-			}
-    	}
-    	else
-    	{
-    		//
-    		// If last drawn height is bigger than current, we need to draw the
-    		// background image from last height to current height.
-    		//
-    		sRect.sYMin = Ymax - pucPrevHeight[ulIdx] - 1;
-    		sRect.sYMax = Ymax - LEDDisplay[ulIdx];
-    		for(uiColIdx=sRect.sXMin; uiColIdx<=sRect.sXMax; uiColIdx++)
-    		{
-    			DrawImgColumn2(pContext, g_pucImage, uiColIdx, sRect.sYMin, sRect.sYMax);
-    		}
-    	}
-
-
-    	if(g_ucDispRain)
-    	{
-			if(LEDDisplayMaxes[ulIdx] <= LEDDisplay[ulIdx])
-			{
-				//
-				// We have a new maximum... no need for gravity calculations
-				// this time, and drawing the bar (from above step) will have
-				// drawn over where the raindrop was last time
-				//
-				LEDDisplayMaxes[ulIdx] = LEDDisplay[ulIdx];
-				g_pucGravity[ulIdx] = 0;
-			}
-			else
-			{
-				//
-				// No new maximum... we need to draw the background image back
-				// over where the rain drop was last time
-				//
-				sRect.sYMax = Ymax - LEDDisplayMaxes[ulIdx] + RAIN_HEIGHT;
-				sRect.sYMin = Ymax - LEDDisplayMaxes[ulIdx];
-
-				for(uiColIdx=sRect.sXMin; uiColIdx<=sRect.sXMax; uiColIdx++)
-				{
-					DrawImgColumn2(pContext, g_pucImage, uiColIdx, sRect.sYMin, sRect.sYMax);
-				}
-
-				//
-				// If gravity droves the last maximum below the current value,
-				// then current value is new maximum
-				//
-				if(g_pucGravity[ulIdx] > LEDDisplayMaxes[ulIdx])
-				{
-					LEDDisplayMaxes[ulIdx] = LEDDisplay[ulIdx];
-				}
-				else
-				{
-					//
-					// apply gravity to the raindrop
-					//
-					LEDDisplayMaxes[ulIdx] -= g_pucGravity[ulIdx];
-					g_pucGravity[ulIdx]++;
-				}
-			}
-
-			//
-			// Draw the raindrop
-			//
-			if((LEDDisplayMaxes[ulIdx] > RAIN_HEIGHT) &&
-			   (LEDDisplayMaxes[ulIdx] > LEDDisplay[ulIdx]))
-			{
-				sRect.sYMax = Ymax - LEDDisplayMaxes[ulIdx] + RAIN_HEIGHT;
-				sRect.sYMin = Ymax - LEDDisplayMaxes[ulIdx];
-				ulColor = ClrLightGrey;
-				GrContextForegroundSet(pContext, ulColor);
-				GrRectFill(pContext, &sRect);
-			}
-    	}
-    	sRect.sXMin += width;
-    	sRect.sXMax += width;
-    	pucPrevHeight[ulIdx] = LEDDisplay[ulIdx];
-    }
+	tSavedConfig sConfig;
+	tSavedOptions sOptions;
+	tStorePart psParts[2];
+
+	sConfig.ulSamplingFreq = g_plSliderVal[FSAMP_SLIDER];
+	sConfig.ulMinDisplayFreq = g_plSliderVal[FMIN_DISP_SLIDER];
+	sConfig.ulMaxDisplayFreq = g_plSliderVal[FMAX_DISP_SLIDER];
+	sConfig.ulNumBars = g_plSliderVal[NUMBARS_SLIDER];
+	sConfig.ucDispRain = g_ucDispRain;
+	sConfig.ucTunerMode = g_ucTunerMode;
+	sConfig.ucWaterfall = g_ucWaterfall;
+	sConfig.ucReserved = 0;
+	OptionsGet(&sOptions);
+
+	psParts[0].pvData = &sConfig;
+	psParts[0].ulLength = sizeof(sConfig);
+	psParts[1].pvData = &sOptions;
+	psParts[1].ulLength = sizeof(sOptions);
+	if(StoreWrite(STORE_TAG_CONFIG_2, psParts, 2))
+	{
+		UARTprintf("Settings not saved\n");
+	}
 }
 
 //*****************************************************************************
 //
-// Update the global configurable variables based on the slider values
+// Update the global configurable variables based on the slider values and
+// the options
 //
 //*****************************************************************************
 void
@@ -661,9 +1906,27 @@ UpdateGConfigs(void)
 	g_uiMaxDisplayFreq = g_plSliderVal[FMAX_DISP_SLIDER];
 	g_uiSamplingFreq = g_plSliderVal[FSAMP_SLIDER];
 	g_uiNumDisplayBars = g_plSliderVal[NUMBARS_SLIDER];
+	g_ucWindowType = g_plChoiceVal[CHOICE_WINDOW];
+	g_ucAvgMode = g_plChoiceVal[CHOICE_AVG_MODE];
+	g_ucAvgFrames = g_plChoiceVal[CHOICE_AVG_FRAMES];
+	g_ucWeighting = g_plChoiceVal[CHOICE_WEIGHTING];
+	g_ucBarScale = g_plChoiceVal[CHOICE_BAR_SCALE];
+	g_cDbFloor = g_plChoiceVal[CHOICE_DB_FLOOR];
+	g_cDbCeiling = g_plChoiceVal[CHOICE_DB_CEILING];
+	g_ucBarPalette = g_plChoiceVal[CHOICE_BAR_PALETTE];
+
+	//
+	// OnEqPaint only switches renderers on a fresh display, so this is
+	// picked up by the one drawn once the config pages have been left
+	//
+	g_ucRenderer = g_plChoiceVal[CHOICE_RENDERER];
+
+	DSPReconfigure();
 
-	InitSamplingTimer();
-	InitDSP();
+	//
+	// Color the bars as they are now laid out, in the palette chosen
+	//
+	ColorsUpdate(g_uiNumDisplayBars);
 }
 
 //*****************************************************************************
@@ -716,6 +1979,44 @@ OnCheckChange(tWidget *pWidget, unsigned long bSelected)
         WidgetPaint((tWidget *)(g_psCheckBoxIndicators + CHECK_DEBUG));
         WidgetPaint((tWidget *)(g_psCheckBoxIndicators + CHECK_VERBOSE));
     }
+    else if(pWidget == (tWidget *)(g_psCheckBoxes+CHECK_TUNER))
+    {
+    	//
+    	// Handle the "tuner mode" checkbox
+    	//
+        if(bSelected)
+        {
+        	g_ucTunerMode = 1;
+        	CanvasImageSet(g_psCheckBoxIndicators + CHECK_TUNER,
+        			       g_pucLightOn);
+        }
+        else
+        {
+        	g_ucTunerMode = 0;
+        	CanvasImageSet(g_psCheckBoxIndicators + CHECK_TUNER,
+        				   g_pucLightOff);
+        }
+        WidgetPaint((tWidget *)(g_psCheckBoxIndicators + CHECK_TUNER));
+    }
+    else if(pWidget == (tWidget *)(g_psCheckBoxes+CHECK_WATERFALL))
+    {
+    	//
+    	// Handle the "waterfall display" checkbox
+    	//
+        if(bSelected)
+        {
+        	g_ucWaterfall = 1;
+        	CanvasImageSet(g_psCheckBoxIndicators + CHECK_WATERFALL,
+        			       g_pucLightOn);
+        }
+        else
+        {
+        	g_ucWaterfall = 0;
+        	CanvasImageSet(g_psCheckBoxIndicators + CHECK_WATERFALL,
+        				   g_pucLightOff);
+        }
+        WidgetPaint((tWidget *)(g_psCheckBoxIndicators + CHECK_WATERFALL));
+    }
     else
     {
     	//
@@ -748,6 +2049,7 @@ OnCheckChange(tWidget *pWidget, unsigned long bSelected)
 static void
 OnConfigPress(tWidget *pWidget)
 {
+	unsigned long ulSlider;
 
 	if(g_ucCfgDisplay == 0)
 	{
@@ -757,10 +2059,16 @@ OnConfigPress(tWidget *pWidget)
 		//
 
 		//
-		// redraw the background image, which will erase the title text for the
-		// last page
+		// Stop the waterfall's hardware scrolling, if it was on, so the config
+		// screens are drawn where they should be
 		//
-		GrImageDraw(&sContext, g_pucImage, 0, 0);
+		Kentec320x240x16_SSD2119ScrollDisable();
+
+		//
+		// Put the background back over the title bar, and anything else the
+		// display drew outside of where the config page goes
+		//
+		CoverRestore(&g_psPanelCfg1.sBase.sPosition);
 		UARTprintf("\nDisplay off, show cfg1\n");
 
 		//
@@ -780,10 +2088,8 @@ OnConfigPress(tWidget *pWidget)
 		//
 		WidgetAdd(WIDGET_ROOT, (tWidget *)&g_psPanelCfg1);
 		WidgetPaint(WIDGET_ROOT);
-		GrContextFontSet(&sContext, &g_sFontCm16);
-		GrContextForegroundSet(&sContext, ClrLightGrey);
-		GrStringDrawCentered(&sContext, "Configuration Page 1", 20,
-							 GrContextDpyWidthGet(&sContext) / 2, 10, 0);
+		CoverAdd(&g_psPanelCfg1.sBase.sPosition);
+		DrawTitle(&sContext, "Configuration Page 1");
 	}
 	else if(g_ucCfgDisplay == 1)
 	{
@@ -797,9 +2103,10 @@ OnConfigPress(tWidget *pWidget)
 		WidgetRemove((tWidget *)&g_psPanelCfg1);
 
 		//
-		// Draw the background image again, erasing the last title block
+		// Erase the last title block.  The second page fills the same part of
+		// the screen as the first, so that's all that needs putting back.
 		//
-		GrImageDraw(&sContext, g_pucImage, 0, 0);
+		CoverRestore(&g_psPanelCfg2.sBase.sPosition);
 		UARTprintf("\nCfg1 to Cfg 2\n");
 
 		//
@@ -807,10 +2114,12 @@ OnConfigPress(tWidget *pWidget)
 		//
 		WidgetAdd(WIDGET_ROOT, (tWidget *)&g_psPanelCfg2);
 		WidgetPaint(WIDGET_ROOT);
-		GrContextFontSet(&sContext, &g_sFontCm16);
-		GrContextForegroundSet(&sContext, ClrLightGrey);
-	    GrStringDrawCentered(&sContext, "Configuration Page 2", 20,
-	                         GrContextDpyWidthGet(&sContext) / 2, 10, 0);
+		for(ulSlider = FMAX_DISP_SLIDER; ulSlider <= NUMBARS_SLIDER; ulSlider++)
+		{
+			SliderDrawn(ulSlider);
+		}
+		CoverAdd(&g_psPanelCfg2.sBase.sPosition);
+		DrawTitle(&sContext, "Configuration Page 2");
 
 	    //
 	    // Update state
@@ -818,16 +2127,40 @@ OnConfigPress(tWidget *pWidget)
 		g_ucCfgDisplay = 2;
 	}
 	else if(g_ucCfgDisplay == 2)
+	{
+		//
+		// We were displaying config screen 2, now we display config screen 3
+		//
+		WidgetRemove((tWidget *)&g_psPanelCfg2);
+		CoverRestore(&g_psPanelCfg3.sBase.sPosition);
+		UARTprintf("\nCfg2 to Cfg 3\n");
+
+		//
+		// Add and paint the third config screen and its title block
+		//
+		WidgetAdd(WIDGET_ROOT, (tWidget *)&g_psPanelCfg3);
+		WidgetPaint(WIDGET_ROOT);
+		CoverAdd(&g_psPanelCfg3.sBase.sPosition);
+		DrawTitle(&sContext, "Configuration Page 3");
+
+	    //
+	    // Update state
+	    //
+		g_ucCfgDisplay = 3;
+	}
+	else if(g_ucCfgDisplay == 3)
 	{
 		//
 		// Go back to displaying bars
 		//
-		UARTprintf("Cfg2 to Display on, save changes\n");
+		UARTprintf("Cfg3 to Display on, save changes\n");
 
 		//
-		// Remove the old config screen
+		// Remove the old config screen, and keep what the config screens
+		// were set to for the next reset
 		//
-		WidgetRemove((tWidget *)&g_psPanelCfg2);
+		WidgetRemove((tWidget *)&g_psPanelCfg3);
+		ConfigSave();
 
 		//
 		// update states
@@ -916,7 +2249,7 @@ OnButtonPress(tWidget *pWidget)
 						  g_pcSliderText[FMAX_DISP_SLIDER]);
 			SliderValueSet(&g_psSliders[FMAX_DISP_SLIDER],
 							g_plSliderVal[FMIN_DISP_SLIDER]+1);
-			WidgetPaint((tWidget *)&g_psSliders[FMAX_DISP_SLIDER]);
+			SliderPaintChange(FMAX_DISP_SLIDER);
 		}
 		else
 		{
@@ -934,7 +2267,7 @@ OnButtonPress(tWidget *pWidget)
 						  g_pcSliderText[FMAX_DISP_SLIDER]);
 			SliderValueSet(&g_psSliders[FMAX_DISP_SLIDER],
 						   g_plSliderVal[FMAX_DISP_SLIDER]);
-			WidgetPaint((tWidget *)&g_psSliders[FMAX_DISP_SLIDER]);
+			SliderPaintChange(FMAX_DISP_SLIDER);
 		}
 	}
 	else if(pWidget == (tWidget *)&g_psPushButtons[2*FMAX_DISP_SLIDER+1])
@@ -953,7 +2286,7 @@ OnButtonPress(tWidget *pWidget)
 					  g_pcSliderText[FMAX_DISP_SLIDER]);
 		SliderValueSet(&g_psSliders[FMAX_DISP_SLIDER],
 					   g_plSliderVal[FMAX_DISP_SLIDER]);
-		WidgetPaint((tWidget *)&g_psSliders[FMAX_DISP_SLIDER]);
+		SliderPaintChange(FMAX_DISP_SLIDER);
 	}
 
 	//
@@ -974,7 +2307,7 @@ OnButtonPress(tWidget *pWidget)
 					  g_pcSliderText[FMIN_DISP_SLIDER]);
 		SliderValueSet(&g_psSliders[FMIN_DISP_SLIDER],
 					   g_plSliderVal[FMIN_DISP_SLIDER]);
-		WidgetPaint((tWidget *)&g_psSliders[FMIN_DISP_SLIDER]);
+		SliderPaintChange(FMIN_DISP_SLIDER);
 	}
 	else if(pWidget == (tWidget *)&g_psPushButtons[2*FMIN_DISP_SLIDER+1])
 	{
@@ -994,7 +2327,7 @@ OnButtonPress(tWidget *pWidget)
 						  g_pcSliderText[FMIN_DISP_SLIDER]);
 			SliderValueSet(&g_psSliders[FMIN_DISP_SLIDER],
 							g_plSliderVal[FMAX_DISP_SLIDER]-1);
-			WidgetPaint((tWidget *)&g_psSliders[FMIN_DISP_SLIDER]);
+			SliderPaintChange(FMIN_DISP_SLIDER);
 		}
 		else
 		{
@@ -1008,7 +2341,7 @@ OnButtonPress(tWidget *pWidget)
 						  g_pcSliderText[FMIN_DISP_SLIDER]);
 			SliderValueSet(&g_psSliders[FMIN_DISP_SLIDER],
 						   g_plSliderVal[FMIN_DISP_SLIDER]);
-			WidgetPaint((tWidget *)&g_psSliders[FMIN_DISP_SLIDER]);
+			SliderPaintChange(FMIN_DISP_SLIDER);
 		}
 	}
 
@@ -1032,7 +2365,7 @@ OnButtonPress(tWidget *pWidget)
 						  g_pcSliderText[FSAMP_SLIDER]);
 			SliderValueSet(&g_psSliders[FSAMP_SLIDER],
 						   2*g_plSliderVal[FMAX_DISP_SLIDER]);
-			WidgetPaint((tWidget *)&g_psSliders[FSAMP_SLIDER]);
+			SliderPaintChange(FSAMP_SLIDER);
 		}
 		else
 		{
@@ -1045,7 +2378,7 @@ OnButtonPress(tWidget *pWidget)
 					      g_pcSliderText[FSAMP_SLIDER]);
 			SliderValueSet(&g_psSliders[FSAMP_SLIDER],
 					       g_plSliderVal[FSAMP_SLIDER]);
-			WidgetPaint((tWidget *)&g_psSliders[FSAMP_SLIDER]);
+			SliderPaintChange(FSAMP_SLIDER);
 		}
 	}
 	else if(pWidget == (tWidget *)&g_psPushButtons[2*FSAMP_SLIDER+1])
@@ -1063,7 +2396,7 @@ OnButtonPress(tWidget *pWidget)
 					  g_pcSliderText[FSAMP_SLIDER]);
 		SliderValueSet(&g_psSliders[FSAMP_SLIDER],
 				       g_plSliderVal[FSAMP_SLIDER]);
-		WidgetPaint((tWidget *)&g_psSliders[FSAMP_SLIDER]);
+		SliderPaintChange(FSAMP_SLIDER);
 	}
 
 	if(pWidget == (tWidget *)&g_psPushButtons[2*NUMBARS_SLIDER])
@@ -1079,7 +2412,7 @@ OnButtonPress(tWidget *pWidget)
 				      g_pcSliderText[NUMBARS_SLIDER]);
 		SliderValueSet(&g_psSliders[NUMBARS_SLIDER],
 					   g_plSliderVal[NUMBARS_SLIDER]);
-		WidgetPaint((tWidget *)&g_psSliders[NUMBARS_SLIDER]);
+		SliderPaintChange(NUMBARS_SLIDER);
 	}
 	else if(pWidget == (tWidget *)&g_psPushButtons[2*NUMBARS_SLIDER+1])
 	{
@@ -1094,7 +2427,7 @@ OnButtonPress(tWidget *pWidget)
 					  g_pcSliderText[NUMBARS_SLIDER]);
 		SliderValueSet(&g_psSliders[NUMBARS_SLIDER],
 					   g_plSliderVal[NUMBARS_SLIDER]);
-		WidgetPaint((tWidget *)&g_psSliders[NUMBARS_SLIDER]);
+		SliderPaintChange(NUMBARS_SLIDER);
 	}
 }
 
@@ -1127,7 +2460,7 @@ OnSliderChange(tWidget *pWidget, long lValue)
 					 g_plSliderVal[FMAX_DISP_SLIDER]);
 			SliderTextSet(&g_psSliders[FMAX_DISP_SLIDER],
 					      g_pcSliderText[FMAX_DISP_SLIDER]);
-			WidgetPaint((tWidget *)&g_psSliders[FMAX_DISP_SLIDER]);
+			SliderPaintChange(FMAX_DISP_SLIDER);
     	}
     	else
     	{
@@ -1138,7 +2471,7 @@ OnSliderChange(tWidget *pWidget, long lValue)
 			usprintf(g_pcSliderText[FMAX_DISP_SLIDER], "%d", lValue);
 			SliderTextSet(&g_psSliders[FMAX_DISP_SLIDER],
 						  g_pcSliderText[FMAX_DISP_SLIDER]);
-			WidgetPaint((tWidget *)&g_psSliders[FMAX_DISP_SLIDER]);
+			SliderPaintChange(FMAX_DISP_SLIDER);
     	}
 	}
     if(pWidget == (tWidget *)&g_psSliders[FMIN_DISP_SLIDER])
@@ -1156,7 +2489,7 @@ OnSliderChange(tWidget *pWidget, long lValue)
 					 g_plSliderVal[FMIN_DISP_SLIDER]);
 			SliderTextSet(&g_psSliders[FMIN_DISP_SLIDER],
 						  g_pcSliderText[FMIN_DISP_SLIDER]);
-			WidgetPaint((tWidget *)&g_psSliders[FMIN_DISP_SLIDER]);
+			SliderPaintChange(FMIN_DISP_SLIDER);
 		}
 		else
 		{
@@ -1167,7 +2500,7 @@ OnSliderChange(tWidget *pWidget, long lValue)
 			usprintf(g_pcSliderText[FMIN_DISP_SLIDER], "%d", lValue);
 			SliderTextSet(&g_psSliders[FMIN_DISP_SLIDER],
 						  g_pcSliderText[FMIN_DISP_SLIDER]);
-			WidgetPaint((tWidget *)&g_psSliders[FMIN_DISP_SLIDER]);
+			SliderPaintChange(FMIN_DISP_SLIDER);
 		}
 	}
     if(pWidget == (tWidget *)&g_psSliders[FSAMP_SLIDER])
@@ -1184,7 +2517,7 @@ OnSliderChange(tWidget *pWidget, long lValue)
     				 2*g_plSliderVal[FMAX_DISP_SLIDER]);
     		SliderTextSet(&g_psSliders[FSAMP_SLIDER],
     					  g_pcSliderText[FSAMP_SLIDER]);
-    		WidgetPaint((tWidget *)&g_psSliders[FSAMP_SLIDER]);
+    		SliderPaintChange(FSAMP_SLIDER);
     	}
     	else
     	{
@@ -1194,7 +2527,7 @@ OnSliderChange(tWidget *pWidget, long lValue)
 			usprintf(g_pcSliderText[FSAMP_SLIDER], "%d", lValue);
 			SliderTextSet(&g_psSliders[FSAMP_SLIDER],
 					      g_pcSliderText[FSAMP_SLIDER]);
-			WidgetPaint((tWidget *)&g_psSliders[FSAMP_SLIDER]);
+			SliderPaintChange(FSAMP_SLIDER);
     	}
 
     	//
@@ -1203,7 +2536,7 @@ OnSliderChange(tWidget *pWidget, long lValue)
     	//
     	SliderRangeSet(&g_psSliders[FMAX_DISP_SLIDER], MIN_DISPLAY_U_FREQ,
     			       g_plSliderVal[FSAMP_SLIDER]/2);
-    	WidgetPaint((tWidget *)&g_psSliders[FMAX_DISP_SLIDER]);
+    	SliderPaintChange(FMAX_DISP_SLIDER);
 	}
     if(pWidget == (tWidget *)&g_psSliders[NUMBARS_SLIDER])
 	{
@@ -1214,8 +2547,104 @@ OnSliderChange(tWidget *pWidget, long lValue)
 		usprintf(g_pcSliderText[NUMBARS_SLIDER], "%d", lValue);
 		SliderTextSet(&g_psSliders[NUMBARS_SLIDER],
 				      g_pcSliderText[NUMBARS_SLIDER]);
-		WidgetPaint((tWidget *)&g_psSliders[NUMBARS_SLIDER]);
+		SliderPaintChange(NUMBARS_SLIDER);
+	}
+}
+
+//*****************************************************************************
+//
+// Function handler for one of the option buttons on the third config page
+// being pressed.  Each press steps the option on to its next value, going
+// back to the first after the last.
+//
+//*****************************************************************************
+static void
+OnChoicePress(tWidget *pWidget)
+{
+	unsigned long ulChoice;
+	long lValue;
+
+	ulChoice = (tPushButtonWidget *)pWidget - g_psChoiceButtons;
+	lValue = g_plChoiceVal[ulChoice];
+
+	if(ulChoice == CHOICE_WINDOW)
+	{
+		//
+		// Step through the windows
+		//
+		lValue = (lValue + 1) % NUM_WINDOWS;
+	}
+	else if(ulChoice == CHOICE_AVG_MODE)
+	{
+		//
+		// Step from off to EMA to boxcar.  DSPReconfigure starts the average
+		// over when the mode or the number of frames changes.
+		//
+		lValue = (lValue + 1) % (AVG_MODE_BOXCAR + 1);
+	}
+	else if(ulChoice == CHOICE_AVG_FRAMES)
+	{
+		//
+		// Double the number of frames averaged, up to MAX_AVG_FRAMES
+		//
+		lValue = (lValue < MAX_AVG_FRAMES) ? (lValue * 2) : MIN_AVG_FRAMES;
+	}
+	else if(ulChoice == CHOICE_WEIGHTING)
+	{
+		//
+		// Step from Z to A to C.  DSPReconfigure lays the bars out again,
+		// which works out their weighting gains.
+		//
+		lValue = (lValue + 1) % (WEIGHTING_C + 1);
+	}
+	else if(ulChoice == CHOICE_BAR_SCALE)
+	{
+		//
+		// Switch between linear and dB bars
+		//
+		lValue = (lValue + 1) % (BAR_SCALE_DB + 1);
+	}
+	else if(ulChoice == CHOICE_DB_FLOOR)
+	{
+		//
+		// Lower the floor, going back up to just under the ceiling once it
+		// has been as low as it goes
+		//
+		lValue -= DB_STEP;
+		if(lValue < MIN_DB_FLOOR)
+		{
+			lValue = g_plChoiceVal[CHOICE_DB_CEILING] - DB_STEP;
+		}
+	}
+	else if(ulChoice == CHOICE_DB_CEILING)
+	{
+		//
+		// Lower the ceiling, going back up to the top once it has come down
+		// to just over the floor
+		//
+		lValue -= DB_STEP;
+		if(lValue <= g_plChoiceVal[CHOICE_DB_FLOOR])
+		{
+			lValue = MAX_DB_CEILING;
+		}
+	}
+	else if(ulChoice == CHOICE_BAR_PALETTE)
+	{
+		//
+		// Step through the palettes
+		//
+		lValue = (lValue + 1) % NUM_BAR_PALETTES;
+	}
+	else if(ulChoice == CHOICE_RENDERER)
+	{
+		//
+		// Step through the renderers
+		//
+		lValue = (lValue + 1) % NUM_RENDERERS;
 	}
+
+	ChoiceSet(ulChoice, lValue);
+	WidgetPaint(pWidget);
 }
 
 //*****************************************************************************
@@ -1228,29 +2657,110 @@ OnSliderChange(tWidget *pWidget, long lValue)
 //
 // Function used to update the display, if necessary.
 //
+// The bars may take more than one call to draw, in which case the refresh is
+// left pending and the rest of them are drawn on the next trip around the
+// main loop.  Once the display is up to date, the refresh timer is started
+// again, for a period PAINT_SHARE - 1 times as long as the bars took to draw.
+//
 //*****************************************************************************
 void
 GUIUpdateDisplay(void)
 {
+	static unsigned char ucRedrawn = 0;
+	unsigned long ulPeriod;
+
 	if(g_ucDispRefresh)
 	{
 		if(g_ucDispRefresh == 2)
 		{
-			GrImageDraw(&sContext, g_pucImage, 0, 0);
+			//
+			// Only restore the background once, even if the bars take a few
+			// calls to draw over it.  The waterfall clears all of the screen
+			// it uses, so it only needs the background put back outside of
+			// that.
+			//
+			g_ucDispRefresh = 1;
+			ucRedrawn = 1;
 			UpdateGConfigs();
-			GrContextFontSet(&sContext, &g_sFontCm16);
-			GrContextForegroundSet(&sContext, ClrLightGrey);
-			GrStringDrawCentered(&sContext, "Frequency Analyzer", 19,
-								 GrContextDpyWidthGet(&sContext) / 2, 10, 0);
-			OnEqPaint(1, &sContext);
+			if(g_ucWaterfall)
+			{
+				CoverRestore(&g_sWaterfallArea);
+				OnWaterfallPaint(1, &sContext);
+			}
+			else
+			{
+				CoverRestore(0);
+				if(!g_ucTunerMode)
+				{
+					DrawTitle(&sContext, "Frequency Analyzer");
+				}
+				OnEqPaint(1, &sContext);
+			}
+			CoverDisplay();
+		}
+		if(g_ucWaterfall)
+		{
+			//
+			// The waterfall scrolls through where the title bar would be, so
+			// the tuner readout only goes out over the UART in this mode
+			//
+			OnWaterfallPaint(0, &sContext);
+		}
+		else
+		{
+			if(!OnEqPaint(0, &sContext))
+			{
+				return;
+			}
+			if(g_ucTunerMode && DrawTunerReadout(&sContext))
+			{
+				ucRedrawn = 1;
+			}
+			if(g_ucShowLatency)
+			{
+				DrawLatencyReadout(&sContext, ucRedrawn);
+			}
 		}
-		OnEqPaint(0, &sContext);
 		g_ucFramesPerSec++;
 		g_ucDispRefresh = 0;
+		ucRedrawn = 0;
+
+		//
+		// A waterfall row is cheap, so it always goes at the fastest rate
+		//
+		ulPeriod = g_ucWaterfall ? 0 : g_ulPaintCycles * (PAINT_SHARE - 1);
+		if(ulPeriod < SysCtlClockGet() / MAX_REFRESH_RATE)
+		{
+			ulPeriod = SysCtlClockGet() / MAX_REFRESH_RATE;
+		}
+		if(ulPeriod > SysCtlClockGet() / MIN_REFRESH_RATE)
+		{
+			ulPeriod = SysCtlClockGet() / MIN_REFRESH_RATE;
+		}
+		TimerLoadSet(TIMER3_BASE, TIMER_A, ulPeriod);
 		TimerEnable(TIMER3_BASE, TIMER_A);
 	}
 }
 
+//*****************************************************************************
+//
+// Make the frame the DSP code has just filled in the one the display draws.
+//
+// The display only ever follows g_psBarFrame, so the single store that moves
+// it over is what publishes the frame; there is no point at which the
+// display can see a frame that is partly written.
+//
+//*****************************************************************************
+void
+GUIPublishFrame(void)
+{
+	tBarFrame *psFrame;
+
+	psFrame = g_psBarFrame;
+	g_psBarFrame = g_psBarFrameNext;
+	g_psBarFrameNext = psFrame;
+}
+
 //*****************************************************************************
 //
 // Function used to update a slider value.
@@ -1275,8 +2785,6 @@ GUIUpdateSlider(int iSliderNum, int iSliderVal)
 void
 GUIinit(void)
 {
-	int i;
-
 	InitDisplayTimer();
 
     //
@@ -1293,33 +2801,69 @@ GUIinit(void)
     WidgetRemove((tWidget *)&g_psPanelCfg1);
     WidgetAdd(WIDGET_ROOT, (tWidget *)&g_psPanelCfg2);
     WidgetRemove((tWidget *)&g_psPanelCfg2);
+    WidgetAdd(WIDGET_ROOT, (tWidget *)&g_psPanelCfg3);
+    WidgetRemove((tWidget *)&g_psPanelCfg3);
 
-	GrImageDraw(&sContext, g_pucImage, 0, 0);
-	GrContextFontSet(&sContext, &g_sFontCm16);
-	GrContextForegroundSet(&sContext, ClrLightGrey);
-	GrStringDrawCentered(&sContext, "Frequency Analyzer", 19,
-						 GrContextDpyWidthGet(&sContext) / 2, 10, 0);
+	DrawBackground();
+	DrawTitle(&sContext, "Frequency Analyzer");
 
+	//
+	// Touches go through the pointer coalescer, so that a drag hands the
+	// widgets no more than one move per display frame
+	//
 	TouchScreenInit();
-	TouchScreenCallbackSet(WidgetPointerMessage);
+	PointerInit(WidgetPointerMessage, SysCtlClockGet() / MAX_REFRESH_RATE);
+	TouchScreenCallbackSet(PointerMessage);
 
 	WidgetAdd(WIDGET_ROOT, (tWidget *)&g_sCfgButton);
 
 	g_ucDispRain = 0;
 	g_ucPrintDbg = 0;
+	g_ucTunerMode = INIT_TUNER_MODE;
+	g_ucWaterfall = INIT_WATERFALL;
 	g_ucDisplayRain = INIT_DISPLAY_RAIN;
 	g_uiSamplingFreq = INIT_SAMPLING_FREQ;
 	g_uiMinDisplayFreq = INIT_DISPLAY_L_FREQ;
 	g_uiMaxDisplayFreq = INIT_DISPLAY_U_FREQ;
 	g_uiNumDisplayBars = INIT_NUMBARS;
+	g_ucWindowType = INIT_WINDOW_TYPE;
+	g_ucAvgMode = INIT_AVG_MODE;
+	g_ucAvgFrames = INIT_AVG_FRAMES;
+	g_ucWeighting = INIT_WEIGHTING;
+	g_ucEngine = INIT_ENGINE;
+	g_ucOctaveFraction = INIT_OCTAVE_FRACTION;
+	g_ucZoom = INIT_ZOOM;
+	g_ucSilenceThreshold = INIT_SILENCE_THRESHOLD;
+	g_ucBarHeight = INIT_BAR_HEIGHT;
+	g_ucShowLatency = INIT_SHOW_LATENCY;
+	g_ucBarScale = INIT_BAR_SCALE;
+	g_ucBarPalette = INIT_BAR_PALETTE;
+	g_ucRenderer = INIT_RENDERER;
+	g_cDbFloor = INIT_DB_FLOOR;
+	g_cDbCeiling = INIT_DB_CEILING;
 	g_plSliderVal[FMIN_DISP_SLIDER] = g_uiMinDisplayFreq;
 	g_plSliderVal[FMAX_DISP_SLIDER] = g_uiMaxDisplayFreq;
 	g_plSliderVal[FSAMP_SLIDER] = g_uiSamplingFreq;
 	g_plSliderVal[NUMBARS_SLIDER] = g_uiNumDisplayBars;
+	ChoiceSet(CHOICE_WINDOW, g_ucWindowType);
+	ChoiceSet(CHOICE_AVG_MODE, g_ucAvgMode);
+	ChoiceSet(CHOICE_AVG_FRAMES, g_ucAvgFrames);
+	ChoiceSet(CHOICE_WEIGHTING, g_ucWeighting);
+	ChoiceSet(CHOICE_BAR_SCALE, g_ucBarScale);
+	ChoiceSet(CHOICE_DB_FLOOR, g_cDbFloor);
+	ChoiceSet(CHOICE_DB_CEILING, g_cDbCeiling);
+	ChoiceSet(CHOICE_BAR_PALETTE, g_ucBarPalette);
+	ChoiceSet(CHOICE_RENDERER, g_ucRenderer);
 
+	//
+	// Start from the settings the config pages were last left on, if they
+	// were saved
+	//
+	ConfigLoad();
 
-	for(i=0;i<g_uiNumDisplayBars;i++)
+	if(g_ucWaterfall)
 	{
-		g_pucGravity[i] = 0;
+		OnWaterfallPaint(1, &sContext);
 	}
+	CoverDisplay();
 }
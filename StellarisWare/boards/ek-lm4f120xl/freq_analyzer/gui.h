@@ -43,20 +43,72 @@ extern "C"
 //
 #define MAX_NUMBARS				300
 
+//*****************************************************************************
+//
+// One frame of bar heights, as handed from the DSP code to the display.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The number of the frame, from g_ulFrameCount.  The display doesn't
+	// draw the same frame twice.
+	//
+	unsigned long ulSequence;
+
+	//
+	// The configuration the frame was calculated for, from g_ulConfigEpoch.
+	// A frame from an older configuration may have a different number of
+	// bars, so it isn't drawn.
+	//
+	unsigned long ulEpoch;
+
+	//
+	// The latency timestamp of when the newest samples the frame was
+	// calculated from landed.
+	//
+	unsigned long ulCaptureTime;
+
+	//
+	// The number of bars, and the height of each in pixels.
+	//
+	unsigned int uiNumBars;
+	unsigned char pucHeights[MAX_NUMBARS];
+}
+tBarFrame;
 
 //*****************************************************************************
 //
 // global variables
 //
 //*****************************************************************************
-extern unsigned char LEDDisplay[MAX_NUMBARS];
+extern tBarFrame *g_psBarFrame;
+extern tBarFrame *g_psBarFrameNext;
 extern unsigned int  LEDFreqBreakpoints[MAX_NUMBARS + 1];
-extern unsigned char LEDDisplayMaxes[MAX_NUMBARS];
+extern unsigned long g_ulPaintCycles;
 extern unsigned char g_ucPrintDbg;
+extern unsigned char g_ucTunerMode;
+extern unsigned char g_ucWaterfall;
 extern unsigned int g_uiNumDisplayBars;
 extern unsigned int g_uiMinDisplayFreq;
 extern unsigned int g_uiMaxDisplayFreq;
 extern unsigned int g_uiSamplingFreq;
+extern unsigned char g_ucWindowType;
+extern unsigned char g_ucAvgMode;
+extern unsigned char g_ucAvgFrames;
+extern unsigned char g_ucWeighting;
+extern unsigned char g_ucEngine;
+extern unsigned char g_ucOctaveFraction;
+extern unsigned char g_ucZoom;
+extern unsigned char g_ucSilenceThreshold;
+extern unsigned char g_ucBarHeight;
+extern unsigned char g_ucShowLatency;
+extern unsigned char g_ucBarScale;
+extern unsigned char g_ucBarPalette;
+extern unsigned char g_ucRenderer;
+extern unsigned char g_ucDispRain;
+extern signed char g_cDbFloor;
+extern signed char g_cDbCeiling;
 
 //*****************************************************************************
 //
@@ -66,6 +118,7 @@ extern unsigned int g_uiSamplingFreq;
 extern void GUIinit(void);
 extern void GUIUpdateDisplay(void);
 extern void GUIUpdateSlider(int iSliderNum, int iSliderVal);
+extern void GUIPublishFrame(void);
 
 //*****************************************************************************
 //
@@ -24,6 +24,5 @@ extern const unsigned char g_pucRedSlider195x37[];
 extern const unsigned char g_pucGreenSlider195x37[];
 extern const unsigned char g_pucGettingHotter28x148[];
 extern const unsigned char g_pucGettingHotter28x148Mono[];
-extern const unsigned char g_pucImage[];
 
 #endif // __IMAGES_H__
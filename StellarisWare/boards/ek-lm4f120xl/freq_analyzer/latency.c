@@ -0,0 +1,367 @@
+//*****************************************************************************
+//
+// latency.c - Measures the latency from sample capture to the bars being
+// drawn.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#ifndef HOST_BUILD
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "utils/uartstdio.h"
+#else
+#include <stdarg.h>
+#include <stdio.h>
+#define UARTprintf				HostPrintf
+#endif
+
+#include "gui.h"
+#include "latency.h"
+
+//*****************************************************************************
+//
+// Private predefines and variables
+//
+//*****************************************************************************
+
+//
+// The timer the timestamps are taken from.  One half of a wide timer is run
+// as a free running 32 bit down counter at the system clock, which at 80 MHz
+// wraps every 53 seconds; far longer than any frame should take to get from
+// the ADC to the screen.
+//
+#define LATENCY_TIMER_PERIPH	SYSCTL_PERIPH_WTIMER5
+#define LATENCY_TIMER_BASE		WTIMER5_BASE
+
+//
+// The number of timestamp ticks in a microsecond
+//
+static unsigned long g_ulTicksPerUs;
+
+//
+// The histogram of latencies recorded in the current interval, and the
+// extremes and count of them
+//
+static unsigned short g_pusHistogram[LATENCY_NUM_BUCKETS];
+static unsigned long g_ulCount;
+static unsigned long g_ulMin;
+static unsigned long g_ulMax;
+
+#ifdef HOST_BUILD
+//
+// The virtual clock a host build takes its timestamps from, in microseconds
+//
+static unsigned long g_ulVirtualClock;
+#endif
+
+//*****************************************************************************
+//
+// Public global variables
+//
+//*****************************************************************************
+
+//
+// The summary of the last complete reporting interval
+//
+tLatencyStats g_sLatencyStats;
+
+//*****************************************************************************
+//
+// Private Functions
+//
+//*****************************************************************************
+
+#ifdef HOST_BUILD
+//*****************************************************************************
+//
+// Print to stdout with the format UARTprintf takes, for host builds.
+//
+// UARTprintf reads every argument but a string as an unsigned long, which is
+// what the reports here pass, and takes %d, %u, %x and %X without a length
+// modifier.  On a host where unsigned long is wider than int, printf would
+// need %ld for those, so each conversion is handed to printf on its own with
+// the modifier added.
+//
+// param pcString: the format, as for UARTprintf
+//
+//*****************************************************************************
+static void
+HostPrintf(const char *pcString, ...)
+{
+	va_list vaArgP;
+	char pcSpec[16];
+	unsigned long ulLen;
+
+	va_start(vaArgP, pcString);
+	while(*pcString)
+	{
+		if(*pcString != '%')
+		{
+			putchar(*pcString++);
+			continue;
+		}
+
+		//
+		// Copy the conversion up to its type, leaving room for the modifier
+		//
+		ulLen = 0;
+		pcSpec[ulLen++] = *pcString++;
+		while(((*pcString >= '0') && (*pcString <= '9')) &&
+			  (ulLen < (sizeof(pcSpec) - 3)))
+		{
+			pcSpec[ulLen++] = *pcString++;
+		}
+
+		switch(*pcString)
+		{
+			case 'd':
+			case 'u':
+			case 'x':
+			case 'X':
+			{
+				pcSpec[ulLen++] = 'l';
+				pcSpec[ulLen++] = *pcString;
+				pcSpec[ulLen] = 0;
+				if(*pcString == 'd')
+				{
+					printf(pcSpec, (long)va_arg(vaArgP, unsigned long));
+				}
+				else
+				{
+					printf(pcSpec, va_arg(vaArgP, unsigned long));
+				}
+				break;
+			}
+			case 'c':
+			{
+				putchar((int)va_arg(vaArgP, unsigned long));
+				break;
+			}
+			case 's':
+			{
+				fputs(va_arg(vaArgP, const char *), stdout);
+				break;
+			}
+			case '%':
+			{
+				putchar('%');
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+		if(*pcString)
+		{
+			pcString++;
+		}
+	}
+	va_end(vaArgP);
+}
+#endif
+
+//*****************************************************************************
+//
+// Find the latency that a given share of the frames in the current interval
+// came in under.
+//
+// param ulPercent: the percentile to find
+//
+// return: the percentile, in microseconds, rounded up to the top of its
+//		   bucket but no more than the slowest frame.  A percentile in the
+//		   overflow bucket is given as the slowest frame.
+//
+//*****************************************************************************
+static unsigned long
+Percentile(unsigned long ulPercent)
+{
+	unsigned long ulTarget, ulSum, ulBucket, ulValue;
+
+	ulTarget = ((g_ulCount * ulPercent) + 99) / 100;
+	ulSum = 0;
+	for(ulBucket = 0; ulBucket < (LATENCY_NUM_BUCKETS - 1); ulBucket++)
+	{
+		ulSum += g_pusHistogram[ulBucket];
+		if(ulSum >= ulTarget)
+		{
+			break;
+		}
+	}
+
+	ulValue = (ulBucket + 1) * LATENCY_BUCKET_US;
+	if((ulBucket == (LATENCY_NUM_BUCKETS - 1)) || (ulValue > g_ulMax))
+	{
+		ulValue = g_ulMax;
+	}
+	return(ulValue);
+}
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Start the timestamp timer and clear the histogram.
+//
+//*****************************************************************************
+void
+LatencyInit(void)
+{
+	unsigned long ulBucket;
+
+#ifndef HOST_BUILD
+	SysCtlPeripheralEnable(LATENCY_TIMER_PERIPH);
+	TimerConfigure(LATENCY_TIMER_BASE,
+				   TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_PERIODIC);
+	TimerLoadSet(LATENCY_TIMER_BASE, TIMER_A, 0xffffffff);
+	TimerEnable(LATENCY_TIMER_BASE, TIMER_A);
+	g_ulTicksPerUs = SysCtlClockGet() / 1000000;
+#else
+	g_ulVirtualClock = 0;
+	g_ulTicksPerUs = 1;
+#endif
+
+	for(ulBucket = 0; ulBucket < LATENCY_NUM_BUCKETS; ulBucket++)
+	{
+		g_pusHistogram[ulBucket] = 0;
+	}
+	g_ulCount = 0;
+	g_sLatencyStats.ulCount = 0;
+	g_sLatencyStats.ulInterval = 0;
+}
+
+//*****************************************************************************
+//
+// Read the free running timestamp timer.  This is cheap enough to call from
+// an interrupt handler.
+//
+// return: the current time, in ticks that count up and wrap at 2^32
+//
+//*****************************************************************************
+unsigned long
+LatencyTimestamp(void)
+{
+#ifndef HOST_BUILD
+	//
+	// The timer counts down
+	//
+	return(0 - TimerValueGet(LATENCY_TIMER_BASE, TIMER_A));
+#else
+	return(g_ulVirtualClock);
+#endif
+}
+
+#ifdef HOST_BUILD
+//*****************************************************************************
+//
+// Move the virtual clock of a host build forward.
+//
+// param ulMicroseconds: how far to move it
+//
+//*****************************************************************************
+void
+LatencyClockAdvance(unsigned long ulMicroseconds)
+{
+	g_ulVirtualClock += ulMicroseconds;
+}
+#endif
+
+//*****************************************************************************
+//
+// Record that a frame has just finished being drawn.
+//
+// param ulCaptureTime: the timestamp taken when the newest samples the frame
+//		 was calculated from landed
+//
+//*****************************************************************************
+void
+LatencyRecord(unsigned long ulCaptureTime)
+{
+	unsigned long ulLatency, ulBucket;
+
+	ulLatency = (LatencyTimestamp() - ulCaptureTime) / g_ulTicksPerUs;
+
+	ulBucket = ulLatency / LATENCY_BUCKET_US;
+	if(ulBucket >= LATENCY_NUM_BUCKETS)
+	{
+		ulBucket = LATENCY_NUM_BUCKETS - 1;
+	}
+	g_pusHistogram[ulBucket]++;
+
+	if((g_ulCount == 0) || (ulLatency < g_ulMin))
+	{
+		g_ulMin = ulLatency;
+	}
+	if((g_ulCount == 0) || (ulLatency > g_ulMax))
+	{
+		g_ulMax = ulLatency;
+	}
+	g_ulCount++;
+}
+
+//*****************************************************************************
+//
+// Close the current reporting interval: summarize it into g_sLatencyStats,
+// print the summary if verbose debug is on, and start a new interval.  This
+// is meant to be called once a second.
+//
+//*****************************************************************************
+void
+LatencyReport(void)
+{
+	unsigned long ulBucket;
+
+	g_sLatencyStats.ulCount = g_ulCount;
+	if(g_ulCount)
+	{
+		g_sLatencyStats.ulMin = g_ulMin;
+		g_sLatencyStats.ulP50 = Percentile(50);
+		g_sLatencyStats.ulP99 = Percentile(99);
+		g_sLatencyStats.ulMax = g_ulMax;
+	}
+	g_sLatencyStats.ulInterval++;
+
+	if((g_ucPrintDbg & 2) && g_ulCount)
+	{
+		UARTprintf("\nLatency: %d frames, min %d  p50 %d  p99 %d  max %d us\n",
+				   g_sLatencyStats.ulCount, g_sLatencyStats.ulMin,
+				   g_sLatencyStats.ulP50, g_sLatencyStats.ulP99,
+				   g_sLatencyStats.ulMax);
+	}
+
+	for(ulBucket = 0; ulBucket < LATENCY_NUM_BUCKETS; ulBucket++)
+	{
+		g_pusHistogram[ulBucket] = 0;
+	}
+	g_ulCount = 0;
+}
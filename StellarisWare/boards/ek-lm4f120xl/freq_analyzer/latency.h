@@ -0,0 +1,95 @@
+//*****************************************************************************
+//
+// latency.h - Predefines, public functions, and globals for measuring the
+// latency from sample capture to the bars being drawn.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __LATENCY_H__
+#define __LATENCY_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The latency histogram: the width of each bucket in microseconds, and the
+// number of buckets.  The last bucket holds everything too slow for the
+// others.
+//
+#define LATENCY_BUCKET_US		2000
+#define LATENCY_NUM_BUCKETS		128
+
+//*****************************************************************************
+//
+// A summary of the latencies recorded over one reporting interval, in
+// microseconds.  The percentiles are rounded up to the top of the histogram
+// bucket they fall in.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The number of frames drawn in the interval.  The rest of the fields are
+	// only valid if this is nonzero.
+	//
+	unsigned long ulCount;
+
+	unsigned long ulMin;
+	unsigned long ulP50;
+	unsigned long ulP99;
+	unsigned long ulMax;
+
+	//
+	// The number of the interval, which goes up by one each time a new
+	// summary is made.
+	//
+	unsigned long ulInterval;
+}
+tLatencyStats;
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+extern tLatencyStats g_sLatencyStats;
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern void LatencyInit(void);
+extern unsigned long LatencyTimestamp(void);
+extern void LatencyRecord(unsigned long ulCaptureTime);
+extern void LatencyReport(void);
+#ifdef HOST_BUILD
+extern void LatencyClockAdvance(unsigned long ulMicroseconds);
+#endif
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __LATENCY_H__
@@ -1,6666 +0,0 @@
-#include "grlib/grlib.h"
-
-const unsigned char g_pucImage[] =
-{
-    IMAGE_FMT_8BPP_UNCOMP,
-    64, 1,
-    240, 0,
-
-    254,
-    0x73, 0x02, 0x00,
-    0x75, 0x00, 0x09,
-    0x6c, 0x00, 0x0d,
-    0x6e, 0x06, 0x01,
-    0x78, 0x07, 0x07,
-    0x6a, 0x09, 0x09,
-    0x77, 0x0c, 0x00,
-    0x72, 0x0e, 0x00,
-    0x73, 0x0a, 0x0c,
-    0x7b, 0x0f, 0x00,
-    0x76, 0x12, 0x01,
-    0x7c, 0x0a, 0x0f,
-    0x70, 0x13, 0x03,
-    0x7e, 0x12, 0x04,
-    0x76, 0x0d, 0x13,
-    0x70, 0x0f, 0x13,
-    0x7f, 0x16, 0x00,
-    0x79, 0x14, 0x09,
-    0x7c, 0x1a, 0x00,
-    0x79, 0x10, 0x18,
-    0x7c, 0x17, 0x11,
-    0x80, 0x1d, 0x05,
-    0x73, 0x1e, 0x08,
-    0x76, 0x18, 0x13,
-    0x79, 0x1e, 0x08,
-    0x76, 0x15, 0x1e,
-    0x7f, 0x25, 0x00,
-    0x72, 0x18, 0x20,
-    0x73, 0x1c, 0x18,
-    0x82, 0x1f, 0x0d,
-    0x7a, 0x1b, 0x19,
-    0x86, 0x25, 0x01,
-    0x82, 0x1b, 0x18,
-    0x6f, 0x1e, 0x1a,
-    0x4e, 0x2c, 0x0c,
-    0x5d, 0x21, 0x20,
-    0x4a, 0x2c, 0x13,
-    0x7d, 0x1e, 0x1e,
-    0x83, 0x28, 0x0a,
-    0x86, 0x2d, 0x00,
-    0x80, 0x23, 0x17,
-    0x74, 0x25, 0x18,
-    0x6d, 0x34, 0x00,
-    0x79, 0x21, 0x21,
-    0x67, 0x36, 0x00,
-    0x7e, 0x2a, 0x10,
-    0x7c, 0x26, 0x1a,
-    0x83, 0x30, 0x05,
-    0x67, 0x34, 0x09,
-    0x83, 0x26, 0x1c,
-    0x8b, 0x33, 0x00,
-    0x8a, 0x30, 0x07,
-    0x88, 0x36, 0x00,
-    0x78, 0x26, 0x26,
-    0x88, 0x2c, 0x15,
-    0x7e, 0x25, 0x27,
-    0x81, 0x2a, 0x21,
-    0x87, 0x29, 0x22,
-    0x86, 0x33, 0x0f,
-    0x64, 0x2e, 0x27,
-    0x84, 0x2f, 0x1a,
-    0x82, 0x28, 0x2c,
-    0x8d, 0x3a, 0x05,
-    0x7f, 0x31, 0x1c,
-    0x7e, 0x2d, 0x25,
-    0x8e, 0x3d, 0x00,
-    0x57, 0x38, 0x21,
-    0x8b, 0x36, 0x15,
-    0x85, 0x2e, 0x27,
-    0x8c, 0x41, 0x00,
-    0x7f, 0x2c, 0x2f,
-    0x88, 0x32, 0x20,
-    0x89, 0x3c, 0x0d,
-    0x67, 0x36, 0x26,
-    0x94, 0x42, 0x00,
-    0x7d, 0x31, 0x2d,
-    0x89, 0x30, 0x2b,
-    0x88, 0x39, 0x1c,
-    0x90, 0x44, 0x04,
-    0x84, 0x32, 0x2c,
-    0x8b, 0x45, 0x05,
-    0x91, 0x3d, 0x14,
-    0x86, 0x36, 0x26,
-    0x8c, 0x35, 0x26,
-    0x94, 0x49, 0x00,
-    0x79, 0x36, 0x32,
-    0x8e, 0x41, 0x18,
-    0x92, 0x4d, 0x00,
-    0x8c, 0x3d, 0x22,
-    0x65, 0x39, 0x3b,
-    0x99, 0x4e, 0x00,
-    0x8b, 0x44, 0x1b,
-    0x8b, 0x38, 0x34,
-    0x91, 0x43, 0x1d,
-    0x95, 0x48, 0x12,
-    0x8d, 0x3c, 0x2e,
-    0x90, 0x4a, 0x13,
-    0x87, 0x3b, 0x35,
-    0x87, 0x38, 0x3c,
-    0x8b, 0x42, 0x28,
-    0x91, 0x52, 0x07,
-    0x97, 0x51, 0x07,
-    0x91, 0x41, 0x29,
-    0x8a, 0x3f, 0x30,
-    0x7a, 0x4b, 0x1f,
-    0x99, 0x55, 0x00,
-    0x94, 0x46, 0x21,
-    0x77, 0x45, 0x2f,
-    0x8f, 0x48, 0x22,
-    0x87, 0x43, 0x2f,
-    0x9d, 0x58, 0x00,
-    0x6f, 0x42, 0x3d,
-    0x94, 0x4d, 0x1a,
-    0x6a, 0x4a, 0x31,
-    0x95, 0x45, 0x2f,
-    0x9a, 0x54, 0x10,
-    0x9b, 0x5c, 0x00,
-    0x90, 0x47, 0x2e,
-    0x8b, 0x51, 0x1d,
-    0x9b, 0x4e, 0x1e,
-    0x93, 0x4b, 0x27,
-    0x92, 0x51, 0x1f,
-    0xa1, 0x5c, 0x04,
-    0x91, 0x45, 0x38,
-    0x77, 0x4f, 0x30,
-    0x8a, 0x44, 0x3f,
-    0x69, 0x4e, 0x38,
-    0x98, 0x51, 0x21,
-    0x80, 0x46, 0x41,
-    0x97, 0x58, 0x17,
-    0xa6, 0x61, 0x00,
-    0x7e, 0x4a, 0x3c,
-    0x9d, 0x57, 0x18,
-    0x97, 0x4e, 0x2c,
-    0x92, 0x4f, 0x2c,
-    0x77, 0x4b, 0x3e,
-    0xa1, 0x63, 0x00,
-    0x96, 0x4c, 0x35,
-    0x91, 0x4c, 0x37,
-    0x9f, 0x60, 0x0f,
-    0xa4, 0x5f, 0x10,
-    0xab, 0x66, 0x00,
-    0x9b, 0x5b, 0x1e,
-    0x67, 0x51, 0x45,
-    0x9e, 0x56, 0x29,
-    0x99, 0x57, 0x29,
-    0xa7, 0x69, 0x03,
-    0x9d, 0x53, 0x33,
-    0xa2, 0x62, 0x16,
-    0xa3, 0x5c, 0x22,
-    0x99, 0x56, 0x34,
-    0x98, 0x50, 0x42,
-    0x9b, 0x61, 0x21,
-    0xa0, 0x5f, 0x25,
-    0x9a, 0x55, 0x3e,
-    0xaa, 0x64, 0x1c,
-    0xa5, 0x65, 0x1c,
-    0x9a, 0x5e, 0x30,
-    0x86, 0x60, 0x34,
-    0x9f, 0x5d, 0x31,
-    0x97, 0x5a, 0x3e,
-    0xa8, 0x61, 0x2a,
-    0xa2, 0x69, 0x1f,
-    0x77, 0x5d, 0x47,
-    0xa7, 0x6f, 0x12,
-    0xad, 0x6e, 0x13,
-    0x86, 0x5d, 0x43,
-    0x9f, 0x5c, 0x3c,
-    0x8b, 0x57, 0x4f,
-    0xa9, 0x69, 0x23,
-    0xa1, 0x66, 0x2d,
-    0xa7, 0x65, 0x2e,
-    0xa6, 0x63, 0x3a,
-    0xac, 0x6c, 0x28,
-    0xa8, 0x6e, 0x28,
-    0xa3, 0x66, 0x3a,
-    0xb2, 0x73, 0x1f,
-    0xa1, 0x63, 0x46,
-    0xa1, 0x6d, 0x33,
-    0x9a, 0x5b, 0x5b,
-    0xa7, 0x6c, 0x35,
-    0x91, 0x6c, 0x3f,
-    0xaf, 0x76, 0x21,
-    0x90, 0x66, 0x4f,
-    0xb2, 0x71, 0x34,
-    0x86, 0x6b, 0x51,
-    0xae, 0x74, 0x31,
-    0x97, 0x64, 0x5c,
-    0xad, 0x71, 0x3d,
-    0x9b, 0x76, 0x4c,
-    0xab, 0x74, 0x4d,
-    0xb1, 0x7c, 0x3d,
-    0xb7, 0x7c, 0x3c,
-    0x81, 0x7d, 0x53,
-    0x9f, 0x6f, 0x68,
-    0xaa, 0x6f, 0x69,
-    0xae, 0x7d, 0x4e,
-    0x9e, 0x7f, 0x55,
-    0xa4, 0x78, 0x63,
-    0x8c, 0x7a, 0x6b,
-    0xaf, 0x7c, 0x5b,
-    0x9c, 0x7c, 0x62,
-    0x9b, 0x77, 0x6d,
-    0xa7, 0x81, 0x56,
-    0x96, 0x7f, 0x6b,
-    0xb6, 0x76, 0x79,
-    0xb4, 0x78, 0x76,
-    0xb5, 0x7d, 0x72,
-    0xae, 0x7c, 0x78,
-    0xa0, 0x88, 0x75,
-    0xb5, 0x92, 0x5a,
-    0xb8, 0x80, 0x81,
-    0xb8, 0x83, 0x7d,
-    0xb4, 0x8f, 0x67,
-    0x9d, 0x8a, 0x7b,
-    0xba, 0x88, 0x79,
-    0xb1, 0x8e, 0x75,
-    0xba, 0x8f, 0x72,
-    0xb7, 0x88, 0x88,
-    0xb2, 0x8c, 0x84,
-    0xb9, 0x8d, 0x82,
-    0xc2, 0x99, 0x7b,
-    0xb4, 0x9d, 0x7d,
-    0xc7, 0xa1, 0x72,
-    0xc0, 0x97, 0x8c,
-    0xac, 0x9b, 0x8d,
-    0xc3, 0xa2, 0x79,
-    0xbf, 0x9d, 0x85,
-    0xb5, 0x9d, 0x8a,
-    0xcc, 0xa3, 0x83,
-    0xce, 0xa5, 0x85,
-    0xce, 0xad, 0x7c,
-    0xcd, 0xaa, 0x85,
-    0xcd, 0xa9, 0x8e,
-    0xbd, 0xad, 0x9f,
-    0xd3, 0xaf, 0x93,
-    0xd0, 0xb2, 0x9a,
-    0xd6, 0xb7, 0x9f,
-    0xcb, 0xb8, 0xa8,
-    0xc5, 0xb8, 0xac,
-    0xdc, 0xbd, 0xa6,
-    0xd9, 0xc0, 0xad,
-    0xe1, 0xc8, 0xb5,
-    0xde, 0xca, 0xbb,
-    0xd8, 0xca, 0xbe,
-    0xd3, 0xcb, 0xc3,
-    0xe5, 0xd2, 0xc2,
-    0xe3, 0xd5, 0xc9,
-    0xe9, 0xdb, 0xcf,
-    0xf8, 0xde, 0xca,
-    0xe7, 0xde, 0xd7,
-    0xed, 0xe4, 0xdb,
-    0xed, 0xe2, 0xe2,
-    0xe7, 0xe5, 0xdf,
-    0xfc, 0xfc, 0xfa,
-
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x79, 0x79, 0x64,
-    0x76, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x76,
-    0x64, 0x79, 0x79, 0xf9, 0xf9, 0x79, 0x76, 0x76, 0x64, 0x76, 0x64, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x64, 0x76, 0x64, 0x76, 0x76, 0x79, 0xf9,
-    0xf9, 0x64, 0x76, 0x79, 0x76, 0x76, 0x79, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x79, 0x76, 0x76, 0x79, 0x76, 0x64, 0xf9, 0xf8, 0x76, 0x64, 0x76,
-    0x76, 0x64, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x64, 0x76,
-    0x76, 0x64, 0x76, 0xf8, 0xf9, 0x76, 0x76, 0x76, 0x64, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x64, 0x76, 0x76, 0x76, 0xf9,
-    0xf9, 0x76, 0x64, 0x79, 0x76, 0x76, 0x79, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x79, 0x76, 0x76, 0x79, 0x64, 0x76, 0xf9, 0xf9, 0x64, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x64, 0xf9, 0xf9, 0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64, 0xf9,
-    0xf9, 0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64, 0xf9, 0xf9, 0x64, 0x76, 0x76,
-    0x64, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x64,
-    0x76, 0x76, 0x64, 0xf9, 0xf9, 0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64, 0xf9,
-    0xf9, 0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64, 0xf9, 0xf9, 0x64, 0x76, 0x76,
-    0x64, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x64,
-    0x76, 0x76, 0x64, 0xf9, 0xf9, 0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64, 0xf9,
-    0xf9, 0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x76, 0x76, 0x64, 0x76, 0x76, 0x64, 0xf9, 0xf9, 0x64, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x64, 0xf9, 0xf9, 0x76, 0x64, 0x79, 0x76, 0x76, 0x79, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x79, 0x76, 0x76, 0x79, 0x64, 0x76, 0xf9,
-    0xf9, 0x76, 0x76, 0x76, 0x64, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x64, 0x76, 0x76, 0x76, 0xf9, 0xf8, 0x76, 0x64, 0x76,
-    0x76, 0x64, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x64, 0x76,
-    0x76, 0x64, 0x76, 0xf8, 0xf9, 0x64, 0x76, 0x79, 0x76, 0x76, 0x79, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x79, 0x76, 0x76, 0x79, 0x76, 0x64, 0xf9,
-    0xf9, 0x79, 0x76, 0x76, 0x64, 0x76, 0x64, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x64, 0x76, 0x64, 0x76, 0x76, 0x79, 0xf9, 0xf9, 0x79, 0x79, 0x64,
-    0x76, 0x76, 0x76, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x76, 0x76, 0x76,
-    0x64, 0x79, 0x79, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9,
-    0x20, 0x1e, 0x06, 0x06, 0x0e, 0x17, 0x0e, 0x06, 0x06, 0x0d, 0x08, 0x00,
-    0x11, 0x08, 0x00, 0x02, 0x08, 0x2e, 0x11, 0x0f, 0x08, 0x00, 0x08, 0x0e,
-    0x08, 0x07, 0x0a, 0x0a, 0x00, 0x08, 0x1e, 0x1e, 0x2e, 0x0f, 0x05, 0x0a,
-    0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x11, 0x19, 0x1b, 0x07, 0x0a, 0x1e, 0x14,
-    0x08, 0x19, 0x38, 0x25, 0x0a, 0x00, 0x01, 0x09, 0x4f, 0x3d, 0x11, 0x0a,
-    0x08, 0x07, 0x16, 0x1e, 0x11, 0x17, 0x2e, 0x3d, 0x44, 0x11, 0x0b, 0x31,
-    0x39, 0x12, 0x09, 0x1d, 0x31, 0x25, 0x31, 0x1d, 0x1d, 0x12, 0x0a, 0x3c,
-    0x2e, 0x11, 0x04, 0x12, 0x53, 0x4c, 0x25, 0x11, 0x12, 0x1a, 0x26, 0x28,
-    0x47, 0x28, 0x27, 0x1f, 0x10, 0x36, 0x67, 0x58, 0x33, 0x14, 0x36, 0x1d,
-    0x28, 0x26, 0x28, 0x3a, 0x47, 0x5d, 0x63, 0x47, 0x47, 0x66, 0x78, 0x3e,
-    0x58, 0x78, 0x6c, 0x48, 0x1a, 0x14, 0x1f, 0x67, 0x8a, 0x43, 0x2f, 0x26,
-    0x1d, 0x27, 0x43, 0x3a, 0x3a, 0x51, 0x56, 0x75, 0x56, 0x2f, 0x56, 0x5d,
-    0x6a, 0x3a, 0x3a, 0x58, 0x51, 0x51, 0x56, 0x51, 0x43, 0x2f, 0x43, 0x3e,
-    0x3c, 0x1d, 0x27, 0x5d, 0x85, 0x58, 0x31, 0x1a, 0x27, 0x3a, 0x33, 0x58,
-    0x3e, 0x34, 0x43, 0x2f, 0x2f, 0x75, 0x5b, 0x4d, 0x28, 0x2d, 0x27, 0x28,
-    0x26, 0x26, 0x3a, 0x3a, 0x43, 0x63, 0x58, 0x47, 0x43, 0x75, 0x5b, 0x2f,
-    0x5d, 0x63, 0x43, 0x12, 0x04, 0x04, 0x26, 0x7b, 0x58, 0x26, 0x1a, 0x0a,
-    0x18, 0x3c, 0x1a, 0x1d, 0x1a, 0x3c, 0x53, 0x4c, 0x14, 0x31, 0x5f, 0x53,
-    0x12, 0x18, 0x38, 0x38, 0x26, 0x2e, 0x28, 0x28, 0x11, 0x0a, 0x2d, 0x1e,
-    0x0a, 0x00, 0x14, 0x5c, 0x38, 0x14, 0x0e, 0x06, 0x11, 0x14, 0x11, 0x0d,
-    0x0a, 0x19, 0x06, 0x06, 0x28, 0x38, 0x2e, 0x18, 0x0a, 0x0f, 0x08, 0x0e,
-    0x0a, 0x0a, 0x11, 0x0e, 0x17, 0x1e, 0x11, 0x11, 0x2e, 0x1c, 0x06, 0x0d,
-    0x37, 0x14, 0x08, 0x03, 0x03, 0x08, 0x25, 0x1e, 0x0f, 0x07, 0x08, 0x02,
-    0x08, 0x0f, 0x08, 0x08, 0x14, 0x25, 0x2b, 0x08, 0x04, 0x13, 0x1e, 0x0f,
-    0x02, 0x08, 0x1e, 0x0f, 0x0e, 0x0e, 0x0e, 0x06, 0x00, 0x0e, 0x0a, 0x06,
-    0x00, 0x00, 0x1e, 0x1e, 0x08, 0x0f, 0x00, 0x02, 0x0a, 0x08, 0x08, 0x08,
-    0x0a, 0x08, 0x00, 0x0e, 0x18, 0x18, 0x1c, 0x0f, 0x08, 0x00, 0x0e, 0x14,
-    0x17, 0x11, 0x0f, 0x13, 0x12, 0x13, 0x1e, 0x40, 0x17, 0x0f, 0x19, 0x0e,
-    0x08, 0x08, 0x1e, 0x35, 0x07, 0x08, 0x17, 0x1c, 0x38, 0x18, 0x0f, 0x1c,
-    0x0c, 0x0c, 0x0c, 0x03, 0x0a, 0x19, 0x1d, 0x20, 0x11, 0x17, 0x2e, 0x1e,
-    0x0f, 0x08, 0x07, 0x1e, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x11, 0x25,
-    0x1e, 0x14, 0x0a, 0x19, 0x31, 0x37, 0x38, 0x17, 0x35, 0x3f, 0x17, 0x17,
-    0x38, 0x06, 0x08, 0x4c, 0x40, 0x25, 0x4c, 0x20, 0x01, 0x0a, 0x25, 0x38,
-    0x31, 0x31, 0x44, 0x3c, 0x3c, 0x47, 0x61, 0x55, 0x1a, 0x28, 0x1d, 0x1f,
-    0x0d, 0x36, 0x63, 0x3c, 0x28, 0x36, 0x53, 0x67, 0x66, 0x38, 0x3c, 0x1f,
-    0x12, 0x27, 0x3a, 0x31, 0x58, 0x89, 0x5f, 0x3a, 0x58, 0x63, 0x66, 0x34,
-    0x2f, 0x26, 0x43, 0x58, 0x58, 0x1a, 0x1d, 0x34, 0x2f, 0x33, 0x5d, 0x6c,
-    0x4d, 0x3a, 0x33, 0x75, 0x75, 0x5d, 0x3a, 0x58, 0x8a, 0x3c, 0x3c, 0x6a,
-    0x3a, 0x1f, 0x5b, 0x85, 0x5d, 0x6c, 0x43, 0x2f, 0x28, 0x47, 0x5d, 0x66,
-    0x58, 0x5d, 0x75, 0x56, 0x66, 0x85, 0x75, 0x48, 0x4d, 0x58, 0x3e, 0x2f,
-    0x4d, 0x9a, 0x89, 0x48, 0x51, 0x5d, 0x78, 0x85, 0x5b, 0x4d, 0x48, 0x27,
-    0x47, 0x58, 0x34, 0x34, 0x96, 0x86, 0x5b, 0x48, 0x5d, 0x89, 0x66, 0x4d,
-    0x33, 0x4d, 0x58, 0x43, 0x27, 0x1d, 0x36, 0x3a, 0x26, 0x3a, 0x4d, 0x58,
-    0x3c, 0x12, 0x47, 0x67, 0x75, 0x58, 0x47, 0x7d, 0x52, 0x2e, 0x52, 0x47,
-    0x06, 0x1d, 0x58, 0x47, 0x5f, 0x53, 0x20, 0x0e, 0x12, 0x3c, 0x47, 0x3c,
-    0x26, 0x3c, 0x26, 0x3c, 0x52, 0x61, 0x44, 0x1e, 0x1a, 0x1e, 0x11, 0x0d,
-    0x47, 0x5f, 0x1e, 0x13, 0x28, 0x38, 0x4c, 0x38, 0x1e, 0x18, 0x0d, 0x06,
-    0x0d, 0x11, 0x11, 0x40, 0x4f, 0x18, 0x25, 0x18, 0x38, 0x28, 0x11, 0x08,
-    0x0a, 0x17, 0x17, 0x0a, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x14, 0x17, 0x0f,
-    0x0c, 0x0f, 0x1e, 0x1c, 0x2e, 0x0f, 0x1b, 0x35, 0x1b, 0x0f, 0x1c, 0x08,
-    0x03, 0x35, 0x37, 0x14, 0x1e, 0x0d, 0x00, 0x08, 0x1e, 0x17, 0x17, 0x0a,
-    0x09, 0x1e, 0x1e, 0x0e, 0x2e, 0x2e, 0x08, 0x17, 0x11, 0x08, 0x02, 0x0e,
-    0x38, 0x1e, 0x00, 0x0e, 0x25, 0x2b, 0x2e, 0x0a, 0x1e, 0x0f, 0x05, 0x1b,
-    0x0c, 0x05, 0x13, 0x31, 0x0e, 0x0f, 0x2e, 0x25, 0x0f, 0x08, 0x00, 0x00,
-    0x06, 0x08, 0x0a, 0x17, 0x07, 0x07, 0x17, 0x2e, 0x38, 0x11, 0x08, 0x08,
-    0x08, 0x18, 0x17, 0x08, 0x0f, 0x00, 0x17, 0x35, 0x25, 0x1e, 0x07, 0x00,
-    0x08, 0x0e, 0x17, 0x1c, 0x35, 0x0f, 0x0e, 0x0a, 0x0a, 0x1e, 0x2b, 0x1e,
-    0x0e, 0x0e, 0x1e, 0x08, 0x06, 0x0e, 0x11, 0x11, 0x11, 0x38, 0x61, 0x17,
-    0x08, 0x0f, 0x0a, 0x28, 0x2e, 0x28, 0x2e, 0x28, 0x28, 0x14, 0x11, 0x11,
-    0x1d, 0x39, 0x37, 0x14, 0x13, 0x4c, 0x61, 0x1d, 0x14, 0x14, 0x18, 0x14,
-    0x04, 0x1e, 0x25, 0x1e, 0x14, 0x3c, 0x66, 0x8a, 0x3c, 0x20, 0x1f, 0x28,
-    0x47, 0x3a, 0x28, 0x1d, 0x11, 0x36, 0x61, 0x63, 0x66, 0x34, 0x12, 0x0d,
-    0x28, 0x52, 0x47, 0x63, 0x43, 0x3a, 0x4d, 0x33, 0x4d, 0x5f, 0x58, 0x33,
-    0x33, 0x58, 0x58, 0x3e, 0x3a, 0x32, 0x3a, 0x3a, 0x86, 0x96, 0x75, 0x26,
-    0x26, 0x33, 0x8a, 0x63, 0x5f, 0x89, 0x5b, 0x5d, 0x58, 0x3a, 0x33, 0x3e,
-    0x5b, 0x5d, 0x43, 0x4d, 0x5f, 0x97, 0x66, 0x3a, 0x3a, 0x3a, 0x26, 0x1a,
-    0x3a, 0x3a, 0x3a, 0x3e, 0x58, 0x78, 0x9a, 0x85, 0x3e, 0x3a, 0x34, 0x5b,
-    0x5d, 0x58, 0x3a, 0x1a, 0x27, 0x5d, 0x78, 0x85, 0x6c, 0x32, 0x27, 0x2f,
-    0x3e, 0x58, 0x63, 0x72, 0x3e, 0x3e, 0x3a, 0x4d, 0x56, 0x66, 0x33, 0x1f,
-    0x34, 0x58, 0x3a, 0x32, 0x28, 0x3c, 0x26, 0x3a, 0x6d, 0x8a, 0x1f, 0x14,
-    0x28, 0x58, 0x7b, 0x47, 0x52, 0x58, 0x4d, 0x52, 0x26, 0x14, 0x28, 0x38,
-    0x43, 0x47, 0x28, 0x1d, 0x67, 0x5f, 0x1d, 0x1d, 0x12, 0x1d, 0x10, 0x09,
-    0x14, 0x2b, 0x13, 0x0d, 0x38, 0x5f, 0x5f, 0x18, 0x12, 0x12, 0x12, 0x36,
-    0x25, 0x13, 0x11, 0x08, 0x28, 0x46, 0x36, 0x44, 0x0d, 0x06, 0x08, 0x11,
-    0x1e, 0x17, 0x38, 0x12, 0x17, 0x11, 0x17, 0x14, 0x19, 0x14, 0x01, 0x08,
-    0x1e, 0x11, 0x0a, 0x06, 0x0e, 0x08, 0x0e, 0x2e, 0x4b, 0x25, 0x00, 0x08,
-    0x11, 0x19, 0x19, 0x25, 0x19, 0x11, 0x0f, 0x0a, 0x08, 0x08, 0x1b, 0x28,
-    0x02, 0x0e, 0x11, 0x1b, 0x35, 0x17, 0x07, 0x03, 0x00, 0x00, 0x00, 0x08,
-    0x17, 0x0f, 0x08, 0x08, 0x18, 0x38, 0x18, 0x08, 0x08, 0x00, 0x0a, 0x1e,
-    0x0f, 0x0a, 0x03, 0x0f, 0x2e, 0x2b, 0x1e, 0x13, 0x00, 0x02, 0x0a, 0x11,
-    0x40, 0x18, 0x07, 0x0a, 0x11, 0x02, 0x01, 0x03, 0x17, 0x28, 0x35, 0x55,
-    0x35, 0x25, 0x18, 0x0a, 0x0f, 0x03, 0x0a, 0x0a, 0x0e, 0x0a, 0x00, 0x0a,
-    0x0a, 0x0a, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x1d, 0x38, 0x17, 0x07, 0x0c,
-    0x0f, 0x0d, 0x04, 0x01, 0x08, 0x06, 0x14, 0x0a, 0x00, 0x14, 0x1e, 0x25,
-    0x2e, 0x11, 0x02, 0x0e, 0x2e, 0x18, 0x0a, 0x11, 0x18, 0x1c, 0x08, 0x0a,
-    0x11, 0x0e, 0x06, 0x00, 0x06, 0x37, 0x4c, 0x28, 0x31, 0x18, 0x28, 0x5c,
-    0x4f, 0x31, 0x25, 0x25, 0x14, 0x0d, 0x0d, 0x1f, 0x53, 0x52, 0x44, 0x4f,
-    0x61, 0x52, 0x36, 0x26, 0x52, 0x3a, 0x31, 0x1f, 0x0d, 0x06, 0x12, 0x3a,
-    0x58, 0x36, 0x1f, 0x3a, 0x3e, 0x4d, 0x48, 0x63, 0x48, 0x27, 0x26, 0x28,
-    0x33, 0x33, 0x27, 0x27, 0x27, 0x58, 0x3e, 0x27, 0x34, 0x58, 0x63, 0x75,
-    0x63, 0x3c, 0x1a, 0x58, 0x6c, 0x3a, 0x3c, 0x53, 0x58, 0x33, 0x47, 0x3c,
-    0x58, 0x5f, 0x1a, 0x12, 0x3e, 0x85, 0x78, 0x66, 0x58, 0x4d, 0x78, 0x93,
-    0x6a, 0x51, 0x3a, 0x43, 0x48, 0x3e, 0x34, 0x5d, 0x78, 0x6a, 0x89, 0x78,
-    0x89, 0x5d, 0x5d, 0x5d, 0x51, 0x5b, 0x4e, 0x3a, 0x1f, 0x26, 0x43, 0x72,
-    0x66, 0x3a, 0x4d, 0x57, 0x60, 0x4e, 0x70, 0x78, 0x3a, 0x26, 0x36, 0x47,
-    0x4d, 0x2f, 0x3a, 0x2f, 0x4d, 0x43, 0x3c, 0x26, 0x48, 0x5b, 0x5b, 0x63,
-    0x47, 0x12, 0x3c, 0x3a, 0x28, 0x33, 0x1a, 0x52, 0x36, 0x12, 0x12, 0x36,
-    0x47, 0x12, 0x04, 0x12, 0x58, 0x58, 0x47, 0x47, 0x31, 0x52, 0x8a, 0x67,
-    0x47, 0x1a, 0x1a, 0x12, 0x12, 0x14, 0x31, 0x53, 0x52, 0x4c, 0x4f, 0x4f,
-    0x4f, 0x36, 0x1d, 0x3c, 0x2e, 0x1d, 0x12, 0x03, 0x01, 0x0d, 0x44, 0x2e,
-    0x0e, 0x17, 0x1d, 0x28, 0x28, 0x38, 0x5c, 0x1e, 0x08, 0x11, 0x06, 0x12,
-    0x04, 0x00, 0x04, 0x06, 0x13, 0x0d, 0x01, 0x14, 0x14, 0x25, 0x1e, 0x0a,
-    0x02, 0x05, 0x1c, 0x17, 0x0a, 0x08, 0x11, 0x1e, 0x00, 0x03, 0x0e, 0x0e,
-    0x08, 0x00, 0x00, 0x1e, 0x37, 0x13, 0x14, 0x08, 0x0a, 0x40, 0x38, 0x0c,
-    0x08, 0x17, 0x08, 0x00, 0x00, 0x08, 0x25, 0x1c, 0x40, 0x4b, 0x1c, 0x2e,
-    0x0a, 0x0a, 0x0a, 0x07, 0x0a, 0x0a, 0x0a, 0x00, 0x03, 0x0a, 0x0a, 0x17,
-    0x11, 0x04, 0x0b, 0x0b, 0x0d, 0x25, 0x37, 0x0f, 0x08, 0x0f, 0x07, 0x03,
-    0x07, 0x08, 0x08, 0x06, 0x17, 0x2e, 0x2e, 0x35, 0x0f, 0x07, 0x1c, 0x1c,
-    0x1b, 0x07, 0x0f, 0x0a, 0x1e, 0x37, 0x1e, 0x0f, 0x0f, 0x17, 0x0a, 0x1e,
-    0x02, 0x00, 0x13, 0x37, 0x25, 0x0d, 0x04, 0x00, 0x08, 0x13, 0x08, 0x08,
-    0x13, 0x1e, 0x0e, 0x37, 0x4f, 0x14, 0x0e, 0x11, 0x14, 0x11, 0x08, 0x17,
-    0x29, 0x1c, 0x17, 0x40, 0x18, 0x06, 0x08, 0x0a, 0x0a, 0x28, 0x3d, 0x2b,
-    0x09, 0x08, 0x11, 0x0e, 0x08, 0x1e, 0x37, 0x17, 0x18, 0x1e, 0x06, 0x14,
-    0x14, 0x1f, 0x1f, 0x4c, 0x53, 0x53, 0x5c, 0x26, 0x0d, 0x1d, 0x47, 0x3a,
-    0x44, 0x28, 0x1d, 0x47, 0x5f, 0x52, 0x28, 0x1f, 0x28, 0x31, 0x67, 0x63,
-    0x26, 0x34, 0x63, 0x63, 0x63, 0x2f, 0x2d, 0x26, 0x34, 0x34, 0x3a, 0x4d,
-    0x3e, 0x4d, 0x5d, 0x9a, 0x86, 0x58, 0x4d, 0x33, 0x33, 0x3c, 0x3a, 0x56,
-    0x48, 0x3a, 0x5d, 0x89, 0x27, 0x26, 0x26, 0x32, 0x58, 0x67, 0x63, 0x3a,
-    0x33, 0x3e, 0x58, 0x2f, 0x32, 0x66, 0x4d, 0x2f, 0x58, 0x27, 0x2d, 0x3a,
-    0x3e, 0x5b, 0x5e, 0x70, 0x6c, 0x78, 0x66, 0x26, 0x26, 0x56, 0x6c, 0x66,
-    0x58, 0x4d, 0x5d, 0x78, 0x85, 0x56, 0x2f, 0x31, 0x33, 0x5f, 0x8a, 0x34,
-    0x3a, 0x78, 0x86, 0x86, 0x5d, 0x48, 0x3e, 0x34, 0x3e, 0x3e, 0x56, 0x3e,
-    0x48, 0x56, 0x85, 0x85, 0x58, 0x4d, 0x3c, 0x2f, 0x3c, 0x3c, 0x3c, 0x53,
-    0x3c, 0x47, 0x63, 0x3a, 0x1d, 0x12, 0x10, 0x2d, 0x39, 0x4c, 0x47, 0x12,
-    0x12, 0x26, 0x12, 0x18, 0x3c, 0x38, 0x14, 0x28, 0x28, 0x0a, 0x1a, 0x1e,
-    0x28, 0x26, 0x52, 0x5f, 0x47, 0x4c, 0x1e, 0x06, 0x1e, 0x26, 0x3c, 0x2e,
-    0x18, 0x28, 0x44, 0x47, 0x28, 0x13, 0x0d, 0x17, 0x17, 0x38, 0x1e, 0x06,
-    0x2e, 0x46, 0x40, 0x28, 0x0a, 0x0e, 0x04, 0x12, 0x06, 0x0e, 0x13, 0x12,
-    0x09, 0x20, 0x46, 0x20, 0x06, 0x0a, 0x0a, 0x0f, 0x05, 0x0c, 0x1c, 0x17,
-    0x08, 0x1b, 0x40, 0x11, 0x00, 0x00, 0x08, 0x0f, 0x1b, 0x1b, 0x0a, 0x00,
-    0x00, 0x0a, 0x08, 0x08, 0x0a, 0x05, 0x03, 0x0f, 0x03, 0x07, 0x07, 0x0a,
-    0x08, 0x08, 0x25, 0x2b, 0x35, 0x1c, 0x05, 0x0f, 0x1c, 0x1c, 0x0a, 0x07,
-    0x0e, 0x11, 0x28, 0x37, 0x0a, 0x08, 0x0c, 0x0f, 0x1c, 0x11, 0x00, 0x07,
-    0x2b, 0x37, 0x14, 0x13, 0x11, 0x0a, 0x00, 0x0f, 0x1c, 0x1c, 0x07, 0x03,
-    0x05, 0x05, 0x00, 0x01, 0x0e, 0x35, 0x1c, 0x05, 0x0f, 0x07, 0x08, 0x08,
-    0x08, 0x11, 0x1e, 0x1e, 0x25, 0x38, 0x1e, 0x0a, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x05, 0x0f, 0x18, 0x1e, 0x14, 0x0f, 0x02, 0x08, 0x0f, 0x0f, 0x11, 0x25,
-    0x1b, 0x02, 0x0a, 0x3f, 0x1e, 0x0e, 0x14, 0x11, 0x0a, 0x1c, 0x35, 0x25,
-    0x0a, 0x0e, 0x1e, 0x14, 0x18, 0x4c, 0x4f, 0x38, 0x28, 0x1e, 0x14, 0x20,
-    0x28, 0x0d, 0x00, 0x13, 0x36, 0x12, 0x1e, 0x1d, 0x3c, 0x28, 0x06, 0x00,
-    0x09, 0x12, 0x11, 0x28, 0x52, 0x47, 0x09, 0x1d, 0x12, 0x14, 0x27, 0x1a,
-    0x26, 0x58, 0x58, 0x3a, 0x4d, 0x58, 0x28, 0x3f, 0x2d, 0x2d, 0x28, 0x1d,
-    0x28, 0x5f, 0x6a, 0x5e, 0x33, 0x26, 0x3a, 0x66, 0x48, 0x3a, 0x58, 0x5b,
-    0x12, 0x0d, 0x53, 0x5f, 0x47, 0x52, 0x43, 0x56, 0x47, 0x5d, 0x58, 0x33,
-    0x34, 0x58, 0x4d, 0x3e, 0x86, 0x96, 0x85, 0x5d, 0x4e, 0x5b, 0x4e, 0x50,
-    0x56, 0x2f, 0x33, 0x6c, 0x4d, 0x33, 0x32, 0x5d, 0x56, 0x3a, 0x27, 0x27,
-    0x33, 0x26, 0x3a, 0x5d, 0x78, 0x2f, 0x33, 0x3a, 0x4d, 0x3a, 0x34, 0x3e,
-    0x6c, 0x63, 0x75, 0x56, 0x78, 0x58, 0x43, 0x3a, 0x3a, 0x3a, 0x31, 0x1d,
-    0x4d, 0x78, 0x5e, 0x3e, 0x26, 0x33, 0x58, 0x51, 0x56, 0x56, 0x5d, 0x36,
-    0x01, 0x36, 0x7b, 0x33, 0x3a, 0x3a, 0x58, 0x47, 0x58, 0x5f, 0x44, 0x28,
-    0x47, 0x52, 0x3a, 0x58, 0x75, 0x75, 0x63, 0x3a, 0x33, 0x3c, 0x1f, 0x2f,
-    0x18, 0x0b, 0x36, 0x36, 0x18, 0x1d, 0x3c, 0x47, 0x2e, 0x08, 0x08, 0x17,
-    0x0d, 0x0b, 0x1a, 0x47, 0x28, 0x06, 0x09, 0x06, 0x0d, 0x1e, 0x0a, 0x25,
-    0x44, 0x38, 0x4f, 0x4c, 0x31, 0x11, 0x0e, 0x11, 0x0a, 0x17, 0x1b, 0x0a,
-    0x25, 0x20, 0x1d, 0x0f, 0x07, 0x13, 0x20, 0x0d, 0x0d, 0x1e, 0x21, 0x05,
-    0x00, 0x2e, 0x1e, 0x0a, 0x0a, 0x0c, 0x08, 0x08, 0x1c, 0x1b, 0x03, 0x02,
-    0x1c, 0x17, 0x11, 0x35, 0x46, 0x1e, 0x0f, 0x11, 0x08, 0x11, 0x17, 0x00,
-    0x00, 0x08, 0x13, 0x02, 0x07, 0x0f, 0x18, 0x0c, 0x0c, 0x0c, 0x05, 0x03,
-    0x00, 0x00, 0x1c, 0x21, 0x07, 0x05, 0x0f, 0x07, 0x0f, 0x08, 0x0e, 0x1e,
-    0x1e, 0x1e, 0x38, 0x37, 0x11, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x03, 0x0f,
-    0x02, 0x08, 0x0a, 0x0a, 0x08, 0x02, 0x05, 0x0f, 0x05, 0x05, 0x0e, 0x13,
-    0x08, 0x17, 0x4b, 0x1c, 0x1c, 0x0f, 0x08, 0x0c, 0x00, 0x00, 0x04, 0x08,
-    0x00, 0x08, 0x2e, 0x2b, 0x1b, 0x05, 0x1c, 0x29, 0x29, 0x0c, 0x0f, 0x0e,
-    0x08, 0x08, 0x1b, 0x0e, 0x00, 0x06, 0x02, 0x06, 0x1e, 0x35, 0x2e, 0x08,
-    0x02, 0x06, 0x52, 0x31, 0x06, 0x14, 0x4b, 0x46, 0x13, 0x3d, 0x7d, 0x46,
-    0x12, 0x0d, 0x06, 0x06, 0x12, 0x31, 0x11, 0x10, 0x28, 0x26, 0x31, 0x04,
-    0x06, 0x3c, 0x67, 0x18, 0x12, 0x12, 0x12, 0x38, 0x18, 0x06, 0x20, 0x27,
-    0x3c, 0x66, 0x43, 0x3c, 0x47, 0x26, 0x26, 0x1a, 0x26, 0x3a, 0x26, 0x28,
-    0x1a, 0x33, 0x63, 0x3a, 0x3c, 0x67, 0x5f, 0x52, 0x43, 0x56, 0x3a, 0x32,
-    0x36, 0x3a, 0x5d, 0x33, 0x1a, 0x1f, 0x27, 0x4d, 0x67, 0x63, 0x33, 0x1f,
-    0x34, 0x6a, 0x8a, 0x58, 0x26, 0x66, 0x9a, 0x5d, 0x56, 0x96, 0x96, 0x75,
-    0x58, 0x2f, 0x3a, 0x3e, 0x70, 0x45, 0x48, 0x41, 0x6c, 0x78, 0x3e, 0x26,
-    0x51, 0x85, 0x5d, 0x2f, 0x3e, 0x3e, 0x5d, 0x58, 0x33, 0x34, 0x5d, 0x56,
-    0x78, 0x85, 0x6c, 0x5b, 0x3e, 0x48, 0x48, 0x32, 0x34, 0x3e, 0x33, 0x3e,
-    0x5d, 0x78, 0x5d, 0x63, 0x5b, 0x63, 0x63, 0x5f, 0x5d, 0x5b, 0x48, 0x2f,
-    0x2f, 0x58, 0x58, 0x27, 0x27, 0x27, 0x4c, 0x5f, 0x72, 0x3e, 0x12, 0x26,
-    0x43, 0x89, 0x66, 0x26, 0x3e, 0x8a, 0x6d, 0x52, 0x7b, 0xa0, 0x66, 0x32,
-    0x12, 0x27, 0x2d, 0x4d, 0x3a, 0x12, 0x1a, 0x3a, 0x5f, 0x1f, 0x09, 0x0d,
-    0x66, 0x67, 0x28, 0x1d, 0x18, 0x1a, 0x38, 0x18, 0x13, 0x31, 0x31, 0x27,
-    0x5f, 0x44, 0x31, 0x20, 0x14, 0x1e, 0x0a, 0x1e, 0x18, 0x0d, 0x0a, 0x11,
-    0x38, 0x4c, 0x1e, 0x1e, 0x2e, 0x35, 0x35, 0x17, 0x14, 0x11, 0x0d, 0x0a,
-    0x1e, 0x13, 0x01, 0x01, 0x04, 0x00, 0x1c, 0x4b, 0x17, 0x00, 0x03, 0x06,
-    0x46, 0x38, 0x0e, 0x04, 0x35, 0x4b, 0x0f, 0x17, 0x4b, 0x4b, 0x0a, 0x02,
-    0x00, 0x00, 0x11, 0x1e, 0x0a, 0x00, 0x08, 0x17, 0x1e, 0x00, 0x08, 0x0e,
-    0x11, 0x0a, 0x03, 0x03, 0x0f, 0x05, 0x05, 0x05, 0x13, 0x11, 0x06, 0x4b,
-    0x4b, 0x17, 0x0a, 0x08, 0x0a, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x17,
-    0x2e, 0x1e, 0x0c, 0x0c, 0x29, 0x29, 0x1c, 0x0c, 0x17, 0x13, 0x06, 0x0b,
-    0x11, 0x0e, 0x11, 0x37, 0x11, 0x0c, 0x37, 0x37, 0x2e, 0x0a, 0x0f, 0x1b,
-    0x07, 0x00, 0x0d, 0x35, 0x1e, 0x0a, 0x0f, 0x0a, 0x1e, 0x11, 0x07, 0x0c,
-    0x0a, 0x00, 0x03, 0x1c, 0x0f, 0x0f, 0x0a, 0x08, 0x01, 0x04, 0x13, 0x0e,
-    0x2b, 0x1e, 0x00, 0x03, 0x35, 0x40, 0x0a, 0x06, 0x39, 0x4c, 0x17, 0x0a,
-    0x40, 0x2e, 0x17, 0x0d, 0x25, 0x19, 0x0e, 0x11, 0x06, 0x28, 0x38, 0x28,
-    0x12, 0x06, 0x1e, 0x1d, 0x1e, 0x0d, 0x12, 0x28, 0x5f, 0x26, 0x12, 0x3c,
-    0x12, 0x18, 0x58, 0x52, 0x3c, 0x5f, 0x67, 0x47, 0x3c, 0x28, 0x36, 0x12,
-    0x36, 0x3a, 0x5f, 0x58, 0x33, 0x2f, 0x52, 0x5f, 0x26, 0x31, 0x47, 0x3a,
-    0x4d, 0x1a, 0x1f, 0x47, 0x3a, 0x43, 0x34, 0x2f, 0x3a, 0x51, 0x34, 0x48,
-    0x58, 0x27, 0x1a, 0x3a, 0x8a, 0x5b, 0x1a, 0x5d, 0x93, 0x5d, 0x3a, 0x5d,
-    0x78, 0x3e, 0x3a, 0x56, 0x56, 0x34, 0x3e, 0x3a, 0x48, 0x7f, 0x5d, 0x56,
-    0x3a, 0x48, 0x4e, 0x60, 0x48, 0x33, 0x58, 0x93, 0x78, 0x4d, 0x5d, 0x3e,
-    0x4d, 0x70, 0x86, 0x70, 0x7f, 0xa7, 0x86, 0x6c, 0x48, 0x56, 0x51, 0x3a,
-    0x56, 0x85, 0x86, 0x5d, 0x56, 0x4e, 0x89, 0x63, 0x3a, 0x66, 0x56, 0x60,
-    0x32, 0x26, 0x58, 0x58, 0x58, 0x51, 0x4d, 0x3a, 0x34, 0x3e, 0x48, 0x6c,
-    0x48, 0x2f, 0x3a, 0x75, 0x75, 0x26, 0x34, 0x85, 0x78, 0x2f, 0x58, 0x78,
-    0x58, 0x26, 0x3a, 0x58, 0x3a, 0x26, 0x27, 0x10, 0x5d, 0x6c, 0x3e, 0x27,
-    0x2d, 0x33, 0x3c, 0x26, 0x1f, 0x3c, 0x5f, 0x5f, 0x28, 0x26, 0x47, 0x12,
-    0x3c, 0x67, 0x3a, 0x2f, 0x7b, 0x66, 0x47, 0x28, 0x1d, 0x1d, 0x14, 0x14,
-    0x28, 0x53, 0x2f, 0x1e, 0x1d, 0x28, 0x28, 0x12, 0x12, 0x1d, 0x28, 0x11,
-    0x06, 0x17, 0x1b, 0x0a, 0x0a, 0x0d, 0x06, 0x08, 0x18, 0x11, 0x1e, 0x14,
-    0x00, 0x03, 0x2e, 0x4b, 0x0a, 0x00, 0x25, 0x40, 0x18, 0x0a, 0x18, 0x1c,
-    0x0a, 0x11, 0x11, 0x11, 0x08, 0x08, 0x08, 0x08, 0x11, 0x11, 0x08, 0x00,
-    0x08, 0x00, 0x07, 0x08, 0x0a, 0x0e, 0x1e, 0x0b, 0x13, 0x13, 0x1e, 0x0e,
-    0x25, 0x2b, 0x06, 0x1e, 0x31, 0x2e, 0x17, 0x0f, 0x1c, 0x0f, 0x08, 0x00,
-    0x1e, 0x2e, 0x17, 0x0f, 0x0a, 0x17, 0x1c, 0x0a, 0x0f, 0x17, 0x0e, 0x02,
-    0x0c, 0x1c, 0x0f, 0x0f, 0x0c, 0x11, 0x04, 0x00, 0x14, 0x25, 0x04, 0x00,
-    0x17, 0x3d, 0x11, 0x06, 0x0f, 0x1c, 0x08, 0x07, 0x44, 0x37, 0x00, 0x08,
-    0x0a, 0x08, 0x07, 0x07, 0x2e, 0x1e, 0x00, 0x03, 0x11, 0x11, 0x1c, 0x2b,
-    0x2e, 0x0f, 0x02, 0x0a, 0x2b, 0x13, 0x01, 0x0d, 0x3d, 0x13, 0x0e, 0x0a,
-    0x02, 0x08, 0x11, 0x12, 0x44, 0x44, 0x4c, 0x14, 0x1e, 0x2e, 0x0a, 0x00,
-    0x06, 0x00, 0x06, 0x1a, 0x25, 0x44, 0x31, 0x0e, 0x06, 0x14, 0x4f, 0x28,
-    0x1d, 0x0e, 0x12, 0x28, 0x36, 0x2e, 0x11, 0x12, 0x5f, 0x52, 0x18, 0x1a,
-    0x58, 0x53, 0x1d, 0x3c, 0x3a, 0x26, 0x14, 0x5f, 0x7b, 0x36, 0x28, 0x33,
-    0x3c, 0x28, 0x26, 0x58, 0x63, 0x26, 0x33, 0x3e, 0x48, 0x58, 0x5d, 0x89,
-    0x66, 0x36, 0x4d, 0x6a, 0x5d, 0x33, 0x2f, 0x6a, 0x5d, 0x3a, 0x3c, 0x12,
-    0x12, 0x48, 0x4e, 0x70, 0x78, 0x78, 0x78, 0x5b, 0x63, 0x3e, 0x2f, 0x27,
-    0x27, 0x27, 0x5b, 0x6c, 0x5b, 0x70, 0x4d, 0x33, 0x2f, 0x78, 0x78, 0x5d,
-    0x58, 0x48, 0x5b, 0x5d, 0x4e, 0x48, 0x3a, 0x70, 0x85, 0x5b, 0x48, 0x70,
-    0x79, 0x4e, 0x48, 0x6c, 0x6c, 0x34, 0x4e, 0x96, 0x86, 0x58, 0x5b, 0x6c,
-    0x48, 0x3a, 0x56, 0x8a, 0x5d, 0x3a, 0x56, 0x57, 0x5b, 0x6c, 0x89, 0x85,
-    0x58, 0x48, 0x5d, 0x86, 0x56, 0x3a, 0x6c, 0x86, 0x4e, 0x3e, 0x26, 0x12,
-    0x26, 0x48, 0x60, 0x7f, 0x63, 0x6c, 0x58, 0x5b, 0x56, 0x2f, 0x27, 0x1a,
-    0x12, 0x3c, 0x63, 0x3a, 0x66, 0x43, 0x26, 0x1f, 0x4d, 0x66, 0x4d, 0x31,
-    0x12, 0x3c, 0x47, 0x47, 0x28, 0x10, 0x27, 0x75, 0x58, 0x1a, 0x26, 0x67,
-    0x47, 0x28, 0x26, 0x36, 0x14, 0x04, 0x5c, 0x5f, 0x14, 0x28, 0x26, 0x12,
-    0x10, 0x14, 0x4f, 0x47, 0x00, 0x14, 0x26, 0x14, 0x25, 0x46, 0x4f, 0x1e,
-    0x0a, 0x17, 0x40, 0x1e, 0x00, 0x12, 0x40, 0x1c, 0x17, 0x0f, 0x03, 0x00,
-    0x13, 0x13, 0x3d, 0x25, 0x37, 0x1e, 0x0f, 0x0f, 0x0a, 0x0e, 0x02, 0x01,
-    0x0e, 0x1e, 0x1e, 0x1e, 0x17, 0x0e, 0x00, 0x08, 0x17, 0x0a, 0x0f, 0x07,
-    0x0f, 0x0c, 0x17, 0x13, 0x01, 0x06, 0x37, 0x1e, 0x08, 0x06, 0x37, 0x37,
-    0x08, 0x08, 0x1c, 0x0a, 0x02, 0x1e, 0x4f, 0x0e, 0x08, 0x0c, 0x08, 0x08,
-    0x03, 0x17, 0x35, 0x0a, 0x02, 0x0e, 0x11, 0x1e, 0x2b, 0x35, 0x1b, 0x08,
-    0x1c, 0x17, 0x0a, 0x1e, 0x2e, 0x11, 0x08, 0x08, 0x0e, 0x08, 0x00, 0x17,
-    0x1e, 0x0a, 0x0a, 0x0a, 0x11, 0x06, 0x14, 0x04, 0x08, 0x0e, 0x08, 0x0a,
-    0x17, 0x13, 0x0d, 0x04, 0x06, 0x11, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x0e,
-    0x08, 0x13, 0x14, 0x06, 0x08, 0x0e, 0x25, 0x38, 0x18, 0x2e, 0x26, 0x06,
-    0x01, 0x06, 0x12, 0x17, 0x40, 0x2e, 0x08, 0x12, 0x17, 0x0e, 0x0a, 0x04,
-    0x12, 0x14, 0x06, 0x26, 0x61, 0x31, 0x0d, 0x06, 0x0d, 0x4f, 0x61, 0x4f,
-    0x4c, 0x26, 0x3c, 0x47, 0x38, 0x1a, 0x12, 0x26, 0x47, 0x14, 0x1d, 0x5c,
-    0x53, 0x1d, 0x1d, 0x3c, 0x1d, 0x47, 0x52, 0x33, 0x2f, 0x48, 0x48, 0x56,
-    0x63, 0x58, 0x3c, 0x48, 0x5d, 0x3e, 0x33, 0x1f, 0x1d, 0x0d, 0x27, 0x3a,
-    0x33, 0x48, 0x3e, 0x2f, 0x2f, 0x63, 0x63, 0x66, 0x5d, 0x7f, 0x70, 0x27,
-    0x2f, 0x3a, 0x3a, 0x58, 0x85, 0x58, 0x41, 0x45, 0x48, 0x45, 0x3a, 0x48,
-    0x4e, 0x41, 0x5b, 0x85, 0x7f, 0x3e, 0x3a, 0x3e, 0x5d, 0x93, 0x85, 0x6c,
-    0x6c, 0x4e, 0x77, 0x5d, 0x4e, 0x34, 0x45, 0x70, 0x48, 0x34, 0x60, 0x70,
-    0x4e, 0x48, 0x5e, 0x56, 0x41, 0x5e, 0x45, 0x48, 0x4e, 0x6c, 0x70, 0x70,
-    0x78, 0x58, 0x3e, 0x60, 0x70, 0x56, 0x2f, 0x27, 0x1d, 0x26, 0x5b, 0x48,
-    0x4e, 0x4e, 0x45, 0x3a, 0x4e, 0x5b, 0x6a, 0x5d, 0x85, 0x85, 0x34, 0x26,
-    0x3a, 0x3e, 0x58, 0x72, 0x5f, 0x2f, 0x56, 0x2f, 0x2f, 0x2f, 0x27, 0x43,
-    0x33, 0x33, 0x63, 0x89, 0x58, 0x28, 0x26, 0x26, 0x67, 0x72, 0x5f, 0x52,
-    0x47, 0x3a, 0x47, 0x38, 0x1a, 0x12, 0x47, 0x26, 0x06, 0x1f, 0x47, 0x3c,
-    0x12, 0x1d, 0x28, 0x0d, 0x28, 0x28, 0x12, 0x10, 0x1d, 0x31, 0x4f, 0x31,
-    0x31, 0x14, 0x28, 0x47, 0x1e, 0x08, 0x01, 0x00, 0x00, 0x17, 0x18, 0x25,
-    0x17, 0x11, 0x0f, 0x0c, 0x18, 0x46, 0x37, 0x25, 0x25, 0x0e, 0x01, 0x00,
-    0x0e, 0x0a, 0x35, 0x18, 0x08, 0x08, 0x08, 0x00, 0x04, 0x08, 0x0a, 0x0a,
-    0x00, 0x0a, 0x35, 0x18, 0x07, 0x00, 0x02, 0x1c, 0x40, 0x1b, 0x1e, 0x13,
-    0x0a, 0x2e, 0x1e, 0x0e, 0x08, 0x08, 0x0e, 0x00, 0x08, 0x1c, 0x0f, 0x0f,
-    0x0a, 0x11, 0x0e, 0x13, 0x13, 0x00, 0x08, 0x0a, 0x08, 0x14, 0x11, 0x1e,
-    0x06, 0x08, 0x13, 0x0e, 0x08, 0x02, 0x02, 0x02, 0x0f, 0x0f, 0x0f, 0x1e,
-    0x1c, 0x1e, 0x28, 0x1e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0c, 0x18, 0x14,
-    0x08, 0x00, 0x13, 0x1e, 0x0a, 0x06, 0x0f, 0x19, 0x18, 0x25, 0x20, 0x13,
-    0x00, 0x20, 0x37, 0x08, 0x02, 0x0a, 0x0a, 0x00, 0x00, 0x04, 0x31, 0x14,
-    0x01, 0x01, 0x00, 0x08, 0x1e, 0x17, 0x06, 0x0e, 0x14, 0x14, 0x17, 0x0e,
-    0x08, 0x14, 0x28, 0x25, 0x38, 0x31, 0x28, 0x38, 0x4f, 0x31, 0x0e, 0x14,
-    0x26, 0x1d, 0x20, 0x1e, 0x12, 0x1e, 0x06, 0x06, 0x12, 0x1e, 0x1a, 0x3f,
-    0x47, 0x47, 0x3a, 0x14, 0x10, 0x26, 0x14, 0x06, 0x1d, 0x47, 0x52, 0x28,
-    0x15, 0x2d, 0x2f, 0x63, 0x5b, 0x3a, 0x34, 0x4d, 0x78, 0x79, 0x6c, 0x32,
-    0x51, 0x78, 0x51, 0x1f, 0x1f, 0x36, 0x33, 0x33, 0x2f, 0x78, 0x5d, 0x3a,
-    0x27, 0x27, 0x2f, 0x6c, 0x5d, 0x3e, 0x34, 0x48, 0x34, 0x4d, 0x33, 0x1f,
-    0x3a, 0x66, 0x5d, 0x78, 0x4e, 0x4e, 0x5d, 0x78, 0x7f, 0x48, 0x58, 0x4e,
-    0x4e, 0x3e, 0x5d, 0x5d, 0x56, 0x2f, 0x27, 0x56, 0x56, 0x51, 0x70, 0x70,
-    0x70, 0x70, 0x4e, 0x34, 0x4e, 0x48, 0x34, 0x3a, 0x5d, 0x7f, 0x56, 0x34,
-    0x56, 0x4e, 0x70, 0x79, 0x60, 0x45, 0x4e, 0x70, 0x79, 0x7f, 0x5b, 0x45,
-    0x7f, 0x70, 0x48, 0x27, 0x3a, 0x4d, 0x48, 0x48, 0x70, 0xa0, 0x48, 0x34,
-    0x32, 0x3a, 0x5d, 0x75, 0x5d, 0x48, 0x3e, 0x4d, 0x3a, 0x47, 0x26, 0x1f,
-    0x5f, 0x58, 0x4e, 0x5b, 0x48, 0x43, 0x63, 0x75, 0x32, 0x31, 0x3a, 0x48,
-    0x33, 0x3a, 0x34, 0x3a, 0x1d, 0x04, 0x1a, 0x3a, 0x1d, 0x47, 0x3a, 0x33,
-    0x58, 0x3c, 0x09, 0x12, 0x1d, 0x09, 0x08, 0x1a, 0x47, 0x31, 0x12, 0x12,
-    0x40, 0x36, 0x1f, 0x3c, 0x28, 0x13, 0x39, 0x47, 0x4f, 0x31, 0x06, 0x36,
-    0x44, 0x14, 0x03, 0x0a, 0x1e, 0x0a, 0x08, 0x0e, 0x38, 0x28, 0x03, 0x06,
-    0x02, 0x08, 0x20, 0x13, 0x01, 0x06, 0x13, 0x17, 0x1e, 0x08, 0x05, 0x0f,
-    0x11, 0x0a, 0x11, 0x14, 0x1e, 0x17, 0x1e, 0x1e, 0x00, 0x02, 0x17, 0x17,
-    0x08, 0x08, 0x03, 0x08, 0x03, 0x00, 0x0f, 0x0f, 0x0f, 0x2e, 0x1c, 0x1e,
-    0x2e, 0x07, 0x00, 0x08, 0x02, 0x03, 0x03, 0x1c, 0x1e, 0x0a, 0x00, 0x0e,
-    0x25, 0x13, 0x13, 0x0a, 0x0e, 0x25, 0x1e, 0x20, 0x20, 0x06, 0x0e, 0x2b,
-    0x11, 0x00, 0x03, 0x08, 0x0a, 0x0c, 0x1e, 0x03, 0x02, 0x0a, 0x07, 0x07,
-    0x18, 0x17, 0x2b, 0x18, 0x0a, 0x08, 0x0f, 0x17, 0x08, 0x00, 0x00, 0x08,
-    0x09, 0x1e, 0x40, 0x40, 0x0f, 0x02, 0x04, 0x20, 0x14, 0x0a, 0x11, 0x17,
-    0x17, 0x2b, 0x1e, 0x0f, 0x2e, 0x14, 0x13, 0x13, 0x14, 0x37, 0x14, 0x0e,
-    0x1e, 0x0a, 0x06, 0x12, 0x2e, 0x2e, 0x31, 0x1e, 0x0a, 0x17, 0x1e, 0x14,
-    0x5c, 0x7d, 0x7d, 0x7b, 0x28, 0x0a, 0x12, 0x44, 0x1d, 0x06, 0x28, 0x31,
-    0x1d, 0x31, 0x28, 0x09, 0x1d, 0x26, 0x1d, 0x0a, 0x12, 0x47, 0x26, 0x3a,
-    0x33, 0x5f, 0x5f, 0x47, 0x10, 0x26, 0x66, 0x3a, 0x2f, 0x27, 0x3a, 0x2f,
-    0x4d, 0x8a, 0x85, 0x48, 0x2f, 0x2d, 0x50, 0x5d, 0x58, 0x58, 0x56, 0x5d,
-    0x56, 0x5d, 0x51, 0x5b, 0x6c, 0x3e, 0x3e, 0x3e, 0x58, 0x51, 0x48, 0x56,
-    0x66, 0x48, 0x34, 0x51, 0x56, 0x78, 0x75, 0x43, 0x3a, 0x5d, 0x5b, 0x78,
-    0x9a, 0xa0, 0xa0, 0x7f, 0x48, 0x48, 0x5e, 0x70, 0x3e, 0x4a, 0x5e, 0x4e,
-    0x4e, 0x51, 0x3e, 0x45, 0x78, 0x5e, 0x34, 0x3a, 0x5e, 0x4e, 0x4a, 0x86,
-    0x70, 0x96, 0x70, 0x34, 0x3e, 0x70, 0x70, 0x4e, 0x45, 0x4e, 0x4e, 0x4e,
-    0x91, 0x91, 0x6c, 0x48, 0x32, 0x4e, 0x86, 0x70, 0x5d, 0x5e, 0x6c, 0x5e,
-    0x70, 0x79, 0x45, 0x78, 0x4e, 0x3e, 0x5d, 0x63, 0x5d, 0x45, 0x45, 0x5d,
-    0x48, 0x3e, 0x48, 0x58, 0x66, 0x75, 0x48, 0x33, 0x53, 0x5b, 0x3e, 0x85,
-    0x9a, 0x9a, 0x89, 0x3e, 0x27, 0x58, 0x66, 0x32, 0x27, 0x3e, 0x43, 0x33,
-    0x47, 0x1f, 0x1a, 0x67, 0x53, 0x28, 0x0d, 0x26, 0x3c, 0x1f, 0x33, 0x47,
-    0x5c, 0x67, 0x28, 0x09, 0x38, 0x4c, 0x28, 0x12, 0x12, 0x12, 0x12, 0x3c,
-    0x5f, 0x61, 0x12, 0x14, 0x11, 0x31, 0x31, 0x28, 0x26, 0x37, 0x31, 0x25,
-    0x52, 0x17, 0x44, 0x36, 0x1e, 0x17, 0x17, 0x38, 0x1e, 0x0a, 0x11, 0x0e,
-    0x08, 0x14, 0x25, 0x25, 0x35, 0x0f, 0x03, 0x0a, 0x11, 0x0a, 0x2b, 0x62,
-    0x7d, 0x55, 0x17, 0x00, 0x0e, 0x2e, 0x14, 0x00, 0x08, 0x1e, 0x0f, 0x0f,
-    0x1c, 0x0a, 0x0f, 0x1e, 0x11, 0x02, 0x08, 0x13, 0x0f, 0x11, 0x1e, 0x17,
-    0x2e, 0x0f, 0x08, 0x08, 0x14, 0x0a, 0x00, 0x00, 0x08, 0x08, 0x13, 0x2e,
-    0x4f, 0x2e, 0x00, 0x00, 0x13, 0x20, 0x1e, 0x0f, 0x17, 0x0e, 0x0e, 0x2e,
-    0x12, 0x06, 0x1e, 0x18, 0x11, 0x0f, 0x11, 0x06, 0x1e, 0x0a, 0x0a, 0x1e,
-    0x1c, 0x0e, 0x0a, 0x08, 0x00, 0x18, 0x4b, 0x1e, 0x1b, 0x1c, 0x17, 0x0c,
-    0x1c, 0x18, 0x0d, 0x0d, 0x0f, 0x02, 0x03, 0x08, 0x07, 0x07, 0x37, 0x35,
-    0x18, 0x12, 0x1e, 0x11, 0x4b, 0x7d, 0x40, 0x1e, 0x0a, 0x0a, 0x18, 0x17,
-    0x0c, 0x0a, 0x14, 0x0e, 0x0e, 0x06, 0x0e, 0x00, 0x0e, 0x14, 0x1e, 0x08,
-    0x08, 0x28, 0x47, 0x28, 0x06, 0x12, 0x36, 0x26, 0x3c, 0x28, 0x67, 0x61,
-    0x12, 0x28, 0x47, 0x47, 0x12, 0x47, 0x33, 0x43, 0x3a, 0x28, 0x53, 0x5f,
-    0x47, 0x47, 0x26, 0x1d, 0x58, 0x85, 0x52, 0x58, 0x66, 0x58, 0x4d, 0x48,
-    0x58, 0x4d, 0x48, 0x43, 0x1f, 0x12, 0x27, 0x34, 0x3e, 0x4e, 0x85, 0x6c,
-    0x5d, 0x5d, 0x58, 0x78, 0x9a, 0x96, 0x5b, 0x48, 0x45, 0x5b, 0x56, 0x26,
-    0x5b, 0x3a, 0x3e, 0x45, 0x3a, 0x56, 0x56, 0x27, 0x5d, 0x5d, 0x3a, 0x26,
-    0x3e, 0x79, 0x70, 0x4e, 0x4e, 0x70, 0x60, 0x70, 0x4e, 0x65, 0x9f, 0x60,
-    0x5b, 0x70, 0x6c, 0x3e, 0x5d, 0x60, 0x70, 0x7f, 0x56, 0x5b, 0x6c, 0x78,
-    0x6c, 0x70, 0x48, 0x5d, 0x90, 0x85, 0x6a, 0x89, 0x85, 0x5d, 0x6c, 0x6c,
-    0x58, 0x5d, 0x75, 0x48, 0x27, 0x2f, 0x48, 0x4e, 0x4e, 0x79, 0x91, 0x85,
-    0x78, 0x5d, 0x6c, 0x96, 0x96, 0x70, 0x56, 0x5e, 0x5d, 0x51, 0x2f, 0x32,
-    0x48, 0x2f, 0x43, 0x33, 0x2f, 0x4d, 0x27, 0x3a, 0x58, 0x31, 0x12, 0x26,
-    0x58, 0x6c, 0x51, 0x3a, 0x58, 0x3e, 0x3a, 0x4d, 0x47, 0x8a, 0x63, 0x1a,
-    0x3c, 0x52, 0x3c, 0x26, 0x47, 0x33, 0x52, 0x3c, 0x1e, 0x47, 0x4f, 0x31,
-    0x38, 0x12, 0x12, 0x61, 0x5f, 0x36, 0x40, 0x40, 0x25, 0x31, 0x28, 0x26,
-    0x1d, 0x28, 0x28, 0x08, 0x06, 0x0e, 0x13, 0x0a, 0x44, 0x52, 0x47, 0x28,
-    0x35, 0x1e, 0x40, 0x61, 0x4c, 0x1e, 0x11, 0x0a, 0x25, 0x17, 0x08, 0x0e,
-    0x0a, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0f, 0x0c, 0x0f, 0x0f, 0x00, 0x0a,
-    0x2b, 0x28, 0x08, 0x08, 0x11, 0x11, 0x0e, 0x11, 0x38, 0x37, 0x0a, 0x11,
-    0x2b, 0x17, 0x0a, 0x0f, 0x0f, 0x11, 0x17, 0x08, 0x0a, 0x2b, 0x17, 0x08,
-    0x0a, 0x02, 0x08, 0x35, 0x2e, 0x1e, 0x18, 0x1b, 0x0c, 0x1c, 0x0a, 0x17,
-    0x0d, 0x11, 0x07, 0x03, 0x07, 0x08, 0x08, 0x0a, 0x08, 0x00, 0x04, 0x25,
-    0x38, 0x0d, 0x00, 0x00, 0x00, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x1b, 0x1b, 0x07, 0x05, 0x0c, 0x05, 0x0c, 0x0c, 0x21, 0x0a, 0x08,
-    0x05, 0x08, 0x35, 0x40, 0x4b, 0x1e, 0x08, 0x0e, 0x00, 0x00, 0x0a, 0x2e,
-    0x18, 0x0f, 0x08, 0x08, 0x0e, 0x00, 0x07, 0x2e, 0x2e, 0x1e, 0x11, 0x37,
-    0x4f, 0x38, 0x11, 0x09, 0x04, 0x00, 0x06, 0x25, 0x12, 0x0d, 0x12, 0x04,
-    0x0a, 0x52, 0x3c, 0x0a, 0x11, 0x3c, 0x52, 0x3c, 0x12, 0x06, 0x47, 0x8a,
-    0x52, 0x0d, 0x12, 0x1f, 0x1a, 0x26, 0x14, 0x10, 0x28, 0x0d, 0x10, 0x26,
-    0x3a, 0x2f, 0x20, 0x31, 0x26, 0x1d, 0x0d, 0x12, 0x47, 0x52, 0x3c, 0x1d,
-    0x28, 0x66, 0x8a, 0x85, 0x86, 0x4d, 0x48, 0x34, 0x1f, 0x4d, 0x5d, 0x5d,
-    0x58, 0x3e, 0x45, 0x5b, 0x34, 0x26, 0x48, 0x70, 0x5e, 0x4e, 0x4e, 0x70,
-    0x91, 0x5e, 0x43, 0x63, 0x33, 0x2f, 0x58, 0x58, 0x34, 0x5b, 0x45, 0x3e,
-    0x5e, 0x70, 0x41, 0x3e, 0x5b, 0x81, 0x65, 0x50, 0x3a, 0x5e, 0xa7, 0x91,
-    0x3e, 0x48, 0x48, 0x56, 0x48, 0x4d, 0x27, 0x34, 0x3e, 0x32, 0x48, 0x5e,
-    0x51, 0x51, 0x33, 0x47, 0x3a, 0x33, 0x1f, 0x43, 0x66, 0x58, 0x2f, 0x26,
-    0x58, 0xa0, 0x96, 0x96, 0x6c, 0x45, 0x50, 0x2f, 0x58, 0x70, 0x6a, 0x5d,
-    0x58, 0x48, 0x45, 0x48, 0x27, 0x2f, 0x5d, 0x6c, 0x4e, 0x4e, 0x41, 0x86,
-    0x86, 0x27, 0x3e, 0x36, 0x12, 0x1f, 0x4c, 0x2f, 0x3e, 0x3e, 0x1d, 0x27,
-    0x6a, 0x3a, 0x1f, 0x33, 0x58, 0x5b, 0x4d, 0x12, 0x28, 0x67, 0x8a, 0x47,
-    0x12, 0x1d, 0x12, 0x1f, 0x12, 0x06, 0x09, 0x12, 0x06, 0x14, 0x31, 0x3c,
-    0x1a, 0x0a, 0x1e, 0x1e, 0x17, 0x06, 0x12, 0x31, 0x31, 0x14, 0x0a, 0x0a,
-    0x38, 0x4f, 0x5c, 0x5c, 0x14, 0x17, 0x06, 0x03, 0x14, 0x38, 0x1d, 0x0d,
-    0x0d, 0x0d, 0x17, 0x00, 0x08, 0x14, 0x1e, 0x17, 0x11, 0x0e, 0x37, 0x52,
-    0x0e, 0x03, 0x07, 0x03, 0x00, 0x0f, 0x0a, 0x0a, 0x11, 0x00, 0x02, 0x18,
-    0x1e, 0x08, 0x06, 0x06, 0x19, 0x0e, 0x00, 0x00, 0x17, 0x46, 0x25, 0x06,
-    0x02, 0x00, 0x08, 0x08, 0x08, 0x00, 0x02, 0x03, 0x00, 0x08, 0x11, 0x1c,
-    0x0f, 0x05, 0x05, 0x0c, 0x03, 0x05, 0x1b, 0x18, 0x0a, 0x0f, 0x07, 0x17,
-    0x2e, 0x40, 0x40, 0x0e, 0x06, 0x1e, 0x0e, 0x08, 0x08, 0x06, 0x1e, 0x0f,
-    0x0a, 0x2e, 0x2e, 0x0a, 0x0f, 0x46, 0x38, 0x25, 0x38, 0x07, 0x08, 0x11,
-    0x40, 0x4f, 0x40, 0x40, 0x1e, 0x0e, 0x0a, 0x1e, 0x4f, 0x37, 0x17, 0x1c,
-    0x18, 0x11, 0x00, 0x00, 0x08, 0x21, 0x0c, 0x07, 0x0a, 0x11, 0x0e, 0x13,
-    0x1c, 0x17, 0x31, 0x5f, 0x31, 0x0d, 0x06, 0x12, 0x14, 0x0d, 0x1d, 0x18,
-    0x11, 0x06, 0x14, 0x1e, 0x47, 0x53, 0x18, 0x40, 0x2b, 0x11, 0x18, 0x5c,
-    0x44, 0x26, 0x12, 0x26, 0x47, 0x26, 0x12, 0x12, 0x1d, 0x3c, 0x3a, 0x26,
-    0x5d, 0x75, 0x3a, 0x26, 0x89, 0x8a, 0x63, 0x58, 0x4d, 0x2f, 0x2f, 0x5b,
-    0x75, 0x89, 0x75, 0x66, 0x3a, 0x1d, 0x47, 0x89, 0x85, 0x5d, 0x75, 0x7b,
-    0x3e, 0x34, 0x27, 0x33, 0x5d, 0x58, 0x3c, 0x26, 0x3a, 0x58, 0x51, 0x4e,
-    0x45, 0x56, 0x7f, 0x7f, 0x41, 0x45, 0x6c, 0x4e, 0x45, 0x4e, 0x5d, 0x4a,
-    0x32, 0x48, 0x4a, 0x6c, 0x90, 0x6c, 0x60, 0x6c, 0x56, 0x3e, 0x7f, 0x96,
-    0x5e, 0x54, 0x4e, 0x60, 0x78, 0x5b, 0x58, 0x4a, 0x4e, 0x85, 0x54, 0x70,
-    0x90, 0x86, 0x48, 0x70, 0xa0, 0x7f, 0x85, 0x7f, 0x5e, 0x41, 0x65, 0x91,
-    0x91, 0x91, 0x7f, 0x6c, 0x34, 0x3a, 0x93, 0x9a, 0x7f, 0x86, 0x85, 0x78,
-    0x5b, 0x34, 0x41, 0x5d, 0x5d, 0x48, 0x26, 0x2f, 0x5d, 0x4e, 0x5d, 0x56,
-    0x4d, 0x70, 0x96, 0x56, 0x3a, 0x48, 0x5b, 0x48, 0x5b, 0x56, 0x4d, 0x32,
-    0x27, 0x3e, 0x48, 0x6c, 0x5d, 0x34, 0x3a, 0x33, 0x26, 0x43, 0x75, 0x63,
-    0x3a, 0x3a, 0x3e, 0x52, 0x47, 0x28, 0x28, 0x2d, 0x47, 0x43, 0x33, 0x67,
-    0x63, 0x2f, 0x1f, 0x8a, 0x67, 0x52, 0x4f, 0x36, 0x12, 0x26, 0x63, 0x58,
-    0x7b, 0x63, 0x47, 0x17, 0x12, 0x2e, 0x67, 0x47, 0x25, 0x39, 0x39, 0x1d,
-    0x11, 0x06, 0x13, 0x28, 0x1e, 0x08, 0x04, 0x14, 0x17, 0x14, 0x1e, 0x11,
-    0x25, 0x38, 0x28, 0x0e, 0x06, 0x0a, 0x11, 0x11, 0x0e, 0x0a, 0x08, 0x08,
-    0x06, 0x04, 0x11, 0x25, 0x06, 0x08, 0x0f, 0x07, 0x08, 0x29, 0x2e, 0x0e,
-    0x08, 0x06, 0x12, 0x1e, 0x08, 0x08, 0x08, 0x11, 0x1e, 0x08, 0x28, 0x2e,
-    0x1e, 0x08, 0x37, 0x4f, 0x1e, 0x35, 0x1e, 0x07, 0x08, 0x2e, 0x46, 0x4f,
-    0x4b, 0x37, 0x0e, 0x08, 0x0a, 0x2e, 0x35, 0x0f, 0x0f, 0x1c, 0x0a, 0x07,
-    0x28, 0x38, 0x0a, 0x0f, 0x08, 0x08, 0x38, 0x38, 0x1e, 0x08, 0x06, 0x11,
-    0x0a, 0x18, 0x37, 0x0a, 0x08, 0x0a, 0x11, 0x1c, 0x1c, 0x0a, 0x1e, 0x2e,
-    0x1c, 0x44, 0x7d, 0x25, 0x06, 0x0e, 0x03, 0x02, 0x00, 0x00, 0x06, 0x08,
-    0x0e, 0x21, 0x0f, 0x0c, 0x17, 0x25, 0x37, 0x06, 0x08, 0x31, 0x1e, 0x0e,
-    0x0d, 0x11, 0x0d, 0x14, 0x31, 0x28, 0x18, 0x20, 0x12, 0x0d, 0x12, 0x36,
-    0x36, 0x12, 0x0e, 0x4f, 0x67, 0x1a, 0x36, 0x28, 0x52, 0x1d, 0x06, 0x33,
-    0x66, 0x3a, 0x12, 0x1d, 0x14, 0x5f, 0x53, 0x52, 0x2f, 0x12, 0x4d, 0x3a,
-    0x52, 0x75, 0x63, 0x2d, 0x12, 0x4d, 0x56, 0x3a, 0x4d, 0x1a, 0x43, 0x66,
-    0x66, 0x97, 0x89, 0x58, 0x33, 0x26, 0x18, 0x0d, 0x1f, 0x3e, 0x48, 0x4d,
-    0x56, 0x32, 0x48, 0x5d, 0x5d, 0x6c, 0x6a, 0x2f, 0x6c, 0x70, 0x41, 0x48,
-    0x56, 0x4e, 0x4e, 0x5e, 0x70, 0x4e, 0x4e, 0x5b, 0x4e, 0x5d, 0x5b, 0x78,
-    0x5e, 0x3e, 0x4e, 0x90, 0x5b, 0x5e, 0x6c, 0x7f, 0x70, 0x34, 0x54, 0x79,
-    0x96, 0x56, 0x4d, 0x3e, 0x70, 0x96, 0x79, 0x79, 0x41, 0x4e, 0x7f, 0x4e,
-    0x85, 0x90, 0x5e, 0x48, 0x56, 0x70, 0x57, 0x4e, 0x48, 0x4a, 0x7f, 0x85,
-    0x9a, 0x9a, 0x85, 0x4e, 0x34, 0x26, 0x10, 0x1f, 0x41, 0x5d, 0x4e, 0x4e,
-    0x4d, 0x3e, 0x5d, 0x4e, 0x6c, 0x7f, 0x34, 0x48, 0x85, 0x4e, 0x3a, 0x48,
-    0x48, 0x56, 0x56, 0x6c, 0x5b, 0x5b, 0x51, 0x3e, 0x58, 0x43, 0x63, 0x5d,
-    0x2f, 0x27, 0x5d, 0x5f, 0x32, 0x58, 0x58, 0x6a, 0x27, 0x27, 0x56, 0x8a,
-    0x3a, 0x18, 0x12, 0x2f, 0x63, 0x63, 0x58, 0x26, 0x18, 0x58, 0x27, 0x47,
-    0x63, 0x3a, 0x14, 0x0d, 0x28, 0x3c, 0x28, 0x12, 0x12, 0x47, 0x31, 0x43,
-    0x8a, 0x58, 0x18, 0x14, 0x04, 0x00, 0x01, 0x00, 0x14, 0x14, 0x12, 0x2e,
-    0x11, 0x17, 0x1e, 0x31, 0x40, 0x11, 0x00, 0x28, 0x1e, 0x06, 0x0e, 0x0a,
-    0x11, 0x14, 0x25, 0x20, 0x11, 0x13, 0x11, 0x0e, 0x08, 0x14, 0x13, 0x04,
-    0x00, 0x11, 0x37, 0x0c, 0x00, 0x0f, 0x2b, 0x0a, 0x00, 0x11, 0x3d, 0x25,
-    0x08, 0x0a, 0x00, 0x1e, 0x4f, 0x25, 0x08, 0x00, 0x11, 0x0f, 0x11, 0x2e,
-    0x1e, 0x0e, 0x0f, 0x0e, 0x17, 0x2e, 0x17, 0x0f, 0x1e, 0x1e, 0x1e, 0x62,
-    0x46, 0x03, 0x03, 0x08, 0x02, 0x03, 0x00, 0x00, 0x08, 0x00, 0x1e, 0x38,
-    0x0f, 0x00, 0x07, 0x0a, 0x06, 0x08, 0x19, 0x35, 0x0a, 0x00, 0x00, 0x0a,
-    0x18, 0x46, 0x11, 0x1c, 0x1c, 0x03, 0x0f, 0x07, 0x02, 0x0f, 0x19, 0x06,
-    0x00, 0x17, 0x11, 0x08, 0x0a, 0x08, 0x06, 0x13, 0x11, 0x0f, 0x0a, 0x2e,
-    0x1e, 0x0e, 0x08, 0x0e, 0x17, 0x12, 0x1a, 0x1d, 0x14, 0x12, 0x1d, 0x11,
-    0x14, 0x0d, 0x09, 0x31, 0x4f, 0x47, 0x31, 0x28, 0x31, 0x12, 0x06, 0x08,
-    0x12, 0x3c, 0x14, 0x0a, 0x12, 0x1d, 0x12, 0x12, 0x28, 0x3a, 0x63, 0x58,
-    0x26, 0x06, 0x14, 0x28, 0x27, 0x36, 0x4d, 0x58, 0x1a, 0x06, 0x28, 0x48,
-    0x8a, 0x75, 0x48, 0x66, 0x2f, 0x33, 0x43, 0x3a, 0x4d, 0x3a, 0x36, 0x3e,
-    0x58, 0x58, 0x43, 0x3a, 0x3e, 0x48, 0x56, 0x5b, 0x33, 0x3a, 0x86, 0x93,
-    0x32, 0x26, 0x4d, 0x56, 0x5d, 0x6c, 0x70, 0x56, 0x4e, 0x7f, 0x5e, 0x48,
-    0x3e, 0x3e, 0x56, 0x7f, 0x96, 0x73, 0x70, 0x70, 0x4e, 0x56, 0x41, 0x3e,
-    0x6c, 0x4e, 0x56, 0x56, 0x4e, 0x4e, 0x45, 0x41, 0x4e, 0x9f, 0x9f, 0x60,
-    0x3e, 0x48, 0x4e, 0x45, 0x56, 0x5d, 0x96, 0x5e, 0x32, 0x2f, 0x5e, 0x96,
-    0x9f, 0x85, 0x7f, 0x78, 0x3e, 0x60, 0x4e, 0x45, 0x4e, 0x56, 0x45, 0x4e,
-    0x4e, 0x5d, 0x56, 0x4e, 0x4e, 0x4e, 0x60, 0x5d, 0x33, 0x6a, 0x96, 0x5e,
-    0x26, 0x3a, 0x56, 0x5d, 0x75, 0x70, 0x51, 0x48, 0x78, 0x5d, 0x3a, 0x5b,
-    0x48, 0x3a, 0x5d, 0x8a, 0x85, 0x5b, 0x56, 0x5d, 0x2f, 0x26, 0x1a, 0x2f,
-    0x3e, 0x33, 0x33, 0x2f, 0x33, 0x26, 0x26, 0x2d, 0x63, 0x8a, 0x58, 0x1f,
-    0x14, 0x1f, 0x1a, 0x26, 0x2d, 0x58, 0x3a, 0x06, 0x06, 0x1d, 0x52, 0x7b,
-    0x52, 0x47, 0x3c, 0x06, 0x2e, 0x2e, 0x1d, 0x26, 0x28, 0x18, 0x0a, 0x1d,
-    0x28, 0x12, 0x14, 0x14, 0x13, 0x1d, 0x1e, 0x11, 0x17, 0x3d, 0x38, 0x08,
-    0x08, 0x14, 0x1e, 0x17, 0x28, 0x1e, 0x11, 0x17, 0x28, 0x11, 0x0e, 0x11,
-    0x0a, 0x14, 0x3d, 0x3d, 0x19, 0x0a, 0x11, 0x08, 0x01, 0x00, 0x08, 0x08,
-    0x07, 0x08, 0x00, 0x03, 0x07, 0x00, 0x00, 0x08, 0x38, 0x2e, 0x08, 0x08,
-    0x08, 0x08, 0x06, 0x06, 0x2b, 0x2e, 0x00, 0x00, 0x00, 0x0e, 0x38, 0x35,
-    0x0f, 0x35, 0x07, 0x02, 0x0a, 0x08, 0x08, 0x17, 0x08, 0x03, 0x0f, 0x1c,
-    0x0c, 0x05, 0x07, 0x0a, 0x03, 0x00, 0x08, 0x0a, 0x00, 0x0a, 0x08, 0x04,
-    0x0a, 0x0a, 0x17, 0x1e, 0x0a, 0x1e, 0x35, 0x4b, 0x2e, 0x1c, 0x0f, 0x0c,
-    0x0c, 0x1c, 0x1b, 0x0f, 0x0f, 0x1e, 0x18, 0x0a, 0x0a, 0x17, 0x11, 0x1e,
-    0x4f, 0x37, 0x04, 0x08, 0x1e, 0x4f, 0x25, 0x06, 0x06, 0x01, 0x0e, 0x4f,
-    0x61, 0x28, 0x14, 0x44, 0x61, 0x44, 0x12, 0x3d, 0x4f, 0x31, 0x31, 0x12,
-    0x06, 0x12, 0x31, 0x28, 0x3c, 0x47, 0x52, 0x3c, 0x26, 0x12, 0x06, 0x12,
-    0x26, 0x5f, 0x5f, 0x1d, 0x12, 0x1f, 0x26, 0x26, 0x3a, 0x1f, 0x12, 0x3c,
-    0x3a, 0x58, 0x58, 0x48, 0x4d, 0x75, 0x85, 0x89, 0x5d, 0x48, 0x58, 0x66,
-    0x51, 0x51, 0x3a, 0x3e, 0x6a, 0x6a, 0x56, 0x3e, 0x3e, 0x4e, 0x6a, 0x86,
-    0x89, 0x48, 0x34, 0x56, 0x93, 0x86, 0x3e, 0x4d, 0x34, 0x27, 0x85, 0xa7,
-    0x89, 0x4e, 0x70, 0x96, 0x96, 0x6c, 0x5d, 0x93, 0x86, 0x7f, 0x6c, 0x5e,
-    0x5e, 0x70, 0x70, 0x5e, 0x70, 0x91, 0x91, 0x4e, 0x50, 0x45, 0x34, 0x45,
-    0x90, 0x9f, 0x86, 0x4a, 0x4e, 0x4a, 0x4e, 0x5e, 0x60, 0x4e, 0x60, 0x60,
-    0x79, 0x7f, 0x78, 0x70, 0x70, 0x96, 0x9f, 0x91, 0x70, 0x4e, 0x7f, 0x70,
-    0x70, 0x5e, 0x56, 0x60, 0x7f, 0x85, 0x4e, 0x4e, 0x6c, 0x85, 0x90, 0xa7,
-    0x70, 0x45, 0x54, 0x7f, 0x96, 0x6c, 0x48, 0x34, 0x34, 0x6c, 0xa0, 0x9a,
-    0x56, 0x4e, 0x86, 0x96, 0x8a, 0x58, 0x75, 0x85, 0x8a, 0x6c, 0x56, 0x58,
-    0x5d, 0x5b, 0x5d, 0x5d, 0x5b, 0x6c, 0x3e, 0x34, 0x27, 0x1a, 0x27, 0x5b,
-    0x85, 0x5d, 0x33, 0x26, 0x36, 0x3a, 0x2f, 0x3a, 0x2d, 0x26, 0x2f, 0x3a,
-    0x66, 0x4d, 0x3a, 0x3a, 0x67, 0x67, 0x7b, 0x52, 0x28, 0x2e, 0x3a, 0x38,
-    0x47, 0x28, 0x26, 0x58, 0x52, 0x31, 0x28, 0x28, 0x25, 0x4c, 0x61, 0x4f,
-    0x0d, 0x09, 0x14, 0x55, 0x44, 0x0e, 0x04, 0x00, 0x08, 0x61, 0x61, 0x25,
-    0x11, 0x40, 0x4f, 0x4c, 0x25, 0x2e, 0x46, 0x28, 0x18, 0x09, 0x06, 0x0e,
-    0x20, 0x13, 0x0d, 0x11, 0x25, 0x0e, 0x00, 0x01, 0x06, 0x00, 0x08, 0x2b,
-    0x35, 0x0f, 0x00, 0x06, 0x0a, 0x08, 0x06, 0x0a, 0x00, 0x08, 0x0e, 0x17,
-    0x1e, 0x17, 0x0f, 0x37, 0x40, 0x38, 0x25, 0x17, 0x0f, 0x1c, 0x1c, 0x1e,
-    0x1b, 0x18, 0x0c, 0x25, 0x0a, 0x0f, 0x0c, 0x0c, 0x0c, 0x35, 0x4b, 0x18,
-    0x1c, 0x11, 0x0e, 0x0e, 0x06, 0x07, 0x00, 0x08, 0x17, 0x08, 0x00, 0x03,
-    0x00, 0x08, 0x17, 0x1c, 0x1c, 0x11, 0x02, 0x07, 0x0c, 0x05, 0x05, 0x2e,
-    0x11, 0x02, 0x06, 0x06, 0x4f, 0x44, 0x1e, 0x03, 0x08, 0x08, 0x1e, 0x25,
-    0x11, 0x0a, 0x1e, 0x25, 0x20, 0x37, 0x1d, 0x06, 0x0e, 0x37, 0x25, 0x06,
-    0x0d, 0x06, 0x1d, 0x38, 0x47, 0x31, 0x12, 0x13, 0x09, 0x11, 0x1e, 0x11,
-    0x12, 0x1a, 0x3c, 0x3c, 0x52, 0x2f, 0x52, 0x66, 0x38, 0x38, 0x1d, 0x31,
-    0x43, 0x1a, 0x1d, 0x31, 0x27, 0x33, 0x12, 0x26, 0x33, 0x2f, 0x27, 0x2f,
-    0x2f, 0x3a, 0x58, 0x58, 0x33, 0x3a, 0x1f, 0x2d, 0x33, 0x1d, 0x56, 0x6c,
-    0x26, 0x2f, 0x2f, 0x5d, 0x89, 0x5d, 0x3e, 0x3a, 0x4d, 0x6a, 0x8a, 0x5e,
-    0x33, 0x5b, 0x70, 0x5e, 0x86, 0x6c, 0x3e, 0x5d, 0x5d, 0x5d, 0x60, 0x56,
-    0x3a, 0x4d, 0x70, 0x96, 0x93, 0x4e, 0x4e, 0x4e, 0x45, 0x4e, 0x56, 0x4a,
-    0x70, 0x7f, 0x70, 0x65, 0x5a, 0x7f, 0x9f, 0x70, 0x6c, 0x56, 0x4e, 0x7f,
-    0x70, 0x45, 0x60, 0x70, 0x54, 0x4e, 0x60, 0x54, 0x4e, 0x4e, 0x4e, 0x5d,
-    0x5e, 0x60, 0x70, 0x5e, 0x60, 0x4e, 0x3e, 0x4e, 0x48, 0x4e, 0x9a, 0x5e,
-    0x48, 0x45, 0x56, 0x84, 0x79, 0x5b, 0x4a, 0x4e, 0x60, 0x91, 0x91, 0x5e,
-    0x4e, 0x70, 0x6c, 0x70, 0x7f, 0x4e, 0x4a, 0x5d, 0x63, 0x4e, 0x4e, 0x34,
-    0x3a, 0x5d, 0x89, 0x85, 0x5d, 0x48, 0x48, 0x3e, 0x33, 0x3e, 0x2f, 0x3a,
-    0x4e, 0x5d, 0x5d, 0x56, 0x3e, 0x6c, 0x85, 0x47, 0x47, 0x3c, 0x58, 0x66,
-    0x2f, 0x1a, 0x3a, 0x3a, 0x27, 0x2d, 0x3a, 0x2d, 0x1f, 0x26, 0x26, 0x28,
-    0x36, 0x47, 0x2d, 0x31, 0x28, 0x11, 0x1d, 0x1e, 0x0e, 0x4d, 0x47, 0x06,
-    0x12, 0x17, 0x47, 0x5c, 0x28, 0x06, 0x09, 0x11, 0x36, 0x47, 0x28, 0x13,
-    0x1e, 0x25, 0x19, 0x38, 0x1d, 0x11, 0x13, 0x28, 0x1e, 0x13, 0x08, 0x08,
-    0x11, 0x2e, 0x40, 0x1e, 0x06, 0x08, 0x06, 0x06, 0x0e, 0x08, 0x00, 0x08,
-    0x11, 0x06, 0x13, 0x06, 0x1e, 0x37, 0x1c, 0x0f, 0x0f, 0x17, 0x35, 0x0a,
-    0x0a, 0x0e, 0x06, 0x08, 0x00, 0x0e, 0x0e, 0x00, 0x07, 0x00, 0x08, 0x0c,
-    0x1b, 0x1c, 0x0f, 0x07, 0x02, 0x0c, 0x0f, 0x05, 0x0f, 0x35, 0x08, 0x08,
-    0x00, 0x17, 0x35, 0x28, 0x08, 0x00, 0x08, 0x13, 0x0c, 0x0a, 0x08, 0x0a,
-    0x1e, 0x11, 0x00, 0x02, 0x0e, 0x17, 0x1e, 0x17, 0x00, 0x07, 0x0a, 0x08,
-    0x03, 0x00, 0x0a, 0x0f, 0x1c, 0x4b, 0x35, 0x0f, 0x03, 0x0a, 0x0a, 0x0e,
-    0x08, 0x11, 0x14, 0x2e, 0x18, 0x17, 0x13, 0x13, 0x19, 0x4f, 0x04, 0x13,
-    0x12, 0x1d, 0x12, 0x12, 0x08, 0x0e, 0x14, 0x11, 0x1d, 0x09, 0x01, 0x0d,
-    0x14, 0x0d, 0x0d, 0x1e, 0x47, 0x4c, 0x36, 0x47, 0x26, 0x12, 0x10, 0x12,
-    0x31, 0x5f, 0x5f, 0x47, 0x44, 0x4c, 0x28, 0x18, 0x36, 0x1d, 0x36, 0x5f,
-    0x47, 0x1d, 0x1a, 0x26, 0x34, 0x58, 0x63, 0x3c, 0x33, 0x3a, 0x3a, 0x3c,
-    0x1d, 0x33, 0x43, 0x3a, 0x63, 0x8a, 0x3e, 0x27, 0x34, 0x56, 0x48, 0x33,
-    0x3a, 0x78, 0x86, 0x5d, 0x4e, 0x5b, 0x56, 0x51, 0x85, 0x6c, 0x51, 0x4e,
-    0x6c, 0x77, 0x6c, 0x3a, 0x3a, 0x4e, 0x5d, 0x60, 0x5d, 0x3a, 0x41, 0x48,
-    0x48, 0x4e, 0x4e, 0x96, 0x91, 0x70, 0x65, 0x7f, 0x60, 0x4e, 0x41, 0x5e,
-    0x91, 0x91, 0x91, 0x7f, 0x7f, 0x60, 0x4e, 0x60, 0x60, 0x4e, 0x91, 0x76,
-    0x54, 0x4a, 0x60, 0x65, 0x79, 0x7f, 0x5d, 0x4e, 0x7f, 0x60, 0x78, 0x3e,
-    0x48, 0x70, 0x70, 0x70, 0x9f, 0x7f, 0x51, 0x45, 0x60, 0x65, 0x4e, 0x48,
-    0x70, 0x81, 0x79, 0x60, 0x70, 0x60, 0x4e, 0x7f, 0x7f, 0x56, 0x5e, 0x4e,
-    0x78, 0x85, 0x56, 0x3a, 0x56, 0x56, 0x4e, 0x5b, 0x48, 0x34, 0x32, 0x3a,
-    0x4d, 0x3a, 0x6c, 0x93, 0x86, 0x4e, 0x5e, 0x3e, 0x34, 0x32, 0x2f, 0x5d,
-    0x85, 0x78, 0x6c, 0x66, 0x48, 0x33, 0x3a, 0x3a, 0x26, 0x3a, 0x5b, 0x58,
-    0x12, 0x1a, 0x2f, 0x3a, 0x43, 0x3a, 0x1d, 0x3a, 0x3a, 0x33, 0x1d, 0x09,
-    0x1f, 0x26, 0x3f, 0x67, 0x63, 0x1d, 0x12, 0x26, 0x47, 0x2e, 0x11, 0x28,
-    0x61, 0x52, 0x36, 0x28, 0x28, 0x18, 0x25, 0x4f, 0x17, 0x1e, 0x18, 0x28,
-    0x18, 0x18, 0x0e, 0x0a, 0x1e, 0x0f, 0x1e, 0x17, 0x00, 0x06, 0x11, 0x08,
-    0x08, 0x14, 0x25, 0x25, 0x14, 0x14, 0x04, 0x06, 0x08, 0x01, 0x0e, 0x2b,
-    0x2e, 0x25, 0x18, 0x1e, 0x08, 0x08, 0x1c, 0x08, 0x0a, 0x19, 0x1e, 0x08,
-    0x00, 0x08, 0x1e, 0x17, 0x1c, 0x07, 0x08, 0x0f, 0x0a, 0x08, 0x02, 0x08,
-    0x07, 0x0c, 0x35, 0x40, 0x0f, 0x02, 0x0e, 0x17, 0x0a, 0x06, 0x08, 0x14,
-    0x1e, 0x1d, 0x0e, 0x0e, 0x0a, 0x06, 0x00, 0x08, 0x08, 0x0e, 0x2b, 0x13,
-    0x00, 0x0a, 0x1c, 0x0c, 0x03, 0x0a, 0x08, 0x0a, 0x07, 0x08, 0x0a, 0x0c,
-    0x0a, 0x35, 0x40, 0x17, 0x2e, 0x37, 0x1e, 0x28, 0x0a, 0x0a, 0x1e, 0x40,
-    0x4f, 0x0a, 0x01, 0x13, 0x37, 0x1e, 0x11, 0x1d, 0x11, 0x01, 0x0a, 0x1e,
-    0x09, 0x06, 0x1d, 0x31, 0x06, 0x14, 0x3d, 0x14, 0x1e, 0x25, 0x0e, 0x06,
-    0x12, 0x1e, 0x12, 0x1f, 0x1d, 0x0d, 0x1d, 0x44, 0x25, 0x12, 0x10, 0x06,
-    0x3a, 0x52, 0x47, 0x36, 0x1f, 0x28, 0x26, 0x28, 0x26, 0x63, 0x4d, 0x27,
-    0x1f, 0x3c, 0x58, 0x2f, 0x2f, 0x4d, 0x4d, 0x27, 0x1f, 0x3e, 0x58, 0x33,
-    0x63, 0x75, 0x58, 0x5d, 0x85, 0x66, 0x5b, 0x5d, 0x3a, 0x3a, 0x78, 0x93,
-    0x5d, 0x34, 0x4d, 0x78, 0x86, 0x66, 0x70, 0x5d, 0x45, 0x45, 0x5d, 0x56,
-    0x4a, 0x5b, 0x78, 0x4e, 0x4e, 0x7f, 0x78, 0x45, 0x6c, 0x4e, 0x3e, 0x45,
-    0x4e, 0x50, 0x70, 0x60, 0x4e, 0x50, 0x70, 0x7f, 0x70, 0x34, 0x2f, 0x70,
-    0x7f, 0x7f, 0x73, 0x54, 0x60, 0x57, 0x5e, 0x60, 0x91, 0x79, 0x60, 0x57,
-    0x5b, 0x86, 0x5e, 0x5e, 0x60, 0x85, 0x60, 0x48, 0x4e, 0x70, 0x5e, 0x5d,
-    0x93, 0x86, 0x77, 0x96, 0x91, 0x70, 0x7f, 0x6c, 0x4e, 0x6c, 0x8e, 0x91,
-    0x4e, 0x41, 0x78, 0x91, 0x60, 0x70, 0x70, 0x41, 0x45, 0x6c, 0x5b, 0x56,
-    0x4e, 0x63, 0x4e, 0x48, 0x5d, 0x60, 0x6c, 0x56, 0x5b, 0x48, 0x48, 0x3e,
-    0x48, 0x4e, 0x4e, 0x3e, 0x34, 0x45, 0x6c, 0x51, 0x32, 0x1f, 0x31, 0x6c,
-    0x5d, 0x5d, 0x51, 0x27, 0x33, 0x33, 0x1f, 0x4d, 0x67, 0x2f, 0x26, 0x1a,
-    0x3a, 0x3a, 0x28, 0x36, 0x47, 0x3c, 0x14, 0x14, 0x3c, 0x3c, 0x1d, 0x52,
-    0x5f, 0x31, 0x52, 0x67, 0x47, 0x3c, 0x31, 0x12, 0x28, 0x67, 0x58, 0x38,
-    0x04, 0x0d, 0x47, 0x28, 0x28, 0x40, 0x12, 0x08, 0x13, 0x1d, 0x11, 0x12,
-    0x1e, 0x19, 0x0e, 0x11, 0x1e, 0x1e, 0x1e, 0x11, 0x0e, 0x00, 0x08, 0x08,
-    0x08, 0x0a, 0x06, 0x01, 0x06, 0x0e, 0x11, 0x07, 0x00, 0x00, 0x1e, 0x25,
-    0x11, 0x0e, 0x08, 0x06, 0x02, 0x0e, 0x08, 0x18, 0x1e, 0x00, 0x03, 0x17,
-    0x11, 0x03, 0x08, 0x0f, 0x0e, 0x07, 0x03, 0x0f, 0x11, 0x0f, 0x1e, 0x35,
-    0x35, 0x1b, 0x2e, 0x18, 0x1e, 0x11, 0x08, 0x13, 0x1e, 0x38, 0x17, 0x00,
-    0x1e, 0x0e, 0x06, 0x06, 0x0a, 0x25, 0x46, 0x38, 0x2b, 0x14, 0x08, 0x08,
-    0x1e, 0x0a, 0x07, 0x02, 0x1e, 0x2e, 0x0f, 0x1c, 0x0f, 0x07, 0x0a, 0x17,
-    0x18, 0x06, 0x02, 0x11, 0x25, 0x17, 0x0a, 0x08, 0x0a, 0x11, 0x11, 0x25,
-    0x38, 0x1c, 0x1e, 0x0a, 0x12, 0x47, 0x4c, 0x31, 0x13, 0x25, 0x13, 0x02,
-    0x11, 0x4f, 0x4f, 0x28, 0x31, 0x44, 0x26, 0x31, 0x12, 0x12, 0x3c, 0x3c,
-    0x53, 0x47, 0x1f, 0x39, 0x20, 0x28, 0x5c, 0x5f, 0x47, 0x26, 0x3a, 0x5f,
-    0x33, 0x47, 0x2e, 0x12, 0x58, 0x8a, 0x6c, 0x58, 0x3a, 0x3c, 0x12, 0x4d,
-    0x63, 0x3a, 0x1f, 0x51, 0x89, 0x5d, 0x43, 0x58, 0x3a, 0x2f, 0x48, 0x58,
-    0x3c, 0x26, 0x3e, 0x66, 0x75, 0x56, 0x33, 0x5b, 0x45, 0x45, 0x5e, 0x7f,
-    0x6a, 0x66, 0x56, 0x4e, 0x91, 0x81, 0x65, 0x77, 0x5d, 0x5b, 0x34, 0x3e,
-    0x7f, 0x93, 0x70, 0x77, 0x91, 0x7f, 0x5e, 0x60, 0x54, 0x65, 0x7f, 0x81,
-    0x91, 0x70, 0x79, 0x70, 0x5e, 0x96, 0x96, 0x7f, 0x4e, 0x50, 0x91, 0x81,
-    0x57, 0x57, 0x50, 0x60, 0x9f, 0x9d, 0x8e, 0x79, 0x4e, 0x48, 0x70, 0x90,
-    0x78, 0x45, 0x4e, 0x96, 0x96, 0x77, 0x81, 0x70, 0x3e, 0x79, 0x70, 0x4e,
-    0x3a, 0x4e, 0x7f, 0x96, 0x7f, 0x45, 0x4e, 0x60, 0x57, 0x70, 0x7f, 0x85,
-    0x78, 0x70, 0x48, 0x7f, 0x84, 0x7f, 0x7f, 0x70, 0x5b, 0x3a, 0x27, 0x5e,
-    0x7f, 0x86, 0x85, 0x86, 0x70, 0x6c, 0x5e, 0x56, 0x5b, 0x5d, 0x5b, 0x79,
-    0x6c, 0x60, 0x5d, 0x34, 0x5d, 0x8a, 0x89, 0x34, 0x2f, 0x75, 0x4e, 0x33,
-    0x4d, 0x33, 0x26, 0x75, 0x8a, 0x63, 0x4d, 0x3a, 0x28, 0x26, 0x58, 0x43,
-    0x1d, 0x12, 0x43, 0x7b, 0x4c, 0x52, 0x2f, 0x1d, 0x28, 0x47, 0x2d, 0x14,
-    0x0d, 0x2e, 0x4c, 0x52, 0x1a, 0x10, 0x18, 0x28, 0x28, 0x47, 0x46, 0x38,
-    0x28, 0x0a, 0x14, 0x44, 0x4f, 0x44, 0x12, 0x1d, 0x11, 0x06, 0x13, 0x2d,
-    0x37, 0x28, 0x20, 0x37, 0x1e, 0x0e, 0x0d, 0x0e, 0x14, 0x14, 0x14, 0x0e,
-    0x0e, 0x14, 0x05, 0x17, 0x4b, 0x1e, 0x0a, 0x08, 0x06, 0x0d, 0x0d, 0x03,
-    0x0e, 0x03, 0x11, 0x38, 0x40, 0x37, 0x12, 0x0a, 0x02, 0x17, 0x17, 0x0a,
-    0x02, 0x0a, 0x35, 0x11, 0x1e, 0x1e, 0x08, 0x0a, 0x18, 0x1e, 0x0a, 0x00,
-    0x03, 0x18, 0x17, 0x08, 0x00, 0x08, 0x0c, 0x0c, 0x00, 0x00, 0x02, 0x0a,
-    0x18, 0x17, 0x00, 0x18, 0x5c, 0x37, 0x0f, 0x0f, 0x25, 0x0f, 0x1c, 0x0a,
-    0x08, 0x0a, 0x07, 0x0a, 0x08, 0x2e, 0x28, 0x0a, 0x0a, 0x08, 0x17, 0x0f,
-    0x13, 0x08, 0x08, 0x0a, 0x08, 0x08, 0x0e, 0x06, 0x00, 0x00, 0x08, 0x08,
-    0x0e, 0x1e, 0x4c, 0x39, 0x0d, 0x0d, 0x12, 0x17, 0x19, 0x14, 0x31, 0x4f,
-    0x0d, 0x00, 0x12, 0x36, 0x1d, 0x1e, 0x14, 0x20, 0x38, 0x1a, 0x0d, 0x0d,
-    0x04, 0x39, 0x5c, 0x44, 0x1d, 0x52, 0x47, 0x28, 0x26, 0x28, 0x3c, 0x5b,
-    0x3e, 0x18, 0x58, 0x86, 0x72, 0x4d, 0x4d, 0x48, 0x3a, 0x3a, 0x58, 0x32,
-    0x47, 0x33, 0x58, 0x34, 0x6d, 0x86, 0x66, 0x48, 0x27, 0x51, 0x78, 0x58,
-    0x2f, 0x56, 0x6c, 0x48, 0x2f, 0x48, 0x48, 0x2f, 0x12, 0x27, 0x4a, 0x4e,
-    0x56, 0x79, 0x91, 0x5d, 0x5d, 0x86, 0x85, 0x6c, 0x4e, 0x70, 0x7f, 0x70,
-    0x2f, 0x41, 0x77, 0x70, 0x60, 0x45, 0x4e, 0x70, 0x5e, 0x4e, 0x60, 0x34,
-    0x6c, 0x96, 0x86, 0x5e, 0x70, 0x7f, 0x70, 0x57, 0x60, 0x4e, 0x81, 0x9f,
-    0x4e, 0x60, 0x9d, 0xaf, 0x91, 0x70, 0x7f, 0x5e, 0x4e, 0x7f, 0x60, 0x4e,
-    0x5d, 0x60, 0x79, 0x54, 0x9f, 0x90, 0x79, 0x4e, 0x4e, 0x96, 0x70, 0x4e,
-    0x4e, 0x65, 0x60, 0x3e, 0x4e, 0x5e, 0x4e, 0x33, 0x27, 0x4e, 0x5d, 0x4a,
-    0x6c, 0x7f, 0x85, 0x4e, 0x70, 0x78, 0x60, 0x5d, 0x6c, 0x7f, 0x4e, 0x33,
-    0x32, 0x5b, 0x6c, 0x4e, 0x34, 0x2f, 0x48, 0x5b, 0x48, 0x41, 0x27, 0x4d,
-    0x6a, 0x86, 0x63, 0x34, 0x5d, 0x5d, 0x48, 0x3a, 0x36, 0x3e, 0x78, 0x47,
-    0x1a, 0x6c, 0xa0, 0x6c, 0x4d, 0x3a, 0x3a, 0x26, 0x53, 0x3a, 0x26, 0x31,
-    0x28, 0x3a, 0x1f, 0x67, 0x7b, 0x3c, 0x2d, 0x12, 0x3c, 0x52, 0x14, 0x12,
-    0x1a, 0x1a, 0x1e, 0x09, 0x2e, 0x12, 0x00, 0x00, 0x0d, 0x14, 0x04, 0x14,
-    0x53, 0x4c, 0x0a, 0x0a, 0x2e, 0x1e, 0x14, 0x09, 0x28, 0x1e, 0x08, 0x00,
-    0x07, 0x1e, 0x09, 0x04, 0x08, 0x04, 0x1e, 0x11, 0x01, 0x08, 0x0c, 0x1c,
-    0x35, 0x1c, 0x07, 0x17, 0x0b, 0x01, 0x01, 0x00, 0x08, 0x18, 0x1e, 0x08,
-    0x0a, 0x4f, 0x4b, 0x1e, 0x0a, 0x1e, 0x14, 0x1c, 0x1e, 0x08, 0x0a, 0x08,
-    0x0f, 0x08, 0x0e, 0x3f, 0x17, 0x0a, 0x0e, 0x0a, 0x11, 0x17, 0x0a, 0x03,
-    0x07, 0x03, 0x02, 0x03, 0x0a, 0x17, 0x2e, 0x18, 0x07, 0x07, 0x02, 0x02,
-    0x03, 0x07, 0x1c, 0x1b, 0x03, 0x1c, 0x1c, 0x40, 0x40, 0x08, 0x08, 0x07,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x17, 0x35, 0x0c, 0x0d, 0x04, 0x0a, 0x35,
-    0x1c, 0x07, 0x2b, 0x3d, 0x20, 0x06, 0x06, 0x25, 0x2e, 0x0c, 0x0f, 0x0e,
-    0x0e, 0x01, 0x13, 0x44, 0x12, 0x09, 0x0e, 0x08, 0x31, 0x4c, 0x25, 0x08,
-    0x08, 0x14, 0x4f, 0x38, 0x12, 0x2d, 0x1e, 0x26, 0x8a, 0x52, 0x1a, 0x1a,
-    0x28, 0x26, 0x10, 0x26, 0x4d, 0x48, 0x63, 0x43, 0x2f, 0x1a, 0x28, 0x13,
-    0x04, 0x38, 0x5b, 0x28, 0x2f, 0x58, 0x6c, 0x78, 0x51, 0x32, 0x3a, 0x3a,
-    0x58, 0x4d, 0x26, 0x33, 0x66, 0x66, 0x4d, 0x5d, 0x56, 0x3e, 0x5d, 0x3e,
-    0x58, 0x5d, 0x89, 0x78, 0x58, 0x48, 0x5e, 0x70, 0x58, 0x3a, 0x3a, 0x48,
-    0x3e, 0x48, 0x79, 0x7f, 0x4e, 0x48, 0x34, 0x4e, 0x93, 0x7f, 0x48, 0x3a,
-    0x3e, 0x70, 0x96, 0x5d, 0x5d, 0x7f, 0x5e, 0xa7, 0x9f, 0x6a, 0x4e, 0x5e,
-    0x5d, 0x48, 0x4e, 0x7f, 0x90, 0x90, 0x84, 0x54, 0x4e, 0x54, 0x4e, 0x34,
-    0x5b, 0x91, 0x54, 0x50, 0x79, 0x7f, 0x90, 0x84, 0x5e, 0x4e, 0x50, 0x60,
-    0x60, 0x56, 0x3e, 0x60, 0x84, 0x70, 0x64, 0x70, 0x4e, 0x54, 0x78, 0x58,
-    0x5b, 0x7f, 0x93, 0x70, 0x45, 0x4e, 0x96, 0x56, 0x4d, 0x3a, 0x3a, 0x41,
-    0x3a, 0x4e, 0x91, 0x60, 0x48, 0x2f, 0x33, 0x7f, 0x7f, 0x51, 0x2f, 0x1a,
-    0x4d, 0x85, 0x56, 0x47, 0x5d, 0x43, 0x5f, 0x97, 0x5f, 0x47, 0x47, 0x3a,
-    0x26, 0x28, 0x58, 0x56, 0x6c, 0x89, 0x58, 0x26, 0x36, 0x26, 0x12, 0x12,
-    0x43, 0x53, 0x12, 0x3c, 0x3a, 0x56, 0x48, 0x33, 0x2f, 0x28, 0x20, 0x36,
-    0x33, 0x14, 0x11, 0x36, 0x47, 0x18, 0x4c, 0x1d, 0x10, 0x28, 0x28, 0x12,
-    0x26, 0x52, 0x31, 0x12, 0x12, 0x3f, 0x2e, 0x17, 0x0a, 0x0e, 0x08, 0x06,
-    0x0e, 0x37, 0x11, 0x0e, 0x0e, 0x00, 0x17, 0x2e, 0x14, 0x11, 0x00, 0x05,
-    0x1b, 0x25, 0x03, 0x1c, 0x0c, 0x0f, 0x4b, 0x1c, 0x0c, 0x16, 0x05, 0x0f,
-    0x08, 0x08, 0x14, 0x1b, 0x2b, 0x0a, 0x07, 0x00, 0x02, 0x02, 0x03, 0x0f,
-    0x2e, 0x07, 0x0f, 0x1c, 0x1c, 0x4f, 0x1e, 0x08, 0x08, 0x03, 0x0f, 0x0f,
-    0x0f, 0x03, 0x0f, 0x1c, 0x1c, 0x0a, 0x08, 0x02, 0x0c, 0x1c, 0x0c, 0x0f,
-    0x00, 0x03, 0x1c, 0x0a, 0x00, 0x0a, 0x0a, 0x07, 0x08, 0x0f, 0x07, 0x05,
-    0x08, 0x35, 0x1e, 0x0a, 0x17, 0x08, 0x0a, 0x07, 0x2e, 0x0c, 0x1e, 0x4b,
-    0x2b, 0x1e, 0x07, 0x02, 0x06, 0x08, 0x06, 0x1c, 0x35, 0x17, 0x0a, 0x08,
-    0x1e, 0x3d, 0x28, 0x1e, 0x0a, 0x40, 0x55, 0x3d, 0x13, 0x09, 0x06, 0x06,
-    0x36, 0x39, 0x1d, 0x06, 0x13, 0x1d, 0x14, 0x2d, 0x67, 0x61, 0x36, 0x25,
-    0x12, 0x36, 0x28, 0x28, 0x0a, 0x0a, 0x0d, 0x1a, 0x1a, 0x3c, 0x1f, 0x1d,
-    0x28, 0x3a, 0x52, 0x12, 0x26, 0x52, 0x47, 0x1d, 0x2d, 0x33, 0x27, 0x28,
-    0x8a, 0x78, 0x5b, 0x58, 0x51, 0x48, 0x58, 0x75, 0x75, 0x48, 0x85, 0x9a,
-    0x85, 0x3e, 0x3c, 0x2f, 0x56, 0x48, 0x58, 0x86, 0x6a, 0x48, 0x3a, 0x48,
-    0x96, 0x86, 0x7f, 0x58, 0x7f, 0xa0, 0x96, 0x6c, 0x60, 0x5e, 0x48, 0x4e,
-    0x7f, 0x78, 0x5e, 0x4e, 0x5e, 0x78, 0x70, 0x91, 0xa0, 0x91, 0x70, 0x70,
-    0x65, 0x5a, 0x57, 0x4e, 0x32, 0x4e, 0x4e, 0x56, 0x85, 0x7f, 0x4e, 0x4e,
-    0x5a, 0x65, 0x56, 0x54, 0x91, 0x65, 0x60, 0x4e, 0x70, 0x57, 0x50, 0x81,
-    0xb1, 0x91, 0x70, 0x5e, 0x65, 0x5e, 0x65, 0x91, 0x57, 0x96, 0xb1, 0x9f,
-    0x65, 0x54, 0x5b, 0x57, 0x60, 0x56, 0x85, 0x9a, 0x4e, 0x3a, 0x4e, 0x9f,
-    0x91, 0x7f, 0x6c, 0x5d, 0xa7, 0x9f, 0x85, 0x4e, 0x5e, 0x3a, 0x34, 0x70,
-    0x7f, 0x56, 0x48, 0x4e, 0x5d, 0x56, 0x70, 0x96, 0x86, 0x5d, 0x58, 0x48,
-    0x75, 0x48, 0x3a, 0x12, 0x33, 0x33, 0x33, 0x3a, 0x5d, 0x47, 0x1f, 0x34,
-    0x63, 0x43, 0x1f, 0x3a, 0x4d, 0x47, 0x26, 0x3f, 0x3c, 0x12, 0x26, 0x8a,
-    0x5b, 0x3a, 0x3c, 0x3a, 0x2f, 0x26, 0x63, 0x47, 0x3c, 0x67, 0x61, 0x5c,
-    0x14, 0x04, 0x0d, 0x1d, 0x14, 0x31, 0x4f, 0x28, 0x14, 0x1e, 0x2e, 0x67,
-    0x2f, 0x2e, 0x1e, 0x3f, 0x61, 0x38, 0x0a, 0x0a, 0x08, 0x00, 0x25, 0x37,
-    0x1e, 0x04, 0x0a, 0x17, 0x0a, 0x1e, 0x4b, 0x62, 0x1e, 0x17, 0x03, 0x17,
-    0x0e, 0x08, 0x08, 0x02, 0x0f, 0x05, 0x07, 0x1c, 0x17, 0x08, 0x00, 0x0a,
-    0x17, 0x00, 0x07, 0x11, 0x08, 0x0f, 0x0a, 0x03, 0x02, 0x00, 0x17, 0x35,
-    0x0a, 0x0a, 0x0a, 0x08, 0x08, 0x14, 0x2e, 0x0a, 0x35, 0x2e, 0x18, 0x07,
-    0x03, 0x08, 0x06, 0x02, 0x0f, 0x16, 0x1c, 0x07, 0x04, 0x08, 0x00, 0x08,
-    0x0f, 0x08, 0x08, 0x18, 0x2e, 0x0f, 0x03, 0x1c, 0x25, 0x1e, 0x0a, 0x08,
-    0x0f, 0x0a, 0x0f, 0x02, 0x00, 0x08, 0x0e, 0x14, 0x11, 0x0e, 0x14, 0x11,
-    0x02, 0x06, 0x18, 0x11, 0x00, 0x0a, 0x1e, 0x11, 0x17, 0x31, 0x1e, 0x11,
-    0x2b, 0x11, 0x1e, 0x3d, 0x39, 0x5f, 0x5c, 0x31, 0x12, 0x1e, 0x44, 0x5f,
-    0x7d, 0x4f, 0x1d, 0x3c, 0x61, 0x61, 0x25, 0x06, 0x12, 0x06, 0x06, 0x67,
-    0x3f, 0x58, 0x67, 0x3c, 0x3a, 0x2e, 0x53, 0x52, 0x20, 0x12, 0x28, 0x33,
-    0x12, 0x1f, 0x63, 0x5d, 0x56, 0x3f, 0x5d, 0x8a, 0x75, 0x5b, 0x58, 0x26,
-    0x3a, 0x5d, 0x48, 0x2f, 0x2d, 0x2f, 0x45, 0x5d, 0x2f, 0x70, 0x86, 0x41,
-    0x48, 0x6c, 0x5d, 0x56, 0x34, 0x5e, 0x4e, 0x48, 0x85, 0x70, 0x32, 0x78,
-    0x96, 0x5e, 0x85, 0x7f, 0xa0, 0xb1, 0x7f, 0x70, 0x70, 0x70, 0xa0, 0xa7,
-    0x96, 0x86, 0x7f, 0x91, 0x9f, 0x60, 0x45, 0x54, 0x57, 0x50, 0x81, 0x91,
-    0x70, 0x9f, 0x7f, 0x77, 0x6c, 0x65, 0x91, 0x65, 0x54, 0x50, 0x70, 0x5e,
-    0x4e, 0x65, 0x91, 0x8e, 0x79, 0x79, 0x9f, 0x9d, 0x90, 0x65, 0x4e, 0x56,
-    0x7f, 0x65, 0x4e, 0x56, 0x45, 0x60, 0x91, 0x4e, 0x57, 0x9f, 0x65, 0x50,
-    0x7f, 0x79, 0x6c, 0x5b, 0x70, 0x70, 0x5e, 0x70, 0x7f, 0x51, 0x41, 0x96,
-    0x6c, 0x7f, 0x7f, 0xa7, 0xa7, 0x9a, 0x7f, 0x78, 0x5e, 0x91, 0x9f, 0x96,
-    0x70, 0x5b, 0x70, 0x91, 0x79, 0x34, 0x2f, 0x48, 0x32, 0x45, 0x8a, 0x56,
-    0x9a, 0x78, 0x56, 0x58, 0x47, 0x5d, 0x5f, 0x3a, 0x26, 0x3a, 0x58, 0x26,
-    0x33, 0x63, 0x78, 0x58, 0x3a, 0x63, 0x85, 0x66, 0x3a, 0x26, 0x26, 0x34,
-    0x33, 0x18, 0x14, 0x14, 0x12, 0x3c, 0x4c, 0x14, 0x40, 0x5c, 0x0d, 0x28,
-    0x38, 0x25, 0x12, 0x11, 0x47, 0x26, 0x12, 0x4f, 0x28, 0x0e, 0x47, 0x28,
-    0x2e, 0x2e, 0x28, 0x4f, 0x61, 0x38, 0x25, 0x13, 0x18, 0x38, 0x61, 0x44,
-    0x12, 0x1b, 0x62, 0x61, 0x17, 0x02, 0x0a, 0x00, 0x00, 0x40, 0x37, 0x1e,
-    0x40, 0x17, 0x0c, 0x1b, 0x0a, 0x0e, 0x0e, 0x00, 0x00, 0x0a, 0x08, 0x08,
-    0x0f, 0x2b, 0x1e, 0x00, 0x11, 0x2e, 0x1c, 0x0f, 0x08, 0x08, 0x07, 0x0e,
-    0x0a, 0x00, 0x00, 0x00, 0x0e, 0x1e, 0x08, 0x11, 0x1e, 0x08, 0x08, 0x0c,
-    0x17, 0x0a, 0x08, 0x11, 0x00, 0x08, 0x08, 0x40, 0x61, 0x4f, 0x11, 0x02,
-    0x11, 0x0e, 0x0f, 0x0a, 0x11, 0x0f, 0x08, 0x17, 0x40, 0x25, 0x07, 0x0a,
-    0x1e, 0x38, 0x37, 0x08, 0x00, 0x07, 0x14, 0x11, 0x1b, 0x0c, 0x1e, 0x06,
-    0x0d, 0x37, 0x18, 0x0c, 0x1e, 0x1e, 0x38, 0x25, 0x08, 0x0a, 0x0d, 0x09,
-    0x0b, 0x0d, 0x36, 0x53, 0x31, 0x12, 0x12, 0x12, 0x28, 0x4f, 0x61, 0x31,
-    0x14, 0x11, 0x18, 0x12, 0x2f, 0x52, 0x12, 0x52, 0x8a, 0x67, 0x1d, 0x1a,
-    0x43, 0x67, 0x3c, 0x3c, 0x36, 0x31, 0x66, 0x97, 0x7d, 0x58, 0x2f, 0x34,
-    0x60, 0x34, 0x1a, 0x3a, 0x4d, 0x58, 0x58, 0x8a, 0x85, 0x58, 0x58, 0x3e,
-    0x78, 0x86, 0x5d, 0x1a, 0x33, 0x5b, 0x5e, 0x60, 0x6c, 0x50, 0x48, 0x34,
-    0x86, 0x70, 0x48, 0x4e, 0x4e, 0x78, 0x63, 0x5b, 0x4e, 0x57, 0x4e, 0x4e,
-    0x5e, 0x70, 0x96, 0x96, 0x7f, 0x60, 0x5d, 0x78, 0x91, 0xa7, 0x90, 0x5e,
-    0x56, 0x4e, 0x70, 0x64, 0x98, 0x81, 0x69, 0xaf, 0xb1, 0x79, 0x70, 0x79,
-    0x91, 0x7f, 0x73, 0x91, 0x5a, 0x81, 0xac, 0x9d, 0x99, 0x65, 0x79, 0x84,
-    0x65, 0x4e, 0x79, 0x64, 0x81, 0x65, 0x90, 0xac, 0x73, 0x60, 0x65, 0x7f,
-    0xb1, 0x9f, 0x4e, 0x48, 0x57, 0x79, 0x79, 0x79, 0x70, 0x70, 0x56, 0x7f,
-    0x9f, 0x70, 0x79, 0x60, 0x70, 0x86, 0x4e, 0x4e, 0x77, 0x4e, 0x4e, 0x5e,
-    0x6c, 0x96, 0x96, 0x70, 0x5e, 0x5b, 0x5d, 0x70, 0x96, 0x90, 0x5b, 0x3e,
-    0x48, 0x50, 0x45, 0x70, 0x78, 0x50, 0x91, 0xa7, 0x6c, 0x48, 0x56, 0x7b,
-    0x7b, 0x51, 0x58, 0x4d, 0x3a, 0x85, 0x9a, 0x89, 0x58, 0x3a, 0x58, 0x5b,
-    0x3c, 0x1f, 0x47, 0x4d, 0x58, 0x58, 0x8a, 0x58, 0x36, 0x3f, 0x4d, 0x58,
-    0x75, 0x26, 0x06, 0x0a, 0x39, 0x46, 0x47, 0x3c, 0x1a, 0x14, 0x31, 0x52,
-    0x2d, 0x12, 0x26, 0x20, 0x4f, 0x38, 0x0d, 0x11, 0x17, 0x11, 0x11, 0x1e,
-    0x2b, 0x4f, 0x2e, 0x11, 0x11, 0x1e, 0x1e, 0x44, 0x62, 0x1b, 0x07, 0x08,
-    0x0f, 0x08, 0x11, 0x31, 0x0e, 0x11, 0x62, 0x40, 0x0f, 0x0f, 0x2e, 0x38,
-    0x0a, 0x06, 0x09, 0x0e, 0x1c, 0x4f, 0x4b, 0x35, 0x03, 0x07, 0x17, 0x08,
-    0x0f, 0x0c, 0x0f, 0x0a, 0x07, 0x2e, 0x46, 0x0e, 0x08, 0x0a, 0x25, 0x3d,
-    0x1e, 0x00, 0x00, 0x0e, 0x11, 0x17, 0x1c, 0x11, 0x0e, 0x08, 0x1e, 0x18,
-    0x17, 0x37, 0x12, 0x17, 0x1e, 0x1e, 0x18, 0x00, 0x00, 0x08, 0x1b, 0x07,
-    0x02, 0x00, 0x02, 0x05, 0x0a, 0x0a, 0x1e, 0x0a, 0x11, 0x2e, 0x0a, 0x00,
-    0x18, 0x0f, 0x03, 0x0f, 0x07, 0x08, 0x0e, 0x3d, 0x4c, 0x14, 0x09, 0x18,
-    0x18, 0x0e, 0x28, 0x18, 0x12, 0x14, 0x06, 0x00, 0x06, 0x00, 0x0e, 0x09,
-    0x06, 0x14, 0x0a, 0x10, 0x14, 0x28, 0x20, 0x12, 0x28, 0x28, 0x2d, 0x4d,
-    0x3a, 0x75, 0x5f, 0x26, 0x12, 0x2e, 0x67, 0x67, 0x47, 0x5f, 0x47, 0x47,
-    0x6d, 0x75, 0x58, 0x28, 0x58, 0x66, 0x27, 0x14, 0x27, 0x6c, 0x2f, 0x1a,
-    0x27, 0x12, 0x1d, 0x3e, 0x51, 0x4e, 0x4e, 0x58, 0x6c, 0x63, 0x26, 0x3a,
-    0x5d, 0x4d, 0x3e, 0x56, 0x48, 0x56, 0x6c, 0x7f, 0x78, 0x4e, 0x4e, 0x6c,
-    0x5b, 0x5d, 0x7f, 0x78, 0x60, 0x50, 0x45, 0x45, 0x50, 0x3e, 0x3e, 0x34,
-    0x4e, 0x4e, 0x60, 0x5e, 0x5e, 0x70, 0x48, 0x78, 0x65, 0x7f, 0x81, 0x81,
-    0x9d, 0x99, 0x91, 0x65, 0x65, 0x54, 0xa0, 0x91, 0x70, 0x91, 0x79, 0x8e,
-    0x99, 0x8e, 0x70, 0x70, 0x91, 0x65, 0x5b, 0x4e, 0x8e, 0x91, 0x50, 0x54,
-    0x54, 0x48, 0x54, 0x7f, 0x73, 0x91, 0x65, 0x81, 0x91, 0x54, 0x45, 0x81,
-    0x65, 0x54, 0x60, 0x70, 0x60, 0x65, 0x91, 0x79, 0x57, 0x60, 0x65, 0x70,
-    0x4e, 0x85, 0x7f, 0x65, 0x50, 0x45, 0x48, 0x3e, 0x45, 0x48, 0x3a, 0x45,
-    0x4e, 0x4e, 0x56, 0x5d, 0x5e, 0x34, 0x56, 0x5d, 0x5b, 0x70, 0x78, 0x7f,
-    0x91, 0x70, 0x4e, 0x4e, 0x48, 0x85, 0x93, 0x5d, 0x5d, 0x51, 0x58, 0x89,
-    0x85, 0x51, 0x3c, 0x5d, 0x5b, 0x27, 0x10, 0x4d, 0x63, 0x1f, 0x1d, 0x36,
-    0x12, 0x10, 0x3c, 0x47, 0x52, 0x3a, 0x3f, 0x52, 0x38, 0x07, 0x1a, 0x47,
-    0x12, 0x12, 0x1d, 0x0d, 0x1f, 0x47, 0x5f, 0x26, 0x1d, 0x1a, 0x31, 0x14,
-    0x31, 0x44, 0x31, 0x26, 0x09, 0x04, 0x06, 0x06, 0x06, 0x0a, 0x0e, 0x0d,
-    0x0e, 0x06, 0x14, 0x1e, 0x0e, 0x0f, 0x18, 0x17, 0x14, 0x1e, 0x11, 0x37,
-    0x40, 0x11, 0x08, 0x13, 0x2b, 0x2e, 0x1b, 0x2b, 0x0a, 0x06, 0x31, 0x37,
-    0x17, 0x17, 0x0a, 0x1c, 0x08, 0x00, 0x00, 0x11, 0x17, 0x02, 0x02, 0x02,
-    0x02, 0x0f, 0x0e, 0x0f, 0x0c, 0x0f, 0x1c, 0x18, 0x02, 0x07, 0x0a, 0x08,
-    0x08, 0x0f, 0x0c, 0x03, 0x25, 0x37, 0x14, 0x08, 0x03, 0x0e, 0x06, 0x02,
-    0x02, 0x00, 0x0f, 0x38, 0x1e, 0x00, 0x11, 0x4b, 0x0e, 0x03, 0x1c, 0x0e,
-    0x11, 0x11, 0x0e, 0x0f, 0x07, 0x08, 0x1c, 0x4b, 0x61, 0x1e, 0x0e, 0x1c,
-    0x0f, 0x2e, 0x4f, 0x38, 0x38, 0x28, 0x40, 0x40, 0x17, 0x0e, 0x06, 0x11,
-    0x17, 0x0e, 0x1e, 0x1e, 0x12, 0x13, 0x0d, 0x25, 0x11, 0x1d, 0x47, 0x2e,
-    0x0d, 0x18, 0x3c, 0x5f, 0x67, 0x2d, 0x12, 0x1a, 0x1d, 0x14, 0x36, 0x36,
-    0x10, 0x12, 0x47, 0x33, 0x3c, 0x52, 0x3c, 0x28, 0x3a, 0x3f, 0x1a, 0x27,
-    0x26, 0x36, 0x89, 0x89, 0x27, 0x4d, 0x78, 0x5d, 0x1f, 0x58, 0x5b, 0x51,
-    0x48, 0x4d, 0x4d, 0x48, 0x2f, 0x3a, 0x89, 0x9a, 0x97, 0x66, 0x66, 0x5d,
-    0x5e, 0xa7, 0x96, 0x91, 0x96, 0x93, 0x85, 0x70, 0x60, 0x3e, 0x4e, 0x70,
-    0x5e, 0x5e, 0x60, 0x65, 0x54, 0x60, 0x70, 0x4e, 0x5e, 0x81, 0x70, 0x5e,
-    0x54, 0x7f, 0x9a, 0x9a, 0x96, 0x70, 0x7f, 0x65, 0x70, 0x65, 0x91, 0x60,
-    0x45, 0x73, 0x73, 0x70, 0x86, 0x7f, 0x54, 0x65, 0x65, 0x54, 0x54, 0x54,
-    0x5e, 0x91, 0x9d, 0x81, 0x70, 0x8e, 0xac, 0x4e, 0x54, 0x99, 0x90, 0x65,
-    0x70, 0x5e, 0x5a, 0x65, 0x4e, 0x70, 0xb1, 0xac, 0x84, 0x70, 0x65, 0x60,
-    0x9f, 0xab, 0x9f, 0x9f, 0x9f, 0x91, 0x84, 0x70, 0x48, 0x34, 0x7f, 0x70,
-    0x60, 0x60, 0x7f, 0x57, 0x70, 0x5e, 0x5e, 0x4e, 0x7f, 0x85, 0x5d, 0x48,
-    0x5e, 0x6c, 0x97, 0x85, 0x51, 0x5d, 0x6c, 0x5d, 0x45, 0x5d, 0x4e, 0x4d,
-    0x48, 0x4e, 0x5b, 0x63, 0x7b, 0x48, 0x34, 0x58, 0x3a, 0x27, 0x2f, 0x32,
-    0x48, 0x85, 0x5d, 0x27, 0x51, 0x89, 0x3a, 0x18, 0x58, 0x5f, 0x47, 0x47,
-    0x28, 0x1a, 0x2f, 0x28, 0x28, 0x5f, 0xb3, 0x5f, 0x26, 0x26, 0x28, 0x47,
-    0x7b, 0x58, 0x5f, 0x67, 0x58, 0x67, 0x28, 0x20, 0x06, 0x0d, 0x12, 0x11,
-    0x12, 0x1d, 0x1d, 0x14, 0x18, 0x1a, 0x0f, 0x1e, 0x37, 0x0a, 0x08, 0x11,
-    0x0a, 0x2d, 0x61, 0x2e, 0x0e, 0x11, 0x06, 0x06, 0x1e, 0x1e, 0x00, 0x08,
-    0x25, 0x17, 0x0a, 0x28, 0x1e, 0x08, 0x0e, 0x0a, 0x06, 0x02, 0x00, 0x00,
-    0x2e, 0x37, 0x08, 0x00, 0x38, 0x37, 0x03, 0x0f, 0x18, 0x07, 0x0a, 0x07,
-    0x08, 0x0f, 0x07, 0x05, 0x1b, 0x61, 0x4b, 0x08, 0x17, 0x1c, 0x1c, 0x1e,
-    0x25, 0x2e, 0x25, 0x37, 0x02, 0x08, 0x2e, 0x1e, 0x1c, 0x1c, 0x17, 0x37,
-    0x1c, 0x04, 0x14, 0x18, 0x08, 0x0c, 0x1c, 0x03, 0x00, 0x00, 0x06, 0x11,
-    0x08, 0x08, 0x2b, 0x2b, 0x0f, 0x0f, 0x18, 0x40, 0x31, 0x14, 0x0a, 0x00,
-    0x0a, 0x0e, 0x0a, 0x0a, 0x13, 0x25, 0x4f, 0x0e, 0x25, 0x61, 0x4b, 0x40,
-    0x14, 0x09, 0x06, 0x1d, 0x31, 0x28, 0x38, 0x1d, 0x12, 0x1a, 0x3c, 0x12,
-    0x06, 0x1d, 0x58, 0x1d, 0x10, 0x31, 0x1f, 0x26, 0x1f, 0x47, 0x58, 0x47,
-    0x12, 0x1d, 0x47, 0x1d, 0x1a, 0x79, 0x6c, 0x43, 0x7b, 0x63, 0x72, 0x75,
-    0x43, 0x3e, 0x78, 0x51, 0x3a, 0x6a, 0x58, 0x27, 0x26, 0x3e, 0x3a, 0x33,
-    0x3a, 0x5b, 0x85, 0x43, 0x31, 0x56, 0x93, 0x85, 0x6c, 0x4e, 0x3e, 0x3a,
-    0x48, 0x4e, 0x70, 0x56, 0x5d, 0x91, 0x91, 0x70, 0x9f, 0x9f, 0x91, 0x5e,
-    0x4e, 0x4e, 0x5e, 0x79, 0x54, 0x7f, 0x7f, 0x54, 0x70, 0x7f, 0x6a, 0x3a,
-    0x4e, 0x91, 0x7f, 0x4e, 0x77, 0x5a, 0x70, 0x54, 0x65, 0x99, 0x91, 0x70,
-    0x4e, 0x5e, 0x65, 0x4e, 0x81, 0x9d, 0x99, 0x9f, 0x91, 0x95, 0x9d, 0x9d,
-    0x64, 0x84, 0x90, 0x5a, 0x7f, 0x84, 0x54, 0x4e, 0x54, 0x77, 0x4e, 0x5e,
-    0x7f, 0x9f, 0x91, 0x4e, 0x54, 0x84, 0x9f, 0x91, 0x65, 0x4e, 0x3e, 0x48,
-    0x60, 0x70, 0x60, 0x4e, 0x73, 0x9f, 0x79, 0x91, 0x9f, 0x9f, 0x65, 0x50,
-    0x54, 0x50, 0x79, 0x70, 0x70, 0x60, 0x5d, 0x4e, 0x60, 0x4e, 0x27, 0x2f,
-    0x5d, 0x78, 0x3e, 0x56, 0x5d, 0x48, 0x48, 0x5b, 0x93, 0x89, 0x48, 0x3a,
-    0x3a, 0x56, 0x3a, 0x3a, 0x85, 0x6c, 0x66, 0x8a, 0x6a, 0x85, 0x63, 0x4d,
-    0x48, 0x66, 0x3a, 0x3a, 0x66, 0x36, 0x12, 0x12, 0x36, 0x31, 0x1d, 0x1f,
-    0x47, 0x5f, 0x28, 0x0d, 0x52, 0x7b, 0x53, 0x33, 0x1a, 0x09, 0x06, 0x14,
-    0x1d, 0x2e, 0x1d, 0x1a, 0x67, 0x3c, 0x31, 0x5f, 0x4f, 0x4c, 0x1e, 0x0a,
-    0x14, 0x18, 0x28, 0x2e, 0x40, 0x11, 0x06, 0x09, 0x13, 0x06, 0x00, 0x08,
-    0x1d, 0x08, 0x0e, 0x0a, 0x06, 0x17, 0x11, 0x37, 0x4f, 0x17, 0x08, 0x0f,
-    0x0a, 0x08, 0x00, 0x1e, 0x2b, 0x0c, 0x21, 0x1c, 0x1c, 0x2e, 0x04, 0x06,
-    0x37, 0x13, 0x0a, 0x1e, 0x0a, 0x00, 0x02, 0x00, 0x0f, 0x0f, 0x02, 0x0f,
-    0x2e, 0x0a, 0x0f, 0x0f, 0x35, 0x1b, 0x17, 0x0f, 0x02, 0x00, 0x08, 0x03,
-    0x1c, 0x0a, 0x0a, 0x0f, 0x0c, 0x0c, 0x07, 0x00, 0x0a, 0x2b, 0x3d, 0x00,
-    0x17, 0x1b, 0x08, 0x21, 0x17, 0x06, 0x1d, 0x4c, 0x0a, 0x08, 0x0a, 0x06,
-    0x0a, 0x0a, 0x17, 0x08, 0x06, 0x11, 0x0a, 0x08, 0x07, 0x06, 0x03, 0x14,
-    0x4c, 0x28, 0x25, 0x2e, 0x25, 0x12, 0x11, 0x0a, 0x17, 0x40, 0x12, 0x06,
-    0x36, 0x1d, 0x06, 0x12, 0x3a, 0x2f, 0x47, 0x2d, 0x26, 0x1a, 0x31, 0x66,
-    0x47, 0x12, 0x47, 0x8a, 0x7b, 0x26, 0x14, 0x12, 0x7b, 0x43, 0x47, 0x58,
-    0x5f, 0x3c, 0x1a, 0x4c, 0x47, 0x20, 0x1f, 0x34, 0x78, 0x85, 0x34, 0x48,
-    0x85, 0x43, 0x47, 0x5f, 0x48, 0x60, 0x86, 0x5b, 0x48, 0x45, 0x4e, 0x58,
-    0x43, 0x5b, 0x51, 0x48, 0x70, 0x56, 0x4e, 0x3a, 0x33, 0x34, 0x4e, 0x96,
-    0x91, 0x79, 0x7f, 0x70, 0x4e, 0x70, 0x5e, 0x56, 0x7f, 0x64, 0x54, 0x81,
-    0x65, 0x45, 0x5e, 0x73, 0x65, 0x77, 0x70, 0x65, 0x5a, 0x65, 0x74, 0x74,
-    0x70, 0x70, 0xac, 0xac, 0x84, 0x4e, 0x4e, 0x90, 0x9f, 0x79, 0x91, 0x91,
-    0x84, 0x60, 0x70, 0x7f, 0x4e, 0x4a, 0x70, 0x8e, 0xaf, 0x91, 0x5e, 0x9f,
-    0x84, 0x7f, 0x7f, 0x70, 0x73, 0xac, 0x91, 0x4e, 0x70, 0x73, 0x73, 0x70,
-    0x65, 0x77, 0x4e, 0x70, 0x70, 0x70, 0x54, 0x41, 0x4a, 0x4e, 0x77, 0xa7,
-    0x81, 0x65, 0x65, 0x57, 0x4e, 0x60, 0x4e, 0x85, 0x7f, 0x57, 0x79, 0x91,
-    0x4e, 0x48, 0x60, 0x65, 0x77, 0x70, 0x5e, 0x4e, 0x45, 0x60, 0x73, 0x5b,
-    0x51, 0x85, 0xa0, 0x93, 0x3e, 0x26, 0x51, 0x96, 0x5d, 0x63, 0x75, 0x66,
-    0x36, 0x33, 0x58, 0x3a, 0x26, 0x26, 0x58, 0x78, 0x89, 0x27, 0x43, 0x5d,
-    0x2d, 0x47, 0x47, 0x26, 0x67, 0x72, 0x1d, 0x15, 0x36, 0x1f, 0x26, 0x36,
-    0x36, 0x2d, 0x1d, 0x1f, 0x1d, 0x28, 0x04, 0x08, 0x10, 0x31, 0x5f, 0x40,
-    0x2f, 0x3a, 0x2d, 0x1e, 0x14, 0x17, 0x2e, 0x3f, 0x1e, 0x0a, 0x26, 0x18,
-    0x08, 0x0e, 0x11, 0x1e, 0x25, 0x14, 0x09, 0x04, 0x08, 0x25, 0x31, 0x25,
-    0x17, 0x40, 0x4c, 0x0a, 0x08, 0x02, 0x1e, 0x1b, 0x1c, 0x2e, 0x1b, 0x0a,
-    0x0f, 0x05, 0x0c, 0x0c, 0x02, 0x06, 0x14, 0x38, 0x1e, 0x00, 0x2b, 0x08,
-    0x08, 0x1c, 0x0f, 0x17, 0x35, 0x18, 0x08, 0x08, 0x03, 0x08, 0x08, 0x13,
-    0x0a, 0x00, 0x06, 0x08, 0x03, 0x02, 0x02, 0x02, 0x0a, 0x0a, 0x0f, 0x03,
-    0x03, 0x0c, 0x1c, 0x0f, 0x17, 0x1e, 0x0e, 0x13, 0x35, 0x0a, 0x0f, 0x0c,
-    0x11, 0x37, 0x20, 0x1e, 0x1e, 0x1e, 0x13, 0x04, 0x0e, 0x11, 0x37, 0x14,
-    0x20, 0x1d, 0x1e, 0x2e, 0x4b, 0x61, 0x38, 0x09, 0x0e, 0x08, 0x11, 0x38,
-    0x40, 0x1e, 0x00, 0x0e, 0x29, 0x1a, 0x1e, 0x12, 0x1d, 0x26, 0x0a, 0x3c,
-    0x52, 0x06, 0x1d, 0x61, 0x4f, 0x3c, 0x3a, 0x3c, 0x47, 0x4d, 0x27, 0x31,
-    0x3c, 0x33, 0x3c, 0x47, 0x47, 0x1a, 0x12, 0x3c, 0x3a, 0x28, 0x25, 0x1d,
-    0x3c, 0x5f, 0x4d, 0x3e, 0x70, 0x6c, 0x66, 0x6a, 0x5b, 0x2f, 0x26, 0x4d,
-    0x4e, 0x86, 0x70, 0x70, 0x70, 0x6c, 0x4e, 0x56, 0x70, 0x91, 0x70, 0x7f,
-    0x70, 0x5e, 0x60, 0x7f, 0x91, 0x90, 0x70, 0x4e, 0x45, 0x4e, 0x65, 0x91,
-    0x7f, 0x56, 0x2f, 0x78, 0x7f, 0x60, 0x64, 0x65, 0x73, 0x57, 0x73, 0x9f,
-    0x5e, 0x4e, 0x84, 0x9f, 0x84, 0x65, 0x65, 0x84, 0x99, 0x91, 0x70, 0x65,
-    0x65, 0x65, 0x70, 0x65, 0x73, 0x60, 0x70, 0x65, 0x65, 0x70, 0x4e, 0x5a,
-    0x96, 0x7f, 0x65, 0x99, 0x99, 0x81, 0x9f, 0x99, 0x7f, 0x60, 0x70, 0x73,
-    0x91, 0x8e, 0x7f, 0x91, 0x95, 0x7f, 0x54, 0x73, 0x9f, 0x9f, 0x91, 0x8e,
-    0x65, 0x73, 0x8e, 0x9f, 0xac, 0x90, 0x70, 0x70, 0x57, 0x70, 0x91, 0x91,
-    0x65, 0x41, 0x60, 0x7f, 0x5e, 0x65, 0x65, 0x73, 0x70, 0x60, 0x76, 0x70,
-    0x34, 0x60, 0x91, 0x79, 0x60, 0x5e, 0x5d, 0x70, 0x79, 0x4e, 0x56, 0x4e,
-    0x5b, 0x56, 0x5b, 0x5d, 0x4d, 0x32, 0x56, 0x53, 0x3c, 0x26, 0x33, 0x3e,
-    0x5d, 0x3a, 0x58, 0x78, 0x56, 0x5d, 0x63, 0x43, 0x15, 0x28, 0x33, 0x52,
-    0x5c, 0x47, 0x5f, 0x53, 0x47, 0x20, 0x27, 0x58, 0x66, 0x63, 0x4d, 0x36,
-    0x1f, 0x47, 0x58, 0x7b, 0x67, 0x2d, 0x12, 0x1d, 0x12, 0x26, 0x4f, 0x1a,
-    0x0a, 0x06, 0x26, 0x2e, 0x12, 0x18, 0x18, 0x2e, 0x06, 0x18, 0x31, 0x04,
-    0x00, 0x28, 0x40, 0x25, 0x1e, 0x12, 0x17, 0x2e, 0x25, 0x0a, 0x0e, 0x0a,
-    0x08, 0x08, 0x0c, 0x06, 0x03, 0x08, 0x0f, 0x07, 0x08, 0x02, 0x03, 0x1c,
-    0x0c, 0x0a, 0x1e, 0x12, 0x08, 0x18, 0x1e, 0x08, 0x0a, 0x0f, 0x0a, 0x25,
-    0x17, 0x1e, 0x13, 0x06, 0x00, 0x08, 0x0a, 0x14, 0x1e, 0x14, 0x0d, 0x13,
-    0x17, 0x1e, 0x4b, 0x35, 0x0d, 0x1e, 0x62, 0x37, 0x08, 0x1e, 0x12, 0x08,
-    0x0e, 0x08, 0x0f, 0x0f, 0x00, 0x00, 0x3d, 0x37, 0x08, 0x0a, 0x0f, 0x17,
-    0x17, 0x1e, 0x17, 0x0f, 0x17, 0x08, 0x0d, 0x20, 0x0b, 0x11, 0x28, 0x28,
-    0x47, 0x3d, 0x17, 0x14, 0x1e, 0x17, 0x0f, 0x12, 0x1e, 0x44, 0x5c, 0x52,
-    0x12, 0x26, 0x61, 0x28, 0x08, 0x1e, 0x52, 0x31, 0x31, 0x25, 0x12, 0x0d,
-    0x4c, 0x4f, 0x1d, 0x1e, 0x28, 0x1a, 0x18, 0x13, 0x1a, 0x3a, 0x63, 0x58,
-    0x28, 0x26, 0x6c, 0x63, 0x58, 0x89, 0x85, 0x2f, 0x3a, 0x89, 0x58, 0x48,
-    0x45, 0x2f, 0x44, 0x33, 0x48, 0x86, 0x90, 0x70, 0x5b, 0x63, 0x56, 0x7f,
-    0x5e, 0x56, 0x60, 0x5e, 0x60, 0x5e, 0x56, 0x60, 0x57, 0x64, 0x65, 0x81,
-    0x91, 0x70, 0x70, 0x5e, 0x4e, 0x78, 0x86, 0x5d, 0x96, 0x90, 0x9f, 0x65,
-    0x5a, 0x9f, 0x91, 0x54, 0x57, 0x73, 0x81, 0x78, 0x70, 0x5e, 0x54, 0x5a,
-    0x90, 0x84, 0x5e, 0x5e, 0x65, 0x5e, 0x5a, 0x65, 0x65, 0x8e, 0x99, 0x65,
-    0x57, 0x99, 0xa2, 0x6e, 0x9f, 0xaf, 0x84, 0x65, 0x9d, 0x99, 0x81, 0x81,
-    0x65, 0x57, 0x5a, 0x65, 0x8e, 0xaa, 0x98, 0x84, 0x73, 0x65, 0x8e, 0x9d,
-    0x73, 0x81, 0x91, 0x91, 0x81, 0x70, 0x6e, 0x81, 0x74, 0x8b, 0x8e, 0x99,
-    0x91, 0x7f, 0x7f, 0x54, 0x70, 0x79, 0x60, 0x73, 0x91, 0x9f, 0x84, 0x70,
-    0x91, 0x9f, 0x70, 0x4e, 0x60, 0x7f, 0x6c, 0x5b, 0x79, 0x41, 0x4a, 0x70,
-    0x85, 0x5b, 0x56, 0x5d, 0x56, 0x56, 0x56, 0x58, 0x6c, 0x7f, 0x70, 0x3a,
-    0x50, 0x91, 0x60, 0x4e, 0x96, 0x7f, 0x34, 0x4e, 0x7f, 0x48, 0x58, 0x58,
-    0x1f, 0x31, 0x33, 0x3e, 0x6a, 0x85, 0x5b, 0x33, 0x1f, 0x3c, 0x58, 0x3a,
-    0x3a, 0x36, 0x3a, 0x3a, 0x3c, 0x2f, 0x2f, 0x2f, 0x58, 0x52, 0x5f, 0x3a,
-    0x2d, 0x2e, 0x17, 0x1e, 0x18, 0x17, 0x12, 0x44, 0x4f, 0x53, 0x28, 0x31,
-    0x5c, 0x25, 0x06, 0x0a, 0x28, 0x14, 0x18, 0x11, 0x11, 0x0e, 0x1e, 0x31,
-    0x11, 0x0a, 0x19, 0x0e, 0x08, 0x00, 0x02, 0x0a, 0x1e, 0x28, 0x17, 0x08,
-    0x1e, 0x25, 0x11, 0x37, 0x4f, 0x0a, 0x08, 0x25, 0x06, 0x06, 0x06, 0x0e,
-    0x0c, 0x08, 0x00, 0x13, 0x37, 0x1e, 0x0f, 0x0f, 0x17, 0x18, 0x08, 0x13,
-    0x0e, 0x17, 0x11, 0x0a, 0x08, 0x08, 0x04, 0x0b, 0x1e, 0x28, 0x40, 0x1c,
-    0x05, 0x02, 0x0a, 0x19, 0x25, 0x17, 0x00, 0x0a, 0x17, 0x08, 0x08, 0x18,
-    0x2b, 0x13, 0x08, 0x08, 0x0a, 0x1c, 0x35, 0x17, 0x07, 0x02, 0x0d, 0x37,
-    0x37, 0x06, 0x08, 0x08, 0x12, 0x1d, 0x20, 0x38, 0x14, 0x0e, 0x0e, 0x18,
-    0x1e, 0x1d, 0x11, 0x00, 0x08, 0x17, 0x14, 0x12, 0x1f, 0x12, 0x08, 0x00,
-    0x28, 0x52, 0x44, 0x4f, 0x4c, 0x14, 0x14, 0x1d, 0x28, 0x28, 0x26, 0x58,
-    0x63, 0x5f, 0x44, 0x28, 0x12, 0x1a, 0x2d, 0x1a, 0x14, 0x27, 0x4d, 0x33,
-    0x27, 0x48, 0x5b, 0x63, 0x5d, 0x34, 0x34, 0x56, 0x3a, 0x15, 0x4c, 0x75,
-    0x78, 0x70, 0x56, 0x3a, 0x5e, 0x78, 0x56, 0x4e, 0x3e, 0x5b, 0x6a, 0x7f,
-    0x85, 0x3e, 0x45, 0x60, 0x65, 0x65, 0x9d, 0x5e, 0x50, 0x4e, 0x70, 0x86,
-    0x79, 0x60, 0x41, 0x48, 0x50, 0x5e, 0x5e, 0x7f, 0x5a, 0x5e, 0x41, 0x70,
-    0x8e, 0x84, 0x84, 0x91, 0x70, 0x4e, 0x54, 0x84, 0x5a, 0x78, 0x90, 0x95,
-    0x91, 0x81, 0x70, 0x4e, 0x4e, 0x4e, 0x5e, 0x60, 0x4e, 0x5a, 0x65, 0x54,
-    0x81, 0x99, 0xab, 0x99, 0x6e, 0x65, 0x84, 0x81, 0x4e, 0x54, 0x84, 0x99,
-    0x74, 0x8e, 0x65, 0x81, 0x9d, 0x91, 0x81, 0x57, 0x5a, 0x84, 0x99, 0x9f,
-    0x65, 0x65, 0x65, 0x73, 0x74, 0x99, 0x74, 0x5a, 0x54, 0x70, 0x91, 0x91,
-    0x70, 0x6c, 0x45, 0x45, 0x60, 0x5e, 0x77, 0x5a, 0x54, 0x45, 0x4a, 0x73,
-    0x90, 0x7f, 0x96, 0x70, 0x4e, 0x56, 0x4e, 0x6c, 0x5d, 0x78, 0x96, 0x7f,
-    0x78, 0x78, 0x48, 0x3a, 0x4d, 0x45, 0x56, 0x3a, 0x48, 0x56, 0x48, 0x56,
-    0x70, 0x86, 0x85, 0x5b, 0x34, 0x3e, 0x5b, 0x33, 0x14, 0x58, 0x63, 0x56,
-    0x56, 0x3a, 0x33, 0x58, 0x53, 0x36, 0x26, 0x1d, 0x3e, 0x48, 0x56, 0x2d,
-    0x1f, 0x2f, 0x33, 0x26, 0x48, 0x75, 0x2d, 0x12, 0x11, 0x28, 0x40, 0x1e,
-    0x18, 0x11, 0x06, 0x0d, 0x0d, 0x1d, 0x1d, 0x13, 0x0e, 0x00, 0x11, 0x40,
-    0x4c, 0x1e, 0x1e, 0x0a, 0x0a, 0x0a, 0x11, 0x0a, 0x0a, 0x28, 0x46, 0x25,
-    0x19, 0x0e, 0x06, 0x06, 0x08, 0x08, 0x08, 0x08, 0x14, 0x0e, 0x08, 0x0a,
-    0x11, 0x28, 0x14, 0x06, 0x00, 0x17, 0x0e, 0x00, 0x08, 0x25, 0x18, 0x0d,
-    0x08, 0x0a, 0x18, 0x1c, 0x1c, 0x0a, 0x00, 0x0a, 0x11, 0x2b, 0x13, 0x0e,
-    0x08, 0x0e, 0x08, 0x11, 0x17, 0x17, 0x03, 0x02, 0x08, 0x08, 0x00, 0x02,
-    0x0f, 0x0f, 0x08, 0x11, 0x08, 0x08, 0x0f, 0x07, 0x11, 0x06, 0x04, 0x00,
-    0x08, 0x0a, 0x1b, 0x25, 0x0a, 0x00, 0x08, 0x1e, 0x11, 0x01, 0x00, 0x04,
-    0x18, 0x0e, 0x08, 0x28, 0x11, 0x11, 0x13, 0x03, 0x00, 0x0a, 0x1e, 0x1e,
-    0x0e, 0x0a, 0x28, 0x1d, 0x31, 0x3c, 0x12, 0x18, 0x3f, 0x28, 0x12, 0x14,
-    0x1e, 0x52, 0x58, 0x1d, 0x06, 0x67, 0x58, 0x12, 0x12, 0x1a, 0x1e, 0x26,
-    0x63, 0x52, 0x12, 0x3a, 0x75, 0x3a, 0x14, 0x12, 0x47, 0x2f, 0x26, 0x43,
-    0x3a, 0x32, 0x48, 0x32, 0x58, 0x63, 0x58, 0x58, 0x34, 0x34, 0x48, 0x45,
-    0x51, 0x66, 0x85, 0x45, 0x3e, 0x45, 0x4e, 0x4e, 0x41, 0x56, 0x5d, 0x48,
-    0x79, 0x45, 0x70, 0x65, 0x60, 0x65, 0x54, 0x34, 0x4e, 0x70, 0x5e, 0x70,
-    0x4e, 0x5e, 0x7f, 0x65, 0x84, 0x70, 0x54, 0x8e, 0x73, 0x70, 0x65, 0x70,
-    0x84, 0x99, 0x91, 0x60, 0x5a, 0x99, 0x70, 0x57, 0x65, 0x50, 0x54, 0x8e,
-    0x99, 0x64, 0x65, 0x99, 0x99, 0x65, 0x60, 0x65, 0x65, 0x54, 0x65, 0x5a,
-    0x70, 0x84, 0x73, 0x70, 0x84, 0x84, 0x91, 0x65, 0x69, 0x74, 0x81, 0x65,
-    0x7f, 0x91, 0x91, 0x65, 0x65, 0x81, 0x69, 0x65, 0x70, 0x73, 0x57, 0x65,
-    0x65, 0x64, 0x9f, 0x65, 0x65, 0x65, 0x60, 0x54, 0x7f, 0x79, 0x70, 0x5e,
-    0x5e, 0x5e, 0x7f, 0x91, 0x73, 0x54, 0x70, 0x90, 0x70, 0x4e, 0x5b, 0x70,
-    0x96, 0x9d, 0x4a, 0x45, 0x84, 0x85, 0x2f, 0x4e, 0x41, 0x3e, 0x60, 0x7f,
-    0x5e, 0x48, 0x6c, 0x86, 0x5b, 0x33, 0x2f, 0x4e, 0x34, 0x34, 0x5d, 0x3e,
-    0x3a, 0x51, 0x3a, 0x5f, 0x5d, 0x5f, 0x2f, 0x33, 0x27, 0x33, 0x3a, 0x33,
-    0x53, 0x58, 0x2f, 0x1a, 0x26, 0x3a, 0x2f, 0x12, 0x27, 0x27, 0x28, 0x26,
-    0x12, 0x53, 0x3c, 0x2d, 0x28, 0x06, 0x08, 0x12, 0x1d, 0x11, 0x12, 0x12,
-    0x28, 0x28, 0x18, 0x28, 0x14, 0x1e, 0x2e, 0x12, 0x08, 0x06, 0x17, 0x28,
-    0x2e, 0x0a, 0x00, 0x28, 0x35, 0x00, 0x00, 0x07, 0x08, 0x0a, 0x2b, 0x1e,
-    0x00, 0x1c, 0x4f, 0x25, 0x07, 0x03, 0x08, 0x00, 0x00, 0x0e, 0x0c, 0x08,
-    0x0f, 0x0c, 0x06, 0x0f, 0x0f, 0x0f, 0x11, 0x06, 0x04, 0x00, 0x03, 0x0a,
-    0x2e, 0x17, 0x03, 0x00, 0x0a, 0x0a, 0x07, 0x00, 0x06, 0x1e, 0x11, 0x07,
-    0x0a, 0x18, 0x08, 0x07, 0x2b, 0x0f, 0x02, 0x08, 0x2b, 0x4b, 0x1c, 0x1b,
-    0x1c, 0x0c, 0x1e, 0x0f, 0x0a, 0x0a, 0x0f, 0x1e, 0x18, 0x00, 0x08, 0x0a,
-    0x1e, 0x17, 0x08, 0x2e, 0x38, 0x25, 0x08, 0x02, 0x0a, 0x0a, 0x0a, 0x08,
-    0x08, 0x0a, 0x00, 0x06, 0x1e, 0x1e, 0x3d, 0x2e, 0x2b, 0x14, 0x11, 0x11,
-    0x2e, 0x3c, 0x4f, 0x3f, 0x2e, 0x28, 0x25, 0x26, 0x12, 0x38, 0x26, 0x28,
-    0x3c, 0x28, 0x18, 0x1d, 0x0d, 0x28, 0x5f, 0x3c, 0x3a, 0x2f, 0x47, 0x53,
-    0x58, 0x75, 0x5f, 0x5f, 0x58, 0x3a, 0x33, 0x6c, 0x9a, 0x85, 0x58, 0x63,
-    0x63, 0x75, 0x34, 0x58, 0x6c, 0x58, 0x5b, 0x7f, 0x4d, 0x2f, 0x56, 0x5b,
-    0x56, 0x48, 0x78, 0x7f, 0x85, 0x70, 0x41, 0x48, 0x48, 0x4a, 0x34, 0x48,
-    0x3e, 0x45, 0x60, 0x5a, 0x70, 0x85, 0x7f, 0x73, 0x7f, 0x5a, 0x54, 0x7f,
-    0x77, 0x84, 0x91, 0x84, 0x65, 0x73, 0x65, 0x5e, 0x5a, 0x84, 0x79, 0x99,
-    0x8e, 0x54, 0x70, 0x70, 0x54, 0x73, 0x84, 0x8b, 0x74, 0x8e, 0x94, 0x99,
-    0x9c, 0x94, 0x8c, 0x98, 0x84, 0x65, 0x98, 0xb1, 0xac, 0x91, 0x84, 0x91,
-    0x90, 0x91, 0x65, 0x8e, 0x6e, 0x65, 0x99, 0x81, 0x50, 0x7f, 0x65, 0x6e,
-    0x65, 0x81, 0x98, 0x99, 0x9f, 0x60, 0x60, 0x70, 0x54, 0x54, 0x4e, 0x4e,
-    0x65, 0x65, 0x65, 0x73, 0x91, 0x79, 0x57, 0x91, 0x65, 0x70, 0x65, 0x65,
-    0x73, 0x84, 0x91, 0x7f, 0x6a, 0x79, 0x60, 0x4e, 0x7f, 0x60, 0x70, 0x81,
-    0x50, 0x3e, 0x5d, 0x48, 0x5e, 0x78, 0x86, 0x6c, 0x60, 0x70, 0x78, 0x85,
-    0x85, 0x5d, 0x6c, 0x6a, 0x48, 0x50, 0x96, 0x9a, 0x78, 0x56, 0x75, 0x53,
-    0x63, 0x33, 0x58, 0x5d, 0x27, 0x66, 0x63, 0x1f, 0x1d, 0x26, 0x36, 0x4d,
-    0x2d, 0x58, 0x75, 0x5d, 0x2d, 0x14, 0x1d, 0x1d, 0x28, 0x0d, 0x04, 0x14,
-    0x12, 0x12, 0x36, 0x2e, 0x38, 0x12, 0x36, 0x31, 0x20, 0x1e, 0x14, 0x1d,
-    0x4f, 0x2e, 0x2e, 0x2b, 0x14, 0x1e, 0x06, 0x14, 0x1e, 0x17, 0x1e, 0x08,
-    0x08, 0x28, 0x0a, 0x07, 0x25, 0x0f, 0x0a, 0x18, 0x2e, 0x1e, 0x0f, 0x35,
-    0x35, 0x29, 0x1c, 0x08, 0x08, 0x17, 0x4b, 0x35, 0x25, 0x1c, 0x0a, 0x0f,
-    0x0a, 0x08, 0x0f, 0x17, 0x11, 0x14, 0x0a, 0x02, 0x08, 0x17, 0x14, 0x07,
-    0x1d, 0x38, 0x2b, 0x0a, 0x00, 0x07, 0x07, 0x05, 0x02, 0x00, 0x02, 0x03,
-    0x55, 0x1e, 0x02, 0x00, 0x07, 0x1c, 0x0f, 0x0f, 0x0f, 0x03, 0x02, 0x07,
-    0x11, 0x0e, 0x0a, 0x1e, 0x17, 0x0f, 0x0f, 0x1e, 0x38, 0x37, 0x1e, 0x13,
-    0x08, 0x08, 0x06, 0x25, 0x2e, 0x3f, 0x17, 0x0a, 0x4f, 0x4c, 0x14, 0x1d,
-    0x28, 0x11, 0x38, 0x4f, 0x44, 0x28, 0x14, 0x1e, 0x39, 0x28, 0x1e, 0x06,
-    0x04, 0x1d, 0x2e, 0x52, 0x67, 0x52, 0x2f, 0x78, 0x5d, 0x26, 0x97, 0x97,
-    0x89, 0x5f, 0x26, 0x1d, 0x12, 0x2d, 0x8a, 0x72, 0x3a, 0x31, 0x47, 0x97,
-    0x66, 0x18, 0x26, 0x3e, 0x43, 0x5d, 0x66, 0x3a, 0x1d, 0x1f, 0x48, 0x5d,
-    0x56, 0x48, 0x4e, 0x6c, 0x5d, 0x5b, 0x70, 0x7f, 0x65, 0x5e, 0x5e, 0x41,
-    0x48, 0x4e, 0x70, 0x96, 0x96, 0x7f, 0x4a, 0x86, 0xa7, 0x7f, 0x5e, 0x70,
-    0x60, 0x70, 0xa0, 0xac, 0x73, 0x54, 0x54, 0x79, 0x73, 0x65, 0x64, 0x4e,
-    0x5e, 0x73, 0x84, 0x9f, 0x9f, 0x79, 0xaf, 0xab, 0x73, 0xaa, 0xbc, 0xaf,
-    0xaf, 0x6e, 0x65, 0x65, 0x60, 0xab, 0xb1, 0x8e, 0x5a, 0x5e, 0xaf, 0xaf,
-    0x65, 0x70, 0x84, 0x81, 0x99, 0x9f, 0x90, 0x5e, 0x45, 0x65, 0x81, 0x81,
-    0x81, 0x81, 0x99, 0x8e, 0x73, 0x8e, 0x99, 0x99, 0x99, 0x84, 0x81, 0x65,
-    0x5a, 0x65, 0x9f, 0x9f, 0x9f, 0x65, 0x81, 0xb1, 0x9f, 0x5a, 0x84, 0x81,
-    0x79, 0x91, 0xac, 0x84, 0x70, 0x60, 0x65, 0x84, 0x7f, 0x65, 0x4e, 0x3e,
-    0x79, 0x7f, 0x91, 0x9f, 0x79, 0x91, 0xaf, 0x65, 0x91, 0xb1, 0xb1, 0x9f,
-    0x70, 0x4e, 0x56, 0x2f, 0x78, 0xa0, 0x6c, 0x5d, 0x3a, 0x66, 0xb3, 0x5d,
-    0x27, 0x48, 0x51, 0x58, 0x63, 0x5d, 0x47, 0x10, 0x1d, 0x48, 0x48, 0x3a,
-    0x3e, 0x5b, 0x51, 0x43, 0x3a, 0x51, 0x6a, 0x5d, 0x33, 0x3c, 0x26, 0x26,
-    0x26, 0x4d, 0x5f, 0x5f, 0x44, 0x1f, 0x5f, 0x58, 0x47, 0x3c, 0x3f, 0x2e,
-    0x47, 0x61, 0x5c, 0x28, 0x17, 0x1d, 0x26, 0x12, 0x1e, 0x06, 0x07, 0x17,
-    0x1e, 0x40, 0x5c, 0x4f, 0x2e, 0x4f, 0x4f, 0x17, 0x61, 0x8a, 0x7d, 0x37,
-    0x06, 0x06, 0x06, 0x0c, 0x61, 0x4f, 0x0f, 0x0f, 0x0f, 0x4b, 0x67, 0x02,
-    0x02, 0x0a, 0x0f, 0x1c, 0x0a, 0x0f, 0x05, 0x03, 0x00, 0x0a, 0x08, 0x08,
-    0x1e, 0x0f, 0x0a, 0x0c, 0x17, 0x1e, 0x37, 0x1e, 0x17, 0x08, 0x08, 0x08,
-    0x17, 0x1e, 0x16, 0x17, 0x07, 0x35, 0x35, 0x0f, 0x05, 0x07, 0x11, 0x2e,
-    0x1b, 0x08, 0x02, 0x03, 0x03, 0x0f, 0x0c, 0x1e, 0x25, 0x08, 0x00, 0x00,
-    0x08, 0x11, 0x17, 0x0a, 0x00, 0x00, 0x0e, 0x0e, 0x04, 0x00, 0x06, 0x0e,
-    0x08, 0x07, 0x0a, 0x2e, 0x52, 0x19, 0x25, 0x44, 0x04, 0x0e, 0x2e, 0x31,
-    0x47, 0x61, 0x52, 0x14, 0x1d, 0x11, 0x18, 0x4f, 0x31, 0x3c, 0x3a, 0x2e,
-    0x3a, 0x26, 0x47, 0x31, 0x33, 0x7b, 0x47, 0x2d, 0x47, 0x1d, 0x2d, 0x4d,
-    0x28, 0x26, 0x14, 0x28, 0x47, 0x5f, 0x53, 0x1f, 0x27, 0x3e, 0x78, 0x6c,
-    0x58, 0x1f, 0x12, 0x58, 0x75, 0x63, 0x5b, 0x4e, 0x4e, 0x56, 0x34, 0x48,
-    0x4e, 0x6c, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x48, 0x32, 0x4e, 0x60, 0x4e,
-    0x4d, 0x45, 0x70, 0x90, 0x7f, 0x70, 0x84, 0x77, 0x60, 0x91, 0x9f, 0x91,
-    0x99, 0xa7, 0x65, 0x5a, 0x70, 0x54, 0x91, 0x9f, 0x91, 0x95, 0x91, 0x99,
-    0x81, 0x91, 0x91, 0x65, 0xaf, 0xab, 0x73, 0x99, 0x73, 0x65, 0x99, 0x7f,
-    0x70, 0x70, 0x5e, 0x70, 0x84, 0x9f, 0x5a, 0x54, 0x65, 0x99, 0x99, 0x91,
-    0x70, 0x4a, 0x70, 0x99, 0x8e, 0x8e, 0x8b, 0x8e, 0x84, 0x65, 0x65, 0x73,
-    0x84, 0x84, 0x65, 0x81, 0x65, 0x73, 0x70, 0x54, 0x57, 0x84, 0x73, 0x70,
-    0x5e, 0x65, 0x8e, 0x9f, 0x79, 0x99, 0x9f, 0x57, 0x81, 0x99, 0x9f, 0x9f,
-    0xac, 0x90, 0x70, 0x54, 0x50, 0x73, 0x91, 0x85, 0x85, 0x90, 0x7f, 0x91,
-    0x70, 0x91, 0x4e, 0x91, 0xb1, 0x70, 0x70, 0x70, 0x56, 0x70, 0x7f, 0x4e,
-    0x48, 0x3e, 0x3e, 0x5e, 0x85, 0x6c, 0x3e, 0x34, 0x56, 0x70, 0x78, 0x58,
-    0x18, 0x1d, 0x5f, 0x66, 0x58, 0x56, 0x63, 0x48, 0x32, 0x27, 0x27, 0x3a,
-    0x43, 0x34, 0x33, 0x2f, 0x34, 0x2f, 0x1a, 0x12, 0x27, 0x2f, 0x14, 0x14,
-    0x10, 0x3c, 0x67, 0x44, 0x33, 0x5f, 0x28, 0x28, 0x4d, 0x43, 0x5c, 0x7b,
-    0x5c, 0x14, 0x14, 0x11, 0x12, 0x52, 0x44, 0x2e, 0x47, 0x28, 0x38, 0x2e,
-    0x18, 0x1e, 0x17, 0x5c, 0x40, 0x11, 0x25, 0x12, 0x0d, 0x1e, 0x11, 0x06,
-    0x05, 0x08, 0x03, 0x17, 0x18, 0x0a, 0x0f, 0x0a, 0x2b, 0x2e, 0x0f, 0x02,
-    0x02, 0x03, 0x0c, 0x17, 0x0c, 0x25, 0x14, 0x08, 0x06, 0x00, 0x03, 0x0c,
-    0x0a, 0x00, 0x00, 0x0e, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x03,
-    0x0a, 0x2b, 0x35, 0x0f, 0x01, 0x1e, 0x35, 0x0f, 0x02, 0x07, 0x08, 0x0c,
-    0x03, 0x08, 0x0f, 0x11, 0x11, 0x08, 0x08, 0x0a, 0x25, 0x1c, 0x11, 0x0e,
-    0x00, 0x06, 0x13, 0x0e, 0x08, 0x1e, 0x1e, 0x0e, 0x38, 0x2e, 0x31, 0x1e,
-    0x17, 0x0e, 0x14, 0x40, 0x39, 0x28, 0x38, 0x0e, 0x00, 0x19, 0x4f, 0x31,
-    0x06, 0x11, 0x1d, 0x4f, 0x7d, 0x67, 0x1a, 0x17, 0x1d, 0x26, 0x1a, 0x28,
-    0x3a, 0x12, 0x0a, 0x12, 0x1d, 0x36, 0x2f, 0x1a, 0x52, 0x75, 0x3a, 0x3c,
-    0x1f, 0x3a, 0x3e, 0x12, 0x5d, 0x96, 0x75, 0x1f, 0x28, 0x34, 0x66, 0x3a,
-    0x3a, 0x70, 0x5b, 0x48, 0x48, 0x48, 0x51, 0x4e, 0x70, 0x70, 0x7f, 0x45,
-    0x48, 0x60, 0x70, 0x70, 0x70, 0x73, 0x4e, 0x70, 0x73, 0x91, 0x7f, 0x70,
-    0x5e, 0x5e, 0x7f, 0x91, 0x91, 0x91, 0x65, 0x3e, 0x4e, 0x90, 0x90, 0x5a,
-    0x4e, 0x5e, 0x81, 0xaf, 0xac, 0x91, 0x69, 0x5a, 0x69, 0x65, 0x7f, 0x9f,
-    0x65, 0x54, 0x70, 0x69, 0x69, 0x81, 0x69, 0x81, 0xaa, 0x99, 0x81, 0x69,
-    0x69, 0x94, 0x64, 0x57, 0xab, 0xaf, 0x69, 0x5e, 0x65, 0x91, 0x91, 0x54,
-    0x81, 0x8b, 0x74, 0x81, 0x64, 0x81, 0x6e, 0x99, 0x99, 0x95, 0x84, 0x65,
-    0x7a, 0x84, 0x73, 0x73, 0x99, 0x90, 0x73, 0x99, 0x99, 0x9f, 0x84, 0x65,
-    0x70, 0x91, 0x9f, 0x99, 0x8b, 0x8e, 0x57, 0x4e, 0x7f, 0x9f, 0x73, 0x60,
-    0x60, 0x70, 0xa7, 0xb1, 0x9a, 0x7f, 0x5e, 0x5e, 0x5a, 0x54, 0x91, 0x70,
-    0x48, 0x45, 0x45, 0x4e, 0x70, 0x4a, 0x51, 0x7f, 0x96, 0x5e, 0x41, 0x32,
-    0x5e, 0x4e, 0x27, 0x78, 0x96, 0x5d, 0x2f, 0x33, 0x48, 0x5d, 0x26, 0x4d,
-    0x5d, 0x48, 0x58, 0x3a, 0x33, 0x3e, 0x6a, 0x56, 0x66, 0x51, 0x26, 0x34,
-    0x43, 0x33, 0x32, 0x48, 0x58, 0x26, 0x5f, 0x5f, 0x52, 0x3a, 0x31, 0x12,
-    0x28, 0x58, 0x52, 0x3a, 0x4d, 0x1e, 0x01, 0x14, 0x4f, 0x38, 0x0d, 0x0a,
-    0x09, 0x40, 0x97, 0x7d, 0x1a, 0x06, 0x08, 0x18, 0x13, 0x1e, 0x2b, 0x11,
-    0x08, 0x00, 0x0a, 0x0a, 0x08, 0x0a, 0x14, 0x18, 0x35, 0x0f, 0x00, 0x08,
-    0x0f, 0x00, 0x0f, 0x4b, 0x2e, 0x03, 0x02, 0x08, 0x1e, 0x0a, 0x03, 0x0a,
-    0x11, 0x11, 0x08, 0x08, 0x0a, 0x0a, 0x17, 0x11, 0x11, 0x06, 0x06, 0x17,
-    0x17, 0x08, 0x11, 0x14, 0x08, 0x0a, 0x1e, 0x17, 0x18, 0x0a, 0x0a, 0x08,
-    0x0b, 0x0f, 0x02, 0x00, 0x17, 0x35, 0x25, 0x08, 0x07, 0x08, 0x38, 0x28,
-    0x08, 0x0a, 0x18, 0x28, 0x0a, 0x04, 0x08, 0x06, 0x06, 0x08, 0x13, 0x1e,
-    0x13, 0x37, 0x25, 0x04, 0x12, 0x28, 0x1d, 0x1e, 0x1d, 0x44, 0x4f, 0x11,
-    0x14, 0x1e, 0x12, 0x12, 0x09, 0x11, 0x11, 0x12, 0x14, 0x44, 0x4f, 0x25,
-    0x06, 0x10, 0x17, 0x27, 0x1a, 0x26, 0x47, 0x47, 0x09, 0x0d, 0x36, 0x1d,
-    0x12, 0x1f, 0x2f, 0x3a, 0x5f, 0x47, 0x66, 0x63, 0x56, 0x3a, 0x48, 0x56,
-    0x58, 0x3c, 0x26, 0x4d, 0x78, 0x85, 0x48, 0x34, 0x2f, 0x5b, 0x86, 0x4e,
-    0x45, 0x79, 0x91, 0x4e, 0x51, 0x4e, 0x57, 0x60, 0x60, 0x70, 0x6c, 0x78,
-    0x7f, 0x7f, 0x7f, 0x70, 0x91, 0x65, 0x70, 0x7f, 0x7f, 0x9f, 0x70, 0x4e,
-    0x73, 0x69, 0x65, 0x57, 0x4a, 0x4e, 0x60, 0x54, 0x99, 0x9f, 0x84, 0x4e,
-    0x4a, 0x60, 0x5a, 0x84, 0x65, 0x99, 0xb1, 0x7f, 0x3e, 0x90, 0x91, 0x65,
-    0x81, 0x81, 0x7a, 0x99, 0x8e, 0x8e, 0x94, 0xaa, 0x74, 0x74, 0x98, 0x8b,
-    0x79, 0x54, 0x65, 0x9d, 0xab, 0x99, 0x64, 0x65, 0x81, 0xaa, 0x98, 0x69,
-    0x74, 0xaa, 0x99, 0x73, 0x73, 0x6e, 0x6e, 0x7a, 0x8e, 0x8e, 0x73, 0x99,
-    0x9d, 0x9f, 0x91, 0x99, 0xaa, 0x8e, 0x8e, 0x7a, 0x99, 0x99, 0x70, 0x69,
-    0x74, 0x6e, 0x73, 0x5e, 0x4e, 0x54, 0x5e, 0x69, 0x99, 0x9f, 0x5a, 0x34,
-    0x4e, 0x5e, 0x7f, 0x5a, 0x64, 0x91, 0x96, 0x26, 0x5d, 0x7f, 0x56, 0x5e,
-    0x70, 0x60, 0x85, 0x85, 0x78, 0x7f, 0x7f, 0x70, 0x4e, 0x70, 0x70, 0x51,
-    0x2f, 0x3a, 0x56, 0x7f, 0x7f, 0x4d, 0x33, 0x34, 0x78, 0x78, 0x34, 0x3e,
-    0x6c, 0x78, 0x58, 0x33, 0x48, 0x58, 0x34, 0x3e, 0x3e, 0x34, 0x43, 0x63,
-    0x5f, 0x58, 0x47, 0x43, 0x52, 0x52, 0x47, 0x58, 0x66, 0x3c, 0x1d, 0x3a,
-    0x26, 0x28, 0x14, 0x0b, 0x0d, 0x09, 0x11, 0x38, 0x4f, 0x28, 0x08, 0x0a,
-    0x0a, 0x18, 0x12, 0x12, 0x1a, 0x28, 0x00, 0x0e, 0x1e, 0x06, 0x06, 0x0e,
-    0x11, 0x13, 0x1c, 0x1e, 0x38, 0x2b, 0x25, 0x0a, 0x0e, 0x13, 0x0f, 0x0f,
-    0x02, 0x08, 0x1e, 0x35, 0x0a, 0x03, 0x03, 0x11, 0x46, 0x0e, 0x08, 0x17,
-    0x37, 0x11, 0x08, 0x0a, 0x11, 0x08, 0x07, 0x0a, 0x14, 0x0f, 0x25, 0x2e,
-    0x1e, 0x09, 0x1e, 0x1e, 0x11, 0x1e, 0x1e, 0x2e, 0x06, 0x00, 0x08, 0x0a,
-    0x0a, 0x18, 0x09, 0x08, 0x37, 0x3d, 0x13, 0x0f, 0x0a, 0x1e, 0x0e, 0x02,
-    0x0d, 0x1c, 0x25, 0x1d, 0x13, 0x08, 0x06, 0x08, 0x08, 0x0e, 0x0a, 0x14,
-    0x1e, 0x00, 0x01, 0x00, 0x06, 0x12, 0x1d, 0x28, 0x25, 0x1e, 0x06, 0x11,
-    0x25, 0x1d, 0x28, 0x3c, 0x40, 0x44, 0x1d, 0x28, 0x5f, 0x12, 0x0a, 0x26,
-    0x1d, 0x28, 0x26, 0x14, 0x31, 0x31, 0x28, 0x53, 0x58, 0x58, 0x58, 0x58,
-    0x3c, 0x47, 0x4d, 0x3a, 0x3e, 0x6a, 0x5b, 0x45, 0x1a, 0x33, 0x5d, 0x58,
-    0x48, 0x48, 0x56, 0x86, 0x90, 0x6c, 0x63, 0x5b, 0x5e, 0x78, 0x32, 0x4e,
-    0x70, 0x5e, 0x70, 0x79, 0x60, 0x45, 0x48, 0x56, 0x70, 0x48, 0x6c, 0x79,
-    0x60, 0x48, 0x45, 0x50, 0x60, 0x5e, 0x73, 0x91, 0x65, 0x54, 0x54, 0x65,
-    0x73, 0x81, 0x91, 0x91, 0x84, 0x70, 0x64, 0x9f, 0x84, 0x5a, 0x73, 0x91,
-    0x6e, 0x8b, 0x65, 0x70, 0x91, 0x84, 0x91, 0x98, 0xab, 0x8b, 0x94, 0x84,
-    0x73, 0x84, 0x84, 0x84, 0x99, 0x98, 0x99, 0x81, 0x54, 0x84, 0x7a, 0x84,
-    0x84, 0x84, 0xaa, 0xaf, 0xab, 0x91, 0x65, 0x8e, 0x99, 0x7f, 0x81, 0x95,
-    0x95, 0x8e, 0x99, 0x99, 0x6e, 0x70, 0x65, 0x8e, 0x73, 0x57, 0x84, 0x81,
-    0x64, 0x57, 0x57, 0x65, 0x64, 0x6e, 0x9d, 0x99, 0x69, 0x57, 0x84, 0x84,
-    0x73, 0x84, 0x91, 0x8e, 0x65, 0x5e, 0x90, 0x90, 0x5e, 0x5e, 0x70, 0x54,
-    0x81, 0x65, 0x4e, 0x5e, 0x70, 0x60, 0x91, 0x90, 0x91, 0x79, 0x7f, 0x5e,
-    0x5e, 0x5e, 0x56, 0x7f, 0x7f, 0x7f, 0x60, 0x2f, 0x56, 0x5d, 0x56, 0x4e,
-    0x48, 0x4e, 0x90, 0x8a, 0x58, 0x3a, 0x3e, 0x6c, 0x43, 0x1a, 0x48, 0x6a,
-    0x56, 0x58, 0x5d, 0x3e, 0x26, 0x26, 0x1f, 0x2f, 0x28, 0x3a, 0x3a, 0x1d,
-    0x12, 0x12, 0x11, 0x28, 0x36, 0x53, 0x52, 0x3c, 0x06, 0x18, 0x36, 0x20,
-    0x31, 0x44, 0x3c, 0x2e, 0x11, 0x2e, 0x67, 0x31, 0x08, 0x28, 0x10, 0x12,
-    0x12, 0x06, 0x0f, 0x11, 0x0e, 0x28, 0x40, 0x38, 0x25, 0x11, 0x1e, 0x25,
-    0x0e, 0x08, 0x1e, 0x28, 0x25, 0x1e, 0x00, 0x00, 0x0a, 0x19, 0x0f, 0x0a,
-    0x06, 0x2e, 0x40, 0x1e, 0x0c, 0x0a, 0x17, 0x1c, 0x03, 0x08, 0x1e, 0x17,
-    0x1e, 0x0a, 0x0f, 0x00, 0x00, 0x02, 0x06, 0x08, 0x08, 0x04, 0x08, 0x00,
-    0x00, 0x02, 0x00, 0x18, 0x0e, 0x1e, 0x11, 0x01, 0x0a, 0x07, 0x0a, 0x14,
-    0x1e, 0x25, 0x1b, 0x05, 0x03, 0x16, 0x21, 0x21, 0x17, 0x11, 0x12, 0x2b,
-    0x02, 0x00, 0x01, 0x17, 0x28, 0x1d, 0x11, 0x11, 0x17, 0x17, 0x38, 0x20,
-    0x09, 0x06, 0x11, 0x12, 0x1d, 0x1e, 0x08, 0x02, 0x14, 0x31, 0x28, 0x12,
-    0x2e, 0x4f, 0x40, 0x17, 0x40, 0x67, 0x6d, 0x2d, 0x1d, 0x15, 0x12, 0x12,
-    0x43, 0x33, 0x1d, 0x26, 0x3a, 0x3a, 0x4d, 0x63, 0x58, 0x47, 0x3c, 0x3a,
-    0x2f, 0x48, 0x32, 0x2f, 0x63, 0x85, 0x3e, 0x43, 0x3a, 0x3e, 0x78, 0x6c,
-    0x75, 0x78, 0x5b, 0x34, 0x34, 0x66, 0x66, 0x51, 0x3a, 0x5d, 0x96, 0x6c,
-    0x27, 0x3a, 0x5e, 0x79, 0x79, 0x60, 0x65, 0x6c, 0x79, 0x91, 0x73, 0x57,
-    0x4e, 0x4e, 0x84, 0x7f, 0x70, 0x4e, 0x3e, 0x4e, 0x91, 0x99, 0x74, 0x84,
-    0x90, 0x9a, 0x5e, 0x70, 0xb1, 0xb1, 0x91, 0x65, 0x69, 0x6e, 0x65, 0x81,
-    0x99, 0x6e, 0x73, 0x6e, 0x84, 0x84, 0x8c, 0x9f, 0x84, 0x73, 0x73, 0x84,
-    0x90, 0x84, 0x65, 0x95, 0xae, 0x8c, 0x6e, 0x84, 0x65, 0x7a, 0xa1, 0x99,
-    0x99, 0x6e, 0x65, 0x5a, 0x84, 0x90, 0x84, 0x70, 0x65, 0xab, 0x99, 0x54,
-    0x4e, 0x73, 0x99, 0x94, 0x8e, 0x74, 0x81, 0x73, 0x9f, 0x99, 0x81, 0x64,
-    0x65, 0x8e, 0x8e, 0x84, 0x7f, 0x4e, 0x4e, 0x81, 0x8e, 0x81, 0x7f, 0x90,
-    0xa7, 0x6a, 0x4a, 0x9f, 0xaf, 0x99, 0x70, 0x70, 0x65, 0x4e, 0x57, 0x8e,
-    0x65, 0x4e, 0x60, 0x65, 0x70, 0x65, 0x91, 0x7f, 0x6c, 0x4e, 0x5d, 0x5d,
-    0x5d, 0x48, 0x4e, 0x91, 0x91, 0x45, 0x5d, 0x48, 0x5d, 0x6c, 0x6c, 0x78,
-    0x66, 0x3a, 0x26, 0x2f, 0x5d, 0x51, 0x3a, 0x3a, 0x56, 0x6a, 0x27, 0x0d,
-    0x1f, 0x58, 0x52, 0x4d, 0x3a, 0x2f, 0x31, 0x3c, 0x5f, 0x47, 0x12, 0x0d,
-    0x28, 0x47, 0x47, 0x28, 0x0e, 0x08, 0x1d, 0x36, 0x36, 0x3c, 0x1a, 0x44,
-    0x38, 0x11, 0x37, 0x61, 0x61, 0x2e, 0x11, 0x0d, 0x06, 0x0e, 0x1e, 0x11,
-    0x08, 0x06, 0x1e, 0x2e, 0x13, 0x1b, 0x28, 0x1e, 0x17, 0x08, 0x0a, 0x11,
-    0x00, 0x04, 0x1e, 0x1e, 0x08, 0x09, 0x0e, 0x08, 0x11, 0x25, 0x18, 0x1e,
-    0x0f, 0x05, 0x0c, 0x21, 0x21, 0x1c, 0x0f, 0x0a, 0x1c, 0x0a, 0x00, 0x02,
-    0x08, 0x11, 0x13, 0x0f, 0x08, 0x0f, 0x0f, 0x1b, 0x1c, 0x0a, 0x00, 0x00,
-    0x2e, 0x3d, 0x08, 0x00, 0x1e, 0x0f, 0x03, 0x0a, 0x00, 0x0e, 0x1e, 0x4b,
-    0x35, 0x1c, 0x40, 0x55, 0x4f, 0x1e, 0x04, 0x00, 0x1b, 0x37, 0x1e, 0x18,
-    0x11, 0x11, 0x17, 0x18, 0x40, 0x31, 0x0a, 0x28, 0x61, 0x31, 0x44, 0x25,
-    0x36, 0x2d, 0x52, 0x67, 0x38, 0x14, 0x28, 0x28, 0x2e, 0x40, 0x7d, 0x61,
-    0x09, 0x1d, 0x36, 0x4d, 0x3c, 0x12, 0x47, 0x5f, 0x89, 0x7b, 0x52, 0x26,
-    0x36, 0x28, 0x33, 0x2f, 0x2f, 0x8a, 0x75, 0x63, 0x58, 0x4d, 0x27, 0x56,
-    0x86, 0x48, 0x32, 0x5b, 0x6c, 0x3a, 0x3a, 0x34, 0x3e, 0x78, 0x91, 0x93,
-    0x9a, 0x78, 0x93, 0x9a, 0x96, 0x5d, 0x3a, 0x4e, 0x96, 0x85, 0x70, 0x4e,
-    0x4e, 0x65, 0x79, 0x86, 0xa0, 0x70, 0x7f, 0x9d, 0x9f, 0x91, 0x8e, 0x73,
-    0x90, 0x84, 0xa7, 0x9f, 0x81, 0x73, 0x74, 0x79, 0x7f, 0xb1, 0xaf, 0x70,
-    0x5e, 0x7f, 0x91, 0xaa, 0x6e, 0x69, 0x98, 0xaa, 0xaf, 0xab, 0x6e, 0x73,
-    0x65, 0x65, 0x6e, 0x70, 0xab, 0xaf, 0x99, 0x99, 0x7a, 0x69, 0x84, 0xab,
-    0x99, 0x73, 0x8e, 0xab, 0x6e, 0x84, 0x73, 0x69, 0x99, 0xa1, 0xac, 0xab,
-    0x91, 0xac, 0xac, 0xaf, 0x99, 0x60, 0x70, 0x99, 0x99, 0x7a, 0x73, 0x73,
-    0x8e, 0x74, 0x7a, 0xac, 0x8e, 0x81, 0xaa, 0xaf, 0x99, 0xaa, 0x74, 0x9f,
-    0x9f, 0x9f, 0x99, 0x8e, 0x65, 0x81, 0x7f, 0x7f, 0x96, 0xb1, 0x90, 0x4e,
-    0x70, 0x7f, 0x84, 0x65, 0x65, 0x91, 0x8e, 0xaf, 0xac, 0x91, 0x60, 0x57,
-    0x50, 0x57, 0x50, 0x65, 0xa7, 0x96, 0x85, 0x78, 0x4e, 0x48, 0x79, 0x91,
-    0x4e, 0x41, 0x85, 0x5d, 0x3a, 0x3a, 0x34, 0x5d, 0x86, 0x89, 0x85, 0x6c,
-    0x5d, 0x8a, 0x9a, 0x85, 0x33, 0x1a, 0x58, 0x75, 0x58, 0x52, 0x26, 0x3a,
-    0x3a, 0x2f, 0x58, 0x58, 0x28, 0x47, 0x7b, 0x52, 0x58, 0x5f, 0x3c, 0x52,
-    0x40, 0x63, 0x4d, 0x28, 0x26, 0x3c, 0x2e, 0x2e, 0x61, 0x67, 0x0e, 0x1e,
-    0x2e, 0x40, 0x31, 0x06, 0x14, 0x38, 0x61, 0x61, 0x4f, 0x25, 0x0e, 0x06,
-    0x13, 0x17, 0x0e, 0x40, 0x4f, 0x1e, 0x17, 0x11, 0x00, 0x0a, 0x46, 0x1e,
-    0x00, 0x11, 0x1e, 0x08, 0x08, 0x02, 0x04, 0x14, 0x35, 0x4b, 0x21, 0x21,
-    0x55, 0x4b, 0x40, 0x0a, 0x00, 0x07, 0x2e, 0x1e, 0x14, 0x0a, 0x08, 0x08,
-    0x0e, 0x2e, 0x35, 0x0c, 0x0a, 0x2e, 0x35, 0x1e, 0x02, 0x08, 0x11, 0x40,
-    0x35, 0x0c, 0x0f, 0x11, 0x08, 0x00, 0x08, 0x1e, 0x18, 0x0f, 0x0f, 0x0e,
-    0x17, 0x11, 0x06, 0x0a, 0x0f, 0x1e, 0x13, 0x28, 0x1e, 0x06, 0x08, 0x1e,
-    0x13, 0x1e, 0x14, 0x08, 0x14, 0x1d, 0x04, 0x14, 0x17, 0x08, 0x3f, 0x7d,
-    0x4f, 0x09, 0x26, 0x38, 0x0a, 0x00, 0x06, 0x26, 0x4f, 0x31, 0x26, 0x14,
-    0x12, 0x36, 0x3a, 0x3c, 0x28, 0x1d, 0x14, 0x1d, 0x26, 0x27, 0x2f, 0x63,
-    0x5f, 0x3c, 0x58, 0x48, 0x43, 0x3a, 0x32, 0x3a, 0x43, 0x34, 0x8a, 0x9a,
-    0x5d, 0x4d, 0x5d, 0x58, 0x2f, 0x2f, 0x4e, 0x70, 0x56, 0x60, 0x5b, 0x56,
-    0x7f, 0x60, 0x6c, 0x5e, 0x78, 0x6c, 0x70, 0x7f, 0x50, 0x54, 0x57, 0x57,
-    0x57, 0x65, 0x64, 0x4e, 0x84, 0x7f, 0x51, 0x54, 0x4e, 0x5e, 0xb1, 0xaf,
-    0x79, 0x81, 0x8e, 0x54, 0x32, 0x41, 0x5e, 0x9f, 0x91, 0x91, 0x81, 0x54,
-    0x65, 0x98, 0x99, 0x65, 0x65, 0x57, 0x57, 0x65, 0x65, 0x69, 0x8e, 0x95,
-    0x6e, 0x95, 0x99, 0x95, 0x74, 0x6e, 0x69, 0x6e, 0x6e, 0x99, 0xbc, 0xac,
-    0x8e, 0x99, 0x9f, 0x65, 0x70, 0x81, 0x99, 0x95, 0x8e, 0x99, 0x6e, 0x7a,
-    0x95, 0x73, 0x84, 0x91, 0x95, 0x8e, 0x95, 0x6e, 0x69, 0x6e, 0x8e, 0x81,
-    0x69, 0x7a, 0x64, 0x84, 0x94, 0x60, 0x65, 0x65, 0x60, 0xac, 0xaf, 0x99,
-    0x65, 0x81, 0x7f, 0x3e, 0x2f, 0x4a, 0x84, 0x7f, 0x91, 0x7f, 0x50, 0x60,
-    0x73, 0x91, 0x79, 0x60, 0x57, 0x5b, 0x4e, 0x57, 0x57, 0x65, 0x84, 0x65,
-    0x6c, 0x7f, 0x7f, 0x5d, 0x5d, 0x45, 0x50, 0x4e, 0x5b, 0xa0, 0xa0, 0x56,
-    0x45, 0x5d, 0x51, 0x2f, 0x2f, 0x56, 0x75, 0x51, 0x5d, 0x58, 0x56, 0x56,
-    0x3e, 0x3a, 0x58, 0x58, 0x51, 0x63, 0x58, 0x26, 0x1a, 0x33, 0x36, 0x26,
-    0x26, 0x1d, 0x1d, 0x5f, 0x12, 0x09, 0x28, 0x17, 0x38, 0x8a, 0x7b, 0x1a,
-    0x26, 0x3c, 0x13, 0x00, 0x00, 0x18, 0x4f, 0x2e, 0x28, 0x17, 0x04, 0x0a,
-    0x31, 0x2e, 0x1b, 0x17, 0x08, 0x0a, 0x0e, 0x08, 0x0e, 0x1e, 0x1e, 0x06,
-    0x1d, 0x2e, 0x17, 0x13, 0x0a, 0x00, 0x06, 0x06, 0x37, 0x4f, 0x1b, 0x18,
-    0x25, 0x17, 0x04, 0x00, 0x0a, 0x35, 0x0f, 0x0f, 0x0f, 0x0f, 0x17, 0x13,
-    0x0a, 0x0f, 0x0f, 0x0a, 0x17, 0x25, 0x08, 0x00, 0x0e, 0x0f, 0x07, 0x0c,
-    0x17, 0x08, 0x0a, 0x06, 0x05, 0x0f, 0x2b, 0x29, 0x03, 0x1b, 0x2e, 0x2b,
-    0x0a, 0x08, 0x0a, 0x02, 0x02, 0x13, 0x1b, 0x17, 0x0a, 0x13, 0x20, 0x35,
-    0x0e, 0x1c, 0x38, 0x1e, 0x1e, 0x38, 0x14, 0x06, 0x38, 0x12, 0x06, 0x08,
-    0x12, 0x11, 0x2b, 0x31, 0x28, 0x18, 0x1e, 0x07, 0x09, 0x25, 0x25, 0x06,
-    0x0a, 0x26, 0x1e, 0x1d, 0x47, 0x38, 0x52, 0x3c, 0x47, 0x47, 0x26, 0x06,
-    0x1d, 0x52, 0x5f, 0x47, 0x89, 0x9a, 0x75, 0x58, 0x27, 0x12, 0x0a, 0x14,
-    0x3a, 0x63, 0x5d, 0x58, 0x27, 0x5d, 0x8a, 0x43, 0x3e, 0x85, 0x8a, 0x70,
-    0x5d, 0x5b, 0x48, 0x34, 0x3e, 0x78, 0x6c, 0x6a, 0x70, 0x85, 0x96, 0x60,
-    0x60, 0x96, 0x85, 0x7f, 0x91, 0x57, 0x4e, 0x65, 0x81, 0x54, 0x60, 0x57,
-    0x7f, 0x90, 0x79, 0x70, 0x70, 0x5a, 0x4e, 0x4e, 0x84, 0x8e, 0x65, 0x54,
-    0x84, 0x7f, 0x5e, 0x90, 0x9f, 0x73, 0x84, 0x99, 0x99, 0x8e, 0x57, 0x57,
-    0x8e, 0x9c, 0x7a, 0x95, 0xab, 0xab, 0x8c, 0x84, 0x65, 0x65, 0x5a, 0x69,
-    0x94, 0x9c, 0x8c, 0x6e, 0x84, 0xaf, 0xac, 0x84, 0xab, 0xb4, 0x9c, 0x8b,
-    0x74, 0x69, 0x69, 0x65, 0x8e, 0x8c, 0x99, 0x98, 0x99, 0xa9, 0x99, 0x6e,
-    0xab, 0xab, 0x99, 0x94, 0x99, 0x73, 0x74, 0xaa, 0x98, 0x65, 0x6e, 0x8e,
-    0x8e, 0x99, 0x7a, 0x73, 0x81, 0x65, 0x57, 0x81, 0x8e, 0x91, 0x54, 0x5a,
-    0x65, 0x4e, 0x70, 0x90, 0x5a, 0x84, 0x65, 0x91, 0x8e, 0x54, 0x45, 0x60,
-    0x81, 0x91, 0x65, 0xac, 0xac, 0x91, 0x79, 0x60, 0x4e, 0x34, 0x34, 0x70,
-    0x85, 0x7f, 0x54, 0x45, 0x7f, 0x85, 0x58, 0x75, 0xa0, 0x96, 0x70, 0x5b,
-    0x3e, 0x2f, 0x27, 0x3a, 0x66, 0x5d, 0x63, 0x66, 0x7b, 0x75, 0x3c, 0x66,
-    0x75, 0x5d, 0x5d, 0x63, 0x3a, 0x26, 0x58, 0x3c, 0x1d, 0x28, 0x1f, 0x47,
-    0x5f, 0x31, 0x28, 0x40, 0x26, 0x13, 0x12, 0x36, 0x33, 0x0e, 0x06, 0x38,
-    0x25, 0x18, 0x2e, 0x38, 0x31, 0x1d, 0x25, 0x31, 0x25, 0x00, 0x06, 0x28,
-    0x38, 0x1e, 0x4f, 0x61, 0x40, 0x1e, 0x06, 0x0a, 0x0a, 0x02, 0x1e, 0x25,
-    0x18, 0x0a, 0x07, 0x17, 0x40, 0x0a, 0x0f, 0x35, 0x38, 0x25, 0x08, 0x06,
-    0x00, 0x02, 0x08, 0x1c, 0x1e, 0x0f, 0x06, 0x1e, 0x31, 0x0f, 0x0f, 0x2b,
-    0x1e, 0x0e, 0x1e, 0x2b, 0x08, 0x0a, 0x17, 0x0a, 0x08, 0x07, 0x0a, 0x11,
-    0x2e, 0x1c, 0x0f, 0x02, 0x03, 0x1e, 0x0f, 0x0e, 0x08, 0x08, 0x0a, 0x0e,
-    0x11, 0x08, 0x0f, 0x2e, 0x17, 0x04, 0x0e, 0x17, 0x2b, 0x17, 0x17, 0x08,
-    0x0a, 0x18, 0x31, 0x38, 0x1e, 0x08, 0x17, 0x38, 0x2e, 0x04, 0x28, 0x44,
-    0x31, 0x12, 0x1e, 0x1e, 0x14, 0x28, 0x1d, 0x13, 0x1a, 0x38, 0x5f, 0x3c,
-    0x06, 0x28, 0x31, 0x47, 0x58, 0x33, 0x1d, 0x33, 0x26, 0x28, 0x52, 0x7b,
-    0x7b, 0x5d, 0x4d, 0x3c, 0x3c, 0x43, 0x12, 0x33, 0x78, 0x89, 0x6a, 0x6c,
-    0x66, 0x58, 0x33, 0x1a, 0x5d, 0x78, 0x48, 0x48, 0x4e, 0x6c, 0x66, 0x5d,
-    0x5e, 0x3e, 0x5d, 0x86, 0x56, 0x4e, 0x60, 0x60, 0x79, 0x78, 0x56, 0x41,
-    0x7f, 0x91, 0x91, 0x91, 0x65, 0x57, 0x91, 0x84, 0x54, 0x65, 0x90, 0x7f,
-    0x65, 0x70, 0x5a, 0x70, 0x65, 0x8e, 0x65, 0x69, 0x9f, 0x9f, 0x99, 0x70,
-    0x65, 0x99, 0x8e, 0xaa, 0x98, 0x73, 0x7a, 0x84, 0x65, 0x95, 0xab, 0xaf,
-    0xab, 0x7a, 0x5a, 0x73, 0x7a, 0x5a, 0x65, 0x99, 0xaa, 0x9c, 0x9c, 0x9c,
-    0x7a, 0x65, 0x5a, 0x84, 0x99, 0x8e, 0x81, 0x6e, 0x88, 0xa2, 0x8b, 0x7a,
-    0x6e, 0x6e, 0xab, 0x8e, 0x69, 0x8b, 0x8e, 0x99, 0x99, 0x84, 0x5a, 0x6e,
-    0x99, 0x99, 0x94, 0x99, 0x81, 0x8e, 0x99, 0x74, 0x65, 0x99, 0x98, 0x84,
-    0x81, 0x73, 0x65, 0x64, 0x8e, 0x6e, 0x70, 0x91, 0x99, 0xac, 0x73, 0x4e,
-    0x81, 0x7f, 0x9f, 0x9f, 0x70, 0x70, 0x65, 0x5e, 0x5a, 0x8e, 0xaf, 0xb1,
-    0x91, 0x70, 0x5e, 0x70, 0x54, 0x48, 0x4a, 0xa0, 0x91, 0x79, 0x79, 0x70,
-    0x4e, 0x34, 0x32, 0x78, 0x6c, 0x4d, 0x48, 0x4e, 0x5e, 0x58, 0x56, 0x48,
-    0x2f, 0x5d, 0x63, 0x33, 0x58, 0x3a, 0x47, 0x58, 0x3e, 0x1f, 0x1a, 0x58,
-    0x63, 0x58, 0x52, 0x36, 0x28, 0x58, 0x47, 0x26, 0x47, 0x3a, 0x47, 0x2d,
-    0x28, 0x1d, 0x28, 0x26, 0x28, 0x1d, 0x12, 0x40, 0x5f, 0x52, 0x08, 0x12,
-    0x28, 0x28, 0x47, 0x31, 0x0d, 0x14, 0x11, 0x13, 0x2e, 0x46, 0x7d, 0x46,
-    0x1e, 0x1e, 0x1e, 0x12, 0x06, 0x08, 0x35, 0x40, 0x1e, 0x19, 0x37, 0x0c,
-    0x08, 0x02, 0x1c, 0x1c, 0x11, 0x02, 0x03, 0x0e, 0x08, 0x0d, 0x0a, 0x00,
-    0x19, 0x1e, 0x0a, 0x06, 0x03, 0x0a, 0x17, 0x11, 0x08, 0x00, 0x17, 0x1e,
-    0x17, 0x1e, 0x0a, 0x08, 0x11, 0x1e, 0x07, 0x0e, 0x08, 0x0a, 0x0f, 0x08,
-    0x35, 0x35, 0x03, 0x03, 0x1e, 0x08, 0x03, 0x11, 0x25, 0x37, 0x1e, 0x08,
-    0x11, 0x0e, 0x0a, 0x1e, 0x40, 0x0a, 0x08, 0x17, 0x17, 0x11, 0x25, 0x38,
-    0x12, 0x11, 0x4c, 0x25, 0x03, 0x06, 0x0d, 0x14, 0x12, 0x44, 0x2e, 0x0d,
-    0x11, 0x31, 0x18, 0x28, 0x67, 0x58, 0x36, 0x10, 0x09, 0x1f, 0x47, 0x47,
-    0x28, 0x26, 0x3c, 0x3a, 0x47, 0x47, 0x3a, 0x36, 0x12, 0x18, 0x3a, 0x58,
-    0x47, 0x26, 0x1f, 0x33, 0x3e, 0x2f, 0x26, 0x33, 0x5b, 0x63, 0x58, 0x3a,
-    0x66, 0x3a, 0x26, 0x5d, 0x4e, 0x34, 0x56, 0x78, 0x7f, 0x7f, 0x48, 0x50,
-    0x79, 0x4e, 0x4e, 0x84, 0x60, 0x3e, 0x4e, 0x5e, 0x54, 0x77, 0x84, 0x73,
-    0x65, 0x99, 0x91, 0x4e, 0x54, 0x70, 0x60, 0x70, 0x81, 0x99, 0x65, 0x5e,
-    0x84, 0x74, 0x74, 0x99, 0xac, 0x9f, 0x65, 0x60, 0x65, 0x95, 0x95, 0x8e,
-    0x69, 0x84, 0x8e, 0x99, 0x8e, 0x8c, 0x8e, 0x65, 0x65, 0x73, 0x99, 0x95,
-    0x7a, 0x81, 0x6e, 0x8b, 0x8e, 0x6e, 0x64, 0x8e, 0x99, 0x8e, 0x73, 0x7a,
-    0x7a, 0x5a, 0x6e, 0xab, 0x74, 0x8b, 0x94, 0x9c, 0xae, 0x8b, 0x84, 0x7a,
-    0x8e, 0x99, 0x9b, 0xab, 0x65, 0x5a, 0x84, 0x8e, 0x8b, 0x9c, 0x94, 0x7a,
-    0x8b, 0xab, 0x69, 0x5a, 0x81, 0x69, 0x65, 0x84, 0xab, 0x8e, 0x65, 0x84,
-    0x7a, 0x64, 0x7a, 0xac, 0x9f, 0x84, 0x5a, 0x70, 0x84, 0x84, 0x84, 0x70,
-    0x57, 0x73, 0x95, 0x7f, 0x70, 0x70, 0x57, 0x50, 0x60, 0x65, 0x79, 0x65,
-    0x4e, 0x4e, 0x70, 0x54, 0x4e, 0x48, 0x56, 0x60, 0x6c, 0x56, 0x56, 0x5d,
-    0x3a, 0x32, 0x5e, 0x4e, 0x3e, 0x5e, 0x5e, 0x79, 0x60, 0x2f, 0x3e, 0x66,
-    0x3a, 0x3e, 0x5d, 0x3c, 0x14, 0x26, 0x36, 0x3a, 0x58, 0x58, 0x47, 0x47,
-    0x7b, 0x47, 0x06, 0x1d, 0x26, 0x1d, 0x1f, 0x53, 0x52, 0x1d, 0x1a, 0x36,
-    0x28, 0x31, 0x61, 0x5c, 0x36, 0x14, 0x06, 0x18, 0x31, 0x2e, 0x12, 0x11,
-    0x12, 0x25, 0x38, 0x25, 0x14, 0x1e, 0x07, 0x00, 0x14, 0x40, 0x28, 0x06,
-    0x06, 0x0e, 0x06, 0x00, 0x06, 0x08, 0x11, 0x0f, 0x0a, 0x0f, 0x35, 0x0f,
-    0x03, 0x0f, 0x1e, 0x00, 0x08, 0x0f, 0x1e, 0x1e, 0x0a, 0x0a, 0x0e, 0x0e,
-    0x0a, 0x1c, 0x25, 0x02, 0x08, 0x11, 0x04, 0x08, 0x1e, 0x2e, 0x0a, 0x17,
-    0x2e, 0x08, 0x00, 0x00, 0x25, 0x11, 0x11, 0x0f, 0x0f, 0x0f, 0x1c, 0x35,
-    0x1e, 0x35, 0x1e, 0x14, 0x18, 0x37, 0x2e, 0x17, 0x18, 0x13, 0x0a, 0x0e,
-    0x03, 0x08, 0x2b, 0x4f, 0x2e, 0x06, 0x14, 0x0e, 0x2b, 0x4f, 0x1e, 0x11,
-    0x13, 0x09, 0x06, 0x0e, 0x31, 0x1e, 0x18, 0x46, 0x4c, 0x0d, 0x12, 0x18,
-    0x3c, 0x7b, 0x33, 0x28, 0x47, 0x26, 0x10, 0x06, 0x36, 0x47, 0x1f, 0x1a,
-    0x5f, 0x58, 0x26, 0x20, 0x27, 0x47, 0x47, 0x3c, 0x3a, 0x6a, 0x8a, 0x66,
-    0x33, 0x58, 0x56, 0x56, 0x5d, 0x3e, 0x4d, 0x58, 0x2f, 0x4d, 0x6c, 0x5d,
-    0x70, 0x8a, 0x48, 0x7f, 0x90, 0x5e, 0x70, 0x79, 0x70, 0x66, 0x70, 0x50,
-    0x34, 0x6c, 0xa7, 0xa7, 0x4e, 0x4e, 0x70, 0x65, 0x84, 0x9f, 0x70, 0x65,
-    0x70, 0x65, 0x54, 0x8e, 0x99, 0x65, 0x91, 0xa7, 0x65, 0x57, 0x81, 0x69,
-    0xac, 0xab, 0x73, 0x99, 0x99, 0x65, 0x54, 0x65, 0x99, 0x84, 0x73, 0x7a,
-    0xab, 0x95, 0x73, 0x65, 0x95, 0x9f, 0x99, 0x84, 0x9b, 0xb4, 0xa9, 0x8e,
-    0x7a, 0x99, 0x74, 0x99, 0x8b, 0x99, 0x8e, 0x73, 0x6e, 0x99, 0x99, 0xa9,
-    0xad, 0x8b, 0x99, 0xad, 0xaa, 0x94, 0x9c, 0x94, 0x8e, 0x8c, 0x8e, 0x5a,
-    0x69, 0xaa, 0xbc, 0x99, 0x65, 0x8e, 0x8e, 0x99, 0xab, 0x8e, 0x73, 0x6e,
-    0x8e, 0x69, 0x69, 0xab, 0x84, 0x84, 0xab, 0x95, 0x65, 0x70, 0x7f, 0x99,
-    0xb4, 0x69, 0x7a, 0x9d, 0x65, 0x4e, 0x54, 0x79, 0x73, 0x54, 0x73, 0x99,
-    0x81, 0x60, 0x60, 0x7f, 0x79, 0x70, 0x54, 0x65, 0x9d, 0x9f, 0x70, 0x60,
-    0x85, 0x60, 0x65, 0x7f, 0x4e, 0x4e, 0x4e, 0x3a, 0x5d, 0x75, 0x60, 0x85,
-    0x63, 0x48, 0x7f, 0x93, 0x5d, 0x6c, 0x6c, 0x58, 0x43, 0x4d, 0x12, 0x1d,
-    0x58, 0x8a, 0x63, 0x12, 0x28, 0x33, 0x47, 0x67, 0x43, 0x1f, 0x3c, 0x26,
-    0x28, 0x1d, 0x53, 0x3c, 0x2e, 0x5f, 0x5f, 0x1a, 0x0d, 0x12, 0x4c, 0x7b,
-    0x47, 0x1a, 0x47, 0x38, 0x06, 0x00, 0x14, 0x38, 0x12, 0x0d, 0x39, 0x44,
-    0x12, 0x08, 0x04, 0x1e, 0x1e, 0x0a, 0x06, 0x1e, 0x4f, 0x18, 0x08, 0x1e,
-    0x11, 0x11, 0x25, 0x0e, 0x13, 0x0f, 0x0a, 0x0f, 0x35, 0x1c, 0x18, 0x2e,
-    0x11, 0x0e, 0x1e, 0x37, 0x1e, 0x17, 0x11, 0x0a, 0x0f, 0x08, 0x03, 0x0a,
-    0x4f, 0x40, 0x06, 0x08, 0x08, 0x08, 0x38, 0x25, 0x02, 0x00, 0x00, 0x0e,
-    0x1e, 0x06, 0x13, 0x2e, 0x35, 0x1c, 0x35, 0x4b, 0x0f, 0x35, 0x40, 0x20,
-    0x06, 0x00, 0x08, 0x1e, 0x2e, 0x35, 0x35, 0x17, 0x1e, 0x17, 0x37, 0x4f,
-    0x2e, 0x17, 0x11, 0x11, 0x0e, 0x0e, 0x1e, 0x1e, 0x13, 0x0e, 0x0d, 0x0d,
-    0x25, 0x4c, 0x37, 0x4c, 0x44, 0x31, 0x5f, 0x58, 0x12, 0x06, 0x1a, 0x52,
-    0x5f, 0x3a, 0x36, 0x12, 0x0d, 0x36, 0x5f, 0x33, 0x1d, 0x1f, 0x33, 0x3a,
-    0x28, 0x0d, 0x1f, 0x63, 0x89, 0x78, 0x6a, 0x3e, 0x33, 0x20, 0x3a, 0x67,
-    0x3a, 0x3e, 0x85, 0x96, 0x66, 0x75, 0x85, 0x58, 0x52, 0x93, 0x7f, 0x4e,
-    0x48, 0x48, 0x70, 0x4e, 0x93, 0x9a, 0x70, 0x60, 0x79, 0x7f, 0x86, 0x90,
-    0x90, 0x7f, 0x5e, 0x5d, 0x56, 0x70, 0x91, 0x73, 0x65, 0x65, 0x6e, 0x84,
-    0x99, 0x99, 0x90, 0x96, 0x73, 0xaa, 0xaa, 0x74, 0x57, 0x65, 0x8b, 0xab,
-    0xab, 0x99, 0x65, 0x57, 0x73, 0x99, 0x99, 0x65, 0x65, 0x84, 0x9f, 0x6e,
-    0x5a, 0x5a, 0x91, 0xb4, 0xab, 0xab, 0x9c, 0x8c, 0x65, 0x65, 0xab, 0x8e,
-    0x6e, 0x9c, 0xbc, 0xab, 0x99, 0xab, 0x99, 0x6e, 0xab, 0xa9, 0x98, 0x81,
-    0x69, 0x98, 0x8b, 0xab, 0xab, 0x95, 0x8e, 0x99, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x94, 0x7a, 0x69, 0x70, 0x84, 0x94, 0x99, 0x6e, 0x6e, 0x81, 0x7a, 0x99,
-    0xab, 0x7a, 0x99, 0x8e, 0x95, 0xab, 0x99, 0x65, 0x65, 0x84, 0x9c, 0x99,
-    0x99, 0x73, 0x50, 0x5e, 0x84, 0x9f, 0x5a, 0x4e, 0x65, 0x81, 0x65, 0x50,
-    0x45, 0x6c, 0x9f, 0xa0, 0x91, 0x73, 0x7f, 0x4e, 0x3a, 0x70, 0x70, 0x4e,
-    0x79, 0x9f, 0x96, 0x5b, 0x85, 0x85, 0x58, 0x66, 0x9a, 0x70, 0x3e, 0x34,
-    0x48, 0x60, 0x4e, 0x89, 0x72, 0x43, 0x3e, 0x66, 0x5d, 0x63, 0x75, 0x66,
-    0x43, 0x27, 0x12, 0x25, 0x47, 0x43, 0x47, 0x26, 0x28, 0x36, 0x33, 0x5f,
-    0x5f, 0x4f, 0x47, 0x31, 0x5f, 0x5f, 0x20, 0x06, 0x12, 0x3f, 0x4d, 0x52,
-    0x2e, 0x0d, 0x0a, 0x1d, 0x47, 0x20, 0x04, 0x06, 0x0d, 0x31, 0x13, 0x00,
-    0x00, 0x37, 0x52, 0x38, 0x38, 0x1e, 0x14, 0x08, 0x17, 0x37, 0x13, 0x09,
-    0x1e, 0x40, 0x2b, 0x1e, 0x4b, 0x29, 0x1c, 0x35, 0x28, 0x0e, 0x00, 0x00,
-    0x11, 0x1b, 0x1c, 0x35, 0x17, 0x0c, 0x17, 0x11, 0x1e, 0x2b, 0x1e, 0x17,
-    0x0a, 0x08, 0x0e, 0x0a, 0x0e, 0x0e, 0x0a, 0x06, 0x0e, 0x19, 0x06, 0x00,
-    0x02, 0x08, 0x08, 0x08, 0x35, 0x1c, 0x03, 0x02, 0x02, 0x08, 0x0a, 0x00,
-    0x00, 0x02, 0x0f, 0x37, 0x40, 0x2b, 0x19, 0x13, 0x17, 0x28, 0x0a, 0x1e,
-    0x61, 0x26, 0x1e, 0x5c, 0x7d, 0x25, 0x04, 0x12, 0x31, 0x1d, 0x0d, 0x0e,
-    0x28, 0x61, 0x36, 0x1a, 0x3c, 0x1f, 0x3c, 0x47, 0x11, 0x12, 0x52, 0x58,
-    0x36, 0x1f, 0x52, 0x3c, 0x4d, 0x3a, 0x28, 0x3a, 0x33, 0x1a, 0x33, 0x36,
-    0x1d, 0x1f, 0x36, 0x2f, 0x3a, 0x75, 0x75, 0x33, 0x3e, 0x5d, 0x2f, 0x26,
-    0x32, 0x56, 0x56, 0x75, 0x66, 0x32, 0x34, 0x3e, 0x41, 0x70, 0x45, 0x4e,
-    0x27, 0x33, 0x7f, 0xa0, 0x96, 0x79, 0x70, 0x6c, 0x90, 0x65, 0x5e, 0x9f,
-    0x9f, 0x7f, 0x99, 0xaf, 0x91, 0x65, 0x65, 0x84, 0x79, 0x7f, 0x65, 0x70,
-    0x99, 0x99, 0x79, 0x8e, 0x69, 0x84, 0xab, 0x65, 0x5a, 0x7a, 0xab, 0x95,
-    0x65, 0x8e, 0x95, 0x95, 0x9c, 0x73, 0x8e, 0x81, 0x69, 0x69, 0x65, 0x70,
-    0x65, 0x81, 0x84, 0x6e, 0x9c, 0xaf, 0x8c, 0x81, 0x9c, 0x74, 0x69, 0x65,
-    0x7a, 0x99, 0x99, 0x99, 0x81, 0x65, 0x6e, 0x69, 0x98, 0x74, 0x8e, 0x65,
-    0x4e, 0x81, 0xaa, 0xad, 0x9c, 0x94, 0x73, 0x99, 0x94, 0x7a, 0x99, 0xaf,
-    0x99, 0xa1, 0xbc, 0xab, 0x69, 0x73, 0x94, 0x91, 0x7f, 0x65, 0x69, 0x8c,
-    0xac, 0x84, 0x90, 0x7a, 0x69, 0x99, 0x74, 0x65, 0x81, 0x99, 0x95, 0x65,
-    0x73, 0x7f, 0x65, 0x84, 0x73, 0x70, 0x73, 0x57, 0x60, 0x5e, 0x56, 0x56,
-    0x56, 0x4e, 0x4e, 0x70, 0xa0, 0x86, 0x4e, 0x7f, 0x70, 0x48, 0x32, 0x51,
-    0x56, 0x5d, 0x6c, 0x48, 0x27, 0x3e, 0x48, 0x45, 0x50, 0x3e, 0x34, 0x0d,
-    0x1f, 0x6a, 0x89, 0x63, 0x43, 0x3a, 0x4d, 0x66, 0x3a, 0x47, 0x89, 0x66,
-    0x47, 0x7b, 0x97, 0x67, 0x18, 0x26, 0x47, 0x36, 0x26, 0x10, 0x1d, 0x5f,
-    0x4c, 0x28, 0x1f, 0x1d, 0x3f, 0x3c, 0x0a, 0x12, 0x36, 0x4f, 0x1d, 0x11,
-    0x31, 0x12, 0x20, 0x1a, 0x0a, 0x11, 0x11, 0x04, 0x06, 0x11, 0x11, 0x08,
-    0x08, 0x08, 0x17, 0x37, 0x2e, 0x11, 0x14, 0x0d, 0x01, 0x00, 0x02, 0x0a,
-    0x02, 0x18, 0x35, 0x03, 0x02, 0x00, 0x08, 0x0a, 0x08, 0x00, 0x00, 0x06,
-    0x18, 0x1b, 0x1b, 0x0f, 0x0f, 0x08, 0x17, 0x0a, 0x08, 0x35, 0x40, 0x0a,
-    0x1e, 0x4f, 0x37, 0x08, 0x25, 0x19, 0x0f, 0x1e, 0x0a, 0x06, 0x00, 0x0e,
-    0x11, 0x14, 0x21, 0x21, 0x0f, 0x0e, 0x06, 0x00, 0x0d, 0x0a, 0x0f, 0x0c,
-    0x02, 0x0f, 0x1d, 0x0d, 0x04, 0x11, 0x11, 0x11, 0x1c, 0x11, 0x28, 0x40,
-    0x0a, 0x0e, 0x28, 0x2e, 0x31, 0x06, 0x0a, 0x47, 0x4c, 0x06, 0x00, 0x04,
-    0x2e, 0x63, 0x36, 0x06, 0x10, 0x3c, 0x53, 0x5f, 0x5f, 0x1f, 0x0d, 0x27,
-    0x2f, 0x26, 0x27, 0x34, 0x33, 0x48, 0x5d, 0x58, 0x5f, 0x63, 0x5d, 0x3e,
-    0x2f, 0x5b, 0x5d, 0x63, 0x6c, 0x4d, 0x51, 0x56, 0x60, 0x3e, 0x48, 0x5d,
-    0x60, 0x56, 0x63, 0x6c, 0x56, 0x4e, 0x3e, 0x34, 0x70, 0x5e, 0x5d, 0x56,
-    0x4e, 0x65, 0x70, 0x4e, 0x60, 0x70, 0x5e, 0x5a, 0x70, 0x91, 0x99, 0x7f,
-    0x70, 0x84, 0x91, 0x91, 0x4e, 0x4e, 0x99, 0xaa, 0x81, 0x3e, 0x48, 0x64,
-    0x98, 0x99, 0x65, 0x65, 0x8e, 0x99, 0xab, 0xab, 0x8e, 0x65, 0x84, 0x99,
-    0x6e, 0x6e, 0x94, 0x6e, 0x74, 0x99, 0x94, 0x99, 0x99, 0xab, 0x94, 0x81,
-    0x94, 0x9c, 0xaa, 0xa9, 0x8e, 0x8e, 0x8b, 0x9c, 0x74, 0x74, 0x94, 0x94,
-    0x94, 0x8e, 0x99, 0x84, 0x74, 0x6e, 0x65, 0x99, 0x94, 0x8e, 0x8e, 0x74,
-    0x94, 0x99, 0x73, 0x73, 0x99, 0x8e, 0x8e, 0x74, 0x8c, 0xaa, 0xab, 0x65,
-    0x95, 0x99, 0x6e, 0x90, 0x4a, 0x6e, 0xab, 0x99, 0x4e, 0x3e, 0x5a, 0x9f,
-    0x99, 0x69, 0x57, 0x81, 0x95, 0x9f, 0x9d, 0x99, 0x5a, 0x60, 0x69, 0x65,
-    0x70, 0x79, 0x5a, 0x54, 0x73, 0x84, 0x7f, 0x7f, 0x84, 0x84, 0x60, 0x60,
-    0x91, 0x65, 0x79, 0x64, 0x4e, 0x5b, 0x5e, 0x5e, 0x51, 0x4e, 0x5e, 0x4e,
-    0x63, 0x50, 0x5b, 0x4d, 0x48, 0x26, 0x32, 0x63, 0x58, 0x4d, 0x4d, 0x43,
-    0x5d, 0x48, 0x26, 0x3a, 0x33, 0x3c, 0x34, 0x4d, 0x58, 0x67, 0x26, 0x1f,
-    0x47, 0x4d, 0x3a, 0x12, 0x12, 0x58, 0x67, 0x12, 0x00, 0x01, 0x14, 0x47,
-    0x2d, 0x04, 0x10, 0x31, 0x31, 0x4f, 0x38, 0x09, 0x00, 0x0d, 0x12, 0x11,
-    0x0d, 0x11, 0x12, 0x12, 0x14, 0x18, 0x25, 0x28, 0x2e, 0x11, 0x00, 0x17,
-    0x25, 0x12, 0x28, 0x0a, 0x11, 0x25, 0x11, 0x08, 0x08, 0x11, 0x1e, 0x1c,
-    0x21, 0x0f, 0x0c, 0x0c, 0x08, 0x07, 0x0a, 0x04, 0x14, 0x03, 0x08, 0x0f,
-    0x1b, 0x02, 0x08, 0x0a, 0x07, 0x0a, 0x08, 0x0f, 0x37, 0x17, 0x00, 0x06,
-    0x08, 0x17, 0x1e, 0x0a, 0x0a, 0x0a, 0x0a, 0x13, 0x11, 0x17, 0x4b, 0x4b,
-    0x1c, 0x03, 0x00, 0x08, 0x06, 0x13, 0x2b, 0x40, 0x08, 0x06, 0x06, 0x13,
-    0x1d, 0x4f, 0x37, 0x0f, 0x08, 0x28, 0x14, 0x08, 0x14, 0x26, 0x14, 0x1d,
-    0x4c, 0x52, 0x2d, 0x28, 0x28, 0x1d, 0x52, 0x52, 0x17, 0x1d, 0x10, 0x1d,
-    0x26, 0x12, 0x04, 0x12, 0x58, 0x52, 0x36, 0x27, 0x3c, 0x48, 0x3a, 0x2d,
-    0x3e, 0x6c, 0x89, 0x78, 0x5d, 0x3a, 0x58, 0x5b, 0x56, 0x27, 0x1f, 0x33,
-    0x58, 0x6a, 0x85, 0x75, 0x56, 0x56, 0x60, 0x5d, 0x6c, 0xa7, 0xa7, 0x85,
-    0x5d, 0x48, 0x5e, 0x70, 0x70, 0x60, 0x96, 0x78, 0x4e, 0x65, 0x60, 0x65,
-    0x99, 0xb1, 0x78, 0x56, 0x7f, 0x7f, 0x4a, 0x60, 0x90, 0x73, 0x65, 0x8e,
-    0x94, 0x8e, 0x84, 0x90, 0x84, 0xab, 0x9c, 0x98, 0x57, 0x65, 0x5a, 0x6e,
-    0x69, 0x54, 0x54, 0x84, 0x9b, 0x7a, 0x6e, 0x7a, 0x99, 0x94, 0x7a, 0x74,
-    0x94, 0xab, 0xa9, 0xab, 0x8b, 0x99, 0x9c, 0x9c, 0x74, 0x6e, 0x74, 0x7a,
-    0x9c, 0xae, 0xa9, 0x94, 0x74, 0xaa, 0x9c, 0x7a, 0xb4, 0xbc, 0xab, 0x99,
-    0x65, 0x8b, 0x94, 0x9c, 0x8b, 0x99, 0xaa, 0x6e, 0x8b, 0x8e, 0x98, 0xa9,
-    0xbc, 0xa1, 0x73, 0x99, 0x9c, 0x65, 0x70, 0x95, 0x7a, 0x84, 0x95, 0x9c,
-    0x9c, 0x95, 0x90, 0x90, 0xab, 0xad, 0x94, 0x5a, 0x65, 0x64, 0x64, 0x65,
-    0x57, 0x45, 0x70, 0x9f, 0x99, 0x73, 0x65, 0x7f, 0x84, 0x64, 0x60, 0x73,
-    0x9f, 0x91, 0x9f, 0x91, 0x5a, 0x91, 0x81, 0x65, 0x4e, 0x45, 0x4e, 0x60,
-    0x96, 0x96, 0x77, 0x4e, 0x5b, 0x7f, 0x4a, 0x85, 0xa7, 0xa0, 0x86, 0x48,
-    0x27, 0x56, 0x5d, 0x56, 0x3e, 0x7b, 0x58, 0x4d, 0x58, 0x3a, 0x56, 0x89,
-    0x78, 0x1f, 0x2f, 0x5b, 0x26, 0x06, 0x1d, 0x52, 0x47, 0x3a, 0x48, 0x5f,
-    0x43, 0x52, 0x3f, 0x3c, 0x5f, 0x67, 0x28, 0x14, 0x14, 0x11, 0x1e, 0x12,
-    0x06, 0x0e, 0x28, 0x40, 0x25, 0x0d, 0x12, 0x1d, 0x14, 0x06, 0x11, 0x36,
-    0x52, 0x52, 0x31, 0x11, 0x0a, 0x2e, 0x18, 0x06, 0x08, 0x08, 0x0d, 0x1e,
-    0x17, 0x25, 0x0a, 0x0a, 0x17, 0x11, 0x11, 0x18, 0x4b, 0x35, 0x0f, 0x03,
-    0x08, 0x13, 0x1e, 0x0a, 0x25, 0x0a, 0x00, 0x0e, 0x08, 0x18, 0x2e, 0x2e,
-    0x0a, 0x03, 0x08, 0x0f, 0x00, 0x00, 0x11, 0x0e, 0x00, 0x00, 0x08, 0x14,
-    0x1e, 0x1e, 0x1c, 0x1e, 0x0a, 0x11, 0x0e, 0x0a, 0x1c, 0x2e, 0x1c, 0x1e,
-    0x11, 0x00, 0x20, 0x25, 0x11, 0x0d, 0x14, 0x3d, 0x31, 0x08, 0x13, 0x28,
-    0x40, 0x1e, 0x06, 0x28, 0x44, 0x28, 0x00, 0x09, 0x28, 0x3c, 0x26, 0x14,
-    0x0d, 0x3d, 0x5f, 0x52, 0x28, 0x28, 0x3a, 0x58, 0x3c, 0x28, 0x63, 0x1a,
-    0x1a, 0x58, 0x3a, 0x3c, 0x1f, 0x26, 0x1a, 0x1f, 0x3e, 0x3e, 0x3a, 0x33,
-    0x3a, 0x32, 0x3c, 0x33, 0x3e, 0x5b, 0x6a, 0x34, 0x1f, 0x58, 0x5b, 0x56,
-    0x85, 0x86, 0x56, 0x70, 0x7f, 0x5e, 0x5e, 0x70, 0x86, 0x96, 0x7f, 0x65,
-    0x4e, 0x57, 0x78, 0x70, 0x70, 0x79, 0x84, 0x9d, 0x5e, 0x5e, 0x85, 0x91,
-    0x84, 0x5a, 0x73, 0x84, 0x84, 0x65, 0x65, 0x65, 0x99, 0x74, 0x65, 0x70,
-    0x81, 0xa2, 0xa2, 0x98, 0x84, 0x7a, 0x9c, 0x98, 0x6e, 0x9c, 0x74, 0x69,
-    0x9c, 0x8b, 0x95, 0x65, 0x6e, 0x8b, 0x6e, 0x74, 0x98, 0x7a, 0x6e, 0x74,
-    0x94, 0x81, 0x81, 0x7a, 0xab, 0xae, 0x94, 0x6e, 0x74, 0x94, 0x8b, 0x9c,
-    0xad, 0x9c, 0x94, 0xa9, 0x9c, 0x94, 0xa2, 0xa2, 0xad, 0x9c, 0xa2, 0x7a,
-    0x8b, 0x9c, 0x8b, 0x94, 0x9c, 0x9b, 0xb4, 0xaf, 0x84, 0x95, 0xab, 0x9c,
-    0x74, 0x8e, 0x8c, 0x99, 0x81, 0x6e, 0x6e, 0x8b, 0xa2, 0x74, 0x65, 0x69,
-    0xa2, 0xad, 0x9c, 0x84, 0x73, 0x94, 0x99, 0x6e, 0x8e, 0xab, 0x57, 0x6e,
-    0x99, 0x84, 0x65, 0x65, 0x70, 0x70, 0x70, 0x5a, 0x65, 0x57, 0x5a, 0x7f,
-    0x70, 0x56, 0x70, 0x64, 0x81, 0x64, 0x54, 0x48, 0x5e, 0x70, 0x60, 0x90,
-    0x79, 0x5d, 0x7f, 0x5e, 0x4e, 0x5b, 0x60, 0x7f, 0x85, 0x70, 0x4e, 0x3a,
-    0x50, 0x5d, 0x51, 0x4e, 0x5d, 0x85, 0x75, 0x47, 0x3a, 0x43, 0x63, 0x2f,
-    0x26, 0x47, 0x52, 0x47, 0x12, 0x1a, 0x3a, 0x47, 0x47, 0x28, 0x12, 0x47,
-    0x63, 0x58, 0x47, 0x1d, 0x26, 0x5f, 0x31, 0x12, 0x5c, 0x28, 0x14, 0x31,
-    0x1d, 0x12, 0x11, 0x13, 0x0d, 0x06, 0x0d, 0x1d, 0x17, 0x0f, 0x18, 0x13,
-    0x0a, 0x0a, 0x11, 0x1e, 0x38, 0x11, 0x00, 0x0e, 0x25, 0x14, 0x18, 0x18,
-    0x1e, 0x1e, 0x1e, 0x0a, 0x0f, 0x1e, 0x1c, 0x2e, 0x1c, 0x1e, 0x00, 0x08,
-    0x1e, 0x11, 0x11, 0x0a, 0x1e, 0x40, 0x0f, 0x0f, 0x08, 0x1e, 0x1e, 0x08,
-    0x02, 0x08, 0x17, 0x03, 0x08, 0x0a, 0x1e, 0x1e, 0x0a, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x0d, 0x0a, 0x08, 0x03, 0x07, 0x35, 0x1e, 0x0d, 0x0b, 0x09,
-    0x13, 0x06, 0x06, 0x06, 0x00, 0x0e, 0x61, 0x7d, 0x28, 0x08, 0x1e, 0x0e,
-    0x08, 0x11, 0x38, 0x44, 0x1d, 0x47, 0x58, 0x38, 0x28, 0x12, 0x06, 0x06,
-    0x2d, 0x3a, 0x26, 0x26, 0x5f, 0x63, 0x5d, 0x66, 0x4d, 0x2f, 0x4d, 0x63,
-    0x43, 0x2f, 0x4d, 0x3c, 0x58, 0x5d, 0x58, 0x56, 0x33, 0x32, 0x9a, 0x85,
-    0x5b, 0x66, 0x58, 0x58, 0x5d, 0x58, 0x63, 0x78, 0x48, 0x33, 0x1d, 0x3a,
-    0x48, 0x5d, 0x70, 0x56, 0x3e, 0x50, 0x79, 0x65, 0x70, 0x70, 0x60, 0x70,
-    0x73, 0x79, 0x57, 0x45, 0x41, 0x90, 0xac, 0x90, 0x65, 0x65, 0x65, 0x4e,
-    0x65, 0x73, 0x9f, 0x84, 0x9f, 0xab, 0x8b, 0x74, 0x81, 0x70, 0x70, 0x81,
-    0x94, 0x99, 0x8e, 0x9c, 0xab, 0xab, 0xab, 0x9c, 0x74, 0x8e, 0xaa, 0x9b,
-    0x7a, 0x99, 0x94, 0x8b, 0x9c, 0x8b, 0x9c, 0x8b, 0x69, 0xad, 0xbc, 0xab,
-    0xab, 0x9c, 0x94, 0x9c, 0x99, 0x94, 0xab, 0x8b, 0x81, 0x65, 0x73, 0x8e,
-    0x7a, 0x9c, 0x94, 0x69, 0x74, 0x9c, 0x9c, 0x94, 0x9c, 0x74, 0x94, 0x9c,
-    0x94, 0x6e, 0x74, 0x65, 0x8b, 0xbc, 0xbc, 0x94, 0x7a, 0x99, 0x65, 0x70,
-    0x7a, 0x99, 0x94, 0x98, 0xab, 0xb4, 0x94, 0x74, 0x84, 0x65, 0x73, 0x98,
-    0x99, 0x6e, 0x8b, 0xab, 0xaa, 0x9d, 0xaa, 0x8e, 0x65, 0x8e, 0x94, 0x81,
-    0x65, 0x90, 0x65, 0x90, 0x91, 0x91, 0x90, 0x4e, 0x5a, 0xac, 0x91, 0x79,
-    0x91, 0x5e, 0x79, 0x70, 0x60, 0x86, 0x78, 0x48, 0x3a, 0x1f, 0x48, 0x58,
-    0x4e, 0x6c, 0x4d, 0x33, 0x4e, 0x70, 0x50, 0x60, 0x45, 0x58, 0x78, 0x4e,
-    0x34, 0x3a, 0x1d, 0x1f, 0x7b, 0x9a, 0x5d, 0x2f, 0x3a, 0x33, 0x12, 0x28,
-    0x5f, 0x58, 0x33, 0x52, 0x5c, 0x52, 0x26, 0x3c, 0x12, 0x12, 0x3c, 0x47,
-    0x31, 0x28, 0x5f, 0x5f, 0x53, 0x5f, 0x38, 0x0d, 0x25, 0x4c, 0x1d, 0x12,
-    0x25, 0x13, 0x18, 0x3c, 0x2e, 0x28, 0x0a, 0x13, 0x61, 0x61, 0x11, 0x1e,
-    0x12, 0x0a, 0x1e, 0x18, 0x18, 0x11, 0x06, 0x00, 0x00, 0x03, 0x03, 0x08,
-    0x0a, 0x06, 0x08, 0x08, 0x1c, 0x2b, 0x13, 0x11, 0x0a, 0x13, 0x0e, 0x00,
-    0x11, 0x03, 0x02, 0x2e, 0x61, 0x35, 0x07, 0x08, 0x07, 0x03, 0x08, 0x07,
-    0x2e, 0x0a, 0x0e, 0x08, 0x0e, 0x1e, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00,
-    0x0e, 0x1c, 0x0f, 0x02, 0x00, 0x11, 0x31, 0x25, 0x1e, 0x28, 0x0d, 0x04,
-    0x14, 0x20, 0x25, 0x1e, 0x00, 0x0e, 0x18, 0x40, 0x61, 0x40, 0x25, 0x14,
-    0x0d, 0x11, 0x1e, 0x26, 0x31, 0x28, 0x12, 0x0d, 0x18, 0x47, 0x1f, 0x12,
-    0x38, 0x28, 0x12, 0x26, 0x26, 0x2f, 0x4d, 0x33, 0x2f, 0x1a, 0x2f, 0x58,
-    0x48, 0x26, 0x33, 0x5d, 0x5d, 0x3e, 0x27, 0x26, 0x48, 0x5d, 0x66, 0x8a,
-    0x89, 0x6c, 0x3a, 0x2f, 0x6a, 0x78, 0x5d, 0x3e, 0x41, 0x4e, 0x34, 0x51,
-    0x85, 0x65, 0x4e, 0x57, 0x57, 0x81, 0x9d, 0x79, 0x73, 0x73, 0x70, 0x70,
-    0x73, 0x84, 0x85, 0x4e, 0x4e, 0x7f, 0x84, 0xaf, 0x9f, 0x81, 0x65, 0x73,
-    0x65, 0x57, 0x74, 0x94, 0x95, 0x7f, 0x5e, 0x65, 0x94, 0x99, 0x81, 0x8e,
-    0x7a, 0x65, 0x64, 0x84, 0x73, 0x99, 0x94, 0x7a, 0x81, 0x69, 0x99, 0x99,
-    0x6e, 0x81, 0x94, 0xa9, 0x9c, 0x8c, 0x65, 0x81, 0x94, 0x94, 0xae, 0xae,
-    0x9c, 0x7a, 0x73, 0x94, 0xab, 0x9c, 0x94, 0x8c, 0x82, 0x8c, 0x6e, 0x94,
-    0x9c, 0x7a, 0x8b, 0x94, 0x9b, 0xb4, 0x92, 0xa2, 0x9c, 0x94, 0x74, 0x99,
-    0x9c, 0x94, 0x6e, 0x81, 0x94, 0x94, 0xb4, 0xbc, 0x99, 0x7a, 0x99, 0x73,
-    0x5a, 0x8e, 0x9c, 0x94, 0x84, 0x7f, 0x70, 0x74, 0x94, 0x69, 0x65, 0x8e,
-    0x64, 0x60, 0x65, 0x65, 0x69, 0x84, 0x73, 0x69, 0x54, 0x7f, 0x84, 0x70,
-    0x5e, 0x5e, 0x91, 0x91, 0x5a, 0x4e, 0x50, 0x70, 0x79, 0x91, 0x9f, 0x90,
-    0x5e, 0x34, 0x56, 0x70, 0x85, 0x70, 0x41, 0x48, 0x4e, 0x33, 0x48, 0x78,
-    0x58, 0x4d, 0x4e, 0x45, 0x70, 0x79, 0x5b, 0x4e, 0x4e, 0x3a, 0x4d, 0x58,
-    0x43, 0x4c, 0x1f, 0x3a, 0x58, 0x63, 0x72, 0x52, 0x47, 0x2d, 0x1a, 0x14,
-    0x12, 0x36, 0x3a, 0x3c, 0x1a, 0x0a, 0x12, 0x3c, 0x3c, 0x11, 0x31, 0x31,
-    0x13, 0x14, 0x12, 0x14, 0x31, 0x14, 0x14, 0x06, 0x14, 0x26, 0x1e, 0x0d,
-    0x17, 0x25, 0x38, 0x1e, 0x0a, 0x0a, 0x0a, 0x1e, 0x14, 0x40, 0x38, 0x17,
-    0x11, 0x0e, 0x17, 0x2b, 0x13, 0x0a, 0x08, 0x08, 0x00, 0x07, 0x1e, 0x28,
-    0x06, 0x00, 0x08, 0x17, 0x25, 0x2e, 0x12, 0x17, 0x08, 0x0e, 0x1c, 0x1b,
-    0x1c, 0x0f, 0x08, 0x0a, 0x17, 0x35, 0x29, 0x07, 0x0e, 0x11, 0x08, 0x0a,
-    0x1e, 0x2b, 0x37, 0x25, 0x0a, 0x0a, 0x00, 0x00, 0x1c, 0x4f, 0x4b, 0x40,
-    0x0e, 0x08, 0x08, 0x0e, 0x2e, 0x25, 0x04, 0x07, 0x4c, 0x46, 0x08, 0x13,
-    0x38, 0x0e, 0x0a, 0x28, 0x1e, 0x0e, 0x17, 0x14, 0x18, 0x09, 0x0a, 0x3a,
-    0x12, 0x11, 0x13, 0x44, 0x52, 0x38, 0x36, 0x1d, 0x04, 0x26, 0x66, 0x5f,
-    0x52, 0x3a, 0x1a, 0x47, 0x58, 0x26, 0x66, 0x63, 0x2f, 0x51, 0x56, 0x27,
-    0x47, 0x66, 0x5d, 0x4d, 0x26, 0x27, 0x63, 0x6c, 0x5b, 0x51, 0x3e, 0x3e,
-    0x6c, 0x86, 0x93, 0x78, 0x5e, 0x5d, 0x56, 0x7f, 0x9f, 0x9f, 0xac, 0x81,
-    0x4e, 0x48, 0x45, 0x91, 0x99, 0x65, 0x60, 0x91, 0xac, 0x70, 0x60, 0x91,
-    0x69, 0x65, 0x73, 0x70, 0x60, 0x6e, 0x8e, 0x69, 0x65, 0x57, 0x9f, 0x9d,
-    0x70, 0x70, 0x81, 0xac, 0x84, 0x84, 0x7a, 0x5a, 0x65, 0xa9, 0x9c, 0x94,
-    0x99, 0x8e, 0x74, 0xa2, 0x7a, 0x8b, 0xb4, 0x8e, 0x8e, 0xa9, 0x74, 0x7a,
-    0x98, 0x9c, 0x8c, 0x69, 0x65, 0x99, 0xa9, 0x92, 0x94, 0x6e, 0x7a, 0x9c,
-    0x9c, 0xa9, 0xad, 0x9b, 0x94, 0x82, 0x9b, 0xb8, 0xbc, 0xbc, 0xab, 0x9b,
-    0x84, 0x69, 0x94, 0xbc, 0x9c, 0x74, 0x9c, 0xbc, 0xa9, 0x74, 0x9c, 0x9c,
-    0x74, 0x99, 0x8b, 0x81, 0x7a, 0x94, 0x8b, 0x7a, 0x69, 0x95, 0xaf, 0x84,
-    0x65, 0x6e, 0x9b, 0x95, 0x84, 0x95, 0x65, 0x54, 0x99, 0xaf, 0x99, 0x84,
-    0x74, 0x64, 0x84, 0x8e, 0x65, 0x9d, 0x8e, 0x5a, 0x7f, 0x70, 0x54, 0x5e,
-    0x91, 0x79, 0x70, 0x48, 0x4e, 0x79, 0x81, 0x60, 0x4e, 0x4e, 0x5e, 0x85,
-    0x85, 0x96, 0x77, 0x70, 0x56, 0x45, 0x96, 0x9f, 0x91, 0x96, 0x70, 0x34,
-    0x27, 0x34, 0x86, 0x70, 0x2f, 0x34, 0x85, 0x89, 0x3c, 0x36, 0x66, 0x33,
-    0x33, 0x43, 0x31, 0x28, 0x3c, 0x3c, 0x4d, 0x14, 0x12, 0x67, 0x3c, 0x14,
-    0x1d, 0x47, 0x58, 0x2e, 0x26, 0x1d, 0x00, 0x14, 0x52, 0x44, 0x44, 0x36,
-    0x1d, 0x0e, 0x1d, 0x12, 0x31, 0x40, 0x11, 0x13, 0x1e, 0x06, 0x0a, 0x2b,
-    0x28, 0x0e, 0x00, 0x00, 0x18, 0x25, 0x14, 0x11, 0x0e, 0x17, 0x37, 0x38,
-    0x2e, 0x1e, 0x0e, 0x06, 0x00, 0x0a, 0x2e, 0x46, 0x40, 0x17, 0x00, 0x03,
-    0x08, 0x1e, 0x37, 0x17, 0x08, 0x1e, 0x4f, 0x0c, 0x00, 0x2e, 0x1e, 0x03,
-    0x0f, 0x11, 0x08, 0x0a, 0x00, 0x17, 0x1e, 0x35, 0x18, 0x0a, 0x1e, 0x44,
-    0x25, 0x02, 0x13, 0x14, 0x08, 0x00, 0x07, 0x18, 0x1e, 0x1b, 0x40, 0x1c,
-    0x08, 0x0c, 0x37, 0x2e, 0x14, 0x0e, 0x0d, 0x1e, 0x1e, 0x28, 0x18, 0x11,
-    0x1e, 0x11, 0x13, 0x09, 0x12, 0x3a, 0x2f, 0x12, 0x11, 0x1d, 0x1d, 0x3f,
-    0x2d, 0x44, 0x47, 0x36, 0x43, 0x3c, 0x3c, 0x7b, 0x63, 0x26, 0x31, 0x58,
-    0x63, 0x63, 0x6a, 0x5b, 0x63, 0x85, 0x89, 0x3e, 0x28, 0x26, 0x4d, 0x5d,
-    0x56, 0x32, 0x56, 0x3a, 0x48, 0x5b, 0x7f, 0x93, 0x58, 0x4e, 0x91, 0x7f,
-    0x56, 0x78, 0x86, 0x5d, 0x45, 0x5e, 0x81, 0x70, 0x70, 0x93, 0x9f, 0x79,
-    0x60, 0x91, 0x91, 0x86, 0x70, 0x60, 0x5e, 0x7f, 0x81, 0x84, 0x70, 0x73,
-    0x91, 0x70, 0x70, 0x64, 0x98, 0x98, 0x65, 0x5e, 0x54, 0x8e, 0x8b, 0x95,
-    0x90, 0x9f, 0x99, 0x99, 0x99, 0x8e, 0xab, 0xb4, 0x99, 0x81, 0x94, 0x9c,
-    0xa2, 0xab, 0x9c, 0x9c, 0xaa, 0xae, 0x9c, 0x6e, 0x65, 0x7a, 0x9c, 0x9c,
-    0x74, 0x94, 0x7a, 0x7a, 0x9b, 0x9c, 0xad, 0x9c, 0x7a, 0xb4, 0xbc, 0x99,
-    0x8b, 0xb4, 0x9b, 0x7a, 0x7a, 0xab, 0xab, 0x9b, 0x9c, 0xab, 0xa9, 0x8e,
-    0x99, 0xad, 0x9c, 0x94, 0x8b, 0x8b, 0x8b, 0x94, 0x9c, 0x8b, 0x8e, 0xab,
-    0x8e, 0x81, 0x74, 0x8b, 0xa9, 0x95, 0x70, 0x65, 0x81, 0x82, 0x94, 0x9f,
-    0x9f, 0x95, 0x95, 0x95, 0x84, 0x8e, 0xaf, 0x9d, 0x91, 0x81, 0x99, 0x99,
-    0x99, 0x9f, 0x91, 0x9f, 0xb1, 0x90, 0x54, 0x41, 0x4e, 0x65, 0x8e, 0x60,
-    0x57, 0x57, 0x50, 0x57, 0x70, 0x91, 0x7f, 0x48, 0x70, 0x9f, 0x85, 0x4a,
-    0x70, 0x70, 0x3e, 0x34, 0x5d, 0x6c, 0x5d, 0x5d, 0x8a, 0x89, 0x58, 0x34,
-    0x5d, 0x75, 0x58, 0x3a, 0x33, 0x36, 0x33, 0x58, 0x3a, 0x26, 0x47, 0x3c,
-    0x1a, 0x26, 0x1a, 0x58, 0x3a, 0x1a, 0x12, 0x1f, 0x26, 0x33, 0x26, 0x3c,
-    0x47, 0x12, 0x44, 0x36, 0x31, 0x4c, 0x47, 0x28, 0x0d, 0x28, 0x4c, 0x47,
-    0x40, 0x18, 0x31, 0x4f, 0x4f, 0x25, 0x08, 0x08, 0x1e, 0x25, 0x0d, 0x06,
-    0x18, 0x00, 0x08, 0x1e, 0x37, 0x40, 0x1e, 0x17, 0x38, 0x4f, 0x0a, 0x08,
-    0x17, 0x0e, 0x08, 0x02, 0x17, 0x1c, 0x18, 0x2e, 0x35, 0x0f, 0x05, 0x1c,
-    0x35, 0x17, 0x08, 0x03, 0x00, 0x17, 0x11, 0x0f, 0x0a, 0x11, 0x17, 0x08,
-    0x07, 0x08, 0x37, 0x61, 0x62, 0x28, 0x0a, 0x08, 0x03, 0x09, 0x0f, 0x0f,
-    0x08, 0x06, 0x04, 0x01, 0x05, 0x0c, 0x29, 0x29, 0x07, 0x05, 0x1b, 0x35,
-    0x11, 0x00, 0x0d, 0x14, 0x28, 0x31, 0x2b, 0x13, 0x1e, 0x1e, 0x4f, 0x61,
-    0x36, 0x67, 0x4d, 0x06, 0x1d, 0x5c, 0x39, 0x39, 0x52, 0x38, 0x1d, 0x66,
-    0x66, 0x36, 0x12, 0x06, 0x1d, 0x53, 0x47, 0x2f, 0x26, 0x36, 0x1a, 0x3c,
-    0x58, 0x27, 0x1f, 0x51, 0x66, 0x3a, 0x2f, 0x3e, 0x86, 0x5d, 0x51, 0x3a,
-    0x2f, 0x6c, 0x96, 0xb1, 0x91, 0x70, 0x41, 0x41, 0x4e, 0x4e, 0x4e, 0x5e,
-    0x60, 0x5b, 0x56, 0x3a, 0x5d, 0x86, 0x96, 0x5e, 0x48, 0x4e, 0x70, 0x91,
-    0x5e, 0x54, 0x70, 0x84, 0x9f, 0x99, 0x84, 0x65, 0x8e, 0xab, 0xaf, 0x8e,
-    0x98, 0xa2, 0x74, 0x64, 0xab, 0x9c, 0x6e, 0x94, 0x8c, 0x5a, 0x99, 0xab,
-    0xab, 0x84, 0x5e, 0x70, 0xab, 0xab, 0x8b, 0x74, 0x6e, 0x84, 0x74, 0x94,
-    0x8b, 0x69, 0x74, 0xab, 0x74, 0x7a, 0x8b, 0xa4, 0xa4, 0x9c, 0x8b, 0x81,
-    0x94, 0xbc, 0xbc, 0xbc, 0xae, 0x82, 0x8c, 0x8b, 0x9b, 0x8c, 0x94, 0x8c,
-    0x8e, 0x7a, 0x6e, 0x84, 0x9b, 0xab, 0x99, 0x65, 0x69, 0x8b, 0xab, 0x9c,
-    0x8b, 0x94, 0x9c, 0xab, 0x9c, 0xa2, 0x94, 0x94, 0x9c, 0xb4, 0xaa, 0x9c,
-    0xae, 0xa2, 0x69, 0x9c, 0xab, 0x7a, 0x94, 0x9c, 0x84, 0x5a, 0xac, 0xaf,
-    0x99, 0x57, 0x4e, 0x91, 0x9d, 0x8e, 0x81, 0x69, 0x65, 0x54, 0x73, 0x7f,
-    0x4e, 0x4e, 0x91, 0x73, 0x54, 0x54, 0x79, 0x91, 0x79, 0x70, 0x45, 0x60,
-    0x91, 0xb1, 0xaf, 0x9f, 0x70, 0x50, 0x50, 0x60, 0x56, 0x48, 0x4e, 0x51,
-    0x3e, 0x2d, 0x28, 0x58, 0x89, 0x89, 0x26, 0x1f, 0x3a, 0x66, 0x5d, 0x27,
-    0x3a, 0x3a, 0x66, 0x66, 0x56, 0x47, 0x33, 0x48, 0x6d, 0x63, 0x3a, 0x63,
-    0x5d, 0x1d, 0x26, 0x63, 0x3c, 0x31, 0x53, 0x36, 0x0d, 0x4f, 0x61, 0x3c,
-    0x0e, 0x08, 0x12, 0x1d, 0x1e, 0x12, 0x11, 0x23, 0x3b, 0x3b, 0x49, 0x3b,
-    0x23, 0x3b, 0x49, 0x3b, 0x23, 0x13, 0x14, 0x18, 0x11, 0x08, 0x03, 0x1e,
-    0x4f, 0x61, 0x4f, 0x1e, 0x08, 0x08, 0x0e, 0x0a, 0x08, 0x0a, 0x08, 0x0a,
-    0x0f, 0x03, 0x05, 0x1c, 0x4b, 0x1c, 0x05, 0x1b, 0x1c, 0x1c, 0x02, 0x00,
-    0x0a, 0x11, 0x2b, 0x1e, 0x0e, 0x0a, 0x0a, 0x17, 0x13, 0x02, 0x03, 0x08,
-    0x08, 0x06, 0x08, 0x0e, 0x04, 0x08, 0x07, 0x18, 0x0a, 0x08, 0x0e, 0x0e,
-    0x4b, 0x4b, 0x21, 0x02, 0x0c, 0x40, 0x46, 0x0f, 0x00, 0x03, 0x00, 0x0d,
-    0x17, 0x0e, 0x11, 0x37, 0x2e, 0x14, 0x25, 0x1d, 0x13, 0x12, 0x2e, 0x36,
-    0x4f, 0x52, 0x3a, 0x0d, 0x14, 0x66, 0x75, 0x5f, 0x52, 0x3c, 0x3c, 0x58,
-    0x3c, 0x1d, 0x28, 0x1a, 0x2d, 0x4d, 0x58, 0x26, 0x3e, 0x56, 0x48, 0x3a,
-    0x66, 0x8a, 0x48, 0x4a, 0x78, 0x5d, 0x3e, 0x5b, 0x48, 0x3e, 0x48, 0x34,
-    0x5e, 0x5b, 0x48, 0x4e, 0x5e, 0x5d, 0x4e, 0x60, 0x70, 0x70, 0x5e, 0x90,
-    0xb1, 0x96, 0x3e, 0x3e, 0x90, 0xa7, 0x70, 0x4a, 0x4e, 0x5e, 0x57, 0x65,
-    0x70, 0x70, 0x8e, 0x99, 0x84, 0x8e, 0x6e, 0x65, 0x65, 0x65, 0x8b, 0xae,
-    0x9c, 0x99, 0x84, 0x65, 0xa2, 0xb4, 0xac, 0xab, 0x99, 0x7a, 0x9c, 0x9c,
-    0x94, 0x74, 0x8b, 0x74, 0x94, 0x94, 0x7a, 0x7a, 0xaa, 0x9c, 0x8c, 0xab,
-    0xb8, 0x9c, 0x82, 0x92, 0x92, 0x88, 0x99, 0x94, 0x6e, 0x94, 0x74, 0x82,
-    0x94, 0x8b, 0x94, 0x9b, 0x94, 0x8c, 0x94, 0x82, 0x9c, 0x8c, 0x9b, 0xbc,
-    0xb8, 0x8e, 0x69, 0x99, 0xbc, 0xab, 0x73, 0x69, 0x74, 0x6e, 0x74, 0x8e,
-    0x6e, 0x94, 0xae, 0x94, 0x94, 0x94, 0x7a, 0x7a, 0x6e, 0x74, 0x92, 0xad,
-    0x99, 0x99, 0x69, 0x88, 0xae, 0xac, 0xab, 0x99, 0x91, 0x99, 0x99, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x84, 0x73, 0x70, 0x81, 0x73, 0x65, 0x7f, 0xac,
-    0x9f, 0x70, 0x70, 0x99, 0x65, 0x60, 0x65, 0x56, 0x54, 0x5b, 0x4e, 0x70,
-    0x4e, 0x4e, 0x70, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x5d, 0x4e, 0x93, 0x9a,
-    0x63, 0x26, 0x2f, 0x97, 0x97, 0x3a, 0x26, 0x1f, 0x1a, 0x36, 0x3a, 0x1f,
-    0x31, 0x58, 0x58, 0x3a, 0x52, 0x27, 0x26, 0x26, 0x33, 0x58, 0x75, 0x58,
-    0x47, 0x28, 0x0d, 0x58, 0x6d, 0x5f, 0x4f, 0x28, 0x26, 0x47, 0x28, 0x20,
-    0x1d, 0x11, 0x06, 0x59, 0xdc, 0xce, 0xce, 0xd4, 0xd3, 0xd3, 0xda, 0xda,
-    0xc3, 0x06, 0x1d, 0x14, 0x0e, 0x18, 0x0a, 0x00, 0x06, 0x08, 0x0a, 0x07,
-    0x08, 0x0a, 0x08, 0x08, 0x11, 0x17, 0x00, 0x07, 0x08, 0x14, 0x55, 0x4b,
-    0x0f, 0x05, 0x1c, 0x35, 0x1c, 0x00, 0x02, 0x00, 0x02, 0x05, 0x0a, 0x08,
-    0x11, 0x17, 0x06, 0x0a, 0x25, 0x2e, 0x0a, 0x00, 0x00, 0x0a, 0x25, 0x1e,
-    0x11, 0x07, 0x08, 0x1e, 0x38, 0x11, 0x08, 0x08, 0x28, 0x2e, 0x25, 0x1e,
-    0x08, 0x0e, 0x06, 0x06, 0x11, 0x2e, 0x1e, 0x11, 0x31, 0x52, 0x39, 0x14,
-    0x2b, 0x5c, 0x37, 0x00, 0x0e, 0x00, 0x17, 0x39, 0x2e, 0x1a, 0x33, 0x33,
-    0x12, 0x06, 0x1e, 0x06, 0x12, 0x3a, 0x43, 0x5d, 0x3a, 0x43, 0x5d, 0x4d,
-    0x5b, 0x8a, 0x66, 0x1f, 0x36, 0x43, 0x5d, 0x5d, 0x43, 0x3e, 0x3e, 0x4e,
-    0x56, 0x45, 0x4e, 0x6c, 0x7f, 0x7f, 0x56, 0x2f, 0x4e, 0x78, 0x78, 0x78,
-    0x5d, 0x4e, 0x70, 0x91, 0x91, 0x4e, 0x4e, 0x79, 0x91, 0x91, 0x73, 0x5e,
-    0x5e, 0x60, 0x5e, 0x4e, 0x73, 0x8e, 0x81, 0x73, 0x9d, 0xab, 0x6e, 0x81,
-    0xab, 0xac, 0x5a, 0x5a, 0x5a, 0x70, 0x9f, 0x95, 0x73, 0x95, 0x8c, 0x84,
-    0x54, 0x77, 0x5e, 0x54, 0x8e, 0xab, 0xa2, 0xa2, 0x88, 0xae, 0xaa, 0x98,
-    0xb4, 0xb4, 0x8c, 0x84, 0x8c, 0xa9, 0xa9, 0x9b, 0x9b, 0x94, 0x9c, 0x94,
-    0x8b, 0x9c, 0x92, 0xa5, 0xa5, 0x9c, 0x84, 0x82, 0x92, 0xae, 0xae, 0x94,
-    0x88, 0x94, 0x92, 0xae, 0x94, 0x7a, 0x9b, 0xad, 0x9c, 0x9c, 0x9c, 0x99,
-    0x7a, 0x7a, 0x7a, 0x9c, 0x92, 0x9c, 0x94, 0xa9, 0xbc, 0x9c, 0x88, 0x9c,
-    0xae, 0x99, 0x6e, 0x8e, 0x65, 0x95, 0x99, 0x74, 0x99, 0x9c, 0x94, 0x64,
-    0x65, 0x5a, 0x54, 0x65, 0x9c, 0x9c, 0x9c, 0x74, 0x9c, 0x9c, 0x74, 0x94,
-    0x9d, 0x91, 0x4e, 0x5a, 0x90, 0x98, 0x95, 0x73, 0x7f, 0x65, 0x91, 0x70,
-    0x70, 0x73, 0x84, 0x96, 0x96, 0x4e, 0x41, 0x70, 0x70, 0x7f, 0x6c, 0x5d,
-    0x56, 0x5d, 0x93, 0x70, 0x4d, 0x56, 0x78, 0x75, 0x56, 0x6c, 0x4e, 0x48,
-    0x32, 0x26, 0x3a, 0x6c, 0x5b, 0x33, 0x5d, 0x8a, 0x5d, 0x4d, 0x48, 0x75,
-    0x58, 0x12, 0x1f, 0x10, 0x1d, 0x52, 0x3c, 0x28, 0x3a, 0x3a, 0x12, 0x06,
-    0x16, 0x05, 0x08, 0x44, 0x36, 0x43, 0x31, 0x36, 0x52, 0x40, 0x40, 0x6f,
-    0xdc, 0xcf, 0xce, 0xd3, 0xd3, 0xd4, 0xd3, 0xd0, 0xc3, 0x18, 0x11, 0x08,
-    0x1e, 0x25, 0x2e, 0x25, 0x08, 0x00, 0x0f, 0x37, 0x2e, 0x1b, 0x08, 0x00,
-    0x11, 0x28, 0x1e, 0x06, 0x08, 0x14, 0x2b, 0x1e, 0x11, 0x0e, 0x08, 0x0a,
-    0x00, 0x08, 0x11, 0x0e, 0x0e, 0x08, 0x1e, 0x40, 0x11, 0x00, 0x1e, 0x2e,
-    0x1e, 0x1e, 0x08, 0x02, 0x03, 0x08, 0x08, 0x0f, 0x1b, 0x17, 0x1e, 0x1e,
-    0x18, 0x11, 0x03, 0x09, 0x0e, 0x12, 0x25, 0x40, 0x61, 0x38, 0x2b, 0x31,
-    0x40, 0x5c, 0x40, 0x14, 0x12, 0x25, 0x12, 0x12, 0x20, 0x0d, 0x13, 0x28,
-    0x37, 0x1e, 0x2e, 0x12, 0x12, 0x47, 0x28, 0x12, 0x52, 0x31, 0x1e, 0x26,
-    0x1a, 0x12, 0x1a, 0x2d, 0x1f, 0x1d, 0x28, 0x2f, 0x3a, 0x3c, 0x33, 0x3a,
-    0x4d, 0x58, 0x3a, 0x43, 0x56, 0x5b, 0x85, 0x5b, 0x48, 0x5b, 0x4e, 0x5b,
-    0x78, 0x56, 0x26, 0x34, 0x56, 0x56, 0x3e, 0x4e, 0x70, 0x91, 0x65, 0x65,
-    0x91, 0x54, 0x60, 0x79, 0x79, 0x81, 0x91, 0xac, 0xac, 0x91, 0x9f, 0x91,
-    0x9d, 0xaa, 0x8e, 0x5a, 0x81, 0x81, 0x74, 0x8e, 0x7a, 0x65, 0x84, 0x90,
-    0x84, 0x84, 0x90, 0x5a, 0x8e, 0x99, 0x74, 0x8e, 0x99, 0x84, 0x8e, 0x7a,
-    0x6e, 0x7a, 0x7a, 0x74, 0x65, 0x73, 0x74, 0x94, 0x99, 0x74, 0x8c, 0x9b,
-    0x9c, 0x94, 0x8c, 0xa9, 0x9b, 0xad, 0xb4, 0x8c, 0x8c, 0x9c, 0x9c, 0xa2,
-    0x9c, 0x74, 0x6e, 0x94, 0x8c, 0x82, 0x94, 0xa2, 0xae, 0xa5, 0x92, 0xa5,
-    0x9c, 0x94, 0x9c, 0x9c, 0x94, 0xa9, 0xbc, 0xb8, 0xad, 0xa9, 0xba, 0xba,
-    0xbc, 0xae, 0x94, 0x94, 0x94, 0x82, 0x9c, 0x9c, 0x7a, 0x94, 0x9c, 0x99,
-    0x99, 0x99, 0x81, 0x74, 0x9c, 0x74, 0x82, 0x94, 0x8e, 0x69, 0x7a, 0x6e,
-    0x65, 0x81, 0x73, 0x54, 0x54, 0x65, 0x84, 0x73, 0x65, 0x5a, 0x73, 0x73,
-    0x81, 0x81, 0x81, 0x65, 0x84, 0x9d, 0x5a, 0x54, 0x70, 0x7f, 0x84, 0x90,
-    0x56, 0x3e, 0x48, 0x4e, 0x56, 0x4e, 0x5e, 0x7f, 0x7f, 0x60, 0x7f, 0x70,
-    0x4e, 0x4e, 0x4e, 0x43, 0x5d, 0x7f, 0xa0, 0x93, 0x75, 0x7b, 0x7b, 0x8a,
-    0x78, 0x56, 0x43, 0x5d, 0x4d, 0x3a, 0x5b, 0x3a, 0x3c, 0x47, 0x58, 0x26,
-    0x36, 0x1f, 0x18, 0x47, 0x26, 0x1d, 0x33, 0x44, 0x12, 0x2e, 0x18, 0x12,
-    0x14, 0x0d, 0x0d, 0x12, 0x18, 0x2e, 0x2e, 0x3b, 0xd0, 0xdc, 0xd4, 0xd4,
-    0xce, 0xcf, 0xd4, 0xd4, 0xd0, 0x2e, 0x11, 0x08, 0x0f, 0x1d, 0x37, 0x17,
-    0x00, 0x00, 0x08, 0x17, 0x07, 0x17, 0x1c, 0x17, 0x11, 0x17, 0x1e, 0x0e,
-    0x03, 0x0e, 0x08, 0x1e, 0x2e, 0x38, 0x37, 0x1c, 0x1c, 0x2e, 0x35, 0x2e,
-    0x17, 0x0c, 0x0c, 0x17, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x2e,
-    0x1b, 0x1e, 0x1c, 0x1e, 0x35, 0x17, 0x38, 0x40, 0x08, 0x0a, 0x40, 0x1e,
-    0x0e, 0x14, 0x1e, 0x11, 0x17, 0x17, 0x11, 0x13, 0x0e, 0x08, 0x17, 0x28,
-    0x06, 0x00, 0x08, 0x13, 0x0e, 0x01, 0x06, 0x26, 0x26, 0x40, 0x4d, 0x47,
-    0x26, 0x14, 0x09, 0x26, 0x43, 0x67, 0x7d, 0x3c, 0x43, 0x8a, 0x8a, 0x67,
-    0x2d, 0x52, 0x7d, 0x7b, 0x53, 0x2f, 0x3a, 0x63, 0x5f, 0x27, 0x26, 0x3a,
-    0x51, 0x51, 0x3e, 0x43, 0x4d, 0x78, 0x5d, 0x3a, 0x4e, 0x4e, 0x70, 0x7f,
-    0x5e, 0x78, 0x78, 0x96, 0x7f, 0x70, 0x9f, 0x7f, 0x48, 0x9f, 0x9f, 0x70,
-    0x65, 0x79, 0x73, 0x65, 0x70, 0x7f, 0x70, 0x70, 0x57, 0x65, 0x84, 0x81,
-    0x50, 0x54, 0x73, 0x64, 0x60, 0x5a, 0x84, 0x9f, 0xab, 0xaa, 0x99, 0x9b,
-    0x84, 0x65, 0x8e, 0x99, 0x9c, 0xbc, 0x9c, 0x8b, 0xb4, 0xb4, 0xb4, 0x99,
-    0x99, 0xac, 0xbc, 0x9c, 0x7a, 0x7a, 0xab, 0xad, 0x8c, 0x7a, 0x95, 0x8b,
-    0x94, 0x94, 0x8c, 0x7a, 0xa9, 0xa9, 0x8c, 0x99, 0x9c, 0x9c, 0xb8, 0xae,
-    0xa9, 0xa9, 0xad, 0xb8, 0x9c, 0xae, 0xba, 0x74, 0x9c, 0xbc, 0xaa, 0x9b,
-    0xad, 0xad, 0x8c, 0x8c, 0xab, 0x9b, 0x8c, 0x7a, 0x7a, 0x9c, 0xad, 0x6e,
-    0x65, 0x7a, 0x88, 0x74, 0x81, 0x74, 0x9c, 0x9c, 0xb4, 0x9c, 0x9c, 0x94,
-    0x74, 0x6e, 0x99, 0x9c, 0xb4, 0xb4, 0x8b, 0x9c, 0xb4, 0xa9, 0x9f, 0x7f,
-    0x90, 0xac, 0x9f, 0x7f, 0x65, 0x81, 0x99, 0x84, 0x65, 0x65, 0x64, 0x65,
-    0x65, 0x65, 0x5e, 0x70, 0x84, 0x5a, 0x4e, 0x7f, 0x65, 0x91, 0x7f, 0x77,
-    0x7f, 0x70, 0x90, 0x70, 0x78, 0x96, 0x56, 0x48, 0x96, 0x7f, 0x5b, 0x5d,
-    0x8a, 0x70, 0x48, 0x58, 0x5b, 0x4d, 0x33, 0x33, 0x3e, 0x5b, 0x3e, 0x15,
-    0x1f, 0x3a, 0x26, 0x12, 0x1a, 0x3a, 0x4d, 0x63, 0x67, 0x52, 0x47, 0x1f,
-    0x0d, 0x28, 0x47, 0x52, 0x7d, 0x44, 0x47, 0x72, 0x7b, 0x47, 0x18, 0x29,
-    0x80, 0x61, 0x2e, 0x3b, 0xd0, 0xdc, 0xd4, 0xce, 0xcd, 0xcf, 0xd3, 0xce,
-    0xc3, 0x17, 0x17, 0x28, 0x14, 0x07, 0x0a, 0x17, 0x2e, 0x40, 0x1e, 0x2b,
-    0x1c, 0x2e, 0x1e, 0x1e, 0x40, 0x1e, 0x00, 0x18, 0x38, 0x0e, 0x0e, 0x1e,
-    0x0a, 0x08, 0x06, 0x0f, 0x11, 0x08, 0x03, 0x08, 0x12, 0x0a, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x4b, 0x1e, 0x17, 0x35, 0x35, 0x38, 0x35, 0x08,
-    0x0c, 0x1b, 0x08, 0x00, 0x0a, 0x08, 0x1e, 0x37, 0x1e, 0x1e, 0x37, 0x13,
-    0x00, 0x25, 0x40, 0x47, 0x28, 0x1e, 0x1d, 0x28, 0x08, 0x11, 0x1a, 0x38,
-    0x31, 0x38, 0x47, 0x36, 0x47, 0x43, 0x17, 0x1d, 0x26, 0x1a, 0x3c, 0x3a,
-    0x39, 0x1f, 0x31, 0x5f, 0x47, 0x2e, 0x1a, 0x47, 0x52, 0x1e, 0x1a, 0x27,
-    0x2f, 0x78, 0x5d, 0x3a, 0x3a, 0x58, 0x3e, 0x3a, 0x4d, 0x3a, 0x3e, 0x9a,
-    0xa0, 0x3e, 0x58, 0x9a, 0x85, 0x50, 0x7f, 0xa0, 0xa0, 0x85, 0x4e, 0x70,
-    0x7f, 0x56, 0x3e, 0x45, 0x50, 0x70, 0x65, 0x79, 0x81, 0x91, 0x70, 0x4e,
-    0x5e, 0x91, 0x90, 0x84, 0x95, 0x65, 0x95, 0x65, 0x65, 0x81, 0x99, 0x74,
-    0x74, 0x94, 0x8c, 0x99, 0xa9, 0x7a, 0x81, 0x74, 0x95, 0x7a, 0x99, 0x99,
-    0x7a, 0x82, 0x9c, 0xa9, 0x99, 0x84, 0x7a, 0xab, 0x84, 0x5a, 0x81, 0x7a,
-    0xb4, 0xad, 0x99, 0x8b, 0x9c, 0x9c, 0x7a, 0x94, 0x99, 0x7a, 0xad, 0xbc,
-    0xad, 0x74, 0xad, 0xbc, 0x9c, 0xad, 0xbc, 0xbc, 0xbc, 0x9c, 0x9c, 0xb8,
-    0x9b, 0x82, 0x82, 0x7a, 0x9c, 0x9c, 0x9c, 0xad, 0xa9, 0xab, 0x7a, 0x7a,
-    0x9c, 0xb4, 0xab, 0xab, 0x94, 0x9c, 0xab, 0x7a, 0x94, 0xa9, 0xa9, 0x9c,
-    0xa2, 0x9c, 0x92, 0xae, 0x9c, 0x6e, 0x7a, 0x8b, 0x8c, 0x9c, 0x9c, 0x8e,
-    0x7a, 0x94, 0xab, 0x99, 0x65, 0x65, 0x91, 0x9f, 0x4e, 0x5d, 0x70, 0x8e,
-    0xab, 0x8e, 0x6e, 0x81, 0x73, 0x65, 0x70, 0x5a, 0x54, 0x65, 0xb1, 0xb1,
-    0x5e, 0x70, 0xb1, 0x7f, 0x7f, 0x99, 0x90, 0x96, 0x7f, 0x4e, 0x7f, 0x7f,
-    0x43, 0x3a, 0x34, 0x3e, 0x5d, 0x5e, 0x78, 0x86, 0x63, 0x45, 0x3e, 0x5d,
-    0x78, 0x85, 0x5d, 0x51, 0x51, 0x56, 0x3a, 0x33, 0x3e, 0x56, 0x58, 0x63,
-    0x5b, 0x48, 0x63, 0x63, 0x1a, 0x26, 0x44, 0x26, 0x47, 0x58, 0x31, 0x1f,
-    0x31, 0x5c, 0x4c, 0x14, 0x12, 0x1d, 0x40, 0x18, 0x18, 0x18, 0x12, 0x6f,
-    0xdc, 0xcf, 0xce, 0xcf, 0xce, 0xcf, 0xcf, 0xce, 0xb3, 0x4f, 0x7d, 0x18,
-    0x0a, 0x52, 0x40, 0x11, 0x37, 0x4b, 0x38, 0x40, 0x17, 0x08, 0x1e, 0x0a,
-    0x02, 0x00, 0x08, 0x11, 0x1e, 0x11, 0x17, 0x17, 0x1e, 0x02, 0x03, 0x35,
-    0x2e, 0x1e, 0x08, 0x08, 0x17, 0x0f, 0x03, 0x08, 0x17, 0x1e, 0x1e, 0x1e,
-    0x0f, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x1c, 0x07, 0x03, 0x00, 0x01,
-    0x0a, 0x4b, 0x1d, 0x02, 0x08, 0x0e, 0x2b, 0x1c, 0x11, 0x18, 0x46, 0x61,
-    0x1d, 0x0d, 0x06, 0x08, 0x40, 0x7d, 0x4f, 0x3f, 0x47, 0x4f, 0x52, 0x1a,
-    0x0e, 0x2e, 0x63, 0x52, 0x06, 0x26, 0x1f, 0x27, 0x52, 0x5f, 0x47, 0x5f,
-    0x28, 0x0e, 0x27, 0x3f, 0x67, 0x67, 0x6d, 0x34, 0x34, 0x3a, 0x2f, 0x32,
-    0x2f, 0x3a, 0x48, 0x48, 0x58, 0x89, 0x78, 0x2f, 0x26, 0x56, 0x78, 0x51,
-    0x3a, 0x41, 0x34, 0x41, 0x45, 0x56, 0x85, 0x4e, 0x34, 0x4e, 0x4e, 0x4e,
-    0x9f, 0x91, 0x57, 0x4e, 0x4e, 0x6c, 0x78, 0x65, 0x91, 0x91, 0xac, 0x9f,
-    0x7f, 0x54, 0x4e, 0x65, 0xaf, 0xaf, 0x99, 0x9c, 0xab, 0xb2, 0x74, 0x65,
-    0x81, 0x9c, 0xa2, 0x73, 0x81, 0x8b, 0x74, 0x9c, 0xab, 0xab, 0xab, 0x99,
-    0x57, 0x6e, 0x94, 0xab, 0xad, 0xab, 0x94, 0x74, 0x9c, 0x94, 0x82, 0x94,
-    0x82, 0x8d, 0x9c, 0x9b, 0xb4, 0xbc, 0x94, 0x65, 0x8b, 0xad, 0x8c, 0x7a,
-    0x88, 0x8b, 0x8b, 0x94, 0x8b, 0x9c, 0xa2, 0x74, 0x8b, 0x94, 0x82, 0xa4,
-    0xbc, 0x82, 0x7a, 0x7a, 0x8c, 0x7a, 0xab, 0x9b, 0x9c, 0xb4, 0xb8, 0x9b,
-    0x7a, 0x84, 0x7a, 0xb8, 0xbc, 0xb4, 0xad, 0xb4, 0xba, 0xad, 0x74, 0x74,
-    0xab, 0xba, 0x94, 0x69, 0x8b, 0x74, 0x94, 0xad, 0xab, 0xab, 0xab, 0x57,
-    0x5e, 0x8e, 0x7a, 0x99, 0xab, 0x91, 0x65, 0x74, 0x81, 0x81, 0x69, 0x81,
-    0x81, 0x90, 0x81, 0x81, 0x9f, 0x81, 0x4a, 0x5d, 0x9f, 0x73, 0x4e, 0x5e,
-    0x54, 0x48, 0x4e, 0x4e, 0x60, 0x7f, 0x48, 0x3a, 0x4e, 0x45, 0x4e, 0x91,
-    0x78, 0x48, 0x34, 0x34, 0x43, 0x58, 0x6c, 0x6c, 0x6c, 0x9a, 0x78, 0x33,
-    0x26, 0x27, 0x66, 0x9a, 0x89, 0x5d, 0x6c, 0x75, 0x85, 0x4d, 0x12, 0x3c,
-    0x78, 0x66, 0x12, 0x28, 0x27, 0x26, 0x67, 0x5f, 0x40, 0x52, 0x28, 0x0e,
-    0x1e, 0x1d, 0x40, 0x52, 0x4b, 0x1e, 0x0a, 0x3b, 0xce, 0xcf, 0xce, 0xcf,
-    0xcf, 0xcf, 0xce, 0xda, 0xc2, 0x08, 0x0a, 0x1e, 0x28, 0x17, 0x0a, 0x0a,
-    0x00, 0x00, 0x08, 0x03, 0x18, 0x0a, 0x00, 0x08, 0x00, 0x00, 0x37, 0x4f,
-    0x08, 0x08, 0x08, 0x0a, 0x1c, 0x0a, 0x0a, 0x25, 0x38, 0x2b, 0x0a, 0x0a,
-    0x00, 0x0a, 0x4f, 0x4b, 0x1b, 0x1c, 0x25, 0x46, 0x08, 0x11, 0x0e, 0x0a,
-    0x08, 0x0e, 0x08, 0x07, 0x08, 0x02, 0x06, 0x14, 0x19, 0x13, 0x00, 0x0a,
-    0x11, 0x06, 0x25, 0x4b, 0x0a, 0x0f, 0x08, 0x04, 0x06, 0x28, 0x3d, 0x17,
-    0x11, 0x1e, 0x2e, 0x1e, 0x1a, 0x12, 0x0d, 0x18, 0x12, 0x0a, 0x18, 0x26,
-    0x47, 0x67, 0x26, 0x12, 0x12, 0x0d, 0x0d, 0x14, 0x1a, 0x26, 0x26, 0x12,
-    0x12, 0x28, 0x4d, 0x70, 0x56, 0x34, 0x5b, 0x4e, 0x6c, 0x4d, 0x2f, 0x3e,
-    0x34, 0x34, 0x3e, 0x3e, 0x5d, 0x85, 0x3e, 0x32, 0x4e, 0x60, 0x56, 0x4e,
-    0x60, 0x60, 0x50, 0x45, 0x48, 0x60, 0x73, 0x81, 0x70, 0x48, 0x56, 0x65,
-    0x60, 0x70, 0x95, 0x91, 0x54, 0x4e, 0x4e, 0x54, 0x84, 0xab, 0x8e, 0x5a,
-    0x65, 0x81, 0x8e, 0x99, 0x8e, 0x65, 0x69, 0x74, 0x6e, 0x6e, 0x8b, 0x9c,
-    0x9c, 0x94, 0x84, 0x81, 0x69, 0x65, 0x5a, 0x84, 0x8b, 0x94, 0x6e, 0x6e,
-    0x8b, 0x94, 0xae, 0xad, 0x88, 0x9c, 0x92, 0xae, 0x92, 0x88, 0x94, 0x8c,
-    0x7a, 0x94, 0x9c, 0x9c, 0xad, 0xa9, 0x7a, 0x94, 0xae, 0x94, 0x94, 0x92,
-    0x9c, 0x9c, 0x94, 0x7a, 0x94, 0xae, 0xa5, 0x92, 0x74, 0x6e, 0x9b, 0x9c,
-    0x7a, 0xad, 0xad, 0x82, 0x7a, 0x6e, 0x73, 0x94, 0xad, 0xa5, 0x94, 0x95,
-    0x8c, 0x9c, 0x9c, 0xb4, 0x8b, 0x74, 0x82, 0x88, 0x8b, 0x94, 0x9c, 0xad,
-    0x9c, 0x74, 0x73, 0x65, 0x5a, 0x5a, 0x65, 0x81, 0x99, 0x6e, 0x81, 0x64,
-    0x6e, 0x99, 0x9c, 0x74, 0x74, 0x94, 0x99, 0x74, 0x70, 0x5e, 0x81, 0x64,
-    0x65, 0x70, 0x5a, 0x91, 0x9f, 0x5a, 0x54, 0x65, 0x65, 0x60, 0x70, 0x7f,
-    0x70, 0x50, 0x3e, 0x4d, 0x5e, 0x65, 0x65, 0x5e, 0x2f, 0x48, 0x6c, 0x56,
-    0x75, 0x86, 0x5d, 0x3e, 0x2f, 0x1f, 0x2f, 0x63, 0x78, 0x3e, 0x33, 0x3c,
-    0x3e, 0x3a, 0x58, 0x3a, 0x1f, 0x27, 0x3c, 0x1d, 0x26, 0x3a, 0x5f, 0x53,
-    0x33, 0x12, 0x10, 0x06, 0x07, 0x0c, 0x12, 0x18, 0x1d, 0x04, 0x06, 0x1d,
-    0x28, 0x38, 0x26, 0x3b, 0xcf, 0xd3, 0xdc, 0xcf, 0xce, 0xcf, 0xce, 0xce,
-    0xbb, 0x08, 0x18, 0x38, 0x0a, 0x00, 0x0a, 0x12, 0x0e, 0x0e, 0x14, 0x11,
-    0x0a, 0x08, 0x00, 0x08, 0x1e, 0x17, 0x0a, 0x08, 0x00, 0x0a, 0x0f, 0x0f,
-    0x1c, 0x1c, 0x08, 0x00, 0x00, 0x08, 0x0a, 0x2e, 0x14, 0x0a, 0x0c, 0x1e,
-    0x17, 0x17, 0x0a, 0x08, 0x0a, 0x0a, 0x17, 0x37, 0x1e, 0x11, 0x08, 0x00,
-    0x14, 0x0e, 0x0e, 0x0e, 0x08, 0x06, 0x2b, 0x4b, 0x4f, 0x1e, 0x14, 0x4b,
-    0x40, 0x18, 0x2e, 0x44, 0x28, 0x20, 0x26, 0x28, 0x38, 0x52, 0x2e, 0x0a,
-    0x17, 0x26, 0x4f, 0x4f, 0x38, 0x12, 0x18, 0x1e, 0x3c, 0x18, 0x1a, 0x47,
-    0x31, 0x26, 0x0d, 0x06, 0x58, 0x3a, 0x12, 0x27, 0x63, 0x7b, 0x63, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x3a, 0x3a, 0x4e, 0x5d, 0x4d, 0x5b, 0x78, 0x48, 0x5b,
-    0x78, 0x4e, 0x50, 0x60, 0x4e, 0x57, 0x91, 0x91, 0x60, 0x54, 0x54, 0x79,
-    0x65, 0x57, 0x57, 0x54, 0x54, 0x79, 0x96, 0x9f, 0x91, 0x91, 0x9f, 0xa7,
-    0x73, 0x84, 0x9f, 0xaa, 0x8e, 0x8e, 0x8b, 0x8e, 0xab, 0x99, 0x65, 0x65,
-    0x81, 0x98, 0xb4, 0x9c, 0x8e, 0x6e, 0x69, 0x94, 0x94, 0x69, 0x8c, 0x8c,
-    0x74, 0x81, 0x69, 0x98, 0xad, 0x74, 0x6e, 0xa9, 0xb8, 0xb8, 0xae, 0xb8,
-    0xa9, 0xa5, 0x9c, 0x8b, 0x9c, 0xa5, 0x9c, 0x9c, 0xb4, 0xa2, 0x94, 0xa5,
-    0x9c, 0x9c, 0xa5, 0x9c, 0x8d, 0xae, 0xae, 0x92, 0x92, 0x94, 0xa9, 0xae,
-    0xa2, 0x9c, 0x92, 0x8b, 0x88, 0xb4, 0xb8, 0xb4, 0xab, 0xad, 0xb8, 0xab,
-    0xa2, 0xb4, 0xba, 0xad, 0x92, 0xae, 0xae, 0xad, 0xad, 0x8c, 0x7a, 0x99,
-    0xad, 0xb4, 0xad, 0xa9, 0x7a, 0x74, 0x94, 0xb4, 0x73, 0x74, 0x94, 0x74,
-    0x84, 0x5a, 0x65, 0xa9, 0x7a, 0x6e, 0x82, 0xb4, 0xad, 0xaa, 0xae, 0x94,
-    0x99, 0x7a, 0x65, 0x65, 0x95, 0x95, 0x65, 0x7a, 0x8e, 0x65, 0x98, 0x8e,
-    0x70, 0x84, 0x73, 0x5a, 0x84, 0x9d, 0x84, 0x70, 0x70, 0x70, 0x96, 0x7f,
-    0x4e, 0x60, 0x60, 0x50, 0x70, 0xa0, 0x93, 0x5d, 0x5d, 0x93, 0x85, 0x6c,
-    0x6c, 0x93, 0x89, 0x5d, 0x63, 0x5e, 0x5b, 0x75, 0x53, 0x1f, 0x28, 0x3a,
-    0x7b, 0x63, 0x58, 0x26, 0x1a, 0x26, 0x3a, 0x26, 0x1d, 0x33, 0x31, 0x1d,
-    0x18, 0x0a, 0x4d, 0x4d, 0x06, 0x12, 0x52, 0x67, 0x5c, 0x5c, 0x4f, 0x49,
-    0xdc, 0xce, 0xd3, 0xcf, 0xd4, 0xd0, 0xd3, 0xda, 0xc3, 0x0e, 0x2e, 0x17,
-    0x06, 0x0e, 0x0d, 0x0a, 0x38, 0x28, 0x1e, 0x0e, 0x03, 0x11, 0x1e, 0x0e,
-    0x0a, 0x08, 0x06, 0x17, 0x40, 0x4f, 0x1e, 0x08, 0x1c, 0x1c, 0x0f, 0x0c,
-    0x1e, 0x2e, 0x13, 0x1e, 0x1e, 0x0a, 0x17, 0x1c, 0x0f, 0x0a, 0x11, 0x1b,
-    0x0e, 0x12, 0x11, 0x0e, 0x08, 0x0a, 0x08, 0x08, 0x19, 0x37, 0x11, 0x01,
-    0x04, 0x13, 0x4f, 0x2e, 0x08, 0x07, 0x06, 0x1c, 0x35, 0x1e, 0x0e, 0x0d,
-    0x01, 0x04, 0x1d, 0x11, 0x18, 0x2e, 0x17, 0x28, 0x1e, 0x0a, 0x2e, 0x0a,
-    0x18, 0x61, 0x2b, 0x06, 0x12, 0x58, 0x43, 0x1d, 0x27, 0x85, 0x8a, 0x47,
-    0x47, 0x63, 0x75, 0x43, 0x36, 0x47, 0x4c, 0x1f, 0x20, 0x28, 0x33, 0x66,
-    0x66, 0x51, 0x85, 0xb1, 0x96, 0x86, 0x85, 0x34, 0x27, 0x3e, 0x48, 0x57,
-    0x65, 0x54, 0x4e, 0x50, 0x4e, 0x5e, 0x41, 0x54, 0x9f, 0x65, 0x50, 0x65,
-    0x79, 0xa7, 0x9f, 0x4e, 0x4a, 0x56, 0x43, 0x6a, 0x90, 0x90, 0x73, 0x64,
-    0x64, 0x74, 0x8e, 0x8e, 0x73, 0x73, 0x65, 0x7f, 0x5e, 0x69, 0x81, 0x65,
-    0x99, 0x99, 0x84, 0x73, 0x8b, 0xb4, 0x8b, 0x73, 0xa5, 0xba, 0xa9, 0x94,
-    0xae, 0xba, 0xad, 0x94, 0x9b, 0x9b, 0x9b, 0x7a, 0x84, 0x6e, 0x8c, 0xad,
-    0x92, 0xa9, 0xbc, 0xbc, 0xad, 0xb8, 0x92, 0x74, 0x8b, 0x88, 0x9c, 0xae,
-    0xae, 0x92, 0x92, 0x88, 0x92, 0x94, 0x8b, 0xb0, 0xb0, 0x94, 0x94, 0x8c,
-    0xae, 0xbf, 0x9c, 0x84, 0x7a, 0x84, 0x95, 0xa9, 0xad, 0x92, 0x9c, 0x88,
-    0x9c, 0x92, 0x9c, 0xa9, 0x9b, 0x6e, 0x7a, 0x84, 0x8e, 0x8c, 0x74, 0x9c,
-    0xaf, 0x7a, 0x6e, 0x8e, 0xb4, 0x9c, 0x81, 0x94, 0xbc, 0xbc, 0x8b, 0x9b,
-    0xae, 0xa9, 0x8b, 0x6e, 0x99, 0x7a, 0x5a, 0x4a, 0x5e, 0x90, 0x95, 0x95,
-    0x6e, 0xa9, 0xbc, 0xab, 0x99, 0xac, 0x60, 0x60, 0x65, 0x54, 0x91, 0x7a,
-    0x65, 0x5a, 0x4e, 0x70, 0x5a, 0x4e, 0x7f, 0x93, 0x54, 0x50, 0x57, 0x60,
-    0xac, 0x79, 0x2f, 0x3a, 0x33, 0x3a, 0x63, 0x78, 0x6c, 0x4e, 0x3a, 0x34,
-    0x5b, 0x45, 0x3e, 0x43, 0x1f, 0x44, 0x31, 0x1d, 0x3c, 0x31, 0x36, 0x5f,
-    0x47, 0x26, 0x1d, 0x5f, 0x7b, 0x1f, 0x26, 0x75, 0x89, 0x5f, 0x36, 0x5f,
-    0x58, 0x47, 0x1a, 0x47, 0x2f, 0x1d, 0x0e, 0x23, 0xbb, 0xbb, 0xc3, 0xb3,
-    0xbb, 0xca, 0xd0, 0xc2, 0xb7, 0x11, 0x00, 0x08, 0x0e, 0x0a, 0x12, 0x1a,
-    0x12, 0x0a, 0x0a, 0x0e, 0x08, 0x17, 0x3d, 0x1e, 0x00, 0x0a, 0x11, 0x35,
-    0x40, 0x0f, 0x05, 0x02, 0x05, 0x16, 0x07, 0x0f, 0x0a, 0x06, 0x06, 0x11,
-    0x0e, 0x04, 0x0a, 0x0a, 0x0f, 0x1c, 0x05, 0x0f, 0x14, 0x1e, 0x0f, 0x08,
-    0x13, 0x1e, 0x12, 0x13, 0x13, 0x06, 0x00, 0x08, 0x1e, 0x0e, 0x00, 0x00,
-    0x0a, 0x3d, 0x1e, 0x1c, 0x0a, 0x07, 0x11, 0x0d, 0x0d, 0x11, 0x0d, 0x1e,
-    0x06, 0x06, 0x38, 0x38, 0x28, 0x18, 0x18, 0x18, 0x0a, 0x0d, 0x28, 0x3c,
-    0x28, 0x1a, 0x52, 0x3a, 0x33, 0x1a, 0x52, 0x58, 0x26, 0x3a, 0x5f, 0x5f,
-    0x26, 0x11, 0x06, 0x1d, 0x7b, 0x75, 0x58, 0x47, 0x1d, 0x26, 0x3a, 0x3a,
-    0x48, 0x48, 0x5d, 0x85, 0x85, 0x48, 0x4e, 0x70, 0x7f, 0x5b, 0x41, 0x70,
-    0x78, 0x70, 0x79, 0x65, 0x60, 0x60, 0x50, 0x7f, 0x7f, 0x48, 0x34, 0x60,
-    0x90, 0x99, 0x65, 0x45, 0x50, 0x7f, 0x57, 0x65, 0x99, 0x84, 0x73, 0x6e,
-    0x65, 0x6e, 0x99, 0x99, 0x6e, 0x70, 0x91, 0x81, 0x73, 0x73, 0x8e, 0x7a,
-    0x8c, 0x99, 0x9c, 0x94, 0x7a, 0x94, 0xae, 0x94, 0x9c, 0xae, 0xad, 0x94,
-    0x6e, 0x65, 0x73, 0xad, 0xb8, 0xab, 0x99, 0x7a, 0x84, 0x84, 0x8c, 0x9c,
-    0x9c, 0x88, 0xae, 0xbc, 0xa5, 0x94, 0xa4, 0xb6, 0xa5, 0x88, 0x88, 0x92,
-    0x92, 0xa4, 0xa4, 0x92, 0x92, 0x94, 0x88, 0x92, 0x94, 0x81, 0x74, 0x92,
-    0xad, 0xad, 0x95, 0x74, 0x82, 0x9b, 0x94, 0xae, 0xa2, 0x9c, 0x88, 0x74,
-    0x94, 0xad, 0xb4, 0xab, 0x6e, 0x74, 0x8b, 0x84, 0x6e, 0x95, 0x9c, 0x99,
-    0x99, 0xa9, 0xab, 0x94, 0x99, 0xa9, 0xa2, 0x74, 0x9c, 0x9c, 0x8b, 0x65,
-    0x65, 0x54, 0x90, 0xac, 0xac, 0x7f, 0x5a, 0x60, 0x57, 0x65, 0x65, 0x69,
-    0x65, 0x74, 0x9d, 0x99, 0x54, 0x65, 0x99, 0x91, 0x5e, 0x4e, 0x70, 0x7f,
-    0x7f, 0x73, 0x65, 0x5e, 0x60, 0x4e, 0x70, 0x56, 0x2f, 0x2f, 0x56, 0x86,
-    0x86, 0x58, 0x33, 0x3a, 0x3e, 0x41, 0x51, 0x5d, 0x5b, 0x58, 0x2f, 0x26,
-    0x66, 0x63, 0x58, 0x3c, 0x28, 0x3a, 0x1a, 0x26, 0x3c, 0x38, 0x3c, 0x26,
-    0x5f, 0x58, 0x26, 0x31, 0x44, 0x43, 0x10, 0x33, 0x52, 0x2d, 0x18, 0x0a,
-    0x00, 0x0d, 0x4c, 0x6f, 0xd0, 0xc3, 0xc3, 0xc3, 0xd0, 0xd0, 0xcd, 0xc3,
-    0xa8, 0xbb, 0xda, 0xc3, 0xce, 0xd0, 0xd0, 0xd0, 0xc3, 0xc3, 0x3b, 0x25,
-    0x1e, 0x06, 0x0e, 0x08, 0x02, 0x0f, 0x17, 0x08, 0x00, 0x00, 0x17, 0x1b,
-    0x0e, 0x0f, 0x02, 0x02, 0x0a, 0x08, 0x08, 0x08, 0x0a, 0x0a, 0x01, 0x0f,
-    0x16, 0x16, 0x21, 0x08, 0x08, 0x03, 0x0a, 0x18, 0x0a, 0x13, 0x0e, 0x12,
-    0x14, 0x13, 0x1e, 0x4b, 0x1e, 0x08, 0x1d, 0x20, 0x0d, 0x01, 0x1d, 0x31,
-    0x0e, 0x0e, 0x28, 0x38, 0x40, 0x38, 0x18, 0x1d, 0x0d, 0x0d, 0x14, 0x12,
-    0x10, 0x52, 0x5f, 0x1a, 0x3f, 0x53, 0x5f, 0x43, 0x3c, 0x28, 0x28, 0x47,
-    0x52, 0x3c, 0x12, 0x18, 0x2d, 0x26, 0x47, 0x52, 0x5f, 0x3a, 0x27, 0x32,
-    0x72, 0x66, 0x63, 0x58, 0x72, 0x63, 0x3c, 0x58, 0x85, 0x32, 0x33, 0x85,
-    0x5b, 0x78, 0x86, 0x5d, 0x3a, 0x33, 0x4e, 0x7f, 0x70, 0x4e, 0x79, 0x79,
-    0x79, 0x9d, 0x9f, 0x96, 0x70, 0x70, 0x7f, 0x5a, 0x4e, 0x81, 0x9c, 0x7a,
-    0x73, 0x84, 0x99, 0x9d, 0x9f, 0x91, 0x91, 0x81, 0x6e, 0x6e, 0x74, 0x73,
-    0x99, 0xbc, 0x9c, 0x94, 0xaa, 0xb4, 0xb4, 0x94, 0x95, 0x7a, 0x99, 0xab,
-    0xab, 0x84, 0x69, 0x7a, 0x8b, 0x8b, 0x9c, 0x9c, 0xa2, 0x94, 0x8c, 0xa9,
-    0xad, 0xb4, 0xa9, 0xb4, 0xbc, 0xa1, 0x99, 0xba, 0x92, 0x6e, 0xae, 0xb0,
-    0x92, 0xb8, 0xae, 0x8c, 0x8e, 0x88, 0xae, 0xa2, 0xa4, 0xa4, 0xa5, 0xa5,
-    0xae, 0xba, 0xb0, 0xa5, 0xae, 0xae, 0xae, 0x9c, 0xa2, 0xba, 0xba, 0x92,
-    0x9c, 0xae, 0xbc, 0xbc, 0xa9, 0x9c, 0x9c, 0x82, 0x94, 0xa9, 0x8c, 0x94,
-    0xb8, 0xbc, 0x9c, 0x92, 0xad, 0xbc, 0x9c, 0x8c, 0x99, 0x95, 0xab, 0x9c,
-    0x7a, 0x65, 0x6e, 0x8e, 0x7a, 0x99, 0x9c, 0x94, 0x7a, 0x5a, 0x84, 0x9f,
-    0x9f, 0x9c, 0x99, 0xaf, 0x91, 0x70, 0x9f, 0x99, 0x54, 0x65, 0x99, 0x91,
-    0x84, 0x84, 0x5e, 0x41, 0x4e, 0x65, 0x91, 0x70, 0x65, 0x77, 0x5a, 0x73,
-    0x96, 0x91, 0x7f, 0x6c, 0x89, 0x78, 0x56, 0x48, 0x70, 0x90, 0x63, 0x4e,
-    0x6c, 0x78, 0x8a, 0x86, 0x5b, 0x63, 0x58, 0x3a, 0x3e, 0x3e, 0x2f, 0x78,
-    0x85, 0x4d, 0x56, 0x5b, 0x86, 0x58, 0x33, 0x31, 0x31, 0x44, 0x47, 0x44,
-    0x09, 0x04, 0x12, 0x11, 0x18, 0x44, 0x4c, 0x28, 0x13, 0x1d, 0x4c, 0x6f,
-    0xda, 0xd4, 0xdb, 0xdb, 0xd4, 0xd4, 0xd4, 0xcf, 0xc3, 0xc2, 0xda, 0xd4,
-    0xda, 0xd0, 0xcd, 0xce, 0xd0, 0xd0, 0x23, 0x11, 0x13, 0x14, 0x0d, 0x13,
-    0x40, 0x29, 0x08, 0x17, 0x17, 0x0e, 0x08, 0x08, 0x37, 0x17, 0x00, 0x11,
-    0x2e, 0x2e, 0x1c, 0x0a, 0x1c, 0x11, 0x03, 0x0f, 0x0f, 0x03, 0x11, 0x2b,
-    0x1e, 0x18, 0x16, 0x2e, 0x0f, 0x06, 0x06, 0x00, 0x08, 0x08, 0x0f, 0x17,
-    0x0a, 0x17, 0x0f, 0x40, 0x4f, 0x14, 0x0e, 0x06, 0x0a, 0x25, 0x14, 0x0a,
-    0x11, 0x0a, 0x28, 0x40, 0x47, 0x44, 0x12, 0x09, 0x11, 0x12, 0x16, 0x3c,
-    0x52, 0x3c, 0x20, 0x10, 0x28, 0x36, 0x47, 0x28, 0x09, 0x1a, 0x47, 0x3f,
-    0x3f, 0x2d, 0x26, 0x1d, 0x47, 0x78, 0x8a, 0x58, 0x27, 0x33, 0x43, 0x8a,
-    0x58, 0x43, 0x8a, 0x66, 0x5d, 0x56, 0x4d, 0x3a, 0x5d, 0x6c, 0x5b, 0x5d,
-    0x4e, 0x70, 0x81, 0x60, 0x4e, 0x4e, 0x56, 0x51, 0x3e, 0x6c, 0x6c, 0x5d,
-    0x70, 0x91, 0x90, 0xb1, 0x9f, 0x65, 0x54, 0x57, 0x84, 0x74, 0x65, 0x70,
-    0x4e, 0x65, 0x90, 0x94, 0x9c, 0x8c, 0x65, 0x65, 0x73, 0x6e, 0x7a, 0xab,
-    0x9c, 0x94, 0x8b, 0x7a, 0x94, 0x9c, 0x99, 0x84, 0x6e, 0x8c, 0x99, 0x9c,
-    0x94, 0x8c, 0x8e, 0x98, 0xb4, 0xba, 0xad, 0x7a, 0x6e, 0x7a, 0xb4, 0x9c,
-    0x99, 0xb8, 0xab, 0x92, 0xa5, 0x88, 0x88, 0xa5, 0xae, 0xa9, 0xa2, 0xa9,
-    0xa4, 0xb6, 0xa4, 0x92, 0x9c, 0x9c, 0x82, 0x7a, 0x8c, 0x82, 0x94, 0xa2,
-    0xa5, 0xae, 0xba, 0xb6, 0xa5, 0x82, 0x94, 0xa2, 0xad, 0x88, 0x9c, 0x7a,
-    0x8b, 0xab, 0xad, 0xba, 0xae, 0x94, 0x7a, 0x7a, 0x9c, 0x92, 0x92, 0xa4,
-    0x9c, 0x9b, 0x8c, 0x8c, 0x9c, 0xab, 0x98, 0x81, 0x74, 0x99, 0x99, 0x94,
-    0x7a, 0x8e, 0x65, 0x99, 0xad, 0xab, 0x65, 0x5a, 0x65, 0x99, 0x9d, 0x91,
-    0x9d, 0x9d, 0x81, 0x8e, 0x84, 0x65, 0x65, 0x84, 0x90, 0x7f, 0x70, 0x64,
-    0x8b, 0x8e, 0x57, 0x60, 0x57, 0x5d, 0x3e, 0x3e, 0x5d, 0x5d, 0x4e, 0x6c,
-    0x85, 0x96, 0xa7, 0x77, 0x56, 0x48, 0x56, 0x70, 0x4e, 0x3e, 0x52, 0x2d,
-    0x63, 0x75, 0x8a, 0x85, 0x4d, 0x26, 0x28, 0x33, 0x3e, 0x3e, 0x5d, 0x5b,
-    0x4d, 0x2f, 0x26, 0x3a, 0x52, 0x39, 0x10, 0x12, 0x3c, 0x31, 0x26, 0x1a,
-    0x12, 0x12, 0x1f, 0x47, 0x61, 0x28, 0x0e, 0x3b, 0xd4, 0xda, 0xd3, 0xd4,
-    0xdc, 0xda, 0xd4, 0xd0, 0xc2, 0xbb, 0xd4, 0xd3, 0xce, 0xce, 0xd3, 0xd4,
-    0xda, 0xd3, 0x23, 0x08, 0x06, 0x00, 0x0e, 0x0a, 0x1c, 0x0a, 0x07, 0x0e,
-    0x1e, 0x37, 0x2b, 0x08, 0x00, 0x00, 0x0f, 0x1e, 0x08, 0x0f, 0x03, 0x05,
-    0x18, 0x25, 0x1e, 0x11, 0x00, 0x00, 0x0e, 0x0e, 0x40, 0x25, 0x05, 0x0e,
-    0x17, 0x08, 0x08, 0x08, 0x1c, 0x35, 0x37, 0x46, 0x38, 0x37, 0x2e, 0x12,
-    0x1e, 0x18, 0x0a, 0x25, 0x14, 0x00, 0x02, 0x1e, 0x44, 0x2e, 0x11, 0x28,
-    0x2b, 0x39, 0x26, 0x4f, 0x61, 0x38, 0x14, 0x1e, 0x0d, 0x14, 0x10, 0x28,
-    0x10, 0x20, 0x3c, 0x28, 0x1a, 0x3f, 0x58, 0x5f, 0x63, 0x47, 0x0d, 0x1f,
-    0x48, 0x34, 0x3c, 0x34, 0x58, 0x43, 0x2f, 0x33, 0x2f, 0x4d, 0x3c, 0x1d,
-    0x1f, 0x5d, 0x85, 0x5d, 0x5d, 0x5e, 0x7f, 0x96, 0x86, 0x7f, 0x6a, 0x6c,
-    0x6c, 0x4e, 0x4e, 0x70, 0x91, 0x9d, 0x91, 0x96, 0x91, 0x91, 0x73, 0x5a,
-    0x70, 0x81, 0x91, 0x81, 0x54, 0x4e, 0x57, 0x7a, 0xab, 0x81, 0x65, 0x8e,
-    0x99, 0x95, 0x95, 0xab, 0xa1, 0x84, 0x6e, 0x6e, 0x8e, 0x74, 0x6e, 0x74,
-    0x74, 0x9c, 0x98, 0x7a, 0x8b, 0x9c, 0x9b, 0xb4, 0xa9, 0x74, 0x7a, 0xa9,
-    0x9c, 0x82, 0x94, 0x9c, 0xad, 0x82, 0x74, 0x74, 0x9c, 0x82, 0x8b, 0x84,
-    0x9c, 0xba, 0xae, 0xa9, 0x92, 0xa5, 0xba, 0xba, 0xbc, 0xa2, 0x88, 0x9c,
-    0x9c, 0x8d, 0x8d, 0xb0, 0xba, 0xb8, 0xbc, 0xb8, 0xad, 0xae, 0x92, 0x92,
-    0xa5, 0x92, 0xad, 0x9c, 0x6e, 0x74, 0x9c, 0xb4, 0x9c, 0x74, 0x9c, 0xa4,
-    0x92, 0xad, 0xa5, 0xae, 0xa2, 0x94, 0x8b, 0x94, 0x94, 0x74, 0x8b, 0x82,
-    0x94, 0x9c, 0x74, 0x7a, 0x9c, 0x9c, 0xad, 0xa9, 0x74, 0x65, 0x99, 0x94,
-    0x74, 0x6e, 0x81, 0x98, 0x8e, 0x64, 0x65, 0x84, 0x84, 0x60, 0x54, 0x60,
-    0x94, 0x95, 0x84, 0x84, 0x79, 0x91, 0x9f, 0xa0, 0x91, 0x70, 0x65, 0x70,
-    0x54, 0x54, 0x65, 0x99, 0x91, 0x96, 0x96, 0x85, 0x70, 0x5d, 0x6c, 0x5e,
-    0x60, 0x5e, 0x4e, 0x2f, 0x33, 0x48, 0x78, 0x6a, 0x34, 0x3a, 0x51, 0x5b,
-    0x5d, 0x78, 0x89, 0x58, 0x33, 0x26, 0x27, 0x27, 0x27, 0x33, 0x1f, 0x14,
-    0x47, 0x26, 0x12, 0x47, 0x3a, 0x5f, 0x58, 0x3c, 0x0e, 0x1f, 0x44, 0x28,
-    0x14, 0x12, 0x31, 0x49, 0xce, 0xcf, 0xce, 0xcf, 0xcf, 0xcd, 0xce, 0xd7,
-    0xd0, 0xc2, 0xd4, 0xd0, 0xcf, 0xda, 0xdc, 0xd3, 0xce, 0xce, 0x23, 0x06,
-    0x08, 0x0e, 0x2e, 0x2e, 0x35, 0x40, 0x1c, 0x35, 0x0a, 0x0a, 0x08, 0x06,
-    0x11, 0x11, 0x08, 0x00, 0x00, 0x0c, 0x11, 0x17, 0x0f, 0x0e, 0x09, 0x0e,
-    0x11, 0x37, 0x35, 0x06, 0x08, 0x03, 0x07, 0x02, 0x08, 0x0f, 0x17, 0x08,
-    0x17, 0x35, 0x37, 0x25, 0x11, 0x08, 0x17, 0x40, 0x29, 0x06, 0x08, 0x14,
-    0x37, 0x4f, 0x31, 0x0e, 0x0a, 0x13, 0x12, 0x40, 0x12, 0x0a, 0x28, 0x61,
-    0x62, 0x40, 0x1d, 0x11, 0x14, 0x36, 0x1d, 0x36, 0x28, 0x3c, 0x47, 0x8a,
-    0x8a, 0x4d, 0x47, 0x2d, 0x28, 0x44, 0x3c, 0x2f, 0x3a, 0x2f, 0x27, 0x63,
-    0x5b, 0x33, 0x36, 0x26, 0x58, 0x6c, 0x7b, 0x5b, 0x33, 0x3a, 0x48, 0x3a,
-    0x3a, 0x4e, 0x4e, 0x3e, 0x51, 0x43, 0x32, 0x3e, 0x56, 0x60, 0x65, 0x81,
-    0x8e, 0x91, 0x91, 0x70, 0x34, 0x48, 0x7f, 0x84, 0x73, 0x65, 0x5a, 0x81,
-    0x99, 0xa7, 0x81, 0x54, 0x65, 0x65, 0x99, 0x8e, 0x65, 0x84, 0xac, 0xac,
-    0xaf, 0x95, 0x7a, 0x6e, 0x8c, 0x98, 0x94, 0x9c, 0x94, 0x9c, 0xad, 0xbc,
-    0xae, 0x8c, 0x8c, 0x74, 0x94, 0x94, 0x94, 0x9c, 0x9c, 0x8b, 0x9c, 0xb4,
-    0x8b, 0x7a, 0x6e, 0x82, 0x9c, 0xb8, 0xae, 0x94, 0x94, 0x9c, 0x8d, 0x8b,
-    0x9c, 0xa2, 0x94, 0x94, 0x9c, 0x9b, 0x7a, 0x94, 0xa9, 0x92, 0xa5, 0xb6,
-    0xba, 0xb0, 0xad, 0x7a, 0x7a, 0xa9, 0xa5, 0xae, 0x9c, 0x94, 0x9c, 0xae,
-    0xbc, 0xa5, 0x94, 0x88, 0x8c, 0x9c, 0xae, 0x88, 0x88, 0xa4, 0xba, 0xb8,
-    0xa9, 0x9c, 0x94, 0x94, 0x9c, 0x9c, 0x9c, 0x8c, 0x94, 0x9c, 0xbc, 0xb4,
-    0xa2, 0x94, 0x74, 0x7a, 0x99, 0x7a, 0x74, 0x94, 0x8e, 0x6e, 0xab, 0x7a,
-    0x65, 0x57, 0x64, 0x74, 0xac, 0x99, 0x81, 0x54, 0x65, 0x69, 0x54, 0x54,
-    0x84, 0x5a, 0x5e, 0x60, 0x4e, 0x4e, 0x4e, 0x70, 0x65, 0x65, 0x81, 0x81,
-    0x81, 0x91, 0x3e, 0x36, 0x48, 0x70, 0x77, 0x5e, 0x48, 0x56, 0x70, 0x93,
-    0x85, 0x45, 0x34, 0x34, 0x3e, 0x75, 0x56, 0x32, 0x58, 0x75, 0x8a, 0x5d,
-    0x33, 0x33, 0x3c, 0x58, 0x27, 0x47, 0x3c, 0x38, 0x53, 0x7b, 0x97, 0x52,
-    0x3c, 0x1d, 0x1f, 0x26, 0x28, 0x1d, 0x28, 0x1d, 0x14, 0x4f, 0x3f, 0x3b,
-    0xce, 0xcd, 0xce, 0xda, 0xda, 0xda, 0xd0, 0xcd, 0xc3, 0xbb, 0xce, 0xce,
-    0xd0, 0xce, 0xce, 0xce, 0xcd, 0xce, 0x23, 0x18, 0x0a, 0x0f, 0x1e, 0x38,
-    0x2e, 0x1b, 0x08, 0x0f, 0x1c, 0x1b, 0x0f, 0x07, 0x0f, 0x0a, 0x2e, 0x38,
-    0x11, 0x08, 0x17, 0x11, 0x17, 0x0a, 0x00, 0x06, 0x28, 0x37, 0x1e, 0x11,
-    0x11, 0x0a, 0x07, 0x0f, 0x14, 0x17, 0x03, 0x00, 0x08, 0x08, 0x00, 0x01,
-    0x1e, 0x2e, 0x17, 0x0f, 0x0f, 0x08, 0x0a, 0x08, 0x00, 0x1e, 0x26, 0x37,
-    0x38, 0x40, 0x3d, 0x12, 0x0a, 0x08, 0x0e, 0x13, 0x11, 0x1e, 0x52, 0x61,
-    0x4c, 0x0d, 0x0d, 0x3c, 0x47, 0x26, 0x2d, 0x3f, 0x26, 0x00, 0x1f, 0x63,
-    0x44, 0x3c, 0x47, 0x58, 0x43, 0x52, 0x5b, 0x58, 0x2f, 0x3e, 0x66, 0x58,
-    0x6a, 0x85, 0x86, 0x86, 0x5e, 0x5b, 0x56, 0x4e, 0x6c, 0x5e, 0x2f, 0x5d,
-    0x70, 0x4e, 0x4e, 0x70, 0x7f, 0x6c, 0x3e, 0x34, 0x3a, 0x48, 0x50, 0x65,
-    0x90, 0x96, 0x41, 0x4a, 0x54, 0x65, 0x73, 0x60, 0x54, 0x91, 0x9d, 0x8e,
-    0x99, 0x99, 0x64, 0x65, 0x81, 0x69, 0x73, 0x70, 0x65, 0x9f, 0xab, 0x9c,
-    0x81, 0x6e, 0x94, 0x9c, 0x99, 0x74, 0x9c, 0xa2, 0x69, 0x65, 0xa1, 0xab,
-    0x82, 0x82, 0x92, 0x9c, 0xaa, 0xab, 0xa9, 0x94, 0x8b, 0xa9, 0x9c, 0xa2,
-    0xb0, 0xba, 0xb8, 0x92, 0xae, 0xa5, 0x88, 0x92, 0xae, 0x8b, 0x94, 0xae,
-    0x92, 0xa4, 0xa5, 0xb0, 0xa9, 0x94, 0x7a, 0x84, 0x8c, 0x8b, 0x9c, 0xae,
-    0xb8, 0x88, 0x74, 0x94, 0x8d, 0xa2, 0x88, 0x94, 0xad, 0xa5, 0xad, 0xa2,
-    0xbc, 0x9c, 0x94, 0x9c, 0x88, 0x94, 0x7a, 0x6e, 0x9b, 0xad, 0xb8, 0x9c,
-    0x6e, 0x88, 0xa5, 0xa9, 0x94, 0x94, 0xa2, 0x74, 0x65, 0x94, 0x9c, 0x8e,
-    0x8e, 0x99, 0x9c, 0x8b, 0x99, 0x94, 0x84, 0x65, 0x95, 0x99, 0x7a, 0xab,
-    0xaa, 0x9d, 0x74, 0x8e, 0x7a, 0x84, 0x81, 0x8e, 0x5a, 0x5e, 0x81, 0x69,
-    0x57, 0x64, 0x81, 0x84, 0x5e, 0x48, 0x3a, 0x3e, 0x48, 0x4e, 0x70, 0x86,
-    0x5d, 0x3a, 0x34, 0x56, 0x4e, 0x56, 0x34, 0x5d, 0x70, 0x70, 0x5d, 0x85,
-    0x78, 0x33, 0x3e, 0x34, 0x33, 0x1f, 0x14, 0x1f, 0x63, 0x6a, 0x6a, 0x26,
-    0x18, 0x3a, 0x58, 0x3a, 0x47, 0x52, 0x47, 0x06, 0x12, 0x5f, 0x26, 0x26,
-    0x3f, 0x28, 0x31, 0x31, 0x3c, 0x2e, 0x11, 0x3b, 0xd4, 0xcf, 0xd4, 0xdc,
-    0xdc, 0xd7, 0xd4, 0xda, 0xc3, 0xbb, 0xd4, 0xce, 0xcd, 0xce, 0xda, 0xce,
-    0xce, 0xd3, 0x3b, 0x11, 0x03, 0x08, 0x07, 0x08, 0x00, 0x03, 0x1c, 0x1c,
-    0x05, 0x0c, 0x0f, 0x03, 0x0a, 0x08, 0x08, 0x17, 0x25, 0x19, 0x35, 0x35,
-    0x11, 0x08, 0x0c, 0x0f, 0x0f, 0x05, 0x03, 0x0f, 0x00, 0x0e, 0x11, 0x1e,
-    0x03, 0x02, 0x0a, 0x25, 0x0f, 0x08, 0x09, 0x11, 0x03, 0x17, 0x4b, 0x40,
-    0x18, 0x0e, 0x0e, 0x0a, 0x08, 0x04, 0x11, 0x0a, 0x00, 0x11, 0x3d, 0x40,
-    0x1e, 0x1e, 0x2e, 0x3f, 0x3f, 0x40, 0x38, 0x12, 0x11, 0x20, 0x3a, 0x3c,
-    0x12, 0x0d, 0x14, 0x1a, 0x58, 0x67, 0x47, 0x10, 0x1f, 0x2f, 0x63, 0x63,
-    0x28, 0x1f, 0x72, 0x8a, 0x51, 0x6c, 0x9a, 0x85, 0x5d, 0x33, 0x3a, 0x4e,
-    0x56, 0x5d, 0x3e, 0x48, 0x4e, 0x85, 0x70, 0x3e, 0x34, 0x70, 0x91, 0x50,
-    0x56, 0x5e, 0x6c, 0x7f, 0x5d, 0x56, 0x65, 0x7f, 0x7f, 0xa7, 0x91, 0x7f,
-    0x65, 0x65, 0x70, 0x65, 0x70, 0x73, 0x65, 0x54, 0x64, 0x74, 0xaa, 0x99,
-    0x6e, 0x8b, 0x99, 0x98, 0x99, 0x99, 0x8e, 0x6e, 0x69, 0x99, 0x9c, 0x74,
-    0x6e, 0x81, 0x8e, 0x9c, 0xb4, 0xab, 0x7a, 0x6e, 0x94, 0xa2, 0xbc, 0x9c,
-    0x8e, 0xa9, 0xbc, 0xad, 0xae, 0xba, 0xba, 0xa9, 0x9c, 0x82, 0x9c, 0x92,
-    0xad, 0x9c, 0x88, 0x8d, 0xae, 0xba, 0x92, 0x82, 0x92, 0xb6, 0xa4, 0x82,
-    0x92, 0x92, 0xad, 0xa9, 0x94, 0x9c, 0xa5, 0xad, 0xa5, 0xb8, 0xba, 0xa9,
-    0x9c, 0x9c, 0x92, 0x8d, 0x92, 0x92, 0x82, 0x94, 0x88, 0xbc, 0xb8, 0xa9,
-    0x92, 0xa9, 0xb4, 0xad, 0xa9, 0xa9, 0x94, 0x7a, 0x82, 0xa9, 0x9c, 0x82,
-    0x74, 0x81, 0x9c, 0xad, 0xb4, 0x9c, 0x69, 0x6e, 0x94, 0xad, 0x9c, 0x6e,
-    0x6e, 0xb4, 0xaa, 0x94, 0xab, 0xbc, 0x99, 0x7a, 0x65, 0x6e, 0x6e, 0x99,
-    0x8e, 0x57, 0x65, 0x6e, 0x9d, 0x81, 0x5e, 0x54, 0x99, 0x99, 0x57, 0x54,
-    0x57, 0x70, 0x7f, 0x4e, 0x4e, 0x65, 0x79, 0x85, 0x90, 0x91, 0x70, 0x4e,
-    0x45, 0x3e, 0x56, 0x56, 0x3e, 0x48, 0x48, 0x34, 0x66, 0x85, 0x58, 0x58,
-    0x58, 0x63, 0x5f, 0x3e, 0x43, 0x33, 0x2d, 0x26, 0x58, 0x48, 0x36, 0x1d,
-    0x12, 0x1a, 0x52, 0x7b, 0x47, 0x0d, 0x12, 0x28, 0x67, 0x5f, 0x1d, 0x14,
-    0x5c, 0x61, 0x2e, 0x59, 0xe0, 0xdc, 0xd4, 0xce, 0xce, 0xce, 0xd0, 0xd4,
-    0xc3, 0xb3, 0xd0, 0xd4, 0xd4, 0xce, 0xce, 0xd4, 0xd7, 0xce, 0x23, 0x00,
-    0x1e, 0x1b, 0x0f, 0x08, 0x0e, 0x0a, 0x08, 0x1b, 0x35, 0x1c, 0x0f, 0x02,
-    0x0f, 0x0a, 0x00, 0x00, 0x08, 0x03, 0x00, 0x11, 0x35, 0x1c, 0x0c, 0x0a,
-    0x29, 0x4b, 0x0c, 0x0f, 0x1e, 0x17, 0x08, 0x08, 0x17, 0x1c, 0x1e, 0x2b,
-    0x1e, 0x20, 0x39, 0x37, 0x25, 0x17, 0x0f, 0x18, 0x0e, 0x0a, 0x12, 0x3d,
-    0x28, 0x18, 0x18, 0x1e, 0x28, 0x1d, 0x0a, 0x17, 0x31, 0x12, 0x08, 0x1e,
-    0x2e, 0x2d, 0x2f, 0x1d, 0x20, 0x26, 0x28, 0x1a, 0x67, 0x47, 0x12, 0x12,
-    0x46, 0x67, 0x28, 0x1d, 0x75, 0x8a, 0x33, 0x31, 0x5d, 0x5d, 0x1f, 0x33,
-    0x43, 0x3a, 0x2f, 0x3a, 0x27, 0x5b, 0x85, 0x6c, 0x48, 0x48, 0x56, 0x5b,
-    0x78, 0x51, 0x3e, 0x70, 0x96, 0x51, 0x3e, 0x77, 0x6c, 0x70, 0x91, 0x84,
-    0x69, 0xac, 0x99, 0x90, 0x91, 0x7f, 0x7f, 0x60, 0x7f, 0x8e, 0x99, 0x99,
-    0x81, 0x81, 0x74, 0x99, 0x84, 0x6e, 0x95, 0x74, 0x98, 0x57, 0x65, 0x7a,
-    0x84, 0x99, 0x99, 0x8e, 0x7a, 0x8b, 0x8b, 0x9c, 0xad, 0x74, 0x69, 0x99,
-    0xb4, 0x99, 0x73, 0xad, 0xbc, 0xa9, 0x94, 0xa9, 0xb8, 0x9b, 0x8b, 0x9c,
-    0x92, 0x94, 0x94, 0x8b, 0x9c, 0xba, 0xa5, 0xa9, 0x92, 0x9c, 0x92, 0xa5,
-    0x8d, 0x94, 0x92, 0xb6, 0xb8, 0x9c, 0xab, 0xa9, 0x92, 0xb0, 0xb6, 0xb6,
-    0xb6, 0xb8, 0xba, 0xae, 0x9c, 0xa5, 0x92, 0x9c, 0x92, 0xae, 0xba, 0xa4,
-    0xa5, 0xa4, 0xa5, 0xae, 0x88, 0xa2, 0xa2, 0xae, 0x8c, 0x95, 0x9b, 0x9c,
-    0x9c, 0xa9, 0x9c, 0x94, 0x9c, 0x82, 0x88, 0xae, 0x94, 0x6e, 0x8e, 0xab,
-    0xab, 0x73, 0x94, 0xba, 0xad, 0x8e, 0x8c, 0xab, 0x99, 0x84, 0x7a, 0x99,
-    0x84, 0x73, 0x65, 0x5a, 0x99, 0x9c, 0x8e, 0x81, 0x65, 0x81, 0x81, 0x6e,
-    0x65, 0x65, 0x99, 0x90, 0x5e, 0x5d, 0x7f, 0x57, 0x65, 0x8b, 0x81, 0x81,
-    0x9d, 0x91, 0x7f, 0x7f, 0x5e, 0x4e, 0x56, 0x4e, 0x78, 0x7f, 0x60, 0x56,
-    0x4e, 0x70, 0x70, 0x51, 0x5b, 0x56, 0x5b, 0x34, 0x1f, 0x47, 0x43, 0x47,
-    0x3e, 0x3e, 0x2f, 0x3a, 0x2f, 0x2f, 0x5b, 0x48, 0x12, 0x14, 0x4c, 0x67,
-    0x28, 0x0d, 0x7b, 0x7b, 0x2e, 0x09, 0x4f, 0x5c, 0x18, 0x1e, 0x2e, 0x3b,
-    0xcf, 0xd3, 0xce, 0xd4, 0xdc, 0xcf, 0xcf, 0xce, 0xc2, 0xc3, 0xce, 0xce,
-    0xd0, 0xd0, 0xda, 0xcf, 0xd0, 0xd3, 0x23, 0x11, 0x25, 0x1e, 0x1e, 0x2b,
-    0x2e, 0x1e, 0x1e, 0x07, 0x0f, 0x0f, 0x06, 0x08, 0x14, 0x1e, 0x11, 0x0a,
-    0x0e, 0x18, 0x18, 0x0f, 0x08, 0x11, 0x0f, 0x03, 0x0f, 0x1c, 0x0f, 0x0c,
-    0x14, 0x1e, 0x06, 0x00, 0x1c, 0x4f, 0x0a, 0x00, 0x0a, 0x37, 0x13, 0x0e,
-    0x1e, 0x1e, 0x08, 0x0a, 0x4c, 0x39, 0x04, 0x0e, 0x18, 0x08, 0x08, 0x0e,
-    0x40, 0x38, 0x00, 0x14, 0x20, 0x20, 0x38, 0x3f, 0x4b, 0x2d, 0x18, 0x38,
-    0x58, 0x3a, 0x12, 0x2f, 0x58, 0x3a, 0x47, 0x12, 0x04, 0x11, 0x26, 0x3e,
-    0x58, 0x58, 0x5d, 0x51, 0x56, 0x56, 0x2f, 0x1f, 0x20, 0x10, 0x33, 0x5d,
-    0x5d, 0x5d, 0x56, 0x48, 0x3e, 0x48, 0x78, 0x45, 0x4e, 0x56, 0x70, 0x70,
-    0x77, 0x70, 0x4e, 0x4e, 0x96, 0x7f, 0x48, 0x6c, 0x96, 0x7f, 0x5a, 0x7f,
-    0x7f, 0x70, 0x45, 0x90, 0x9d, 0x73, 0x65, 0x74, 0x73, 0x65, 0x81, 0x99,
-    0xab, 0x65, 0x65, 0x74, 0x98, 0xa2, 0x99, 0xaa, 0xac, 0x99, 0x8e, 0x9c,
-    0xa9, 0x74, 0x7a, 0xae, 0xab, 0x94, 0x8e, 0x5a, 0x65, 0xa1, 0xab, 0xab,
-    0xae, 0xae, 0xae, 0xa9, 0xa5, 0xa2, 0x8b, 0x8b, 0x7a, 0x7a, 0x92, 0x92,
-    0x92, 0x92, 0x94, 0x9c, 0x88, 0xae, 0xa5, 0xa2, 0x88, 0xa4, 0xa5, 0xa4,
-    0xa5, 0x88, 0x82, 0xae, 0xb0, 0x92, 0x92, 0xb6, 0xb0, 0x92, 0xa5, 0xa5,
-    0x92, 0x88, 0x92, 0xc0, 0xba, 0x9c, 0x92, 0xa4, 0x9c, 0x88, 0x92, 0xb0,
-    0xa5, 0x82, 0x9c, 0xad, 0xa4, 0xb8, 0xba, 0xae, 0x92, 0x92, 0xae, 0xb6,
-    0x92, 0x74, 0x92, 0xb4, 0x9c, 0x8c, 0x73, 0x5a, 0x99, 0x9c, 0x9c, 0xaa,
-    0x9c, 0xa2, 0x9c, 0xa2, 0x94, 0x81, 0x65, 0x70, 0x54, 0x73, 0x95, 0x8e,
-    0x7a, 0x6e, 0x65, 0x5a, 0x81, 0x99, 0x81, 0x81, 0x65, 0x99, 0x8e, 0x84,
-    0x65, 0x4e, 0x65, 0xa0, 0x70, 0x4e, 0x70, 0x91, 0x70, 0x4e, 0x70, 0x7f,
-    0x56, 0x41, 0x93, 0x96, 0x56, 0x3e, 0x5e, 0x4e, 0x34, 0x45, 0x70, 0x75,
-    0x33, 0x4d, 0x4e, 0x4e, 0x6c, 0x75, 0x89, 0x58, 0x2f, 0x45, 0x5d, 0x5b,
-    0x2f, 0x4d, 0x6c, 0x58, 0x4d, 0x26, 0x0b, 0x0d, 0x3c, 0x47, 0x52, 0x3a,
-    0x67, 0x53, 0x4c, 0x3c, 0x2b, 0x04, 0x06, 0x23, 0xc3, 0xd4, 0xd4, 0xdc,
-    0xda, 0xce, 0xcd, 0xd0, 0xc2, 0xc2, 0xcf, 0xce, 0xd3, 0xd4, 0xd3, 0xd4,
-    0xce, 0xce, 0x3b, 0x25, 0x00, 0x00, 0x2e, 0x25, 0x08, 0x08, 0x1e, 0x17,
-    0x02, 0x1c, 0x46, 0x0b, 0x04, 0x06, 0x04, 0x06, 0x00, 0x1e, 0x1c, 0x08,
-    0x00, 0x0e, 0x13, 0x17, 0x2b, 0x25, 0x1b, 0x08, 0x0f, 0x1c, 0x0a, 0x1c,
-    0x37, 0x13, 0x0b, 0x0e, 0x06, 0x0e, 0x00, 0x11, 0x2b, 0x25, 0x17, 0x11,
-    0x11, 0x06, 0x1d, 0x0b, 0x06, 0x0d, 0x1e, 0x38, 0x38, 0x40, 0x40, 0x14,
-    0x20, 0x31, 0x1d, 0x06, 0x09, 0x06, 0x06, 0x18, 0x1d, 0x1f, 0x3a, 0x28,
-    0x0d, 0x28, 0x47, 0x58, 0x58, 0x5b, 0x63, 0x34, 0x12, 0x28, 0x31, 0x33,
-    0x63, 0x56, 0x3a, 0x48, 0x48, 0x58, 0x3a, 0x36, 0x3e, 0x34, 0x4d, 0x5e,
-    0x7f, 0x78, 0x56, 0x56, 0x4e, 0x7f, 0x96, 0x85, 0x6c, 0x4e, 0x65, 0x7f,
-    0x7f, 0x60, 0x5d, 0x6c, 0x85, 0x45, 0x79, 0x91, 0x7f, 0x65, 0x65, 0x73,
-    0x4e, 0x84, 0x99, 0x65, 0x81, 0x8e, 0x8e, 0x8e, 0xa2, 0x94, 0x69, 0x74,
-    0x94, 0x8c, 0x81, 0x65, 0x65, 0x54, 0x73, 0x7a, 0x74, 0x94, 0x8c, 0x69,
-    0x6e, 0x8c, 0x9c, 0xab, 0xab, 0xad, 0xa9, 0x6e, 0x8b, 0x82, 0x82, 0x9c,
-    0xb4, 0x9c, 0x92, 0x8d, 0x88, 0x92, 0x8b, 0x88, 0xa5, 0x9c, 0xae, 0xba,
-    0xb0, 0x92, 0x9c, 0x92, 0xa5, 0xb8, 0xba, 0xae, 0x92, 0xa4, 0xb6, 0xa5,
-    0xa5, 0x8d, 0xa4, 0xa5, 0x92, 0x88, 0xad, 0xba, 0xae, 0xa2, 0xa5, 0x9c,
-    0x9c, 0xba, 0x92, 0x88, 0xa5, 0xa4, 0xae, 0xba, 0xba, 0x9c, 0x9c, 0xae,
-    0xad, 0x9c, 0x88, 0x74, 0x84, 0x6e, 0x9c, 0x82, 0xa2, 0x9c, 0x8c, 0x7a,
-    0x9c, 0xae, 0xa9, 0xab, 0xb4, 0xa4, 0x74, 0x6e, 0x74, 0x8e, 0x7a, 0x9c,
-    0x9c, 0x74, 0x94, 0x7a, 0x7a, 0x69, 0x65, 0x8e, 0x73, 0x81, 0x9c, 0xab,
-    0x95, 0x5a, 0x65, 0x69, 0x99, 0x99, 0x8e, 0x81, 0x70, 0x81, 0x91, 0x65,
-    0x57, 0x60, 0x65, 0x70, 0x48, 0x60, 0x73, 0x70, 0x50, 0x5e, 0x5e, 0x48,
-    0x7f, 0x5e, 0x48, 0x4e, 0x4e, 0x5e, 0x7f, 0x7f, 0x60, 0x34, 0x45, 0x5e,
-    0x56, 0x2f, 0x1f, 0x1d, 0x09, 0x33, 0x36, 0x4d, 0x58, 0x2f, 0x1a, 0x27,
-    0x48, 0x43, 0x5f, 0x53, 0x58, 0x47, 0x12, 0x12, 0x28, 0x1d, 0x4f, 0x5c,
-    0x12, 0x12, 0x12, 0x3b, 0xbb, 0xb3, 0xbb, 0xbb, 0xb3, 0xbb, 0xc2, 0xc2,
-    0x80, 0x23, 0x23, 0x3b, 0x4f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3d, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x83, 0x83, 0x3b, 0x0f, 0x0f, 0x08, 0x12,
-    0x17, 0x02, 0x06, 0x0a, 0x0e, 0x1e, 0x1d, 0x25, 0x0a, 0x08, 0x0e, 0x0a,
-    0x07, 0x02, 0x03, 0x02, 0x0f, 0x21, 0x16, 0x1e, 0x0d, 0x0d, 0x20, 0x0e,
-    0x01, 0x00, 0x0f, 0x00, 0x00, 0x19, 0x25, 0x0b, 0x00, 0x08, 0x14, 0x0d,
-    0x20, 0x31, 0x1e, 0x18, 0x2e, 0x87, 0xc2, 0xc2, 0xc3, 0xd0, 0xd0, 0xc3,
-    0xbb, 0x3b, 0x1d, 0x04, 0x06, 0x1d, 0x4f, 0x3a, 0x14, 0x12, 0x12, 0x2f,
-    0x3e, 0x2f, 0x2f, 0x2f, 0x26, 0x36, 0x3c, 0x1f, 0x1d, 0x2f, 0x56, 0x60,
-    0x70, 0x5b, 0x5e, 0x5d, 0x75, 0x5d, 0x3a, 0x3a, 0x4e, 0x3e, 0x56, 0x60,
-    0x4e, 0x3e, 0x27, 0x41, 0x60, 0x5d, 0x60, 0x70, 0x64, 0x81, 0x73, 0x54,
-    0x4e, 0x65, 0x60, 0xb5, 0xd8, 0xbd, 0x79, 0x54, 0x54, 0x65, 0x81, 0x8b,
-    0x99, 0x73, 0x65, 0x81, 0x98, 0xa2, 0xa2, 0x74, 0x94, 0xb4, 0x94, 0x84,
-    0x73, 0x8e, 0x81, 0x73, 0x7a, 0xa9, 0xab, 0x74, 0x65, 0x73, 0x8b, 0xa9,
-    0xa2, 0x8b, 0x7a, 0x9c, 0x8c, 0x9c, 0x8b, 0x6e, 0x7a, 0xad, 0xa4, 0xa5,
-    0xa5, 0xa4, 0xa5, 0xae, 0xa5, 0x88, 0x82, 0x92, 0x92, 0x92, 0xa4, 0xa5,
-    0x9c, 0x82, 0x8c, 0xcb, 0xbd, 0xa5, 0xa5, 0xa5, 0xb0, 0xb6, 0xa5, 0x88,
-    0xa5, 0x92, 0x88, 0x8b, 0xa9, 0xa5, 0x92, 0x88, 0x92, 0x92, 0xa5, 0xb0,
-    0xa5, 0x92, 0x92, 0xe2, 0xdf, 0xb6, 0x92, 0x9c, 0xba, 0xae, 0x9c, 0x8c,
-    0x94, 0xcb, 0xcb, 0x8b, 0x92, 0xbc, 0xcb, 0xdf, 0xc5, 0x7a, 0x92, 0xae,
-    0x9c, 0x74, 0x82, 0x8e, 0x6e, 0x99, 0x65, 0x69, 0x88, 0x88, 0xa2, 0x9e,
-    0xd5, 0xdd, 0x9c, 0xab, 0x6e, 0x65, 0x6e, 0x7a, 0x65, 0x73, 0x84, 0x73,
-    0x60, 0x4a, 0x70, 0x81, 0x54, 0x84, 0x73, 0x73, 0x8e, 0x65, 0x4e, 0x60,
-    0x70, 0x4e, 0x41, 0x4e, 0x79, 0x60, 0x3e, 0x41, 0x5d, 0x4e, 0x7f, 0x70,
-    0x4e, 0x4e, 0x60, 0x79, 0x7f, 0x70, 0x4d, 0x78, 0x86, 0xc6, 0xc6, 0x83,
-    0x47, 0x31, 0x1d, 0x3a, 0x5b, 0x58, 0x26, 0x12, 0x12, 0x27, 0x58, 0x3a,
-    0x1d, 0x1a, 0x1f, 0x31, 0x2e, 0x12, 0x06, 0x12, 0x3c, 0x3a, 0x3f, 0x49,
-    0xdc, 0xda, 0xda, 0xd4, 0xce, 0xcf, 0xcf, 0xcf, 0xc2, 0x14, 0x0a, 0x11,
-    0x00, 0x00, 0x1e, 0x1e, 0x11, 0x18, 0xa8, 0xd3, 0xd3, 0xce, 0xcd, 0xcd,
-    0xc3, 0xc3, 0xce, 0x80, 0x1b, 0x0a, 0x00, 0x08, 0x25, 0x1e, 0x11, 0x0e,
-    0x0d, 0x1c, 0x14, 0x1e, 0x1e, 0x0a, 0x0a, 0x38, 0x17, 0x00, 0x08, 0x0f,
-    0x08, 0x1b, 0x21, 0x0f, 0x00, 0x11, 0x0d, 0x04, 0x25, 0x25, 0x46, 0x2e,
-    0x0a, 0x08, 0x11, 0x25, 0x13, 0x04, 0x08, 0x0b, 0x11, 0x1a, 0x61, 0x6f,
-    0xc2, 0xce, 0xce, 0xd4, 0xd7, 0xd3, 0xd3, 0xdc, 0xdc, 0x59, 0x4c, 0x14,
-    0x4f, 0x31, 0x20, 0x14, 0x36, 0x4c, 0x47, 0x2f, 0x3a, 0x2f, 0x2f, 0x2f,
-    0x47, 0x58, 0x58, 0x43, 0x3c, 0x27, 0x58, 0x48, 0x85, 0x9a, 0xb3, 0x9a,
-    0x56, 0x2f, 0x56, 0x7f, 0x5e, 0x3e, 0x5d, 0x5e, 0x5d, 0x70, 0x5d, 0x48,
-    0x70, 0x96, 0x70, 0x48, 0x54, 0x79, 0x60, 0x81, 0x91, 0x8e, 0xac, 0xe3,
-    0xdd, 0xd5, 0x91, 0x91, 0x65, 0x65, 0x81, 0x69, 0x84, 0xaf, 0xb1, 0x8e,
-    0x57, 0x64, 0x8b, 0x9c, 0x94, 0x99, 0x94, 0x9c, 0x94, 0x9c, 0x94, 0x94,
-    0x9c, 0x94, 0x7a, 0x8c, 0xab, 0x9c, 0x8b, 0x9c, 0x8d, 0x94, 0x88, 0x9c,
-    0x9c, 0xad, 0xad, 0x9c, 0x8b, 0x8d, 0xa2, 0xa5, 0xc0, 0xc0, 0xbf, 0xa5,
-    0x9c, 0x88, 0xb8, 0xb6, 0x9c, 0x92, 0xb0, 0x92, 0xae, 0xae, 0xdf, 0xe7,
-    0xe7, 0xd1, 0x9c, 0x88, 0xa5, 0xa5, 0xa5, 0xb6, 0xb0, 0xba, 0xba, 0x88,
-    0x9c, 0xb0, 0xb6, 0xa5, 0xa5, 0x92, 0x92, 0xa4, 0xb8, 0xc0, 0xac, 0xe7,
-    0xdf, 0xb5, 0xae, 0xa5, 0x92, 0x92, 0xae, 0xae, 0xd5, 0xe7, 0xe8, 0xde,
-    0x92, 0x94, 0xe7, 0xe8, 0xe2, 0x9c, 0x9c, 0xa9, 0xa2, 0x88, 0x94, 0x94,
-    0x9c, 0x9c, 0x94, 0x81, 0x74, 0x94, 0x8b, 0xc5, 0xeb, 0xeb, 0xb9, 0x8e,
-    0x73, 0x8c, 0x9b, 0x84, 0x65, 0x7a, 0x95, 0x84, 0x84, 0x65, 0x70, 0x84,
-    0x84, 0x65, 0x4e, 0x5a, 0x7f, 0x65, 0x81, 0x81, 0x91, 0x9f, 0x70, 0x56,
-    0x70, 0x7f, 0x70, 0x4e, 0x4e, 0x6a, 0x48, 0x70, 0xa7, 0x93, 0x56, 0x2f,
-    0x34, 0x70, 0x78, 0x4e, 0x51, 0xd8, 0xdd, 0xc6, 0x6c, 0x3a, 0x5d, 0x58,
-    0x2f, 0x26, 0x33, 0x58, 0x3c, 0x26, 0x2f, 0x2f, 0x28, 0x28, 0x31, 0x47,
-    0x4f, 0x33, 0x12, 0x14, 0x31, 0x1d, 0x67, 0x87, 0xe0, 0xe0, 0xd4, 0xce,
-    0xcf, 0xdc, 0xd4, 0xce, 0xc2, 0x31, 0x0d, 0x2e, 0x25, 0x08, 0x12, 0x28,
-    0x11, 0x00, 0x80, 0xd3, 0xcd, 0xd3, 0xd3, 0xd4, 0xda, 0xd0, 0xd0, 0x55,
-    0x2e, 0x1e, 0x08, 0x08, 0x08, 0x0f, 0x17, 0x2e, 0x4f, 0x2b, 0x00, 0x02,
-    0x0f, 0x1e, 0x17, 0x0e, 0x0f, 0x0a, 0x07, 0x37, 0x17, 0x0f, 0x17, 0x1e,
-    0x17, 0x0a, 0x0d, 0x0e, 0x19, 0x0e, 0x0a, 0x17, 0x25, 0x18, 0x11, 0x08,
-    0x08, 0x31, 0x38, 0x20, 0x31, 0x18, 0x23, 0xd0, 0xd0, 0xd4, 0xc3, 0xb3,
-    0xa8, 0x80, 0xa8, 0xa8, 0xa8, 0x11, 0x4c, 0x5f, 0x38, 0x31, 0x47, 0x3c,
-    0x58, 0x7b, 0x63, 0x2f, 0x33, 0x3a, 0x47, 0x26, 0x27, 0x2f, 0x2d, 0x2f,
-    0x26, 0x1f, 0x47, 0x27, 0x27, 0x48, 0x3c, 0x1a, 0x1a, 0x56, 0x78, 0x5b,
-    0x51, 0x6c, 0x78, 0x6c, 0x60, 0x5e, 0x90, 0x96, 0x4a, 0x5b, 0x7f, 0x70,
-    0x79, 0x73, 0x70, 0x81, 0x70, 0x60, 0x70, 0xd8, 0xe3, 0xd9, 0x7f, 0x4e,
-    0x81, 0xa7, 0x8e, 0x95, 0x9f, 0x73, 0x7f, 0x91, 0x99, 0x99, 0x99, 0x74,
-    0x69, 0x65, 0x6e, 0x74, 0x74, 0x94, 0xad, 0x9c, 0x94, 0x9c, 0x94, 0xb4,
-    0xbc, 0xbc, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x6e, 0x9c, 0x7a, 0x94, 0x94,
-    0x94, 0x88, 0x9c, 0x8b, 0x9c, 0x94, 0x8c, 0x7a, 0x94, 0xae, 0xae, 0x92,
-    0xa5, 0xb0, 0x92, 0xa5, 0xa5, 0xb6, 0xdd, 0xe7, 0xe7, 0xc1, 0xa5, 0x92,
-    0xa4, 0xa5, 0xb0, 0xb6, 0x92, 0x92, 0xa5, 0xb6, 0xba, 0xa5, 0x88, 0xa5,
-    0xc0, 0xb0, 0xa5, 0xba, 0x92, 0x9c, 0xac, 0xe7, 0xe8, 0xb5, 0xa9, 0x94,
-    0x82, 0x8b, 0x88, 0xa5, 0xc4, 0xe7, 0xe7, 0xcb, 0xa5, 0xae, 0xe7, 0xec,
-    0xe2, 0xae, 0x88, 0x9c, 0x9c, 0x9c, 0x81, 0x7a, 0x82, 0x81, 0x74, 0x6e,
-    0x84, 0x99, 0x81, 0xbd, 0xe5, 0xdf, 0x7c, 0x65, 0x99, 0x94, 0x8e, 0x6e,
-    0x99, 0x95, 0x7a, 0x8e, 0x81, 0xaf, 0x9f, 0x54, 0x81, 0x91, 0x73, 0x70,
-    0x84, 0x79, 0x7f, 0x65, 0x5e, 0x6c, 0x7f, 0x78, 0x70, 0x4e, 0x48, 0x90,
-    0x91, 0x6c, 0x85, 0x78, 0x56, 0x5b, 0x78, 0x5d, 0x63, 0x56, 0x3e, 0x27,
-    0x26, 0xc6, 0xdc, 0xc6, 0x5d, 0x6c, 0x56, 0x58, 0x5d, 0x58, 0x75, 0x9a,
-    0x75, 0x27, 0x33, 0x36, 0x47, 0x1d, 0x12, 0x1a, 0x12, 0x1e, 0x12, 0x0e,
-    0x28, 0x1e, 0x0e, 0x3b, 0xce, 0xce, 0xcd, 0xd3, 0xd7, 0xd4, 0xcf, 0xd3,
-    0xc3, 0x25, 0x28, 0x11, 0x4f, 0x5c, 0x00, 0x0e, 0x1e, 0x28, 0x80, 0xd3,
-    0xce, 0xd3, 0xd3, 0xce, 0xd3, 0xd4, 0xd0, 0x6f, 0x08, 0x07, 0x11, 0x38,
-    0x2e, 0x17, 0x1e, 0x0f, 0x0f, 0x1c, 0x0a, 0x1c, 0x17, 0x0a, 0x00, 0x08,
-    0x0a, 0x06, 0x06, 0x0e, 0x06, 0x02, 0x07, 0x35, 0x40, 0x11, 0x00, 0x00,
-    0x06, 0x0a, 0x17, 0x08, 0x06, 0x0e, 0x02, 0x0d, 0x25, 0x1e, 0x0d, 0x08,
-    0x06, 0x0c, 0x80, 0xce, 0xce, 0xa8, 0x12, 0x0d, 0x17, 0x18, 0x52, 0x67,
-    0x67, 0x52, 0x18, 0x18, 0x0e, 0x13, 0x1a, 0x47, 0x36, 0x1a, 0x28, 0x6b,
-    0x6b, 0x23, 0x28, 0x5f, 0x5b, 0x48, 0x3e, 0x34, 0x63, 0x7b, 0x1f, 0x3a,
-    0x27, 0x1f, 0x49, 0x87, 0x48, 0x48, 0x4e, 0x34, 0x33, 0x78, 0x5b, 0x87,
-    0x68, 0x7c, 0xa6, 0x7c, 0x87, 0x87, 0xa6, 0xa6, 0x91, 0x4e, 0x54, 0x54,
-    0x60, 0x65, 0x50, 0xd9, 0xdd, 0xcb, 0x7c, 0xa6, 0xa6, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x68, 0x7c, 0x7f, 0x7a, 0x65, 0x65, 0x69, 0x99, 0xb4, 0xb4,
-    0xb4, 0x6e, 0x74, 0x6e, 0x7c, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x7a, 0x6e, 0x9c, 0xad, 0x9c, 0x92, 0x92, 0xae, 0xba, 0xa5, 0x82, 0x9c,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x7c, 0xa5, 0xa5, 0x9c, 0x92,
-    0x92, 0xb0, 0xba, 0xc8, 0xb5, 0x92, 0xba, 0xc0, 0x92, 0x8d, 0xa4, 0x92,
-    0x9e, 0x9e, 0x9e, 0xb5, 0x9c, 0x94, 0x92, 0xa4, 0xa2, 0x88, 0x9c, 0x9c,
-    0x82, 0x9e, 0xbc, 0xe8, 0xe7, 0xc5, 0x9e, 0x9e, 0x9e, 0xba, 0xb0, 0xb6,
-    0xa5, 0xbd, 0xc8, 0x6e, 0x94, 0x92, 0xe7, 0xe7, 0xd2, 0x82, 0x8d, 0x94,
-    0x69, 0x74, 0xa2, 0x9c, 0x9c, 0x88, 0xa2, 0xae, 0xab, 0x84, 0x7a, 0xbd,
-    0xdf, 0xdf, 0x9e, 0x84, 0x99, 0x7a, 0x65, 0x73, 0x99, 0x65, 0x65, 0x64,
-    0x99, 0x91, 0x84, 0x7c, 0x7c, 0x9f, 0xac, 0x73, 0x4e, 0x54, 0x70, 0x70,
-    0x70, 0x3e, 0x41, 0x4e, 0x49, 0x87, 0x87, 0x87, 0x87, 0x68, 0x6b, 0x6b,
-    0x87, 0x6b, 0x6b, 0x87, 0x87, 0x6b, 0x49, 0x33, 0x6c, 0xdc, 0xe0, 0xc6,
-    0x2f, 0x3a, 0x1a, 0x1d, 0x3a, 0x56, 0x52, 0x28, 0x12, 0x49, 0x49, 0x23,
-    0x1d, 0x36, 0x3a, 0x47, 0x2d, 0x2e, 0x58, 0x5f, 0x18, 0x14, 0x14, 0x23,
-    0xce, 0xd4, 0xd3, 0xd3, 0xd7, 0xce, 0xc3, 0xd4, 0xc3, 0x0e, 0x08, 0x1e,
-    0x40, 0x14, 0x00, 0x00, 0x1e, 0x52, 0xa8, 0xce, 0xcd, 0xcd, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0x3b, 0x03, 0x0e, 0x19, 0x11, 0x0a, 0x08, 0x08, 0x0f,
-    0x00, 0x03, 0x0f, 0x1e, 0x0a, 0x0c, 0x08, 0x17, 0x2e, 0x46, 0x4f, 0x0a,
-    0x1e, 0x2e, 0x0f, 0x08, 0x06, 0x08, 0x0e, 0x04, 0x11, 0x3d, 0x2e, 0x08,
-    0x17, 0x55, 0x4f, 0x25, 0x38, 0x17, 0x17, 0x18, 0x4b, 0x4f, 0xca, 0xe0,
-    0xda, 0x42, 0x14, 0x28, 0x61, 0x4f, 0x2e, 0x3c, 0x38, 0x2e, 0x18, 0x12,
-    0x2d, 0x47, 0x1a, 0x06, 0x11, 0x3c, 0x6b, 0xd7, 0xd7, 0xa8, 0x52, 0x66,
-    0x33, 0x27, 0x48, 0x58, 0x33, 0x36, 0x5f, 0x4d, 0x26, 0x3b, 0xd9, 0xdc,
-    0xc2, 0x6c, 0x48, 0x5e, 0xb7, 0xd8, 0xdd, 0xe3, 0xdd, 0xdd, 0xd9, 0xdd,
-    0xdd, 0xe3, 0xdd, 0xd9, 0xdd, 0xd9, 0xc6, 0x65, 0x9f, 0x9f, 0x7f, 0xd9,
-    0xe9, 0xe9, 0xe3, 0xe3, 0xe5, 0xdd, 0xdd, 0xe9, 0xe9, 0xe9, 0xec, 0xe9,
-    0xe2, 0xdd, 0xc6, 0xac, 0xac, 0x99, 0x98, 0x99, 0x7a, 0xcb, 0xd2, 0xe2,
-    0xe8, 0xe2, 0xdf, 0xdf, 0xdf, 0xe8, 0xe2, 0xe7, 0xe7, 0xd5, 0xc5, 0xae,
-    0x88, 0x88, 0xa5, 0x92, 0xd2, 0xe2, 0xe8, 0xdf, 0xdf, 0xe7, 0xe8, 0xe7,
-    0xe8, 0xe7, 0xe7, 0xe7, 0xe7, 0xd2, 0xb5, 0xba, 0xae, 0xa4, 0xb2, 0xe7,
-    0xe8, 0xb5, 0x82, 0x92, 0xb5, 0xd5, 0xe7, 0xe8, 0xeb, 0xe7, 0xe7, 0xe7,
-    0xc5, 0xba, 0xa5, 0xa5, 0xa4, 0xa2, 0xb8, 0xc0, 0xc5, 0xeb, 0xeb, 0xe7,
-    0xe8, 0xe8, 0xeb, 0xec, 0xeb, 0xe8, 0xe8, 0x92, 0x82, 0xdf, 0xdf, 0xc5,
-    0xa5, 0x94, 0xdf, 0xdf, 0xdf, 0x92, 0x92, 0x9c, 0x8b, 0xab, 0xb8, 0x94,
-    0x88, 0x94, 0x94, 0x74, 0x95, 0x99, 0x7a, 0xbd, 0xdf, 0xe5, 0x9e, 0xa1,
-    0x94, 0x7a, 0x9d, 0x7a, 0x65, 0x8e, 0xaa, 0x99, 0x84, 0x65, 0xe2, 0xe9,
-    0xe5, 0xdd, 0xdd, 0xdd, 0xcb, 0x9e, 0x65, 0x9f, 0xa0, 0x5e, 0xa6, 0xd8,
-    0xe9, 0xe3, 0xdd, 0xdd, 0xd9, 0xdd, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdc,
-    0xdc, 0xe3, 0xe0, 0xa3, 0x56, 0xdc, 0xdc, 0xc6, 0x3a, 0x2d, 0x3a, 0x58,
-    0x2f, 0x1e, 0x12, 0x3a, 0xbb, 0xd7, 0xd7, 0xd0, 0x58, 0x63, 0x3c, 0x12,
-    0x28, 0x2d, 0x12, 0x1a, 0x3c, 0x38, 0x14, 0x23, 0xce, 0xd4, 0xd4, 0xda,
-    0xcf, 0xd4, 0xdc, 0xcf, 0xbb, 0x4f, 0x5c, 0x1e, 0x08, 0x0a, 0x2e, 0x2b,
-    0x0a, 0x06, 0x80, 0xd3, 0xd3, 0xce, 0xd3, 0xd4, 0xd0, 0xce, 0xd4, 0x87,
-    0x1c, 0x2e, 0x1e, 0x0a, 0x07, 0x35, 0x4b, 0x4f, 0x4b, 0x35, 0x0c, 0x07,
-    0x0a, 0x35, 0x4b, 0x1c, 0x0c, 0x17, 0x08, 0x08, 0x1b, 0x37, 0x0a, 0x0a,
-    0x0a, 0x06, 0x37, 0x2e, 0x04, 0x01, 0x0a, 0x40, 0x11, 0x11, 0x40, 0x25,
-    0x13, 0x0e, 0x0a, 0x1e, 0x1e, 0x08, 0xa8, 0xd4, 0xda, 0x8f, 0x7d, 0x44,
-    0x06, 0x09, 0x06, 0x01, 0x00, 0x0a, 0x28, 0x26, 0x28, 0x31, 0x28, 0x3c,
-    0x26, 0x26, 0x87, 0xd4, 0xcf, 0xa8, 0x47, 0x1a, 0x2f, 0x2f, 0x34, 0x3e,
-    0x66, 0x5f, 0x33, 0x3e, 0x58, 0x3e, 0xd7, 0xe0, 0xc2, 0x34, 0x32, 0xb7,
-    0xdd, 0xe0, 0xdd, 0xdd, 0xdd, 0xd9, 0xd9, 0xdd, 0xe3, 0xdd, 0xd9, 0xd9,
-    0xdd, 0xe5, 0xe5, 0xdd, 0x7f, 0x4e, 0x90, 0xe3, 0xdd, 0xe5, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xe2, 0xdd, 0xdf, 0xdf, 0xdd, 0xe3, 0xe6, 0xe9, 0xeb, 0xe5,
-    0x7c, 0x5e, 0x5e, 0x68, 0xdf, 0xdf, 0xe8, 0xe2, 0xe2, 0xdf, 0xdf, 0xe5,
-    0xe2, 0xe6, 0xe6, 0xdf, 0xe8, 0xe8, 0xdf, 0xcb, 0x82, 0x9c, 0x8d, 0xe2,
-    0xe7, 0xe7, 0xe7, 0xe8, 0xe7, 0xe2, 0xe2, 0xe8, 0xe7, 0xdf, 0xe8, 0xe8,
-    0xe7, 0xe7, 0xe7, 0xc9, 0xb0, 0x82, 0xb8, 0xe7, 0xe7, 0xb5, 0x92, 0xb5,
-    0xe7, 0xeb, 0xe7, 0xe7, 0xe7, 0xe8, 0xe7, 0xe7, 0xb5, 0xba, 0xa4, 0x88,
-    0x9c, 0xb6, 0xa5, 0x9c, 0x9e, 0xe8, 0xe8, 0xe7, 0xeb, 0xec, 0xe8, 0xe2,
-    0xe2, 0xdf, 0xd2, 0x6e, 0xa2, 0xdf, 0xe7, 0xc5, 0x94, 0x9c, 0xe7, 0xe7,
-    0xd5, 0xae, 0x88, 0x94, 0xa5, 0x8c, 0x6e, 0x82, 0x94, 0x94, 0x94, 0x9c,
-    0x8c, 0x74, 0xab, 0xbd, 0xdf, 0xe8, 0xa6, 0x99, 0x6e, 0x65, 0x99, 0x99,
-    0x74, 0x6e, 0x8e, 0x8e, 0x57, 0x57, 0xd9, 0xe9, 0xdd, 0xdd, 0xdf, 0xdf,
-    0xe6, 0xe9, 0xcc, 0x57, 0x4e, 0xb7, 0xdd, 0xdd, 0xe3, 0xdd, 0xdd, 0xd9,
-    0xdd, 0xe3, 0xdc, 0xd7, 0xd7, 0xdd, 0xd9, 0xe0, 0xe0, 0xe0, 0xd7, 0x3b,
-    0x12, 0xc3, 0xcf, 0xbb, 0x3e, 0x3e, 0x33, 0x3c, 0x2f, 0x43, 0xbb, 0xd7,
-    0xdc, 0xd7, 0xcf, 0xa8, 0x58, 0x1d, 0x14, 0x28, 0x2e, 0x26, 0x3c, 0x2f,
-    0x1d, 0x1e, 0x31, 0x49, 0xce, 0xd4, 0xda, 0xd3, 0xc3, 0xd4, 0xdc, 0xd0,
-    0xc2, 0x12, 0x38, 0x13, 0x00, 0x14, 0x38, 0x1e, 0x0a, 0x11, 0x80, 0xd4,
-    0xda, 0xd3, 0xcd, 0xce, 0xd3, 0xd4, 0xd3, 0x80, 0x17, 0x0f, 0x08, 0x0e,
-    0x18, 0x1e, 0x07, 0x0a, 0x17, 0x1e, 0x1b, 0x61, 0x40, 0x03, 0x05, 0x0f,
-    0x02, 0x02, 0x02, 0x00, 0x03, 0x06, 0x35, 0x38, 0x0e, 0x00, 0x08, 0x04,
-    0x01, 0x06, 0x1e, 0x38, 0x18, 0x08, 0x08, 0x11, 0x2e, 0x61, 0x28, 0x18,
-    0x37, 0x0a, 0xa8, 0xd3, 0xd0, 0x42, 0x1e, 0x06, 0x06, 0x1d, 0x37, 0x20,
-    0x28, 0x1d, 0x18, 0x28, 0x38, 0x18, 0x2e, 0x67, 0x3a, 0x0a, 0x3b, 0xd4,
-    0xd7, 0xa8, 0x4d, 0x3e, 0x3a, 0x43, 0x58, 0x36, 0x3c, 0x3a, 0x33, 0x56,
-    0x85, 0x85, 0xdc, 0xdc, 0xc2, 0x48, 0x3b, 0xd9, 0xd9, 0xd8, 0xb7, 0x49,
-    0x41, 0x4e, 0x51, 0x3e, 0x3e, 0x70, 0xa7, 0x96, 0x7c, 0xc4, 0xd9, 0xd9,
-    0xbd, 0x5a, 0x91, 0xe3, 0xdf, 0xc4, 0x60, 0x8e, 0xaf, 0x99, 0x8e, 0x98,
-    0x81, 0x74, 0x74, 0x65, 0x84, 0xc6, 0xdd, 0xdf, 0xd8, 0x91, 0x7a, 0xdf,
-    0xe8, 0xdd, 0xbd, 0x94, 0x8e, 0x8e, 0xb4, 0xb4, 0x7a, 0x69, 0x94, 0x9c,
-    0xbd, 0xdd, 0xe8, 0xe8, 0xa9, 0xa5, 0xb2, 0xdf, 0xe8, 0xcb, 0x92, 0xb0,
-    0xba, 0xa5, 0x92, 0xa5, 0x92, 0x9c, 0x94, 0x88, 0xb5, 0xe7, 0xe7, 0xdf,
-    0x92, 0xa5, 0xb8, 0xdf, 0xe7, 0xbd, 0xb6, 0xd2, 0xdf, 0xdf, 0xb5, 0x92,
-    0xa5, 0xa5, 0xb6, 0xa5, 0x94, 0x94, 0xa5, 0xc0, 0xc0, 0xba, 0xba, 0xb0,
-    0x92, 0xa5, 0xb4, 0xe7, 0xe7, 0xbd, 0x92, 0x92, 0xa2, 0xa9, 0x92, 0xa9,
-    0xa9, 0xdf, 0xe7, 0xc9, 0x8e, 0xae, 0xe8, 0xe8, 0xd2, 0x7a, 0xa2, 0x9c,
-    0x92, 0x9c, 0x99, 0x94, 0xa9, 0x9c, 0x6e, 0x74, 0x74, 0x74, 0x9c, 0xc5,
-    0xe8, 0xdf, 0x9e, 0x8c, 0x81, 0x65, 0x65, 0x81, 0x74, 0x74, 0x69, 0x69,
-    0x65, 0x65, 0x5a, 0x70, 0x9f, 0xab, 0x84, 0xa6, 0xcb, 0xd5, 0xd5, 0x65,
-    0x57, 0xdd, 0xe5, 0xd9, 0xb7, 0x4e, 0x91, 0x9f, 0x91, 0x7f, 0x85, 0x48,
-    0x4e, 0x56, 0x48, 0x5d, 0x3a, 0x33, 0x48, 0x58, 0x58, 0xc6, 0xdc, 0xc6,
-    0x3a, 0x4d, 0x43, 0x3b, 0xb7, 0xe0, 0xe0, 0xcf, 0xc3, 0xa8, 0x47, 0x47,
-    0x3a, 0x47, 0x1d, 0x47, 0x52, 0x28, 0x1d, 0x28, 0x12, 0x28, 0x5f, 0x6f,
-    0xda, 0xd4, 0xd4, 0xcf, 0xce, 0xc3, 0xce, 0xd7, 0xc2, 0x0e, 0x08, 0x08,
-    0x11, 0x09, 0x07, 0x14, 0x4f, 0x2e, 0x80, 0xce, 0xce, 0xc3, 0xce, 0xcf,
-    0xda, 0xda, 0xce, 0x80, 0x08, 0x0c, 0x3f, 0x2e, 0x0f, 0x2e, 0x0a, 0x08,
-    0x11, 0x08, 0x08, 0x17, 0x07, 0x02, 0x0f, 0x1b, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x00, 0x08, 0x0e, 0x0a, 0x08, 0x0f, 0x08, 0x00, 0x08, 0x13, 0x25, 0x18,
-    0x14, 0x2b, 0x4b, 0x61, 0x40, 0x2b, 0x18, 0x1e, 0x28, 0x28, 0xa8, 0xd3,
-    0xd3, 0xca, 0xc3, 0xbb, 0xc3, 0xc3, 0xc3, 0xc2, 0xd0, 0xc2, 0xbb, 0xc2,
-    0xc2, 0xca, 0xc6, 0xbb, 0x83, 0x12, 0x49, 0xe0, 0xe0, 0xa8, 0x5b, 0x5b,
-    0x75, 0x6a, 0x44, 0x5f, 0x7b, 0x6c, 0x5d, 0x41, 0x48, 0x58, 0xd9, 0xd9,
-    0xc2, 0x6c, 0x7c, 0xe3, 0xdd, 0xa6, 0x34, 0x34, 0x5b, 0xa7, 0x91, 0x56,
-    0x48, 0x4e, 0x4e, 0x60, 0x77, 0x54, 0xd9, 0xdf, 0xc9, 0x84, 0x73, 0xdd,
-    0xdd, 0xd9, 0xab, 0xaf, 0x99, 0x69, 0x74, 0x98, 0x74, 0x74, 0x8e, 0x7a,
-    0xab, 0x9b, 0xd9, 0xe8, 0xe5, 0x94, 0x9c, 0xe8, 0xe8, 0xc5, 0x6e, 0x82,
-    0xb4, 0xb4, 0x74, 0x81, 0x7a, 0x6e, 0xa9, 0xbc, 0xad, 0x9e, 0xe8, 0xeb,
-    0xcc, 0xa9, 0xd2, 0xeb, 0xeb, 0xb0, 0x92, 0x92, 0x92, 0xa5, 0xa5, 0x92,
-    0xae, 0xba, 0xb8, 0x92, 0x92, 0xd2, 0xe7, 0xe7, 0xba, 0xb6, 0xb8, 0xe7,
-    0xe7, 0xb5, 0xa5, 0xd5, 0xe7, 0xe2, 0x92, 0xa5, 0xa5, 0xb0, 0xa5, 0xa4,
-    0xae, 0xb6, 0xc0, 0xb6, 0xae, 0x92, 0xb0, 0xb6, 0xa4, 0xa5, 0xac, 0xe7,
-    0xe7, 0xb5, 0xa4, 0x92, 0xae, 0xa5, 0xb6, 0xc0, 0xa4, 0xdf, 0xe7, 0xcb,
-    0xba, 0xae, 0xdf, 0xdf, 0xdf, 0xd5, 0xe2, 0xe2, 0xd5, 0xd2, 0xe2, 0xdd,
-    0xd8, 0xd9, 0xd8, 0xd8, 0xd5, 0xd2, 0xd2, 0xd2, 0xdf, 0xe8, 0x9e, 0x94,
-    0x9c, 0x9c, 0x8e, 0x9e, 0xbd, 0xcb, 0xcb, 0xd5, 0xd5, 0xd9, 0xcb, 0xc6,
-    0xcb, 0xcb, 0xcb, 0xc9, 0xd9, 0xdd, 0xdd, 0x7c, 0x8e, 0xe5, 0xe3, 0xc6,
-    0x9d, 0x9f, 0x9f, 0x7f, 0x4e, 0x5e, 0x70, 0x5e, 0x70, 0x5d, 0x60, 0x86,
-    0x78, 0x5d, 0x3e, 0x56, 0x5b, 0xd9, 0xe3, 0xc6, 0x32, 0x3a, 0xb7, 0xe0,
-    0xe0, 0xd7, 0xcf, 0xa8, 0x23, 0x7d, 0x97, 0x52, 0x36, 0x58, 0x75, 0x8a,
-    0x47, 0x4d, 0x67, 0x5f, 0x58, 0x2e, 0x12, 0x3b, 0xd4, 0xd0, 0xd4, 0xd4,
-    0xda, 0xd4, 0xd7, 0xce, 0xb3, 0x06, 0x1e, 0x4f, 0x61, 0x1e, 0x00, 0x08,
-    0x11, 0x0a, 0x80, 0xce, 0xce, 0xd3, 0xce, 0xd0, 0xdc, 0xd0, 0xce, 0x87,
-    0x4b, 0x35, 0x1b, 0x11, 0x0a, 0x11, 0x11, 0x1e, 0x1e, 0x18, 0x11, 0x1e,
-    0x0a, 0x08, 0x0f, 0x17, 0x11, 0x2b, 0x4f, 0x11, 0x29, 0x18, 0x07, 0x0e,
-    0x13, 0x08, 0x00, 0x08, 0x13, 0x00, 0x00, 0x08, 0x08, 0x11, 0x1e, 0x1e,
-    0x0a, 0x0a, 0x06, 0x08, 0x17, 0x0e, 0xa8, 0xd4, 0xd0, 0xce, 0xcd, 0xce,
-    0xd4, 0xda, 0xd3, 0xce, 0xce, 0xcf, 0xdc, 0xdc, 0xd4, 0xcf, 0xd4, 0xd7,
-    0xdb, 0x63, 0x6f, 0xd7, 0xd4, 0xa8, 0x52, 0x2f, 0x1f, 0x1d, 0x36, 0x58,
-    0x75, 0x56, 0x3a, 0x34, 0x33, 0x3a, 0xd7, 0xd7, 0xc2, 0x50, 0x87, 0xdd,
-    0xe3, 0xb7, 0x70, 0xa7, 0x4e, 0x51, 0x56, 0x70, 0x7f, 0x4e, 0x4e, 0x70,
-    0x5e, 0x54, 0xd9, 0xdd, 0xc9, 0x54, 0x57, 0xd5, 0xe5, 0xd5, 0x81, 0x73,
-    0x65, 0x65, 0x70, 0x64, 0x64, 0x45, 0x8e, 0xab, 0x65, 0x65, 0xcb, 0xe8,
-    0xe8, 0x9b, 0x6e, 0xdf, 0xe2, 0xc1, 0xae, 0x92, 0x81, 0x8e, 0x9c, 0xa2,
-    0xae, 0x92, 0x94, 0x94, 0x99, 0x94, 0xe7, 0xe7, 0xb5, 0x7a, 0xd2, 0xe8,
-    0xe8, 0xb5, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xa5, 0xa5, 0xb6,
-    0xa5, 0xdf, 0xeb, 0xe2, 0x9c, 0xa2, 0xb8, 0xeb, 0xe7, 0xb5, 0x92, 0xd2,
-    0xe7, 0xe7, 0xd2, 0xb5, 0xa5, 0xa5, 0x92, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5,
-    0xa5, 0x92, 0x8c, 0x92, 0x94, 0x9c, 0xac, 0xe7, 0xe2, 0xb5, 0x92, 0xba,
-    0xb0, 0x92, 0x88, 0x94, 0xa5, 0xe7, 0xe7, 0xc5, 0x82, 0x92, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xe2, 0xdf, 0xdf, 0xe5, 0xe8, 0xe8,
-    0xe7, 0xdf, 0xe2, 0xdf, 0xdf, 0xe2, 0x9e, 0x6e, 0x94, 0x94, 0xd9, 0xe8,
-    0xe8, 0xe6, 0xe6, 0xdd, 0xe2, 0xdd, 0xe9, 0xe6, 0xdd, 0xdf, 0xdd, 0xe5,
-    0xdd, 0xdd, 0xdd, 0x65, 0x54, 0xd5, 0xdd, 0xbd, 0x70, 0x70, 0x79, 0x50,
-    0x54, 0x48, 0x45, 0x48, 0x27, 0x70, 0x70, 0x3a, 0x3e, 0x3e, 0x6c, 0x78,
-    0x56, 0xc6, 0xd9, 0xcf, 0xb7, 0xdd, 0xdd, 0xd7, 0xd7, 0xb7, 0x63, 0x63,
-    0x4d, 0x33, 0x36, 0x31, 0x33, 0x1f, 0x26, 0x14, 0x18, 0x3c, 0x53, 0x4d,
-    0x1a, 0x1f, 0x1a, 0x3b, 0xa8, 0x80, 0x7d, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0x87, 0x52, 0x28, 0x1d, 0x13, 0x1e, 0x40, 0x13, 0x06, 0x09, 0x3b, 0x80,
-    0x55, 0x80, 0x80, 0x55, 0x80, 0x3b, 0x80, 0x23, 0x1b, 0x17, 0x0f, 0x07,
-    0x05, 0x0f, 0x03, 0x08, 0x0a, 0x1b, 0x00, 0x08, 0x00, 0x11, 0x28, 0x1c,
-    0x08, 0x00, 0x0a, 0x13, 0x0f, 0x0a, 0x08, 0x11, 0x1e, 0x0e, 0x00, 0x00,
-    0x11, 0x14, 0x35, 0x18, 0x08, 0x0a, 0x0e, 0x0a, 0x08, 0x0e, 0x1d, 0x2e,
-    0x14, 0x5c, 0xc2, 0xce, 0xce, 0xca, 0xa8, 0xa8, 0x80, 0xa8, 0xc2, 0xbb,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xbb, 0xbb, 0xa8, 0xa8, 0x71, 0x2f, 0x87, 0xd7,
-    0xcf, 0xa8, 0x3a, 0x2f, 0x48, 0x36, 0x1a, 0x27, 0x1a, 0x26, 0x26, 0x3e,
-    0x89, 0x85, 0xd9, 0xdd, 0xca, 0x34, 0x7c, 0xd9, 0xdd, 0xb7, 0x79, 0x78,
-    0x7f, 0x93, 0x5e, 0x50, 0x4e, 0x41, 0x70, 0xa0, 0x90, 0x4e, 0xd5, 0xdf,
-    0xc9, 0x8e, 0x95, 0xd5, 0xdf, 0xd9, 0x73, 0x5e, 0x60, 0x65, 0x91, 0x91,
-    0xaf, 0xb1, 0x8e, 0x65, 0x84, 0x8c, 0xd5, 0xe5, 0xdf, 0xab, 0xb4, 0xe8,
-    0xe8, 0xc1, 0x8b, 0x98, 0xad, 0xaa, 0x98, 0x88, 0x88, 0xa2, 0x9c, 0x84,
-    0x74, 0xa9, 0xe8, 0xe7, 0xbd, 0x88, 0xd2, 0xe7, 0xdf, 0x9e, 0x92, 0xa5,
-    0xb0, 0xa5, 0xa4, 0xb0, 0x92, 0x8d, 0x8d, 0x92, 0xb6, 0xe2, 0xe7, 0xe2,
-    0xba, 0xae, 0xab, 0xe7, 0xe7, 0xb5, 0xb6, 0xb0, 0xe7, 0xe7, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xdf, 0xe7, 0xd5, 0xad, 0xba,
-    0xc0, 0xb0, 0xab, 0xe7, 0xe8, 0xbd, 0xa2, 0x8d, 0xa5, 0xb6, 0xba, 0xa5,
-    0xa5, 0xdf, 0xe7, 0xcb, 0xae, 0x88, 0xe7, 0xe7, 0xdf, 0xc5, 0xc5, 0xbd,
-    0xbd, 0xcb, 0xcb, 0xc9, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc5, 0xe2,
-    0xe8, 0xdf, 0xb9, 0x8e, 0x84, 0xdf, 0xe2, 0xe8, 0xe8, 0xd8, 0xc9, 0xc9,
-    0xc9, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc9, 0xbd, 0xcb, 0xdd, 0xdd, 0x73,
-    0x91, 0xe3, 0xdd, 0xc9, 0x79, 0x70, 0x54, 0x48, 0x4e, 0x5d, 0x60, 0xa0,
-    0xa0, 0x5b, 0x41, 0x4e, 0x5e, 0x5b, 0x3a, 0x48, 0x85, 0xdc, 0xdc, 0xd9,
-    0xd9, 0xd9, 0xd9, 0xc2, 0x3a, 0x3a, 0x48, 0x48, 0x48, 0x33, 0x10, 0x31,
-    0x47, 0x26, 0x47, 0x1d, 0x06, 0x14, 0x12, 0x11, 0x06, 0x1a, 0x67, 0x6f,
-    0xd0, 0xd4, 0xcf, 0xce, 0xce, 0xc3, 0xcf, 0xdc, 0xc6, 0x1d, 0x2e, 0x2e,
-    0x17, 0x0a, 0x14, 0x0d, 0x0b, 0x26, 0x38, 0x0e, 0x01, 0x00, 0x13, 0x12,
-    0x28, 0x0e, 0x08, 0x0e, 0x0f, 0x0a, 0x08, 0x03, 0x07, 0x0c, 0x35, 0x4b,
-    0x1b, 0x02, 0x0e, 0x17, 0x0a, 0x0e, 0x08, 0x14, 0x2e, 0x2b, 0x0a, 0x0d,
-    0x0e, 0x00, 0x00, 0x08, 0x08, 0x11, 0x4f, 0x0a, 0x00, 0x0f, 0x1c, 0x17,
-    0x08, 0x0a, 0x14, 0x0e, 0x0a, 0x0f, 0x12, 0x11, 0x0a, 0x37, 0xbb, 0xd4,
-    0xdb, 0x8f, 0x14, 0x20, 0x28, 0x09, 0x25, 0x47, 0x4f, 0x25, 0x11, 0x28,
-    0x5f, 0x36, 0x53, 0x47, 0x26, 0x1a, 0x6b, 0xd4, 0xd7, 0x83, 0x3c, 0x63,
-    0x27, 0x4d, 0x58, 0x5f, 0x43, 0x43, 0x3a, 0x2f, 0x33, 0x33, 0xd9, 0xd9,
-    0xc2, 0x34, 0x71, 0xdd, 0xdd, 0xa6, 0x27, 0x33, 0x70, 0x70, 0x7f, 0x7f,
-    0x4e, 0x5e, 0x5e, 0x4e, 0x60, 0x9d, 0xdd, 0xdd, 0xbd, 0x50, 0x70, 0xd9,
-    0xdd, 0xd9, 0x79, 0x60, 0x5e, 0x91, 0x91, 0x57, 0x7f, 0x91, 0x84, 0x95,
-    0xac, 0x99, 0xd9, 0xe5, 0xe2, 0x6e, 0x99, 0xe8, 0xe8, 0xc1, 0x7a, 0x9c,
-    0x9c, 0xa2, 0x9c, 0x88, 0x7a, 0x88, 0x94, 0x94, 0x8c, 0x9e, 0xe8, 0xe7,
-    0xbd, 0xae, 0xd2, 0xe7, 0xe7, 0xb9, 0x88, 0x88, 0x9c, 0x92, 0xa5, 0xa5,
-    0x92, 0x88, 0xa5, 0xa5, 0xa5, 0xd2, 0xe2, 0xe2, 0xb0, 0xb6, 0xb8, 0xe7,
-    0xe7, 0xb5, 0x92, 0x92, 0xb6, 0xc5, 0xd2, 0xe7, 0xe7, 0xe8, 0xe7, 0xe7,
-    0xe7, 0xe8, 0xe7, 0xe7, 0xe7, 0xe7, 0xdf, 0xa2, 0xad, 0xae, 0xac, 0xeb,
-    0xeb, 0xbd, 0xba, 0x92, 0x82, 0x92, 0xba, 0xba, 0x92, 0xdf, 0xe7, 0xcb,
-    0xa5, 0xad, 0xe7, 0xe2, 0xd2, 0x9c, 0x9b, 0x99, 0x94, 0x94, 0x9c, 0x74,
-    0x9c, 0xa9, 0x94, 0x9c, 0x94, 0x6e, 0x69, 0xb5, 0xdf, 0xe2, 0x9e, 0x69,
-    0x9e, 0xe2, 0xe8, 0xc5, 0x65, 0x4e, 0x65, 0x99, 0x91, 0x99, 0x81, 0x65,
-    0x6e, 0x65, 0x5e, 0x84, 0xb7, 0xe5, 0xdf, 0x68, 0x5b, 0xe3, 0xdd, 0xc6,
-    0x70, 0x5e, 0x48, 0x56, 0x85, 0x56, 0x48, 0x6c, 0x8a, 0x5b, 0x7f, 0x86,
-    0x5b, 0x6c, 0x5b, 0x3a, 0x33, 0xdc, 0xdd, 0xdd, 0xd9, 0xd9, 0xdc, 0x71,
-    0x58, 0x5b, 0x48, 0x2f, 0x2f, 0x3a, 0x31, 0x26, 0x31, 0x58, 0x12, 0x25,
-    0x4f, 0x47, 0x3c, 0x3c, 0x2e, 0x0d, 0x12, 0x23, 0xcf, 0xd3, 0xce, 0xce,
-    0xcf, 0xd4, 0xd7, 0xce, 0xb3, 0x06, 0x28, 0x31, 0x28, 0x25, 0x14, 0x11,
-    0x06, 0x11, 0x0e, 0x31, 0x35, 0x00, 0x00, 0x0e, 0x17, 0x0f, 0x08, 0x0f,
-    0x0f, 0x08, 0x03, 0x0f, 0x1b, 0x0f, 0x0c, 0x35, 0x1c, 0x1e, 0x2e, 0x18,
-    0x14, 0x11, 0x08, 0x0a, 0x1c, 0x37, 0x17, 0x00, 0x0d, 0x04, 0x08, 0x0a,
-    0x08, 0x37, 0x40, 0x35, 0x4b, 0x1b, 0x08, 0x0a, 0x37, 0x1e, 0x08, 0x08,
-    0x4f, 0x4f, 0x11, 0x38, 0x1e, 0x0a, 0xbb, 0xd4, 0xd4, 0x42, 0x00, 0x12,
-    0x28, 0x47, 0x14, 0x06, 0x25, 0x31, 0x31, 0x44, 0x4f, 0x44, 0x36, 0x12,
-    0x3a, 0x6c, 0x87, 0xdc, 0xdc, 0x87, 0x1a, 0x12, 0x2f, 0x66, 0x63, 0x5d,
-    0x5d, 0x66, 0x51, 0x5b, 0x4e, 0x3e, 0xd9, 0xdd, 0xca, 0x78, 0x71, 0xdd,
-    0xd9, 0xb7, 0x9a, 0x8a, 0x5d, 0x41, 0x70, 0x81, 0x60, 0x5d, 0x4e, 0x45,
-    0x7f, 0xa0, 0xe3, 0xe9, 0xc9, 0x4e, 0x5f, 0xd9, 0xe3, 0xd9, 0x4e, 0x90,
-    0xb1, 0x90, 0x91, 0x91, 0x65, 0x7f, 0x99, 0x8e, 0x54, 0x54, 0xd5, 0xe8,
-    0xe5, 0x8b, 0x73, 0xe2, 0xe8, 0xc1, 0x94, 0xab, 0x9c, 0x94, 0x7a, 0x82,
-    0xb4, 0xae, 0xae, 0xad, 0x9c, 0x94, 0xdf, 0xdf, 0xbd, 0xb8, 0xd2, 0xe7,
-    0xe8, 0xb5, 0xae, 0xa5, 0x88, 0x92, 0xa5, 0xa5, 0xba, 0xa5, 0xa5, 0x92,
-    0xa5, 0xe2, 0xeb, 0xe8, 0x92, 0xa5, 0xbc, 0xe7, 0xe7, 0xb9, 0x92, 0x92,
-    0xc0, 0xc0, 0xba, 0xb6, 0xa5, 0xa2, 0xa5, 0xba, 0xad, 0x92, 0xa2, 0xc0,
-    0xe5, 0xe7, 0xe7, 0xc5, 0x9c, 0xae, 0xbc, 0xe7, 0xdf, 0xb5, 0xa5, 0xa5,
-    0xb0, 0x9c, 0x9c, 0xa9, 0xa9, 0xdf, 0xe7, 0xcb, 0xae, 0x8d, 0xdf, 0xe7,
-    0xe2, 0xba, 0xb4, 0xab, 0x9c, 0x74, 0x69, 0x9c, 0xab, 0xb4, 0x9c, 0xa9,
-    0x9c, 0x94, 0xa2, 0xbd, 0xdf, 0xe2, 0x9e, 0x9c, 0xb5, 0xe8, 0xe5, 0x8f,
-    0x99, 0xaf, 0xac, 0x73, 0x7f, 0x99, 0x8e, 0x65, 0x73, 0x65, 0x54, 0x9f,
-    0xb9, 0xe9, 0xe5, 0x79, 0x5d, 0xdd, 0xe0, 0xc6, 0x5b, 0x3e, 0x93, 0x96,
-    0x78, 0x70, 0x78, 0x5b, 0x63, 0x78, 0x56, 0x33, 0x27, 0x45, 0x5d, 0x6c,
-    0x3e, 0xc6, 0xdd, 0xdc, 0xd7, 0xdd, 0xe0, 0xdc, 0xc9, 0x49, 0x2f, 0x8a,
-    0x5b, 0x58, 0x52, 0x3c, 0x28, 0x0d, 0x1f, 0x5f, 0x61, 0x5c, 0x44, 0x47,
-    0x47, 0x44, 0x26, 0x23, 0xd4, 0xd4, 0xd7, 0xdc, 0xd3, 0xd4, 0xcf, 0xcf,
-    0xd0, 0x4f, 0x1d, 0x17, 0x1e, 0x1e, 0x1e, 0x06, 0x17, 0x09, 0x11, 0x38,
-    0x46, 0x40, 0x1e, 0x0e, 0x00, 0x2b, 0x1c, 0x0a, 0x08, 0x0c, 0x4b, 0x1b,
-    0x17, 0x1c, 0x0f, 0x17, 0x1c, 0x1c, 0x0a, 0x00, 0x00, 0x18, 0x1e, 0x07,
-    0x00, 0x07, 0x0a, 0x0f, 0x00, 0x00, 0x00, 0x11, 0x28, 0x0a, 0x00, 0x2e,
-    0x55, 0x35, 0x1c, 0x1b, 0x1e, 0x1e, 0x1c, 0x17, 0x11, 0x08, 0x11, 0x1e,
-    0x07, 0x4f, 0xbb, 0xd3, 0xd0, 0x42, 0x38, 0x2e, 0x0e, 0x13, 0x1d, 0x25,
-    0x0d, 0x09, 0x31, 0x1e, 0x01, 0x01, 0x14, 0x38, 0x1a, 0x1a, 0x87, 0xda,
-    0xd4, 0x87, 0x58, 0x3a, 0x3c, 0x3a, 0x63, 0x48, 0x1d, 0x10, 0x26, 0x58,
-    0x5b, 0x33, 0xd7, 0xd9, 0xd0, 0x3a, 0x49, 0xd9, 0xdc, 0xb7, 0x75, 0x5d,
-    0x5b, 0x6c, 0x70, 0x60, 0x60, 0x4e, 0x4e, 0x81, 0x65, 0x3e, 0xdf, 0xe9,
-    0xc9, 0x79, 0x84, 0xd9, 0xdd, 0xd8, 0x90, 0x5a, 0x70, 0x70, 0x81, 0x81,
-    0x74, 0xaf, 0x8e, 0x5a, 0x5a, 0x7a, 0xd5, 0xe5, 0xdf, 0x74, 0x9c, 0xdf,
-    0xdf, 0xb9, 0x95, 0x65, 0x54, 0x6e, 0x8c, 0x94, 0x7a, 0x94, 0xad, 0x9c,
-    0x8c, 0x9c, 0xe7, 0xe7, 0xbd, 0xae, 0xd2, 0xdf, 0xdf, 0x9e, 0x9c, 0xae,
-    0x8d, 0x88, 0x92, 0xa5, 0xa2, 0x94, 0x88, 0x94, 0xa5, 0xdf, 0xe8, 0xe2,
-    0xa2, 0xae, 0xbc, 0xe7, 0xe7, 0xb9, 0xb0, 0xb6, 0x88, 0x92, 0xbf, 0xbf,
-    0xba, 0xba, 0xba, 0xa9, 0xad, 0xba, 0xa5, 0xa5, 0x92, 0xe7, 0xe7, 0xc5,
-    0xc0, 0xb0, 0xab, 0xdf, 0xe8, 0xc5, 0xa5, 0x92, 0x92, 0xae, 0x92, 0x7a,
-    0x82, 0xdf, 0xe7, 0xbd, 0x6e, 0x92, 0xe7, 0xdf, 0xd5, 0xb4, 0x9c, 0x8c,
-    0x9c, 0xb4, 0x9b, 0x8c, 0x9c, 0x9c, 0x9c, 0x69, 0x65, 0x8c, 0x94, 0xbd,
-    0xdf, 0xdf, 0x9e, 0x74, 0x9e, 0xdf, 0xdf, 0x87, 0x9f, 0x9f, 0x91, 0x91,
-    0x91, 0x84, 0x81, 0x65, 0x57, 0x81, 0x99, 0x5a, 0x68, 0xe5, 0xe9, 0x91,
-    0x7f, 0xe3, 0xdd, 0xc6, 0x78, 0x70, 0x4e, 0x5b, 0x50, 0x70, 0x56, 0xa0,
-    0x96, 0x63, 0x4d, 0x3a, 0x5d, 0x86, 0x48, 0x3c, 0x5b, 0xdc, 0xd7, 0xbb,
-    0x34, 0xa6, 0xcf, 0xcf, 0xd7, 0xd9, 0xc2, 0x49, 0x5f, 0x52, 0x26, 0x3f,
-    0x47, 0x47, 0x26, 0x28, 0x3c, 0x44, 0x12, 0x00, 0x13, 0x38, 0x26, 0x3b,
-    0xce, 0xd0, 0xd4, 0xcf, 0xce, 0xce, 0xce, 0xd4, 0xd0, 0x31, 0x12, 0x2b,
-    0x17, 0x0e, 0x17, 0x08, 0x17, 0x38, 0x1e, 0x00, 0x13, 0x61, 0x4f, 0x17,
-    0x1c, 0x1b, 0x14, 0x17, 0x1c, 0x0f, 0x0f, 0x05, 0x0f, 0x00, 0x0a, 0x38,
-    0x11, 0x08, 0x08, 0x11, 0x17, 0x17, 0x0a, 0x00, 0x08, 0x03, 0x03, 0x03,
-    0x08, 0x0a, 0x2b, 0x25, 0x0a, 0x07, 0x08, 0x00, 0x07, 0x00, 0x11, 0x17,
-    0x00, 0x2e, 0x25, 0x40, 0x40, 0x06, 0x08, 0x09, 0x17, 0x1e, 0x83, 0xd3,
-    0xce, 0xbb, 0x3b, 0x17, 0x26, 0x12, 0x14, 0x31, 0x38, 0x14, 0x31, 0x5c,
-    0x47, 0x14, 0x1d, 0x52, 0x52, 0x28, 0x49, 0xd7, 0xcf, 0xb3, 0x23, 0x5b,
-    0x58, 0x28, 0x14, 0x0d, 0x52, 0x7b, 0x58, 0x27, 0x12, 0x83, 0xdd, 0xdd,
-    0xbb, 0x5d, 0x87, 0xe0, 0xe0, 0xc2, 0x66, 0x3e, 0x3e, 0x58, 0x34, 0x4e,
-    0x70, 0x91, 0x9d, 0x65, 0x4e, 0xbd, 0xdd, 0xd9, 0xb5, 0x70, 0x79, 0xd9,
-    0xe2, 0xd9, 0x9f, 0x94, 0x73, 0x65, 0x70, 0x69, 0x8e, 0x8e, 0x65, 0x65,
-    0x99, 0x8e, 0xd5, 0xe8, 0xdf, 0x6e, 0x94, 0xe5, 0xe5, 0xd5, 0xac, 0xab,
-    0x95, 0x7a, 0xa2, 0x9c, 0x99, 0x8c, 0x84, 0x74, 0x8e, 0xd5, 0xe7, 0xe8,
-    0xb9, 0x8b, 0xd2, 0xe2, 0xeb, 0xb9, 0x9c, 0x74, 0x88, 0xa2, 0xba, 0x92,
-    0x92, 0xa4, 0x92, 0xc0, 0xc0, 0xe2, 0xe7, 0xe7, 0x92, 0x92, 0xab, 0xe7,
-    0xe7, 0xc5, 0xb6, 0xa5, 0x92, 0xa5, 0x92, 0x8c, 0x92, 0xb6, 0x92, 0x92,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xc5, 0xe7, 0xe7, 0xc5, 0xa5, 0x92, 0xab, 0xe7,
-    0xe7, 0xb5, 0xad, 0xba, 0x92, 0xa5, 0xa9, 0x94, 0x9c, 0xe6, 0xeb, 0xc5,
-    0x82, 0x9c, 0xe8, 0xe7, 0xd5, 0x7a, 0x7a, 0x74, 0x69, 0x94, 0xb4, 0x9c,
-    0x7a, 0x69, 0x69, 0xad, 0xaa, 0x99, 0x6e, 0xb5, 0xe5, 0xe9, 0xa6, 0x6e,
-    0xa6, 0xe5, 0xe9, 0xd8, 0x91, 0x84, 0x77, 0x7f, 0x5a, 0x54, 0x81, 0x6e,
-    0x94, 0x9f, 0x5a, 0x5e, 0xc8, 0xdd, 0xd9, 0x6b, 0x70, 0xdd, 0xd9, 0xd9,
-    0x87, 0x91, 0x81, 0x4e, 0x56, 0x4e, 0x4e, 0x70, 0x4e, 0x33, 0x3e, 0x5d,
-    0x56, 0x4d, 0x78, 0x48, 0x3e, 0xdc, 0xdc, 0xc2, 0x3e, 0x66, 0x63, 0x87,
-    0xc6, 0xe0, 0xdc, 0xd7, 0xc2, 0x49, 0x2d, 0x12, 0x10, 0x43, 0x36, 0x18,
-    0x0a, 0x0e, 0x44, 0x61, 0x39, 0x14, 0x08, 0x3b, 0xda, 0xd7, 0xce, 0xd4,
-    0xd3, 0xd3, 0xda, 0xd3, 0xbb, 0x13, 0x0d, 0x0a, 0x08, 0x0e, 0x28, 0x28,
-    0x31, 0x14, 0x08, 0x08, 0x00, 0x03, 0x08, 0x08, 0x2e, 0x08, 0x17, 0x2e,
-    0x35, 0x46, 0x1b, 0x03, 0x05, 0x06, 0x13, 0x0c, 0x0e, 0x00, 0x08, 0x17,
-    0x17, 0x0e, 0x02, 0x00, 0x0a, 0x1c, 0x0f, 0x0f, 0x02, 0x06, 0x14, 0x0a,
-    0x00, 0x0a, 0x11, 0x08, 0x0a, 0x06, 0x03, 0x08, 0x0a, 0x4f, 0x18, 0x08,
-    0x0a, 0x12, 0x12, 0x0a, 0x38, 0x11, 0x1e, 0xda, 0xdc, 0xd4, 0xc3, 0xb3,
-    0x80, 0xa8, 0xa8, 0xa8, 0xbb, 0xa8, 0xa8, 0xa8, 0xbb, 0xc2, 0xb7, 0xb3,
-    0x7d, 0x67, 0x7b, 0xd9, 0xd7, 0xd7, 0xd0, 0xbb, 0xb7, 0xc2, 0xbb, 0xa8,
-    0xa8, 0xbb, 0xbb, 0xc6, 0xe0, 0xe0, 0xdd, 0xd9, 0x6b, 0x4e, 0x6b, 0xdc,
-    0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd9, 0xd7, 0xcb, 0xd9, 0xd9, 0xd9, 0xd9,
-    0xdd, 0xe5, 0xe2, 0xdd, 0x7c, 0x65, 0x60, 0xd9, 0xe9, 0xd9, 0x73, 0x64,
-    0x74, 0x6e, 0x74, 0x98, 0x99, 0x81, 0xaf, 0xab, 0x99, 0x84, 0xd5, 0xdf,
-    0xdf, 0x73, 0x84, 0xd9, 0xe6, 0xdf, 0xdf, 0xd5, 0xc9, 0xc9, 0xcb, 0xbd,
-    0xcb, 0xc9, 0xd8, 0xe2, 0xe5, 0xdf, 0xe2, 0xdf, 0xae, 0xad, 0xd2, 0xdf,
-    0xe7, 0xb5, 0x92, 0xba, 0xbc, 0xae, 0xa9, 0x92, 0xa4, 0x92, 0x92, 0x8c,
-    0x82, 0xd2, 0xe7, 0xdf, 0xb0, 0xb6, 0xb8, 0xe7, 0xe7, 0xb5, 0x88, 0xb9,
-    0xd5, 0xc5, 0xc5, 0xc5, 0xcb, 0xc5, 0xc5, 0xcb, 0xd5, 0xc5, 0xcb, 0xe2,
-    0xe7, 0xe7, 0xe7, 0xba, 0x92, 0xb6, 0xb8, 0xeb, 0xe7, 0xb5, 0x8b, 0x92,
-    0xa5, 0x82, 0xad, 0xae, 0x9c, 0xdf, 0xe2, 0xc5, 0xba, 0xad, 0xe8, 0xe7,
-    0xe2, 0xba, 0x92, 0x9c, 0x9c, 0x7a, 0x6e, 0xae, 0xad, 0x94, 0x8c, 0x7a,
-    0x99, 0x99, 0xab, 0xc9, 0xe9, 0xe5, 0xa6, 0x84, 0x99, 0xd9, 0xdd, 0xdd,
-    0xdd, 0xd1, 0xbd, 0xbd, 0xc9, 0xbd, 0xb5, 0xbd, 0xbd, 0xbd, 0xbd, 0xdd,
-    0xe3, 0xdd, 0xd9, 0x5e, 0x60, 0xbe, 0xdd, 0xe9, 0xdd, 0xd5, 0xc7, 0xb5,
-    0xbd, 0xbd, 0xc9, 0xb7, 0xb7, 0xca, 0xca, 0xb7, 0xb7, 0xb7, 0xbb, 0x56,
-    0x34, 0xd0, 0xe0, 0xc6, 0x1f, 0x26, 0x48, 0x8a, 0x75, 0xa6, 0xc6, 0xe0,
-    0xe0, 0xe0, 0xc6, 0x3b, 0x28, 0x0e, 0x3c, 0x5f, 0x47, 0x2e, 0x12, 0x1d,
-    0x1e, 0x31, 0x67, 0x6f, 0xdc, 0xd4, 0xce, 0xd4, 0xcf, 0xce, 0xce, 0xcd,
-    0xb3, 0x11, 0x13, 0x14, 0x1e, 0x08, 0x00, 0x0a, 0x1e, 0x08, 0x0e, 0x17,
-    0x0a, 0x0e, 0x0a, 0x02, 0x0c, 0x0f, 0x1e, 0x2e, 0x0f, 0x0a, 0x08, 0x0a,
-    0x0a, 0x17, 0x2b, 0x0a, 0x25, 0x35, 0x1e, 0x03, 0x03, 0x0a, 0x08, 0x00,
-    0x07, 0x17, 0x18, 0x03, 0x08, 0x07, 0x00, 0x0a, 0x11, 0x08, 0x0a, 0x1e,
-    0x31, 0x0a, 0x0e, 0x46, 0x44, 0x37, 0x12, 0x0a, 0x11, 0x18, 0x12, 0x06,
-    0x00, 0x0a, 0x0e, 0x3b, 0xbb, 0xd7, 0xdb, 0xdc, 0xcd, 0xd3, 0xd4, 0xd4,
-    0xcf, 0xcf, 0xdc, 0xdc, 0xd4, 0xdc, 0xd7, 0xcf, 0xdc, 0x3c, 0x31, 0x43,
-    0xc8, 0xe0, 0xe0, 0xe0, 0xd7, 0xd7, 0xdc, 0xe0, 0xe0, 0xe0, 0xdc, 0xdc,
-    0xe0, 0xe0, 0xc6, 0x42, 0x3e, 0x2f, 0x6b, 0xe3, 0xe0, 0xe3, 0xe0, 0xdd,
-    0xe3, 0xdd, 0xe3, 0xdd, 0xdd, 0xd9, 0xdd, 0xe2, 0xdd, 0xdd, 0xd9, 0xa6,
-    0x91, 0x70, 0x84, 0xe3, 0xe9, 0xd9, 0x81, 0x70, 0x73, 0x8e, 0x64, 0x64,
-    0x57, 0x57, 0x8e, 0x84, 0x5a, 0x99, 0xe2, 0xdf, 0xe2, 0x9c, 0x99, 0x7a,
-    0xbd, 0xe2, 0xe8, 0xdf, 0xe8, 0xe8, 0xdf, 0xe8, 0xe8, 0xe2, 0xe8, 0xe8,
-    0xeb, 0xec, 0xd5, 0xa2, 0x9c, 0xa2, 0xd2, 0xec, 0xeb, 0xb9, 0xa9, 0xba,
-    0xb8, 0x9c, 0x82, 0x92, 0x92, 0x82, 0xb6, 0xba, 0xae, 0xe8, 0xe8, 0xe8,
-    0x92, 0xa4, 0xbd, 0xe7, 0xe7, 0xb5, 0xb0, 0xd5, 0xe7, 0xe7, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xe7, 0xec, 0xe7, 0xe7, 0xe7, 0xe7, 0xdf, 0xb5, 0x88,
-    0x8d, 0x92, 0xaf, 0xdf, 0xe8, 0xc5, 0xa4, 0x8d, 0xa4, 0xae, 0x8d, 0x82,
-    0x9c, 0xe7, 0xe7, 0xc5, 0xae, 0x94, 0xe2, 0xe7, 0xdf, 0xa9, 0xa5, 0xae,
-    0xba, 0xba, 0xad, 0x9c, 0x94, 0xb4, 0xbc, 0xbc, 0xab, 0x99, 0xaf, 0xc9,
-    0xe5, 0xdf, 0x9e, 0x8e, 0x65, 0x74, 0xd8, 0xe2, 0xec, 0xe9, 0xe5, 0xe2,
-    0xdd, 0xe5, 0xe2, 0xdf, 0xdf, 0xdf, 0xdd, 0xdd, 0xdd, 0xd9, 0x9f, 0x65,
-    0x5e, 0x96, 0xd7, 0xe3, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd5, 0xd9, 0xd9,
-    0xd7, 0xdd, 0xdc, 0xd7, 0xe0, 0xe3, 0xd9, 0xa8, 0x6c, 0xd9, 0xdc, 0xc6,
-    0x66, 0x3e, 0x34, 0x56, 0x34, 0x18, 0x6a, 0xa6, 0xd0, 0xdc, 0xdc, 0xe0,
-    0x97, 0x52, 0x31, 0x3c, 0x3a, 0x7b, 0x7d, 0x61, 0x37, 0x31, 0x5c, 0x6f,
-    0xcf, 0xce, 0xcf, 0xce, 0xce, 0xdc, 0xdc, 0xd4, 0xd0, 0x1e, 0x13, 0x18,
-    0x18, 0x11, 0x0a, 0x00, 0x06, 0x1e, 0x11, 0x0e, 0x17, 0x38, 0x2b, 0x08,
-    0x17, 0x37, 0x38, 0x14, 0x0a, 0x08, 0x08, 0x0a, 0x0a, 0x00, 0x02, 0x08,
-    0x0a, 0x17, 0x03, 0x11, 0x1c, 0x0f, 0x08, 0x0f, 0x17, 0x0f, 0x08, 0x0f,
-    0x01, 0x08, 0x0f, 0x40, 0x61, 0x4f, 0x13, 0x01, 0x0d, 0x13, 0x0f, 0x0f,
-    0x1e, 0x17, 0x13, 0x25, 0x4f, 0x38, 0x11, 0x18, 0x2e, 0x5f, 0x4f, 0x08,
-    0x00, 0x3b, 0x6b, 0xa8, 0xbb, 0xa8, 0xa8, 0xa8, 0xbb, 0xb7, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xbb, 0xbb, 0x49, 0x26, 0x26, 0x1d, 0x26, 0x49, 0x83, 0xc2,
-    0xb7, 0xbb, 0xbb, 0xa8, 0xbb, 0xca, 0xca, 0xa8, 0x6b, 0x49, 0x33, 0x58,
-    0x75, 0x85, 0x6b, 0xdd, 0xe3, 0xc6, 0x87, 0xa6, 0xb7, 0xb7, 0xa6, 0xa6,
-    0xa6, 0xa6, 0xb7, 0xca, 0xa3, 0x91, 0x4e, 0x5e, 0x91, 0x70, 0x4a, 0x7c,
-    0xbd, 0x9e, 0x91, 0x9d, 0xac, 0x81, 0x81, 0x8e, 0xab, 0xb4, 0x74, 0x54,
-    0x65, 0x8e, 0x9e, 0xcb, 0xb5, 0x8e, 0x69, 0x84, 0x9c, 0x9c, 0x9e, 0xb5,
-    0xbd, 0xcb, 0xcb, 0xc5, 0xbd, 0xcb, 0xcb, 0xc5, 0x9e, 0x9c, 0xae, 0xad,
-    0x92, 0x92, 0x92, 0xcb, 0xc5, 0xbc, 0xae, 0x94, 0x8b, 0x94, 0x9c, 0xa5,
-    0xb6, 0xa4, 0x92, 0xc0, 0xb0, 0x9e, 0xcb, 0xc5, 0xba, 0xba, 0xa5, 0xc5,
-    0xc5, 0xb0, 0xbf, 0xc0, 0xd2, 0xcb, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5,
-    0xcb, 0xc5, 0xd5, 0xc5, 0xb9, 0xa4, 0xa5, 0xb6, 0xbf, 0xba, 0x88, 0xbd,
-    0xcb, 0xa5, 0xae, 0xb0, 0xa5, 0x9c, 0x82, 0xae, 0xba, 0xc5, 0xc5, 0xa4,
-    0xad, 0xb8, 0x9e, 0xcb, 0xb5, 0x88, 0x94, 0x94, 0x88, 0xa2, 0xa5, 0x9c,
-    0x9c, 0x98, 0x99, 0x99, 0xb4, 0xad, 0x8c, 0x6e, 0xbd, 0xbd, 0x7a, 0x9c,
-    0xa2, 0x8b, 0xa2, 0xbe, 0xb9, 0xbd, 0xc9, 0xc9, 0xc6, 0xbd, 0xc9, 0xbd,
-    0xbd, 0xc9, 0xc9, 0xca, 0xa6, 0x4a, 0x70, 0x73, 0x6c, 0x3e, 0x5d, 0x7c,
-    0xa6, 0xb7, 0xca, 0xc6, 0xbd, 0xb5, 0xbd, 0xca, 0xca, 0xb7, 0xa0, 0xbb,
-    0xb7, 0xb7, 0xb7, 0x4e, 0x3a, 0x83, 0xbb, 0x87, 0x48, 0x2f, 0x48, 0x58,
-    0x66, 0x58, 0x26, 0x3a, 0x4d, 0x6b, 0xbb, 0xa8, 0x31, 0x67, 0x66, 0x26,
-    0x2d, 0x2e, 0x28, 0x5c, 0x61, 0x31, 0x11, 0x23, 0xd0, 0xcf, 0xd3, 0xdc,
-    0xd3, 0xd3, 0xe0, 0xe0, 0xc2, 0x2e, 0x40, 0x40, 0x18, 0x11, 0x11, 0x0a,
-    0x28, 0x61, 0x61, 0x2e, 0x00, 0x08, 0x1e, 0x13, 0x08, 0x0f, 0x17, 0x0e,
-    0x04, 0x28, 0x38, 0x11, 0x08, 0x04, 0x2b, 0x38, 0x1e, 0x00, 0x02, 0x0e,
-    0x1c, 0x1c, 0x0f, 0x0a, 0x0f, 0x08, 0x1e, 0x18, 0x1c, 0x37, 0x17, 0x0f,
-    0x0f, 0x1c, 0x1e, 0x02, 0x00, 0x13, 0x1e, 0x0a, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x17, 0x2e, 0x17, 0x29, 0x40, 0x17, 0x08, 0x37, 0x17, 0x0a, 0x09,
-    0x06, 0x0b, 0x28, 0x4c, 0x47, 0x28, 0x1d, 0x38, 0x33, 0x14, 0x31, 0x43,
-    0x43, 0x28, 0x0d, 0x12, 0x14, 0x28, 0x28, 0x12, 0x10, 0x27, 0x2f, 0x3c,
-    0x3c, 0x3a, 0x3c, 0x47, 0x63, 0x56, 0x5d, 0x78, 0x78, 0x89, 0x7c, 0xe0,
-    0xd9, 0xa6, 0x5b, 0x96, 0x6c, 0x86, 0x85, 0x5e, 0x96, 0x91, 0x70, 0x4a,
-    0x70, 0x90, 0x5b, 0x48, 0x50, 0x91, 0x65, 0x4e, 0x54, 0x45, 0x45, 0x65,
-    0x81, 0x99, 0x8e, 0x8e, 0x8e, 0x81, 0x57, 0x64, 0x9c, 0x6e, 0x73, 0x84,
-    0x81, 0x84, 0x94, 0xa9, 0x9c, 0x8b, 0x7a, 0x94, 0x82, 0x82, 0xa9, 0x9c,
-    0x94, 0x6e, 0x7a, 0x82, 0x7a, 0x8b, 0x82, 0x82, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x92, 0x9c, 0x94, 0xa5, 0xa5, 0xa5, 0xa4, 0xb0, 0xba, 0xba, 0xb6, 0x9c,
-    0x9c, 0xad, 0xbc, 0xba, 0xb8, 0xba, 0xae, 0xb0, 0xba, 0xb6, 0x92, 0xa5,
-    0xba, 0xb0, 0x92, 0x8d, 0xb6, 0xb6, 0x92, 0x92, 0x88, 0x8b, 0x92, 0xa5,
-    0xb0, 0xb0, 0xae, 0xa5, 0xae, 0x82, 0x94, 0xad, 0xa5, 0x82, 0x88, 0x9c,
-    0x8d, 0xae, 0xba, 0xb0, 0x92, 0x92, 0xa4, 0xa4, 0x8d, 0xae, 0x92, 0xa9,
-    0x82, 0x8c, 0x8b, 0x7a, 0x82, 0x7a, 0x6e, 0x7a, 0x8b, 0x8b, 0x7a, 0x8b,
-    0x8c, 0x6e, 0x99, 0x99, 0x94, 0x9c, 0x9c, 0x9b, 0xab, 0xab, 0x73, 0x81,
-    0x73, 0xac, 0xac, 0x91, 0x9f, 0x91, 0x84, 0x99, 0x99, 0x5a, 0x5e, 0x90,
-    0x84, 0x4e, 0x34, 0x6c, 0x9f, 0x60, 0x50, 0x4e, 0x3a, 0x3e, 0x5e, 0x5e,
-    0x70, 0x79, 0x4e, 0x5e, 0x3e, 0x1f, 0x5d, 0x78, 0x3e, 0x34, 0x48, 0x3a,
-    0x58, 0x66, 0x72, 0x58, 0x3e, 0x58, 0x45, 0x3a, 0x3a, 0x56, 0x3e, 0x33,
-    0x12, 0x1a, 0x1d, 0x1f, 0x1d, 0x06, 0x09, 0x26, 0x3c, 0x1a, 0x28, 0x26,
-    0x1f, 0x28, 0x47, 0x59, 0xd0, 0xd4, 0xd4, 0xda, 0xda, 0xd0, 0xcf, 0xc3,
-    0xc2, 0x4f, 0x1e, 0x4f, 0x31, 0x14, 0x40, 0x40, 0x1e, 0x17, 0x0e, 0x1e,
-    0x08, 0x00, 0x00, 0x19, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11,
-    0x0f, 0x05, 0x1b, 0x1c, 0x00, 0x0a, 0x11, 0x03, 0x04, 0x08, 0x08, 0x08,
-    0x25, 0x38, 0x1e, 0x0a, 0x05, 0x07, 0x0a, 0x02, 0x02, 0x03, 0x0c, 0x40,
-    0x1e, 0x00, 0x17, 0x61, 0x14, 0x08, 0x28, 0x17, 0x13, 0x14, 0x17, 0x17,
-    0x17, 0x0a, 0x2e, 0x7d, 0x8a, 0x3c, 0x1d, 0x31, 0x25, 0x4c, 0x61, 0x38,
-    0x4f, 0x5f, 0x61, 0x61, 0x26, 0x26, 0x0d, 0x26, 0x26, 0x1f, 0x1d, 0x3c,
-    0x3c, 0x26, 0x26, 0x47, 0x28, 0x3e, 0x63, 0x3a, 0x36, 0x33, 0x58, 0x72,
-    0x66, 0x58, 0x48, 0x4e, 0x4e, 0x5b, 0x6b, 0xdc, 0xd7, 0xa6, 0x6c, 0x5d,
-    0x5b, 0x5d, 0x56, 0x48, 0x57, 0x50, 0x45, 0x4e, 0x56, 0x5d, 0x9f, 0xa0,
-    0x70, 0x70, 0x99, 0x84, 0x4e, 0x90, 0x9f, 0x73, 0x73, 0x65, 0x65, 0x84,
-    0x73, 0x69, 0xab, 0xbc, 0xab, 0x95, 0x99, 0x99, 0x99, 0xab, 0x9c, 0xa9,
-    0xb4, 0xa9, 0xae, 0x94, 0x82, 0x6e, 0x7a, 0x9c, 0x82, 0x94, 0x9c, 0xa9,
-    0x9b, 0x9c, 0x92, 0x9c, 0x9c, 0xb8, 0x92, 0x9c, 0x94, 0x92, 0xb8, 0xb8,
-    0xa5, 0x92, 0xa5, 0xa5, 0x92, 0xa5, 0xa5, 0x82, 0x94, 0xa4, 0xae, 0xa9,
-    0xa9, 0xae, 0x9c, 0xa5, 0xa4, 0xa4, 0x92, 0xa2, 0x8d, 0xb0, 0xc0, 0xb0,
-    0x92, 0xb6, 0xc0, 0x92, 0xa5, 0xc0, 0xb6, 0xb0, 0xa5, 0x92, 0xa5, 0xae,
-    0x9c, 0xad, 0xc0, 0xbf, 0xa4, 0xa5, 0xb0, 0xa9, 0xbc, 0xbc, 0xb8, 0xbc,
-    0xba, 0xae, 0xae, 0xa9, 0x94, 0x74, 0x92, 0x92, 0x9c, 0xa2, 0xad, 0x8d,
-    0x9c, 0x94, 0x9b, 0x8b, 0xad, 0xa2, 0x88, 0x7a, 0x94, 0x9c, 0xab, 0x9b,
-    0x8e, 0x74, 0x94, 0x7a, 0x6e, 0x6e, 0x73, 0x54, 0x84, 0x95, 0x84, 0x65,
-    0x73, 0x65, 0x70, 0x84, 0x60, 0x5e, 0x70, 0x4e, 0x70, 0xaf, 0x95, 0x4e,
-    0x70, 0x9f, 0x79, 0x4e, 0x91, 0x79, 0x6c, 0x4e, 0x4d, 0x56, 0x5e, 0x4e,
-    0x56, 0x9a, 0xa7, 0x85, 0x4e, 0x79, 0x56, 0x6a, 0x96, 0x86, 0x85, 0x85,
-    0x78, 0x6c, 0x56, 0x3e, 0x1a, 0x33, 0x33, 0x27, 0x2f, 0x3a, 0x2f, 0x31,
-    0x26, 0x47, 0x28, 0x3a, 0x5f, 0x33, 0x12, 0x28, 0x2f, 0x58, 0x4f, 0x3b,
-    0xa8, 0xa8, 0xa8, 0x80, 0xa8, 0xa8, 0x80, 0x80, 0x83, 0x18, 0x11, 0x28,
-    0x1e, 0x0e, 0x12, 0x08, 0x08, 0x00, 0x08, 0x0a, 0x25, 0x3d, 0x0e, 0x00,
-    0x35, 0x4c, 0x02, 0x1e, 0x1e, 0x08, 0x0e, 0x08, 0x0f, 0x1b, 0x05, 0x05,
-    0x37, 0x61, 0x40, 0x0a, 0x1e, 0x1c, 0x1e, 0x1c, 0x18, 0x2e, 0x25, 0x37,
-    0x03, 0x0a, 0x46, 0x1c, 0x17, 0x2e, 0x1c, 0x35, 0x1e, 0x06, 0x2b, 0x25,
-    0x0a, 0x17, 0x1e, 0x08, 0x00, 0x06, 0x17, 0x17, 0x08, 0x0e, 0x2e, 0x26,
-    0x0e, 0x06, 0x40, 0x4f, 0x3c, 0x1d, 0x0a, 0x06, 0x06, 0x09, 0x12, 0x1e,
-    0x14, 0x3c, 0x75, 0x36, 0x47, 0x7b, 0x7b, 0x52, 0x47, 0x3c, 0x1f, 0x3a,
-    0x4d, 0x3c, 0x52, 0x3a, 0x33, 0x58, 0x56, 0x1f, 0x12, 0x58, 0x60, 0x48,
-    0x3e, 0x56, 0x4e, 0x87, 0x87, 0x7f, 0x85, 0x86, 0x4a, 0x56, 0x5e, 0x41,
-    0x45, 0x91, 0x96, 0x70, 0x90, 0x91, 0x91, 0x91, 0x65, 0x65, 0x91, 0x7f,
-    0x54, 0x91, 0x65, 0x60, 0x60, 0x6e, 0x73, 0x70, 0x65, 0x8e, 0x98, 0x65,
-    0x54, 0x84, 0xaf, 0x9c, 0x94, 0x7a, 0x74, 0x69, 0x69, 0x74, 0x94, 0x74,
-    0x7a, 0xb8, 0xa9, 0x9b, 0xb4, 0xbc, 0xb8, 0x9c, 0x9c, 0x82, 0x9c, 0x92,
-    0x94, 0xa9, 0x9c, 0x88, 0x9c, 0xa5, 0x9c, 0x7a, 0x9c, 0xa4, 0xa5, 0x88,
-    0x92, 0xa5, 0xa4, 0xae, 0xa5, 0xba, 0xb6, 0xa5, 0x92, 0xa5, 0xa5, 0x92,
-    0xb6, 0xbf, 0xb6, 0xba, 0xba, 0xb8, 0xba, 0xb0, 0xb0, 0xb6, 0xb6, 0xa5,
-    0xb0, 0xb0, 0x9c, 0x94, 0x92, 0xa5, 0x92, 0x92, 0x92, 0xb6, 0xa9, 0x94,
-    0x88, 0xb6, 0xba, 0xae, 0xa9, 0x9c, 0x88, 0x82, 0x82, 0x92, 0x94, 0x8c,
-    0xa4, 0xbc, 0x92, 0xae, 0xba, 0xba, 0xa9, 0x88, 0x9c, 0x7a, 0x9c, 0x82,
-    0x94, 0x9c, 0x8b, 0x7a, 0x9c, 0x99, 0x65, 0x65, 0x94, 0x9c, 0x84, 0x84,
-    0x7a, 0x6e, 0x7a, 0x7a, 0x99, 0xab, 0x8e, 0x65, 0x65, 0x8e, 0x57, 0x65,
-    0x9f, 0x9f, 0x90, 0x9f, 0x81, 0x9f, 0x84, 0x70, 0x91, 0x91, 0x65, 0x70,
-    0x65, 0x50, 0x34, 0x34, 0x5e, 0x4e, 0x41, 0x56, 0x70, 0x78, 0x33, 0x27,
-    0x70, 0xa0, 0x78, 0x4e, 0x34, 0x33, 0x26, 0x26, 0x3e, 0x3e, 0x27, 0x3a,
-    0x89, 0x3e, 0x3a, 0x75, 0x75, 0x5d, 0x2d, 0x27, 0x1a, 0x33, 0x47, 0x26,
-    0x44, 0x26, 0x12, 0x26, 0x36, 0x0a, 0x06, 0x3b, 0xdc, 0xd3, 0xcf, 0xd4,
-    0xd4, 0xd3, 0xd4, 0xdc, 0xd0, 0x37, 0x0a, 0x0a, 0x2e, 0x11, 0x00, 0x37,
-    0x4f, 0x2e, 0x40, 0x2b, 0x1e, 0x25, 0x0e, 0x0e, 0x28, 0x11, 0x0a, 0x1e,
-    0x0a, 0x08, 0x00, 0x00, 0x0f, 0x08, 0x02, 0x08, 0x1e, 0x0a, 0x0e, 0x0a,
-    0x2e, 0x1e, 0x11, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x2e, 0x0a, 0x0a, 0x0c,
-    0x05, 0x0f, 0x03, 0x00, 0x13, 0x3d, 0x4f, 0x06, 0x25, 0x2e, 0x0e, 0x28,
-    0x1e, 0x14, 0x38, 0x4f, 0x0d, 0x11, 0x17, 0x0d, 0x12, 0x1d, 0x1e, 0x06,
-    0x12, 0x1a, 0x18, 0x1f, 0x06, 0x0a, 0x14, 0x44, 0x67, 0x43, 0x33, 0x47,
-    0x36, 0x10, 0x28, 0x12, 0x36, 0x52, 0x27, 0x33, 0x63, 0x2f, 0x12, 0x3a,
-    0x51, 0x56, 0x5b, 0x5d, 0x5f, 0x3a, 0x48, 0x70, 0x5b, 0x43, 0x5d, 0x9a,
-    0x96, 0x56, 0x27, 0x48, 0x90, 0x7f, 0x5d, 0x85, 0x85, 0x56, 0x48, 0x5e,
-    0x5d, 0x3a, 0x45, 0x70, 0x99, 0x9f, 0x5e, 0x65, 0x9f, 0x70, 0x7f, 0x81,
-    0x6e, 0x94, 0xaf, 0x91, 0x65, 0x84, 0x99, 0x99, 0x8e, 0x7a, 0x65, 0x6e,
-    0x94, 0x74, 0x88, 0x6e, 0x81, 0x81, 0x8b, 0xb4, 0xad, 0x9c, 0xab, 0x9c,
-    0x8b, 0x94, 0x7a, 0x9c, 0xa5, 0x9c, 0x94, 0xae, 0xae, 0x7a, 0x94, 0xa5,
-    0x92, 0xae, 0xae, 0xa5, 0x92, 0x88, 0xa5, 0xb6, 0xa9, 0xa5, 0xb0, 0xc0,
-    0xa5, 0x88, 0x8d, 0xb0, 0xb6, 0xa5, 0xb6, 0xb6, 0xa4, 0x94, 0xa5, 0xa5,
-    0x9c, 0x94, 0xa5, 0xb6, 0xc0, 0xb6, 0x92, 0xb6, 0xba, 0xa5, 0xb0, 0xa4,
-    0xb0, 0xbf, 0xb6, 0x92, 0xa5, 0xba, 0xa4, 0xae, 0xa5, 0x92, 0x9c, 0xa5,
-    0xa4, 0xa4, 0x8d, 0x8b, 0x94, 0x94, 0xae, 0xba, 0xad, 0xae, 0xa9, 0x94,
-    0x94, 0x94, 0x94, 0xa5, 0xad, 0x8c, 0x9c, 0xad, 0x82, 0x74, 0x9c, 0x9c,
-    0x9c, 0xa2, 0x99, 0x98, 0x6e, 0x99, 0x9c, 0x84, 0x91, 0x9c, 0xaf, 0x9c,
-    0x65, 0x60, 0x6e, 0xaa, 0x8e, 0x81, 0x99, 0x81, 0x4e, 0x5e, 0x7f, 0x70,
-    0x4a, 0x60, 0x7f, 0x9f, 0x9f, 0x54, 0x81, 0x91, 0x60, 0x70, 0x60, 0x5d,
-    0x7f, 0x96, 0x5d, 0x48, 0x60, 0x6c, 0x5d, 0x6c, 0x5d, 0x2f, 0x56, 0x4e,
-    0x5b, 0x48, 0x2f, 0x27, 0x26, 0x48, 0x89, 0x63, 0x58, 0x43, 0x3a, 0x1a,
-    0x26, 0x28, 0x3a, 0x58, 0x33, 0x1a, 0x58, 0x36, 0x06, 0x28, 0x2f, 0x31,
-    0x47, 0x31, 0x28, 0x3b, 0xce, 0xda, 0xdc, 0xd3, 0xd4, 0xdc, 0xe0, 0xd7,
-    0xbb, 0x0e, 0x44, 0x38, 0x13, 0x2e, 0x37, 0x11, 0x17, 0x08, 0x0e, 0x0a,
-    0x00, 0x08, 0x37, 0x46, 0x1e, 0x00, 0x38, 0x11, 0x0e, 0x2e, 0x17, 0x1e,
-    0x40, 0x1c, 0x08, 0x08, 0x08, 0x08, 0x0a, 0x11, 0x0e, 0x00, 0x04, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1b, 0x07, 0x00, 0x0c, 0x1e, 0x0e,
-    0x1d, 0x37, 0x1e, 0x18, 0x28, 0x11, 0x0a, 0x0e, 0x13, 0x2e, 0x2e, 0x26,
-    0x39, 0x31, 0x14, 0x09, 0x14, 0x31, 0x4f, 0x31, 0x2f, 0x3c, 0x3c, 0x52,
-    0x61, 0x67, 0x4f, 0x1d, 0x12, 0x1e, 0x26, 0x47, 0x52, 0x47, 0x12, 0x14,
-    0x52, 0x44, 0x47, 0x3a, 0x43, 0x4d, 0x1f, 0x75, 0x5d, 0x26, 0x3a, 0x72,
-    0x75, 0x5d, 0x56, 0x48, 0x5d, 0x78, 0x56, 0x32, 0x5d, 0x70, 0x4e, 0x5b,
-    0x70, 0x6c, 0x48, 0x4e, 0x4e, 0x5b, 0x5b, 0x45, 0x6c, 0x93, 0x79, 0x65,
-    0x8e, 0x81, 0x91, 0x90, 0x91, 0x60, 0x5e, 0x81, 0x8e, 0xaa, 0x9f, 0x99,
-    0xab, 0x8e, 0x81, 0x64, 0x7a, 0xab, 0xab, 0x9c, 0xa2, 0x98, 0x94, 0xae,
-    0xb4, 0xae, 0x9c, 0x7a, 0x6e, 0x74, 0x9c, 0xa9, 0xad, 0x82, 0x6e, 0xa2,
-    0xad, 0x9c, 0x92, 0xa9, 0xa5, 0x88, 0x92, 0xba, 0x9c, 0x74, 0xa5, 0xba,
-    0xad, 0xa4, 0x92, 0xae, 0xb6, 0xa4, 0x92, 0xae, 0xa5, 0xb0, 0xa4, 0xa4,
-    0xa5, 0x92, 0xa5, 0xa4, 0xa5, 0xad, 0x92, 0x92, 0xae, 0xa5, 0xb6, 0xc0,
-    0xb6, 0xb0, 0xba, 0xb6, 0xa5, 0x92, 0xa5, 0xb6, 0xb6, 0xb6, 0xb0, 0xb0,
-    0xb6, 0xa5, 0x92, 0x92, 0xba, 0xba, 0xb6, 0xb6, 0xa4, 0xa5, 0xb6, 0xba,
-    0xc0, 0xa5, 0x9c, 0x94, 0x94, 0x9c, 0xae, 0xb8, 0x92, 0x6e, 0x94, 0xae,
-    0x88, 0x9c, 0xa2, 0x9c, 0x94, 0x82, 0xad, 0x94, 0x6e, 0x8b, 0xa9, 0xab,
-    0x99, 0x8c, 0x73, 0x98, 0xac, 0x84, 0x81, 0x8e, 0x9f, 0x81, 0x6e, 0x6e,
-    0x65, 0x65, 0x81, 0x65, 0x70, 0x4e, 0x4e, 0x7f, 0x91, 0x70, 0x84, 0x99,
-    0x7f, 0x81, 0x91, 0x70, 0x50, 0x45, 0x5e, 0x7f, 0x86, 0x78, 0x7f, 0x7f,
-    0x6c, 0x48, 0x48, 0x70, 0x86, 0x7f, 0x7f, 0x70, 0x5b, 0x5e, 0x78, 0x89,
-    0x89, 0x3e, 0x26, 0x33, 0x3c, 0x4d, 0x58, 0x58, 0x1a, 0x1d, 0x5b, 0x3a,
-    0x28, 0x3a, 0x2f, 0x47, 0x12, 0x47, 0x52, 0x09, 0x0d, 0x52, 0x47, 0x49,
-    0xd4, 0xd3, 0xd4, 0xda, 0xd4, 0xd0, 0xd7, 0xcf, 0xbb, 0x13, 0x25, 0x1e,
-    0x11, 0x17, 0x1c, 0x17, 0x11, 0x08, 0x08, 0x18, 0x18, 0x11, 0x28, 0x18,
-    0x17, 0x1e, 0x1e, 0x08, 0x14, 0x0a, 0x11, 0x1c, 0x1e, 0x1e, 0x14, 0x0e,
-    0x08, 0x08, 0x0a, 0x1e, 0x1c, 0x14, 0x13, 0x0e, 0x0d, 0x1e, 0x46, 0x35,
-    0x17, 0x1e, 0x61, 0x35, 0x08, 0x1c, 0x37, 0x0a, 0x11, 0x0f, 0x11, 0x0c,
-    0x06, 0x06, 0x4f, 0x4f, 0x1e, 0x0e, 0x03, 0x14, 0x20, 0x1d, 0x28, 0x25,
-    0x1d, 0x1e, 0x12, 0x1d, 0x1a, 0x1a, 0x3a, 0x26, 0x52, 0x3c, 0x1a, 0x31,
-    0x28, 0x26, 0x28, 0x18, 0x26, 0x5f, 0x7b, 0x58, 0x31, 0x47, 0x6d, 0x3a,
-    0x27, 0x33, 0x63, 0x52, 0x47, 0x34, 0x3a, 0x33, 0x51, 0x6c, 0x58, 0x43,
-    0x43, 0x48, 0x56, 0x58, 0x3a, 0x56, 0x7f, 0x70, 0x48, 0x4e, 0x96, 0x7f,
-    0x70, 0x9f, 0xa7, 0x5e, 0x70, 0x9f, 0x79, 0x79, 0x65, 0x60, 0x5d, 0x60,
-    0x7f, 0x9f, 0x9d, 0x74, 0x81, 0x69, 0x65, 0x8e, 0x81, 0x81, 0x99, 0x99,
-    0x99, 0x6e, 0x65, 0x98, 0x74, 0x9c, 0x9c, 0xa2, 0x9c, 0x94, 0x94, 0x99,
-    0x99, 0x94, 0x82, 0x94, 0x9c, 0xae, 0xba, 0x92, 0x9c, 0xba, 0xa4, 0x94,
-    0x8d, 0xae, 0xae, 0x94, 0x9c, 0x9c, 0x88, 0x92, 0xae, 0xae, 0x9c, 0x92,
-    0xae, 0xa5, 0xa4, 0xa9, 0xa5, 0xa5, 0xb6, 0x9c, 0x94, 0xba, 0xc0, 0xb0,
-    0xb6, 0xbf, 0xb0, 0xa4, 0xb6, 0xb6, 0xb0, 0xb6, 0xa5, 0x92, 0x92, 0xa5,
-    0xb6, 0xbf, 0xb6, 0xa4, 0xa5, 0x88, 0xa5, 0xb6, 0xa5, 0xa4, 0xba, 0xae,
-    0xa5, 0x92, 0xa4, 0xa5, 0xa5, 0xb6, 0xa4, 0xa5, 0xa4, 0xa9, 0xa9, 0x9c,
-    0xa9, 0xa2, 0x88, 0xad, 0xae, 0xba, 0xa5, 0x94, 0xae, 0xa5, 0x9c, 0x74,
-    0x9c, 0x9c, 0x98, 0x8e, 0x94, 0x74, 0x7a, 0x94, 0x98, 0x81, 0x84, 0x84,
-    0x7a, 0x84, 0x84, 0x73, 0x9f, 0x9f, 0x73, 0x4e, 0x90, 0xaf, 0x91, 0x6e,
-    0xaf, 0x90, 0x70, 0x91, 0x8c, 0x65, 0x65, 0x70, 0x60, 0x56, 0x50, 0x79,
-    0x9d, 0x9f, 0x79, 0x5e, 0x48, 0x5d, 0x85, 0x56, 0x4e, 0x70, 0x70, 0x5b,
-    0x56, 0x58, 0x4e, 0x4e, 0x86, 0x4e, 0x6a, 0x5d, 0x58, 0x43, 0x47, 0x53,
-    0x47, 0x2f, 0x3c, 0x58, 0x66, 0x63, 0x3a, 0x3a, 0x63, 0x3a, 0x12, 0x26,
-    0x52, 0x26, 0x31, 0x1f, 0x0d, 0x0a, 0x28, 0x59, 0xcf, 0xcf, 0xd4, 0xd7,
-    0xd0, 0xce, 0xce, 0xd4, 0xd0, 0x2e, 0x0e, 0x0a, 0x4f, 0x3d, 0x1e, 0x4f,
-    0x4f, 0x18, 0x17, 0x38, 0x0a, 0x13, 0x0a, 0x0e, 0x0a, 0x08, 0x00, 0x13,
-    0x37, 0x0a, 0x0a, 0x0a, 0x0a, 0x14, 0x04, 0x11, 0x0a, 0x1e, 0x17, 0x08,
-    0x03, 0x00, 0x06, 0x13, 0x14, 0x25, 0x35, 0x1b, 0x08, 0x07, 0x13, 0x25,
-    0x2b, 0x1e, 0x08, 0x0f, 0x0e, 0x00, 0x0f, 0x2e, 0x40, 0x18, 0x1e, 0x08,
-    0x0a, 0x37, 0x2e, 0x31, 0x09, 0x01, 0x1e, 0x28, 0x36, 0x09, 0x06, 0x12,
-    0x18, 0x2e, 0x3a, 0x67, 0x28, 0x12, 0x12, 0x31, 0x31, 0x2e, 0x12, 0x04,
-    0x10, 0x26, 0x28, 0x3c, 0x3a, 0x33, 0x14, 0x10, 0x4d, 0x58, 0x5b, 0x43,
-    0x33, 0x27, 0x27, 0x3a, 0x43, 0x58, 0x5d, 0x78, 0x78, 0x5b, 0x56, 0x48,
-    0x3a, 0x3f, 0x4d, 0x3e, 0x43, 0x56, 0x60, 0x56, 0x4e, 0x7f, 0x7f, 0x91,
-    0x70, 0x60, 0x60, 0x79, 0x60, 0x48, 0x70, 0x9f, 0x91, 0x8e, 0x65, 0x70,
-    0x8b, 0x9d, 0x8e, 0x69, 0x65, 0x8e, 0x99, 0x98, 0x8b, 0x69, 0x81, 0x94,
-    0x82, 0xa2, 0xbc, 0x99, 0x6e, 0x6e, 0x94, 0xa9, 0xa2, 0x74, 0x6e, 0x69,
-    0x74, 0x8c, 0x94, 0xa5, 0x9c, 0x82, 0x7a, 0x94, 0xae, 0xb0, 0xb0, 0xae,
-    0x9c, 0x88, 0x8d, 0x92, 0xa2, 0xa9, 0xae, 0xb8, 0xa5, 0xa4, 0xa5, 0x92,
-    0x8d, 0x92, 0x9c, 0x82, 0x9c, 0xb8, 0xae, 0x9c, 0xa5, 0xba, 0xba, 0xb6,
-    0xa4, 0xa5, 0xb6, 0xa4, 0x92, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0xa4,
-    0xb6, 0xb6, 0xa5, 0x8d, 0xa5, 0xb0, 0xa5, 0xb6, 0x88, 0x92, 0xb0, 0xa5,
-    0xa5, 0xba, 0xba, 0x92, 0x94, 0x94, 0xae, 0xae, 0x9c, 0x6e, 0x73, 0x7a,
-    0x94, 0x94, 0x92, 0xa5, 0x94, 0x8e, 0x74, 0x9c, 0xa9, 0xa2, 0xb4, 0x9c,
-    0x8e, 0x81, 0x7a, 0x7a, 0x8c, 0xab, 0xac, 0xab, 0x9f, 0x8e, 0x65, 0x65,
-    0x65, 0x5a, 0x70, 0x5e, 0x7f, 0x90, 0x60, 0x64, 0x8e, 0x9f, 0x9f, 0x73,
-    0x70, 0x65, 0x5a, 0x50, 0x4e, 0x7f, 0x91, 0x91, 0x64, 0x60, 0x4e, 0x85,
-    0x7f, 0x78, 0x56, 0x45, 0x60, 0x6c, 0x7f, 0x4e, 0x48, 0x5d, 0x4e, 0x4e,
-    0x70, 0x96, 0x51, 0x3a, 0x3a, 0x58, 0x5d, 0x52, 0x28, 0x18, 0x14, 0x1f,
-    0x28, 0x2f, 0x34, 0x2d, 0x20, 0x06, 0x26, 0x58, 0x44, 0x52, 0x53, 0x0d,
-    0x09, 0x12, 0x14, 0x3b, 0xdc, 0xdc, 0xdc, 0xdc, 0xd0, 0xd7, 0xcf, 0xce,
-    0xc2, 0x0a, 0x11, 0x0a, 0x11, 0x0e, 0x08, 0x0a, 0x17, 0x31, 0x38, 0x11,
-    0x0e, 0x17, 0x0e, 0x00, 0x08, 0x2b, 0x19, 0x0a, 0x01, 0x06, 0x11, 0x2b,
-    0x1c, 0x0e, 0x00, 0x0e, 0x11, 0x25, 0x0a, 0x0a, 0x08, 0x06, 0x06, 0x11,
-    0x18, 0x18, 0x07, 0x00, 0x07, 0x08, 0x01, 0x08, 0x0a, 0x0f, 0x08, 0x11,
-    0x08, 0x09, 0x18, 0x0c, 0x17, 0x06, 0x0a, 0x09, 0x0a, 0x18, 0x1e, 0x35,
-    0x13, 0x00, 0x0a, 0x1d, 0x20, 0x09, 0x14, 0x0b, 0x12, 0x12, 0x0e, 0x26,
-    0x12, 0x1d, 0x12, 0x06, 0x00, 0x18, 0x3f, 0x1a, 0x1a, 0x1a, 0x3c, 0x47,
-    0x3a, 0x58, 0x26, 0x3c, 0x66, 0x33, 0x26, 0x3c, 0x33, 0x66, 0x75, 0x4d,
-    0x1f, 0x5d, 0x6c, 0x33, 0x34, 0x58, 0x33, 0x58, 0x85, 0x78, 0x48, 0x6c,
-    0x9f, 0x70, 0x33, 0x48, 0x5a, 0x57, 0x4e, 0x79, 0x79, 0x54, 0x70, 0x60,
-    0x70, 0x91, 0x73, 0x5e, 0x57, 0x57, 0x57, 0x69, 0x7f, 0x73, 0x9f, 0x81,
-    0x65, 0x73, 0x69, 0x74, 0x69, 0x6e, 0x7a, 0x81, 0x94, 0x6e, 0x8b, 0x94,
-    0x6e, 0x94, 0x6e, 0x65, 0x74, 0x94, 0x98, 0x94, 0x94, 0x94, 0x9c, 0x8d,
-    0x92, 0x88, 0x88, 0xa5, 0xa5, 0x9c, 0x9c, 0x9c, 0xb8, 0xb8, 0xae, 0x8b,
-    0xa5, 0xba, 0x94, 0x88, 0xa5, 0x88, 0x92, 0xba, 0xba, 0x88, 0x92, 0xc0,
-    0xb6, 0x88, 0x82, 0xa4, 0xa4, 0x92, 0xa4, 0xa5, 0x8d, 0xa4, 0xa5, 0xa5,
-    0xb6, 0xba, 0xa4, 0xa4, 0xa5, 0xa5, 0xa4, 0xa5, 0x92, 0xb0, 0xae, 0xa4,
-    0x92, 0x92, 0xa5, 0x92, 0x92, 0xa4, 0x88, 0xa5, 0x9c, 0x8d, 0xa5, 0xa9,
-    0xa5, 0x9c, 0x74, 0x74, 0x9c, 0xab, 0xab, 0x9c, 0x94, 0x9b, 0x9c, 0x92,
-    0x9c, 0x74, 0x8d, 0xad, 0x94, 0x94, 0x7a, 0x94, 0xb2, 0xae, 0x6e, 0x73,
-    0xab, 0x9f, 0x5a, 0x84, 0x84, 0x65, 0x84, 0xac, 0x95, 0x65, 0x99, 0xaf,
-    0x73, 0x45, 0x65, 0x69, 0x54, 0x70, 0x65, 0x70, 0x65, 0x65, 0x5e, 0x90,
-    0x96, 0x70, 0x60, 0x50, 0x4e, 0x60, 0x60, 0x51, 0x6c, 0x85, 0x45, 0x4a,
-    0x41, 0x4e, 0x50, 0x4d, 0x56, 0x4d, 0x51, 0x3e, 0x32, 0x5d, 0x3e, 0x34,
-    0x3e, 0x2f, 0x1d, 0x2f, 0x3c, 0x26, 0x2f, 0x28, 0x3c, 0x3c, 0x3c, 0x4d,
-    0x26, 0x31, 0x58, 0x3c, 0x1f, 0x1d, 0x14, 0x53, 0x5f, 0x1a, 0x04, 0x6f,
-    0xda, 0xcf, 0xce, 0xcf, 0xd0, 0xd4, 0xdc, 0xdc, 0xb3, 0x31, 0x67, 0x37,
-    0x08, 0x00, 0x0f, 0x08, 0x00, 0x0a, 0x17, 0x08, 0x14, 0x18, 0x08, 0x1e,
-    0x08, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1e, 0x12, 0x00, 0x03,
-    0x0a, 0x13, 0x08, 0x00, 0x03, 0x13, 0x0e, 0x08, 0x0f, 0x0a, 0x03, 0x07,
-    0x2e, 0x0f, 0x06, 0x08, 0x37, 0x4b, 0x37, 0x25, 0x25, 0x17, 0x1c, 0x0c,
-    0x17, 0x11, 0x11, 0x25, 0x1e, 0x06, 0x08, 0x1e, 0x1e, 0x25, 0x14, 0x3d,
-    0x44, 0x4c, 0x1d, 0x04, 0x1d, 0x14, 0x11, 0x00, 0x06, 0x13, 0x14, 0x1e,
-    0x3c, 0x38, 0x3f, 0x3c, 0x47, 0x2f, 0x28, 0x26, 0x3e, 0x43, 0x5f, 0x3a,
-    0x2f, 0x3c, 0x4d, 0x43, 0x33, 0x58, 0x43, 0x58, 0x75, 0x33, 0x33, 0x43,
-    0x47, 0x34, 0x5d, 0x6c, 0x5d, 0x56, 0x86, 0x70, 0x6c, 0x7f, 0x86, 0x93,
-    0x65, 0x60, 0x60, 0x99, 0xaf, 0x9f, 0x79, 0x7f, 0x85, 0x7f, 0x60, 0x7f,
-    0x74, 0x65, 0x65, 0x94, 0x65, 0x54, 0x7f, 0x84, 0x95, 0x64, 0x8b, 0xaa,
-    0x9c, 0x94, 0x69, 0x73, 0x6e, 0x8e, 0x73, 0x69, 0x69, 0x6e, 0x7a, 0x9c,
-    0x94, 0x9c, 0x9c, 0xaa, 0x9c, 0x8c, 0x9c, 0x9c, 0x8d, 0xa5, 0xae, 0x92,
-    0x9c, 0x8d, 0xa2, 0xa9, 0x9c, 0xae, 0x94, 0xbc, 0xad, 0x8c, 0x9c, 0x92,
-    0x9c, 0xa4, 0xa5, 0xa4, 0xa4, 0xa5, 0xba, 0xa4, 0xb6, 0xbf, 0xb6, 0xb6,
-    0xa4, 0xa4, 0xb6, 0xbf, 0xbf, 0xbf, 0xb6, 0xb6, 0xb6, 0xae, 0xa5, 0xb6,
-    0xb6, 0xa5, 0xb6, 0xb0, 0x82, 0x8d, 0x92, 0xad, 0xa5, 0x92, 0xb6, 0xb6,
-    0xba, 0x88, 0x94, 0x8d, 0x8d, 0x8d, 0x94, 0x94, 0x9c, 0x92, 0xa2, 0xae,
-    0xad, 0xab, 0x9c, 0xa9, 0xa9, 0x9c, 0x88, 0x9c, 0x92, 0xad, 0x9c, 0x94,
-    0x7a, 0x9c, 0x9c, 0x8e, 0x94, 0x8e, 0x9c, 0xaa, 0x6e, 0x7f, 0x90, 0x70,
-    0x7a, 0x95, 0x7a, 0x84, 0x84, 0x99, 0x8e, 0x98, 0xaa, 0x8b, 0x8b, 0x74,
-    0x65, 0x69, 0xa7, 0xaf, 0x99, 0x81, 0x91, 0x7f, 0x85, 0x5e, 0x65, 0x81,
-    0x4e, 0x65, 0x91, 0x3a, 0x3e, 0x4e, 0x5b, 0x5e, 0x51, 0x7f, 0x91, 0x86,
-    0x56, 0x32, 0x4d, 0x3e, 0x3e, 0x27, 0x26, 0x32, 0x3a, 0x3a, 0x56, 0x4d,
-    0x58, 0x4d, 0x58, 0x47, 0x36, 0x2f, 0x33, 0x4d, 0x58, 0x47, 0x27, 0x1f,
-    0x28, 0x36, 0x1d, 0x25, 0x1d, 0x1d, 0x4f, 0x3b, 0xd0, 0xda, 0xce, 0xd0,
-    0xdc, 0xd0, 0xd3, 0xd0, 0xc2, 0x2e, 0x1e, 0x40, 0x40, 0x38, 0x25, 0x08,
-    0x00, 0x1e, 0x5c, 0x4f, 0x2b, 0x2b, 0x1e, 0x1e, 0x0a, 0x08, 0x0f, 0x06,
-    0x0b, 0x12, 0x08, 0x02, 0x0f, 0x17, 0x19, 0x08, 0x1c, 0x2e, 0x2b, 0x0a,
-    0x00, 0x08, 0x07, 0x08, 0x02, 0x03, 0x03, 0x02, 0x4f, 0x1c, 0x02, 0x08,
-    0x0f, 0x1c, 0x17, 0x0a, 0x0a, 0x00, 0x00, 0x04, 0x13, 0x14, 0x0d, 0x28,
-    0x1e, 0x11, 0x1e, 0x37, 0x40, 0x31, 0x1e, 0x11, 0x08, 0x0e, 0x0d, 0x38,
-    0x40, 0x4f, 0x1d, 0x25, 0x61, 0x5c, 0x28, 0x26, 0x26, 0x1d, 0x53, 0x63,
-    0x66, 0x52, 0x26, 0x36, 0x58, 0x3a, 0x26, 0x12, 0x04, 0x27, 0x5d, 0x66,
-    0x85, 0x66, 0x5d, 0x96, 0x70, 0x4e, 0xa0, 0xb1, 0xa0, 0x70, 0x45, 0x5b,
-    0x3a, 0x5b, 0x9a, 0x8a, 0x5d, 0x3a, 0x3e, 0xa7, 0x85, 0x41, 0x4e, 0x70,
-    0x6c, 0x70, 0x85, 0x70, 0x45, 0x41, 0x60, 0x84, 0x65, 0x65, 0x6e, 0x8e,
-    0x6e, 0x73, 0x99, 0xab, 0x99, 0x7a, 0x81, 0x65, 0x65, 0x73, 0x95, 0x9c,
-    0xab, 0xab, 0x84, 0xab, 0xbc, 0x9b, 0x8c, 0x9c, 0x99, 0x94, 0xab, 0xae,
-    0xa9, 0x94, 0x94, 0xa2, 0xa9, 0x8d, 0x8c, 0x6e, 0x6e, 0xa9, 0xae, 0xba,
-    0xbc, 0xae, 0xc0, 0xc0, 0xa5, 0xc0, 0xc0, 0xbf, 0xba, 0xa5, 0xa5, 0x88,
-    0x92, 0xc0, 0xc0, 0xb0, 0xad, 0x88, 0xc0, 0xc0, 0x92, 0x9c, 0xa4, 0xa4,
-    0xa5, 0xba, 0xa5, 0x92, 0x88, 0x92, 0xb0, 0xb6, 0xa4, 0xa4, 0xb0, 0xa4,
-    0xa5, 0xb6, 0xba, 0xb0, 0xb0, 0xa5, 0x92, 0x9c, 0x92, 0x8d, 0xb0, 0xba,
-    0xb0, 0x92, 0xad, 0xc0, 0xb0, 0x92, 0x92, 0x92, 0x92, 0xb0, 0xbc, 0xbc,
-    0x9c, 0x94, 0x9c, 0xa9, 0x88, 0x82, 0x6e, 0x65, 0x8b, 0xa9, 0xb4, 0xbc,
-    0x9c, 0xb4, 0xbc, 0x94, 0xa9, 0xbc, 0xbc, 0xbc, 0x99, 0x84, 0x74, 0x57,
-    0x99, 0xaf, 0x99, 0x81, 0x60, 0x84, 0xaf, 0x91, 0x4e, 0x5a, 0x7f, 0x70,
-    0x84, 0x7f, 0x70, 0x48, 0x48, 0x57, 0x79, 0x57, 0x54, 0x65, 0x60, 0x4e,
-    0x60, 0x86, 0x7f, 0x7f, 0x60, 0x5d, 0x48, 0x4d, 0x3e, 0x70, 0x78, 0x85,
-    0x56, 0x3e, 0x9a, 0x8a, 0x56, 0x48, 0x51, 0x32, 0x56, 0x78, 0x63, 0x58,
-    0x47, 0x3c, 0x4d, 0x3a, 0x33, 0x12, 0x06, 0x1d, 0x47, 0x3a, 0x7b, 0x5c,
-    0x26, 0x6d, 0x5f, 0x3b, 0xe0, 0xe0, 0xe0, 0xd7, 0xd3, 0xd4, 0xce, 0xd3,
-    0xdb, 0x61, 0x18, 0x13, 0x0a, 0x55, 0x61, 0x08, 0x06, 0x11, 0x1c, 0x1c,
-    0x0c, 0x0e, 0x08, 0x02, 0x00, 0x0f, 0x13, 0x06, 0x14, 0x11, 0x0e, 0x17,
-    0x1c, 0x2e, 0x25, 0x0e, 0x17, 0x08, 0x08, 0x08, 0x17, 0x14, 0x18, 0x17,
-    0x03, 0x38, 0x40, 0x0e, 0x07, 0x05, 0x1b, 0x2e, 0x2b, 0x0f, 0x00, 0x07,
-    0x08, 0x17, 0x13, 0x14, 0x13, 0x13, 0x00, 0x00, 0x11, 0x18, 0x1e, 0x06,
-    0x06, 0x0a, 0x12, 0x12, 0x0a, 0x08, 0x1e, 0x25, 0x13, 0x09, 0x11, 0x26,
-    0x4f, 0x25, 0x39, 0x5f, 0x18, 0x1f, 0x52, 0x52, 0x53, 0x8a, 0x58, 0x26,
-    0x1d, 0x12, 0x2f, 0x63, 0x58, 0x58, 0x58, 0x43, 0x66, 0x58, 0x56, 0x3a,
-    0x56, 0x96, 0x4e, 0x48, 0x50, 0x3e, 0x3e, 0x70, 0x4e, 0x45, 0x3e, 0x48,
-    0x56, 0x78, 0x85, 0x56, 0x3e, 0x5e, 0x90, 0x93, 0x70, 0x2f, 0x2f, 0x60,
-    0x91, 0x7f, 0x81, 0x84, 0x84, 0x65, 0x54, 0x57, 0x73, 0x84, 0x73, 0x65,
-    0x65, 0x6e, 0x84, 0x65, 0x5a, 0x84, 0x99, 0x73, 0x69, 0x6e, 0x99, 0xa9,
-    0xab, 0x94, 0xad, 0x94, 0x8b, 0xa9, 0xa9, 0x9c, 0xb4, 0xb8, 0x9c, 0x82,
-    0x7a, 0x7a, 0xa5, 0xb4, 0xb4, 0xae, 0x9c, 0xa9, 0xae, 0xae, 0xa2, 0x88,
-    0xbf, 0xb0, 0x92, 0xa5, 0x9c, 0x8d, 0xb0, 0xa5, 0xa5, 0x92, 0x82, 0xa9,
-    0xba, 0xba, 0xa5, 0x9c, 0xa5, 0xb0, 0xba, 0xb0, 0x92, 0x82, 0x92, 0xba,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xa5, 0x92, 0x88, 0xa4, 0xa4, 0xa5, 0x92, 0x92,
-    0xa5, 0x92, 0x92, 0x88, 0x92, 0xae, 0x92, 0x8b, 0x94, 0x9c, 0xa5, 0xb8,
-    0x8d, 0xba, 0xb8, 0x88, 0xa5, 0xba, 0xae, 0xbc, 0xc0, 0xad, 0x9c, 0x94,
-    0x74, 0x9b, 0xb8, 0xab, 0x9c, 0x9c, 0x94, 0xa2, 0x9c, 0x9c, 0x74, 0xa9,
-    0xbc, 0x8c, 0x74, 0x7a, 0x65, 0x8b, 0x74, 0x81, 0x81, 0x57, 0x65, 0x84,
-    0x9f, 0x84, 0x5e, 0x60, 0x73, 0xa7, 0x90, 0x60, 0x3a, 0x48, 0x65, 0x91,
-    0x65, 0x81, 0x81, 0x65, 0x4e, 0x48, 0x4e, 0x70, 0x60, 0x41, 0x45, 0x5d,
-    0x4e, 0x48, 0x48, 0x32, 0x45, 0x56, 0x3a, 0x27, 0x3a, 0x5b, 0x78, 0x58,
-    0x56, 0x78, 0x48, 0x41, 0x5d, 0x5d, 0x58, 0x8a, 0x75, 0x3c, 0x49, 0x3b,
-    0x3b, 0x52, 0x52, 0x47, 0x3a, 0x3b, 0x3a, 0x36, 0x47, 0x3b, 0x3b, 0x6f,
-    0xbb, 0xbb, 0xbb, 0xa8, 0xa8, 0xbb, 0xbb, 0xa8, 0x80, 0x08, 0x0a, 0x40,
-    0x38, 0x0a, 0x0a, 0x0e, 0x37, 0x35, 0x14, 0x02, 0x02, 0x08, 0x08, 0x1e,
-    0x18, 0x2e, 0x14, 0x00, 0x03, 0x02, 0x08, 0x0a, 0x0e, 0x00, 0x00, 0x08,
-    0x0e, 0x00, 0x00, 0x00, 0x06, 0x08, 0x07, 0x03, 0x08, 0x28, 0x2b, 0x0a,
-    0x00, 0x35, 0x35, 0x0a, 0x00, 0x0a, 0x17, 0x17, 0x00, 0x0f, 0x0e, 0x13,
-    0x08, 0x0e, 0x08, 0x14, 0x18, 0x28, 0x31, 0x25, 0x01, 0x11, 0x2e, 0x28,
-    0x18, 0x31, 0x44, 0x1e, 0x5c, 0x4f, 0x4f, 0x31, 0x25, 0x13, 0x14, 0x31,
-    0x3f, 0x53, 0x43, 0x10, 0x06, 0x28, 0x52, 0x47, 0x14, 0x28, 0x2f, 0x63,
-    0x97, 0x6c, 0x3a, 0x33, 0x26, 0x27, 0x26, 0x63, 0x6c, 0x1d, 0x1f, 0x3a,
-    0x34, 0x58, 0x48, 0x34, 0x70, 0x96, 0x70, 0x4e, 0x32, 0x3e, 0x70, 0x34,
-    0x70, 0xa0, 0x7f, 0x4d, 0x3e, 0x70, 0x7f, 0x4e, 0x4e, 0x79, 0x7f, 0x5a,
-    0x54, 0x65, 0x65, 0x81, 0x8e, 0x99, 0x8c, 0x65, 0x65, 0x74, 0x99, 0x84,
-    0x8e, 0xab, 0x8e, 0x99, 0xab, 0xa9, 0xab, 0x99, 0x99, 0x74, 0x98, 0xaa,
-    0xa9, 0xa9, 0x8c, 0x69, 0x6e, 0x9c, 0xa9, 0x8c, 0x7a, 0x82, 0x92, 0xbf,
-    0xbc, 0xae, 0x94, 0x88, 0x94, 0x94, 0xa9, 0xae, 0x9b, 0x8b, 0x88, 0x82,
-    0x92, 0xad, 0x9c, 0xae, 0xb6, 0xb0, 0xa5, 0x92, 0x88, 0xb6, 0x92, 0x92,
-    0xc0, 0xba, 0xa2, 0x82, 0xa5, 0xba, 0xa5, 0x94, 0xa5, 0xb0, 0xa4, 0xa5,
-    0xa5, 0xa4, 0xa4, 0xb6, 0xb6, 0xb6, 0xa5, 0x92, 0xae, 0xb0, 0x92, 0xa5,
-    0xb6, 0xb8, 0x92, 0xb8, 0xba, 0xba, 0xa5, 0xa5, 0x9c, 0x8d, 0xa5, 0xae,
-    0xa5, 0xa5, 0x82, 0x74, 0x94, 0xa9, 0x9c, 0x7a, 0x82, 0x9b, 0xbc, 0xb8,
-    0xad, 0x9c, 0x74, 0x74, 0x74, 0x74, 0xad, 0x94, 0x65, 0x69, 0x69, 0x6e,
-    0x7a, 0x6e, 0x69, 0x98, 0xaa, 0x98, 0x65, 0x54, 0x81, 0x81, 0x54, 0x9f,
-    0xac, 0x65, 0x56, 0x4e, 0x65, 0x91, 0x50, 0x60, 0x73, 0x79, 0x57, 0x5e,
-    0x60, 0x70, 0x79, 0x7f, 0x91, 0x7f, 0x51, 0x3e, 0x78, 0x5e, 0x48, 0x60,
-    0x78, 0x48, 0x78, 0x89, 0x85, 0x70, 0x5d, 0x34, 0x33, 0x56, 0x63, 0x75,
-    0xc6, 0xd7, 0xcf, 0xd7, 0xdc, 0xd7, 0xcf, 0xcf, 0xd7, 0xc2, 0xd0, 0xe0,
-    0xd7, 0xcf, 0xcf, 0xd7, 0xcf, 0xd4, 0xd7, 0xa8, 0xcd, 0xce, 0xce, 0xcf,
-    0xcf, 0xce, 0xd3, 0xdc, 0xc2, 0x0a, 0x00, 0x0e, 0x0a, 0x08, 0x17, 0x46,
-    0x2b, 0x08, 0x08, 0x0f, 0x1e, 0x0e, 0x00, 0x13, 0x14, 0x0a, 0x08, 0x00,
-    0x0c, 0x17, 0x17, 0x13, 0x14, 0x0a, 0x00, 0x17, 0x1e, 0x06, 0x1e, 0x1e,
-    0x06, 0x0a, 0x1e, 0x1c, 0x1e, 0x17, 0x13, 0x00, 0x0e, 0x08, 0x03, 0x03,
-    0x17, 0x4f, 0x2e, 0x06, 0x08, 0x08, 0x37, 0x37, 0x0e, 0x17, 0x2e, 0x3d,
-    0x0a, 0x08, 0x0a, 0x1e, 0x12, 0x1a, 0x2e, 0x1d, 0x20, 0x31, 0x26, 0x28,
-    0x28, 0x31, 0x25, 0x31, 0x28, 0x4f, 0x4f, 0x1d, 0x17, 0x2f, 0x28, 0x1a,
-    0x14, 0x1d, 0x26, 0x1d, 0x27, 0x58, 0x63, 0x4d, 0x0d, 0x12, 0x28, 0x3e,
-    0x33, 0x3e, 0x63, 0x75, 0x20, 0x1f, 0x5d, 0x4d, 0x32, 0x48, 0x48, 0x5b,
-    0x6c, 0x5b, 0x86, 0x70, 0x85, 0x45, 0x78, 0x7f, 0x45, 0x43, 0x41, 0x5e,
-    0x90, 0x96, 0x5e, 0x60, 0x60, 0x91, 0x9d, 0x65, 0x65, 0x84, 0x99, 0x84,
-    0x65, 0x81, 0x81, 0x73, 0x84, 0x7a, 0x8e, 0x7a, 0xaa, 0x99, 0x99, 0x74,
-    0x8b, 0x8c, 0x99, 0x99, 0x9c, 0xb4, 0x94, 0x7a, 0x9c, 0x9c, 0x82, 0x7a,
-    0x95, 0x74, 0x7a, 0x6e, 0xa9, 0xbc, 0xae, 0x7a, 0x84, 0x94, 0x9c, 0x92,
-    0x88, 0xa5, 0xae, 0x99, 0x69, 0xad, 0x9c, 0x82, 0x9b, 0xad, 0xae, 0xae,
-    0xa5, 0xb2, 0xba, 0xba, 0xa5, 0xa5, 0xba, 0xae, 0x8d, 0x8d, 0x92, 0xba,
-    0xc0, 0xba, 0x92, 0x92, 0xa4, 0xc0, 0xa4, 0xa5, 0xa4, 0xb6, 0xb0, 0xa5,
-    0x92, 0xa5, 0xa5, 0xa4, 0xa5, 0xa5, 0xa4, 0xb6, 0xb6, 0xb6, 0xa5, 0xae,
-    0xae, 0x9c, 0xad, 0xa5, 0xba, 0xb0, 0x9c, 0x9c, 0xa5, 0x9c, 0x9c, 0x8b,
-    0x94, 0x8b, 0x7a, 0x9c, 0xae, 0xae, 0x9c, 0x65, 0x7a, 0x8e, 0x9c, 0x94,
-    0x9c, 0xa2, 0xab, 0x54, 0x99, 0x9c, 0x69, 0x6e, 0x6e, 0x8e, 0x94, 0x81,
-    0x74, 0x99, 0x99, 0x99, 0x64, 0x99, 0x8e, 0x70, 0x4e, 0x4e, 0x7f, 0x9f,
-    0x9f, 0x70, 0x57, 0x70, 0x9d, 0x91, 0x60, 0x70, 0x91, 0x93, 0x5e, 0x56,
-    0x5e, 0x4e, 0x5e, 0x70, 0x60, 0x5d, 0x6c, 0x7f, 0x70, 0x5d, 0x48, 0x6a,
-    0x58, 0x58, 0x63, 0x6a, 0x85, 0x51, 0x2f, 0x5d, 0xc6, 0xd7, 0xd7, 0xcf,
-    0xcf, 0xcf, 0xd7, 0xdc, 0xe0, 0xbb, 0xbb, 0xcf, 0xcf, 0xd7, 0xd7, 0xd7,
-    0xd4, 0xda, 0xce, 0x80, 0xd4, 0xd0, 0xd0, 0xce, 0xcf, 0xdc, 0xd4, 0xd4,
-    0xd0, 0x37, 0x28, 0x20, 0x1d, 0x31, 0x14, 0x08, 0x00, 0x0a, 0x2e, 0x4f,
-    0x11, 0x08, 0x06, 0x17, 0x4b, 0x17, 0x0f, 0x2b, 0x2e, 0x0f, 0x08, 0x0a,
-    0x17, 0x0a, 0x13, 0x11, 0x17, 0x0a, 0x18, 0x28, 0x1e, 0x0a, 0x17, 0x17,
-    0x0a, 0x17, 0x17, 0x38, 0x04, 0x00, 0x08, 0x11, 0x11, 0x0e, 0x0a, 0x0a,
-    0x46, 0x46, 0x0f, 0x05, 0x0a, 0x1c, 0x0a, 0x00, 0x1e, 0x28, 0x18, 0x37,
-    0x28, 0x18, 0x0a, 0x0e, 0x14, 0x1e, 0x0e, 0x1d, 0x20, 0x01, 0x06, 0x06,
-    0x06, 0x13, 0x13, 0x3c, 0x47, 0x28, 0x09, 0x1d, 0x26, 0x1f, 0x47, 0x53,
-    0x47, 0x47, 0x1e, 0x3a, 0x66, 0x2d, 0x2d, 0x3e, 0x3a, 0x48, 0x56, 0x33,
-    0x2f, 0x3e, 0x3a, 0x5d, 0x85, 0x70, 0x6a, 0x60, 0x5d, 0x5d, 0x5b, 0x4e,
-    0x6c, 0x7f, 0x70, 0x78, 0x32, 0x4e, 0x70, 0x6c, 0x5e, 0x60, 0x5a, 0x9f,
-    0x9f, 0x7f, 0x60, 0x79, 0x73, 0x73, 0x4e, 0x7f, 0x8e, 0x74, 0x8e, 0x95,
-    0x84, 0x5a, 0x65, 0x65, 0x84, 0x5a, 0x73, 0x8e, 0x6e, 0x65, 0x69, 0x65,
-    0x69, 0x6e, 0x94, 0xa9, 0x99, 0x6e, 0x84, 0x9c, 0x9c, 0x9c, 0xab, 0xab,
-    0xab, 0x8c, 0x6e, 0xae, 0xa5, 0x9c, 0x92, 0x9c, 0x88, 0xa2, 0x94, 0x94,
-    0xa2, 0x9c, 0xa5, 0xba, 0xba, 0xa5, 0xba, 0xa5, 0x92, 0xa5, 0xa4, 0xa4,
-    0xba, 0xba, 0xb0, 0x92, 0x92, 0xa5, 0xa5, 0x92, 0xa5, 0xa5, 0xb6, 0xc0,
-    0xb6, 0x92, 0x88, 0xa5, 0xb8, 0x88, 0x88, 0xa4, 0xb6, 0xb0, 0xba, 0xb0,
-    0xa5, 0x88, 0x92, 0x92, 0x92, 0x9c, 0xa5, 0x9c, 0x88, 0x88, 0x8b, 0x94,
-    0x82, 0x88, 0xae, 0xae, 0x82, 0x74, 0x9c, 0xa4, 0x9c, 0xa9, 0xaa, 0xa9,
-    0x8c, 0x74, 0x9c, 0xb4, 0x94, 0x94, 0x94, 0x8b, 0x88, 0x94, 0x81, 0x6e,
-    0x8b, 0x6e, 0x9c, 0x9c, 0x9c, 0x99, 0x99, 0x81, 0x6e, 0x74, 0x64, 0x95,
-    0x99, 0x99, 0x81, 0x4e, 0x77, 0x79, 0x78, 0x65, 0x65, 0x84, 0x9d, 0xa0,
-    0x70, 0x4e, 0x5e, 0x7f, 0x5d, 0x34, 0x5e, 0x78, 0x70, 0x7f, 0x78, 0x4e,
-    0x3e, 0x3e, 0x50, 0x4e, 0x2f, 0x3e, 0x48, 0x33, 0x1a, 0x2d, 0x26, 0x3e,
-    0x3a, 0x58, 0x63, 0x47, 0xc3, 0xd7, 0xdc, 0xd7, 0xdc, 0xdc, 0xdc, 0xd7,
-    0xcf, 0xbb, 0xca, 0xd7, 0xce, 0xd7, 0xcf, 0xd7, 0xd4, 0xcf, 0xcf, 0xa8,
-    0xce, 0xd4, 0xda, 0xda, 0xd4, 0xd3, 0xd3, 0xd4, 0xc2, 0x0a, 0x20, 0x31,
-    0x4c, 0x25, 0x00, 0x08, 0x14, 0x18, 0x06, 0x06, 0x04, 0x25, 0x4c, 0x1e,
-    0x05, 0x0f, 0x1e, 0x16, 0x02, 0x0f, 0x19, 0x18, 0x1e, 0x25, 0x11, 0x00,
-    0x08, 0x00, 0x06, 0x08, 0x08, 0x08, 0x03, 0x02, 0x06, 0x03, 0x02, 0x0a,
-    0x13, 0x2e, 0x1e, 0x02, 0x0a, 0x08, 0x08, 0x11, 0x14, 0x1e, 0x14, 0x0f,
-    0x0a, 0x1e, 0x35, 0x2d, 0x1e, 0x1e, 0x28, 0x28, 0x08, 0x01, 0x06, 0x28,
-    0x28, 0x12, 0x12, 0x1d, 0x20, 0x1d, 0x44, 0x28, 0x11, 0x09, 0x25, 0x3c,
-    0x36, 0x38, 0x14, 0x06, 0x28, 0x3a, 0x43, 0x36, 0x38, 0x67, 0x67, 0x1a,
-    0x52, 0x8a, 0x8a, 0x58, 0x4d, 0x4d, 0x3a, 0x33, 0x5e, 0x5b, 0x48, 0x48,
-    0x4e, 0x5b, 0x79, 0x70, 0x70, 0x5e, 0x56, 0x4e, 0x4e, 0x70, 0x5b, 0x56,
-    0x93, 0x9f, 0x6c, 0x5d, 0x60, 0x70, 0x79, 0x91, 0x91, 0x91, 0x79, 0x50,
-    0x4e, 0x7f, 0x90, 0x70, 0x70, 0x81, 0x99, 0x73, 0x4e, 0x54, 0x7a, 0x99,
-    0x7a, 0x7a, 0x99, 0x84, 0x99, 0x9c, 0xab, 0x7a, 0x5a, 0x6e, 0xaa, 0x94,
-    0x95, 0x8e, 0x64, 0x74, 0xa9, 0xae, 0x9c, 0x9b, 0xab, 0xb4, 0x99, 0x94,
-    0xba, 0xb8, 0xa5, 0x9c, 0x9c, 0x9c, 0x8b, 0x92, 0xb6, 0x92, 0x92, 0xa4,
-    0xa5, 0x8d, 0xa4, 0xb0, 0xa5, 0x92, 0xa5, 0xa5, 0xa5, 0x8d, 0x88, 0xb0,
-    0xc0, 0xb0, 0x92, 0xa5, 0x92, 0xa5, 0xba, 0xb0, 0xb0, 0xae, 0x9c, 0x88,
-    0xa9, 0xba, 0xae, 0xa2, 0xae, 0xb6, 0xae, 0x88, 0x82, 0x92, 0xb6, 0xa4,
-    0xa5, 0xa5, 0x92, 0xa9, 0xad, 0xae, 0xa9, 0x94, 0x8b, 0x9c, 0x92, 0x92,
-    0x9c, 0x6e, 0x69, 0xa9, 0xad, 0xaa, 0x9c, 0xab, 0xbc, 0x99, 0x81, 0xb4,
-    0xbc, 0xb4, 0x94, 0x82, 0x88, 0x6e, 0x8e, 0xa2, 0x99, 0x8e, 0x7a, 0x8b,
-    0x8c, 0x8b, 0x8b, 0x94, 0x8e, 0x74, 0x73, 0x7f, 0x91, 0x65, 0x81, 0x9d,
-    0x9f, 0x5a, 0x70, 0x70, 0x7f, 0x90, 0x8e, 0x91, 0x73, 0x60, 0x48, 0x45,
-    0x6c, 0x78, 0x5b, 0x51, 0x70, 0x7f, 0x48, 0x26, 0x41, 0x70, 0x70, 0x70,
-    0x5b, 0x56, 0x58, 0x56, 0x5d, 0x6a, 0x47, 0x26, 0x3a, 0x5d, 0x3e, 0x3c,
-    0xbb, 0xcf, 0xd7, 0xe0, 0xdc, 0xd7, 0xdc, 0xe0, 0xdc, 0xa8, 0xbb, 0xe0,
-    0xe0, 0xdc, 0xcf, 0xcf, 0xcf, 0xce, 0xd4, 0xa8, 0xce, 0xce, 0xd3, 0xd4,
-    0xd4, 0xdc, 0xda, 0xd4, 0xc3, 0x13, 0x0d, 0x11, 0x01, 0x06, 0x26, 0x40,
-    0x1e, 0x06, 0x0a, 0x00, 0x11, 0x14, 0x14, 0x28, 0x11, 0x00, 0x0f, 0x1c,
-    0x35, 0x1c, 0x0f, 0x11, 0x1e, 0x0a, 0x00, 0x00, 0x08, 0x0a, 0x11, 0x11,
-    0x08, 0x0c, 0x0f, 0x1b, 0x1e, 0x0a, 0x0f, 0x08, 0x37, 0x46, 0x08, 0x08,
-    0x25, 0x0e, 0x08, 0x06, 0x00, 0x06, 0x19, 0x4c, 0x4b, 0x18, 0x2e, 0x55,
-    0x4f, 0x25, 0x08, 0x06, 0x37, 0x4f, 0x2e, 0x28, 0x11, 0x11, 0x14, 0x12,
-    0x39, 0x28, 0x04, 0x26, 0x61, 0x38, 0x4f, 0x3c, 0x47, 0x3f, 0x52, 0x5f,
-    0x47, 0x1d, 0x26, 0x3c, 0x36, 0x47, 0x7b, 0x7b, 0x12, 0x1d, 0x36, 0x66,
-    0x66, 0x2f, 0x47, 0x78, 0x96, 0x9a, 0x5e, 0x48, 0x3e, 0x34, 0x45, 0x48,
-    0x48, 0x96, 0x96, 0x7f, 0x79, 0x60, 0x41, 0x70, 0x96, 0x5e, 0x41, 0x79,
-    0x91, 0x60, 0x51, 0x45, 0x70, 0x9f, 0x99, 0x99, 0x9f, 0x84, 0x91, 0x9d,
-    0x9d, 0x65, 0x4e, 0x6e, 0xaf, 0x99, 0x8e, 0x69, 0x74, 0x7a, 0x8e, 0x9c,
-    0x99, 0x8e, 0x8e, 0xb4, 0x9c, 0x9c, 0xa9, 0x9c, 0x9c, 0x9c, 0xb4, 0xb4,
-    0x88, 0x8c, 0x9b, 0x9b, 0xa1, 0xad, 0xbc, 0x8b, 0x74, 0x8b, 0xae, 0xa5,
-    0x88, 0x92, 0xae, 0xba, 0xc0, 0xba, 0xa5, 0x92, 0x88, 0x8d, 0xa5, 0x9c,
-    0xba, 0xbf, 0xba, 0xb6, 0xa4, 0x8d, 0xa4, 0xb6, 0xa5, 0x88, 0xa5, 0xba,
-    0xa4, 0x92, 0x88, 0x9c, 0xae, 0xb8, 0xc0, 0xc0, 0xb6, 0xb6, 0xc0, 0xc0,
-    0xa5, 0x8b, 0x88, 0xb0, 0xba, 0xa5, 0x92, 0x92, 0x92, 0xa5, 0xa4, 0xb8,
-    0xa5, 0x88, 0xba, 0xba, 0xa5, 0xad, 0x92, 0xb0, 0xad, 0xae, 0xbc, 0xa2,
-    0x82, 0x9c, 0x9c, 0x9b, 0x9c, 0xbc, 0xaa, 0x69, 0x84, 0x8b, 0x9c, 0x8b,
-    0x74, 0x94, 0xb4, 0xbc, 0xb4, 0x99, 0x8c, 0x6e, 0x69, 0x6e, 0x81, 0x99,
-    0xb4, 0xac, 0x99, 0x9f, 0x81, 0x69, 0x8b, 0x9f, 0x5e, 0x54, 0x9f, 0x73,
-    0x54, 0x4e, 0x4e, 0x7f, 0x91, 0x9d, 0xa7, 0x90, 0x79, 0x93, 0xa7, 0x96,
-    0x48, 0x2f, 0x70, 0x91, 0x77, 0x5d, 0x48, 0x56, 0x60, 0x3e, 0x63, 0x5d,
-    0x3a, 0x58, 0x9a, 0x56, 0x5d, 0x6c, 0x56, 0x58, 0xc6, 0xe0, 0xdd, 0xd7,
-    0xdc, 0xdc, 0xd7, 0xd7, 0xe0, 0xc2, 0xa8, 0xd4, 0xd7, 0xdc, 0xd7, 0xcf,
-    0xd7, 0xdc, 0xe0, 0xc2, 0xd7, 0xd4, 0xcf, 0xce, 0xcf, 0xd4, 0xce, 0xda,
-    0xd0, 0x2e, 0x18, 0x1e, 0x00, 0x13, 0x47, 0x25, 0x02, 0x2b, 0x28, 0x01,
-    0x08, 0x00, 0x04, 0x13, 0x31, 0x44, 0x1c, 0x18, 0x4b, 0x4b, 0x37, 0x0a,
-    0x00, 0x08, 0x2e, 0x25, 0x1e, 0x0a, 0x03, 0x0e, 0x11, 0x2e, 0x37, 0x0f,
-    0x0c, 0x35, 0x2e, 0x18, 0x00, 0x03, 0x1e, 0x4f, 0x37, 0x0a, 0x1e, 0x28,
-    0x11, 0x08, 0x01, 0x1e, 0x1e, 0x0a, 0x17, 0x18, 0x2d, 0x2e, 0x12, 0x17,
-    0x1e, 0x25, 0x1e, 0x40, 0x28, 0x09, 0x0e, 0x12, 0x1d, 0x18, 0x28, 0x09,
-    0x14, 0x31, 0x06, 0x0e, 0x12, 0x0a, 0x4b, 0x7b, 0x7d, 0x3c, 0x3c, 0x31,
-    0x04, 0x06, 0x06, 0x47, 0x7b, 0x5f, 0x66, 0x28, 0x12, 0x32, 0x63, 0x58,
-    0x33, 0x2f, 0x27, 0x26, 0x3a, 0x48, 0x48, 0x70, 0x66, 0x3a, 0x63, 0x78,
-    0x56, 0x56, 0x4a, 0x48, 0x4e, 0x60, 0xa0, 0xaf, 0x65, 0x70, 0x65, 0x70,
-    0x41, 0x45, 0x65, 0x91, 0x70, 0x91, 0x7f, 0x7f, 0x98, 0x81, 0x73, 0x73,
-    0x91, 0x81, 0x99, 0x98, 0x6e, 0x69, 0x6e, 0x74, 0x81, 0x94, 0x8e, 0x65,
-    0x9c, 0x99, 0x57, 0x74, 0x81, 0x8e, 0xbc, 0xbc, 0x9c, 0x8b, 0x9c, 0x6e,
-    0x5e, 0x65, 0x7a, 0xb8, 0xad, 0xb4, 0x9c, 0x7a, 0x94, 0xae, 0xa9, 0x94,
-    0x88, 0x82, 0x8b, 0x9c, 0x92, 0x92, 0xa5, 0xb0, 0x9c, 0xa9, 0xa5, 0xa5,
-    0xa5, 0x92, 0x8d, 0x92, 0x92, 0xba, 0xbf, 0xba, 0x92, 0xa5, 0xb0, 0x92,
-    0x8b, 0x92, 0xb0, 0x92, 0xae, 0xae, 0xae, 0xba, 0xb0, 0xa5, 0xa5, 0x92,
-    0xa5, 0xae, 0xb8, 0xa9, 0x94, 0x8c, 0xa9, 0xa2, 0xa5, 0xa9, 0x94, 0x9c,
-    0xa5, 0x6e, 0x88, 0x94, 0x82, 0xae, 0xc0, 0xb0, 0x9c, 0x9c, 0x8c, 0x65,
-    0x5a, 0x69, 0xaa, 0xb4, 0xab, 0xab, 0x81, 0x81, 0x94, 0x9c, 0x8c, 0x65,
-    0x84, 0x65, 0x65, 0x69, 0x6e, 0x8e, 0x98, 0x81, 0x65, 0x84, 0x84, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x91, 0xaf, 0xac, 0x84, 0x69, 0x91, 0x70, 0x56,
-    0x56, 0x65, 0x70, 0x60, 0x85, 0x6a, 0x5e, 0x85, 0x5e, 0x6c, 0x78, 0x5e,
-    0x4e, 0x86, 0x6c, 0x3a, 0x3e, 0x56, 0x58, 0x58, 0x63, 0x2f, 0x3a, 0x6c,
-    0x3c, 0x1f, 0x2f, 0x1a, 0xc6, 0xe0, 0xe0, 0xdc, 0xdc, 0xd7, 0xce, 0xce,
-    0xcf, 0xbb, 0xc2, 0xdc, 0xd7, 0xcf, 0xcf, 0xd4, 0xdc, 0xd4, 0xd0, 0xa8,
-    0xce, 0xce, 0xcf, 0xce, 0xd3, 0xd7, 0xd4, 0xce, 0xc2, 0x26, 0x0f, 0x0a,
-    0x11, 0x08, 0x03, 0x11, 0x4f, 0x61, 0x25, 0x06, 0x1e, 0x14, 0x08, 0x07,
-    0x09, 0x13, 0x0a, 0x11, 0x0f, 0x18, 0x1e, 0x0d, 0x17, 0x0f, 0x0e, 0x0e,
-    0x17, 0x1e, 0x06, 0x00, 0x06, 0x0f, 0x05, 0x0c, 0x17, 0x08, 0x0f, 0x08,
-    0x08, 0x0f, 0x35, 0x1c, 0x03, 0x1e, 0x2e, 0x37, 0x13, 0x08, 0x0a, 0x00,
-    0x00, 0x11, 0x1c, 0x17, 0x0f, 0x1e, 0x44, 0x40, 0x11, 0x38, 0x4f, 0x31,
-    0x36, 0x4c, 0x20, 0x14, 0x39, 0x12, 0x06, 0x06, 0x12, 0x36, 0x47, 0x31,
-    0x28, 0x18, 0x1e, 0x08, 0x14, 0x52, 0x3c, 0x09, 0x1a, 0x52, 0x38, 0x31,
-    0x5c, 0x47, 0x36, 0x47, 0x7b, 0x63, 0x36, 0x20, 0x36, 0x66, 0x75, 0x5b,
-    0x9a, 0x9a, 0x78, 0x4e, 0x56, 0x3a, 0x32, 0x26, 0x5d, 0x86, 0x93, 0x6c,
-    0x4e, 0x77, 0x96, 0x4e, 0x65, 0x9f, 0x9d, 0x7f, 0x70, 0x7f, 0x60, 0x50,
-    0x4e, 0x7f, 0x70, 0x8e, 0x7f, 0x8e, 0xac, 0x73, 0x8e, 0xab, 0x99, 0x8b,
-    0x94, 0x8b, 0x81, 0x99, 0x99, 0x64, 0x84, 0x74, 0x99, 0x99, 0x9c, 0x94,
-    0x99, 0x98, 0x74, 0x81, 0x94, 0x9c, 0x6e, 0x6e, 0xa1, 0x9b, 0x7a, 0x9c,
-    0x9c, 0x9c, 0xa9, 0xae, 0xa5, 0xa2, 0x7a, 0x7a, 0xad, 0xb2, 0xa5, 0xbc,
-    0xc0, 0xba, 0xae, 0x9c, 0x9c, 0x82, 0x74, 0x9c, 0xb6, 0xba, 0xb0, 0xa5,
-    0xa5, 0xba, 0xa5, 0x92, 0xc0, 0xba, 0xba, 0xa5, 0xb0, 0xa5, 0x9c, 0x88,
-    0xad, 0xa5, 0xa5, 0xb8, 0xae, 0xba, 0xae, 0xa5, 0xba, 0xb0, 0xad, 0xb8,
-    0xae, 0x9c, 0xad, 0xb0, 0x9c, 0x94, 0x92, 0xa5, 0xa2, 0xae, 0xad, 0x9c,
-    0x94, 0x94, 0x74, 0x88, 0x92, 0x9c, 0x6e, 0x99, 0x9c, 0x8e, 0x98, 0xab,
-    0x98, 0x99, 0x82, 0x9c, 0x9c, 0x6e, 0x57, 0x84, 0xab, 0x99, 0x99, 0xb8,
-    0xb4, 0x94, 0x6e, 0x74, 0x57, 0x4e, 0x4e, 0x90, 0x9f, 0x98, 0x81, 0x65,
-    0x9f, 0x95, 0x4e, 0x73, 0xac, 0x91, 0x5a, 0x7f, 0x70, 0x4e, 0x48, 0x4e,
-    0x60, 0x70, 0x78, 0x6c, 0x7f, 0x96, 0x4e, 0x7f, 0x93, 0x5d, 0x70, 0x7f,
-    0x5b, 0x48, 0x78, 0x58, 0x26, 0x34, 0x3a, 0x56, 0x5d, 0x58, 0x3e, 0x4d,
-    0xc6, 0xcf, 0xd7, 0xd9, 0xd7, 0xcf, 0xcf, 0xda, 0xdc, 0xa8, 0xc2, 0xdc,
-    0xd7, 0xd7, 0xdc, 0xdc, 0xcf, 0xce, 0xcf, 0xbb, 0xdc, 0xd4, 0xdc, 0xe0,
-    0xda, 0xd4, 0xcf, 0xce, 0xbb, 0x08, 0x1e, 0x31, 0x38, 0x18, 0x0e, 0x28,
-    0x4f, 0x09, 0x0f, 0x38, 0x2e, 0x17, 0x03, 0x0e, 0x01, 0x00, 0x01, 0x11,
-    0x18, 0x0f, 0x08, 0x11, 0x38, 0x0a, 0x0f, 0x37, 0x1e, 0x0e, 0x1e, 0x2e,
-    0x08, 0x0f, 0x17, 0x07, 0x03, 0x07, 0x0a, 0x17, 0x2e, 0x21, 0x0c, 0x05,
-    0x05, 0x18, 0x17, 0x06, 0x00, 0x08, 0x17, 0x1e, 0x11, 0x08, 0x17, 0x37,
-    0x18, 0x04, 0x13, 0x1e, 0x1e, 0x17, 0x17, 0x0a, 0x08, 0x25, 0x25, 0x44,
-    0x31, 0x14, 0x1d, 0x38, 0x14, 0x0d, 0x1d, 0x31, 0x36, 0x28, 0x1f, 0x1a,
-    0x28, 0x36, 0x47, 0x1a, 0x33, 0x4d, 0x67, 0x5f, 0x0d, 0x3f, 0x52, 0x3e,
-    0x63, 0x3a, 0x3a, 0x56, 0x3a, 0x2f, 0x5d, 0x9a, 0x93, 0x6a, 0x58, 0x4d,
-    0x4e, 0x4e, 0x34, 0x45, 0x7f, 0x7f, 0x78, 0x85, 0x85, 0x5d, 0x3a, 0x3a,
-    0x7f, 0x7f, 0x4e, 0x4e, 0x60, 0x73, 0x73, 0x65, 0x65, 0x5e, 0x73, 0x99,
-    0x70, 0x70, 0x73, 0x81, 0x99, 0x73, 0x70, 0x54, 0x73, 0x9f, 0xa1, 0x7a,
-    0x99, 0x73, 0x9c, 0x94, 0x81, 0x6e, 0xa9, 0x9c, 0x94, 0xa2, 0x88, 0x8c,
-    0x94, 0xa4, 0x8b, 0x9c, 0x92, 0xad, 0xba, 0x7a, 0x7a, 0xa9, 0x9c, 0xae,
-    0xad, 0x9c, 0x92, 0x9c, 0x82, 0x92, 0xbc, 0xba, 0xae, 0x9c, 0x94, 0x92,
-    0xa5, 0xa4, 0x88, 0xa5, 0xb6, 0xa5, 0xb0, 0xb8, 0xa4, 0x88, 0x88, 0xa5,
-    0xb0, 0x92, 0x82, 0x92, 0xa4, 0xb6, 0xae, 0xa4, 0x92, 0x92, 0xba, 0xa5,
-    0x92, 0xa5, 0xa5, 0xae, 0xa5, 0x9c, 0x82, 0x9c, 0xae, 0xb0, 0xae, 0xa5,
-    0x9c, 0xa4, 0xae, 0x9c, 0x94, 0xae, 0x92, 0x9b, 0x9c, 0x92, 0x9c, 0x88,
-    0x92, 0x9c, 0x88, 0xad, 0xa9, 0xae, 0x94, 0x69, 0x9b, 0x94, 0x9c, 0x9c,
-    0x94, 0x74, 0x99, 0x81, 0x7a, 0x9c, 0xb4, 0xab, 0x7a, 0x5a, 0x84, 0x74,
-    0x74, 0x57, 0x73, 0x99, 0x99, 0x8e, 0x99, 0x84, 0x77, 0x4e, 0x4e, 0x91,
-    0x7f, 0x5d, 0x5e, 0x79, 0x81, 0x79, 0x65, 0x60, 0x4e, 0x70, 0x7f, 0x3e,
-    0x5d, 0x6c, 0x5d, 0x6c, 0x56, 0x3c, 0x33, 0x60, 0x78, 0x60, 0x56, 0x48,
-    0x4d, 0x6c, 0x3e, 0x27, 0x56, 0x56, 0x48, 0x4e, 0xc6, 0xd9, 0xd9, 0xd9,
-    0xd9, 0xd7, 0xd9, 0xd9, 0xe0, 0xc2, 0xa8, 0xd4, 0xd4, 0xd7, 0xdc, 0xd7,
-    0xd4, 0xd7, 0xcf, 0xa8, 0xd4, 0xe0, 0xdc, 0xdc, 0xd4, 0xd3, 0xd4, 0xd7,
-    0xc3, 0x08, 0x3d, 0x4f, 0x25, 0x2e, 0x40, 0x18, 0x0a, 0x03, 0x1c, 0x29,
-    0x07, 0x00, 0x03, 0x06, 0x0e, 0x11, 0x06, 0x00, 0x1e, 0x1e, 0x0e, 0x08,
-    0x07, 0x0f, 0x17, 0x0f, 0x02, 0x00, 0x11, 0x17, 0x1e, 0x1e, 0x08, 0x0a,
-    0x1c, 0x18, 0x02, 0x0e, 0x08, 0x1c, 0x1c, 0x05, 0x1c, 0x1b, 0x00, 0x02,
-    0x1e, 0x0e, 0x0a, 0x18, 0x38, 0x4f, 0x31, 0x06, 0x0e, 0x00, 0x01, 0x1c,
-    0x46, 0x0e, 0x00, 0x1e, 0x18, 0x12, 0x31, 0x3d, 0x1e, 0x28, 0x5c, 0x2e,
-    0x00, 0x0d, 0x14, 0x0d, 0x1f, 0x3a, 0x3a, 0x18, 0x1f, 0x52, 0x1f, 0x3c,
-    0x63, 0x63, 0x3a, 0x1f, 0x1a, 0x32, 0x58, 0x58, 0x2f, 0x3a, 0x48, 0x5d,
-    0x63, 0x66, 0x56, 0x34, 0x32, 0x3a, 0x75, 0x5e, 0x50, 0x48, 0x48, 0x5b,
-    0x45, 0x48, 0x34, 0x34, 0x5e, 0x78, 0x56, 0x45, 0x5e, 0x45, 0x32, 0x7f,
-    0x7f, 0x4e, 0x70, 0x73, 0x99, 0x9f, 0x60, 0x54, 0x7f, 0x70, 0x65, 0x9d,
-    0x91, 0x45, 0x54, 0x7f, 0x9f, 0x84, 0x99, 0x94, 0x74, 0xab, 0x99, 0x65,
-    0x6e, 0x8e, 0x74, 0x74, 0xa2, 0xa2, 0x88, 0x74, 0x9c, 0x8c, 0x94, 0x8d,
-    0xb0, 0xae, 0x94, 0x7a, 0x82, 0x9c, 0x92, 0x9c, 0x82, 0x9c, 0xa9, 0xa5,
-    0xae, 0x92, 0xa5, 0x94, 0x94, 0xae, 0xb8, 0xa5, 0x92, 0x8d, 0x92, 0xa5,
-    0x92, 0x8d, 0x8c, 0xa9, 0xa4, 0xa5, 0x9c, 0x92, 0xa9, 0x8b, 0xa4, 0xb6,
-    0x88, 0xa5, 0xa4, 0xb6, 0xc0, 0xa5, 0x92, 0xa5, 0xa5, 0x92, 0xb0, 0xb6,
-    0x82, 0x82, 0x92, 0x92, 0xad, 0xb0, 0xae, 0x92, 0xae, 0xbc, 0x94, 0x74,
-    0x94, 0x94, 0x88, 0x92, 0xae, 0xa4, 0x82, 0x88, 0x92, 0x94, 0x92, 0xb0,
-    0xb4, 0x8d, 0x6e, 0x7a, 0x82, 0x88, 0x94, 0x8c, 0x8b, 0x74, 0x9b, 0x9c,
-    0x94, 0x74, 0x6e, 0x5a, 0x84, 0x9f, 0x99, 0x74, 0x73, 0x81, 0x6e, 0x73,
-    0x65, 0x54, 0x70, 0x91, 0x7f, 0x5e, 0x70, 0x7f, 0x45, 0x45, 0x91, 0x65,
-    0x4e, 0x70, 0x81, 0x9f, 0x81, 0x45, 0x56, 0x5d, 0x43, 0x78, 0x91, 0x58,
-    0x27, 0x3e, 0x5b, 0x5b, 0x5b, 0x86, 0x5d, 0x56, 0x85, 0x58, 0x1f, 0x32,
-    0x33, 0x33, 0x58, 0x5d, 0xb7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xdc, 0xd8,
-    0xd7, 0x83, 0xa8, 0xcf, 0xd0, 0xd7, 0xcf, 0xd0, 0xc6, 0xdc, 0xd0, 0xa8,
-    0xd0, 0xd0, 0xc3, 0xc3, 0xd0, 0xda, 0xd0, 0xc3, 0x80, 0x1e, 0x14, 0x08,
-    0x01, 0x09, 0x18, 0x18, 0x07, 0x0f, 0x35, 0x21, 0x03, 0x0a, 0x1e, 0x00,
-    0x0a, 0x1e, 0x2e, 0x2e, 0x0a, 0x06, 0x06, 0x08, 0x08, 0x1c, 0x1e, 0x00,
-    0x03, 0x1c, 0x03, 0x00, 0x1e, 0x2b, 0x0e, 0x17, 0x37, 0x08, 0x00, 0x08,
-    0x2e, 0x0f, 0x18, 0x1c, 0x1b, 0x0c, 0x2e, 0x46, 0x1e, 0x37, 0x37, 0x11,
-    0x28, 0x38, 0x1c, 0x28, 0x1e, 0x13, 0x13, 0x06, 0x00, 0x08, 0x40, 0x61,
-    0x31, 0x06, 0x14, 0x13, 0x1d, 0x4f, 0x1d, 0x14, 0x0d, 0x12, 0x14, 0x10,
-    0x47, 0x26, 0x28, 0x67, 0x53, 0x1d, 0x10, 0x31, 0x3c, 0x75, 0x47, 0x2f,
-    0x63, 0x4d, 0x12, 0x10, 0x47, 0x48, 0x34, 0x3a, 0x5d, 0x63, 0x58, 0x33,
-    0x3a, 0x58, 0x51, 0x4d, 0x56, 0x78, 0xa7, 0x5e, 0x48, 0x78, 0x78, 0x6c,
-    0x70, 0x4e, 0x6c, 0x78, 0x5d, 0x60, 0x91, 0x73, 0x9f, 0xa7, 0x70, 0x90,
-    0x95, 0x79, 0x84, 0x9f, 0x90, 0x91, 0x73, 0x4e, 0x4a, 0x73, 0xaf, 0xaf,
-    0x70, 0x73, 0x84, 0x6e, 0x9f, 0xac, 0x84, 0x8e, 0x74, 0x94, 0x74, 0xa2,
-    0xa9, 0x81, 0xab, 0xab, 0x7a, 0x73, 0x8c, 0x74, 0xad, 0xae, 0x82, 0xa5,
-    0xae, 0x82, 0x73, 0x7a, 0x9c, 0x8d, 0x94, 0xae, 0xae, 0xa5, 0x9c, 0x88,
-    0xad, 0xae, 0xa2, 0x92, 0xb6, 0xba, 0xb0, 0xa9, 0x92, 0xa5, 0xa9, 0xb8,
-    0xa5, 0x92, 0xb8, 0xa9, 0x9c, 0xb8, 0xba, 0xb0, 0xc0, 0xae, 0xa4, 0xb6,
-    0xae, 0xa5, 0xb0, 0xa5, 0xa5, 0xae, 0x82, 0x74, 0x92, 0xbf, 0xc0, 0x8d,
-    0x82, 0xa9, 0x92, 0x92, 0xba, 0x92, 0x9c, 0x92, 0x9c, 0x94, 0x92, 0xae,
-    0x94, 0x9c, 0xbc, 0xad, 0x74, 0x94, 0x9c, 0x9c, 0xb8, 0x82, 0x9c, 0xad,
-    0x8b, 0x65, 0x65, 0x94, 0x8b, 0x74, 0x7a, 0x94, 0x94, 0x7a, 0x69, 0x8e,
-    0x9f, 0x84, 0x69, 0x7a, 0xaa, 0xaa, 0x7a, 0x65, 0x8e, 0x84, 0x91, 0x84,
-    0x70, 0x7f, 0x85, 0x5e, 0x79, 0x81, 0x8e, 0x99, 0x91, 0x65, 0x91, 0x91,
-    0x60, 0x7f, 0x91, 0x78, 0x6c, 0x4e, 0x27, 0x33, 0x86, 0x9a, 0x89, 0x27,
-    0x58, 0x45, 0x48, 0x75, 0x6a, 0x3a, 0x51, 0x3e, 0x33, 0x2f, 0x6a, 0x47,
-    0xa8, 0xd0, 0xc6, 0xbb, 0xbb, 0xc2, 0xc2, 0xc6, 0xc2, 0x83, 0xbb, 0xc2,
-    0xb3, 0xb3, 0xc2, 0xc2, 0xbb, 0xbb, 0xc2, 0x3c, 0x12, 0x07, 0x11, 0x2e,
-    0x2e, 0x11, 0x12, 0x3c, 0x67, 0x40, 0x0a, 0x1e, 0x1e, 0x1e, 0x37, 0x11,
-    0x2e, 0x1c, 0x11, 0x0e, 0x4b, 0x2e, 0x25, 0x37, 0x1e, 0x1e, 0x1e, 0x25,
-    0x1e, 0x18, 0x14, 0x0a, 0x0f, 0x02, 0x00, 0x17, 0x4b, 0x40, 0x08, 0x06,
-    0x0e, 0x08, 0x2e, 0x25, 0x00, 0x00, 0x03, 0x0a, 0x0f, 0x08, 0x0a, 0x28,
-    0x37, 0x17, 0x2e, 0x44, 0x11, 0x1e, 0x2b, 0x11, 0x06, 0x08, 0x11, 0x1e,
-    0x1e, 0x25, 0x37, 0x19, 0x28, 0x25, 0x2b, 0x40, 0x38, 0x20, 0x11, 0x14,
-    0x09, 0x0e, 0x1e, 0x1e, 0x1d, 0x0d, 0x14, 0x14, 0x28, 0x67, 0x53, 0x4c,
-    0x1d, 0x31, 0x7b, 0x58, 0x14, 0x06, 0x27, 0x63, 0x66, 0x48, 0x58, 0x28,
-    0x18, 0x3a, 0x5d, 0x48, 0x33, 0x3a, 0x58, 0x56, 0x3a, 0x26, 0x4d, 0x8a,
-    0x8a, 0x75, 0x86, 0x4e, 0x4e, 0x27, 0x56, 0x77, 0x51, 0x4e, 0x90, 0x96,
-    0x60, 0x70, 0x91, 0x4e, 0x4e, 0x90, 0x90, 0x60, 0x4e, 0x5e, 0x65, 0x5a,
-    0x9f, 0x9f, 0x65, 0x73, 0x84, 0x84, 0x99, 0x99, 0x9f, 0x8e, 0x65, 0x70,
-    0x70, 0x6e, 0x99, 0x7a, 0x7a, 0x6e, 0x94, 0x98, 0xab, 0xab, 0x99, 0x99,
-    0x95, 0xb4, 0xb8, 0x8c, 0x5a, 0x7a, 0xae, 0xae, 0xa2, 0x92, 0x94, 0x84,
-    0x99, 0xad, 0xa5, 0x94, 0x94, 0x92, 0xa5, 0x9c, 0x74, 0x88, 0xa5, 0xba,
-    0xba, 0xbc, 0xae, 0xae, 0x82, 0x82, 0xba, 0xae, 0x92, 0xb0, 0xc0, 0xb4,
-    0xa9, 0xb8, 0xa5, 0x94, 0xae, 0xba, 0xa4, 0x82, 0x88, 0xae, 0xa5, 0xae,
-    0xb8, 0xa5, 0xa5, 0xa4, 0xa4, 0xa5, 0xae, 0xba, 0xae, 0x8d, 0x94, 0x7a,
-    0x94, 0x92, 0xa5, 0x9c, 0x94, 0x88, 0x8d, 0x92, 0xbc, 0xab, 0x99, 0x8b,
-    0xad, 0xbc, 0xa9, 0x7a, 0x6e, 0x94, 0xad, 0xaa, 0x9c, 0x9c, 0x6e, 0x6e,
-    0x9c, 0xb4, 0x8e, 0x6e, 0x7a, 0x74, 0x7a, 0x65, 0x54, 0x84, 0xaf, 0xaf,
-    0x99, 0x9f, 0x8e, 0x65, 0x4e, 0x84, 0x91, 0x65, 0x81, 0x90, 0x9f, 0x60,
-    0x91, 0x84, 0x5e, 0x79, 0x99, 0x7f, 0x50, 0x4e, 0x5e, 0x60, 0x5e, 0x93,
-    0x78, 0x56, 0x6c, 0x78, 0x86, 0x75, 0x85, 0x85, 0x5b, 0x34, 0x36, 0x31,
-    0x58, 0x56, 0x58, 0x3a, 0x3a, 0x48, 0x34, 0x7b, 0xd0, 0xdc, 0xd7, 0xdc,
-    0xe0, 0xe0, 0xd4, 0xcf, 0xd7, 0xc2, 0xc2, 0xdc, 0xdc, 0xd7, 0xcf, 0xd4,
-    0xdc, 0xd7, 0xce, 0x23, 0x1d, 0x2e, 0x18, 0x0a, 0x14, 0x40, 0x67, 0x40,
-    0x38, 0x18, 0x11, 0x08, 0x1e, 0x38, 0x08, 0x06, 0x1d, 0x3d, 0x1c, 0x0f,
-    0x4b, 0x25, 0x0a, 0x2e, 0x2e, 0x0e, 0x00, 0x03, 0x0a, 0x11, 0x1e, 0x2e,
-    0x17, 0x0a, 0x17, 0x0c, 0x1e, 0x35, 0x18, 0x17, 0x0a, 0x08, 0x07, 0x05,
-    0x0a, 0x0a, 0x0a, 0x00, 0x13, 0x11, 0x08, 0x01, 0x03, 0x08, 0x0e, 0x0a,
-    0x37, 0x17, 0x02, 0x06, 0x00, 0x0a, 0x17, 0x08, 0x01, 0x00, 0x1e, 0x1c,
-    0x38, 0x37, 0x2e, 0x1e, 0x17, 0x25, 0x0e, 0x18, 0x61, 0x31, 0x28, 0x5f,
-    0x61, 0x28, 0x04, 0x1d, 0x26, 0x1f, 0x14, 0x0e, 0x31, 0x47, 0x31, 0x1d,
-    0x47, 0x31, 0x3a, 0x4d, 0x12, 0x26, 0x63, 0x5d, 0x3a, 0x3c, 0x43, 0x3e,
-    0x56, 0x3e, 0x33, 0x51, 0x3e, 0x3a, 0x32, 0x26, 0x28, 0x27, 0x33, 0x34,
-    0x58, 0x96, 0x96, 0x4e, 0x70, 0x70, 0x41, 0x3a, 0x48, 0x70, 0x70, 0x90,
-    0x7f, 0x48, 0x4e, 0x54, 0x54, 0x79, 0x54, 0x5a, 0x3e, 0x56, 0x91, 0x9f,
-    0x91, 0x84, 0x7f, 0x65, 0x8e, 0x81, 0x65, 0xac, 0xab, 0x95, 0xab, 0xbc,
-    0xab, 0x6e, 0x99, 0x9c, 0x73, 0x73, 0x69, 0x84, 0xab, 0xab, 0x6e, 0x9c,
-    0x8b, 0x94, 0xae, 0x82, 0x7a, 0x92, 0xba, 0xa9, 0x82, 0xab, 0x9c, 0xae,
-    0xae, 0x94, 0x8d, 0x9c, 0x94, 0x94, 0x7a, 0x84, 0x6e, 0x88, 0x8d, 0x82,
-    0xb8, 0xc0, 0x92, 0x92, 0xb0, 0x92, 0x82, 0x94, 0xa5, 0xa5, 0xb0, 0xba,
-    0x9c, 0x94, 0x8d, 0xa9, 0xad, 0x9c, 0x8d, 0x8b, 0x73, 0xa9, 0xb6, 0xb6,
-    0xae, 0xa5, 0x9c, 0xa2, 0xa5, 0x92, 0xa5, 0xc0, 0xa2, 0xae, 0xc0, 0xba,
-    0x9c, 0x94, 0xae, 0x9c, 0x7a, 0x8e, 0x7a, 0xab, 0xad, 0x95, 0x7a, 0x9c,
-    0x7a, 0x9c, 0x94, 0x6e, 0x99, 0xae, 0xaa, 0x8b, 0x7a, 0x99, 0x7a, 0x9c,
-    0x6e, 0x74, 0x7a, 0x65, 0x65, 0x70, 0x5d, 0x4e, 0x54, 0x70, 0x70, 0x91,
-    0xac, 0x91, 0x65, 0x91, 0x84, 0x45, 0x4e, 0x79, 0x65, 0x9d, 0x91, 0x60,
-    0x45, 0x4e, 0x4e, 0x60, 0x5e, 0x3e, 0x56, 0x1f, 0x3e, 0x78, 0x7f, 0x85,
-    0x6c, 0x66, 0x34, 0x5b, 0x56, 0x48, 0x93, 0x6a, 0x4d, 0x8a, 0x9a, 0x5d,
-    0x27, 0x3a, 0x5f, 0x26, 0xbb, 0xd7, 0xdc, 0xe0, 0xd7, 0xcf, 0xd7, 0xd7,
-    0xdc, 0xbb, 0xa8, 0xcf, 0xdc, 0xdc, 0xd7, 0xcf, 0xd4, 0xcf, 0xd4, 0x3b,
-    0x13, 0x0a, 0x10, 0x0a, 0x07, 0x0a, 0x11, 0x0e, 0x0a, 0x07, 0x09, 0x2e,
-    0x2e, 0x17, 0x20, 0x10, 0x01, 0x00, 0x04, 0x11, 0x00, 0x2e, 0x46, 0x08,
-    0x00, 0x00, 0x06, 0x11, 0x08, 0x00, 0x00, 0x0e, 0x1e, 0x1b, 0x1b, 0x17,
-    0x17, 0x08, 0x0a, 0x0f, 0x00, 0x35, 0x3f, 0x11, 0x1c, 0x61, 0x31, 0x0a,
-    0x19, 0x14, 0x08, 0x1e, 0x1e, 0x08, 0x03, 0x08, 0x0e, 0x18, 0x2e, 0x2b,
-    0x0a, 0x0e, 0x08, 0x08, 0x14, 0x0a, 0x17, 0x1e, 0x08, 0x11, 0x37, 0x14,
-    0x0d, 0x28, 0x1e, 0x0f, 0x11, 0x13, 0x31, 0x3d, 0x06, 0x13, 0x31, 0x36,
-    0x47, 0x06, 0x14, 0x47, 0x47, 0x0d, 0x06, 0x12, 0x36, 0x58, 0x2d, 0x09,
-    0x27, 0x4d, 0x58, 0x63, 0x63, 0x2f, 0x1a, 0x48, 0x3e, 0x3a, 0x58, 0x4e,
-    0x34, 0x56, 0x6c, 0x63, 0x66, 0x75, 0x86, 0x5e, 0x41, 0x5e, 0x6c, 0x7f,
-    0x70, 0x56, 0x6a, 0x60, 0x70, 0x4e, 0x4e, 0x60, 0x70, 0x79, 0x70, 0x7f,
-    0x60, 0x70, 0x4e, 0x4e, 0x95, 0x81, 0x70, 0x5a, 0x65, 0x8e, 0x81, 0x57,
-    0x69, 0x74, 0x81, 0x65, 0x65, 0x7a, 0x99, 0x73, 0x69, 0x99, 0x7a, 0x95,
-    0x73, 0x69, 0x9c, 0xb4, 0x7a, 0x5a, 0x69, 0x8b, 0xad, 0x9c, 0x73, 0x7a,
-    0x9c, 0x8d, 0xa9, 0xb4, 0xa9, 0x7a, 0x9c, 0x92, 0x8d, 0x88, 0x92, 0x9c,
-    0xa9, 0xae, 0xad, 0xab, 0xae, 0xb0, 0xae, 0x88, 0x8d, 0xa5, 0xa5, 0xb0,
-    0x92, 0xa5, 0xa5, 0xa5, 0x92, 0x88, 0x92, 0xa5, 0xa5, 0xa9, 0xae, 0x92,
-    0x9c, 0xa9, 0x82, 0xad, 0xae, 0xa2, 0xa2, 0x88, 0xad, 0xa5, 0x88, 0x9c,
-    0x92, 0x92, 0x9c, 0x82, 0xa9, 0xae, 0x9b, 0x7a, 0x9c, 0xa9, 0x92, 0x9b,
-    0x6e, 0x94, 0xb4, 0x9c, 0x69, 0x5a, 0x7a, 0x9c, 0xab, 0x7a, 0x69, 0x94,
-    0xaa, 0x9c, 0xae, 0x9c, 0x74, 0x81, 0x94, 0x8c, 0x6e, 0x7a, 0x6e, 0x6e,
-    0x8c, 0x99, 0x9f, 0x91, 0x9f, 0x9f, 0x73, 0x65, 0x81, 0x81, 0x8e, 0x69,
-    0x65, 0x70, 0x7f, 0x64, 0x60, 0x70, 0x65, 0x65, 0x6c, 0x70, 0x60, 0x4e,
-    0x5d, 0x3a, 0x5b, 0x85, 0x63, 0x5b, 0x51, 0x4e, 0x5e, 0x3e, 0x2f, 0x34,
-    0x58, 0x56, 0x4d, 0x34, 0x5b, 0x66, 0x27, 0x33, 0x66, 0x3e, 0x58, 0x26,
-    0xc2, 0xe0, 0xdd, 0xd7, 0xcf, 0xcf, 0xd7, 0xdc, 0xd4, 0x80, 0xbb, 0xd7,
-    0xd7, 0xd7, 0xdc, 0xcf, 0xce, 0xcf, 0xd4, 0x3b, 0x14, 0x12, 0x12, 0x1a,
-    0x1a, 0x25, 0x2b, 0x3c, 0x52, 0x25, 0x00, 0x14, 0x25, 0x1e, 0x26, 0x13,
-    0x14, 0x25, 0x0e, 0x00, 0x0e, 0x0f, 0x11, 0x1e, 0x2b, 0x11, 0x0f, 0x0a,
-    0x03, 0x0e, 0x11, 0x0e, 0x17, 0x00, 0x03, 0x0a, 0x2b, 0x02, 0x08, 0x0f,
-    0x07, 0x08, 0x02, 0x0a, 0x37, 0x0f, 0x00, 0x0f, 0x02, 0x17, 0x11, 0x0a,
-    0x11, 0x0a, 0x11, 0x11, 0x11, 0x17, 0x4f, 0x4b, 0x18, 0x08, 0x0a, 0x11,
-    0x14, 0x18, 0x28, 0x4f, 0x08, 0x0a, 0x11, 0x0d, 0x38, 0x4f, 0x40, 0x0a,
-    0x13, 0x26, 0x12, 0x04, 0x28, 0x31, 0x1e, 0x28, 0x3a, 0x53, 0x33, 0x3c,
-    0x1d, 0x31, 0x7b, 0x63, 0x28, 0x12, 0x1d, 0x26, 0x27, 0x1f, 0x10, 0x12,
-    0x3e, 0x5d, 0x34, 0x27, 0x58, 0x6c, 0x51, 0x3a, 0x51, 0x78, 0x7f, 0x8a,
-    0x78, 0x3e, 0x5d, 0x70, 0x5e, 0x4e, 0x48, 0x56, 0x56, 0x70, 0x70, 0x5d,
-    0x4e, 0x60, 0x93, 0x70, 0x70, 0xb1, 0xac, 0x91, 0x65, 0x50, 0x79, 0x65,
-    0x91, 0x65, 0x9f, 0x7f, 0x70, 0x81, 0x69, 0x99, 0xaf, 0xaf, 0x84, 0x70,
-    0x9f, 0x84, 0x54, 0x84, 0x99, 0x6e, 0x7a, 0x99, 0xa2, 0x94, 0x8b, 0x99,
-    0x9c, 0xae, 0xbc, 0xa2, 0x74, 0x74, 0x82, 0x8c, 0x8b, 0x65, 0x65, 0x99,
-    0xad, 0xa9, 0x9c, 0x94, 0x92, 0xa4, 0x94, 0x94, 0xae, 0xba, 0xb8, 0xb6,
-    0x92, 0x8d, 0x92, 0xa4, 0x9c, 0x82, 0x88, 0x9c, 0xb0, 0xb0, 0xae, 0xad,
-    0xa5, 0xb6, 0xa5, 0x8d, 0xb6, 0xc0, 0xba, 0xa5, 0x8c, 0x92, 0xae, 0xa5,
-    0xa5, 0xb4, 0xb0, 0x9c, 0x92, 0x92, 0x92, 0xba, 0xc0, 0xba, 0x94, 0x9c,
-    0xae, 0x99, 0x84, 0xab, 0x9b, 0x82, 0xa2, 0xae, 0xad, 0x9c, 0x94, 0x94,
-    0xad, 0xbc, 0xab, 0x7a, 0x6e, 0x74, 0x8b, 0x8b, 0x81, 0x57, 0x84, 0xa9,
-    0x9c, 0x8e, 0x81, 0x99, 0x99, 0x6e, 0x81, 0x7a, 0xab, 0xac, 0xab, 0x99,
-    0x64, 0x90, 0x99, 0x65, 0x54, 0x60, 0x57, 0x64, 0x91, 0x91, 0x70, 0x57,
-    0x91, 0x91, 0x57, 0x7f, 0xac, 0xa0, 0x79, 0x5b, 0x3e, 0x78, 0x78, 0x6c,
-    0x5e, 0x85, 0x4e, 0x56, 0x4e, 0x45, 0x70, 0x96, 0x9a, 0x34, 0x34, 0x5b,
-    0x34, 0x12, 0x3a, 0x66, 0x3a, 0x3a, 0x5d, 0x5b, 0xc6, 0xd9, 0xdc, 0xdc,
-    0xe0, 0xe0, 0xd7, 0xcf, 0xcf, 0xa8, 0xbb, 0xcf, 0xce, 0xce, 0xd7, 0xdc,
-    0xd7, 0xcf, 0xce, 0x49, 0x1d, 0x08, 0x12, 0x3c, 0x4f, 0x4f, 0x3c, 0x18,
-    0x11, 0x2e, 0x1e, 0x08, 0x0e, 0x0e, 0x14, 0x1d, 0x14, 0x19, 0x0d, 0x09,
-    0x37, 0x1e, 0x07, 0x46, 0x55, 0x46, 0x1e, 0x03, 0x11, 0x0e, 0x17, 0x1e,
-    0x37, 0x11, 0x00, 0x11, 0x08, 0x1c, 0x35, 0x35, 0x0e, 0x03, 0x08, 0x0a,
-    0x03, 0x07, 0x1e, 0x08, 0x00, 0x02, 0x0c, 0x1e, 0x0e, 0x1c, 0x25, 0x1e,
-    0x17, 0x17, 0x11, 0x11, 0x25, 0x40, 0x37, 0x38, 0x18, 0x02, 0x1d, 0x35,
-    0x1e, 0x1e, 0x28, 0x4f, 0x25, 0x04, 0x0e, 0x2e, 0x5c, 0x12, 0x11, 0x12,
-    0x44, 0x28, 0x06, 0x10, 0x31, 0x3c, 0x26, 0x12, 0x12, 0x44, 0x5f, 0x52,
-    0x47, 0x26, 0x52, 0x5d, 0x3c, 0x3a, 0x75, 0x2f, 0x2d, 0x56, 0x4d, 0x3e,
-    0x33, 0x3a, 0x3a, 0x3a, 0x4e, 0x45, 0x34, 0x32, 0x56, 0x5d, 0x4d, 0x5b,
-    0x70, 0x60, 0x70, 0x51, 0x32, 0x5b, 0x70, 0x70, 0x7f, 0x96, 0x4e, 0x85,
-    0x79, 0x70, 0x79, 0x81, 0x99, 0x99, 0x91, 0x84, 0x54, 0x65, 0x85, 0x65,
-    0x84, 0x81, 0x8b, 0xaa, 0x65, 0x79, 0x81, 0xac, 0x84, 0x70, 0x84, 0x7a,
-    0x99, 0x8e, 0x6e, 0x7a, 0x94, 0x94, 0x6e, 0x81, 0x94, 0xad, 0xad, 0x88,
-    0x88, 0x9c, 0xad, 0x9c, 0x94, 0xb4, 0x9c, 0x7a, 0xb4, 0x92, 0x9c, 0x94,
-    0x94, 0x88, 0x94, 0x9c, 0x9c, 0x94, 0x94, 0x9c, 0xa2, 0x88, 0x82, 0xa9,
-    0xa4, 0xae, 0x92, 0x82, 0x94, 0xae, 0xad, 0xae, 0xbc, 0x92, 0xa9, 0xba,
-    0xae, 0xa9, 0x92, 0xba, 0xba, 0xae, 0xb0, 0xa5, 0x92, 0x92, 0xa2, 0x92,
-    0xae, 0xa5, 0xba, 0xa9, 0x8e, 0x9c, 0xae, 0xb0, 0x94, 0x9c, 0xab, 0x9b,
-    0x9c, 0x88, 0x9c, 0xa9, 0xae, 0x9c, 0x82, 0x7a, 0xa9, 0xad, 0x92, 0x99,
-    0x99, 0xaa, 0xa2, 0x74, 0x9c, 0xb4, 0x74, 0x7a, 0xaa, 0x99, 0x84, 0x69,
-    0x74, 0x73, 0x84, 0x84, 0x84, 0x70, 0x65, 0x74, 0x81, 0x70, 0x73, 0x81,
-    0x7a, 0x84, 0x57, 0x4a, 0x7f, 0x84, 0x79, 0x9f, 0x91, 0x6c, 0x7f, 0x7f,
-    0x57, 0x65, 0x86, 0x90, 0x86, 0x85, 0x70, 0x56, 0x6c, 0x63, 0x5e, 0x5e,
-    0x6c, 0x7f, 0x78, 0x33, 0x3a, 0x58, 0x70, 0x3a, 0x32, 0x3a, 0x58, 0x58,
-    0x26, 0x32, 0x3e, 0x56, 0xc6, 0xd7, 0xd7, 0xdc, 0xe0, 0xe0, 0xdc, 0xd4,
-    0xd7, 0xc2, 0xc2, 0xd7, 0xe0, 0xd7, 0xcf, 0xdc, 0xd7, 0xd4, 0xce, 0x23,
-    0x12, 0x06, 0x11, 0x1d, 0x0d, 0x06, 0x1e, 0x2e, 0x1e, 0x1e, 0x14, 0x25,
-    0x37, 0x13, 0x08, 0x0e, 0x1d, 0x1e, 0x1e, 0x2e, 0x18, 0x17, 0x17, 0x0f,
-    0x0a, 0x1c, 0x35, 0x35, 0x25, 0x1c, 0x05, 0x08, 0x17, 0x11, 0x11, 0x0f,
-    0x1c, 0x35, 0x08, 0x08, 0x07, 0x18, 0x1e, 0x0a, 0x00, 0x08, 0x0f, 0x00,
-    0x0f, 0x0f, 0x19, 0x19, 0x07, 0x00, 0x00, 0x00, 0x08, 0x08, 0x0e, 0x08,
-    0x06, 0x08, 0x0a, 0x37, 0x1e, 0x0a, 0x0a, 0x17, 0x1c, 0x0e, 0x06, 0x0e,
-    0x01, 0x2e, 0x7d, 0x80, 0x28, 0x13, 0x1d, 0x11, 0x06, 0x12, 0x3c, 0x4c,
-    0x1a, 0x43, 0x58, 0x3c, 0x26, 0x1f, 0x10, 0x12, 0x3a, 0x3a, 0x26, 0x27,
-    0x5b, 0x75, 0x63, 0x75, 0x63, 0x2f, 0x48, 0x66, 0x3e, 0x33, 0x56, 0x3e,
-    0x5b, 0x6c, 0x5b, 0x78, 0x48, 0x50, 0x9f, 0x91, 0x60, 0x70, 0x5d, 0x5d,
-    0x78, 0x45, 0x5d, 0x5e, 0x41, 0x48, 0x2f, 0x48, 0x4e, 0x5e, 0x65, 0x4e,
-    0x45, 0x60, 0x7f, 0x64, 0x81, 0x91, 0x70, 0x84, 0x91, 0x65, 0x69, 0x64,
-    0x79, 0xaf, 0xbe, 0xac, 0x73, 0x84, 0x84, 0x65, 0x6e, 0x99, 0xa9, 0x99,
-    0x9c, 0xb4, 0xa2, 0x82, 0x7a, 0x81, 0x74, 0x88, 0x9c, 0x9c, 0x8e, 0xab,
-    0xbc, 0xbc, 0xb8, 0xb8, 0x9c, 0x9c, 0xae, 0x92, 0x9c, 0x9c, 0xa9, 0x9c,
-    0xae, 0xae, 0xb8, 0xae, 0x88, 0xb8, 0xc0, 0xa5, 0xb0, 0xad, 0x9c, 0xa5,
-    0xab, 0x9c, 0xab, 0x9c, 0x82, 0x7a, 0x95, 0x94, 0x9b, 0x92, 0x92, 0x6e,
-    0x94, 0x92, 0xa5, 0x92, 0xa5, 0x92, 0xa2, 0xae, 0x9c, 0x82, 0x94, 0x74,
-    0xae, 0xc0, 0xc0, 0x92, 0x9c, 0xa9, 0x8c, 0x7a, 0x9b, 0xad, 0xae, 0x9c,
-    0xa5, 0xba, 0x92, 0x88, 0x8c, 0x6e, 0x74, 0x9c, 0x9c, 0x98, 0xaa, 0xae,
-    0xad, 0xb4, 0xb4, 0x9c, 0x74, 0x9b, 0x99, 0x8e, 0x74, 0x95, 0x7a, 0x99,
-    0x9f, 0x95, 0x99, 0x69, 0x8e, 0xaf, 0x98, 0x8e, 0x9f, 0x65, 0x73, 0x91,
-    0x5a, 0x77, 0x70, 0x50, 0x56, 0x48, 0x56, 0x4a, 0x57, 0x79, 0x41, 0x33,
-    0x5b, 0x70, 0x5e, 0x70, 0x5e, 0x5d, 0x6c, 0x5e, 0x48, 0x48, 0x27, 0x48,
-    0x9a, 0x9a, 0x5d, 0x4d, 0x58, 0x3a, 0x1f, 0x33, 0x5d, 0x78, 0x3e, 0x66,
-    0xca, 0xe0, 0xd7, 0xd7, 0xcf, 0xcf, 0xd7, 0xda, 0xd7, 0xa8, 0xc2, 0xe0,
-    0xdc, 0xdc, 0xd7, 0xd7, 0xd4, 0xd7, 0xdc, 0x3b, 0x28, 0x18, 0x28, 0x4c,
-    0x44, 0x44, 0x2e, 0x12, 0x6d, 0x5c, 0x1e, 0x28, 0x18, 0x14, 0x28, 0x18,
-    0x19, 0x0a, 0x08, 0x08, 0x00, 0x00, 0x03, 0x08, 0x0a, 0x07, 0x08, 0x08,
-    0x0a, 0x1c, 0x0a, 0x0f, 0x07, 0x13, 0x0a, 0x00, 0x0f, 0x02, 0x03, 0x40,
-    0x61, 0x40, 0x08, 0x08, 0x0a, 0x07, 0x03, 0x02, 0x37, 0x1e, 0x0a, 0x08,
-    0x0e, 0x25, 0x2b, 0x11, 0x06, 0x0a, 0x01, 0x00, 0x1e, 0x31, 0x17, 0x00,
-    0x06, 0x14, 0x20, 0x31, 0x31, 0x25, 0x13, 0x0b, 0x20, 0x1e, 0x1e, 0x14,
-    0x06, 0x12, 0x1d, 0x4f, 0x61, 0x38, 0x1d, 0x13, 0x12, 0x0d, 0x0a, 0x28,
-    0x3f, 0x3c, 0x28, 0x1d, 0x26, 0x3a, 0x3c, 0x28, 0x36, 0x2e, 0x28, 0x2e,
-    0x2e, 0x3c, 0x58, 0x58, 0x3a, 0x28, 0x47, 0x63, 0x3e, 0x1f, 0x1f, 0x5d,
-    0x75, 0x5d, 0x3a, 0x27, 0x3e, 0x5d, 0x6c, 0x9a, 0x85, 0x70, 0x56, 0x56,
-    0x78, 0x85, 0x70, 0x54, 0x60, 0x79, 0x50, 0x60, 0x99, 0x73, 0x57, 0x64,
-    0x69, 0x6e, 0x99, 0x81, 0x81, 0x84, 0x73, 0x81, 0x84, 0x95, 0x65, 0x70,
-    0x81, 0x74, 0x98, 0xaf, 0xab, 0x8e, 0x84, 0x84, 0x65, 0x65, 0x8e, 0x9c,
-    0x99, 0x95, 0x8e, 0x7a, 0xa9, 0xa2, 0x7a, 0x8b, 0x94, 0x6e, 0x7a, 0x7a,
-    0x7a, 0x9b, 0x9c, 0x9c, 0x8b, 0x8b, 0xa2, 0x92, 0x8b, 0x74, 0x9c, 0xba,
-    0xa5, 0x9c, 0x7a, 0x8b, 0x92, 0xa2, 0xba, 0xba, 0xad, 0x9c, 0x94, 0x92,
-    0xae, 0xa5, 0x92, 0x92, 0xa4, 0x88, 0x94, 0xa5, 0xb6, 0xa2, 0x92, 0x92,
-    0xa4, 0xb6, 0xa4, 0x92, 0xb0, 0x92, 0x9c, 0xae, 0xa5, 0x9c, 0x94, 0x7a,
-    0x9b, 0xad, 0xb8, 0xbc, 0x94, 0x94, 0x99, 0x7a, 0x73, 0x7a, 0x9c, 0x9b,
-    0x94, 0x98, 0x7a, 0x98, 0xaa, 0x8e, 0x8e, 0x99, 0x73, 0x5a, 0x81, 0x65,
-    0x95, 0x94, 0x7a, 0x69, 0x69, 0x74, 0x74, 0x81, 0x57, 0x65, 0x8e, 0x99,
-    0x81, 0x70, 0x4e, 0x65, 0x91, 0x84, 0x9d, 0x8e, 0x65, 0x57, 0x70, 0x7f,
-    0x96, 0x73, 0x57, 0x57, 0x60, 0x45, 0x70, 0x91, 0x79, 0x4e, 0x60, 0x54,
-    0x65, 0x64, 0x86, 0x70, 0x4e, 0x45, 0x5b, 0x6c, 0x43, 0x39, 0x1f, 0x33,
-    0x56, 0x75, 0x86, 0x75, 0x3a, 0x3c, 0x3c, 0x12, 0xbb, 0xdc, 0xdc, 0xd7,
-    0xd7, 0xcf, 0xd4, 0xdc, 0xda, 0xa8, 0xbb, 0xcf, 0xce, 0xcf, 0xd7, 0xd0,
-    0xd7, 0xd0, 0xcf, 0x23, 0x14, 0x38, 0x1d, 0x06, 0x09, 0x1e, 0x38, 0x1e,
-    0x08, 0x04, 0x08, 0x1e, 0x18, 0x4c, 0x26, 0x14, 0x0d, 0x0e, 0x14, 0x37,
-    0x14, 0x08, 0x00, 0x00, 0x00, 0x08, 0x25, 0x2b, 0x08, 0x00, 0x02, 0x13,
-    0x25, 0x37, 0x1e, 0x19, 0x0e, 0x11, 0x1c, 0x11, 0x0c, 0x0f, 0x07, 0x07,
-    0x17, 0x4b, 0x35, 0x07, 0x08, 0x0a, 0x08, 0x0a, 0x1e, 0x37, 0x3d, 0x2b,
-    0x17, 0x08, 0x04, 0x04, 0x37, 0x46, 0x4f, 0x4f, 0x17, 0x04, 0x01, 0x0d,
-    0x4c, 0x31, 0x13, 0x11, 0x4f, 0x4f, 0x09, 0x14, 0x47, 0x14, 0x14, 0x28,
-    0x12, 0x09, 0x14, 0x14, 0x28, 0x12, 0x12, 0x58, 0x26, 0x18, 0x18, 0x52,
-    0x5f, 0x31, 0x47, 0x28, 0x06, 0x44, 0x7b, 0x5f, 0x5f, 0x47, 0x3c, 0x3a,
-    0x51, 0x58, 0x78, 0x66, 0x33, 0x5d, 0x6a, 0x2f, 0x3a, 0x5d, 0x6c, 0x51,
-    0x36, 0x27, 0x5d, 0x6c, 0x5e, 0x4e, 0x4e, 0x5e, 0x6c, 0x7f, 0x96, 0x79,
-    0x65, 0x70, 0x60, 0x91, 0x9d, 0x9d, 0xaf, 0x8e, 0x5a, 0x50, 0x57, 0x84,
-    0x99, 0x7f, 0x64, 0x99, 0xaa, 0x84, 0x7f, 0x99, 0x98, 0x74, 0x74, 0x81,
-    0x65, 0x95, 0x99, 0x6e, 0x6e, 0x69, 0x9c, 0x9c, 0x81, 0x6e, 0x94, 0xab,
-    0x99, 0x94, 0x94, 0x81, 0x7a, 0xae, 0xb4, 0xab, 0xab, 0x8c, 0x8c, 0xae,
-    0x88, 0x9c, 0xae, 0x9c, 0xa9, 0xba, 0x8c, 0x8b, 0x9c, 0xae, 0xae, 0x88,
-    0x74, 0x8d, 0xa5, 0xa5, 0x9c, 0x88, 0x92, 0xad, 0xb0, 0xba, 0xba, 0xa4,
-    0xa4, 0x8d, 0xa5, 0xba, 0xb6, 0xc0, 0xba, 0x92, 0x9c, 0x7a, 0x92, 0xba,
-    0xae, 0x88, 0x9c, 0xc0, 0xae, 0x82, 0xad, 0xa9, 0x9c, 0xa9, 0xa9, 0x84,
-    0x7a, 0xa9, 0x8b, 0x8c, 0x7a, 0x94, 0xb4, 0x7a, 0x6e, 0x94, 0xaa, 0x9c,
-    0x74, 0x8b, 0x69, 0x65, 0x9c, 0xab, 0xa1, 0x99, 0x95, 0x6e, 0x98, 0x94,
-    0x7a, 0xaa, 0x94, 0x74, 0xaa, 0x8e, 0x57, 0x5a, 0x91, 0x9f, 0x70, 0x45,
-    0x60, 0x84, 0x84, 0x84, 0x65, 0x5a, 0x5e, 0x7f, 0x91, 0x9d, 0x81, 0x64,
-    0x57, 0x60, 0x91, 0x9f, 0x9f, 0xa0, 0x70, 0x3e, 0x2f, 0x3e, 0x91, 0x78,
-    0x43, 0x48, 0x86, 0x7f, 0x3a, 0x4c, 0x72, 0x3e, 0x3a, 0x58, 0x3c, 0x26,
-    0x43, 0x52, 0x47, 0x28, 0xc2, 0xe0, 0xdc, 0xcf, 0xd7, 0xd7, 0xdc, 0xd7,
-    0xda, 0xa8, 0xb3, 0xd3, 0xdc, 0xdc, 0xdc, 0xdc, 0xcf, 0xcf, 0xd7, 0x3b,
-    0x3c, 0x52, 0x0a, 0x12, 0x31, 0x06, 0x1e, 0x2b, 0x19, 0x11, 0x00, 0x00,
-    0x1e, 0x1e, 0x1e, 0x11, 0x0a, 0x11, 0x20, 0x2e, 0x2b, 0x25, 0x13, 0x04,
-    0x03, 0x0e, 0x37, 0x38, 0x38, 0x1e, 0x08, 0x00, 0x00, 0x0f, 0x35, 0x0f,
-    0x08, 0x1c, 0x4b, 0x17, 0x03, 0x2b, 0x1c, 0x08, 0x0f, 0x11, 0x08, 0x0f,
-    0x01, 0x0a, 0x25, 0x40, 0x2e, 0x0a, 0x1c, 0x3d, 0x2e, 0x08, 0x0d, 0x14,
-    0x06, 0x00, 0x0e, 0x1c, 0x1e, 0x25, 0x4f, 0x28, 0x07, 0x11, 0x37, 0x2e,
-    0x1e, 0x0e, 0x06, 0x14, 0x25, 0x28, 0x25, 0x1e, 0x20, 0x13, 0x13, 0x11,
-    0x1e, 0x52, 0x2f, 0x12, 0x0a, 0x28, 0x3c, 0x53, 0x47, 0x47, 0x40, 0x47,
-    0x58, 0x53, 0x3c, 0x7b, 0x66, 0x47, 0x32, 0x56, 0x6a, 0x5d, 0x5d, 0x5b,
-    0x5b, 0x86, 0x85, 0x5b, 0x28, 0x1f, 0x5b, 0x78, 0x5d, 0x3e, 0x6a, 0x33,
-    0x48, 0x70, 0x90, 0x91, 0x56, 0x56, 0x96, 0x91, 0x50, 0x5e, 0x96, 0x70,
-    0x48, 0x5e, 0x7f, 0x77, 0x73, 0xa7, 0xb1, 0x7f, 0x4e, 0x73, 0x9f, 0x91,
-    0x65, 0x65, 0x73, 0x81, 0x8e, 0x99, 0x69, 0x7a, 0x74, 0x65, 0x84, 0x84,
-    0x9c, 0x9c, 0x6e, 0x65, 0x6e, 0x99, 0x9c, 0x9c, 0x98, 0xaa, 0x94, 0xa9,
-    0xad, 0x9c, 0x9c, 0xb8, 0xa9, 0x94, 0x9c, 0xad, 0xad, 0xa5, 0x92, 0xa9,
-    0xb8, 0xbc, 0xb4, 0x8b, 0x6e, 0x9c, 0xae, 0xa5, 0x9c, 0xad, 0x82, 0x98,
-    0xa5, 0xba, 0xc0, 0x92, 0x88, 0xba, 0xba, 0x92, 0x9c, 0xae, 0xae, 0x8c,
-    0x8b, 0x9c, 0xae, 0x9c, 0xb4, 0xbc, 0xae, 0x8b, 0x9c, 0xb0, 0xad, 0x8d,
-    0x9c, 0x92, 0x9b, 0x94, 0xad, 0x9c, 0x94, 0xae, 0x99, 0x74, 0x7a, 0x94,
-    0xad, 0x9c, 0x6e, 0x6e, 0x94, 0x9c, 0xab, 0x9c, 0x99, 0x99, 0x94, 0xab,
-    0x94, 0x8c, 0xb4, 0xa9, 0x95, 0x8b, 0x99, 0x94, 0x94, 0x94, 0x8b, 0x99,
-    0xaf, 0xab, 0x81, 0x60, 0x57, 0x73, 0x84, 0x65, 0x70, 0x5a, 0x4e, 0x65,
-    0x84, 0x9f, 0x9f, 0x5b, 0x7f, 0x9f, 0x81, 0x4e, 0x65, 0x91, 0x5d, 0x48,
-    0x56, 0x6a, 0x5d, 0x78, 0x8a, 0x96, 0x48, 0x2f, 0x5d, 0x78, 0x5b, 0x45,
-    0x4d, 0x47, 0x3a, 0x56, 0x58, 0x34, 0x58, 0x43, 0x26, 0x33, 0x2d, 0x66,
-    0x87, 0x83, 0x49, 0x83, 0x87, 0x83, 0x87, 0x80, 0xa8, 0x83, 0xa8, 0xa8,
-    0x83, 0x87, 0x87, 0x87, 0x6f, 0x87, 0xbb, 0x3b, 0x3c, 0x28, 0x3c, 0x4c,
-    0x4c, 0x1d, 0x0a, 0x0a, 0x11, 0x25, 0x11, 0x08, 0x14, 0x00, 0x0e, 0x1e,
-    0x37, 0x3d, 0x14, 0x06, 0x3d, 0x40, 0x06, 0x08, 0x1b, 0x0e, 0x00, 0x00,
-    0x17, 0x1e, 0x0f, 0x25, 0x35, 0x0f, 0x02, 0x1c, 0x28, 0x17, 0x07, 0x03,
-    0x00, 0x0c, 0x0a, 0x0a, 0x08, 0x0a, 0x1b, 0x0f, 0x08, 0x0a, 0x2b, 0x46,
-    0x46, 0x37, 0x0f, 0x08, 0x0e, 0x14, 0x0d, 0x11, 0x06, 0x0a, 0x0f, 0x00,
-    0x08, 0x13, 0x3f, 0x2e, 0x08, 0x08, 0x19, 0x25, 0x11, 0x01, 0x11, 0x1e,
-    0x44, 0x28, 0x31, 0x20, 0x12, 0x28, 0x4f, 0x5c, 0x36, 0x52, 0x5f, 0x12,
-    0x28, 0x5f, 0x47, 0x26, 0x58, 0x3a, 0x26, 0x7b, 0x7b, 0x3c, 0x12, 0x09,
-    0x1f, 0x58, 0x32, 0x3a, 0x2f, 0x26, 0x26, 0x3a, 0x5b, 0x2f, 0x1a, 0x5d,
-    0x78, 0x3e, 0x48, 0x48, 0x6c, 0x6a, 0x5e, 0x48, 0x32, 0x6c, 0x90, 0x9f,
-    0x9f, 0x85, 0x41, 0x5b, 0x70, 0x4e, 0x70, 0x5e, 0x5e, 0x70, 0x60, 0x48,
-    0x60, 0x7f, 0x73, 0x5e, 0x4a, 0x4e, 0x7f, 0x84, 0x65, 0x65, 0x81, 0x99,
-    0x98, 0x9c, 0x98, 0x8e, 0x99, 0xab, 0xab, 0x95, 0xab, 0xb4, 0x7a, 0x74,
-    0xad, 0xab, 0x7a, 0x9c, 0x9c, 0x8e, 0xa9, 0xbc, 0xae, 0x7a, 0x65, 0x73,
-    0xab, 0x9c, 0x9b, 0x94, 0x7a, 0x6e, 0x7a, 0x92, 0x94, 0x6e, 0x94, 0xba,
-    0x92, 0x82, 0x82, 0x92, 0xad, 0xa2, 0x88, 0x7a, 0x9c, 0xba, 0xbc, 0xc0,
-    0xba, 0x88, 0x88, 0x9c, 0x92, 0x9c, 0x9c, 0x9c, 0x9b, 0x9c, 0x8c, 0x7a,
-    0x9b, 0xa9, 0x9c, 0x7a, 0x7a, 0x9c, 0xad, 0x82, 0x8b, 0x9c, 0xa2, 0xad,
-    0xab, 0xa2, 0x9c, 0x9b, 0xab, 0xbc, 0x9b, 0x94, 0xba, 0xa9, 0x6e, 0xa9,
-    0xae, 0x94, 0x94, 0xaa, 0x99, 0x99, 0xab, 0xad, 0x8e, 0x5a, 0x60, 0x74,
-    0x99, 0x74, 0x69, 0x65, 0x65, 0x64, 0x81, 0x6e, 0x57, 0x60, 0x99, 0x8e,
-    0x69, 0x70, 0x65, 0x91, 0x91, 0x65, 0x57, 0x5e, 0x90, 0xa7, 0xb1, 0x9d,
-    0x70, 0x4e, 0x57, 0x79, 0x4e, 0x4e, 0x5d, 0x5d, 0x4e, 0x34, 0x33, 0x51,
-    0x66, 0x63, 0x33, 0x26, 0x58, 0x5b, 0x5b, 0x34, 0x4d, 0x43, 0x5d, 0x6a,
-    0x5d, 0x4d, 0x3a, 0x63, 0x7b, 0x75, 0x52, 0x7b, 0x7b, 0x31, 0x2f, 0x7b,
-    0x47, 0x31, 0x47, 0x4f, 0x1d, 0x61, 0x5f, 0x31, 0x06, 0x06, 0x12, 0x28,
-    0x28, 0x28, 0x12, 0x06, 0x06, 0x13, 0x28, 0x12, 0x06, 0x12, 0x26, 0x13,
-    0x09, 0x12, 0x25, 0x12, 0x0d, 0x11, 0x00, 0x17, 0x46, 0x5c, 0x4c, 0x1e,
-    0x09, 0x06, 0x11, 0x11, 0x08, 0x0a, 0x08, 0x0a, 0x03, 0x00, 0x08, 0x0f,
-    0x35, 0x0f, 0x03, 0x0f, 0x1c, 0x1c, 0x00, 0x00, 0x08, 0x0a, 0x2e, 0x18,
-    0x11, 0x0a, 0x0e, 0x1e, 0x11, 0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x0f,
-    0x0a, 0x00, 0x0a, 0x25, 0x0a, 0x0a, 0x0e, 0x0a, 0x4b, 0x61, 0x2e, 0x07,
-    0x1c, 0x4b, 0x4f, 0x0a, 0x00, 0x00, 0x08, 0x06, 0x0e, 0x06, 0x06, 0x39,
-    0x38, 0x14, 0x1e, 0x1e, 0x1d, 0x12, 0x28, 0x58, 0x7b, 0x52, 0x52, 0x1f,
-    0x12, 0x66, 0x66, 0x5f, 0x58, 0x47, 0x58, 0x5d, 0x3e, 0x47, 0x33, 0x1a,
-    0x2f, 0x66, 0x66, 0x3a, 0x3e, 0x5d, 0x5d, 0x34, 0x78, 0x9a, 0x3e, 0x4d,
-    0x78, 0x63, 0x34, 0x5d, 0x5d, 0x56, 0x48, 0x34, 0x5d, 0x4e, 0x4e, 0x60,
-    0x4e, 0x4e, 0x70, 0x70, 0x65, 0x65, 0x79, 0x90, 0xb1, 0x9f, 0x4e, 0x50,
-    0x90, 0xac, 0x7f, 0x4e, 0x54, 0x54, 0x65, 0x81, 0x65, 0x64, 0x7a, 0xaa,
-    0x8e, 0x74, 0x7a, 0x84, 0x6e, 0x65, 0x99, 0xbc, 0xaa, 0x94, 0x8c, 0x6e,
-    0x9c, 0xb4, 0xab, 0x9c, 0x9c, 0x9c, 0xa2, 0x9c, 0x9c, 0x9b, 0x99, 0x94,
-    0x9c, 0xa9, 0x94, 0x82, 0xad, 0xa9, 0x8c, 0x9c, 0xba, 0xad, 0x94, 0xa2,
-    0xb8, 0x82, 0x9c, 0x92, 0x8b, 0x88, 0x82, 0x9c, 0x92, 0x94, 0x9c, 0x92,
-    0x94, 0x9c, 0x92, 0xa2, 0x9c, 0x9c, 0xa2, 0xc0, 0xc0, 0x9c, 0x84, 0x9b,
-    0xbc, 0xad, 0x7a, 0x7a, 0x82, 0x88, 0x9c, 0x8b, 0x81, 0x94, 0xad, 0xab,
-    0x92, 0x9c, 0x82, 0x8c, 0x7a, 0x8c, 0xae, 0xbc, 0x9c, 0x94, 0x7a, 0x8b,
-    0xae, 0xaa, 0x9c, 0x9c, 0x99, 0xa2, 0x9c, 0x8e, 0x7a, 0x6e, 0x65, 0x84,
-    0x9f, 0x8e, 0x69, 0x9f, 0x99, 0x84, 0x64, 0x9d, 0x99, 0x70, 0x84, 0x99,
-    0x65, 0x5a, 0x84, 0x60, 0x54, 0x4e, 0x50, 0x65, 0x60, 0x60, 0x70, 0x60,
-    0x4e, 0x70, 0x70, 0x60, 0x5e, 0x6c, 0xa7, 0x9a, 0x72, 0x2f, 0x3e, 0x9a,
-    0x8a, 0x3a, 0x27, 0x34, 0x32, 0x27, 0x34, 0x27, 0x27, 0x51, 0x58, 0x3a,
-    0x58, 0x47, 0x26, 0x12, 0x26, 0x58, 0x7d, 0x66, 0x5f, 0x3c, 0x12, 0x53,
-    0x67, 0x61, 0x47, 0x39, 0x3c, 0x3a, 0x26, 0x26, 0x28, 0x12, 0x09, 0x26,
-    0x3d, 0x14, 0x13, 0x2e, 0x31, 0x14, 0x38, 0x61, 0x1e, 0x06, 0x25, 0x28,
-    0x0e, 0x28, 0x14, 0x06, 0x08, 0x00, 0x0a, 0x07, 0x08, 0x0f, 0x00, 0x00,
-    0x17, 0x18, 0x08, 0x08, 0x03, 0x1b, 0x4b, 0x4b, 0x0f, 0x00, 0x1b, 0x40,
-    0x1c, 0x02, 0x00, 0x00, 0x00, 0x07, 0x06, 0x08, 0x0a, 0x0a, 0x08, 0x0e,
-    0x28, 0x25, 0x11, 0x00, 0x00, 0x1e, 0x37, 0x2b, 0x1e, 0x0f, 0x08, 0x1e,
-    0x37, 0x09, 0x00, 0x0e, 0x18, 0x1b, 0x18, 0x18, 0x0f, 0x0a, 0x0e, 0x08,
-    0x17, 0x31, 0x28, 0x13, 0x28, 0x5f, 0x44, 0x11, 0x28, 0x5f, 0x47, 0x14,
-    0x12, 0x04, 0x18, 0x3f, 0x28, 0x18, 0x3a, 0x3c, 0x10, 0x00, 0x0d, 0x06,
-    0x06, 0x2f, 0x58, 0x56, 0x3a, 0x63, 0x5d, 0x43, 0x66, 0x75, 0x53, 0x1f,
-    0x33, 0x58, 0x75, 0x75, 0x48, 0x3e, 0x56, 0x5d, 0x3a, 0x43, 0x5e, 0x85,
-    0x96, 0x96, 0x45, 0x34, 0x4e, 0x7f, 0x91, 0x78, 0x70, 0x70, 0x57, 0x81,
-    0x84, 0x60, 0x60, 0x65, 0x84, 0x5a, 0x7f, 0x7f, 0x70, 0x4e, 0x5e, 0x5a,
-    0x91, 0xab, 0x84, 0x81, 0xb4, 0xab, 0x74, 0x81, 0xab, 0xaf, 0x73, 0x65,
-    0x65, 0x73, 0x99, 0x99, 0x6e, 0x94, 0x9c, 0x6e, 0x65, 0x65, 0x65, 0x65,
-    0x8e, 0x9c, 0x9c, 0x94, 0x9c, 0xbc, 0x9c, 0x9c, 0xad, 0xb4, 0x94, 0x74,
-    0x94, 0xab, 0xab, 0x92, 0x94, 0x88, 0x92, 0x9c, 0x94, 0xa9, 0xa5, 0xae,
-    0xba, 0xa9, 0x7a, 0x8b, 0xae, 0xa5, 0xa9, 0xa2, 0xa5, 0x94, 0xa5, 0xae,
-    0x92, 0x7a, 0x9c, 0xa9, 0x9c, 0x8d, 0x9c, 0x99, 0x8c, 0x7a, 0x82, 0xa9,
-    0xae, 0x92, 0x9c, 0xae, 0xc0, 0xab, 0x94, 0xad, 0xbc, 0x9c, 0x74, 0x8c,
-    0x74, 0x94, 0x9c, 0x74, 0x94, 0x9c, 0x94, 0x74, 0x5a, 0x5a, 0x5a, 0x69,
-    0x94, 0x94, 0x8b, 0x84, 0xac, 0xab, 0x84, 0x95, 0xac, 0x81, 0x57, 0x65,
-    0x8e, 0x99, 0x99, 0x73, 0x65, 0x81, 0x91, 0x5a, 0x65, 0x84, 0x8e, 0x9f,
-    0x91, 0x60, 0x50, 0x65, 0x91, 0x91, 0x70, 0x70, 0x60, 0x60, 0x91, 0x65,
-    0x48, 0x48, 0x6c, 0x63, 0x51, 0x5d, 0x5d, 0x3a, 0x33, 0x27, 0x48, 0x6c,
-    0x6c, 0x51, 0x5d, 0x9a, 0x78, 0x3a, 0x4d, 0x89, 0x63, 0x1f, 0x26, 0x10,
-    0x28, 0x58, 0x3c, 0x1f, 0x3a, 0x52, 0x1d, 0x04, 0x0a, 0x06, 0x06, 0x26,
-    0x3c, 0x53, 0x1a, 0x2d, 0x43, 0x38, 0x44, 0x5f, 0x40, 0x06, 0x04, 0x20,
-    0x31, 0x40, 0x1e, 0x0e, 0x25, 0x1e, 0x0a, 0x13, 0x1e, 0x37, 0x2e, 0x18,
-    0x0e, 0x00, 0x0f, 0x38, 0x37, 0x2e, 0x11, 0x08, 0x07, 0x25, 0x1c, 0x07,
-    0x07, 0x18, 0x17, 0x1b, 0x11, 0x08, 0x0a, 0x0f, 0x03, 0x0f, 0x17, 0x17,
-    0x0e, 0x0f, 0x2e, 0x4f, 0x11, 0x00, 0x18, 0x2e, 0x1e, 0x17, 0x08, 0x00,
-    0x00, 0x0e, 0x0a, 0x0a, 0x17, 0x1e, 0x18, 0x2b, 0x19, 0x13, 0x07, 0x0e,
-    0x13, 0x1e, 0x28, 0x38, 0x7d, 0x3d, 0x18, 0x31, 0x47, 0x4f, 0x44, 0x1d,
-    0x0d, 0x14, 0x12, 0x12, 0x31, 0x12, 0x12, 0x2f, 0x52, 0x1a, 0x2d, 0x12,
-    0x12, 0x38, 0x1a, 0x1d, 0x33, 0x4f, 0x31, 0x3c, 0x26, 0x2f, 0x33, 0x2d,
-    0x26, 0x1a, 0x39, 0x3a, 0x3a, 0x26, 0x26, 0x58, 0x56, 0x5d, 0x58, 0x58,
-    0x56, 0x56, 0x86, 0x56, 0x33, 0x5d, 0x6a, 0x6c, 0x89, 0x4e, 0x27, 0x34,
-    0x4e, 0x4e, 0x45, 0x6c, 0x78, 0x73, 0x81, 0x81, 0x81, 0x65, 0x70, 0x70,
-    0x60, 0x81, 0x84, 0xac, 0xaf, 0x90, 0x90, 0xb1, 0x99, 0x9d, 0x8e, 0x69,
-    0x74, 0x81, 0x69, 0x74, 0x74, 0x73, 0x7a, 0x99, 0x6e, 0x74, 0x84, 0x73,
-    0x99, 0x7a, 0x81, 0x94, 0x9c, 0x8e, 0x99, 0x94, 0x94, 0x74, 0x7a, 0x7a,
-    0x81, 0x95, 0x99, 0x9b, 0x82, 0x7a, 0x94, 0x92, 0x9c, 0x94, 0xa2, 0x92,
-    0x9c, 0xb0, 0xad, 0x88, 0x9c, 0xa5, 0x92, 0xae, 0xa9, 0x74, 0x74, 0x88,
-    0x82, 0x82, 0x88, 0x92, 0xae, 0xba, 0xa4, 0xa5, 0xa4, 0x92, 0x9c, 0x9c,
-    0xa9, 0xb8, 0xb8, 0xbc, 0xb8, 0xad, 0xbc, 0xbc, 0xba, 0xad, 0x8d, 0x9c,
-    0x92, 0x94, 0x9c, 0x9c, 0x8b, 0x8c, 0xa9, 0x9b, 0x94, 0xa2, 0x8e, 0x8c,
-    0xa2, 0x82, 0x6e, 0x94, 0x98, 0x7a, 0x8c, 0x84, 0x6e, 0x6e, 0x84, 0x70,
-    0x7f, 0x91, 0x7a, 0x84, 0x65, 0x65, 0x8e, 0x99, 0x8e, 0x81, 0x84, 0x81,
-    0x99, 0x99, 0x70, 0x54, 0x84, 0x84, 0x91, 0x7f, 0x4e, 0x48, 0x54, 0x57,
-    0x60, 0x4e, 0x6c, 0x7f, 0x91, 0x7f, 0x65, 0x73, 0x60, 0x54, 0x45, 0x56,
-    0x78, 0x79, 0xa0, 0x9a, 0x75, 0x89, 0x7f, 0x86, 0x78, 0x5d, 0x48, 0x58,
-    0x3a, 0x3a, 0x3e, 0x3f, 0x3c, 0x48, 0x5b, 0x47, 0x44, 0x28, 0x1a, 0x53,
-    0x26, 0x1d, 0x3a, 0x3c, 0x2e, 0x2d, 0x1d, 0x1d, 0x1d, 0x12, 0x0e, 0x11,
-    0x18, 0x31, 0x28, 0x06, 0x0e, 0x25, 0x1d, 0x1d, 0x09, 0x25, 0x28, 0x18,
-    0x4f, 0x1e, 0x08, 0x0e, 0x11, 0x1e, 0x2b, 0x11, 0x00, 0x00, 0x08, 0x0a,
-    0x08, 0x1e, 0x14, 0x1c, 0x17, 0x14, 0x1e, 0x0e, 0x08, 0x08, 0x07, 0x1e,
-    0x37, 0x38, 0x2e, 0x18, 0x1c, 0x2e, 0x35, 0x2b, 0x11, 0x0e, 0x0a, 0x17,
-    0x07, 0x08, 0x08, 0x08, 0x0a, 0x08, 0x1e, 0x38, 0x28, 0x2e, 0x2b, 0x1e,
-    0x25, 0x17, 0x2e, 0x2e, 0x08, 0x0e, 0x4f, 0x2e, 0x0a, 0x14, 0x14, 0x17,
-    0x0e, 0x12, 0x11, 0x06, 0x0e, 0x06, 0x14, 0x26, 0x06, 0x00, 0x04, 0x09,
-    0x0e, 0x01, 0x0a, 0x2f, 0x3c, 0x47, 0x58, 0x47, 0x2f, 0x18, 0x12, 0x31,
-    0x47, 0x5f, 0x72, 0x1f, 0x4d, 0x8a, 0x8a, 0x67, 0x26, 0x4f, 0x7d, 0x8a,
-    0x48, 0x2f, 0x48, 0x78, 0x5b, 0x2f, 0x3a, 0x33, 0x3a, 0x58, 0x3a, 0x48,
-    0x48, 0x78, 0x5d, 0x34, 0x5d, 0x70, 0x86, 0x96, 0x70, 0x7f, 0x79, 0x90,
-    0x90, 0x70, 0x91, 0x60, 0x45, 0x91, 0x9f, 0x7f, 0x65, 0x7f, 0x65, 0x54,
-    0x4e, 0x5a, 0x5e, 0x4e, 0x54, 0x65, 0x99, 0x8e, 0x57, 0x64, 0x81, 0x65,
-    0x54, 0x54, 0x84, 0x99, 0xab, 0x99, 0x9f, 0xab, 0x7a, 0x69, 0x74, 0x9c,
-    0x9c, 0xbc, 0x9c, 0x94, 0xae, 0xb4, 0xaa, 0x94, 0x99, 0xaf, 0xb8, 0x9c,
-    0x88, 0x94, 0xad, 0xae, 0x94, 0x7a, 0x8b, 0x94, 0x94, 0x94, 0x88, 0x9c,
-    0xa2, 0x92, 0x94, 0x9c, 0xae, 0xa9, 0xbc, 0xa5, 0xae, 0x92, 0xae, 0xbc,
-    0xae, 0xad, 0xb8, 0x82, 0x9c, 0xba, 0xa5, 0xa9, 0xad, 0xae, 0x9c, 0x8b,
-    0x9c, 0x9c, 0x94, 0x94, 0x8b, 0x92, 0xa5, 0x82, 0x6e, 0x94, 0x8c, 0x6e,
-    0x69, 0x7a, 0x92, 0xa5, 0xad, 0xaa, 0xaa, 0x94, 0x74, 0x7a, 0x94, 0x98,
-    0xb4, 0xab, 0x74, 0xab, 0xae, 0xab, 0x99, 0x84, 0x90, 0xb1, 0xab, 0x84,
-    0x65, 0x74, 0xab, 0x74, 0x65, 0x65, 0x65, 0x73, 0x65, 0x65, 0x73, 0x84,
-    0x91, 0x70, 0x4e, 0x65, 0x91, 0x9f, 0x8e, 0x73, 0x91, 0x7f, 0x90, 0x96,
-    0x78, 0x9a, 0x4e, 0x48, 0xa7, 0x91, 0x5d, 0x5d, 0x5d, 0x57, 0x48, 0x4d,
-    0x5b, 0x4d, 0x3a, 0x34, 0x48, 0x63, 0x48, 0x12, 0x26, 0x27, 0x18, 0x14,
-    0x2d, 0x3a, 0x48, 0x63, 0x58, 0x47, 0x47, 0x1f, 0x10, 0x26, 0x52, 0x52,
-    0x8a, 0x2d, 0x3c, 0x67, 0x7b, 0x4f, 0x18, 0x2e, 0x7d, 0x4f, 0x28, 0x14,
-    0x1d, 0x4c, 0x3d, 0x0d, 0x06, 0x06, 0x06, 0x0a, 0x06, 0x1e, 0x37, 0x2b,
-    0x11, 0x08, 0x17, 0x12, 0x40, 0x46, 0x37, 0x44, 0x37, 0x25, 0x2e, 0x1e,
-    0x37, 0x17, 0x00, 0x18, 0x38, 0x0e, 0x09, 0x0a, 0x06, 0x04, 0x08, 0x08,
-    0x0f, 0x05, 0x03, 0x08, 0x14, 0x11, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x18, 0x0a, 0x40, 0x2e, 0x2b, 0x28, 0x08, 0x17, 0x12, 0x08, 0x02,
-    0x08, 0x13, 0x14, 0x14, 0x1e, 0x25, 0x35, 0x11, 0x08, 0x28, 0x5f, 0x4c,
-    0x28, 0x20, 0x12, 0x1d, 0x09, 0x0d, 0x1e, 0x31, 0x38, 0x47, 0x3c, 0x2d,
-    0x3f, 0x52, 0x1d, 0x1d, 0x2d, 0x26, 0x28, 0x43, 0x43, 0x28, 0x36, 0x5f,
-    0x43, 0x26, 0x1a, 0x4d, 0x52, 0x1d, 0x2e, 0x2f, 0x48, 0x6c, 0x48, 0x3a,
-    0x48, 0x56, 0x48, 0x48, 0x56, 0x34, 0x3e, 0x8a, 0x9a, 0x56, 0x4d, 0x93,
-    0x89, 0x5d, 0x7f, 0x90, 0x79, 0x65, 0x4e, 0x77, 0x7f, 0x48, 0x41, 0x48,
-    0x4e, 0x7f, 0x60, 0x7f, 0x90, 0x84, 0x70, 0x4e, 0x79, 0x9f, 0xa7, 0x91,
-    0x84, 0x64, 0x84, 0x84, 0x81, 0x81, 0x99, 0x99, 0x94, 0x99, 0x8c, 0x9f,
-    0xab, 0x8e, 0x73, 0x7a, 0x99, 0x8b, 0x9c, 0x94, 0x8c, 0x99, 0xb2, 0xad,
-    0x8e, 0x6e, 0x99, 0xab, 0x8e, 0x57, 0x7f, 0x6e, 0xad, 0xa5, 0x9c, 0x94,
-    0x88, 0x9c, 0x94, 0x92, 0x9c, 0x94, 0xad, 0xc0, 0xae, 0x8b, 0xa5, 0xba,
-    0x9b, 0xad, 0xba, 0xba, 0xa4, 0x8d, 0x8d, 0xa5, 0x9c, 0x82, 0x7a, 0x94,
-    0x9c, 0x9c, 0x92, 0xa2, 0xad, 0x9c, 0x8b, 0x8b, 0xad, 0xbc, 0xa5, 0xae,
-    0x9c, 0x92, 0x9c, 0x82, 0x8d, 0xa9, 0xa9, 0xa9, 0xad, 0xae, 0x92, 0xae,
-    0x9c, 0x98, 0x8b, 0x94, 0x94, 0x94, 0x9c, 0x94, 0x95, 0xab, 0xb4, 0x7a,
-    0x65, 0x73, 0xa1, 0x95, 0x5d, 0x51, 0x54, 0x7a, 0xab, 0x99, 0x81, 0x74,
-    0x6e, 0x74, 0x81, 0x73, 0x70, 0x65, 0xac, 0xaf, 0x60, 0x7f, 0xab, 0x7f,
-    0x70, 0x99, 0x99, 0x84, 0x79, 0x60, 0x7f, 0x70, 0x3a, 0x3a, 0x3e, 0x5b,
-    0x4e, 0x56, 0x78, 0x78, 0x66, 0x48, 0x48, 0x5d, 0x85, 0x89, 0x78, 0x4e,
-    0x3e, 0x58, 0x33, 0x3a, 0x43, 0x66, 0x63, 0x63, 0x5d, 0x48, 0x5b, 0x63,
-    0x1f, 0x1f, 0x47, 0x26, 0x2f, 0x47, 0x26, 0x31, 0x3f, 0x67, 0x52, 0x12,
-    0x14, 0x1e, 0x4c, 0x1c, 0x1c, 0x14, 0x12, 0x47, 0x26, 0x17, 0x11, 0x14,
-    0x0d, 0x06, 0x0e, 0x11, 0x08, 0x4f, 0x7d, 0x25, 0x0e, 0x47, 0x2e, 0x0a,
-    0x28, 0x4f, 0x2b, 0x37, 0x17, 0x0f, 0x1e, 0x0e, 0x03, 0x06, 0x0a, 0x0e,
-    0x17, 0x11, 0x17, 0x25, 0x14, 0x00, 0x08, 0x38, 0x40, 0x1e, 0x0a, 0x08,
-    0x13, 0x0f, 0x08, 0x03, 0x11, 0x1b, 0x2b, 0x18, 0x0f, 0x08, 0x00, 0x06,
-    0x00, 0x00, 0x08, 0x1e, 0x00, 0x01, 0x06, 0x00, 0x0a, 0x4b, 0x2b, 0x02,
-    0x00, 0x08, 0x1b, 0x2e, 0x18, 0x17, 0x37, 0x4f, 0x25, 0x0d, 0x0e, 0x06,
-    0x4f, 0x80, 0x61, 0x40, 0x4f, 0x5c, 0x4f, 0x14, 0x04, 0x12, 0x67, 0x52,
-    0x06, 0x28, 0x28, 0x26, 0x58, 0x5c, 0x39, 0x4f, 0x1d, 0x0a, 0x28, 0x26,
-    0x52, 0x63, 0x5b, 0x2d, 0x2f, 0x2f, 0x2f, 0x48, 0x48, 0x3e, 0x51, 0x3e,
-    0x3e, 0x6a, 0x75, 0x1f, 0x1d, 0x43, 0x5d, 0x48, 0x48, 0x45, 0x41, 0x41,
-    0x45, 0x4e, 0x7f, 0x4e, 0x34, 0x4e, 0x4e, 0x50, 0xa0, 0x91, 0x5e, 0x45,
-    0x4e, 0x5e, 0x60, 0x79, 0x91, 0x91, 0x99, 0x98, 0x65, 0x54, 0x5d, 0x73,
-    0xb4, 0xaf, 0x99, 0x94, 0xa2, 0xaa, 0x8e, 0x65, 0x69, 0x9b, 0x9c, 0x69,
-    0x65, 0x8c, 0x7a, 0x99, 0xab, 0x99, 0x9f, 0x95, 0x70, 0x73, 0x8b, 0x94,
-    0xb4, 0xb4, 0x99, 0x6e, 0x8b, 0x88, 0x94, 0x94, 0x82, 0x9c, 0x92, 0x94,
-    0x9b, 0xad, 0x94, 0x5a, 0x74, 0xad, 0x8c, 0x7a, 0x94, 0x7a, 0x7a, 0x94,
-    0x8c, 0x9c, 0x9c, 0x7a, 0x94, 0x8d, 0x74, 0xb4, 0xb8, 0x9c, 0x8b, 0x7a,
-    0x8b, 0x95, 0x8c, 0x9b, 0x9b, 0xad, 0xae, 0x9c, 0x8c, 0x7a, 0x7a, 0xba,
-    0xbc, 0xad, 0xad, 0xad, 0xbc, 0xa9, 0x74, 0x74, 0xa2, 0xba, 0xa2, 0x81,
-    0x8c, 0x82, 0x94, 0xae, 0x9c, 0x95, 0xac, 0x70, 0x5e, 0x73, 0x81, 0x99,
-    0xab, 0x9f, 0x65, 0x73, 0x81, 0x73, 0x6e, 0x74, 0x74, 0x8b, 0x81, 0x7f,
-    0x9f, 0x91, 0x41, 0x3e, 0x90, 0x91, 0x56, 0x5e, 0x54, 0x4a, 0x4a, 0x54,
-    0x60, 0x81, 0x56, 0x34, 0x54, 0x50, 0x5d, 0x9a, 0x85, 0x48, 0x34, 0x3e,
-    0x4d, 0x58, 0x5d, 0x56, 0x5b, 0x85, 0x5d, 0x2f, 0x2f, 0x1f, 0x63, 0x9a,
-    0x8a, 0x63, 0x6c, 0x6c, 0x78, 0x34, 0x1d, 0x28, 0x75, 0x67, 0x10, 0x1a,
-    0x31, 0x26, 0x5f, 0x5f, 0x44, 0x40, 0x11, 0x06, 0x18, 0x1e, 0x31, 0x3c,
-    0x3a, 0x1d, 0x13, 0x11, 0x04, 0x0a, 0x0d, 0x0d, 0x12, 0x14, 0x11, 0x2e,
-    0x1e, 0x0a, 0x0e, 0x1e, 0x18, 0x0f, 0x0f, 0x06, 0x01, 0x00, 0x08, 0x07,
-    0x1b, 0x0a, 0x03, 0x07, 0x00, 0x00, 0x37, 0x40, 0x0a, 0x00, 0x00, 0x0f,
-    0x1c, 0x17, 0x0f, 0x18, 0x37, 0x1e, 0x08, 0x0f, 0x03, 0x13, 0x5c, 0x4b,
-    0x19, 0x19, 0x1c, 0x4f, 0x05, 0x0a, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x04, 0x01, 0x0a, 0x1e, 0x14, 0x0a, 0x02, 0x0e, 0x19, 0x0a, 0x1b, 0x40,
-    0x18, 0x0a, 0x0e, 0x08, 0x09, 0x25, 0x44, 0x1d, 0x18, 0x1e, 0x12, 0x18,
-    0x28, 0x11, 0x09, 0x14, 0x14, 0x10, 0x10, 0x1a, 0x52, 0x58, 0x26, 0x28,
-    0x14, 0x06, 0x11, 0x1e, 0x1a, 0x28, 0x1f, 0x10, 0x1d, 0x26, 0x33, 0x6d,
-    0x48, 0x34, 0x5b, 0x5b, 0x5d, 0x4d, 0x3a, 0x3a, 0x2f, 0x27, 0x2f, 0x3a,
-    0x75, 0x85, 0x5b, 0x48, 0x50, 0x4e, 0x56, 0x5d, 0x70, 0x4e, 0x56, 0x4e,
-    0x41, 0x4e, 0x70, 0x65, 0x5a, 0x41, 0x45, 0x79, 0x65, 0x79, 0xa0, 0x91,
-    0x60, 0x54, 0x50, 0x60, 0x84, 0x9d, 0x91, 0x60, 0x57, 0x81, 0x8e, 0x99,
-    0x99, 0x65, 0x6e, 0x7a, 0x73, 0x69, 0x84, 0xab, 0xab, 0x7a, 0x73, 0x69,
-    0x5a, 0x5e, 0x65, 0x6e, 0x99, 0x8c, 0x65, 0x69, 0x7a, 0x8b, 0xae, 0xa4,
-    0x94, 0x9c, 0x92, 0xa9, 0x9c, 0x7a, 0x95, 0x8b, 0x8b, 0x8b, 0x82, 0x9c,
-    0xad, 0xa9, 0x7a, 0x94, 0xa9, 0x88, 0x94, 0x88, 0x8d, 0x8d, 0x9c, 0x8b,
-    0x94, 0xad, 0xad, 0xa9, 0x7a, 0x6e, 0x9c, 0xa9, 0x9c, 0xb4, 0xad, 0x94,
-    0x8c, 0x6e, 0x69, 0x94, 0xae, 0xad, 0x8b, 0x6e, 0x99, 0x9c, 0x9c, 0xa9,
-    0x7a, 0x6e, 0x94, 0x74, 0x74, 0x74, 0xad, 0xb4, 0x9c, 0x74, 0x6e, 0x69,
-    0x5a, 0x5e, 0x73, 0x84, 0x7a, 0x65, 0x65, 0x64, 0x84, 0x99, 0xaa, 0x74,
-    0x74, 0x74, 0x98, 0x99, 0x7f, 0x65, 0x65, 0x57, 0x60, 0x5e, 0x70, 0x91,
-    0x9f, 0x60, 0x4e, 0x73, 0x65, 0x4e, 0x79, 0x7f, 0x54, 0x57, 0x4e, 0x48,
-    0x60, 0x65, 0x70, 0x51, 0x26, 0x45, 0x70, 0x5b, 0x78, 0x86, 0x56, 0x32,
-    0x36, 0x26, 0x33, 0x6a, 0x75, 0x58, 0x26, 0x3c, 0x47, 0x3e, 0x4d, 0x3c,
-    0x26, 0x2f, 0x2f, 0x1d, 0x1f, 0x3c, 0x5f, 0x5f, 0x26, 0x1d, 0x12, 0x09,
-    0x06, 0x11, 0x1e, 0x28, 0x14, 0x06, 0x0e, 0x11, 0x12, 0x44, 0x31, 0x0d,
-    0x17, 0x31, 0x4c, 0x14, 0x11, 0x17, 0x06, 0x0e, 0x06, 0x0a, 0x2b, 0x40,
-    0x11, 0x08, 0x17, 0x1e, 0x0e, 0x0a, 0x12, 0x0a, 0x08, 0x08, 0x03, 0x08,
-    0x25, 0x11, 0x07, 0x00, 0x02, 0x17, 0x0f, 0x0f, 0x35, 0x21, 0x0f, 0x03,
-    0x08, 0x08, 0x11, 0x2e, 0x1c, 0x0f, 0x0c, 0x16, 0x0a, 0x17, 0x17, 0x00,
-    0x08, 0x08, 0x17, 0x35, 0x1e, 0x07, 0x08, 0x00, 0x1e, 0x11, 0x11, 0x07,
-    0x04, 0x0e, 0x38, 0x62, 0x46, 0x0d, 0x0f, 0x4b, 0x4b, 0x2e, 0x31, 0x4c,
-    0x28, 0x1d, 0x31, 0x28, 0x2b, 0x40, 0x1e, 0x0a, 0x11, 0x28, 0x52, 0x4f,
-    0x40, 0x1d, 0x28, 0x1d, 0x2e, 0x1d, 0x28, 0x3c, 0x33, 0x26, 0x10, 0x0d,
-    0x58, 0x3a, 0x14, 0x26, 0x63, 0x8a, 0x67, 0x63, 0x63, 0x56, 0x56, 0x34,
-    0x33, 0x5d, 0x6a, 0x58, 0x5d, 0x78, 0x3e, 0x48, 0x78, 0x5d, 0x5d, 0x4e,
-    0x4e, 0x70, 0x90, 0x7f, 0x4e, 0x5d, 0x5b, 0x85, 0x93, 0x5e, 0x50, 0x4e,
-    0x4e, 0x79, 0x9f, 0x91, 0x96, 0x70, 0x96, 0x9d, 0x91, 0x81, 0xaa, 0x99,
-    0x81, 0x81, 0x95, 0x90, 0x9d, 0x8e, 0x57, 0x65, 0x81, 0x94, 0xaf, 0x9d,
-    0x8e, 0x84, 0x73, 0x6e, 0x95, 0x65, 0x8e, 0x7a, 0x74, 0x6e, 0x65, 0x8c,
-    0xab, 0x81, 0x74, 0x9c, 0xab, 0xae, 0xaa, 0xa4, 0x92, 0xae, 0x88, 0x94,
-    0x9c, 0xad, 0x9c, 0x9c, 0xae, 0x8d, 0x9c, 0xad, 0x9b, 0x9c, 0xa9, 0x88,
-    0x88, 0xae, 0xae, 0x9c, 0x8d, 0x82, 0xa9, 0xba, 0xa9, 0x9c, 0x9c, 0x94,
-    0x9c, 0xb8, 0xb8, 0xad, 0x9b, 0x9b, 0xbc, 0xad, 0x9c, 0xae, 0xba, 0x92,
-    0x8d, 0xa5, 0xa9, 0xad, 0xad, 0x8c, 0x84, 0x8b, 0x9c, 0xae, 0xae, 0xa2,
-    0x82, 0x82, 0x94, 0x9c, 0x84, 0x8e, 0x94, 0x8b, 0x74, 0x65, 0x69, 0x9c,
-    0x7a, 0x65, 0x6e, 0xaa, 0xad, 0xab, 0x98, 0x98, 0x94, 0x8e, 0x65, 0x73,
-    0x99, 0x99, 0x84, 0x8b, 0x95, 0x70, 0x77, 0x84, 0x7f, 0x5a, 0x65, 0x70,
-    0x84, 0x91, 0x7f, 0x70, 0x60, 0x70, 0x91, 0x93, 0x57, 0x54, 0x45, 0x5d,
-    0x85, 0x96, 0x7f, 0x60, 0x5d, 0x85, 0x8a, 0x5d, 0x5d, 0x86, 0x85, 0x56,
-    0x5b, 0x5d, 0x63, 0x75, 0x4d, 0x2f, 0x33, 0x3a, 0x75, 0x5d, 0x58, 0x33,
-    0x33, 0x1d, 0x44, 0x26, 0x1d, 0x3c, 0x26, 0x28, 0x1d, 0x06, 0x4f, 0x52,
-    0x0d, 0x11, 0x44, 0x61, 0x4f, 0x58, 0x38, 0x28, 0x47, 0x14, 0x0a, 0x1e,
-    0x31, 0x25, 0x25, 0x28, 0x1e, 0x17, 0x1e, 0x17, 0x0e, 0x06, 0x11, 0x0e,
-    0x37, 0x29, 0x14, 0x06, 0x02, 0x13, 0x25, 0x11, 0x0a, 0x08, 0x06, 0x1e,
-    0x46, 0x46, 0x1e, 0x03, 0x1c, 0x1c, 0x17, 0x11, 0x1e, 0x31, 0x1e, 0x1e,
-    0x17, 0x0a, 0x1c, 0x1c, 0x0f, 0x0a, 0x0a, 0x1e, 0x0a, 0x17, 0x0f, 0x0f,
-    0x0a, 0x11, 0x08, 0x08, 0x1e, 0x2e, 0x0e, 0x08, 0x0a, 0x11, 0x46, 0x25,
-    0x0e, 0x08, 0x00, 0x17, 0x18, 0x14, 0x11, 0x11, 0x00, 0x08, 0x18, 0x13,
-    0x0d, 0x18, 0x18, 0x38, 0x1e, 0x0a, 0x1e, 0x0e, 0x2e, 0x4f, 0x28, 0x11,
-    0x12, 0x52, 0x52, 0x12, 0x2d, 0x72, 0x8a, 0x43, 0x47, 0x75, 0x89, 0x5f,
-    0x2f, 0x58, 0x4d, 0x1a, 0x1d, 0x28, 0x27, 0x5b, 0x5b, 0x3e, 0x78, 0xb3,
-    0x96, 0x6c, 0x85, 0x27, 0x1a, 0x4d, 0x45, 0x60, 0x7f, 0x70, 0x4e, 0x45,
-    0x4e, 0x5e, 0x41, 0x4e, 0x86, 0x70, 0x50, 0x60, 0x4e, 0x90, 0xa0, 0x56,
-    0x5d, 0x56, 0x58, 0x5d, 0x79, 0x8e, 0x65, 0x70, 0x57, 0x81, 0x84, 0x84,
-    0x84, 0x65, 0x7f, 0x79, 0x54, 0x73, 0x65, 0x64, 0x99, 0x84, 0x57, 0x5a,
-    0x7a, 0xaf, 0x84, 0x65, 0xb4, 0xbc, 0xad, 0x8b, 0xa9, 0xbc, 0xb4, 0x98,
-    0xa2, 0xa2, 0x99, 0x73, 0x81, 0x6e, 0x94, 0xa2, 0x9c, 0x92, 0xc0, 0xbf,
-    0xae, 0xb8, 0x9c, 0x65, 0x74, 0x8b, 0x8c, 0xad, 0xa5, 0x88, 0x94, 0x9c,
-    0xa4, 0x88, 0x74, 0xad, 0xae, 0x7a, 0x94, 0x94, 0xae, 0xba, 0x94, 0x6e,
-    0x82, 0x73, 0x90, 0x99, 0x9c, 0x9c, 0x8c, 0x74, 0x98, 0x88, 0x82, 0x9b,
-    0x99, 0x8e, 0x8c, 0x6e, 0x74, 0x6e, 0x6e, 0x8b, 0x99, 0x8e, 0x6e, 0x7a,
-    0xb4, 0xab, 0x81, 0x94, 0xbc, 0xba, 0x8b, 0x9c, 0xb4, 0xb4, 0x99, 0x8e,
-    0x8b, 0x84, 0x70, 0x5e, 0x70, 0x65, 0x74, 0x74, 0x74, 0xaa, 0xbc, 0x99,
-    0x99, 0x9f, 0x45, 0x45, 0x5e, 0x54, 0x64, 0x81, 0x73, 0x5e, 0x4a, 0x70,
-    0x57, 0x50, 0x57, 0x96, 0x5b, 0x4e, 0x5d, 0x51, 0x96, 0x70, 0x2f, 0x3e,
-    0x2f, 0x3c, 0x58, 0x63, 0x56, 0x58, 0x3a, 0x32, 0x5d, 0x56, 0x58, 0x58,
-    0x2f, 0x3a, 0x36, 0x12, 0x26, 0x1d, 0x26, 0x5f, 0x47, 0x1f, 0x1a, 0x5c,
-    0x5f, 0x12, 0x28, 0x67, 0x7b, 0x58, 0x47, 0x5f, 0x75, 0x47, 0x20, 0x28,
-    0x31, 0x17, 0x0a, 0x12, 0x1e, 0x1a, 0x2e, 0x11, 0x28, 0x80, 0x61, 0x2e,
-    0x28, 0x06, 0x00, 0x06, 0x0e, 0x11, 0x1e, 0x1e, 0x11, 0x06, 0x0d, 0x08,
-    0x08, 0x0b, 0x25, 0x19, 0x01, 0x08, 0x0e, 0x2e, 0x38, 0x08, 0x0f, 0x0a,
-    0x08, 0x0c, 0x07, 0x08, 0x06, 0x06, 0x08, 0x0a, 0x0f, 0x08, 0x04, 0x0b,
-    0x0e, 0x1e, 0x0f, 0x0c, 0x14, 0x14, 0x07, 0x08, 0x0a, 0x17, 0x14, 0x11,
-    0x0a, 0x0e, 0x06, 0x0e, 0x1e, 0x0f, 0x00, 0x00, 0x0e, 0x37, 0x19, 0x2b,
-    0x0a, 0x08, 0x0a, 0x0a, 0x14, 0x14, 0x0a, 0x12, 0x04, 0x06, 0x31, 0x2b,
-    0x25, 0x14, 0x18, 0x2e, 0x11, 0x14, 0x37, 0x1a, 0x1d, 0x1a, 0x52, 0x3a,
-    0x2e, 0x28, 0x1f, 0x43, 0x33, 0x3a, 0x58, 0x43, 0x1f, 0x06, 0x06, 0x2d,
-    0x8a, 0x7b, 0x5f, 0x2f, 0x12, 0x28, 0x27, 0x27, 0x3e, 0x34, 0x5b, 0x89,
-    0x85, 0x58, 0x56, 0x79, 0x7f, 0x56, 0x48, 0x70, 0x70, 0x5d, 0x7f, 0x70,
-    0x4e, 0x5d, 0x4a, 0x70, 0x6c, 0x34, 0x2f, 0x5d, 0x8a, 0x91, 0x78, 0x4e,
-    0x4e, 0x57, 0x57, 0x64, 0x91, 0x69, 0x70, 0x70, 0x4e, 0x65, 0x9f, 0x84,
-    0x84, 0x65, 0x91, 0x84, 0x70, 0x90, 0x73, 0x84, 0x90, 0x99, 0x99, 0x99,
-    0x7a, 0x74, 0x9c, 0x99, 0x94, 0x9c, 0xaa, 0x82, 0x65, 0x69, 0x6e, 0xb4,
-    0xbc, 0x9c, 0x94, 0x6e, 0x65, 0x65, 0x74, 0x94, 0x94, 0x94, 0xae, 0xbc,
-    0x9c, 0x8c, 0xae, 0xad, 0xae, 0x88, 0x88, 0x9c, 0x82, 0x9c, 0xad, 0x9c,
-    0x9c, 0x82, 0x88, 0x92, 0x82, 0x65, 0x6e, 0x9c, 0xad, 0x9c, 0x99, 0x6e,
-    0x82, 0x94, 0x8b, 0x9c, 0xa2, 0x88, 0x94, 0x73, 0x7a, 0x9c, 0x9c, 0x9c,
-    0x8e, 0x8c, 0x99, 0x74, 0x73, 0x7a, 0x99, 0x6e, 0x7a, 0xa9, 0x94, 0x7a,
-    0x84, 0x94, 0x94, 0x6e, 0x99, 0x9c, 0x95, 0x54, 0x5e, 0x4e, 0x81, 0xaf,
-    0x98, 0x81, 0x65, 0x4e, 0x56, 0x4e, 0x70, 0x81, 0x65, 0x73, 0x90, 0x9f,
-    0x57, 0x65, 0x99, 0x91, 0x4e, 0x5e, 0x7f, 0x60, 0x70, 0x91, 0x70, 0x4e,
-    0x45, 0x4e, 0x6c, 0x3e, 0x28, 0x1a, 0x4e, 0x85, 0x85, 0x58, 0x36, 0x2f,
-    0x34, 0x3a, 0x56, 0x6c, 0x34, 0x3a, 0x33, 0x26, 0x48, 0x58, 0x53, 0x28,
-    0x28, 0x53, 0x28, 0x1f, 0x36, 0x44, 0x3c, 0x28, 0x52, 0x5f, 0x26, 0x12,
-    0x26, 0x3a, 0x28, 0x26, 0x52, 0x26, 0x12, 0x06, 0x01, 0x17, 0x52, 0x4d,
-    0x2e, 0x11, 0x08, 0x00, 0x0a, 0x0e, 0x09, 0x11, 0x11, 0x38, 0x5f, 0x14,
-    0x13, 0x28, 0x25, 0x17, 0x0a, 0x11, 0x11, 0x11, 0x13, 0x0e, 0x0b, 0x06,
-    0x02, 0x13, 0x14, 0x06, 0x02, 0x00, 0x11, 0x1e, 0x11, 0x0f, 0x02, 0x00,
-    0x06, 0x0f, 0x0f, 0x03, 0x08, 0x08, 0x00, 0x0f, 0x17, 0x0a, 0x17, 0x0f,
-    0x00, 0x00, 0x18, 0x1c, 0x17, 0x17, 0x0a, 0x11, 0x19, 0x0a, 0x1e, 0x46,
-    0x1e, 0x0a, 0x25, 0x1d, 0x13, 0x00, 0x37, 0x31, 0x0a, 0x11, 0x2e, 0x3d,
-    0x38, 0x2b, 0x1e, 0x25, 0x11, 0x12, 0x25, 0x13, 0x0e, 0x61, 0x4f, 0x1e,
-    0x4f, 0x4c, 0x61, 0x47, 0x18, 0x2e, 0x1d, 0x1f, 0x47, 0x3c, 0x0d, 0x12,
-    0x26, 0x1d, 0x3c, 0x5f, 0x5f, 0x47, 0x1d, 0x31, 0x58, 0x67, 0x67, 0x58,
-    0x8a, 0x75, 0x4d, 0x63, 0x85, 0x3a, 0x27, 0x6c, 0x58, 0x6a, 0x85, 0x48,
-    0x32, 0x2d, 0x5d, 0x85, 0x70, 0x70, 0x86, 0x70, 0x70, 0x96, 0x96, 0x91,
-    0x4e, 0x70, 0x7f, 0x70, 0x56, 0x70, 0x9f, 0x91, 0x7f, 0x84, 0x91, 0x9f,
-    0x84, 0x73, 0x91, 0x91, 0x65, 0x7f, 0x81, 0x65, 0x9f, 0xaf, 0x99, 0x99,
-    0x99, 0xac, 0xab, 0x6e, 0x7a, 0x73, 0x84, 0x99, 0x99, 0x74, 0x81, 0x81,
-    0x74, 0x94, 0xab, 0x99, 0x9c, 0x7a, 0x7a, 0xa2, 0x9c, 0x9c, 0x9c, 0xab,
-    0xaf, 0x9f, 0x95, 0xae, 0x9c, 0x81, 0x9c, 0x9c, 0x9b, 0xb4, 0x9c, 0x6e,
-    0x74, 0x98, 0xad, 0xa2, 0xa9, 0xa9, 0x9c, 0xa9, 0xad, 0xb2, 0xae, 0x9c,
-    0x88, 0xad, 0x9b, 0x7a, 0x74, 0xad, 0xa9, 0x9c, 0x9c, 0xaa, 0xa9, 0x9c,
-    0x9c, 0xa2, 0x9c, 0x8c, 0x94, 0x8c, 0x7a, 0x99, 0xbc, 0xa9, 0x8e, 0x9c,
-    0xaa, 0xb4, 0x99, 0x7a, 0x6e, 0x8e, 0x99, 0x94, 0x74, 0x57, 0x57, 0x84,
-    0x84, 0x9f, 0x99, 0x91, 0x90, 0x70, 0x81, 0x74, 0x8e, 0x99, 0x9f, 0xac,
-    0xa7, 0x85, 0x84, 0x8e, 0x54, 0x70, 0x91, 0x70, 0x91, 0x91, 0x5e, 0x41,
-    0x51, 0x7f, 0x7f, 0x70, 0x70, 0x79, 0x54, 0x78, 0x79, 0x91, 0x78, 0x5b,
-    0x85, 0x6a, 0x3e, 0x33, 0x6a, 0x85, 0x63, 0x56, 0x5d, 0x89, 0x89, 0x5d,
-    0x51, 0x63, 0x3a, 0x2f, 0x43, 0x3a, 0x36, 0x7b, 0x8a, 0x47, 0x4d, 0x5b,
-    0x75, 0x58, 0x47, 0x31, 0x1d, 0x39, 0x47, 0x47, 0x0d, 0x0a, 0x1d, 0x0a,
-    0x12, 0x3c, 0x44, 0x31, 0x20, 0x12, 0x3c, 0x52, 0x40, 0x18, 0x44, 0x52,
-    0x1e, 0x18, 0x40, 0x0e, 0x08, 0x2b, 0x31, 0x1e, 0x37, 0x14, 0x01, 0x03,
-    0x1e, 0x1e, 0x1e, 0x06, 0x0e, 0x13, 0x13, 0x13, 0x40, 0x35, 0x08, 0x11,
-    0x14, 0x11, 0x08, 0x0e, 0x37, 0x18, 0x03, 0x1e, 0x25, 0x2e, 0x1c, 0x0a,
-    0x25, 0x1c, 0x05, 0x0c, 0x0c, 0x0f, 0x13, 0x28, 0x20, 0x18, 0x2e, 0x25,
-    0x0a, 0x08, 0x02, 0x00, 0x08, 0x08, 0x0c, 0x0c, 0x0f, 0x1e, 0x11, 0x2b,
-    0x4f, 0x18, 0x0e, 0x08, 0x0e, 0x1e, 0x0d, 0x0a, 0x0e, 0x0a, 0x2e, 0x40,
-    0x44, 0x4f, 0x0d, 0x06, 0x13, 0x06, 0x14, 0x4f, 0x61, 0x1d, 0x12, 0x12,
-    0x0d, 0x40, 0x5c, 0x36, 0x10, 0x1d, 0x36, 0x31, 0x33, 0x31, 0x28, 0x0d,
-    0x33, 0x67, 0x75, 0x47, 0x1d, 0x1f, 0x3c, 0x7b, 0x47, 0x58, 0x63, 0x4d,
-    0x48, 0x56, 0x3e, 0x3e, 0x5d, 0x5b, 0x58, 0x56, 0x56, 0x86, 0x96, 0x45,
-    0x45, 0x4e, 0x56, 0x34, 0x34, 0x4e, 0x56, 0x4e, 0x70, 0x70, 0x90, 0x9f,
-    0x91, 0x70, 0x54, 0x70, 0x7f, 0x70, 0x4e, 0x5e, 0x4e, 0x5a, 0x7f, 0x9d,
-    0xab, 0x91, 0x60, 0x70, 0x57, 0x84, 0x8e, 0x9d, 0x95, 0x73, 0x69, 0x65,
-    0x95, 0x99, 0x95, 0x5a, 0x69, 0x74, 0x8c, 0x94, 0x8b, 0x8e, 0x69, 0x81,
-    0xab, 0xb4, 0xab, 0x6e, 0x84, 0x84, 0xab, 0x99, 0x8c, 0xaa, 0x9c, 0x94,
-    0x9c, 0x98, 0x7a, 0x9c, 0xa9, 0x94, 0x8c, 0x9b, 0xa2, 0xae, 0xa9, 0x74,
-    0x8b, 0x8b, 0x7a, 0x74, 0x7a, 0x7a, 0x8e, 0x94, 0x9c, 0x9c, 0xb8, 0xb8,
-    0x9c, 0x8b, 0x82, 0x9b, 0x9b, 0x99, 0x99, 0x84, 0x8e, 0xaa, 0x9c, 0xad,
-    0xae, 0x6e, 0x6e, 0x6e, 0x74, 0x94, 0x9c, 0x9c, 0x94, 0x74, 0x6e, 0x84,
-    0x99, 0xab, 0x6e, 0x65, 0x81, 0x90, 0x90, 0x95, 0x5a, 0x65, 0x5e, 0x84,
-    0xb1, 0xac, 0x70, 0x5d, 0x70, 0x91, 0x9f, 0x70, 0x91, 0x9f, 0x7f, 0x73,
-    0x7f, 0x5a, 0x57, 0x91, 0x70, 0x70, 0x7f, 0x79, 0x81, 0x93, 0x56, 0x4e,
-    0x54, 0x45, 0x48, 0x3e, 0x5b, 0x56, 0x58, 0x75, 0x78, 0x85, 0x96, 0x70,
-    0x34, 0x3a, 0x58, 0x5d, 0x58, 0x3a, 0x3c, 0x27, 0x3e, 0x63, 0x89, 0x78,
-    0x32, 0x1f, 0x1a, 0x26, 0x3a, 0x52, 0x63, 0x48, 0x2f, 0x26, 0x28, 0x3c,
-    0x5f, 0x36, 0x04, 0x10, 0x47, 0x2f, 0x2e, 0x1a, 0x0e, 0x06, 0x14, 0x4c,
-    0x61, 0x31, 0x11, 0x25, 0x14, 0x2e, 0x25, 0x2e, 0x25, 0x28, 0x1e, 0x14,
-    0x18, 0x17, 0x37, 0x2e, 0x0a, 0x09, 0x1e, 0x1e, 0x2e, 0x1e, 0x0a, 0x00,
-    0x00, 0x00, 0x08, 0x08, 0x1c, 0x0c, 0x07, 0x0a, 0x1e, 0x35, 0x1c, 0x06,
-    0x02, 0x08, 0x11, 0x17, 0x03, 0x0a, 0x00, 0x0a, 0x1c, 0x25, 0x1d, 0x13,
-    0x00, 0x02, 0x0f, 0x08, 0x46, 0x1c, 0x0a, 0x0f, 0x0f, 0x08, 0x02, 0x02,
-    0x19, 0x38, 0x35, 0x4f, 0x35, 0x2b, 0x35, 0x0a, 0x17, 0x1d, 0x11, 0x1e,
-    0x18, 0x00, 0x00, 0x17, 0x28, 0x28, 0x0c, 0x35, 0x12, 0x14, 0x1d, 0x44,
-    0x61, 0x39, 0x12, 0x13, 0x06, 0x14, 0x06, 0x13, 0x12, 0x0d, 0x36, 0x1f,
-    0x1f, 0x67, 0x47, 0x52, 0x58, 0x47, 0x14, 0x26, 0x4d, 0x26, 0x1f, 0x52,
-    0x5f, 0x47, 0x25, 0x14, 0x26, 0x4d, 0x2e, 0x12, 0x12, 0x5d, 0x78, 0x63,
-    0x56, 0x3e, 0x78, 0x89, 0x85, 0x70, 0x4e, 0x5b, 0x50, 0x4e, 0x4e, 0x70,
-    0x91, 0x96, 0x8a, 0x93, 0x7f, 0x7f, 0x7f, 0x57, 0x57, 0x64, 0x70, 0x7f,
-    0x56, 0x3e, 0x5e, 0x73, 0x90, 0x7f, 0x78, 0x81, 0x81, 0x8e, 0x99, 0xab,
-    0x98, 0x69, 0x81, 0x64, 0x81, 0x73, 0x5a, 0x84, 0x65, 0x84, 0x7a, 0x73,
-    0x7a, 0x9c, 0x94, 0xab, 0x99, 0x73, 0x81, 0xab, 0x94, 0x74, 0x99, 0xab,
-    0xac, 0x8e, 0x73, 0x81, 0x99, 0x65, 0x81, 0x64, 0x74, 0xb4, 0x9c, 0x9c,
-    0x8c, 0x9c, 0xab, 0xab, 0xaa, 0x9c, 0x8b, 0x94, 0x94, 0x8b, 0x94, 0xae,
-    0xbc, 0xb4, 0xb4, 0xb4, 0xa9, 0xab, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x8b,
-    0x73, 0x6e, 0x99, 0xaf, 0xab, 0x74, 0x94, 0x94, 0x9c, 0x9c, 0xb8, 0xb8,
-    0x8b, 0x74, 0x6e, 0x6e, 0x74, 0x6e, 0x6e, 0x5a, 0x8e, 0x8c, 0x8e, 0x74,
-    0x9c, 0x95, 0x7a, 0x95, 0x73, 0x54, 0x91, 0x99, 0x65, 0x70, 0x93, 0xa7,
-    0x7f, 0x54, 0x54, 0x65, 0x54, 0x4e, 0x48, 0x4e, 0x90, 0x9f, 0x73, 0x5e,
-    0x70, 0x91, 0x96, 0x91, 0x73, 0x6c, 0x60, 0x6c, 0x4e, 0x54, 0x70, 0x96,
-    0x96, 0x9a, 0x8a, 0x89, 0x6c, 0x5e, 0x60, 0x4e, 0x5e, 0x5d, 0x48, 0x26,
-    0x1f, 0x3a, 0x5d, 0x5d, 0x33, 0x3a, 0x48, 0x51, 0x5d, 0x86, 0x89, 0x63,
-    0x2f, 0x1a, 0x26, 0x4d, 0x27, 0x1a, 0x20, 0x12, 0x3c, 0x31, 0x1d, 0x3a,
-    0x52, 0x52, 0x52, 0x39, 0x06, 0x12, 0x4c, 0x25, 0x13, 0x1e, 0x31, 0x25,
-    0x17, 0x11, 0x06, 0x0e, 0x08, 0x00, 0x08, 0x18, 0x40, 0x25, 0x17, 0x0a,
-    0x2b, 0x38, 0x4f, 0x1e, 0x08, 0x11, 0x08, 0x00, 0x01, 0x08, 0x25, 0x2b,
-    0x4b, 0x4b, 0x0f, 0x35, 0x0f, 0x08, 0x08, 0x07, 0x0a, 0x17, 0x0a, 0x00,
-    0x02, 0x0f, 0x0f, 0x0c, 0x0f, 0x0e, 0x04, 0x09, 0x20, 0x25, 0x37, 0x08,
-    0x02, 0x08, 0x08, 0x00, 0x08, 0x0f, 0x08, 0x08, 0x11, 0x37, 0x40, 0x1c,
-    0x0a, 0x0f, 0x18, 0x2e, 0x1e, 0x0a, 0x0f, 0x11, 0x28, 0x4f, 0x38, 0x11,
-    0x17, 0x1e, 0x18, 0x40, 0x0a, 0x00, 0x12, 0x44, 0x4c, 0x38, 0x1f, 0x14,
-    0x14, 0x1e, 0x0d, 0x36, 0x25, 0x28, 0x36, 0x7b, 0x7d, 0x36, 0x2e, 0x3c,
-    0x3c, 0x3c, 0x26, 0x36, 0x47, 0x47, 0x33, 0x67, 0x66, 0x1a, 0x14, 0x09,
-    0x3c, 0x63, 0x7b, 0x5b, 0x2f, 0x2f, 0x34, 0x3a, 0x33, 0x34, 0x43, 0x32,
-    0x43, 0x48, 0x27, 0x58, 0x56, 0x5d, 0x4e, 0x70, 0x7f, 0x85, 0x85, 0x66,
-    0x27, 0x3a, 0x77, 0x65, 0x79, 0x60, 0x4e, 0x70, 0x91, 0x9f, 0x85, 0x5d,
-    0x5d, 0x6a, 0x93, 0x84, 0x57, 0x65, 0x99, 0x99, 0x99, 0x6e, 0x81, 0x81,
-    0x8e, 0x6e, 0x74, 0x99, 0x8e, 0x7a, 0xab, 0xbc, 0x99, 0x8e, 0x84, 0x84,
-    0x99, 0x99, 0x7a, 0x94, 0x9c, 0x8e, 0x94, 0xa9, 0x8e, 0x81, 0x5a, 0x74,
-    0xaa, 0xaf, 0xab, 0x8e, 0x6e, 0x8b, 0x8c, 0x6e, 0x74, 0x94, 0x84, 0x84,
-    0x74, 0x6e, 0x65, 0x6e, 0x8b, 0x8c, 0x88, 0xae, 0xa9, 0xab, 0x94, 0x6e,
-    0x64, 0x99, 0x9c, 0x9c, 0x7a, 0x7a, 0x88, 0xae, 0xb4, 0xac, 0x6e, 0x73,
-    0x74, 0x99, 0xab, 0x74, 0x74, 0x9c, 0xa9, 0xae, 0x99, 0x98, 0x74, 0x7a,
-    0x94, 0x8b, 0x94, 0x8e, 0x99, 0x99, 0xbc, 0xad, 0x7a, 0x84, 0x84, 0x84,
-    0x8e, 0x69, 0x6e, 0x99, 0x81, 0x73, 0x9d, 0x84, 0x60, 0x4e, 0x5e, 0x70,
-    0x93, 0x9a, 0x96, 0x4a, 0x54, 0x65, 0x57, 0x56, 0x70, 0x5b, 0x4e, 0x6c,
-    0x4a, 0x34, 0x4e, 0x4e, 0x4e, 0x57, 0x65, 0x7f, 0x85, 0x86, 0x4d, 0x1a,
-    0x4d, 0x4e, 0x60, 0x4e, 0x48, 0x4d, 0x5d, 0x85, 0x78, 0x34, 0x33, 0x3a,
-    0x43, 0x5f, 0x4d, 0x26, 0x43, 0x75, 0x7b, 0x58, 0x3a, 0x2f, 0x26, 0x48,
-    0x2f, 0x3c, 0x33, 0x44, 0x52, 0x7b, 0x8a, 0x2f, 0x2e, 0x37, 0x2e, 0x2e,
-    0x18, 0x18, 0x25, 0x25, 0x1d, 0x4c, 0x3d, 0x0d, 0x0e, 0x04, 0x06, 0x37,
-    0x52, 0x40, 0x11, 0x00, 0x0e, 0x17, 0x06, 0x08, 0x18, 0x0f, 0x17, 0x0a,
-    0x08, 0x08, 0x0e, 0x0f, 0x08, 0x08, 0x1e, 0x35, 0x35, 0x1c, 0x07, 0x05,
-    0x1c, 0x1c, 0x08, 0x08, 0x0a, 0x0a, 0x2b, 0x38, 0x1e, 0x0a, 0x1b, 0x17,
-    0x17, 0x0a, 0x02, 0x00, 0x1c, 0x37, 0x11, 0x11, 0x11, 0x09, 0x00, 0x08,
-    0x1e, 0x17, 0x00, 0x00, 0x00, 0x08, 0x01, 0x01, 0x13, 0x2e, 0x1b, 0x05,
-    0x0f, 0x08, 0x07, 0x08, 0x00, 0x09, 0x14, 0x20, 0x25, 0x35, 0x2e, 0x11,
-    0x0a, 0x11, 0x17, 0x18, 0x0a, 0x0a, 0x31, 0x47, 0x31, 0x06, 0x06, 0x3c,
-    0x3c, 0x1e, 0x28, 0x47, 0x26, 0x00, 0x12, 0x53, 0x26, 0x20, 0x1f, 0x58,
-    0x33, 0x36, 0x58, 0x2f, 0x1a, 0x3a, 0x63, 0x58, 0x5d, 0x66, 0x58, 0x63,
-    0x56, 0x56, 0x3e, 0x3e, 0x56, 0x58, 0x26, 0x4d, 0x48, 0x3e, 0x58, 0x5b,
-    0x78, 0x50, 0x34, 0x26, 0x2f, 0x48, 0x50, 0x60, 0x81, 0x86, 0x43, 0x56,
-    0x50, 0x60, 0x65, 0x4e, 0x5d, 0x70, 0x90, 0x7f, 0x84, 0x90, 0x5e, 0x70,
-    0x65, 0x77, 0x5e, 0x4e, 0x54, 0x84, 0xab, 0xaa, 0x81, 0x57, 0x74, 0x7a,
-    0x81, 0x81, 0x8e, 0x91, 0x5e, 0x5e, 0x99, 0x7a, 0x81, 0x74, 0x94, 0x9c,
-    0x90, 0x9f, 0xaa, 0x74, 0x74, 0x94, 0x9c, 0xa9, 0xad, 0x9c, 0x9c, 0x9c,
-    0x9b, 0x94, 0x94, 0x94, 0x9b, 0x7a, 0x84, 0x9c, 0x7a, 0x7a, 0x99, 0x9c,
-    0x9c, 0x8e, 0x65, 0x65, 0x65, 0x84, 0x7a, 0x9c, 0xae, 0x8e, 0x8e, 0x74,
-    0x74, 0x94, 0x8b, 0x6e, 0x8b, 0x9c, 0x94, 0x88, 0x9b, 0x94, 0x99, 0x8e,
-    0x8e, 0x73, 0x70, 0x70, 0x95, 0xab, 0xa9, 0x8b, 0x5a, 0x6e, 0x8e, 0x99,
-    0x74, 0x74, 0x99, 0x79, 0x50, 0x69, 0x99, 0x64, 0x6e, 0x8e, 0xab, 0x73,
-    0x91, 0x99, 0x73, 0x57, 0x8e, 0xab, 0x81, 0x99, 0x91, 0x95, 0x84, 0x73,
-    0x73, 0x77, 0x77, 0x7f, 0x60, 0x3e, 0x57, 0x4e, 0x50, 0x5e, 0x70, 0x70,
-    0x4a, 0x32, 0x2f, 0x32, 0x2f, 0x34, 0x4e, 0x7f, 0x6c, 0x3a, 0x4d, 0x3e,
-    0x56, 0x56, 0x3a, 0x33, 0x5d, 0x5d, 0x48, 0x56, 0x58, 0x47, 0x4d, 0x3c,
-    0x27, 0x1e, 0x0d, 0x1f, 0x5f, 0x56, 0x63, 0x0d, 0x12, 0x3c, 0x3a, 0x3f,
-    0x26, 0x3a, 0x40, 0x08, 0x12, 0x47, 0x31, 0x14, 0x36, 0x2d, 0x26, 0x2d,
-    0x3c, 0x28, 0x08, 0x09, 0x40, 0x28, 0x12, 0x3c, 0x47, 0x28, 0x28, 0x28,
-    0x12, 0x0a, 0x0a, 0x06, 0x06, 0x06, 0x25, 0x0f, 0x0a, 0x0c, 0x1e, 0x0f,
-    0x05, 0x05, 0x0c, 0x07, 0x01, 0x00, 0x1e, 0x29, 0x05, 0x0c, 0x0f, 0x08,
-    0x09, 0x04, 0x06, 0x0f, 0x1e, 0x1e, 0x2e, 0x37, 0x13, 0x0a, 0x1b, 0x0c,
-    0x1c, 0x05, 0x0c, 0x0c, 0x00, 0x0a, 0x13, 0x0e, 0x08, 0x00, 0x08, 0x25,
-    0x17, 0x08, 0x11, 0x19, 0x0f, 0x17, 0x4b, 0x35, 0x17, 0x07, 0x08, 0x11,
-    0x06, 0x08, 0x0a, 0x0e, 0x00, 0x08, 0x38, 0x38, 0x17, 0x0d, 0x1e, 0x38,
-    0x2e, 0x40, 0x28, 0x06, 0x06, 0x12, 0x3c, 0x3f, 0x12, 0x06, 0x10, 0x1d,
-    0x4f, 0x61, 0x3a, 0x06, 0x12, 0x3c, 0x67, 0x58, 0x1d, 0x31, 0x75, 0x6d,
-    0x63, 0x58, 0x7b, 0x63, 0x4d, 0x33, 0x33, 0x43, 0x4d, 0x51, 0x27, 0x2f,
-    0x4d, 0x75, 0x63, 0x3a, 0x36, 0x6a, 0x93, 0x56, 0x34, 0x41, 0x50, 0x86,
-    0x6c, 0x4e, 0x79, 0x65, 0x70, 0x96, 0x96, 0x70, 0x78, 0x4e, 0x4e, 0x54,
-    0x70, 0x70, 0x5e, 0x4e, 0x60, 0x91, 0xb1, 0x73, 0x5a, 0x7f, 0x90, 0x90,
-    0x91, 0x84, 0x69, 0x57, 0x65, 0x74, 0x99, 0x81, 0x65, 0x65, 0x65, 0x9f,
-    0xab, 0xac, 0x7f, 0x65, 0x7a, 0x9c, 0xb4, 0x81, 0x73, 0x9f, 0xab, 0x94,
-    0x9c, 0xb4, 0xad, 0x94, 0x8b, 0x6e, 0x94, 0x88, 0x9c, 0x98, 0x74, 0x8b,
-    0xa2, 0xa9, 0x8c, 0x65, 0x99, 0xb4, 0x9c, 0x81, 0x94, 0x94, 0xa9, 0x9c,
-    0x8e, 0x94, 0xab, 0x94, 0xa2, 0xb4, 0xaa, 0x94, 0x8b, 0x74, 0x74, 0x8b,
-    0x99, 0x8c, 0x73, 0x6e, 0x74, 0xb4, 0xab, 0x74, 0x8e, 0x99, 0xab, 0x95,
-    0x99, 0x7a, 0x65, 0x65, 0x84, 0xa1, 0x8e, 0x81, 0x81, 0x65, 0x99, 0xb1,
-    0xaf, 0x6e, 0x60, 0x81, 0x98, 0xac, 0x8e, 0x70, 0x73, 0x9d, 0x99, 0x91,
-    0x99, 0xab, 0x91, 0x7f, 0x5e, 0x65, 0x7f, 0x84, 0x70, 0x4a, 0x4e, 0x70,
-    0x91, 0x65, 0x51, 0x45, 0x91, 0x91, 0x45, 0x48, 0x5e, 0x6c, 0x85, 0x56,
-    0x4e, 0x70, 0x70, 0x6c, 0x91, 0x85, 0x6c, 0x58, 0x3a, 0x33, 0x34, 0x58,
-    0x48, 0x2f, 0x1f, 0x3e, 0x6a, 0x75, 0x2f, 0x2f, 0x52, 0x5f, 0x43, 0x52,
-    0x52, 0x26, 0x1d, 0x1f, 0x52, 0x47, 0x18, 0x12, 0x0c, 0x12, 0x40, 0x67,
-    0x3c, 0x0a, 0x11, 0x1a, 0x67, 0x47, 0x1d, 0x20, 0x52, 0x52, 0x2e, 0x28,
-    0x61, 0x4f, 0x28, 0x06, 0x04, 0x0e, 0x11, 0x25, 0x03, 0x08, 0x1e, 0x1e,
-    0x1e, 0x08, 0x0e, 0x0d, 0x25, 0x0e, 0x00, 0x00, 0x17, 0x1c, 0x08, 0x08,
-    0x13, 0x11, 0x03, 0x1c, 0x4b, 0x21, 0x0f, 0x07, 0x0f, 0x0e, 0x08, 0x08,
-    0x0a, 0x03, 0x02, 0x14, 0x38, 0x18, 0x07, 0x0f, 0x29, 0x4b, 0x1c, 0x0c,
-    0x17, 0x17, 0x0a, 0x0a, 0x1e, 0x1c, 0x1e, 0x1e, 0x11, 0x18, 0x3d, 0x19,
-    0x28, 0x1e, 0x0f, 0x0c, 0x0d, 0x09, 0x13, 0x2e, 0x2b, 0x1e, 0x0c, 0x18,
-    0x40, 0x18, 0x03, 0x0f, 0x25, 0x0e, 0x08, 0x1e, 0x2e, 0x1e, 0x18, 0x1d,
-    0x12, 0x28, 0x18, 0x12, 0x4f, 0x39, 0x06, 0x0d, 0x40, 0x4f, 0x06, 0x1d,
-    0x75, 0x7b, 0x20, 0x1d, 0x58, 0x4d, 0x1a, 0x1d, 0x47, 0x1f, 0x18, 0x26,
-    0x28, 0x58, 0x7b, 0x43, 0x32, 0x32, 0x58, 0x5d, 0x56, 0x27, 0x33, 0x5d,
-    0x96, 0x63, 0x34, 0x6c, 0x4e, 0x78, 0x7f, 0x86, 0x70, 0x96, 0x91, 0x7f,
-    0x78, 0x78, 0x5b, 0x51, 0x70, 0x79, 0x90, 0x84, 0x5e, 0x5e, 0x73, 0x9f,
-    0x65, 0x70, 0x5a, 0x73, 0x65, 0x4e, 0x5e, 0x7f, 0x7f, 0x73, 0x81, 0x69,
-    0x81, 0x69, 0x81, 0x99, 0x98, 0x69, 0x65, 0x7f, 0x9f, 0x70, 0x54, 0xab,
-    0xbc, 0x8b, 0x73, 0x9b, 0xab, 0x84, 0x65, 0x84, 0x8e, 0x6e, 0x6e, 0x74,
-    0x74, 0xb4, 0xab, 0x8c, 0x6e, 0x94, 0x9c, 0x94, 0x74, 0x74, 0x94, 0xb4,
-    0xa9, 0x6e, 0x94, 0x94, 0x99, 0xad, 0xb4, 0xab, 0xab, 0xb8, 0x9c, 0x9b,
-    0x94, 0x82, 0x84, 0x7a, 0x98, 0xab, 0xad, 0x9c, 0x8c, 0x94, 0x9c, 0x9c,
-    0x7a, 0x8b, 0x74, 0x9c, 0x74, 0x65, 0x84, 0x8e, 0x8e, 0x95, 0x7a, 0x84,
-    0x8e, 0x84, 0x7a, 0x9c, 0x7a, 0x64, 0x70, 0x91, 0x8e, 0x57, 0x7a, 0xaf,
-    0x98, 0x65, 0x84, 0x99, 0x84, 0x60, 0x54, 0x7f, 0x5a, 0x4e, 0x70, 0x4e,
-    0x9f, 0xa7, 0x65, 0x5a, 0x70, 0x70, 0x65, 0x5a, 0x3e, 0x50, 0x91, 0x91,
-    0x45, 0x56, 0x70, 0x4e, 0x70, 0x96, 0x77, 0x7f, 0xa7, 0x85, 0x70, 0x5e,
-    0x45, 0x48, 0x63, 0x58, 0x78, 0x8a, 0x78, 0x4d, 0x43, 0x5d, 0x78, 0x47,
-    0x47, 0x47, 0x51, 0x34, 0x1d, 0x1f, 0x44, 0x3c, 0x47, 0x3a, 0x3a, 0x3c,
-    0x26, 0x1f, 0x58, 0x3a, 0x18, 0x09, 0x25, 0x47, 0x12, 0x06, 0x58, 0x75,
-    0x28, 0x12, 0x3c, 0x47, 0x1e, 0x0a, 0x1e, 0x1e, 0x0a, 0x14, 0x06, 0x1d,
-    0x37, 0x1d, 0x0e, 0x00, 0x1e, 0x12, 0x14, 0x08, 0x00, 0x18, 0x3d, 0x04,
-    0x04, 0x0b, 0x0e, 0x17, 0x1d, 0x1e, 0x11, 0x37, 0x37, 0x1e, 0x1c, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x08, 0x1e, 0x2e, 0x17, 0x0f, 0x08, 0x18, 0x2e, 0x0a,
-    0x08, 0x0f, 0x0f, 0x00, 0x0f, 0x1c, 0x0f, 0x0e, 0x18, 0x1e, 0x0e, 0x00,
-    0x13, 0x2e, 0x0f, 0x00, 0x13, 0x2b, 0x11, 0x0e, 0x1e, 0x1e, 0x0a, 0x08,
-    0x4f, 0x37, 0x00, 0x08, 0x11, 0x0a, 0x08, 0x0c, 0x2e, 0x1e, 0x06, 0x06,
-    0x20, 0x28, 0x28, 0x38, 0x4f, 0x18, 0x0a, 0x28, 0x4f, 0x2d, 0x06, 0x1d,
-    0x4c, 0x28, 0x31, 0x12, 0x01, 0x0d, 0x28, 0x47, 0x53, 0x3a, 0x4d, 0x3a,
-    0x47, 0x33, 0x3c, 0x1d, 0x12, 0x09, 0x1d, 0x53, 0x3a, 0x58, 0x43, 0x26,
-    0x33, 0x34, 0x5d, 0x58, 0x3e, 0x3a, 0x6c, 0x5b, 0x5d, 0x63, 0x34, 0x48,
-    0x86, 0x78, 0x3a, 0x6c, 0x85, 0x60, 0x5b, 0x70, 0x86, 0x4e, 0x2f, 0x85,
-    0x96, 0x60, 0x4e, 0x54, 0x54, 0x4a, 0x54, 0x79, 0x84, 0x5e, 0x4e, 0x84,
-    0x81, 0x8e, 0x9f, 0x9f, 0x84, 0x65, 0x84, 0x98, 0x99, 0x65, 0x65, 0x99,
-    0x9f, 0x99, 0x73, 0x60, 0x57, 0x6e, 0x99, 0x94, 0x99, 0x9c, 0x9c, 0x99,
-    0x99, 0x84, 0x5a, 0x5a, 0x54, 0x5a, 0x99, 0x99, 0x99, 0x99, 0x81, 0x7a,
-    0x84, 0x9b, 0x9b, 0x94, 0x7a, 0x94, 0x9c, 0x9c, 0x9c, 0x7a, 0x81, 0x9c,
-    0xad, 0x6e, 0x6e, 0x9c, 0xaa, 0x7a, 0x8c, 0x9b, 0x94, 0x69, 0x94, 0xb4,
-    0x9c, 0x81, 0x99, 0x94, 0x7a, 0x74, 0x74, 0xa9, 0x99, 0x69, 0x7a, 0x98,
-    0x9c, 0x9c, 0xab, 0xab, 0x74, 0x6e, 0x99, 0xa9, 0x84, 0x69, 0x99, 0x9b,
-    0x99, 0x74, 0x57, 0x4e, 0x65, 0x8e, 0x99, 0x99, 0x74, 0x99, 0x8e, 0x8e,
-    0x91, 0x70, 0x54, 0x4e, 0x41, 0x5e, 0x84, 0x5a, 0x84, 0x5e, 0x5e, 0x60,
-    0x70, 0x7f, 0x70, 0x57, 0x60, 0x73, 0x70, 0x7f, 0x60, 0x45, 0x5b, 0x91,
-    0x5d, 0x3a, 0x70, 0x7f, 0x5b, 0x48, 0x60, 0x70, 0x3a, 0x3a, 0x85, 0x85,
-    0x3e, 0x47, 0x58, 0x33, 0x27, 0x4d, 0x56, 0x72, 0x28, 0x26, 0x58, 0x5b,
-    0x5b, 0x63, 0x7b, 0x47, 0x1a, 0x52, 0x63, 0x3a, 0x10, 0x36, 0x5f, 0x47,
-    0x3c, 0x2e, 0x06, 0x09, 0x3c, 0x2e, 0x3c, 0x3c, 0x52, 0x36, 0x36, 0x47,
-    0x12, 0x06, 0x06, 0x00, 0x0a, 0x28, 0x1d, 0x28, 0x1e, 0x0e, 0x11, 0x11,
-    0x2e, 0x11, 0x11, 0x0a, 0x28, 0x28, 0x28, 0x25, 0x04, 0x08, 0x20, 0x19,
-    0x01, 0x00, 0x1d, 0x1e, 0x08, 0x0e, 0x1e, 0x17, 0x02, 0x1e, 0x46, 0x0e,
-    0x00, 0x08, 0x07, 0x03, 0x00, 0x0f, 0x18, 0x08, 0x00, 0x06, 0x13, 0x17,
-    0x2e, 0x1b, 0x1e, 0x02, 0x0c, 0x0e, 0x08, 0x1c, 0x2e, 0x17, 0x0a, 0x0a,
-    0x08, 0x08, 0x00, 0x0f, 0x1c, 0x17, 0x1b, 0x14, 0x0e, 0x00, 0x20, 0x04,
-    0x06, 0x11, 0x0e, 0x19, 0x3d, 0x44, 0x28, 0x14, 0x20, 0x31, 0x12, 0x06,
-    0x00, 0x0a, 0x06, 0x17, 0x12, 0x1d, 0x4f, 0x20, 0x11, 0x1d, 0x31, 0x40,
-    0x52, 0x53, 0x5f, 0x28, 0x06, 0x14, 0x1d, 0x20, 0x52, 0x67, 0x1a, 0x4d,
-    0x34, 0x2f, 0x33, 0x1a, 0x3e, 0x4d, 0x2f, 0x66, 0x8a, 0x5d, 0x34, 0x34,
-    0x3e, 0x6c, 0x85, 0x4e, 0x3e, 0x3a, 0x5d, 0x78, 0x70, 0x5b, 0x5b, 0x4e,
-    0x6c, 0x48, 0x45, 0x65, 0x7f, 0x6c, 0x6c, 0x5e, 0x48, 0x70, 0x65, 0x60,
-    0x70, 0x70, 0x65, 0x84, 0x99, 0x8e, 0x65, 0x65, 0x84, 0x81, 0x60, 0x54,
-    0x4e, 0x41, 0x65, 0x91, 0x65, 0x99, 0x8e, 0x65, 0x65, 0x8e, 0x99, 0x99,
-    0x9d, 0xab, 0x94, 0x57, 0x64, 0x73, 0x73, 0x74, 0xab, 0x8e, 0x7a, 0x99,
-    0x6e, 0x8e, 0x65, 0x74, 0x8b, 0x6e, 0x99, 0xab, 0xa9, 0x7a, 0x7a, 0x74,
-    0x94, 0xb4, 0xa9, 0x94, 0x6e, 0x74, 0xab, 0xab, 0x94, 0x8b, 0x8b, 0x82,
-    0x74, 0x73, 0x98, 0x9c, 0x94, 0x74, 0xa2, 0x84, 0x6e, 0xab, 0x8b, 0x8b,
-    0x94, 0x9c, 0xa9, 0xab, 0xab, 0x99, 0x7a, 0x88, 0x94, 0x8e, 0x69, 0x65,
-    0x5e, 0x65, 0x8c, 0x6e, 0x95, 0x99, 0x73, 0x65, 0x84, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x69, 0x60, 0x70, 0x5e, 0x65, 0x99, 0x84, 0x65, 0x81, 0x65,
-    0x65, 0x60, 0x54, 0x81, 0x70, 0x70, 0x91, 0x9f, 0x7f, 0x5e, 0x4e, 0x70,
-    0x91, 0x91, 0x79, 0x6c, 0x56, 0x70, 0x86, 0x78, 0x4e, 0x4e, 0x4e, 0x4e,
-    0x32, 0x48, 0x78, 0x63, 0x58, 0x5d, 0x5b, 0x3c, 0x5d, 0x5d, 0x3e, 0x51,
-    0x56, 0x5d, 0x63, 0x86, 0x63, 0x2f, 0x48, 0x5d, 0x3a, 0x1f, 0x14, 0x09,
-    0x06, 0x26, 0x1f, 0x33, 0x52, 0x47, 0x14, 0x1d, 0x2f, 0x47, 0x52, 0x52,
-    0x47, 0x28, 0x0a, 0x06, 0x0e, 0x12, 0x4f, 0x31, 0x12, 0x18, 0x1e, 0x14,
-    0x11, 0x00, 0x14, 0x14, 0x06, 0x17, 0x4c, 0x37, 0x06, 0x06, 0x03, 0x38,
-    0x4f, 0x20, 0x11, 0x0a, 0x1e, 0x35, 0x2b, 0x0e, 0x13, 0x08, 0x0e, 0x08,
-    0x00, 0x17, 0x0a, 0x11, 0x1e, 0x13, 0x08, 0x1e, 0x19, 0x00, 0x08, 0x0a,
-    0x0a, 0x1e, 0x1e, 0x20, 0x1e, 0x0e, 0x06, 0x0e, 0x00, 0x02, 0x02, 0x00,
-    0x0f, 0x25, 0x17, 0x11, 0x17, 0x17, 0x25, 0x1e, 0x00, 0x00, 0x08, 0x03,
-    0x02, 0x0f, 0x25, 0x11, 0x00, 0x08, 0x0e, 0x13, 0x1e, 0x14, 0x13, 0x17,
-    0x14, 0x31, 0x20, 0x20, 0x08, 0x38, 0x4f, 0x28, 0x08, 0x18, 0x28, 0x06,
-    0x06, 0x1e, 0x47, 0x31, 0x0d, 0x06, 0x04, 0x1a, 0x47, 0x26, 0x12, 0x28,
-    0x26, 0x39, 0x36, 0x1d, 0x11, 0x2d, 0x52, 0x43, 0x5b, 0x56, 0x5b, 0x63,
-    0x78, 0x58, 0x2f, 0x3a, 0x3a, 0x33, 0x34, 0x56, 0x58, 0x2f, 0x1d, 0x32,
-    0x5b, 0x5d, 0x5d, 0x48, 0x6c, 0x79, 0x70, 0x3e, 0x32, 0x50, 0x4e, 0x34,
-    0x48, 0x6c, 0x70, 0x45, 0x45, 0x57, 0x54, 0x7f, 0x81, 0x57, 0x54, 0x70,
-    0x65, 0x8e, 0x8e, 0x79, 0x65, 0x9f, 0x84, 0x54, 0x4e, 0x7f, 0x70, 0x70,
-    0x57, 0x99, 0x9f, 0x65, 0x54, 0x57, 0x65, 0x7a, 0x8e, 0x81, 0x6e, 0x8b,
-    0x69, 0x8e, 0x74, 0x65, 0x65, 0x98, 0x94, 0x9c, 0x94, 0x94, 0x9c, 0xa9,
-    0x9c, 0x74, 0x74, 0x8e, 0x7a, 0x6e, 0x99, 0x7a, 0x6e, 0x65, 0x69, 0x94,
-    0x99, 0x99, 0x8b, 0x94, 0xab, 0xab, 0x8b, 0x74, 0x8b, 0x8b, 0x81, 0x65,
-    0x7a, 0xa2, 0x74, 0x69, 0x74, 0x7a, 0x98, 0xb4, 0x94, 0x74, 0x8e, 0x94,
-    0x9c, 0xaa, 0x74, 0x7a, 0xab, 0x9c, 0x6e, 0x69, 0x8e, 0x74, 0x81, 0x69,
-    0x99, 0xab, 0x73, 0x54, 0x54, 0x54, 0x84, 0x99, 0x84, 0x65, 0x8e, 0x65,
-    0x7f, 0x91, 0x54, 0x4e, 0x69, 0x81, 0x7a, 0x98, 0x6e, 0x95, 0x9f, 0x99,
-    0x65, 0x54, 0x70, 0x5a, 0x4e, 0x5a, 0x7f, 0x5a, 0x48, 0x34, 0x54, 0x86,
-    0x6c, 0x78, 0x5e, 0x70, 0x5e, 0x5e, 0x34, 0x3e, 0x4a, 0x34, 0x26, 0x33,
-    0x5d, 0x5d, 0x27, 0x3a, 0x3e, 0x58, 0x85, 0x6c, 0x3e, 0x34, 0x48, 0x5b,
-    0x5b, 0x5b, 0x3a, 0x5d, 0x78, 0x3e, 0x12, 0x28, 0x3a, 0x28, 0x1d, 0x26,
-    0x52, 0x47, 0x1d, 0x04, 0x04, 0x12, 0x3c, 0x28, 0x12, 0x1a, 0x2e, 0x31,
-    0x28, 0x06, 0x08, 0x14, 0x31, 0x28, 0x44, 0x26, 0x1d, 0x28, 0x38, 0x25,
-    0x0e, 0x08, 0x13, 0x06, 0x00, 0x0e, 0x08, 0x08, 0x00, 0x04, 0x0e, 0x18,
-    0x17, 0x14, 0x17, 0x2b, 0x2e, 0x08, 0x00, 0x07, 0x03, 0x02, 0x08, 0x17,
-    0x14, 0x0a, 0x00, 0x00, 0x13, 0x14, 0x11, 0x0f, 0x13, 0x1e, 0x11, 0x0d,
-    0x20, 0x06, 0x0f, 0x3d, 0x17, 0x00, 0x08, 0x0a, 0x08, 0x0e, 0x1e, 0x08,
-    0x00, 0x0a, 0x0a, 0x08, 0x1e, 0x1c, 0x2e, 0x2b, 0x0e, 0x07, 0x0a, 0x2e,
-    0x1e, 0x00, 0x11, 0x0e, 0x11, 0x37, 0x4b, 0x46, 0x1e, 0x04, 0x0d, 0x31,
-    0x2e, 0x17, 0x17, 0x28, 0x25, 0x1e, 0x47, 0x1d, 0x53, 0x38, 0x25, 0x14,
-    0x38, 0x5c, 0x38, 0x1a, 0x26, 0x28, 0x28, 0x1d, 0x26, 0x3c, 0x4c, 0x47,
-    0x26, 0x1d, 0x43, 0x2f, 0x66, 0xa0, 0x9a, 0x6c, 0x2f, 0x26, 0x48, 0x6c,
-    0x48, 0x2f, 0x56, 0x56, 0x48, 0x5d, 0x58, 0x3e, 0x56, 0x5b, 0x48, 0x1f,
-    0x48, 0x5d, 0x4e, 0x78, 0x85, 0x7f, 0xa0, 0x7f, 0x41, 0x4e, 0x79, 0x7f,
-    0x60, 0x70, 0x65, 0x50, 0x70, 0x9d, 0xa0, 0x7f, 0x50, 0x50, 0x81, 0x99,
-    0x7f, 0x5e, 0x65, 0x90, 0x73, 0x84, 0x84, 0x91, 0xac, 0x65, 0x5a, 0x84,
-    0x99, 0x99, 0x81, 0x81, 0x74, 0x69, 0x6e, 0x8e, 0x8e, 0x99, 0x8b, 0x74,
-    0x81, 0x99, 0x8b, 0x74, 0xbc, 0xbc, 0xb4, 0x8e, 0x6e, 0x74, 0x9c, 0x94,
-    0x81, 0x8b, 0x9c, 0x8b, 0x9c, 0x9c, 0x8e, 0x8b, 0x99, 0x94, 0x69, 0x69,
-    0x8b, 0x98, 0x94, 0xa9, 0x9c, 0xb4, 0xb4, 0x8e, 0x7a, 0x9b, 0x9c, 0x99,
-    0x8b, 0x99, 0x99, 0x8b, 0xb4, 0xbe, 0xab, 0x74, 0x69, 0x74, 0xab, 0x99,
-    0x81, 0x6e, 0x99, 0x99, 0x8b, 0x9b, 0x99, 0xab, 0x6e, 0x65, 0x6e, 0x99,
-    0x99, 0x84, 0x6e, 0x6e, 0x84, 0x6e, 0x84, 0x65, 0x91, 0x91, 0x84, 0x70,
-    0x65, 0x81, 0x64, 0x9d, 0xaf, 0xb1, 0x9f, 0x65, 0x54, 0x81, 0x91, 0x5a,
-    0x5e, 0x7f, 0x7f, 0x70, 0x90, 0x4e, 0x54, 0x77, 0x70, 0x4e, 0x34, 0x4e,
-    0x60, 0x4e, 0x7f, 0x70, 0x86, 0x9a, 0x5d, 0x2f, 0x5d, 0x85, 0x75, 0x48,
-    0x4e, 0x5d, 0x34, 0x75, 0x9a, 0x86, 0x63, 0x1a, 0x3f, 0x56, 0x75, 0x58,
-    0x2f, 0x3a, 0x58, 0x3a, 0x63, 0x3c, 0x58, 0x3a, 0x36, 0x1f, 0x47, 0x67,
-    0x38, 0x1f, 0x31, 0x26, 0x1a, 0x28, 0x26, 0x31, 0x36, 0x1d, 0x14, 0x12,
-    0x25, 0x14, 0x4c, 0x61, 0x61, 0x61, 0x1e, 0x08, 0x11, 0x3d, 0x19, 0x01,
-    0x0d, 0x11, 0x04, 0x19, 0x19, 0x06, 0x0e, 0x18, 0x17, 0x00, 0x08, 0x0f,
-    0x0f, 0x0f, 0x17, 0x17, 0x2e, 0x17, 0x08, 0x05, 0x18, 0x17, 0x08, 0x0f,
-    0x08, 0x08, 0x14, 0x38, 0x4f, 0x2b, 0x08, 0x01, 0x0d, 0x20, 0x17, 0x08,
-    0x0a, 0x0a, 0x08, 0x2b, 0x1e, 0x08, 0x1b, 0x2e, 0x25, 0x11, 0x11, 0x08,
-    0x11, 0x00, 0x0f, 0x1c, 0x1e, 0x0a, 0x07, 0x03, 0x07, 0x40, 0x35, 0x1e,
-    0x1e, 0x0a, 0x0c, 0x05, 0x1c, 0x1e, 0x14, 0x1e, 0x0e, 0x02, 0x08, 0x08,
-    0x0e, 0x12, 0x3c, 0x47, 0x28, 0x28, 0x38, 0x3c, 0x61, 0x7d, 0x52, 0x1a,
-    0x28, 0x1f, 0x28, 0x12, 0x1d, 0x1d, 0x12, 0x26, 0x1a, 0x1d, 0x26, 0x1d,
-    0x12, 0x1f, 0x0d, 0x06, 0x06, 0x47, 0x63, 0x52, 0x3e, 0x5d, 0x5d, 0x34,
-    0x56, 0x51, 0x85, 0x93, 0x2f, 0x3a, 0x5d, 0x75, 0x48, 0x6a, 0x60, 0x5e,
-    0x5d, 0x3a, 0x58, 0x6a, 0x78, 0x4e, 0x4e, 0x48, 0x7f, 0x90, 0x70, 0x78,
-    0x85, 0x51, 0x3e, 0x78, 0x85, 0x65, 0x65, 0x5e, 0x41, 0x51, 0x4e, 0x5a,
-    0x7f, 0x73, 0x9f, 0x91, 0x7f, 0x84, 0x91, 0x9d, 0xb4, 0xaf, 0x74, 0x74,
-    0x8e, 0x8e, 0x98, 0x65, 0x8e, 0x65, 0x65, 0x81, 0x81, 0x8e, 0x81, 0x5a,
-    0x84, 0x65, 0x5e, 0x5e, 0x65, 0x99, 0x99, 0x74, 0x8b, 0x92, 0x8c, 0x99,
-    0x8b, 0xa9, 0xbc, 0x88, 0x6e, 0x99, 0x99, 0x8c, 0x7a, 0x82, 0x94, 0x94,
-    0x6e, 0x73, 0x9f, 0x9b, 0x99, 0x9f, 0x5a, 0x84, 0xac, 0xab, 0x95, 0xab,
-    0x84, 0x70, 0x9f, 0x9f, 0x95, 0x99, 0x95, 0x54, 0x54, 0x73, 0x69, 0x95,
-    0x7a, 0x9c, 0x9c, 0x8e, 0x8c, 0x8c, 0x99, 0xac, 0xbc, 0x99, 0x84, 0x73,
-    0x65, 0x84, 0x54, 0x5a, 0x65, 0x60, 0x65, 0x65, 0x70, 0x65, 0x60, 0x5e,
-    0x5e, 0x48, 0x34, 0x41, 0x5a, 0x84, 0x70, 0x65, 0x84, 0x65, 0x70, 0x65,
-    0x79, 0xac, 0x91, 0x45, 0x5d, 0x70, 0x78, 0x56, 0x5e, 0x60, 0x70, 0x4e,
-    0x33, 0x48, 0x63, 0x66, 0x56, 0x4d, 0x33, 0x89, 0x93, 0x58, 0x66, 0x5f,
-    0x26, 0x2f, 0x58, 0x58, 0x3a, 0x36, 0x1d, 0x11, 0x1d, 0x26, 0x26, 0x33,
-    0x52, 0x7b, 0x3c, 0x26, 0x47, 0x47, 0x5f, 0x7b, 0x5f, 0x1f, 0x28, 0x31,
-    0x28, 0x12, 0x12, 0x12, 0x11, 0x14, 0x17, 0x13, 0x12, 0x06, 0x04, 0x13,
-    0x06, 0x03, 0x00, 0x13, 0x25, 0x1e, 0x00, 0x13, 0x19, 0x08, 0x19, 0x11,
-    0x3d, 0x46, 0x08, 0x08, 0x37, 0x25, 0x13, 0x17, 0x0f, 0x17, 0x0a, 0x02,
-    0x08, 0x1e, 0x17, 0x08, 0x08, 0x02, 0x08, 0x35, 0x35, 0x17, 0x1c, 0x0c,
-    0x05, 0x1c, 0x0f, 0x17, 0x11, 0x0f, 0x02, 0x07, 0x0a, 0x0f, 0x08, 0x0a,
-    0x08, 0x01, 0x0e, 0x2b, 0x40, 0x0a, 0x00, 0x08, 0x04, 0x0f, 0x0f, 0x00,
-    0x00, 0x05, 0x00, 0x18, 0x2e, 0x1c, 0x0f, 0x05, 0x00, 0x0f, 0x0c, 0x0c,
-    0x0f, 0x1c, 0x0e, 0x0a, 0x1e, 0x0a, 0x2e, 0x52, 0x61, 0x4f, 0x11, 0x11,
-    0x06, 0x0e, 0x12, 0x36, 0x25, 0x14, 0x10, 0x28, 0x28, 0x04, 0x11, 0x47,
-    0x47, 0x31, 0x31, 0x47, 0x58, 0x58, 0x12, 0x28, 0x28, 0x0d, 0x1a, 0x47,
-    0x47, 0x3c, 0x47, 0x12, 0x1f, 0x63, 0x34, 0x47, 0x2f, 0x48, 0x75, 0x48,
-    0x1a, 0x27, 0x66, 0xa7, 0x70, 0x2f, 0x48, 0x41, 0x4e, 0x75, 0x3a, 0x34,
-    0x5b, 0x33, 0x48, 0x70, 0x70, 0x48, 0x48, 0x56, 0x3e, 0x56, 0x43, 0x33,
-    0x5d, 0x5d, 0x45, 0x4e, 0x5e, 0x90, 0xac, 0xaf, 0x9d, 0x5e, 0x5a, 0x54,
-    0x45, 0x7f, 0x73, 0x65, 0x70, 0x65, 0x73, 0x8e, 0x69, 0x57, 0x74, 0x99,
-    0x81, 0x7a, 0x8e, 0x99, 0xaa, 0x74, 0x65, 0x84, 0x5a, 0x65, 0x90, 0x95,
-    0x84, 0x6e, 0x6e, 0x69, 0x8c, 0x8b, 0x84, 0x6e, 0x74, 0xaa, 0x94, 0x73,
-    0x54, 0x94, 0xad, 0xb4, 0x6e, 0x69, 0x6e, 0x6e, 0x94, 0x84, 0x54, 0x6e,
-    0x84, 0x5a, 0x91, 0x99, 0x84, 0x65, 0x84, 0x7f, 0x84, 0x84, 0x54, 0x65,
-    0x95, 0x5a, 0x5a, 0x73, 0x95, 0xac, 0xaf, 0xb4, 0x8c, 0x64, 0x6e, 0x60,
-    0x73, 0x7a, 0x84, 0x65, 0x5a, 0x65, 0x74, 0x64, 0x4a, 0x65, 0x9f, 0x8e,
-    0x84, 0x81, 0x91, 0xac, 0x8e, 0x54, 0x5a, 0x60, 0x51, 0x5d, 0x85, 0x4a,
-    0x77, 0x70, 0x45, 0x56, 0x7f, 0x70, 0x5e, 0x4e, 0x77, 0x79, 0x60, 0x34,
-    0x48, 0x7f, 0x9f, 0x5e, 0x34, 0x56, 0x41, 0x5d, 0x5b, 0x27, 0x2f, 0x4d,
-    0x1f, 0x3a, 0x6a, 0x51, 0x33, 0x27, 0x39, 0x1f, 0x47, 0x28, 0x12, 0x3c,
-    0x28, 0x12, 0x1e, 0x3c, 0x7b, 0x8a, 0x75, 0x66, 0x12, 0x1d, 0x10, 0x12,
-    0x28, 0x47, 0x36, 0x1f, 0x13, 0x28, 0x1a, 0x06, 0x06, 0x33, 0x2f, 0x1a,
-    0x18, 0x31, 0x4f, 0x4c, 0x12, 0x04, 0x06, 0x06, 0x0d, 0x25, 0x1e, 0x17,
-    0x13, 0x04, 0x01, 0x2b, 0x13, 0x0a, 0x08, 0x11, 0x25, 0x13, 0x00, 0x00,
-    0x14, 0x38, 0x14, 0x00, 0x00, 0x08, 0x13, 0x17, 0x0f, 0x00, 0x00, 0x00,
-    0x08, 0x1c, 0x1b, 0x0c, 0x0f, 0x0c, 0x0f, 0x1c, 0x0f, 0x03, 0x08, 0x11,
-    0x06, 0x0f, 0x0f, 0x1c, 0x2e, 0x38, 0x44, 0x0a, 0x14, 0x2e, 0x17, 0x02,
-    0x08, 0x0f, 0x1b, 0x17, 0x13, 0x20, 0x18, 0x0f, 0x0a, 0x61, 0x4b, 0x1e,
-    0x1c, 0x0a, 0x04, 0x13, 0x4f, 0x4c, 0x44, 0x5c, 0x37, 0x17, 0x2e, 0x28,
-    0x52, 0x4f, 0x25, 0x28, 0x28, 0x17, 0x14, 0x06, 0x20, 0x38, 0x13, 0x08,
-    0x06, 0x1d, 0x28, 0x17, 0x28, 0x31, 0x47, 0x5f, 0x47, 0x12, 0x31, 0x31,
-    0x28, 0x26, 0x52, 0x3c, 0x12, 0x12, 0x33, 0x31, 0x3a, 0x5f, 0x36, 0x58,
-    0x58, 0x3c, 0x34, 0x89, 0x8a, 0x48, 0x32, 0x48, 0x66, 0x75, 0x4d, 0x31,
-    0x33, 0x5d, 0x78, 0x4e, 0x64, 0x79, 0x5e, 0x51, 0x96, 0xa7, 0x78, 0x5e,
-    0x6a, 0x5d, 0x4e, 0x96, 0x9f, 0x91, 0x99, 0x99, 0x7f, 0x4e, 0x78, 0x99,
-    0x99, 0x91, 0x86, 0x77, 0x5e, 0x70, 0x5e, 0x5a, 0x9f, 0x7f, 0x4e, 0x4e,
-    0x7f, 0x90, 0x73, 0x65, 0x65, 0x74, 0x9c, 0xaa, 0x81, 0x69, 0x74, 0x81,
-    0x69, 0x7a, 0x7a, 0x65, 0x54, 0x6e, 0x6e, 0x84, 0x9b, 0x8e, 0x8b, 0x9f,
-    0x84, 0x84, 0x99, 0xab, 0xa1, 0x6e, 0x69, 0x8b, 0xac, 0x84, 0x65, 0x74,
-    0x82, 0xa9, 0x94, 0xa2, 0xb4, 0x9c, 0x6e, 0x94, 0xba, 0xaa, 0x74, 0x8b,
-    0x98, 0x6e, 0x99, 0xaf, 0xab, 0xaa, 0xab, 0xab, 0x84, 0x84, 0xab, 0xb4,
-    0x94, 0x8e, 0x91, 0x84, 0x91, 0x81, 0x81, 0x7a, 0x9f, 0x79, 0x60, 0x69,
-    0x74, 0x8e, 0x81, 0x81, 0x91, 0x8e, 0x99, 0x8e, 0x70, 0x91, 0x73, 0x5a,
-    0x73, 0x84, 0x65, 0x4e, 0x4e, 0x70, 0x6c, 0x91, 0x73, 0x54, 0x7f, 0x78,
-    0x4e, 0x85, 0x96, 0x96, 0x4e, 0x4e, 0x7f, 0x96, 0x78, 0x3e, 0x34, 0x56,
-    0x7f, 0x85, 0x60, 0x7f, 0x7f, 0x4e, 0x48, 0x9f, 0x96, 0x63, 0x58, 0x56,
-    0x3e, 0x33, 0x8a, 0x89, 0x75, 0x8a, 0x75, 0x44, 0x47, 0x63, 0x8a, 0x63,
-    0x3a, 0x47, 0x3c, 0x28, 0x1d, 0x12, 0x26, 0x52, 0x28, 0x0a, 0x12, 0x3c,
-    0x28, 0x12, 0x31, 0x28, 0x26, 0x4d, 0x31, 0x14, 0x13, 0x11, 0x06, 0x14,
-    0x44, 0x31, 0x06, 0x00, 0x11, 0x14, 0x1e, 0x31, 0x06, 0x28, 0x40, 0x0a,
-    0x08, 0x37, 0x4f, 0x1e, 0x08, 0x08, 0x31, 0x37, 0x08, 0x03, 0x04, 0x0f,
-    0x25, 0x08, 0x1e, 0x1e, 0x11, 0x08, 0x37, 0x61, 0x2b, 0x1b, 0x13, 0x0a,
-    0x08, 0x35, 0x4b, 0x38, 0x4f, 0x40, 0x0f, 0x0a, 0x17, 0x2b, 0x35, 0x0f,
-    0x08, 0x11, 0x07, 0x0f, 0x25, 0x2e, 0x08, 0x11, 0x08, 0x05, 0x35, 0x2e,
-    0x13, 0x01, 0x0f, 0x1c, 0x0a, 0x17, 0x1e, 0x17, 0x0a, 0x0f, 0x11, 0x14,
-    0x0a, 0x08, 0x11, 0x1e, 0x13, 0x40, 0x7d, 0x37, 0x11, 0x0a, 0x03, 0x06,
-    0x00, 0x00, 0x25, 0x0d, 0x12, 0x28, 0x12, 0x31, 0x25, 0x12, 0x4f, 0x12,
-    0x06, 0x47, 0x1f, 0x11, 0x12, 0x28, 0x1d, 0x31, 0x5f, 0x47, 0x1f, 0x2f,
-    0x58, 0x3e, 0x3a, 0x43, 0x43, 0x36, 0x10, 0x33, 0x58, 0x4d, 0x34, 0x33,
-    0x63, 0x33, 0x1f, 0x51, 0x85, 0x56, 0x33, 0x3a, 0x4d, 0x75, 0x70, 0x70,
-    0x45, 0x3a, 0x70, 0x7f, 0x4e, 0x70, 0x7f, 0x5d, 0x3e, 0x56, 0x7f, 0x45,
-    0x48, 0x4e, 0x70, 0x70, 0x79, 0xb1, 0xa7, 0x65, 0x4e, 0x3a, 0x2f, 0x32,
-    0x4a, 0x5a, 0x7f, 0x65, 0x77, 0x5e, 0x84, 0x91, 0x70, 0x91, 0x96, 0x54,
-    0x81, 0x99, 0x65, 0x64, 0x64, 0x84, 0x8e, 0x8e, 0x99, 0x81, 0x84, 0x7a,
-    0x99, 0x84, 0x99, 0x99, 0x7a, 0x65, 0x81, 0x95, 0x9f, 0x99, 0x84, 0x8e,
-    0x8e, 0x65, 0x64, 0x9c, 0xa9, 0x74, 0x7a, 0x6e, 0x8b, 0x9c, 0xa9, 0x99,
-    0x69, 0x8c, 0xad, 0x74, 0x99, 0x94, 0x99, 0x73, 0x84, 0x99, 0x8c, 0x65,
-    0x65, 0x84, 0x99, 0x7a, 0xab, 0xac, 0x99, 0x65, 0x60, 0x45, 0x4e, 0x54,
-    0x69, 0x8e, 0x74, 0x84, 0x70, 0x65, 0x9f, 0x8e, 0x81, 0x9f, 0x70, 0x70,
-    0x99, 0x6e, 0x54, 0x70, 0x65, 0x65, 0x73, 0x90, 0x65, 0x65, 0x91, 0x91,
-    0x77, 0x70, 0x91, 0x91, 0x4e, 0x4e, 0x7f, 0x65, 0x70, 0x4e, 0x54, 0x7f,
-    0x48, 0x48, 0x70, 0x91, 0x6c, 0x48, 0x56, 0x45, 0x7f, 0x79, 0x70, 0x41,
-    0x4d, 0x91, 0x5e, 0x41, 0x6c, 0x75, 0x3e, 0x33, 0x48, 0x5d, 0x33, 0x26,
-    0x28, 0x58, 0x3c, 0x63, 0x9a, 0x75, 0x34, 0x1a, 0x06, 0x06, 0x06, 0x0d,
-    0x31, 0x1f, 0x28, 0x2f, 0x26, 0x3c, 0x2f, 0x26, 0x3a, 0x28, 0x06, 0x44,
-    0x28, 0x10, 0x11, 0x14, 0x1d, 0x28, 0x44, 0x31, 0x17, 0x1e, 0x1e, 0x12,
-    0x12, 0x2e, 0x31, 0x0d, 0x01, 0x17, 0x2e, 0x0e, 0x08, 0x08, 0x12, 0x0e,
-    0x00, 0x0e, 0x1e, 0x1e, 0x11, 0x11, 0x0a, 0x1e, 0x44, 0x1e, 0x06, 0x02,
-    0x19, 0x17, 0x0e, 0x17, 0x14, 0x1e, 0x0a, 0x0f, 0x17, 0x18, 0x08, 0x0a,
-    0x0f, 0x0a, 0x19, 0x4f, 0x40, 0x08, 0x05, 0x08, 0x02, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x1e, 0x37, 0x0a, 0x03, 0x03, 0x02, 0x08, 0x0e, 0x11, 0x31,
-    0x13, 0x03, 0x0e, 0x0a, 0x2e, 0x61, 0x1e, 0x1e, 0x28, 0x0a, 0x1e, 0x25,
-    0x11, 0x1e, 0x11, 0x08, 0x06, 0x1e, 0x28, 0x1e, 0x2e, 0x28, 0x0a, 0x1d,
-    0x28, 0x18, 0x12, 0x4c, 0x38, 0x06, 0x06, 0x26, 0x31, 0x28, 0x1f, 0x3c,
-    0x3c, 0x28, 0x52, 0x31, 0x12, 0x12, 0x1d, 0x3a, 0x63, 0x63, 0x3a, 0x27,
-    0x33, 0x26, 0x20, 0x10, 0x2f, 0x48, 0x2f, 0x27, 0x2f, 0x3a, 0x43, 0x2f,
-    0x33, 0x5b, 0x9a, 0x78, 0x3e, 0x1f, 0x26, 0x32, 0x45, 0x5b, 0x5d, 0x70,
-    0x48, 0x32, 0x4d, 0x70, 0xa0, 0x96, 0x6c, 0x96, 0x60, 0x70, 0x70, 0x4e,
-    0x60, 0x5d, 0x4e, 0x70, 0x64, 0x7f, 0x78, 0x65, 0x7f, 0x5e, 0x65, 0x81,
-    0x70, 0x70, 0x95, 0x99, 0x54, 0x3e, 0x70, 0x8e, 0x6e, 0x6e, 0x8e, 0x8e,
-    0x74, 0x99, 0x81, 0x65, 0x65, 0x81, 0x84, 0xab, 0xab, 0x99, 0x6e, 0x7a,
-    0x6e, 0x73, 0x65, 0x6e, 0x65, 0x84, 0x6e, 0x69, 0x84, 0x8c, 0x6e, 0x65,
-    0x6e, 0xb4, 0xb4, 0x82, 0x65, 0x5a, 0x65, 0x65, 0x7a, 0x8e, 0x9c, 0x99,
-    0x54, 0x54, 0x84, 0xab, 0xaf, 0x99, 0x99, 0x99, 0x81, 0x8e, 0x6e, 0x84,
-    0x84, 0x65, 0x65, 0x81, 0x8e, 0x7a, 0x8e, 0x99, 0x6e, 0x74, 0x98, 0x81,
-    0x77, 0x9f, 0xb1, 0x84, 0x4e, 0x57, 0x84, 0x90, 0x84, 0x91, 0x73, 0x65,
-    0x91, 0x84, 0x5e, 0x4e, 0x70, 0x70, 0x84, 0x9f, 0x84, 0x70, 0x5a, 0x70,
-    0x54, 0x56, 0x4e, 0x54, 0x57, 0x60, 0x45, 0x4e, 0x60, 0x4e, 0x3e, 0x45,
-    0x86, 0xa0, 0x79, 0x48, 0x27, 0x3a, 0x34, 0x56, 0x48, 0x5e, 0x6c, 0x2f,
-    0x26, 0x33, 0x78, 0x96, 0x78, 0x56, 0x6a, 0x33, 0x3a, 0x3a, 0x3c, 0x3a,
-    0x1f, 0x26, 0x27, 0x2f, 0x47, 0x3c, 0x36, 0x3c, 0x1f, 0x26, 0x2f, 0x18,
-    0x1f, 0x67, 0x52, 0x06, 0x0e, 0x31, 0x31, 0x31, 0x25, 0x36, 0x31, 0x28,
-    0x47, 0x1d, 0x11, 0x12, 0x17, 0x28, 0x44, 0x4f, 0x31, 0x14, 0x1e, 0x11,
-    0x04, 0x03, 0x08, 0x0e, 0x08, 0x06, 0x11, 0x08, 0x0e, 0x06, 0x01, 0x0e,
-    0x40, 0x25, 0x0a, 0x08, 0x00, 0x00, 0x0a, 0x13, 0x1e, 0x18, 0x08, 0x08,
-    0x0f, 0x0f, 0x44, 0x25, 0x0a, 0x35, 0x0f, 0x0f, 0x18, 0x0a, 0x08, 0x0a,
-    0x06, 0x07, 0x1c, 0x21, 0x17, 0x0c, 0x0c, 0x08, 0x03, 0x00, 0x07, 0x0f,
-    0x00, 0x0f, 0x08, 0x0a, 0x11, 0x06, 0x14, 0x14, 0x08, 0x1c, 0x4b, 0x4b,
-    0x2e, 0x1c, 0x0f, 0x18, 0x17, 0x1c, 0x1e, 0x1e, 0x1e, 0x2e, 0x2e, 0x1e,
-    0x25, 0x1e, 0x1e, 0x31, 0x61, 0x4f, 0x0e, 0x1d, 0x28, 0x4f, 0x31, 0x13,
-    0x06, 0x0e, 0x0d, 0x61, 0x7d, 0x52, 0x1a, 0x43, 0x67, 0x58, 0x26, 0x52,
-    0x67, 0x53, 0x3a, 0x26, 0x1f, 0x2f, 0x3a, 0x33, 0x33, 0x34, 0x66, 0x3e,
-    0x48, 0x2f, 0x1a, 0x27, 0x3e, 0x8a, 0x75, 0x56, 0x3e, 0x2f, 0x32, 0x48,
-    0x3e, 0x3e, 0x3a, 0x5b, 0x56, 0x70, 0x70, 0x60, 0x5d, 0x86, 0x90, 0x91,
-    0x78, 0x48, 0x5e, 0x70, 0x5e, 0x60, 0x70, 0x78, 0x7f, 0x90, 0x70, 0x70,
-    0x79, 0x65, 0x73, 0x9d, 0x9f, 0x7f, 0x70, 0x81, 0x9f, 0x95, 0x65, 0x57,
-    0x57, 0x60, 0x90, 0xaf, 0x99, 0x65, 0x84, 0x9d, 0xac, 0x81, 0x79, 0xaf,
-    0xaa, 0x94, 0x84, 0x69, 0x6e, 0x7a, 0x8e, 0x8e, 0x8e, 0x9c, 0xaa, 0x74,
-    0x73, 0x65, 0x69, 0x81, 0x9c, 0xa9, 0x99, 0x8e, 0x6e, 0x65, 0x6e, 0x84,
-    0x99, 0x73, 0x84, 0x6e, 0x99, 0x99, 0x98, 0x99, 0x95, 0xaf, 0xaf, 0xaf,
-    0x81, 0x6e, 0x99, 0x8b, 0x8e, 0x8b, 0x91, 0x74, 0xab, 0x99, 0x8e, 0x84,
-    0x8e, 0x8e, 0x9c, 0xb4, 0x99, 0x81, 0x6e, 0x94, 0xac, 0x91, 0x57, 0x65,
-    0x65, 0x73, 0xb1, 0xac, 0x5a, 0x91, 0x9f, 0x9f, 0x84, 0x5e, 0x9f, 0xac,
-    0x9f, 0x73, 0x70, 0x60, 0x5a, 0x7f, 0x70, 0x5a, 0x91, 0x91, 0x65, 0x57,
-    0x45, 0x48, 0x5b, 0x7f, 0x91, 0x70, 0x5e, 0x4e, 0x48, 0x48, 0x4e, 0x60,
-    0x4e, 0x48, 0x5d, 0x5d, 0x78, 0x5d, 0x5d, 0x56, 0x8a, 0x86, 0x85, 0x56,
-    0x33, 0x58, 0x3e, 0x58, 0x4d, 0x3a, 0x58, 0x67, 0x67, 0x58, 0x47, 0x3c,
-    0x47, 0x5f, 0x8a, 0x58, 0x1a, 0x2d, 0x2d, 0x67, 0x53, 0x1a, 0x12, 0x12,
-    0x12, 0x67, 0x7b, 0x4f, 0x1d, 0x31, 0x61, 0x47, 0x28, 0x4c, 0x61, 0x4f,
-    0x1e, 0x06, 0x06, 0x09, 0x25, 0x18, 0x25, 0x25, 0x40, 0x2e, 0x0e, 0x01,
-    0x08, 0x04, 0x1e, 0x37, 0x3d, 0x11, 0x03, 0x08, 0x0a, 0x08, 0x0a, 0x0a,
-    0x0e, 0x11, 0x0a, 0x11, 0x11, 0x0a, 0x0f, 0x37, 0x46, 0x35, 0x1c, 0x0a,
-    0x0c, 0x1c, 0x0c, 0x1c, 0x18, 0x1c, 0x0f, 0x1c, 0x0a, 0x0f, 0x1c, 0x1b,
-    0x0f, 0x35, 0x4b, 0x17, 0x35, 0x18, 0x08, 0x0a, 0x0e, 0x08, 0x02, 0x08,
-    0x1e, 0x08, 0x00, 0x06, 0x00, 0x0a, 0x11, 0x17, 0x0f, 0x0f, 0x08, 0x02,
-    0x0f, 0x07, 0x00, 0x2e, 0x11, 0x00, 0x06, 0x06, 0x2e, 0x2e, 0x1e, 0x06,
-    0x00, 0x13, 0x40, 0x4f, 0x26, 0x1e, 0x14, 0x25, 0x31, 0x47, 0x1d, 0x1d,
-    0x28, 0x2e, 0x28, 0x12, 0x12, 0x11, 0x1a, 0x36, 0x67, 0x52, 0x1a, 0x31,
-    0x26, 0x26, 0x3c, 0x26, 0x26, 0x27, 0x3a, 0x3a, 0x5b, 0x58, 0x6c, 0x8a,
-    0x4d, 0x3a, 0x4d, 0x56, 0x6c, 0x41, 0x2f, 0x48, 0x5d, 0x48, 0x2f, 0x3e,
-    0x3e, 0x41, 0x3a, 0x32, 0x45, 0x5b, 0x5d, 0x56, 0x45, 0x4e, 0x3e, 0x34,
-    0x4e, 0x27, 0x60, 0x7f, 0x3e, 0x50, 0x41, 0x5e, 0x91, 0x7f, 0x4e, 0x4e,
-    0x60, 0x8e, 0xaf, 0x81, 0x5a, 0x65, 0x8e, 0x74, 0x99, 0x90, 0x7f, 0x7f,
-    0x65, 0x7f, 0x77, 0x70, 0x60, 0x60, 0x73, 0x99, 0xab, 0x81, 0x69, 0x74,
-    0x81, 0x81, 0x81, 0x74, 0x81, 0x8e, 0x81, 0x94, 0x94, 0x99, 0xb4, 0x99,
-    0x65, 0x6e, 0x8e, 0x99, 0x8e, 0x6e, 0x8e, 0x7a, 0x6e, 0x65, 0x5a, 0x84,
-    0x73, 0x64, 0x69, 0x81, 0x74, 0x81, 0x99, 0x81, 0x84, 0x6e, 0x64, 0x81,
-    0x57, 0x79, 0xab, 0x81, 0x65, 0x65, 0x65, 0x99, 0x99, 0x73, 0x65, 0x65,
-    0x8e, 0xaa, 0x98, 0x81, 0x65, 0x6e, 0x8e, 0x99, 0x94, 0x81, 0x6e, 0x7f,
-    0x70, 0x7f, 0x70, 0x4e, 0x4a, 0x70, 0x73, 0x9f, 0x70, 0x54, 0x57, 0x54,
-    0x70, 0x54, 0x4e, 0x54, 0x65, 0x70, 0x79, 0x81, 0x65, 0x8e, 0x91, 0x5b,
-    0x5d, 0x5d, 0x85, 0x86, 0x45, 0x45, 0x6c, 0x4e, 0x41, 0x48, 0x4e, 0x4d,
-    0x33, 0x32, 0x3a, 0x58, 0x3e, 0x56, 0x4d, 0x3a, 0x3a, 0x12, 0x33, 0x2f,
-    0x12, 0x63, 0x52, 0x14, 0x12, 0x12, 0x52, 0x63, 0x43, 0x12, 0x0d, 0x1a,
-    0x56, 0x5d, 0x33, 0x28, 0x1a, 0x26, 0x3c, 0x58, 0x3c, 0x1e, 0x28, 0x25,
-    0x20, 0x0e, 0x11, 0x06, 0x11, 0x2e, 0x38, 0x1e, 0x11, 0x13, 0x14, 0x12,
-    0x14, 0x11, 0x06, 0x14, 0x31, 0x12, 0x13, 0x1d, 0x39, 0x39, 0x1e, 0x0e,
-    0x04, 0x11, 0x2e, 0x0a, 0x0a, 0x0a, 0x0a, 0x06, 0x00, 0x0f, 0x0a, 0x00,
-    0x00, 0x00, 0x0f, 0x0c, 0x17, 0x11, 0x0f, 0x07, 0x03, 0x0c, 0x05, 0x03,
-    0x0c, 0x1e, 0x02, 0x00, 0x00, 0x14, 0x35, 0x1c, 0x02, 0x00, 0x04, 0x11,
-    0x07, 0x0a, 0x00, 0x0f, 0x18, 0x0a, 0x00, 0x00, 0x0e, 0x17, 0x37, 0x1e,
-    0x08, 0x11, 0x0a, 0x08, 0x07, 0x03, 0x07, 0x19, 0x0f, 0x55, 0x61, 0x08,
-    0x0a, 0x14, 0x14, 0x37, 0x08, 0x2e, 0x47, 0x40, 0x37, 0x17, 0x0a, 0x0b,
-    0x1d, 0x47, 0x12, 0x25, 0x0d, 0x20, 0x1e, 0x0d, 0x06, 0x2e, 0x26, 0x25,
-    0x31, 0x12, 0x06, 0x12, 0x12, 0x06, 0x09, 0x31, 0x5f, 0x52, 0x26, 0x43,
-    0x3a, 0x12, 0x1d, 0x1a, 0x34, 0x5d, 0x63, 0x48, 0x66, 0x63, 0x3a, 0x33,
-    0x34, 0x2f, 0x3e, 0x6c, 0x78, 0x36, 0x2f, 0x58, 0x5d, 0x85, 0x7f, 0x48,
-    0x51, 0x5d, 0x6c, 0x4e, 0x48, 0x5d, 0x6c, 0x70, 0x96, 0xb1, 0x78, 0x48,
-    0x70, 0x70, 0x64, 0x4e, 0x60, 0x91, 0x9d, 0x91, 0x65, 0x65, 0x57, 0x70,
-    0x91, 0x5a, 0x65, 0x65, 0x65, 0x7f, 0x5a, 0x4e, 0x70, 0x73, 0x73, 0x73,
-    0x70, 0x57, 0x57, 0x57, 0x57, 0x60, 0x65, 0x94, 0xaa, 0x6e, 0x8e, 0x99,
-    0x74, 0x69, 0x64, 0x81, 0x99, 0xaa, 0x99, 0x8c, 0xa1, 0x7a, 0x69, 0x81,
-    0x65, 0x6e, 0x99, 0xab, 0x84, 0x54, 0x73, 0x95, 0x99, 0xb4, 0x8e, 0x69,
-    0x74, 0x74, 0x8e, 0x69, 0x69, 0x74, 0x81, 0x99, 0xbc, 0xaf, 0x65, 0x64,
-    0x74, 0x98, 0x8e, 0x57, 0x99, 0xac, 0x9d, 0x99, 0x8e, 0x81, 0x69, 0x8e,
-    0x99, 0x69, 0x6e, 0x65, 0x74, 0x8e, 0x65, 0x57, 0x84, 0x73, 0x7f, 0x65,
-    0x60, 0x50, 0x45, 0x45, 0x4e, 0x4e, 0x65, 0x84, 0x73, 0x65, 0x91, 0x60,
-    0x50, 0x4e, 0x4e, 0x77, 0x84, 0x73, 0x70, 0x7f, 0x7f, 0x4e, 0x56, 0x4e,
-    0x3e, 0x4e, 0x93, 0x6c, 0x48, 0x33, 0x3e, 0x5d, 0x8a, 0x6c, 0x3a, 0x48,
-    0x51, 0x56, 0x27, 0x1a, 0x34, 0x3a, 0x43, 0x89, 0x8a, 0x47, 0x1d, 0x47,
-    0x52, 0x3a, 0x28, 0x3c, 0x75, 0x7b, 0x53, 0x3a, 0x26, 0x12, 0x26, 0x4d,
-    0x18, 0x26, 0x1a, 0x26, 0x26, 0x12, 0x0e, 0x1d, 0x28, 0x14, 0x28, 0x11,
-    0x00, 0x0e, 0x0d, 0x00, 0x06, 0x12, 0x3d, 0x25, 0x1e, 0x28, 0x14, 0x07,
-    0x0a, 0x06, 0x0d, 0x2e, 0x28, 0x1d, 0x1e, 0x25, 0x0a, 0x06, 0x0a, 0x06,
-    0x08, 0x1e, 0x17, 0x06, 0x00, 0x06, 0x11, 0x1e, 0x29, 0x08, 0x08, 0x11,
-    0x0e, 0x08, 0x02, 0x08, 0x0f, 0x0c, 0x35, 0x4b, 0x25, 0x00, 0x0a, 0x17,
-    0x1e, 0x09, 0x08, 0x14, 0x25, 0x37, 0x13, 0x06, 0x11, 0x08, 0x06, 0x08,
-    0x00, 0x0a, 0x38, 0x1c, 0x00, 0x07, 0x0a, 0x0a, 0x08, 0x06, 0x0f, 0x03,
-    0x08, 0x0a, 0x1e, 0x19, 0x08, 0x1e, 0x2e, 0x17, 0x46, 0x25, 0x0d, 0x1e,
-    0x1e, 0x08, 0x0a, 0x2b, 0x37, 0x17, 0x06, 0x12, 0x4f, 0x2e, 0x38, 0x38,
-    0x0d, 0x0d, 0x20, 0x28, 0x2e, 0x18, 0x1e, 0x28, 0x12, 0x28, 0x47, 0x4c,
-    0x44, 0x44, 0x26, 0x14, 0x14, 0x12, 0x33, 0x2f, 0x26, 0x1a, 0x26, 0x4d,
-    0x3a, 0x12, 0x12, 0x18, 0x58, 0x48, 0x56, 0x5d, 0x48, 0x58, 0x3a, 0x26,
-    0x3a, 0x85, 0x75, 0x3a, 0x26, 0x27, 0x47, 0x3e, 0x56, 0x5d, 0x56, 0x3a,
-    0x34, 0x6c, 0x5e, 0x48, 0x58, 0x5b, 0x6c, 0x7f, 0x96, 0x70, 0x65, 0x79,
-    0x4e, 0x48, 0x70, 0x9d, 0x73, 0x50, 0x70, 0x9f, 0x90, 0x73, 0x81, 0x69,
-    0x65, 0x7f, 0x7f, 0x7f, 0x65, 0x5a, 0x7f, 0x5a, 0x65, 0x9f, 0x8e, 0x84,
-    0x74, 0x84, 0x65, 0x65, 0x69, 0x6e, 0x74, 0x6e, 0x69, 0x65, 0x74, 0x99,
-    0x8e, 0x57, 0x50, 0x90, 0x7a, 0x8e, 0xab, 0x84, 0x73, 0x84, 0x65, 0x70,
-    0xab, 0xac, 0x84, 0x54, 0x5e, 0x65, 0x81, 0x74, 0x74, 0x74, 0x6e, 0x65,
-    0x8e, 0x8e, 0x73, 0x65, 0x91, 0x79, 0x7a, 0xac, 0x9c, 0x81, 0x99, 0x84,
-    0x60, 0x65, 0x99, 0x99, 0x73, 0x70, 0x8e, 0x99, 0x81, 0x99, 0x81, 0x69,
-    0x65, 0x6e, 0x81, 0x81, 0x70, 0x70, 0x65, 0x5a, 0x91, 0x81, 0x91, 0x79,
-    0x73, 0x54, 0x4e, 0x54, 0x4e, 0x70, 0x5e, 0x5e, 0x4e, 0x60, 0x79, 0x5e,
-    0x48, 0x26, 0x56, 0x7f, 0x60, 0x79, 0x70, 0x56, 0x5d, 0x41, 0x3a, 0x5e,
-    0x96, 0x5d, 0x3e, 0x2f, 0x26, 0x3a, 0x51, 0x58, 0x51, 0x34, 0x27, 0x33,
-    0x3e, 0x3a, 0x1a, 0x44, 0x47, 0x38, 0x7b, 0x66, 0x3c, 0x47, 0x47, 0x1d,
-    0x12, 0x47, 0x58, 0x27, 0x14, 0x26, 0x58, 0x52, 0x3c, 0x47, 0x1a, 0x18,
-    0x28, 0x38, 0x25, 0x1e, 0x1e, 0x25, 0x06, 0x20, 0x40, 0x12, 0x1e, 0x31,
-    0x13, 0x08, 0x0e, 0x06, 0x0d, 0x0e, 0x08, 0x08, 0x08, 0x1e, 0x14, 0x06,
-    0x08, 0x08, 0x1e, 0x14, 0x13, 0x13, 0x06, 0x08, 0x06, 0x08, 0x00, 0x28,
-    0x2e, 0x06, 0x00, 0x0a, 0x0f, 0x07, 0x08, 0x08, 0x07, 0x03, 0x0a, 0x0a,
-    0x0a, 0x0f, 0x0a, 0x1c, 0x1c, 0x2b, 0x1c, 0x17, 0x17, 0x0a, 0x08, 0x04,
-    0x11, 0x25, 0x11, 0x06, 0x11, 0x08, 0x03, 0x08, 0x0e, 0x25, 0x35, 0x38,
-    0x35, 0x1e, 0x03, 0x11, 0x35, 0x0a, 0x0e, 0x08, 0x35, 0x46, 0x0a, 0x37,
-    0x25, 0x19, 0x25, 0x1e, 0x11, 0x00, 0x00, 0x25, 0x28, 0x28, 0x1c, 0x09,
-    0x0e, 0x18, 0x14, 0x1d, 0x3d, 0x37, 0x1e, 0x04, 0x14, 0x52, 0x52, 0x39,
-    0x29, 0x37, 0x12, 0x01, 0x20, 0x4f, 0x5c, 0x4f, 0x44, 0x4c, 0x3c, 0x47,
-    0x47, 0x1a, 0x26, 0x47, 0x66, 0x43, 0x3a, 0x47, 0x14, 0x47, 0x89, 0x75,
-    0x3a, 0x2f, 0x5d, 0x5b, 0x3e, 0x34, 0x34, 0x3a, 0x5d, 0x86, 0x85, 0x70,
-    0x5d, 0x4d, 0x3a, 0x78, 0x78, 0x58, 0x2f, 0x6c, 0x96, 0x86, 0x78, 0x86,
-    0x56, 0x5d, 0x70, 0x4a, 0x3a, 0x41, 0x60, 0x7f, 0x7f, 0x7f, 0x4e, 0x70,
-    0x57, 0x79, 0x79, 0x7f, 0x89, 0x77, 0x5e, 0x65, 0x99, 0x9f, 0x90, 0x90,
-    0x81, 0x73, 0x4e, 0x70, 0x9f, 0x9f, 0x99, 0x95, 0x99, 0x8e, 0x99, 0x8b,
-    0x74, 0x6e, 0x8e, 0x98, 0xaa, 0x8e, 0x98, 0x64, 0x79, 0xab, 0xaf, 0x8e,
-    0x65, 0x8e, 0x99, 0x84, 0x65, 0x84, 0x5a, 0x84, 0xac, 0xab, 0xab, 0xa1,
-    0x84, 0x70, 0x8e, 0x9f, 0x84, 0x73, 0x81, 0xaa, 0xaa, 0x8e, 0xab, 0x99,
-    0x65, 0x91, 0x8e, 0x65, 0x60, 0x64, 0x98, 0x9f, 0x9f, 0x64, 0x65, 0x81,
-    0x81, 0x84, 0x84, 0x90, 0x85, 0x7f, 0x54, 0x6e, 0xaa, 0x99, 0x99, 0x84,
-    0x91, 0x70, 0x4a, 0x84, 0x91, 0x8e, 0x8e, 0x91, 0x79, 0x65, 0x84, 0x5e,
-    0x60, 0x7f, 0x70, 0x91, 0x70, 0x79, 0x5e, 0x56, 0x86, 0x9f, 0x93, 0x48,
-    0x4e, 0x85, 0x60, 0x56, 0x66, 0x51, 0x3e, 0x5d, 0x85, 0x86, 0x7f, 0x60,
-    0x36, 0x3a, 0x8a, 0x51, 0x52, 0x27, 0x6c, 0x8a, 0x48, 0x67, 0x58, 0x2f,
-    0x52, 0x58, 0x26, 0x06, 0x0d, 0x3c, 0x4c, 0x5c, 0x44, 0x1f, 0x26, 0x26,
-    0x36, 0x3c, 0x52, 0x47, 0x3c, 0x12, 0x18, 0x58, 0x67, 0x3a, 0x28, 0x28,
-    0x12, 0x00, 0x11, 0x40, 0x4f, 0x31, 0x25, 0x38, 0x1e, 0x20, 0x14, 0x09,
-    0x28, 0x25, 0x38, 0x38, 0x1e, 0x11, 0x02, 0x18, 0x4b, 0x2e, 0x0e, 0x09,
-    0x06, 0x0d, 0x09, 0x00, 0x08, 0x0a, 0x17, 0x37, 0x38, 0x40, 0x37, 0x08,
-    0x02, 0x1c, 0x1e, 0x0f, 0x08, 0x0f, 0x2e, 0x11, 0x1b, 0x2b, 0x0a, 0x1e,
-    0x1e, 0x25, 0x08, 0x02, 0x00, 0x1e, 0x14, 0x07, 0x08, 0x06, 0x0a, 0x0f,
-    0x02, 0x08, 0x08, 0x13, 0x18, 0x0a, 0x02, 0x17, 0x4b, 0x2e, 0x1e, 0x16,
-    0x17, 0x0a, 0x1e, 0x11, 0x0a, 0x08, 0x08, 0x0e, 0x00, 0x25, 0x37, 0x08,
-    0x08, 0x11, 0x2e, 0x18, 0x08, 0x06, 0x0e, 0x0e, 0x0e, 0x08, 0x0a, 0x10,
-    0x00, 0x02, 0x0c, 0x14, 0x13, 0x0d, 0x44, 0x44, 0x14, 0x17, 0x3f, 0x47,
-    0x1d, 0x12, 0x38, 0x38, 0x13, 0x00, 0x12, 0x31, 0x26, 0x12, 0x1d, 0x1d,
-    0x26, 0x1a, 0x12, 0x12, 0x28, 0x4f, 0x5c, 0x43, 0x3c, 0x47, 0x3a, 0x3a,
-    0x33, 0x33, 0x48, 0x78, 0x34, 0x1a, 0x56, 0x85, 0x78, 0x5d, 0x5d, 0x6c,
-    0x3a, 0x5d, 0x78, 0x56, 0x48, 0x41, 0x60, 0x56, 0x4a, 0x93, 0x56, 0x58,
-    0x51, 0x70, 0x91, 0x6c, 0x4d, 0x50, 0x65, 0x4e, 0x48, 0x57, 0x7f, 0x56,
-    0x1f, 0x41, 0x70, 0x70, 0x4e, 0x70, 0x96, 0x70, 0x54, 0x91, 0x84, 0x7f,
-    0x70, 0x65, 0x8e, 0x69, 0x57, 0x57, 0x73, 0x81, 0x64, 0x65, 0x65, 0x81,
-    0x69, 0x54, 0x5a, 0x79, 0x91, 0x90, 0x91, 0x91, 0x84, 0x84, 0x73, 0x65,
-    0x65, 0x65, 0x95, 0x9f, 0x60, 0x65, 0xac, 0xaa, 0x99, 0x84, 0x91, 0x70,
-    0x79, 0x9d, 0x84, 0x65, 0x70, 0x81, 0x73, 0x81, 0xab, 0x9f, 0x70, 0x65,
-    0x73, 0x99, 0x99, 0x65, 0x57, 0x84, 0x5a, 0x4e, 0x54, 0x81, 0x65, 0x3e,
-    0x41, 0x5a, 0x7f, 0x4e, 0x5e, 0x85, 0x7f, 0x70, 0x7f, 0x84, 0x84, 0x65,
-    0x70, 0x91, 0x64, 0x5b, 0x45, 0x4e, 0x7f, 0x70, 0x4e, 0x5d, 0x4e, 0x60,
-    0x48, 0x45, 0x48, 0x75, 0x78, 0x85, 0x6a, 0x3e, 0x5d, 0x5b, 0x56, 0x3e,
-    0x34, 0x5b, 0x78, 0x3a, 0x32, 0x70, 0x91, 0x78, 0x5d, 0x6c, 0x43, 0x33,
-    0x67, 0x51, 0x32, 0x3c, 0x2f, 0x4d, 0x1a, 0x63, 0x63, 0x3c, 0x1f, 0x1d,
-    0x3a, 0x58, 0x26, 0x12, 0x31, 0x33, 0x12, 0x11, 0x36, 0x1d, 0x04, 0x00,
-    0x12, 0x2d, 0x18, 0x14, 0x52, 0x47, 0x0d, 0x0d, 0x1a, 0x2e, 0x17, 0x0d,
-    0x37, 0x44, 0x1e, 0x00, 0x04, 0x0d, 0x11, 0x06, 0x0e, 0x0c, 0x11, 0x0a,
-    0x08, 0x0f, 0x19, 0x2b, 0x2b, 0x18, 0x0f, 0x1e, 0x0a, 0x00, 0x0e, 0x07,
-    0x08, 0x1e, 0x18, 0x08, 0x08, 0x35, 0x40, 0x1e, 0x1c, 0x17, 0x18, 0x17,
-    0x1c, 0x0a, 0x0a, 0x08, 0x07, 0x00, 0x08, 0x37, 0x0a, 0x08, 0x0f, 0x17,
-    0x1c, 0x17, 0x08, 0x02, 0x08, 0x07, 0x02, 0x07, 0x08, 0x17, 0x35, 0x1c,
-    0x07, 0x08, 0x00, 0x02, 0x00, 0x03, 0x0c, 0x0c, 0x03, 0x35, 0x1e, 0x35,
-    0x46, 0x0f, 0x02, 0x04, 0x14, 0x11, 0x17, 0x11, 0x08, 0x1e, 0x1e, 0x08,
-    0x17, 0x04, 0x0d, 0x38, 0x37, 0x13, 0x31, 0x4f, 0x2e, 0x17, 0x17, 0x2e,
-    0x2e, 0x2e, 0x1e, 0x1e, 0x12, 0x06, 0x12, 0x47, 0x1d, 0x12, 0x13, 0x06,
-    0x44, 0x4f, 0x52, 0x12, 0x06, 0x09, 0x58, 0x5f, 0x1a, 0x52, 0x3c, 0x3a,
-    0x89, 0x44, 0x36, 0x20, 0x31, 0x47, 0x12, 0x27, 0x56, 0x6c, 0x78, 0x48,
-    0x2f, 0x3a, 0x33, 0x12, 0x10, 0x48, 0x5d, 0x26, 0x51, 0x75, 0x86, 0x85,
-    0x5d, 0x48, 0x45, 0x4e, 0x4e, 0x4e, 0x3e, 0x45, 0x70, 0x70, 0x48, 0x77,
-    0x5e, 0x4a, 0x85, 0x78, 0x60, 0x78, 0x78, 0x93, 0x65, 0x57, 0x73, 0x7f,
-    0x70, 0x6c, 0x5d, 0x4e, 0x4e, 0x45, 0x73, 0x84, 0x5e, 0x4e, 0x4e, 0x70,
-    0x9f, 0x9d, 0x70, 0x3e, 0x48, 0x73, 0x9f, 0x91, 0x7f, 0x99, 0x65, 0xac,
-    0x91, 0x70, 0x70, 0x54, 0x7f, 0x54, 0x60, 0x91, 0x9f, 0xaf, 0x99, 0x5a,
-    0x65, 0x81, 0x57, 0x4e, 0x60, 0x8c, 0x65, 0x65, 0x99, 0x9d, 0xaf, 0x9f,
-    0x70, 0x65, 0x81, 0x74, 0x84, 0x79, 0x70, 0x7f, 0x84, 0x54, 0x69, 0x81,
-    0x5a, 0x90, 0x90, 0x77, 0x70, 0x7f, 0x84, 0x84, 0x65, 0x79, 0x84, 0x70,
-    0x85, 0x5d, 0x56, 0x4e, 0x56, 0x4e, 0x84, 0x5a, 0x4e, 0x48, 0x45, 0x91,
-    0xa0, 0x70, 0x48, 0x27, 0x56, 0x85, 0x70, 0x5b, 0x70, 0x5d, 0x85, 0x9a,
-    0x63, 0x56, 0x4d, 0x48, 0x58, 0x2f, 0x58, 0x60, 0x7f, 0x96, 0x48, 0x2f,
-    0x43, 0x3a, 0x1a, 0x1a, 0x56, 0x63, 0x1f, 0x63, 0x5d, 0x85, 0x63, 0x33,
-    0x36, 0x26, 0x43, 0x4d, 0x36, 0x26, 0x1f, 0x3a, 0x36, 0x20, 0x3a, 0x26,
-    0x28, 0x4c, 0x4c, 0x1d, 0x31, 0x52, 0x4d, 0x28, 0x12, 0x40, 0x3c, 0x2e,
-    0x18, 0x1e, 0x0e, 0x08, 0x09, 0x31, 0x18, 0x0a, 0x0f, 0x08, 0x2e, 0x47,
-    0x2e, 0x0c, 0x02, 0x07, 0x18, 0x37, 0x05, 0x21, 0x16, 0x18, 0x4c, 0x14,
-    0x08, 0x0f, 0x0c, 0x0f, 0x03, 0x08, 0x0e, 0x37, 0x35, 0x0a, 0x03, 0x02,
-    0x02, 0x02, 0x03, 0x0f, 0x1e, 0x08, 0x0a, 0x35, 0x17, 0x4b, 0x25, 0x00,
-    0x00, 0x0f, 0x17, 0x0f, 0x1b, 0x05, 0x05, 0x1c, 0x0c, 0x0a, 0x05, 0x02,
-    0x0f, 0x29, 0x0e, 0x08, 0x00, 0x08, 0x0f, 0x0a, 0x02, 0x0f, 0x0f, 0x0e,
-    0x0f, 0x05, 0x02, 0x07, 0x08, 0x1b, 0x0a, 0x08, 0x08, 0x07, 0x0f, 0x08,
-    0x2e, 0x14, 0x11, 0x38, 0x37, 0x1e, 0x08, 0x08, 0x11, 0x01, 0x00, 0x11,
-    0x28, 0x1e, 0x0e, 0x08, 0x2e, 0x61, 0x3f, 0x3f, 0x18, 0x4f, 0x61, 0x47,
-    0x1a, 0x1a, 0x12, 0x0a, 0x3c, 0x4f, 0x31, 0x11, 0x14, 0x12, 0x1d, 0x52,
-    0x8a, 0x8a, 0x44, 0x2e, 0x1a, 0x31, 0x28, 0x26, 0x12, 0x28, 0x14, 0x1d,
-    0x38, 0x67, 0x47, 0x1a, 0x2f, 0x4d, 0x2d, 0x1f, 0x58, 0x5d, 0x51, 0x47,
-    0x3a, 0x58, 0x2f, 0x3a, 0x85, 0x78, 0x58, 0x3a, 0x56, 0x6c, 0x4e, 0x86,
-    0x6c, 0x3e, 0x85, 0x96, 0x7f, 0x56, 0x41, 0x48, 0x4e, 0x56, 0x48, 0x7f,
-    0x7f, 0x4e, 0x4e, 0x70, 0xac, 0x91, 0x76, 0x70, 0x91, 0xb1, 0x9f, 0x70,
-    0x65, 0x73, 0x45, 0x5e, 0x91, 0x91, 0x7f, 0x54, 0x5d, 0x5e, 0x7f, 0xb1,
-    0xb1, 0x95, 0x65, 0x65, 0x65, 0x65, 0x65, 0x5d, 0x60, 0x60, 0x54, 0x5a,
-    0x7f, 0x91, 0x70, 0x5a, 0x84, 0x65, 0x54, 0x73, 0x99, 0x8e, 0x91, 0x84,
-    0x84, 0x64, 0x65, 0x8e, 0xaf, 0x84, 0x70, 0x65, 0x8e, 0x84, 0x8e, 0x99,
-    0x65, 0x84, 0xaf, 0x9f, 0x7f, 0x70, 0x57, 0x65, 0x7f, 0x4e, 0x85, 0x90,
-    0x5e, 0x5e, 0x60, 0x95, 0xa7, 0x95, 0x70, 0x70, 0xac, 0xaf, 0x91, 0x70,
-    0x65, 0x4e, 0x3e, 0x81, 0x90, 0x79, 0x60, 0x4e, 0x4e, 0x60, 0x96, 0xa7,
-    0x9f, 0x6c, 0x4e, 0x56, 0x50, 0x4e, 0x3a, 0x33, 0x48, 0x3e, 0x4d, 0x56,
-    0x6c, 0x5d, 0x2f, 0x45, 0x4e, 0x36, 0x27, 0x6a, 0x5b, 0x56, 0x58, 0x5b,
-    0x4d, 0x27, 0x34, 0x85, 0x56, 0x3a, 0x33, 0x3e, 0x32, 0x3f, 0x66, 0x3c,
-    0x26, 0x75, 0x67, 0x53, 0x36, 0x12, 0x1d, 0x1f, 0x20, 0x28, 0x4f, 0x26,
-    0x14, 0x1d, 0x2f, 0x6d, 0x47, 0x39, 0x1d, 0x47, 0x61, 0x52, 0x28, 0x12,
-    0x0e, 0x06, 0x3f, 0x4f, 0x37, 0x11, 0x08, 0x13, 0x0e, 0x1c, 0x7d, 0x6d,
-    0x18, 0x0a, 0x07, 0x17, 0x0c, 0x0f, 0x08, 0x02, 0x08, 0x0f, 0x0a, 0x0c,
-    0x0f, 0x03, 0x02, 0x07, 0x0a, 0x00, 0x03, 0x0f, 0x0f, 0x0f, 0x08, 0x00,
-    0x0a, 0x03, 0x0f, 0x1c, 0x08, 0x08, 0x08, 0x0a, 0x0a, 0x1e, 0x1c, 0x07,
-    0x1e, 0x37, 0x1e, 0x08, 0x03, 0x0f, 0x08, 0x00, 0x08, 0x1e, 0x18, 0x0f,
-    0x06, 0x08, 0x00, 0x0f, 0x14, 0x0f, 0x08, 0x11, 0x2e, 0x07, 0x08, 0x2e,
-    0x35, 0x1c, 0x0f, 0x08, 0x0f, 0x0a, 0x0a, 0x08, 0x03, 0x07, 0x0a, 0x1e,
-    0x07, 0x08, 0x28, 0x17, 0x00, 0x11, 0x2e, 0x14, 0x08, 0x0e, 0x2e, 0x31,
-    0x1e, 0x37, 0x2e, 0x18, 0x3f, 0x12, 0x13, 0x28, 0x47, 0x61, 0x7b, 0x52,
-    0x12, 0x12, 0x38, 0x61, 0x7d, 0x61, 0x44, 0x3c, 0x47, 0x3c, 0x11, 0x10,
-    0x26, 0x14, 0x10, 0x75, 0x58, 0x63, 0x7b, 0x47, 0x44, 0x31, 0x3a, 0x58,
-    0x3a, 0x2f, 0x36, 0x56, 0x34, 0x33, 0x5f, 0x6a, 0x5d, 0x3a, 0x6a, 0x86,
-    0x85, 0x6a, 0x56, 0x58, 0x5b, 0x5b, 0x3e, 0x3a, 0x3a, 0x58, 0x5d, 0x4e,
-    0x27, 0x7f, 0x7f, 0x4e, 0x4e, 0x7f, 0x7f, 0x5d, 0x45, 0x70, 0x7f, 0x4e,
-    0x70, 0x70, 0x48, 0x79, 0x81, 0x57, 0x73, 0x91, 0x99, 0xac, 0xa7, 0x7f,
-    0x54, 0x70, 0x9f, 0xac, 0xb1, 0x90, 0x91, 0x90, 0x90, 0x54, 0x54, 0x70,
-    0x70, 0x5e, 0x91, 0x99, 0x99, 0xa7, 0x91, 0x65, 0x77, 0x7f, 0x8e, 0x84,
-    0x69, 0x64, 0x8e, 0x69, 0x60, 0x81, 0x99, 0x9f, 0x65, 0x84, 0xac, 0xaf,
-    0x99, 0x84, 0x7f, 0x65, 0x7f, 0x65, 0x69, 0x57, 0x5a, 0x65, 0x73, 0x4a,
-    0x70, 0xac, 0x65, 0x57, 0x91, 0x91, 0x73, 0x54, 0x70, 0x73, 0x70, 0x7f,
-    0x7f, 0x5e, 0x60, 0x9f, 0x65, 0x65, 0x79, 0x9d, 0xb1, 0x9f, 0x91, 0x54,
-    0x57, 0x91, 0xac, 0x9f, 0x91, 0x70, 0x7f, 0x7f, 0x5e, 0x3a, 0x34, 0x5d,
-    0x32, 0x5b, 0xa7, 0x6a, 0x96, 0x97, 0x5d, 0x56, 0x3e, 0x6c, 0x5d, 0x48,
-    0x34, 0x4e, 0x5d, 0x3c, 0x32, 0x6c, 0x75, 0x51, 0x3a, 0x75, 0x85, 0x86,
-    0x63, 0x3a, 0x3c, 0x3a, 0x33, 0x36, 0x12, 0x1d, 0x31, 0x47, 0x31, 0x10,
-    0x5f, 0x5f, 0x1e, 0x36, 0x58, 0x47, 0x1d, 0x1d, 0x3c, 0x3c, 0x2e, 0x47,
-    0x28, 0x11, 0x44, 0x18, 0x20, 0x31, 0x44, 0x5f, 0x7b, 0x47, 0x17, 0x12,
-    0x28, 0x44, 0x61, 0x61, 0x26, 0x2e, 0x4b, 0x38, 0x0f, 0x06, 0x11, 0x07,
-    0x08, 0x40, 0x40, 0x2e, 0x4b, 0x0c, 0x0f, 0x1c, 0x14, 0x0e, 0x04, 0x00,
-    0x02, 0x1e, 0x0c, 0x08, 0x0a, 0x1c, 0x1e, 0x02, 0x18, 0x35, 0x2e, 0x17,
-    0x08, 0x08, 0x0a, 0x08, 0x08, 0x00, 0x00, 0x08, 0x06, 0x0a, 0x00, 0x11,
-    0x1e, 0x07, 0x03, 0x0f, 0x1e, 0x08, 0x03, 0x18, 0x06, 0x08, 0x0a, 0x44,
-    0x61, 0x4b, 0x18, 0x00, 0x0a, 0x0a, 0x07, 0x08, 0x0f, 0x08, 0x00, 0x0f,
-    0x4b, 0x2e, 0x0a, 0x0c, 0x1b, 0x4b, 0x37, 0x0f, 0x02, 0x07, 0x17, 0x13,
-    0x1e, 0x13, 0x0e, 0x00, 0x14, 0x40, 0x1e, 0x0e, 0x1e, 0x18, 0x4f, 0x2b,
-    0x06, 0x1d, 0x12, 0x0e, 0x0e, 0x06, 0x18, 0x47, 0x47, 0x28, 0x1d, 0x09,
-    0x1e, 0x4f, 0x5c, 0x2d, 0x12, 0x1d, 0x3c, 0x28, 0x52, 0x5f, 0x26, 0x3c,
-    0x75, 0x58, 0x28, 0x3c, 0x5f, 0x5f, 0x3a, 0x3a, 0x58, 0x4d, 0x78, 0x9a,
-    0x8a, 0x72, 0x36, 0x34, 0x6a, 0x51, 0x1f, 0x36, 0x48, 0x48, 0x51, 0x86,
-    0x86, 0x4e, 0x4a, 0x5b, 0x7f, 0xa7, 0x60, 0x32, 0x34, 0x6c, 0x5d, 0x5d,
-    0x70, 0x4e, 0x34, 0x3e, 0x91, 0x7f, 0x48, 0x4e, 0x70, 0x7f, 0x7f, 0x4e,
-    0x70, 0x65, 0x57, 0x57, 0x60, 0x57, 0x73, 0x84, 0x91, 0x70, 0x54, 0x4e,
-    0x7f, 0x9f, 0x84, 0x70, 0x60, 0x70, 0x5a, 0x65, 0x9f, 0x84, 0x64, 0x99,
-    0x9d, 0x70, 0x70, 0x91, 0x91, 0x84, 0x65, 0x91, 0x81, 0x74, 0xaa, 0xaf,
-    0x9d, 0x65, 0x70, 0x84, 0x8e, 0x5e, 0x4a, 0x5a, 0x73, 0x70, 0x9f, 0xab,
-    0x84, 0x81, 0x81, 0x9f, 0xaf, 0x99, 0x4e, 0x4a, 0x5a, 0x7f, 0x5a, 0x91,
-    0x73, 0x5e, 0x4e, 0x7f, 0xa7, 0x60, 0x60, 0x7f, 0x7f, 0x90, 0x70, 0x5e,
-    0x64, 0x65, 0x79, 0x57, 0x4e, 0x65, 0x96, 0x65, 0x65, 0x4e, 0x48, 0x4e,
-    0x96, 0x96, 0x5e, 0x56, 0x56, 0x5d, 0x56, 0x7f, 0x7f, 0x4e, 0x86, 0x9a,
-    0x5d, 0x3e, 0x6c, 0x85, 0x78, 0x4e, 0x5b, 0x5e, 0x60, 0x79, 0xa7, 0x9a,
-    0x56, 0x27, 0x3e, 0x6c, 0x3a, 0x1d, 0x3c, 0x3e, 0x34, 0x47, 0x89, 0x5d,
-    0x3a, 0x58, 0x47, 0x78, 0x8a, 0x1d, 0x06, 0x26, 0x31, 0x26, 0x52, 0x3c,
-    0x28, 0x1d, 0x38, 0x5c, 0x38, 0x12, 0x1a, 0x31, 0x5f, 0x4c, 0x0d, 0x1d,
-    0x12, 0x0d, 0x06, 0x04, 0x0d, 0x4f, 0x3f, 0x1e, 0x0a, 0x0e, 0x0e, 0x40,
-    0x67, 0x1e, 0x08, 0x0a, 0x17, 0x06, 0x17, 0x4f, 0x1e, 0x0a, 0x67, 0x4b,
-    0x0a, 0x0f, 0x35, 0x40, 0x13, 0x04, 0x0e, 0x08, 0x25, 0x5c, 0x4b, 0x35,
-    0x00, 0x00, 0x11, 0x0a, 0x08, 0x0f, 0x0f, 0x07, 0x02, 0x2b, 0x35, 0x17,
-    0x08, 0x0a, 0x37, 0x44, 0x19, 0x00, 0x00, 0x0a, 0x17, 0x1e, 0x0f, 0x0e,
-    0x07, 0x0f, 0x2e, 0x17, 0x17, 0x37, 0x17, 0x0a, 0x0e, 0x11, 0x1e, 0x08,
-    0x00, 0x08, 0x18, 0x17, 0x02, 0x02, 0x02, 0x07, 0x0e, 0x11, 0x1e, 0x0f,
-    0x1b, 0x21, 0x07, 0x05, 0x35, 0x0a, 0x00, 0x08, 0x06, 0x00, 0x17, 0x4c,
-    0x4f, 0x28, 0x18, 0x18, 0x1d, 0x08, 0x14, 0x28, 0x1e, 0x14, 0x04, 0x01,
-    0x06, 0x04, 0x0e, 0x06, 0x06, 0x12, 0x14, 0x14, 0x25, 0x28, 0x1d, 0x3c,
-    0x52, 0x47, 0x47, 0x43, 0x52, 0x58, 0x58, 0x3a, 0x12, 0x1d, 0x53, 0x66,
-    0x52, 0x53, 0x4d, 0x3a, 0x63, 0x63, 0x47, 0x1d, 0x47, 0x66, 0x27, 0x1d,
-    0x1a, 0x78, 0x56, 0x27, 0x2f, 0x1a, 0x26, 0x3e, 0x48, 0x4e, 0x6c, 0x4e,
-    0x4e, 0x48, 0x32, 0x4e, 0x85, 0x48, 0x48, 0x56, 0x41, 0x4e, 0x85, 0x91,
-    0x7f, 0x4e, 0x7f, 0x70, 0x5e, 0x56, 0x70, 0x70, 0x57, 0x50, 0x4e, 0x4e,
-    0x57, 0x57, 0x54, 0x48, 0x60, 0x54, 0x7f, 0x60, 0x77, 0x5e, 0x5a, 0x8e,
-    0x91, 0x84, 0x95, 0x91, 0x91, 0x99, 0x91, 0x70, 0x60, 0x65, 0x90, 0x91,
-    0x90, 0x9f, 0x73, 0x9f, 0x99, 0x8b, 0x65, 0x65, 0x81, 0x73, 0x4e, 0x50,
-    0x84, 0x9f, 0x5e, 0x60, 0x54, 0x4e, 0x65, 0x65, 0x81, 0x90, 0x81, 0x91,
-    0x79, 0x4e, 0x4e, 0x99, 0x73, 0x4e, 0x5e, 0x4e, 0x65, 0x91, 0xb1, 0x90,
-    0x5a, 0x65, 0x90, 0x5e, 0x4e, 0x70, 0x65, 0x65, 0x60, 0x50, 0x60, 0x57,
-    0x54, 0x4e, 0x3e, 0x4e, 0x54, 0x54, 0x6c, 0x6a, 0x5d, 0x56, 0x85, 0x91,
-    0x70, 0x70, 0x85, 0x70, 0x90, 0x96, 0x5d, 0x48, 0x58, 0x78, 0x8a, 0x63,
-    0x89, 0x5b, 0x5d, 0x70, 0x70, 0x48, 0x26, 0x51, 0x66, 0x2f, 0x12, 0x4d,
-    0x78, 0x3a, 0x36, 0x1a, 0x14, 0x1d, 0x2f, 0x3a, 0x58, 0x47, 0x1f, 0x53,
-    0x31, 0x09, 0x47, 0x58, 0x12, 0x1d, 0x14, 0x0d, 0x36, 0x5f, 0x67, 0x3c,
-    0x3c, 0x47, 0x38, 0x12, 0x20, 0x39, 0x39, 0x20, 0x04, 0x0b, 0x0b, 0x04,
-    0x09, 0x06, 0x04, 0x11, 0x11, 0x14, 0x11, 0x1e, 0x11, 0x17, 0x3d, 0x1e,
-    0x17, 0x25, 0x1e, 0x28, 0x47, 0x25, 0x0f, 0x08, 0x1c, 0x35, 0x17, 0x35,
-    0x1e, 0x08, 0x25, 0x25, 0x0a, 0x0f, 0x0a, 0x1e, 0x0a, 0x00, 0x01, 0x0e,
-    0x25, 0x08, 0x02, 0x00, 0x08, 0x07, 0x0a, 0x0a, 0x0f, 0x08, 0x1c, 0x0a,
-    0x03, 0x17, 0x1e, 0x00, 0x07, 0x0f, 0x08, 0x07, 0x35, 0x4b, 0x1e, 0x0a,
-    0x08, 0x08, 0x0a, 0x02, 0x00, 0x03, 0x0f, 0x40, 0x2e, 0x01, 0x0a, 0x4f,
-    0x11, 0x08, 0x21, 0x0f, 0x0a, 0x11, 0x07, 0x0f, 0x0f, 0x08, 0x2e, 0x61,
-    0x7d, 0x25, 0x1e, 0x2e, 0x25, 0x28, 0x26, 0x38, 0x38, 0x38, 0x4f, 0x40,
-    0x0e, 0x06, 0x08, 0x0e, 0x14, 0x12, 0x1e, 0x1a, 0x12, 0x06, 0x14, 0x31,
-    0x12, 0x3c, 0x52, 0x1d, 0x14, 0x1d, 0x3a, 0x61, 0x47, 0x26, 0x26, 0x1a,
-    0x1d, 0x28, 0x1f, 0x1f, 0x06, 0x1d, 0x4d, 0x33, 0x47, 0x3c, 0x1a, 0x28,
-    0x3a, 0x26, 0x1d, 0x1f, 0x1d, 0x1f, 0x85, 0x85, 0x2f, 0x2f, 0x85, 0x6a,
-    0x27, 0x78, 0x75, 0x3e, 0x48, 0x34, 0x2f, 0x58, 0x3a, 0x4d, 0x86, 0xa7,
-    0x96, 0x60, 0x85, 0x70, 0x70, 0x91, 0x85, 0x7f, 0x96, 0x90, 0x96, 0x7f,
-    0x5e, 0x48, 0x4e, 0x70, 0x70, 0x7f, 0x91, 0x79, 0x70, 0x57, 0x9d, 0x65,
-    0x79, 0x9f, 0x90, 0x5a, 0x5e, 0x5a, 0x91, 0x90, 0x73, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x5a, 0x54, 0x4e, 0x81, 0x73, 0x70, 0x77, 0x70, 0x70, 0x73,
-    0x65, 0x54, 0x70, 0x70, 0x5e, 0x99, 0xaf, 0x84, 0x60, 0x91, 0xaf, 0x70,
-    0x73, 0x9f, 0x90, 0x7f, 0x65, 0x4e, 0x77, 0x70, 0x54, 0x84, 0xb1, 0xa7,
-    0x84, 0x91, 0x90, 0x73, 0x9f, 0x9f, 0x7f, 0x90, 0x91, 0x9f, 0x84, 0x77,
-    0x5d, 0x41, 0x65, 0x65, 0x91, 0x65, 0x81, 0x64, 0x70, 0x79, 0x70, 0x54,
-    0x91, 0x91, 0x60, 0x4e, 0x5e, 0x86, 0x7f, 0x78, 0x5e, 0x70, 0x60, 0x4e,
-    0x4e, 0x4e, 0x48, 0x33, 0x4e, 0x78, 0x5d, 0x58, 0x43, 0x34, 0x3e, 0x56,
-    0x4d, 0x32, 0x2f, 0x2f, 0x4d, 0x96, 0x85, 0x33, 0x3a, 0x86, 0x58, 0x31,
-    0x63, 0x58, 0x3a, 0x3a, 0x28, 0x1d, 0x2f, 0x1a, 0x44, 0x7b, 0x97, 0x5f,
-    0x47, 0x58, 0x47, 0x43, 0x5f, 0x3c, 0x52, 0x58, 0x67, 0x52, 0x31, 0x12,
-    0x13, 0x13, 0x12, 0x1d, 0x28, 0x31, 0x1a, 0x14, 0x0a, 0x31, 0x1e, 0x2e,
-    0x4f, 0x18, 0x06, 0x17, 0x1e, 0x38, 0x4f, 0x1e, 0x0a, 0x11, 0x0e, 0x06,
-    0x13, 0x11, 0x00, 0x0a, 0x37, 0x25, 0x0a, 0x1c, 0x14, 0x00, 0x08, 0x0a,
-    0x06, 0x02, 0x02, 0x02, 0x2e, 0x40, 0x04, 0x00, 0x37, 0x38, 0x03, 0x1c,
-    0x1e, 0x03, 0x0a, 0x08, 0x0f, 0x0f, 0x03, 0x05, 0x40, 0x61, 0x4b, 0x0f,
-    0x2b, 0x35, 0x1e, 0x1e, 0x1e, 0x1c, 0x1e, 0x2b, 0x02, 0x08, 0x37, 0x25,
-    0x17, 0x35, 0x18, 0x1e, 0x11, 0x04, 0x2b, 0x1e, 0x08, 0x0c, 0x0c, 0x08,
-    0x03, 0x00, 0x08, 0x1e, 0x08, 0x00, 0x18, 0x1e, 0x08, 0x03, 0x1e, 0x37,
-    0x1e, 0x12, 0x0e, 0x06, 0x03, 0x04, 0x08, 0x0e, 0x17, 0x2b, 0x52, 0x0d,
-    0x25, 0x5c, 0x4f, 0x2e, 0x1e, 0x0d, 0x06, 0x14, 0x25, 0x1d, 0x28, 0x28,
-    0x12, 0x31, 0x3c, 0x11, 0x11, 0x1a, 0x52, 0x28, 0x10, 0x28, 0x26, 0x47,
-    0x3a, 0x4f, 0x52, 0x47, 0x26, 0x31, 0x52, 0x26, 0x1f, 0x6d, 0x7b, 0x52,
-    0x7b, 0x5f, 0x66, 0x58, 0x56, 0x75, 0x78, 0x56, 0x4d, 0x5d, 0x4d, 0x27,
-    0x27, 0x56, 0x48, 0x2f, 0x32, 0x4e, 0x70, 0x58, 0x27, 0x45, 0x85, 0x70,
-    0x5d, 0x3e, 0x34, 0x32, 0x32, 0x4e, 0x60, 0x4e, 0x4e, 0x96, 0x91, 0x70,
-    0x90, 0xa0, 0x91, 0x4e, 0x60, 0x57, 0x60, 0x73, 0x70, 0x70, 0x5a, 0x5a,
-    0x5e, 0x90, 0x5a, 0x4a, 0x5a, 0x91, 0x84, 0x4e, 0x5e, 0x70, 0x7f, 0x73,
-    0x84, 0x90, 0x84, 0x65, 0x5e, 0x7f, 0x81, 0x54, 0x91, 0xab, 0x91, 0x9f,
-    0x9f, 0x91, 0x84, 0x73, 0x91, 0x91, 0x99, 0x70, 0x84, 0x81, 0x60, 0x4e,
-    0x54, 0x73, 0x6a, 0x4a, 0x65, 0x91, 0x70, 0x45, 0x4e, 0x84, 0x90, 0x91,
-    0x5a, 0x4e, 0x45, 0x3e, 0x4e, 0x5a, 0x70, 0x4e, 0x81, 0x9f, 0x70, 0x91,
-    0x91, 0x99, 0x7f, 0x57, 0x79, 0x54, 0x70, 0x60, 0x5b, 0x5b, 0x5e, 0x4e,
-    0x7f, 0x78, 0x3e, 0x48, 0x78, 0x7f, 0x4e, 0x48, 0x56, 0x60, 0x5d, 0x5b,
-    0x78, 0x89, 0x5b, 0x56, 0x5d, 0x5d, 0x33, 0x4d, 0x85, 0x6c, 0x63, 0x85,
-    0x5d, 0x63, 0x58, 0x48, 0x63, 0x63, 0x3a, 0x32, 0x58, 0x2f, 0x12, 0x12,
-    0x3a, 0x38, 0x12, 0x1d, 0x3c, 0x47, 0x14, 0x06, 0x38, 0x67, 0x47, 0x26,
-    0x12, 0x10, 0x06, 0x0e, 0x11, 0x12, 0x18, 0x1a, 0x5f, 0x39, 0x31, 0x61,
-    0x4f, 0x38, 0x12, 0x11, 0x0d, 0x14, 0x26, 0x17, 0x25, 0x11, 0x0d, 0x17,
-    0x1e, 0x08, 0x00, 0x0a, 0x2b, 0x17, 0x08, 0x0a, 0x17, 0x1e, 0x17, 0x25,
-    0x37, 0x0a, 0x06, 0x0e, 0x17, 0x08, 0x08, 0x18, 0x38, 0x0f, 0x16, 0x1c,
-    0x1e, 0x1e, 0x06, 0x11, 0x2e, 0x0a, 0x0a, 0x0f, 0x08, 0x03, 0x00, 0x00,
-    0x0f, 0x0f, 0x00, 0x0f, 0x1c, 0x0a, 0x07, 0x0a, 0x2e, 0x1e, 0x0e, 0x0e,
-    0x00, 0x02, 0x03, 0x00, 0x1c, 0x0f, 0x08, 0x08, 0x05, 0x0c, 0x05, 0x03,
-    0x11, 0x31, 0x37, 0x00, 0x18, 0x35, 0x0f, 0x1c, 0x1e, 0x13, 0x25, 0x46,
-    0x13, 0x0b, 0x0e, 0x08, 0x08, 0x0e, 0x18, 0x0a, 0x0f, 0x0e, 0x06, 0x06,
-    0x0e, 0x0e, 0x08, 0x12, 0x4f, 0x28, 0x12, 0x38, 0x1e, 0x0a, 0x0a, 0x0a,
-    0x28, 0x40, 0x0d, 0x09, 0x47, 0x1e, 0x00, 0x28, 0x36, 0x26, 0x3c, 0x2f,
-    0x26, 0x0a, 0x1d, 0x67, 0x4f, 0x1d, 0x3c, 0x66, 0x72, 0x1f, 0x09, 0x18,
-    0x66, 0x3a, 0x1f, 0x58, 0x67, 0x2d, 0x12, 0x3c, 0x26, 0x10, 0x1f, 0x3e,
-    0x85, 0x70, 0x3a, 0x58, 0x85, 0x51, 0x51, 0x56, 0x56, 0x5e, 0xa0, 0x78,
-    0x58, 0x5d, 0x70, 0x6c, 0x4e, 0x6c, 0x58, 0x51, 0x60, 0x56, 0x4e, 0x48,
-    0x43, 0x41, 0x5d, 0xa0, 0x91, 0x65, 0x79, 0x70, 0x50, 0x5d, 0x41, 0x5d,
-    0x96, 0x65, 0x57, 0x81, 0x79, 0x4e, 0x4a, 0x91, 0x5e, 0x77, 0x81, 0x69,
-    0x70, 0x54, 0x91, 0x9f, 0x5e, 0x5e, 0x91, 0x9d, 0x65, 0x4a, 0x45, 0x91,
-    0x91, 0x54, 0x84, 0x9f, 0x7f, 0x41, 0x5e, 0x70, 0x56, 0x41, 0x70, 0x8e,
-    0xac, 0x74, 0x65, 0x99, 0x84, 0x65, 0x81, 0x65, 0x90, 0xb1, 0xa7, 0x70,
-    0x73, 0x81, 0x84, 0x65, 0x73, 0x5e, 0x56, 0x7f, 0x70, 0x5e, 0x4e, 0x50,
-    0x4e, 0x4a, 0x90, 0x9f, 0x65, 0x65, 0x79, 0x79, 0x5d, 0x50, 0x5b, 0x90,
-    0x91, 0x4e, 0x54, 0x91, 0x4e, 0x3e, 0x77, 0x70, 0x60, 0x6c, 0x6c, 0x4e,
-    0x41, 0x5e, 0x96, 0x75, 0x56, 0x60, 0x96, 0x86, 0x48, 0x2d, 0x51, 0x93,
-    0x58, 0x58, 0x89, 0x5d, 0x26, 0x27, 0x3e, 0x33, 0x1f, 0x33, 0x4e, 0x79,
-    0x6c, 0x1f, 0x3e, 0x66, 0x33, 0x4d, 0x3a, 0x52, 0x63, 0x7b, 0x36, 0x1f,
-    0x36, 0x3c, 0x3a, 0x3a, 0x3c, 0x1f, 0x28, 0x36, 0x1f, 0x28, 0x06, 0x11,
-    0x12, 0x31, 0x7d, 0x3a, 0x28, 0x40, 0x28, 0x11, 0x0d, 0x0e, 0x28, 0x40,
-    0x14, 0x06, 0x26, 0x2e, 0x02, 0x0e, 0x31, 0x17, 0x13, 0x25, 0x17, 0x03,
-    0x0e, 0x28, 0x2e, 0x2e, 0x0a, 0x37, 0x4f, 0x09, 0x00, 0x00, 0x2b, 0x1c,
-    0x0f, 0x17, 0x1e, 0x08, 0x0f, 0x03, 0x05, 0x0f, 0x03, 0x08, 0x1e, 0x44,
-    0x14, 0x08, 0x38, 0x0f, 0x0a, 0x25, 0x11, 0x1e, 0x37, 0x25, 0x06, 0x00,
-    0x08, 0x07, 0x0e, 0x0e, 0x11, 0x08, 0x07, 0x08, 0x08, 0x06, 0x02, 0x00,
-    0x0e, 0x11, 0x18, 0x0a, 0x02, 0x1c, 0x1c, 0x0a, 0x0a, 0x14, 0x08, 0x11,
-    0x12, 0x08, 0x0a, 0x17, 0x0a, 0x2e, 0x1e, 0x11, 0x1e, 0x19, 0x0a, 0x06,
-    0x0a, 0x13, 0x35, 0x2e, 0x14, 0x14, 0x1d, 0x12, 0x4f, 0x4f, 0x31, 0x06,
-    0x03, 0x06, 0x11, 0x2e, 0x38, 0x28, 0x11, 0x17, 0x28, 0x2e, 0x31, 0x12,
-    0x1d, 0x25, 0x09, 0x26, 0x44, 0x06, 0x0d, 0x52, 0x53, 0x4f, 0x26, 0x12,
-    0x28, 0x3a, 0x36, 0x12, 0x36, 0x52, 0x47, 0x47, 0x26, 0x28, 0x36, 0x47,
-    0x47, 0x4d, 0x3c, 0x1d, 0x33, 0x67, 0x3a, 0x2f, 0x6c, 0x5d, 0x6a, 0x78,
-    0x3e, 0x33, 0x3a, 0x48, 0x5d, 0x6c, 0x56, 0x75, 0x86, 0x4e, 0x48, 0x48,
-    0x60, 0x86, 0x7f, 0x70, 0x60, 0x4e, 0x5e, 0x86, 0x91, 0x96, 0x70, 0x3e,
-    0x48, 0x60, 0x79, 0x93, 0x96, 0x4e, 0x58, 0x79, 0x7f, 0x60, 0x65, 0x60,
-    0x70, 0x5e, 0x65, 0x91, 0x4e, 0x51, 0x84, 0x90, 0x91, 0x79, 0x70, 0x70,
-    0x7f, 0x65, 0x70, 0x54, 0x7f, 0x84, 0x70, 0x70, 0x5a, 0x54, 0x5a, 0x65,
-    0x5e, 0x77, 0x4e, 0x4e, 0x90, 0x84, 0x70, 0x91, 0x90, 0x91, 0x91, 0x84,
-    0x57, 0x5a, 0x54, 0x73, 0x91, 0x91, 0x73, 0x73, 0x84, 0x54, 0x54, 0x65,
-    0x99, 0x95, 0x99, 0x91, 0x7f, 0x65, 0x91, 0xac, 0x9f, 0x91, 0x4e, 0x48,
-    0x4e, 0x5a, 0x91, 0x90, 0x65, 0x4e, 0x5b, 0x7f, 0x5b, 0x70, 0x54, 0x70,
-    0x60, 0x4e, 0x7f, 0x60, 0x3e, 0x5d, 0x86, 0x85, 0x78, 0x5d, 0x58, 0x6c,
-    0x77, 0x56, 0x3a, 0x5b, 0x70, 0x6c, 0x58, 0x5d, 0x4d, 0x3a, 0x56, 0x3e,
-    0x58, 0x3a, 0x1f, 0x66, 0x85, 0x48, 0x5d, 0x78, 0x58, 0x58, 0x66, 0x3c,
-    0x1a, 0x26, 0x3a, 0x5f, 0x52, 0x3c, 0x58, 0x58, 0x1f, 0x12, 0x20, 0x47,
-    0x58, 0x5f, 0x3a, 0x33, 0x1f, 0x3a, 0x67, 0x6d, 0x5f, 0x2e, 0x04, 0x12,
-    0x18, 0x2e, 0x52, 0x40, 0x1e, 0x12, 0x26, 0x28, 0x25, 0x12, 0x12, 0x18,
-    0x06, 0x0a, 0x40, 0x08, 0x08, 0x31, 0x4f, 0x39, 0x25, 0x0a, 0x0f, 0x1e,
-    0x13, 0x06, 0x08, 0x08, 0x08, 0x0e, 0x0f, 0x13, 0x0e, 0x0e, 0x11, 0x1c,
-    0x0c, 0x08, 0x05, 0x1c, 0x0a, 0x0a, 0x14, 0x11, 0x08, 0x25, 0x11, 0x08,
-    0x19, 0x08, 0x0a, 0x1c, 0x17, 0x1e, 0x1e, 0x0e, 0x00, 0x08, 0x06, 0x1e,
-    0x1e, 0x13, 0x14, 0x11, 0x1e, 0x2b, 0x4c, 0x35, 0x14, 0x19, 0x62, 0x35,
-    0x0e, 0x1e, 0x17, 0x04, 0x11, 0x08, 0x17, 0x0f, 0x07, 0x00, 0x25, 0x25,
-    0x08, 0x0a, 0x0f, 0x13, 0x0e, 0x0a, 0x1e, 0x17, 0x25, 0x0f, 0x0a, 0x17,
-    0x0b, 0x11, 0x28, 0x20, 0x3d, 0x2e, 0x1e, 0x17, 0x17, 0x11, 0x0e, 0x08,
-    0x11, 0x28, 0x40, 0x3d, 0x13, 0x31, 0x4f, 0x14, 0x09, 0x1d, 0x47, 0x28,
-    0x31, 0x12, 0x14, 0x09, 0x28, 0x47, 0x1e, 0x1e, 0x26, 0x36, 0x26, 0x12,
-    0x04, 0x28, 0x58, 0x47, 0x0d, 0x31, 0x89, 0x52, 0x3c, 0x8a, 0x9a, 0x3c,
-    0x4d, 0x6d, 0x4d, 0x58, 0x48, 0x26, 0x1d, 0x1f, 0x58, 0x86, 0x86, 0x5d,
-    0x48, 0x2f, 0x34, 0x70, 0x4e, 0x4e, 0x6c, 0x70, 0x70, 0x4e, 0x4e, 0x60,
-    0x54, 0x70, 0x70, 0x70, 0x70, 0x50, 0x70, 0x70, 0x78, 0x6c, 0x86, 0x5d,
-    0x70, 0x90, 0x96, 0x70, 0x65, 0x96, 0x86, 0x56, 0x4e, 0x7f, 0x96, 0x6a,
-    0x60, 0x54, 0x45, 0x6c, 0x85, 0x5d, 0x6c, 0x70, 0x70, 0x70, 0x70, 0x50,
-    0x5b, 0x7f, 0x84, 0x5e, 0x41, 0x9f, 0xa7, 0x70, 0x99, 0xaf, 0x91, 0x65,
-    0x99, 0x84, 0x7f, 0x91, 0x54, 0x5d, 0x4e, 0x5e, 0x91, 0xab, 0x84, 0x7f,
-    0x5e, 0x4e, 0x65, 0x81, 0x65, 0x84, 0x91, 0x8e, 0x65, 0x57, 0x70, 0x65,
-    0x76, 0x99, 0x81, 0x79, 0x70, 0x70, 0x78, 0x5e, 0x89, 0x70, 0x4e, 0x5e,
-    0x7f, 0x9f, 0x91, 0x60, 0x65, 0x91, 0x4e, 0x4e, 0x70, 0x7f, 0x6c, 0x5d,
-    0x4e, 0x4d, 0x48, 0x75, 0x5d, 0x58, 0x5b, 0x66, 0x56, 0x5b, 0x4d, 0x3c,
-    0x48, 0x6a, 0x56, 0x26, 0x5d, 0x8a, 0x66, 0x5d, 0x9a, 0x85, 0x4d, 0x5e,
-    0x6c, 0x34, 0x66, 0x47, 0x1d, 0x1d, 0x26, 0x4d, 0x78, 0x8a, 0x3a, 0x31,
-    0x20, 0x3c, 0x4d, 0x2f, 0x3a, 0x2f, 0x3a, 0x3c, 0x28, 0x28, 0x1f, 0x1a,
-    0x53, 0x47, 0x36, 0x26, 0x25, 0x31, 0x31, 0x2e, 0x28, 0x18, 0x17, 0x36,
-    0x4c, 0x47, 0x18, 0x28, 0x4f, 0x17, 0x06, 0x13, 0x2d, 0x1d, 0x1e, 0x0e,
-    0x0a, 0x08, 0x17, 0x25, 0x0a, 0x18, 0x1c, 0x0f, 0x18, 0x0f, 0x00, 0x08,
-    0x14, 0x17, 0x08, 0x00, 0x14, 0x1e, 0x0e, 0x35, 0x4f, 0x17, 0x11, 0x20,
-    0x06, 0x13, 0x06, 0x0e, 0x0c, 0x06, 0x00, 0x11, 0x25, 0x11, 0x0c, 0x0f,
-    0x0a, 0x1e, 0x08, 0x13, 0x0e, 0x1b, 0x14, 0x0a, 0x08, 0x00, 0x04, 0x11,
-    0x13, 0x1e, 0x35, 0x18, 0x05, 0x08, 0x08, 0x1e, 0x25, 0x13, 0x00, 0x08,
-    0x0a, 0x08, 0x03, 0x17, 0x40, 0x17, 0x0e, 0x00, 0x06, 0x1e, 0x35, 0x1e,
-    0x08, 0x02, 0x0e, 0x1e, 0x25, 0x0a, 0x08, 0x0e, 0x17, 0x1e, 0x11, 0x2e,
-    0x0e, 0x0a, 0x0a, 0x12, 0x2e, 0x11, 0x0a, 0x03, 0x00, 0x0e, 0x1e, 0x14,
-    0x1d, 0x1e, 0x06, 0x00, 0x12, 0x44, 0x44, 0x28, 0x31, 0x14, 0x09, 0x12,
-    0x1f, 0x1d, 0x38, 0x3c, 0x4d, 0x3a, 0x1a, 0x28, 0x20, 0x12, 0x14, 0x20,
-    0x31, 0x1a, 0x33, 0x28, 0x28, 0x3a, 0x4d, 0x58, 0x52, 0x33, 0x3a, 0x4d,
-    0x27, 0x1d, 0x4c, 0x7b, 0x5d, 0x4e, 0x3e, 0x2f, 0x5d, 0x89, 0x5d, 0x58,
-    0x32, 0x48, 0x5d, 0x78, 0x6c, 0x3a, 0x5e, 0x5b, 0x60, 0x60, 0x96, 0x5d,
-    0x48, 0x4e, 0x5e, 0x70, 0x6c, 0x50, 0x2f, 0x2f, 0x45, 0x5e, 0x4e, 0x73,
-    0x65, 0x56, 0x34, 0x5d, 0x7f, 0x5e, 0x70, 0x86, 0x60, 0x4e, 0x4e, 0x60,
-    0x4e, 0x78, 0x7f, 0x90, 0x91, 0x70, 0x5e, 0x5e, 0x60, 0x4e, 0x5b, 0x4e,
-    0x60, 0x77, 0x54, 0x4a, 0x65, 0x7f, 0x91, 0x91, 0x5e, 0x54, 0x70, 0x54,
-    0x41, 0x5e, 0x9f, 0x91, 0x73, 0x84, 0x70, 0x65, 0x9f, 0x93, 0x77, 0x4e,
-    0x5a, 0x73, 0x84, 0x73, 0x4e, 0x5a, 0x70, 0x65, 0x65, 0x9f, 0x81, 0x54,
-    0x4e, 0x4e, 0x78, 0x7f, 0x6c, 0x3e, 0x34, 0x34, 0x56, 0x4e, 0x70, 0x65,
-    0x5e, 0x3e, 0x3e, 0x85, 0x70, 0x6c, 0x85, 0x4e, 0x3e, 0x4d, 0x48, 0x3e,
-    0x56, 0x78, 0x85, 0x85, 0x4e, 0x34, 0x3e, 0x3a, 0x3a, 0x27, 0x32, 0x43,
-    0x48, 0x51, 0x2f, 0x3a, 0x3e, 0x5b, 0x6a, 0x58, 0x2f, 0x3a, 0x58, 0x1f,
-    0x12, 0x58, 0x75, 0x48, 0x4e, 0x33, 0x26, 0x5f, 0x5c, 0x43, 0x26, 0x1d,
-    0x3c, 0x47, 0x47, 0x1d, 0x12, 0x28, 0x28, 0x1f, 0x3c, 0x6d, 0x1f, 0x12,
-    0x14, 0x28, 0x25, 0x14, 0x1e, 0x0a, 0x00, 0x11, 0x12, 0x1d, 0x28, 0x12,
-    0x0e, 0x00, 0x0e, 0x31, 0x37, 0x2b, 0x25, 0x14, 0x0e, 0x08, 0x1e, 0x11,
-    0x25, 0x2e, 0x29, 0x1e, 0x0a, 0x0e, 0x08, 0x08, 0x06, 0x08, 0x1e, 0x0e,
-    0x0a, 0x0e, 0x08, 0x00, 0x0e, 0x18, 0x1e, 0x08, 0x00, 0x11, 0x0a, 0x02,
-    0x0f, 0x2e, 0x2e, 0x0a, 0x04, 0x00, 0x0a, 0x1b, 0x1b, 0x11, 0x00, 0x08,
-    0x0a, 0x1e, 0x11, 0x03, 0x08, 0x0a, 0x0e, 0x13, 0x17, 0x17, 0x00, 0x00,
-    0x0f, 0x06, 0x00, 0x00, 0x18, 0x07, 0x0a, 0x17, 0x0a, 0x07, 0x0f, 0x05,
-    0x0a, 0x06, 0x00, 0x00, 0x0e, 0x08, 0x0f, 0x17, 0x03, 0x00, 0x00, 0x1e,
-    0x13, 0x08, 0x00, 0x08, 0x18, 0x08, 0x08, 0x12, 0x0a, 0x0e, 0x0a, 0x06,
-    0x00, 0x0f, 0x1e, 0x0a, 0x13, 0x09, 0x1e, 0x14, 0x10, 0x31, 0x12, 0x1e,
-    0x31, 0x1d, 0x11, 0x09, 0x14, 0x39, 0x40, 0x12, 0x11, 0x3c, 0x36, 0x06,
-    0x09, 0x12, 0x2e, 0x31, 0x52, 0x47, 0x12, 0x47, 0x7b, 0x52, 0x12, 0x14,
-    0x26, 0x28, 0x1f, 0x47, 0x4d, 0x1a, 0x33, 0x3c, 0x4d, 0x75, 0x53, 0x36,
-    0x26, 0x26, 0x3a, 0x58, 0x3a, 0x3a, 0x5f, 0x3a, 0x33, 0x32, 0x58, 0x5d,
-    0x3a, 0x51, 0x56, 0x2f, 0x51, 0x32, 0x56, 0x5d, 0x3e, 0x5d, 0x43, 0x27,
-    0x48, 0x86, 0x6c, 0x70, 0x4e, 0x4e, 0x4e, 0x60, 0x70, 0x54, 0x4e, 0x79,
-    0x7f, 0x60, 0x54, 0x4e, 0x85, 0x96, 0x96, 0x50, 0x70, 0x7f, 0x3e, 0x48,
-    0x6c, 0x4e, 0x60, 0x91, 0x91, 0x70, 0x70, 0x9f, 0x9f, 0x4e, 0x48, 0x5e,
-    0x54, 0x48, 0x70, 0x77, 0x54, 0x5a, 0x70, 0x5a, 0x90, 0x90, 0x70, 0x4a,
-    0x4e, 0x4e, 0x5a, 0x60, 0x4e, 0x78, 0x70, 0x4e, 0x5d, 0x5e, 0x7f, 0x85,
-    0x5d, 0x5d, 0x56, 0x60, 0x4e, 0x4e, 0x7f, 0x54, 0x54, 0x50, 0x41, 0x48,
-    0x70, 0x78, 0x60, 0x5e, 0x41, 0x50, 0x4e, 0x70, 0x70, 0x4e, 0x77, 0x7f,
-    0x4e, 0x4e, 0x48, 0x4e, 0x96, 0x93, 0x56, 0x48, 0x70, 0x66, 0x1f, 0x34,
-    0x56, 0x3e, 0x4e, 0x6c, 0x51, 0x3a, 0x8a, 0x96, 0x58, 0x26, 0x3a, 0x58,
-    0x26, 0x32, 0x56, 0x33, 0x3e, 0x58, 0x33, 0x5f, 0x67, 0x31, 0x1f, 0x1a,
-    0x1a, 0x3c, 0x33, 0x1d, 0x26, 0x47, 0x1d, 0x12, 0x28, 0x47, 0x47, 0x1d,
-    0x28, 0x1d, 0x10, 0x1d, 0x0b, 0x28, 0x12, 0x1d, 0x12, 0x0d, 0x04, 0x18,
-    0x38, 0x2e, 0x2e, 0x12, 0x1d, 0x12, 0x11, 0x28, 0x0a, 0x14, 0x28, 0x25,
-    0x06, 0x08, 0x06, 0x25, 0x2e, 0x0a, 0x00, 0x18, 0x18, 0x06, 0x02, 0x00,
-    0x0f, 0x0f, 0x25, 0x17, 0x00, 0x0f, 0x2e, 0x1c, 0x0a, 0x03, 0x08, 0x00,
-    0x00, 0x0a, 0x0f, 0x06, 0x17, 0x17, 0x08, 0x0a, 0x08, 0x0a, 0x0a, 0x06,
-    0x00, 0x08, 0x08, 0x0f, 0x1b, 0x11, 0x00, 0x00, 0x0e, 0x17, 0x08, 0x00,
-    0x00, 0x0a, 0x0a, 0x00, 0x08, 0x0f, 0x05, 0x08, 0x37, 0x0a, 0x00, 0x08,
-    0x35, 0x4b, 0x35, 0x21, 0x1c, 0x0f, 0x0f, 0x08, 0x11, 0x0d, 0x17, 0x17,
-    0x18, 0x00, 0x00, 0x11, 0x1e, 0x11, 0x08, 0x38, 0x35, 0x1e, 0x11, 0x08,
-    0x08, 0x11, 0x17, 0x08, 0x0a, 0x0e, 0x06, 0x0e, 0x19, 0x1e, 0x1e, 0x14,
-    0x1d, 0x17, 0x11, 0x14, 0x25, 0x37, 0x40, 0x1e, 0x17, 0x18, 0x20, 0x25,
-    0x11, 0x14, 0x18, 0x2f, 0x2f, 0x11, 0x18, 0x47, 0x14, 0x12, 0x39, 0x28,
-    0x26, 0x26, 0x52, 0x47, 0x3a, 0x5f, 0x58, 0x63, 0x53, 0x1d, 0x26, 0x58,
-    0x8a, 0x75, 0x3a, 0x58, 0x3a, 0x43, 0x47, 0x3e, 0x5d, 0x3a, 0x56, 0x89,
-    0x32, 0x2f, 0x58, 0x48, 0x72, 0x58, 0x5d, 0x89, 0x85, 0x5d, 0x2f, 0x4d,
-    0x43, 0x4e, 0x3a, 0x33, 0x41, 0x45, 0x56, 0x70, 0x70, 0x6c, 0x5d, 0x79,
-    0x70, 0x4e, 0x4e, 0x6c, 0x70, 0x79, 0x65, 0x54, 0x50, 0x6c, 0x65, 0x60,
-    0x4e, 0x6c, 0x4e, 0x91, 0x79, 0x4e, 0x78, 0x6c, 0x5b, 0x65, 0x65, 0x73,
-    0x70, 0x7f, 0x91, 0x70, 0x91, 0x90, 0x9f, 0x9f, 0x65, 0x50, 0x79, 0x9d,
-    0xb1, 0x96, 0x7f, 0x79, 0x79, 0x70, 0x60, 0x91, 0x70, 0x70, 0x99, 0x70,
-    0x48, 0x70, 0x70, 0x70, 0x6c, 0x6c, 0x90, 0x91, 0x91, 0x4e, 0x4e, 0x60,
-    0x60, 0x60, 0x45, 0x45, 0x60, 0x70, 0x60, 0x70, 0x78, 0x78, 0x6c, 0x85,
-    0x78, 0x56, 0x5e, 0x7f, 0x79, 0x79, 0x5e, 0x4e, 0x5d, 0x5b, 0x5e, 0x56,
-    0x56, 0x51, 0x79, 0x79, 0x3e, 0x48, 0x5b, 0x2d, 0x51, 0x5b, 0x5d, 0x5d,
-    0x56, 0x75, 0x66, 0x5d, 0x89, 0x8a, 0x89, 0x58, 0x2f, 0x48, 0x8a, 0x96,
-    0x78, 0x56, 0x48, 0x36, 0x53, 0x28, 0x58, 0x34, 0x26, 0x58, 0x66, 0x12,
-    0x28, 0x39, 0x36, 0x53, 0x26, 0x47, 0x5f, 0x67, 0x2d, 0x12, 0x14, 0x12,
-    0x28, 0x06, 0x06, 0x14, 0x12, 0x1e, 0x4f, 0x3f, 0x31, 0x26, 0x2e, 0x1e,
-    0x12, 0x12, 0x1d, 0x1d, 0x28, 0x11, 0x0a, 0x1e, 0x1e, 0x25, 0x0e, 0x12,
-    0x17, 0x1e, 0x25, 0x06, 0x0e, 0x44, 0x11, 0x08, 0x18, 0x17, 0x07, 0x11,
-    0x35, 0x1e, 0x0f, 0x2e, 0x4b, 0x35, 0x18, 0x00, 0x02, 0x18, 0x40, 0x38,
-    0x1c, 0x1c, 0x11, 0x0f, 0x0f, 0x0a, 0x11, 0x17, 0x1e, 0x17, 0x0a, 0x03,
-    0x0a, 0x1e, 0x1e, 0x0a, 0x18, 0x2e, 0x1e, 0x11, 0x08, 0x08, 0x05, 0x08,
-    0x00, 0x08, 0x00, 0x07, 0x55, 0x1b, 0x02, 0x08, 0x07, 0x11, 0x0f, 0x08,
-    0x08, 0x03, 0x03, 0x07, 0x0a, 0x06, 0x08, 0x11, 0x08, 0x0f, 0x17, 0x1b,
-    0x28, 0x1e, 0x19, 0x11, 0x00, 0x00, 0x0e, 0x1c, 0x1c, 0x40, 0x0f, 0x1b,
-    0x61, 0x4f, 0x17, 0x1d, 0x1b, 0x0a, 0x38, 0x61, 0x4f, 0x1d, 0x11, 0x11,
-    0x1e, 0x11, 0x06, 0x00, 0x06, 0x12, 0x28, 0x47, 0x5f, 0x44, 0x47, 0x6d,
-    0x4d, 0x52, 0x8a, 0x97, 0x8a, 0x52, 0x14, 0x20, 0x14, 0x28, 0x7b, 0x58,
-    0x47, 0x1d, 0x28, 0x7b, 0x53, 0x10, 0x1a, 0x33, 0x26, 0x52, 0x3a, 0x3a,
-    0x28, 0x12, 0x27, 0x4d, 0x4d, 0x34, 0x34, 0x51, 0x58, 0x51, 0x5d, 0x5d,
-    0x5e, 0x56, 0x58, 0x2f, 0x27, 0x27, 0x5d, 0x86, 0x78, 0x5d, 0x3e, 0x8a,
-    0x91, 0x70, 0x60, 0x57, 0x56, 0x6c, 0x96, 0x96, 0x7f, 0x4e, 0x56, 0x6c,
-    0x5e, 0x4e, 0x45, 0x34, 0x48, 0x65, 0x73, 0x9f, 0x96, 0x7f, 0xac, 0x98,
-    0x60, 0xb1, 0xb1, 0xb1, 0xac, 0x60, 0x5e, 0x4e, 0x56, 0xa0, 0xb1, 0x7f,
-    0x4e, 0x48, 0x9f, 0x9f, 0x4e, 0x5b, 0x70, 0x70, 0x70, 0x7f, 0x70, 0x4e,
-    0x3e, 0x50, 0x5e, 0x79, 0x57, 0x65, 0x69, 0x60, 0x54, 0x7f, 0x91, 0x81,
-    0x65, 0x70, 0x60, 0x41, 0x41, 0x60, 0x91, 0x91, 0x7f, 0x60, 0x7f, 0xb1,
-    0x84, 0x70, 0x7f, 0x60, 0x60, 0x7f, 0xa0, 0x96, 0x6c, 0x56, 0x5e, 0x70,
-    0x4e, 0x3e, 0x45, 0x32, 0x4e, 0x5e, 0x7f, 0x9f, 0x86, 0x91, 0xa7, 0x60,
-    0x86, 0xb1, 0xa7, 0xa7, 0x5d, 0x3e, 0x48, 0x26, 0x63, 0x9a, 0x6c, 0x4d,
-    0x1f, 0x58, 0xa0, 0x32, 0x18, 0x33, 0x3a, 0x2f, 0x4d, 0x58, 0x3a, 0x12,
-    0x10, 0x3c, 0x3a, 0x2f, 0x33, 0x3a, 0x47, 0x26, 0x26, 0x47, 0x5f, 0x5f,
-    0x3c, 0x26, 0x0e, 0x11, 0x1d, 0x52, 0x4c, 0x5c, 0x31, 0x1e, 0x67, 0x5f,
-    0x28, 0x28, 0x25, 0x11, 0x38, 0x61, 0x61, 0x28, 0x0e, 0x0a, 0x11, 0x1e,
-    0x06, 0x00, 0x08, 0x17, 0x18, 0x28, 0x52, 0x38, 0x2b, 0x4c, 0x37, 0x1e,
-    0x61, 0x7d, 0x7d, 0x38, 0x07, 0x0a, 0x0a, 0x0a, 0x4b, 0x46, 0x0f, 0x07,
-    0x08, 0x1e, 0x40, 0x03, 0x02, 0x07, 0x08, 0x0f, 0x05, 0x0f, 0x03, 0x05,
-    0x08, 0x0a, 0x08, 0x03, 0x0f, 0x0a, 0x0a, 0x17, 0x1e, 0x1e, 0x25, 0x0f,
-    0x11, 0x00, 0x00, 0x08, 0x14, 0x17, 0x1c, 0x0c, 0x05, 0x35, 0x4f, 0x0a,
-    0x05, 0x08, 0x1c, 0x2b, 0x1c, 0x00, 0x02, 0x07, 0x03, 0x0f, 0x0f, 0x1e,
-    0x28, 0x0a, 0x00, 0x00, 0x08, 0x0a, 0x0f, 0x00, 0x00, 0x03, 0x06, 0x08,
-    0x06, 0x00, 0x06, 0x08, 0x08, 0x05, 0x08, 0x1e, 0x38, 0x0e, 0x19, 0x46,
-    0x14, 0x11, 0x26, 0x38, 0x38, 0x61, 0x4f, 0x1e, 0x0e, 0x00, 0x08, 0x52,
-    0x5c, 0x40, 0x2d, 0x12, 0x26, 0x1d, 0x26, 0x1d, 0x1a, 0x63, 0x26, 0x11,
-    0x28, 0x10, 0x1f, 0x26, 0x17, 0x1d, 0x0a, 0x06, 0x31, 0x58, 0x58, 0x0d,
-    0x12, 0x3a, 0x66, 0x5f, 0x33, 0x06, 0x14, 0x27, 0x56, 0x63, 0x48, 0x56,
-    0x48, 0x3a, 0x1d, 0x2f, 0x5b, 0x5d, 0x4d, 0x32, 0x48, 0x48, 0x34, 0x34,
-    0x27, 0x48, 0x4d, 0x48, 0x2f, 0x34, 0x60, 0x70, 0x60, 0x4e, 0x79, 0x70,
-    0x4e, 0x70, 0x85, 0x78, 0x96, 0xa7, 0x78, 0x4e, 0x48, 0x45, 0x79, 0x96,
-    0x8a, 0x7f, 0x60, 0x7f, 0x60, 0x70, 0x50, 0x4a, 0x9f, 0x90, 0x48, 0x6c,
-    0x57, 0x4e, 0x65, 0x4e, 0x50, 0x45, 0x34, 0x50, 0x65, 0x91, 0x4e, 0x41,
-    0x4e, 0x8e, 0x91, 0x7f, 0x50, 0x48, 0x45, 0x91, 0x91, 0x7f, 0x79, 0x65,
-    0x70, 0x50, 0x45, 0x57, 0x79, 0x5e, 0x54, 0x60, 0x57, 0x70, 0x5e, 0x45,
-    0x50, 0x57, 0x4e, 0x56, 0x3e, 0x4e, 0x7f, 0x7f, 0x4e, 0x8e, 0x91, 0x60,
-    0x7f, 0x91, 0x78, 0x7f, 0xa0, 0x93, 0x4e, 0x51, 0x34, 0x60, 0x91, 0x93,
-    0x79, 0x6c, 0x4e, 0x60, 0x5e, 0x5d, 0x3a, 0x85, 0x96, 0x48, 0x48, 0x56,
-    0x4d, 0x4e, 0x51, 0x4d, 0x2f, 0x26, 0x26, 0x34, 0x5d, 0x51, 0x1f, 0x27,
-    0x63, 0x75, 0x63, 0x2f, 0x0a, 0x12, 0x3e, 0x63, 0x4d, 0x58, 0x58, 0x3a,
-    0x1d, 0x10, 0x26, 0x47, 0x33, 0x1d, 0x14, 0x28, 0x1f, 0x20, 0x12, 0x11,
-    0x1a, 0x2e, 0x09, 0x0d, 0x14, 0x31, 0x47, 0x14, 0x25, 0x61, 0x14, 0x1e,
-    0x47, 0x44, 0x40, 0x5f, 0x4f, 0x25, 0x0a, 0x0a, 0x06, 0x4b, 0x61, 0x44,
-    0x2b, 0x17, 0x1e, 0x13, 0x25, 0x13, 0x08, 0x46, 0x35, 0x08, 0x17, 0x13,
-    0x0e, 0x18, 0x0a, 0x06, 0x00, 0x02, 0x00, 0x1e, 0x2e, 0x08, 0x08, 0x17,
-    0x2b, 0x1e, 0x0e, 0x02, 0x03, 0x03, 0x03, 0x17, 0x0f, 0x1c, 0x17, 0x08,
-    0x00, 0x02, 0x07, 0x0a, 0x08, 0x02, 0x00, 0x08, 0x08, 0x00, 0x02, 0x00,
-    0x08, 0x08, 0x00, 0x02, 0x07, 0x1c, 0x2e, 0x08, 0x01, 0x25, 0x35, 0x07,
-    0x02, 0x08, 0x0f, 0x0c, 0x03, 0x03, 0x17, 0x0a, 0x08, 0x00, 0x0a, 0x1e,
-    0x17, 0x14, 0x17, 0x11, 0x00, 0x0a, 0x1b, 0x0a, 0x08, 0x14, 0x1e, 0x17,
-    0x38, 0x37, 0x28, 0x17, 0x0f, 0x0e, 0x0e, 0x1e, 0x2e, 0x20, 0x1e, 0x08,
-    0x00, 0x17, 0x28, 0x13, 0x00, 0x08, 0x0a, 0x31, 0x61, 0x52, 0x18, 0x08,
-    0x06, 0x14, 0x14, 0x3c, 0x3c, 0x13, 0x06, 0x09, 0x12, 0x31, 0x1f, 0x20,
-    0x52, 0x61, 0x61, 0x1a, 0x0a, 0x1f, 0x26, 0x09, 0x52, 0x7b, 0x3a, 0x0d,
-    0x14, 0x3a, 0x3a, 0x1a, 0x26, 0x34, 0x4d, 0x33, 0x33, 0x2f, 0x58, 0x58,
-    0x63, 0x66, 0x70, 0x34, 0x32, 0x56, 0x5b, 0x4d, 0x5b, 0x89, 0x51, 0x5d,
-    0x85, 0x8a, 0x70, 0x6c, 0x5b, 0x56, 0x56, 0x70, 0x70, 0x77, 0x4e, 0x2f,
-    0x3a, 0x5d, 0x5e, 0x34, 0x48, 0x4e, 0x6c, 0x96, 0x9a, 0x70, 0x45, 0x48,
-    0x4e, 0x56, 0x70, 0x90, 0x48, 0x3a, 0x3e, 0x4e, 0x70, 0x70, 0x4e, 0x78,
-    0x9f, 0x96, 0x65, 0x56, 0x48, 0x70, 0x45, 0x4a, 0xa7, 0x90, 0x56, 0x3e,
-    0x5b, 0x90, 0x5e, 0x34, 0x5e, 0x65, 0x57, 0x4e, 0x50, 0x79, 0x79, 0x65,
-    0x79, 0x91, 0x65, 0x54, 0x65, 0x81, 0x57, 0x70, 0x84, 0x79, 0x70, 0x96,
-    0x91, 0x91, 0x86, 0x78, 0x60, 0x5d, 0x70, 0x79, 0x57, 0x70, 0x48, 0x3a,
-    0x51, 0x78, 0x5e, 0x48, 0x45, 0x5b, 0x85, 0xa0, 0x85, 0x5b, 0x41, 0x41,
-    0x45, 0x58, 0x93, 0x58, 0x1f, 0x32, 0x3a, 0x48, 0x6c, 0x41, 0x58, 0x85,
-    0x96, 0x75, 0x3e, 0x26, 0x3a, 0x3a, 0x1f, 0x75, 0x8a, 0x47, 0x10, 0x1d,
-    0x58, 0x58, 0x14, 0x26, 0x3a, 0x2f, 0x1a, 0x28, 0x28, 0x47, 0x44, 0x43,
-    0x52, 0x47, 0x1f, 0x1a, 0x3a, 0x36, 0x26, 0x47, 0x52, 0x2b, 0x52, 0x52,
-    0x5f, 0x52, 0x38, 0x12, 0x11, 0x28, 0x39, 0x38, 0x44, 0x0d, 0x01, 0x0e,
-    0x37, 0x25, 0x08, 0x08, 0x08, 0x25, 0x7d, 0x4f, 0x11, 0x0a, 0x00, 0x06,
-    0x0a, 0x0a, 0x1e, 0x06, 0x06, 0x0a, 0x0a, 0x0e, 0x06, 0x08, 0x14, 0x38,
-    0x2b, 0x11, 0x02, 0x08, 0x08, 0x00, 0x0a, 0x37, 0x17, 0x03, 0x05, 0x0f,
-    0x11, 0x0f, 0x02, 0x0a, 0x11, 0x0a, 0x08, 0x08, 0x11, 0x17, 0x17, 0x11,
-    0x17, 0x08, 0x00, 0x0f, 0x1e, 0x08, 0x14, 0x1e, 0x08, 0x11, 0x1e, 0x18,
-    0x1e, 0x1e, 0x0f, 0x08, 0x09, 0x08, 0x03, 0x03, 0x17, 0x35, 0x1e, 0x00,
-    0x07, 0x0a, 0x40, 0x28, 0x0e, 0x11, 0x18, 0x25, 0x0a, 0x04, 0x11, 0x0a,
-    0x0a, 0x11, 0x11, 0x0f, 0x1e, 0x1e, 0x1e, 0x11, 0x17, 0x17, 0x0a, 0x11,
-    0x0a, 0x37, 0x3d, 0x13, 0x0e, 0x17, 0x0e, 0x0e, 0x08, 0x0a, 0x0e, 0x08,
-    0x04, 0x37, 0x61, 0x18, 0x08, 0x06, 0x07, 0x12, 0x14, 0x31, 0x2e, 0x1d,
-    0x08, 0x1e, 0x31, 0x14, 0x14, 0x14, 0x20, 0x36, 0x38, 0x25, 0x37, 0x3a,
-    0x58, 0x47, 0x47, 0x47, 0x28, 0x0a, 0x12, 0x47, 0x7b, 0x67, 0x36, 0x26,
-    0x26, 0x63, 0x8a, 0x48, 0x3a, 0x5b, 0x6c, 0x3e, 0x36, 0x3a, 0x3a, 0x3e,
-    0x63, 0x56, 0x34, 0x4e, 0x85, 0x78, 0x63, 0x3e, 0x5b, 0x48, 0x3a, 0x51,
-    0x6c, 0x9a, 0x6c, 0x34, 0x5e, 0x60, 0x4e, 0x4a, 0x4d, 0x45, 0x51, 0x3e,
-    0x78, 0x93, 0x85, 0x3a, 0x33, 0x3e, 0x4e, 0x4e, 0x5e, 0x70, 0x7f, 0x43,
-    0x27, 0x96, 0x6c, 0x48, 0x50, 0x60, 0x64, 0x86, 0x5d, 0x6c, 0x7f, 0x90,
-    0x78, 0x5e, 0x96, 0x70, 0x41, 0x32, 0x5d, 0xa0, 0xa0, 0x85, 0x56, 0x5d,
-    0x70, 0x9d, 0x81, 0x57, 0x65, 0x91, 0x65, 0x60, 0x57, 0x57, 0x60, 0x7f,
-    0x70, 0x57, 0x5e, 0x7f, 0x96, 0x85, 0x6c, 0x60, 0x70, 0x4e, 0x5e, 0x70,
-    0x7f, 0x90, 0x5e, 0x4e, 0x64, 0x57, 0x4e, 0x48, 0x58, 0x56, 0x41, 0x4a,
-    0x86, 0xa0, 0x5b, 0x27, 0x34, 0x56, 0x70, 0x4e, 0x70, 0x78, 0x63, 0x09,
-    0x5f, 0x6c, 0x32, 0x34, 0x45, 0x5b, 0x5b, 0x43, 0x58, 0x63, 0x5d, 0x63,
-    0x48, 0x5b, 0x5d, 0x26, 0x14, 0x28, 0x47, 0x8a, 0x67, 0x1a, 0x2f, 0x27,
-    0x66, 0x75, 0x33, 0x33, 0x52, 0x52, 0x28, 0x12, 0x1a, 0x1a, 0x33, 0x3a,
-    0x26, 0x2d, 0x47, 0x58, 0x40, 0x40, 0x2e, 0x27, 0x1a, 0x18, 0x1d, 0x3c,
-    0x61, 0x26, 0x06, 0x25, 0x20, 0x12, 0x13, 0x0a, 0x0a, 0x00, 0x0d, 0x31,
-    0x52, 0x1d, 0x08, 0x08, 0x06, 0x0a, 0x0e, 0x18, 0x1e, 0x20, 0x00, 0x04,
-    0x13, 0x08, 0x08, 0x0a, 0x0a, 0x0e, 0x17, 0x17, 0x18, 0x28, 0x25, 0x0e,
-    0x0e, 0x0e, 0x08, 0x02, 0x00, 0x0a, 0x2b, 0x40, 0x08, 0x02, 0x0a, 0x1e,
-    0x46, 0x11, 0x0a, 0x1e, 0x2b, 0x0e, 0x08, 0x08, 0x0e, 0x08, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x1d, 0x2e, 0x1e, 0x09, 0x14, 0x13, 0x0e, 0x0e, 0x11, 0x40,
-    0x08, 0x02, 0x08, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x37, 0x38, 0x0f, 0x02,
-    0x0a, 0x1c, 0x0f, 0x03, 0x17, 0x1e, 0x1c, 0x37, 0x17, 0x06, 0x06, 0x0a,
-    0x07, 0x08, 0x08, 0x08, 0x1e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0e, 0x1e,
-    0x19, 0x0a, 0x00, 0x06, 0x12, 0x06, 0x0a, 0x25, 0x31, 0x18, 0x07, 0x18,
-    0x61, 0x18, 0x11, 0x12, 0x0d, 0x1e, 0x09, 0x13, 0x1e, 0x1e, 0x0e, 0x26,
-    0x58, 0x3a, 0x3c, 0x38, 0x38, 0x3f, 0x2e, 0x1a, 0x3c, 0x58, 0x47, 0x3c,
-    0x12, 0x31, 0x47, 0x3c, 0x28, 0x28, 0x26, 0x75, 0x8a, 0x3a, 0x1a, 0x27,
-    0x58, 0x52, 0x18, 0x47, 0x66, 0x48, 0x63, 0x5d, 0x3a, 0x2f, 0x3a, 0x3a,
-    0x34, 0x33, 0x33, 0x34, 0x34, 0x2f, 0x3a, 0x3a, 0x34, 0x2f, 0x58, 0x6c,
-    0x63, 0x33, 0x2f, 0x4e, 0x60, 0x4e, 0x60, 0x70, 0x75, 0x33, 0x33, 0x86,
-    0x78, 0x3e, 0x4e, 0x4e, 0x50, 0x60, 0x4e, 0x48, 0x5e, 0x4e, 0x4e, 0x96,
-    0x96, 0x7f, 0x65, 0x5e, 0x79, 0x70, 0x70, 0x60, 0x90, 0x79, 0x70, 0x4e,
-    0x4e, 0x70, 0x78, 0x56, 0x4e, 0x60, 0x91, 0xa7, 0x7f, 0x45, 0x48, 0x4e,
-    0x77, 0x48, 0x56, 0x79, 0x79, 0x65, 0x91, 0x70, 0x4e, 0x56, 0x56, 0x4e,
-    0x4e, 0x56, 0x60, 0x6c, 0x45, 0x48, 0x48, 0x41, 0x4e, 0x45, 0x7f, 0x70,
-    0x3e, 0x2f, 0x56, 0x70, 0x5d, 0x79, 0x65, 0x7f, 0x5d, 0x2f, 0x6c, 0x86,
-    0x58, 0x56, 0x56, 0x48, 0x5d, 0x51, 0x33, 0x58, 0x48, 0x34, 0x6c, 0x85,
-    0x78, 0x6c, 0x6c, 0x56, 0x48, 0x34, 0x33, 0x5f, 0x5d, 0x5d, 0x33, 0x28,
-    0x43, 0x52, 0x3c, 0x26, 0x26, 0x58, 0x75, 0x75, 0x26, 0x18, 0x1a, 0x47,
-    0x31, 0x06, 0x3c, 0x4d, 0x36, 0x52, 0x3a, 0x28, 0x1d, 0x18, 0x12, 0x28,
-    0x18, 0x26, 0x3f, 0x06, 0x09, 0x06, 0x06, 0x0a, 0x06, 0x31, 0x3c, 0x18,
-    0x00, 0x0e, 0x1e, 0x14, 0x0a, 0x1e, 0x37, 0x1b, 0x08, 0x1e, 0x61, 0x28,
-    0x0a, 0x0a, 0x04, 0x11, 0x08, 0x00, 0x08, 0x06, 0x06, 0x20, 0x40, 0x38,
-    0x1e, 0x1e, 0x0a, 0x11, 0x14, 0x08, 0x13, 0x1e, 0x1e, 0x06, 0x00, 0x05,
-    0x0e, 0x0a, 0x08, 0x0a, 0x0e, 0x1e, 0x4f, 0x18, 0x02, 0x08, 0x17, 0x1c,
-    0x03, 0x0f, 0x1e, 0x25, 0x25, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x08,
-    0x08, 0x08, 0x08, 0x02, 0x03, 0x08, 0x00, 0x08, 0x11, 0x31, 0x13, 0x00,
-    0x11, 0x07, 0x08, 0x13, 0x06, 0x1e, 0x1c, 0x0a, 0x0c, 0x16, 0x4b, 0x4b,
-    0x1c, 0x0e, 0x11, 0x17, 0x02, 0x08, 0x05, 0x0f, 0x0f, 0x17, 0x0e, 0x04,
-    0x14, 0x18, 0x25, 0x17, 0x0a, 0x0e, 0x06, 0x0e, 0x0a, 0x1c, 0x0a, 0x0a,
-    0x06, 0x20, 0x2e, 0x0a, 0x1e, 0x4b, 0x4b, 0x1c, 0x18, 0x61, 0x4f, 0x28,
-    0x1d, 0x1d, 0x0d, 0x1e, 0x47, 0x2e, 0x1e, 0x18, 0x28, 0x1a, 0x2e, 0x52,
-    0x2f, 0x2f, 0x3c, 0x2d, 0x1f, 0x1f, 0x0b, 0x20, 0x5f, 0x63, 0x26, 0x28,
-    0x26, 0x26, 0x52, 0x53, 0x4d, 0x5d, 0x52, 0x28, 0x44, 0x47, 0x5f, 0x47,
-    0x31, 0x3a, 0x56, 0x2f, 0x1a, 0x26, 0x3a, 0x63, 0x5d, 0x4e, 0x41, 0x4d,
-    0x58, 0x63, 0x5d, 0x58, 0x33, 0x3e, 0x5d, 0x48, 0x5b, 0x58, 0x1f, 0x3c,
-    0x60, 0x79, 0x57, 0x4e, 0x8a, 0x9a, 0x63, 0x58, 0xa0, 0x96, 0x85, 0x4e,
-    0x56, 0x4e, 0x41, 0x65, 0x91, 0x70, 0x4e, 0x5e, 0x60, 0x60, 0x7f, 0x65,
-    0x7f, 0x5e, 0x4e, 0x50, 0x4e, 0x4e, 0x4e, 0x7f, 0x9d, 0x70, 0x45, 0x5d,
-    0x4e, 0x70, 0x7f, 0x7f, 0x96, 0x7f, 0x56, 0x4d, 0x58, 0x89, 0x89, 0x5d,
-    0x4e, 0x7f, 0x79, 0x48, 0x34, 0x50, 0x7f, 0x70, 0x79, 0x65, 0x5e, 0x5d,
-    0x78, 0x78, 0x78, 0x48, 0x56, 0x86, 0x70, 0x6c, 0x63, 0x27, 0x27, 0x60,
-    0x79, 0x79, 0x50, 0x70, 0x9a, 0x7b, 0x3a, 0x78, 0x9a, 0x89, 0x51, 0x48,
-    0x48, 0x3a, 0x48, 0x70, 0x78, 0x3e, 0x34, 0x3e, 0x58, 0x5d, 0x60, 0x60,
-    0x5b, 0x47, 0x3a, 0x36, 0x3a, 0x33, 0x3e, 0x78, 0x6c, 0x26, 0x3c, 0x2f,
-    0x36, 0x5f, 0x52, 0x52, 0x67, 0x2f, 0x18, 0x38, 0x4f, 0x52, 0x38, 0x28,
-    0x2e, 0x44, 0x14, 0x0a, 0x12, 0x26, 0x3c, 0x3c, 0x26, 0x26, 0x26, 0x1d,
-    0x47, 0x31, 0x12, 0x09, 0x1d, 0x1d, 0x12, 0x2e, 0x0f, 0x08, 0x17, 0x31,
-    0x28, 0x0e, 0x11, 0x4b, 0x35, 0x17, 0x19, 0x4f, 0x46, 0x28, 0x0a, 0x08,
-    0x0a, 0x06, 0x25, 0x1e, 0x11, 0x0a, 0x11, 0x1e, 0x11, 0x1b, 0x11, 0x1e,
-    0x1e, 0x04, 0x08, 0x0a, 0x00, 0x04, 0x25, 0x28, 0x08, 0x08, 0x11, 0x07,
-    0x17, 0x13, 0x0e, 0x25, 0x1c, 0x05, 0x1b, 0x21, 0x55, 0x21, 0x0f, 0x0c,
-    0x1e, 0x0a, 0x03, 0x03, 0x08, 0x0a, 0x11, 0x17, 0x08, 0x11, 0x1b, 0x1c,
-    0x1c, 0x1e, 0x0f, 0x08, 0x2e, 0x25, 0x03, 0x08, 0x25, 0x0a, 0x07, 0x07,
-    0x00, 0x00, 0x1c, 0x46, 0x35, 0x1c, 0x35, 0x55, 0x4b, 0x1e, 0x01, 0x02,
-    0x1c, 0x35, 0x11, 0x1b, 0x0f, 0x08, 0x0e, 0x11, 0x37, 0x25, 0x08, 0x17,
-    0x46, 0x38, 0x1e, 0x20, 0x35, 0x1c, 0x35, 0x61, 0x31, 0x09, 0x11, 0x0e,
-    0x1e, 0x2e, 0x4b, 0x37, 0x08, 0x17, 0x17, 0x31, 0x1e, 0x06, 0x2e, 0x4f,
-    0x67, 0x7d, 0x40, 0x26, 0x1a, 0x0a, 0x11, 0x28, 0x28, 0x4d, 0x67, 0x52,
-    0x53, 0x26, 0x0d, 0x39, 0x5f, 0x28, 0x0d, 0x5f, 0x58, 0x28, 0x1d, 0x14,
-    0x33, 0x58, 0x6d, 0x7b, 0x66, 0x53, 0x67, 0x7b, 0x7b, 0x3c, 0x10, 0x3a,
-    0x89, 0x66, 0x34, 0x26, 0x3a, 0x51, 0x58, 0x5d, 0x66, 0x3a, 0x3e, 0x93,
-    0x75, 0x5d, 0x78, 0x5d, 0x63, 0x6a, 0x89, 0x8a, 0x48, 0x5b, 0x60, 0x56,
-    0x58, 0x75, 0xa0, 0x58, 0x27, 0x3a, 0x5b, 0x8a, 0x51, 0x5d, 0x7f, 0x90,
-    0xa7, 0x7f, 0x5e, 0x5e, 0x45, 0x48, 0x4e, 0x4e, 0x96, 0xa7, 0x96, 0x7f,
-    0x5e, 0x56, 0x4e, 0x96, 0x70, 0x41, 0x70, 0x93, 0x4e, 0x34, 0x34, 0x45,
-    0x79, 0x7f, 0x96, 0xa7, 0x78, 0x8a, 0x96, 0x9f, 0x7f, 0x3a, 0x48, 0x91,
-    0x91, 0x79, 0x5e, 0x4e, 0x60, 0x54, 0x70, 0x78, 0x5e, 0x56, 0x70, 0x96,
-    0x70, 0x85, 0x70, 0x7f, 0x6c, 0x89, 0x96, 0x60, 0x56, 0x60, 0x5e, 0x58,
-    0x66, 0x96, 0x78, 0x26, 0x3a, 0x3e, 0x85, 0x56, 0x34, 0x4e, 0x85, 0x96,
-    0x85, 0x48, 0x51, 0x3a, 0x26, 0x3e, 0x33, 0x58, 0x9a, 0x75, 0x5f, 0x66,
-    0x3a, 0x2f, 0x5b, 0x63, 0x1d, 0x26, 0x75, 0x52, 0x1a, 0x12, 0x12, 0x3c,
-    0x58, 0x6d, 0x6d, 0x52, 0x3a, 0x67, 0x7b, 0x4f, 0x11, 0x01, 0x4c, 0x75,
-    0x47, 0x28, 0x1e, 0x28, 0x1a, 0x28, 0x26, 0x38, 0x11, 0x20, 0x61, 0x36,
-    0x39, 0x1d, 0x28, 0x2e, 0x28, 0x7d, 0x40, 0x04, 0x11, 0x14, 0x17, 0x2e,
-    0x40, 0x35, 0x0a, 0x0e, 0x17, 0x2e, 0x1e, 0x00, 0x14, 0x2e, 0x4f, 0x46,
-    0x2e, 0x14, 0x08, 0x00, 0x0e, 0x0a, 0x03, 0x25, 0x4f, 0x18, 0x1e, 0x1e,
-    0x00, 0x13, 0x38, 0x0a, 0x02, 0x17, 0x17, 0x03, 0x08, 0x07, 0x00, 0x0e,
-    0x35, 0x4b, 0x21, 0x16, 0x4b, 0x4b, 0x2e, 0x0a, 0x00, 0x08, 0x37, 0x1c,
-    0x14, 0x11, 0x08, 0x08, 0x0a, 0x2e, 0x35, 0x0f, 0x11, 0x2e, 0x2e, 0x17,
-    0x02, 0x05, 0x1c, 0x4b, 0x35, 0x0f, 0x0a, 0x0f, 0x07, 0x04, 0x00, 0x0c,
-    0x0c, 0x0f, 0x18, 0x0c, 0x17, 0x1e, 0x0f, 0x17, 0x0f, 0x0c, 0x0a, 0x1e,
-    0x0f, 0x00, 0x00, 0x0a, 0x0e, 0x0a, 0x13, 0x08, 0x0f, 0x0a, 0x01, 0x00,
-    0x08, 0x08, 0x17, 0x5c, 0x37, 0x11, 0x14, 0x0a, 0x02, 0x08, 0x00, 0x11,
-    0x5c, 0x2b, 0x2e, 0x06, 0x00, 0x1d, 0x3c, 0x28, 0x0f, 0x11, 0x0a, 0x08,
-    0x12, 0x1d, 0x28, 0x47, 0x28, 0x14, 0x1a, 0x1d, 0x12, 0x12, 0x18, 0x14,
-    0x28, 0x47, 0x8a, 0x8a, 0x3c, 0x26, 0x47, 0x3a, 0x1f, 0x1d, 0x3a, 0x47,
-    0x26, 0x58, 0x3a, 0x4d, 0x63, 0x4d, 0x58, 0x3e, 0x33, 0x3e, 0x5b, 0x5b,
-    0x2f, 0x26, 0x3a, 0x5d, 0x4d, 0x56, 0x58, 0x33, 0x6a, 0x58, 0x12, 0x33,
-    0x26, 0x34, 0x9a, 0x9a, 0x5d, 0x45, 0x4e, 0x3a, 0x10, 0x1a, 0x3a, 0x9a,
-    0x9a, 0x85, 0x4e, 0x33, 0x45, 0x7f, 0x79, 0x48, 0x32, 0x41, 0x3a, 0x48,
-    0x4e, 0x60, 0x70, 0x78, 0x58, 0x5b, 0x7f, 0x5d, 0x48, 0x4e, 0x4e, 0x56,
-    0x5e, 0x96, 0xb1, 0x7f, 0x4e, 0x70, 0x85, 0x5b, 0x48, 0x56, 0x7f, 0x5d,
-    0x89, 0x78, 0x5e, 0x79, 0x7f, 0x70, 0x7f, 0x5d, 0x5e, 0x70, 0x96, 0x5d,
-    0x41, 0x45, 0x57, 0x50, 0x4e, 0x5e, 0x34, 0x4e, 0x70, 0x27, 0x34, 0x32,
-    0x3a, 0x8a, 0x9a, 0x78, 0x5b, 0x70, 0x58, 0x1d, 0x10, 0x1a, 0x78, 0x9a,
-    0x85, 0x6c, 0x2f, 0x2f, 0x60, 0x6a, 0x33, 0x1f, 0x33, 0x27, 0x26, 0x32,
-    0x48, 0x48, 0x5d, 0x44, 0x31, 0x5f, 0x47, 0x33, 0x3c, 0x2f, 0x2f, 0x2f,
-    0x52, 0x97, 0x89, 0x33, 0x33, 0x67, 0x47, 0x10, 0x12, 0x52, 0x2f, 0x2e,
-    0x52, 0x31, 0x3f, 0x47, 0x28, 0x44, 0x31, 0x25, 0x3c, 0x67, 0x3a, 0x11,
-    0x09, 0x1a, 0x28, 0x1d, 0x28, 0x0e, 0x0e, 0x28, 0x06, 0x06, 0x0a, 0x00,
-    0x1e, 0x67, 0x44, 0x11, 0x1e, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x40,
-    0x2e, 0x0e, 0x08, 0x0a, 0x18, 0x1b, 0x0f, 0x0f, 0x07, 0x08, 0x08, 0x0e,
-    0x11, 0x0f, 0x0f, 0x0f, 0x0a, 0x0f, 0x0e, 0x0f, 0x02, 0x02, 0x07, 0x0a,
-    0x40, 0x4f, 0x1c, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x0a, 0x0f, 0x0f, 0x1c,
-    0x11, 0x17, 0x18, 0x13, 0x1e, 0x0e, 0x0a, 0x0a, 0x1e, 0x1e, 0x08, 0x00,
-    0x08, 0x0f, 0x0f, 0x0a, 0x17, 0x07, 0x08, 0x06, 0x0f, 0x0f, 0x1c, 0x1e,
-    0x02, 0x1c, 0x1c, 0x17, 0x0e, 0x08, 0x08, 0x02, 0x00, 0x0e, 0x17, 0x0e,
-    0x08, 0x08, 0x18, 0x25, 0x08, 0x2e, 0x2b, 0x0f, 0x17, 0x35, 0x25, 0x08,
-    0x2b, 0x08, 0x01, 0x06, 0x08, 0x04, 0x1e, 0x25, 0x17, 0x08, 0x08, 0x06,
-    0x00, 0x0e, 0x0e, 0x00, 0x08, 0x1e, 0x18, 0x19, 0x17, 0x11, 0x1e, 0x1e,
-    0x37, 0x31, 0x12, 0x00, 0x11, 0x40, 0x2e, 0x31, 0x7b, 0x7b, 0x4f, 0x28,
-    0x1e, 0x13, 0x09, 0x08, 0x38, 0x5f, 0x5f, 0x26, 0x1d, 0x3c, 0x58, 0x28,
-    0x3c, 0x6d, 0x58, 0x47, 0x2f, 0x63, 0x26, 0x10, 0x2d, 0x27, 0x3c, 0x47,
-    0x47, 0x58, 0x63, 0x47, 0x43, 0x89, 0x5f, 0x43, 0x75, 0x66, 0x33, 0x58,
-    0x56, 0x27, 0x33, 0x58, 0x48, 0x6c, 0x75, 0x56, 0x4e, 0x48, 0x33, 0x36,
-    0x48, 0x4e, 0x34, 0x27, 0x67, 0x75, 0x56, 0x58, 0x66, 0x34, 0x4e, 0x85,
-    0x70, 0x4e, 0x2f, 0x33, 0x75, 0x85, 0x6c, 0x96, 0xb1, 0x96, 0x6c, 0x5d,
-    0x4e, 0x34, 0x33, 0x4e, 0x86, 0x91, 0x79, 0x4e, 0x56, 0x96, 0x5e, 0x48,
-    0x96, 0x9f, 0x79, 0x60, 0x65, 0x60, 0x34, 0x4e, 0x5d, 0x4a, 0x5e, 0x6a,
-    0x5e, 0x91, 0x78, 0x5d, 0x96, 0x85, 0x5e, 0x7f, 0x96, 0x4e, 0x4e, 0x7f,
-    0x48, 0x2f, 0x56, 0x5d, 0x5d, 0x86, 0x85, 0x56, 0x4e, 0x3a, 0x1a, 0x3a,
-    0x60, 0x50, 0x33, 0x51, 0x75, 0x5f, 0x58, 0x66, 0x34, 0x3e, 0x4e, 0x70,
-    0x5b, 0x33, 0x12, 0x3a, 0x75, 0x63, 0x6a, 0x9a, 0x9a, 0x5b, 0x48, 0x3a,
-    0x1a, 0x06, 0x12, 0x63, 0x78, 0x6c, 0x4d, 0x26, 0x67, 0x5f, 0x1d, 0x53,
-    0x75, 0x58, 0x2f, 0x2f, 0x2f, 0x12, 0x10, 0x26, 0x28, 0x20, 0x31, 0x26,
-    0x3a, 0x52, 0x18, 0x4f, 0x61, 0x44, 0x2e, 0x58, 0x3c, 0x10, 0x38, 0x14,
-    0x06, 0x06, 0x14, 0x1d, 0x44, 0x31, 0x25, 0x13, 0x07, 0x00, 0x01, 0x13,
-    0x12, 0x00, 0x07, 0x1e, 0x14, 0x11, 0x17, 0x13, 0x1e, 0x1e, 0x2e, 0x31,
-    0x0a, 0x03, 0x05, 0x2e, 0x25, 0x17, 0x4f, 0x61, 0x2e, 0x0f, 0x0f, 0x02,
-    0x02, 0x07, 0x21, 0x35, 0x1c, 0x0f, 0x05, 0x0f, 0x1c, 0x0f, 0x0f, 0x35,
-    0x2e, 0x11, 0x08, 0x0a, 0x08, 0x02, 0x08, 0x0f, 0x0a, 0x08, 0x07, 0x11,
-    0x2e, 0x0a, 0x0f, 0x2e, 0x18, 0x08, 0x2b, 0x37, 0x06, 0x0a, 0x17, 0x0f,
-    0x07, 0x08, 0x08, 0x11, 0x2e, 0x1b, 0x08, 0x03, 0x0f, 0x1c, 0x0f, 0x00,
-    0x02, 0x08, 0x06, 0x0e, 0x0a, 0x08, 0x06, 0x2e, 0x1e, 0x0a, 0x08, 0x08,
-    0x17, 0x0a, 0x03, 0x02, 0x03, 0x11, 0x17, 0x2e, 0x14, 0x08, 0x1e, 0x2e,
-    0x0a, 0x00, 0x00, 0x11, 0x0a, 0x0a, 0x07, 0x0e, 0x1e, 0x13, 0x13, 0x1e,
-    0x12, 0x1e, 0x44, 0x37, 0x00, 0x18, 0x25, 0x28, 0x38, 0x1e, 0x17, 0x12,
-    0x11, 0x0e, 0x40, 0x61, 0x4f, 0x2e, 0x28, 0x2e, 0x31, 0x14, 0x00, 0x14,
-    0x47, 0x47, 0x26, 0x47, 0x52, 0x26, 0x0a, 0x12, 0x3f, 0x2d, 0x18, 0x18,
-    0x1a, 0x2f, 0x3a, 0x3a, 0x27, 0x1f, 0x3a, 0x58, 0x26, 0x3c, 0x33, 0x36,
-    0x47, 0x47, 0x36, 0x1d, 0x3a, 0x58, 0x5f, 0x56, 0x5b, 0x34, 0x63, 0x4d,
-    0x27, 0x3e, 0x56, 0x51, 0x4e, 0x50, 0x5b, 0x3a, 0x4e, 0x70, 0x50, 0x56,
-    0x75, 0x85, 0x8a, 0x2f, 0x34, 0x8a, 0x5e, 0x85, 0x60, 0x4e, 0x6c, 0x6a,
-    0x3a, 0x51, 0x85, 0xa0, 0x79, 0x56, 0x56, 0x4e, 0x5e, 0x3e, 0x48, 0x70,
-    0x79, 0x79, 0x79, 0x91, 0x78, 0x56, 0x27, 0x5b, 0x70, 0x4e, 0x45, 0x4e,
-    0x4e, 0x60, 0x78, 0x79, 0x56, 0x6c, 0x96, 0x5d, 0x56, 0x70, 0x5b, 0x6a,
-    0x5e, 0x5d, 0x2f, 0x41, 0x78, 0x85, 0x85, 0x70, 0x4e, 0x60, 0x70, 0x56,
-    0x3a, 0x6c, 0x6a, 0x51, 0x79, 0x4e, 0x56, 0x56, 0x60, 0x60, 0x41, 0x6c,
-    0x5d, 0x96, 0x56, 0x26, 0x6a, 0x5b, 0x6a, 0x5b, 0x4d, 0x3e, 0x48, 0x36,
-    0x36, 0x5d, 0x89, 0x86, 0x58, 0x3a, 0x3a, 0x50, 0x34, 0x1a, 0x4d, 0x5d,
-    0x63, 0x3a, 0x63, 0x58, 0x26, 0x14, 0x1a, 0x43, 0x2f, 0x1d, 0x1a, 0x2f,
-    0x47, 0x33, 0x33, 0x26, 0x28, 0x47, 0x4f, 0x12, 0x28, 0x28, 0x31, 0x20,
-    0x14, 0x17, 0x06, 0x28, 0x31, 0x47, 0x31, 0x14, 0x28, 0x26, 0x28, 0x06,
-    0x12, 0x31, 0x14, 0x1e, 0x14, 0x06, 0x0a, 0x17, 0x12, 0x11, 0x11, 0x2b,
-    0x38, 0x28, 0x00, 0x17, 0x2e, 0x1e, 0x35, 0x0a, 0x08, 0x07, 0x0a, 0x07,
-    0x17, 0x38, 0x38, 0x1e, 0x08, 0x11, 0x0a, 0x00, 0x00, 0x08, 0x1e, 0x37,
-    0x11, 0x18, 0x37, 0x0a, 0x03, 0x05, 0x1b, 0x0a, 0x08, 0x03, 0x08, 0x08,
-    0x08, 0x0e, 0x08, 0x08, 0x1e, 0x2b, 0x0f, 0x00, 0x08, 0x0c, 0x17, 0x08,
-    0x03, 0x02, 0x0a, 0x0a, 0x1c, 0x1e, 0x0f, 0x0a, 0x1e, 0x17, 0x00, 0x08,
-    0x08, 0x0a, 0x0f, 0x05, 0x21, 0x29, 0x02, 0x03, 0x17, 0x07, 0x00, 0x06,
-    0x1e, 0x37, 0x1e, 0x08, 0x06, 0x00, 0x08, 0x0a, 0x35, 0x0f, 0x00, 0x0f,
-    0x0a, 0x0a, 0x17, 0x1e, 0x11, 0x17, 0x46, 0x25, 0x00, 0x00, 0x00, 0x04,
-    0x13, 0x2e, 0x2e, 0x08, 0x13, 0x1e, 0x08, 0x17, 0x38, 0x4b, 0x28, 0x00,
-    0x06, 0x11, 0x1e, 0x1e, 0x11, 0x11, 0x0d, 0x1d, 0x4c, 0x40, 0x28, 0x0a,
-    0x0e, 0x11, 0x26, 0x38, 0x1e, 0x0e, 0x12, 0x14, 0x14, 0x12, 0x0a, 0x06,
-    0x28, 0x26, 0x1d, 0x28, 0x44, 0x12, 0x0a, 0x47, 0x2f, 0x1a, 0x31, 0x3a,
-    0x75, 0x75, 0x26, 0x26, 0x2f, 0x28, 0x36, 0x58, 0x47, 0x06, 0x1f, 0x58,
-    0x3a, 0x58, 0x58, 0x56, 0x48, 0x85, 0x5b, 0x1f, 0x27, 0x3e, 0x3a, 0x3e,
-    0x5b, 0x70, 0x3e, 0x33, 0x4e, 0x45, 0x45, 0x78, 0x89, 0x86, 0x3a, 0x32,
-    0x48, 0x5d, 0x6a, 0x5b, 0x3e, 0x4e, 0x78, 0x86, 0x6c, 0x4e, 0x56, 0x3a,
-    0x34, 0x70, 0x86, 0x5d, 0x45, 0x41, 0x56, 0x54, 0x4e, 0x4e, 0x41, 0x4e,
-    0x5b, 0x56, 0x48, 0x56, 0x5b, 0x27, 0x4e, 0x79, 0x4e, 0x45, 0x4e, 0x7f,
-    0x90, 0x4e, 0x41, 0x51, 0x56, 0x4e, 0x85, 0x78, 0x27, 0x34, 0x56, 0x5d,
-    0x5d, 0x89, 0x70, 0x50, 0x79, 0x85, 0x4d, 0x48, 0x56, 0x3e, 0x43, 0x60,
-    0x79, 0x6c, 0x48, 0x4e, 0x4e, 0x48, 0x4e, 0x86, 0x8a, 0x3e, 0x2f, 0x3a,
-    0x58, 0x5d, 0x56, 0x48, 0x3e, 0x56, 0x66, 0x63, 0x63, 0x58, 0x27, 0x28,
-    0x34, 0x66, 0x50, 0x50, 0x2f, 0x48, 0x48, 0x2f, 0x32, 0x18, 0x12, 0x36,
-    0x36, 0x1f, 0x28, 0x44, 0x18, 0x12, 0x52, 0x3c, 0x26, 0x2f, 0x43, 0x7b,
-    0x52, 0x0d, 0x1d, 0x1a, 0x12, 0x28, 0x5f, 0x14, 0x00, 0x12, 0x28, 0x12,
-    0x3c, 0x3f, 0x28, 0x28, 0x4f, 0x28, 0x06, 0x04, 0x06, 0x13, 0x12, 0x2e,
-    0x38, 0x0e, 0x0e, 0x17, 0x08, 0x06, 0x40, 0x4f, 0x1e, 0x08, 0x08, 0x0e,
-    0x1e, 0x11, 0x13, 0x0e, 0x08, 0x17, 0x38, 0x1e, 0x0a, 0x00, 0x00, 0x02,
-    0x0f, 0x1e, 0x0a, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0c,
-    0x07, 0x0f, 0x35, 0x0f, 0x02, 0x0f, 0x17, 0x00, 0x06, 0x0e, 0x18, 0x2b,
-    0x0a, 0x08, 0x00, 0x08, 0x08, 0x1c, 0x1e, 0x03, 0x07, 0x1e, 0x03, 0x06,
-    0x1e, 0x1e, 0x0d, 0x1e, 0x25, 0x08, 0x00, 0x08, 0x25, 0x0e, 0x11, 0x25,
-    0x1b, 0x17, 0x1c, 0x40, 0x17, 0x35, 0x2e, 0x11, 0x17, 0x1e, 0x25, 0x18,
-    0x1c, 0x14, 0x17, 0x08, 0x03, 0x08, 0x35, 0x4f, 0x1e, 0x02, 0x0a, 0x08,
-    0x11, 0x2b, 0x07, 0x0e, 0x08, 0x00, 0x0e, 0x06, 0x0e, 0x14, 0x1e, 0x3f,
-    0x4f, 0x08, 0x0a, 0x0e, 0x14, 0x40, 0x25, 0x13, 0x4f, 0x28, 0x00, 0x00,
-    0x17, 0x1c, 0x14, 0x12, 0x28, 0x31, 0x1d, 0x0a, 0x1e, 0x37, 0x17, 0x0d,
-    0x1d, 0x47, 0x7b, 0x47, 0x12, 0x28, 0x1d, 0x47, 0x4c, 0x26, 0x5f, 0x52,
-    0x28, 0x2d, 0x67, 0x52, 0x5b, 0x75, 0x44, 0x3a, 0x58, 0x3c, 0x56, 0x58,
-    0x52, 0x5c, 0x47, 0x06, 0x06, 0x43, 0x97, 0x89, 0x1a, 0x27, 0x4d, 0x3a,
-    0x58, 0x66, 0x47, 0x3e, 0x32, 0x3e, 0x3a, 0x48, 0x4e, 0x34, 0x7b, 0x89,
-    0x3e, 0x2f, 0x4e, 0x48, 0x75, 0x6c, 0x48, 0x86, 0x8a, 0x34, 0x1f, 0x33,
-    0x5b, 0x3e, 0x41, 0x5e, 0x78, 0x50, 0x48, 0x48, 0x63, 0x5b, 0x5b, 0x56,
-    0x7f, 0xa7, 0x7f, 0x50, 0x50, 0x5e, 0x70, 0x86, 0x6c, 0x5d, 0x89, 0x5d,
-    0x3e, 0x85, 0x86, 0x6c, 0x90, 0x6c, 0x5e, 0x70, 0x5d, 0x60, 0x91, 0x70,
-    0x85, 0x85, 0x3e, 0x1a, 0x45, 0xa0, 0xa7, 0x4e, 0x34, 0x5d, 0x5b, 0x5b,
-    0x86, 0x56, 0x5b, 0x56, 0x4e, 0x3e, 0x48, 0x77, 0x5b, 0x5d, 0x96, 0x6a,
-    0x2f, 0x5b, 0x45, 0x56, 0x86, 0x3e, 0x4e, 0x86, 0x48, 0x1f, 0x1f, 0x51,
-    0x5d, 0x3a, 0x3e, 0x5b, 0x5d, 0x3a, 0x26, 0x3a, 0x47, 0x26, 0x48, 0x5b,
-    0x78, 0x8a, 0x3e, 0x2f, 0x47, 0x3a, 0x58, 0x53, 0x47, 0x58, 0x47, 0x2e,
-    0x52, 0x67, 0x3f, 0x7d, 0x5f, 0x1f, 0x52, 0x53, 0x38, 0x52, 0x4d, 0x52,
-    0x40, 0x14, 0x00, 0x06, 0x4f, 0x7b, 0x44, 0x04, 0x11, 0x12, 0x28, 0x4f,
-    0x1d, 0x14, 0x11, 0x11, 0x11, 0x06, 0x28, 0x1c, 0x17, 0x46, 0x47, 0x08,
-    0x08, 0x08, 0x11, 0x40, 0x18, 0x0e, 0x38, 0x28, 0x08, 0x00, 0x0a, 0x1e,
-    0x0a, 0x04, 0x11, 0x13, 0x0e, 0x01, 0x00, 0x17, 0x0a, 0x08, 0x0e, 0x25,
-    0x31, 0x17, 0x08, 0x00, 0x0d, 0x25, 0x17, 0x06, 0x1e, 0x2e, 0x17, 0x0f,
-    0x4b, 0x2b, 0x1c, 0x38, 0x1e, 0x13, 0x14, 0x25, 0x1e, 0x2b, 0x28, 0x17,
-    0x0f, 0x02, 0x00, 0x1c, 0x4f, 0x46, 0x0a, 0x08, 0x08, 0x08, 0x28, 0x1e,
-    0x00, 0x00, 0x00, 0x08, 0x0f, 0x08, 0x06, 0x1e, 0x25, 0x17, 0x1c, 0x1c,
-    0x0f, 0x0c, 0x14, 0x0a, 0x00, 0x02, 0x00, 0x0f, 0x0c, 0x1e, 0x17, 0x0f,
-    0x1c, 0x0c, 0x11, 0x1c, 0x1e, 0x17, 0x0a, 0x0a, 0x0f, 0x0e, 0x0a, 0x13,
-    0x1e, 0x0e, 0x00, 0x08, 0x13, 0x4f, 0x40, 0x1e, 0x17, 0x28, 0x5c, 0x40,
-    0x11, 0x01, 0x11, 0x40, 0x2e, 0x2b, 0x28, 0x1c, 0x08, 0x25, 0x52, 0x12,
-    0x06, 0x14, 0x12, 0x26, 0x0e, 0x06, 0x1e, 0x67, 0x58, 0x2d, 0x26, 0x28,
-    0x18, 0x06, 0x31, 0x38, 0x0a, 0x1a, 0x3c, 0x3a, 0x1a, 0x3c, 0x52, 0x26,
-    0x28, 0x58, 0x43, 0x1d, 0x12, 0x26, 0x3a, 0x1f, 0x47, 0x53, 0x47, 0x52,
-    0x58, 0x47, 0x47, 0x63, 0x7b, 0x4d, 0x2f, 0x28, 0x31, 0x3a, 0x51, 0x58,
-    0x3e, 0x2f, 0x48, 0x48, 0x6c, 0x7b, 0x53, 0x39, 0x58, 0x86, 0x9a, 0x56,
-    0x28, 0x34, 0x70, 0x70, 0x5b, 0x5e, 0x56, 0x33, 0x58, 0x85, 0x5e, 0x56,
-    0x3e, 0x56, 0x5e, 0x4e, 0x2f, 0x4d, 0x8a, 0x93, 0x89, 0x6c, 0x5d, 0x51,
-    0x33, 0x33, 0x75, 0x3e, 0x48, 0x5d, 0x89, 0x5d, 0x63, 0x8a, 0x63, 0x3c,
-    0x58, 0x7f, 0x4e, 0x3e, 0x3e, 0x6c, 0x5d, 0x5d, 0x78, 0x51, 0x75, 0x70,
-    0x70, 0x5d, 0x6c, 0x7f, 0x78, 0x58, 0x34, 0x34, 0x58, 0x5b, 0x5b, 0x4e,
-    0x4a, 0x56, 0x4e, 0x70, 0x85, 0x67, 0x53, 0x43, 0x85, 0x93, 0x6c, 0x33,
-    0x1a, 0x4e, 0x77, 0x5e, 0x5b, 0x56, 0x27, 0x27, 0x63, 0x85, 0x34, 0x3a,
-    0x34, 0x48, 0x58, 0x27, 0x12, 0x4d, 0x7d, 0x7b, 0x5c, 0x67, 0x3a, 0x28,
-    0x1d, 0x58, 0x3c, 0x1f, 0x33, 0x58, 0x52, 0x3c, 0x52, 0x47, 0x18, 0x28,
-    0x52, 0x36, 0x0b, 0x14, 0x28, 0x1a, 0x18, 0x52, 0x40, 0x25, 0x44, 0x36,
-    0x25, 0x2e, 0x44, 0x36, 0x1e, 0x06, 0x13, 0x11, 0x14, 0x31, 0x1d, 0x12,
-    0x09, 0x14, 0x12, 0x4f, 0x4f, 0x1e, 0x1e, 0x25, 0x46, 0x4c, 0x11, 0x00,
-    0x0e, 0x28, 0x2b, 0x18, 0x1e, 0x0e, 0x00, 0x0f, 0x37, 0x0b, 0x01, 0x01,
-    0x00, 0x06, 0x08, 0x00, 0x00, 0x0a, 0x35, 0x46, 0x1e, 0x08, 0x08, 0x07,
-    0x08, 0x17, 0x08, 0x06, 0x13, 0x35, 0x1c, 0x1c, 0x2e, 0x17, 0x0f, 0x1b,
-    0x1e, 0x0a, 0x03, 0x00, 0x0a, 0x0f, 0x1e, 0x18, 0x0a, 0x17, 0x18, 0x0a,
-    0x13, 0x28, 0x1e, 0x11, 0x06, 0x0a, 0x0a, 0x0a, 0x0a, 0x1e, 0x11, 0x08,
-    0x17, 0x1e, 0x08, 0x00, 0x00, 0x07, 0x07, 0x03, 0x37, 0x0c, 0x02, 0x02,
-    0x02, 0x0a, 0x0f, 0x00, 0x00, 0x00, 0x17, 0x35, 0x17, 0x1b, 0x1e, 0x08,
-    0x08, 0x0a, 0x08, 0x17, 0x40, 0x1e, 0x14, 0x61, 0x4b, 0x1e, 0x08, 0x0d,
-    0x1e, 0x0c, 0x06, 0x08, 0x1e, 0x4b, 0x0f, 0x07, 0x14, 0x0b, 0x18, 0x1d,
-    0x08, 0x11, 0x28, 0x38, 0x0a, 0x0e, 0x1e, 0x1d, 0x25, 0x31, 0x11, 0x12,
-    0x0d, 0x00, 0x08, 0x0d, 0x09, 0x0e, 0x11, 0x11, 0x12, 0x5f, 0x3c, 0x1d,
-    0x44, 0x31, 0x0a, 0x12, 0x1e, 0x3c, 0x36, 0x67, 0x3a, 0x11, 0x12, 0x1d,
-    0x12, 0x2f, 0x12, 0x28, 0x06, 0x1d, 0x58, 0x58, 0x5d, 0x58, 0x3a, 0x1a,
-    0x2f, 0x2f, 0x33, 0x75, 0x75, 0x3a, 0x85, 0x97, 0x6c, 0x32, 0x48, 0x4d,
-    0x1f, 0x28, 0x26, 0x4d, 0x72, 0x53, 0x28, 0x58, 0x48, 0x48, 0x5b, 0x32,
-    0x33, 0x5d, 0x85, 0x5b, 0x3a, 0x3a, 0x48, 0x6c, 0x4e, 0x45, 0x56, 0x48,
-    0x34, 0x3e, 0x2f, 0x20, 0x1f, 0x27, 0x3a, 0x3a, 0x89, 0x9a, 0x56, 0x56,
-    0x78, 0x45, 0x34, 0x48, 0x5b, 0x5d, 0x5e, 0x78, 0x48, 0x2f, 0x56, 0x48,
-    0x56, 0x48, 0x3e, 0x2f, 0x1d, 0x5d, 0x70, 0x7f, 0x70, 0x60, 0x5b, 0x4d,
-    0x4e, 0x56, 0x78, 0xa0, 0x60, 0x78, 0xa7, 0x85, 0x5b, 0x51, 0x56, 0x3a,
-    0x28, 0x33, 0x33, 0x75, 0x63, 0x26, 0x33, 0x5d, 0x3a, 0x58, 0x34, 0x2f,
-    0x3e, 0x6c, 0x6c, 0x3a, 0x2f, 0x58, 0x48, 0x5b, 0x3e, 0x34, 0x58, 0x27,
-    0x32, 0x1a, 0x0d, 0x0d, 0x12, 0x20, 0x1d, 0x43, 0x63, 0x47, 0x2f, 0x66,
-    0x47, 0x14, 0x18, 0x27, 0x3c, 0x2f, 0x5f, 0x3c, 0x11, 0x1d, 0x12, 0x12,
-    0x1d, 0x14, 0x1e, 0x07, 0x2e, 0x4f, 0x4f, 0x40, 0x44, 0x31, 0x11, 0x18,
-    0x11, 0x28, 0x61, 0x40, 0x28, 0x5f, 0x61, 0x31, 0x0e, 0x11, 0x28, 0x08,
-    0x08, 0x04, 0x1d, 0x2e, 0x17, 0x07, 0x0e, 0x0d, 0x1e, 0x18, 0x0a, 0x0e,
-    0x1e, 0x1b, 0x07, 0x02, 0x0f, 0x13, 0x06, 0x13, 0x0e, 0x08, 0x00, 0x00,
-    0x02, 0x08, 0x0c, 0x03, 0x08, 0x02, 0x08, 0x2b, 0x2e, 0x17, 0x1e, 0x14,
-    0x00, 0x00, 0x00, 0x0a, 0x00, 0x1c, 0x2b, 0x05, 0x02, 0x02, 0x08, 0x17,
-    0x07, 0x00, 0x00, 0x07, 0x1e, 0x1c, 0x1c, 0x1c, 0x14, 0x08, 0x0a, 0x08,
-    0x07, 0x35, 0x35, 0x11, 0x37, 0x4f, 0x37, 0x06, 0x18, 0x1e, 0x11, 0x1e,
-    0x11, 0x08, 0x00, 0x00, 0x08, 0x13, 0x1c, 0x21, 0x0c, 0x0f, 0x0f, 0x08,
-    0x0f, 0x0a, 0x0a, 0x0f, 0x00, 0x08, 0x1e, 0x0f, 0x02, 0x17, 0x0a, 0x07,
-    0x03, 0x03, 0x17, 0x11, 0x00, 0x0e, 0x0f, 0x11, 0x1e, 0x0c, 0x08, 0x25,
-    0x37, 0x08, 0x05, 0x03, 0x08, 0x1d, 0x06, 0x00, 0x18, 0x14, 0x11, 0x2e,
-    0x38, 0x0e, 0x04, 0x1d, 0x14, 0x11, 0x0d, 0x06, 0x0d, 0x25, 0x28, 0x31,
-    0x4c, 0x4c, 0x4c, 0x1e, 0x09, 0x1d, 0x2e, 0x47, 0x3c, 0x12, 0x2d, 0x47,
-    0x3c, 0x0d, 0x1d, 0x26, 0x28, 0x47, 0x4f, 0x3c, 0x18, 0x1d, 0x12, 0x12,
-    0x5f, 0x31, 0x3c, 0x2f, 0x1a, 0x3a, 0x3a, 0x26, 0x52, 0x3a, 0x28, 0x26,
-    0x27, 0x58, 0x58, 0x36, 0x26, 0x66, 0x58, 0x58, 0x3a, 0x27, 0x56, 0x6c,
-    0x3a, 0x0d, 0x15, 0x2f, 0x5d, 0x5e, 0x26, 0x27, 0x5d, 0x5d, 0x66, 0x85,
-    0x66, 0x2f, 0x43, 0x66, 0x3e, 0x58, 0x4e, 0x45, 0x45, 0x78, 0x70, 0x78,
-    0x6c, 0x85, 0x78, 0x34, 0x3e, 0x5d, 0x5b, 0x70, 0x56, 0x4e, 0x60, 0x70,
-    0x48, 0x34, 0x56, 0x50, 0x4e, 0x5b, 0x5d, 0x58, 0x3e, 0x3e, 0x27, 0x75,
-    0x78, 0x56, 0x4e, 0x45, 0x50, 0x4e, 0x48, 0x48, 0x56, 0x48, 0x3e, 0x48,
-    0x56, 0x75, 0x56, 0x2f, 0x58, 0x6a, 0x63, 0x66, 0x33, 0x3e, 0x78, 0x5d,
-    0x12, 0x1d, 0x33, 0x5b, 0x78, 0x33, 0x28, 0x3e, 0x56, 0x58, 0x75, 0x75,
-    0x3a, 0x36, 0x34, 0x3a, 0x33, 0x3a, 0x3e, 0x2f, 0x3e, 0x5d, 0x66, 0x58,
-    0x63, 0x58, 0x36, 0x28, 0x47, 0x3c, 0x47, 0x28, 0x31, 0x44, 0x47, 0x1f,
-    0x0d, 0x1d, 0x3c, 0x33, 0x38, 0x44, 0x20, 0x14, 0x1d, 0x0a, 0x1e, 0x3a,
-    0x1a, 0x2e, 0x14, 0x11, 0x31, 0x1e, 0x0a, 0x38, 0x31, 0x0f, 0x0a, 0x0e,
-    0x3d, 0x37, 0x06, 0x08, 0x31, 0x37, 0x3d, 0x0a, 0x09, 0x25, 0x20, 0x06,
-    0x00, 0x00, 0x04, 0x1d, 0x0e, 0x01, 0x0d, 0x17, 0x0c, 0x1c, 0x1c, 0x0f,
-    0x0f, 0x07, 0x0e, 0x0a, 0x0a, 0x00, 0x08, 0x0a, 0x11, 0x1e, 0x1c, 0x25,
-    0x2b, 0x0a, 0x00, 0x0e, 0x11, 0x13, 0x1c, 0x0f, 0x17, 0x17, 0x08, 0x02,
-    0x00, 0x08, 0x0f, 0x17, 0x21, 0x1c, 0x0c, 0x0f, 0x0a, 0x07, 0x13, 0x08,
-    0x0c, 0x03, 0x03, 0x0e, 0x1b, 0x03, 0x0a, 0x17, 0x0f, 0x0f, 0x00, 0x0a,
-    0x2b, 0x07, 0x00, 0x04, 0x00, 0x0f, 0x1e, 0x11, 0x0a, 0x1e, 0x17, 0x11,
-    0x11, 0x11, 0x40, 0x4b, 0x2b, 0x07, 0x03, 0x0a, 0x0d, 0x0f, 0x14, 0x18,
-    0x00, 0x0a, 0x0f, 0x0c, 0x2e, 0x2e, 0x1e, 0x07, 0x0a, 0x14, 0x07, 0x00,
-    0x1e, 0x1e, 0x04, 0x0e, 0x28, 0x0d, 0x13, 0x1c, 0x1c, 0x1e, 0x4f, 0x44,
-    0x08, 0x08, 0x08, 0x0e, 0x08, 0x03, 0x06, 0x08, 0x25, 0x26, 0x17, 0x13,
-    0x1e, 0x25, 0x0a, 0x06, 0x14, 0x47, 0x52, 0x4f, 0x38, 0x11, 0x10, 0x28,
-    0x28, 0x14, 0x12, 0x12, 0x12, 0x36, 0x52, 0x28, 0x31, 0x36, 0x5f, 0x44,
-    0x47, 0x8a, 0x6d, 0x67, 0x47, 0x1e, 0x3c, 0x47, 0x47, 0x38, 0x58, 0x2d,
-    0x26, 0x3a, 0x2d, 0x58, 0x89, 0x75, 0x2f, 0x26, 0x58, 0x36, 0x11, 0x3c,
-    0x66, 0x3a, 0x33, 0x58, 0x60, 0x56, 0x47, 0x47, 0x43, 0x93, 0xa0, 0x48,
-    0x1d, 0x3c, 0x3e, 0x48, 0x3a, 0x1a, 0x12, 0x3a, 0x85, 0x5d, 0x3e, 0x58,
-    0x6c, 0x5d, 0x34, 0x48, 0x78, 0x85, 0x78, 0x78, 0x51, 0x4d, 0x5d, 0x5d,
-    0x3e, 0x34, 0x4d, 0x3e, 0x60, 0x78, 0x5b, 0x5b, 0x5b, 0x78, 0x78, 0x4e,
-    0x86, 0x93, 0x85, 0x85, 0x3a, 0x58, 0x6a, 0x5d, 0x56, 0x8a, 0x75, 0x34,
-    0x5d, 0x56, 0x66, 0x8a, 0xa0, 0x72, 0x3a, 0x56, 0x6a, 0x27, 0x26, 0x6a,
-    0x5d, 0x2f, 0x56, 0x79, 0x60, 0x43, 0x4c, 0x43, 0x70, 0x99, 0x70, 0x36,
-    0x1f, 0x3a, 0x58, 0x3a, 0x26, 0x12, 0x26, 0x63, 0x56, 0x33, 0x27, 0x3a,
-    0x58, 0x27, 0x26, 0x43, 0x6a, 0x66, 0x5f, 0x52, 0x28, 0x1f, 0x43, 0x27,
-    0x12, 0x12, 0x10, 0x26, 0x5f, 0x52, 0x38, 0x36, 0x5f, 0x58, 0x38, 0x47,
-    0x72, 0x5f, 0x4f, 0x28, 0x0e, 0x33, 0x2d, 0x1d, 0x36, 0x4f, 0x0d, 0x12,
-    0x28, 0x1d, 0x52, 0x67, 0x61, 0x1e, 0x11, 0x2b, 0x1e, 0x08, 0x18, 0x2d,
-    0x11, 0x0a, 0x31, 0x20, 0x13, 0x17, 0x17, 0x1e, 0x4c, 0x39, 0x06, 0x03,
-    0x07, 0x0e, 0x08, 0x00, 0x08, 0x00, 0x11, 0x2e, 0x0c, 0x08, 0x0a, 0x0e,
-    0x0a, 0x08, 0x11, 0x1e, 0x25, 0x28, 0x17, 0x08, 0x00, 0x1e, 0x11, 0x00,
-    0x08, 0x00, 0x08, 0x1e, 0x11, 0x0e, 0x0e, 0x11, 0x14, 0x11, 0x11, 0x1e,
-    0x4b, 0x35, 0x17, 0x05, 0x07, 0x11, 0x14, 0x0a, 0x2b, 0x0f, 0x08, 0x18,
-    0x08, 0x18, 0x35, 0x2e, 0x07, 0x07, 0x11, 0x0a, 0x00, 0x07, 0x18, 0x08,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x2c, 0x30, 0x30, 0x2c, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2c, 0x30, 0x30, 0x2c, 0x2c, 0x30, 0x30, 0x2c, 0x2c, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x2c, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x2c, 0x30, 0x30, 0x2a, 0x30, 0x2c, 0x2c, 0x30, 0x30, 0x30, 0x2c, 0x30,
-    0x30, 0x30, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x30, 0x30,
-    0x2c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2a, 0x2c, 0x2c, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x30, 0x2c, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x2c, 0x2a, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x2c,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x2c, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x2c, 0x2c, 0x30, 0x30, 0x2c, 0x2c, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2c, 0x2c, 0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x2c,
-    0x2c, 0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x2c, 0x2c, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x30, 0x2c, 0x2c, 0x30, 0x30, 0x2c,
-    0x2c, 0x30, 0x30, 0x2c, 0x2c, 0x2c, 0x30, 0x2c, 0x30, 0x30, 0x2c, 0x30,
-    0x30, 0x30, 0x30, 0x2c, 0x30, 0x30, 0x2c, 0x2a, 0x30, 0x2c, 0x2c, 0x30,
-    0x30, 0x2c, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x30, 0x2c, 0x2c, 0x30,
-    0x2c, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x2c, 0x2c, 0x2c, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x2c, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x2c, 0x30, 0x2c, 0x2c, 0x30, 0x30,
-    0x30, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x30, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe9, 0xe6,
-    0xe6, 0xe6, 0xe5, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5,
-    0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6,
-    0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe5, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe8,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5,
-    0xe6, 0xe9, 0xe5, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe5, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe5, 0xe6, 0x30, 0x30, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe9,
-    0xe5, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe8, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe8, 0xe5, 0xe6, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8,
-    0xe6, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0x2c,
-    0x30, 0xe6, 0xe6, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2,
-    0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3,
-    0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3,
-    0xf3, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2,
-    0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2,
-    0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf6, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3,
-    0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf2, 0xf3, 0xf3, 0xe6, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe9, 0xfc,
-    0xfc, 0xfb, 0xfb, 0xfd, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb,
-    0xfc, 0xfd, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc,
-    0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfd, 0xfb, 0xfc, 0xfb, 0xfb,
-    0xfd, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb,
-    0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfd,
-    0xfd, 0xfb, 0xfc, 0xfd, 0xfd, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfd, 0xfc,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb,
-    0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfc, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xfc,
-    0xfc, 0xfb, 0xfd, 0xfb, 0xfc, 0xfb, 0xfc, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc,
-    0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb,
-    0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xfb, 0xfc,
-    0xfc, 0xfb, 0xfc, 0xfb, 0xfb, 0xfd, 0xfb, 0xfc, 0xfd, 0xfc, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfc, 0xfb, 0xfb, 0xfd, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfd,
-    0xe9, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xfd, 0xfb, 0xfb, 0xfc, 0xfc,
-    0xfc, 0xfb, 0xfb, 0xfd, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb,
-    0xfc, 0xfc, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb,
-    0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb,
-    0xfd, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfd, 0xfc, 0xfb, 0xfc,
-    0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc,
-    0xfc, 0xfd, 0xfc, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfd, 0xfb,
-    0xfb, 0xfc, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfc, 0xfb,
-    0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfc, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb,
-    0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb,
-    0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfc,
-    0xfb, 0xfd, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfc, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfc, 0xfb, 0xfd, 0xfc,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc,
-    0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfd, 0xfc,
-    0xfb, 0xfb, 0xfd, 0xfc, 0xfc, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfc, 0xfc,
-    0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb,
-    0xfb, 0xfc, 0xfc, 0xfb, 0xfd, 0xfb, 0xfb, 0xfc, 0xe9, 0xe8, 0xe6, 0x30,
-    0x30, 0xe6, 0xe6, 0xfb, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfd, 0xfb, 0xfc, 0xfc, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfd, 0xfd, 0xfb,
-    0xfc, 0xfb, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc,
-    0xfb, 0xfd, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfd,
-    0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd,
-    0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfd, 0xfb, 0xfd, 0xfb,
-    0xfd, 0xfd, 0xfc, 0xfc, 0xfd, 0xfc, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfc,
-    0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xfc, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc,
-    0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfd, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc,
-    0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb,
-    0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfc, 0xfb, 0xfd, 0xfb, 0xfc, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfb, 0xfc, 0xfb, 0xfb, 0xe9, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xfb,
-    0xfc, 0xfd, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfd, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfd, 0xfc, 0xfd, 0xfb, 0xfb, 0xfc,
-    0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfc, 0xfd, 0xfc, 0xfc, 0xfd, 0xfb, 0xfc,
-    0xfb, 0xfc, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfc,
-    0xfb, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfd, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfc,
-    0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfc, 0xfb,
-    0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb,
-    0xfc, 0xfc, 0xfb, 0xfc, 0xfd, 0xfb, 0xfb, 0xfc, 0xfb, 0xfd, 0xfc, 0xfb,
-    0xfb, 0xfc, 0xfc, 0xfb, 0xfd, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfc,
-    0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfd, 0xfd,
-    0xfb, 0xfb, 0xfd, 0xfd, 0xfc, 0xfd, 0xfb, 0xfb, 0xfd, 0xfb, 0xfc, 0xfb,
-    0xfd, 0xfb, 0xfb, 0xfb, 0xfd, 0xfc, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb,
-    0xeb, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xef, 0xcc, 0xa3,
-    0xa3, 0xa3, 0xe1, 0xf5, 0xfb, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xef, 0xd1,
-    0xa3, 0xa3, 0xb9, 0xd6, 0xf7, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xee,
-    0xd1, 0xd6, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xd6, 0xd6,
-    0xf4, 0xfb, 0xfb, 0xfb, 0xd6, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd6, 0xf5,
-    0xfb, 0xfb, 0xe1, 0xd6, 0xef, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb,
-    0xe1, 0xc7, 0xa3, 0xa3, 0xb9, 0xd6, 0xef, 0xfb, 0xfb, 0xfc, 0xfc, 0xef,
-    0xd6, 0xe1, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xe1, 0xd6, 0xef,
-    0xfb, 0xfb, 0xfb, 0xe1, 0xd1, 0xd6, 0xd6, 0xd6, 0xea, 0xf4, 0xfb, 0xfb,
-    0xfb, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xf5, 0xd1, 0xd1, 0xfa, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xef, 0xd1, 0xd1, 0xd6, 0xd1, 0xd6, 0xd6, 0xd6, 0xd1,
-    0xd6, 0xfb, 0xfb, 0xfb, 0xd6, 0xd1, 0xf5, 0xfb, 0xfb, 0xfc, 0xfa, 0xfb,
-    0xfb, 0xf4, 0xd6, 0xa3, 0xa3, 0xb9, 0xd6, 0xfa, 0xfb, 0xfc, 0xfa, 0xfc,
-    0xfc, 0xfb, 0xe1, 0xd6, 0xd6, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb,
-    0xf5, 0xd6, 0xd6, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xe9, 0xe6, 0xe6, 0x30,
-    0x30, 0xe6, 0xe6, 0xfa, 0xfc, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfc, 0xf8, 0xfa, 0xf4, 0xa3, 0x24, 0x22, 0x22, 0x22, 0x22, 0x24, 0x22,
-    0xfa, 0xfa, 0xfc, 0xfa, 0xf5, 0xa3, 0x22, 0x24, 0x22, 0x22, 0x22, 0x24,
-    0x42, 0xe1, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xd6, 0x22, 0x22, 0xa3, 0xfc,
-    0xf8, 0xfa, 0xf8, 0xfa, 0xfa, 0xf8, 0x24, 0x24, 0xee, 0xf8, 0xfa, 0xf8,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x22, 0x24, 0xee, 0xfa, 0xf8, 0xa3, 0x24,
-    0xd6, 0xf8, 0xfa, 0xfa, 0xfa, 0xfa, 0xea, 0x42, 0x22, 0x24, 0x22, 0x24,
-    0x22, 0x24, 0x24, 0xa3, 0xfc, 0xfa, 0xfa, 0xd6, 0x24, 0xa3, 0xf8, 0xfa,
-    0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xa3, 0x22, 0xd6, 0xfa, 0xfc, 0xfa, 0xa3,
-    0x24, 0x24, 0x24, 0x22, 0x24, 0x24, 0xb9, 0xf5, 0xfa, 0xfc, 0xfc, 0xfa,
-    0xfc, 0xf8, 0xd6, 0x22, 0x22, 0xd6, 0xfa, 0xfa, 0xfa, 0xfa, 0xf8, 0xd6,
-    0x24, 0x22, 0x24, 0x22, 0x24, 0x22, 0x22, 0x22, 0x22, 0xfc, 0xfa, 0xfa,
-    0x22, 0x22, 0xef, 0xfc, 0xfa, 0xf8, 0xfa, 0xf7, 0xa3, 0x24, 0x22, 0x22,
-    0x24, 0x22, 0x22, 0x42, 0xe1, 0xfa, 0xfc, 0xfa, 0xfa, 0xf8, 0xa3, 0x22,
-    0x24, 0xd1, 0xfa, 0xfa, 0xfa, 0xfc, 0xfa, 0xfa, 0xef, 0x22, 0x24, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfc, 0xfa, 0xfa, 0xe9, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf3, 0x42,
-    0x24, 0x8f, 0xef, 0xfe, 0xfe, 0xfa, 0xea, 0x8f, 0xfa, 0xf8, 0xf8, 0xf8,
-    0x71, 0x22, 0x42, 0xea, 0xfe, 0xfe, 0xfd, 0xe1, 0x22, 0x24, 0xe4, 0xf8,
-    0xf8, 0xfa, 0xf8, 0xd6, 0x24, 0x22, 0x24, 0xd6, 0xfa, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0x24, 0x24, 0xef, 0xf8, 0xfa, 0xf8, 0x22, 0x22, 0xea, 0xf5,
-    0xf5, 0xf5, 0xf5, 0xfa, 0xf8, 0xf8, 0xa3, 0x22, 0xd6, 0xf8, 0xf8, 0xf8,
-    0xfa, 0xd6, 0x22, 0x22, 0xcc, 0xfa, 0xfe, 0xfe, 0xfd, 0xe1, 0x71, 0x22,
-    0xfa, 0xf8, 0xf8, 0xd6, 0x24, 0xa3, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xa3, 0x22, 0xd6, 0xf8, 0xf8, 0xf8, 0xa3, 0x22, 0xcc, 0xf5, 0xf5,
-    0xd6, 0x42, 0x22, 0xc7, 0xf8, 0xf8, 0xfa, 0xf8, 0xf8, 0xf8, 0x71, 0x22,
-    0x24, 0x7e, 0xf8, 0xfa, 0xf8, 0xf8, 0xf8, 0xf5, 0xf5, 0xf5, 0xf5, 0x8f,
-    0x22, 0xcc, 0xf5, 0xf5, 0xf5, 0xfa, 0xf8, 0xf8, 0x22, 0x24, 0xef, 0xf8,
-    0xf8, 0xf8, 0xfa, 0x71, 0x24, 0x42, 0xea, 0xfe, 0xfe, 0xfc, 0xe1, 0x22,
-    0x24, 0xe4, 0xfa, 0xf8, 0xf8, 0xf8, 0xa3, 0x24, 0x22, 0x22, 0xef, 0xf8,
-    0xf8, 0xfa, 0xf8, 0xf8, 0xef, 0x24, 0x24, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xe9, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x71, 0x22, 0xa3, 0xfe, 0xfb, 0xf7,
-    0xf7, 0xfc, 0xfc, 0xfe, 0xf7, 0xf7, 0xf7, 0xcc, 0x24, 0x42, 0xf5, 0xfb,
-    0xf7, 0xf7, 0xf8, 0xfc, 0xe1, 0x22, 0x42, 0xef, 0xf7, 0xf7, 0xf7, 0xd6,
-    0x24, 0x42, 0x24, 0x22, 0xef, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x22, 0x24,
-    0xef, 0xf7, 0xf7, 0xf7, 0x22, 0x24, 0xef, 0xfa, 0xfa, 0xf8, 0xfb, 0xf8,
-    0xf7, 0xf7, 0xa3, 0x22, 0xd6, 0xf7, 0xf7, 0xf7, 0xea, 0x22, 0x24, 0xef,
-    0xfe, 0xfa, 0xf7, 0xf7, 0xf8, 0xfc, 0xfe, 0xea, 0xf7, 0xf7, 0xf7, 0xd6,
-    0x22, 0xa3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xa3, 0x22, 0xd6,
-    0xf7, 0xf7, 0xf7, 0xa3, 0x24, 0xd1, 0xfa, 0xfa, 0xfc, 0xea, 0x24, 0x42,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xea, 0x24, 0xa3, 0x7e, 0x24, 0xee, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xfa, 0xfa, 0xfa, 0xfa, 0xa3, 0x22, 0xd1, 0xf8, 0xfb,
-    0xfc, 0xf7, 0xf7, 0xf7, 0x22, 0x24, 0xef, 0xf7, 0xf7, 0xf7, 0xcc, 0x24,
-    0x42, 0xf7, 0xfb, 0xf8, 0xf7, 0xf8, 0xfd, 0xe1, 0x22, 0x42, 0xf4, 0xf7,
-    0xf7, 0xf7, 0xa3, 0x24, 0x42, 0x22, 0x42, 0xf4, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xef, 0x24, 0x24, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xe9, 0xe6, 0xe6, 0x30,
-    0x30, 0xe6, 0xe6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf7, 0xe4, 0x24, 0x42, 0xfb, 0xf7, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf6, 0xf6, 0xf6, 0x42, 0x22, 0xe1, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6,
-    0xfb, 0x7e, 0x22, 0xcc, 0xf6, 0xf6, 0xf7, 0xd6, 0x22, 0xa3, 0xb9, 0x22,
-    0x7e, 0xf3, 0xf6, 0xf7, 0xf7, 0xf7, 0x22, 0x22, 0xea, 0xf7, 0xf6, 0xf6,
-    0x24, 0x22, 0xea, 0xf7, 0xf7, 0xf6, 0xf6, 0xf7, 0xf6, 0xf6, 0xa3, 0x22,
-    0xd1, 0xf6, 0xf7, 0xf6, 0x42, 0x24, 0xd6, 0xfb, 0xf7, 0xf6, 0xf7, 0xf6,
-    0xf7, 0xf6, 0xf6, 0xfb, 0xf6, 0xf6, 0xf6, 0xd6, 0x22, 0xa3, 0xf7, 0xf6,
-    0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xa3, 0x22, 0xd6, 0xf6, 0xf7, 0xf6, 0xa3,
-    0x24, 0xd6, 0xf7, 0xf7, 0xf7, 0xee, 0x22, 0x24, 0xf6, 0xf7, 0xf7, 0xf6,
-    0xf6, 0xb9, 0x24, 0xe1, 0xd1, 0x22, 0xb9, 0xf7, 0xf6, 0xf7, 0xf7, 0xf6,
-    0xf7, 0xf7, 0xf7, 0xa3, 0x24, 0xd6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xf6,
-    0x22, 0x22, 0xea, 0xf6, 0xf7, 0xf7, 0x42, 0x24, 0xe1, 0xfa, 0xf6, 0xf6,
-    0xf7, 0xf7, 0xf6, 0xfb, 0x71, 0x22, 0xcc, 0xf6, 0xf6, 0xf6, 0xa3, 0x22,
-    0xd1, 0x7e, 0x22, 0xa3, 0xf6, 0xf6, 0xf7, 0xf7, 0xea, 0x22, 0x22, 0xf7,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf7, 0xf6, 0xe9, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xa3, 0x22, 0xc7,
-    0xf7, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xe4, 0x24,
-    0x24, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xd6, 0x24, 0xa3,
-    0xf3, 0xf3, 0xf3, 0xd6, 0x24, 0xa3, 0xfd, 0x42, 0x22, 0xb9, 0xf3, 0xf3,
-    0xf2, 0xf4, 0x24, 0x24, 0xea, 0xf3, 0xf3, 0xf3, 0x24, 0x22, 0xea, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xa3, 0x24, 0xd6, 0xf3, 0xf3, 0xec,
-    0x24, 0x22, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2,
-    0xf3, 0xf3, 0xf3, 0xd6, 0x24, 0xa3, 0xf4, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xa3, 0x24, 0xd6, 0xf3, 0xf3, 0xf3, 0xa3, 0x22, 0xd6, 0xf3, 0xf3,
-    0xf3, 0xb9, 0x22, 0x7e, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0x22, 0x22, 0xf7,
-    0xf5, 0x24, 0x42, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xa3,
-    0x24, 0xd6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x24, 0x22, 0xea, 0xf3,
-    0xf3, 0xe4, 0x22, 0x24, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3,
-    0xd6, 0x24, 0xa3, 0xf3, 0xf3, 0xf3, 0xa3, 0x22, 0xd6, 0xf5, 0x22, 0x22,
-    0xd1, 0xf3, 0xf3, 0xf3, 0xea, 0x24, 0x24, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xe9, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0x42, 0x22, 0xe1, 0xf3, 0xf3, 0xf3, 0xf2,
-    0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xd1, 0x22, 0xa3, 0xf4, 0xf3, 0xf2,
-    0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0x24, 0x22, 0xf2, 0xf2, 0xf2, 0xd6,
-    0x24, 0xa3, 0xf3, 0xef, 0x24, 0x22, 0xe4, 0xf3, 0xf2, 0xf3, 0x24, 0x22,
-    0xea, 0xf2, 0xf2, 0xf3, 0x22, 0x24, 0xd1, 0xe4, 0xe4, 0xe4, 0xe4, 0xf1,
-    0xf3, 0xf2, 0xa3, 0x24, 0xd1, 0xf3, 0xf2, 0xd1, 0x24, 0x7e, 0xf3, 0xf2,
-    0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xd6,
-    0x22, 0xa3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xa3, 0x24, 0xd1,
-    0xf3, 0xf3, 0xf2, 0xa3, 0x22, 0xc7, 0xe3, 0xe4, 0xb9, 0x24, 0x24, 0xf5,
-    0xf3, 0xf3, 0xf2, 0xf2, 0xd1, 0x24, 0xb9, 0xf3, 0xf7, 0x7e, 0x22, 0xd1,
-    0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xa3, 0x24, 0xd1, 0xf2, 0xf3,
-    0xf2, 0xf3, 0xf2, 0xf2, 0x22, 0x24, 0xea, 0xf3, 0xf2, 0xd1, 0x22, 0x7e,
-    0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xef, 0x22, 0x24, 0xf2,
-    0xf2, 0xf3, 0xa3, 0x24, 0xd1, 0xf7, 0xd6, 0x24, 0x42, 0xee, 0xf2, 0xf2,
-    0xea, 0x24, 0x22, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xe9, 0xe6, 0xe6, 0x30,
-    0x30, 0xe6, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0x24, 0x24, 0xec, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xd1, 0x22, 0xa3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xe4, 0x24, 0x22, 0xf1, 0xf1, 0xf1, 0xd1, 0x22, 0xa3, 0xf1, 0xf6,
-    0xd6, 0x22, 0x42, 0xec, 0xf1, 0xf1, 0x22, 0x22, 0xea, 0xf1, 0xf1, 0xf1,
-    0x22, 0x22, 0x24, 0x22, 0x24, 0x24, 0x24, 0xe4, 0xf1, 0xf1, 0xa3, 0x22,
-    0xd1, 0xf1, 0xf1, 0xd1, 0x22, 0xa3, 0xf1, 0xf3, 0xf1, 0xf1, 0xec, 0xe3,
-    0xe4, 0xe4, 0xe4, 0xe4, 0xf1, 0xf1, 0xf1, 0xd6, 0x24, 0xa3, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xa3, 0x24, 0xd1, 0xf1, 0xf1, 0xf1, 0xa3,
-    0x22, 0x22, 0x24, 0x22, 0x24, 0x7e, 0xf5, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1,
-    0x71, 0x24, 0xe1, 0xf1, 0xf1, 0xe1, 0x24, 0x71, 0xf1, 0xf1, 0xf1, 0xee,
-    0xf1, 0xf1, 0xf1, 0xa3, 0x24, 0xd1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0x22, 0x24, 0xe4, 0xf1, 0xf1, 0xd1, 0x24, 0xa3, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xe4, 0x22, 0x24, 0xf1, 0xf1, 0xf1, 0xa3, 0x24,
-    0xd1, 0xf1, 0xfb, 0x7e, 0x24, 0x71, 0xf1, 0xf1, 0xe4, 0x22, 0x22, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xe6, 0xe6, 0x2c, 0x30, 0xe6, 0xe6, 0xf1,
-    0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0x24, 0x24, 0xe4,
-    0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf1, 0xf0, 0xd1, 0x24,
-    0xa3, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xf0, 0xf1, 0xe4, 0x24, 0x22,
-    0xf1, 0xf0, 0xf0, 0xd1, 0x22, 0xa3, 0xf0, 0xf1, 0xfb, 0x7e, 0x24, 0x7e,
-    0xf1, 0xf0, 0x22, 0x22, 0xe4, 0xf0, 0xf1, 0xf0, 0x22, 0x22, 0xc7, 0xe1,
-    0xe1, 0xe1, 0xe1, 0xee, 0xf1, 0xf1, 0xa3, 0x22, 0xd1, 0xf1, 0xf1, 0xd1,
-    0x22, 0xa3, 0xf1, 0xf0, 0xf1, 0xf1, 0xc9, 0x22, 0x24, 0x22, 0x22, 0x24,
-    0xf0, 0xf1, 0xf0, 0xd1, 0x24, 0xa3, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf1,
-    0xf1, 0xa3, 0x24, 0xd1, 0xf0, 0xf1, 0xf0, 0xa3, 0x24, 0xa3, 0xc7, 0x24,
-    0x71, 0xfd, 0xf6, 0xf1, 0xf0, 0xf0, 0xf0, 0xe4, 0x24, 0x42, 0xf6, 0xf1,
-    0xf0, 0xf4, 0x24, 0x22, 0xe4, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xa3,
-    0x24, 0xd1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0x22, 0x22, 0xe4, 0xf1,
-    0xf0, 0xd1, 0x22, 0xa3, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf0, 0xf0, 0xf1,
-    0xe4, 0x24, 0x24, 0xf0, 0xf0, 0xf1, 0xa3, 0x24, 0xd1, 0xf0, 0xf0, 0xfa,
-    0x42, 0x22, 0xb9, 0xf1, 0xe4, 0x22, 0x22, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1,
-    0xe6, 0xe6, 0xe6, 0x2c, 0x30, 0xe6, 0xe6, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0x71, 0x22, 0xd1, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe4, 0x24, 0x42, 0xed, 0xed, 0xed,
-    0xed, 0xf1, 0xed, 0xed, 0xed, 0xd1, 0x24, 0x7e, 0xed, 0xed, 0xed, 0xd1,
-    0x22, 0xa3, 0xed, 0xed, 0xed, 0xf5, 0x42, 0x24, 0xb9, 0xed, 0x22, 0x22,
-    0xe4, 0xed, 0xed, 0xed, 0x24, 0x24, 0xee, 0xf8, 0xf8, 0xf8, 0xf8, 0xf1,
-    0xed, 0xed, 0xa3, 0x24, 0xd1, 0xed, 0xed, 0xe4, 0x24, 0x42, 0xed, 0xf0,
-    0xed, 0xed, 0xea, 0xe1, 0xe1, 0xc7, 0x24, 0x22, 0xed, 0xed, 0xed, 0xcc,
-    0x24, 0xa3, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xa3, 0x24, 0xd1,
-    0xed, 0xed, 0xed, 0xa3, 0x22, 0xd1, 0xfb, 0x71, 0x24, 0xc9, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xb9, 0x24, 0x24, 0x24, 0x22, 0x22, 0x22, 0x24, 0x24,
-    0xb9, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xa3, 0x24, 0xcc, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0x22, 0x22, 0xe4, 0xed, 0xed, 0xe4, 0x22, 0x42,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xd1, 0x24, 0x7e, 0xed,
-    0xed, 0xed, 0xa3, 0x22, 0xcc, 0xed, 0xf1, 0xf1, 0xea, 0x22, 0x22, 0xd8,
-    0xe4, 0x24, 0x24, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe6, 0xe6, 0xe6, 0x2c,
-    0x30, 0xe6, 0xe6, 0xec, 0xec, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xeb, 0xc7, 0x22, 0x7e, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xec, 0xec, 0xec,
-    0xeb, 0xec, 0xf1, 0x22, 0x24, 0xe4, 0xec, 0xec, 0xeb, 0xec, 0xec, 0xeb,
-    0xec, 0xb9, 0x22, 0xc7, 0xeb, 0xec, 0xeb, 0xcc, 0x24, 0xa3, 0xec, 0xec,
-    0xec, 0xf0, 0xe1, 0x22, 0x22, 0xe4, 0x24, 0x22, 0xe4, 0xec, 0xec, 0xec,
-    0x22, 0x24, 0xe4, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xec, 0xa3, 0x24,
-    0xcc, 0xeb, 0xec, 0xf1, 0x22, 0x22, 0xd8, 0xeb, 0xeb, 0xec, 0xf3, 0xf8,
-    0xf8, 0xee, 0x24, 0x22, 0xec, 0xec, 0xeb, 0xd6, 0x22, 0x71, 0xec, 0xeb,
-    0xec, 0xec, 0xec, 0xeb, 0xeb, 0x7e, 0x22, 0xd1, 0xec, 0xec, 0xec, 0xa3,
-    0x24, 0xcc, 0xec, 0xf5, 0x22, 0x22, 0xe4, 0xec, 0xec, 0xeb, 0xec, 0x42,
-    0x22, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x7e, 0x22, 0x42, 0xec, 0xec, 0xec,
-    0xeb, 0xeb, 0xec, 0xa3, 0x24, 0xcc, 0xeb, 0xeb, 0xec, 0xec, 0xec, 0xec,
-    0x24, 0x22, 0xe4, 0xec, 0xec, 0xf1, 0x22, 0x24, 0xe4, 0xec, 0xeb, 0xec,
-    0xeb, 0xec, 0xec, 0xec, 0xb9, 0x24, 0xc7, 0xec, 0xec, 0xeb, 0xa3, 0x22,
-    0xd1, 0xeb, 0xeb, 0xec, 0xf6, 0xb9, 0x22, 0x42, 0xe4, 0x22, 0x22, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xeb, 0xeb, 0xe6, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xef, 0x24, 0x22,
-    0xd8, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xed, 0xa3,
-    0x22, 0xa3, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe3, 0x22, 0x24, 0xee,
-    0xeb, 0xeb, 0xeb, 0xcc, 0x22, 0xa3, 0xeb, 0xeb, 0xeb, 0xeb, 0xf7, 0xb9,
-    0x22, 0x71, 0x24, 0x22, 0xe4, 0xeb, 0xeb, 0xeb, 0x22, 0x24, 0xe4, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xa3, 0x24, 0xcc, 0xeb, 0xeb, 0xed,
-    0xa3, 0x22, 0x7e, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe4, 0x22, 0x22,
-    0xeb, 0xeb, 0xeb, 0xee, 0x22, 0x22, 0xe3, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xe3, 0x24, 0x22, 0xee, 0xeb, 0xeb, 0xeb, 0xa3, 0x22, 0xcc, 0xeb, 0xf0,
-    0xb9, 0x24, 0x7e, 0xeb, 0xeb, 0xeb, 0xcc, 0x24, 0x71, 0xfb, 0xfb, 0xfc,
-    0xfb, 0xfb, 0xfb, 0x42, 0x24, 0xc9, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xa3,
-    0x24, 0xcc, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0x24, 0x22, 0xe4, 0xeb,
-    0xeb, 0xed, 0xa3, 0x24, 0xa3, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xeb, 0xe3,
-    0x24, 0x22, 0xee, 0xeb, 0xeb, 0xeb, 0xa3, 0x24, 0xcc, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xfa, 0x7e, 0x24, 0x7e, 0x24, 0x22, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xe6, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xe9, 0xe9, 0xe9, 0xe6, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf1, 0xcc, 0x24, 0x42, 0xd8, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe6, 0xd8, 0xe9, 0xe8, 0xe9, 0xef, 0x24, 0x24, 0xb5, 0xe6,
-    0xe9, 0xe6, 0xe6, 0xdd, 0x71, 0x22, 0xb9, 0xf1, 0xe9, 0xe9, 0xe9, 0xcc,
-    0x22, 0xa3, 0xe9, 0xe8, 0xe6, 0xe9, 0xe9, 0xf8, 0x7e, 0x22, 0x22, 0x24,
-    0xde, 0xe9, 0xe9, 0xe9, 0x24, 0x22, 0xe4, 0xe9, 0xe9, 0xe9, 0xe9, 0xe6,
-    0xe9, 0xe9, 0xa3, 0x24, 0xcc, 0xe6, 0xe9, 0xe9, 0xf4, 0x42, 0x24, 0xa3,
-    0xe3, 0xe9, 0xe9, 0xe9, 0xe9, 0xe4, 0x22, 0x22, 0xe9, 0xe9, 0xe9, 0xf0,
-    0x8f, 0x22, 0x71, 0xe3, 0xe9, 0xe9, 0xe9, 0xe3, 0x71, 0x24, 0xa3, 0xed,
-    0xe6, 0xe9, 0xe6, 0xa3, 0x24, 0xcc, 0xe9, 0xe9, 0xf5, 0x42, 0x22, 0xc9,
-    0xe9, 0xe8, 0x7e, 0x22, 0xd6, 0xe9, 0xe9, 0xe9, 0xe6, 0xe9, 0xe9, 0xc7,
-    0x22, 0x7e, 0xe9, 0xe9, 0xe9, 0xe6, 0xe9, 0xa3, 0x22, 0xcc, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0x24, 0x22, 0xe4, 0xe9, 0xe9, 0xe6, 0xef, 0x24,
-    0x22, 0xb9, 0xe9, 0xe6, 0xe9, 0xe8, 0xe3, 0x71, 0x24, 0xb9, 0xf1, 0xe9,
-    0xe8, 0xe6, 0xa3, 0x22, 0xcc, 0xe9, 0xe9, 0xe9, 0xe6, 0xeb, 0xf5, 0x22,
-    0x24, 0x24, 0x22, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0x30,
-    0x2c, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xf7, 0xa3, 0x22, 0x22, 0x71, 0xb9, 0xb5, 0xa3, 0x42, 0x24,
-    0xe6, 0xe6, 0xe6, 0xf0, 0xea, 0x24, 0x22, 0x42, 0xa3, 0xb7, 0x71, 0x24,
-    0x24, 0x7e, 0xf8, 0xe6, 0xe6, 0xe6, 0xe6, 0xcc, 0x24, 0xa3, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xf4, 0x24, 0x22, 0x24, 0xe4, 0xe6, 0xe6, 0xe6,
-    0x22, 0x22, 0xe4, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xa3, 0x24,
-    0xcc, 0xe6, 0xe6, 0xe6, 0xed, 0xef, 0x42, 0x24, 0x22, 0x7c, 0xb5, 0xb9,
-    0x7c, 0x42, 0x22, 0x24, 0xe6, 0xe9, 0xe6, 0xe6, 0xf4, 0x42, 0x24, 0x42,
-    0x9e, 0xb7, 0xa6, 0x42, 0x24, 0x42, 0xf4, 0xe6, 0xe6, 0xe6, 0xe6, 0xa3,
-    0x22, 0xcc, 0xe6, 0xe6, 0xeb, 0xd6, 0x22, 0x42, 0xdd, 0xdd, 0x22, 0x24,
-    0xee, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xee, 0x22, 0x24, 0xdd, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xa3, 0x22, 0xcc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0x24, 0x22, 0xe4, 0xe6, 0xe6, 0xe6, 0xf0, 0xea, 0x22, 0x24, 0x42, 0xa3,
-    0xb9, 0x7c, 0x22, 0x22, 0x7e, 0xf7, 0xe6, 0xe6, 0xe6, 0xe6, 0xa3, 0x24,
-    0xcc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xed, 0xe1, 0x22, 0x24, 0x24, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xfb,
-    0xef, 0x71, 0x22, 0x22, 0x22, 0x22, 0x42, 0xcc, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xf2, 0xf5, 0xa3, 0x22, 0x24, 0x22, 0x22, 0x42, 0xe1, 0xfc, 0xe6, 0xe8,
-    0xe6, 0xe6, 0xe6, 0xcc, 0x22, 0xa3, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xf1, 0xe1, 0x22, 0x22, 0xe4, 0xe6, 0xe6, 0xe6, 0x24, 0x24, 0xe4, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xa3, 0x22, 0xcc, 0xe6, 0xe9, 0xe6,
-    0xe6, 0xf1, 0xfa, 0xc7, 0x42, 0x22, 0x22, 0x24, 0x22, 0x42, 0xc7, 0xf5,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xed, 0xfd, 0xb9, 0x24, 0x24, 0x24, 0x22, 0x22,
-    0xc7, 0xfd, 0xed, 0xe6, 0xe6, 0xe6, 0xe6, 0xa3, 0x24, 0xcc, 0xe6, 0xe6,
-    0xe6, 0xf6, 0x7e, 0x24, 0x7e, 0xb9, 0x24, 0x7e, 0xeb, 0xe6, 0xe9, 0xe6,
-    0xe6, 0xe6, 0xe9, 0xeb, 0x7e, 0x24, 0xb9, 0xe6, 0xe6, 0xe6, 0xe6, 0xa3,
-    0x22, 0xcc, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x24, 0x22, 0xe4, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xf2, 0xf5, 0xa3, 0x22, 0x24, 0x22, 0x22, 0x42, 0xe1,
-    0xfd, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xa3, 0x22, 0xcc, 0xe6, 0xe9, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xf7, 0xa3, 0x24, 0x24, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe8, 0xe6, 0xf2, 0xfe, 0xfd, 0xf5,
-    0xf5, 0xfa, 0xfe, 0xf8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xf0, 0xfb, 0xfe,
-    0xf5, 0xf5, 0xfa, 0xfe, 0xf7, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xf6,
-    0xfe, 0xfb, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xf6, 0xfe, 0xfe,
-    0xf1, 0xe6, 0xe6, 0xe6, 0xfe, 0xfe, 0xf0, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xfb, 0xfe, 0xf7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xeb, 0xf8,
-    0xfe, 0xfa, 0xf5, 0xf5, 0xfd, 0xfe, 0xf8, 0xf0, 0xe6, 0xe9, 0xe6, 0xe6,
-    0xe6, 0xeb, 0xfb, 0xfe, 0xf5, 0xf5, 0xf5, 0xfe, 0xf8, 0xe9, 0xe6, 0xe9,
-    0xe6, 0xe6, 0xe6, 0xfb, 0xfe, 0xf7, 0xe6, 0xe6, 0xe6, 0xe6, 0xfc, 0xfe,
-    0xfc, 0xf7, 0xfe, 0xfb, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe5,
-    0xfb, 0xfe, 0xf6, 0xe6, 0xe5, 0xe6, 0xe6, 0xfb, 0xfe, 0xf6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xfe, 0xfe, 0xf0, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xf0, 0xfb, 0xfe, 0xf5, 0xf5, 0xfa, 0xfe, 0xf6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xfb, 0xfe, 0xf7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xfb, 0xfe, 0xfe, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x30,
-    0x30, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe8, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xeb, 0xf0, 0xf0, 0xed, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xf0, 0xf0, 0xed, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe5, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xed, 0xf0, 0xf0,
-    0xeb, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xf0, 0xf0, 0xf0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe9,
-    0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6,
-    0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xf0,
-    0xf0, 0xeb, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5,
-    0xe6, 0xe6, 0xe9, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe9, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe5, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe5, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe5, 0xe9, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe5, 0xe6, 0xe6, 0xe8, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe8, 0xe6, 0xe6, 0xe5, 0xe6, 0xe5, 0xe8,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x30,
-    0x30, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe5, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe8,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0x30, 0x30, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe9, 0xe6, 0xe5, 0xe6, 0xe6, 0xe8,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9,
-    0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe8, 0xe6,
-    0xe6, 0xe5, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0x30, 0x2a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x6b, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6b, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x7c,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x7c, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x2a,
-};
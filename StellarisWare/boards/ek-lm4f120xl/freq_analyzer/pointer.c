@@ -0,0 +1,223 @@
+//*****************************************************************************
+//
+// pointer.c - Coalesces the pointer messages from the touch screen, so the
+// widgets see no more than one move per display frame.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#ifndef HOST_BUILD
+#include "inc/hw_types.h"
+#include "driverlib/interrupt.h"
+#include "grlib/grlib.h"
+#include "grlib/widget.h"
+#else
+#define IntMasterDisable()
+#define IntMasterEnable()
+#define WIDGET_MSG_PTR_DOWN		0x00000002
+#define WIDGET_MSG_PTR_MOVE		0x00000003
+#define WIDGET_MSG_PTR_UP		0x00000004
+#endif
+
+#include "latency.h"
+#include "pointer.h"
+
+//*****************************************************************************
+//
+// Private predefines and variables
+//
+//*****************************************************************************
+
+//
+// Where messages are passed on to, and the shortest time between two moves
+// being passed on, in timestamp ticks
+//
+static long (*g_pfnSink)(unsigned long ulMessage, long lX, long lY);
+static unsigned long g_ulPeriod;
+
+//
+// The latest move not yet passed on.  These are written by the touch screen
+// interrupt and taken by the main loop.
+//
+static volatile unsigned char g_ucPending;
+static volatile long g_lPendingX;
+static volatile long g_lPendingY;
+
+//
+// The position and time of the last message passed on
+//
+static long g_lLastX;
+static long g_lLastY;
+static unsigned long g_ulLastTime;
+
+//*****************************************************************************
+//
+// Public global variables
+//
+//*****************************************************************************
+tPointerStats g_sPointerStats;
+
+//*****************************************************************************
+//
+// Private Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Pass a message on to the widgets.  This has to be called either from the
+// touch screen interrupt or with interrupts disabled, so that messages reach
+// the widget message queue one at a time.
+//
+// param ulMessage: the WIDGET_MSG_PTR_* message
+// param lX, lY: where the pointer is
+// return: what the sink returned
+//
+//*****************************************************************************
+static long
+Deliver(unsigned long ulMessage, long lX, long lY)
+{
+	g_sPointerStats.ulDelivered++;
+	g_lLastX = lX;
+	g_lLastY = lY;
+	g_ulLastTime = LatencyTimestamp();
+	return(g_pfnSink(ulMessage, lX, lY));
+}
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Set where pointer messages go once they have been coalesced.
+//
+// param pfnSink: the function messages are passed on to, usually
+//		 WidgetPointerMessage
+// param ulPeriod: the shortest time between two moves being passed on, in
+//		 LatencyTimestamp ticks.  This is normally the display frame period,
+//		 since a widget can't show more moves than that anyway.
+//
+//*****************************************************************************
+void
+PointerInit(long (*pfnSink)(unsigned long ulMessage, long lX, long lY),
+			unsigned long ulPeriod)
+{
+	g_pfnSink = pfnSink;
+	g_ulPeriod = ulPeriod;
+	g_ucPending = 0;
+	g_lLastX = -1;
+	g_lLastY = -1;
+	g_ulLastTime = LatencyTimestamp();
+
+	g_sPointerStats.ulReceived = 0;
+	g_sPointerStats.ulDelivered = 0;
+	g_sPointerStats.ulCoalesced = 0;
+	g_sPointerStats.ulStill = 0;
+}
+
+//*****************************************************************************
+//
+// Take a message from the touch screen.  This is the touch screen callback,
+// so it runs in the touch screen interrupt.
+//
+// A move is held as the latest position, replacing any move still held, and
+// PointerFlush passes it on later.  A press or release is passed on at once,
+// after any move still held, so the widgets see the pointer where it was
+// let go.
+//
+// param ulMessage: the WIDGET_MSG_PTR_* message
+// param lX, lY: where the pointer is
+// return: what the sink returned for a message passed on, or 1 for a move
+//		   that was held
+//
+//*****************************************************************************
+long
+PointerMessage(unsigned long ulMessage, long lX, long lY)
+{
+	g_sPointerStats.ulReceived++;
+
+	if(ulMessage == WIDGET_MSG_PTR_MOVE)
+	{
+		if(g_ucPending)
+		{
+			g_sPointerStats.ulCoalesced++;
+			g_ucPending = 0;
+		}
+
+		//
+		// The debouncer sends a move for every sample while the screen is
+		// pressed, so most of them from a finger held still go nowhere
+		//
+		if((lX == g_lLastX) && (lY == g_lLastY))
+		{
+			g_sPointerStats.ulStill++;
+			return(1);
+		}
+
+		g_lPendingX = lX;
+		g_lPendingY = lY;
+		g_ucPending = 1;
+		return(1);
+	}
+
+	if(g_ucPending)
+	{
+		g_ucPending = 0;
+		Deliver(WIDGET_MSG_PTR_MOVE, g_lPendingX, g_lPendingY);
+	}
+	return(Deliver(ulMessage, lX, lY));
+}
+
+//*****************************************************************************
+//
+// Pass on the move being held, if there is one and a frame period has gone by
+// since the last message was passed on.  This is called from the main loop,
+// ahead of processing the widget message queue.
+//
+//*****************************************************************************
+void
+PointerFlush(void)
+{
+	if(!g_ucPending || ((LatencyTimestamp() - g_ulLastTime) < g_ulPeriod))
+	{
+		return;
+	}
+
+	//
+	// The touch screen interrupt passes messages on too, so keep it out until
+	// this one is in the queue
+	//
+	IntMasterDisable();
+	if(g_ucPending)
+	{
+		g_ucPending = 0;
+		Deliver(WIDGET_MSG_PTR_MOVE, g_lPendingX, g_lPendingY);
+	}
+	IntMasterEnable();
+}
@@ -0,0 +1,81 @@
+//*****************************************************************************
+//
+// pointer.h - Predefines, public functions, and globals for coalescing the
+// pointer messages from the touch screen.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __POINTER_H__
+#define __POINTER_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The pointer messages seen since the counts were last cleared.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// Messages of any kind from the touch screen
+	//
+	unsigned long ulReceived;
+
+	//
+	// Messages passed on to the widgets
+	//
+	unsigned long ulDelivered;
+
+	//
+	// Moves dropped because a later one replaced them before they were
+	// passed on
+	//
+	unsigned long ulCoalesced;
+
+	//
+	// Moves dropped because they went nowhere since the last one passed on
+	//
+	unsigned long ulStill;
+}
+tPointerStats;
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+extern tPointerStats g_sPointerStats;
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern void PointerInit(long (*pfnSink)(unsigned long ulMessage, long lX,
+										long lY),
+						unsigned long ulPeriod);
+extern long PointerMessage(unsigned long ulMessage, long lX, long lY);
+extern void PointerFlush(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __POINTER_H__
@@ -0,0 +1,703 @@
+//*****************************************************************************
+//
+// render.c - The renderers that draw a frame of bar heights on the display.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#ifndef HOST_BUILD
+#include "grlib/grlib.h"
+#include "drivers/Kentec320x240x16_ssd2119_8bit.h"
+#else
+#include "tools/ssd2119_emu.h"
+#endif
+#include "gui.h"
+#include "colormap.h"
+#include "background.h"
+#include "render.h"
+
+//*****************************************************************************
+//
+// Private predefines and variables
+//
+//*****************************************************************************
+
+//
+// The part of the screen the bars are spread across, and the widest a bar
+// can be
+//
+#define RENDER_CANVAS_X			10
+#define RENDER_CANVAS_WIDTH		300
+#define RENDER_MAX_BAR_WIDTH	50
+
+//
+// The bottom row of the bars, and the row the mirrored bars grow out from.
+// Either way, a bar of COLORMAP_FULL_SCALE fits between the title and the
+// config button.  Taller bars are cut down to that.
+//
+#define RENDER_Y_MAX			210
+#define RENDER_Y_MID			118
+#define RENDER_MAX_HEIGHT		COLORMAP_FULL_SCALE
+
+//
+// The height of each kind of marker, in rows.  A raindrop is one row more
+// than RAIN_HEIGHT.
+//
+#define RAIN_HEIGHT				1
+#define DOT_HEIGHT				3
+#define PEAK_HEIGHT				2
+
+//
+// How many frames a peak is held for before it starts to fall, and how many
+// rows it falls by each frame after that.  A peak has to have fallen all the
+// way within 256 frames, since only the low byte of the frame number it was
+// set in is kept.
+//
+#define PEAK_HOLD_FRAMES		24
+#define PEAK_FALL_ROWS			2
+
+//
+// The marker level of a bar with no marker.  Marker levels are otherwise bar
+// heights, which never get this high.
+//
+#define MARKER_NONE				0xff
+
+//
+// The color of the raindrops and peaks, ClrLightGrey in the display's native
+// 5-6-5 format
+//
+#define MARKER_COLOR			0xd69a
+
+//
+// The color value SpanOutside() takes to mean the background image
+//
+#define SPAN_BACKGROUND			(-1)
+
+//*****************************************************************************
+//
+// The rows of a column that something covers, inclusive.  The span is empty
+// if lTop is below lBottom.
+//
+//*****************************************************************************
+typedef struct
+{
+	long lTop;
+	long lBottom;
+}
+tSpan;
+
+//*****************************************************************************
+//
+// How a renderer built on the span painter draws each bar: a body, and a
+// marker above it, each covering one span of the bar's columns.  The two never
+// overlap.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The span the body of a bar of the given height covers
+	//
+	void (*pfnBody)(unsigned char ucHeight, tSpan *psSpan);
+
+	//
+	// The level a bar's marker is at for a frame, or MARKER_NONE.  Markers
+	// that move on their own only advance when ucCommit is set.
+	//
+	unsigned char (*pfnMarkerLevel)(const tBarFrame *psFrame,
+									unsigned long ulIdx,
+									unsigned char ucCommit);
+
+	//
+	// The span the marker covers at a level
+	//
+	void (*pfnMarker)(unsigned char ucLevel, tSpan *psSpan);
+
+	//
+	// Whether the marker is drawn in the bar's color, rather than
+	// MARKER_COLOR
+	//
+	unsigned char ucMarkerBarColor;
+}
+tSpanStyle;
+
+//
+// An array used to keep track of the current location of each "rain drop,"
+// which represents the biggest value drawn on screen for a given bar, minus
+// the effects of gravity over time.  The peak-hold renderer keeps each bar's
+// peak here.
+//
+unsigned char LEDDisplayMaxes[MAX_NUMBARS];
+
+//
+// An array used to keep track of the current "acceleration" of the falling
+// "rain drop."  The peak-hold renderer keeps the low byte of the frame number
+// each peak was set in here.
+//
+static unsigned char g_pucGravity[MAX_NUMBARS];
+
+//
+// The height and marker level each bar was last drawn at
+//
+static unsigned char g_pucDrawnHeight[MAX_NUMBARS];
+static unsigned char g_pucDrawnMarker[MAX_NUMBARS];
+
+//
+// The color of each bar, in the display's native format, spread across the
+// bars from the selected palette.  This is rebuilt whenever the number of bars
+// or the palette changes, so the paint loop just looks each one up.
+//
+static unsigned short g_pusBarColors[MAX_NUMBARS];
+
+//*****************************************************************************
+//
+// Private Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Get the height of a bar of a frame, cut down to what fits on the screen.
+//
+//*****************************************************************************
+static unsigned char
+BarHeight(const tBarFrame *psFrame, unsigned long ulIdx)
+{
+	if(psFrame->pucHeights[ulIdx] > RENDER_MAX_HEIGHT)
+	{
+		return(RENDER_MAX_HEIGHT);
+	}
+	return(psFrame->pucHeights[ulIdx]);
+}
+
+//*****************************************************************************
+//
+// Draw the part of one span of a bar that is outside another.
+//
+// param lXMin: the leftmost column of the bar
+// param lWidth: the width of the bar, in pixels, or 0 to draw nothing
+// param psSpan: the span to draw
+// param psExclude: the span to leave alone
+// param lColor: the color to draw, or SPAN_BACKGROUND to restore the
+//		 background image
+//
+// return: the number of rows drawn, or that would be drawn
+//
+//*****************************************************************************
+static long
+SpanOutside(long lXMin, long lWidth, const tSpan *psSpan,
+			const tSpan *psExclude, long lColor)
+{
+	long lTop[2], lBottom[2], lRows;
+	int iPart;
+
+	if(psSpan->lTop > psSpan->lBottom)
+	{
+		return(0);
+	}
+
+	//
+	// Cut the span into the parts above and below the excluded one.  If the
+	// two don't overlap, that's all of it.
+	//
+	if((psExclude->lTop > psExclude->lBottom) ||
+	   (psExclude->lBottom < psSpan->lTop) ||
+	   (psExclude->lTop > psSpan->lBottom))
+	{
+		lTop[0] = psSpan->lTop;
+		lBottom[0] = psSpan->lBottom;
+		lTop[1] = 1;
+		lBottom[1] = 0;
+	}
+	else
+	{
+		lTop[0] = psSpan->lTop;
+		lBottom[0] = psExclude->lTop - 1;
+		lTop[1] = psExclude->lBottom + 1;
+		lBottom[1] = psSpan->lBottom;
+	}
+
+	lRows = 0;
+	for(iPart = 0; iPart < 2; iPart++)
+	{
+		if(lTop[iPart] > lBottom[iPart])
+		{
+			continue;
+		}
+		lRows += lBottom[iPart] - lTop[iPart] + 1;
+		if(!lWidth)
+		{
+			continue;
+		}
+
+		if(lColor == SPAN_BACKGROUND)
+		{
+			BackgroundDraw(&g_sBackground, lXMin, lTop[iPart],
+						   lXMin + lWidth - 1, lBottom[iPart]);
+		}
+		else
+		{
+			DpyWindowBegin(lXMin, lTop[iPart], lXMin + lWidth - 1,
+						   lBottom[iPart]);
+			DpyPixelRun(lColor,
+						lWidth * (lBottom[iPart] - lTop[iPart] + 1));
+			DpyWindowEnd();
+		}
+	}
+
+	return(lRows);
+}
+
+//*****************************************************************************
+//
+// Find the span of a bar's marker, which is empty if it has none.
+//
+//*****************************************************************************
+static void
+MarkerSpan(const tSpanStyle *psStyle, unsigned char ucLevel, tSpan *psSpan)
+{
+	if(ucLevel == MARKER_NONE)
+	{
+		psSpan->lTop = 1;
+		psSpan->lBottom = 0;
+	}
+	else
+	{
+		psStyle->pfnMarker(ucLevel, psSpan);
+	}
+}
+
+//*****************************************************************************
+//
+// Bring one bar on the screen up to date with a frame, or work out what that
+// would take.
+//
+// param psStyle: how the bar is drawn
+// param psFrame: the frame the bar is from
+// param ulIdx: the index of the bar
+// param lXMin: the leftmost column of the bar
+// param lWidth: the width of the bar, in pixels, or 0 to only work out the
+//		 cost, without drawing anything or moving any markers along
+//
+// The old marker is rubbed out first, then the body is moved, then the new
+// marker is drawn, so the new marker can't be rubbed out by the body
+// shrinking past it.
+//
+// return: the number of rows drawn, or -1 if nothing needed drawing
+//
+//*****************************************************************************
+static long
+SpanBarUpdate(const tSpanStyle *psStyle, const tBarFrame *psFrame,
+			  unsigned long ulIdx, long lXMin, long lWidth)
+{
+	tSpan sOldBody, sNewBody, sOldMarker, sNewMarker;
+	unsigned char ucHeight, ucMarker, ucMoved;
+	long lRows, lColor;
+
+	ucHeight = BarHeight(psFrame, ulIdx);
+	ucMarker = psStyle->pfnMarkerLevel(psFrame, ulIdx, lWidth != 0);
+
+	if((ucHeight == g_pucDrawnHeight[ulIdx]) &&
+	   (ucMarker == g_pucDrawnMarker[ulIdx]))
+	{
+		//
+		// Nothing on the screen changes, but a marker above the bar is
+		// still on its way down, so the bar has to be looked at again
+		//
+		return(((ucMarker != MARKER_NONE) && (ucMarker > ucHeight)) ? 0 : -1);
+	}
+
+	psStyle->pfnBody(g_pucDrawnHeight[ulIdx], &sOldBody);
+	psStyle->pfnBody(ucHeight, &sNewBody);
+	MarkerSpan(psStyle, g_pucDrawnMarker[ulIdx], &sOldMarker);
+	MarkerSpan(psStyle, ucMarker, &sNewMarker);
+	lColor = g_pusBarColors[ulIdx];
+	ucMoved = (ucMarker != g_pucDrawnMarker[ulIdx]);
+
+	lRows = 0;
+	if(ucMoved)
+	{
+		lRows += SpanOutside(lXMin, lWidth, &sOldMarker, &sNewBody,
+							 SPAN_BACKGROUND);
+	}
+	lRows += SpanOutside(lXMin, lWidth, &sOldBody, &sNewBody,
+						 SPAN_BACKGROUND);
+	lRows += SpanOutside(lXMin, lWidth, &sNewBody, &sOldBody, lColor);
+
+	//
+	// The marker has to be drawn again if it moved, or if the body shrank
+	// out from under where it is
+	//
+	if(ucMoved || ((ucHeight != g_pucDrawnHeight[ulIdx]) &&
+				   (sNewMarker.lTop <= sOldBody.lBottom) &&
+				   (sNewMarker.lBottom >= sOldBody.lTop)))
+	{
+		sOldMarker.lTop = 1;
+		sOldMarker.lBottom = 0;
+		lRows += SpanOutside(lXMin, lWidth, &sNewMarker, &sOldMarker,
+							 psStyle->ucMarkerBarColor ? lColor :
+														 MARKER_COLOR);
+	}
+
+	if(lWidth)
+	{
+		g_pucDrawnHeight[ulIdx] = ucHeight;
+		g_pucDrawnMarker[ulIdx] = ucMarker;
+	}
+	return(lRows);
+}
+
+//*****************************************************************************
+//
+// The span painter's side of the tRenderer interface.  pvData is the
+// tSpanStyle of the renderer.
+//
+//*****************************************************************************
+static void
+SpanInit(const void *pvData)
+{
+	unsigned long ulIdx;
+
+	for(ulIdx = 0; ulIdx < MAX_NUMBARS; ulIdx++)
+	{
+		g_pucDrawnHeight[ulIdx] = 0;
+		g_pucDrawnMarker[ulIdx] = MARKER_NONE;
+		LEDDisplayMaxes[ulIdx] = 0;
+		g_pucGravity[ulIdx] = 0;
+	}
+}
+
+static long
+SpanCost(const void *pvData, const tBarFrame *psFrame, unsigned long ulIdx)
+{
+	return(SpanBarUpdate(pvData, psFrame, ulIdx, 0, 0));
+}
+
+static void
+SpanPaintDiff(const void *pvData, const tBarFrame *psFrame,
+			  unsigned long ulIdx, long lXMin, long lWidth)
+{
+	SpanBarUpdate(pvData, psFrame, ulIdx, lXMin, lWidth);
+}
+
+static void
+SpanPaintFull(const void *pvData, const tBarFrame *psFrame,
+			  unsigned long ulIdx, long lXMin, long lWidth)
+{
+	//
+	// An empty body and no marker is what's on a clean background
+	//
+	g_pucDrawnHeight[ulIdx] = 0;
+	g_pucDrawnMarker[ulIdx] = MARKER_NONE;
+	SpanBarUpdate(pvData, psFrame, ulIdx, lXMin, lWidth);
+}
+
+//*****************************************************************************
+//
+// Bodies: none, a bar standing on the bottom row, and a bar centered on the
+// middle row.  All are empty at a height of 0.
+//
+//*****************************************************************************
+static void
+BodyNone(unsigned char ucHeight, tSpan *psSpan)
+{
+	psSpan->lTop = 1;
+	psSpan->lBottom = 0;
+}
+
+static void
+BodyBar(unsigned char ucHeight, tSpan *psSpan)
+{
+	psSpan->lTop = RENDER_Y_MAX - ucHeight + 1;
+	psSpan->lBottom = RENDER_Y_MAX;
+}
+
+static void
+BodyMirrored(unsigned char ucHeight, tSpan *psSpan)
+{
+	psSpan->lTop = RENDER_Y_MID - (ucHeight >> 1);
+	psSpan->lBottom = psSpan->lTop + ucHeight - 1;
+}
+
+//*****************************************************************************
+//
+// Markers.  Each returns the marker's level for a frame, with its span
+// function following it.
+//
+//*****************************************************************************
+static unsigned char
+LevelNone(const tBarFrame *psFrame, unsigned long ulIdx,
+		  unsigned char ucCommit)
+{
+	return(MARKER_NONE);
+}
+
+//
+// A raindrop, when it's raining, left behind at the highest the bar has been
+// and falling back down at an ever faster rate
+//
+static unsigned char
+LevelRain(const tBarFrame *psFrame, unsigned long ulIdx,
+		  unsigned char ucCommit)
+{
+	unsigned char ucHeight, ucMax, ucGravity;
+
+	if(!g_ucDispRain)
+	{
+		return(MARKER_NONE);
+	}
+
+	ucHeight = BarHeight(psFrame, ulIdx);
+	ucMax = LEDDisplayMaxes[ulIdx];
+	ucGravity = g_pucGravity[ulIdx];
+	if(ucMax <= ucHeight)
+	{
+		//
+		// We have a new maximum... no need for gravity calculations this
+		// time
+		//
+		ucMax = ucHeight;
+		ucGravity = 0;
+	}
+	else if(ucGravity > ucMax)
+	{
+		//
+		// If gravity drove the last maximum below the current value, then
+		// current value is new maximum
+		//
+		ucMax = ucHeight;
+	}
+	else
+	{
+		//
+		// apply gravity to the raindrop
+		//
+		ucMax -= ucGravity;
+		ucGravity++;
+	}
+
+	if(ucCommit)
+	{
+		LEDDisplayMaxes[ulIdx] = ucMax;
+		g_pucGravity[ulIdx] = ucGravity;
+	}
+
+	return(((ucMax > RAIN_HEIGHT) && (ucMax > ucHeight)) ? ucMax :
+														   MARKER_NONE);
+}
+
+static void
+MarkerRain(unsigned char ucLevel, tSpan *psSpan)
+{
+	psSpan->lTop = RENDER_Y_MAX - ucLevel;
+	psSpan->lBottom = psSpan->lTop + RAIN_HEIGHT;
+}
+
+//
+// A dot riding on the top of the bar, which sits on the bottom row when the
+// bar is empty
+//
+static unsigned char
+LevelDot(const tBarFrame *psFrame, unsigned long ulIdx,
+		 unsigned char ucCommit)
+{
+	return(BarHeight(psFrame, ulIdx));
+}
+
+static void
+MarkerDot(unsigned char ucLevel, tSpan *psSpan)
+{
+	psSpan->lTop = RENDER_Y_MAX - ((ucLevel > DOT_HEIGHT) ? ucLevel :
+															DOT_HEIGHT) + 1;
+	psSpan->lBottom = psSpan->lTop + DOT_HEIGHT - 1;
+}
+
+//
+// The highest the bar has been, held for PEAK_HOLD_FRAMES frames and then
+// falling at a steady PEAK_FALL_ROWS rows a frame.  The peak's level is
+// worked out from the frame number, so it falls at the same rate however
+// often the bar is drawn.
+//
+static unsigned char
+LevelPeak(const tBarFrame *psFrame, unsigned long ulIdx,
+		  unsigned char ucCommit)
+{
+	unsigned char ucHeight, ucAge;
+	long lPeak;
+
+	ucHeight = BarHeight(psFrame, ulIdx);
+	lPeak = LEDDisplayMaxes[ulIdx];
+	ucAge = (unsigned char)psFrame->ulSequence - g_pucGravity[ulIdx];
+	if(ucAge > PEAK_HOLD_FRAMES)
+	{
+		lPeak -= (ucAge - PEAK_HOLD_FRAMES) * PEAK_FALL_ROWS;
+	}
+
+	if(lPeak <= ucHeight)
+	{
+		lPeak = ucHeight;
+		if(ucCommit)
+		{
+			LEDDisplayMaxes[ulIdx] = ucHeight;
+			g_pucGravity[ulIdx] = psFrame->ulSequence;
+		}
+	}
+	return(lPeak);
+}
+
+static void
+MarkerPeak(unsigned char ucLevel, tSpan *psSpan)
+{
+	psSpan->lBottom = RENDER_Y_MAX - ucLevel;
+	psSpan->lTop = psSpan->lBottom - PEAK_HEIGHT + 1;
+}
+
+//*****************************************************************************
+//
+// The renderers
+//
+//*****************************************************************************
+
+//
+// Vertical bars standing on the bottom of the screen, with a raindrop above
+// each when "Make it rain" is checked
+//
+static const tSpanStyle g_sBarsStyle =
+{
+	BodyBar, LevelRain, MarkerRain, 0
+};
+static const tRenderer g_sBarsRenderer =
+{
+	"bars", RENDER_DIRTY_TOP | RENDER_DIRTY_MARKER, &g_sBarsStyle,
+	SpanInit, SpanCost, SpanPaintDiff, SpanPaintFull
+};
+
+//
+// Bars mirrored about the middle of the screen
+//
+static const tSpanStyle g_sMirroredStyle =
+{
+	BodyMirrored, LevelNone, 0, 0
+};
+static const tRenderer g_sMirroredRenderer =
+{
+	"mirrored", RENDER_DIRTY_ENDS, &g_sMirroredStyle,
+	SpanInit, SpanCost, SpanPaintDiff, SpanPaintFull
+};
+
+//
+// Just the top of each bar, which at a lot of bars traces the spectrum out as
+// a line
+//
+static const tSpanStyle g_sDotsStyle =
+{
+	BodyNone, LevelDot, MarkerDot, 1
+};
+static const tRenderer g_sDotsRenderer =
+{
+	"dots", RENDER_DIRTY_MARKER, &g_sDotsStyle,
+	SpanInit, SpanCost, SpanPaintDiff, SpanPaintFull
+};
+
+//
+// Bars, with the envelope of their recent peaks held above them
+//
+static const tSpanStyle g_sPeaksStyle =
+{
+	BodyBar, LevelPeak, MarkerPeak, 0
+};
+static const tRenderer g_sPeaksRenderer =
+{
+	"peaks", RENDER_DIRTY_TOP | RENDER_DIRTY_MARKER, &g_sPeaksStyle,
+	SpanInit, SpanCost, SpanPaintDiff, SpanPaintFull
+};
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//
+// The renderers, indexed by RENDERER_*
+//
+const tRenderer * const g_ppsRenderers[NUM_RENDERERS] =
+{
+	&g_sBarsRenderer,
+	&g_sMirroredRenderer,
+	&g_sDotsRenderer,
+	&g_sPeaksRenderer
+};
+
+//*****************************************************************************
+//
+// Work out where the bars go across the screen.
+//
+// param uiNumBars: the number of bars
+// param plXMin: returns the leftmost column of the first bar
+// param plWidth: returns the width of each bar, in pixels
+//
+//*****************************************************************************
+void
+RenderLayout(unsigned int uiNumBars, long *plXMin, long *plWidth)
+{
+	long lWidth;
+
+	//
+	// Figure out the width of each bar based on the number of pixels the
+	// entire display can take up
+	//
+	lWidth = RENDER_CANVAS_WIDTH / uiNumBars;
+	if(lWidth > RENDER_MAX_BAR_WIDTH)
+	{
+		lWidth = RENDER_MAX_BAR_WIDTH;
+	}
+
+	*plWidth = lWidth;
+	*plXMin = RENDER_CANVAS_X + (RENDER_CANVAS_WIDTH - (lWidth * uiNumBars)) / 2;
+}
+
+//*****************************************************************************
+//
+// Spread a palette evenly across the bars, and store the color of each bar
+// for the renderers to draw it in.
+//
+// param uiNumBars: the number of bars
+// param ucPalette: the palette, from the BAR_PALETTE_* values
+//
+//*****************************************************************************
+void
+RenderColorsBuild(unsigned int uiNumBars, unsigned char ucPalette)
+{
+	const unsigned short *pusPalette;
+	unsigned int uiIdx;
+
+	pusPalette = g_ppusBarPalettes[ucPalette];
+	for(uiIdx = 0; uiIdx < uiNumBars; uiIdx++)
+	{
+		g_pusBarColors[uiIdx] = pusPalette[(uiIdx * COLORMAP_SIZE) / uiNumBars];
+	}
+}
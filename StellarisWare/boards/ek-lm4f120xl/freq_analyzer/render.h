@@ -0,0 +1,137 @@
+//*****************************************************************************
+//
+// render.h - Predefines, public functions, and globals for the renderers that
+// draw a frame of bar heights on the display.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __RENDER_H__
+#define __RENDER_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The renderers.  These index g_ppsRenderers.
+//
+#define RENDERER_BARS			0
+#define RENDERER_MIRRORED		1
+#define RENDERER_DOTS			2
+#define RENDERER_PEAKS			3
+#define NUM_RENDERERS			4
+
+//
+// How a renderer redraws a bar when it changes, which is what the bus cost of
+// a frame comes down to.  A renderer may do more than one of these.
+//
+// RENDER_DIRTY_TOP: the bar grows up from a fixed base, so only the rows
+// between its old and new tops are drawn.
+//
+// RENDER_DIRTY_ENDS: the bar grows out from its middle, so both ends move by
+// half of the change.
+//
+// RENDER_DIRTY_MARKER: a marker of a few rows moves, so no more than twice
+// its height is drawn however far it moves.
+//
+#define RENDER_DIRTY_TOP		0x01
+#define RENDER_DIRTY_ENDS		0x02
+#define RENDER_DIRTY_MARKER		0x04
+
+//*****************************************************************************
+//
+// A way of drawing the bars.
+//
+// Every function is handed pvData, so renderers that work the same way can
+// share their functions and differ only in their data.  The renderer keeps
+// track of what it has drawn for each bar, so that it only has to draw what
+// has changed.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The name of the renderer, for the debug output
+	//
+	const char *pcName;
+
+	//
+	// How the renderer redraws a bar, from the RENDER_DIRTY_* flags
+	//
+	unsigned char ucDirty;
+
+	//
+	// The renderer's own data
+	//
+	const void *pvData;
+
+	//
+	// Forget what has been drawn, for a display that has just had the
+	// background drawn over it
+	//
+	void (*pfnInit)(const void *pvData);
+
+	//
+	// The number of rows drawing one bar of a frame would draw, or -1 if it
+	// doesn't need drawing at all.  0 means the bar has nothing to draw, but
+	// still has to be drawn to keep something moving.
+	//
+	long (*pfnCost)(const void *pvData, const tBarFrame *psFrame,
+					unsigned long ulIdx);
+
+	//
+	// Draw one bar of a frame over what was last drawn for it
+	//
+	void (*pfnPaintDiff)(const void *pvData, const tBarFrame *psFrame,
+						 unsigned long ulIdx, long lXMin, long lWidth);
+
+	//
+	// Draw one bar of a frame over the background, whatever was drawn for it
+	// before
+	//
+	void (*pfnPaintFull)(const void *pvData, const tBarFrame *psFrame,
+						 unsigned long ulIdx, long lXMin, long lWidth);
+}
+tRenderer;
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+extern const tRenderer * const g_ppsRenderers[NUM_RENDERERS];
+extern unsigned char LEDDisplayMaxes[MAX_NUMBARS];
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern void RenderLayout(unsigned int uiNumBars, long *plXMin, long *plWidth);
+extern void RenderColorsBuild(unsigned int uiNumBars, unsigned char ucPalette);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __RENDER_H__
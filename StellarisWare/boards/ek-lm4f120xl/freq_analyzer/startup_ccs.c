@@ -120,10 +120,10 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // PWM Generator 3
     IntDefaultHandler,                      // uDMA Software Transfer
     uDMAErrorHandler,                       // uDMA Error
-    IntDefaultHandler,                      // ADC1 Sequence 0
+    TouchScreenIntHandler,                  // ADC1 Sequence 0
     IntDefaultHandler,                      // ADC1 Sequence 1
     IntDefaultHandler,                      // ADC1 Sequence 2
-    TouchScreenIntHandler,                  // ADC1 Sequence 3
+    IntDefaultHandler,                      // ADC1 Sequence 3
     IntDefaultHandler,                      // I2S0
     IntDefaultHandler,                      // External Bus Interface 0
     IntDefaultHandler,                      // GPIO Port J
@@ -0,0 +1,607 @@
+//*****************************************************************************
+//
+// store.c - A log of records in flash, which keeps settings across resets.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#ifndef HOST_BUILD
+#include "inc/hw_types.h"
+#include "driverlib/flash.h"
+#else
+#include "tools/flash_sim.h"
+#endif
+#include <string.h>
+
+#include "store.h"
+
+//*****************************************************************************
+//
+// Private predefines and variables
+//
+//*****************************************************************************
+
+//
+// How the log is read.  The target reads its flash directly; a host build
+// reads the flash model's copy.
+//
+#ifndef HOST_BUILD
+#define STORE_PTR(ulAddr)		((const unsigned char *)(ulAddr))
+#else
+#define STORE_PTR(ulAddr)		FlashSimPtr(ulAddr)
+#endif
+
+//
+// The start of a bank that is in use
+//
+#define STORE_MAGIC				0x53514146
+
+//
+// The tag of a record header that hasn't been programmed, which is where the
+// log ends
+//
+#define STORE_TAG_FREE			0xffff
+
+//
+// Records are padded out to whole words, as flash is programmed a word at a
+// time
+//
+#define STORE_ALIGN(ulLength)	(((ulLength) + 3) & ~3)
+
+//
+// The number of words gathered up in SRAM before they are programmed
+//
+#define STORE_WRITE_WORDS		16
+
+//*****************************************************************************
+//
+// The start of each bank.  Of two banks with this header, the one with the
+// later sequence number is the one in use.  It is programmed last when a bank
+// is filled, so a bank that was being filled when the power went is ignored.
+//
+//*****************************************************************************
+typedef struct
+{
+	unsigned long ulMagic;
+	unsigned long ulSequence;
+}
+tBankHeader;
+
+//*****************************************************************************
+//
+// The start of each record, followed by its data.  The header is programmed
+// before the data, so a record cut short by the power going fails its check
+// but still says where the next one starts.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// What the record holds, from the STORE_TAG_* values
+	//
+	unsigned short usTag;
+
+	//
+	// The length of the data, in bytes, before it is padded to a whole word
+	//
+	unsigned short usLength;
+
+	//
+	// The StoreHash of the tag, the length and the data
+	//
+	unsigned long ulCheck;
+}
+tRecordHeader;
+
+//*****************************************************************************
+//
+// Words on their way to being programmed
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// Where the next word is to be programmed
+	//
+	unsigned long ulAddr;
+
+	//
+	// The bytes gathered so far, and how many there are
+	//
+	unsigned long pulBuf[STORE_WRITE_WORDS];
+	unsigned long ulCount;
+
+	//
+	// Nonzero if programming any of the words failed
+	//
+	long lError;
+}
+tWriter;
+
+//
+// The bank in use, or -1 if neither is, its sequence number, and where in it
+// the next record goes
+//
+static long g_lActive = -1;
+static unsigned long g_ulSequence;
+static unsigned long g_ulEnd;
+
+//*****************************************************************************
+//
+// Private Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Find the address of a bank.
+//
+// param lBank: the bank, 0 or 1
+// return: the address of its first byte
+//
+//*****************************************************************************
+static unsigned long
+BankAddr(long lBank)
+{
+	return(STORE_BASE + (lBank * STORE_BANK_SIZE));
+}
+
+//*****************************************************************************
+//
+// Check that a record's data is what its header says it is.
+//
+// param ulAddr: the address of the record
+// param psHeader: the record's header
+// return: 1 if the record is good, else 0
+//
+//*****************************************************************************
+static int
+RecordGood(unsigned long ulAddr, const tRecordHeader *psHeader)
+{
+	unsigned long ulHash;
+
+	ulHash = StoreHash(STORE_HASH_INIT, psHeader, 4);
+	ulHash = StoreHash(ulHash, STORE_PTR(ulAddr + sizeof(tRecordHeader)),
+					   psHeader->usLength);
+	return(ulHash == psHeader->ulCheck);
+}
+
+//*****************************************************************************
+//
+// Walk the records in a bank.
+//
+// param lBank: the bank
+// param usTag: the tag of the record to look for, or STORE_TAG_FREE for none
+// param pulFound: returns the address of the latest good record with the
+//		 tag, or 0 if there isn't one
+// return: the offset into the bank of the end of the log.  If the log runs
+//		   into a header that doesn't make sense, the bank is treated as full,
+//		   so that nothing is written after it.
+//
+//*****************************************************************************
+static unsigned long
+BankScan(long lBank, unsigned short usTag, unsigned long *pulFound)
+{
+	tRecordHeader sHeader;
+	unsigned long ulOffset, ulAddr;
+
+	*pulFound = 0;
+	ulOffset = sizeof(tBankHeader);
+	while((ulOffset + sizeof(tRecordHeader)) <= STORE_BANK_SIZE)
+	{
+		ulAddr = BankAddr(lBank) + ulOffset;
+		memcpy(&sHeader, STORE_PTR(ulAddr), sizeof(sHeader));
+		if(sHeader.usTag == STORE_TAG_FREE)
+		{
+			break;
+		}
+		if((ulOffset + sizeof(tRecordHeader) + STORE_ALIGN(sHeader.usLength)) >
+		   STORE_BANK_SIZE)
+		{
+			return(STORE_BANK_SIZE);
+		}
+		if((sHeader.usTag == usTag) && RecordGood(ulAddr, &sHeader))
+		{
+			*pulFound = ulAddr;
+		}
+		ulOffset += sizeof(tRecordHeader) + STORE_ALIGN(sHeader.usLength);
+	}
+	return(ulOffset);
+}
+
+//*****************************************************************************
+//
+// Program the words gathered so far, padding the last one out with erased
+// bytes.
+//
+// param psWriter: the writer
+//
+//*****************************************************************************
+static void
+WriterFlush(tWriter *psWriter)
+{
+	unsigned long ulLength;
+
+	if(psWriter->ulCount == 0)
+	{
+		return;
+	}
+
+	ulLength = STORE_ALIGN(psWriter->ulCount);
+	memset((unsigned char *)psWriter->pulBuf + psWriter->ulCount, 0xff,
+		   ulLength - psWriter->ulCount);
+	if(FlashProgram(psWriter->pulBuf, psWriter->ulAddr, ulLength))
+	{
+		psWriter->lError = -1;
+	}
+	psWriter->ulAddr += ulLength;
+	psWriter->ulCount = 0;
+}
+
+//*****************************************************************************
+//
+// Add bytes to those on their way to being programmed.
+//
+// param psWriter: the writer
+// param pvData: the bytes
+// param ulLength: the number of bytes
+//
+//*****************************************************************************
+static void
+WriterPut(tWriter *psWriter, const void *pvData, unsigned long ulLength)
+{
+	const unsigned char *pucData;
+	unsigned long ulCopy;
+
+	pucData = pvData;
+	while(ulLength)
+	{
+		ulCopy = sizeof(psWriter->pulBuf) - psWriter->ulCount;
+		if(ulCopy > ulLength)
+		{
+			ulCopy = ulLength;
+		}
+		memcpy((unsigned char *)psWriter->pulBuf + psWriter->ulCount, pucData,
+			   ulCopy);
+		psWriter->ulCount += ulCopy;
+		pucData += ulCopy;
+		ulLength -= ulCopy;
+		if(psWriter->ulCount == sizeof(psWriter->pulBuf))
+		{
+			WriterFlush(psWriter);
+		}
+	}
+}
+
+//*****************************************************************************
+//
+// Move the latest good record of each kind into the other bank, and start
+// using it.  The bank in use is left as it is until the next time this
+// happens, so if the power goes part way through, nothing is lost.
+//
+// param usSkip: the tag of a record not to move, as it is about to be
+//		 written again, or STORE_TAG_FREE to move them all
+// return: 0 on success, or -1 if the flash couldn't be erased or programmed
+//
+//*****************************************************************************
+static long
+Compact(unsigned short usSkip)
+{
+	tRecordHeader sHeader;
+	tBankHeader sBank;
+	tWriter sWriter;
+	unsigned long ulOffset, ulAddr, ulLatest;
+	long lNew;
+
+	lNew = (g_lActive == 0) ? 1 : 0;
+	for(ulOffset = 0; ulOffset < STORE_BANK_SIZE;
+		ulOffset += STORE_BLOCK_SIZE)
+	{
+		if(FlashErase(BankAddr(lNew) + ulOffset))
+		{
+			return(-1);
+		}
+	}
+
+	sWriter.ulAddr = BankAddr(lNew) + sizeof(tBankHeader);
+	sWriter.ulCount = 0;
+	sWriter.lError = 0;
+	if(g_lActive >= 0)
+	{
+		ulOffset = sizeof(tBankHeader);
+		while((ulOffset + sizeof(tRecordHeader)) <= g_ulEnd)
+		{
+			ulAddr = BankAddr(g_lActive) + ulOffset;
+			memcpy(&sHeader, STORE_PTR(ulAddr), sizeof(sHeader));
+			if(sHeader.usTag == STORE_TAG_FREE)
+			{
+				break;
+			}
+			if(sHeader.usTag != usSkip)
+			{
+				BankScan(g_lActive, sHeader.usTag, &ulLatest);
+				if(ulLatest == ulAddr)
+				{
+					WriterPut(&sWriter, STORE_PTR(ulAddr),
+							  sizeof(tRecordHeader) +
+							  STORE_ALIGN(sHeader.usLength));
+				}
+			}
+			ulOffset += sizeof(tRecordHeader) + STORE_ALIGN(sHeader.usLength);
+		}
+	}
+	WriterFlush(&sWriter);
+
+	//
+	// Only now does the new bank take over
+	//
+	sBank.ulMagic = STORE_MAGIC;
+	sBank.ulSequence = g_ulSequence + 1;
+	if(sWriter.lError ||
+	   FlashProgram((unsigned long *)&sBank, BankAddr(lNew), sizeof(sBank)))
+	{
+		return(-1);
+	}
+
+	g_lActive = lNew;
+	g_ulSequence = sBank.ulSequence;
+	g_ulEnd = sWriter.ulAddr - BankAddr(lNew);
+	return(0);
+}
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Find the bank in use and the end of the log in it.  This has to be called
+// before anything else here.
+//
+//*****************************************************************************
+void
+StoreInit(void)
+{
+	tBankHeader psBanks[2];
+	unsigned long ulFound;
+	long lBank;
+
+	g_lActive = -1;
+	for(lBank = 0; lBank < 2; lBank++)
+	{
+		memcpy(&psBanks[lBank], STORE_PTR(BankAddr(lBank)),
+			   sizeof(tBankHeader));
+		if((psBanks[lBank].ulMagic == STORE_MAGIC) &&
+		   ((g_lActive < 0) ||
+			((long)(psBanks[lBank].ulSequence - g_ulSequence) > 0)))
+		{
+			g_lActive = lBank;
+			g_ulSequence = psBanks[lBank].ulSequence;
+		}
+	}
+
+	if(g_lActive >= 0)
+	{
+		g_ulEnd = BankScan(g_lActive, STORE_TAG_FREE, &ulFound);
+	}
+}
+
+//*****************************************************************************
+//
+// Look for a record.
+//
+// param usTag: the kind of record, from the STORE_TAG_* values
+// return: the length of the latest good record of that kind, or -1 if there
+//		   isn't one
+//
+//*****************************************************************************
+long
+StoreFind(unsigned short usTag)
+{
+	unsigned long ulFound;
+
+	if(g_lActive < 0)
+	{
+		return(-1);
+	}
+
+	BankScan(g_lActive, usTag, &ulFound);
+	if(!ulFound)
+	{
+		return(-1);
+	}
+	return(((const tRecordHeader *)STORE_PTR(ulFound))->usLength);
+}
+
+//*****************************************************************************
+//
+// Read part of a record.
+//
+// param usTag: the kind of record, from the STORE_TAG_* values
+// param ulOffset: where in the record to start reading
+// param pvData: where to put what is read
+// param ulLength: the most bytes to read
+// return: the number of bytes read, which is 0 if there is no record of the
+//		   kind, or it ends before ulOffset
+//
+//*****************************************************************************
+unsigned long
+StoreRead(unsigned short usTag, unsigned long ulOffset, void *pvData,
+		  unsigned long ulLength)
+{
+	long lRecordLength;
+	unsigned long ulFound;
+
+	lRecordLength = StoreFind(usTag);
+	if((lRecordLength < 0) || (ulOffset >= (unsigned long)lRecordLength))
+	{
+		return(0);
+	}
+	if(ulLength > (lRecordLength - ulOffset))
+	{
+		ulLength = lRecordLength - ulOffset;
+	}
+
+	BankScan(g_lActive, usTag, &ulFound);
+	memcpy(pvData, STORE_PTR(ulFound + sizeof(tRecordHeader) + ulOffset),
+		   ulLength);
+	return(ulLength);
+}
+
+//*****************************************************************************
+//
+// Write a record, which takes the place of any earlier one of the same kind.
+// Nothing is written if the latest record of the kind already holds the same
+// data, so this can be called whenever the data might have changed without
+// wearing out the flash.
+//
+// When the bank in use fills, the latest record of each kind is moved to the
+// other bank, so each bank is only erased once per time through the two of
+// them.  Erasing stalls the processor for a few milliseconds per block.
+//
+// param usTag: the kind of record, from the STORE_TAG_* values
+// param psParts: the parts the record is gathered from, in order
+// param ulNumParts: the number of parts
+// return: 0 on success, or -1 if the record is too long or the flash couldn't
+//		   be erased or programmed
+//
+//*****************************************************************************
+long
+StoreWrite(unsigned short usTag, const tStorePart *psParts,
+		   unsigned long ulNumParts)
+{
+	tRecordHeader sHeader;
+	tWriter sWriter;
+	unsigned long ulPart, ulLength, ulSize, ulFound, ulOffset;
+
+	ulLength = 0;
+	for(ulPart = 0; ulPart < ulNumParts; ulPart++)
+	{
+		ulLength += psParts[ulPart].ulLength;
+	}
+	ulSize = sizeof(tRecordHeader) + STORE_ALIGN(ulLength);
+	if((usTag == STORE_TAG_FREE) ||
+	   (ulSize > (STORE_BANK_SIZE - sizeof(tBankHeader))))
+	{
+		return(-1);
+	}
+
+	sHeader.usTag = usTag;
+	sHeader.usLength = ulLength;
+	sHeader.ulCheck = StoreHash(STORE_HASH_INIT, &sHeader, 4);
+	for(ulPart = 0; ulPart < ulNumParts; ulPart++)
+	{
+		sHeader.ulCheck = StoreHash(sHeader.ulCheck, psParts[ulPart].pvData,
+									psParts[ulPart].ulLength);
+	}
+
+	//
+	// See if the same record is already there
+	//
+	if(g_lActive >= 0)
+	{
+		BankScan(g_lActive, usTag, &ulFound);
+		if(ulFound &&
+		   !memcmp(STORE_PTR(ulFound), &sHeader, sizeof(sHeader)))
+		{
+			ulOffset = ulFound + sizeof(tRecordHeader);
+			for(ulPart = 0; ulPart < ulNumParts; ulPart++)
+			{
+				if(memcmp(STORE_PTR(ulOffset), psParts[ulPart].pvData,
+						  psParts[ulPart].ulLength))
+				{
+					break;
+				}
+				ulOffset += psParts[ulPart].ulLength;
+			}
+			if(ulPart == ulNumParts)
+			{
+				return(0);
+			}
+		}
+	}
+
+	//
+	// Make room if need be.  The record being replaced is carried over too,
+	// so it is still there if the power goes before the new one is written,
+	// unless there is only room for one of them.
+	//
+	if((g_lActive < 0) || ((g_ulEnd + ulSize) > STORE_BANK_SIZE))
+	{
+		if(Compact(STORE_TAG_FREE))
+		{
+			return(-1);
+		}
+		if(((g_ulEnd + ulSize) > STORE_BANK_SIZE) &&
+		   (Compact(usTag) || ((g_ulEnd + ulSize) > STORE_BANK_SIZE)))
+		{
+			return(-1);
+		}
+	}
+
+	sWriter.ulAddr = BankAddr(g_lActive) + g_ulEnd;
+	sWriter.ulCount = 0;
+	sWriter.lError = 0;
+	WriterPut(&sWriter, &sHeader, sizeof(sHeader));
+	WriterFlush(&sWriter);
+	for(ulPart = 0; ulPart < ulNumParts; ulPart++)
+	{
+		WriterPut(&sWriter, psParts[ulPart].pvData, psParts[ulPart].ulLength);
+	}
+	WriterFlush(&sWriter);
+
+	//
+	// Even a record that failed to program takes up its room
+	//
+	g_ulEnd += ulSize;
+	return(sWriter.lError);
+}
+
+//*****************************************************************************
+//
+// Add bytes to a 32 bit FNV-1a hash.  This checks records, and is handy for
+// telling whether what a record was made from has changed.
+//
+// param ulHash: the hash so far, starting from STORE_HASH_INIT
+// param pvData: the bytes
+// param ulLength: the number of bytes
+// return: the hash with the bytes added
+//
+//*****************************************************************************
+unsigned long
+StoreHash(unsigned long ulHash, const void *pvData, unsigned long ulLength)
+{
+	const unsigned char *pucData;
+
+	pucData = pvData;
+	while(ulLength--)
+	{
+		ulHash = ((ulHash ^ *pucData++) * 16777619UL) & 0xffffffff;
+	}
+	return(ulHash);
+}
@@ -0,0 +1,90 @@
+//*****************************************************************************
+//
+// store.h - Predefines, public functions, and globals for the record log
+// that keeps settings in flash across resets.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __STORE_H__
+#define __STORE_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The flash the log lives in: two banks at the top of flash, which the linker
+// scripts keep the application out of.  Each bank is a whole number of the
+// part's 1 KB erase blocks.
+//
+#define STORE_BASE				0x0003C000
+#define STORE_BANK_SIZE			0x2000
+#define STORE_BLOCK_SIZE		0x400
+
+//
+// The kinds of record kept.  A record whose layout changes gets a new tag, so
+// that one written by older firmware is never read as the new layout.
+// STORE_TAG_CONFIG_2 is the settings record with the analysis and display
+// options added; STORE_TAG_CONFIG is still read if it is all there is.
+//
+#define STORE_TAG_CONFIG		0x0001
+#define STORE_TAG_LAYOUT		0x0002
+#define STORE_TAG_CONFIG_2		0x0003
+
+//
+// The hash StoreHash starts from
+//
+#define STORE_HASH_INIT			2166136261UL
+
+//*****************************************************************************
+//
+// One part of a record being written.  A record can be gathered from several
+// parts, so its pieces don't have to be copied together first.
+//
+//*****************************************************************************
+typedef struct
+{
+	const void *pvData;
+	unsigned long ulLength;
+}
+tStorePart;
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern void StoreInit(void);
+extern long StoreFind(unsigned short usTag);
+extern unsigned long StoreRead(unsigned short usTag, unsigned long ulOffset,
+							   void *pvData, unsigned long ulLength);
+extern long StoreWrite(unsigned short usTag, const tStorePart *psParts,
+					   unsigned long ulNumParts);
+extern unsigned long StoreHash(unsigned long ulHash, const void *pvData,
+							   unsigned long ulLength);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __STORE_H__
@@ -1,269 +0,0 @@
-//*****************************************************************************
-// A 2048 sample wide vector corresponding to a hamming window.
-// Generated using the following formula:
-//   w(n) = 0.54 - 0.46*cos(2*pi*n/(N-1))
-// To be used in conjunction with an array of real data.  For a window intended
-// to be used with an array in format x[0..1] = real[0], imag[0], see the file
-// ti_hamming_window_complex_vector.c
-//*****************************************************************************
-
-const float ti_hamming_window_vector[2048] = {
-0.080000000000000016,	0.080002164847594981,	0.080008659370003496,	0.080019483506096639,	0.080034637153993532,	0.080054120171062254,	0.080077932373921246,	0.080106073538440972,	
-0.080138543399746076,	0.080175341652217860,	0.080216467949497161,	0.080261921904487596,	0.080311703089359240,	0.080365811035552626,	0.080424245233783137,	0.080487005134045858,	
-0.080554090145620719,	0.080625499637078019,	0.080701232936284423,	0.080781289330409303,	0.080865668065931387,	0.080954368348645847,	0.081047389343671880,	0.081144730175460422,	
-0.081246389927802518,	0.081352367643837839,	0.081462662326063792,	0.081577272936344786,	0.081696198395922126,	0.081819437585424107,	0.081946989344876514,	0.082078852473713618,	
-0.082215025730789454,	0.082355507834389427,	0.082500297462242508,	0.082649393251533559,	0.082802793798916238,	0.082960497660526156,	0.083122503351994531,	0.083288809348462070,	
-0.083459414084593411,	0.083634315954591809,	0.083813513312214233,	0.083997004470786923,	0.084184787703221201,	0.084376861242029783,	0.084573223279343343,	0.084773871966927636,	
-0.084978805416200773,	0.085188021698251085,	0.085401518843855245,	0.085619294843496827,	0.085841347647385158,	0.086067675165474700,	0.086298275267484639,	0.086533145782918999,	
-0.086772284501087038,	0.087015689171124080,	0.087263357502012640,	0.087515287162604094,	0.087771475781640504,	0.088031920947777037,	0.088296620209604590,	0.088565571075672908,	
-0.088838771014514012,	0.089116217454666011,	0.089397907784697375,	0.089683839353231404,	0.089974009468971300,	0.090268415400725430,	0.090567054377433009,	0.090869923588190293,	
-0.091177020182276886,	0.091488341269182705,	0.091803883918635115,	0.092123645160626530,	0.092447621985442346,	0.092775811343689313,	0.093108210146324200,	0.093444815264682873,	
-0.093785623530509774,	0.094130631735987708,	0.094479836633768050,	0.094833234937001298,	0.095190823319368040,	0.095552598415110240,	0.095918556819062903,	0.096288695086686166,	
-0.096663009734097680,	0.097041497238105429,	0.097424154036240884,	0.097810976526792520,	0.098201961068839744,	0.098597103982287132,	0.098996401547899099,	0.099399850007334881,	
-0.099807445563183939,	0.100219184379001652,	0.100635062579345486,	0.101055076249811429,	0.101479221437070846,	0.101907494148907721,	0.102339890354256169,	0.102776405983238422,	
-0.103217036927203146,	0.103661779038764085,	0.104110628131839092,	0.104563579981689567,	0.105020630324960201,	0.105481774859719088,	0.105947009245498255,	0.106416329103334456,	
-0.106889730015810452,	0.107367207527096581,	0.107848757142992649,	0.108334374330970290,	0.108824054520215555,	0.109317793101672028,	0.109815585428084131,	0.110317426814040914,	
-0.110823312536020124,	0.111333237832432694,	0.111847197903667497,	0.112365187912136635,	0.112887202982320856,	0.113413238200815517,	0.113943288616376801,	0.114477349239968329,	
-0.115015415044808111,	0.115557480966415868,	0.116103541902660715,	0.116653592713809165,	0.117207628222573454,	0.117765643214160401,	0.118327632436320385,	0.118893590599396817,	
-0.119463512376375924,	0.120037392402936857,	0.120615225277502278,	0.121197005561289109,	0.121782727778359717,	0.122372386415673551,	0.122965975923138945,	0.123563490713665375,	
-0.124164925163216075,	0.124770273610860960,	0.125379530358829872,	0.125992689672566327,	0.126609745780781241,	0.127230692875507617,	0.127855525112154839,	0.128484236609563984,	
-0.129116821450062952,	0.129753273679522357,	0.130393587307411379,	0.131037756306854325,	0.131685774614687195,	0.132337636131514919,	0.132993334721768636,	0.133652864213763489,	
-0.134316218399756687,	0.134983391036006067,	0.135654375842828606,	0.136329166504659816,	0.137007756670112973,	0.137690139952038992,	0.138376309927586566,	0.139066260138262537,	
-0.139759984089992767,	0.140457475253183195,	0.141158727062781403,	0.141863732918338231,	0.142572486184070119,	0.143284980188921357,	0.144001208226627070,	0.144721163555776133,	
-0.145444839399874848,	0.146172228947410554,	0.146903325351915776,	0.147638121732032723,	0.148376611171578049,	0.149118786719607876,	0.149864641390483277,	0.150614168163936052,	
-0.151367359985134758,	0.152124209764751106,	0.152884710379026734,	0.153648854669840240,	0.154416635444774519,	0.155188045477184511,	0.155963077506265202,	0.156741724237119961,	
-0.157523978340829207,	0.158309832454519406,	0.159099279181432351,	0.159892311090994804,	0.160688920718888378,	0.161489100567119875,	0.162292843104091866,	0.163100140764673412,	
-0.163910985950271509,	0.164725371028902473,	0.165543288335263772,	0.166364730170806219,	0.167189688803806413,	0.168018156469439517,	0.168850125369852333,	0.169685587674236749,	
-0.170524535518903370,	0.171366961007355517,	0.172212856210363696,	0.173062213166040119,	0.173915023879913588,	0.174771280325004913,	0.175630974441902316,	0.176494098138837374,	
-0.177360643291761128,	0.178230601744420541,	0.179103965308435392,	0.179980725763375177,	0.180860874856836551,	0.181744404304521073,	0.182631305790313087,	0.183521570966358044,	
-0.184415191453141003,	0.185312158839565672,	0.186212464683033374,	0.187116100509522626,	0.188023057813668903,	0.188933328058844607,	0.189846902677239582,	0.190763773069941522,	
-0.191683930607017133,	0.192607366627593202,	0.193534072439938282,	0.194464039321544269,	0.195397258519208722,	0.196333721249117132,	0.197273418696925662,	0.198216342017844022,	
-0.199162482336718821,	0.200111830748117059,	0.201064378316409886,	0.202020116075856820,	0.202979035030690119,	0.203941126155199326,	0.204906380393816423,	0.205874788661200847,	
-0.206846341842325226,	0.207821030792560951,	0.208798846337764438,	0.209779779274363420,	0.210763820369443439,	0.211750960360834961,	0.212741189957200455,	0.213734499838121816,	
-0.214730880654188161,	0.215730323027083726,	0.216732817549676354,	0.217738354786105731,	0.218746925271872478,	0.219758519513927025,	0.220773127990759155,	0.221790741152487425,	
-0.222811349420949212,	0.223834943189790803,	0.224861512824557824,	0.225891048662785893,	0.226923541014091595,	0.227958980160263697,	0.228997356355354648,	0.230038659825772179,	
-0.231082880770371535,	0.232130009360547424,	0.233180035740326752,	0.234232950026461356,	0.235288742308520982,	0.236347402648986571,	0.237408921083343799,	0.238473287620176916,	
-0.239540492241262670,	0.240610524901664763,	0.241683375529828243,	0.242759034027674486,	0.243837490270695928,	0.244918734108051761,	0.246002755362663167,	0.247089543831309238,	
-0.248179089284723070,	0.249271381467687847,	0.250366410099133574,	0.251464164872233664,	0.252564635454502251,	0.253667811487890971,	0.254773682588886996,	0.255882238348610180,	
-0.256993468332911645,	0.258107362082471536,	0.259223909112897666,	0.260343098914824100,	0.261464920954010249,	0.262589364671439784,	0.263716419483420283,	0.264846074781682539,	
-0.265978319933480645,	0.267113144281692083,	0.268250537144917867,	0.269390487817583180,	0.270532985570038131,	0.271678019648658786,	0.272825579275948304,	0.273975653650638418,	
-0.275128231947791124,	0.276283303318900553,	0.277440856891995047,	0.278600881771739473,	0.279763367039537914,	0.280928301753636311,	0.282095674949225439,	0.283265475638544206,	
-0.284437692810982967,	0.285612315433187325,	0.286789332449161771,	0.287968732780373882,	0.289150505325858620,	0.290334638962322644,	0.291521122544249223,	0.292709944904003094,	
-0.293901094851935218,	0.295094561176488912,	0.296290332644304377,	0.297488398000325394,	0.298688745967904346,	0.299891365248908970,	0.301096244523828827,	0.302303372451881047,	
-0.303512737671118027,	0.304724328798533561,	0.305938134430170761,	0.307154143141228519,	0.308372343486169931,	0.309592723998829200,	0.310815273192520336,	0.312039979560144676,	
-0.313266831574299298,	0.314495817687386103,	0.315726926331719449,	0.316960145919636116,	0.318195464843603504,	0.319432871476329594,	0.320672354170871809,	0.321913901260746982,	
-0.323157501060041041,	0.324403141863519151,	0.325650811946735619,	0.326900499566144309,	0.328152192959209610,	0.329405880344516455,	0.330661549921881848,	0.331919189872465381,	
-0.333178788358880984,	0.334440333525307831,	0.335703813497602588,	0.336969216383410375,	0.338236530272277292,	0.339505743235762547,	0.340776843327550094,	0.342049818583562037,	
-0.343324657022070212,	0.344601346643809980,	0.345879875432092143,	0.347160231352917015,	0.348442402355086889,	0.349726376370320113,	0.351012141313364223,	0.352299685082109792,	
-0.353588995557704733,	0.354880060604667535,	0.356172868071002513,	0.357467405788313208,	0.358763661571917913,	0.360061623220963190,	0.361361278518539941,	0.362662615231797270,	
-0.363965621112058713,	0.365270283894936543,	0.366576591300447618,	0.367884531033129347,	0.369194090782154705,	0.370505258221448752,	0.371818021009803990,	0.373132366790997316,	
-0.374448283193905440,	0.375765757832622227,	0.377084778306574386,	0.378405332200639155,	0.379727407085260149,	0.381050990516565047,	0.382376070036482607,	0.383702633172859631,	
-0.385030667439578811,	0.386360160336675640,	0.387691099350456869,	0.389023471953617417,	0.390357265605359049,	0.391692467751507845,	0.393029065824632817,	0.394367047244163771,	
-0.395706399416509924,	0.397047109735178760,	0.398389165580893934,	0.399732554321714950,	0.401077263313155075,	0.402423279898301400,	0.403770591407933033,	0.405119185160641049,	
-0.406469048462947347,	0.407820168609424438,	0.409172532882815021,	0.410526128554151326,	0.411880942882875634,	0.413236963116959233,	0.414594176493023492,	0.415952570236459040,	
-0.417312131561546784,	0.418672847671577530,	0.420034705758973281,	0.421397693005406915,	0.422761796581923310,	0.424127003649060252,	0.425493301356968723,	0.426860676845534526,	
-0.428229117244498581,	0.429598609673578935,	0.430969141242591058,	0.432340699051570021,	0.433713270190891231,	0.435086841741392560,	0.436461400774495356,	0.437836934352326401,	
-0.439213429527839927,	0.440590873344939016,	0.441969252838598003,	0.443348555034983938,	0.444728766951579479,	0.446109875597304195,	0.447491867972637736,	0.448874731069741295,	
-0.450258451872581011,	0.451643017357049537,	0.453028414491089160,	0.454414630234814598,	0.455801651540635178,	0.457189465353378233,	0.458578058610411565,	0.459967418241766679,	
-0.461357531170261403,	0.462748384311623684,	0.464139964574613817,	0.465532258861148573,	0.466925254066423767,	0.468318937079037989,	0.469713294781116064,	0.471108314048432064,	
-0.472503981750533653,	0.473900284750864542,	0.475297209906889395,	0.476694744070216392,	0.478092874086721964,	0.479491586796673752,	0.480890869034855173,	0.482290707630688764,	
-0.483691089408360531,	0.485092001186944011,	0.486493429780523789,	0.487895361998320454,	0.489297784644813771,	0.490700684519867980,	0.492104048418854856,	0.493507863132779223,	
-0.494912115448402079,	0.496316792148366048,	0.497721880011319007,	0.499127365812038704,	0.500533236321557662,	0.501939478307287135,	0.503346078533142172,	0.504753023759665465,	
-0.506160300744152969,	0.507567896240777583,	0.508975797000714492,	0.510383989772265623,	0.511792461300984103,	0.513201198329799602,	0.514610187599142566,	0.516019415847069673,	
-0.517428869809387737,	0.518838536219779267,	0.520248401809927152,	0.521658453309639669,	0.523068677446974939,	0.524479060948366271,	0.525889590538747176,	0.527300252941675707,	
-0.528711034879460362,	0.530121923073283985,	0.531532904243329773,	0.532943965108905404,	0.534355092388568820,	0.535766272800252463,	0.537177493061388955,	0.538588739889035661,	
-0.540000000000000036,	0.541411260110964410,	0.542822506938611005,	0.544233727199747608,	0.545644907611431140,	0.547056034891094556,	0.548467095756670187,	0.549878076926715975,	
-0.551288965120539598,	0.552699747058324253,	0.554110409461252784,	0.555520939051633689,	0.556931322553025132,	0.558341546690360291,	0.559751598190072808,	0.561161463780220693,	
-0.562571130190612334,	0.563980584152930287,	0.565389812400857394,	0.566798801670200469,	0.568207538699015968,	0.569616010227734337,	0.571024202999285468,	0.572432103759222377,	
-0.573839699255846991,	0.575246976240334496,	0.576653921466857788,	0.578060521692712825,	0.579466763678442298,	0.580872634187961312,	0.582278119988681064,	0.583683207851633967,	
-0.585087884551597992,	0.586492136867220792,	0.587895951581145160,	0.589299315480132035,	0.590702215355186300,	0.592104638001679562,	0.593506570219476171,	0.594907998813056005,	
-0.596308910591639485,	0.597709292369311251,	0.599109130965144843,	0.600508413203326263,	0.601907125913277996,	0.603305255929783679,	0.604702790093110676,	0.606099715249135529,	
-0.607496018249466418,	0.608891685951567951,	0.610286705218883951,	0.611681062920962026,	0.613074745933576248,	0.614467741138851498,	0.615860035425386254,	0.617251615688376387,	
-0.618642468829738612,	0.620032581758233392,	0.621421941389588506,	0.622810534646621727,	0.624198348459364838,	0.625585369765185417,	0.626971585508910856,	0.628356982642950479,	
-0.629741548127419004,	0.631125268930258665,	0.632508132027362335,	0.633890124402695765,	0.635271233048420481,	0.636651444965016022,	0.638030747161402068,	0.639409126655061000,	
-0.640786570472160033,	0.642163065647673670,	0.643538599225504715,	0.644913158258607400,	0.646286729809108729,	0.647659300948429939,	0.649030858757408957,	0.650401390326421081,	
-0.651770882755501435,	0.653139323154465545,	0.654506698643031348,	0.655872996350939763,	0.657238203418076705,	0.658602306994593101,	0.659965294241026790,	0.661327152328422541,	
-0.662687868438453287,	0.664047429763541031,	0.665405823506976524,	0.666763036883040838,	0.668119057117124382,	0.669473871445848689,	0.670827467117184995,	0.672179831390575577,	
-0.673530951537052669,	0.674880814839359022,	0.676229408592067038,	0.677576720101698671,	0.678922736686844996,	0.680267445678285121,	0.681610834419106082,	0.682952890264821311,	
-0.684293600583490091,	0.685632952755836245,	0.686970934175367254,	0.688307532248492171,	0.689642734394640966,	0.690976528046382654,	0.692308900649543091,	0.693639839663324320,	
-0.694969332560421260,	0.696297366827140385,	0.697623929963517408,	0.698949009483434969,	0.700272592914739866,	0.701594667799360860,	0.702915221693425685,	0.704234242167377844,	
-0.705551716806094631,	0.706867633209002699,	0.708181978990195971,	0.709494741778551208,	0.710805909217845255,	0.712115468966870613,	0.713423408699552453,	0.714729716105063528,	
-0.716034378887941303,	0.717337384768202746,	0.718638721481460130,	0.719938376779036826,	0.721236338428082102,	0.722532594211686807,	0.723827131928997503,	0.725119939395332480,	
-0.726411004442295338,	0.727700314917890223,	0.728987858686635737,	0.730273623629679958,	0.731557597644913016,	0.732839768647083112,	0.734120124567907872,	0.735398653356190035,	
-0.736675342977929692,	0.737950181416438089,	0.739223156672449977,	0.740494256764237524,	0.741763469727722669,	0.743030783616589696,	0.744296186502397483,	0.745559666474692073,	
-0.746821211641119143,	0.748080810127534690,	0.749338450078118168,	0.750594119655483505,	0.751847807040790461,	0.753099500433855762,	0.754349188053264452,	0.755596858136480809,	
-0.756842498939959030,	0.758086098739253034,	0.759327645829128151,	0.760567128523670477,	0.761804535156396456,	0.763039854080363900,	0.764273073668280456,	0.765504182312613968,	
-0.766733168425700606,	0.767960020439855340,	0.769184726807479513,	0.770407276001170760,	0.771627656513830029,	0.772845856858771385,	0.774061865569829255,	0.775275671201466454,	
-0.776487262328881989,	0.777696627548118857,	0.778903755476171300,	0.780108634751091046,	0.781311254032095670,	0.782511601999674511,	0.783709667355695583,	0.784905438823511048,	
-0.786098905148064686,	0.787290055095997032,	0.788478877455750737,	0.789665361037677260,	0.790849494674141229,	0.792031267219626134,	0.793210667550838244,	0.794387684566812635,	
-0.795562307189016882,	0.796734524361455865,	0.797904325050774577,	0.799071698246363593,	0.800236632960462102,	0.801399118228260487,	0.802559143108004913,	0.803716696681099352,	
-0.804871768052208836,	0.806024346349361598,	0.807174420724051656,	0.808321980351341285,	0.809467014429961940,	0.810609512182416836,	0.811749462855082093,	0.812886855718307988,	
-0.814021680066519315,	0.815153925218317421,	0.816283580516579677,	0.817410635328560176,	0.818535079045989766,	0.819656901085175860,	0.820776090887102461,	0.821892637917528535,	
-0.823006531667088370,	0.824117761651389724,	0.825226317411113075,	0.826332188512108989,	0.827435364545497709,	0.828535835127766185,	0.829633589900866442,	0.830728618532312169,	
-0.831820910715276862,	0.832910456168690860,	0.833997244637336821,	0.835081265891948199,	0.836162509729304060,	0.837240965972325557,	0.838316624470171745,	0.839389475098335169,	
-0.840459507758737234,	0.841526712379823127,	0.842591078916656189,	0.843652597351013389,	0.844711257691479034,	0.845767049973538687,	0.846819964259673208,	0.847869990639452564,	
-0.848917119229628536,	0.849961340174227753,	0.851002643644645285,	0.852041019839736236,	0.853076458985908448,	0.854108951337214095,	0.855138487175442163,	0.856165056810209268,	
-0.857188650579050804,	0.858209258847512535,	0.859226872009240750,	0.860241480486072962,	0.861253074728127510,	0.862261645213894257,	0.863267182450323523,	0.864269676972916345,	
-0.865269119345811855,	0.866265500161878199,	0.867258810042799699,	0.868249039639165110,	0.869236179630556549,	0.870220220725636540,	0.871201153662235606,	0.872178969207439092,	
-0.873153658157674761,	0.874125211338799057,	0.875093619606183704,	0.876058873844800745,	0.877020964969309924,	0.877979883924143278,	0.878935621683590185,	0.879888169251882957,	
-0.880837517663281111,	0.881783657982156077,	0.882726581303074354,	0.883666278750882883,	0.884602741480791210,	0.885535960678455858,	0.886465927560061817,	0.887392633372406814,	
-0.888316069392983021,	0.889236226930058549,	0.890153097322760489,	0.891066671941155408,	0.891976942186331168,	0.892883899490477417,	0.893787535316966641,	0.894687841160434316,	
-0.895584808546859068,	0.896478429033642055,	0.897368694209686901,	0.898255595695478970,	0.899139125143163520,	0.900019274236624867,	0.900896034691564540,	0.901769398255579557,	
-0.902639356708238916,	0.903505901861162641,	0.904369025558097617,	0.905228719674995186,	0.906084976120086427,	0.906937786833959869,	0.907787143789636430,	0.908633038992644582,	
-0.909475464481096618,	0.910314412325763267,	0.911149874630147738,	0.911981843530560554,	0.912810311196193602,	0.913635269829193741,	0.914456711664736299,	0.915274628971097570,	
-0.916089014049728534,	0.916899859235326686,	0.917707156895908205,	0.918510899432880112,	0.919311079281111554,	0.920107688909005295,	0.920900720818567664,	0.921690167545480610,	
-0.922476021659170864,	0.923258275762880110,	0.924036922493734814,	0.924811954522815505,	0.925583364555225607,	0.926351145330159831,	0.927115289620973337,	0.927875790235248910,	
-0.928632640014865340,	0.929385831836063936,	0.930135358609516794,	0.930881213280392195,	0.931623388828421994,	0.932361878267967348,	0.933096674648084212,	0.933827771052589517,	
-0.934555160600125223,	0.935278836444223938,	0.935998791773372973,	0.936715019811078742,	0.937427513815929925,	0.938136267081661757,	0.938841272937218752,	0.939542524746816876,	
-0.940240015910007276,	0.940933739861737450,	0.941623690072413533,	0.942309860047961023,	0.942992243329887070,	0.943670833495340200,	0.944345624157171493,	0.945016608963993976,	
-0.945683781600243356,	0.946347135786236637,	0.947006665278231408,	0.947662363868485125,	0.948314225385312848,	0.948962243693145746,	0.949606412692588719,	0.950246726320477686,	
-0.950883178549937091,	0.951515763390436087,	0.952144474887845260,	0.952769307124492371,	0.953390254219218858,	0.954007310327433800,	0.954620469641170200,	0.955229726389139056,	
-0.955835074836783982,	0.956436509286334724,	0.957034024076861112,	0.957627613584326465,	0.958217272221640326,	0.958802994438710976,	0.959384774722497724,	0.959962607597063200,	
-0.960536487623624202,	0.961106409400603212,	0.961672367563679686,	0.962234356785839684,	0.962792371777426603,	0.963346407286190920,	0.963896458097339259,	0.964442519033584245,	
-0.964984584955191904,	0.965522650760031742,	0.966056711383623257,	0.966586761799184568,	0.967112797017679160,	0.967634812087863394,	0.968152802096332588,	0.968666762167567419,	
-0.969176687463979891,	0.969682573185959074,	0.970184414571915954,	0.970682206898328070,	0.971175945479784475,	0.971665625669029809,	0.972151242857007380,	0.972632792472903462,	
-0.973110269984189591,	0.973583670896665643,	0.974052990754501802,	0.974518225140280969,	0.974979369675039842,	0.975436420018310546,	0.975889371868160937,	0.976338220961235903,	
-0.976782963072796884,	0.977223594016761621,	0.977660109645743902,	0.978092505851092309,	0.978520778562929183,	0.978944923750188600,	0.979364937420654558,	0.979780815620998391,	
-0.980192554436816188,	0.980600149992665204,	0.981003598452100944,	0.981402896017712911,	0.981798038931160355,	0.982189023473207579,	0.982575845963759131,	0.982958502761894670,	
-0.983336990265902378,	0.983711304913313933,	0.984081443180937154,	0.984447401584889858,	0.984809176680632059,	0.985166765062998717,	0.985520163366232049,	0.985869368264012391,	
-0.986214376469490284,	0.986555184735317114,	0.986891789853675871,	0.987224188656310786,	0.987552378014557752,	0.987876354839373527,	0.988196116081364928,	0.988511658730817366,	
-0.988822979817723158,	0.989130076411809833,	0.989432945622567006,	0.989731584599274683,	0.990025990531028688,	0.990316160646768640,	0.990602092215302710,	0.990883782545334046,	
-0.991161228985486087,	0.991434428924327205,	0.991703379790395467,	0.991968079052223062,	0.992228524218359609,	0.992484712837396033,	0.992736642497987432,	0.992984310828875949,	
-0.993227715498912977,	0.993466854217081030,	0.993701724732515390,	0.993932324834525427,	0.994158652352614913,	0.994380705156503231,	0.994598481156144798,	0.994811978301748945,	
-0.995021194583799340,	0.995226128033072421,	0.995426776720656714,	0.995623138757970261,	0.995815212296778829,	0.996002995529213120,	0.996186486687785866,	0.996365684045408262,	
-0.996540585915406618,	0.996711190651538015,	0.996877496648005512,	0.997039502339473915,	0.997197206201083874,	0.997350606748466539,	0.997499702537757549,	0.997644492165610686,	
-0.997784974269210645,	0.997921147526286467,	0.998053010655123529,	0.998180562414575978,	0.998303801604077945,	0.998422727063655313,	0.998537337673936265,	0.998647632356162274,	
-0.998753610072197540,	0.998855269824539649,	0.998952610656328233,	0.999045631651354182,	0.999134331934068642,	0.999218710669590782,	0.999298767063715676,	0.999374500362922080,	
-0.999445909854379311,	0.999512994865954241,	0.999575754766216962,	0.999634188964447445,	0.999688296910640872,	0.999738078095512517,	0.999783532050502854,	0.999824658347782225,	
-0.999861456600254050,	0.999893926461559057,	0.999922067626078825,	0.999945879828937789,	0.999965362846006567,	0.999980516493903404,	0.999991340629996617,	0.999997835152405146,	
-1.000000000000000000,	0.999997835152405146,	0.999991340629996617,	0.999980516493903404,	0.999965362846006567,	0.999945879828937789,	0.999922067626078825,	0.999893926461559057,	
-0.999861456600254050,	0.999824658347782225,	0.999783532050502965,	0.999738078095512517,	0.999688296910640872,	0.999634188964447445,	0.999575754766216962,	0.999512994865954241,	
-0.999445909854379311,	0.999374500362922080,	0.999298767063715676,	0.999218710669590782,	0.999134331934068753,	0.999045631651354182,	0.998952610656328233,	0.998855269824539649,	
-0.998753610072197540,	0.998647632356162274,	0.998537337673936265,	0.998422727063655313,	0.998303801604077945,	0.998180562414575978,	0.998053010655123529,	0.997921147526286467,	
-0.997784974269210645,	0.997644492165610686,	0.997499702537757549,	0.997350606748466539,	0.997197206201083874,	0.997039502339473915,	0.996877496648005512,	0.996711190651538015,	
-0.996540585915406618,	0.996365684045408262,	0.996186486687785866,	0.996002995529213120,	0.995815212296778829,	0.995623138757970261,	0.995426776720656714,	0.995226128033072421,	
-0.995021194583799340,	0.994811978301749056,	0.994598481156144798,	0.994380705156503231,	0.994158652352614913,	0.993932324834525427,	0.993701724732515390,	0.993466854217081030,	
-0.993227715498913089,	0.992984310828875949,	0.992736642497987432,	0.992484712837396033,	0.992228524218359609,	0.991968079052223062,	0.991703379790395467,	0.991434428924327205,	
-0.991161228985486087,	0.990883782545334046,	0.990602092215302710,	0.990316160646768640,	0.990025990531028799,	0.989731584599274683,	0.989432945622567117,	0.989130076411809833,	
-0.988822979817723158,	0.988511658730817366,	0.988196116081364928,	0.987876354839373527,	0.987552378014557752,	0.987224188656310786,	0.986891789853675871,	0.986555184735317225,	
-0.986214376469490284,	0.985869368264012391,	0.985520163366232049,	0.985166765062998717,	0.984809176680632059,	0.984447401584889858,	0.984081443180937154,	0.983711304913313933,	
-0.983336990265902378,	0.982958502761894670,	0.982575845963759131,	0.982189023473207579,	0.981798038931160355,	0.981402896017713022,	0.981003598452100944,	0.980600149992665204,	
-0.980192554436816188,	0.979780815620998391,	0.979364937420654558,	0.978944923750188711,	0.978520778562929294,	0.978092505851092309,	0.977660109645743902,	0.977223594016761621,	
-0.976782963072796995,	0.976338220961236014,	0.975889371868161049,	0.975436420018310546,	0.974979369675039842,	0.974518225140280969,	0.974052990754501802,	0.973583670896665643,	
-0.973110269984189591,	0.972632792472903462,	0.972151242857007492,	0.971665625669029809,	0.971175945479784475,	0.970682206898328070,	0.970184414571915954,	0.969682573185959185,	
-0.969176687463980002,	0.968666762167567419,	0.968152802096332588,	0.967634812087863394,	0.967112797017679271,	0.966586761799184568,	0.966056711383623368,	0.965522650760031742,	
-0.964984584955192015,	0.964442519033584245,	0.963896458097339370,	0.963346407286190920,	0.962792371777426603,	0.962234356785839684,	0.961672367563679686,	0.961106409400603212,	
-0.960536487623624202,	0.959962607597063311,	0.959384774722497835,	0.958802994438710976,	0.958217272221640437,	0.957627613584326465,	0.957034024076861112,	0.956436509286334724,	
-0.955835074836784093,	0.955229726389139056,	0.954620469641170200,	0.954007310327433800,	0.953390254219218858,	0.952769307124492482,	0.952144474887845260,	0.951515763390436087,	
-0.950883178549937091,	0.950246726320477686,	0.949606412692588719,	0.948962243693145857,	0.948314225385312848,	0.947662363868485125,	0.947006665278231519,	0.946347135786236637,	
-0.945683781600243356,	0.945016608963994087,	0.944345624157171493,	0.943670833495340200,	0.942992243329887070,	0.942309860047961134,	0.941623690072413533,	0.940933739861737561,	
-0.940240015910007276,	0.939542524746816876,	0.938841272937218752,	0.938136267081661868,	0.937427513815930036,	0.936715019811078742,	0.935998791773372973,	0.935278836444223938,	
-0.934555160600125223,	0.933827771052589628,	0.933096674648084323,	0.932361878267967348,	0.931623388828422105,	0.930881213280392306,	0.930135358609516794,	0.929385831836064047,	
-0.928632640014865340,	0.927875790235248910,	0.927115289620973337,	0.926351145330159831,	0.925583364555225607,	0.924811954522815616,	0.924036922493734925,	0.923258275762880221,	
-0.922476021659170975,	0.921690167545480610,	0.920900720818567775,	0.920107688909005295,	0.919311079281111665,	0.918510899432880223,	0.917707156895908205,	0.916899859235326686,	
-0.916089014049728534,	0.915274628971097681,	0.914456711664736410,	0.913635269829193852,	0.912810311196193713,	0.911981843530560554,	0.911149874630147849,	0.910314412325763267,	
-0.909475464481096729,	0.908633038992644582,	0.907787143789636430,	0.906937786833959980,	0.906084976120086538,	0.905228719674995186,	0.904369025558097728,	0.903505901861162641,	
-0.902639356708239027,	0.901769398255579557,	0.900896034691564651,	0.900019274236624867,	0.899139125143163520,	0.898255595695479081,	0.897368694209687012,	0.896478429033642055,	
-0.895584808546859179,	0.894687841160434316,	0.893787535316966752,	0.892883899490477528,	0.891976942186331279,	0.891066671941155408,	0.890153097322760489,	0.889236226930058660,	
-0.888316069392983021,	0.887392633372406814,	0.886465927560061817,	0.885535960678455858,	0.884602741480791321,	0.883666278750882883,	0.882726581303074465,	0.881783657982156077,	
-0.880837517663281222,	0.879888169251883068,	0.878935621683590296,	0.877979883924143389,	0.877020964969309924,	0.876058873844800745,	0.875093619606183704,	0.874125211338799168,	
-0.873153658157674872,	0.872178969207439203,	0.871201153662235717,	0.870220220725636651,	0.869236179630556660,	0.868249039639165221,	0.867258810042799699,	0.866265500161878310,	
-0.865269119345811966,	0.864269676972916456,	0.863267182450323634,	0.862261645213894368,	0.861253074728127621,	0.860241480486073073,	0.859226872009240861,	0.858209258847512646,	
-0.857188650579050915,	0.856165056810209379,	0.855138487175442275,	0.854108951337214206,	0.853076458985908559,	0.852041019839736347,	0.851002643644645396,	0.849961340174227864,	
-0.848917119229628647,	0.847869990639452675,	0.846819964259673319,	0.845767049973538798,	0.844711257691479145,	0.843652597351013500,	0.842591078916656300,	0.841526712379823238,	
-0.840459507758737567,	0.839389475098335280,	0.838316624470171745,	0.837240965972325668,	0.836162509729304171,	0.835081265891948532,	0.833997244637337043,	0.832910456168690749,	
-0.831820910715277195,	0.830728618532312280,	0.829633589900866442,	0.828535835127766518,	0.827435364545497820,	0.826332188512108989,	0.825226317411113186,	0.824117761651389835,	
-0.823006531667088592,	0.821892637917528646,	0.820776090887102350,	0.819656901085176082,	0.818535079045989877,	0.817410635328560176,	0.816283580516579899,	0.815153925218317532,	
-0.814021680066519315,	0.812886855718308099,	0.811749462855082204,	0.810609512182417169,	0.809467014429962051,	0.808321980351341285,	0.807174420724051989,	0.806024346349361709,	
-0.804871768052208836,	0.803716696681099685,	0.802559143108005024,	0.801399118228260487,	0.800236632960462213,	0.799071698246363815,	0.797904325050774799,	0.796734524361455976,	
-0.795562307189017104,	0.794387684566812968,	0.793210667550838355,	0.792031267219626134,	0.790849494674141562,	0.789665361037677371,	0.788478877455750737,	0.787290055095997143,	
-0.786098905148064797,	0.784905438823511381,	0.783709667355695694,	0.782511601999674622,	0.781311254032096003,	0.780108634751091157,	0.778903755476171189,	0.777696627548119190,	
-0.776487262328882100,	0.775275671201466343,	0.774061865569829477,	0.772845856858771496,	0.771627656513830362,	0.770407276001170982,	0.769184726807479735,	0.767960020439855673,	
-0.766733168425700828,	0.765504182312613968,	0.764273073668280789,	0.763039854080364011,	0.761804535156396456,	0.760567128523670588,	0.759327645829128262,	0.758086098739253256,	
-0.756842498939959030,	0.755596858136480920,	0.754349188053264674,	0.753099500433855762,	0.751847807040790350,	0.750594119655483727,	0.749338450078118279,	0.748080810127534579,	
-0.746821211641119254,	0.745559666474692184,	0.744296186502397705,	0.743030783616589807,	0.741763469727722780,	0.740494256764237746,	0.739223156672449977,	0.737950181416437978,	
-0.736675342977930026,	0.735398653356190146,	0.734120124567907761,	0.732839768647083223,	0.731557597644913127,	0.730273623629680180,	0.728987858686635959,	0.727700314917890223,	
-0.726411004442295560,	0.725119939395332591,	0.723827131928997503,	0.722532594211687029,	0.721236338428082213,	0.719938376779036715,	0.718638721481460241,	0.717337384768202746,	
-0.716034378887941636,	0.714729716105063750,	0.713423408699552453,	0.712115468966870946,	0.710805909217845366,	0.709494741778551208,	0.708181978990196193,	0.706867633209002810,	
-0.705551716806094520,	0.704234242167377955,	0.702915221693425685,	0.701594667799360749,	0.700272592914740089,	0.698949009483434969,	0.697623929963517742,	0.696297366827140496,	
-0.694969332560421260,	0.693639839663324542,	0.692308900649543202,	0.690976528046382543,	0.689642734394641188,	0.688307532248492171,	0.686970934175367143,	0.685632952755836467,	
-0.684293600583490091,	0.682952890264821533,	0.681610834419106193,	0.680267445678285121,	0.678922736686845107,	0.677576720101698671,	0.676229408592066927,	0.674880814839359133,	
-0.673530951537052780,	0.672179831390575466,	0.670827467117185217,	0.669473871445848689,	0.668119057117124715,	0.666763036883040838,	0.665405823506976524,	0.664047429763541142,	
-0.662687868438453398,	0.661327152328422430,	0.659965294241026901,	0.658602306994593212,	0.657238203418076594,	0.655872996350939985,	0.654506698643031348,	0.653139323154465767,	
-0.651770882755501546,	0.650401390326421081,	0.649030858757409179,	0.647659300948430050,	0.646286729809108729,	0.644913158258607622,	0.643538599225504826,	0.642163065647673559,	
-0.640786570472160255,	0.639409126655061000,	0.638030747161402290,	0.636651444965016133,	0.635271233048420592,	0.633890124402695987,	0.632508132027362446,	0.631125268930258665,	
-0.629741548127419226,	0.628356982642950590,	0.626971585508910745,	0.625585369765185639,	0.624198348459364838,	0.622810534646622060,	0.621421941389588617,	0.620032581758233392,	
-0.618642468829738834,	0.617251615688376498,	0.615860035425386143,	0.614467741138851720,	0.613074745933576359,	0.611681062920961915,	0.610286705218884173,	0.608891685951567951,	
-0.607496018249466752,	0.606099715249135640,	0.604702790093110676,	0.603305255929783901,	0.601907125913278218,	0.600508413203326152,	0.599109130965145065,	0.597709292369311362,	
-0.596308910591639374,	0.594907998813056227,	0.593506570219476282,	0.592104638001679895,	0.590702215355186411,	0.589299315480132035,	0.587895951581145382,	0.586492136867220903,	
-0.585087884551597881,	0.583683207851634189,	0.582278119988681175,	0.580872634187961201,	0.579466763678442520,	0.578060521692712825,	0.576653921466858121,	0.575246976240334607,	
-0.573839699255846991,	0.572432103759222599,	0.571024202999285579,	0.569616010227734448,	0.568207538699016190,	0.566798801670200580,	0.565389812400857283,	0.563980584152930509,	
-0.562571130190612334,	0.561161463780221026,	0.559751598190072919,	0.558341546690360291,	0.556931322553025354,	0.555520939051633800,	0.554110409461252784,	0.552699747058324475,	
-0.551288965120539709,	0.549878076926715864,	0.548467095756670409,	0.547056034891094556,	0.545644907611431473,	0.544233727199747719,	0.542822506938611116,	0.541411260110964632,	
-0.540000000000000147,	0.538588739889035661,	0.537177493061389177,	0.535766272800252574,	0.534355092388568820,	0.532943965108905626,	0.531532904243329885,	0.530121923073284318,	
-0.528711034879460473,	0.527300252941675818,	0.525889590538747398,	0.524479060948366382,	0.523068677446974939,	0.521658453309639891,	0.520248401809927263,	0.518838536219779156,	
-0.517428869809387959,	0.516019415847069673,	0.514610187599142899,	0.513201198329799713,	0.511792461300984103,	0.510383989772265845,	0.508975797000714603,	0.507567896240777583,	
-0.506160300744153191,	0.504753023759665576,	0.503346078533142061,	0.501939478307287357,	0.500533236321557662,	0.499127365812038981,	0.497721880011319118,	0.496316792148366048,	
-0.494912115448402412,	0.493507863132779334,	0.492104048418854856,	0.490700684519868147,	0.489297784644813882,	0.487895361998320343,	0.486493429780524012,	0.485092001186944011,	
-0.483691089408360864,	0.482290707630688875,	0.480890869034855173,	0.479491586796674030,	0.478092874086722075,	0.476694744070216392,	0.475297209906889617,	0.473900284750864653,	
-0.472503981750533542,	0.471108314048432286,	0.469713294781116064,	0.468318937079038322,	0.466925254066423878,	0.465532258861148573,	0.464139964574614095,	0.462748384311623795,	
-0.461357531170261403,	0.459967418241766901,	0.458578058610411676,	0.457189465353378177,	0.455801651540635344,	0.454414630234814598,	0.453028414491089437,	0.451643017357049648,	
-0.450258451872581011,	0.448874731069741628,	0.447491867972637847,	0.446109875597304251,	0.444728766951579702,	0.443348555034984049,	0.441969252838597892,	0.440590873344939238,	
-0.439213429527839927,	0.437836934352326679,	0.436461400774495467,	0.435086841741392560,	0.433713270190891564,	0.432340699051570132,	0.430969141242591058,	0.429598609673579157,	
-0.428229117244498692,	0.426860676845534415,	0.425493301356968889,	0.424127003649060252,	0.422761796581923588,	0.421397693005407026,	0.420034705758973281,	0.418672847671577808,	
-0.417312131561546840,	0.415952570236459040,	0.414594176493023714,	0.413236963116959344,	0.411880942882875523,	0.410526128554151493,	0.409172532882815021,	0.407820168609424716,	
-0.406469048462947458,	0.405119185160641049,	0.403770591407933310,	0.402423279898301511,	0.401077263313155075,	0.399732554321715117,	0.398389165580894045,	0.397047109735178649,	
-0.395706399416510091,	0.394367047244163771,	0.393029065824633095,	0.391692467751508011,	0.390357265605359049,	0.389023471953617694,	0.387691099350456980,	0.386360160336675640,	
-0.385030667439578977,	0.383702633172859742,	0.382376070036482552,	0.381050990516565213,	0.379727407085260149,	0.378405332200639433,	0.377084778306574608,	0.375765757832622227,	
-0.374448283193905718,	0.373132366790997427,	0.371818021009803990,	0.370505258221448974,	0.369194090782154816,	0.367884531033129292,	0.366576591300447785,	0.365270283894936543,	
-0.363965621112058602,	0.362662615231797492,	0.361361278518539941,	0.360061623220963467,	0.358763661571917969,	0.357467405788313208,	0.356172868071002680,	0.354880060604667591,	
-0.353588995557704622,	0.352299685082110015,	0.351012141313364223,	0.349726376370320002,	0.348442402355087055,	0.347160231352917015,	0.345879875432092421,	0.344601346643810036,	
-0.343324657022070212,	0.342049818583562204,	0.340776843327550205,	0.339505743235762436,	0.338236530272277458,	0.336969216383410375,	0.335703813497602477,	0.334440333525307998,	
-0.333178788358880984,	0.331919189872465659,	0.330661549921881959,	0.329405880344516455,	0.328152192959209832,	0.326900499566144420,	0.325650811946735508,	0.324403141863519318,	
-0.323157501060041152,	0.321913901260746926,	0.320672354170871976,	0.319432871476329650,	0.318195464843603837,	0.316960145919636227,	0.315726926331719449,	0.314495817687386325,	
-0.313266831574299465,	0.312039979560144620,	0.310815273192520558,	0.309592723998829311,	0.308372343486169875,	0.307154143141228742,	0.305938134430170816,	0.304724328798533894,	
-0.303512737671118138,	0.302303372451881047,	0.301096244523829049,	0.299891365248909136,	0.298688745967904290,	0.297488398000325560,	0.296290332644304544,	0.295094561176488912,	
-0.293901094851935440,	0.292709944904003150,	0.291521122544249556,	0.290334638962322811,	0.289150505325858675,	0.287968732780374159,	0.286789332449161882,	0.285612315433187325,	
-0.284437692810983189,	0.283265475638544262,	0.282095674949225383,	0.280928301753636478,	0.279763367039537969,	0.278600881771739750,	0.277440856891995213,	0.276283303318900608,	
-0.275128231947791402,	0.273975653650638529,	0.272825579275948304,	0.271678019648659008,	0.270532985570038187,	0.269390487817583124,	0.268250537144918033,	0.267113144281692139,	
-0.265978319933480922,	0.264846074781682650,	0.263716419483420339,	0.262589364671440062,	0.261464920954010360,	0.260343098914824100,	0.259223909112897832,	0.258107362082471592,	
-0.256993468332911590,	0.255882238348610347,	0.254773682588887052,	0.253667811487891248,	0.252564635454502417,	0.251464164872233720,	0.250366410099133796,	0.249271381467687958,	
-0.248179089284723070,	0.247089543831309461,	0.246002755362663222,	0.244918734108051706,	0.243837490270696094,	0.242759034027674514,	0.241683375529828520,	0.240610524901664902,	
-0.239540492241262698,	0.238473287620177138,	0.237408921083343910,	0.236347402648986571,	0.235288742308521176,	0.234232950026461439,	0.233180035740326724,	0.232130009360547562,	
-0.231082880770371590,	0.230038659825772457,	0.228997356355354786,	0.227958980160263752,	0.226923541014091817,	0.225891048662786004,	0.224861512824557824,	0.223834943189790997,	
-0.222811349420949295,	0.221790741152487397,	0.220773127990759321,	0.219758519513927109,	0.218746925271872728,	0.217738354786105870,	0.216732817549676382,	0.215730323027083948,	
-0.214730880654188216,	0.213734499838121789,	0.212741189957200594,	0.211750960360835017,	0.210763820369443383,	0.209779779274363531,	0.208798846337764493,	0.207821030792561173,	
-0.206846341842325337,	0.205874788661200847,	0.204906380393816590,	0.203941126155199409,	0.202979035030690064,	0.202020116075856959,	0.201064378316409914,	0.200111830748116976,	
-0.199162482336718960,	0.198216342017844049,	0.197273418696925856,	0.196333721249117243,	0.195397258519208722,	0.194464039321544435,	0.193534072439938337,	0.192607366627593174,	
-0.191683930607017272,	0.190763773069941550,	0.189846902677239526,	0.188933328058844746,	0.188023057813668931,	0.187116100509522820,	0.186212464683033457,	0.185312158839565672,	
-0.184415191453141170,	0.183521570966358100,	0.182631305790313059,	0.181744404304521212,	0.180860874856836606,	0.179980725763375121,	0.179103965308435531,	0.178230601744420597,	
-0.177360643291761322,	0.176494098138837485,	0.175630974441902316,	0.174771280325005079,	0.173915023879913644,	0.173062213166040091,	0.172212856210363835,	0.171366961007355545,	
-0.170524535518903314,	0.169685587674236860,	0.168850125369852361,	0.168018156469439683,	0.167189688803806497,	0.166364730170806219,	0.165543288335263911,	0.164725371028902529,	
-0.163910985950271482,	0.163100140764673551,	0.162292843104091894,	0.161489100567119848,	0.160688920718888489,	0.159892311090994832,	0.159099279181432546,	0.158309832454519489,	
-0.157523978340829207,	0.156741724237120100,	0.155963077506265257,	0.155188045477184483,	0.154416635444774630,	0.153648854669840268,	0.152884710379026706,	0.152124209764751217,	
-0.151367359985134786,	0.150614168163936218,	0.149864641390483361,	0.149118786719607876,	0.148376611171578188,	0.147638121732032779,	0.146903325351915748,	0.146172228947410665,	
-0.145444839399874903,	0.144721163555776106,	0.144001208226627153,	0.143284980188921385,	0.142572486184070257,	0.141863732918338314,	0.141158727062781403,	0.140457475253183334,	
-0.139759984089992823,	0.139066260138262510,	0.138376309927586677,	0.137690139952039048,	0.137007756670112946,	0.136329166504659899,	0.135654375842828634,	0.134983391036006206,	
-0.134316218399756770,	0.133652864213763489,	0.132993334721768747,	0.132337636131514974,	0.131685774614687195,	0.131037756306854408,	0.130393587307411407,	0.129753273679522330,	
-0.129116821450063063,	0.128484236609564012,	0.127855525112154977,	0.127230692875507673,	0.126609745780781241,	0.125992689672566438,	0.125379530358829927,	0.124770273610860946,	
-0.124164925163216186,	0.123563490713665416,	0.122965975923138918,	0.122372386415673634,	0.121782727778359745,	0.121197005561289234,	0.120615225277502347,	0.120037392402936857,	
-0.119463512376376021,	0.118893590599396859,	0.118327632436320385,	0.117765643214160498,	0.117207628222573482,	0.116653592713809123,	0.116103541902660798,	0.115557480966415896,	
-0.115015415044808222,	0.114477349239968385,	0.113943288616376801,	0.113413238200815614,	0.112887202982320897,	0.112365187912136621,	0.111847197903667581,	0.111333237832432722,	
-0.110823312536020097,	0.110317426814040984,	0.109815585428084145,	0.109317793101671987,	0.108824054520215610,	0.108334374330970290,	0.107848757142992746,	0.107367207527096623,	
-0.106889730015810452,	0.106416329103334525,	0.105947009245498283,	0.105481774859719074,	0.105020630324960271,	0.104563579981689594,	0.104110628131839064,	0.103661779038764126,	
-0.103217036927203146,	0.102776405983238506,	0.102339890354256197,	0.101907494148907707,	0.101479221437070916,	0.101055076249811457,	0.100635062579345472,	0.100219184379001708,	
-0.099807445563183952,	0.099399850007334853,	0.098996401547899140,	0.098597103982287132,	0.098201961068839813,	0.097810976526792548,	0.097424154036240870,	0.097041497238105498,	
-0.096663009734097693,	0.096288695086686152,	0.095918556819062958,	0.095552598415110254,	0.095190823319368026,	0.094833234937001340,	0.094479836633768050,	0.094130631735987777,	
-0.093785623530509815,	0.093444815264682873,	0.093108210146324255,	0.092775811343689341,	0.092447621985442333,	0.092123645160626585,	0.091803883918635129,	0.091488341269182691,	
-0.091177020182276927,	0.090869923588190293,	0.090567054377433079,	0.090268415400725457,	0.089974009468971300,	0.089683839353231459,	0.089397907784697389,	0.089116217454666011,	
-0.088838771014514054,	0.088565571075672922,	0.088296620209604576,	0.088031920947777065,	0.087771475781640504,	0.087515287162604136,	0.087263357502012667,	0.087015689171124080,	
-0.086772284501087080,	0.086533145782919013,	0.086298275267484625,	0.086067675165474727,	0.085841347647385172,	0.085619294843496813,	0.085401518843855273,	0.085188021698251085,	
-0.084978805416200814,	0.084773871966927650,	0.084573223279343343,	0.084376861242029810,	0.084184787703221214,	0.083997004470786923,	0.083813513312214261,	0.083634315954591823,	
-0.083459414084593411,	0.083288809348462098,	0.083122503351994531,	0.082960497660526197,	0.082802793798916252,	0.082649393251533559,	0.082500297462242536,	0.082355507834389441,	
-0.082215025730789440,	0.082078852473713645,	0.081946989344876514,	0.081819437585424093,	0.081696198395922140,	0.081577272936344786,	0.081462662326063806,	0.081352367643837853,	
-0.081246389927802518,	0.081144730175460436,	0.081047389343671880,	0.080954368348645847,	0.080865668065931387,	0.080781289330409317,	0.080701232936284423,	0.080625499637078019,	
-0.080554090145620719,	0.080487005134045872,	0.080424245233783151,	0.080365811035552626,	0.080311703089359254,	0.080261921904487610,	0.080216467949497161,	0.080175341652217860,	
-0.080138543399746076,	0.080106073538440972,	0.080077932373921246,	0.080054120171062254,	0.080034637153993532,	0.080019483506096639,	0.080008659370003496,	0.080002164847594981	
-};
-
-
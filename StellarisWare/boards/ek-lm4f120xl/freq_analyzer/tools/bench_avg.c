@@ -0,0 +1,252 @@
+//*****************************************************************************
+//
+// bench_avg.c - Host test of the variance reduction from spectrum averaging.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Every bin of the FFT of white Gaussian noise is a complex Gaussian,
+// independent of the other bins and of the frames before it.  So its power
+// is exponentially distributed, with a variance equal to the square of its
+// mean: var/mean^2 is 1.  Averaging K frames of power should bring that down
+// to 1/K, in EMA mode as well as boxcar mode.
+//
+// This feeds frames of such bins through AverageSpectrum and measures
+// var/mean^2 of the power it hands back, pooled over the bins and frames.
+// It fails if any result is more than 5% from 1/K, or if the mean power
+// moves by more than 2%.  The first 10K frames in EMA mode are left out,
+// while the average settles from its seed.
+//
+// As with bench_bars, this brings its own plain C versions of the CMSIS
+// functions average.c calls.
+//
+// Build: cc -O2 -I../../../../dsplib -o bench_avg bench_avg.c -lm
+// Usage: bench_avg [frames]
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+//
+// Stand in for arm_math.h, which only builds for the target
+//
+#define _ARM_MATH_H
+typedef float float32_t;
+
+static void
+arm_cmplx_mag_f32(float32_t *pSrc, float32_t *pDst, unsigned long numSamples)
+{
+	unsigned long i;
+
+	for(i = 0; i < numSamples; i++)
+	{
+		pDst[i] = sqrtf((pSrc[2 * i] * pSrc[2 * i]) +
+						(pSrc[(2 * i) + 1] * pSrc[(2 * i) + 1]));
+	}
+}
+
+static void
+arm_cmplx_mag_squared_f32(float32_t *pSrc, float32_t *pDst,
+						  unsigned long numSamples)
+{
+	unsigned long i;
+
+	for(i = 0; i < numSamples; i++)
+	{
+		pDst[i] = (pSrc[2 * i] * pSrc[2 * i]) +
+				  (pSrc[(2 * i) + 1] * pSrc[(2 * i) + 1]);
+	}
+}
+
+static void
+arm_scale_f32(float32_t *pSrc, float32_t scale, float32_t *pDst,
+			  unsigned long blockSize)
+{
+	unsigned long i;
+
+	for(i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrc[i] * scale;
+	}
+}
+
+static void
+arm_add_f32(float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst,
+			unsigned long blockSize)
+{
+	unsigned long i;
+
+	for(i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrcA[i] + pSrcB[i];
+	}
+}
+
+static void
+arm_copy_f32(float32_t *pSrc, float32_t *pDst, unsigned long blockSize)
+{
+	unsigned long i;
+
+	for(i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrc[i];
+	}
+}
+
+#include "../average.c"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The bins in a frame, as for the full band FFT, and the frames averaged per
+// test by default
+//
+#define NUM_BINS				1025
+#define DEFAULT_FRAMES			3200
+
+//
+// The spread of the real and imaginary parts of each bin, which makes the
+// mean power 2 * BIN_SIGMA^2
+//
+#define BIN_SIGMA				100.0f
+
+//
+// How far a result may be from what it should be
+//
+#define RATIO_TOLERANCE			0.05
+#define MEAN_TOLERANCE			0.02
+
+#ifndef M_PI
+#define M_PI					3.14159265358979323846
+#endif
+
+//*****************************************************************************
+//
+// The averaging modes and frame counts to test.
+//
+//*****************************************************************************
+static const struct
+{
+	const char *pcName;
+	unsigned long ulMode;
+	unsigned long ulFrames;
+}
+g_psTests[] =
+{
+	{ "off", AVG_MODE_OFF, 1 },
+	{ "EMA", AVG_MODE_EMA, 4 },
+	{ "EMA", AVG_MODE_EMA, 16 },
+	{ "boxcar", AVG_MODE_BOXCAR, 4 },
+	{ "boxcar", AVG_MODE_BOXCAR, 16 },
+};
+
+#define NUM_TESTS		(sizeof(g_psTests) / sizeof(g_psTests[0]))
+
+//*****************************************************************************
+//
+// The frame of complex bins, and the power kept from frame to frame
+//
+//*****************************************************************************
+static float32_t g_pfBuffer[NUM_BINS * 2];
+static float32_t g_pfAverage[NUM_BINS];
+
+//*****************************************************************************
+//
+// A Gaussian random number with a mean of 0 and a spread of 1, from a
+// generator that gives the same sequence on every host.
+//
+//*****************************************************************************
+static float
+Gaussian(void)
+{
+	static uint32_t ulState = 2012;
+	double dU1, dU2;
+
+	ulState = (ulState * 1664525) + 1013904223;
+	dU1 = ((ulState >> 8) + 1) / 16777217.0;
+	ulState = (ulState * 1664525) + 1013904223;
+	dU2 = (ulState >> 8) / 16777216.0;
+	return((float)(sqrt(-2.0 * log(dU1)) * cos(2 * M_PI * dU2)));
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(int argc, char **argv)
+{
+	unsigned long ulFrames, ulFrame, ulTest, ulBin, ulCount, ulSkip;
+	double dPower, dSum, dSumSquares, dMean, dRatio, dExpected, dTrueMean;
+	unsigned long ulValues;
+	int iBad, iFailed;
+
+	ulFrames = (argc > 1) ? strtoul(argv[1], 0, 0) : DEFAULT_FRAMES;
+	if(ulFrames < 320)
+	{
+		fprintf(stderr, "Usage: bench_avg [frames, at least 320]\n");
+		return(2);
+	}
+
+	dTrueMean = 2.0 * BIN_SIGMA * BIN_SIGMA;
+	iFailed = 0;
+
+	printf("mode    K  var/mean^2  expected  mean/true\n");
+	for(ulTest = 0; ulTest < NUM_TESTS; ulTest++)
+	{
+		ulCount = 0;
+		ulSkip = (g_psTests[ulTest].ulMode == AVG_MODE_EMA) ?
+				 (10 * g_psTests[ulTest].ulFrames) : 0;
+		dSum = 0;
+		dSumSquares = 0;
+		ulValues = 0;
+
+		for(ulFrame = 0; ulFrame < ulFrames; ulFrame++)
+		{
+			for(ulBin = 0; ulBin < NUM_BINS * 2; ulBin++)
+			{
+				g_pfBuffer[ulBin] = BIN_SIGMA * Gaussian();
+			}
+			if(!AverageSpectrum(g_pfBuffer, g_pfAverage, &ulCount, NUM_BINS,
+								g_psTests[ulTest].ulMode,
+								g_psTests[ulTest].ulFrames) ||
+			   (ulFrame < ulSkip))
+			{
+				continue;
+			}
+
+			//
+			// The spectrum comes back as magnitudes, so square them to get
+			// the averaged power back
+			//
+			for(ulBin = 0; ulBin < NUM_BINS; ulBin++)
+			{
+				dPower = (double)g_pfBuffer[ulBin] * g_pfBuffer[ulBin];
+				dSum += dPower;
+				dSumSquares += dPower * dPower;
+				ulValues++;
+			}
+		}
+
+		dMean = dSum / ulValues;
+		dRatio = ((dSumSquares / ulValues) - (dMean * dMean)) /
+				 (dMean * dMean);
+		dExpected = 1.0 / g_psTests[ulTest].ulFrames;
+		iBad = ((fabs(dRatio - dExpected) > (RATIO_TOLERANCE * dExpected)) ||
+				(fabs((dMean / dTrueMean) - 1.0) > MEAN_TOLERANCE));
+		printf("%-6s %2lu  %10.3f  %8.3f  %9.3f  %s\n",
+			   g_psTests[ulTest].pcName, g_psTests[ulTest].ulFrames, dRatio,
+			   dExpected, dMean / dTrueMean, iBad ? "FAILED" : "ok");
+		iFailed |= iBad;
+	}
+
+	printf("\n%s\n", iFailed ? "FAILED" : "all tests pass");
+	return(iFailed);
+}
@@ -0,0 +1,253 @@
+//*****************************************************************************
+//
+// bench_bars.c - Host microbenchmark for the bar normalization kernel.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Times the normalization tail of the DSP loop at MAX_NUMBARS bars, both the
+// way it used to be done (a divide, a clip and a multiply by the display
+// height per bar) and the way it is done now (a reciprocal of each maximum
+// kept up to date, then BarsQuantize), and checks that the two give the same
+// heights.
+//
+// The CMSIS library only comes prebuilt for the target, so this brings its
+// own plain C versions of the few CMSIS functions bars.c calls.  The times
+// are for the host, which divides nearly as fast as it multiplies.  On the
+// Cortex-M4F a divide costs 14 cycles against 1 for a multiply, so the
+// divides per frame are printed as well.
+//
+// Build: cc -O2 -I../../../../dsplib -o bench_bars bench_bars.c -lm
+// Usage: bench_bars [frames]
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+//
+// Stand in for arm_math.h, which only builds for the target
+//
+#define _ARM_MATH_H
+typedef float float32_t;
+
+static void
+arm_mult_f32(float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst,
+			 unsigned long blockSize)
+{
+	unsigned long i;
+
+	for(i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrcA[i] * pSrcB[i];
+	}
+}
+
+static void
+arm_scale_f32(float32_t *pSrc, float32_t scale, float32_t *pDst,
+			  unsigned long blockSize)
+{
+	unsigned long i;
+
+	for(i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrc[i] * scale;
+	}
+}
+
+#include "../bars.c"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+#define MAX_NUMBARS				300
+#define BAR_HEIGHT				185
+#define DEFAULT_FRAMES			100000
+
+//
+// The release of a maximum over one frame, as NormalizeBars works it out for
+// a 30 frame per second refresh
+//
+#define RELEASE					0.99939f
+
+//*****************************************************************************
+//
+// The bar powers, maxima, and outputs for both kernels.  The powers are
+// copied in before each run, since both kernels overwrite them.
+//
+//*****************************************************************************
+static float32_t g_pfPowers[MAX_NUMBARS];
+static float32_t g_pfWork[MAX_NUMBARS];
+static float32_t g_pfMaxOld[MAX_NUMBARS];
+static float32_t g_pfMaxNew[MAX_NUMBARS];
+static float32_t g_pfInvMax[MAX_NUMBARS];
+static unsigned char g_pucOld[MAX_NUMBARS];
+static unsigned char g_pucNew[MAX_NUMBARS];
+
+//
+// The number of divides each kernel has done
+//
+static unsigned long g_ulDivOld;
+static unsigned long g_ulDivNew;
+
+//*****************************************************************************
+//
+// The old normalization tail: decay and attack the maxima, then divide each
+// power by its maximum, clip it, and scale it to the display height.
+//
+//*****************************************************************************
+static void
+NormalizeOld(float32_t *pfPower, unsigned long ulNumBars)
+{
+	unsigned long i;
+	float32_t fLevel;
+
+	arm_scale_f32(g_pfMaxOld, RELEASE, g_pfMaxOld, ulNumBars);
+	for(i = 0; i < ulNumBars; i++)
+	{
+		if(pfPower[i] > g_pfMaxOld[i])
+		{
+			g_pfMaxOld[i] = pfPower[i];
+		}
+	}
+
+	for(i = 0; i < ulNumBars; i++)
+	{
+		fLevel = (g_pfMaxOld[i] > 0) ? (pfPower[i] / g_pfMaxOld[i]) : 0;
+		g_ulDivOld++;
+		if(fLevel > 1.0f)
+		{
+			fLevel = 1.0f;
+		}
+		g_pucOld[i] = (int)(fLevel * BAR_HEIGHT);
+	}
+}
+
+//*****************************************************************************
+//
+// The new normalization tail: decay and attack the maxima and their
+// reciprocals, recalculate one reciprocal outright, then BarsQuantize.
+//
+//*****************************************************************************
+static void
+NormalizeNew(float32_t *pfPower, unsigned long ulNumBars)
+{
+	static unsigned long ulResync;
+	unsigned long i;
+
+	arm_scale_f32(g_pfMaxNew, RELEASE, g_pfMaxNew, ulNumBars);
+	arm_scale_f32(g_pfInvMax, 1.0f / RELEASE, g_pfInvMax, ulNumBars);
+	for(i = 0; i < ulNumBars; i++)
+	{
+		if(pfPower[i] > g_pfMaxNew[i])
+		{
+			g_pfMaxNew[i] = pfPower[i];
+			g_pfInvMax[i] = 1.0f / g_pfMaxNew[i];
+			g_ulDivNew++;
+		}
+	}
+	g_ulDivNew++;
+	ulResync = (ulResync + 1) % ulNumBars;
+	g_pfInvMax[ulResync] = (g_pfMaxNew[ulResync] > 0) ?
+						   (1.0f / g_pfMaxNew[ulResync]) : 0;
+
+	BarsQuantize(pfPower, g_pfInvMax, BAR_HEIGHT, g_pucNew, ulNumBars,
+				 BAR_HEIGHT);
+}
+
+//*****************************************************************************
+//
+// Fill the powers with something like a frame of music: a slowly moving
+// level per bar with noise on top, and the occasional loud hit.
+//
+//*****************************************************************************
+static void
+MakeFrame(unsigned long ulFrame)
+{
+	unsigned long i;
+
+	for(i = 0; i < MAX_NUMBARS; i++)
+	{
+		g_pfPowers[i] = 1000.0f * (1.5f + sinf((float)(ulFrame + (i * 7)) /
+											   50.0f)) *
+						((float)rand() / (float)RAND_MAX);
+		if((rand() % 64) == 0)
+		{
+			g_pfPowers[i] *= 4.0f;
+		}
+	}
+}
+
+static double
+Seconds(void)
+{
+	struct timespec sTime;
+
+	clock_gettime(CLOCK_MONOTONIC, &sTime);
+	return((double)sTime.tv_sec + ((double)sTime.tv_nsec * 1e-9));
+}
+
+int
+main(int argc, char **argv)
+{
+	unsigned long ulFrames, ulFrame, i, ulMismatch, ulWorst, ulDiff;
+	double dOld, dNew, dStart;
+
+	ulFrames = (argc > 1) ? strtoul(argv[1], 0, 0) : DEFAULT_FRAMES;
+	dOld = 0;
+	dNew = 0;
+	ulMismatch = 0;
+	ulWorst = 0;
+
+	for(ulFrame = 0; ulFrame < ulFrames; ulFrame++)
+	{
+		MakeFrame(ulFrame);
+
+		for(i = 0; i < MAX_NUMBARS; i++)
+		{
+			g_pfWork[i] = g_pfPowers[i];
+		}
+		dStart = Seconds();
+		NormalizeOld(g_pfWork, MAX_NUMBARS);
+		dOld += Seconds() - dStart;
+
+		for(i = 0; i < MAX_NUMBARS; i++)
+		{
+			g_pfWork[i] = g_pfPowers[i];
+		}
+		dStart = Seconds();
+		NormalizeNew(g_pfWork, MAX_NUMBARS);
+		dNew += Seconds() - dStart;
+
+		//
+		// The two can land on opposite sides of a pixel boundary, but
+		// should never be further apart than that
+		//
+		for(i = 0; i < MAX_NUMBARS; i++)
+		{
+			ulDiff = (unsigned long)abs((int)g_pucOld[i] - (int)g_pucNew[i]);
+			if(ulDiff)
+			{
+				ulMismatch++;
+			}
+			if(ulDiff > ulWorst)
+			{
+				ulWorst = ulDiff;
+			}
+		}
+	}
+
+	printf("%lu frames of %d bars\n", ulFrames, MAX_NUMBARS);
+	printf("divide per bar:     %7.1f ns/frame\n", dOld * 1e9 / ulFrames);
+	printf("reciprocal + quant: %7.1f ns/frame\n", dNew * 1e9 / ulFrames);
+	printf("divides per frame:  %7.1f against %.1f\n",
+		   (double)g_ulDivNew / ulFrames, (double)g_ulDivOld / ulFrames);
+	printf("heights that differ: %lu of %lu, by at most %lu\n", ulMismatch,
+		   ulFrames * MAX_NUMBARS, ulWorst);
+
+	return((ulWorst > 1) ? 1 : 0);
+}
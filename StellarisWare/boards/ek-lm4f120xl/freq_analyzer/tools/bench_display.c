@@ -0,0 +1,629 @@
+//*****************************************************************************
+//
+// bench_display.c - Host benchmark and pixel check for the display drawing
+// code, run against the SSD2119 model in ssd2119_emu.c.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Builds the display driver, the background decoder and the color tables for
+// the host, with their bus writes going to the model, and counts the bus
+// traffic per frame of:
+//
+// * drawing the whole background, and drawing random rectangles of it the
+//   way gui.c restores what its readouts and widgets covered
+// * each renderer in render.c drawing the bars over the last frame, at the
+//   smallest, default and largest number of bars, along with the number of
+//   pixels its cost estimates said it would draw
+// * adding a row to the waterfall and scrolling it
+//
+// After the bars have been drawn over a run of frames, the screen is checked
+// pixel for pixel against what the renderer says it has drawn, drawn over a
+// fresh background, and the cost estimates are checked against the pixels
+// actually drawn.  The waterfall is checked to show its newest row at the
+// top.  Each background rectangle is checked pixel for pixel against the
+// same part of the whole background, with nothing drawn outside it.
+//
+// Each frame's pixels are hashed.  At the default number of frames, every
+// hash is checked against the one in g_psGolden, taken from the drawing code
+// when the table was last updated, so a change to the drawing code that
+// changes what ends up on the screen fails.  The frames are made from a
+// fixed random sequence, so the hashes are the same on every host.  With -o
+// each frame is also written out as a PPM image into the given directory, to
+// be looked at before the table is updated for a change that is meant to
+// change the screen.
+//
+// gui.c itself needs grlib and driverlib, which only build for the target, so
+// its pass planning is left out and every bar that needs drawing is drawn.
+// For the same reason the config page, which is all grlib widgets, is not
+// drawn here.
+//
+// Build: cc -O2 -I.. -o bench_display bench_display.c
+// Usage: bench_display [-o directory] [frames]
+//
+//*****************************************************************************
+
+#define HOST_BUILD
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ssd2119_emu.c"
+#include "../Kentec320x240x16_ssd2119_8bit.c"
+#include "../background.c"
+#include "../bgimage.c"
+#include "../colormap.c"
+#include "../render.c"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+#define DEFAULT_FRAMES			200
+
+//
+// The number of background rectangles drawn
+//
+#define BACKGROUND_RECTS		200
+
+//
+// The waterfall, as gui.c has it
+//
+#define WATERFALL_Y_MIN			0
+#define WATERFALL_Y_MAX			209
+#define WATERFALL_HEIGHT		(WATERFALL_Y_MAX - WATERFALL_Y_MIN + 1)
+
+//*****************************************************************************
+//
+// The directory frames are written to, or NULL to only hash them
+//
+//*****************************************************************************
+static const char *g_pcOutDir;
+
+//
+// The frame being drawn
+//
+static tBarFrame g_sFrame;
+
+//
+// The "Make it rain" checkbox, which the bars renderer reads
+//
+unsigned char g_ucDispRain;
+
+//
+// The whole background, as the panel showed it after it was drawn
+//
+static unsigned short g_ppusBackground[EMU_GATE_LINES][EMU_SOURCE_LINES];
+
+//
+// Whether the frame hashes are checked against g_psGolden, which only holds
+// for the default number of frames
+//
+static unsigned char g_ucGolden;
+
+//
+// The state of the random number generator, which each run seeds
+//
+static unsigned long g_ulRandom;
+
+//*****************************************************************************
+//
+// The hash of each frame at the default number of frames.  These have to be
+// updated by any change that is meant to change what is drawn, once the
+// frames written out with -o have been checked by eye.
+//
+//*****************************************************************************
+static const struct
+{
+	const char *pcName;
+	unsigned long ulHash;
+}
+g_psGolden[] =
+{
+	{ "background", 0x8ed2af46 },
+	{ "bars_8", 0x87dcabd2 },
+	{ "bars_75", 0xb07dd8be },
+	{ "bars_300", 0x68053ac6 },
+	{ "mirrored_8", 0x6edf6ea4 },
+	{ "mirrored_75", 0xa2673924 },
+	{ "mirrored_300", 0x0b29bc44 },
+	{ "dots_8", 0xd13276e9 },
+	{ "dots_75", 0x473a47d0 },
+	{ "dots_300", 0x0a1a2ced },
+	{ "peaks_8", 0x7df8cc16 },
+	{ "peaks_75", 0xedc31a95 },
+	{ "peaks_300", 0x4ebe3cf1 },
+	{ "bars_rain_8", 0x52f13275 },
+	{ "bars_rain_75", 0xe87f8cbf },
+	{ "bars_rain_300", 0x76975ccb },
+	{ "waterfall", 0x21663fcc },
+};
+
+#define NUM_GOLDEN		(sizeof(g_psGolden) / sizeof(g_psGolden[0]))
+
+//*****************************************************************************
+//
+// A random number from 0 to 32767, from a generator that gives the same
+// sequence on every host, unlike rand().
+//
+//*****************************************************************************
+static unsigned long
+Random(void)
+{
+	g_ulRandom = ((g_ulRandom * 1664525) + 1013904223) & 0xffffffff;
+	return(g_ulRandom >> 17);
+}
+
+//*****************************************************************************
+//
+// Print the bus traffic since the counts were cleared, per frame.
+//
+// param pcName: the name of what was drawn
+// param ulFrames: the number of frames drawn
+//
+//*****************************************************************************
+static void
+CountsPrint(const char *pcName, unsigned long ulFrames)
+{
+	printf("%-24s %9lu %9lu %9lu %7lu %7lu %7lu\n", pcName,
+		   g_sEmuCounts.ulCommands / ulFrames,
+		   g_sEmuCounts.ulData / ulFrames,
+		   g_sEmuCounts.ulPixels / ulFrames,
+		   g_sEmuCounts.ulAddressSetups / ulFrames,
+		   g_sEmuCounts.ulWindowSetups / ulFrames,
+		   g_sEmuCounts.ulEntryModes / ulFrames);
+	if(g_sEmuCounts.ulStrays)
+	{
+		printf("%-24s %lu pixels written outside the RAM\n", "",
+			   g_sEmuCounts.ulStrays);
+	}
+}
+
+//*****************************************************************************
+//
+// Check a frame's hash against the one in g_psGolden, if the hashes are being
+// checked.
+//
+// param pcName: the name of the frame
+// param ulHash: its hash
+// return: 0 if the hash matches or isn't being checked, else 1
+//
+//*****************************************************************************
+static int
+GoldenCheck(const char *pcName, unsigned long ulHash)
+{
+	unsigned long ulIdx;
+
+	if(!g_ucGolden)
+	{
+		return(0);
+	}
+	for(ulIdx = 0; ulIdx < NUM_GOLDEN; ulIdx++)
+	{
+		if(!strcmp(g_psGolden[ulIdx].pcName, pcName))
+		{
+			if(g_psGolden[ulIdx].ulHash == ulHash)
+			{
+				return(0);
+			}
+			printf("%-24s %s: hash %08lx, expected %08lx\n", "", pcName,
+				   ulHash, g_psGolden[ulIdx].ulHash);
+			return(1);
+		}
+	}
+	printf("%-24s %s: hash %08lx, which has no reference\n", "", pcName,
+		   ulHash);
+	return(1);
+}
+
+//*****************************************************************************
+//
+// Hash the frame on the panel, check it against its reference, and write it
+// out if asked to.
+//
+// param pcName: the name of the frame, which the file is named after
+// param pulHash: where to store the hash of the frame
+// return: 0 if the hash matches its reference, else 1
+//
+//*****************************************************************************
+static int
+FrameSave(const char *pcName, unsigned long *pulHash)
+{
+	char pcPath[256];
+
+	*pulHash = EmuFrameHash();
+	if(g_pcOutDir)
+	{
+		snprintf(pcPath, sizeof(pcPath), "%s/%s.ppm", g_pcOutDir, pcName);
+		if(EmuFrameWrite(pcPath))
+		{
+			fprintf(stderr, "bench_display: can't write %s\n", pcPath);
+			exit(2);
+		}
+	}
+	return(GoldenCheck(pcName, *pulHash));
+}
+
+//*****************************************************************************
+//
+// Start a fresh screen: reset the controller, initialize it the way the
+// application does, and draw the background.
+//
+//*****************************************************************************
+static void
+ScreenFresh(void)
+{
+	EmuReset();
+	Kentec320x240x16_SSD2119Init();
+	BackgroundDraw(&g_sBackground, 0, 0, g_sBackground.usWidth - 1,
+				   g_sBackground.usHeight - 1);
+}
+
+//*****************************************************************************
+//
+// Move each bar a random step up or down, the way music does.
+//
+// param uiNumBars: the number of bars
+//
+//*****************************************************************************
+static void
+HeightsNext(unsigned int uiNumBars)
+{
+	unsigned int uiIdx;
+	int iHeight;
+
+	for(uiIdx = 0; uiIdx < uiNumBars; uiIdx++)
+	{
+		iHeight = g_sFrame.pucHeights[uiIdx] + (Random() % 61) - 30;
+		if(iHeight < 0)
+		{
+			iHeight = 0;
+		}
+		if(iHeight > COLORMAP_FULL_SCALE)
+		{
+			iHeight = COLORMAP_FULL_SCALE;
+		}
+		g_sFrame.pucHeights[uiIdx] = iHeight;
+	}
+	g_sFrame.ulSequence++;
+}
+
+//*****************************************************************************
+//
+// Draw each bar of the frame that needs it over what the renderer last drew,
+// the way OnEqPaint does once its pass is planned.
+//
+// param psRenderer: the renderer to draw with
+// param lXMin, lWidth: the bar layout
+// param ucFull: 1 to draw every bar in full, 0 to draw just the changes
+// return: the number of pixels the cost estimates said would be drawn
+//
+//*****************************************************************************
+static unsigned long
+BarsPaint(const tRenderer *psRenderer, long lXMin, long lWidth,
+		  unsigned char ucFull)
+{
+	unsigned long ulIdx, ulPredicted;
+	long lCost;
+
+	ulPredicted = 0;
+	for(ulIdx = 0; ulIdx < g_sFrame.uiNumBars; ulIdx++)
+	{
+		if(ucFull)
+		{
+			psRenderer->pfnPaintFull(psRenderer->pvData, &g_sFrame, ulIdx,
+									 lXMin + (ulIdx * lWidth), lWidth);
+			continue;
+		}
+
+		lCost = psRenderer->pfnCost(psRenderer->pvData, &g_sFrame, ulIdx);
+		if(lCost >= 0)
+		{
+			ulPredicted += lCost * lWidth;
+			psRenderer->pfnPaintDiff(psRenderer->pvData, &g_sFrame, ulIdx,
+									 lXMin + (ulIdx * lWidth), lWidth);
+		}
+	}
+	return(ulPredicted);
+}
+
+//*****************************************************************************
+//
+// Draw what a renderer says it has on the screen over a fresh background:
+// each bar's body, and its marker.
+//
+// param psRenderer: the renderer
+// param lXMin, lWidth: the bar layout
+// return: 0 if the renderer is up to date with the frame, else 1
+//
+//*****************************************************************************
+static int
+BarsExpected(const tRenderer *psRenderer, long lXMin, long lWidth)
+{
+	const tSpanStyle *psStyle;
+	tSpan sSpan, sEmpty;
+	unsigned long ulIdx;
+	long lX;
+
+	psStyle = psRenderer->pvData;
+	sEmpty.lTop = 1;
+	sEmpty.lBottom = 0;
+	ScreenFresh();
+	for(ulIdx = 0; ulIdx < g_sFrame.uiNumBars; ulIdx++)
+	{
+		if(g_pucDrawnHeight[ulIdx] != BarHeight(&g_sFrame, ulIdx))
+		{
+			printf("%-24s bar %lu is not up to date\n", "", ulIdx);
+			return(1);
+		}
+		lX = lXMin + (ulIdx * lWidth);
+		psStyle->pfnBody(g_pucDrawnHeight[ulIdx], &sSpan);
+		SpanOutside(lX, lWidth, &sSpan, &sEmpty, g_pusBarColors[ulIdx]);
+		MarkerSpan(psStyle, g_pucDrawnMarker[ulIdx], &sSpan);
+		SpanOutside(lX, lWidth, &sSpan, &sEmpty,
+					psStyle->ucMarkerBarColor ? g_pusBarColors[ulIdx] :
+												MARKER_COLOR);
+	}
+	return(0);
+}
+
+//*****************************************************************************
+//
+// Draw the bars with a renderer over a run of frames, then check the result
+// against what the renderer says it has drawn, drawn on a fresh screen.
+//
+// param psRenderer: the renderer
+// param uiNumBars: the number of bars
+// param ulFrames: the number of frames to draw
+// return: 0 if the two screens match, and the cost estimates were right,
+//		   else 1
+//
+//*****************************************************************************
+static int
+BarsRun(const tRenderer *psRenderer, unsigned int uiNumBars,
+		unsigned long ulFrames)
+{
+	char pcName[32];
+	unsigned long ulFrame, ulHash, ulPredicted;
+	long lXMin, lWidth;
+	int iFailed;
+
+	g_ulRandom = uiNumBars;
+	memset(&g_sFrame, 0, sizeof(g_sFrame));
+	memset(g_sFrame.pucHeights, COLORMAP_FULL_SCALE / 2,
+		   sizeof(g_sFrame.pucHeights));
+	g_sFrame.uiNumBars = uiNumBars;
+	RenderLayout(uiNumBars, &lXMin, &lWidth);
+	RenderColorsBuild(uiNumBars, BAR_PALETTE_GRADIENT);
+
+	ScreenFresh();
+	psRenderer->pfnInit(psRenderer->pvData);
+	BarsPaint(psRenderer, lXMin, lWidth, 1);
+
+	EmuCountsClear();
+	ulPredicted = 0;
+	for(ulFrame = 0; ulFrame < ulFrames; ulFrame++)
+	{
+		HeightsNext(uiNumBars);
+		ulPredicted += BarsPaint(psRenderer, lXMin, lWidth, 0);
+	}
+	snprintf(pcName, sizeof(pcName), "%s%s %u", psRenderer->pcName,
+			 g_ucDispRain ? " rain" : "", uiNumBars);
+	CountsPrint(pcName, ulFrames);
+	printf("%-24s dirty%s%s%s, predicted %lu pixels\n", "",
+		   (psRenderer->ucDirty & RENDER_DIRTY_TOP) ? " top" : "",
+		   (psRenderer->ucDirty & RENDER_DIRTY_ENDS) ? " ends" : "",
+		   (psRenderer->ucDirty & RENDER_DIRTY_MARKER) ? " marker" : "",
+		   ulPredicted / ulFrames);
+	if(ulPredicted != g_sEmuCounts.ulPixels)
+	{
+		printf("%-24s predicted %lu pixels in all, drew %lu\n", "",
+			   ulPredicted, g_sEmuCounts.ulPixels);
+		return(1);
+	}
+
+	snprintf(pcName, sizeof(pcName), "%s%s_%u", psRenderer->pcName,
+			 g_ucDispRain ? "_rain" : "", uiNumBars);
+	iFailed = FrameSave(pcName, &ulHash);
+	if(BarsExpected(psRenderer, lXMin, lWidth))
+	{
+		return(1);
+	}
+	if(EmuFrameHash() != ulHash)
+	{
+		printf("%-24s drawn over differs from drawn fresh\n", "");
+		return(1);
+	}
+	return(iFailed);
+}
+
+//*****************************************************************************
+//
+// Add rows to the waterfall the way OnWaterfallPaint does, then check that
+// the newest row shows at the top.
+//
+// param ulFrames: the number of rows to add
+// return: 0 if the newest row is at the top, else 1
+//
+//*****************************************************************************
+static int
+WaterfallRun(unsigned long ulFrames)
+{
+	tRectangle sRect;
+	unsigned long ulFrame, ulScroll, ulHash;
+	unsigned int uiIdx, uiNumBars;
+	long lWidth, lXMin, lX;
+	int iFailed;
+
+	uiNumBars = 75;
+	RenderLayout(uiNumBars, &lXMin, &lWidth);
+
+	g_ulRandom = 1;
+	ScreenFresh();
+	sRect.sXMin = 0;
+	sRect.sYMin = WATERFALL_Y_MIN;
+	sRect.sXMax = EMU_SOURCE_LINES - 1;
+	sRect.sYMax = WATERFALL_Y_MAX;
+	g_sKentec320x240x16_SSD2119.pfnRectFill(0, &sRect, 0);
+	Kentec320x240x16_SSD2119ScrollAreaSet(WATERFALL_Y_MIN, WATERFALL_Y_MAX);
+	ulScroll = 0;
+
+	EmuCountsClear();
+	for(ulFrame = 0; ulFrame < ulFrames; ulFrame++)
+	{
+		HeightsNext(uiNumBars);
+		ulScroll = (ulScroll + 1) % WATERFALL_HEIGHT;
+		DpyPixelDrawRuns(lXMin, WATERFALL_Y_MIN +
+						 ((WATERFALL_HEIGHT - ulScroll) % WATERFALL_HEIGHT),
+						 uiNumBars, lWidth, g_sFrame.pucHeights,
+						 g_pusColormapHeat);
+		Kentec320x240x16_SSD2119ScrollSet(ulScroll);
+	}
+	CountsPrint("waterfall row", ulFrames);
+	iFailed = FrameSave("waterfall", &ulHash);
+
+	for(uiIdx = 0; uiIdx < uiNumBars; uiIdx++)
+	{
+		for(lX = 0; lX < lWidth; lX++)
+		{
+			if(EmuPixelGet(lXMin + (uiIdx * lWidth) + lX, WATERFALL_Y_MIN) !=
+			   g_pusColormapHeat[g_sFrame.pucHeights[uiIdx]])
+			{
+				printf("%-24s newest row is not at the top\n", "");
+				return(1);
+			}
+		}
+	}
+	return(iFailed);
+}
+
+//*****************************************************************************
+//
+// Draw the whole background, then random rectangles of it, each on a cleared
+// screen, and check each one against the same part of the whole background.
+//
+// param ulRects: the number of rectangles to draw
+// return: 0 if the background matches its reference and every rectangle
+//		   matches the background, else 1
+//
+//*****************************************************************************
+static int
+BackgroundRun(unsigned long ulRects)
+{
+	tRectangle sRect;
+	unsigned long ulRect, ulHash, ulPixels;
+	long lX, lY, lXMin, lYMin, lXMax, lYMax;
+	int iFailed;
+
+	EmuCountsClear();
+	BackgroundDraw(&g_sBackground, 0, 0, g_sBackground.usWidth - 1,
+				   g_sBackground.usHeight - 1);
+	CountsPrint("background", 1);
+	iFailed = FrameSave("background", &ulHash);
+	for(lY = 0; lY < EMU_GATE_LINES; lY++)
+	{
+		for(lX = 0; lX < EMU_SOURCE_LINES; lX++)
+		{
+			g_ppusBackground[lY][lX] = EmuPixelGet(lX, lY);
+		}
+	}
+
+	//
+	// Half the rectangles are strips along the top, like the readouts
+	// gui.c erases, and the rest are anywhere
+	//
+	g_ulRandom = 2;
+	sRect.sXMin = 0;
+	sRect.sYMin = 0;
+	sRect.sXMax = EMU_SOURCE_LINES - 1;
+	sRect.sYMax = EMU_GATE_LINES - 1;
+	ulPixels = 0;
+	for(ulRect = 0; ulRect < ulRects; ulRect++)
+	{
+		lXMin = Random() % EMU_SOURCE_LINES;
+		lXMax = lXMin + (Random() % (EMU_SOURCE_LINES - lXMin));
+		lYMin = (ulRect & 1) ? 0 : (Random() % EMU_GATE_LINES);
+		lYMax = (ulRect & 1) ? 20 :
+				(lYMin + (Random() % (EMU_GATE_LINES - lYMin)));
+
+		g_sKentec320x240x16_SSD2119.pfnRectFill(0, &sRect, 0);
+		EmuCountsClear();
+		BackgroundDraw(&g_sBackground, lXMin, lYMin, lXMax, lYMax);
+		ulPixels += g_sEmuCounts.ulPixels;
+		for(lY = 0; lY < EMU_GATE_LINES; lY++)
+		{
+			for(lX = 0; lX < EMU_SOURCE_LINES; lX++)
+			{
+				if(EmuPixelGet(lX, lY) !=
+				   (((lX >= lXMin) && (lX <= lXMax) && (lY >= lYMin) &&
+					 (lY <= lYMax)) ? g_ppusBackground[lY][lX] : 0))
+				{
+					printf("%-24s rectangle (%ld, %ld)-(%ld, %ld) differs "
+						   "at (%ld, %ld)\n", "", lXMin, lYMin, lXMax, lYMax,
+						   lX, lY);
+					return(1);
+				}
+			}
+		}
+	}
+	printf("%-24s %lu rectangles, %lu pixels each on average, all match\n",
+		   "background rectangles", ulRects, ulPixels / ulRects);
+	return(iFailed);
+}
+
+//*****************************************************************************
+//
+// Run the benchmark
+//
+//*****************************************************************************
+int
+main(int argc, char **argv)
+{
+	static const unsigned int puiNumBars[] = { 8, 75, MAX_NUMBARS };
+	unsigned long ulFrames;
+	unsigned int uiRenderer, uiCount;
+	int iFailed;
+
+	if((argc > 2) && !strcmp(argv[1], "-o"))
+	{
+		g_pcOutDir = argv[2];
+		argc -= 2;
+		argv += 2;
+	}
+	ulFrames = (argc > 1) ? strtoul(argv[1], 0, 0) : DEFAULT_FRAMES;
+	if(!ulFrames)
+	{
+		fprintf(stderr, "Usage: bench_display [-o directory] [frames]\n");
+		return(2);
+	}
+
+	printf("%-24s %9s %9s %9s %7s %7s %7s\n", "bus writes per frame",
+		   "commands", "data", "pixels", "address", "window", "entry");
+
+	EmuReset();
+	Kentec320x240x16_SSD2119Init();
+	CountsPrint("init", 1);
+
+	g_ucGolden = (ulFrames == DEFAULT_FRAMES);
+	iFailed = BackgroundRun(BACKGROUND_RECTS);
+
+	//
+	// The bars renderer is run again with rain, which only it draws
+	//
+	for(uiRenderer = 0; uiRenderer <= NUM_RENDERERS; uiRenderer++)
+	{
+		g_ucDispRain = (uiRenderer == NUM_RENDERERS);
+		for(uiCount = 0; uiCount < 3; uiCount++)
+		{
+			iFailed |= BarsRun(g_ppsRenderers[g_ucDispRain ? RENDERER_BARS :
+														  uiRenderer],
+							   puiNumBars[uiCount], ulFrames);
+		}
+	}
+	g_ucDispRain = 0;
+	iFailed |= WaterfallRun(ulFrames);
+
+	printf("%s\n", iFailed ? "FAILED" : "all frames match");
+	return(iFailed);
+}
@@ -0,0 +1,362 @@
+//*****************************************************************************
+//
+// bench_filterbank.c - Host benchmark of the filterbank engine against the
+// FFT engine at equal bar counts.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// For 1/1, 1/3 and 1/6 octave bands between the default display limits at
+// the default sampling rate, this lays out a filterbank with FilterbankInit
+// and runs a sine through it, a DMA block at a time, reading the bands after
+// every block as the DSP loop does.
+//
+// The filterbank's own cost accounting is reported: the biquad section
+// updates per sample it worked out at design time, and the ones it counted
+// while running.  The counts are checked against a count kept by the
+// stand-in biquad kernel below, and against the design figure.
+//
+// The FFT engine's work doesn't depend on the samples, so it is worked out
+// from the operations the FFT path does per frame at the same bar count:
+// the window, the NUM_SAMPLES / 2 point radix-4 complex FFT, the real FFT
+// split, the magnitudes and the band means.  The FFT path's cost per sample
+// depends on how far apart its frames are, so it is given for frames back
+// to back (fast DMA) and a DMA block apart (slow DMA).  The filterbank's
+// doesn't: its output rate is free.  Both are given in multiplies; the FFT
+// path also takes one square root per bin per frame, and the filterbank one
+// per band per read.  The silence gate's sums are the same for both and are
+// left out.
+//
+// Each band is also checked with a sine at its center: it must read within
+// 0.3% of the sine's amplitude, and bands two or more away must be at least
+// 27.5 dB down.  The worst of those is the 1/3 octave band at 10 kHz, whose
+// lower skirt the bilinear transform flattens out this close to Nyquist.
+//
+// As with bench_bars, this brings its own plain C versions of the CMSIS
+// functions filterbank.c calls.
+//
+// Build: cc -O2 -I../../../../dsplib -o bench_filterbank bench_filterbank.c -lm
+// Usage: bench_filterbank
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+//
+// Stand in for arm_math.h, which only builds for the target
+//
+#define _ARM_MATH_H
+typedef float float32_t;
+#define PI						3.14159265358979f
+
+typedef struct
+{
+	uint32_t numStages;
+	float32_t *pState;
+	float32_t *pCoeffs;
+}
+arm_biquad_casd_df1_inst_f32;
+
+//
+// The section updates and squared samples the stand-in kernels have done
+//
+static unsigned long g_ulSections;
+static unsigned long g_ulSquares;
+
+static void
+arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32 *S,
+								uint8_t numStages, float32_t *pCoeffs,
+								float32_t *pState)
+{
+	unsigned long i;
+
+	S->numStages = numStages;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	for(i = 0; i < 4 * numStages; i++)
+	{
+		pState[i] = 0;
+	}
+}
+
+static void
+arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32 *S,
+						   float32_t *pSrc, float32_t *pDst,
+						   uint32_t blockSize)
+{
+	float32_t *pfState, *pfCoeffs, fIn, fOut;
+	unsigned long ulStage, i;
+
+	for(ulStage = 0; ulStage < S->numStages; ulStage++)
+	{
+		pfState = S->pState + (4 * ulStage);
+		pfCoeffs = S->pCoeffs + (5 * ulStage);
+		for(i = 0; i < blockSize; i++)
+		{
+			fIn = pSrc[i];
+			fOut = (pfCoeffs[0] * fIn) + (pfCoeffs[1] * pfState[0]) +
+				   (pfCoeffs[2] * pfState[1]) + (pfCoeffs[3] * pfState[2]) +
+				   (pfCoeffs[4] * pfState[3]);
+			pfState[1] = pfState[0];
+			pfState[0] = fIn;
+			pfState[3] = pfState[2];
+			pfState[2] = fOut;
+			pDst[i] = fOut;
+		}
+		pSrc = pDst;
+		g_ulSections += blockSize;
+	}
+}
+
+static void
+arm_power_f32(float32_t *pSrc, uint32_t blockSize, float32_t *pResult)
+{
+	unsigned long i;
+	float32_t fSum;
+
+	fSum = 0;
+	for(i = 0; i < blockSize; i++)
+	{
+		fSum += pSrc[i] * pSrc[i];
+	}
+	*pResult = fSum;
+	g_ulSquares += blockSize;
+}
+
+#include "../filterbank.c"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The defaults from gui.c and dsp.h: the sampling rate, the display limits,
+// the FFT length and the slow DMA method's block size
+//
+#define SAMPLE_RATE				26000
+#define MIN_FREQ				40
+#define MAX_FREQ				13000
+#define NUM_SAMPLES				2048
+#define NUM_BINS				((NUM_SAMPLES / 2) + 1)
+#define DMA_SIZE				256
+
+//
+// How long each band's sine is run before it is measured, and for how long
+// it is measured, in seconds.  The narrowest bands take a while to settle.
+//
+#define SETTLE_SECONDS			3
+#define MEASURE_SECONDS			2
+
+//
+// The sine's amplitude, in ADC counts
+//
+#define AMPLITUDE				1000.0f
+
+//
+// The limits the bands have to meet
+//
+#define CENTER_TOLERANCE		0.003f
+#define REJECTION_DB			27.5f
+
+#ifndef M_PI
+#define M_PI					3.14159265358979323846
+#endif
+
+//*****************************************************************************
+//
+// The filterbank, a block of samples, and the band levels
+//
+//*****************************************************************************
+static tFilterbank g_sBank;
+static float32_t g_pfBlock[DMA_SIZE];
+static float32_t g_pfLevels[FB_MAX_BANDS];
+
+//*****************************************************************************
+//
+// Work out the multiplies the FFT path does on one frame.
+//
+// param ulNumBars: the number of bars
+//
+// return: the multiplies per frame
+//
+//*****************************************************************************
+static unsigned long
+FFTMultiplies(unsigned long ulNumBars)
+{
+	unsigned long ulPoints, ulStages, ulMults;
+
+	//
+	// The window, one multiply per sample
+	//
+	ulMults = NUM_SAMPLES;
+
+	//
+	// The NUM_SAMPLES / 2 point radix-4 complex FFT: three twiddle
+	// multiplies, each four real ones, per butterfly, on every stage but the
+	// last, which needs no twiddles
+	//
+	ulPoints = NUM_SAMPLES / 2;
+	for(ulStages = 0; (1UL << (2 * ulStages)) < ulPoints; ulStages++)
+	{
+	}
+	ulMults += (ulStages - 1) * (ulPoints / 4) * 3 * 4;
+
+	//
+	// The real FFT split: the twiddle recurrence, the halving of the even and
+	// odd spectra, and the twiddle rotation, four multiplies each per pair of
+	// bins
+	//
+	ulMults += ((NUM_SAMPLES / 4) - 1) * 12;
+
+	//
+	// The magnitude of every bin, then the mean and gain of every bar
+	//
+	ulMults += NUM_BINS * 2;
+	ulMults += ulNumBars * 2;
+
+	return(ulMults);
+}
+
+//*****************************************************************************
+//
+// Run a sine through the bank and read back the level of each band.
+//
+// param fFreq: the sine's frequency, in Hz
+//
+//*****************************************************************************
+static void
+SineRun(float fFreq)
+{
+	unsigned long ulSample, ulBlock, ulTotal;
+	double dPhase, dStep;
+
+	dPhase = 0;
+	dStep = 2 * M_PI * fFreq / SAMPLE_RATE;
+	ulTotal = (SETTLE_SECONDS + MEASURE_SECONDS) * SAMPLE_RATE;
+	for(ulSample = 0; ulSample < ulTotal; ulSample += DMA_SIZE)
+	{
+		for(ulBlock = 0; ulBlock < DMA_SIZE; ulBlock++)
+		{
+			g_pfBlock[ulBlock] = AMPLITUDE * (float)sin(dPhase);
+			dPhase += dStep;
+			if(dPhase > 2 * M_PI)
+			{
+				dPhase -= 2 * M_PI;
+			}
+		}
+		FilterbankProcess(&g_sBank, g_pfBlock, DMA_SIZE);
+
+		//
+		// Read after every block, as the DSP loop does, but throw the levels
+		// away until the bank has settled, and read the whole measurement in
+		// one go at the end
+		//
+		if(ulSample < SETTLE_SECONDS * SAMPLE_RATE)
+		{
+			FilterbankRead(&g_sBank, g_pfLevels);
+		}
+	}
+	FilterbankRead(&g_sBank, g_pfLevels);
+}
+
+//*****************************************************************************
+//
+// Run the benchmark.
+//
+//*****************************************************************************
+int
+main(void)
+{
+	static const unsigned long pulFractions[] =
+	{
+		FB_OCTAVE_1, FB_OCTAVE_3, FB_OCTAVE_6
+	};
+	unsigned long ulTest, ulBands, ulBand, ulOther, ulFFT;
+	float fCounted, fFilterbank, fWorstGain, fWorstReject, fGain, fReject;
+	int iBad, iFailed;
+
+	iFailed = 0;
+	printf("%.0f Hz sampling, bands from %d to %d Hz, multiplies per sample\n",
+		   (float)SAMPLE_RATE, MIN_FREQ, MAX_FREQ);
+	printf("                           filterbank         FFT path\n");
+	printf("octave bands  sections/sample  mults  frames %4d  frames %d"
+		   "   center  reject\n", NUM_SAMPLES, DMA_SIZE);
+	printf("              design  counted         apart        apart"
+		   "       worst   worst\n");
+
+	for(ulTest = 0; ulTest < 3; ulTest++)
+	{
+		ulBands = FilterbankInit(&g_sBank, sizeof(g_sBank), SAMPLE_RATE,
+								 pulFractions[ulTest], MIN_FREQ, MAX_FREQ);
+		if(ulBands == 0)
+		{
+			printf("1/%lu: no bands\n", pulFractions[ulTest]);
+			iFailed = 1;
+			continue;
+		}
+
+		//
+		// Play a sine at each band's center, checking that band reads it at
+		// its amplitude and that the bands two or more away reject it
+		//
+		g_ulSections = 0;
+		g_ulSquares = 0;
+		fWorstGain = 0;
+		fWorstReject = 1000;
+		for(ulBand = 0; ulBand < ulBands; ulBand++)
+		{
+			SineRun(g_sBank.psBands[ulBand].fCenter);
+
+			fGain = (g_pfLevels[ulBand] / AMPLITUDE) - 1.0f;
+			if(fabsf(fGain) > fabsf(fWorstGain))
+			{
+				fWorstGain = fGain;
+			}
+			for(ulOther = 0; ulOther < ulBands; ulOther++)
+			{
+				if((ulOther + 2 > ulBand) && (ulOther < ulBand + 2))
+				{
+					continue;
+				}
+				fReject = 20 * log10f(AMPLITUDE /
+									  (g_pfLevels[ulOther] + 1e-6f));
+				if(fReject < fWorstReject)
+				{
+					fWorstReject = fReject;
+				}
+			}
+		}
+
+		//
+		// The bank's own count has to match the kernel's, and come out at
+		// the figure it worked out at design time
+		//
+		fCounted = (float)g_sBank.sCost.ulSections /
+				   (float)g_sBank.sCost.ulSamples;
+		fFilterbank = (fCounted * 5) +
+					  ((float)g_ulSquares / (float)g_sBank.sCost.ulSamples);
+		ulFFT = FFTMultiplies(ulBands);
+
+		iBad = ((g_sBank.sCost.ulSections != g_ulSections) ||
+				(fabsf(fCounted - g_sBank.sCost.fSectionsPerSample) >
+				 (0.01f * g_sBank.sCost.fSectionsPerSample)) ||
+				(fabsf(fWorstGain) > CENTER_TOLERANCE) ||
+				(fWorstReject < REJECTION_DB));
+
+		printf(" 1/%lu  %4lu  %7.1f  %7.1f  %5.0f  %11.1f  %11.1f  %+5.2f%%"
+			   "  %4.1f dB  %s\n", pulFractions[ulTest], ulBands,
+			   g_sBank.sCost.fSectionsPerSample, fCounted, fFilterbank,
+			   (float)ulFFT / NUM_SAMPLES, (float)ulFFT / DMA_SIZE,
+			   fWorstGain * 100, fWorstReject, iBad ? "FAILED" : "ok");
+		iFailed |= iBad;
+	}
+
+	printf("\nFFT path: %lu multiplies and %d square roots per frame\n",
+		   FFTMultiplies(0), NUM_BINS);
+	printf("\n%s\n", iFailed ? "FAILED" : "all tests pass");
+	return(iFailed);
+}
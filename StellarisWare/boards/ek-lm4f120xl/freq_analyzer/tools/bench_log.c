@@ -0,0 +1,187 @@
+//*****************************************************************************
+//
+// bench_log.c - Host microbenchmark for the dB bar kernel.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Compares BarsLog2 against log10f, for both speed and accuracy, over levels
+// spread evenly in dB from DB_RANGE below the maximum up to the maximum.
+// Then checks that BarsQuantizeDb gives the same heights as working each one
+// out with log10f would.
+//
+// As with bench_bars, this brings its own plain C versions of the CMSIS
+// functions bars.c calls, and the times are for the host.  log10f is a
+// library call with range reduction and branches on any target, where
+// BarsLog2 is a handful of integer and multiply-add instructions, so the
+// Cortex-M4F should see at least the same advantage.
+//
+// Build: cc -O2 -I../../../../dsplib -o bench_log bench_log.c -lm
+// Usage: bench_log [passes]
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+//
+// Stand in for arm_math.h, which only builds for the target
+//
+#define _ARM_MATH_H
+typedef float float32_t;
+
+static void
+arm_mult_f32(float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst,
+			 unsigned long blockSize)
+{
+	unsigned long i;
+
+	for(i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrcA[i] * pSrcB[i];
+	}
+}
+
+static void
+arm_scale_f32(float32_t *pSrc, float32_t scale, float32_t *pDst,
+			  unsigned long blockSize)
+{
+	unsigned long i;
+
+	for(i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrc[i] * scale;
+	}
+}
+
+#include "../bars.c"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+#define MAX_NUMBARS				300
+#define BAR_HEIGHT				185
+#define NUM_LEVELS				(MAX_NUMBARS * 64)
+#define DEFAULT_PASSES			2000
+
+//
+// The span of levels to test, and the range the heights are checked over
+//
+#define DB_RANGE				120.0f
+#define DB_FLOOR				(-60.0f)
+#define DB_CEILING				0.0f
+
+//*****************************************************************************
+//
+// The levels, and the results from each way of taking their logarithms
+//
+//*****************************************************************************
+static float32_t g_pfLevels[NUM_LEVELS];
+static float32_t g_pfFast[NUM_LEVELS];
+static float32_t g_pfRef[NUM_LEVELS];
+static float32_t g_pfWork[MAX_NUMBARS];
+static unsigned char g_pucFast[MAX_NUMBARS];
+
+static double
+Seconds(void)
+{
+	struct timespec sTime;
+
+	clock_gettime(CLOCK_MONOTONIC, &sTime);
+	return((double)sTime.tv_sec + ((double)sTime.tv_nsec * 1e-9));
+}
+
+int
+main(int argc, char **argv)
+{
+	unsigned long ulPasses, ulPass, i, j, ulMismatch, ulWorst, ulDiff;
+	double dRef, dFast, dStart, dErr, dWorstDb;
+	float32_t fRef;
+	int iRef;
+
+	ulPasses = (argc > 1) ? strtoul(argv[1], 0, 0) : DEFAULT_PASSES;
+
+	for(i = 0; i < NUM_LEVELS; i++)
+	{
+		g_pfLevels[i] = powf(10.0f, (-DB_RANGE * (float32_t)rand() /
+									 (float32_t)RAND_MAX) / 20.0f);
+	}
+
+	//
+	// Time each over the whole set of levels, a pass at a time
+	//
+	dStart = Seconds();
+	for(ulPass = 0; ulPass < ulPasses; ulPass++)
+	{
+		for(i = 0; i < NUM_LEVELS; i++)
+		{
+			g_pfRef[i] = 20.0f * log10f(g_pfLevels[i]);
+		}
+	}
+	dRef = Seconds() - dStart;
+
+	dStart = Seconds();
+	for(ulPass = 0; ulPass < ulPasses; ulPass++)
+	{
+		BarsLog2(g_pfLevels, g_pfFast, NUM_LEVELS);
+	}
+	dFast = Seconds() - dStart;
+
+	dWorstDb = 0;
+	for(i = 0; i < NUM_LEVELS; i++)
+	{
+		dErr = fabs((g_pfFast[i] * DB_PER_LOG2) - g_pfRef[i]);
+		if(dErr > dWorstDb)
+		{
+			dWorstDb = dErr;
+		}
+	}
+
+	//
+	// Quantize the levels a frame of bars at a time, and compare against
+	// heights worked out directly from log10f
+	//
+	ulMismatch = 0;
+	ulWorst = 0;
+	for(i = 0; i < NUM_LEVELS; i += MAX_NUMBARS)
+	{
+		for(j = 0; j < MAX_NUMBARS; j++)
+		{
+			g_pfWork[j] = g_pfLevels[i + j];
+		}
+		BarsQuantizeDb(g_pfWork, 0, 1.0f, DB_FLOOR, DB_CEILING, g_pucFast,
+					   MAX_NUMBARS, BAR_HEIGHT);
+
+		for(j = 0; j < MAX_NUMBARS; j++)
+		{
+			fRef = ((g_pfRef[i + j] - DB_FLOOR) * BAR_HEIGHT) /
+				   (DB_CEILING - DB_FLOOR);
+			iRef = (fRef < 0) ? 0 :
+				   ((fRef < BAR_HEIGHT) ? (int)fRef : BAR_HEIGHT);
+			ulDiff = (unsigned long)abs(iRef - (int)g_pucFast[j]);
+			if(ulDiff)
+			{
+				ulMismatch++;
+			}
+			if(ulDiff > ulWorst)
+			{
+				ulWorst = ulDiff;
+			}
+		}
+	}
+
+	printf("%lu passes of %d levels\n", ulPasses, NUM_LEVELS);
+	printf("20 * log10f:        %6.2f ns/level\n",
+		   dRef * 1e9 / ((double)ulPasses * NUM_LEVELS));
+	printf("BarsLog2:           %6.2f ns/level\n",
+		   dFast * 1e9 / ((double)ulPasses * NUM_LEVELS));
+	printf("worst error:        %6.4f dB\n", dWorstDb);
+	printf("heights that differ: %lu of %d, by at most %lu\n", ulMismatch,
+		   NUM_LEVELS, ulWorst);
+
+	return((ulWorst > 1) ? 1 : 0);
+}
@@ -0,0 +1,466 @@
+//*****************************************************************************
+//
+// bench_reconfig.c - Host test of carrying bar normalization over to a new
+// bar layout, as DSPReconfigure does with BarsRemap.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// First BarsRemap is checked on layouts whose answers are known: the same
+// layout, a constant, and bars split in two and merged in pairs.
+//
+// Then a noisy spectrum with a few tones is fed through the bar
+// normalization, with the same attack and release as dsp.c, one frame every
+// 50 ms.  The bars are laid out one way for a while and then changed to
+// another.  Three runs are compared after the change:
+//
+// * reset: the maxima start from 0, as every config change used to do
+// * carried: the maxima are carried over with BarsRemap
+// * reference: the new layout has been running all along, which is what the
+//   display should look like
+//
+// For each of the first frames after the change, it prints the mean height
+// error against the reference and the number of bars pinned at full height.
+// It fails if carrying the maxima over isn't closer to the reference than
+// resetting them.
+//
+// Build: cc -O2 -I../../../../dsplib -o bench_reconfig bench_reconfig.c -lm
+// Usage: bench_reconfig [frames]
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+//
+// Stand in for arm_math.h, which only builds for the target
+//
+#define _ARM_MATH_H
+typedef float float32_t;
+
+static void
+arm_mult_f32(float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst,
+			 unsigned long blockSize)
+{
+	unsigned long i;
+
+	for(i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrcA[i] * pSrcB[i];
+	}
+}
+
+static void
+arm_scale_f32(float32_t *pSrc, float32_t scale, float32_t *pDst,
+			  unsigned long blockSize)
+{
+	unsigned long i;
+
+	for(i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrc[i] * scale;
+	}
+}
+
+#include "../bars.c"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+#define MAX_NUMBARS				300
+#define BAR_HEIGHT				185
+#define DEFAULT_FRAMES			2000
+
+//
+// The spectrum: 1024 bins of the 2048 point FFT at 26 kHz, the default
+// sampling rate
+//
+#define NUM_BINS				1024
+#define HZ_PER_BIN				(26000.0f / 2048.0f)
+
+//
+// The frames shown after the change, and the normalization constants from
+// dsp.h
+//
+#define FRAMES_SHOWN			8
+#define FRAME_MS				50.0f
+#define NORM_RELEASE_MS			55000.0f
+
+//*****************************************************************************
+//
+// A bar layout and the normalization state of its bars.
+//
+//*****************************************************************************
+typedef struct
+{
+	unsigned long ulNumBars;
+
+	//
+	// The first and last bin of each bar
+	//
+	unsigned long pulFirst[MAX_NUMBARS];
+	unsigned long pulLast[MAX_NUMBARS];
+
+	//
+	// The edges of the bars in Hz, as LayoutEdgesGet works them out
+	//
+	float32_t pfEdges[MAX_NUMBARS + 1];
+
+	float32_t pfMax[MAX_NUMBARS];
+	unsigned char pucHeights[MAX_NUMBARS];
+}
+tLayout;
+
+//*****************************************************************************
+//
+// One layout change to try.
+//
+//*****************************************************************************
+typedef struct
+{
+	const char *pcName;
+	unsigned long ulBarsBefore;
+	float fMinBefore, fMaxBefore;
+	unsigned long ulBarsAfter;
+	float fMinAfter, fMaxAfter;
+}
+tChange;
+
+static const tChange g_psChanges[] =
+{
+	{ "75 -> 150 bars", 75, 40, 13000, 150, 40, 13000 },
+	{ "150 -> 30 bars", 150, 40, 13000, 30, 40, 13000 },
+	{ "band 40-13k -> 200-5k", 75, 40, 13000, 75, 200, 5000 },
+	{ "band 200-5k -> 40-13k", 75, 200, 5000, 75, 40, 13000 },
+};
+
+#define NUM_CHANGES				(sizeof(g_psChanges) / sizeof(g_psChanges[0]))
+
+//*****************************************************************************
+//
+// The spectrum of the current frame
+//
+//*****************************************************************************
+static float32_t g_pfBins[NUM_BINS];
+
+//*****************************************************************************
+//
+// A uniform random number in (0, 1], from a generator that gives the same
+// sequence on every host.
+//
+//*****************************************************************************
+static float
+Random(void)
+{
+	static uint32_t ulState = 12345;
+
+	ulState = (ulState * 1664525) + 1013904223;
+	return(((ulState >> 8) + 1) / 16777216.0f);
+}
+
+//*****************************************************************************
+//
+// Make up the next frame's spectrum: pink noise with a few tones over it,
+// each bin's power scattered as the power of a noisy FFT bin is, and the
+// whole frame louder or quieter from one frame to the next.
+//
+//*****************************************************************************
+static void
+SpectrumMake(void)
+{
+	unsigned long ulBin;
+	float fLoudness, fFreq;
+
+	fLoudness = 0.3f + Random();
+	for(ulBin = 0; ulBin < NUM_BINS; ulBin++)
+	{
+		fFreq = (ulBin + 1) * HZ_PER_BIN;
+		g_pfBins[ulBin] = fLoudness * (1000.0f / fFreq) * -logf(Random());
+	}
+	g_pfBins[(unsigned long)(440.0f / HZ_PER_BIN)] += 50.0f * fLoudness;
+	g_pfBins[(unsigned long)(1500.0f / HZ_PER_BIN)] += 20.0f * fLoudness;
+	g_pfBins[(unsigned long)(6000.0f / HZ_PER_BIN)] += 5.0f * fLoudness;
+}
+
+//*****************************************************************************
+//
+// Lay bars out logarithmically over a band, each at least one bin wide, the
+// way setFreqBreakpoints does.
+//
+// param psLayout: the layout
+// param ulNumBars: the number of bars
+// param fMin, fMax: the band, in Hz
+//
+//*****************************************************************************
+static void
+LayoutMake(tLayout *psLayout, unsigned long ulNumBars, float fMin, float fMax)
+{
+	unsigned long ulBar, ulEdge, ulLast;
+
+	ulLast = 0;
+	psLayout->ulNumBars = 0;
+	for(ulBar = 0; ulBar < ulNumBars; ulBar++)
+	{
+		ulEdge = (unsigned long)(fMin * powf(fMax / fMin,
+											(float)(ulBar + 1) / ulNumBars) /
+								 HZ_PER_BIN);
+		psLayout->pulFirst[ulBar] = ulBar ? (ulLast + 1) :
+									(unsigned long)(fMin / HZ_PER_BIN);
+		if(ulEdge < psLayout->pulFirst[ulBar])
+		{
+			ulEdge = psLayout->pulFirst[ulBar];
+		}
+		if(ulEdge >= NUM_BINS)
+		{
+			break;
+		}
+		psLayout->pulLast[ulBar] = ulEdge;
+		ulLast = ulEdge;
+		psLayout->ulNumBars++;
+	}
+
+	psLayout->pfEdges[0] = HZ_PER_BIN * (psLayout->pulFirst[0] - 0.5f);
+	for(ulBar = 0; ulBar < psLayout->ulNumBars; ulBar++)
+	{
+		psLayout->pfEdges[ulBar + 1] = HZ_PER_BIN *
+									   (psLayout->pulLast[ulBar] + 0.5f);
+		psLayout->pfMax[ulBar] = 0;
+	}
+}
+
+//*****************************************************************************
+//
+// Run a frame through a layout: the mean power of each bar's bins,
+// normalized against its maximum as NormalizeBars does with an attack of 0.
+//
+// param psLayout: the layout
+//
+//*****************************************************************************
+static void
+LayoutFrame(tLayout *psLayout)
+{
+	unsigned long ulBar, ulBin;
+	float32_t pfPower[MAX_NUMBARS], pfScale[MAX_NUMBARS];
+	float32_t fRelease;
+
+	fRelease = expf(-FRAME_MS / NORM_RELEASE_MS);
+	for(ulBar = 0; ulBar < psLayout->ulNumBars; ulBar++)
+	{
+		pfPower[ulBar] = 0;
+		for(ulBin = psLayout->pulFirst[ulBar];
+			ulBin <= psLayout->pulLast[ulBar]; ulBin++)
+		{
+			pfPower[ulBar] += g_pfBins[ulBin];
+		}
+		pfPower[ulBar] /= (psLayout->pulLast[ulBar] -
+						   psLayout->pulFirst[ulBar] + 1);
+
+		psLayout->pfMax[ulBar] *= fRelease;
+		if(pfPower[ulBar] > psLayout->pfMax[ulBar])
+		{
+			psLayout->pfMax[ulBar] = pfPower[ulBar];
+		}
+		pfScale[ulBar] = 1.0f / psLayout->pfMax[ulBar];
+	}
+	BarsQuantize(pfPower, pfScale, BAR_HEIGHT, psLayout->pucHeights,
+				 psLayout->ulNumBars, BAR_HEIGHT);
+}
+
+//*****************************************************************************
+//
+// Compare a layout's heights against the reference.
+//
+// param psLayout: the layout
+// param psReference: the same bars, run from the start
+// param pulFull: returns the number of bars at full height
+// return: the mean difference in height, in pixels
+//
+//*****************************************************************************
+static float
+HeightError(const tLayout *psLayout, const tLayout *psReference,
+			unsigned long *pulFull)
+{
+	unsigned long ulBar;
+	float fError;
+
+	fError = 0;
+	*pulFull = 0;
+	for(ulBar = 0; ulBar < psLayout->ulNumBars; ulBar++)
+	{
+		fError += fabsf((float)psLayout->pucHeights[ulBar] -
+						(float)psReference->pucHeights[ulBar]);
+		if(psLayout->pucHeights[ulBar] == BAR_HEIGHT)
+		{
+			(*pulFull)++;
+		}
+	}
+	return(fError / psLayout->ulNumBars);
+}
+
+//*****************************************************************************
+//
+// Check BarsRemap on layouts whose answers are known.
+//
+// return: 0 if it gets them all right, else 1
+//
+//*****************************************************************************
+static int
+RemapCheck(void)
+{
+	float32_t pfEdges[9], pfHalves[17], pfValues[16], pfOut[16];
+	unsigned long i;
+	int iFailed;
+
+	iFailed = 0;
+	for(i = 0; i <= 16; i++)
+	{
+		pfHalves[i] = 100.0f + (50.0f * i);
+	}
+	for(i = 0; i <= 8; i++)
+	{
+		pfEdges[i] = pfHalves[2 * i];
+	}
+	for(i = 0; i < 16; i++)
+	{
+		pfValues[i] = (float32_t)(i * i);
+	}
+
+	//
+	// The same layout gives back the same values
+	//
+	BarsRemap(pfHalves, pfValues, 16, pfHalves, pfOut, 16, -1);
+	for(i = 0; i < 16; i++)
+	{
+		iFailed |= (pfOut[i] != pfValues[i]);
+	}
+
+	//
+	// Merging pairs of bars gives the mean of each pair, and splitting them
+	// again gives each half its pair's mean
+	//
+	BarsRemap(pfHalves, pfValues, 16, pfEdges, pfOut, 8, -1);
+	for(i = 0; i < 8; i++)
+	{
+		iFailed |= (fabsf(pfOut[i] - ((pfValues[2 * i] +
+									   pfValues[(2 * i) + 1]) / 2)) > 0.001f);
+	}
+	BarsRemap(pfEdges, pfOut, 8, pfHalves, pfValues, 16, -1);
+	for(i = 0; i < 16; i++)
+	{
+		iFailed |= (pfValues[i] != pfOut[i / 2]);
+	}
+
+	//
+	// A constant stays constant over a shifted layout, and bars past the end
+	// of the old ones get the uncovered value
+	//
+	for(i = 0; i < 16; i++)
+	{
+		pfValues[i] = 7.0f;
+	}
+	for(i = 0; i <= 8; i++)
+	{
+		pfEdges[i] = 325.0f + (120.0f * i);
+	}
+	BarsRemap(pfHalves, pfValues, 16, pfEdges, pfOut, 8, -1);
+	for(i = 0; i < 8; i++)
+	{
+		iFailed |= (pfEdges[i] < pfHalves[16]) ?
+				   (fabsf(pfOut[i] - 7.0f) > 0.001f) : (pfOut[i] != -1);
+	}
+
+	printf("BarsRemap on known layouts: %s\n", iFailed ? "FAILED" : "ok");
+	return(iFailed);
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(int argc, char **argv)
+{
+	static tLayout sBefore, sReset, sCarried, sReference;
+	unsigned long ulFrames, ulFrame, ulChange, ulBar, ulFull;
+	float32_t pfLevels[MAX_NUMBARS], fLoudest;
+	float fResetError, fCarriedError, fError;
+	int iFailed;
+
+	ulFrames = (argc > 1) ? strtoul(argv[1], 0, 0) : DEFAULT_FRAMES;
+	if(!ulFrames)
+	{
+		fprintf(stderr, "Usage: bench_reconfig [frames]\n");
+		return(2);
+	}
+
+	iFailed = RemapCheck();
+
+	for(ulChange = 0; ulChange < NUM_CHANGES; ulChange++)
+	{
+		const tChange *psChange = &g_psChanges[ulChange];
+
+		LayoutMake(&sBefore, psChange->ulBarsBefore, psChange->fMinBefore,
+				   psChange->fMaxBefore);
+		LayoutMake(&sReference, psChange->ulBarsAfter, psChange->fMinAfter,
+				   psChange->fMaxAfter);
+		for(ulFrame = 0; ulFrame < ulFrames; ulFrame++)
+		{
+			SpectrumMake();
+			LayoutFrame(&sBefore);
+			LayoutFrame(&sReference);
+		}
+
+		//
+		// Change the layout, with the maxima reset and carried over.  The
+		// gains are all 1 here, so the levels are the maxima themselves.
+		//
+		LayoutMake(&sReset, psChange->ulBarsAfter, psChange->fMinAfter,
+				   psChange->fMaxAfter);
+		sCarried = sReset;
+		fLoudest = 0;
+		for(ulBar = 0; ulBar < sBefore.ulNumBars; ulBar++)
+		{
+			pfLevels[ulBar] = sBefore.pfMax[ulBar];
+			if(pfLevels[ulBar] > fLoudest)
+			{
+				fLoudest = pfLevels[ulBar];
+			}
+		}
+		BarsRemap(sBefore.pfEdges, pfLevels, sBefore.ulNumBars,
+				  sCarried.pfEdges, sCarried.pfMax, sCarried.ulNumBars,
+				  fLoudest);
+
+		printf("\n%s (%lu -> %lu bars)\n", psChange->pcName,
+			   sBefore.ulNumBars, sReference.ulNumBars);
+		printf("frame   reset: error  full    carried: error  full\n");
+		fResetError = 0;
+		fCarriedError = 0;
+		for(ulFrame = 0; ulFrame < FRAMES_SHOWN; ulFrame++)
+		{
+			SpectrumMake();
+			LayoutFrame(&sReset);
+			LayoutFrame(&sCarried);
+			LayoutFrame(&sReference);
+
+			fError = HeightError(&sReset, &sReference, &ulFull);
+			fResetError += fError;
+			printf("%5lu   %12.1f  %4lu", ulFrame, fError, ulFull);
+			fError = HeightError(&sCarried, &sReference, &ulFull);
+			fCarriedError += fError;
+			printf("   %14.1f  %4lu\n", fError, ulFull);
+		}
+		printf("mean    %12.1f        %14.1f\n", fResetError / FRAMES_SHOWN,
+			   fCarriedError / FRAMES_SHOWN);
+		if(fCarriedError >= fResetError)
+		{
+			iFailed = 1;
+		}
+	}
+
+	printf("\n%s\n", iFailed ? "FAILED" : "all tests pass");
+	return(iFailed);
+}
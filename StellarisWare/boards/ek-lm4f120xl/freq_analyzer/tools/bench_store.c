@@ -0,0 +1,467 @@
+//*****************************************************************************
+//
+// bench_store.c - Host test of the record log in store.c, run against the
+// flash model in flash_sim.c.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Writes records shaped like the ones the application keeps (a small config
+// record and a bar layout gathered from three parts) and checks that:
+//
+// * each record reads back as written, after StoreInit as at a reset
+// * writing a record that hasn't changed programs nothing
+// * over many writes, every block of both banks is erased about as often,
+//   and no word is ever programmed over one that wasn't erased
+// * if the power goes at any step of a write, with or without the bank
+//   filling up part way through it, each record reads back as either what it
+//   was before or what was being written, and the log can still be written
+//   afterwards
+//
+// Any failure makes the exit status nonzero.
+//
+// Build: cc -O2 -I.. -o bench_store bench_store.c
+// Usage: bench_store [writes]
+//
+//*****************************************************************************
+
+#define HOST_BUILD
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flash_sim.c"
+#include "../store.c"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+#define DEFAULT_WRITES			5000
+
+//
+// The most bars a layout is kept for, as gui.h has it
+//
+#define MAX_NUMBARS				300
+
+//*****************************************************************************
+//
+// Stand ins for the records the application keeps
+//
+//*****************************************************************************
+typedef struct
+{
+	unsigned long ulSamplingFreq;
+	unsigned long ulMinDisplayFreq;
+	unsigned long ulMaxDisplayFreq;
+	unsigned long ulNumBars;
+	unsigned char pucFlags[4];
+}
+tTestConfig;
+
+typedef struct
+{
+	unsigned long ulKey;
+	unsigned long ulNumBars;
+	float pfGain[MAX_NUMBARS];
+	unsigned int puiEdges[MAX_NUMBARS + 1];
+}
+tTestLayout;
+
+//*****************************************************************************
+//
+// Make up a config record.
+//
+// param psConfig: where to make it
+// param ulSeed: what to make it from; different seeds give different records
+//
+//*****************************************************************************
+static void
+ConfigMake(tTestConfig *psConfig, unsigned long ulSeed)
+{
+	memset(psConfig, 0, sizeof(*psConfig));
+	psConfig->ulSamplingFreq = 4000 + ((ulSeed * 1000) % 76000);
+	psConfig->ulMinDisplayFreq = 1 + (ulSeed % 5000);
+	psConfig->ulMaxDisplayFreq = 1000 + (ulSeed % 12000);
+	psConfig->ulNumBars = 8 + (ulSeed % 293);
+	psConfig->pucFlags[0] = ulSeed & 1;
+	psConfig->pucFlags[1] = (ulSeed >> 1) & 1;
+}
+
+//*****************************************************************************
+//
+// Make up a layout record.
+//
+// param psLayout: where to make it
+// param ulSeed: what to make it from; different seeds give different records
+//
+//*****************************************************************************
+static void
+LayoutMake(tTestLayout *psLayout, unsigned long ulSeed)
+{
+	unsigned long ulBar;
+
+	memset(psLayout, 0, sizeof(*psLayout));
+	psLayout->ulKey = StoreHash(STORE_HASH_INIT, &ulSeed, sizeof(ulSeed));
+	psLayout->ulNumBars = 8 + ((ulSeed * 37) % 293);
+	for(ulBar = 0; ulBar < psLayout->ulNumBars; ulBar++)
+	{
+		psLayout->pfGain[ulBar] = (float)(ulSeed + ulBar) / 7.0f;
+		psLayout->puiEdges[ulBar] = ulBar * 3 + ulSeed;
+	}
+	psLayout->puiEdges[ulBar] = ulBar * 3 + ulSeed;
+}
+
+//*****************************************************************************
+//
+// Write a layout record the way dsp.c does: the key and bar count, then only
+// as many gains and edges as there are bars.
+//
+// param psLayout: the layout
+// return: what StoreWrite returned
+//
+//*****************************************************************************
+static long
+LayoutWrite(const tTestLayout *psLayout)
+{
+	tStorePart psParts[3];
+
+	psParts[0].pvData = psLayout;
+	psParts[0].ulLength = 2 * sizeof(unsigned long);
+	psParts[1].pvData = psLayout->pfGain;
+	psParts[1].ulLength = psLayout->ulNumBars * sizeof(float);
+	psParts[2].pvData = psLayout->puiEdges;
+	psParts[2].ulLength = (psLayout->ulNumBars + 1) * sizeof(unsigned int);
+	return(StoreWrite(STORE_TAG_LAYOUT, psParts, 3));
+}
+
+//*****************************************************************************
+//
+// Write a config record.
+//
+// param psConfig: the config
+// return: what StoreWrite returned
+//
+//*****************************************************************************
+static long
+ConfigWrite(const tTestConfig *psConfig)
+{
+	tStorePart sPart;
+
+	sPart.pvData = psConfig;
+	sPart.ulLength = sizeof(*psConfig);
+	return(StoreWrite(STORE_TAG_CONFIG, &sPart, 1));
+}
+
+//*****************************************************************************
+//
+// Check that the config record reads back as one of two configs.
+//
+// param psA, psB: the configs it may be; psB may be NULL
+// return: 0 if it is one of them, else 1
+//
+//*****************************************************************************
+static int
+ConfigCheck(const tTestConfig *psA, const tTestConfig *psB)
+{
+	tTestConfig sRead;
+
+	if((StoreFind(STORE_TAG_CONFIG) != sizeof(sRead)) ||
+	   (StoreRead(STORE_TAG_CONFIG, 0, &sRead, sizeof(sRead)) !=
+		sizeof(sRead)))
+	{
+		return(1);
+	}
+	if(!memcmp(&sRead, psA, sizeof(sRead)) ||
+	   (psB && !memcmp(&sRead, psB, sizeof(sRead))))
+	{
+		return(0);
+	}
+	return(1);
+}
+
+//*****************************************************************************
+//
+// Check that the layout record reads back as one of two layouts, reading it
+// a part at a time the way dsp.c does.
+//
+// param psA, psB: the layouts it may be; psB may be NULL
+// return: 0 if it is one of them, else 1
+//
+//*****************************************************************************
+static int
+LayoutCheck(const tTestLayout *psA, const tTestLayout *psB)
+{
+	static tTestLayout sRead;
+	unsigned long ulOffset, ulLength;
+	long lLength;
+
+	memset(&sRead, 0, sizeof(sRead));
+	lLength = StoreFind(STORE_TAG_LAYOUT);
+	if((lLength < (long)(2 * sizeof(unsigned long))) ||
+	   (StoreRead(STORE_TAG_LAYOUT, 0, &sRead, 2 * sizeof(unsigned long)) !=
+		2 * sizeof(unsigned long)) ||
+	   (sRead.ulNumBars > MAX_NUMBARS))
+	{
+		return(1);
+	}
+	ulOffset = 2 * sizeof(unsigned long);
+	ulLength = sRead.ulNumBars * sizeof(float);
+	if(StoreRead(STORE_TAG_LAYOUT, ulOffset, sRead.pfGain, ulLength) !=
+	   ulLength)
+	{
+		return(1);
+	}
+	ulOffset += ulLength;
+	ulLength = (sRead.ulNumBars + 1) * sizeof(unsigned int);
+	if((StoreRead(STORE_TAG_LAYOUT, ulOffset, sRead.puiEdges, ulLength) !=
+		ulLength) || (lLength != (long)(ulOffset + ulLength)))
+	{
+		return(1);
+	}
+	if(!memcmp(&sRead, psA, sizeof(sRead)) ||
+	   (psB && !memcmp(&sRead, psB, sizeof(sRead))))
+	{
+		return(0);
+	}
+	return(1);
+}
+
+//*****************************************************************************
+//
+// Fill the log from a fresh part with a run of config writes and a layout
+// write, which leaves the bank in use with the given room to spare or less.
+//
+// param ulWrites: the number of config records to write
+// param psConfig: returns the last config written
+// param psLayout: returns the layout written
+//
+//*****************************************************************************
+static void
+LogPrepare(unsigned long ulWrites, tTestConfig *psConfig,
+		   tTestLayout *psLayout)
+{
+	unsigned long ulWrite;
+
+	FlashSimReset();
+	StoreInit();
+	LayoutMake(psLayout, 1);
+	LayoutWrite(psLayout);
+	for(ulWrite = 0; ulWrite < ulWrites; ulWrite++)
+	{
+		ConfigMake(psConfig, 1000 + ulWrite);
+		ConfigWrite(psConfig);
+	}
+}
+
+//*****************************************************************************
+//
+// Cut the power at every step of a config write, and check what is left.
+//
+// param ulWrites: the config records written before the one cut short
+// return: 0 if every cut left the log as it should be, else 1
+//
+//*****************************************************************************
+static int
+PowerCutRun(unsigned long ulWrites)
+{
+	tTestConfig sOld, sNew, sAfter;
+	tTestLayout sLayout;
+	unsigned long ulSteps, ulStep, ulErases;
+	int iFailed;
+
+	//
+	// Count the steps the write takes when the power stays on
+	//
+	LogPrepare(ulWrites, &sOld, &sLayout);
+	ConfigMake(&sNew, 7);
+	FlashSimCountsClear();
+	ConfigWrite(&sNew);
+	ulSteps = g_sFlashSimCounts.ulWords + g_sFlashSimCounts.ulErases;
+	ulErases = g_sFlashSimCounts.ulErases;
+
+	iFailed = 0;
+	for(ulStep = 0; ulStep <= ulSteps; ulStep++)
+	{
+		LogPrepare(ulWrites, &sOld, &sLayout);
+		FlashSimPowerCut(ulStep);
+		ConfigWrite(&sNew);
+		FlashSimPowerRestore();
+
+		StoreInit();
+		if(ConfigCheck(&sOld, &sNew) || LayoutCheck(&sLayout, 0))
+		{
+			printf("  cut at step %lu of %lu: records lost\n", ulStep,
+				   ulSteps);
+			iFailed = 1;
+			continue;
+		}
+
+		ConfigMake(&sAfter, 8);
+		if(ConfigWrite(&sAfter) || ConfigCheck(&sAfter, 0) ||
+		   LayoutCheck(&sLayout, 0))
+		{
+			printf("  cut at step %lu of %lu: can't write after\n", ulStep,
+				   ulSteps);
+			iFailed = 1;
+		}
+	}
+
+	printf("power cut at each of %4lu steps, %lu erases: %s\n", ulSteps,
+		   ulErases, iFailed ? "FAILED" : "ok");
+	return(iFailed);
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(int argc, char **argv)
+{
+	static tTestLayout sLayout;
+	tTestConfig sConfig;
+	unsigned long ulWrites, ulWrite, ulBlock, ulMin, ulMax, ulErases;
+	unsigned long ulFill;
+	int iFailed;
+
+	ulWrites = (argc > 1) ? strtoul(argv[1], 0, 0) : DEFAULT_WRITES;
+	if(!ulWrites)
+	{
+		fprintf(stderr, "Usage: bench_store [writes]\n");
+		return(2);
+	}
+	iFailed = 0;
+
+	//
+	// A fresh part has nothing in it
+	//
+	FlashSimReset();
+	StoreInit();
+	if((StoreFind(STORE_TAG_CONFIG) >= 0) ||
+	   (StoreFind(STORE_TAG_LAYOUT) >= 0))
+	{
+		printf("fresh flash: records found\n");
+		iFailed = 1;
+	}
+
+	//
+	// Write both and read them back
+	//
+	ConfigMake(&sConfig, 1);
+	LayoutMake(&sLayout, 1);
+	if(ConfigWrite(&sConfig) || LayoutWrite(&sLayout))
+	{
+		printf("first writes failed\n");
+		iFailed = 1;
+	}
+	StoreInit();
+	if(ConfigCheck(&sConfig, 0) || LayoutCheck(&sLayout, 0))
+	{
+		printf("first records don't read back\n");
+		iFailed = 1;
+	}
+
+	//
+	// Writing them again unchanged programs nothing
+	//
+	FlashSimCountsClear();
+	ConfigWrite(&sConfig);
+	LayoutWrite(&sLayout);
+	printf("unchanged writes: %lu words programmed\n",
+		   g_sFlashSimCounts.ulWords);
+	if(g_sFlashSimCounts.ulWords)
+	{
+		iFailed = 1;
+	}
+
+	//
+	// Many writes, mostly config with a new layout now and then, each checked
+	// after a reset
+	//
+	FlashSimReset();
+	StoreInit();
+	for(ulWrite = 0; ulWrite < ulWrites; ulWrite++)
+	{
+		ConfigMake(&sConfig, ulWrite);
+		if(ConfigWrite(&sConfig))
+		{
+			printf("config write %lu failed\n", ulWrite);
+			iFailed = 1;
+			break;
+		}
+		if((ulWrite % 20) == 0)
+		{
+			LayoutMake(&sLayout, ulWrite);
+			if(LayoutWrite(&sLayout))
+			{
+				printf("layout write %lu failed\n", ulWrite);
+				iFailed = 1;
+				break;
+			}
+		}
+		StoreInit();
+		if(ConfigCheck(&sConfig, 0) || LayoutCheck(&sLayout, 0))
+		{
+			printf("write %lu doesn't read back\n", ulWrite);
+			iFailed = 1;
+			break;
+		}
+	}
+
+	ulMin = ~0UL;
+	ulMax = 0;
+	ulErases = 0;
+	for(ulBlock = STORE_BASE; ulBlock < STORE_BASE + (2 * STORE_BANK_SIZE);
+		ulBlock += STORE_BLOCK_SIZE)
+	{
+		ulErases += FlashSimBlockErases(ulBlock);
+		if(FlashSimBlockErases(ulBlock) < ulMin)
+		{
+			ulMin = FlashSimBlockErases(ulBlock);
+		}
+		if(FlashSimBlockErases(ulBlock) > ulMax)
+		{
+			ulMax = FlashSimBlockErases(ulBlock);
+		}
+	}
+	printf("%lu config and %lu layout writes: %lu words, erases per block "
+		   "%lu to %lu\n", ulWrites, (ulWrites + 19) / 20,
+		   g_sFlashSimCounts.ulWords, ulMin, ulMax);
+	if(g_sFlashSimCounts.ulOverwrites || g_sFlashSimCounts.ulFailures ||
+	   ((ulMax - ulMin) > 1))
+	{
+		printf("%lu words programmed over, %lu failures\n",
+			   g_sFlashSimCounts.ulOverwrites, g_sFlashSimCounts.ulFailures);
+		iFailed = 1;
+	}
+	if(g_sFlashSimCounts.ulErases != ulErases)
+	{
+		printf("blocks outside the log erased\n");
+		iFailed = 1;
+	}
+
+	//
+	// Cut the power during a write with plenty of room, and during one that
+	// fills the bank and has to move the records to the other one.  Find how
+	// many config writes leave the bank one write short of full.
+	//
+	iFailed |= PowerCutRun(3);
+	for(ulFill = 1; ulFill < 1000; ulFill++)
+	{
+		LogPrepare(ulFill, &sConfig, &sLayout);
+		FlashSimCountsClear();
+		ConfigMake(&sConfig, 7);
+		ConfigWrite(&sConfig);
+		if(g_sFlashSimCounts.ulErases)
+		{
+			break;
+		}
+	}
+	iFailed |= PowerCutRun(ulFill);
+
+	printf("%s\n", iFailed ? "FAILED" : "all tests pass");
+	return(iFailed);
+}
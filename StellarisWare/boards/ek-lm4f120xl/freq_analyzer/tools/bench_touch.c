@@ -0,0 +1,495 @@
+//*****************************************************************************
+//
+// bench_touch.c - Host benchmark for the pointer coalescing in pointer.c,
+// replaying touch traces against a model of the config page sliders.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Each trace is a list of the pointer messages the touch screen debouncer
+// sends, with the time each was sent.  It is replayed twice:
+//
+// * straight to the sliders, the way every message used to be delivered
+// * through PointerMessage, with the main loop calling PointerFlush every
+//   MAIN_LOOP_US, the way it is delivered now
+//
+// and for each the messages reaching the widget message queue and the slider
+// paints they cause are counted.  A slider is painted whenever a message
+// changes its value.  The longest the sliders went without seeing a move
+// the touch screen had sent is printed as well.  Both replays have to leave every slider at the same value, or the
+// exit status is nonzero.
+//
+// With no arguments, a set of traces shaped like what the debouncer sends at
+// TS_ACTIVE_RATE is built in: taps, a finger held still, and drags of a few
+// speeds.  Traces recorded from the board can be replayed instead, from text
+// files with one message per line:
+//
+//     <milliseconds> <d|m|u> <x> <y>
+//
+// for a press, move or release at screen position x, y.  Lines starting with
+// '#' are skipped.
+//
+// Build: cc -O2 -I.. -o bench_touch bench_touch.c
+// Usage: bench_touch [trace file ...]
+//
+//*****************************************************************************
+
+#define HOST_BUILD
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../latency.c"
+#include "../pointer.c"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The display frame period PointerInit is given, from MAX_REFRESH_RATE as
+// gui.c has it, and how often the main loop gets around to PointerFlush while
+// a config page is up.  The virtual clock counts microseconds.
+//
+#define MAX_REFRESH_RATE		18
+#define FRAME_US				(1000000 / MAX_REFRESH_RATE)
+#define MAIN_LOOP_US			1000
+
+//
+// The time between the debouncer's messages, from TS_ACTIVE_RATE in touch.c
+//
+#define SAMPLE_US				4000
+
+//
+// The longest trace that can be replayed
+//
+#define MAX_EVENTS				16384
+
+//*****************************************************************************
+//
+// One message from the touch screen
+//
+//*****************************************************************************
+typedef struct
+{
+	unsigned long ulTime;
+	unsigned long ulMessage;
+	long lX;
+	long lY;
+}
+tTouchEvent;
+
+//*****************************************************************************
+//
+// A slider on the second config page, as gui.c lays them out
+//
+//*****************************************************************************
+typedef struct
+{
+	long lXMin;
+	long lYMin;
+	long lWidth;
+	long lHeight;
+	long lMin;
+	long lMax;
+	long lValue;
+}
+tSliderModel;
+
+static const tSliderModel g_psSlidersInit[4] =
+{
+	{ 50, 45, 220, 25, 1000, 13000, 13000 },
+	{ 50, 90, 220, 25, 1, 5000, 40 },
+	{ 50, 135, 220, 25, 4000, 80000, 26000 },
+	{ 50, 180, 220, 25, 8, 300, 75 },
+};
+
+//*****************************************************************************
+//
+// What one replay of a trace did
+//
+//*****************************************************************************
+typedef struct
+{
+	unsigned long ulMessages;
+	unsigned long ulPaints;
+	unsigned long ulMaxLag;
+	long plValues[4];
+}
+tReplayCounts;
+
+//*****************************************************************************
+//
+// The trace being replayed
+//
+//*****************************************************************************
+static tTouchEvent g_psTrace[MAX_EVENTS];
+static unsigned long g_ulNumEvents;
+
+//
+// The sliders, the one the pointer went down on, or -1, and the counts for
+// the replay under way
+//
+static tSliderModel g_psSliderModels[4];
+static int g_iCaptured;
+static tReplayCounts g_sCounts;
+
+//
+// The time now, and whether any message from the touch screen is waiting to
+// reach the sliders, and since when
+//
+static unsigned long g_ulNow;
+static int g_iHeld;
+static unsigned long g_ulHeldTime;
+
+//
+// The debug output switch, which latency.c reads
+//
+unsigned char g_ucPrintDbg;
+
+//*****************************************************************************
+//
+// Add a message to the end of the trace.
+//
+// param ulTime: when it was sent, in microseconds
+// param ulMessage: the WIDGET_MSG_PTR_* message
+// param lX, lY: where the pointer was
+//
+//*****************************************************************************
+static void
+TraceAdd(unsigned long ulTime, unsigned long ulMessage, long lX, long lY)
+{
+	if(g_ulNumEvents < MAX_EVENTS)
+	{
+		g_psTrace[g_ulNumEvents].ulTime = ulTime;
+		g_psTrace[g_ulNumEvents].ulMessage = ulMessage;
+		g_psTrace[g_ulNumEvents].lX = lX;
+		g_psTrace[g_ulNumEvents].lY = lY;
+		g_ulNumEvents++;
+	}
+}
+
+//*****************************************************************************
+//
+// Add a touch to the trace that moves in a straight line at the debouncer's
+// rate, optionally wobbling a pixel either way along the way.
+//
+// param ulStart: when the press is sent, in microseconds
+// param ulLength: how long the pointer is down for, in microseconds
+// param lX0, lX1: where the pointer starts and ends on the X axis
+// param lY: where the pointer is on the Y axis
+// param lWobble: how far the pointer wobbles, in pixels
+// return: when the release is sent
+//
+//*****************************************************************************
+static unsigned long
+TraceStroke(unsigned long ulStart, unsigned long ulLength, long lX0, long lX1,
+			long lY, long lWobble)
+{
+	unsigned long ulTime;
+	long lX;
+
+	TraceAdd(ulStart, WIDGET_MSG_PTR_DOWN, lX0, lY);
+	for(ulTime = SAMPLE_US; ulTime < ulLength; ulTime += SAMPLE_US)
+	{
+		lX = lX0 + (((lX1 - lX0) * (long)ulTime) / (long)ulLength);
+		if((ulTime / SAMPLE_US) & 1)
+		{
+			lX += lWobble;
+		}
+		TraceAdd(ulStart + ulTime, WIDGET_MSG_PTR_MOVE, lX, lY);
+	}
+	TraceAdd(ulStart + ulLength, WIDGET_MSG_PTR_UP, lX1, lY);
+	return(ulStart + ulLength);
+}
+
+//*****************************************************************************
+//
+// Read a trace from a file.
+//
+// param pcFilename: the file
+// return: 0 on success, or -1 if the file couldn't be read
+//
+//*****************************************************************************
+static int
+TraceRead(const char *pcFilename)
+{
+	FILE *pFile;
+	char pcLine[128];
+	unsigned long ulMs;
+	char cType;
+	long lX, lY;
+
+	pFile = fopen(pcFilename, "r");
+	if(!pFile)
+	{
+		return(-1);
+	}
+
+	g_ulNumEvents = 0;
+	while(fgets(pcLine, sizeof(pcLine), pFile))
+	{
+		if((pcLine[0] == '#') ||
+		   (sscanf(pcLine, "%lu %c %ld %ld", &ulMs, &cType, &lX, &lY) != 4))
+		{
+			continue;
+		}
+		TraceAdd(ulMs * 1000,
+				 (cType == 'd') ? WIDGET_MSG_PTR_DOWN :
+				 (cType == 'u') ? WIDGET_MSG_PTR_UP : WIDGET_MSG_PTR_MOVE,
+				 lX, lY);
+	}
+
+	fclose(pFile);
+	return(0);
+}
+
+//*****************************************************************************
+//
+// Take a message the way the sliders do: a press captures the slider under
+// it, and while one is captured its value follows the pointer.  A change of
+// value is one paint.
+//
+// param ulMessage: the WIDGET_MSG_PTR_* message
+// param lX, lY: where the pointer is
+// return: 1, for a message that was queued
+//
+//*****************************************************************************
+static long
+SliderSink(unsigned long ulMessage, long lX, long lY)
+{
+	tSliderModel *psSlider;
+	long lValue;
+	int iSlider;
+
+	g_sCounts.ulMessages++;
+	if(g_iHeld && ((g_ulNow - g_ulHeldTime) > g_sCounts.ulMaxLag))
+	{
+		g_sCounts.ulMaxLag = g_ulNow - g_ulHeldTime;
+	}
+	g_iHeld = 0;
+
+	if(ulMessage == WIDGET_MSG_PTR_DOWN)
+	{
+		g_iCaptured = -1;
+		for(iSlider = 0; iSlider < 4; iSlider++)
+		{
+			psSlider = &g_psSliderModels[iSlider];
+			if((lX >= psSlider->lXMin) &&
+			   (lX < psSlider->lXMin + psSlider->lWidth) &&
+			   (lY >= psSlider->lYMin) &&
+			   (lY < psSlider->lYMin + psSlider->lHeight))
+			{
+				g_iCaptured = iSlider;
+			}
+		}
+	}
+	if(g_iCaptured < 0)
+	{
+		return(1);
+	}
+
+	psSlider = &g_psSliderModels[g_iCaptured];
+	lValue = psSlider->lMin +
+			 ((((lX - psSlider->lXMin) * (psSlider->lMax - psSlider->lMin)) +
+			   (psSlider->lWidth / 2)) / (psSlider->lWidth - 1));
+	if(lValue < psSlider->lMin)
+	{
+		lValue = psSlider->lMin;
+	}
+	if(lValue > psSlider->lMax)
+	{
+		lValue = psSlider->lMax;
+	}
+	if(lValue != psSlider->lValue)
+	{
+		psSlider->lValue = lValue;
+		g_sCounts.ulPaints++;
+	}
+
+	if(ulMessage == WIDGET_MSG_PTR_UP)
+	{
+		g_iCaptured = -1;
+	}
+	return(1);
+}
+
+//*****************************************************************************
+//
+// Put the sliders back to where the config page starts them.
+//
+//*****************************************************************************
+static void
+SlidersReset(void)
+{
+	memcpy(g_psSliderModels, g_psSlidersInit, sizeof(g_psSliderModels));
+	memset(&g_sCounts, 0, sizeof(g_sCounts));
+	g_iCaptured = -1;
+}
+
+//*****************************************************************************
+//
+// Note the values the sliders were left at.
+//
+// param psCounts: where to note them, along with the counts of the replay
+//
+//*****************************************************************************
+static void
+SlidersSave(tReplayCounts *psCounts)
+{
+	int iSlider;
+
+	*psCounts = g_sCounts;
+	for(iSlider = 0; iSlider < 4; iSlider++)
+	{
+		psCounts->plValues[iSlider] = g_psSliderModels[iSlider].lValue;
+	}
+}
+
+//*****************************************************************************
+//
+// Replay the trace both ways, and print what each did.
+//
+// param pcName: the name of the trace
+// return: 0 if both left the sliders in the same place, else 1
+//
+//*****************************************************************************
+static int
+TraceRun(const char *pcName)
+{
+	tReplayCounts sDirect, sCoalesced;
+	unsigned long ulEvent, ulEnd, ulStill;
+
+	if(!g_ulNumEvents)
+	{
+		return(0);
+	}
+
+	//
+	// Every message straight to the sliders
+	//
+	SlidersReset();
+	for(ulEvent = 0; ulEvent < g_ulNumEvents; ulEvent++)
+	{
+		g_ulNow = g_psTrace[ulEvent].ulTime;
+		SliderSink(g_psTrace[ulEvent].ulMessage, g_psTrace[ulEvent].lX,
+				   g_psTrace[ulEvent].lY);
+	}
+	SlidersSave(&sDirect);
+
+	//
+	// Through the coalescer, running the main loop until a frame after the
+	// last message, so any move still held gets passed on
+	//
+	SlidersReset();
+	LatencyInit();
+	PointerInit(SliderSink, FRAME_US);
+	ulEnd = g_psTrace[g_ulNumEvents - 1].ulTime + (2 * FRAME_US);
+	ulEvent = 0;
+	g_iHeld = 0;
+	for(g_ulNow = 0; g_ulNow <= ulEnd; g_ulNow += MAIN_LOOP_US)
+	{
+		while((ulEvent < g_ulNumEvents) &&
+			  (g_psTrace[ulEvent].ulTime <= g_ulNow))
+		{
+			//
+			// A move that went nowhere isn't waiting for anything
+			//
+			ulStill = g_sPointerStats.ulStill;
+			PointerMessage(g_psTrace[ulEvent].ulMessage,
+						   g_psTrace[ulEvent].lX, g_psTrace[ulEvent].lY);
+			if(!g_iHeld && (ulStill == g_sPointerStats.ulStill) &&
+			   (g_psTrace[ulEvent].ulMessage == WIDGET_MSG_PTR_MOVE))
+			{
+				g_iHeld = 1;
+				g_ulHeldTime = g_psTrace[ulEvent].ulTime;
+			}
+			ulEvent++;
+		}
+		PointerFlush();
+		LatencyClockAdvance(MAIN_LOOP_US);
+	}
+	SlidersSave(&sCoalesced);
+
+	printf("%-20s %7lu %9lu %7lu %9lu %7lu %8lu\n", pcName, g_ulNumEvents,
+		   sDirect.ulMessages, sDirect.ulPaints, sCoalesced.ulMessages,
+		   sCoalesced.ulPaints, sCoalesced.ulMaxLag / 1000);
+	printf("%-20s coalesced %lu, still %lu\n", "",
+		   g_sPointerStats.ulCoalesced, g_sPointerStats.ulStill);
+
+	if(memcmp(sDirect.plValues, sCoalesced.plValues,
+			  sizeof(sDirect.plValues)))
+	{
+		printf("%-20s sliders left at different values\n", "");
+		return(1);
+	}
+	return(0);
+}
+
+//*****************************************************************************
+//
+// Replay the built in traces, or the ones named on the command line.
+//
+//*****************************************************************************
+int
+main(int argc, char **argv)
+{
+	unsigned long ulTime;
+	int iArg, iFailed;
+
+	printf("%-20s %7s %9s %7s %9s %7s %8s\n", "", "touch", "direct",
+		   "", "coalesced", "", "max lag");
+	printf("%-20s %7s %9s %7s %9s %7s %8s\n", "trace", "msgs", "msgs",
+		   "paints", "msgs", "paints", "ms");
+
+	iFailed = 0;
+	if(argc > 1)
+	{
+		for(iArg = 1; iArg < argc; iArg++)
+		{
+			if(TraceRead(argv[iArg]))
+			{
+				fprintf(stderr, "bench_touch: can't read %s\n", argv[iArg]);
+				return(2);
+			}
+			iFailed |= TraceRun(argv[iArg]);
+		}
+	}
+	else
+	{
+		//
+		// Slider centers are at y = 57, 102, 147 and 192
+		//
+		g_ulNumEvents = 0;
+		ulTime = TraceStroke(0, 20000, 160, 160, 192, 0);
+		TraceStroke(ulTime + 300000, 20000, 90, 90, 147, 0);
+		iFailed |= TraceRun("two taps");
+
+		g_ulNumEvents = 0;
+		TraceStroke(0, 1000000, 160, 160, 192, 0);
+		iFailed |= TraceRun("hold, 1 s");
+
+		g_ulNumEvents = 0;
+		TraceStroke(0, 1000000, 160, 160, 192, 1);
+		iFailed |= TraceRun("hold wobbling, 1 s");
+
+		g_ulNumEvents = 0;
+		TraceStroke(0, 2000000, 55, 265, 192, 0);
+		iFailed |= TraceRun("slow drag, 2 s");
+
+		g_ulNumEvents = 0;
+		TraceStroke(0, 250000, 265, 55, 147, 0);
+		iFailed |= TraceRun("fast drag, 250 ms");
+
+		g_ulNumEvents = 0;
+		ulTime = TraceStroke(0, 600000, 60, 260, 57, 0);
+		ulTime = TraceStroke(ulTime + 100000, 600000, 260, 60, 57, 0);
+		TraceStroke(ulTime + 100000, 600000, 60, 200, 102, 0);
+		iFailed |= TraceRun("sweeps, 2 sliders");
+	}
+
+	printf("%s\n", iFailed ? "FAILED" : "all replays agree");
+	return(iFailed);
+}
@@ -0,0 +1,380 @@
+//*****************************************************************************
+//
+// bench_tuner.c - Host test of the tuner's pitch detection on synthetic
+// instrument tones.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Each tone is made the way the target would capture it: a frame of
+// NUM_SAMPLES 12 bit ADC counts around mid-scale, windowed with one of the
+// generated window tables.  The frame's circular autocorrelation, with the
+// mean taken out, is what AutoCorrelate leaves behind on the target after
+// squaring the spectrum, dropping DC and running the inverse FFT.  It is
+// worked out directly here and handed to TunerProcess.
+//
+// The tones are a sine, a plucked guitar string (harmonics falling off about
+// as 1/n^2, the whole tone dying away), a bowed violin (a sawtooth with bow
+// noise), a clarinet (mostly odd harmonics) and a tone with its fundamental
+// missing (harmonics 2 to 6).
+// Each is played at notes from 41 Hz to 1 kHz, detuned by up to 45 cents,
+// at 26 kHz and at 8 kHz.  Harmonics at or above Nyquist are left out, as
+// the anti-alias filter would.
+//
+// The test fails if any tone reads more than 1 cent off at 26 kHz or 3 cents
+// off at 8 kHz, names the wrong note, or if white noise reads as a pitch.
+// That is checked with each window selected.  The flat top's autocorrelation
+// dies away too soon to follow the lowest notes at 26 kHz, so with it
+// selected the frames are taken with the window TunerWindowType puts in its
+// place, as the DSP does in tuner mode.
+//
+// Build: cc -O2 -o bench_tuner bench_tuner.c -lm
+// Usage: bench_tuner
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "../window.c"
+#include "../window_tables.c"
+#include "../tuner.c"
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+#define NUM_SAMPLES				2048
+#define MAX_HARMONICS			40
+#define NOISE_FRAMES			20
+
+//
+// The tones' amplitude, and the ADC's mid-scale, in counts
+//
+#define TONE_AMPLITUDE			1200.0f
+#define ADC_MID					0x800
+
+#ifndef M_PI
+#define M_PI					3.14159265358979323846
+#endif
+
+//*****************************************************************************
+//
+// An instrument: how loud each harmonic is, and how the tone is played.
+//
+//*****************************************************************************
+typedef struct
+{
+	const char *pcName;
+
+	//
+	// The amplitude of harmonic n + 1, harmonic 1 being the fundamental
+	//
+	float (*pfnHarmonic)(unsigned long n);
+
+	//
+	// The time it takes the tone to die away to 1/e, in seconds, or 0 if it
+	// holds steady
+	//
+	float fDecay;
+
+	//
+	// The level of the noise added to the tone, relative to its amplitude
+	//
+	float fNoise;
+}
+tInstrument;
+
+static float
+SineHarmonic(unsigned long n)
+{
+	return(n ? 0 : 1.0f);
+}
+
+static float
+GuitarHarmonic(unsigned long n)
+{
+	return(1.0f / ((n + 1) * (n + 1) * 0.5f + 0.5f));
+}
+
+static float
+ViolinHarmonic(unsigned long n)
+{
+	return(1.0f / (n + 1));
+}
+
+static float
+ClarinetHarmonic(unsigned long n)
+{
+	static const float pfLevels[9] =
+	{
+		1.0f, 0.04f, 0.75f, 0.05f, 0.5f, 0.06f, 0.14f, 0.02f, 0.5f
+	};
+
+	return((n < 9) ? pfLevels[n] : 0);
+}
+
+static float
+MissingHarmonic(unsigned long n)
+{
+	return(((n >= 1) && (n <= 5)) ? 1.0f : 0);
+}
+
+static const tInstrument g_psInstruments[] =
+{
+	{ "sine", SineHarmonic, 0, 0 },
+	{ "guitar", GuitarHarmonic, 0.4f, 0.002f },
+	{ "violin", ViolinHarmonic, 0, 0.02f },
+	{ "clarinet", ClarinetHarmonic, 0, 0.005f },
+	{ "missing fundamental", MissingHarmonic, 0, 0.002f },
+};
+
+#define NUM_INSTRUMENTS	(sizeof(g_psInstruments) / sizeof(g_psInstruments[0]))
+
+//
+// The notes played, as MIDI note numbers from E1 (41 Hz) to B5 (988 Hz)
+//
+static const int g_piNotes[] = { 28, 33, 40, 45, 50, 55, 60, 64, 69, 76, 83 };
+
+#define NUM_NOTES		(sizeof(g_piNotes) / sizeof(g_piNotes[0]))
+
+//
+// The windows the tuner is checked with selected
+//
+static const unsigned long g_pulWindows[] =
+{
+	WINDOW_HAMMING, WINDOW_HANN, WINDOW_BLACKMAN_HARRIS, WINDOW_FLAT_TOP,
+	WINDOW_KAISER
+};
+
+#define NUM_TEST_WINDOWS	(sizeof(g_pulWindows) / sizeof(g_pulWindows[0]))
+
+//
+// The sampling rates, and the error allowed at each, in cents
+//
+static const struct
+{
+	float fRate;
+	float fTolerance;
+}
+g_psRates[] =
+{
+	{ 26000.0f, 1.0f },
+	{ 8000.0f, 3.0f },
+};
+
+#define NUM_RATES		(sizeof(g_psRates) / sizeof(g_psRates[0]))
+
+//*****************************************************************************
+//
+// The frame, and its autocorrelation
+//
+//*****************************************************************************
+static float g_pfFrame[NUM_SAMPLES];
+static float g_pfAutoCorr[NUM_SAMPLES / 2 + 1];
+
+//*****************************************************************************
+//
+// A uniform random number in [0, 1), from a generator that gives the same
+// sequence on every host.
+//
+//*****************************************************************************
+static float
+Random(void)
+{
+	static uint32_t ulState = 2012;
+
+	ulState = (ulState * 1664525) + 1013904223;
+	return((ulState >> 8) / 16777216.0f);
+}
+
+//*****************************************************************************
+//
+// Turn the frame of signal into what the target would correlate: quantize
+// it to ADC counts, window it, and take its circular autocorrelation with
+// the mean removed.
+//
+// param psWindow: the window
+//
+//*****************************************************************************
+static void
+FrameCorrelate(const tWindowTable *psWindow)
+{
+	unsigned long n, ulLag;
+	double dMean, dSum;
+
+	dMean = 0;
+	for(n = 0; n < NUM_SAMPLES; n++)
+	{
+		g_pfFrame[n] = floorf(g_pfFrame[n] + ADC_MID + 0.5f) - ADC_MID;
+		g_pfFrame[n] *= WindowCoef(psWindow, n);
+		dMean += g_pfFrame[n];
+	}
+	dMean /= NUM_SAMPLES;
+	for(n = 0; n < NUM_SAMPLES; n++)
+	{
+		g_pfFrame[n] -= (float)dMean;
+	}
+
+	for(ulLag = 0; ulLag <= NUM_SAMPLES / 2; ulLag++)
+	{
+		dSum = 0;
+		for(n = 0; n < NUM_SAMPLES; n++)
+		{
+			dSum += (double)g_pfFrame[n] *
+					g_pfFrame[(n + ulLag) % NUM_SAMPLES];
+		}
+		g_pfAutoCorr[ulLag] = (float)dSum;
+	}
+}
+
+//*****************************************************************************
+//
+// Make a frame of an instrument playing a note.
+//
+// param psInstrument: the instrument
+// param fFreq: the fundamental, in Hz
+// param fRate: the sampling rate, in Hz
+//
+//*****************************************************************************
+static void
+ToneMake(const tInstrument *psInstrument, float fFreq, float fRate)
+{
+	float pfPhase[MAX_HARMONICS], pfLevel[MAX_HARMONICS];
+	unsigned long n, h;
+	double dTime, dSample;
+
+	for(h = 0; h < MAX_HARMONICS; h++)
+	{
+		pfPhase[h] = 2 * M_PI * Random();
+		pfLevel[h] = ((h + 1) * fFreq < fRate / 2) ?
+					 psInstrument->pfnHarmonic(h) : 0;
+	}
+
+	for(n = 0; n < NUM_SAMPLES; n++)
+	{
+		dTime = n / (double)fRate;
+		dSample = 0;
+		for(h = 0; h < MAX_HARMONICS; h++)
+		{
+			if(pfLevel[h] != 0)
+			{
+				dSample += pfLevel[h] * sin((2 * M_PI * (h + 1) * fFreq *
+											 dTime) + pfPhase[h]);
+			}
+		}
+		if(psInstrument->fDecay != 0)
+		{
+			dSample *= exp(-dTime / psInstrument->fDecay);
+		}
+		dSample += psInstrument->fNoise * 2 * (Random() - 0.5f);
+		g_pfFrame[n] = (float)(TONE_AMPLITUDE * dSample);
+	}
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+	const tWindowTable *psWindow;
+	tTunerResults sResults;
+	unsigned long ulInst, ulNote, ulTest, n, ulFalse, ulSelected, ulType;
+	float fFreq, fDetune, fError, fWorst;
+	int iFailed;
+
+	iFailed = 0;
+
+	for(ulTest = 0; ulTest < NUM_TEST_WINDOWS * NUM_RATES; ulTest++)
+	{
+		float fRate = g_psRates[ulTest % NUM_RATES].fRate;
+		float fTolerance = g_psRates[ulTest % NUM_RATES].fTolerance;
+
+		ulSelected = g_pulWindows[ulTest / NUM_RATES];
+		ulType = TunerWindowType(ulSelected);
+		psWindow = WindowTableGet(ulType, NUM_SAMPLES);
+		printf("\n%s window", WindowNameGet(ulSelected));
+		if(ulType != ulSelected)
+		{
+			printf(" (%s used)", WindowNameGet(ulType));
+		}
+		printf(", %.0f Hz sampling, %.0f cent tolerance\n", fRate,
+			   fTolerance);
+		printf("%-20s  worst  at note\n", "instrument");
+		for(ulInst = 0; ulInst < NUM_INSTRUMENTS; ulInst++)
+		{
+			const tInstrument *psInstrument = &g_psInstruments[ulInst];
+			int iWorstNote = 0, iBad = 0;
+
+			fWorst = 0;
+			for(ulNote = 0; ulNote < NUM_NOTES; ulNote++)
+			{
+				//
+				// Detune each note differently, from -45 to +45 cents
+				//
+				fDetune = -45.0f + (9.0f * ulNote);
+				fFreq = A4_FREQ * powf(2.0f, (g_piNotes[ulNote] - A4_NOTE +
+											  (fDetune / 100.0f)) / 12.0f);
+
+				ToneMake(psInstrument, fFreq, fRate);
+				FrameCorrelate(psWindow);
+				TunerProcess(g_pfAutoCorr, NUM_SAMPLES, psWindow, fRate,
+							 &sResults);
+
+				if(!sResults.ucValid)
+				{
+					printf("  %s at %.1f Hz: no pitch found\n",
+						   psInstrument->pcName, fFreq);
+					iBad = 1;
+					continue;
+				}
+				fError = 1200.0f * log2f(sResults.fFrequency / fFreq);
+				if(fabsf(fError) > fabsf(fWorst))
+				{
+					fWorst = fError;
+					iWorstNote = g_piNotes[ulNote];
+				}
+				if((fabsf(fError) > fTolerance) ||
+				   (sResults.iNote != g_piNotes[ulNote]))
+				{
+					printf("  %s at %.1f Hz: read %.2f Hz, %s%d %+d cents\n",
+						   psInstrument->pcName, fFreq, sResults.fFrequency,
+						   TunerNoteName(sResults.iNote),
+						   TunerNoteOctave(sResults.iNote), sResults.iCents);
+					iBad = 1;
+				}
+			}
+			printf("%-20s  %+5.2f  %s%d  %s\n", psInstrument->pcName, fWorst,
+				   TunerNoteName(iWorstNote), TunerNoteOctave(iWorstNote),
+				   iBad ? "FAILED" : "ok");
+			iFailed |= iBad;
+		}
+
+		//
+		// White noise has no pitch, and must not read as one
+		//
+		ulFalse = 0;
+		for(ulNote = 0; ulNote < NOISE_FRAMES; ulNote++)
+		{
+			for(n = 0; n < NUM_SAMPLES; n++)
+			{
+				g_pfFrame[n] = TONE_AMPLITUDE * 2 * (Random() - 0.5f);
+			}
+			FrameCorrelate(psWindow);
+			TunerProcess(g_pfAutoCorr, NUM_SAMPLES, psWindow, fRate,
+						 &sResults);
+			ulFalse += sResults.ucValid;
+		}
+		printf("%-20s  %lu of %d frames read as a pitch  %s\n", "white noise",
+			   ulFalse, NOISE_FRAMES, ulFalse ? "FAILED" : "ok");
+		iFailed |= (ulFalse != 0);
+	}
+
+	printf("\n%s\n", iFailed ? "FAILED" : "all tests pass");
+	return(iFailed);
+}
@@ -0,0 +1,261 @@
+//*****************************************************************************
+//
+// flash_sim.c - A host model of the LM4F120's flash, as driven through the
+// driverlib flash API.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// The model follows the parts of the flash that code keeping records in it
+// has to get right:
+//
+// * Erasing sets a whole 1 KB block to ones, and nothing smaller.
+//
+// * Programming can only clear bits, so a word programmed twice holds the AND
+//   of the two.  Doing that with a 1 over a 0 is counted.
+//
+// * The power can be made to go after a given number of steps, each step
+//   being one word programmed or one block erased.  The step the power goes
+//   on is left half done: the word gets only its low half, and the block only
+//   has its first half erased.  Every erase and program after that fails and
+//   changes nothing, until the power is restored.
+//
+// Each block's erases are counted, to show how evenly the wear is spread.
+//
+//*****************************************************************************
+
+#include <string.h>
+
+#include "flash_sim.h"
+
+//*****************************************************************************
+//
+// Private predefines and variables
+//
+//*****************************************************************************
+
+//
+// The flash, and the erases of each block
+//
+static unsigned char g_pucFlash[FLASH_SIM_SIZE];
+static unsigned long g_pulBlockErases[FLASH_SIM_SIZE / FLASH_SIM_BLOCK_SIZE];
+
+//
+// Whether the power is to go, the steps left until it does, and whether it
+// has gone
+//
+static int g_iCutArmed;
+static unsigned long g_ulStepsLeft;
+static int g_iPowerOff;
+
+//
+// What has been done to the flash since the counts were last cleared
+//
+tFlashSimCounts g_sFlashSimCounts;
+
+//*****************************************************************************
+//
+// Private Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Take a step towards the power going.
+//
+// return: 1 if the power goes on this step, else 0
+//
+//*****************************************************************************
+static int
+PowerStep(void)
+{
+	if(!g_iCutArmed)
+	{
+		return(0);
+	}
+	if(g_ulStepsLeft == 0)
+	{
+		g_iCutArmed = 0;
+		g_iPowerOff = 1;
+		return(1);
+	}
+	g_ulStepsLeft--;
+	return(0);
+}
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Erase a block, the way the driverlib function of the same name does.
+//
+// param ulAddress: the start of the block
+// return: 0 on success, or -1 if the address isn't the start of a block or
+//		   the power is off
+//
+//*****************************************************************************
+long
+FlashErase(unsigned long ulAddress)
+{
+	if(g_iPowerOff || (ulAddress >= FLASH_SIM_SIZE) ||
+	   (ulAddress & (FLASH_SIM_BLOCK_SIZE - 1)))
+	{
+		g_sFlashSimCounts.ulFailures++;
+		return(-1);
+	}
+
+	g_sFlashSimCounts.ulErases++;
+	g_pulBlockErases[ulAddress / FLASH_SIM_BLOCK_SIZE]++;
+	if(PowerStep())
+	{
+		memset(g_pucFlash + ulAddress, 0xff, FLASH_SIM_BLOCK_SIZE / 2);
+		return(-1);
+	}
+	memset(g_pucFlash + ulAddress, 0xff, FLASH_SIM_BLOCK_SIZE);
+	return(0);
+}
+
+//*****************************************************************************
+//
+// Program words, the way the driverlib function of the same name does.
+//
+// param pulData: the words
+// param ulAddress: where to program them, which must be word aligned
+// param ulCount: the number of bytes, which must be a multiple of 4
+// return: 0 on success, or -1 if the address or count is bad or the power is
+//		   off
+//
+//*****************************************************************************
+long
+FlashProgram(unsigned long *pulData, unsigned long ulAddress,
+			 unsigned long ulCount)
+{
+	const unsigned char *pucData;
+	unsigned char *pucWord;
+	unsigned long ulOld, ulNew;
+
+	if(g_iPowerOff || (ulAddress & 3) || (ulCount & 3) ||
+	   (ulAddress + ulCount > FLASH_SIM_SIZE))
+	{
+		g_sFlashSimCounts.ulFailures++;
+		return(-1);
+	}
+
+	//
+	// The words are taken a byte at a time, as a long may be wider than a
+	// word on the host
+	//
+	pucData = (const unsigned char *)pulData;
+	for(; ulCount; ulCount -= 4, ulAddress += 4, pucData += 4)
+	{
+		pucWord = g_pucFlash + ulAddress;
+		ulOld = pucWord[0] | (pucWord[1] << 8) | (pucWord[2] << 16) |
+				((unsigned long)pucWord[3] << 24);
+		ulNew = pucData[0] | (pucData[1] << 8) | (pucData[2] << 16) |
+				((unsigned long)pucData[3] << 24);
+		g_sFlashSimCounts.ulWords++;
+		if((ulOld & ulNew) != ulNew)
+		{
+			g_sFlashSimCounts.ulOverwrites++;
+		}
+		if(PowerStep())
+		{
+			ulNew |= 0xffff0000;
+		}
+		ulNew &= ulOld;
+		pucWord[0] = ulNew;
+		pucWord[1] = ulNew >> 8;
+		pucWord[2] = ulNew >> 16;
+		pucWord[3] = ulNew >> 24;
+		if(g_iPowerOff)
+		{
+			return(-1);
+		}
+	}
+	return(0);
+}
+
+//*****************************************************************************
+//
+// Find the model's copy of some flash, to read it.
+//
+// param ulAddress: the address
+// return: a pointer to the byte at the address
+//
+//*****************************************************************************
+const unsigned char *
+FlashSimPtr(unsigned long ulAddress)
+{
+	return(g_pucFlash + (ulAddress % FLASH_SIM_SIZE));
+}
+
+//*****************************************************************************
+//
+// Put the model in the state of a part fresh from the factory: all of the
+// flash erased and none of it worn, with the power on.
+//
+//*****************************************************************************
+void
+FlashSimReset(void)
+{
+	memset(g_pucFlash, 0xff, sizeof(g_pucFlash));
+	memset(g_pulBlockErases, 0, sizeof(g_pulBlockErases));
+	FlashSimPowerRestore();
+	FlashSimCountsClear();
+}
+
+//*****************************************************************************
+//
+// Clear the counts of what has been done to the flash.
+//
+//*****************************************************************************
+void
+FlashSimCountsClear(void)
+{
+	memset(&g_sFlashSimCounts, 0, sizeof(g_sFlashSimCounts));
+}
+
+//*****************************************************************************
+//
+// Read back how many times a block has been erased since the model was reset.
+//
+// param ulAddress: any address in the block
+// return: the number of erases
+//
+//*****************************************************************************
+unsigned long
+FlashSimBlockErases(unsigned long ulAddress)
+{
+	return(g_pulBlockErases[(ulAddress % FLASH_SIM_SIZE) /
+							FLASH_SIM_BLOCK_SIZE]);
+}
+
+//*****************************************************************************
+//
+// Make the power go part way through a later erase or program.
+//
+// param ulSteps: the number of words programmed and blocks erased that
+//		 complete before the power goes
+//
+//*****************************************************************************
+void
+FlashSimPowerCut(unsigned long ulSteps)
+{
+	g_iCutArmed = 1;
+	g_ulStepsLeft = ulSteps;
+}
+
+//*****************************************************************************
+//
+// Bring the power back, and forget any cut still to come.
+//
+//*****************************************************************************
+void
+FlashSimPowerRestore(void)
+{
+	g_iCutArmed = 0;
+	g_iPowerOff = 0;
+}
@@ -0,0 +1,101 @@
+//*****************************************************************************
+//
+// flash_sim.h - Predefines, public functions, and globals for the host model
+// of the LM4F120's flash.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// A host build of store.c (with HOST_BUILD defined) includes this in place of
+// driverlib/flash.h, and programs and erases the model instead of the part.
+//
+//*****************************************************************************
+
+#ifndef __FLASH_SIM_H__
+#define __FLASH_SIM_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The size of the part's flash, and of the blocks it is erased in
+//
+#define FLASH_SIM_SIZE			0x40000
+#define FLASH_SIM_BLOCK_SIZE	0x400
+
+//*****************************************************************************
+//
+// What has been done to the flash since the counts were last cleared.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// Blocks erased
+	//
+	unsigned long ulErases;
+
+	//
+	// Words programmed
+	//
+	unsigned long ulWords;
+
+	//
+	// Words programmed with a 1 where the flash already held a 0, which
+	// programming can't undo, so the word read back isn't what was written
+	//
+	unsigned long ulOverwrites;
+
+	//
+	// Erases and programs turned away, for a bad address or because the power
+	// had gone
+	//
+	unsigned long ulFailures;
+}
+tFlashSimCounts;
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+extern tFlashSimCounts g_sFlashSimCounts;
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern long FlashErase(unsigned long ulAddress);
+extern long FlashProgram(unsigned long *pulData, unsigned long ulAddress,
+						 unsigned long ulCount);
+extern const unsigned char *FlashSimPtr(unsigned long ulAddress);
+extern void FlashSimReset(void);
+extern void FlashSimCountsClear(void);
+extern unsigned long FlashSimBlockErases(unsigned long ulAddress);
+extern void FlashSimPowerCut(unsigned long ulSteps);
+extern void FlashSimPowerRestore(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __FLASH_SIM_H__
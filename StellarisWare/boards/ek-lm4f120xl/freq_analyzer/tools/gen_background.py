@@ -0,0 +1,258 @@
+#!/usr/bin/env python
+#******************************************************************************
+#
+# gen_background.py - Generates bgimage.c, the background image compressed so
+# that any part of any column can be drawn without decoding the rest.
+#
+# Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+#
+# The image is reduced to a palette of at most 16 colors, so each pixel is a
+# nibble.  Images that already use 16 colors or fewer keep them exactly;
+# others are reduced with a median cut.  The palette is stored in the
+# display's native 5-6-5 RGB format.
+#
+# Each column is cut into segments of SEGMENT_ROWS rows, and each segment is
+# coded as a stream of nibble packets:
+#
+#   0..7   a literal: the next (n + 1) nibbles are one pixel each
+#   8..15  a run: the next nibble is the color of (n - 6) pixels
+#
+# Every segment starts on a byte boundary, and a packet never crosses from
+# one segment into the next.  A table gives the offset of each column's data,
+# and another the offset of each segment from the start of its column, so the
+# decoder can start at any row after skipping less than SEGMENT_ROWS pixels.
+#
+# Usage: gen_background.py image.bmp > bgimage.c
+#
+# The image must be an uncompressed 1, 4, 8 or 24 bit Windows bitmap.
+#
+#******************************************************************************
+
+import os
+import struct
+import sys
+
+#
+# The number of rows in each segment.  This must match BG_SEGMENT_ROWS in
+# background.h.
+#
+SEGMENT_ROWS = 32
+
+#
+# The most colors the image can have.  This must match BG_PALETTE_SIZE in
+# background.h.
+#
+PALETTE_SIZE = 16
+
+#
+# The longest literal and run a single packet can hold.
+#
+MAX_LITERAL = 8
+MIN_RUN = 2
+MAX_RUN = 9
+
+def read_bmp(path):
+    """Returns the width, height, and rows of (r, g, b) pixels of a bitmap,
+    top row first."""
+    with open(path, 'rb') as bmp:
+        data = bmp.read()
+    if data[0:2] != b'BM':
+        raise ValueError('%s is not a bitmap' % path)
+    offset = struct.unpack('<I', data[10:14])[0]
+    header_size = struct.unpack('<I', data[14:18])[0]
+    width, height = struct.unpack('<ii', data[18:26])
+    bpp, compression = struct.unpack('<HI', data[28:34])
+    colors = struct.unpack('<I', data[46:50])[0]
+    if compression != 0 or bpp not in (1, 4, 8, 24):
+        raise ValueError('%s: only uncompressed 1, 4, 8 and 24 bit bitmaps '
+                         'are supported' % path)
+
+    palette = []
+    if bpp != 24:
+        base = 14 + header_size
+        for i in range(colors or (1 << bpp)):
+            b, g, r = struct.unpack('<BBB', data[base + 4 * i:base + 4 * i + 3])
+            palette.append((r, g, b))
+
+    stride = ((width * bpp + 31) // 32) * 4
+    rows = []
+    for y in range(abs(height)):
+        line = offset + stride * ((abs(height) - 1 - y) if height > 0 else y)
+        row = []
+        for x in range(width):
+            if bpp == 24:
+                b, g, r = struct.unpack('<BBB', data[line + 3 * x:
+                                                     line + 3 * x + 3])
+                row.append((r, g, b))
+            else:
+                bit = x * bpp
+                byte = data[line + bit // 8]
+                index = (byte >> (8 - bpp - (bit % 8))) & ((1 << bpp) - 1)
+                row.append(palette[index])
+        rows.append(row)
+    return width, abs(height), rows
+
+def median_cut(pixels, count):
+    """Returns a palette of at most count colors for the given pixels."""
+    boxes = [pixels]
+    while len(boxes) < count:
+        best = None
+        for i, box in enumerate(boxes):
+            spans = [max(c[ch] for c in box) - min(c[ch] for c in box)
+                     for ch in range(3)]
+            if max(spans) and (best is None or
+                               max(spans) * len(box) > best[0]):
+                best = (max(spans) * len(box), i, spans.index(max(spans)))
+        if best is None:
+            break
+        box = sorted(boxes.pop(best[1]), key=lambda c: c[best[2]])
+        boxes += [box[:len(box) // 2], box[len(box) // 2:]]
+    return [tuple((sum(c[ch] for c in box) + len(box) // 2) // len(box)
+                  for ch in range(3)) for box in boxes]
+
+def quantize(rows):
+    """Returns a palette of at most PALETTE_SIZE colors, and the rows of the
+    image as indices into it."""
+    pixels = [c for row in rows for c in row]
+    palette = sorted(set(pixels))
+    if len(palette) > PALETTE_SIZE:
+        palette = median_cut(pixels, PALETTE_SIZE)
+    nearest = {}
+    for color in set(pixels):
+        nearest[color] = min(range(len(palette)),
+                             key=lambda i: sum((palette[i][ch] - color[ch]) ** 2
+                                               for ch in range(3)))
+    return palette, [[nearest[c] for c in row] for row in rows]
+
+def encode_segment(pixels):
+    """Returns the shortest packet stream for a segment, as a list of
+    nibbles."""
+    #
+    # cost[i] is the fewest nibbles pixels[i:] can be coded in, and step[i]
+    # the packet that starts the best coding
+    #
+    count = len(pixels)
+    cost = [0] * (count + 1)
+    step = [None] * (count + 1)
+    for i in range(count - 1, -1, -1):
+        best = None
+        for length in range(1, min(MAX_LITERAL, count - i) + 1):
+            option = (1 + length + cost[i + length], 'literal', length)
+            if best is None or option[0] < best[0]:
+                best = option
+        length = 1
+        while (i + length < count and length < MAX_RUN and
+               pixels[i + length] == pixels[i]):
+            length += 1
+            option = (2 + cost[i + length], 'run', length)
+            if option[0] < best[0]:
+                best = option
+        cost[i], step[i] = best[0], best[1:]
+
+    nibbles = []
+    i = 0
+    while i < count:
+        kind, length = step[i]
+        if kind == 'literal':
+            nibbles.append(length - 1)
+            nibbles += pixels[i:i + length]
+        else:
+            nibbles += [length - MIN_RUN + 8, pixels[i]]
+        i += length
+    return nibbles
+
+def pack(nibbles):
+    """Packs nibbles into bytes, first nibble in the high half, padding the
+    last byte with zero."""
+    if len(nibbles) % 2:
+        nibbles = nibbles + [0]
+    return [(nibbles[i] << 4) | nibbles[i + 1]
+            for i in range(0, len(nibbles), 2)]
+
+def to_565(rgb):
+    r, g, b = rgb
+    return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | ((b & 0xf8) >> 3)
+
+def write_table(out, ctype, name, values, per_line, fmt):
+    out.write("static const %s %s[%d] =\n{\n" % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        out.write("    " + ", ".join(fmt % v
+                                     for v in values[i:i + per_line]) + ",\n")
+    out.write("};\n")
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write('Usage: gen_background.py image.bmp > bgimage.c\n')
+        return 2
+
+    width, height, rows = read_bmp(sys.argv[1])
+    palette, rows = quantize(rows)
+    segments = (height + SEGMENT_ROWS - 1) // SEGMENT_ROWS
+
+    data = []
+    column_offsets = []
+    segment_offsets = []
+    for x in range(width):
+        column = [rows[y][x] for y in range(height)]
+        column_offsets.append(len(data))
+        for segment in range(segments):
+            segment_offsets.append(len(data) - column_offsets[-1])
+            data += pack(encode_segment(
+                column[segment * SEGMENT_ROWS:(segment + 1) * SEGMENT_ROWS]))
+    if max(segment_offsets) > 0xff or column_offsets[-1] > 0xffff:
+        raise ValueError('the image is too big for the offset tables')
+
+    out = sys.stdout
+    out.write("""\
+//*****************************************************************************
+//
+// bgimage.c - The background image, compressed so that it can be drawn a
+// piece of a column at a time.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// THIS FILE IS GENERATED BY tools/gen_background.py FROM %s.
+// DO NOT EDIT.
+//
+//*****************************************************************************
+
+#include "background.h"
+
+#if (BG_SEGMENT_ROWS != %d) || (BG_PALETTE_SIZE != %d)
+#error "background.h and bgimage.c disagree on the image layout"
+#endif
+
+""" % (os.path.basename(sys.argv[1]), SEGMENT_ROWS, PALETTE_SIZE))
+
+    values = [to_565(c) for c in palette]
+    values += [0] * (PALETTE_SIZE - len(values))
+    write_table(out, "unsigned short", "g_pusBgPalette", values, 8, "0x%04x")
+    out.write("\n")
+    write_table(out, "unsigned short", "g_pusBgColumns", column_offsets, 8,
+                "%5d")
+    out.write("\n")
+    write_table(out, "unsigned char", "g_pucBgSegments", segment_offsets,
+                min(segments, 16), "%3d")
+    out.write("\n")
+    write_table(out, "unsigned char", "g_pucBgData", data, 12, "0x%02x")
+    out.write("""
+const tBackground g_sBackground =
+{
+    %d,
+    %d,
+    g_pusBgPalette,
+    g_pusBgColumns,
+    g_pucBgSegments,
+    g_pucBgData
+};
+""" % (width, height))
+
+    sys.stderr.write('bgimage.c: %dx%d, %d colors, %d bytes (%d of pixel '
+                     'data)\n' % (width, height, len(palette),
+                                  len(data) + 2 * PALETTE_SIZE +
+                                  2 * len(column_offsets) +
+                                  len(segment_offsets), len(data)))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
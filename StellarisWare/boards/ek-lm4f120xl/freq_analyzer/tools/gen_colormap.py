@@ -0,0 +1,150 @@
+#!/usr/bin/env python
+#******************************************************************************
+#
+# gen_colormap.py - Generates colormap.c, the tables that map a display level
+# or a bar's place across the display to a color in the SSD2119's native
+# 5-6-5 RGB format.
+#
+# Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+#
+# Each map is a list of color stops along the level axis.  Colors between the
+# stops are interpolated linearly in 24-bit RGB and then converted the same
+# way DPYCOLORTRANSLATE does, so the tables match what the driver would draw
+# for the same 24-bit color.
+#
+# Usage: gen_colormap.py [full_scale] > colormap.c
+#
+# full_scale is the level that maps to the last color stop of the color maps.
+# Levels above it saturate.  It defaults to the default bar height.  The bar
+# palettes always span their whole table.
+#
+#******************************************************************************
+
+import sys
+
+#
+# The number of entries in each table, one for every value of an unsigned
+# char.
+#
+SIZE = 256
+
+#
+# The default level that maps to the top of each color map.
+#
+DEFAULT_FULL_SCALE = 185
+
+#
+# The color maps.  Each stop is (fraction of full scale, 24-bit RGB color).
+#
+COLORMAPS = [
+    ("Heat", "black through purple and red to pale yellow",
+     [(0.00, 0x000000),
+      (0.15, 0x1b0c41),
+      (0.35, 0x6a176e),
+      (0.55, 0xbc3754),
+      (0.70, 0xed6925),
+      (0.85, 0xfbb61a),
+      (1.00, 0xfcffa4)]),
+]
+
+#
+# The palettes the bars can be colored from, left to right, in the order of
+# the BAR_PALETTE_* values in colormap.h.  Entry n of each is the color at
+# n / SIZE of the way across, so bar i of N takes entry (i * SIZE) / N.
+#
+PALETTES = [
+    ("Gradient", "blue through to red",
+     [(0.00, 0x0000ff),
+      (1.00, 0xff0000)]),
+    ("Heat", "purple and red through to pale yellow",
+     [(0.00, 0x1b0c41),
+      (0.25, 0x6a176e),
+      (0.50, 0xbc3754),
+      (0.70, 0xed6925),
+      (0.85, 0xfbb61a),
+      (1.00, 0xfcffa4)]),
+    ("Rainbow", "red through the spectrum to violet",
+     [(0.00, 0xff0000),
+      (0.17, 0xff8000),
+      (0.33, 0xffff00),
+      (0.50, 0x00ff00),
+      (0.67, 0x00ffff),
+      (0.83, 0x0000ff),
+      (1.00, 0x8000ff)]),
+    ("Mono", "one shade of green",
+     [(0.00, 0x00e000),
+      (1.00, 0x00e000)]),
+]
+
+def write_table(out, kind, name, desc, values):
+    out.write("//\n// %s: %s\n//\n" % (name, desc))
+    out.write("const unsigned short g_pus%s%s[COLORMAP_SIZE] =\n{\n" %
+              (kind, name))
+    for i in range(0, SIZE, 8):
+        out.write("    " + ", ".join("0x%04x" % v
+                                     for v in values[i:i + 8]) + ",\n")
+    out.write("};\n")
+
+def lerp_color(stops, x):
+    for (x0, c0), (x1, c1) in zip(stops, stops[1:]):
+        if x <= x1:
+            t = (x - x0) / (x1 - x0)
+            return tuple(int(round(((c0 >> s) & 0xff) * (1.0 - t) +
+                                   ((c1 >> s) & 0xff) * t))
+                         for s in (16, 8, 0))
+    c = stops[-1][1]
+    return ((c >> 16) & 0xff, (c >> 8) & 0xff, c & 0xff)
+
+def to_565(rgb):
+    r, g, b = rgb
+    return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | ((b & 0xf8) >> 3)
+
+def main():
+    full_scale = int(sys.argv[1]) if len(sys.argv) > 1 else DEFAULT_FULL_SCALE
+    out = sys.stdout
+
+    out.write("""\
+//*****************************************************************************
+//
+// colormap.c - Tables mapping a display level or a bar's place across the
+// display to a 5-6-5 RGB color.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// THIS FILE IS GENERATED BY tools/gen_colormap.py.  DO NOT EDIT.
+//
+//*****************************************************************************
+
+#include "colormap.h"
+
+""")
+    out.write("#if (COLORMAP_SIZE != %d) || (COLORMAP_FULL_SCALE != %d) || "
+              "\\\n    (NUM_BAR_PALETTES != %d)\n"
+              "#error \"colormap.h and colormap.c disagree on the table "
+              "layout\"\n#endif\n\n" % (SIZE, full_scale, len(PALETTES)))
+
+    for index, (name, desc, stops) in enumerate(COLORMAPS):
+        if index:
+            out.write("\n")
+        values = [to_565(lerp_color(stops, min(1.0, float(n) / full_scale)))
+                  for n in range(SIZE)]
+        write_table(out, "Colormap", name, desc, values)
+
+    for name, desc, stops in PALETTES:
+        out.write("\n")
+        values = [to_565(lerp_color(stops, float(n) / SIZE))
+                  for n in range(SIZE)]
+        write_table(out, "Palette", name, desc, values)
+
+    out.write("\n//\n// The bar palettes, indexed by BAR_PALETTE_*\n//\n")
+    out.write("const unsigned short * const "
+              "g_ppusBarPalettes[NUM_BAR_PALETTES] =\n{\n")
+    for name, desc, stops in PALETTES:
+        out.write("    g_pusPalette%s,\n" % name)
+    out.write("};\n")
+
+    sys.stderr.write("colormap.c: %d maps, %d palettes, full scale %d\n" %
+                     (len(COLORMAPS), len(PALETTES), full_scale))
+
+if __name__ == "__main__":
+    main()
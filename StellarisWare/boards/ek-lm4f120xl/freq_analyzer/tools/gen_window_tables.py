@@ -0,0 +1,169 @@
+#!/usr/bin/env python
+#******************************************************************************
+#
+# gen_window_tables.py - Generates window_tables.c, the half-length window
+# coefficient tables used by window.c.
+#
+# Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+#
+# Every window we support is symmetric, w(n) = w(N-1-n), so only the first N/2
+# coefficients of each window are stored.  The tables are emitted twice, once
+# as q15 and once as float; window.h selects which set gets compiled based on
+# WINDOW_TABLES_FLOAT.
+#
+# Usage: gen_window_tables.py [fft_size ...] > window_tables.c
+#
+# If no sizes are given, tables are generated for every length supported by
+# arm_rfft_f32 (128, 512 and 2048), plus the 256 point complex FFT used by the
+# zoom FFT.
+#
+#******************************************************************************
+
+import math
+import sys
+
+#
+# The FFT sizes supported by the CMSIS real FFT, and the zoom FFT's size.
+#
+DEFAULT_SIZES = [128, 256, 512, 2048]
+
+#
+# Shape parameter for the Kaiser window.  8.6 gives roughly -90 dB side lobes,
+# which is below the noise floor of the 12-bit ADC.
+#
+KAISER_BETA = 8.6
+
+def cosine_sum(n, size, coefs):
+    """Generalized cosine window, w(n) = a0 - a1 cos(x) + a2 cos(2x) - ..."""
+    x = 2.0 * math.pi * n / (size - 1)
+    value = 0.0
+    sign = 1.0
+    for k, a in enumerate(coefs):
+        value += sign * a * math.cos(k * x)
+        sign = -sign
+    return value
+
+def bessel_i0(x):
+    """Zeroth order modified Bessel function of the first kind."""
+    total = 1.0
+    term = 1.0
+    k = 1
+    while term > 1e-12 * total:
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+def kaiser(n, size):
+    r = 2.0 * n / (size - 1) - 1.0
+    return bessel_i0(KAISER_BETA * math.sqrt(1.0 - r * r)) / \
+        bessel_i0(KAISER_BETA)
+
+#
+# The windows, in the same order as the WINDOW_* indices in window.h.
+#
+WINDOWS = [
+    ("hamming", "Hamming",
+     lambda n, size: cosine_sum(n, size, [0.54, 0.46])),
+    ("hann", "Hann",
+     lambda n, size: cosine_sum(n, size, [0.5, 0.5])),
+    ("blackman_harris", "Blackman-Harris",
+     lambda n, size: cosine_sum(n, size,
+                                [0.35875, 0.48829, 0.14128, 0.01168])),
+    ("flat_top", "Flat top",
+     lambda n, size: cosine_sum(n, size,
+                                [0.21557895, 0.41663158, 0.277263158,
+                                 0.083578947, 0.006947368])),
+    ("kaiser", "Kaiser",
+     kaiser),
+]
+
+def to_q15(value):
+    q = int(round(value * 32768.0))
+    return max(-32768, min(32767, q))
+
+def emit_table(out, ctype, name, values, fmt, per_line):
+    out.write("static const %s %s[%d] =\n{\n" % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        out.write("    " + ", ".join(fmt(v) for v in values[i:i + per_line]) +
+                  ",\n")
+    out.write("};\n\n")
+
+def main():
+    sizes = [int(arg) for arg in sys.argv[1:]] or DEFAULT_SIZES
+    out = sys.stdout
+
+    out.write("""\
+//*****************************************************************************
+//
+// window_tables.c - Half-length window coefficient tables.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// THIS FILE IS GENERATED BY tools/gen_window_tables.py.  DO NOT EDIT.
+//
+// Each table holds the first N/2 coefficients of a symmetric N point window,
+// w(n) = w(N-1-n).  Coherent gain is sum(w)/N and the equivalent noise
+// bandwidth is N*sum(w^2)/sum(w)^2, in bins.
+//
+//*****************************************************************************
+
+#include "window.h"
+
+""")
+    out.write("#if NUM_WINDOW_SIZES != %d\n"
+              "#error \"window.h and window_tables.c disagree on the number of "
+              "window sizes\"\n#endif\n\n" % len(sizes))
+
+    meta = {}
+    for float_tables in (False, True):
+        out.write("#ifdef WINDOW_TABLES_FLOAT\n\n" if float_tables else
+                  "#ifndef WINDOW_TABLES_FLOAT\n\n")
+        for key, title, func in WINDOWS:
+            for size in sizes:
+                full = [func(n, size) for n in range(size)]
+                half = full[:size // 2]
+                s1 = sum(full)
+                s2 = sum(w * w for w in full)
+                meta[(key, size)] = (s1 / size, size * s2 / (s1 * s1))
+                name = "g_p%sWindow_%s_%d" % ("f" if float_tables else "s",
+                                              key, size)
+                if float_tables:
+                    emit_table(out, "float", name, half,
+                               lambda v: "%.9ff" % v, 6)
+                else:
+                    emit_table(out, "short", name, [to_q15(v) for v in half],
+                               lambda v: "%6d" % v, 10)
+        out.write("#endif\n\n")
+
+    out.write("""\
+//*****************************************************************************
+//
+// The window descriptor table, indexed by window type and then by size.
+//
+//*****************************************************************************
+#ifdef WINDOW_TABLES_FLOAT
+#define WINDOW_TABLE(name, size)    g_pfWindow_##name##_##size
+#else
+#define WINDOW_TABLE(name, size)    g_psWindow_##name##_##size
+#endif
+
+""")
+    out.write("const unsigned short g_pusWindowSizes[NUM_WINDOW_SIZES] =\n{\n")
+    out.write("    " + ", ".join("%d" % s for s in sizes) + "\n};\n\n")
+    out.write("const tWindowTable g_psWindowTables[NUM_WINDOWS]"
+              "[NUM_WINDOW_SIZES] =\n{\n")
+    for key, title, func in WINDOWS:
+        out.write("    //\n    // %s\n    //\n    {\n" % title)
+        for size in sizes:
+            cg, enbw = meta[(key, size)]
+            out.write("        { %d, %.7ff, %.7ff, WINDOW_TABLE(%s, %d) },\n" %
+                      (size, cg, enbw, key, size))
+        out.write("    },\n")
+    out.write("};\n")
+
+    sys.stderr.write("window_tables.c: %d windows x %d sizes\n" %
+                     (len(WINDOWS), len(sizes)))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,226 @@
+#!/usr/bin/env python
+#******************************************************************************
+#
+# sram_budget.py - Reports how much SRAM and flash each module of the
+# application uses, from the map file GNU ld writes.
+#
+# Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+#
+# Every allocated input section in the map is charged to the object file it
+# came from.  Archive members are charged to their archive, so grlib,
+# driverlib and the C library each show up as one line.  Initialized data
+# counts against both SRAM and flash, since its initial values are stored in
+# flash and copied out at reset.
+#
+# SRAM that no input section accounts for (fill, and the gaps left by
+# aligning output sections) is charged to "(padding)".  The stack is part of
+# startup_gcc.o's .bss, so it is counted there.
+#
+# Usage: sram_budget.py [--headroom bytes] freq_analyzer.map
+#
+# Exits with an error if less than the given number of bytes of SRAM (1024 by
+# default) is left free.
+#
+#******************************************************************************
+
+import os
+import re
+import sys
+
+#
+# The SRAM that has to be left free if no --headroom is given
+#
+DEFAULT_HEADROOM = 1024
+
+#
+# Output sections that are not loaded onto the part
+#
+NOT_ALLOCATED = re.compile(r'^(\.debug|\.comment|\.ARM\.attributes|\.stab|'
+                           r'/DISCARD/)')
+
+#
+# Input sections that only take up space at their run address.  GNU ld
+# reports a load address for .bss when it follows initialized data placed
+# with AT(), but there is nothing to load.
+#
+NO_CONTENTS = re.compile(r'^(\.bss|COMMON|\.noinit|\.arena)')
+
+OUTPUT_SECTION = re.compile(r'^(\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)'
+                            r'(?:\s+load address 0x([0-9a-fA-F]+))?)?\s*$')
+INPUT_SECTION = re.compile(r'^ (\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)'
+                           r'\s+(\S.*))?\s*$')
+CONTINUATION = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+MEMORY_REGION = re.compile(r'^(\w+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)')
+
+def module_name(path):
+    """The name to charge a section from the given input file to."""
+    match = re.match(r'^(.*\.a)\(.*\)$', path)
+    if match:
+        path = match.group(1)
+    return os.path.basename(path)
+
+def region_of(regions, address):
+    """The name of the memory region an address is in, or None."""
+    for name, (origin, length) in regions.items():
+        if origin <= address < origin + length:
+            return name
+    return None
+
+def parse_map(lines):
+    """Returns the memory regions, and the (output section, input section,
+    address, load address, size, module) of every allocated input section."""
+    regions = {}
+    sections = []
+    in_memory = False
+    in_map = False
+    output = None
+    output_lma_offset = None
+    pending = None
+
+    for line in lines:
+        line = line.rstrip('\r\n')
+
+        if line.startswith('Memory Configuration'):
+            in_memory = True
+            continue
+        if line.startswith('Linker script and memory map'):
+            in_memory = False
+            in_map = True
+            continue
+        if in_memory:
+            match = MEMORY_REGION.match(line)
+            if match and match.group(1) != 'Name':
+                regions[match.group(1)] = (int(match.group(2), 16),
+                                           int(match.group(3), 16))
+            continue
+        if not in_map or not line:
+            continue
+
+        #
+        # A long input section name puts its address, size and file on the
+        # next line
+        #
+        if pending:
+            match = CONTINUATION.match(line)
+            if match:
+                fields = (pending, match.group(1), match.group(2),
+                          match.group(3))
+                pending = None
+                line = None
+            else:
+                pending = None
+        else:
+            fields = None
+
+        if line is not None and not line.startswith(' '):
+            match = OUTPUT_SECTION.match(line)
+            if match:
+                output = match.group(1)
+                output_lma_offset = None
+                if match.group(4):
+                    output_lma_offset = (int(match.group(4), 16) -
+                                         int(match.group(2), 16))
+            continue
+
+        if line is not None:
+            match = INPUT_SECTION.match(line)
+            if not match or match.group(1).startswith('*('):
+                continue
+            if match.group(2) is None:
+                pending = match.group(1)
+                continue
+            fields = match.groups()
+
+        if fields is None or output is None or NOT_ALLOCATED.match(output):
+            continue
+
+        name, address, size, source = fields
+        address = int(address, 16)
+        size = int(size, 16)
+        if size == 0:
+            continue
+        if name == '*fill*':
+            module = '(padding)'
+        else:
+            module = module_name(source.strip())
+        lma = None
+        if (output_lma_offset is not None) and not NO_CONTENTS.match(name):
+            lma = address + output_lma_offset
+        sections.append((output, name, address, lma, size, module))
+
+    return regions, sections
+
+def budget(regions, sections):
+    """Totals up the use of each region by each module.  Returns a dictionary
+    of module to a dictionary of region to bytes, and the highest address used
+    in each region."""
+    usage = {}
+    top = {}
+    for output, name, address, lma, size, module in sections:
+        for where in (address, lma):
+            if where is None:
+                continue
+            region = region_of(regions, where)
+            if region is None:
+                continue
+            usage.setdefault(module, {})
+            usage[module][region] = usage[module].get(region, 0) + size
+            top[region] = max(top.get(region, 0), where + size)
+    return usage, top
+
+def main():
+    args = sys.argv[1:]
+    headroom = DEFAULT_HEADROOM
+    if len(args) >= 2 and args[0] == '--headroom':
+        headroom = int(args[1], 0)
+        args = args[2:]
+    if len(args) != 1:
+        sys.stderr.write('Usage: sram_budget.py [--headroom bytes] '
+                         'file.map\n')
+        return 2
+
+    with open(args[0]) as map_file:
+        regions, sections = parse_map(map_file)
+    for region in ('SRAM', 'FLASH'):
+        if region not in regions:
+            sys.stderr.write('sram_budget: no %s region in %s\n' %
+                             (region, args[0]))
+            return 2
+
+    usage, top = budget(regions, sections)
+
+    #
+    # Anything between the start of a region and the last byte used in it
+    # that no section accounts for went to alignment
+    #
+    for region in ('SRAM', 'FLASH'):
+        used = top.get(region, regions[region][0]) - regions[region][0]
+        counted = sum(u.get(region, 0) for u in usage.values())
+        if used > counted:
+            usage.setdefault('(padding)', {})
+            usage['(padding)'][region] = (usage['(padding)'].get(region, 0) +
+                                          used - counted)
+
+    print('%-28s %8s %8s' % ('Module', 'SRAM', 'Flash'))
+    for module in sorted(usage, key=lambda m: (-usage[m].get('SRAM', 0),
+                                               -usage[m].get('FLASH', 0), m)):
+        print('%-28s %8d %8d' % (module, usage[module].get('SRAM', 0),
+                                 usage[module].get('FLASH', 0)))
+
+    totals = {}
+    for region in ('SRAM', 'FLASH'):
+        totals[region] = sum(u.get(region, 0) for u in usage.values())
+    print('-' * 46)
+    print('%-28s %8d %8d' % ('Total', totals['SRAM'], totals['FLASH']))
+    print('%-28s %8d %8d' % ('Free', regions['SRAM'][1] - totals['SRAM'],
+                             regions['FLASH'][1] - totals['FLASH']))
+
+    free = regions['SRAM'][1] - totals['SRAM']
+    if free < headroom:
+        sys.stderr.write('sram_budget: %d bytes of SRAM free, but %d must '
+                         'be\n' % (free, headroom))
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,411 @@
+//*****************************************************************************
+//
+// ssd2119_emu.c - A host model of the SSD2119 display controller, as driven
+// by Kentec320x240x16_ssd2119_8bit.c over its 8080 style bus.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// The model keeps the register file and the display RAM, and follows the
+// parts of the controller the driver relies on:
+//
+// * The address counter, set through the X and Y RAM address registers, and
+//   stepped after every pixel as the entry mode register says: each axis
+//   counts up or down, and either axis can be the one that moves first.
+//
+// * The window, set through the RAM position registers.  The counter wraps
+//   within it, moving on a line in the other axis each time it does.
+//
+// * Vertical scrolling, set through the display control, scroll control and
+//   screen position registers.  It only changes which RAM line each gate
+//   line shows, so the RAM is left alone, and the scroll is applied when the
+//   frame is read back.
+//
+// Frames are read back as the panel would show them in the landscape
+// orientation the application uses: source line 319 on the left, and gate
+// line 239 at the top.
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ssd2119_emu.h"
+
+//*****************************************************************************
+//
+// Private predefines and variables
+//
+//*****************************************************************************
+
+//
+// The registers the model acts on
+//
+#define REG_DISPLAY_CTRL		0x07
+#define REG_ENTRY_MODE			0x11
+#define REG_RAM_DATA			0x22
+#define REG_V_SCROLL_CTRL_1		0x41
+#define REG_V_SCROLL_CTRL_2		0x42
+#define REG_V_RAM_POS			0x44
+#define REG_H_RAM_START			0x45
+#define REG_H_RAM_END			0x46
+#define REG_FIRST_WIN_START		0x48
+#define REG_FIRST_WIN_END		0x49
+#define REG_SECOND_WIN_START	0x4A
+#define REG_SECOND_WIN_END		0x4B
+#define REG_X_RAM_ADDR			0x4E
+#define REG_Y_RAM_ADDR			0x4F
+
+//
+// Entry mode bits: ID0 counts X up, ID1 counts Y up, and AM moves Y first
+//
+#define ENTRY_ID0				0x0010
+#define ENTRY_ID1				0x0020
+#define ENTRY_AM				0x0008
+
+//
+// Display control bits: SPT splits the panel into two screens, and VLE1 and
+// VLE2 scroll the first and second of them
+//
+#define DISPLAY_SPT				0x0100
+#define DISPLAY_VLE1			0x0200
+#define DISPLAY_VLE2			0x0400
+
+//
+// The register file, and the register the last command selected
+//
+static unsigned short g_pusRegs[256];
+static unsigned char g_ucIndex;
+
+//
+// The display RAM, by gate line and then source line, and the address
+// counter
+//
+static unsigned short g_ppusRam[EMU_GATE_LINES][EMU_SOURCE_LINES];
+static long g_lAddrX;
+static long g_lAddrY;
+
+//
+// The bus traffic since the counts were last cleared
+//
+tEmuCounts g_sEmuCounts;
+
+//*****************************************************************************
+//
+// Private Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Step one axis of the address counter, wrapping within the window.
+//
+// param plAddr: the axis of the counter to step
+// param bUp: whether the axis counts up
+// param lStart, lEnd: the extent of the window on this axis
+// return: 1 if the counter wrapped, and the other axis has to step, else 0
+//
+//*****************************************************************************
+static int
+AddrStep(long *plAddr, tBoolean bUp, long lStart, long lEnd)
+{
+	if(bUp)
+	{
+		if(*plAddr >= lEnd)
+		{
+			*plAddr = lStart;
+			return(1);
+		}
+		(*plAddr)++;
+	}
+	else
+	{
+		if(*plAddr <= lStart)
+		{
+			*plAddr = lEnd;
+			return(1);
+		}
+		(*plAddr)--;
+	}
+	return(0);
+}
+
+//*****************************************************************************
+//
+// Write a pixel into the RAM at the address counter, and step the counter.
+//
+// param usData: the pixel, in 5-6-5 RGB format
+//
+//*****************************************************************************
+static void
+RamWrite(unsigned short usData)
+{
+	unsigned short usEntry;
+	long lXStart, lXEnd, lYStart, lYEnd;
+
+	g_sEmuCounts.ulPixels++;
+	if((g_lAddrX < EMU_SOURCE_LINES) && (g_lAddrY < EMU_GATE_LINES))
+	{
+		g_ppusRam[g_lAddrY][g_lAddrX] = usData;
+	}
+	else
+	{
+		g_sEmuCounts.ulStrays++;
+	}
+
+	usEntry = g_pusRegs[REG_ENTRY_MODE];
+	lXStart = g_pusRegs[REG_H_RAM_START];
+	lXEnd = g_pusRegs[REG_H_RAM_END];
+	lYStart = g_pusRegs[REG_V_RAM_POS] & 0xff;
+	lYEnd = g_pusRegs[REG_V_RAM_POS] >> 8;
+
+	if(usEntry & ENTRY_AM)
+	{
+		if(AddrStep(&g_lAddrY, usEntry & ENTRY_ID1, lYStart, lYEnd))
+		{
+			AddrStep(&g_lAddrX, usEntry & ENTRY_ID0, lXStart, lXEnd);
+		}
+	}
+	else
+	{
+		if(AddrStep(&g_lAddrX, usEntry & ENTRY_ID0, lXStart, lXEnd))
+		{
+			AddrStep(&g_lAddrY, usEntry & ENTRY_ID1, lYStart, lYEnd);
+		}
+	}
+}
+
+//*****************************************************************************
+//
+// Find the RAM line a gate line shows, once scrolling is applied.
+//
+// param lGate: the gate line
+// return: the line of RAM it shows
+//
+//*****************************************************************************
+static long
+GateSource(long lGate)
+{
+	unsigned short usCtrl;
+	long lStart, lEnd, lScroll;
+
+	usCtrl = g_pusRegs[REG_DISPLAY_CTRL];
+	lStart = g_pusRegs[REG_FIRST_WIN_START];
+	lEnd = g_pusRegs[REG_FIRST_WIN_END];
+	lScroll = g_pusRegs[REG_V_SCROLL_CTRL_1];
+	if((usCtrl & DISPLAY_SPT) && !((lGate >= lStart) && (lGate <= lEnd)))
+	{
+		usCtrl &= ~DISPLAY_VLE1;
+		lStart = g_pusRegs[REG_SECOND_WIN_START];
+		lEnd = g_pusRegs[REG_SECOND_WIN_END];
+		lScroll = g_pusRegs[REG_V_SCROLL_CTRL_2];
+	}
+	else
+	{
+		usCtrl &= ~DISPLAY_VLE2;
+	}
+
+	//
+	// The screen scrolls towards lower gate lines, with the lines that fall
+	// off its start wrapping around to its end
+	//
+	if((usCtrl & (DISPLAY_VLE1 | DISPLAY_VLE2)) && (lGate >= lStart) &&
+	   (lGate <= lEnd) && (lEnd >= lStart))
+	{
+		lGate = lStart + ((lGate - lStart + lScroll) % (lEnd - lStart + 1));
+	}
+	return(lGate);
+}
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Put the model in the state the controller comes out of reset in, with the
+// RAM cleared to black.  The counts are cleared too.
+//
+//*****************************************************************************
+void
+EmuReset(void)
+{
+	memset(g_pusRegs, 0, sizeof(g_pusRegs));
+	memset(g_ppusRam, 0, sizeof(g_ppusRam));
+	g_pusRegs[REG_ENTRY_MODE] = 0x6830;
+	g_pusRegs[REG_V_RAM_POS] = (EMU_GATE_LINES - 1) << 8;
+	g_pusRegs[REG_H_RAM_END] = EMU_SOURCE_LINES - 1;
+	g_pusRegs[REG_FIRST_WIN_END] = EMU_GATE_LINES - 1;
+	g_ucIndex = 0;
+	g_lAddrX = 0;
+	g_lAddrY = 0;
+	EmuCountsClear();
+}
+
+//*****************************************************************************
+//
+// Write a command, which selects the register the following data goes to.
+//
+// param ucData: the register index
+//
+//*****************************************************************************
+void
+EmuWriteCommand(unsigned char ucData)
+{
+	g_sEmuCounts.ulCommands++;
+	g_ucIndex = ucData;
+}
+
+//*****************************************************************************
+//
+// Write a data word to the register the last command selected.  Once the
+// RAM data register is selected, every data word is a pixel.
+//
+// param usData: the data word
+//
+//*****************************************************************************
+void
+EmuWriteData(unsigned short usData)
+{
+	g_sEmuCounts.ulData++;
+
+	switch(g_ucIndex)
+	{
+		case REG_RAM_DATA:
+			RamWrite(usData);
+			return;
+
+		case REG_X_RAM_ADDR:
+			g_lAddrX = usData;
+			g_sEmuCounts.ulAddressSetups++;
+			break;
+
+		case REG_Y_RAM_ADDR:
+			g_lAddrY = usData;
+			g_sEmuCounts.ulAddressSetups++;
+			break;
+
+		case REG_V_RAM_POS:
+		case REG_H_RAM_START:
+		case REG_H_RAM_END:
+			g_sEmuCounts.ulWindowSetups++;
+			break;
+
+		case REG_ENTRY_MODE:
+			g_sEmuCounts.ulEntryModes++;
+			break;
+	}
+
+	g_pusRegs[g_ucIndex] = usData;
+}
+
+//*****************************************************************************
+//
+// Clear the bus traffic counts, usually at the start of a frame.
+//
+//*****************************************************************************
+void
+EmuCountsClear(void)
+{
+	memset(&g_sEmuCounts, 0, sizeof(g_sEmuCounts));
+}
+
+//*****************************************************************************
+//
+// Read back a register.
+//
+// param ucReg: the register index
+// return: the last value written to the register
+//
+//*****************************************************************************
+unsigned short
+EmuRegisterGet(unsigned char ucReg)
+{
+	return(g_pusRegs[ucReg]);
+}
+
+//*****************************************************************************
+//
+// Read back a pixel the way the panel shows it.
+//
+// param lX, lY: the pixel, in landscape screen coordinates
+// return: the pixel's color, in 5-6-5 RGB format
+//
+//*****************************************************************************
+unsigned short
+EmuPixelGet(long lX, long lY)
+{
+	return(g_ppusRam[GateSource(EMU_GATE_LINES - 1 - lY)]
+					[EMU_SOURCE_LINES - 1 - lX]);
+}
+
+//*****************************************************************************
+//
+// Hash the frame the panel shows, so that two renderings can be compared
+// without keeping the frames around.
+//
+// return: the 32 bit FNV-1a hash of the frame's pixels, row by row
+//
+//*****************************************************************************
+unsigned long
+EmuFrameHash(void)
+{
+	unsigned long ulHash;
+	unsigned short usPixel;
+	long lX, lY;
+
+	ulHash = 2166136261UL;
+	for(lY = 0; lY < EMU_GATE_LINES; lY++)
+	{
+		for(lX = 0; lX < EMU_SOURCE_LINES; lX++)
+		{
+			usPixel = EmuPixelGet(lX, lY);
+			ulHash = ((ulHash ^ (usPixel & 0xff)) * 16777619UL) & 0xffffffff;
+			ulHash = ((ulHash ^ (usPixel >> 8)) * 16777619UL) & 0xffffffff;
+		}
+	}
+	return(ulHash);
+}
+
+//*****************************************************************************
+//
+// Write the frame the panel shows out as a binary PPM image.
+//
+// param pcFilename: the file to write
+// return: 0 on success, or -1 if the file couldn't be written
+//
+//*****************************************************************************
+int
+EmuFrameWrite(const char *pcFilename)
+{
+	FILE *pFile;
+	unsigned short usPixel;
+	unsigned char pucRGB[3];
+	long lX, lY;
+
+	pFile = fopen(pcFilename, "wb");
+	if(!pFile)
+	{
+		return(-1);
+	}
+
+	fprintf(pFile, "P6\n%d %d\n255\n", EMU_SOURCE_LINES, EMU_GATE_LINES);
+	for(lY = 0; lY < EMU_GATE_LINES; lY++)
+	{
+		for(lX = 0; lX < EMU_SOURCE_LINES; lX++)
+		{
+			//
+			// Widen each channel by repeating its top bits at the bottom, so
+			// full scale stays full scale
+			//
+			usPixel = EmuPixelGet(lX, lY);
+			pucRGB[0] = ((usPixel >> 8) & 0xf8) | (usPixel >> 13);
+			pucRGB[1] = ((usPixel >> 3) & 0xfc) | ((usPixel >> 9) & 0x03);
+			pucRGB[2] = ((usPixel << 3) & 0xf8) | ((usPixel >> 2) & 0x07);
+			fwrite(pucRGB, 1, 3, pFile);
+		}
+	}
+
+	return(fclose(pFile) ? -1 : 0);
+}
@@ -0,0 +1,161 @@
+//*****************************************************************************
+//
+// ssd2119_emu.h - Predefines, public functions, and globals for the host
+// model of the SSD2119 display controller.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// A host build of the display driver (with HOST_BUILD defined) includes this
+// in place of grlib and the driverlib headers, and sends its command and
+// data writes to the model instead of the GPIO bus.
+//
+//*****************************************************************************
+
+#ifndef __SSD2119_EMU_H__
+#define __SSD2119_EMU_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The size of the controller's RAM: one word per source line (the long side
+// of the panel) on each gate line.
+//
+#define EMU_SOURCE_LINES		320
+#define EMU_GATE_LINES			240
+
+//*****************************************************************************
+//
+// Stand ins for the grlib and driverlib types the display driver uses
+//
+//*****************************************************************************
+typedef unsigned char tBoolean;
+
+typedef struct
+{
+	short sXMin;
+	short sYMin;
+	short sXMax;
+	short sYMax;
+}
+tRectangle;
+
+typedef struct
+{
+	long lSize;
+	void *pvDisplayData;
+	unsigned short usWidth;
+	unsigned short usHeight;
+	void (*pfnPixelDraw)(void *pvDisplayData, long lX, long lY,
+						 unsigned long ulValue);
+	void (*pfnPixelDrawMultiple)(void *pvDisplayData, long lX, long lY,
+								 long lX0, long lCount, long lBPP,
+								 const unsigned char *pucData,
+								 const unsigned char *pucPalette);
+	void (*pfnLineDrawH)(void *pvDisplayData, long lX1, long lX2, long lY,
+						 unsigned long ulValue);
+	void (*pfnLineDrawV)(void *pvDisplayData, long lX, long lY1, long lY2,
+						 unsigned long ulValue);
+	void (*pfnRectFill)(void *pvDisplayData, const tRectangle *pRect,
+						unsigned long ulValue);
+	unsigned long (*pfnColorTranslate)(void *pvDisplayData,
+									   unsigned long ulValue);
+	void (*pfnFlush)(void *pvDisplayData);
+}
+tDisplay;
+
+//*****************************************************************************
+//
+// The bus traffic the model has seen since the counts were last cleared.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// Register index writes, with DC low
+	//
+	unsigned long ulCommands;
+
+	//
+	// Data writes of any kind, with DC high
+	//
+	unsigned long ulData;
+
+	//
+	// Data writes that went into the display RAM
+	//
+	unsigned long ulPixels;
+
+	//
+	// Writes to the X and Y RAM address counters
+	//
+	unsigned long ulAddressSetups;
+
+	//
+	// Writes to the window extent registers
+	//
+	unsigned long ulWindowSetups;
+
+	//
+	// Writes to the entry mode register
+	//
+	unsigned long ulEntryModes;
+
+	//
+	// Pixels written while the address counter was outside the RAM, which a
+	// correct driver never does
+	//
+	unsigned long ulStrays;
+}
+tEmuCounts;
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+extern tEmuCounts g_sEmuCounts;
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern void EmuReset(void);
+extern void EmuWriteCommand(unsigned char ucData);
+extern void EmuWriteData(unsigned short usData);
+extern void EmuCountsClear(void);
+extern unsigned short EmuRegisterGet(unsigned char ucReg);
+extern unsigned short EmuPixelGet(long lX, long lY);
+extern unsigned long EmuFrameHash(void);
+extern int EmuFrameWrite(const char *pcFilename);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+//
+// The driver's own header, which needs tDisplay from above
+//
+#include "Kentec320x240x16_ssd2119_8bit.h"
+
+#endif // __SSD2119_EMU_H__
@@ -211,15 +211,56 @@ short g_sTouchMin = TOUCH_MIN;
 //
 // The current state of the touch screen driver's state machine.  This is used
 // to cycle the touch screen interface through the powering sequence required
-// to read the two axes of the surface.
+// to read the two axes of the surface.  In the DISCHARGE states, the layer to
+// be read is being discharged until the next timer interrupt; in the SETTLE
+// states, it has been switched to an analog input and is settling to the
+// touch voltage until the next timer interrupt; in the WAIT states, the ADC
+// is capturing it.
 //
 //*****************************************************************************
-static unsigned long g_ulTSState;
-#define TS_STATE_INIT           0
-#define TS_STATE_READ_X         1
-#define TS_STATE_READ_Y         2
-#define TS_STATE_SKIP_X         3
-#define TS_STATE_SKIP_Y         4
+static volatile unsigned long g_ulTSState;
+#define TS_STATE_DISCHARGE_X    0
+#define TS_STATE_SETTLE_X       1
+#define TS_STATE_WAIT_X         2
+#define TS_STATE_DISCHARGE_Y    3
+#define TS_STATE_SETTLE_Y       4
+#define TS_STATE_WAIT_Y         5
+
+//*****************************************************************************
+//
+// The ADC sample sequence captures each axis as TS_SETTLE_STEPS samples that
+// are thrown away while the ADC's sample and hold settles on the newly
+// selected channel, followed by TS_AVG_STEPS samples that are averaged.  The
+// panel itself has a whole timer tick to settle before the sequence starts.
+// Each sample is itself the average of TS_OVERSAMPLE conversions, done in
+// hardware.  All of the steps sample the same channel, so TS_MUX gives the
+// sequence's multiplexer setting for a channel.
+//
+//*****************************************************************************
+#define TS_SETTLE_STEPS         2
+#define TS_AVG_STEPS            4
+#define TS_OVERSAMPLE           4
+#define TS_MUX(ulCh)            ((ulCh) * 0x00111111)
+
+//*****************************************************************************
+//
+// The touch screen sample rates, in X/Y pairs per second, while the screen is
+// in use and while it is idle, and the number of pairs the pen has to be up
+// for before the rate drops.
+//
+//*****************************************************************************
+#define TS_ACTIVE_RATE          250
+#define TS_IDLE_RATE            20
+#define TS_IDLE_PAIRS           50
+
+//*****************************************************************************
+//
+// The number of timer interrupts per X/Y pair.  Each axis takes one to switch
+// the layer to be read over to an analog input and one to capture it, so at
+// the active rate the layer settles for 1 ms, as long as it always has.
+//
+//*****************************************************************************
+#define TS_TICKS_PER_PAIR       4
 
 //*****************************************************************************
 //
@@ -456,35 +497,28 @@ TouchScreenDebouncer(void)
     }
 }
 
-void
-Timer1AIntHandler(void)
-{
-    TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
-	ADCProcessorTrigger(ADC1_BASE, 3);
-}
-
 //*****************************************************************************
 //
-//! Handles the ADC interrupt for the touch screen.
+//! Handles the timer interrupt for the touch screen.
 //!
-//! This function is called when the ADC sequence that samples the touch screen
-//! has completed its acquisition.  The touch screen state machine is advanced
-//! and the acquired ADC sample is processed appropriately.
+//! This function is called TS_TICKS_PER_PAIR times per touch screen sample,
+//! and moves one axis on a step.  The layer to be sensed has been grounded
+//! since the last axis was captured, so any residual voltage on it has
+//! drained away; on one tick it is switched over to an analog input, and on
+//! the next, once it has settled to the voltage at the touch point, the ADC
+//! sample sequence is started.
 //!
-//! It is the responsibility of the application using the touch screen driver
-//! to ensure that this function is installed in the interrupt vector table for
-//! the ADC3 interrupt.
+//! The ADC could be triggered by the timer directly, but the timer triggers
+//! are shared by every ADC, so the audio sample sequence would be triggered as
+//! well.  The sequence is triggered from this handler instead.
 //!
 //! \return None.
 //
 //*****************************************************************************
 void
-TouchScreenIntHandler(void)
+Timer1AIntHandler(void)
 {
-    //
-    // Clear the ADC sample sequence interrupt.
-    //
-    HWREG(ADC1_BASE + ADC_O_ISC) = 1 << 3;
+    TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
 
     //
     // Determine what to do based on the current state of the state machine.
@@ -492,15 +526,10 @@ TouchScreenIntHandler(void)
     switch(g_ulTSState)
     {
         //
-        // The new sample is an X axis sample that should be discarded.
+        // The X axis layer is driven, and the Y axis layer grounded.
         //
-        case TS_STATE_SKIP_X:
+        case TS_STATE_DISCHARGE_X:
         {
-            //
-            // Read and throw away the ADC sample.
-            //
-            HWREG(ADC1_BASE + ADC_O_SSFIFO3);
-
             //
             // Set the analog mode select for the YP pin.
             //
@@ -512,124 +541,222 @@ TouchScreenIntHandler(void)
             //
             HWREG(TS_P_BASE + GPIO_O_DIR) =
                 HWREG(TS_P_BASE + GPIO_O_DIR) & ~TS_YP_PIN;
-            //if(g_eDaughterType == DAUGHTER_NONE)
-            {
-                HWREG(TS_N_BASE + GPIO_O_DIR) =
-                    HWREG(TS_N_BASE + GPIO_O_DIR) & ~TS_YN_PIN;
-            }
-            //else if(g_eDaughterType == DAUGHTER_SRAM_FLASH)
-            //{
-            //    HWREGB(LCD_CONTROL_SET_REG) = LCD_CONTROL_YN;
-            //}
+            HWREG(TS_N_BASE + GPIO_O_DIR) =
+                HWREG(TS_N_BASE + GPIO_O_DIR) & ~TS_YN_PIN;
 
             //
-            // The next sample will be a valid X axis sample.
-            //
-            g_ulTSState = TS_STATE_READ_X;
-
-            //
-            // This state has been handled.
+            // Capture the X axis value on the next tick.
             //
+            HWREG(ADC1_BASE + ADC_O_SSMUX0) = TS_MUX(ADC_CTL_CH_YP);
+            g_ulTSState = TS_STATE_SETTLE_X;
             break;
         }
 
         //
-        // The new sample is an X axis sample that should be processed.
+        // The Y axis layer is driven, and the X axis layer grounded.
         //
-        case TS_STATE_READ_X:
+        case TS_STATE_DISCHARGE_Y:
         {
             //
-            // Read the raw ADC sample.
-            //
-            g_sTouchX = HWREG(ADC1_BASE + ADC_O_SSFIFO3);
-
-            //
-            // Clear the analog mode select for the YP pin.
+            // Set the analog mode select for the XP pin.
             //
             HWREG(TS_P_BASE + GPIO_O_AMSEL) =
-                HWREG(TS_P_BASE + GPIO_O_AMSEL) & ~TS_YP_PIN;
+                HWREG(TS_P_BASE + GPIO_O_AMSEL) | TS_XP_PIN;
 
             //
-            // Configure the X and Y axis touch layers as outputs.
+            // Configure the X axis touch layer pins as inputs.
             //
             HWREG(TS_P_BASE + GPIO_O_DIR) =
-                HWREG(TS_P_BASE + GPIO_O_DIR) | TS_XP_PIN | TS_YP_PIN;
-
-            //if(g_eDaughterType == DAUGHTER_NONE)
-            {
-                HWREG(TS_N_BASE + GPIO_O_DIR) =
-                    HWREG(TS_N_BASE + GPIO_O_DIR) | TS_XN_PIN | TS_YN_PIN;
-            }
+                HWREG(TS_P_BASE + GPIO_O_DIR) & ~TS_XP_PIN;
+            HWREG(TS_N_BASE + GPIO_O_DIR) =
+                HWREG(TS_N_BASE + GPIO_O_DIR) & ~TS_XN_PIN;
 
             //
-            // Drive the positive side of the Y axis touch layer with VDD and
-            // the negative side with GND.  Also, drive both sides of the X
-            // axis layer with GND to discharge any residual voltage (so that
-            // a no-touch condition can be properly detected).
+            // Capture the Y axis value on the next tick.
             //
-            //if(g_eDaughterType == DAUGHTER_NONE)
-            {
-                HWREG(TS_N_BASE + GPIO_O_DATA +
-                      ((TS_XN_PIN | TS_YN_PIN) << 2)) = 0;
-            }
-            //else if(g_eDaughterType == DAUGHTER_SRAM_FLASH)
-            //{
-            //    HWREGB(LCD_CONTROL_CLR_REG) = LCD_CONTROL_XN | LCD_CONTROL_YN;
-            //}
-            HWREG(TS_P_BASE + GPIO_O_DATA + ((TS_XP_PIN | TS_YP_PIN) << 2)) =
-                TS_YP_PIN;
+            HWREG(ADC1_BASE + ADC_O_SSMUX0) = TS_MUX(ADC_CTL_CH_XP);
+            g_ulTSState = TS_STATE_SETTLE_Y;
+            break;
+        }
 
-            //
-            // Configure the sample sequence to capture the X axis value.
-            //
-            HWREG(ADC1_BASE + ADC_O_SSMUX3) = ADC_CTL_CH_XP;
+        //
+        // The layer to be sensed has settled, so capture it.
+        //
+        case TS_STATE_SETTLE_X:
+        {
+            g_ulTSState = TS_STATE_WAIT_X;
+            ADCProcessorTrigger(ADC1_BASE, 0);
+            break;
+        }
+        case TS_STATE_SETTLE_Y:
+        {
+            g_ulTSState = TS_STATE_WAIT_Y;
+            ADCProcessorTrigger(ADC1_BASE, 0);
+            break;
+        }
 
-            //
-            // The next sample will be an invalid Y axis sample.
-            //
-            g_ulTSState = TS_STATE_SKIP_Y;
+        //
+        // The last capture is still in progress, which only happens if the
+        // timer is running far faster than it should.  Let it finish.
+        //
+        default:
+        {
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Reads an axis of the touch screen from the ADC sample sequence.
+//!
+//! The first TS_SETTLE_STEPS samples are taken while the input settles, and
+//! are thrown away.  The rest are averaged, on top of the averaging the ADC
+//! does in hardware.
+//!
+//! \return The averaged raw ADC reading.
+//
+//*****************************************************************************
+static short
+TouchScreenAxisRead(void)
+{
+    unsigned long ulStep, ulSum;
+
+    ulSum = 0;
+    for(ulStep = 0; ulStep < TS_SETTLE_STEPS + TS_AVG_STEPS; ulStep++)
+    {
+        if(ulStep < TS_SETTLE_STEPS)
+        {
+            HWREG(ADC1_BASE + ADC_O_SSFIFO0);
+        }
+        else
+        {
+            ulSum += HWREG(ADC1_BASE + ADC_O_SSFIFO0) & 0xfff;
+        }
+    }
+
+    return(ulSum / TS_AVG_STEPS);
+}
+
+//*****************************************************************************
+//
+//! Sets the touch screen sample rate from whether the screen is being touched.
+//!
+//! While the pen is up, the screen only has to be watched for the next press,
+//! so once it has been up for TS_IDLE_PAIRS samples the sample rate drops to
+//! TS_IDLE_RATE.  The first sample that shows a press brings it straight back
+//! up to TS_ACTIVE_RATE, so the press is debounced at the full rate.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+TouchScreenRateUpdate(void)
+{
+    static unsigned long ulUntouched = 0;
+    static unsigned char ucIdle = 0;
 
+    if((g_sTouchX < g_sTouchMin) || (g_sTouchY < g_sTouchMin))
+    {
+        if(ulUntouched < TS_IDLE_PAIRS)
+        {
+            ulUntouched++;
+        }
+        else if(!ucIdle && !g_cState)
+        {
+            ucIdle = 1;
+            TimerLoadSet(TIMER1_BASE, TIMER_A,
+                         (SysCtlClockGet() /
+                          (TS_IDLE_RATE * TS_TICKS_PER_PAIR)) - 1);
+        }
+    }
+    else
+    {
+        ulUntouched = 0;
+        if(ucIdle)
+        {
             //
-            // This state has been handled.
+            // The new load value takes effect straight away, rather than at
+            // the end of the long idle period.
             //
-            break;
+            ucIdle = 0;
+            TimerLoadSet(TIMER1_BASE, TIMER_A,
+                         (SysCtlClockGet() /
+                          (TS_ACTIVE_RATE * TS_TICKS_PER_PAIR)) - 1);
         }
+    }
+}
+
+//*****************************************************************************
+//
+//! Handles the ADC interrupt for the touch screen.
+//!
+//! This function is called when the ADC sequence that samples the touch screen
+//! has completed its acquisition of one axis.  The averaged reading is stored,
+//! and the layer just sensed is grounded while the other is driven, ready for
+//! the next axis to be switched over on the next timer interrupt and captured
+//! on the one after.  Once the Y axis is captured, there is a new X/Y sample
+//! pair, which is passed to the debouncer.
+//!
+//! It is the responsibility of the application using the touch screen driver
+//! to ensure that this function is installed in the interrupt vector table for
+//! the ADC1 sample sequence 0 interrupt.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TouchScreenIntHandler(void)
+{
+    //
+    // Clear the ADC sample sequence interrupt.
+    //
+    HWREG(ADC1_BASE + ADC_O_ISC) = 1 << 0;
 
+    //
+    // Determine what to do based on the current state of the state machine.
+    //
+    switch(g_ulTSState)
+    {
         //
-        // The new sample is a Y axis sample that should be discarded.
+        // The X axis has been captured.
         //
-        case TS_STATE_SKIP_Y:
+        case TS_STATE_WAIT_X:
         {
             //
-            // Read and throw away the ADC sample.
+            // Read the averaged ADC samples.
             //
-            HWREG(ADC1_BASE + ADC_O_SSFIFO3);
+            g_sTouchX = TouchScreenAxisRead();
 
             //
-            // Set the analog mode select for the XP pin.
+            // Clear the analog mode select for the YP pin.
             //
             HWREG(TS_P_BASE + GPIO_O_AMSEL) =
-                HWREG(TS_P_BASE + GPIO_O_AMSEL) | TS_XP_PIN;
+                HWREG(TS_P_BASE + GPIO_O_AMSEL) & ~TS_YP_PIN;
 
             //
-            // Configure the X axis touch layer pins as inputs.
+            // Configure the X and Y axis touch layers as outputs.
             //
             HWREG(TS_P_BASE + GPIO_O_DIR) =
-                HWREG(TS_P_BASE + GPIO_O_DIR) & ~TS_XP_PIN;
-            //if(g_eDaughterType == DAUGHTER_NONE)
-            {
-                HWREG(TS_N_BASE + GPIO_O_DIR) =
-                    HWREG(TS_N_BASE + GPIO_O_DIR) & ~TS_XN_PIN;
-            }
-            //else if(g_eDaughterType == DAUGHTER_SRAM_FLASH)
-            //{
-            //    HWREGB(LCD_CONTROL_SET_REG) = LCD_CONTROL_XN;
-            //}
+                HWREG(TS_P_BASE + GPIO_O_DIR) | TS_XP_PIN | TS_YP_PIN;
+            HWREG(TS_N_BASE + GPIO_O_DIR) =
+                HWREG(TS_N_BASE + GPIO_O_DIR) | TS_XN_PIN | TS_YN_PIN;
 
             //
-            // The next sample will be a valid Y axis sample.
+            // Drive the positive side of the Y axis touch layer with VDD and
+            // the negative side with GND.  Also, drive both sides of the X
+            // axis layer with GND to discharge any residual voltage (so that
+            // a no-touch condition can be properly detected).
             //
-            g_ulTSState = TS_STATE_READ_Y;
+            HWREG(TS_N_BASE + GPIO_O_DATA +
+                  ((TS_XN_PIN | TS_YN_PIN) << 2)) = 0;
+            HWREG(TS_P_BASE + GPIO_O_DATA + ((TS_XP_PIN | TS_YP_PIN) << 2)) =
+                TS_YP_PIN;
+
+            //
+            // The Y axis is set up to be read on the next timer interrupt.
+            //
+            g_ulTSState = TS_STATE_DISCHARGE_Y;
 
             //
             // This state has been handled.
@@ -638,27 +765,15 @@ TouchScreenIntHandler(void)
         }
 
         //
-        // The new sample is a Y axis sample that should be processed.
+        // The Y axis has been captured.
         //
-        case TS_STATE_READ_Y:
+        case TS_STATE_WAIT_Y:
         {
             //
-            // Read the raw ADC sample.
-            //
-            g_sTouchY = HWREG(ADC1_BASE + ADC_O_SSFIFO3);
-
-            //
-            // The next configuration is the same as the initial configuration.
-            // Therefore, fall through into the initialization state to avoid
-            // duplicating the code.
+            // Read the averaged ADC samples.
             //
-        }
+            g_sTouchY = TouchScreenAxisRead();
 
-        //
-        // The state machine is in its initial state
-        //
-        case TS_STATE_INIT:
-        {
             //
             // Clear the analog mode select for the XP pin.
             //
@@ -670,11 +785,8 @@ TouchScreenIntHandler(void)
             //
             HWREG(TS_P_BASE + GPIO_O_DIR) =
                 HWREG(TS_P_BASE + GPIO_O_DIR) | TS_XP_PIN | TS_YP_PIN;
-            //if(g_eDaughterType == DAUGHTER_NONE)
-            {
-                HWREG(TS_N_BASE + GPIO_O_DIR) =
-                    HWREG(TS_N_BASE + GPIO_O_DIR) | TS_XN_PIN | TS_YN_PIN;
-            }
+            HWREG(TS_N_BASE + GPIO_O_DIR) =
+                HWREG(TS_N_BASE + GPIO_O_DIR) | TS_XN_PIN | TS_YN_PIN;
 
             //
             // Drive one side of the X axis touch layer with VDD and the other
@@ -684,33 +796,20 @@ TouchScreenIntHandler(void)
             //
             HWREG(TS_P_BASE + GPIO_O_DATA + ((TS_XP_PIN | TS_YP_PIN) << 2)) =
                 TS_XP_PIN;
-            //if(g_eDaughterType == DAUGHTER_NONE)
-            {
-                HWREG(TS_N_BASE + GPIO_O_DATA +
-                      ((TS_XN_PIN | TS_YN_PIN) << 2)) = 0;
-            }
-            //else if(g_eDaughterType == DAUGHTER_SRAM_FLASH)
-            //{
-            //    HWREGB(LCD_CONTROL_CLR_REG) = LCD_CONTROL_XN | LCD_CONTROL_YN;
-            //}
-            //
-            // Configure the sample sequence to capture the Y axis value.
-            //
-            HWREG(ADC1_BASE + ADC_O_SSMUX3) = ADC_CTL_CH_YP;
+            HWREG(TS_N_BASE + GPIO_O_DATA +
+                  ((TS_XN_PIN | TS_YN_PIN) << 2)) = 0;
 
             //
-            // If this is the valid Y sample state, then there is a new X/Y
-            // sample pair.  In that case, run the touch screen debouncer.
+            // There is a new X/Y sample pair, so run the touch screen
+            // debouncer, and pick the sample rate for what it found.
             //
-            if(g_ulTSState == TS_STATE_READ_Y)
-            {
-                TouchScreenDebouncer();
-            }
+            TouchScreenDebouncer();
+            TouchScreenRateUpdate();
 
             //
-            // The next sample will be an invalid X axis sample.
+            // The X axis is set up to be read on the next timer interrupt.
             //
-            g_ulTSState = TS_STATE_SKIP_X;
+            g_ulTSState = TS_STATE_DISCHARGE_X;
 
             //
             // This state has been handled.
@@ -728,7 +827,7 @@ TouchScreenIntHandler(void)
 //! reading from the touch screen.  This driver uses the following hardware
 //! resources:
 //!
-//! - ADC sample sequence 3
+//! - ADC1 sample sequence 0
 //! - Timer 1 subtimer A
 //!
 //! \return None.
@@ -737,10 +836,13 @@ TouchScreenIntHandler(void)
 void
 TouchScreenInit(void)
 {
+    unsigned long ulStep;
+
     //
-    // Set the initial state of the touch screen driver's state machine.
+    // Set the initial state of the touch screen driver's state machine.  The
+    // pins are set up for it below.
     //
-    g_ulTSState = TS_STATE_INIT;
+    g_ulTSState = TS_STATE_DISCHARGE_X;
 
     //
     // Determine which calibration parameter set we will be using.
@@ -771,19 +873,24 @@ TouchScreenInit(void)
 
     //
     // Configure the ADC sample sequence used to read the touch screen reading.
+    // Only the last step interrupts, so each axis takes one interrupt.  The
+    // channel is set for each axis as it is captured.
     //
-    ADCHardwareOversampleConfigure(ADC1_BASE, 4);
-    //ADCSequenceConfigure(ADC1_BASE, 3, ADC_TRIGGER_TIMER, 0);
-    ADCSequenceConfigure(ADC1_BASE, 3, ADC_TRIGGER_PROCESSOR, 0);
-    ADCSequenceStepConfigure(ADC1_BASE, 3, 0,
+    ADCHardwareOversampleConfigure(ADC1_BASE, TS_OVERSAMPLE);
+    ADCSequenceConfigure(ADC1_BASE, 0, ADC_TRIGGER_PROCESSOR, 0);
+    for(ulStep = 0; ulStep < TS_SETTLE_STEPS + TS_AVG_STEPS - 1; ulStep++)
+    {
+        ADCSequenceStepConfigure(ADC1_BASE, 0, ulStep, ADC_CTL_CH_YP);
+    }
+    ADCSequenceStepConfigure(ADC1_BASE, 0, ulStep,
                              ADC_CTL_CH_YP | ADC_CTL_END | ADC_CTL_IE);
-    ADCSequenceEnable(ADC1_BASE, 3);
+    ADCSequenceEnable(ADC1_BASE, 0);
 
     //
     // Enable the ADC sample sequence interrupt.
     //
-    ADCIntEnable(ADC1_BASE, 3);
-    IntEnable(INT_ADC1SS3);
+    ADCIntEnable(ADC1_BASE, 0);
+    IntEnable(INT_ADC1SS0);
 
     //
     // Configure the GPIOs used to drive the touch screen layers.
@@ -799,7 +906,11 @@ TouchScreenInit(void)
         GPIOPinTypeGPIOOutput(TS_N_BASE, TS_XN_PIN | TS_YN_PIN);
     }
 
-    GPIOPinWrite(TS_P_BASE, TS_XP_PIN | TS_YP_PIN, 0x00);
+    //
+    // Drive the X axis touch layer, and ground the Y axis layer, ready for
+    // the X axis to be set up on the first timer interrupt.
+    //
+    GPIOPinWrite(TS_P_BASE, TS_XP_PIN | TS_YP_PIN, TS_XP_PIN);
     //if(g_eDaughterType == DAUGHTER_NONE)
     {
         GPIOPinWrite(TS_N_BASE, TS_XN_PIN | TS_YN_PIN, 0x00);
@@ -822,14 +933,16 @@ TouchScreenInit(void)
     if((HWREG(TIMER1_BASE + TIMER_O_CTL) & TIMER_CTL_TAEN) == 0)
     {
         //
-        // Configure the timer to trigger the sampling of the touch screen
-        // every millisecond.
+        // Configure the timer to step the capture of the touch screen's axes
+        // TS_TICKS_PER_PAIR times per sample, at the active rate to begin
+        // with.
         //
         TimerConfigure(TIMER1_BASE, (TIMER_CFG_SPLIT_PAIR |
                                      TIMER_CFG_A_PERIODIC |
                                      TIMER_CFG_B_PERIODIC));
-        TimerLoadSet(TIMER1_BASE, TIMER_A, (SysCtlClockGet() / 1000) - 1);
-        //TimerControlTrigger(TIMER1_BASE, TIMER_A, true);
+        TimerLoadSet(TIMER1_BASE, TIMER_A,
+                     (SysCtlClockGet() /
+                      (TS_ACTIVE_RATE * TS_TICKS_PER_PAIR)) - 1);
 
         //
         //JTW: We can't have multiple timers trigger different ADC peripherals,
@@ -841,7 +954,7 @@ TouchScreenInit(void)
 
         //
         // Enable the timer.  At this point, the touch screen state machine
-        // will sample and run once per millisecond.
+        // will sample and run TS_ACTIVE_RATE times per second.
         //
         TimerEnable(TIMER1_BASE, TIMER_A);
     }
@@ -0,0 +1,518 @@
+//*****************************************************************************
+//
+// tuner.c - Pitch detection from the autocorrelation of a windowed frame.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "window.h"
+#include "tuner.h"
+#include <math.h>
+
+//*****************************************************************************
+//
+// Private predefines and variables
+//
+//*****************************************************************************
+
+//
+// 12 / ln(2), used to turn a natural log frequency ratio into semitones
+//
+#define SEMITONES_PER_LN		17.3123405f
+
+//
+// The MIDI note number and frequency of A4, which everything is tuned from
+//
+#define A4_NOTE					69
+#define A4_FREQ					440.0f
+
+//
+// The period is refined at multiples of itself up to this lag, in samples.
+// The error a parabola makes in placing a peak is a fraction of a sample
+// whatever the lag, so it is divided by the multiple.  Past this lag, the
+// correlation that wraps around the end of the frame gets too strong to
+// take back out.
+//
+#define REFINE_LAG				256
+
+//
+// The number of times the wrapped part of the correlation is estimated from
+// the period and taken out, each with the period found the time before
+//
+#define WRAP_PASSES				2
+
+//
+// The number of window autocorrelations kept, so that the passes over the
+// same few lags, and the frames after them while a note is held, don't work
+// them out again
+//
+#define WINDOW_CACHE_SIZE		16
+
+//
+// Printable names for the notes in an octave, starting at C
+//
+static const char * const g_ppcNoteNames[12] =
+{
+	"C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B"
+};
+
+//
+// Window autocorrelations already worked out, the window they are for, and
+// the entry to be replaced next
+//
+static struct
+{
+	unsigned long ulLag;
+	float fValue;
+}
+g_psWindowCache[WINDOW_CACHE_SIZE];
+static const tWindowTable *g_psCachedWindow;
+static unsigned long g_ulCacheNext;
+
+//*****************************************************************************
+//
+// Public global variables
+//
+//*****************************************************************************
+
+//
+// The pitch found in the most recently processed frame
+//
+tTunerResults g_sTunerResults;
+
+//*****************************************************************************
+//
+// Private Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Get coefficient n of a full length window from its half length table.
+//
+//*****************************************************************************
+static float
+WindowCoef(const tWindowTable *psWindow, unsigned long n)
+{
+	if(n >= (psWindow->usLength / 2))
+	{
+		n = psWindow->usLength - 1 - n;
+	}
+	return(WINDOW_COEF_TO_FLOAT(psWindow->pCoefs[n]));
+}
+
+//*****************************************************************************
+//
+// Calculate the autocorrelation of the window itself at a given lag.
+//
+// The autocorrelation of a windowed frame is the autocorrelation of the signal
+// multiplied by this, so it tapers off as the lag grows.  Dividing it back out
+// keeps that taper from dragging the detected period short, which would
+// otherwise read several cents sharp on low notes.
+//
+// param psWindow: the window that was applied to the frame
+// param ulLag: the lag, in samples
+//
+// return: sum over n of w(n) * w(n + ulLag)
+//
+//*****************************************************************************
+static float
+WindowAutoCorr(const tWindowTable *psWindow, unsigned long ulLag)
+{
+	unsigned long n;
+	float fSum;
+
+	fSum = 0;
+	for(n = 0; n + ulLag < psWindow->usLength; n++)
+	{
+		fSum += WindowCoef(psWindow, n) * WindowCoef(psWindow, n + ulLag);
+	}
+	return(fSum);
+}
+
+//*****************************************************************************
+//
+// Look up the autocorrelation of the window at a given lag, working it out
+// only if it isn't already in the cache.
+//
+// param psWindow: the window that was applied to the frame
+// param ulLag: the lag, in samples
+//
+// return: sum over n of w(n) * w(n + ulLag)
+//
+//*****************************************************************************
+static float
+WindowAutoCorrCached(const tWindowTable *psWindow, unsigned long ulLag)
+{
+	unsigned long ulIdx;
+
+	if(psWindow != g_psCachedWindow)
+	{
+		for(ulIdx = 0; ulIdx < WINDOW_CACHE_SIZE; ulIdx++)
+		{
+			g_psWindowCache[ulIdx].ulLag = ~0UL;
+		}
+		g_psCachedWindow = psWindow;
+	}
+
+	for(ulIdx = 0; ulIdx < WINDOW_CACHE_SIZE; ulIdx++)
+	{
+		if(g_psWindowCache[ulIdx].ulLag == ulLag)
+		{
+			return(g_psWindowCache[ulIdx].fValue);
+		}
+	}
+
+	ulIdx = g_ulCacheNext;
+	g_ulCacheNext = (ulIdx + 1) % WINDOW_CACHE_SIZE;
+	g_psWindowCache[ulIdx].ulLag = ulLag;
+	g_psWindowCache[ulIdx].fValue = WindowAutoCorr(psWindow, ulLag);
+	return(g_psWindowCache[ulIdx].fValue);
+}
+
+//*****************************************************************************
+//
+// Estimate how much of the autocorrelation at a lag wrapped around the end of
+// the frame.
+//
+// The autocorrelation comes from an FFT as long as the frame, so it is
+// circular: lag k also takes in the tail of the frame against its head, which
+// is the correlation at lag N - k.  For a periodic signal that is the window's
+// autocorrelation at N - k times the signal's at (N - k) modulo the period.
+// That is a short lag, where hardly anything wraps, so the signal's
+// correlation there is read from the autocorrelation itself.
+//
+// param pfAutoCorr: the circular autocorrelation of the windowed frame
+// param ulLength: the length of the frame, in samples
+// param psWindow: the window that was applied to the frame
+// param ulLag: the lag, in samples
+// param fPeriod: the period, in samples
+//
+// return: the part of the correlation at ulLag that wrapped around
+//
+//*****************************************************************************
+static float
+WrapEstimate(const float *pfAutoCorr, unsigned long ulLength,
+			 const tWindowTable *psWindow, unsigned long ulLag, float fPeriod)
+{
+	unsigned long ulIdx;
+	float fPhase;
+
+	//
+	// The signal's correlation is symmetric about each multiple of the
+	// period, so fold the lag into the first half period
+	//
+	fPhase = fmodf((float)(ulLength - ulLag), fPeriod);
+	if(fPhase > (fPeriod / 2))
+	{
+		fPhase = fPeriod - fPhase;
+	}
+	ulIdx = (unsigned long)(fPhase + 0.5f);
+
+	return(WindowAutoCorrCached(psWindow, ulLength - ulLag) *
+		   pfAutoCorr[ulIdx] / WindowAutoCorrCached(psWindow, ulIdx));
+}
+
+//*****************************************************************************
+//
+// Get the signal's correlation at a lag, with the window's taper divided back
+// out and, once the period is known, the wrapped part taken out.
+//
+// param pfAutoCorr: the circular autocorrelation of the windowed frame
+// param ulLength: the length of the frame, in samples
+// param psWindow: the window that was applied to the frame
+// param ulLag: the lag, in samples
+// param fPeriod: the period, in samples, or 0 if it isn't known yet
+//
+// return: the corrected correlation
+//
+//*****************************************************************************
+static float
+LagLevel(const float *pfAutoCorr, unsigned long ulLength,
+		 const tWindowTable *psWindow, unsigned long ulLag, float fPeriod)
+{
+	float fLevel;
+
+	fLevel = pfAutoCorr[ulLag];
+	if(fPeriod > 0)
+	{
+		fLevel -= WrapEstimate(pfAutoCorr, ulLength, psWindow, ulLag,
+							   fPeriod);
+	}
+	return(fLevel / WindowAutoCorrCached(psWindow, ulLag));
+}
+
+//*****************************************************************************
+//
+// Find the peak of the corrected correlation nearest a lag, to a fraction of
+// a sample.
+//
+// The corrections can move the peak by a sample or so, so this climbs to the
+// corrected maximum, then fits a parabola through the three points around
+// it.
+//
+// param pfAutoCorr: the circular autocorrelation of the windowed frame
+// param ulLength: the length of the frame, in samples
+// param psWindow: the window that was applied to the frame
+// param pulLag: the lag to start from, which returns the lag of the peak
+// param ulMinLag, ulMaxLag: the range of lags the peak may be in
+// param fPeriod: the period, in samples, or 0 if it isn't known yet
+// param pfLevel: returns the corrected correlation at the peak
+//
+// return: the lag of the peak, in samples
+//
+//*****************************************************************************
+static float
+PeakFind(const float *pfAutoCorr, unsigned long ulLength,
+		 const tWindowTable *psWindow, unsigned long *pulLag,
+		 unsigned long ulMinLag, unsigned long ulMaxLag, float fPeriod,
+		 float *pfLevel)
+{
+	unsigned long ulLag;
+	float fPrev, fCenter, fNext, fDenom, fDelta;
+
+	ulLag = *pulLag;
+	fPrev = LagLevel(pfAutoCorr, ulLength, psWindow, ulLag - 1, fPeriod);
+	fCenter = LagLevel(pfAutoCorr, ulLength, psWindow, ulLag, fPeriod);
+	fNext = LagLevel(pfAutoCorr, ulLength, psWindow, ulLag + 1, fPeriod);
+	while((fNext > fCenter) && (ulLag + 1 < ulMaxLag))
+	{
+		ulLag++;
+		fPrev = fCenter;
+		fCenter = fNext;
+		fNext = LagLevel(pfAutoCorr, ulLength, psWindow, ulLag + 1, fPeriod);
+	}
+	while((fPrev > fCenter) && (ulLag - 1 > ulMinLag))
+	{
+		ulLag--;
+		fNext = fCenter;
+		fCenter = fPrev;
+		fPrev = LagLevel(pfAutoCorr, ulLength, psWindow, ulLag - 1, fPeriod);
+	}
+
+	fDelta = 0;
+	fDenom = fPrev - (2 * fCenter) + fNext;
+	if(fDenom < 0)
+	{
+		fDelta = 0.5f * (fPrev - fNext) / fDenom;
+	}
+
+	*pulLag = ulLag;
+	*pfLevel = fCenter;
+	return((float)ulLag + fDelta);
+}
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Find the fundamental frequency of a frame from its autocorrelation.
+//
+// The period is taken as the first lag past the main lobe around lag 0 whose
+// correlation is close to the strongest in the search range.  The correlation
+// around that lag is corrected for the window's own autocorrelation and for
+// what wrapped around the end of the frame, and a parabola through the three
+// points around the peak gives the period to a fraction of a sample.  The
+// period is then refined at multiples of itself.
+//
+// param pfAutoCorr: the circular autocorrelation of the windowed frame, at
+//		 least ulLength / 2 lags long
+// param ulLength: the length of the frame, in samples
+// param psWindow: the window that was applied to the frame
+// param fSampleRate: the sampling frequency, in Hz
+// param psResults: where to store the result
+//
+//*****************************************************************************
+void
+TunerProcess(const float *pfAutoCorr, unsigned long ulLength,
+			 const tWindowTable *psWindow, float fSampleRate,
+			 tTunerResults *psResults)
+{
+	unsigned long ulLag, ulStart, ulMinLag, ulMaxLag, ulPass, ulMultiple;
+	float fMax, fEnergy, fLevel, fPeriod, fNote;
+
+	psResults->ucValid = 0;
+
+	fEnergy = pfAutoCorr[0];
+	if(fEnergy <= 0)
+	{
+		return;
+	}
+
+	//
+	// Convert the frequency range we search into a range of lags
+	//
+	ulMinLag = (unsigned long)(fSampleRate / TUNER_MAX_FREQ);
+	if(ulMinLag < 2)
+	{
+		ulMinLag = 2;
+	}
+	ulMaxLag = (unsigned long)(fSampleRate / TUNER_MIN_FREQ);
+	if(ulMaxLag > (ulLength / 2) - 2)
+	{
+		ulMaxLag = (ulLength / 2) - 2;
+	}
+
+	//
+	// Skip past the main lobe around lag 0, which is always the strongest
+	// correlation but says nothing about the period.
+	//
+	for(ulLag = 1; (ulLag < ulMaxLag) && (pfAutoCorr[ulLag] > 0); ulLag++)
+	{
+	}
+	if(ulLag < ulMinLag)
+	{
+		ulLag = ulMinLag;
+	}
+	ulStart = ulLag;
+
+	//
+	// Find the strongest correlation in the rest of the search range
+	//
+	fMax = 0;
+	for(; ulLag <= ulMaxLag; ulLag++)
+	{
+		if(pfAutoCorr[ulLag] > fMax)
+		{
+			fMax = pfAutoCorr[ulLag];
+		}
+	}
+	if(fMax <= 0)
+	{
+		return;
+	}
+
+	//
+	// Take the first local maximum that comes close to it
+	//
+	fMax *= TUNER_PEAK_THRESHOLD;
+	for(ulLag = ulStart; ulLag < ulMaxLag; ulLag++)
+	{
+		if((pfAutoCorr[ulLag] >= fMax) &&
+		   (pfAutoCorr[ulLag] >= pfAutoCorr[ulLag - 1]) &&
+		   (pfAutoCorr[ulLag] >= pfAutoCorr[ulLag + 1]))
+		{
+			break;
+		}
+	}
+	if(ulLag >= ulMaxLag)
+	{
+		return;
+	}
+
+	//
+	// Find the peak with the window's taper divided out, then again with the
+	// wrapped part of the correlation taken out as well.  That is worked out
+	// from the period, so each pass starts from the period the last one found.
+	//
+	fEnergy /= WindowAutoCorrCached(psWindow, 0);
+	fPeriod = PeakFind(pfAutoCorr, ulLength, psWindow, &ulLag, ulStart,
+					   ulMaxLag, 0, &fLevel);
+	for(ulPass = 0; ulPass < WRAP_PASSES; ulPass++)
+	{
+		fPeriod = PeakFind(pfAutoCorr, ulLength, psWindow, &ulLag, ulStart,
+						   ulMaxLag, fPeriod, &fLevel);
+	}
+
+	psResults->fClarity = fLevel / fEnergy;
+	if(psResults->fClarity < TUNER_MIN_CLARITY)
+	{
+		return;
+	}
+
+	//
+	// Refine the period at twice its lag, then four times, and so on.  Each
+	// step only has to be close enough to climb to the right peak.  So little
+	// wraps around at these short lags that it is left in.
+	//
+	for(ulMultiple = 2; (ulMultiple * fPeriod) < REFINE_LAG; ulMultiple *= 2)
+	{
+		ulLag = (unsigned long)((ulMultiple * fPeriod) + 0.5f);
+		fPeriod = PeakFind(pfAutoCorr, ulLength, psWindow, &ulLag, ulLag - 2,
+						   ulLag + 2, 0, &fLevel) / ulMultiple;
+	}
+	psResults->fFrequency = fSampleRate / fPeriod;
+
+	//
+	// Find the nearest note and how far off of it we are
+	//
+	fNote = A4_NOTE + (SEMITONES_PER_LN *
+					   logf(psResults->fFrequency / A4_FREQ));
+	psResults->iNote = (int)(fNote + 0.5f);
+	psResults->iCents = (int)floorf(((fNote - psResults->iNote) * 100) + 0.5f);
+	psResults->ucValid = 1;
+}
+
+//*****************************************************************************
+//
+// Get the window frames have to be taken with for the tuner.
+//
+// param ulType: the selected window
+//
+// return: the selected window, or TUNER_FLAT_TOP_WINDOW in place of the flat
+//		   top
+//
+//*****************************************************************************
+unsigned long
+TunerWindowType(unsigned long ulType)
+{
+	return((ulType == WINDOW_FLAT_TOP) ? TUNER_FLAT_TOP_WINDOW : ulType);
+}
+
+//*****************************************************************************
+//
+// Get the printable name of a note, without its octave.
+//
+// param iNote: a MIDI note number
+//
+// return: the name of the note, such as "C#"
+//
+//*****************************************************************************
+const char *
+TunerNoteName(int iNote)
+{
+	return(g_ppcNoteNames[iNote % 12]);
+}
+
+//*****************************************************************************
+//
+// Get the octave number of a note in scientific pitch notation, where middle
+// C is C4.
+//
+// param iNote: a MIDI note number
+//
+// return: the octave the note is in
+//
+//*****************************************************************************
+int
+TunerNoteOctave(int iNote)
+{
+	return((iNote / 12) - 1);
+}
@@ -0,0 +1,123 @@
+//*****************************************************************************
+//
+// tuner.h - Predefines, public functions, and globals for the pitch detection
+// (tuner) mode.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __TUNER_H__
+#define __TUNER_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The range of fundamental frequencies, in Hz, the tuner will search.  This
+// covers everything from a bass guitar's low E to the top of a soprano's
+// range.
+//
+#define TUNER_MIN_FREQ			40
+#define TUNER_MAX_FREQ			2000
+
+//
+// How strongly the signal has to correlate with itself one period later,
+// relative to its energy, before the tuner reports a pitch.  Noise and chords
+// fall below this.
+//
+#define TUNER_MIN_CLARITY		0.5f
+
+//
+// A candidate period is accepted as the fundamental if its correlation is
+// within this fraction of the strongest candidate.  Taking the first such
+// candidate, rather than the strongest, keeps the tuner from locking on to a
+// multiple of the period and reading an octave low.
+//
+#define TUNER_PEAK_THRESHOLD	0.9f
+
+//
+// The window frames are taken with in tuner mode when the flat top is
+// selected.  The flat top's autocorrelation dies away too soon to follow the
+// lowest notes, and of the other windows the Kaiser follows them best.
+//
+#define TUNER_FLAT_TOP_WINDOW	WINDOW_KAISER
+
+//*****************************************************************************
+//
+// The result of running pitch detection on one frame.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// Non-zero if a pitch was found in the last frame.  The remaining fields
+	// are only meaningful when this is set.
+	//
+	unsigned char ucValid;
+
+	//
+	// The estimated fundamental frequency, in Hz.
+	//
+	float fFrequency;
+
+	//
+	// The normalized correlation at the detected period, between 0 and 1.
+	//
+	float fClarity;
+
+	//
+	// The nearest note, as a MIDI note number (69 is A4, 440 Hz).
+	//
+	int iNote;
+
+	//
+	// How far the fundamental is from the nearest note, in cents.
+	//
+	int iCents;
+}
+tTunerResults;
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+extern tTunerResults g_sTunerResults;
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern void TunerProcess(const float *pfAutoCorr, unsigned long ulLength,
+						 const tWindowTable *psWindow, float fSampleRate,
+						 tTunerResults *psResults);
+extern unsigned long TunerWindowType(unsigned long ulType);
+extern const char *TunerNoteName(int iNote);
+extern int TunerNoteOctave(int iNote);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __TUNER_H__
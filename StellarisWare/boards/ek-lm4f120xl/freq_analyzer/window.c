@@ -0,0 +1,104 @@
+//*****************************************************************************
+//
+// window.c - Lookup functions for the generated FFT window tables.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#include "window.h"
+
+//*****************************************************************************
+//
+// Printable names for each window type, indexed by WINDOW_*.
+//
+//*****************************************************************************
+static const char * const g_ppcWindowNames[NUM_WINDOWS] =
+{
+	"Hamming",
+	"Hann",
+	"Blackman-Harris",
+	"Flat top",
+	"Kaiser"
+};
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Find the generated table for a given window type and length.
+//
+// param ulType: one of the WINDOW_* types
+// param ulLength: the full length of the window, which must be one of the FFT
+//		 lengths listed in g_pusWindowSizes
+//
+// return: a pointer to the table, or 0 if no table was generated for that type
+//		   and length
+//
+//*****************************************************************************
+const tWindowTable *
+WindowTableGet(unsigned long ulType, unsigned long ulLength)
+{
+	unsigned long ulIdx;
+
+	if(ulType >= NUM_WINDOWS)
+	{
+		return(0);
+	}
+
+	for(ulIdx = 0; ulIdx < NUM_WINDOW_SIZES; ulIdx++)
+	{
+		if(g_pusWindowSizes[ulIdx] == ulLength)
+		{
+			return(&g_psWindowTables[ulType][ulIdx]);
+		}
+	}
+
+	return(0);
+}
+
+//*****************************************************************************
+//
+// Get a printable name for a window type.
+//
+// param ulType: one of the WINDOW_* types
+//
+// return: the name of the window, or "?" for an unknown type
+//
+//*****************************************************************************
+const char *
+WindowNameGet(unsigned long ulType)
+{
+	if(ulType >= NUM_WINDOWS)
+	{
+		return("?");
+	}
+
+	return(g_ppcWindowNames[ulType]);
+}
@@ -0,0 +1,121 @@
+//*****************************************************************************
+//
+// window.h - Predefines, public functions, and globals for the FFT window
+// subsystem.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __WINDOW_H__
+#define __WINDOW_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The available window types.  These index g_psWindowTables, so they must
+// stay in the same order as the WINDOWS list in tools/gen_window_tables.py.
+//
+#define WINDOW_HAMMING			0
+#define WINDOW_HANN				1
+#define WINDOW_BLACKMAN_HARRIS	2
+#define WINDOW_FLAT_TOP			3
+#define WINDOW_KAISER			4
+#define NUM_WINDOWS				5
+
+//
+// The number of window lengths generated for each window type, one for each
+// length supported by arm_rfft_f32 (128, 512, and 2048) and one for the zoom
+// FFT (256).
+//
+#define NUM_WINDOW_SIZES		4
+
+//
+// Window coefficients are stored as q15 unless WINDOW_TABLES_FLOAT is defined,
+// which doubles the flash used by the tables in exchange for skipping the
+// q15->float conversion in the conditioning loop.
+//
+#ifdef WINDOW_TABLES_FLOAT
+typedef float tWindowCoef;
+#define WINDOW_COEF_TO_FLOAT(c)	(c)
+#else
+typedef short tWindowCoef;
+#define WINDOW_COEF_TO_FLOAT(c)	((float)(c) * (1.0f / 32768.0f))
+#endif
+
+//*****************************************************************************
+//
+// Describes one generated window table.  Only the first usLength / 2
+// coefficients are stored, since w(n) == w(usLength - 1 - n).
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The full length of the window, in samples.
+	//
+	unsigned short usLength;
+
+	//
+	// The coherent gain of the window, sum(w) / N.  Dividing a bin magnitude
+	// by N/2 * coherent gain gives the amplitude of a sine centered on that
+	// bin.
+	//
+	float fCoherentGain;
+
+	//
+	// The equivalent noise bandwidth of the window, in bins.  Dividing the
+	// power summed over a band by the ENBW corrects for the noise the window
+	// lets leak into each bin.
+	//
+	float fENBW;
+
+	//
+	// The first half of the window coefficients.
+	//
+	const tWindowCoef *pCoefs;
+}
+tWindowTable;
+
+//*****************************************************************************
+//
+// global variables
+//
+//*****************************************************************************
+extern const unsigned short g_pusWindowSizes[NUM_WINDOW_SIZES];
+extern const tWindowTable g_psWindowTables[NUM_WINDOWS][NUM_WINDOW_SIZES];
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern const tWindowTable *WindowTableGet(unsigned long ulType,
+										  unsigned long ulLength);
+extern const char *WindowNameGet(unsigned long ulType);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __WINDOW_H__
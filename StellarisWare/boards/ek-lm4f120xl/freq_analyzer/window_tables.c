@@ -0,0 +1,2232 @@
+//*****************************************************************************
+//
+// window_tables.c - Half-length window coefficient tables.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// THIS FILE IS GENERATED BY tools/gen_window_tables.py.  DO NOT EDIT.
+//
+// Each table holds the first N/2 coefficients of a symmetric N point window,
+// w(n) = w(N-1-n).  Coherent gain is sum(w)/N and the equivalent noise
+// bandwidth is N*sum(w^2)/sum(w)^2, in bins.
+//
+//*****************************************************************************
+
+#include "window.h"
+
+#if NUM_WINDOW_SIZES != 4
+#error "window.h and window_tables.c disagree on the number of window sizes"
+#endif
+
+#ifndef WINDOW_TABLES_FLOAT
+
+static const short g_psWindow_hamming_128[64] =
+{
+      2621,   2640,   2695,   2787,   2916,   3080,   3281,   3516,   3787,   4091,
+      4429,   4799,   5201,   5633,   6095,   6585,   7102,   7646,   8214,   8805,
+      9418,  10051,  10703,  11371,  12056,  12754,  13464,  14185,  14914,  15650,
+     16391,  17136,  17881,  18626,  19369,  20108,  20841,  21566,  22282,  22986,
+     23678,  24354,  25015,  25658,  26281,  26883,  27463,  28019,  28549,  29053,
+     29529,  29976,  30393,  30780,  31134,  31455,  31742,  31995,  32213,  32396,
+     32543,  32653,  32727,  32763,
+};
+
+static const short g_psWindow_hamming_256[128] =
+{
+      2621,   2626,   2640,   2663,   2695,   2736,   2786,   2845,   2913,   2991,
+      3077,   3172,   3276,   3388,   3509,   3639,   3778,   3925,   4080,   4243,
+      4415,   4595,   4782,   4978,   5181,   5392,   5610,   5836,   6069,   6309,
+      6555,   6809,   7069,   7336,   7609,   7888,   8173,   8464,   8760,   9062,
+      9369,   9681,   9998,  10319,  10646,  10976,  11310,  11649,  11991,  12336,
+     12685,  13037,  13391,  13749,  14108,  14470,  14834,  15199,  15566,  15935,
+     16304,  16674,  17045,  17416,  17788,  18159,  18530,  18900,  19270,  19639,
+     20007,  20373,  20738,  21101,  21461,  21820,  22176,  22529,  22879,  23226,
+     23570,  23910,  24247,  24579,  24907,  25231,  25551,  25865,  26175,  26479,
+     26778,  27072,  27360,  27642,  27918,  28188,  28451,  28708,  28958,  29202,
+     29438,  29667,  29889,  30104,  30311,  30510,  30702,  30886,  31061,  31229,
+     31388,  31539,  31682,  31816,  31942,  32059,  32167,  32266,  32357,  32439,
+     32511,  32575,  32630,  32675,  32712,  32739,  32758,  32767,
+};
+
+static const short g_psWindow_hamming_512[256] =
+{
+      2621,   2623,   2626,   2632,   2640,   2650,   2662,   2677,   2694,   2714,
+      2735,   2759,   2785,   2814,   2844,   2877,   2912,   2950,   2989,   3031,
+      3075,   3121,   3170,   3220,   3273,   3328,   3385,   3444,   3506,   3570,
+      3635,   3703,   3773,   3845,   3920,   3996,   4074,   4155,   4237,   4322,
+      4408,   4497,   4587,   4680,   4774,   4871,   4969,   5069,   5171,   5275,
+      5381,   5489,   5599,   5710,   5824,   5939,   6056,   6174,   6295,   6417,
+      6541,   6666,   6793,   6922,   7053,   7185,   7318,   7454,   7590,   7729,
+      7868,   8010,   8152,   8297,   8442,   8589,   8738,   8887,   9039,   9191,
+      9345,   9499,   9656,   9813,   9972,  10131,  10292,  10454,  10617,  10782,
+     10947,  11113,  11280,  11448,  11618,  11788,  11959,  12130,  12303,  12477,
+     12651,  12826,  13002,  13178,  13355,  13533,  13711,  13891,  14070,  14250,
+     14431,  14612,  14794,  14976,  15158,  15341,  15525,  15708,  15892,  16076,
+     16261,  16445,  16630,  16815,  17000,  17185,  17370,  17556,  17741,  17926,
+     18112,  18297,  18482,  18667,  18852,  19037,  19221,  19405,  19589,  19773,
+     19957,  20140,  20322,  20505,  20686,  20868,  21049,  21229,  21409,  21589,
+     21767,  21945,  22123,  22300,  22476,  22651,  22826,  23000,  23173,  23345,
+     23516,  23687,  23857,  24025,  24193,  24360,  24525,  24690,  24854,  25016,
+     25178,  25338,  25497,  25655,  25812,  25968,  26122,  26275,  26427,  26577,
+     26726,  26874,  27020,  27165,  27309,  27451,  27591,  27730,  27868,  28004,
+     28138,  28271,  28402,  28532,  28660,  28786,  28911,  29034,  29155,  29275,
+     29392,  29508,  29623,  29735,  29846,  29954,  30061,  30166,  30269,  30371,
+     30470,  30567,  30663,  30756,  30848,  30937,  31025,  31110,  31194,  31275,
+     31355,  31432,  31507,  31580,  31651,  31720,  31787,  31852,  31914,  31975,
+     32033,  32089,  32143,  32195,  32244,  32292,  32337,  32380,  32420,  32459,
+     32495,  32529,  32561,  32590,  32618,  32643,  32665,  32686,  32704,  32720,
+     32734,  32745,  32754,  32761,  32765,  32767,
+};
+
+static const short g_psWindow_hamming_2048[1024] =
+{
+      2621,   2622,   2622,   2622,   2623,   2623,   2624,   2625,   2626,   2627,
+      2629,   2630,   2632,   2633,   2635,   2637,   2640,   2642,   2644,   2647,
+      2650,   2653,   2656,   2659,   2662,   2666,   2669,   2673,   2677,   2681,
+      2685,   2690,   2694,   2699,   2703,   2708,   2713,   2719,   2724,   2729,
+      2735,   2741,   2747,   2753,   2759,   2765,   2771,   2778,   2785,   2792,
+      2799,   2806,   2813,   2820,   2828,   2836,   2844,   2852,   2860,   2868,
+      2876,   2885,   2894,   2902,   2911,   2920,   2930,   2939,   2949,   2958,
+      2968,   2978,   2988,   2998,   3009,   3019,   3030,   3040,   3051,   3062,
+      3074,   3085,   3096,   3108,   3120,   3132,   3144,   3156,   3168,   3180,
+      3193,   3206,   3218,   3231,   3245,   3258,   3271,   3285,   3298,   3312,
+      3326,   3340,   3354,   3369,   3383,   3398,   3412,   3427,   3442,   3457,
+      3472,   3488,   3503,   3519,   3535,   3551,   3567,   3583,   3599,   3616,
+      3632,   3649,   3666,   3683,   3700,   3717,   3735,   3752,   3770,   3788,
+      3806,   3824,   3842,   3860,   3879,   3897,   3916,   3935,   3954,   3973,
+      3992,   4011,   4031,   4050,   4070,   4090,   4110,   4130,   4150,   4171,
+      4191,   4212,   4232,   4253,   4274,   4295,   4317,   4338,   4360,   4381,
+      4403,   4425,   4447,   4469,   4491,   4514,   4536,   4559,   4582,   4604,
+      4627,   4651,   4674,   4697,   4721,   4744,   4768,   4792,   4816,   4840,
+      4864,   4888,   4913,   4938,   4962,   4987,   5012,   5037,   5062,   5088,
+      5113,   5138,   5164,   5190,   5216,   5242,   5268,   5294,   5321,   5347,
+      5374,   5400,   5427,   5454,   5481,   5508,   5536,   5563,   5591,   5618,
+      5646,   5674,   5702,   5730,   5758,   5786,   5815,   5843,   5872,   5901,
+      5930,   5959,   5988,   6017,   6046,   6076,   6105,   6135,   6164,   6194,
+      6224,   6254,   6285,   6315,   6345,   6376,   6406,   6437,   6468,   6499,
+      6530,   6561,   6592,   6624,   6655,   6687,   6718,   6750,   6782,   6814,
+      6846,   6878,   6910,   6943,   6975,   7008,   7040,   7073,   7106,   7139,
+      7172,   7205,   7239,   7272,   7305,   7339,   7373,   7406,   7440,   7474,
+      7508,   7542,   7577,   7611,   7645,   7680,   7715,   7749,   7784,   7819,
+      7854,   7889,   7924,   7960,   7995,   8030,   8066,   8102,   8137,   8173,
+      8209,   8245,   8281,   8317,   8354,   8390,   8426,   8463,   8500,   8536,
+      8573,   8610,   8647,   8684,   8721,   8758,   8796,   8833,   8870,   8908,
+      8946,   8983,   9021,   9059,   9097,   9135,   9173,   9211,   9250,   9288,
+      9326,   9365,   9404,   9442,   9481,   9520,   9559,   9598,   9637,   9676,
+      9715,   9754,   9794,   9833,   9873,   9912,   9952,   9992,  10032,  10071,
+     10111,  10151,  10191,  10232,  10272,  10312,  10353,  10393,  10434,  10474,
+     10515,  10555,  10596,  10637,  10678,  10719,  10760,  10801,  10842,  10884,
+     10925,  10966,  11008,  11049,  11091,  11132,  11174,  11216,  11258,  11299,
+     11341,  11383,  11425,  11468,  11510,  11552,  11594,  11637,  11679,  11721,
+     11764,  11806,  11849,  11892,  11934,  11977,  12020,  12063,  12106,  12149,
+     12192,  12235,  12278,  12321,  12365,  12408,  12451,  12495,  12538,  12582,
+     12625,  12669,  12712,  12756,  12800,  12844,  12887,  12931,  12975,  13019,
+     13063,  13107,  13151,  13196,  13240,  13284,  13328,  13372,  13417,  13461,
+     13506,  13550,  13595,  13639,  13684,  13728,  13773,  13818,  13862,  13907,
+     13952,  13997,  14042,  14087,  14132,  14176,  14222,  14267,  14312,  14357,
+     14402,  14447,  14492,  14537,  14583,  14628,  14673,  14719,  14764,  14809,
+     14855,  14900,  14946,  14991,  15037,  15082,  15128,  15174,  15219,  15265,
+     15310,  15356,  15402,  15448,  15493,  15539,  15585,  15631,  15677,  15722,
+     15768,  15814,  15860,  15906,  15952,  15998,  16044,  16090,  16136,  16182,
+     16228,  16274,  16320,  16366,  16412,  16458,  16505,  16551,  16597,  16643,
+     16689,  16735,  16782,  16828,  16874,  16920,  16966,  17013,  17059,  17105,
+     17151,  17197,  17244,  17290,  17336,  17382,  17429,  17475,  17521,  17567,
+     17614,  17660,  17706,  17753,  17799,  17845,  17891,  17938,  17984,  18030,
+     18076,  18123,  18169,  18215,  18261,  18308,  18354,  18400,  18446,  18492,
+     18539,  18585,  18631,  18677,  18723,  18770,  18816,  18862,  18908,  18954,
+     19000,  19046,  19092,  19138,  19184,  19230,  19276,  19322,  19368,  19414,
+     19460,  19506,  19552,  19598,  19644,  19690,  19736,  19782,  19827,  19873,
+     19919,  19965,  20010,  20056,  20102,  20147,  20193,  20239,  20284,  20330,
+     20375,  20421,  20466,  20512,  20557,  20603,  20648,  20693,  20739,  20784,
+     20829,  20875,  20920,  20965,  21010,  21055,  21100,  21145,  21190,  21235,
+     21280,  21325,  21370,  21415,  21460,  21505,  21549,  21594,  21639,  21683,
+     21728,  21773,  21817,  21862,  21906,  21950,  21995,  22039,  22083,  22128,
+     22172,  22216,  22260,  22304,  22348,  22392,  22436,  22480,  22524,  22568,
+     22611,  22655,  22699,  22742,  22786,  22830,  22873,  22916,  22960,  23003,
+     23046,  23090,  23133,  23176,  23219,  23262,  23305,  23348,  23391,  23434,
+     23476,  23519,  23562,  23604,  23647,  23689,  23732,  23774,  23816,  23859,
+     23901,  23943,  23985,  24027,  24069,  24111,  24153,  24195,  24236,  24278,
+     24320,  24361,  24402,  24444,  24485,  24527,  24568,  24609,  24650,  24691,
+     24732,  24773,  24814,  24854,  24895,  24936,  24976,  25017,  25057,  25097,
+     25138,  25178,  25218,  25258,  25298,  25338,  25378,  25418,  25457,  25497,
+     25536,  25576,  25615,  25655,  25694,  25733,  25772,  25811,  25850,  25889,
+     25928,  25967,  26005,  26044,  26082,  26121,  26159,  26197,  26235,  26273,
+     26311,  26349,  26387,  26425,  26463,  26500,  26538,  26575,  26612,  26650,
+     26687,  26724,  26761,  26798,  26835,  26872,  26908,  26945,  26981,  27018,
+     27054,  27090,  27126,  27162,  27198,  27234,  27270,  27306,  27341,  27377,
+     27412,  27447,  27483,  27518,  27553,  27588,  27623,  27657,  27692,  27727,
+     27761,  27796,  27830,  27864,  27898,  27932,  27966,  28000,  28034,  28067,
+     28101,  28134,  28168,  28201,  28234,  28267,  28300,  28333,  28365,  28398,
+     28431,  28463,  28495,  28528,  28560,  28592,  28624,  28655,  28687,  28719,
+     28750,  28782,  28813,  28844,  28875,  28906,  28937,  28968,  28998,  29029,
+     29059,  29090,  29120,  29150,  29180,  29210,  29240,  29270,  29299,  29329,
+     29358,  29387,  29416,  29445,  29474,  29503,  29532,  29560,  29589,  29617,
+     29646,  29674,  29702,  29730,  29757,  29785,  29813,  29840,  29867,  29895,
+     29922,  29949,  29976,  30002,  30029,  30056,  30082,  30108,  30135,  30161,
+     30187,  30212,  30238,  30264,  30289,  30315,  30340,  30365,  30390,  30415,
+     30440,  30464,  30489,  30513,  30537,  30562,  30586,  30610,  30633,  30657,
+     30681,  30704,  30727,  30750,  30774,  30796,  30819,  30842,  30865,  30887,
+     30909,  30932,  30954,  30976,  30997,  31019,  31041,  31062,  31083,  31105,
+     31126,  31147,  31167,  31188,  31209,  31229,  31249,  31270,  31290,  31310,
+     31329,  31349,  31368,  31388,  31407,  31426,  31445,  31464,  31483,  31502,
+     31520,  31538,  31557,  31575,  31593,  31611,  31628,  31646,  31663,  31681,
+     31698,  31715,  31732,  31749,  31765,  31782,  31798,  31814,  31831,  31847,
+     31862,  31878,  31894,  31909,  31925,  31940,  31955,  31970,  31985,  31999,
+     32014,  32028,  32042,  32056,  32070,  32084,  32098,  32112,  32125,  32138,
+     32151,  32165,  32177,  32190,  32203,  32215,  32228,  32240,  32252,  32264,
+     32276,  32287,  32299,  32310,  32321,  32333,  32344,  32354,  32365,  32376,
+     32386,  32396,  32406,  32416,  32426,  32436,  32446,  32455,  32464,  32474,
+     32483,  32491,  32500,  32509,  32517,  32526,  32534,  32542,  32550,  32558,
+     32565,  32573,  32580,  32587,  32594,  32601,  32608,  32615,  32621,  32628,
+     32634,  32640,  32646,  32652,  32657,  32663,  32668,  32673,  32679,  32684,
+     32688,  32693,  32698,  32702,  32706,  32710,  32714,  32718,  32722,  32725,
+     32729,  32732,  32735,  32738,  32741,  32744,  32746,  32749,  32751,  32753,
+     32755,  32757,  32759,  32760,  32762,  32763,  32764,  32765,  32766,  32767,
+     32767,  32767,  32767,  32767,
+};
+
+static const short g_psWindow_hann_128[64] =
+{
+         0,     20,     80,    180,    320,    499,    717,    973,   1267,   1597,
+      1965,   2367,   2804,   3273,   3775,   4308,   4871,   5461,   6078,   6721,
+      7387,   8075,   8784,   9511,  10255,  11014,  11786,  12569,  13362,  14162,
+     14967,  15776,  16587,  17397,  18204,  19007,  19804,  20592,  21370,  22136,
+     22887,  23623,  24341,  25039,  25717,  26371,  27001,  27606,  28182,  28730,
+     29247,  29734,  30187,  30607,  30991,  31341,  31653,  31928,  32165,  32364,
+     32523,  32643,  32723,  32763,
+};
+
+static const short g_psWindow_hann_256[128] =
+{
+         0,      5,     20,     45,     80,    124,    179,    243,    317,    401,
+       495,    598,    711,    833,    965,   1106,   1257,   1416,   1585,   1763,
+      1949,   2145,   2349,   2561,   2782,   3011,   3249,   3494,   3747,   4008,
+      4276,   4552,   4834,   5124,   5421,   5724,   6034,   6350,   6672,   7000,
+      7334,   7673,   8018,   8367,   8722,   9081,   9445,   9812,  10184,  10560,
+     10939,  11321,  11707,  12095,  12486,  12879,  13274,  13672,  14070,  14471,
+     14872,  15275,  15678,  16081,  16485,  16889,  17292,  17695,  18097,  18498,
+     18897,  19295,  19692,  20086,  20478,  20868,  21255,  21639,  22019,  22397,
+     22770,  23140,  23506,  23867,  24224,  24576,  24923,  25265,  25602,  25932,
+     26258,  26577,  26890,  27196,  27496,  27789,  28076,  28355,  28627,  28892,
+     29148,  29398,  29639,  29872,  30097,  30314,  30522,  30722,  30913,  31095,
+     31268,  31432,  31588,  31733,  31870,  31997,  32115,  32223,  32321,  32410,
+     32489,  32558,  32618,  32667,  32707,  32737,  32757,  32767,
+};
+
+static const short g_psWindow_hann_512[256] =
+{
+         0,      1,      5,     11,     20,     31,     45,     61,     79,    100,
+       124,    150,    178,    209,    242,    278,    316,    357,    400,    445,
+       493,    543,    596,    651,    708,    768,    830,    895,    961,   1031,
+      1102,   1176,   1252,   1330,   1411,   1494,   1579,   1667,   1756,   1848,
+      1942,   2038,   2137,   2237,   2340,   2445,   2552,   2661,   2772,   2885,
+      3000,   3117,   3236,   3358,   3481,   3606,   3733,   3862,   3993,   4126,
+      4260,   4397,   4535,   4675,   4817,   4960,   5105,   5252,   5401,   5551,
+      5703,   5857,   6012,   6169,   6327,   6487,   6648,   6811,   6975,   7141,
+      7308,   7476,   7646,   7817,   7989,   8163,   8338,   8514,   8691,   8870,
+      9049,   9230,   9412,   9595,   9778,   9963,  10149,  10336,  10523,  10712,
+     10901,  11092,  11283,  11475,  11667,  11860,  12054,  12249,  12444,  12640,
+     12836,  13033,  13231,  13429,  13627,  13826,  14025,  14225,  14425,  14625,
+     14825,  15026,  15227,  15428,  15629,  15830,  16031,  16233,  16434,  16636,
+     16837,  17039,  17240,  17441,  17642,  17843,  18043,  18243,  18443,  18643,
+     18843,  19041,  19240,  19438,  19636,  19833,  20030,  20226,  20421,  20616,
+     20811,  21004,  21197,  21389,  21581,  21772,  21961,  22150,  22338,  22526,
+     22712,  22897,  23082,  23265,  23447,  23629,  23809,  23988,  24166,  24342,
+     24518,  24692,  24865,  25037,  25207,  25376,  25544,  25710,  25875,  26039,
+     26201,  26361,  26520,  26678,  26834,  26988,  27141,  27292,  27442,  27589,
+     27735,  27880,  28023,  28163,  28303,  28440,  28575,  28709,  28841,  28971,
+     29099,  29225,  29349,  29471,  29591,  29710,  29826,  29940,  30052,  30162,
+     30270,  30376,  30480,  30581,  30681,  30778,  30873,  30966,  31057,  31145,
+     31232,  31316,  31398,  31477,  31554,  31629,  31702,  31772,  31840,  31906,
+     31969,  32030,  32089,  32145,  32199,  32250,  32299,  32346,  32390,  32432,
+     32471,  32508,  32543,  32575,  32604,  32632,  32656,  32679,  32698,  32716,
+     32731,  32743,  32753,  32760,  32765,  32767,
+};
+
+static const short g_psWindow_hann_2048[1024] =
+{
+         0,      0,      0,      1,      1,      2,      3,      4,      5,      6,
+         8,      9,     11,     13,     15,     17,     20,     22,     25,     28,
+        31,     34,     37,     41,     44,     48,     52,     56,     60,     65,
+        69,     74,     79,     84,     89,     94,    100,    106,    111,    117,
+       123,    130,    136,    143,    149,    156,    163,    170,    178,    185,
+       193,    200,    208,    216,    225,    233,    241,    250,    259,    268,
+       277,    286,    296,    305,    315,    325,    335,    345,    356,    366,
+       377,    388,    398,    410,    421,    432,    444,    455,    467,    479,
+       491,    504,    516,    529,    542,    554,    568,    581,    594,    608,
+       621,    635,    649,    663,    677,    692,    706,    721,    736,    751,
+       766,    781,    796,    812,    828,    844,    860,    876,    892,    908,
+       925,    942,    959,    976,    993,   1010,   1028,   1045,   1063,   1081,
+      1099,   1117,   1135,   1154,   1172,   1191,   1210,   1229,   1248,   1268,
+      1287,   1307,   1327,   1346,   1366,   1387,   1407,   1427,   1448,   1469,
+      1490,   1511,   1532,   1553,   1575,   1596,   1618,   1640,   1662,   1684,
+      1706,   1729,   1751,   1774,   1797,   1820,   1843,   1866,   1889,   1913,
+      1936,   1960,   1984,   2008,   2032,   2057,   2081,   2106,   2131,   2155,
+      2180,   2206,   2231,   2256,   2282,   2307,   2333,   2359,   2385,   2411,
+      2438,   2464,   2491,   2517,   2544,   2571,   2598,   2626,   2653,   2681,
+      2708,   2736,   2764,   2792,   2820,   2848,   2877,   2905,   2934,   2963,
+      2992,   3021,   3050,   3079,   3108,   3138,   3168,   3197,   3227,   3257,
+      3287,   3318,   3348,   3379,   3409,   3440,   3471,   3502,   3533,   3564,
+      3596,   3627,   3659,   3691,   3722,   3754,   3787,   3819,   3851,   3884,
+      3916,   3949,   3982,   4015,   4048,   4081,   4114,   4147,   4181,   4214,
+      4248,   4282,   4316,   4350,   4384,   4419,   4453,   4488,   4522,   4557,
+      4592,   4627,   4662,   4697,   4732,   4768,   4803,   4839,   4875,   4910,
+      4946,   4982,   5019,   5055,   5091,   5128,   5164,   5201,   5238,   5275,
+      5312,   5349,   5386,   5423,   5461,   5498,   5536,   5574,   5612,   5650,
+      5688,   5726,   5764,   5802,   5841,   5879,   5918,   5957,   5996,   6035,
+      6074,   6113,   6152,   6191,   6231,   6270,   6310,   6349,   6389,   6429,
+      6469,   6509,   6549,   6590,   6630,   6671,   6711,   6752,   6792,   6833,
+      6874,   6915,   6956,   6997,   7039,   7080,   7121,   7163,   7205,   7246,
+      7288,   7330,   7372,   7414,   7456,   7498,   7541,   7583,   7625,   7668,
+      7711,   7753,   7796,   7839,   7882,   7925,   7968,   8011,   8054,   8098,
+      8141,   8185,   8228,   8272,   8316,   8360,   8403,   8447,   8491,   8535,
+      8580,   8624,   8668,   8713,   8757,   8802,   8846,   8891,   8936,   8981,
+      9025,   9070,   9115,   9161,   9206,   9251,   9296,   9342,   9387,   9433,
+      9478,   9524,   9570,   9615,   9661,   9707,   9753,   9799,   9845,   9891,
+      9937,   9984,  10030,  10076,  10123,  10169,  10216,  10263,  10309,  10356,
+     10403,  10450,  10496,  10543,  10590,  10638,  10685,  10732,  10779,  10826,
+     10874,  10921,  10968,  11016,  11063,  11111,  11159,  11206,  11254,  11302,
+     11350,  11398,  11446,  11494,  11542,  11590,  11638,  11686,  11734,  11782,
+     11831,  11879,  11927,  11976,  12024,  12073,  12121,  12170,  12218,  12267,
+     12316,  12365,  12413,  12462,  12511,  12560,  12609,  12658,  12707,  12756,
+     12805,  12854,  12903,  12952,  13001,  13051,  13100,  13149,  13198,  13248,
+     13297,  13347,  13396,  13445,  13495,  13544,  13594,  13644,  13693,  13743,
+     13792,  13842,  13892,  13941,  13991,  14041,  14091,  14141,  14190,  14240,
+     14290,  14340,  14390,  14440,  14490,  14540,  14590,  14640,  14690,  14740,
+     14790,  14840,  14890,  14940,  14990,  15040,  15090,  15141,  15191,  15241,
+     15291,  15341,  15391,  15442,  15492,  15542,  15592,  15642,  15693,  15743,
+     15793,  15843,  15894,  15944,  15994,  16045,  16095,  16145,  16195,  16246,
+     16296,  16346,  16397,  16447,  16497,  16547,  16598,  16648,  16698,  16749,
+     16799,  16849,  16899,  16950,  17000,  17050,  17100,  17151,  17201,  17251,
+     17301,  17352,  17402,  17452,  17502,  17552,  17602,  17653,  17703,  17753,
+     17803,  17853,  17903,  17953,  18003,  18053,  18103,  18153,  18203,  18253,
+     18303,  18353,  18403,  18453,  18503,  18553,  18602,  18652,  18702,  18752,
+     18802,  18851,  18901,  18951,  19000,  19050,  19100,  19149,  19199,  19248,
+     19298,  19347,  19397,  19446,  19496,  19545,  19594,  19644,  19693,  19742,
+     19791,  19840,  19890,  19939,  19988,  20037,  20086,  20135,  20184,  20233,
+     20281,  20330,  20379,  20428,  20477,  20525,  20574,  20622,  20671,  20720,
+     20768,  20816,  20865,  20913,  20962,  21010,  21058,  21106,  21154,  21202,
+     21250,  21298,  21346,  21394,  21442,  21490,  21538,  21585,  21633,  21681,
+     21728,  21776,  21823,  21871,  21918,  21965,  22013,  22060,  22107,  22154,
+     22201,  22248,  22295,  22342,  22389,  22435,  22482,  22529,  22575,  22622,
+     22668,  22715,  22761,  22807,  22854,  22900,  22946,  22992,  23038,  23084,
+     23130,  23176,  23221,  23267,  23313,  23358,  23404,  23449,  23494,  23540,
+     23585,  23630,  23675,  23720,  23765,  23810,  23855,  23899,  23944,  23989,
+     24033,  24078,  24122,  24166,  24210,  24255,  24299,  24343,  24387,  24430,
+     24474,  24518,  24561,  24605,  24648,  24692,  24735,  24778,  24822,  24865,
+     24908,  24951,  24993,  25036,  25079,  25121,  25164,  25206,  25249,  25291,
+     25333,  25375,  25417,  25459,  25501,  25543,  25584,  25626,  25667,  25709,
+     25750,  25791,  25832,  25873,  25914,  25955,  25996,  26037,  26077,  26118,
+     26158,  26198,  26239,  26279,  26319,  26359,  26399,  26438,  26478,  26518,
+     26557,  26596,  26636,  26675,  26714,  26753,  26792,  26831,  26869,  26908,
+     26946,  26985,  27023,  27061,  27099,  27137,  27175,  27213,  27251,  27288,
+     27326,  27363,  27400,  27438,  27475,  27512,  27549,  27585,  27622,  27659,
+     27695,  27731,  27767,  27804,  27840,  27876,  27911,  27947,  27983,  28018,
+     28053,  28089,  28124,  28159,  28194,  28229,  28263,  28298,  28332,  28367,
+     28401,  28435,  28469,  28503,  28537,  28570,  28604,  28637,  28671,  28704,
+     28737,  28770,  28803,  28836,  28868,  28901,  28933,  28965,  28998,  29030,
+     29061,  29093,  29125,  29156,  29188,  29219,  29250,  29282,  29312,  29343,
+     29374,  29405,  29435,  29465,  29496,  29526,  29556,  29586,  29615,  29645,
+     29674,  29704,  29733,  29762,  29791,  29820,  29849,  29877,  29906,  29934,
+     29962,  29990,  30018,  30046,  30074,  30101,  30129,  30156,  30183,  30210,
+     30237,  30264,  30291,  30317,  30343,  30370,  30396,  30422,  30448,  30473,
+     30499,  30525,  30550,  30575,  30600,  30625,  30650,  30675,  30699,  30723,
+     30748,  30772,  30796,  30820,  30843,  30867,  30890,  30914,  30937,  30960,
+     30983,  31006,  31028,  31051,  31073,  31095,  31117,  31139,  31161,  31183,
+     31204,  31226,  31247,  31268,  31289,  31310,  31330,  31351,  31371,  31391,
+     31412,  31432,  31451,  31471,  31491,  31510,  31529,  31548,  31567,  31586,
+     31605,  31623,  31642,  31660,  31678,  31696,  31714,  31732,  31749,  31767,
+     31784,  31801,  31818,  31835,  31851,  31868,  31884,  31900,  31916,  31932,
+     31948,  31964,  31979,  31995,  32010,  32025,  32040,  32055,  32069,  32084,
+     32098,  32112,  32126,  32140,  32154,  32167,  32181,  32194,  32207,  32220,
+     32233,  32245,  32258,  32270,  32283,  32295,  32307,  32318,  32330,  32341,
+     32353,  32364,  32375,  32386,  32397,  32407,  32418,  32428,  32438,  32448,
+     32458,  32467,  32477,  32486,  32496,  32505,  32513,  32522,  32531,  32539,
+     32548,  32556,  32564,  32572,  32579,  32587,  32594,  32601,  32608,  32615,
+     32622,  32629,  32635,  32642,  32648,  32654,  32660,  32665,  32671,  32676,
+     32681,  32687,  32691,  32696,  32701,  32705,  32710,  32714,  32718,  32722,
+     32725,  32729,  32732,  32736,  32739,  32742,  32744,  32747,  32749,  32752,
+     32754,  32756,  32758,  32759,  32761,  32762,  32764,  32765,  32766,  32766,
+     32767,  32767,  32767,  32767,
+};
+
+static const short g_psWindow_blackman_harris_128[64] =
+{
+         2,      3,      7,     13,     22,     35,     52,     74,    102,    138,
+       183,    238,    305,    386,    482,    596,    730,    886,   1066,   1273,
+      1509,   1776,   2076,   2412,   2786,   3199,   3653,   4150,   4692,   5278,
+      5910,   6588,   7311,   8080,   8892,   9747,  10643,  11577,  12546,  13547,
+     14576,  15628,  16698,  17782,  18874,  19967,  21056,  22134,  23194,  24230,
+     25235,  26202,  27125,  27997,  28813,  29565,  30248,  30858,  31390,  31839,
+     32203,  32479,  32664,  32756,
+};
+
+static const short g_psWindow_blackman_harris_256[128] =
+{
+         2,      2,      3,      5,      7,      9,     13,     17,     22,     27,
+        34,     42,     51,     61,     73,     86,    101,    118,    137,    158,
+       181,    207,    235,    267,    301,    339,    381,    427,    476,    530,
+       589,    652,    721,    795,    875,    961,   1053,   1151,   1257,   1369,
+      1489,   1617,   1752,   1896,   2049,   2210,   2380,   2560,   2749,   2948,
+      3156,   3375,   3605,   3845,   4096,   4357,   4630,   4914,   5209,   5516,
+      5833,   6162,   6503,   6855,   7218,   7592,   7978,   8374,   8781,   9199,
+      9628,  10066,  10514,  10972,  11439,  11915,  12400,  12892,  13392,  13899,
+     14413,  14932,  15457,  15987,  16521,  17058,  17599,  18141,  18685,  19229,
+     19774,  20318,  20860,  21400,  21936,  22468,  22996,  23518,  24033,  24541,
+     25041,  25532,  26012,  26482,  26941,  27387,  27821,  28240,  28645,  29034,
+     29408,  29765,  30104,  30426,  30728,  31012,  31276,  31520,  31743,  31945,
+     32126,  32284,  32421,  32535,  32627,  32696,  32742,  32765,
+};
+
+static const short g_psWindow_blackman_harris_512[256] =
+{
+         2,      2,      2,      3,      3,      4,      5,      5,      7,      8,
+         9,     11,     13,     15,     17,     19,     22,     24,     27,     31,
+        34,     38,     42,     46,     51,     56,     61,     67,     73,     79,
+        86,     93,    101,    109,    117,    126,    136,    146,    157,    168,
+       180,    192,    206,    219,    234,    249,    265,    282,    300,    318,
+       338,    358,    379,    401,    424,    448,    474,    500,    527,    556,
+       585,    616,    648,    682,    717,    753,    790,    829,    869,    911,
+       955,   1000,   1046,   1094,   1144,   1195,   1249,   1304,   1360,   1419,
+      1480,   1542,   1606,   1673,   1741,   1811,   1884,   1959,   2035,   2114,
+      2195,   2279,   2364,   2452,   2543,   2635,   2731,   2828,   2928,   3031,
+      3136,   3243,   3353,   3466,   3581,   3699,   3820,   3943,   4069,   4197,
+      4329,   4463,   4600,   4739,   4882,   5027,   5175,   5326,   5480,   5636,
+      5795,   5958,   6123,   6290,   6461,   6634,   6811,   6990,   7172,   7357,
+      7544,   7734,   7927,   8123,   8322,   8523,   8727,   8933,   9142,   9354,
+      9568,   9785,  10005,  10226,  10451,  10677,  10906,  11138,  11371,  11607,
+     11845,  12085,  12327,  12571,  12817,  13065,  13315,  13567,  13820,  14075,
+     14332,  14590,  14849,  15110,  15372,  15636,  15900,  16166,  16433,  16700,
+     16969,  17238,  17507,  17778,  18049,  18320,  18591,  18863,  19135,  19406,
+     19678,  19950,  20221,  20492,  20762,  21032,  21302,  21570,  21838,  22104,
+     22370,  22634,  22897,  23159,  23419,  23678,  23935,  24190,  24443,  24695,
+     24944,  25191,  25435,  25677,  25917,  26154,  26389,  26620,  26849,  27074,
+     27297,  27516,  27732,  27944,  28154,  28359,  28561,  28759,  28953,  29143,
+     29329,  29511,  29689,  29862,  30031,  30196,  30356,  30512,  30662,  30809,
+     30950,  31086,  31218,  31344,  31466,  31582,  31693,  31799,  31900,  31995,
+     32085,  32170,  32249,  32322,  32390,  32453,  32510,  32561,  32607,  32647,
+     32681,  32710,  32733,  32750,  32762,  32767,
+};
+
+static const short g_psWindow_blackman_harris_2048[1024] =
+{
+         2,      2,      2,      2,      2,      2,      2,      2,      2,      2,
+         2,      2,      3,      3,      3,      3,      3,      3,      3,      4,
+         4,      4,      4,      4,      5,      5,      5,      5,      5,      6,
+         6,      6,      7,      7,      7,      7,      8,      8,      8,      9,
+         9,     10,     10,     10,     11,     11,     12,     12,     13,     13,
+        14,     14,     15,     15,     16,     16,     17,     17,     18,     18,
+        19,     20,     20,     21,     22,     22,     23,     24,     24,     25,
+        26,     27,     27,     28,     29,     30,     31,     31,     32,     33,
+        34,     35,     36,     37,     38,     39,     40,     41,     42,     43,
+        44,     45,     46,     47,     48,     50,     51,     52,     53,     54,
+        56,     57,     58,     60,     61,     62,     64,     65,     67,     68,
+        69,     71,     72,     74,     76,     77,     79,     80,     82,     84,
+        86,     87,     89,     91,     93,     95,     97,     98,    100,    102,
+       104,    106,    108,    111,    113,    115,    117,    119,    121,    124,
+       126,    128,    131,    133,    136,    138,    140,    143,    146,    148,
+       151,    154,    156,    159,    162,    165,    167,    170,    173,    176,
+       179,    182,    185,    189,    192,    195,    198,    201,    205,    208,
+       212,    215,    219,    222,    226,    229,    233,    237,    241,    244,
+       248,    252,    256,    260,    264,    268,    272,    277,    281,    285,
+       290,    294,    298,    303,    308,    312,    317,    322,    326,    331,
+       336,    341,    346,    351,    356,    361,    367,    372,    377,    383,
+       388,    394,    399,    405,    411,    416,    422,    428,    434,    440,
+       446,    453,    459,    465,    471,    478,    484,    491,    498,    504,
+       511,    518,    525,    532,    539,    546,    553,    560,    568,    575,
+       583,    590,    598,    606,    613,    621,    629,    637,    645,    654,
+       662,    670,    679,    687,    696,    705,    713,    722,    731,    740,
+       749,    758,    768,    777,    787,    796,    806,    815,    825,    835,
+       845,    855,    865,    876,    886,    896,    907,    918,    928,    939,
+       950,    961,    972,    983,    995,   1006,   1018,   1029,   1041,   1053,
+      1065,   1077,   1089,   1101,   1114,   1126,   1138,   1151,   1164,   1177,
+      1190,   1203,   1216,   1229,   1243,   1256,   1270,   1284,   1297,   1311,
+      1325,   1340,   1354,   1368,   1383,   1397,   1412,   1427,   1442,   1457,
+      1472,   1488,   1503,   1519,   1534,   1550,   1566,   1582,   1599,   1615,
+      1631,   1648,   1665,   1681,   1698,   1715,   1733,   1750,   1767,   1785,
+      1803,   1820,   1838,   1856,   1875,   1893,   1912,   1930,   1949,   1968,
+      1987,   2006,   2025,   2045,   2064,   2084,   2104,   2124,   2144,   2164,
+      2185,   2205,   2226,   2247,   2268,   2289,   2310,   2331,   2353,   2374,
+      2396,   2418,   2440,   2463,   2485,   2507,   2530,   2553,   2576,   2599,
+      2622,   2646,   2669,   2693,   2717,   2741,   2765,   2790,   2814,   2839,
+      2864,   2888,   2914,   2939,   2964,   2990,   3016,   3041,   3067,   3094,
+      3120,   3147,   3173,   3200,   3227,   3254,   3281,   3309,   3337,   3364,
+      3392,   3420,   3449,   3477,   3506,   3534,   3563,   3592,   3622,   3651,
+      3681,   3710,   3740,   3770,   3801,   3831,   3862,   3892,   3923,   3954,
+      3986,   4017,   4049,   4080,   4112,   4144,   4177,   4209,   4242,   4274,
+      4307,   4341,   4374,   4407,   4441,   4475,   4509,   4543,   4577,   4612,
+      4646,   4681,   4716,   4751,   4787,   4822,   4858,   4894,   4930,   4966,
+      5002,   5039,   5076,   5113,   5150,   5187,   5224,   5262,   5300,   5338,
+      5376,   5414,   5453,   5491,   5530,   5569,   5609,   5648,   5688,   5727,
+      5767,   5807,   5848,   5888,   5929,   5969,   6010,   6052,   6093,   6134,
+      6176,   6218,   6260,   6302,   6344,   6387,   6430,   6473,   6516,   6559,
+      6602,   6646,   6690,   6734,   6778,   6822,   6867,   6911,   6956,   7001,
+      7047,   7092,   7137,   7183,   7229,   7275,   7321,   7368,   7414,   7461,
+      7508,   7555,   7602,   7650,   7698,   7745,   7793,   7841,   7890,   7938,
+      7987,   8036,   8085,   8134,   8183,   8233,   8282,   8332,   8382,   8432,
+      8483,   8533,   8584,   8635,   8686,   8737,   8788,   8840,   8891,   8943,
+      8995,   9047,   9100,   9152,   9205,   9258,   9311,   9364,   9417,   9471,
+      9524,   9578,   9632,   9686,   9740,   9795,   9849,   9904,   9959,  10014,
+     10069,  10124,  10180,  10235,  10291,  10347,  10403,  10459,  10516,  10572,
+     10629,  10686,  10743,  10800,  10857,  10914,  10972,  11030,  11088,  11146,
+     11204,  11262,  11320,  11379,  11438,  11496,  11555,  11614,  11674,  11733,
+     11792,  11852,  11912,  11972,  12032,  12092,  12152,  12213,  12273,  12334,
+     12394,  12455,  12516,  12578,  12639,  12700,  12762,  12823,  12885,  12947,
+     13009,  13071,  13133,  13196,  13258,  13321,  13383,  13446,  13509,  13572,
+     13635,  13698,  13761,  13825,  13888,  13952,  14016,  14079,  14143,  14207,
+     14271,  14336,  14400,  14464,  14529,  14593,  14658,  14723,  14788,  14853,
+     14918,  14983,  15048,  15113,  15178,  15244,  15309,  15375,  15441,  15506,
+     15572,  15638,  15704,  15770,  15836,  15902,  15968,  16035,  16101,  16167,
+     16234,  16300,  16367,  16434,  16500,  16567,  16634,  16701,  16768,  16835,
+     16902,  16969,  17036,  17103,  17170,  17237,  17305,  17372,  17439,  17507,
+     17574,  17642,  17709,  17777,  17844,  17912,  17979,  18047,  18115,  18182,
+     18250,  18318,  18386,  18453,  18521,  18589,  18657,  18725,  18792,  18860,
+     18928,  18996,  19064,  19132,  19199,  19267,  19335,  19403,  19471,  19539,
+     19607,  19674,  19742,  19810,  19878,  19945,  20013,  20081,  20149,  20216,
+     20284,  20352,  20419,  20487,  20555,  20622,  20690,  20757,  20824,  20892,
+     20959,  21027,  21094,  21161,  21228,  21295,  21362,  21430,  21497,  21563,
+     21630,  21697,  21764,  21831,  21897,  21964,  22031,  22097,  22163,  22230,
+     22296,  22362,  22428,  22494,  22560,  22626,  22692,  22758,  22823,  22889,
+     22954,  23020,  23085,  23150,  23215,  23281,  23345,  23410,  23475,  23540,
+     23604,  23669,  23733,  23797,  23861,  23925,  23989,  24053,  24117,  24180,
+     24244,  24307,  24370,  24433,  24496,  24559,  24622,  24684,  24746,  24809,
+     24871,  24933,  24995,  25057,  25118,  25180,  25241,  25302,  25363,  25424,
+     25485,  25545,  25606,  25666,  25726,  25786,  25846,  25905,  25965,  26024,
+     26083,  26142,  26201,  26260,  26318,  26376,  26435,  26492,  26550,  26608,
+     26665,  26722,  26779,  26836,  26893,  26949,  27006,  27062,  27117,  27173,
+     27229,  27284,  27339,  27394,  27449,  27503,  27557,  27611,  27665,  27719,
+     27772,  27826,  27879,  27931,  27984,  28036,  28088,  28140,  28192,  28243,
+     28295,  28346,  28396,  28447,  28497,  28547,  28597,  28647,  28696,  28745,
+     28794,  28843,  28891,  28939,  28987,  29035,  29082,  29129,  29176,  29223,
+     29269,  29316,  29361,  29407,  29452,  29498,  29542,  29587,  29631,  29675,
+     29719,  29763,  29806,  29849,  29892,  29934,  29976,  30018,  30060,  30101,
+     30142,  30183,  30223,  30264,  30304,  30343,  30383,  30422,  30460,  30499,
+     30537,  30575,  30613,  30650,  30687,  30724,  30760,  30796,  30832,  30868,
+     30903,  30938,  30972,  31007,  31041,  31074,  31108,  31141,  31174,  31206,
+     31238,  31270,  31302,  31333,  31364,  31394,  31425,  31455,  31484,  31514,
+     31543,  31571,  31600,  31628,  31655,  31683,  31710,  31737,  31763,  31789,
+     31815,  31840,  31865,  31890,  31915,  31939,  31962,  31986,  32009,  32032,
+     32054,  32076,  32098,  32119,  32140,  32161,  32182,  32202,  32221,  32241,
+     32260,  32278,  32297,  32315,  32332,  32350,  32367,  32383,  32400,  32416,
+     32431,  32446,  32461,  32476,  32490,  32504,  32517,  32531,  32543,  32556,
+     32568,  32580,  32591,  32602,  32613,  32623,  32633,  32643,  32652,  32661,
+     32669,  32678,  32685,  32693,  32700,  32707,  32713,  32719,  32725,  32730,
+     32735,  32740,  32744,  32748,  32752,  32755,  32758,  32760,  32763,  32764,
+     32766,  32767,  32767,  32767,
+};
+
+static const short g_psWindow_flat_top_128[64] =
+{
+       -14,    -16,    -22,    -33,    -49,    -70,    -98,   -133,   -176,   -227,
+      -289,   -362,   -445,   -541,   -648,   -767,   -897,  -1037,  -1185,  -1340,
+     -1497,  -1654,  -1806,  -1949,  -2077,  -2184,  -2262,  -2306,  -2307,  -2257,
+     -2148,  -1973,  -1724,  -1393,   -973,   -458,    156,    874,   1699,   2631,
+      3670,   4814,   6059,   7398,   8825,  10328,  11898,  13520,  15179,  16861,
+     18546,  20218,  21858,  23446,  24964,  26392,  27713,  28911,  29968,  30872,
+     31611,  32173,  32553,  32744,
+};
+
+static const short g_psWindow_flat_top_256[128] =
+{
+       -14,    -14,    -16,    -18,    -22,    -27,    -33,    -40,    -48,    -58,
+       -70,    -83,    -97,   -113,   -132,   -152,   -174,   -199,   -225,   -255,
+      -287,   -321,   -358,   -398,   -441,   -487,   -536,   -588,   -642,   -700,
+      -760,   -823,   -889,   -957,  -1028,  -1100,  -1175,  -1251,  -1328,  -1406,
+     -1485,  -1563,  -1641,  -1718,  -1793,  -1867,  -1937,  -2003,  -2066,  -2123,
+     -2174,  -2219,  -2256,  -2284,  -2303,  -2312,  -2309,  -2294,  -2265,  -2223,
+     -2164,  -2090,  -1998,  -1889,  -1760,  -1610,  -1440,  -1248,  -1034,   -796,
+      -535,   -248,     63,    400,    764,   1153,   1569,   2012,   2481,   2978,
+      3500,   4049,   4623,   5223,   5847,   6495,   7166,   7859,   8573,   9306,
+     10058,  10826,  11610,  12408,  13217,  14037,  14865,  15699,  16537,  17377,
+     18216,  19054,  19886,  20711,  21527,  22331,  23121,  23894,  24649,  25382,
+     26092,  26777,  27433,  28060,  28654,  29215,  29741,  30229,  30677,  31086,
+     31452,  31776,  32055,  32290,  32478,  32620,  32715,  32762,
+};
+
+static const short g_psWindow_flat_top_512[256] =
+{
+       -14,    -14,    -14,    -15,    -16,    -17,    -18,    -20,    -22,    -24,
+       -27,    -30,    -33,    -36,    -40,    -44,    -48,    -53,    -58,    -64,
+       -69,    -76,    -82,    -89,    -97,   -105,   -113,   -122,   -131,   -141,
+      -151,   -162,   -173,   -185,   -198,   -211,   -224,   -239,   -254,   -269,
+      -285,   -302,   -320,   -338,   -357,   -376,   -397,   -418,   -439,   -462,
+      -485,   -509,   -533,   -559,   -585,   -612,   -639,   -667,   -696,   -726,
+      -756,   -787,   -819,   -852,   -885,   -918,   -953,   -988,  -1023,  -1059,
+     -1095,  -1132,  -1169,  -1207,  -1245,  -1284,  -1322,  -1361,  -1400,  -1439,
+     -1478,  -1518,  -1557,  -1596,  -1635,  -1673,  -1712,  -1750,  -1787,  -1824,
+     -1860,  -1896,  -1931,  -1965,  -1997,  -2029,  -2060,  -2090,  -2118,  -2144,
+     -2170,  -2193,  -2215,  -2235,  -2252,  -2268,  -2282,  -2293,  -2302,  -2308,
+     -2311,  -2312,  -2310,  -2305,  -2296,  -2284,  -2269,  -2251,  -2228,  -2202,
+     -2172,  -2138,  -2100,  -2057,  -2011,  -1959,  -1903,  -1842,  -1777,  -1706,
+     -1631,  -1550,  -1463,  -1372,  -1275,  -1172,  -1064,   -950,   -830,   -704,
+      -572,   -434,   -289,   -139,     18,    181,    351,    527,    709,    899,
+      1094,   1297,   1506,   1721,   1944,   2173,   2408,   2650,   2899,   3155,
+      3417,   3685,   3960,   4241,   4529,   4823,   5124,   5430,   5743,   6061,
+      6386,   6716,   7051,   7393,   7739,   8091,   8448,   8810,   9177,   9548,
+      9924,  10304,  10688,  11076,  11468,  11863,  12262,  12663,  13068,  13475,
+     13884,  14295,  14709,  15124,  15540,  15957,  16376,  16795,  17214,  17633,
+     18052,  18471,  18888,  19305,  19720,  20134,  20546,  20955,  21362,  21766,
+     22167,  22565,  22959,  23348,  23734,  24115,  24491,  24862,  25228,  25588,
+     25942,  26289,  26630,  26965,  27292,  27612,  27924,  28228,  28525,  28813,
+     29092,  29363,  29625,  29877,  30120,  30354,  30577,  30791,  30994,  31188,
+     31370,  31542,  31703,  31853,  31993,  32121,  32237,  32343,  32436,  32519,
+     32589,  32648,  32696,  32731,  32755,  32767,
+};
+
+static const short g_psWindow_flat_top_2048[1024] =
+{
+       -14,    -14,    -14,    -14,    -14,    -14,    -14,    -14,    -14,    -14,
+       -15,    -15,    -15,    -15,    -15,    -16,    -16,    -16,    -16,    -17,
+       -17,    -17,    -18,    -18,    -18,    -19,    -19,    -20,    -20,    -21,
+       -21,    -22,    -22,    -23,    -23,    -24,    -24,    -25,    -25,    -26,
+       -27,    -27,    -28,    -29,    -30,    -30,    -31,    -32,    -33,    -34,
+       -34,    -35,    -36,    -37,    -38,    -39,    -40,    -41,    -42,    -43,
+       -44,    -45,    -46,    -47,    -48,    -49,    -51,    -52,    -53,    -54,
+       -55,    -57,    -58,    -59,    -61,    -62,    -63,    -65,    -66,    -68,
+       -69,    -71,    -72,    -74,    -75,    -77,    -79,    -80,    -82,    -84,
+       -85,    -87,    -89,    -91,    -93,    -95,    -96,    -98,   -100,   -102,
+      -104,   -106,   -108,   -110,   -113,   -115,   -117,   -119,   -121,   -124,
+      -126,   -128,   -131,   -133,   -135,   -138,   -140,   -143,   -145,   -148,
+      -151,   -153,   -156,   -159,   -161,   -164,   -167,   -170,   -173,   -176,
+      -179,   -182,   -185,   -188,   -191,   -194,   -197,   -200,   -204,   -207,
+      -210,   -213,   -217,   -220,   -224,   -227,   -231,   -234,   -238,   -242,
+      -245,   -249,   -253,   -257,   -260,   -264,   -268,   -272,   -276,   -280,
+      -284,   -289,   -293,   -297,   -301,   -305,   -310,   -314,   -319,   -323,
+      -328,   -332,   -337,   -341,   -346,   -351,   -355,   -360,   -365,   -370,
+      -375,   -380,   -385,   -390,   -395,   -400,   -406,   -411,   -416,   -421,
+      -427,   -432,   -438,   -443,   -449,   -454,   -460,   -466,   -471,   -477,
+      -483,   -489,   -495,   -501,   -507,   -513,   -519,   -525,   -531,   -538,
+      -544,   -550,   -557,   -563,   -570,   -576,   -583,   -589,   -596,   -603,
+      -609,   -616,   -623,   -630,   -637,   -644,   -651,   -658,   -665,   -672,
+      -679,   -687,   -694,   -701,   -709,   -716,   -723,   -731,   -738,   -746,
+      -754,   -761,   -769,   -777,   -785,   -793,   -800,   -808,   -816,   -824,
+      -832,   -841,   -849,   -857,   -865,   -873,   -882,   -890,   -898,   -907,
+      -915,   -924,   -932,   -941,   -949,   -958,   -967,   -975,   -984,   -993,
+     -1002,  -1011,  -1019,  -1028,  -1037,  -1046,  -1055,  -1064,  -1073,  -1082,
+     -1092,  -1101,  -1110,  -1119,  -1128,  -1138,  -1147,  -1156,  -1166,  -1175,
+     -1184,  -1194,  -1203,  -1213,  -1222,  -1232,  -1241,  -1251,  -1260,  -1270,
+     -1279,  -1289,  -1299,  -1308,  -1318,  -1328,  -1337,  -1347,  -1357,  -1366,
+     -1376,  -1386,  -1396,  -1405,  -1415,  -1425,  -1435,  -1445,  -1454,  -1464,
+     -1474,  -1484,  -1493,  -1503,  -1513,  -1523,  -1533,  -1542,  -1552,  -1562,
+     -1572,  -1581,  -1591,  -1601,  -1611,  -1620,  -1630,  -1640,  -1649,  -1659,
+     -1669,  -1678,  -1688,  -1697,  -1707,  -1716,  -1726,  -1735,  -1745,  -1754,
+     -1764,  -1773,  -1782,  -1792,  -1801,  -1810,  -1819,  -1828,  -1837,  -1846,
+     -1855,  -1864,  -1873,  -1882,  -1891,  -1900,  -1909,  -1917,  -1926,  -1935,
+     -1943,  -1952,  -1960,  -1968,  -1977,  -1985,  -1993,  -2001,  -2009,  -2017,
+     -2025,  -2033,  -2041,  -2048,  -2056,  -2063,  -2071,  -2078,  -2085,  -2093,
+     -2100,  -2107,  -2114,  -2121,  -2127,  -2134,  -2141,  -2147,  -2154,  -2160,
+     -2166,  -2172,  -2178,  -2184,  -2190,  -2195,  -2201,  -2206,  -2212,  -2217,
+     -2222,  -2227,  -2232,  -2236,  -2241,  -2245,  -2250,  -2254,  -2258,  -2262,
+     -2266,  -2270,  -2273,  -2276,  -2280,  -2283,  -2286,  -2289,  -2291,  -2294,
+     -2296,  -2298,  -2300,  -2302,  -2304,  -2306,  -2307,  -2308,  -2309,  -2310,
+     -2311,  -2312,  -2312,  -2312,  -2312,  -2312,  -2312,  -2311,  -2310,  -2310,
+     -2308,  -2307,  -2306,  -2304,  -2302,  -2300,  -2298,  -2295,  -2293,  -2290,
+     -2287,  -2283,  -2280,  -2276,  -2272,  -2268,  -2264,  -2259,  -2254,  -2249,
+     -2244,  -2238,  -2232,  -2226,  -2220,  -2214,  -2207,  -2200,  -2193,  -2185,
+     -2178,  -2170,  -2162,  -2153,  -2144,  -2135,  -2126,  -2117,  -2107,  -2097,
+     -2087,  -2076,  -2065,  -2054,  -2043,  -2031,  -2019,  -2007,  -1995,  -1982,
+     -1969,  -1956,  -1942,  -1928,  -1914,  -1899,  -1885,  -1869,  -1854,  -1838,
+     -1822,  -1806,  -1789,  -1773,  -1755,  -1738,  -1720,  -1702,  -1683,  -1664,
+     -1645,  -1626,  -1606,  -1586,  -1566,  -1545,  -1524,  -1502,  -1481,  -1458,
+     -1436,  -1413,  -1390,  -1367,  -1343,  -1319,  -1294,  -1270,  -1244,  -1219,
+     -1193,  -1167,  -1140,  -1113,  -1086,  -1058,  -1030,  -1002,   -973,   -944,
+      -915,   -885,   -855,   -824,   -793,   -762,   -730,   -698,   -665,   -633,
+      -599,   -566,   -532,   -498,   -463,   -428,   -392,   -356,   -320,   -283,
+      -246,   -209,   -171,   -133,    -94,    -55,    -16,     24,     64,    105,
+       146,    187,    229,    271,    314,    357,    400,    444,    488,    533,
+       578,    623,    669,    716,    762,    809,    857,    905,    953,   1002,
+      1051,   1100,   1150,   1201,   1251,   1303,   1354,   1406,   1459,   1511,
+      1565,   1618,   1672,   1727,   1782,   1837,   1893,   1949,   2006,   2063,
+      2120,   2178,   2236,   2295,   2354,   2413,   2473,   2533,   2594,   2655,
+      2717,   2779,   2841,   2904,   2967,   3030,   3094,   3159,   3224,   3289,
+      3355,   3421,   3487,   3554,   3621,   3689,   3757,   3825,   3894,   3963,
+      4033,   4103,   4174,   4245,   4316,   4387,   4460,   4532,   4605,   4678,
+      4752,   4826,   4900,   4975,   5050,   5126,   5202,   5278,   5355,   5432,
+      5509,   5587,   5665,   5744,   5823,   5902,   5982,   6062,   6142,   6223,
+      6304,   6386,   6468,   6550,   6632,   6715,   6799,   6882,   6966,   7051,
+      7135,   7220,   7306,   7391,   7477,   7564,   7650,   7737,   7825,   7913,
+      8001,   8089,   8177,   8266,   8356,   8445,   8535,   8625,   8716,   8807,
+      8898,   8989,   9081,   9173,   9265,   9358,   9450,   9544,   9637,   9731,
+      9824,   9919,  10013,  10108,  10203,  10298,  10394,  10489,  10585,  10682,
+     10778,  10875,  10972,  11069,  11166,  11264,  11362,  11460,  11558,  11657,
+     11756,  11855,  11954,  12053,  12153,  12253,  12352,  12453,  12553,  12653,
+     12754,  12855,  12956,  13057,  13158,  13260,  13362,  13463,  13565,  13667,
+     13770,  13872,  13975,  14077,  14180,  14283,  14386,  14489,  14592,  14695,
+     14799,  14902,  15006,  15110,  15214,  15317,  15421,  15525,  15630,  15734,
+     15838,  15942,  16047,  16151,  16255,  16360,  16464,  16569,  16674,  16778,
+     16883,  16988,  17092,  17197,  17301,  17406,  17511,  17615,  17720,  17825,
+     17929,  18034,  18138,  18243,  18347,  18452,  18556,  18661,  18765,  18869,
+     18973,  19077,  19181,  19285,  19389,  19493,  19596,  19700,  19803,  19907,
+     20010,  20113,  20216,  20319,  20422,  20524,  20627,  20729,  20831,  20933,
+     21035,  21137,  21238,  21340,  21441,  21542,  21643,  21743,  21844,  21944,
+     22044,  22144,  22243,  22343,  22442,  22541,  22640,  22738,  22837,  22935,
+     23032,  23130,  23227,  23324,  23421,  23517,  23614,  23709,  23805,  23900,
+     23995,  24090,  24185,  24279,  24373,  24466,  24559,  24652,  24745,  24837,
+     24929,  25020,  25112,  25202,  25293,  25383,  25473,  25562,  25651,  25740,
+     25828,  25916,  26003,  26091,  26177,  26264,  26349,  26435,  26520,  26605,
+     26689,  26773,  26856,  26939,  27021,  27103,  27185,  27266,  27347,  27427,
+     27507,  27586,  27665,  27743,  27821,  27899,  27976,  28052,  28128,  28203,
+     28278,  28353,  28427,  28500,  28573,  28645,  28717,  28788,  28859,  28929,
+     28999,  29068,  29137,  29205,  29272,  29339,  29406,  29471,  29537,  29601,
+     29665,  29729,  29792,  29854,  29916,  29977,  30038,  30098,  30157,  30216,
+     30274,  30332,  30389,  30445,  30501,  30556,  30611,  30665,  30718,  30771,
+     30823,  30874,  30925,  30975,  31024,  31073,  31121,  31169,  31215,  31262,
+     31307,  31352,  31396,  31440,  31483,  31525,  31566,  31607,  31647,  31687,
+     31726,  31764,  31801,  31838,  31874,  31909,  31944,  31978,  32011,  32044,
+     32076,  32107,  32138,  32167,  32197,  32225,  32253,  32280,  32306,  32331,
+     32356,  32380,  32404,  32426,  32448,  32470,  32490,  32510,  32529,  32547,
+     32565,  32582,  32598,  32613,  32628,  32642,  32655,  32668,  32679,  32691,
+     32701,  32710,  32719,  32727,  32735,  32741,  32747,  32752,  32757,  32761,
+     32763,  32766,  32767,  32767,
+};
+
+static const short g_psWindow_kaiser_128[64] =
+{
+        44,     73,    110,    157,    214,    283,    365,    463,    576,    707,
+       858,   1029,   1223,   1440,   1683,   1952,   2250,   2576,   2933,   3321,
+      3741,   4194,   4681,   5201,   5755,   6343,   6965,   7620,   8307,   9026,
+      9775,  10553,  11358,  12187,  13040,  13913,  14804,  15710,  16628,  17554,
+     18485,  19418,  20348,  21273,  22187,  23088,  23971,  24832,  25667,  26472,
+     27243,  27977,  28670,  29319,  29920,  30470,  30966,  31406,  31788,  32109,
+     32368,  32563,  32694,  32760,
+};
+
+static const short g_psWindow_kaiser_256[128] =
+{
+        44,     57,     73,     90,    110,    132,    156,    183,    213,    246,
+       281,    321,    363,    410,    460,    514,    572,    635,    702,    775,
+       852,    934,   1021,   1115,   1213,   1318,   1429,   1546,   1669,   1799,
+      1936,   2079,   2230,   2388,   2553,   2726,   2907,   3095,   3291,   3495,
+      3707,   3927,   4156,   4392,   4637,   4891,   5153,   5423,   5702,   5989,
+      6284,   6588,   6900,   7221,   7549,   7886,   8230,   8583,   8943,   9311,
+      9686,  10068,  10457,  10853,  11255,  11664,  12079,  12499,  12925,  13356,
+     13792,  14233,  14677,  15126,  15578,  16033,  16490,  16950,  17412,  17875,
+     18339,  18803,  19268,  19732,  20195,  20657,  21118,  21575,  22030,  22482,
+     22930,  23374,  23813,  24247,  24675,  25097,  25512,  25919,  26320,  26712,
+     27095,  27469,  27834,  28188,  28532,  28866,  29188,  29498,  29797,  30082,
+     30355,  30615,  30862,  31094,  31313,  31517,  31706,  31881,  32040,  32184,
+     32313,  32425,  32522,  32603,  32668,  32717,  32750,  32766,
+};
+
+static const short g_psWindow_kaiser_512[256] =
+{
+        44,     50,     57,     65,     73,     81,     90,     99,    110,    120,
+       131,    143,    156,    169,    183,    197,    212,    228,    245,    262,
+       281,    300,    320,    341,    362,    385,    408,    433,    458,    485,
+       512,    541,    570,    601,    633,    666,    700,    735,    772,    810,
+       849,    889,    930,    973,   1018,   1063,   1110,   1159,   1209,   1260,
+      1313,   1367,   1423,   1480,   1539,   1600,   1662,   1726,   1791,   1859,
+      1928,   1998,   2071,   2145,   2221,   2298,   2378,   2459,   2542,   2627,
+      2714,   2803,   2894,   2986,   3081,   3178,   3276,   3377,   3479,   3584,
+      3690,   3799,   3909,   4022,   4137,   4253,   4372,   4493,   4616,   4741,
+      4868,   4998,   5129,   5262,   5398,   5535,   5675,   5817,   5961,   6107,
+      6255,   6405,   6557,   6712,   6868,   7027,   7187,   7350,   7514,   7681,
+      7849,   8020,   8192,   8367,   8543,   8721,   8902,   9084,   9268,   9454,
+      9641,   9831,  10022,  10215,  10409,  10606,  10804,  11003,  11204,  11407,
+     11612,  11817,  12025,  12234,  12444,  12655,  12868,  13082,  13298,  13515,
+     13732,  13951,  14171,  14392,  14615,  14838,  15062,  15286,  15512,  15739,
+     15966,  16194,  16422,  16651,  16881,  17111,  17341,  17572,  17803,  18034,
+     18266,  18498,  18730,  18961,  19193,  19425,  19657,  19888,  20119,  20350,
+     20581,  20811,  21040,  21269,  21498,  21725,  21952,  22179,  22404,  22628,
+     22852,  23074,  23295,  23516,  23734,  23952,  24168,  24383,  24597,  24808,
+     25019,  25227,  25434,  25639,  25843,  26044,  26243,  26441,  26636,  26829,
+     27021,  27209,  27396,  27580,  27762,  27941,  28118,  28292,  28463,  28632,
+     28798,  28962,  29122,  29280,  29434,  29586,  29734,  29880,  30022,  30162,
+     30298,  30430,  30560,  30686,  30809,  30928,  31044,  31156,  31265,  31370,
+     31472,  31570,  31664,  31755,  31842,  31925,  32005,  32080,  32152,  32220,
+     32284,  32344,  32400,  32452,  32501,  32545,  32585,  32622,  32654,  32682,
+     32707,  32727,  32743,  32755,  32763,  32767,
+};
+
+static const short g_psWindow_kaiser_2048[1024] =
+{
+        44,     45,     47,     49,     50,     52,     54,     55,     57,     59,
+        61,     63,     65,     67,     69,     71,     73,     75,     77,     79,
+        81,     83,     85,     88,     90,     92,     95,     97,     99,    102,
+       104,    107,    109,    112,    115,    117,    120,    123,    126,    128,
+       131,    134,    137,    140,    143,    146,    149,    152,    155,    159,
+       162,    165,    169,    172,    175,    179,    182,    186,    189,    193,
+       197,    201,    204,    208,    212,    216,    220,    224,    228,    232,
+       236,    240,    245,    249,    253,    258,    262,    266,    271,    276,
+       280,    285,    290,    294,    299,    304,    309,    314,    319,    324,
+       329,    335,    340,    345,    351,    356,    362,    367,    373,    378,
+       384,    390,    396,    402,    408,    414,    420,    426,    432,    438,
+       444,    451,    457,    464,    470,    477,    484,    490,    497,    504,
+       511,    518,    525,    532,    540,    547,    554,    562,    569,    577,
+       584,    592,    600,    607,    615,    623,    631,    639,    648,    656,
+       664,    673,    681,    690,    698,    707,    716,    724,    733,    742,
+       751,    761,    770,    779,    788,    798,    807,    817,    827,    836,
+       846,    856,    866,    876,    886,    897,    907,    917,    928,    938,
+       949,    960,    971,    981,    992,   1004,   1015,   1026,   1037,   1049,
+      1060,   1072,   1083,   1095,   1107,   1119,   1131,   1143,   1155,   1168,
+      1180,   1192,   1205,   1218,   1230,   1243,   1256,   1269,   1282,   1295,
+      1309,   1322,   1336,   1349,   1363,   1377,   1391,   1405,   1419,   1433,
+      1447,   1461,   1476,   1490,   1505,   1520,   1535,   1550,   1565,   1580,
+      1595,   1610,   1626,   1641,   1657,   1673,   1689,   1705,   1721,   1737,
+      1753,   1769,   1786,   1802,   1819,   1836,   1853,   1870,   1887,   1904,
+      1921,   1939,   1956,   1974,   1992,   2010,   2028,   2046,   2064,   2082,
+      2101,   2119,   2138,   2156,   2175,   2194,   2213,   2232,   2252,   2271,
+      2291,   2310,   2330,   2350,   2370,   2390,   2410,   2431,   2451,   2471,
+      2492,   2513,   2534,   2555,   2576,   2597,   2619,   2640,   2662,   2683,
+      2705,   2727,   2749,   2771,   2794,   2816,   2839,   2861,   2884,   2907,
+      2930,   2953,   2976,   3000,   3023,   3047,   3071,   3094,   3118,   3143,
+      3167,   3191,   3216,   3240,   3265,   3290,   3315,   3340,   3365,   3390,
+      3416,   3442,   3467,   3493,   3519,   3545,   3571,   3598,   3624,   3651,
+      3678,   3704,   3731,   3758,   3786,   3813,   3841,   3868,   3896,   3924,
+      3952,   3980,   4008,   4036,   4065,   4094,   4122,   4151,   4180,   4209,
+      4239,   4268,   4298,   4327,   4357,   4387,   4417,   4447,   4478,   4508,
+      4539,   4569,   4600,   4631,   4662,   4693,   4725,   4756,   4788,   4820,
+      4851,   4883,   4916,   4948,   4980,   5013,   5045,   5078,   5111,   5144,
+      5177,   5211,   5244,   5278,   5311,   5345,   5379,   5413,   5447,   5482,
+      5516,   5551,   5586,   5620,   5655,   5691,   5726,   5761,   5797,   5832,
+      5868,   5904,   5940,   5976,   6013,   6049,   6086,   6122,   6159,   6196,
+      6233,   6270,   6308,   6345,   6383,   6421,   6458,   6496,   6535,   6573,
+      6611,   6650,   6688,   6727,   6766,   6805,   6844,   6883,   6923,   6962,
+      7002,   7042,   7082,   7122,   7162,   7202,   7243,   7283,   7324,   7365,
+      7406,   7447,   7488,   7529,   7571,   7612,   7654,   7696,   7738,   7780,
+      7822,   7864,   7907,   7949,   7992,   8035,   8078,   8121,   8164,   8207,
+      8251,   8294,   8338,   8381,   8425,   8469,   8514,   8558,   8602,   8647,
+      8691,   8736,   8781,   8826,   8871,   8916,   8961,   9007,   9052,   9098,
+      9144,   9190,   9236,   9282,   9328,   9375,   9421,   9468,   9514,   9561,
+      9608,   9655,   9702,   9749,   9797,   9844,   9892,   9940,   9987,  10035,
+     10083,  10131,  10180,  10228,  10277,  10325,  10374,  10423,  10471,  10520,
+     10570,  10619,  10668,  10717,  10767,  10817,  10866,  10916,  10966,  11016,
+     11066,  11116,  11167,  11217,  11268,  11318,  11369,  11420,  11471,  11522,
+     11573,  11624,  11675,  11726,  11778,  11829,  11881,  11933,  11985,  12037,
+     12089,  12141,  12193,  12245,  12297,  12350,  12402,  12455,  12508,  12561,
+     12613,  12666,  12719,  12773,  12826,  12879,  12932,  12986,  13039,  13093,
+     13147,  13200,  13254,  13308,  13362,  13416,  13470,  13524,  13579,  13633,
+     13688,  13742,  13797,  13851,  13906,  13961,  14016,  14070,  14125,  14181,
+     14236,  14291,  14346,  14401,  14457,  14512,  14568,  14623,  14679,  14734,
+     14790,  14846,  14902,  14958,  15014,  15070,  15126,  15182,  15238,  15294,
+     15350,  15407,  15463,  15520,  15576,  15632,  15689,  15746,  15802,  15859,
+     15916,  15973,  16029,  16086,  16143,  16200,  16257,  16314,  16371,  16428,
+     16485,  16542,  16600,  16657,  16714,  16771,  16829,  16886,  16944,  17001,
+     17058,  17116,  17173,  17231,  17288,  17346,  17404,  17461,  17519,  17576,
+     17634,  17692,  17750,  17807,  17865,  17923,  17981,  18038,  18096,  18154,
+     18212,  18270,  18327,  18385,  18443,  18501,  18559,  18617,  18675,  18732,
+     18790,  18848,  18906,  18964,  19022,  19080,  19138,  19195,  19253,  19311,
+     19369,  19427,  19485,  19543,  19600,  19658,  19716,  19774,  19831,  19889,
+     19947,  20005,  20062,  20120,  20178,  20235,  20293,  20351,  20408,  20466,
+     20523,  20581,  20638,  20696,  20753,  20810,  20868,  20925,  20982,  21040,
+     21097,  21154,  21211,  21268,  21325,  21382,  21439,  21496,  21553,  21610,
+     21667,  21724,  21781,  21837,  21894,  21950,  22007,  22063,  22120,  22176,
+     22233,  22289,  22345,  22401,  22457,  22513,  22569,  22625,  22681,  22737,
+     22793,  22849,  22904,  22960,  23015,  23071,  23126,  23181,  23236,  23292,
+     23347,  23402,  23457,  23511,  23566,  23621,  23676,  23730,  23785,  23839,
+     23893,  23947,  24002,  24056,  24110,  24163,  24217,  24271,  24324,  24378,
+     24431,  24485,  24538,  24591,  24644,  24697,  24750,  24803,  24855,  24908,
+     24960,  25013,  25065,  25117,  25169,  25221,  25273,  25325,  25376,  25428,
+     25479,  25530,  25582,  25633,  25683,  25734,  25785,  25836,  25886,  25936,
+     25987,  26037,  26087,  26137,  26186,  26236,  26286,  26335,  26384,  26433,
+     26482,  26531,  26580,  26628,  26677,  26725,  26773,  26821,  26869,  26917,
+     26965,  27012,  27060,  27107,  27154,  27201,  27248,  27294,  27341,  27387,
+     27433,  27479,  27525,  27571,  27617,  27662,  27708,  27753,  27798,  27843,
+     27887,  27932,  27976,  28020,  28065,  28108,  28152,  28196,  28239,  28283,
+     28326,  28369,  28411,  28454,  28496,  28539,  28581,  28623,  28664,  28706,
+     28747,  28789,  28830,  28871,  28911,  28952,  28992,  29032,  29072,  29112,
+     29152,  29191,  29231,  29270,  29309,  29347,  29386,  29424,  29463,  29501,
+     29538,  29576,  29613,  29651,  29688,  29725,  29761,  29798,  29834,  29870,
+     29906,  29942,  29977,  30013,  30048,  30083,  30117,  30152,  30186,  30220,
+     30254,  30288,  30321,  30355,  30388,  30421,  30453,  30486,  30518,  30550,
+     30582,  30614,  30645,  30676,  30707,  30738,  30769,  30799,  30829,  30859,
+     30889,  30919,  30948,  30977,  31006,  31035,  31063,  31091,  31119,  31147,
+     31175,  31202,  31229,  31256,  31283,  31309,  31335,  31361,  31387,  31413,
+     31438,  31463,  31488,  31513,  31537,  31561,  31585,  31609,  31633,  31656,
+     31679,  31702,  31725,  31747,  31769,  31791,  31813,  31834,  31855,  31876,
+     31897,  31917,  31938,  31958,  31978,  31997,  32016,  32035,  32054,  32073,
+     32091,  32109,  32127,  32145,  32162,  32180,  32196,  32213,  32230,  32246,
+     32262,  32277,  32293,  32308,  32323,  32338,  32352,  32367,  32381,  32394,
+     32408,  32421,  32434,  32447,  32460,  32472,  32484,  32496,  32507,  32518,
+     32530,  32540,  32551,  32561,  32571,  32581,  32591,  32600,  32609,  32618,
+     32626,  32635,  32643,  32651,  32658,  32665,  32673,  32679,  32686,  32692,
+     32698,  32704,  32710,  32715,  32720,  32725,  32729,  32734,  32738,  32741,
+     32745,  32748,  32751,  32754,  32757,  32759,  32761,  32763,  32764,  32765,
+     32766,  32767,  32767,  32767,
+};
+
+#endif
+
+#ifdef WINDOW_TABLES_FLOAT
+
+static const float g_pfWindow_hamming_128[64] =
+{
+    0.080000000f, 0.080562849f, 0.082250017f, 0.085057376f, 0.088978056f, 0.094002462f,
+    0.100118299f, 0.107310600f, 0.115561765f, 0.124851601f, 0.135157375f, 0.146453867f,
+    0.158713432f, 0.171906069f, 0.185999493f, 0.200959216f, 0.216748629f, 0.233329092f,
+    0.250660030f, 0.268699032f, 0.287401952f, 0.306723023f, 0.326614961f, 0.347029088f,
+    0.367915447f, 0.389222926f, 0.410899381f, 0.432891768f, 0.455146266f, 0.477608416f,
+    0.500223248f, 0.522935421f, 0.545689353f, 0.568429363f, 0.591099802f, 0.613645190f,
+    0.636010357f, 0.658140570f, 0.679981673f, 0.701480217f, 0.722583593f, 0.743240156f,
+    0.763399356f, 0.783011860f, 0.802029674f, 0.820406257f, 0.838096639f, 0.855057529f,
+    0.871247420f, 0.886626693f, 0.901157713f, 0.914804919f, 0.927534914f, 0.939316547f,
+    0.950120985f, 0.959921789f, 0.968694973f, 0.976419069f, 0.983075175f, 0.988647001f,
+    0.993120913f, 0.996485962f, 0.998733914f, 0.999859266f,
+};
+
+static const float g_pfWindow_hamming_256[128] =
+{
+    0.080000000f, 0.080139632f, 0.080558444f, 0.081256180f, 0.082232418f, 0.083486566f,
+    0.085017860f, 0.086825373f, 0.088908006f, 0.091264495f, 0.093893409f, 0.096793154f,
+    0.099961967f, 0.103397926f, 0.107098944f, 0.111062774f, 0.115287011f, 0.119769089f,
+    0.124506288f, 0.129495732f, 0.134734391f, 0.140219085f, 0.145946484f, 0.151913112f,
+    0.158115346f, 0.164549420f, 0.171211429f, 0.178097329f, 0.185202937f, 0.192523942f,
+    0.200055898f, 0.207794233f, 0.215734248f, 0.223871124f, 0.232199921f, 0.240715582f,
+    0.249412937f, 0.258286707f, 0.267331503f, 0.276541836f, 0.285912112f, 0.295436645f,
+    0.305109651f, 0.314925258f, 0.324877507f, 0.334960356f, 0.345167684f, 0.355493294f,
+    0.365930917f, 0.376474217f, 0.387116792f, 0.397852183f, 0.408673870f, 0.419575286f,
+    0.430549810f, 0.441590782f, 0.452691497f, 0.463845217f, 0.475045170f, 0.486284557f,
+    0.497556555f, 0.508854319f, 0.520170992f, 0.531499704f, 0.542833575f, 0.554165727f,
+    0.565489278f, 0.576797356f, 0.588083093f, 0.599339640f, 0.610560161f, 0.621737846f,
+    0.632865908f, 0.643937592f, 0.654946175f, 0.665884975f, 0.676747351f, 0.687526708f,
+    0.698216503f, 0.708810244f, 0.719301502f, 0.729683906f, 0.739951154f, 0.750097012f,
+    0.760115322f, 0.770000000f, 0.779745046f, 0.789344544f, 0.798792666f, 0.808083676f,
+    0.817211933f, 0.826171896f, 0.834958125f, 0.843565286f, 0.851988154f, 0.860221615f,
+    0.868260671f, 0.876100441f, 0.883736166f, 0.891163210f, 0.898377064f, 0.905373349f,
+    0.912147817f, 0.918696356f, 0.925014990f, 0.931099882f, 0.936947340f, 0.942553812f,
+    0.947915896f, 0.953030335f, 0.957894025f, 0.962504013f, 0.966857501f, 0.970951846f,
+    0.974784561f, 0.978353320f, 0.981655957f, 0.984690466f, 0.987455005f, 0.989947896f,
+    0.992167626f, 0.994112846f, 0.995782376f, 0.997175203f, 0.998290480f, 0.999127531f,
+    0.999685848f, 0.999965091f,
+};
+
+static const float g_pfWindow_hamming_512[256] =
+{
+    0.080000000f, 0.080034773f, 0.080139086f, 0.080312924f, 0.080556260f, 0.080869058f,
+    0.081251271f, 0.081702840f, 0.082223697f, 0.082813763f, 0.083472950f, 0.084201158f,
+    0.084998276f, 0.085864184f, 0.086798751f, 0.087801836f, 0.088873287f, 0.090012943f,
+    0.091220630f, 0.092496166f, 0.093839359f, 0.095250006f, 0.096727892f, 0.098272795f,
+    0.099884482f, 0.101562707f, 0.103307219f, 0.105117752f, 0.106994034f, 0.108935780f,
+    0.110942697f, 0.113014482f, 0.115150821f, 0.117351392f, 0.119615861f, 0.121943887f,
+    0.124335117f, 0.126789190f, 0.129305734f, 0.131884370f, 0.134524708f, 0.137226347f,
+    0.139988881f, 0.142811891f, 0.145694950f, 0.148637623f, 0.151639464f, 0.154700020f,
+    0.157818829f, 0.160995417f, 0.164229306f, 0.167520007f, 0.170867021f, 0.174269844f,
+    0.177727959f, 0.181240845f, 0.184807971f, 0.188428797f, 0.192102776f, 0.195829351f,
+    0.199607961f, 0.203438034f, 0.207318990f, 0.211250242f, 0.215231198f, 0.219261254f,
+    0.223339801f, 0.227466222f, 0.231639895f, 0.235860188f, 0.240126462f, 0.244438073f,
+    0.248794369f, 0.253194691f, 0.257638374f, 0.262124747f, 0.266653130f, 0.271222840f,
+    0.275833185f, 0.280483469f, 0.285172988f, 0.289901033f, 0.294666890f, 0.299469838f,
+    0.304309150f, 0.309184096f, 0.314093938f, 0.319037935f, 0.324015337f, 0.329025393f,
+    0.334067346f, 0.339140433f, 0.344243888f, 0.349376938f, 0.354538807f, 0.359728716f,
+    0.364945879f, 0.370189508f, 0.375458810f, 0.380752989f, 0.386071243f, 0.391412769f,
+    0.396776760f, 0.402162404f, 0.407568887f, 0.412995392f, 0.418441099f, 0.423905183f,
+    0.429386820f, 0.434885179f, 0.440399431f, 0.445928740f, 0.451472272f, 0.457029188f,
+    0.462598649f, 0.468179811f, 0.473771831f, 0.479373865f, 0.484985064f, 0.490604581f,
+    0.496231565f, 0.501865167f, 0.507504534f, 0.513148814f, 0.518797154f, 0.524448699f,
+    0.530102595f, 0.535757988f, 0.541414022f, 0.547069842f, 0.552724593f, 0.558377421f,
+    0.564027470f, 0.569673887f, 0.575315817f, 0.580952408f, 0.586582808f, 0.592206164f,
+    0.597821628f, 0.603428351f, 0.609025483f, 0.614612180f, 0.620187597f, 0.625750890f,
+    0.631301219f, 0.636837745f, 0.642359630f, 0.647866039f, 0.653356141f, 0.658829105f,
+    0.664284103f, 0.669720312f, 0.675136908f, 0.680533074f, 0.685907993f, 0.691260852f,
+    0.696590844f, 0.701897160f, 0.707179000f, 0.712435565f, 0.717666060f, 0.722869695f,
+    0.728045682f, 0.733193239f, 0.738311587f, 0.743399954f, 0.748457570f, 0.753483669f,
+    0.758477493f, 0.763438286f, 0.768365298f, 0.773257785f, 0.778115006f, 0.782936227f,
+    0.787720720f, 0.792467761f, 0.797176632f, 0.801846621f, 0.806477023f, 0.811067137f,
+    0.815616270f, 0.820123733f, 0.824588846f, 0.829010932f, 0.833389324f, 0.837723359f,
+    0.842012383f, 0.846255746f, 0.850452808f, 0.854602934f, 0.858705496f, 0.862759874f,
+    0.866765455f, 0.870721634f, 0.874627812f, 0.878483399f, 0.882287812f, 0.886040476f,
+    0.889740823f, 0.893388294f, 0.896982338f, 0.900522411f, 0.904007978f, 0.907438512f,
+    0.910813494f, 0.914132414f, 0.917394770f, 0.920600070f, 0.923747828f, 0.926837568f,
+    0.929868825f, 0.932841138f, 0.935754059f, 0.938607147f, 0.941399972f, 0.944132110f,
+    0.946803149f, 0.949412685f, 0.951960324f, 0.954445679f, 0.956868376f, 0.959228049f,
+    0.961524340f, 0.963756902f, 0.965925398f, 0.968029499f, 0.970068889f, 0.972043258f,
+    0.973952308f, 0.975795750f, 0.977573306f, 0.979284707f, 0.980929694f, 0.982508019f,
+    0.984019442f, 0.985463736f, 0.986840682f, 0.988150071f, 0.989391707f, 0.990565400f,
+    0.991670974f, 0.992708262f, 0.993677107f, 0.994577361f, 0.995408890f, 0.996171567f,
+    0.996865277f, 0.997489916f, 0.998045388f, 0.998531610f, 0.998948509f, 0.999296021f,
+    0.999574093f, 0.999782684f, 0.999921762f, 0.999991307f,
+};
+
+static const float g_pfWindow_hamming_2048[1024] =
+{
+    0.080000000f, 0.080002167f, 0.080008668f, 0.080019503f, 0.080034671f, 0.080054173f,
+    0.080078009f, 0.080106177f, 0.080138679f, 0.080175513f, 0.080216679f, 0.080262178f,
+    0.080312008f, 0.080366168f, 0.080424660f, 0.080487481f, 0.080554632f, 0.080626111f,
+    0.080701918f, 0.080782053f, 0.080866514f, 0.080955301f, 0.081048413f, 0.081145848f,
+    0.081247607f, 0.081353689f, 0.081464091f, 0.081578813f, 0.081697855f, 0.081821215f,
+    0.081948891f, 0.082080883f, 0.082217189f, 0.082357808f, 0.082502739f, 0.082651980f,
+    0.082805530f, 0.082963388f, 0.083125551f, 0.083292020f, 0.083462791f, 0.083637863f,
+    0.083817235f, 0.084000905f, 0.084188871f, 0.084381132f, 0.084577685f, 0.084778529f,
+    0.084983662f, 0.085193082f, 0.085406787f, 0.085624775f, 0.085847044f, 0.086073592f,
+    0.086304416f, 0.086539515f, 0.086778887f, 0.087022528f, 0.087270437f, 0.087522612f,
+    0.087779049f, 0.088039747f, 0.088304704f, 0.088573916f, 0.088847381f, 0.089125097f,
+    0.089407061f, 0.089693270f, 0.089983721f, 0.090278413f, 0.090577342f, 0.090880504f,
+    0.091187899f, 0.091499522f, 0.091815370f, 0.092135441f, 0.092459732f, 0.092788239f,
+    0.093120959f, 0.093457890f, 0.093799028f, 0.094144370f, 0.094493913f, 0.094847653f,
+    0.095205587f, 0.095567711f, 0.095934023f, 0.096304519f, 0.096679195f, 0.097058048f,
+    0.097441074f, 0.097828269f, 0.098219631f, 0.098615155f, 0.099014837f, 0.099418675f,
+    0.099826663f, 0.100238798f, 0.100655076f, 0.101075494f, 0.101500048f, 0.101928732f,
+    0.102361544f, 0.102798479f, 0.103239533f, 0.103684703f, 0.104133983f, 0.104587369f,
+    0.105044858f, 0.105506445f, 0.105972125f, 0.106441895f, 0.106915749f, 0.107393684f,
+    0.107875695f, 0.108361777f, 0.108851925f, 0.109346136f, 0.109844404f, 0.110346725f,
+    0.110853094f, 0.111363506f, 0.111877957f, 0.112396441f, 0.112918954f, 0.113445491f,
+    0.113976046f, 0.114510615f, 0.115049194f, 0.115591775f, 0.116138356f, 0.116688930f,
+    0.117243492f, 0.117802037f, 0.118364560f, 0.118931055f, 0.119501518f, 0.120075942f,
+    0.120654322f, 0.121236654f, 0.121822931f, 0.122413148f, 0.123007299f, 0.123605379f,
+    0.124207382f, 0.124813302f, 0.125423134f, 0.126036872f, 0.126654510f, 0.127276043f,
+    0.127901464f, 0.128530768f, 0.129163948f, 0.129801000f, 0.130441915f, 0.131086690f,
+    0.131735317f, 0.132387791f, 0.133044105f, 0.133704253f, 0.134368229f, 0.135036027f,
+    0.135707640f, 0.136383063f, 0.137062288f, 0.137745309f, 0.138432120f, 0.139122715f,
+    0.139817086f, 0.140515228f, 0.141217134f, 0.141922797f, 0.142632210f, 0.143345367f,
+    0.144062261f, 0.144782886f, 0.145507234f, 0.146235299f, 0.146967074f, 0.147702552f,
+    0.148441726f, 0.149184589f, 0.149931134f, 0.150681354f, 0.151435242f, 0.152192791f,
+    0.152953994f, 0.153718843f, 0.154487332f, 0.155259453f, 0.156035198f, 0.156814562f,
+    0.157597535f, 0.158384112f, 0.159174283f, 0.159968043f, 0.160765383f, 0.161566297f,
+    0.162370775f, 0.163178812f, 0.163990399f, 0.164805528f, 0.165624192f, 0.166446384f,
+    0.167272095f, 0.168101318f, 0.168934044f, 0.169770267f, 0.170609978f, 0.171453169f,
+    0.172299832f, 0.173149959f, 0.174003543f, 0.174860575f, 0.175721048f, 0.176584952f,
+    0.177452281f, 0.178323025f, 0.179197176f, 0.180074728f, 0.180955670f, 0.181839995f,
+    0.182727694f, 0.183618759f, 0.184513182f, 0.185410955f, 0.186312068f, 0.187216513f,
+    0.188124282f, 0.189035367f, 0.189949758f, 0.190867447f, 0.191788425f, 0.192712684f,
+    0.193640215f, 0.194571010f, 0.195505059f, 0.196442353f, 0.197382885f, 0.198326644f,
+    0.199273623f, 0.200223811f, 0.201177201f, 0.202133783f, 0.203093549f, 0.204056488f,
+    0.205022593f, 0.205991854f, 0.206964261f, 0.207939807f, 0.208918481f, 0.209900274f,
+    0.210885177f, 0.211873181f, 0.212864277f, 0.213858454f, 0.214855705f, 0.215856018f,
+    0.216859386f, 0.217865798f, 0.218875246f, 0.219887718f, 0.220903207f, 0.221921702f,
+    0.222943194f, 0.223967673f, 0.224995130f, 0.226025554f, 0.227058937f, 0.228095268f,
+    0.229134537f, 0.230176736f, 0.231221853f, 0.232269880f, 0.233320806f, 0.234374621f,
+    0.235431316f, 0.236490880f, 0.237553304f, 0.238618578f, 0.239686691f, 0.240757633f,
+    0.241831394f, 0.242907965f, 0.243987335f, 0.245069494f, 0.246154432f, 0.247242138f,
+    0.248332602f, 0.249425814f, 0.250521764f, 0.251620442f, 0.252721836f, 0.253825937f,
+    0.254932734f, 0.256042217f, 0.257154375f, 0.258269198f, 0.259386675f, 0.260506797f,
+    0.261629551f, 0.262754928f, 0.263882918f, 0.265013508f, 0.266146690f, 0.267282452f,
+    0.268420783f, 0.269561672f, 0.270705110f, 0.271851085f, 0.272999587f, 0.274150603f,
+    0.275304125f, 0.276460141f, 0.277618639f, 0.278779609f, 0.279943041f, 0.281108923f,
+    0.282277244f, 0.283447993f, 0.284621159f, 0.285796731f, 0.286974698f, 0.288155050f,
+    0.289337773f, 0.290522859f, 0.291710295f, 0.292900070f, 0.294092174f, 0.295286594f,
+    0.296483320f, 0.297682340f, 0.298883643f, 0.300087218f, 0.301293053f, 0.302501137f,
+    0.303711459f, 0.304924007f, 0.306138770f, 0.307355736f, 0.308574894f, 0.309796232f,
+    0.311019740f, 0.312245404f, 0.313473215f, 0.314703160f, 0.315935227f, 0.317169405f,
+    0.318405683f, 0.319644049f, 0.320884490f, 0.322126996f, 0.323371555f, 0.324618155f,
+    0.325866784f, 0.327117430f, 0.328370083f, 0.329624729f, 0.330881357f, 0.332139955f,
+    0.333400512f, 0.334663015f, 0.335927453f, 0.337193814f, 0.338462085f, 0.339732255f,
+    0.341004312f, 0.342278244f, 0.343554038f, 0.344831684f, 0.346111168f, 0.347392479f,
+    0.348675604f, 0.349960533f, 0.351247251f, 0.352535748f, 0.353826012f, 0.355118029f,
+    0.356411788f, 0.357707277f, 0.359004483f, 0.360303395f, 0.361604000f, 0.362906285f,
+    0.364210239f, 0.365515849f, 0.366823103f, 0.368131989f, 0.369442494f, 0.370754606f,
+    0.372068312f, 0.373383601f, 0.374700459f, 0.376018875f, 0.377338836f, 0.378660329f,
+    0.379983342f, 0.381307863f, 0.382633879f, 0.383961378f, 0.385290347f, 0.386620773f,
+    0.387952645f, 0.389285949f, 0.390620673f, 0.391956804f, 0.393294330f, 0.394633239f,
+    0.395973517f, 0.397315151f, 0.398658131f, 0.400002442f, 0.401348072f, 0.402695008f,
+    0.404043238f, 0.405392748f, 0.406743527f, 0.408095562f, 0.409448839f, 0.410803346f,
+    0.412159071f, 0.413516000f, 0.414874120f, 0.416233420f, 0.417593886f, 0.418955504f,
+    0.420318264f, 0.421682150f, 0.423047152f, 0.424413256f, 0.425780448f, 0.427148717f,
+    0.428518049f, 0.429888431f, 0.431259850f, 0.432632294f, 0.434005750f, 0.435380204f,
+    0.436755644f, 0.438132057f, 0.439509430f, 0.440887749f, 0.442267002f, 0.443647176f,
+    0.445028258f, 0.446410234f, 0.447793092f, 0.449176819f, 0.450561402f, 0.451946827f,
+    0.453333082f, 0.454720153f, 0.456108028f, 0.457496694f, 0.458886136f, 0.460276343f,
+    0.461667301f, 0.463058997f, 0.464451418f, 0.465844550f, 0.467238382f, 0.468632899f,
+    0.470028088f, 0.471423936f, 0.472820431f, 0.474217559f, 0.475615306f, 0.477013660f,
+    0.478412607f, 0.479812135f, 0.481212229f, 0.482612878f, 0.484014067f, 0.485415784f,
+    0.486818015f, 0.488220747f, 0.489623966f, 0.491027661f, 0.492431817f, 0.493836421f,
+    0.495241460f, 0.496646920f, 0.498052790f, 0.499459054f, 0.500865700f, 0.502272715f,
+    0.503680086f, 0.505087798f, 0.506495840f, 0.507904197f, 0.509312857f, 0.510721805f,
+    0.512131030f, 0.513540517f, 0.514950254f, 0.516360226f, 0.517770421f, 0.519180826f,
+    0.520591427f, 0.522002210f, 0.523413163f, 0.524824273f, 0.526235525f, 0.527646907f,
+    0.529058406f, 0.530470008f, 0.531881699f, 0.533293467f, 0.534705298f, 0.536117179f,
+    0.537529096f, 0.538941037f, 0.540352988f, 0.541764935f, 0.543176866f, 0.544588767f,
+    0.546000625f, 0.547412426f, 0.548824157f, 0.550235805f, 0.551647357f, 0.553058799f,
+    0.554470118f, 0.555881301f, 0.557292334f, 0.558703204f, 0.560113898f, 0.561524402f,
+    0.562934703f, 0.564344789f, 0.565754645f, 0.567164258f, 0.568573616f, 0.569982704f,
+    0.571391510f, 0.572800020f, 0.574208221f, 0.575616100f, 0.577023643f, 0.578430838f,
+    0.579837670f, 0.581244127f, 0.582650195f, 0.584055862f, 0.585461113f, 0.586865936f,
+    0.588270318f, 0.589674245f, 0.591077704f, 0.592480681f, 0.593883164f, 0.595285140f,
+    0.596686594f, 0.598087515f, 0.599487888f, 0.600887701f, 0.602286940f, 0.603685592f,
+    0.605083644f, 0.606481084f, 0.607877896f, 0.609274069f, 0.610669590f, 0.612064445f,
+    0.613458620f, 0.614852104f, 0.616244882f, 0.617636942f, 0.619028271f, 0.620418855f,
+    0.621808681f, 0.623197737f, 0.624586009f, 0.625973484f, 0.627360148f, 0.628745990f,
+    0.630130996f, 0.631515152f, 0.632898446f, 0.634280865f, 0.635662396f, 0.637043025f,
+    0.638422740f, 0.639801528f, 0.641179376f, 0.642556270f, 0.643932198f, 0.645307147f,
+    0.646681103f, 0.648054055f, 0.649425988f, 0.650796891f, 0.652166749f, 0.653535551f,
+    0.654903284f, 0.656269933f, 0.657635487f, 0.658999933f, 0.660363258f, 0.661725448f,
+    0.663086492f, 0.664446376f, 0.665805088f, 0.667162614f, 0.668518943f, 0.669874060f,
+    0.671227954f, 0.672580611f, 0.673932020f, 0.675282166f, 0.676631038f, 0.677978623f,
+    0.679324907f, 0.680669879f, 0.682013526f, 0.683355835f, 0.684696793f, 0.686036388f,
+    0.687374606f, 0.688711437f, 0.690046866f, 0.691380882f, 0.692713471f, 0.694044622f,
+    0.695374321f, 0.696702556f, 0.698029315f, 0.699354585f, 0.700678354f, 0.702000609f,
+    0.703321337f, 0.704640527f, 0.705958166f, 0.707274241f, 0.708588740f, 0.709901650f,
+    0.711212960f, 0.712522657f, 0.713830729f, 0.715137162f, 0.716441946f, 0.717745067f,
+    0.719046514f, 0.720346273f, 0.721644334f, 0.722940683f, 0.724235308f, 0.725528198f,
+    0.726819340f, 0.728108722f, 0.729396331f, 0.730682156f, 0.731966184f, 0.733248404f,
+    0.734528803f, 0.735807370f, 0.737084091f, 0.738358956f, 0.739631952f, 0.740903067f,
+    0.742172289f, 0.743439606f, 0.744705007f, 0.745968479f, 0.747230010f, 0.748489590f,
+    0.749747204f, 0.751002843f, 0.752256493f, 0.753508144f, 0.754757783f, 0.756005399f,
+    0.757250980f, 0.758494514f, 0.759735989f, 0.760975394f, 0.762212718f, 0.763447947f,
+    0.764681071f, 0.765912079f, 0.767140958f, 0.768367697f, 0.769592284f, 0.770814709f,
+    0.772034958f, 0.773253022f, 0.774468888f, 0.775682545f, 0.776893981f, 0.778103185f,
+    0.779310146f, 0.780514853f, 0.781717293f, 0.782917456f, 0.784115331f, 0.785310905f,
+    0.786504168f, 0.787695109f, 0.788883716f, 0.790069978f, 0.791253884f, 0.792435423f,
+    0.793614584f, 0.794791355f, 0.795965726f, 0.797137685f, 0.798307221f, 0.799474324f,
+    0.800638982f, 0.801801184f, 0.802960920f, 0.804118178f, 0.805272948f, 0.806425219f,
+    0.807574979f, 0.808722219f, 0.809866926f, 0.811009092f, 0.812148703f, 0.813285751f,
+    0.814420224f, 0.815552112f, 0.816681403f, 0.817808087f, 0.818932155f, 0.820053594f,
+    0.821172394f, 0.822288546f, 0.823402038f, 0.824512860f, 0.825621001f, 0.826726451f,
+    0.827829200f, 0.828929237f, 0.830026552f, 0.831121135f, 0.832212974f, 0.833302061f,
+    0.834388384f, 0.835471933f, 0.836552699f, 0.837630671f, 0.838705838f, 0.839778191f,
+    0.840847720f, 0.841914415f, 0.842978265f, 0.844039260f, 0.845097391f, 0.846152647f,
+    0.847205019f, 0.848254497f, 0.849301070f, 0.850344729f, 0.851385464f, 0.852423266f,
+    0.853458124f, 0.854490028f, 0.855518970f, 0.856544939f, 0.857567926f, 0.858587921f,
+    0.859604914f, 0.860618896f, 0.861629857f, 0.862637788f, 0.863642679f, 0.864644521f,
+    0.865643304f, 0.866639019f, 0.867631657f, 0.868621208f, 0.869607663f, 0.870591012f,
+    0.871571247f, 0.872548357f, 0.873522335f, 0.874493170f, 0.875460854f, 0.876425378f,
+    0.877386731f, 0.878344906f, 0.879299893f, 0.880251684f, 0.881200268f, 0.882145639f,
+    0.883087785f, 0.884026699f, 0.884962372f, 0.885894795f, 0.886823959f, 0.887749855f,
+    0.888672475f, 0.889591810f, 0.890507851f, 0.891420589f, 0.892330017f, 0.893236126f,
+    0.894138906f, 0.895038350f, 0.895934448f, 0.896827194f, 0.897716577f, 0.898602590f,
+    0.899485225f, 0.900364472f, 0.901240325f, 0.902112774f, 0.902981811f, 0.903847428f,
+    0.904709618f, 0.905568371f, 0.906423680f, 0.907275537f, 0.908123933f, 0.908968861f,
+    0.909810313f, 0.910648281f, 0.911482757f, 0.912313732f, 0.913141200f, 0.913965152f,
+    0.914785581f, 0.915602479f, 0.916415838f, 0.917225651f, 0.918031909f, 0.918834606f,
+    0.919633734f, 0.920429285f, 0.921221251f, 0.922009626f, 0.922794402f, 0.923575572f,
+    0.924353127f, 0.925127061f, 0.925897367f, 0.926664037f, 0.927427064f, 0.928186441f,
+    0.928942160f, 0.929694215f, 0.930442599f, 0.931187304f, 0.931928323f, 0.932665650f,
+    0.933399277f, 0.934129198f, 0.934855405f, 0.935577892f, 0.936296653f, 0.937011679f,
+    0.937722965f, 0.938430504f, 0.939134289f, 0.939834314f, 0.940530571f, 0.941223055f,
+    0.941911759f, 0.942596676f, 0.943277800f, 0.943955124f, 0.944628643f, 0.945298349f,
+    0.945964237f, 0.946626300f, 0.947284532f, 0.947938926f, 0.948589478f, 0.949236179f,
+    0.949879025f, 0.950518010f, 0.951153126f, 0.951784369f, 0.952411732f, 0.953035210f,
+    0.953654796f, 0.954270485f, 0.954882271f, 0.955490148f, 0.956094110f, 0.956694152f,
+    0.957290268f, 0.957882453f, 0.958470700f, 0.959055005f, 0.959635362f, 0.960211765f,
+    0.960784209f, 0.961352689f, 0.961917199f, 0.962477733f, 0.963034288f, 0.963586856f,
+    0.964135434f, 0.964680016f, 0.965220596f, 0.965757171f, 0.966289734f, 0.966818280f,
+    0.967342806f, 0.967863305f, 0.968379773f, 0.968892205f, 0.969400596f, 0.969904942f,
+    0.970405237f, 0.970901477f, 0.971393657f, 0.971881773f, 0.972365820f, 0.972845793f,
+    0.973321688f, 0.973793501f, 0.974261226f, 0.974724860f, 0.975184399f, 0.975639837f,
+    0.976091171f, 0.976538396f, 0.976981508f, 0.977420504f, 0.977855378f, 0.978286126f,
+    0.978712746f, 0.979135232f, 0.979553580f, 0.979967788f, 0.980377850f, 0.980783763f,
+    0.981185523f, 0.981583127f, 0.981976570f, 0.982365849f, 0.982750961f, 0.983131900f,
+    0.983508665f, 0.983881252f, 0.984249656f, 0.984613875f, 0.984973904f, 0.985329742f,
+    0.985681383f, 0.986028826f, 0.986372067f, 0.986711101f, 0.987045928f, 0.987376542f,
+    0.987702941f, 0.988025122f, 0.988343082f, 0.988656818f, 0.988966327f, 0.989271606f,
+    0.989572652f, 0.989869463f, 0.990162035f, 0.990450365f, 0.990734452f, 0.991014292f,
+    0.991289883f, 0.991561222f, 0.991828306f, 0.992091134f, 0.992349702f, 0.992604009f,
+    0.992854051f, 0.993099826f, 0.993341333f, 0.993578568f, 0.993811530f, 0.994040217f,
+    0.994264625f, 0.994484754f, 0.994700601f, 0.994912163f, 0.995119440f, 0.995322429f,
+    0.995521128f, 0.995715535f, 0.995905649f, 0.996091467f, 0.996272988f, 0.996450211f,
+    0.996623133f, 0.996791752f, 0.996956069f, 0.997116079f, 0.997271783f, 0.997423179f,
+    0.997570266f, 0.997713041f, 0.997851504f, 0.997985653f, 0.998115487f, 0.998241005f,
+    0.998362206f, 0.998479088f, 0.998591650f, 0.998699892f, 0.998803812f, 0.998903410f,
+    0.998998684f, 0.999089633f, 0.999176258f, 0.999258556f, 0.999336527f, 0.999410170f,
+    0.999479485f, 0.999544471f, 0.999605127f, 0.999661453f, 0.999713449f, 0.999761113f,
+    0.999804445f, 0.999843446f, 0.999878114f, 0.999908449f, 0.999934451f, 0.999956120f,
+    0.999973455f, 0.999986457f, 0.999995124f, 0.999999458f,
+};
+
+static const float g_pfWindow_hann_128[64] =
+{
+    0.000000000f, 0.000611792f, 0.002445670f, 0.005497148f, 0.009758756f, 0.015220068f,
+    0.021867716f, 0.029685435f, 0.038654092f, 0.048751740f, 0.059953669f, 0.072232464f,
+    0.085558078f, 0.099897901f, 0.115216841f, 0.131477409f, 0.148639814f, 0.166662057f,
+    0.185500033f, 0.205107643f, 0.225436905f, 0.246438068f, 0.268059740f, 0.290249008f,
+    0.312951573f, 0.336111876f, 0.359673241f, 0.383578009f, 0.407767681f, 0.432183061f,
+    0.456764400f, 0.481451544f, 0.506184080f, 0.530901482f, 0.555543263f, 0.580049120f,
+    0.604359083f, 0.628413663f, 0.652153992f, 0.675521975f, 0.698460427f, 0.720913213f,
+    0.742825387f, 0.764143326f, 0.784814863f, 0.804789410f, 0.824018086f, 0.842453836f,
+    0.860051543f, 0.876768145f, 0.892562731f, 0.907396651f, 0.921233603f, 0.934039725f,
+    0.945783680f, 0.956436727f, 0.965972797f, 0.974368554f, 0.981603451f, 0.987659784f,
+    0.992522732f, 0.996180394f, 0.998623819f, 0.999847029f,
+};
+
+static const float g_pfWindow_hann_256[128] =
+{
+    0.000000000f, 0.000151774f, 0.000607004f, 0.001365413f, 0.002426542f, 0.003789745f,
+    0.005454196f, 0.007418883f, 0.009682615f, 0.012244016f, 0.015101532f, 0.018253428f,
+    0.021697790f, 0.025432528f, 0.029455374f, 0.033763885f, 0.038355447f, 0.043227271f,
+    0.048376400f, 0.053799708f, 0.059493903f, 0.065455527f, 0.071680961f, 0.078166426f,
+    0.084907985f, 0.091901544f, 0.099142858f, 0.106627531f, 0.114351019f, 0.122308633f,
+    0.130495541f, 0.138906775f, 0.147537227f, 0.156381657f, 0.165434697f, 0.174690850f,
+    0.184144497f, 0.193789898f, 0.203621199f, 0.213632430f, 0.223817514f, 0.234170266f,
+    0.244684403f, 0.255353542f, 0.266171204f, 0.277130822f, 0.288225744f, 0.299449233f,
+    0.310794475f, 0.322254583f, 0.333822600f, 0.345491503f, 0.357254207f, 0.369103571f,
+    0.381032402f, 0.393033458f, 0.405099453f, 0.417223062f, 0.429396924f, 0.441613649f,
+    0.453865820f, 0.466145999f, 0.478446731f, 0.490760548f, 0.503079973f, 0.515397529f,
+    0.527705737f, 0.539997126f, 0.552264232f, 0.564499608f, 0.576695827f, 0.588845485f,
+    0.600941205f, 0.612975643f, 0.624941495f, 0.636831495f, 0.648638425f, 0.660355118f,
+    0.671974459f, 0.683489396f, 0.694892937f, 0.706178159f, 0.717338211f, 0.728366318f,
+    0.739255785f, 0.750000000f, 0.760592441f, 0.771026678f, 0.781296376f, 0.791395299f,
+    0.801317318f, 0.811056408f, 0.820606657f, 0.829962267f, 0.839117559f, 0.848066973f,
+    0.856805077f, 0.865326566f, 0.873626267f, 0.881699141f, 0.889540287f, 0.897144945f,
+    0.904508497f, 0.911626474f, 0.918494554f, 0.925108568f, 0.931464500f, 0.937558491f,
+    0.943386843f, 0.948946016f, 0.954232636f, 0.959243493f, 0.963975545f, 0.968425919f,
+    0.972591914f, 0.976471000f, 0.980060823f, 0.983359202f, 0.986364136f, 0.989073800f,
+    0.991486550f, 0.993600920f, 0.995415627f, 0.996929568f, 0.998141826f, 0.999051664f,
+    0.999658530f, 0.999962055f,
+};
+
+static const float g_pfWindow_hann_512[256] =
+{
+    0.000000000f, 0.000037797f, 0.000151181f, 0.000340135f, 0.000604631f, 0.000944629f,
+    0.001360077f, 0.001850913f, 0.002417062f, 0.003058438f, 0.003774946f, 0.004566476f,
+    0.005432908f, 0.006374113f, 0.007389947f, 0.008480256f, 0.009644877f, 0.010883633f,
+    0.012196337f, 0.013582789f, 0.015042782f, 0.016576093f, 0.018182492f, 0.019861734f,
+    0.021613567f, 0.023437725f, 0.025333934f, 0.027301905f, 0.029341341f, 0.031451935f,
+    0.033633367f, 0.035885307f, 0.038207415f, 0.040599339f, 0.043060719f, 0.045591181f,
+    0.048190344f, 0.050857815f, 0.053593189f, 0.056396054f, 0.059265986f, 0.062202551f,
+    0.065205305f, 0.068273794f, 0.071407554f, 0.074606112f, 0.077868983f, 0.081195674f,
+    0.084585683f, 0.088038497f, 0.091553594f, 0.095130442f, 0.098768501f, 0.102467221f,
+    0.106226043f, 0.110044397f, 0.113921708f, 0.117857388f, 0.121850843f, 0.125901469f,
+    0.130008654f, 0.134171776f, 0.138390206f, 0.142663307f, 0.146990432f, 0.151370928f,
+    0.155804131f, 0.160289372f, 0.164825973f, 0.169413247f, 0.174050502f, 0.178737036f,
+    0.183472140f, 0.188255099f, 0.193085190f, 0.197961681f, 0.202883837f, 0.207850913f,
+    0.212862158f, 0.217916814f, 0.223014117f, 0.228153297f, 0.233333576f, 0.238554171f,
+    0.243814294f, 0.249113148f, 0.254449933f, 0.259823842f, 0.265234062f, 0.270679775f,
+    0.276160159f, 0.281674384f, 0.287221617f, 0.292801019f, 0.298411747f, 0.304052952f,
+    0.309723782f, 0.315423378f, 0.321150881f, 0.326905422f, 0.332686134f, 0.338492141f,
+    0.344322565f, 0.350176526f, 0.356053138f, 0.361951513f, 0.367870760f, 0.373809982f,
+    0.379768282f, 0.385744760f, 0.391738511f, 0.397748631f, 0.403774209f, 0.409814335f,
+    0.415868096f, 0.421934577f, 0.428012860f, 0.434102027f, 0.440201156f, 0.446309327f,
+    0.452425614f, 0.458549094f, 0.464678841f, 0.470813928f, 0.476953428f, 0.483096412f,
+    0.489241951f, 0.495389117f, 0.501536980f, 0.507684611f, 0.513831080f, 0.519975458f,
+    0.526116815f, 0.532254225f, 0.538386758f, 0.544513487f, 0.550633486f, 0.556745831f,
+    0.562849596f, 0.568943859f, 0.575027699f, 0.581100196f, 0.587160431f, 0.593207489f,
+    0.599240456f, 0.605258418f, 0.611260467f, 0.617245695f, 0.623213197f, 0.629162070f,
+    0.635091417f, 0.641000339f, 0.646887944f, 0.652753341f, 0.658595644f, 0.664413970f,
+    0.670207439f, 0.675975174f, 0.681716305f, 0.687429962f, 0.693115283f, 0.698771407f,
+    0.704397480f, 0.709992651f, 0.715556073f, 0.721086907f, 0.726584315f, 0.732047467f,
+    0.737475536f, 0.742867702f, 0.748223150f, 0.753541070f, 0.758820659f, 0.764061117f,
+    0.769261652f, 0.774421479f, 0.779539817f, 0.784615893f, 0.789648938f, 0.794638193f,
+    0.799582902f, 0.804482319f, 0.809335702f, 0.814142317f, 0.818901439f, 0.823612347f,
+    0.828274329f, 0.832886681f, 0.837448705f, 0.841959711f, 0.846419017f, 0.850825950f,
+    0.855179843f, 0.859480037f, 0.863725883f, 0.867916738f, 0.872051970f, 0.876130952f,
+    0.880153069f, 0.884117711f, 0.888024281f, 0.891872186f, 0.895660845f, 0.899389686f,
+    0.903058145f, 0.906665667f, 0.910211707f, 0.913695728f, 0.917117204f, 0.920475618f,
+    0.923770461f, 0.927001237f, 0.930167455f, 0.933268638f, 0.936304317f, 0.939274033f,
+    0.942177336f, 0.945013788f, 0.947782960f, 0.950484434f, 0.953117800f, 0.955682662f,
+    0.958178630f, 0.960605328f, 0.962962389f, 0.965249456f, 0.967466184f, 0.969612237f,
+    0.971687291f, 0.973691033f, 0.975623159f, 0.977483377f, 0.979271407f, 0.980986977f,
+    0.982629829f, 0.984199713f, 0.985696393f, 0.987119643f, 0.988469246f, 0.989745000f,
+    0.990946711f, 0.992074198f, 0.993127290f, 0.994105827f, 0.995009663f, 0.995838660f,
+    0.996592693f, 0.997271648f, 0.997875422f, 0.998403924f, 0.998857075f, 0.999234805f,
+    0.999537058f, 0.999763787f, 0.999914959f, 0.999990551f,
+};
+
+static const float g_pfWindow_hann_2048[1024] =
+{
+    0.000000000f, 0.000002355f, 0.000009422f, 0.000021198f, 0.000037686f, 0.000058884f,
+    0.000084792f, 0.000115410f, 0.000150738f, 0.000190775f, 0.000235521f, 0.000284976f,
+    0.000339139f, 0.000398009f, 0.000461587f, 0.000529871f, 0.000602860f, 0.000680555f,
+    0.000762954f, 0.000850057f, 0.000941863f, 0.001038370f, 0.001139579f, 0.001245487f,
+    0.001356095f, 0.001471401f, 0.001591403f, 0.001716102f, 0.001845495f, 0.001979581f,
+    0.002118360f, 0.002261829f, 0.002409988f, 0.002562835f, 0.002720368f, 0.002882587f,
+    0.003049489f, 0.003221074f, 0.003397339f, 0.003578282f, 0.003763903f, 0.003954199f,
+    0.004149168f, 0.004348810f, 0.004553121f, 0.004762100f, 0.004975745f, 0.005194054f,
+    0.005417024f, 0.005644655f, 0.005876943f, 0.006113886f, 0.006355483f, 0.006601730f,
+    0.006852626f, 0.007108169f, 0.007368355f, 0.007633183f, 0.007902649f, 0.008176752f,
+    0.008455488f, 0.008738856f, 0.009026852f, 0.009319474f, 0.009616719f, 0.009918584f,
+    0.010225066f, 0.010536163f, 0.010851871f, 0.011172188f, 0.011497110f, 0.011826635f,
+    0.012160760f, 0.012499480f, 0.012842793f, 0.013190697f, 0.013543186f, 0.013900259f,
+    0.014261912f, 0.014628141f, 0.014998944f, 0.015374315f, 0.015754253f, 0.016138753f,
+    0.016527812f, 0.016921425f, 0.017319590f, 0.017722303f, 0.018129560f, 0.018541356f,
+    0.018957689f, 0.019378554f, 0.019803947f, 0.020233864f, 0.020668301f, 0.021107255f,
+    0.021550720f, 0.021998693f, 0.022451170f, 0.022908146f, 0.023369617f, 0.023835578f,
+    0.024306026f, 0.024780956f, 0.025260362f, 0.025744242f, 0.026232590f, 0.026725401f,
+    0.027222672f, 0.027724397f, 0.028230571f, 0.028741190f, 0.029256249f, 0.029775744f,
+    0.030299668f, 0.030828018f, 0.031360788f, 0.031897974f, 0.032439570f, 0.032985571f,
+    0.033535972f, 0.034090768f, 0.034649953f, 0.035213523f, 0.035781472f, 0.036353794f,
+    0.036930485f, 0.037511539f, 0.038096949f, 0.038686712f, 0.039280821f, 0.039879271f,
+    0.040482056f, 0.041089170f, 0.041700608f, 0.042316364f, 0.042936432f, 0.043560806f,
+    0.044189481f, 0.044822450f, 0.045459707f, 0.046101247f, 0.046747064f, 0.047397151f,
+    0.048051502f, 0.048710111f, 0.049372972f, 0.050040078f, 0.050711424f, 0.051387003f,
+    0.052066809f, 0.052750835f, 0.053439074f, 0.054131521f, 0.054828169f, 0.055529011f,
+    0.056234040f, 0.056943251f, 0.057656636f, 0.058374188f, 0.059095901f, 0.059821769f,
+    0.060551783f, 0.061285938f, 0.062024226f, 0.062766640f, 0.063513174f, 0.064263820f,
+    0.065018572f, 0.065777422f, 0.066540363f, 0.067307388f, 0.068078489f, 0.068853660f,
+    0.069632893f, 0.070416180f, 0.071203515f, 0.071994890f, 0.072790298f, 0.073589730f,
+    0.074393180f, 0.075200640f, 0.076012102f, 0.076827558f, 0.077647002f, 0.078470425f,
+    0.079297819f, 0.080129177f, 0.080964491f, 0.081803753f, 0.082646955f, 0.083494089f,
+    0.084345147f, 0.085200121f, 0.086059004f, 0.086921786f, 0.087788460f, 0.088659018f,
+    0.089533451f, 0.090411752f, 0.091293912f, 0.092179922f, 0.093069774f, 0.093963461f,
+    0.094860973f, 0.095762302f, 0.096667439f, 0.097576377f, 0.098489106f, 0.099405618f,
+    0.100325904f, 0.101249956f, 0.102177764f, 0.103109321f, 0.104044617f, 0.104983644f,
+    0.105926392f, 0.106872853f, 0.107823018f, 0.108776878f, 0.109734424f, 0.110695646f,
+    0.111660537f, 0.112629086f, 0.113601285f, 0.114577125f, 0.115556595f, 0.116539688f,
+    0.117526394f, 0.118516703f, 0.119510606f, 0.120508094f, 0.121509158f, 0.122513787f,
+    0.123521973f, 0.124533706f, 0.125548977f, 0.126567775f, 0.127590092f, 0.128615917f,
+    0.129645242f, 0.130678056f, 0.131714349f, 0.132754112f, 0.133797336f, 0.134844009f,
+    0.135894123f, 0.136947667f, 0.138004632f, 0.139065007f, 0.140128783f, 0.141195950f,
+    0.142266497f, 0.143340414f, 0.144417692f, 0.145498320f, 0.146582288f, 0.147669585f,
+    0.148760202f, 0.149854129f, 0.150951354f, 0.152051868f, 0.153155660f, 0.154262720f,
+    0.155373037f, 0.156486601f, 0.157603402f, 0.158723428f, 0.159846670f, 0.160973117f,
+    0.162102758f, 0.163235582f, 0.164371580f, 0.165510739f, 0.166653050f, 0.167798501f,
+    0.168947083f, 0.170098783f, 0.171253592f, 0.172411497f, 0.173572490f, 0.174736557f,
+    0.175903690f, 0.177073875f, 0.178247104f, 0.179423363f, 0.180602643f, 0.181784932f,
+    0.182970220f, 0.184158494f, 0.185349744f, 0.186543958f, 0.187741126f, 0.188941236f,
+    0.190144276f, 0.191350236f, 0.192559103f, 0.193770867f, 0.194985517f, 0.196203040f,
+    0.197423425f, 0.198646661f, 0.199872737f, 0.201101640f, 0.202333359f, 0.203567882f,
+    0.204805199f, 0.206045296f, 0.207288163f, 0.208533788f, 0.209782159f, 0.211033265f,
+    0.212287092f, 0.213543631f, 0.214802868f, 0.216064793f, 0.217329392f, 0.218596655f,
+    0.219866569f, 0.221139123f, 0.222414303f, 0.223692099f, 0.224972498f, 0.226255489f,
+    0.227541058f, 0.228829195f, 0.230119886f, 0.231413120f, 0.232708885f, 0.234007167f,
+    0.235307956f, 0.236611239f, 0.237917003f, 0.239225237f, 0.240535927f, 0.241849062f,
+    0.243164629f, 0.244482616f, 0.245803011f, 0.247125800f, 0.248450972f, 0.249778514f,
+    0.251108413f, 0.252440657f, 0.253775233f, 0.255112130f, 0.256451334f, 0.257792832f,
+    0.259136612f, 0.260482662f, 0.261830968f, 0.263181518f, 0.264534299f, 0.265889299f,
+    0.267246504f, 0.268605903f, 0.269967481f, 0.271331227f, 0.272697127f, 0.274065169f,
+    0.275435339f, 0.276807625f, 0.278182014f, 0.279558493f, 0.280937049f, 0.282317668f,
+    0.283700339f, 0.285085047f, 0.286471781f, 0.287860526f, 0.289251269f, 0.290643999f,
+    0.292038700f, 0.293435362f, 0.294833969f, 0.296234509f, 0.297636969f, 0.299041336f,
+    0.300447596f, 0.301855736f, 0.303265743f, 0.304677603f, 0.306091304f, 0.307506832f,
+    0.308924173f, 0.310343314f, 0.311764243f, 0.313186944f, 0.314611406f, 0.316037615f,
+    0.317465557f, 0.318895218f, 0.320326586f, 0.321759646f, 0.323194386f, 0.324630792f,
+    0.326068850f, 0.327508547f, 0.328949869f, 0.330392802f, 0.331837333f, 0.333283449f,
+    0.334731135f, 0.336180379f, 0.337631166f, 0.339083483f, 0.340537315f, 0.341992651f,
+    0.343449475f, 0.344907773f, 0.346367533f, 0.347828741f, 0.349291382f, 0.350755443f,
+    0.352220911f, 0.353687770f, 0.355156008f, 0.356625611f, 0.358096564f, 0.359568855f,
+    0.361042468f, 0.362517391f, 0.363993609f, 0.365471109f, 0.366949876f, 0.368429896f,
+    0.369911156f, 0.371393642f, 0.372877339f, 0.374362234f, 0.375848313f, 0.377335562f,
+    0.378823966f, 0.380313512f, 0.381804185f, 0.383295972f, 0.384788859f, 0.386282831f,
+    0.387777874f, 0.389273975f, 0.390771119f, 0.392269292f, 0.393768480f, 0.395268669f,
+    0.396769845f, 0.398271993f, 0.399775100f, 0.401279151f, 0.402784132f, 0.404290029f,
+    0.405796828f, 0.407304515f, 0.408813074f, 0.410322493f, 0.411832757f, 0.413343851f,
+    0.414855762f, 0.416368475f, 0.417881976f, 0.419396251f, 0.420911285f, 0.422427064f,
+    0.423943574f, 0.425460800f, 0.426978729f, 0.428497346f, 0.430016637f, 0.431536587f,
+    0.433057182f, 0.434578407f, 0.436100249f, 0.437622693f, 0.439145725f, 0.440669330f,
+    0.442193494f, 0.443718203f, 0.445243442f, 0.446769197f, 0.448295453f, 0.449822197f,
+    0.451349413f, 0.452877087f, 0.454405206f, 0.455933754f, 0.457462718f, 0.458992082f,
+    0.460521832f, 0.462051955f, 0.463582435f, 0.465113258f, 0.466644409f, 0.468175875f,
+    0.469707641f, 0.471239693f, 0.472772015f, 0.474304593f, 0.475837414f, 0.477370463f,
+    0.478903725f, 0.480437185f, 0.481970830f, 0.483504644f, 0.485038614f, 0.486572725f,
+    0.488106963f, 0.489641313f, 0.491175760f, 0.492710290f, 0.494244889f, 0.495779542f,
+    0.497314235f, 0.498848953f, 0.500383683f, 0.501918408f, 0.503453115f, 0.504987790f,
+    0.506522418f, 0.508056985f, 0.509591475f, 0.511125875f, 0.512660171f, 0.514194347f,
+    0.515728389f, 0.517262283f, 0.518796015f, 0.520329569f, 0.521862932f, 0.523396089f,
+    0.524929025f, 0.526461727f, 0.527994179f, 0.529526368f, 0.531058278f, 0.532589896f,
+    0.534121207f, 0.535652196f, 0.537182849f, 0.538713152f, 0.540243090f, 0.541772650f,
+    0.543301815f, 0.544830573f, 0.546358908f, 0.547886806f, 0.549414254f, 0.550941235f,
+    0.552467737f, 0.553993744f, 0.555519243f, 0.557044219f, 0.558568657f, 0.560092543f,
+    0.561615863f, 0.563138603f, 0.564660748f, 0.566182284f, 0.567703196f, 0.569223470f,
+    0.570743092f, 0.572262047f, 0.573780322f, 0.575297902f, 0.576814772f, 0.578330918f,
+    0.579846326f, 0.581360983f, 0.582874872f, 0.584387981f, 0.585900295f, 0.587411799f,
+    0.588922480f, 0.590432323f, 0.591941314f, 0.593449439f, 0.594956683f, 0.596463033f,
+    0.597968474f, 0.599472991f, 0.600976572f, 0.602479201f, 0.603980865f, 0.605481549f,
+    0.606981240f, 0.608479922f, 0.609977582f, 0.611474206f, 0.612969780f, 0.614464290f,
+    0.615957721f, 0.617450060f, 0.618941292f, 0.620431403f, 0.621920380f, 0.623408208f,
+    0.624894873f, 0.626380362f, 0.627864660f, 0.629347753f, 0.630829628f, 0.632310270f,
+    0.633789665f, 0.635267800f, 0.636744661f, 0.638220233f, 0.639694503f, 0.641167457f,
+    0.642639080f, 0.644109360f, 0.645578282f, 0.647045833f, 0.648511998f, 0.649976764f,
+    0.651440117f, 0.652902043f, 0.654362528f, 0.655821560f, 0.657279123f, 0.658735204f,
+    0.660189790f, 0.661642866f, 0.663094420f, 0.664544437f, 0.665992903f, 0.667439806f,
+    0.668885131f, 0.670328865f, 0.671770995f, 0.673211506f, 0.674650385f, 0.676087618f,
+    0.677523193f, 0.678957095f, 0.680389310f, 0.681819827f, 0.683248630f, 0.684675707f,
+    0.686101044f, 0.687524627f, 0.688946444f, 0.690366481f, 0.691784724f, 0.693201160f,
+    0.694615776f, 0.696028558f, 0.697439493f, 0.698848568f, 0.700255770f, 0.701661085f,
+    0.703064500f, 0.704466002f, 0.705865577f, 0.707263213f, 0.708658896f, 0.710052613f,
+    0.711444352f, 0.712834098f, 0.714221838f, 0.715607561f, 0.716991252f, 0.718372899f,
+    0.719752488f, 0.721130007f, 0.722505442f, 0.723878782f, 0.725250011f, 0.726619119f,
+    0.727986092f, 0.729350916f, 0.730713580f, 0.732074070f, 0.733432373f, 0.734788478f,
+    0.736142370f, 0.737494037f, 0.738843467f, 0.740190646f, 0.741535563f, 0.742878203f,
+    0.744218556f, 0.745556607f, 0.746892346f, 0.748225758f, 0.749556831f, 0.750885553f,
+    0.752211911f, 0.753535893f, 0.754857487f, 0.756176679f, 0.757493457f, 0.758807810f,
+    0.760119724f, 0.761429188f, 0.762736188f, 0.764040713f, 0.765342751f, 0.766642288f,
+    0.767939313f, 0.769233814f, 0.770525778f, 0.771815194f, 0.773102048f, 0.774386330f,
+    0.775668026f, 0.776947125f, 0.778223615f, 0.779497483f, 0.780768718f, 0.782037308f,
+    0.783303241f, 0.784566504f, 0.785827087f, 0.787084976f, 0.788340161f, 0.789592629f,
+    0.790842369f, 0.792089368f, 0.793333616f, 0.794575100f, 0.795813808f, 0.797049729f,
+    0.798282852f, 0.799513165f, 0.800740655f, 0.801965312f, 0.803187125f, 0.804406080f,
+    0.805622168f, 0.806835376f, 0.808045693f, 0.809253108f, 0.810457610f, 0.811659186f,
+    0.812857826f, 0.814053519f, 0.815246252f, 0.816436016f, 0.817622798f, 0.818806588f,
+    0.819987374f, 0.821165145f, 0.822339890f, 0.823511598f, 0.824680259f, 0.825845860f,
+    0.827008392f, 0.828167842f, 0.829324201f, 0.830477456f, 0.831627599f, 0.832774616f,
+    0.833918499f, 0.835059235f, 0.836196815f, 0.837331227f, 0.838462461f, 0.839590506f,
+    0.840715352f, 0.841836987f, 0.842955402f, 0.844070586f, 0.845182528f, 0.846291218f,
+    0.847396645f, 0.848498800f, 0.849597670f, 0.850693247f, 0.851785520f, 0.852874479f,
+    0.853960113f, 0.855042412f, 0.856121366f, 0.857196965f, 0.858269199f, 0.859338057f,
+    0.860403529f, 0.861465606f, 0.862524277f, 0.863579533f, 0.864631363f, 0.865679758f,
+    0.866724708f, 0.867766202f, 0.868804232f, 0.869838787f, 0.870869857f, 0.871897433f,
+    0.872921506f, 0.873942064f, 0.874959100f, 0.875972603f, 0.876982564f, 0.877988973f,
+    0.878991820f, 0.879991097f, 0.880986794f, 0.881978902f, 0.882967410f, 0.883952311f,
+    0.884933593f, 0.885911250f, 0.886885270f, 0.887855645f, 0.888822366f, 0.889785424f,
+    0.890744810f, 0.891700513f, 0.892652527f, 0.893600841f, 0.894545447f, 0.895486335f,
+    0.896423498f, 0.897356925f, 0.898286609f, 0.899212540f, 0.900134710f, 0.901053110f,
+    0.901967732f, 0.902878566f, 0.903785605f, 0.904688839f, 0.905588261f, 0.906483861f,
+    0.907375632f, 0.908263564f, 0.909147650f, 0.910027881f, 0.910904249f, 0.911776746f,
+    0.912645363f, 0.913510092f, 0.914370925f, 0.915227855f, 0.916080872f, 0.916929969f,
+    0.917775138f, 0.918616371f, 0.919453660f, 0.920286997f, 0.921116374f, 0.921941783f,
+    0.922763218f, 0.923580669f, 0.924394129f, 0.925203591f, 0.926009047f, 0.926810489f,
+    0.927607910f, 0.928401302f, 0.929190658f, 0.929975970f, 0.930757231f, 0.931534434f,
+    0.932307571f, 0.933076635f, 0.933841619f, 0.934602515f, 0.935359316f, 0.936112016f,
+    0.936860607f, 0.937605082f, 0.938345435f, 0.939081657f, 0.939813742f, 0.940541684f,
+    0.941265475f, 0.941985109f, 0.942700578f, 0.943411877f, 0.944118997f, 0.944821934f,
+    0.945520680f, 0.946215228f, 0.946905572f, 0.947591705f, 0.948273622f, 0.948951315f,
+    0.949624778f, 0.950294005f, 0.950958990f, 0.951619726f, 0.952276206f, 0.952928426f,
+    0.953576379f, 0.954220058f, 0.954859457f, 0.955494571f, 0.956125394f, 0.956751919f,
+    0.957374141f, 0.957992053f, 0.958605651f, 0.959214928f, 0.959819878f, 0.960420496f,
+    0.961016776f, 0.961608713f, 0.962196300f, 0.962779533f, 0.963358406f, 0.963932913f,
+    0.964503050f, 0.965068810f, 0.965630188f, 0.966187179f, 0.966739778f, 0.967287980f,
+    0.967831779f, 0.968371170f, 0.968906149f, 0.969436710f, 0.969962847f, 0.970484558f,
+    0.971001835f, 0.971514675f, 0.972023072f, 0.972527022f, 0.973026520f, 0.973521562f,
+    0.974012142f, 0.974498257f, 0.974979900f, 0.975457069f, 0.975929758f, 0.976397963f,
+    0.976861680f, 0.977320904f, 0.977775631f, 0.978225856f, 0.978671576f, 0.979112786f,
+    0.979549482f, 0.979981660f, 0.980409315f, 0.980832445f, 0.981251044f, 0.981665109f,
+    0.982074636f, 0.982479621f, 0.982880061f, 0.983275951f, 0.983667287f, 0.984054067f,
+    0.984436286f, 0.984813941f, 0.985187029f, 0.985555545f, 0.985919486f, 0.986278850f,
+    0.986633632f, 0.986983828f, 0.987329437f, 0.987670455f, 0.988006877f, 0.988338702f,
+    0.988665926f, 0.988988546f, 0.989306559f, 0.989619962f, 0.989928752f, 0.990232926f,
+    0.990532481f, 0.990827415f, 0.991117724f, 0.991403407f, 0.991684459f, 0.991960879f,
+    0.992232664f, 0.992499811f, 0.992762318f, 0.993020183f, 0.993273403f, 0.993521975f,
+    0.993765897f, 0.994005167f, 0.994239783f, 0.994469743f, 0.994695044f, 0.994915684f,
+    0.995131661f, 0.995342973f, 0.995549618f, 0.995751595f, 0.995948900f, 0.996141533f,
+    0.996329492f, 0.996512774f, 0.996691379f, 0.996865304f, 0.997034547f, 0.997199108f,
+    0.997358984f, 0.997514175f, 0.997664678f, 0.997810492f, 0.997951616f, 0.998088049f,
+    0.998219789f, 0.998346834f, 0.998469185f, 0.998586839f, 0.998699796f, 0.998808054f,
+    0.998911613f, 0.999010471f, 0.999104628f, 0.999194082f, 0.999278833f, 0.999358880f,
+    0.999434223f, 0.999504860f, 0.999570790f, 0.999632014f, 0.999688531f, 0.999740340f,
+    0.999787441f, 0.999829832f, 0.999867515f, 0.999900488f, 0.999928751f, 0.999952304f,
+    0.999971147f, 0.999985279f, 0.999994700f, 0.999999411f,
+};
+
+static const float g_pfWindow_blackman_harris_128[64] =
+{
+    0.000060000f, 0.000094828f, 0.000201788f, 0.000388303f, 0.000666743f, 0.001054417f,
+    0.001573565f, 0.002251325f, 0.003119696f, 0.004215468f, 0.005580118f, 0.007259678f,
+    0.009304539f, 0.011769214f, 0.014712027f, 0.018194740f, 0.022282100f, 0.027041313f,
+    0.032541427f, 0.038852640f, 0.046045525f, 0.054190174f, 0.063355267f, 0.073607083f,
+    0.085008445f, 0.097617627f, 0.111487231f, 0.126663038f, 0.143182876f, 0.161075498f,
+    0.180359498f, 0.201042294f, 0.223119180f, 0.246572490f, 0.271370864f, 0.297468666f,
+    0.324805546f, 0.353306176f, 0.382880163f, 0.413422161f, 0.444812180f, 0.476916094f,
+    0.509586369f, 0.542662983f, 0.575974550f, 0.609339637f, 0.642568254f, 0.675463510f,
+    0.707823413f, 0.739442795f, 0.770115327f, 0.799635616f, 0.827801348f, 0.854415434f,
+    0.879288158f, 0.902239265f, 0.923099990f, 0.941714967f, 0.957944015f, 0.971663765f,
+    0.982769101f, 0.991174391f, 0.996814508f, 0.999645596f,
+};
+
+static const float g_pfWindow_blackman_harris_256[128] =
+{
+    0.000060000f, 0.000068600f, 0.000094554f, 0.000138318f, 0.000200653f, 0.000282625f,
+    0.000385604f, 0.000511264f, 0.000661583f, 0.000838845f, 0.001045633f, 0.001284836f,
+    0.001559643f, 0.001873546f, 0.002230333f, 0.002634091f, 0.003089203f, 0.003600342f,
+    0.004172473f, 0.004810844f, 0.005520985f, 0.006308700f, 0.007180064f, 0.008141413f,
+    0.009199339f, 0.010360679f, 0.011632507f, 0.013022120f, 0.014537032f, 0.016184953f,
+    0.017973782f, 0.019911588f, 0.022006594f, 0.024267157f, 0.026701753f, 0.029318953f,
+    0.032127403f, 0.035135798f, 0.038352864f, 0.041787326f, 0.045447885f, 0.049343189f,
+    0.053481803f, 0.057872185f, 0.062522645f, 0.067441323f, 0.072636151f, 0.078114821f,
+    0.083884754f, 0.089953060f, 0.096326508f, 0.103011489f, 0.110013984f, 0.117339523f,
+    0.124993156f, 0.132979414f, 0.141302277f, 0.149965142f, 0.158970784f, 0.168321331f,
+    0.178018227f, 0.188062207f, 0.198453265f, 0.209190627f, 0.220272728f, 0.231697186f,
+    0.243460781f, 0.255559434f, 0.267988192f, 0.280741210f, 0.293811741f, 0.307192124f,
+    0.320873774f, 0.334847183f, 0.349101913f, 0.363626600f, 0.378408956f, 0.393435776f,
+    0.408692949f, 0.424165472f, 0.439837465f, 0.455692188f, 0.471712071f, 0.487878733f,
+    0.504173012f, 0.520575000f, 0.537064076f, 0.553618943f, 0.570217671f, 0.586837740f,
+    0.603456084f, 0.620049142f, 0.636592910f, 0.653062992f, 0.669434657f, 0.685682894f,
+    0.701782477f, 0.717708020f, 0.733434041f, 0.748935027f, 0.764185496f, 0.779160064f,
+    0.793833511f, 0.808180844f, 0.822177367f, 0.835798746f, 0.849021071f, 0.861820927f,
+    0.874175455f, 0.886062413f, 0.897460245f, 0.908348133f, 0.918706061f, 0.928514872f,
+    0.937756320f, 0.946413122f, 0.954469011f, 0.961908783f, 0.968718334f, 0.974884713f,
+    0.980396148f, 0.985242088f, 0.989413232f, 0.992901556f, 0.995700336f, 0.997804170f,
+    0.999208991f, 0.999912082f,
+};
+
+static const float g_pfWindow_blackman_harris_512[256] =
+{
+    0.000060000f, 0.000062139f, 0.000068567f, 0.000079311f, 0.000094418f, 0.000113956f,
+    0.000138008f, 0.000166678f, 0.000200090f, 0.000238385f, 0.000281723f, 0.000330284f,
+    0.000384266f, 0.000443887f, 0.000509381f, 0.000581003f, 0.000659029f, 0.000743749f,
+    0.000835475f, 0.000934538f, 0.001041285f, 0.001156085f, 0.001279324f, 0.001411406f,
+    0.001552756f, 0.001703815f, 0.001865045f, 0.002036924f, 0.002219951f, 0.002414641f,
+    0.002621529f, 0.002841168f, 0.003074128f, 0.003320998f, 0.003582385f, 0.003858913f,
+    0.004151226f, 0.004459982f, 0.004785858f, 0.005129551f, 0.005491770f, 0.005873246f,
+    0.006274722f, 0.006696961f, 0.007140742f, 0.007606857f, 0.008096118f, 0.008609349f,
+    0.009147392f, 0.009711102f, 0.010301350f, 0.010919021f, 0.011565014f, 0.012240241f,
+    0.012945628f, 0.013682114f, 0.014450649f, 0.015252198f, 0.016087735f, 0.016958245f,
+    0.017864726f, 0.018808184f, 0.019789635f, 0.020810105f, 0.021870628f, 0.022972246f,
+    0.024116007f, 0.025302967f, 0.026534189f, 0.027810740f, 0.029133691f, 0.030504118f,
+    0.031923102f, 0.033391723f, 0.034911066f, 0.036482216f, 0.038106256f, 0.039784271f,
+    0.041517345f, 0.043306558f, 0.045152987f, 0.047057707f, 0.049021785f, 0.051046284f,
+    0.053132261f, 0.055280764f, 0.057492832f, 0.059769496f, 0.062111775f, 0.064520677f,
+    0.066997196f, 0.069542316f, 0.072157001f, 0.074842205f, 0.077598860f, 0.080427884f,
+    0.083330175f, 0.086306609f, 0.089358044f, 0.092485315f, 0.095689233f, 0.098970584f,
+    0.102330131f, 0.105768609f, 0.109286726f, 0.112885161f, 0.116564564f, 0.120325552f,
+    0.124168714f, 0.128094602f, 0.132103737f, 0.136196603f, 0.140373650f, 0.144635289f,
+    0.148981894f, 0.153413799f, 0.157931299f, 0.162534646f, 0.167224053f, 0.171999686f,
+    0.176861672f, 0.181810088f, 0.186844969f, 0.191966303f, 0.197174028f, 0.202468037f,
+    0.207848172f, 0.213314227f, 0.218865944f, 0.224503014f, 0.230225076f, 0.236031719f,
+    0.241922475f, 0.247896825f, 0.253954195f, 0.260093957f, 0.266315427f, 0.272617865f,
+    0.279000478f, 0.285462412f, 0.292002761f, 0.298620559f, 0.305314784f, 0.312084356f,
+    0.318928139f, 0.325844940f, 0.332833504f, 0.339892524f, 0.347020633f, 0.354216405f,
+    0.361478359f, 0.368804956f, 0.376194600f, 0.383645639f, 0.391156364f, 0.398725009f,
+    0.406349756f, 0.414028727f, 0.421759994f, 0.429541572f, 0.437371423f, 0.445247459f,
+    0.453167536f, 0.461129461f, 0.469130991f, 0.477169832f, 0.485243642f, 0.493350031f,
+    0.501486563f, 0.509650756f, 0.517840082f, 0.526051972f, 0.534283813f, 0.542532951f,
+    0.550796694f, 0.559072308f, 0.567357026f, 0.575648043f, 0.583942519f, 0.592237583f,
+    0.600530332f, 0.608817833f, 0.617097126f, 0.625365222f, 0.633619111f, 0.641855755f,
+    0.650072098f, 0.658265065f, 0.666431559f, 0.674568472f, 0.682672677f, 0.690741038f,
+    0.698770407f, 0.706757627f, 0.714699536f, 0.722592966f, 0.730434747f, 0.738221706f,
+    0.745950675f, 0.753618486f, 0.761221978f, 0.768757997f, 0.776223397f, 0.783615045f,
+    0.790929821f, 0.798164619f, 0.805316354f, 0.812381956f, 0.819358380f, 0.826242603f,
+    0.833031629f, 0.839722488f, 0.846312241f, 0.852797980f, 0.859176830f, 0.865445954f,
+    0.871602550f, 0.877643858f, 0.883567158f, 0.889369772f, 0.895049071f, 0.900602469f,
+    0.906027432f, 0.911321475f, 0.916482166f, 0.921507126f, 0.926394035f, 0.931140627f,
+    0.935744698f, 0.940204101f, 0.944516755f, 0.948680641f, 0.952693805f, 0.956554361f,
+    0.960260489f, 0.963810440f, 0.967202534f, 0.970435164f, 0.973506796f, 0.976415969f,
+    0.979161297f, 0.981741473f, 0.984155264f, 0.986401515f, 0.988479152f, 0.990387179f,
+    0.992124681f, 0.993690823f, 0.995084854f, 0.996306103f, 0.997353982f, 0.998227987f,
+    0.998927697f, 0.999452775f, 0.999802967f, 0.999978106f,
+};
+
+static const float g_pfWindow_blackman_harris_2048[1024] =
+{
+    0.000060000f, 0.000060133f, 0.000060533f, 0.000061200f, 0.000062133f, 0.000063334f,
+    0.000064802f, 0.000066537f, 0.000068542f, 0.000070815f, 0.000073357f, 0.000076170f,
+    0.000079254f, 0.000082610f, 0.000086238f, 0.000090140f, 0.000094317f, 0.000098770f,
+    0.000103500f, 0.000108508f, 0.000113796f, 0.000119366f, 0.000125218f, 0.000131354f,
+    0.000137776f, 0.000144486f, 0.000151486f, 0.000158776f, 0.000166360f, 0.000174240f,
+    0.000182416f, 0.000190893f, 0.000199671f, 0.000208753f, 0.000218141f, 0.000227839f,
+    0.000237848f, 0.000248171f, 0.000258810f, 0.000269770f, 0.000281051f, 0.000292658f,
+    0.000304593f, 0.000316859f, 0.000329459f, 0.000342397f, 0.000355676f, 0.000369299f,
+    0.000383269f, 0.000397590f, 0.000412266f, 0.000427301f, 0.000442697f, 0.000458458f,
+    0.000474589f, 0.000491094f, 0.000507976f, 0.000525240f, 0.000542889f, 0.000560928f,
+    0.000579361f, 0.000598193f, 0.000617428f, 0.000637070f, 0.000657124f, 0.000677594f,
+    0.000698487f, 0.000719805f, 0.000741554f, 0.000763740f, 0.000786366f, 0.000809439f,
+    0.000832963f, 0.000856943f, 0.000881385f, 0.000906295f, 0.000931677f, 0.000957537f,
+    0.000983881f, 0.001010715f, 0.001038043f, 0.001065873f, 0.001094210f, 0.001123059f,
+    0.001152428f, 0.001182321f, 0.001212746f, 0.001243708f, 0.001275214f, 0.001307271f,
+    0.001339883f, 0.001373059f, 0.001406805f, 0.001441128f, 0.001476033f, 0.001511529f,
+    0.001547622f, 0.001584319f, 0.001621627f, 0.001659553f, 0.001698104f, 0.001737288f,
+    0.001777112f, 0.001817583f, 0.001858709f, 0.001900498f, 0.001942957f, 0.001986093f,
+    0.002029915f, 0.002074430f, 0.002119646f, 0.002165572f, 0.002212215f, 0.002259583f,
+    0.002307685f, 0.002356529f, 0.002406122f, 0.002456475f, 0.002507595f, 0.002559490f,
+    0.002612169f, 0.002665642f, 0.002719916f, 0.002775001f, 0.002830905f, 0.002887637f,
+    0.002945207f, 0.003003624f, 0.003062896f, 0.003123034f, 0.003184045f, 0.003245941f,
+    0.003308729f, 0.003372421f, 0.003437024f, 0.003502550f, 0.003569007f, 0.003636406f,
+    0.003704756f, 0.003774068f, 0.003844350f, 0.003915615f, 0.003987871f, 0.004061128f,
+    0.004135398f, 0.004210690f, 0.004287015f, 0.004364384f, 0.004442806f, 0.004522293f,
+    0.004602855f, 0.004684503f, 0.004767248f, 0.004851101f, 0.004936072f, 0.005022173f,
+    0.005109414f, 0.005197808f, 0.005287364f, 0.005378095f, 0.005470012f, 0.005563126f,
+    0.005657449f, 0.005752992f, 0.005849766f, 0.005947785f, 0.006047058f, 0.006147599f,
+    0.006249418f, 0.006352528f, 0.006456941f, 0.006562670f, 0.006669725f, 0.006778119f,
+    0.006887864f, 0.006998974f, 0.007111460f, 0.007225334f, 0.007340609f, 0.007457298f,
+    0.007575413f, 0.007694967f, 0.007815972f, 0.007938442f, 0.008062390f, 0.008187827f,
+    0.008314768f, 0.008443225f, 0.008573211f, 0.008704740f, 0.008837824f, 0.008972477f,
+    0.009108713f, 0.009246544f, 0.009385985f, 0.009527048f, 0.009669747f, 0.009814096f,
+    0.009960108f, 0.010107797f, 0.010257178f, 0.010408263f, 0.010561067f, 0.010715603f,
+    0.010871886f, 0.011029930f, 0.011189748f, 0.011351356f, 0.011514766f, 0.011679994f,
+    0.011847053f, 0.012015959f, 0.012186725f, 0.012359366f, 0.012533896f, 0.012710330f,
+    0.012888683f, 0.013068969f, 0.013251203f, 0.013435400f, 0.013621574f, 0.013809741f,
+    0.013999915f, 0.014192111f, 0.014386344f, 0.014582630f, 0.014780983f, 0.014981419f,
+    0.015183952f, 0.015388598f, 0.015595372f, 0.015804290f, 0.016015366f, 0.016228616f,
+    0.016444057f, 0.016661702f, 0.016881567f, 0.017103669f, 0.017328023f, 0.017554644f,
+    0.017783548f, 0.018014750f, 0.018248267f, 0.018484115f, 0.018722308f, 0.018962863f,
+    0.019205797f, 0.019451123f, 0.019698860f, 0.019949022f, 0.020201626f, 0.020456687f,
+    0.020714223f, 0.020974248f, 0.021236779f, 0.021501833f, 0.021769425f, 0.022039572f,
+    0.022312290f, 0.022587596f, 0.022865505f, 0.023146033f, 0.023429199f, 0.023715017f,
+    0.024003504f, 0.024294677f, 0.024588552f, 0.024885145f, 0.025184474f, 0.025486555f,
+    0.025791403f, 0.026099037f, 0.026409472f, 0.026722725f, 0.027038813f, 0.027357752f,
+    0.027679559f, 0.028004251f, 0.028331845f, 0.028662356f, 0.028995803f, 0.029332201f,
+    0.029671568f, 0.030013920f, 0.030359274f, 0.030707647f, 0.031059055f, 0.031413516f,
+    0.031771047f, 0.032131663f, 0.032495383f, 0.032862222f, 0.033232198f, 0.033605328f,
+    0.033981628f, 0.034361115f, 0.034743806f, 0.035129719f, 0.035518870f, 0.035911275f,
+    0.036306952f, 0.036705918f, 0.037108189f, 0.037513782f, 0.037922715f, 0.038335003f,
+    0.038750665f, 0.039169716f, 0.039592174f, 0.040018056f, 0.040447378f, 0.040880157f,
+    0.041316410f, 0.041756153f, 0.042199404f, 0.042646180f, 0.043096496f, 0.043550370f,
+    0.044007819f, 0.044468859f, 0.044933507f, 0.045401780f, 0.045873694f, 0.046349266f,
+    0.046828513f, 0.047311451f, 0.047798096f, 0.048288466f, 0.048782577f, 0.049280445f,
+    0.049782087f, 0.050287519f, 0.050796758f, 0.051309820f, 0.051826722f, 0.052347480f,
+    0.052872109f, 0.053400627f, 0.053933050f, 0.054469394f, 0.055009675f, 0.055553909f,
+    0.056102112f, 0.056654301f, 0.057210491f, 0.057770699f, 0.058334939f, 0.058903230f,
+    0.059475585f, 0.060052021f, 0.060632554f, 0.061217199f, 0.061805972f, 0.062398889f,
+    0.062995966f, 0.063597217f, 0.064202659f, 0.064812306f, 0.065426175f, 0.066044280f,
+    0.066666636f, 0.067293260f, 0.067924166f, 0.068559369f, 0.069198884f, 0.069842727f,
+    0.070490912f, 0.071143454f, 0.071800367f, 0.072461668f, 0.073127369f, 0.073797487f,
+    0.074472035f, 0.075151027f, 0.075834479f, 0.076522405f, 0.077214819f, 0.077911734f,
+    0.078613166f, 0.079319128f, 0.080029634f, 0.080744699f, 0.081464335f, 0.082188557f,
+    0.082917379f, 0.083650813f, 0.084388874f, 0.085131574f, 0.085878928f, 0.086630948f,
+    0.087387648f, 0.088149040f, 0.088915138f, 0.089685955f, 0.090461503f, 0.091241795f,
+    0.092026844f, 0.092816662f, 0.093611261f, 0.094410655f, 0.095214855f, 0.096023874f,
+    0.096837723f, 0.097656415f, 0.098479961f, 0.099308373f, 0.100141663f, 0.100979842f,
+    0.101822922f, 0.102670915f, 0.103523830f, 0.104381680f, 0.105244476f, 0.106112228f,
+    0.106984947f, 0.107862644f, 0.108745330f, 0.109633015f, 0.110525709f, 0.111423422f,
+    0.112326166f, 0.113233949f, 0.114146781f, 0.115064673f, 0.115987634f, 0.116915673f,
+    0.117848800f, 0.118787025f, 0.119730355f, 0.120678801f, 0.121632372f, 0.122591075f,
+    0.123554920f, 0.124523915f, 0.125498068f, 0.126477388f, 0.127461883f, 0.128451561f,
+    0.129446429f, 0.130446496f, 0.131451769f, 0.132462255f, 0.133477962f, 0.134498897f,
+    0.135525066f, 0.136556477f, 0.137593136f, 0.138635051f, 0.139682226f, 0.140734670f,
+    0.141792387f, 0.142855384f, 0.143923666f, 0.144997240f, 0.146076111f, 0.147160284f,
+    0.148249764f, 0.149344557f, 0.150444667f, 0.151550100f, 0.152660859f, 0.153776950f,
+    0.154898376f, 0.156025142f, 0.157157251f, 0.158294709f, 0.159437517f, 0.160585680f,
+    0.161739200f, 0.162898082f, 0.164062328f, 0.165231941f, 0.166406923f, 0.167587277f,
+    0.168773006f, 0.169964111f, 0.171160594f, 0.172362458f, 0.173569704f, 0.174782333f,
+    0.176000346f, 0.177223745f, 0.178452531f, 0.179686704f, 0.180926265f, 0.182171215f,
+    0.183421552f, 0.184677279f, 0.185938393f, 0.187204896f, 0.188476786f, 0.189754063f,
+    0.191036726f, 0.192324774f, 0.193618205f, 0.194917018f, 0.196221212f, 0.197530785f,
+    0.198845734f, 0.200166057f, 0.201491752f, 0.202822817f, 0.204159249f, 0.205501044f,
+    0.206848199f, 0.208200712f, 0.209558578f, 0.210921794f, 0.212290356f, 0.213664259f,
+    0.215043500f, 0.216428073f, 0.217817975f, 0.219213199f, 0.220613742f, 0.222019596f,
+    0.223430758f, 0.224847222f, 0.226268980f, 0.227696028f, 0.229128358f, 0.230565964f,
+    0.232008840f, 0.233456979f, 0.234910372f, 0.236369013f, 0.237832895f, 0.239302009f,
+    0.240776347f, 0.242255901f, 0.243740663f, 0.245230624f, 0.246725775f, 0.248226107f,
+    0.249731611f, 0.251242278f, 0.252758096f, 0.254279058f, 0.255805152f, 0.257336368f,
+    0.258872695f, 0.260414124f, 0.261960642f, 0.263512239f, 0.265068902f, 0.266630622f,
+    0.268197384f, 0.269769179f, 0.271345992f, 0.272927813f, 0.274514627f, 0.276106422f,
+    0.277703185f, 0.279304902f, 0.280911560f, 0.282523146f, 0.284139644f, 0.285761040f,
+    0.287387321f, 0.289018471f, 0.290654476f, 0.292295319f, 0.293940987f, 0.295591463f,
+    0.297246732f, 0.298906777f, 0.300571582f, 0.302241131f, 0.303915407f, 0.305594393f,
+    0.307278071f, 0.308966426f, 0.310659437f, 0.312357089f, 0.314059363f, 0.315766241f,
+    0.317477704f, 0.319193733f, 0.320914310f, 0.322639415f, 0.324369029f, 0.326103133f,
+    0.327841706f, 0.329584728f, 0.331332179f, 0.333084039f, 0.334840287f, 0.336600902f,
+    0.338365862f, 0.340135147f, 0.341908734f, 0.343686603f, 0.345468730f, 0.347255093f,
+    0.349045670f, 0.350840439f, 0.352639376f, 0.354442457f, 0.356249661f, 0.358060962f,
+    0.359876337f, 0.361695763f, 0.363519214f, 0.365346666f, 0.367178095f, 0.369013475f,
+    0.370852782f, 0.372695989f, 0.374543072f, 0.376394004f, 0.378248760f, 0.380107312f,
+    0.381969636f, 0.383835703f, 0.385705487f, 0.387578961f, 0.389456097f, 0.391336869f,
+    0.393221247f, 0.395109204f, 0.397000712f, 0.398895743f, 0.400794267f, 0.402696256f,
+    0.404601681f, 0.406510512f, 0.408422720f, 0.410338275f, 0.412257148f, 0.414179308f,
+    0.416104724f, 0.418033367f, 0.419965205f, 0.421900207f, 0.423838343f, 0.425779580f,
+    0.427723888f, 0.429671234f, 0.431621587f, 0.433574914f, 0.435531182f, 0.437490360f,
+    0.439452414f, 0.441417311f, 0.443385018f, 0.445355502f, 0.447328728f, 0.449304664f,
+    0.451283275f, 0.453264527f, 0.455248385f, 0.457234815f, 0.459223782f, 0.461215250f,
+    0.463209186f, 0.465205553f, 0.467204316f, 0.469205438f, 0.471208885f, 0.473214620f,
+    0.475222606f, 0.477232807f, 0.479245186f, 0.481259707f, 0.483276331f, 0.485295023f,
+    0.487315745f, 0.489338458f, 0.491363125f, 0.493389708f, 0.495418170f, 0.497448470f,
+    0.499480572f, 0.501514436f, 0.503550023f, 0.505587295f, 0.507626212f, 0.509666735f,
+    0.511708824f, 0.513752439f, 0.515797540f, 0.517844089f, 0.519892043f, 0.521941363f,
+    0.523992009f, 0.526043939f, 0.528097112f, 0.530151489f, 0.532207026f, 0.534263684f,
+    0.536321420f, 0.538380193f, 0.540439961f, 0.542500682f, 0.544562314f, 0.546624815f,
+    0.548688142f, 0.550752253f, 0.552817104f, 0.554882654f, 0.556948859f, 0.559015675f,
+    0.561083060f, 0.563150971f, 0.565219363f, 0.567288193f, 0.569357418f, 0.571426992f,
+    0.573496873f, 0.575567015f, 0.577637375f, 0.579707908f, 0.581778569f, 0.583849314f,
+    0.585920098f, 0.587990875f, 0.590061602f, 0.592132232f, 0.594202720f, 0.596273020f,
+    0.598343088f, 0.600412878f, 0.602482343f, 0.604551438f, 0.606620117f, 0.608688333f,
+    0.610756041f, 0.612823195f, 0.614889746f, 0.616955651f, 0.619020860f, 0.621085329f,
+    0.623149010f, 0.625211856f, 0.627273820f, 0.629334855f, 0.631394914f, 0.633453950f,
+    0.635511915f, 0.637568762f, 0.639624443f, 0.641678912f, 0.643732119f, 0.645784018f,
+    0.647834560f, 0.649883698f, 0.651931384f, 0.653977569f, 0.656022206f, 0.658065246f,
+    0.660106642f, 0.662146344f, 0.664184305f, 0.666220476f, 0.668254808f, 0.670287254f,
+    0.672317764f, 0.674346290f, 0.676372783f, 0.678397195f, 0.680419477f, 0.682439579f,
+    0.684457453f, 0.686473050f, 0.688486322f, 0.690497218f, 0.692505691f, 0.694511691f,
+    0.696515168f, 0.698516075f, 0.700514361f, 0.702509978f, 0.704502877f, 0.706493007f,
+    0.708480320f, 0.710464767f, 0.712446299f, 0.714424865f, 0.716400418f, 0.718372906f,
+    0.720342282f, 0.722308496f, 0.724271498f, 0.726231240f, 0.728187671f, 0.730140743f,
+    0.732090406f, 0.734036610f, 0.735979308f, 0.737918448f, 0.739853982f, 0.741785861f,
+    0.743714036f, 0.745638456f, 0.747559073f, 0.749475838f, 0.751388701f, 0.753297613f,
+    0.755202526f, 0.757103389f, 0.759000154f, 0.760892772f, 0.762781194f, 0.764665370f,
+    0.766545252f, 0.768420792f, 0.770291939f, 0.772158645f, 0.774020862f, 0.775878540f,
+    0.777731632f, 0.779580087f, 0.781423859f, 0.783262897f, 0.785097155f, 0.786926583f,
+    0.788751133f, 0.790570756f, 0.792385405f, 0.794195032f, 0.795999588f, 0.797799025f,
+    0.799593295f, 0.801382351f, 0.803166144f, 0.804944628f, 0.806717754f, 0.808485474f,
+    0.810247743f, 0.812004511f, 0.813755732f, 0.815501358f, 0.817241343f, 0.818975639f,
+    0.820704200f, 0.822426979f, 0.824143928f, 0.825855003f, 0.827560155f, 0.829259339f,
+    0.830952508f, 0.832639616f, 0.834320617f, 0.835995466f, 0.837664116f, 0.839326521f,
+    0.840982637f, 0.842632417f, 0.844275817f, 0.845912790f, 0.847543293f, 0.849167280f,
+    0.850784706f, 0.852395526f, 0.853999697f, 0.855597173f, 0.857187910f, 0.858771865f,
+    0.860348993f, 0.861919250f, 0.863482593f, 0.865038979f, 0.866588363f, 0.868130702f,
+    0.869665954f, 0.871194076f, 0.872715024f, 0.874228757f, 0.875735231f, 0.877234405f,
+    0.878726237f, 0.880210683f, 0.881687704f, 0.883157256f, 0.884619299f, 0.886073792f,
+    0.887520692f, 0.888959960f, 0.890391555f, 0.891815436f, 0.893231563f, 0.894639895f,
+    0.896040393f, 0.897433017f, 0.898817728f, 0.900194485f, 0.901563250f, 0.902923983f,
+    0.904276646f, 0.905621201f, 0.906957608f, 0.908285830f, 0.909605829f, 0.910917566f,
+    0.912221005f, 0.913516108f, 0.914802837f, 0.916081156f, 0.917351028f, 0.918612416f,
+    0.919865284f, 0.921109597f, 0.922345318f, 0.923572411f, 0.924790842f, 0.926000574f,
+    0.927201573f, 0.928393805f, 0.929577235f, 0.930751827f, 0.931917550f, 0.933074368f,
+    0.934222248f, 0.935361157f, 0.936491061f, 0.937611928f, 0.938723726f, 0.939826421f,
+    0.940919982f, 0.942004377f, 0.943079574f, 0.944145542f, 0.945202250f, 0.946249666f,
+    0.947287761f, 0.948316504f, 0.949335864f, 0.950345813f, 0.951346320f, 0.952337356f,
+    0.953318892f, 0.954290899f, 0.955253349f, 0.956206214f, 0.957149465f, 0.958083074f,
+    0.959007015f, 0.959921260f, 0.960825782f, 0.961720555f, 0.962605551f, 0.963480746f,
+    0.964346113f, 0.965201627f, 0.966047262f, 0.966882994f, 0.967708797f, 0.968524648f,
+    0.969330522f, 0.970126395f, 0.970912245f, 0.971688047f, 0.972453778f, 0.973209417f,
+    0.973954940f, 0.974690325f, 0.975415551f, 0.976130596f, 0.976835439f, 0.977530058f,
+    0.978214435f, 0.978888546f, 0.979552374f, 0.980205898f, 0.980849099f, 0.981481957f,
+    0.982104454f, 0.982716572f, 0.983318291f, 0.983909594f, 0.984490464f, 0.985060883f,
+    0.985620833f, 0.986170299f, 0.986709265f, 0.987237713f, 0.987755628f, 0.988262995f,
+    0.988759798f, 0.989246023f, 0.989721655f, 0.990186680f, 0.990641084f, 0.991084853f,
+    0.991517975f, 0.991940436f, 0.992352223f, 0.992753324f, 0.993143728f, 0.993523422f,
+    0.993892395f, 0.994250637f, 0.994598135f, 0.994934881f, 0.995260863f, 0.995576073f,
+    0.995880500f, 0.996174136f, 0.996456971f, 0.996728998f, 0.996990207f, 0.997240592f,
+    0.997480144f, 0.997708857f, 0.997926724f, 0.998133738f, 0.998329892f, 0.998515182f,
+    0.998689601f, 0.998853144f, 0.999005807f, 0.999147584f, 0.999278472f, 0.999398466f,
+    0.999507563f, 0.999605760f, 0.999693053f, 0.999769441f, 0.999834920f, 0.999889489f,
+    0.999933147f, 0.999965891f, 0.999987720f, 0.999998636f,
+};
+
+static const float g_pfWindow_flat_top_128[64] =
+{
+    -0.000421051f, -0.000484160f, -0.000676378f, -0.001006273f, -0.001487753f, -0.002139516f,
+    -0.002984279f, -0.004047797f, -0.005357677f, -0.006941989f, -0.008827712f, -0.011039002f,
+    -0.013595337f, -0.016509555f, -0.019785822f, -0.023417588f, -0.027385568f, -0.031655816f,
+    -0.036177951f, -0.040883600f, -0.045685135f, -0.050474759f, -0.055124023f, -0.059483822f,
+    -0.063384942f, -0.066639177f, -0.069041082f, -0.070370356f, -0.070394856f, -0.068874251f,
+    -0.065564244f, -0.060221343f, -0.052608069f, -0.042498541f, -0.029684297f, -0.013980247f,
+    0.004769410f, 0.026685422f, 0.051848060f, 0.080292175f, 0.112002889f, 0.146912075f,
+    0.184895761f, 0.225772561f, 0.269303242f, 0.315191504f, 0.363085995f, 0.412583592f,
+    0.463233929f, 0.514545101f, 0.565990489f, 0.617016567f, 0.667051555f, 0.715514750f,
+    0.761826342f, 0.805417503f, 0.845740525f, 0.882278789f, 0.914556330f, 0.942146771f,
+    0.964681428f, 0.981856382f, 0.993438358f, 0.999269261f,
+};
+
+static const float g_pfWindow_flat_top_256[128] =
+{
+    -0.000421051f, -0.000436659f, -0.000483664f, -0.000562599f, -0.000674350f, -0.000820145f,
+    -0.001001543f, -0.001220418f, -0.001478940f, -0.001779556f, -0.002124961f, -0.002518071f,
+    -0.002961995f, -0.003459992f, -0.004015443f, -0.004631802f, -0.005312558f, -0.006061185f,
+    -0.006881094f, -0.007775581f, -0.008747774f, -0.009800577f, -0.010936611f, -0.012158155f,
+    -0.013467085f, -0.014864813f, -0.016352223f, -0.017929609f, -0.019596613f, -0.021352158f,
+    -0.023194394f, -0.025120628f, -0.027127276f, -0.029209797f, -0.031362646f, -0.033579221f,
+    -0.035851815f, -0.038171578f, -0.040528477f, -0.042911262f, -0.045307446f, -0.047703278f,
+    -0.050083736f, -0.052432520f, -0.054732051f, -0.056963489f, -0.059106743f, -0.061140507f,
+    -0.063042294f, -0.064788481f, -0.066354371f, -0.067714252f, -0.068841479f, -0.069708558f,
+    -0.070287239f, -0.070548626f, -0.070463285f, -0.070001376f, -0.069132779f, -0.067827234f,
+    -0.066054496f, -0.063784483f, -0.060987444f, -0.057634121f, -0.053695927f, -0.049145119f,
+    -0.043954981f, -0.038100002f, -0.031556062f, -0.024300617f, -0.016312873f, -0.007573975f,
+    0.001932821f, 0.012221979f, 0.023305512f, 0.035192827f, 0.047890574f, 0.061402503f,
+    0.075729337f, 0.090868651f, 0.106814766f, 0.123558658f, 0.141087880f, 0.159386501f,
+    0.178435057f, 0.198210530f, 0.218686330f, 0.239832308f, 0.261614779f, 0.283996571f,
+    0.306937088f, 0.330392392f, 0.354315314f, 0.378655566f, 0.403359892f, 0.428372222f,
+    0.453633854f, 0.479083643f, 0.504658221f, 0.530292216f, 0.555918498f, 0.581468434f,
+    0.606872153f, 0.632058826f, 0.656956955f, 0.681494666f, 0.705600011f, 0.729201280f,
+    0.752227304f, 0.774607776f, 0.796273552f, 0.817156972f, 0.837192158f, 0.856315318f,
+    0.874465040f, 0.891582574f, 0.907612111f, 0.922501040f, 0.936200201f, 0.948664114f,
+    0.959851201f, 0.969723979f, 0.978249247f, 0.985398241f, 0.991146774f, 0.995475354f,
+    0.998369280f, 0.999818709f,
+};
+
+static const float g_pfWindow_flat_top_512[256] =
+{
+    -0.000421051f, -0.000424935f, -0.000436598f, -0.000456074f, -0.000483418f, -0.000518707f,
+    -0.000562040f, -0.000613539f, -0.000673345f, -0.000741620f, -0.000818549f, -0.000904334f,
+    -0.000999200f, -0.001103387f, -0.001217157f, -0.001340788f, -0.001474576f, -0.001618831f,
+    -0.001773882f, -0.001940071f, -0.002117754f, -0.002307298f, -0.002509085f, -0.002723507f,
+    -0.002950963f, -0.003191863f, -0.003446625f, -0.003715671f, -0.003999429f, -0.004298331f,
+    -0.004612809f, -0.004943298f, -0.005290232f, -0.005654041f, -0.006035152f, -0.006433988f,
+    -0.006850964f, -0.007286486f, -0.007740950f, -0.008214740f, -0.008708226f, -0.009221763f,
+    -0.009755688f, -0.010310320f, -0.010885955f, -0.011482868f, -0.012101308f, -0.012741497f,
+    -0.013403630f, -0.014087871f, -0.014794349f, -0.015523162f, -0.016274370f, -0.017047994f,
+    -0.017844015f, -0.018662374f, -0.019502964f, -0.020365635f, -0.021250187f, -0.022156372f,
+    -0.023083888f, -0.024032381f, -0.025001441f, -0.025990601f, -0.026999336f, -0.028027059f,
+    -0.029073121f, -0.030136809f, -0.031217346f, -0.032313888f, -0.033425520f, -0.034551261f,
+    -0.035690056f, -0.036840781f, -0.038002237f, -0.039173150f, -0.040352172f, -0.041537878f,
+    -0.042728768f, -0.043923262f, -0.045119704f, -0.046316357f, -0.047511408f, -0.048702962f,
+    -0.049889047f, -0.051067609f, -0.052236517f, -0.053393561f, -0.054536451f, -0.055662820f,
+    -0.056770222f, -0.057856137f, -0.058917967f, -0.059953040f, -0.060958610f, -0.061931859f,
+    -0.062869899f, -0.063769773f, -0.064628455f, -0.065442856f, -0.066209823f, -0.066926140f,
+    -0.067588536f, -0.068193681f, -0.068738193f, -0.069218640f, -0.069631542f, -0.069973375f,
+    -0.070240572f, -0.070429532f, -0.070536617f, -0.070558161f, -0.070490469f, -0.070329826f,
+    -0.070072498f, -0.069714737f, -0.069252784f, -0.068682878f, -0.068001256f, -0.067204157f,
+    -0.066287833f, -0.065248548f, -0.064082585f, -0.062786252f, -0.061355886f, -0.059787858f,
+    -0.058078582f, -0.056224513f, -0.054222162f, -0.052068092f, -0.049758932f, -0.047291376f,
+    -0.044662194f, -0.041868231f, -0.038906422f, -0.035773787f, -0.032467447f, -0.028984622f,
+    -0.025322639f, -0.021478940f, -0.017451084f, -0.013236755f, -0.008833764f, -0.004240061f,
+    0.000546268f, 0.005526988f, 0.010703717f, 0.016077914f, 0.021650882f, 0.027423754f,
+    0.033397496f, 0.039572901f, 0.045950580f, 0.052530964f, 0.059314296f, 0.066300629f,
+    0.073489821f, 0.080881534f, 0.088475226f, 0.096270155f, 0.104265369f, 0.112459708f,
+    0.120851801f, 0.129440061f, 0.138222688f, 0.147197664f, 0.156362749f, 0.165715489f,
+    0.175253205f, 0.184972999f, 0.194871749f, 0.204946116f, 0.215192536f, 0.225607225f,
+    0.236186182f, 0.246925184f, 0.257819793f, 0.268865356f, 0.280057005f, 0.291389662f,
+    0.302858042f, 0.314456653f, 0.326179801f, 0.338021594f, 0.349975947f, 0.362036581f,
+    0.374197034f, 0.386450661f, 0.398790641f, 0.411209981f, 0.423701525f, 0.436257953f,
+    0.448871796f, 0.461535434f, 0.474241108f, 0.486980925f, 0.499746864f, 0.512530785f,
+    0.525324436f, 0.538119461f, 0.550907406f, 0.563679731f, 0.576427813f, 0.589142960f,
+    0.601816416f, 0.614439370f, 0.627002967f, 0.639498316f, 0.651916498f, 0.664248576f,
+    0.676485606f, 0.688618643f, 0.700638755f, 0.712537030f, 0.724304582f, 0.735932570f,
+    0.747412198f, 0.758734730f, 0.769891499f, 0.780873915f, 0.791673477f, 0.802281779f,
+    0.812690525f, 0.822891532f, 0.832876743f, 0.842638237f, 0.852168234f, 0.861459111f,
+    0.870503402f, 0.879293812f, 0.887823227f, 0.896084718f, 0.904071551f, 0.911777194f,
+    0.919195329f, 0.926319851f, 0.933144885f, 0.939664786f, 0.945874147f, 0.951767808f,
+    0.957340860f, 0.962588652f, 0.967506794f, 0.972091167f, 0.976337923f, 0.980243492f,
+    0.983804588f, 0.987018208f, 0.989881641f, 0.992392470f, 0.994548570f, 0.996348117f,
+    0.997789588f, 0.998871762f, 0.999593721f, 0.999954854f,
+};
+
+static const float g_pfWindow_flat_top_2048[1024] =
+{
+    -0.000421051f, -0.000421293f, -0.000422019f, -0.000423229f, -0.000424924f, -0.000427103f,
+    -0.000429767f, -0.000432917f, -0.000436553f, -0.000440675f, -0.000445286f, -0.000450384f,
+    -0.000455971f, -0.000462049f, -0.000468618f, -0.000475680f, -0.000483235f, -0.000491285f,
+    -0.000499831f, -0.000508876f, -0.000518419f, -0.000528464f, -0.000539012f, -0.000550065f,
+    -0.000561624f, -0.000573692f, -0.000586271f, -0.000599362f, -0.000612969f, -0.000627093f,
+    -0.000641737f, -0.000656903f, -0.000672595f, -0.000688814f, -0.000705563f, -0.000722845f,
+    -0.000740664f, -0.000759021f, -0.000777920f, -0.000797365f, -0.000817358f, -0.000837902f,
+    -0.000859002f, -0.000880660f, -0.000902880f, -0.000925665f, -0.000949020f, -0.000972947f,
+    -0.000997452f, -0.001022536f, -0.001048205f, -0.001074463f, -0.001101313f, -0.001128760f,
+    -0.001156808f, -0.001185462f, -0.001214725f, -0.001244602f, -0.001275097f, -0.001306216f,
+    -0.001337962f, -0.001370341f, -0.001403357f, -0.001437015f, -0.001471320f, -0.001506276f,
+    -0.001541890f, -0.001578165f, -0.001615107f, -0.001652722f, -0.001691014f, -0.001729988f,
+    -0.001769651f, -0.001810007f, -0.001851061f, -0.001892821f, -0.001935290f, -0.001978474f,
+    -0.002022380f, -0.002067013f, -0.002112379f, -0.002158483f, -0.002205331f, -0.002252929f,
+    -0.002301284f, -0.002350401f, -0.002400286f, -0.002450945f, -0.002502384f, -0.002554610f,
+    -0.002607629f, -0.002661446f, -0.002716069f, -0.002771503f, -0.002827755f, -0.002884830f,
+    -0.002942737f, -0.003001480f, -0.003061066f, -0.003121502f, -0.003182795f, -0.003244950f,
+    -0.003307975f, -0.003371875f, -0.003436658f, -0.003502331f, -0.003568899f, -0.003636369f,
+    -0.003704748f, -0.003774043f, -0.003844261f, -0.003915408f, -0.003987490f, -0.004060515f,
+    -0.004134490f, -0.004209420f, -0.004285313f, -0.004362176f, -0.004440015f, -0.004518837f,
+    -0.004598649f, -0.004679458f, -0.004761270f, -0.004844091f, -0.004927930f, -0.005012792f,
+    -0.005098685f, -0.005185614f, -0.005273588f, -0.005362611f, -0.005452692f, -0.005543836f,
+    -0.005636051f, -0.005729342f, -0.005823718f, -0.005919183f, -0.006015746f, -0.006113411f,
+    -0.006212186f, -0.006312078f, -0.006413092f, -0.006515236f, -0.006618515f, -0.006722935f,
+    -0.006828504f, -0.006935228f, -0.007043112f, -0.007152163f, -0.007262387f, -0.007373790f,
+    -0.007486379f, -0.007600158f, -0.007715135f, -0.007831315f, -0.007948704f, -0.008067308f,
+    -0.008187132f, -0.008308182f, -0.008430464f, -0.008553984f, -0.008678746f, -0.008804757f,
+    -0.008932022f, -0.009060545f, -0.009190333f, -0.009321390f, -0.009453722f, -0.009587333f,
+    -0.009722228f, -0.009858413f, -0.009995892f, -0.010134669f, -0.010274750f, -0.010416139f,
+    -0.010558840f, -0.010702858f, -0.010848196f, -0.010994860f, -0.011142853f, -0.011292178f,
+    -0.011442841f, -0.011594844f, -0.011748192f, -0.011902887f, -0.012058934f, -0.012216335f,
+    -0.012375094f, -0.012535214f, -0.012696699f, -0.012859549f, -0.013023770f, -0.013189363f,
+    -0.013356330f, -0.013524675f, -0.013694399f, -0.013865505f, -0.014037994f, -0.014211869f,
+    -0.014387131f, -0.014563782f, -0.014741823f, -0.014921255f, -0.015102081f, -0.015284300f,
+    -0.015467914f, -0.015652924f, -0.015839330f, -0.016027133f, -0.016216332f, -0.016406929f,
+    -0.016598922f, -0.016792313f, -0.016987100f, -0.017183283f, -0.017380862f, -0.017579836f,
+    -0.017780203f, -0.017981963f, -0.018185114f, -0.018389655f, -0.018595584f, -0.018802899f,
+    -0.019011599f, -0.019221680f, -0.019433142f, -0.019645980f, -0.019860193f, -0.020075777f,
+    -0.020292729f, -0.020511047f, -0.020730726f, -0.020951762f, -0.021174153f, -0.021397893f,
+    -0.021622979f, -0.021849406f, -0.022077168f, -0.022306263f, -0.022536683f, -0.022768424f,
+    -0.023001481f, -0.023235847f, -0.023471517f, -0.023708484f, -0.023946743f, -0.024186285f,
+    -0.024427105f, -0.024669196f, -0.024912550f, -0.025157159f, -0.025403017f, -0.025650114f,
+    -0.025898443f, -0.026147996f, -0.026398763f, -0.026650735f, -0.026903905f, -0.027158261f,
+    -0.027413795f, -0.027670496f, -0.027928356f, -0.028187362f, -0.028447505f, -0.028708773f,
+    -0.028971156f, -0.029234643f, -0.029499221f, -0.029764879f, -0.030031604f, -0.030299384f,
+    -0.030568208f, -0.030838060f, -0.031108930f, -0.031380802f, -0.031653664f, -0.031927501f,
+    -0.032202300f, -0.032478045f, -0.032754722f, -0.033032316f, -0.033310812f, -0.033590194f,
+    -0.033870445f, -0.034151551f, -0.034433495f, -0.034716259f, -0.034999828f, -0.035284183f,
+    -0.035569307f, -0.035855183f, -0.036141792f, -0.036429115f, -0.036717136f, -0.037005833f,
+    -0.037295188f, -0.037585182f, -0.037875795f, -0.038167006f, -0.038458795f, -0.038751142f,
+    -0.039044025f, -0.039337423f, -0.039631315f, -0.039925678f, -0.040220491f, -0.040515732f,
+    -0.040811376f, -0.041107402f, -0.041403785f, -0.041700503f, -0.041997531f, -0.042294845f,
+    -0.042592420f, -0.042890232f, -0.043188255f, -0.043486464f, -0.043784833f, -0.044083336f,
+    -0.044381946f, -0.044680637f, -0.044979382f, -0.045278154f, -0.045576924f, -0.045875666f,
+    -0.046174350f, -0.046472948f, -0.046771432f, -0.047069772f, -0.047367939f, -0.047665902f,
+    -0.047963633f, -0.048261099f, -0.048558272f, -0.048855119f, -0.049151610f, -0.049447713f,
+    -0.049743395f, -0.050038625f, -0.050333370f, -0.050627598f, -0.050921274f, -0.051214366f,
+    -0.051506840f, -0.051798662f, -0.052089797f, -0.052380211f, -0.052669868f, -0.052958734f,
+    -0.053246772f, -0.053533948f, -0.053820223f, -0.054105563f, -0.054389930f, -0.054673288f,
+    -0.054955598f, -0.055236823f, -0.055516925f, -0.055795865f, -0.056073606f, -0.056350107f,
+    -0.056625330f, -0.056899236f, -0.057171784f, -0.057442935f, -0.057712648f, -0.057980881f,
+    -0.058247596f, -0.058512749f, -0.058776300f, -0.059038206f, -0.059298426f, -0.059556917f,
+    -0.059813637f, -0.060068542f, -0.060321589f, -0.060572735f, -0.060821935f, -0.061069146f,
+    -0.061314324f, -0.061557423f, -0.061798399f, -0.062037206f, -0.062273799f, -0.062508133f,
+    -0.062740161f, -0.062969838f, -0.063197115f, -0.063421948f, -0.063644288f, -0.063864089f,
+    -0.064081303f, -0.064295881f, -0.064507777f, -0.064716942f, -0.064923327f, -0.065126883f,
+    -0.065327561f, -0.065525313f, -0.065720088f, -0.065911836f, -0.066100509f, -0.066286055f,
+    -0.066468425f, -0.066647567f, -0.066823430f, -0.066995964f, -0.067165117f, -0.067330837f,
+    -0.067493074f, -0.067651774f, -0.067806886f, -0.067958357f, -0.068106134f, -0.068250166f,
+    -0.068390398f, -0.068526778f, -0.068659252f, -0.068787767f, -0.068912269f, -0.069032703f,
+    -0.069149017f, -0.069261155f, -0.069369063f, -0.069472687f, -0.069571972f, -0.069666862f,
+    -0.069757302f, -0.069843238f, -0.069924613f, -0.070001373f, -0.070073461f, -0.070140822f,
+    -0.070203399f, -0.070261136f, -0.070313978f, -0.070361867f, -0.070404747f, -0.070442561f,
+    -0.070475253f, -0.070502765f, -0.070525041f, -0.070542024f, -0.070553655f, -0.070559878f,
+    -0.070560636f, -0.070555870f, -0.070545524f, -0.070529539f, -0.070507857f, -0.070480422f,
+    -0.070447174f, -0.070408056f, -0.070363009f, -0.070311977f, -0.070254899f, -0.070191719f,
+    -0.070122377f, -0.070046816f, -0.069964977f, -0.069876801f, -0.069782231f, -0.069681207f,
+    -0.069573672f, -0.069459566f, -0.069338831f, -0.069211409f, -0.069077241f, -0.068936268f,
+    -0.068788432f, -0.068633674f, -0.068471936f, -0.068303160f, -0.068127286f, -0.067944257f,
+    -0.067754013f, -0.067556497f, -0.067351650f, -0.067139414f, -0.066919731f, -0.066692542f,
+    -0.066457790f, -0.066215415f, -0.065965361f, -0.065707569f, -0.065441982f, -0.065168541f,
+    -0.064887189f, -0.064597869f, -0.064300522f, -0.063995092f, -0.063681522f, -0.063359754f,
+    -0.063029731f, -0.062691396f, -0.062344693f, -0.061989565f, -0.061625955f, -0.061253807f,
+    -0.060873065f, -0.060483673f, -0.060085575f, -0.059678716f, -0.059263039f, -0.058838490f,
+    -0.058405013f, -0.057962553f, -0.057511056f, -0.057050467f, -0.056580731f, -0.056101795f,
+    -0.055613604f, -0.055116105f, -0.054609244f, -0.054092968f, -0.053567225f, -0.053031960f,
+    -0.052487122f, -0.051932658f, -0.051368517f, -0.050794646f, -0.050210994f, -0.049617510f,
+    -0.049014142f, -0.048400841f, -0.047777556f, -0.047144237f, -0.046500834f, -0.045847297f,
+    -0.045183578f, -0.044509627f, -0.043825397f, -0.043130838f, -0.042425904f, -0.041710546f,
+    -0.040984718f, -0.040248373f, -0.039501464f, -0.038743945f, -0.037975771f, -0.037196896f,
+    -0.036407275f, -0.035606864f, -0.034795618f, -0.033973495f, -0.033140449f, -0.032296440f,
+    -0.031441423f, -0.030575357f, -0.029698200f, -0.028809910f, -0.027910448f, -0.026999773f,
+    -0.026077843f, -0.025144621f, -0.024200067f, -0.023244143f, -0.022276810f, -0.021298030f,
+    -0.020307767f, -0.019305984f, -0.018292644f, -0.017267712f, -0.016231153f, -0.015182932f,
+    -0.014123015f, -0.013051367f, -0.011967957f, -0.010872751f, -0.009765717f, -0.008646823f,
+    -0.007516040f, -0.006373335f, -0.005218679f, -0.004052043f, -0.002873398f, -0.001682715f,
+    -0.000479968f, 0.000734872f, 0.001961830f, 0.003200933f, 0.004452206f, 0.005715674f,
+    0.006991361f, 0.008279290f, 0.009579485f, 0.010891967f, 0.012216759f, 0.013553882f,
+    0.014903356f, 0.016265200f, 0.017639435f, 0.019026079f, 0.020425149f, 0.021836662f,
+    0.023260637f, 0.024697087f, 0.026146029f, 0.027607478f, 0.029081447f, 0.030567949f,
+    0.032066997f, 0.033578603f, 0.035102778f, 0.036639533f, 0.038188877f, 0.039750820f,
+    0.041325370f, 0.042912534f, 0.044512320f, 0.046124734f, 0.047749782f, 0.049387467f,
+    0.051037795f, 0.052700768f, 0.054376390f, 0.056064662f, 0.057765585f, 0.059479160f,
+    0.061205386f, 0.062944262f, 0.064695787f, 0.066459957f, 0.068236769f, 0.070026219f,
+    0.071828303f, 0.073643013f, 0.075470345f, 0.077310290f, 0.079162841f, 0.081027988f,
+    0.082905722f, 0.084796033f, 0.086698909f, 0.088614338f, 0.090542308f, 0.092482805f,
+    0.094435814f, 0.096401320f, 0.098379307f, 0.100369759f, 0.102372657f, 0.104387983f,
+    0.106415718f, 0.108455841f, 0.110508332f, 0.112573169f, 0.114650329f, 0.116739789f,
+    0.118841524f, 0.120955509f, 0.123081719f, 0.125220126f, 0.127370704f, 0.129533422f,
+    0.131708253f, 0.133895166f, 0.136094129f, 0.138305112f, 0.140528081f, 0.142763003f,
+    0.145009843f, 0.147268567f, 0.149539137f, 0.151821518f, 0.154115671f, 0.156421557f,
+    0.158739138f, 0.161068372f, 0.163409218f, 0.165761635f, 0.168125580f, 0.170501008f,
+    0.172887875f, 0.175286135f, 0.177695742f, 0.180116649f, 0.182548807f, 0.184992168f,
+    0.187446682f, 0.189912298f, 0.192388964f, 0.194876628f, 0.197375237f, 0.199884737f,
+    0.202405073f, 0.204936188f, 0.207478027f, 0.210030531f, 0.212593642f, 0.215167301f,
+    0.217751448f, 0.220346021f, 0.222950960f, 0.225566200f, 0.228191680f, 0.230827333f,
+    0.233473096f, 0.236128902f, 0.238794683f, 0.241470373f, 0.244155903f, 0.246851203f,
+    0.249556203f, 0.252270832f, 0.254995017f, 0.257728687f, 0.260471767f, 0.263224183f,
+    0.265985860f, 0.268756721f, 0.271536691f, 0.274325690f, 0.277123640f, 0.279930463f,
+    0.282746077f, 0.285570403f, 0.288403357f, 0.291244858f, 0.294094822f, 0.296953165f,
+    0.299819801f, 0.302694646f, 0.305577612f, 0.308468613f, 0.311367559f, 0.314274362f,
+    0.317188933f, 0.320111181f, 0.323041015f, 0.325978342f, 0.328923070f, 0.331875106f,
+    0.334834355f, 0.337800722f, 0.340774111f, 0.343754427f, 0.346741571f, 0.349735445f,
+    0.352735952f, 0.355742991f, 0.358756463f, 0.361776266f, 0.364802300f, 0.367834461f,
+    0.370872647f, 0.373916754f, 0.376966678f, 0.380022314f, 0.383083556f, 0.386150297f,
+    0.389222431f, 0.392299850f, 0.395382446f, 0.398470108f, 0.401562729f, 0.404660197f,
+    0.407762401f, 0.410869230f, 0.413980572f, 0.417096314f, 0.420216341f, 0.423340541f,
+    0.426468799f, 0.429600998f, 0.432737024f, 0.435876760f, 0.439020089f, 0.442166893f,
+    0.445317053f, 0.448470453f, 0.451626971f, 0.454786488f, 0.457948884f, 0.461114038f,
+    0.464281829f, 0.467452133f, 0.470624830f, 0.473799796f, 0.476976907f, 0.480156040f,
+    0.483337069f, 0.486519871f, 0.489704320f, 0.492890289f, 0.496077652f, 0.499266283f,
+    0.502456055f, 0.505646839f, 0.508838508f, 0.512030933f, 0.515223984f, 0.518417534f,
+    0.521611452f, 0.524805607f, 0.527999870f, 0.531194109f, 0.534388193f, 0.537581991f,
+    0.540775370f, 0.543968198f, 0.547160343f, 0.550351672f, 0.553542050f, 0.556731345f,
+    0.559919423f, 0.563106149f, 0.566291389f, 0.569475009f, 0.572656872f, 0.575836844f,
+    0.579014789f, 0.582190571f, 0.585364055f, 0.588535103f, 0.591703580f, 0.594869349f,
+    0.598032272f, 0.601192213f, 0.604349034f, 0.607502598f, 0.610652767f, 0.613799404f,
+    0.616942369f, 0.620081526f, 0.623216736f, 0.626347861f, 0.629474761f, 0.632597300f,
+    0.635715337f, 0.638828734f, 0.641937352f, 0.645041052f, 0.648139696f, 0.651233144f,
+    0.654321256f, 0.657403895f, 0.660480921f, 0.663552194f, 0.666617576f, 0.669676927f,
+    0.672730108f, 0.675776981f, 0.678817405f, 0.681851241f, 0.684878352f, 0.687898597f,
+    0.690911839f, 0.693917937f, 0.696916754f, 0.699908150f, 0.702891988f, 0.705868128f,
+    0.708836433f, 0.711796764f, 0.714748983f, 0.717692952f, 0.720628534f, 0.723555591f,
+    0.726473986f, 0.729383581f, 0.732284240f, 0.735175825f, 0.738058201f, 0.740931231f,
+    0.743794778f, 0.746648707f, 0.749492882f, 0.752327168f, 0.755151430f, 0.757965533f,
+    0.760769343f, 0.763562725f, 0.766345546f, 0.769117671f, 0.771878968f, 0.774629304f,
+    0.777368546f, 0.780096562f, 0.782813220f, 0.785518389f, 0.788211938f, 0.790893736f,
+    0.793563652f, 0.796221558f, 0.798867322f, 0.801500817f, 0.804121914f, 0.806730485f,
+    0.809326401f, 0.811909537f, 0.814479764f, 0.817036957f, 0.819580991f, 0.822111739f,
+    0.824629077f, 0.827132881f, 0.829623027f, 0.832099393f, 0.834561855f, 0.837010291f,
+    0.839444580f, 0.841864601f, 0.844270233f, 0.846661358f, 0.849037855f, 0.851399607f,
+    0.853746495f, 0.856078402f, 0.858395211f, 0.860696806f, 0.862983073f, 0.865253895f,
+    0.867509160f, 0.869748754f, 0.871972563f, 0.874180477f, 0.876372384f, 0.878548173f,
+    0.880707734f, 0.882850958f, 0.884977737f, 0.887087963f, 0.889181530f, 0.891258330f,
+    0.893318258f, 0.895361211f, 0.897387083f, 0.899395773f, 0.901387177f, 0.903361194f,
+    0.905317723f, 0.907256665f, 0.909177920f, 0.911081391f, 0.912966979f, 0.914834589f,
+    0.916684124f, 0.918515490f, 0.920328593f, 0.922123340f, 0.923899638f, 0.925657397f,
+    0.927396525f, 0.929116933f, 0.930818533f, 0.932501237f, 0.934164958f, 0.935809610f,
+    0.937435108f, 0.939041369f, 0.940628309f, 0.942195845f, 0.943743898f, 0.945272387f,
+    0.946781232f, 0.948270355f, 0.949739679f, 0.951189128f, 0.952618627f, 0.954028101f,
+    0.955417476f, 0.956786681f, 0.958135645f, 0.959464296f, 0.960772567f, 0.962060388f,
+    0.963327692f, 0.964574414f, 0.965800489f, 0.967005851f, 0.968190439f, 0.969354191f,
+    0.970497045f, 0.971618942f, 0.972719823f, 0.973799630f, 0.974858307f, 0.975895799f,
+    0.976912051f, 0.977907010f, 0.978880623f, 0.979832840f, 0.980763611f, 0.981672886f,
+    0.982560618f, 0.983426761f, 0.984271269f, 0.985094097f, 0.985895202f, 0.986674542f,
+    0.987432077f, 0.988167765f, 0.988881570f, 0.989573452f, 0.990243375f, 0.990891305f,
+    0.991517207f, 0.992121048f, 0.992702796f, 0.993262421f, 0.993799893f, 0.994315184f,
+    0.994808266f, 0.995279114f, 0.995727703f, 0.996154008f, 0.996558009f, 0.996939682f,
+    0.997299009f, 0.997635969f, 0.997950546f, 0.998242723f, 0.998512484f, 0.998759815f,
+    0.998984703f, 0.999187136f, 0.999367104f, 0.999524596f, 0.999659605f, 0.999772123f,
+    0.999862145f, 0.999929665f, 0.999974681f, 0.999997189f,
+};
+
+static const float g_pfWindow_kaiser_128[64] =
+{
+    0.001332514f, 0.002221019f, 0.003357829f, 0.004779594f, 0.006525103f, 0.008635091f,
+    0.011152016f, 0.014119797f, 0.017583521f, 0.021589111f, 0.026182967f, 0.031411572f,
+    0.037321076f, 0.043956851f, 0.051363031f, 0.059582027f, 0.068654040f, 0.078616560f,
+    0.089503860f, 0.101346501f, 0.114170838f, 0.127998540f, 0.142846132f, 0.158724557f,
+    0.175638773f, 0.193587378f, 0.212562286f, 0.232548437f, 0.253523560f, 0.275457998f,
+    0.298314577f, 0.322048549f, 0.346607587f, 0.371931852f, 0.397954130f, 0.424600028f,
+    0.451788243f, 0.479430900f, 0.507433952f, 0.535697645f, 0.564117046f, 0.592582625f,
+    0.620980895f, 0.649195098f, 0.677105934f, 0.704592332f, 0.731532244f, 0.757803472f,
+    0.783284512f, 0.807855400f, 0.831398568f, 0.853799694f, 0.874948535f, 0.894739743f,
+    0.913073654f, 0.929857034f, 0.945003788f, 0.958435622f, 0.970082639f, 0.979883885f,
+    0.987787819f, 0.993752714f, 0.997746987f, 0.999749443f,
+};
+
+static const float g_pfWindow_kaiser_256[128] =
+{
+    0.001332514f, 0.001746193f, 0.002217073f, 0.002749474f, 0.003347853f, 0.004016807f,
+    0.004761063f, 0.005585475f, 0.006495017f, 0.007494777f, 0.008589949f, 0.009785825f,
+    0.011087789f, 0.012501307f, 0.014031917f, 0.015685218f, 0.017466863f, 0.019382548f,
+    0.021437996f, 0.023638950f, 0.025991160f, 0.028500369f, 0.031172301f, 0.034012646f,
+    0.037027048f, 0.040221093f, 0.043600288f, 0.047170055f, 0.050935708f, 0.054902444f,
+    0.059075325f, 0.063459263f, 0.068059007f, 0.072879122f, 0.077923981f, 0.083197743f,
+    0.088704342f, 0.094447469f, 0.100430559f, 0.106656776f, 0.113128997f, 0.119849798f,
+    0.126821441f, 0.134045861f, 0.141524649f, 0.149259044f, 0.157249916f, 0.165497761f,
+    0.174002680f, 0.182764379f, 0.191782151f, 0.201054870f, 0.210580983f, 0.220358501f,
+    0.230384993f, 0.240657579f, 0.251172924f, 0.261927236f, 0.272916259f, 0.284135274f,
+    0.295579094f, 0.307242068f, 0.319118073f, 0.331200526f, 0.343482376f, 0.355956114f,
+    0.368613776f, 0.381446947f, 0.394446766f, 0.407603940f, 0.420908743f, 0.434351034f,
+    0.447920263f, 0.461605482f, 0.475395361f, 0.489278199f, 0.503241939f, 0.517274183f,
+    0.531362209f, 0.545492989f, 0.559653204f, 0.573829268f, 0.588007342f, 0.602173358f,
+    0.616313041f, 0.630411927f, 0.644455390f, 0.658428660f, 0.672316852f, 0.686104987f,
+    0.699778017f, 0.713320850f, 0.726718377f, 0.739955495f, 0.753017134f, 0.765888282f,
+    0.778554016f, 0.790999520f, 0.803210117f, 0.815171296f, 0.826868732f, 0.838288319f,
+    0.849416189f, 0.860238744f, 0.870742674f, 0.880914987f, 0.890743032f, 0.900214519f,
+    0.909317547f, 0.918040622f, 0.926372684f, 0.934303120f, 0.941821793f, 0.948919054f,
+    0.955585765f, 0.961813315f, 0.967593636f, 0.972919219f, 0.977783129f, 0.982179017f,
+    0.986101134f, 0.989544341f, 0.992504119f, 0.994976579f, 0.996958467f, 0.998447173f,
+    0.999440737f, 0.999937846f,
+};
+
+static const float g_pfWindow_kaiser_512[256] =
+{
+    0.001332514f, 0.001532063f, 0.001745329f, 0.001972835f, 0.002215113f, 0.002472705f,
+    0.002746160f, 0.003036036f, 0.003342901f, 0.003667329f, 0.004009904f, 0.004371218f,
+    0.004751869f, 0.005152464f, 0.005573618f, 0.006015953f, 0.006480096f, 0.006966684f,
+    0.007476359f, 0.008009769f, 0.008567568f, 0.009150418f, 0.009758984f, 0.010393939f,
+    0.011055957f, 0.011745722f, 0.012463919f, 0.013211238f, 0.013988373f, 0.014796022f,
+    0.015634886f, 0.016505668f, 0.017409075f, 0.018345816f, 0.019316601f, 0.020322143f,
+    0.021363154f, 0.022440349f, 0.023554443f, 0.024706149f, 0.025896183f, 0.027125257f,
+    0.028394084f, 0.029703375f, 0.031053838f, 0.032446180f, 0.033881103f, 0.035359309f,
+    0.036881494f, 0.038448350f, 0.040060565f, 0.041718821f, 0.043423796f, 0.045176161f,
+    0.046976581f, 0.048825714f, 0.050724210f, 0.052672712f, 0.054671855f, 0.056722264f,
+    0.058824557f, 0.060979339f, 0.063187208f, 0.065448750f, 0.067764539f, 0.070135139f,
+    0.072561101f, 0.075042963f, 0.077581252f, 0.080176479f, 0.082829142f, 0.085539726f,
+    0.088308698f, 0.091136513f, 0.094023607f, 0.096970402f, 0.099977302f, 0.103044695f,
+    0.106172949f, 0.109362416f, 0.112613429f, 0.115926302f, 0.119301328f, 0.122738783f,
+    0.126238920f, 0.129801972f, 0.133428153f, 0.137117653f, 0.140870641f, 0.144687263f,
+    0.148567644f, 0.152511884f, 0.156520061f, 0.160592229f, 0.164728416f, 0.168928630f,
+    0.173192849f, 0.177521030f, 0.181913102f, 0.186368969f, 0.190888511f, 0.195471580f,
+    0.200118000f, 0.204827572f, 0.209600067f, 0.214435229f, 0.219332777f, 0.224292400f,
+    0.229313759f, 0.234396490f, 0.239540198f, 0.244744460f, 0.250008826f, 0.255332816f,
+    0.260715923f, 0.266157609f, 0.271657309f, 0.277214429f, 0.282828345f, 0.288498405f,
+    0.294223928f, 0.300004204f, 0.305838493f, 0.311726027f, 0.317666009f, 0.323657613f,
+    0.329699985f, 0.335792241f, 0.341933470f, 0.348122731f, 0.354359055f, 0.360641446f,
+    0.366968878f, 0.373340301f, 0.379754632f, 0.386210765f, 0.392707566f, 0.399243872f,
+    0.405818495f, 0.412430221f, 0.419077809f, 0.425759993f, 0.432475482f, 0.439222958f,
+    0.446001080f, 0.452808482f, 0.459643775f, 0.466505545f, 0.473392356f, 0.480302749f,
+    0.487235242f, 0.494188334f, 0.501160499f, 0.508150193f, 0.515155850f, 0.522175885f,
+    0.529208694f, 0.536252654f, 0.543306125f, 0.550367447f, 0.557434945f, 0.564506928f,
+    0.571581688f, 0.578657502f, 0.585732634f, 0.592805332f, 0.599873833f, 0.606936360f,
+    0.613991124f, 0.621036327f, 0.628070158f, 0.635090798f, 0.642096419f, 0.649085183f,
+    0.656055247f, 0.663004758f, 0.669931861f, 0.676834692f, 0.683711384f, 0.690560068f,
+    0.697378867f, 0.704165908f, 0.710919313f, 0.717637203f, 0.724317700f, 0.730958928f,
+    0.737559012f, 0.744116079f, 0.750628260f, 0.757093689f, 0.763510507f, 0.769876859f,
+    0.776190898f, 0.782450784f, 0.788654684f, 0.794800775f, 0.800887245f, 0.806912290f,
+    0.812874120f, 0.818770956f, 0.824601033f, 0.830362598f, 0.836053914f, 0.841673260f,
+    0.847218929f, 0.852689234f, 0.858082504f, 0.863397086f, 0.868631348f, 0.873783676f,
+    0.878852478f, 0.883836185f, 0.888733247f, 0.893542139f, 0.898261360f, 0.902889432f,
+    0.907424904f, 0.911866349f, 0.916212366f, 0.920461583f, 0.924612656f, 0.928664266f,
+    0.932615127f, 0.936463979f, 0.940209597f, 0.943850781f, 0.947386366f, 0.950815219f,
+    0.954136237f, 0.957348353f, 0.960450532f, 0.963441772f, 0.966321106f, 0.969087604f,
+    0.971740369f, 0.974278540f, 0.976701294f, 0.979007842f, 0.981197434f, 0.983269357f,
+    0.985222936f, 0.987057532f, 0.988772547f, 0.990367419f, 0.991841628f, 0.993194691f,
+    0.994426164f, 0.995535644f, 0.996522768f, 0.997387211f, 0.998128691f, 0.998746962f,
+    0.999241823f, 0.999613112f, 0.999860705f, 0.999984522f,
+};
+
+static const float g_pfWindow_kaiser_2048[1024] =
+{
+    0.001332514f, 0.001381072f, 0.001430460f, 0.001480687f, 0.001531761f, 0.001583689f,
+    0.001636480f, 0.001690142f, 0.001744683f, 0.001800112f, 0.001856435f, 0.001913663f,
+    0.001971803f, 0.002030863f, 0.002090852f, 0.002151777f, 0.002213649f, 0.002276475f,
+    0.002340263f, 0.002405022f, 0.002470761f, 0.002537488f, 0.002605211f, 0.002673941f,
+    0.002743685f, 0.002814451f, 0.002886250f, 0.002959089f, 0.003032977f, 0.003107924f,
+    0.003183938f, 0.003261028f, 0.003339203f, 0.003418472f, 0.003498844f, 0.003580328f,
+    0.003662933f, 0.003746669f, 0.003831544f, 0.003917568f, 0.004004750f, 0.004093099f,
+    0.004182624f, 0.004273335f, 0.004365241f, 0.004458352f, 0.004552676f, 0.004648224f,
+    0.004745004f, 0.004843026f, 0.004942300f, 0.005042836f, 0.005144642f, 0.005247728f,
+    0.005352105f, 0.005457781f, 0.005564766f, 0.005673071f, 0.005782704f, 0.005893676f,
+    0.006005997f, 0.006119675f, 0.006234722f, 0.006351146f, 0.006468958f, 0.006588168f,
+    0.006708785f, 0.006830821f, 0.006954283f, 0.007079184f, 0.007205532f, 0.007333338f,
+    0.007462612f, 0.007593363f, 0.007725603f, 0.007859342f, 0.007994588f, 0.008131354f,
+    0.008269648f, 0.008409482f, 0.008550865f, 0.008693808f, 0.008838321f, 0.008984415f,
+    0.009132100f, 0.009281385f, 0.009432283f, 0.009584802f, 0.009738955f, 0.009894750f,
+    0.010052199f, 0.010211311f, 0.010372099f, 0.010534571f, 0.010698739f, 0.010864614f,
+    0.011032205f, 0.011201524f, 0.011372581f, 0.011545387f, 0.011719952f, 0.011896288f,
+    0.012074405f, 0.012254313f, 0.012436023f, 0.012619547f, 0.012804895f, 0.012992077f,
+    0.013181105f, 0.013371989f, 0.013564740f, 0.013759369f, 0.013955887f, 0.014154305f,
+    0.014354634f, 0.014556884f, 0.014761066f, 0.014967192f, 0.015175272f, 0.015385317f,
+    0.015597338f, 0.015811346f, 0.016027353f, 0.016245369f, 0.016465404f, 0.016687471f,
+    0.016911580f, 0.017137742f, 0.017365968f, 0.017596269f, 0.017828656f, 0.018063141f,
+    0.018299734f, 0.018538447f, 0.018779289f, 0.019022274f, 0.019267411f, 0.019514712f,
+    0.019764187f, 0.020015848f, 0.020269707f, 0.020525773f, 0.020784059f, 0.021044575f,
+    0.021307332f, 0.021572342f, 0.021839615f, 0.022109164f, 0.022380998f, 0.022655129f,
+    0.022931568f, 0.023210326f, 0.023491415f, 0.023774845f, 0.024060628f, 0.024348774f,
+    0.024639295f, 0.024932202f, 0.025227506f, 0.025525218f, 0.025825350f, 0.026127911f,
+    0.026432914f, 0.026740370f, 0.027050289f, 0.027362683f, 0.027677562f, 0.027994938f,
+    0.028314822f, 0.028637225f, 0.028962157f, 0.029289631f, 0.029619656f, 0.029952245f,
+    0.030287407f, 0.030625155f, 0.030965498f, 0.031308448f, 0.031654017f, 0.032002214f,
+    0.032353051f, 0.032706538f, 0.033062687f, 0.033421509f, 0.033783014f, 0.034147214f,
+    0.034514118f, 0.034883739f, 0.035256086f, 0.035631171f, 0.036009005f, 0.036389598f,
+    0.036772961f, 0.037159104f, 0.037548039f, 0.037939777f, 0.038334327f, 0.038731701f,
+    0.039131909f, 0.039534962f, 0.039940870f, 0.040349645f, 0.040761296f, 0.041175834f,
+    0.041593270f, 0.042013615f, 0.042436878f, 0.042863070f, 0.043292202f, 0.043724284f,
+    0.044159327f, 0.044597340f, 0.045038334f, 0.045482320f, 0.045929308f, 0.046379307f,
+    0.046832329f, 0.047288384f, 0.047747480f, 0.048209630f, 0.048674843f, 0.049143128f,
+    0.049614497f, 0.050088958f, 0.050566523f, 0.051047201f, 0.051531001f, 0.052017934f,
+    0.052508011f, 0.053001239f, 0.053497630f, 0.053997193f, 0.054499938f, 0.055005874f,
+    0.055515012f, 0.056027360f, 0.056542929f, 0.057061728f, 0.057583766f, 0.058109053f,
+    0.058637599f, 0.059169412f, 0.059704502f, 0.060242879f, 0.060784552f, 0.061329529f,
+    0.061877821f, 0.062429435f, 0.062984383f, 0.063542672f, 0.064104311f, 0.064669310f,
+    0.065237677f, 0.065809421f, 0.066384552f, 0.066963077f, 0.067545007f, 0.068130349f,
+    0.068719111f, 0.069311304f, 0.069906935f, 0.070506013f, 0.071108546f, 0.071714542f,
+    0.072324011f, 0.072936960f, 0.073553398f, 0.074173333f, 0.074796773f, 0.075423726f,
+    0.076054200f, 0.076688204f, 0.077325745f, 0.077966831f, 0.078611470f, 0.079259670f,
+    0.079911438f, 0.080566782f, 0.081225711f, 0.081888231f, 0.082554350f, 0.083224075f,
+    0.083897414f, 0.084574374f, 0.085254963f, 0.085939188f, 0.086627055f, 0.087318572f,
+    0.088013746f, 0.088712585f, 0.089415094f, 0.090121281f, 0.090831153f, 0.091544716f,
+    0.092261977f, 0.092982942f, 0.093707619f, 0.094436013f, 0.095168132f, 0.095903981f,
+    0.096643566f, 0.097386895f, 0.098133973f, 0.098884805f, 0.099639399f, 0.100397761f,
+    0.101159895f, 0.101925808f, 0.102695505f, 0.103468993f, 0.104246277f, 0.105027362f,
+    0.105812254f, 0.106600959f, 0.107393481f, 0.108189825f, 0.108989998f, 0.109794004f,
+    0.110601848f, 0.111413535f, 0.112229069f, 0.113048457f, 0.113871702f, 0.114698810f,
+    0.115529784f, 0.116364629f, 0.117203350f, 0.118045951f, 0.118892436f, 0.119742810f,
+    0.120597076f, 0.121455239f, 0.122317302f, 0.123183270f, 0.124053146f, 0.124926933f,
+    0.125804637f, 0.126686259f, 0.127571804f, 0.128461275f, 0.129354676f, 0.130252009f,
+    0.131153277f, 0.132058484f, 0.132967633f, 0.133880726f, 0.134797767f, 0.135718757f,
+    0.136643700f, 0.137572599f, 0.138505455f, 0.139442271f, 0.140383050f, 0.141327793f,
+    0.142276503f, 0.143229181f, 0.144185830f, 0.145146451f, 0.146111046f, 0.147079618f,
+    0.148052166f, 0.149028694f, 0.150009202f, 0.150993691f, 0.151982164f, 0.152974620f,
+    0.153971061f, 0.154971488f, 0.155975901f, 0.156984302f, 0.157996692f, 0.159013069f,
+    0.160033436f, 0.161057793f, 0.162086139f, 0.163118475f, 0.164154802f, 0.165195118f,
+    0.166239424f, 0.167287720f, 0.168340006f, 0.169396280f, 0.170456543f, 0.171520794f,
+    0.172589032f, 0.173661257f, 0.174737467f, 0.175817662f, 0.176901841f, 0.177990002f,
+    0.179082144f, 0.180178265f, 0.181278365f, 0.182382442f, 0.183490493f, 0.184602518f,
+    0.185718514f, 0.186838479f, 0.187962411f, 0.189090309f, 0.190222169f, 0.191357990f,
+    0.192497768f, 0.193641502f, 0.194789188f, 0.195940824f, 0.197096407f, 0.198255934f,
+    0.199419401f, 0.200586806f, 0.201758145f, 0.202933415f, 0.204112612f, 0.205295732f,
+    0.206482773f, 0.207673729f, 0.208868597f, 0.210067373f, 0.211270053f, 0.212476633f,
+    0.213687107f, 0.214901473f, 0.216119724f, 0.217341856f, 0.218567865f, 0.219797746f,
+    0.221031493f, 0.222269102f, 0.223510567f, 0.224755882f, 0.226005043f, 0.227258044f,
+    0.228514879f, 0.229775542f, 0.231040027f, 0.232308329f, 0.233580441f, 0.234856358f,
+    0.236136072f, 0.237419577f, 0.238706867f, 0.239997935f, 0.241292775f, 0.242591379f,
+    0.243893740f, 0.245199852f, 0.246509706f, 0.247823297f, 0.249140616f, 0.250461655f,
+    0.251786408f, 0.253114866f, 0.254447021f, 0.255782866f, 0.257122392f, 0.258465592f,
+    0.259812456f, 0.261162976f, 0.262517145f, 0.263874952f, 0.265236390f, 0.266601449f,
+    0.267970121f, 0.269342396f, 0.270718265f, 0.272097719f, 0.273480749f, 0.274867344f,
+    0.276257495f, 0.277651193f, 0.279048426f, 0.280449187f, 0.281853463f, 0.283261246f,
+    0.284672524f, 0.286087288f, 0.287505526f, 0.288927228f, 0.290352383f, 0.291780980f,
+    0.293213009f, 0.294648457f, 0.296087315f, 0.297529570f, 0.298975211f, 0.300424226f,
+    0.301876604f, 0.303332333f, 0.304791401f, 0.306253795f, 0.307719505f, 0.309188517f,
+    0.310660819f, 0.312136399f, 0.313615243f, 0.315097340f, 0.316582677f, 0.318071240f,
+    0.319563017f, 0.321057994f, 0.322556158f, 0.324057496f, 0.325561994f, 0.327069638f,
+    0.328580416f, 0.330094312f, 0.331611314f, 0.333131407f, 0.334654577f, 0.336180809f,
+    0.337710090f, 0.339242404f, 0.340777738f, 0.342316076f, 0.343857404f, 0.345401707f,
+    0.346948969f, 0.348499176f, 0.350052312f, 0.351608362f, 0.353167310f, 0.354729141f,
+    0.356293840f, 0.357861389f, 0.359431775f, 0.361004979f, 0.362580987f, 0.364159782f,
+    0.365741347f, 0.367325667f, 0.368912725f, 0.370502503f, 0.372094986f, 0.373690156f,
+    0.375287997f, 0.376888490f, 0.378491620f, 0.380097369f, 0.381705719f, 0.383316653f,
+    0.384930153f, 0.386546201f, 0.388164781f, 0.389785873f, 0.391409459f, 0.393035522f,
+    0.394664044f, 0.396295006f, 0.397928389f, 0.399564174f, 0.401202345f, 0.402842880f,
+    0.404485763f, 0.406130973f, 0.407778492f, 0.409428300f, 0.411080378f, 0.412734708f,
+    0.414391268f, 0.416050041f, 0.417711005f, 0.419374142f, 0.421039432f, 0.422706853f,
+    0.424376388f, 0.426048015f, 0.427721713f, 0.429397464f, 0.431075245f, 0.432755038f,
+    0.434436820f, 0.436120572f, 0.437806272f, 0.439493900f, 0.441183434f, 0.442874853f,
+    0.444568137f, 0.446263264f, 0.447960212f, 0.449658960f, 0.451359486f, 0.453061769f,
+    0.454765787f, 0.456471518f, 0.458178941f, 0.459888032f, 0.461598770f, 0.463311133f,
+    0.465025098f, 0.466740643f, 0.468457746f, 0.470176384f, 0.471896534f, 0.473618173f,
+    0.475341279f, 0.477065829f, 0.478791800f, 0.480519168f, 0.482247911f, 0.483978005f,
+    0.485709426f, 0.487442152f, 0.489176159f, 0.490911424f, 0.492647921f, 0.494385629f,
+    0.496124523f, 0.497864579f, 0.499605772f, 0.501348080f, 0.503091478f, 0.504835941f,
+    0.506581445f, 0.508327967f, 0.510075480f, 0.511823962f, 0.513573387f, 0.515323730f,
+    0.517074967f, 0.518827073f, 0.520580023f, 0.522333791f, 0.524088354f, 0.525843685f,
+    0.527599760f, 0.529356553f, 0.531114039f, 0.532872192f, 0.534630987f, 0.536390399f,
+    0.538150401f, 0.539910969f, 0.541672075f, 0.543433695f, 0.545195803f, 0.546958372f,
+    0.548721376f, 0.550484790f, 0.552248587f, 0.554012741f, 0.555777226f, 0.557542015f,
+    0.559307082f, 0.561072401f, 0.562837944f, 0.564603686f, 0.566369599f, 0.568135658f,
+    0.569901834f, 0.571668102f, 0.573434434f, 0.575200804f, 0.576967185f, 0.578733549f,
+    0.580499869f, 0.582266118f, 0.584032270f, 0.585798296f, 0.587564169f, 0.589329863f,
+    0.591095349f, 0.592860600f, 0.594625589f, 0.596390288f, 0.598154670f, 0.599918706f,
+    0.601682369f, 0.603445632f, 0.605208466f, 0.606970844f, 0.608732737f, 0.610494119f,
+    0.612254960f, 0.614015233f, 0.615774910f, 0.617533963f, 0.619292363f, 0.621050083f,
+    0.622807094f, 0.624563368f, 0.626318876f, 0.628073591f, 0.629827484f, 0.631580526f,
+    0.633332690f, 0.635083946f, 0.636834266f, 0.638583622f, 0.640331985f, 0.642079327f,
+    0.643825618f, 0.645570831f, 0.647314936f, 0.649057905f, 0.650799710f, 0.652540320f,
+    0.654279708f, 0.656017845f, 0.657754702f, 0.659490250f, 0.661224460f, 0.662957303f,
+    0.664688750f, 0.666418774f, 0.668147343f, 0.669874430f, 0.671600005f, 0.673324040f,
+    0.675046505f, 0.676767372f, 0.678486611f, 0.680204193f, 0.681920089f, 0.683634270f,
+    0.685346707f, 0.687057371f, 0.688766232f, 0.690473262f, 0.692178431f, 0.693881710f,
+    0.695583071f, 0.697282482f, 0.698979917f, 0.700675344f, 0.702368736f, 0.704060063f,
+    0.705749295f, 0.707436404f, 0.709121361f, 0.710804135f, 0.712484698f, 0.714163021f,
+    0.715839074f, 0.717512828f, 0.719184255f, 0.720853324f, 0.722520006f, 0.724184274f,
+    0.725846096f, 0.727505444f, 0.729162289f, 0.730816602f, 0.732468353f, 0.734117514f,
+    0.735764055f, 0.737407947f, 0.739049161f, 0.740687668f, 0.742323438f, 0.743956443f,
+    0.745586654f, 0.747214042f, 0.748838577f, 0.750460231f, 0.752078974f, 0.753694778f,
+    0.755307613f, 0.756917452f, 0.758524264f, 0.760128021f, 0.761728694f, 0.763326254f,
+    0.764920673f, 0.766511922f, 0.768099971f, 0.769684793f, 0.771266358f, 0.772844637f,
+    0.774419603f, 0.775991226f, 0.777559479f, 0.779124331f, 0.780685756f, 0.782243723f,
+    0.783798206f, 0.785349175f, 0.786896602f, 0.788440459f, 0.789980718f, 0.791517349f,
+    0.793050325f, 0.794579619f, 0.796105200f, 0.797627043f, 0.799145117f, 0.800659396f,
+    0.802169852f, 0.803676456f, 0.805179180f, 0.806677997f, 0.808172879f, 0.809663798f,
+    0.811150727f, 0.812633637f, 0.814112502f, 0.815587293f, 0.817057983f, 0.818524546f,
+    0.819986952f, 0.821445175f, 0.822899188f, 0.824348963f, 0.825794474f, 0.827235692f,
+    0.828672592f, 0.830105146f, 0.831533327f, 0.832957108f, 0.834376462f, 0.835791363f,
+    0.837201784f, 0.838607698f, 0.840009079f, 0.841405900f, 0.842798134f, 0.844185756f,
+    0.845568739f, 0.846947057f, 0.848320683f, 0.849689592f, 0.851053757f, 0.852413153f,
+    0.853767754f, 0.855117533f, 0.856462465f, 0.857802524f, 0.859137685f, 0.860467922f,
+    0.861793210f, 0.863113523f, 0.864428836f, 0.865739124f, 0.867044362f, 0.868344524f,
+    0.869639586f, 0.870929522f, 0.872214308f, 0.873493920f, 0.874768331f, 0.876037519f,
+    0.877301458f, 0.878560124f, 0.879813492f, 0.881061539f, 0.882304240f, 0.883541572f,
+    0.884773509f, 0.886000029f, 0.887221107f, 0.888436720f, 0.889646844f, 0.890851456f,
+    0.892050532f, 0.893244049f, 0.894431984f, 0.895614313f, 0.896791014f, 0.897962063f,
+    0.899127437f, 0.900287115f, 0.901441073f, 0.902589288f, 0.903731739f, 0.904868402f,
+    0.905999256f, 0.907124278f, 0.908243446f, 0.909356739f, 0.910464134f, 0.911565610f,
+    0.912661145f, 0.913750718f, 0.914834306f, 0.915911890f, 0.916983446f, 0.918048956f,
+    0.919108396f, 0.920161747f, 0.921208988f, 0.922250098f, 0.923285056f, 0.924313842f,
+    0.925336436f, 0.926352817f, 0.927362965f, 0.928366861f, 0.929364484f, 0.930355814f,
+    0.931340832f, 0.932319519f, 0.933291855f, 0.934257820f, 0.935217396f, 0.936170563f,
+    0.937117302f, 0.938057595f, 0.938991422f, 0.939918766f, 0.940839607f, 0.941753928f,
+    0.942661710f, 0.943562935f, 0.944457585f, 0.945345642f, 0.946227088f, 0.947101907f,
+    0.947970079f, 0.948831589f, 0.949686418f, 0.950534549f, 0.951375966f, 0.952210652f,
+    0.953038590f, 0.953859763f, 0.954674156f, 0.955481750f, 0.956282531f, 0.957076483f,
+    0.957863588f, 0.958643833f, 0.959417200f, 0.960183674f, 0.960943240f, 0.961695883f,
+    0.962441587f, 0.963180337f, 0.963912119f, 0.964636918f, 0.965354719f, 0.966065507f,
+    0.966769269f, 0.967465990f, 0.968155657f, 0.968838254f, 0.969513768f, 0.970182187f,
+    0.970843495f, 0.971497681f, 0.972144730f, 0.972784630f, 0.973417367f, 0.974042929f,
+    0.974661303f, 0.975272476f, 0.975876437f, 0.976473173f, 0.977062672f, 0.977644921f,
+    0.978219910f, 0.978787627f, 0.979348059f, 0.979901196f, 0.980447026f, 0.980985538f,
+    0.981516722f, 0.982040566f, 0.982557060f, 0.983066194f, 0.983567957f, 0.984062338f,
+    0.984549328f, 0.985028918f, 0.985501096f, 0.985965854f, 0.986423182f, 0.986873071f,
+    0.987315511f, 0.987750494f, 0.988178011f, 0.988598053f, 0.989010611f, 0.989415678f,
+    0.989813244f, 0.990203302f, 0.990585843f, 0.990960861f, 0.991328347f, 0.991688294f,
+    0.992040694f, 0.992385540f, 0.992722826f, 0.993052544f, 0.993374688f, 0.993689251f,
+    0.993996226f, 0.994295608f, 0.994587390f, 0.994871566f, 0.995148131f, 0.995417079f,
+    0.995678404f, 0.995932101f, 0.996178165f, 0.996416590f, 0.996647373f, 0.996870507f,
+    0.997085990f, 0.997293815f, 0.997493980f, 0.997686479f, 0.997871309f, 0.998048467f,
+    0.998217948f, 0.998379749f, 0.998533867f, 0.998680298f, 0.998819040f, 0.998950090f,
+    0.999073445f, 0.999189102f, 0.999297060f, 0.999397315f, 0.999489867f, 0.999574712f,
+    0.999651850f, 0.999721279f, 0.999782996f, 0.999837002f, 0.999883295f, 0.999921874f,
+    0.999952738f, 0.999975886f, 0.999991319f, 0.999999035f,
+};
+
+#endif
+
+//*****************************************************************************
+//
+// The window descriptor table, indexed by window type and then by size.
+//
+//*****************************************************************************
+#ifdef WINDOW_TABLES_FLOAT
+#define WINDOW_TABLE(name, size)    g_pfWindow_##name##_##size
+#else
+#define WINDOW_TABLE(name, size)    g_psWindow_##name##_##size
+#endif
+
+const unsigned short g_pusWindowSizes[NUM_WINDOW_SIZES] =
+{
+    128, 256, 512, 2048
+};
+
+const tWindowTable g_psWindowTables[NUM_WINDOWS][NUM_WINDOW_SIZES] =
+{
+    //
+    // Hamming
+    //
+    {
+        { 128, 0.5364063f, 1.3705315f, WINDOW_TABLE(hamming, 128) },
+        { 256, 0.5382031f, 1.3666682f, WINDOW_TABLE(hamming, 256) },
+        { 512, 0.5391016f, 1.3647444f, WINDOW_TABLE(hamming, 512) },
+        { 2048, 0.5397754f, 1.3633049f, WINDOW_TABLE(hamming, 2048) },
+    },
+    //
+    // Hann
+    //
+    {
+        { 128, 0.4960938f, 1.5118110f, WINDOW_TABLE(hann, 128) },
+        { 256, 0.4980469f, 1.5058824f, WINDOW_TABLE(hann, 256) },
+        { 512, 0.4990234f, 1.5029354f, WINDOW_TABLE(hann, 512) },
+        { 2048, 0.4997559f, 1.5007328f, WINDOW_TABLE(hann, 2048) },
+    },
+    //
+    // Blackman-Harris
+    //
+    {
+        { 128, 0.3559477f, 2.0201299f, WINDOW_TABLE(blackman_harris, 128) },
+        { 256, 0.3573489f, 2.0122105f, WINDOW_TABLE(blackman_harris, 256) },
+        { 512, 0.3580494f, 2.0082740f, WINDOW_TABLE(blackman_harris, 512) },
+        { 2048, 0.3585749f, 2.0053318f, WINDOW_TABLE(blackman_harris, 2048) },
+    },
+    //
+    // Flat top
+    //
+    {
+        { 128, 0.2138914f, 3.8000503f, WINDOW_TABLE(flat_top, 128) },
+        { 256, 0.2147352f, 3.7850897f, WINDOW_TABLE(flat_top, 256) },
+        { 512, 0.2151571f, 3.7776535f, WINDOW_TABLE(flat_top, 512) },
+        { 2048, 0.2154735f, 3.7720955f, WINDOW_TABLE(flat_top, 2048) },
+    },
+    //
+    // Kaiser
+    //
+    {
+        { 128, 0.4175220f, 1.7348503f, WINDOW_TABLE(kaiser, 128) },
+        { 256, 0.4191613f, 1.7280839f, WINDOW_TABLE(kaiser, 256) },
+        { 512, 0.4199808f, 1.7247220f, WINDOW_TABLE(kaiser, 512) },
+        { 2048, 0.4205953f, 1.7222099f, WINDOW_TABLE(kaiser, 2048) },
+    },
+};
@@ -0,0 +1,303 @@
+//*****************************************************************************
+//
+// zoom.c - Zoom FFT, for a finely resolved spectrum of a narrow band.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the <organization> nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+// THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+
+#include "arm_math.h"
+#include "gui.h"
+#include "dsp.h"
+#include "window.h"
+#include "zoom.h"
+#include <math.h>
+
+//*****************************************************************************
+//
+// Private predefines and variables
+//
+//*****************************************************************************
+
+//
+// The part of the decimated band, as a fraction of the decimated rate, that
+// is clear of aliases.  The decimation filters start to roll off past this.
+//
+#define ZOOM_PASS_FRACTION		0.4f
+
+//
+// Flags passed to the CMSIS complex FFT init function: forward transform, with
+// the output in normal order
+//
+#define ZOOM_FFT_INVERT			0
+#define ZOOM_FFT_BIT_ORDER		1
+
+//*****************************************************************************
+//
+// Private Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Design the lowpass filter run ahead of each decimation by 2: a Hamming
+// windowed sinc, half way down at a quarter of the input rate and normalized
+// for unity gain at DC.
+//
+// param pfCoeffs: where to store the ZOOM_TAPS coefficients
+//
+//*****************************************************************************
+static void
+DesignDecimator(float32_t *pfCoeffs)
+{
+	unsigned long ulTap;
+	float fX, fSum;
+
+	fSum = 0;
+	for(ulTap = 0; ulTap < ZOOM_TAPS; ulTap++)
+	{
+		fX = (float)ulTap - ((ZOOM_TAPS - 1) / 2.0f);
+		pfCoeffs[ulTap] = (fX == 0) ? 0.5f :
+						  (sinf(0.5f * PI * fX) / (PI * fX));
+		pfCoeffs[ulTap] *= 0.54f - (0.46f * cosf((2.0f * PI * ulTap) /
+												 (ZOOM_TAPS - 1)));
+		fSum += pfCoeffs[ulTap];
+	}
+	arm_scale_f32(pfCoeffs, 1.0f / fSum, pfCoeffs, ZOOM_TAPS);
+}
+
+//*****************************************************************************
+//
+// Public Functions
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Work out how far a band can be decimated and still be seen cleanly.
+//
+// After mixing down, the band sits around 0 Hz and has to fit within the
+// alias free part of the decimated rate.  The mirror image of the band, which
+// the mixer moves down to twice the center frequency, never overlaps the band
+// and is taken out by the decimation filters along with everything else.
+//
+// param ulSampleRate: the input sample rate, in Hz
+// param ulMinFreq, ulMaxFreq: the band, in Hz
+//
+// return: the decimation, a power of 2, or 1 if the band is too wide for
+//		   zooming to pay off
+//
+//*****************************************************************************
+unsigned long
+ZoomDecimationGet(unsigned long ulSampleRate, unsigned long ulMinFreq,
+				  unsigned long ulMaxFreq)
+{
+	unsigned long ulDecimation;
+	float fHalfWidth;
+
+	if(ulMaxFreq <= ulMinFreq)
+	{
+		return(1);
+	}
+	fHalfWidth = ((float)ulMaxFreq - (float)ulMinFreq) / 2.0f;
+
+	for(ulDecimation = 1 << ZOOM_MAX_STAGES;
+		ulDecimation >= ZOOM_MIN_DECIMATION; ulDecimation /= 2)
+	{
+		if(fHalfWidth <= (ZOOM_PASS_FRACTION * (float)ulSampleRate /
+						  (float)ulDecimation))
+		{
+			return(ulDecimation);
+		}
+	}
+
+	return(1);
+}
+
+//*****************************************************************************
+//
+// Set up the zoom FFT.
+//
+// param psZoom: the zoom FFT state to initialize
+// param ulBytes: the number of bytes available at psZoom
+// param ulSampleRate: the input sample rate, in Hz
+// param fCenter: the frequency, in Hz, at the center of the zoomed spectrum
+// param ulDecimation: the decimation from ZoomDecimationGet
+//
+// return: 1 if the zoom FFT is ready to use, 0 if it doesn't fit in ulBytes or
+//		   the decimation isn't supported
+//
+//*****************************************************************************
+unsigned long
+ZoomInit(tZoom *psZoom, unsigned long ulBytes, unsigned long ulSampleRate,
+		 float fCenter, unsigned long ulDecimation)
+{
+	unsigned long ulStage, ulChannel, ulBlock, ulState;
+
+	if((ulBytes < sizeof(tZoom)) || (ulDecimation < 2) ||
+	   (ulDecimation > (1 << ZOOM_MAX_STAGES)) ||
+	   (ulDecimation & (ulDecimation - 1)))
+	{
+		return(0);
+	}
+
+	psZoom->fCenter = fCenter;
+	psZoom->fPhase = 0;
+	psZoom->fPhaseStep = 360.0f * fCenter / (float)ulSampleRate;
+
+	DesignDecimator(psZoom->pfCoeffs);
+
+	//
+	// Every stage uses the same filter.  Each one sees half the block size
+	// of the one before it, so hand out the state buffer accordingly.
+	//
+	psZoom->ulNumStages = 0;
+	while((1UL << psZoom->ulNumStages) < ulDecimation)
+	{
+		psZoom->ulNumStages++;
+	}
+	for(ulChannel = 0; ulChannel < 2; ulChannel++)
+	{
+		ulState = 0;
+		ulBlock = ZOOM_BLOCK_SIZE;
+		for(ulStage = 0; ulStage < psZoom->ulNumStages; ulStage++)
+		{
+			arm_fir_decimate_init_f32(&psZoom->psDecim[ulChannel][ulStage],
+									  ZOOM_TAPS, 2, psZoom->pfCoeffs,
+									  psZoom->pfState[ulChannel] + ulState,
+									  ulBlock);
+			ulState += ZOOM_TAPS + ulBlock - 1;
+			ulBlock /= 2;
+		}
+	}
+
+	arm_fill_f32(0, psZoom->pfRing, ZOOM_FFT_SIZE * 2);
+	psZoom->ulRingPos = 0;
+
+	arm_cfft_radix4_init_f32(&psZoom->sFFT, ZOOM_FFT_SIZE, ZOOM_FFT_INVERT,
+							 ZOOM_FFT_BIT_ORDER);
+
+	return(1);
+}
+
+//*****************************************************************************
+//
+// Mix a block of samples down, decimate it, and add the result to the ring of
+// decimated samples.
+//
+// The mixer multiplies by e^(-j phase), which moves the center frequency to 0
+// Hz.  Each channel is then lowpass filtered and halved in rate once per
+// stage.
+//
+// param psZoom: the zoom FFT state
+// param pfSamples: ZOOM_BLOCK_SIZE new samples, centered around 0
+//
+//*****************************************************************************
+void
+ZoomProcess(tZoom *psZoom, const float32_t *pfSamples)
+{
+	unsigned long ulIdx, ulStage, ulLength;
+	float32_t fSin, fCos;
+
+	for(ulIdx = 0; ulIdx < ZOOM_BLOCK_SIZE; ulIdx++)
+	{
+		arm_sin_cos_f32(psZoom->fPhase, &fSin, &fCos);
+		psZoom->pfI[ulIdx] = pfSamples[ulIdx] * fCos;
+		psZoom->pfQ[ulIdx] = -pfSamples[ulIdx] * fSin;
+
+		psZoom->fPhase += psZoom->fPhaseStep;
+		if(psZoom->fPhase >= 180.0f)
+		{
+			psZoom->fPhase -= 360.0f;
+		}
+	}
+
+	//
+	// Decimate in place.  Each output sample only depends on inputs at or
+	// after its own index, so nothing is overwritten before it's used.
+	//
+	ulLength = ZOOM_BLOCK_SIZE;
+	for(ulStage = 0; ulStage < psZoom->ulNumStages; ulStage++)
+	{
+		arm_fir_decimate_f32(&psZoom->psDecim[0][ulStage], psZoom->pfI,
+							 psZoom->pfI, ulLength);
+		arm_fir_decimate_f32(&psZoom->psDecim[1][ulStage], psZoom->pfQ,
+							 psZoom->pfQ, ulLength);
+		ulLength /= 2;
+	}
+
+	for(ulIdx = 0; ulIdx < ulLength; ulIdx++)
+	{
+		psZoom->pfRing[2 * psZoom->ulRingPos] = psZoom->pfI[ulIdx];
+		psZoom->pfRing[(2 * psZoom->ulRingPos) + 1] = psZoom->pfQ[ulIdx];
+		psZoom->ulRingPos = (psZoom->ulRingPos + 1) % ZOOM_FFT_SIZE;
+	}
+}
+
+//*****************************************************************************
+//
+// Calculate the spectrum of the last ZOOM_FFT_SIZE decimated samples.
+//
+// The ring is windowed, oldest sample first, and transformed.  The bins are
+// then swapped around so they run from the lowest frequency to the highest:
+// bin i is at the center frequency plus (i - ZOOM_FFT_SIZE / 2) times the
+// decimated rate over ZOOM_FFT_SIZE.
+//
+// param psZoom: the zoom FFT state
+// param psWindow: the window to apply, ZOOM_FFT_SIZE long
+// param pfBuffer: where to store the ZOOM_FFT_SIZE complex bins
+//
+//*****************************************************************************
+void
+ZoomSpectrum(tZoom *psZoom, const tWindowTable *psWindow, float32_t *pfBuffer)
+{
+	unsigned long ulIdx, ulRing;
+	float32_t fCoef, fTemp;
+
+	ulRing = psZoom->ulRingPos;
+	for(ulIdx = 0; ulIdx < ZOOM_FFT_SIZE; ulIdx++)
+	{
+		fCoef = WINDOW_COEF_TO_FLOAT(psWindow->pCoefs[
+					(ulIdx < ZOOM_FFT_SIZE / 2) ? ulIdx :
+					(ZOOM_FFT_SIZE - 1 - ulIdx)]);
+		pfBuffer[2 * ulIdx] = psZoom->pfRing[2 * ulRing] * fCoef;
+		pfBuffer[(2 * ulIdx) + 1] = psZoom->pfRing[(2 * ulRing) + 1] * fCoef;
+		ulRing = (ulRing + 1) % ZOOM_FFT_SIZE;
+	}
+
+	arm_cfft_radix4_f32(&psZoom->sFFT, pfBuffer);
+
+	//
+	// Move the negative frequencies, which the FFT leaves in the top half,
+	// below the positive ones
+	//
+	for(ulIdx = 0; ulIdx < ZOOM_FFT_SIZE; ulIdx++)
+	{
+		fTemp = pfBuffer[ulIdx];
+		pfBuffer[ulIdx] = pfBuffer[ulIdx + ZOOM_FFT_SIZE];
+		pfBuffer[ulIdx + ZOOM_FFT_SIZE] = fTemp;
+	}
+}
@@ -0,0 +1,138 @@
+//*****************************************************************************
+//
+// zoom.h - Predefines, public functions, and globals for the zoom FFT.
+//
+// Copyright (c) 2012 Texas Instruments Incorporated.  All rights reserved.
+//
+//*****************************************************************************
+
+#ifndef __ZOOM_H__
+#define __ZOOM_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// pre-processor macros
+//
+//*****************************************************************************
+
+//
+// The length of the complex FFT run on the decimated signal.  This must be a
+// length arm_cfft_radix4_f32 supports and one the window tables were
+// generated for.
+//
+#define ZOOM_FFT_SIZE			256
+
+//
+// The signal is decimated by 2 this many times at most, for a total
+// decimation of up to 64
+//
+#define ZOOM_MAX_STAGES			6
+
+//
+// Zooming only pays off once the decimation is large enough that the zoomed
+// spectrum is at least as fine as the full-band one
+//
+#define ZOOM_MIN_DECIMATION		(NUM_SAMPLES / ZOOM_FFT_SIZE)
+
+//
+// The number of taps in the lowpass filter run ahead of each decimation
+//
+#define ZOOM_TAPS				33
+
+//
+// The number of input samples taken at a time.  This has to be a multiple of
+// the largest decimation so every stage sees whole pairs of samples.
+//
+#define ZOOM_BLOCK_SIZE			64
+
+//
+// The number of state values the decimation filters for one channel need, at
+// most.  Stage k needs ZOOM_TAPS - 1 plus its block size, ZOOM_BLOCK_SIZE
+// halved k times.
+//
+#define ZOOM_STATE_SIZE			((ZOOM_MAX_STAGES * (ZOOM_TAPS - 1)) +	  \
+								 (2 * ZOOM_BLOCK_SIZE))
+
+//*****************************************************************************
+//
+// The state of the zoom FFT: the mixer, the decimation filters for the in
+// phase (I) and quadrature (Q) channels, and the most recent ZOOM_FFT_SIZE
+// decimated samples.  This is big, so the caller provides the memory.
+//
+//*****************************************************************************
+typedef struct
+{
+	//
+	// The frequency, in Hz, that is mixed down to 0 Hz.
+	//
+	float fCenter;
+
+	//
+	// The phase of the mixer, and how far it advances each sample, in
+	// degrees.
+	//
+	float32_t fPhase;
+	float32_t fPhaseStep;
+
+	//
+	// The number of times the signal is decimated by 2.
+	//
+	unsigned long ulNumStages;
+
+	arm_fir_decimate_instance_f32 psDecim[2][ZOOM_MAX_STAGES];
+	float32_t pfCoeffs[ZOOM_TAPS];
+	float32_t pfState[2][ZOOM_STATE_SIZE];
+
+	//
+	// The I and Q channels of the block being decimated.
+	//
+	float32_t pfI[ZOOM_BLOCK_SIZE];
+	float32_t pfQ[ZOOM_BLOCK_SIZE];
+
+	//
+	// A ring of the last ZOOM_FFT_SIZE decimated complex samples, and the
+	// index of the oldest one.
+	//
+	float32_t pfRing[ZOOM_FFT_SIZE * 2];
+	unsigned long ulRingPos;
+
+	arm_cfft_radix4_instance_f32 sFFT;
+}
+tZoom;
+
+//*****************************************************************************
+//
+// public functions
+//
+//*****************************************************************************
+extern unsigned long ZoomDecimationGet(unsigned long ulSampleRate,
+									   unsigned long ulMinFreq,
+									   unsigned long ulMaxFreq);
+extern unsigned long ZoomInit(tZoom *psZoom, unsigned long ulBytes,
+							  unsigned long ulSampleRate, float fCenter,
+							  unsigned long ulDecimation);
+extern void ZoomProcess(tZoom *psZoom, const float32_t *pfSamples);
+extern void ZoomSpectrum(tZoom *psZoom, const tWindowTable *psWindow,
+						 float32_t *pfBuffer);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ZOOM_H__
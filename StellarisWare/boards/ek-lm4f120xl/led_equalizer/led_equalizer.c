@@ -177,8 +177,9 @@ arm_cfft_radix4_instance_f32 cfftStructure;
 // Hamming window, used to prepare samples for fft and correct for the fact
 // we're using an algorithm meant for a continuous, infinite signal on a
 // signal that is finite and not always continuous.
+// Only the first half of the window is stored, since it is symmetric.
 //
-extern float ti_hamming_window_vector[NUM_SAMPLES];
+extern float ti_hamming_window_vector[NUM_SAMPLES / 2];
 
 //
 // The range in Hertz of each frequency bin
@@ -719,7 +720,11 @@ SampleSineTest(void)
 
 	//arm_mult_q15 (ti_sample_sine_vector, ti_hamming_window_vector, ti_sample_sine_vector, NUM_SAMPLES);
 	//arm_mult_f32((float32_t *)g_ulADCValues, ti_hamming_window_vector, (float32_t *)g_ulADCValues, NUM_SAMPLES);
-	arm_mult_f32(g_fFFTResult, ti_hamming_window_vector, g_fFFTResult, NUM_SAMPLES);
+	for(i=0;i<NUM_SAMPLES/2;i++)
+	{
+		g_fFFTResult[i] *= ti_hamming_window_vector[i];
+		g_fFFTResult[NUM_SAMPLES-1-i] *= ti_hamming_window_vector[i];
+	}
 	UARTprintf("Done with Hamming window multiplication\n");
 
 	UARTprintf("Calculating FFT\n");
@@ -746,7 +751,7 @@ SampleSineTest(void)
 //
 // Run the DSP calculations on the input vector.
 //
-// Step 1: multiply vector by hamming window
+// Step 1: center samples around 0 and multiply by hamming window
 // Step 2: get fast fourier transform of samples
 // Step 3: get complex power of each element in fft output
 // Step 4: calculate average power in each LED range of bins
@@ -772,19 +777,19 @@ ProcessData(void)
 	// Ugly, ugly, ugly part where we have to move the ul samples into a float
 	// array because the fixed point fft functions in CMSIS seem to be not
 	// working.  While we're at it, we might as well center the samples around
-	// 0, as the CMSIS algorithm seems to like that.
+	// 0, as the CMSIS algorithm seems to like that, and multiply by the
+	// hamming window.  Only the first half of the window is stored, so each
+	// coefficient is applied to sample i and to its mirror, N-1-i.
 	//
-	for(i=0;i<NUM_SAMPLES;i++)
+	for(i=0;i<NUM_SAMPLES/2;i++)
 	{
-		g_fFFTResult[i] = ((float)g_ulADCValues[i] - (float)0x800);
+		g_fFFTResult[i] = ((float)g_ulADCValues[i] - (float)0x800) *
+						  ti_hamming_window_vector[i];
+		g_fFFTResult[NUM_SAMPLES-1-i] =
+			((float)g_ulADCValues[NUM_SAMPLES-1-i] - (float)0x800) *
+			ti_hamming_window_vector[i];
 	}
 
-	//
-	// Multiply samples by hamming window
-	//
-	arm_mult_f32(g_fFFTResult, ti_hamming_window_vector, g_fFFTResult,
-				 NUM_SAMPLES);
-
 	//
 	// Calculate FFT on samples
 	//
@@ -845,27 +850,21 @@ ProcessData(void)
 	//
 	for(i=0;i<NUM_F_LEDS;i++)
 	{
+		//
+		// Normalize currently observed power by maximum observed power for
+		// this frequency range.  The reciprocal of the maximum is taken once
+		// and scaled so that every whole step of the result, 1/8, 2/8, 3/8,
+		// etc of the maximum, lights one more LED.  The bottom LED is always
+		// lit.
+		//
 		ucDisplay = 0;
-		for(j=0;j<NUM_P_LEDS;j++)
+		if(maxLEDPowers[i] > 0)
 		{
-			//
-			// Normalize currently observed power by maximum observed power for
-			// this frequency range
-			//
-			power = (float)LEDPower[i] / maxLEDPowers[i];
-
-			//
-			// power is now between 0 and 1, so figure out if it's greater than
-			// 1/8, 2/8, 3/8, etc
-			//
-			if(power >= ((float)j * 0.125))
-			{
-				ucDisplay |= (1 << j);
-			}
-			else
-			{
-				break;
-			}
+			power = (float)LEDPower[i] *
+					((float)NUM_P_LEDS / maxLEDPowers[i]);
+			j = (power < (float)(NUM_P_LEDS - 1)) ?
+				((uint32_t)power + 1) : NUM_P_LEDS;
+			ucDisplay = (unsigned char)((1 << j) - 1);
 		}
 		LEDDisplay[i] = ucDisplay;
 	}